@@ -49,4 +49,27 @@
 #endif
 
 
+// Software prefetch hints. T0 fetches the cache line into all cache levels,
+// T1 into L2 and higher, T2 into L3 and higher. NTA fetches data that is going
+// to be used only once, minimizing cache pollution. Prefetches never fault, so
+// the address does not have to be valid.
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define UME_PREFETCH_T0(p)  _mm_prefetch((char const *)(p), _MM_HINT_T0)
+#define UME_PREFETCH_T1(p)  _mm_prefetch((char const *)(p), _MM_HINT_T1)
+#define UME_PREFETCH_T2(p)  _mm_prefetch((char const *)(p), _MM_HINT_T2)
+#define UME_PREFETCH_NTA(p) _mm_prefetch((char const *)(p), _MM_HINT_NTA)
+#elif defined(__GNUC__)
+// ARM, Power and other targets: the locality argument maps 3/2/1 to T0/T1/T2.
+#define UME_PREFETCH_T0(p)  __builtin_prefetch((p), 0, 3)
+#define UME_PREFETCH_T1(p)  __builtin_prefetch((p), 0, 2)
+#define UME_PREFETCH_T2(p)  __builtin_prefetch((p), 0, 1)
+#define UME_PREFETCH_NTA(p) __builtin_prefetch((p), 0, 0)
+#else
+#define UME_PREFETCH_T0(p)  ((void)(p))
+#define UME_PREFETCH_T1(p)  ((void)(p))
+#define UME_PREFETCH_T2(p)  ((void)(p))
+#define UME_PREFETCH_NTA(p) ((void)(p))
+#endif
+
 #endif
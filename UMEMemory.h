@@ -36,6 +36,13 @@
 #include <stdlib.h>
 
 #include <iostream>
+#include <new>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
 
 #include "UMESimd.h"
 #include "UMEInline.h"
@@ -66,6 +73,27 @@
 
 #define ALIGNED_TYPE(type, alignment) typedef type UME_ALIGN(alignment)
 
+// Size from which DynamicMemory::MemCopy and MemSet switch to non-temporal stores.
+// Can also be changed at runtime with DynamicMemory::SetStreamingThreshold().
+#ifndef UME_MEMORY_STREAMING_THRESHOLD
+#define UME_MEMORY_STREAMING_THRESHOLD (8*1024*1024)
+#endif
+
+// Register width used for streaming stores, following the plugin selection in UMESimd.h
+#if !defined(FORCE_SCALAR) && !defined(FORCE_OPENMP) && !defined(__MIC__)
+    #if defined(__AVX512F__)
+        #define UME_MEMORY_STREAM_WIDTH 64
+    #elif defined(__AVX__)
+        #define UME_MEMORY_STREAM_WIDTH 32
+    #elif defined(__SSE2__) || defined(_M_X64)
+        #define UME_MEMORY_STREAM_WIDTH 16
+    #endif
+#endif
+
+#if defined(UME_MEMORY_STREAM_WIDTH)
+#include <immintrin.h>
+#endif
+
 namespace UME
 {
 
@@ -85,9 +113,12 @@ namespace UME
             void* ptr = _aligned_malloc(size, alignment);
             return ptr;
 #elif defined(__GNUC__) || (__ICC) || defined(__INTEL_COMPILER)
-            void* memptr;
+            void* memptr = nullptr;
             //std::cout << "AlignedMalloc: memptr(before):" << memptr;
 
+            // posix_memalign requires a power of two multiple of sizeof(void*)
+            if (alignment < sizeof(void*)) alignment = sizeof(void*);
+
             int retval = 0;
             do 
             {
@@ -120,16 +151,186 @@ namespace UME
 #endif
         }
 
+        // Sized version used by AlignedAllocator. Size and alignment are not needed here.
+        static inline void AlignedFree(void *ptr, std::size_t, std::size_t)
+        {
+            AlignedFree(ptr);
+        }
+
+        // Buffers of at least StreamingThreshold() bytes are written with
+        // non-temporal stores, so that copying them does not evict the cache.
+        static inline std::size_t & StreamingThreshold()
+        {
+            static std::size_t threshold = UME_MEMORY_STREAMING_THRESHOLD;
+            return threshold;
+        }
+        static inline void SetStreamingThreshold(std::size_t threshold)
+        {
+            StreamingThreshold() = threshold;
+        }
+
         static inline void* MemCopy(void *dst, void *src, size_t num)
         {
-            // TODO: specialize it depending on the architecture and OS
+#if defined(UME_MEMORY_STREAM_WIDTH)
+            if (num >= StreamingThreshold()) {
+                StreamCopy((char*)dst, (const char*)src, num);
+                return dst;
+            }
+#endif
             return std::memcpy(dst, src, num);
         }
         static inline void MemSet(void *dst, int ch, std::size_t count)
         {
-            // TODO: specialize it depending on the architecture and OS
+#if defined(UME_MEMORY_STREAM_WIDTH)
+            if (count >= StreamingThreshold()) {
+                StreamSet((char*)dst, ch, count);
+                return;
+            }
+#endif
             std::memset(dst, ch, count);
         }
+
+#if defined(UME_MEMORY_STREAM_WIDTH)
+    private:
+        static const std::size_t STREAM_WIDTH = UME_MEMORY_STREAM_WIDTH;
+        // Four registers are written per iteration
+        static const std::size_t STREAM_STEP = 4 * UME_MEMORY_STREAM_WIDTH;
+
+        // Bytes to copy with scalar code before 'dst' gets vector aligned.
+        static inline std::size_t StreamHead(char *dst, std::size_t num)
+        {
+            std::size_t head = (STREAM_WIDTH - (uintptr_t(dst) & (STREAM_WIDTH - 1))) & (STREAM_WIDTH - 1);
+            return head < num ? head : num;
+        }
+
+        static inline void StreamCopy(char *dst, const char *src, std::size_t num)
+        {
+            std::size_t head = StreamHead(dst, num);
+            std::memcpy(dst, src, head);
+            dst += head;
+            src += head;
+            num -= head;
+
+            std::size_t body = num & ~(STREAM_STEP - 1);
+            bool srcAligned = (uintptr_t(src) & (STREAM_WIDTH - 1)) == 0;
+#if UME_MEMORY_STREAM_WIDTH == 64
+            if (srcAligned) {
+                for (std::size_t i = 0; i < body; i += STREAM_STEP) {
+                    __m512i t0 = _mm512_load_si512((const void*)(src + i));
+                    __m512i t1 = _mm512_load_si512((const void*)(src + i + 64));
+                    __m512i t2 = _mm512_load_si512((const void*)(src + i + 128));
+                    __m512i t3 = _mm512_load_si512((const void*)(src + i + 192));
+                    _mm512_stream_si512((__m512i*)(dst + i), t0);
+                    _mm512_stream_si512((__m512i*)(dst + i + 64), t1);
+                    _mm512_stream_si512((__m512i*)(dst + i + 128), t2);
+                    _mm512_stream_si512((__m512i*)(dst + i + 192), t3);
+                }
+            }
+            else {
+                for (std::size_t i = 0; i < body; i += STREAM_STEP) {
+                    __m512i t0 = _mm512_loadu_si512((const void*)(src + i));
+                    __m512i t1 = _mm512_loadu_si512((const void*)(src + i + 64));
+                    __m512i t2 = _mm512_loadu_si512((const void*)(src + i + 128));
+                    __m512i t3 = _mm512_loadu_si512((const void*)(src + i + 192));
+                    _mm512_stream_si512((__m512i*)(dst + i), t0);
+                    _mm512_stream_si512((__m512i*)(dst + i + 64), t1);
+                    _mm512_stream_si512((__m512i*)(dst + i + 128), t2);
+                    _mm512_stream_si512((__m512i*)(dst + i + 192), t3);
+                }
+            }
+#elif UME_MEMORY_STREAM_WIDTH == 32
+            if (srcAligned) {
+                for (std::size_t i = 0; i < body; i += STREAM_STEP) {
+                    __m256i t0 = _mm256_load_si256((const __m256i*)(src + i));
+                    __m256i t1 = _mm256_load_si256((const __m256i*)(src + i + 32));
+                    __m256i t2 = _mm256_load_si256((const __m256i*)(src + i + 64));
+                    __m256i t3 = _mm256_load_si256((const __m256i*)(src + i + 96));
+                    _mm256_stream_si256((__m256i*)(dst + i), t0);
+                    _mm256_stream_si256((__m256i*)(dst + i + 32), t1);
+                    _mm256_stream_si256((__m256i*)(dst + i + 64), t2);
+                    _mm256_stream_si256((__m256i*)(dst + i + 96), t3);
+                }
+            }
+            else {
+                for (std::size_t i = 0; i < body; i += STREAM_STEP) {
+                    __m256i t0 = _mm256_loadu_si256((const __m256i*)(src + i));
+                    __m256i t1 = _mm256_loadu_si256((const __m256i*)(src + i + 32));
+                    __m256i t2 = _mm256_loadu_si256((const __m256i*)(src + i + 64));
+                    __m256i t3 = _mm256_loadu_si256((const __m256i*)(src + i + 96));
+                    _mm256_stream_si256((__m256i*)(dst + i), t0);
+                    _mm256_stream_si256((__m256i*)(dst + i + 32), t1);
+                    _mm256_stream_si256((__m256i*)(dst + i + 64), t2);
+                    _mm256_stream_si256((__m256i*)(dst + i + 96), t3);
+                }
+            }
+#else
+            if (srcAligned) {
+                for (std::size_t i = 0; i < body; i += STREAM_STEP) {
+                    __m128i t0 = _mm_load_si128((const __m128i*)(src + i));
+                    __m128i t1 = _mm_load_si128((const __m128i*)(src + i + 16));
+                    __m128i t2 = _mm_load_si128((const __m128i*)(src + i + 32));
+                    __m128i t3 = _mm_load_si128((const __m128i*)(src + i + 48));
+                    _mm_stream_si128((__m128i*)(dst + i), t0);
+                    _mm_stream_si128((__m128i*)(dst + i + 16), t1);
+                    _mm_stream_si128((__m128i*)(dst + i + 32), t2);
+                    _mm_stream_si128((__m128i*)(dst + i + 48), t3);
+                }
+            }
+            else {
+                for (std::size_t i = 0; i < body; i += STREAM_STEP) {
+                    __m128i t0 = _mm_loadu_si128((const __m128i*)(src + i));
+                    __m128i t1 = _mm_loadu_si128((const __m128i*)(src + i + 16));
+                    __m128i t2 = _mm_loadu_si128((const __m128i*)(src + i + 32));
+                    __m128i t3 = _mm_loadu_si128((const __m128i*)(src + i + 48));
+                    _mm_stream_si128((__m128i*)(dst + i), t0);
+                    _mm_stream_si128((__m128i*)(dst + i + 16), t1);
+                    _mm_stream_si128((__m128i*)(dst + i + 32), t2);
+                    _mm_stream_si128((__m128i*)(dst + i + 48), t3);
+                }
+            }
+#endif
+            // Make the streaming stores visible before returning
+            _mm_sfence();
+            std::memcpy(dst + body, src + body, num - body);
+        }
+
+        static inline void StreamSet(char *dst, int ch, std::size_t count)
+        {
+            std::size_t head = StreamHead(dst, count);
+            std::memset(dst, ch, head);
+            dst += head;
+            count -= head;
+
+            std::size_t body = count & ~(STREAM_STEP - 1);
+#if UME_MEMORY_STREAM_WIDTH == 64
+            __m512i t0 = _mm512_set1_epi8((char)ch);
+            for (std::size_t i = 0; i < body; i += STREAM_STEP) {
+                _mm512_stream_si512((__m512i*)(dst + i), t0);
+                _mm512_stream_si512((__m512i*)(dst + i + 64), t0);
+                _mm512_stream_si512((__m512i*)(dst + i + 128), t0);
+                _mm512_stream_si512((__m512i*)(dst + i + 192), t0);
+            }
+#elif UME_MEMORY_STREAM_WIDTH == 32
+            __m256i t0 = _mm256_set1_epi8((char)ch);
+            for (std::size_t i = 0; i < body; i += STREAM_STEP) {
+                _mm256_stream_si256((__m256i*)(dst + i), t0);
+                _mm256_stream_si256((__m256i*)(dst + i + 32), t0);
+                _mm256_stream_si256((__m256i*)(dst + i + 64), t0);
+                _mm256_stream_si256((__m256i*)(dst + i + 96), t0);
+            }
+#else
+            __m128i t0 = _mm_set1_epi8((char)ch);
+            for (std::size_t i = 0; i < body; i += STREAM_STEP) {
+                _mm_stream_si128((__m128i*)(dst + i), t0);
+                _mm_stream_si128((__m128i*)(dst + i + 16), t0);
+                _mm_stream_si128((__m128i*)(dst + i + 32), t0);
+                _mm_stream_si128((__m128i*)(dst + i + 48), t0);
+            }
+#endif
+            _mm_sfence();
+            std::memset(dst + body, ch, count - body);
+        }
+#endif
     };
 
 #include "utilities/ignore_warnings_push.h"
@@ -144,40 +345,280 @@ namespace UME
         return to;
     }
     
-    template<class T, int SIMD_STRIDE>
+    // MemoryArena
+    //   Bump allocator for short-lived SIMD scratch buffers. Memory is taken from
+    //   large blocks obtained with DynamicMemory::AlignedMalloc and is released
+    //   all at once by reset(). Individual allocations cannot be freed.
+    //   Blocks of at least HUGE_PAGE_SIZE can optionally be backed by transparent
+    //   huge pages (Linux only, ignored elsewhere).
+    class MemoryArena
+    {
+    public:
+        static const std::size_t DEFAULT_BLOCK_SIZE = 1 << 20;
+        static const std::size_t HUGE_PAGE_SIZE = 1 << 21;
+        // Largest alignment used by SIMDVec types (1024b vectors)
+        static const std::size_t MAX_ALIGNMENT = 128;
+
+        explicit MemoryArena(std::size_t blockSize = DEFAULT_BLOCK_SIZE, bool useHugePages = false) :
+            mHead(nullptr), mCurrent(nullptr), mEnd(nullptr),
+            mBlockSize(blockSize), mUseHugePages(useHugePages) {}
+
+        ~MemoryArena() { release(); }
+
+        MemoryArena(MemoryArena const &) = delete;
+        MemoryArena & operator= (MemoryArena const &) = delete;
+
+        inline void* allocate(std::size_t size, std::size_t alignment)
+        {
+            uintptr_t ptr = alignUp(uintptr_t(mCurrent), alignment);
+            if (mCurrent == nullptr || ptr + size > uintptr_t(mEnd)) {
+                addBlock(size + alignment);
+                ptr = alignUp(uintptr_t(mCurrent), alignment);
+            }
+            mCurrent = (char*)(ptr + size);
+            return (void*)ptr;
+        }
+
+        // Invalidate all allocations. If the arena had to grow, its blocks are
+        // merged into a single one so that the next cycle does not grow again.
+        inline void reset()
+        {
+            if (mHead == nullptr) return;
+            if (mHead->next == nullptr) {
+                mCurrent = blockBegin(mHead);
+                return;
+            }
+            std::size_t total = 0;
+            for (Block* block = mHead; block != nullptr; block = block->next) total += block->size;
+            release();
+            addBlock(total);
+        }
+
+        // Return all blocks to the system.
+        inline void release()
+        {
+            while (mHead != nullptr) {
+                Block* next = mHead->next;
+                DynamicMemory::AlignedFree(mHead);
+                mHead = next;
+            }
+            mCurrent = nullptr;
+            mEnd = nullptr;
+        }
+
+        // Number of bytes handed out from the current block.
+        inline std::size_t used() const
+        {
+            return mHead != nullptr ? std::size_t(mCurrent - blockBegin(mHead)) : 0;
+        }
+
+        // Arena owned by the calling thread.
+        static inline MemoryArena & threadLocal()
+        {
+            static thread_local MemoryArena arena;
+            return arena;
+        }
+
+    private:
+        struct Block {
+            Block* next;
+            std::size_t size;
+        };
+
+        Block* mHead;
+        char* mCurrent;
+        char* mEnd;
+        std::size_t mBlockSize;
+        bool mUseHugePages;
+
+        static inline uintptr_t alignUp(uintptr_t value, std::size_t alignment)
+        {
+            return (value + alignment - 1) & ~uintptr_t(alignment - 1);
+        }
+
+        static inline char* blockBegin(Block* block)
+        {
+            return (char*)block + alignUp(sizeof(Block), MAX_ALIGNMENT);
+        }
+
+        inline void addBlock(std::size_t minSize)
+        {
+            std::size_t size = alignUp(sizeof(Block), MAX_ALIGNMENT) + minSize;
+            if (size < mBlockSize) size = mBlockSize;
+
+            std::size_t blockAlignment = MAX_ALIGNMENT;
+            bool hugePages = mUseHugePages && size >= HUGE_PAGE_SIZE;
+            if (hugePages) {
+                size = alignUp(size, HUGE_PAGE_SIZE);
+                blockAlignment = HUGE_PAGE_SIZE;
+            }
+
+            Block* block = (Block*)DynamicMemory::AlignedMalloc(size, blockAlignment);
+            if (block == nullptr) throw std::bad_alloc();
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+            if (hugePages) madvise(block, size, MADV_HUGEPAGE);
+#endif
+            block->next = mHead;
+            block->size = size;
+            mHead = block;
+            mCurrent = blockBegin(block);
+            mEnd = (char*)block + size;
+        }
+    };
+
+    // MemoryPool
+    //   Size-class allocator. Requests up to MAX_POOLED_SIZE bytes are rounded up
+    //   to a power of two and served from per-class free lists refilled from an
+    //   internal MemoryArena. Larger requests go to DynamicMemory::AlignedMalloc.
+    //   Memory has to be returned to the pool it came from, with the same size.
+    class MemoryPool
+    {
+    public:
+        static const std::size_t MIN_POOLED_SIZE = 64;
+        static const std::size_t MAX_POOLED_SIZE = 1 << 16;
+        static const int SIZE_CLASS_COUNT = 11; // 64B to 64kB
+
+        explicit MemoryPool(std::size_t blockSize = MemoryArena::DEFAULT_BLOCK_SIZE, bool useHugePages = false) :
+            mArena(blockSize, useHugePages)
+        {
+            for (int i = 0; i < SIZE_CLASS_COUNT; i++) mFreeLists[i] = nullptr;
+        }
+
+        MemoryPool(MemoryPool const &) = delete;
+        MemoryPool & operator= (MemoryPool const &) = delete;
+
+        inline void* allocate(std::size_t size, std::size_t alignment)
+        {
+            std::size_t classSize = size > alignment ? size : alignment;
+            if (classSize > MAX_POOLED_SIZE || alignment > MemoryArena::MAX_ALIGNMENT) {
+                void* ptr = DynamicMemory::AlignedMalloc(size, alignment);
+                if (ptr == nullptr) throw std::bad_alloc();
+                return ptr;
+            }
+            int sizeClass = getSizeClass(classSize);
+            FreeNode* node = mFreeLists[sizeClass];
+            if (node != nullptr) {
+                mFreeLists[sizeClass] = node->next;
+                return node;
+            }
+            // Each block is aligned to its size, up to the largest SIMD alignment
+            std::size_t blockSize = MIN_POOLED_SIZE << sizeClass;
+            std::size_t blockAlignment = MemoryArena::MAX_ALIGNMENT;
+            if (blockSize < blockAlignment) blockAlignment = blockSize;
+            return mArena.allocate(blockSize, blockAlignment);
+        }
+
+        inline void deallocate(void* ptr, std::size_t size, std::size_t alignment)
+        {
+            if (ptr == nullptr) return;
+            std::size_t classSize = size > alignment ? size : alignment;
+            if (classSize > MAX_POOLED_SIZE || alignment > MemoryArena::MAX_ALIGNMENT) {
+                DynamicMemory::AlignedFree(ptr);
+                return;
+            }
+            int sizeClass = getSizeClass(classSize);
+            FreeNode* node = (FreeNode*)ptr;
+            node->next = mFreeLists[sizeClass];
+            mFreeLists[sizeClass] = node;
+        }
+
+        // Pool owned by the calling thread.
+        static inline MemoryPool & threadLocal()
+        {
+            static thread_local MemoryPool pool;
+            return pool;
+        }
+
+    private:
+        struct FreeNode {
+            FreeNode* next;
+        };
+
+        MemoryArena mArena;
+        FreeNode* mFreeLists[SIZE_CLASS_COUNT];
+
+        static inline int getSizeClass(std::size_t size)
+        {
+            int sizeClass = 0;
+            std::size_t classSize = MIN_POOLED_SIZE;
+            while (classSize < size) {
+                classSize <<= 1;
+                sizeClass++;
+            }
+            return sizeClass;
+        }
+    };
+
+    // Memory sources for AlignedAllocator. Both use the calling thread's
+    // instance, so containers using them should not outlive or migrate from
+    // the thread that created them.
+    struct ArenaMemory
+    {
+        static inline void* AlignedMalloc(std::size_t size, std::size_t alignment)
+        {
+            return MemoryArena::threadLocal().allocate(size, alignment);
+        }
+        // Arena memory is reclaimed by MemoryArena::threadLocal().reset()
+        static inline void AlignedFree(void *ptr, std::size_t size, std::size_t alignment) {}
+    };
+
+    struct PoolMemory
+    {
+        static inline void* AlignedMalloc(std::size_t size, std::size_t alignment)
+        {
+            return MemoryPool::threadLocal().allocate(size, alignment);
+        }
+        static inline void AlignedFree(void *ptr, std::size_t size, std::size_t alignment)
+        {
+            MemoryPool::threadLocal().deallocate(ptr, size, alignment);
+        }
+    };
+
+    // STL-compatible allocator returning memory aligned for SIMDVec<T, SIMD_STRIDE>.
+    // MEMORY selects where memory comes from: DynamicMemory (default),
+    // ArenaMemory or PoolMemory.
+    template<class T, int SIMD_STRIDE, class MEMORY = DynamicMemory>
     struct AlignedAllocator {
+        typedef T value_type;
+        template <class U> struct rebind { typedef AlignedAllocator<U, SIMD_STRIDE, MEMORY> other; };
+
         AlignedAllocator() {}
-        template <class U> AlignedAllocator(const AlignedAllocator<U, SIMD_STRIDE> & other) {}
+        template <class U> AlignedAllocator(const AlignedAllocator<U, SIMD_STRIDE, MEMORY> & other) {}
         T* allocate(std::size_t n) {
             int alignment = UME::SIMD::SIMDVec<T, SIMD_STRIDE>::alignment();
-            return (T*)DynamicMemory::AlignedMalloc(n, alignment);
+            return (T*)MEMORY::AlignedMalloc(n*sizeof(T), alignment);
         }
         void deallocate(T* p, std::size_t n) {
-            DynamicMemory::AlignedFree(p);
+            int alignment = UME::SIMD::SIMDVec<T, SIMD_STRIDE>::alignment();
+            MEMORY::AlignedFree(p, n*sizeof(T), alignment);
         }
     };
     
     // Specialize for bool
-    template<int SIMD_STRIDE>
-    struct AlignedAllocator<bool, SIMD_STRIDE> {
+    template<int SIMD_STRIDE, class MEMORY>
+    struct AlignedAllocator<bool, SIMD_STRIDE, MEMORY> {
+        typedef bool value_type;
+        template <class U> struct rebind { typedef AlignedAllocator<U, SIMD_STRIDE, MEMORY> other; };
+
         AlignedAllocator() {}
-        template <class U> AlignedAllocator(const AlignedAllocator<U, SIMD_STRIDE> & other) {}
+        template <class U> AlignedAllocator(const AlignedAllocator<U, SIMD_STRIDE, MEMORY> & other) {}
         bool* allocate(std::size_t n) {
             int alignment = UME::SIMD::SIMDVecMask<SIMD_STRIDE>::alignment();
-            return (bool*)DynamicMemory::AlignedMalloc(n, alignment);
+            return (bool*)MEMORY::AlignedMalloc(n*sizeof(bool), alignment);
         }
         void deallocate(bool* p, std::size_t n) {
-            DynamicMemory::AlignedFree(p);
+            int alignment = UME::SIMD::SIMDVecMask<SIMD_STRIDE>::alignment();
+            MEMORY::AlignedFree(p, n*sizeof(bool), alignment);
         }
     };
     
-    template <class T, class U, int SIMD_STRIDE1, int SIMD_STRIDE2>
-    bool operator==(const AlignedAllocator<T, SIMD_STRIDE1>&, const AlignedAllocator<U, SIMD_STRIDE2>&) {
-        return std::is_same<T, U>::value && (SIMD_STRIDE1 == SIMD_STRIDE2);
+    template <class T, class U, int SIMD_STRIDE1, int SIMD_STRIDE2, class MEMORY1, class MEMORY2>
+    bool operator==(const AlignedAllocator<T, SIMD_STRIDE1, MEMORY1>&, const AlignedAllocator<U, SIMD_STRIDE2, MEMORY2>&) {
+        return std::is_same<T, U>::value && (SIMD_STRIDE1 == SIMD_STRIDE2) && std::is_same<MEMORY1, MEMORY2>::value;
     }
-    template <class T, class U, int SIMD_STRIDE1, int SIMD_STRIDE2>
-    bool operator!=(const AlignedAllocator<T, SIMD_STRIDE1>&, const AlignedAllocator<U, SIMD_STRIDE2>&) {
-        return !(std::is_same<T, U>::value && (SIMD_STRIDE1 == SIMD_STRIDE2));
+    template <class T, class U, int SIMD_STRIDE1, int SIMD_STRIDE2, class MEMORY1, class MEMORY2>
+    bool operator!=(const AlignedAllocator<T, SIMD_STRIDE1, MEMORY1>&, const AlignedAllocator<U, SIMD_STRIDE2, MEMORY2>&) {
+        return !(std::is_same<T, U>::value && (SIMD_STRIDE1 == SIMD_STRIDE2) && std::is_same<MEMORY1, MEMORY2>::value);
     }
 #include "utilities/ignore_warnings_pop.h"
     
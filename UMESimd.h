@@ -38,6 +38,10 @@
 
 #include <iostream>
 
+// Runtime dispatch support. In multiversioned translation units (UME_SIMD_MULTIVERSION)
+// this also renames the 'UME' namespace, so it has to be included first.
+#include "UMESimdDispatch.h"
+
 #include "UMEBasicTypes.h"
 
 // Always include emulated vector types, so that plugins can use them to emulate unsupported types.
@@ -144,6 +148,8 @@ namespace SIMD {
     #include "plugins/UMESimdPluginScalarEmulation.h"
 #elif defined FORCE_OPENMP
     #include "plugins/UMESimdPluginOpenMP.h"
+#elif defined FORCE_VECTOR_EXT
+    #include "plugins/UMESimdPluginVectorExt.h"
 #else
     #if defined __AVX512F__
         #include "plugins/UMESimdPluginAVX512.h"
@@ -153,6 +159,8 @@ namespace SIMD {
         #include "plugins/UMESimdPluginAVX2.h"
     #elif defined __AVX__
         #include "plugins/UMESimdPluginAVX.h"
+    #elif defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #include "plugins/UMESimdPluginSSE.h"
     #elif defined (__aarch64__) || defined (__arm__)
         #include "plugins/UMESimdPluginARM.h"
     #elif defined (__ALTIVEC__)
@@ -0,0 +1,308 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+
+#ifndef UME_SIMD_DISPATCH_H_
+#define UME_SIMD_DISPATCH_H_
+
+// ************************************************************************************************
+//  Runtime instruction set dispatch.
+//
+//    The plugin used by 'UMESimd.h' is selected at compile time from the instruction set flags
+//  passed to the compiler. To ship a single binary that uses the widest instruction set available
+//  on the executing host, a kernel can be compiled several times (once per plugin) and the best
+//  version selected at runtime:
+//
+//    1. Kernel translation unit (compiled once with each of: no ISA flags, -mavx, -mavx2
+//       and -mavx512f, or equivalent). Without ISA flags x86-64 compilers still enable SSE2,
+//       so the baseline version uses the SSE plugin there, and the scalar plugin elsewhere:
+//
+//          #define UME_SIMD_MULTIVERSION
+//          #include "UMESimd.h"
+//
+//          namespace UME_SIMD_ISA_NAMESPACE {
+//              float sum(float const * p, int n) { ... uses UME::SIMD types ... }
+//          }
+//
+//       With UME_SIMD_MULTIVERSION defined, the 'UME' namespace is renamed per instruction set
+//       so that the library code instantiated in each translation unit does not collide (ODR)
+//       with the versions compiled for other instruction sets.
+//
+//    2. Dispatching translation unit (compiled with baseline flags):
+//
+//          #include "UMESimdDispatch.h"
+//
+//          UME_SIMD_MULTIVERSION_DECLARE(float, sum, (float const *, int));
+//
+//          float sum(float const * p, int n) {
+//              static auto f = UME_SIMD_MULTIVERSION_SELECT(sum);
+//              return f(p, n);
+//          }
+//
+//    CPU features are queried only once. After the first call a kernel invocation costs a
+//  single indirect call. Setting the 'UME_SIMD_MAX_ISA' environment variable to one of
+//  'scalar', 'avx', 'avx2' or 'avx512' limits the selection, which is useful for testing.
+//
+//    Note: templates from outside of the UME namespace (e.g. 'std::sort<float*>') instantiated
+//  in several kernel translation units are still merged by the linker. Such code should not be
+//  used in kernels compiled for wider instruction sets.
+// ************************************************************************************************
+
+#include <cstdlib>
+#include <cstring>
+
+#include "UMEBasicTypes.h"
+#include "UMEInline.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define UME_SIMD_DISPATCH_X86 1
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #elif defined(__GNUC__) || defined(__clang__) || defined(__INTEL_COMPILER)
+        #include <cpuid.h>
+    #endif
+#endif
+
+// Instruction set identifiers. The order reflects preference: higher value is preferred.
+#define UME_SIMD_ISA_SCALAR 0
+#define UME_SIMD_ISA_AVX    1
+#define UME_SIMD_ISA_AVX2   2
+#define UME_SIMD_ISA_AVX512 3
+#define UME_SIMD_ISA_COUNT  4
+
+// Instruction set of the plugin selected by 'UMESimd.h' for the current translation unit.
+// This has to follow the plugin selection order in 'UMESimd.h'.
+#if defined FORCE_SCALAR || defined FORCE_OPENMP || defined FORCE_VECTOR_EXT
+    #define UME_SIMD_COMPILED_ISA  UME_SIMD_ISA_SCALAR
+    #define UME_SIMD_ISA_NAMESPACE ume_isa_scalar
+#elif defined __AVX512F__
+    #define UME_SIMD_COMPILED_ISA  UME_SIMD_ISA_AVX512
+    #define UME_SIMD_ISA_NAMESPACE ume_isa_avx512
+#elif defined __AVX2__
+    #define UME_SIMD_COMPILED_ISA  UME_SIMD_ISA_AVX2
+    #define UME_SIMD_ISA_NAMESPACE ume_isa_avx2
+#elif defined __AVX__
+    #define UME_SIMD_COMPILED_ISA  UME_SIMD_ISA_AVX
+    #define UME_SIMD_ISA_NAMESPACE ume_isa_avx
+#else
+    // Scalar plugin, or the SSE plugin when SSE2 is part of the baseline instruction set.
+    #define UME_SIMD_COMPILED_ISA  UME_SIMD_ISA_SCALAR
+    #define UME_SIMD_ISA_NAMESPACE ume_isa_scalar
+#endif
+
+// Rename the library namespace in multiversioned translation units. This has to happen before
+// any other UME header opens the namespace.
+#if defined(UME_SIMD_MULTIVERSION) && !defined(UME)
+    #if UME_SIMD_COMPILED_ISA == UME_SIMD_ISA_AVX512
+        #define UME UME_isa_avx512
+    #elif UME_SIMD_COMPILED_ISA == UME_SIMD_ISA_AVX2
+        #define UME UME_isa_avx2
+    #elif UME_SIMD_COMPILED_ISA == UME_SIMD_ISA_AVX
+        #define UME UME_isa_avx
+    #else
+        #define UME UME_isa_scalar
+    #endif
+#endif
+
+namespace UME
+{
+namespace SIMD
+{
+    // Runtime CPU feature query. Only features relevant for plugin selection are listed.
+    struct CPUFeatures
+    {
+        bool sse2;
+        bool sse3;
+        bool ssse3;
+        bool sse41;
+        bool sse42;
+        bool avx;
+        bool fma;
+        bool avx2;
+        bool avx512f;
+        bool avx512cd;
+        bool avx512bw;
+        bool avx512dq;
+        bool avx512vl;
+
+        // Query the executing CPU. Operating system support for extended register state
+        // (XSAVE/XGETBV) is verified, so a feature is only reported when it can be used.
+        static CPUFeatures query() {
+            CPUFeatures f;
+            std::memset(&f, 0, sizeof(f));
+#if defined(UME_SIMD_DISPATCH_X86)
+            uint32_t regs[4];
+            cpuid(regs, 0, 0);
+            uint32_t maxLeaf = regs[0];
+
+            if (maxLeaf < 1) return f;
+            cpuid(regs, 1, 0);
+            f.sse2  = (regs[3] & (1u << 26)) != 0;
+            f.sse3  = (regs[2] & (1u << 0)) != 0;
+            f.ssse3 = (regs[2] & (1u << 9)) != 0;
+            f.sse41 = (regs[2] & (1u << 19)) != 0;
+            f.sse42 = (regs[2] & (1u << 20)) != 0;
+            bool osxsave = (regs[2] & (1u << 27)) != 0;
+            bool cpuAvx  = (regs[2] & (1u << 28)) != 0;
+            bool cpuFma  = (regs[2] & (1u << 12)) != 0;
+
+            // XCR0: bits 1,2 - SSE/AVX state, bits 5,6,7 - opmask/ZMM state
+            uint64_t xcr0 = osxsave ? xgetbv0() : 0;
+            bool osAvx    = (xcr0 & 0x06) == 0x06;
+            bool osAvx512 = (xcr0 & 0xE6) == 0xE6;
+
+            f.avx = cpuAvx && osAvx;
+            f.fma = cpuFma && osAvx;
+
+            if (maxLeaf < 7) return f;
+            cpuid(regs, 7, 0);
+            f.avx2     = osAvx && ((regs[1] & (1u << 5)) != 0);
+            f.avx512f  = osAvx512 && ((regs[1] & (1u << 16)) != 0);
+            f.avx512dq = f.avx512f && ((regs[1] & (1u << 17)) != 0);
+            f.avx512cd = f.avx512f && ((regs[1] & (1u << 28)) != 0);
+            f.avx512bw = f.avx512f && ((regs[1] & (1u << 30)) != 0);
+            f.avx512vl = f.avx512f && ((regs[1] & (1u << 31)) != 0);
+#endif
+            return f;
+        }
+
+    private:
+#if defined(UME_SIMD_DISPATCH_X86)
+        static UME_FORCE_INLINE void cpuid(uint32_t regs[4], uint32_t leaf, uint32_t subleaf) {
+#if defined(_MSC_VER)
+            int r[4];
+            __cpuidex(r, int(leaf), int(subleaf));
+            for (int i = 0; i < 4; i++) regs[i] = uint32_t(r[i]);
+#else
+            __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+        }
+
+        static UME_FORCE_INLINE uint64_t xgetbv0() {
+#if defined(_MSC_VER)
+            return uint64_t(_xgetbv(0));
+#else
+            uint32_t eax, edx;
+            __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+            return (uint64_t(edx) << 32) | eax;
+#endif
+        }
+#endif
+    };
+
+    class RuntimeISA
+    {
+    public:
+        // Features of the executing CPU. Queried once, on first use.
+        static CPUFeatures const & features() {
+            static const CPUFeatures f = CPUFeatures::query();
+            return f;
+        }
+
+        // Widest instruction set, for which a plugin exists, supported by the executing CPU.
+        static int best() {
+            static const int isa = selectBest();
+            return isa;
+        }
+
+        // Check if code compiled for 'isa' can be executed.
+        static bool supports(int isa) {
+            CPUFeatures const & f = features();
+            switch (isa) {
+            case UME_SIMD_ISA_SCALAR: return true;
+            case UME_SIMD_ISA_AVX:    return f.avx;
+            // The AVX2 plugin is also compiled with FMA enabled.
+            case UME_SIMD_ISA_AVX2:   return f.avx2 && f.fma;
+            case UME_SIMD_ISA_AVX512: return f.avx512f;
+            default:                  return false;
+            }
+        }
+
+        static const char* name(int isa) {
+            switch (isa) {
+            case UME_SIMD_ISA_SCALAR: return "scalar";
+            case UME_SIMD_ISA_AVX:    return "avx";
+            case UME_SIMD_ISA_AVX2:   return "avx2";
+            case UME_SIMD_ISA_AVX512: return "avx512";
+            default:                  return "unknown";
+            }
+        }
+
+    private:
+        static int selectBest() {
+            int limit = UME_SIMD_ISA_COUNT - 1;
+            const char* env = std::getenv("UME_SIMD_MAX_ISA");
+            if (env != nullptr) {
+                for (int i = 0; i < UME_SIMD_ISA_COUNT; i++) {
+                    if (std::strcmp(env, name(i)) == 0) limit = i;
+                }
+            }
+            for (int i = limit; i > UME_SIMD_ISA_SCALAR; i--) {
+                if (supports(i)) return i;
+            }
+            return UME_SIMD_ISA_SCALAR;
+        }
+    };
+
+    // Select one of the function versions, using the widest instruction set supported
+    // by the executing CPU. Versions not provided (nullptr) are skipped.
+    template<typename FUNC_PTR_T>
+    FUNC_PTR_T selectISAFunction(
+        FUNC_PTR_T scalarFunc,
+        FUNC_PTR_T avxFunc,
+        FUNC_PTR_T avx2Func,
+        FUNC_PTR_T avx512Func)
+    {
+        FUNC_PTR_T table[UME_SIMD_ISA_COUNT] = { scalarFunc, avxFunc, avx2Func, avx512Func };
+        for (int i = RuntimeISA::best(); i > UME_SIMD_ISA_SCALAR; i--) {
+            if (table[i] != nullptr) return table[i];
+        }
+        return scalarFunc;
+    }
+}
+}
+
+// Declare all versions of a multiversioned function. Each version has to be defined in a separate
+// translation unit, inside of 'UME_SIMD_ISA_NAMESPACE'.
+#define UME_SIMD_MULTIVERSION_DECLARE(RETURN_TYPE, FUNC_NAME, ARGS) \
+    namespace ume_isa_scalar { RETURN_TYPE FUNC_NAME ARGS; } \
+    namespace ume_isa_avx    { RETURN_TYPE FUNC_NAME ARGS; } \
+    namespace ume_isa_avx2   { RETURN_TYPE FUNC_NAME ARGS; } \
+    namespace ume_isa_avx512 { RETURN_TYPE FUNC_NAME ARGS; }
+
+// Returns the pointer to the best version of a function declared with UME_SIMD_MULTIVERSION_DECLARE.
+#define UME_SIMD_MULTIVERSION_SELECT(FUNC_NAME) \
+    UME::SIMD::selectISAFunction( \
+        &ume_isa_scalar::FUNC_NAME, \
+        &ume_isa_avx::FUNC_NAME, \
+        &ume_isa_avx2::FUNC_NAME, \
+        &ume_isa_avx512::FUNC_NAME)
+
+#endif
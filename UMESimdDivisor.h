@@ -0,0 +1,163 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+
+#ifndef UME_SIMD_DIVISOR_H_
+#define UME_SIMD_DIVISOR_H_
+
+#include "UMEInline.h"
+#include "UMEBasicTypes.h"
+
+namespace UME
+{
+namespace SIMD
+{
+    // SIMDDivisor
+    //   Integer divisor with precomputed reciprocal. Division of a vector by a
+    //   divisor which is constant for many iterations can be replaced with
+    //   a high-half multiplication and shifts, which are much cheaper than
+    //   hardware division (and available in SIMD instruction sets that have
+    //   no integer division at all). Create the divisor once, outside of the
+    //   loop, and pass it to DIV/REM operations:
+    //
+    //      SIMDDivisor<uint32_t> d(HIST_SIZE);
+    //      for (...) {
+    //          bin = values.rem(d);
+    //      }
+    //
+    //   Magic numbers are only computed for 32-bit types. Other types store
+    //   the divisor and fall back to regular division. As with scalar code,
+    //   the divisor cannot be zero.
+    template<typename SCALAR_T>
+    class SIMDDivisor {
+        SCALAR_T mDivisor;
+    public:
+        explicit SIMDDivisor(SCALAR_T d) : mDivisor(d) {}
+
+        UME_FORCE_INLINE SCALAR_T divisor() const { return mDivisor; }
+        UME_FORCE_INLINE SCALAR_T divide(SCALAR_T n) const { return n / mDivisor; }
+        UME_FORCE_INLINE SCALAR_T remainder(SCALAR_T n) const { return n % mDivisor; }
+    };
+
+    namespace details
+    {
+        UME_FORCE_INLINE uint32_t floorLog2(uint32_t x) {
+            uint32_t retval = 0;
+            while (x >>= 1) retval++;
+            return retval;
+        }
+    }
+
+    // Unsigned division, round-up variant (Granlund & Montgomery):
+    //   l = ceil(log2(d)), m = floor(2^32 * (2^l - d) / d) + 1
+    //   t = mulhi(m, n)
+    //   q = (t + ((n - t) >> shift1)) >> shift2
+    // with shift1 = min(l, 1) and shift2 = max(l - 1, 0). There is no special
+    // case for any divisor, so vector code doesn't need to branch.
+    template<>
+    class SIMDDivisor<uint32_t> {
+        uint32_t mDivisor;
+        uint32_t mMagic;
+        uint32_t mShift1;
+        uint32_t mShift2;
+    public:
+        explicit SIMDDivisor(uint32_t d) : mDivisor(d) {
+            uint32_t l = details::floorLog2(d);
+            if ((d & (d - 1)) != 0) l++;
+            mMagic = uint32_t(((((uint64_t(1) << l) - d) << 32) / d) + 1);
+            mShift1 = l > 0 ? 1 : 0;
+            mShift2 = l > 0 ? l - 1 : 0;
+        }
+
+        UME_FORCE_INLINE uint32_t divisor() const { return mDivisor; }
+        UME_FORCE_INLINE uint32_t magic() const { return mMagic; }
+        UME_FORCE_INLINE uint32_t shift1() const { return mShift1; }
+        UME_FORCE_INLINE uint32_t shift2() const { return mShift2; }
+
+        UME_FORCE_INLINE uint32_t divide(uint32_t n) const {
+            uint32_t t = uint32_t((uint64_t(mMagic) * n) >> 32);
+            return (t + ((n - t) >> mShift1)) >> mShift2;
+        }
+        UME_FORCE_INLINE uint32_t remainder(uint32_t n) const {
+            return n - divide(n) * mDivisor;
+        }
+    };
+
+    // Signed division, computed for |d| and corrected for sign:
+    //   k = floor(log2(|d|)), m = floor(2^(32+k) / |d|) + 1 (0 if |d| is a power of 2)
+    //   q = mulhi(m, n) + n
+    //   q = (q + ((q >> 31) & c)) >> k      (round toward zero)
+    // where c = 2^k - 1 for powers of 2 and 2^k otherwise.
+    //   q = (q ^ sign) - sign
+    // 'm' doesn't fit in int32_t, so it is stored as m - 2^32, and 'n'
+    // is added back after the signed multiplication.
+    template<>
+    class SIMDDivisor<int32_t> {
+        int32_t mDivisor;
+        int32_t mMagic;
+        uint32_t mShift;
+        int32_t mMask;
+        int32_t mSign;
+    public:
+        explicit SIMDDivisor(int32_t d) : mDivisor(d) {
+            uint32_t absD = d < 0 ? uint32_t(0) - uint32_t(d) : uint32_t(d);
+            mShift = details::floorLog2(absD);
+            if ((absD & (absD - 1)) == 0) {
+                mMagic = 0;
+                mMask = int32_t((uint32_t(1) << mShift) - 1);
+            }
+            else {
+                mMagic = int32_t(uint32_t(((uint64_t(1) << (32 + mShift)) / absD) + 1));
+                mMask = int32_t(uint32_t(1) << mShift);
+            }
+            mSign = d < 0 ? -1 : 0;
+        }
+
+        UME_FORCE_INLINE int32_t divisor() const { return mDivisor; }
+        UME_FORCE_INLINE int32_t magic() const { return mMagic; }
+        UME_FORCE_INLINE uint32_t shift() const { return mShift; }
+        UME_FORCE_INLINE int32_t mask() const { return mMask; }
+        UME_FORCE_INLINE int32_t sign() const { return mSign; }
+
+        UME_FORCE_INLINE int32_t divide(int32_t n) const {
+            int32_t q = int32_t((int64_t(mMagic) * n) >> 32);
+            q = int32_t(uint32_t(q) + uint32_t(n));
+            q += (q >> 31) & mMask;
+            q >>= mShift;
+            return int32_t((uint32_t(q) ^ uint32_t(mSign)) - uint32_t(mSign));
+        }
+        UME_FORCE_INLINE int32_t remainder(int32_t n) const {
+            return int32_t(uint32_t(n) - uint32_t(divide(n)) * uint32_t(mDivisor));
+        }
+    };
+}
+}
+
+#endif
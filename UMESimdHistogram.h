@@ -0,0 +1,214 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_HISTOGRAM_H_
+#define UME_SIMD_HISTOGRAM_H_
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "UMESimd.h"
+
+namespace UME
+{
+namespace SIMD
+{
+    namespace details
+    {
+        // Histograms with up to this many bins per lane give every lane its
+        // own copy of the bins, so that the copies of all threads still fit
+        // in a private cache.
+        const uint32_t HISTOGRAM_LANE_PRIVATE_LIMIT = 4096;
+        // Minimum number of elements worth starting a thread for.
+        const uint32_t HISTOGRAM_MIN_THREAD_CHUNK = 65536;
+
+        // Counts data[begin, end) into 'table'. 'begin' has to be a multiple
+        // of VEC_LEN; a partial last vector is processed under a mask, with
+        // the indices of inactive lanes replaced by 0 so that they stay
+        // inside the table.
+        template<uint32_t VEC_LEN, typename SCALAR_T, typename BIN_FUNC>
+        void histogramChunk(
+            SCALAR_T const * data,
+            uint32_t begin,
+            uint32_t end,
+            uint32_t * table,
+            bool lanePrivate,
+            BIN_FUNC const & binFunc)
+        {
+            typedef SIMDVec<SCALAR_T, VEC_LEN> DATA_VEC_T;
+            typedef SIMDVec<uint32_t, VEC_LEN> UINT_VEC_T;
+            typedef SIMDVecMask<VEC_LEN>       MASK_T;
+
+            uint32_t raw[VEC_LEN];
+            for (uint32_t i = 0; i < VEC_LEN; i++) raw[i] = i;
+
+            DATA_VEC_T x(SCALAR_T(0));
+            UINT_VEC_T one(uint32_t(1));
+            UINT_VEC_T lane(raw);
+
+            uint32_t i = begin;
+            if (lanePrivate) {
+                // Bin 'b' of lane 'l' is table[b * VEC_LEN + l]. Lanes never
+                // share an entry, so a plain gather, add and scatter is safe.
+                UINT_VEC_T t1;
+                for (; i + VEC_LEN <= end; i += VEC_LEN) {
+                    x.load(data + i);
+                    UINT_VEC_T t0 = binFunc(x).mul(VEC_LEN).add(lane);
+                    t1.gather(table, t0);
+                    t1.adda(one);
+                    t1.scatter(table, t0);
+                }
+                if (i < end) {
+                    MASK_T m = MASK_T::prefix(end - i);
+                    x.loadn(end - i, data + i);
+                    UINT_VEC_T t0 = UINT_VEC_T(uint32_t(0)).blend(m, binFunc(x)).mul(VEC_LEN).add(lane);
+                    t1.gather(table, t0);
+                    t1.adda(m, one);
+                    t1.scatter(table, t0);
+                }
+            }
+            else {
+                for (; i + VEC_LEN <= end; i += VEC_LEN) {
+                    x.load(data + i);
+                    one.scatteradd(table, binFunc(x));
+                }
+                if (i < end) {
+                    MASK_T m = MASK_T::prefix(end - i);
+                    x.loadn(end - i, data + i);
+                    one.scatteradd(m, table, UINT_VEC_T(uint32_t(0)).blend(m, binFunc(x)));
+                }
+            }
+        }
+    }
+
+    // histogram
+    //   Counts 'count' elements of 'data' into 'binCount' bins, adding the
+    //   counts to 'hist'. 'binFunc' maps a vector of data to a vector of bin
+    //   indices, each smaller than 'binCount'. It is called concurrently from
+    //   several threads, and on partially filled vectors with zeros in the
+    //   unused lanes.
+    //
+    //   Example:
+    //      struct Binning {
+    //          SIMDVec<uint32_t, 8> operator() (SIMDVec<float, 8> const & x) const {
+    //              return SIMDVec<uint32_t, 8>(x.mul(0.1f).trunc());
+    //          }
+    //      };
+    //      histogram<8>(data, count, hist, 100, Binning());
+    //
+    //   The input is split between 'threadCount' threads, the hardware
+    //   concurrency by default. Every thread counts its part into a private
+    //   sub-histogram, which removes all write sharing, and the sub-histograms
+    //   are merged with vector adds once all threads are done. For small
+    //   'binCount' every lane also gets a private copy of the bins. Otherwise
+    //   there is one copy per thread, updated with scatteradd.
+    template<uint32_t VEC_LEN, typename SCALAR_T, typename BIN_FUNC>
+    void histogram(
+        SCALAR_T const * data,
+        uint32_t count,
+        uint32_t * hist,
+        uint32_t binCount,
+        BIN_FUNC const & binFunc,
+        uint32_t threadCount = 0)
+    {
+        typedef SIMDVec<uint32_t, VEC_LEN> UINT_VEC_T;
+
+        if (threadCount == 0) threadCount = std::max(1u, std::thread::hardware_concurrency());
+        threadCount = std::max(1u, std::min(threadCount, count / details::HISTOGRAM_MIN_THREAD_CHUNK));
+
+        bool lanePrivate = binCount <= details::HISTOGRAM_LANE_PRIVATE_LIMIT;
+        // Table size padded to full vectors.
+        uint32_t tableSize = lanePrivate ? binCount * VEC_LEN : ((binCount + VEC_LEN - 1) / VEC_LEN) * VEC_LEN;
+        // Thread chunk size rounded up to full vectors.
+        uint32_t chunk = (((count + threadCount - 1) / threadCount + VEC_LEN - 1) / VEC_LEN) * VEC_LEN;
+
+        std::vector<uint32_t*> tables(threadCount);
+        for (uint32_t t = 0; t < threadCount; t++) {
+            tables[t] = (uint32_t *)UME::DynamicMemory::AlignedMalloc(tableSize * sizeof(uint32_t), UINT_VEC_T::alignment());
+            std::memset(tables[t], 0, tableSize * sizeof(uint32_t));
+        }
+
+        std::vector<std::thread> threads;
+        for (uint32_t t = 1; t < threadCount; t++) {
+            uint32_t begin = std::min(count, t * chunk);
+            uint32_t end = std::min(count, begin + chunk);
+            uint32_t * table = tables[t];
+            threads.push_back(std::thread([=, &binFunc]() {
+                details::histogramChunk<VEC_LEN>(data, begin, end, table, lanePrivate, binFunc);
+            }));
+        }
+        // The calling thread takes the first chunk.
+        details::histogramChunk<VEC_LEN>(data, 0, std::min(count, chunk), tables[0], lanePrivate, binFunc);
+        for (uint32_t t = 0; t < threads.size(); t++) threads[t].join();
+
+        // Merge sub-histograms of all threads into the first one.
+        UINT_VEC_T t0, t1;
+        for (uint32_t t = 1; t < threadCount; t++) {
+            for (uint32_t i = 0; i < tableSize; i += VEC_LEN) {
+                t0.loada(tables[0] + i);
+                t1.loada(tables[t] + i);
+                t0.adda(t1);
+                t0.storea(tables[0] + i);
+            }
+        }
+
+        // Add the merged counts to the output.
+        if (lanePrivate) {
+            for (uint32_t i = 0; i < binCount; i++) {
+                t0.loada(tables[0] + i * VEC_LEN);
+                hist[i] += t0.hadd();
+            }
+        }
+        else {
+            uint32_t i = 0;
+            for (; i + VEC_LEN <= binCount; i += VEC_LEN) {
+                t0.load(hist + i);
+                t1.loada(tables[0] + i);
+                t0.adda(t1);
+                t0.store(hist + i);
+            }
+            if (i < binCount) {
+                t0.loadn(binCount - i, hist + i);
+                t1.loada(tables[0] + i);
+                t0.adda(t1);
+                t0.storen(binCount - i, hist + i);
+            }
+        }
+
+        for (uint32_t t = 0; t < threadCount; t++) {
+            UME::DynamicMemory::AlignedFree(tables[t]);
+        }
+    }
+}
+}
+
+#endif
@@ -218,6 +218,14 @@ namespace SIMD
             return SCALAR_EMULATION::storeAligned<DERIVED_MASK_TYPE, bool>(static_cast<DERIVED_MASK_TYPE const &>(*this), addrAligned);
         }
 
+        // PREFIX
+        // Returns a mask with the first 'n' lanes set. Any 'n' greater
+        // than MASK_LEN selects all lanes.
+        UME_FORCE_INLINE static DERIVED_MASK_TYPE prefix(uint32_t n) {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::prefix<DERIVED_MASK_TYPE>(n);
+        }
+
         // GATHERU
         UME_FORCE_INLINE DERIVED_MASK_TYPE & gatheru (bool const * baseAddr, uint32_t stride) {
             UME_EMULATION_WARNING();
@@ -844,25 +852,25 @@ namespace SIMD
         // ONE-VEC
         static DERIVED_VEC_TYPE one() { return DERIVED_VEC_TYPE(SCALAR_TYPE(1)); }
 
-#include "utilities/ignore_warnings_push.h"
-#include "utilities/ignore_warnings_unused_parameter.h"
-
         // PREFETCH0
         static UME_FORCE_INLINE void prefetch0(SCALAR_TYPE const *p) {
-            // DO NOTHING!
+            UME_PREFETCH_T0(p);
         }
 
         // PREFETCH1
         static UME_FORCE_INLINE void prefetch1(SCALAR_TYPE const *p) {
-            // DO NOTHING!
+            UME_PREFETCH_T1(p);
         }
 
         // PREFETCH2
         static UME_FORCE_INLINE void prefetch2(SCALAR_TYPE const *p) {
-            // DO NOTHING!
+            UME_PREFETCH_T2(p);
         }
 
-#include "utilities/ignore_warnings_pop.h"
+        // PREFETCHNTA
+        static UME_FORCE_INLINE void prefetchnta(SCALAR_TYPE const *p) {
+            UME_PREFETCH_NTA(p);
+        }
 
         // ASSIGNV
         UME_FORCE_INLINE DERIVED_VEC_TYPE & assign (DERIVED_VEC_TYPE const & src) {
@@ -930,6 +938,14 @@ namespace SIMD
             return SCALAR_EMULATION::load<DERIVED_VEC_TYPE, SCALAR_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE &>(*this), p);
         }
 
+        // LOADN
+        // Loads the first 'n' elements and zeroes the remaining lanes. No memory
+        // past 'p + n' is accessed, so this can be used for the remainder of an array.
+        UME_FORCE_INLINE DERIVED_VEC_TYPE & loadn(uint32_t n, SCALAR_TYPE const *p) {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::loadn<DERIVED_VEC_TYPE, SCALAR_TYPE>(static_cast<DERIVED_VEC_TYPE &>(*this), n, p);
+        }
+
         // STORE
         UME_FORCE_INLINE SCALAR_TYPE* store (SCALAR_TYPE* p) const {
             UME_EMULATION_WARNING();
@@ -966,6 +982,21 @@ namespace SIMD
             return SCALAR_EMULATION::store<DERIVED_VEC_TYPE, SCALAR_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this), p);
         }
 
+        // STOREN
+        // Stores the first 'n' elements. No memory past 'p + n' is accessed.
+        UME_FORCE_INLINE SCALAR_TYPE* storen(uint32_t n, SCALAR_TYPE *p) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::storen<DERIVED_VEC_TYPE, SCALAR_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this), n, p);
+        }
+
+        // COMPRESSSTORE
+        // Stores lanes selected by 'mask' contiguously, starting at 'p', and returns
+        // the number of lanes stored. No memory past 'p + count' is accessed.
+        UME_FORCE_INLINE uint32_t compressstore(MASK_TYPE const & mask, SCALAR_TYPE *p) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::compressstore<DERIVED_VEC_TYPE, SCALAR_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this), p);
+        }
+
         // EXTRACT
         // This method should be provided for all derived classes and cannot be defined
         // as generic.
@@ -1043,7 +1074,7 @@ namespace SIMD
             int i24, int i25, int i26, int i27, int i28, int i29, int i30, int i31>
         UME_FORCE_INLINE DERIVED_VEC_TYPE swizzle() const {
             UME_EMULATION_WARNING();
-            static_assert(VEC_LEN == 31, "Invalid number of template parameters.");
+            static_assert(VEC_LEN == 32, "Invalid number of template parameters.");
             SWIZZLE_MASK_TYPE sMask(
                 i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15,
                 i16, i17, i18, i19, i20, i21, i22, i23, i24, i25, i26, i27, i28, i29, i30, i31);
@@ -1575,6 +1606,38 @@ namespace SIMD
             return SCALAR_EMULATION::divAssign<DERIVED_VEC_TYPE, SCALAR_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE &>(*this), b);
         }
 
+        // DIVD
+        UME_FORCE_INLINE DERIVED_VEC_TYPE div (SIMDDivisor<SCALAR_TYPE> const & b) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::div<DERIVED_VEC_TYPE, SCALAR_TYPE> (static_cast<DERIVED_VEC_TYPE const &>(*this), b);
+        }
+
+        UME_FORCE_INLINE DERIVED_VEC_TYPE operator/ (SIMDDivisor<SCALAR_TYPE> const & b) const {
+            return div(b);
+        }
+
+        // MDIVD
+        UME_FORCE_INLINE DERIVED_VEC_TYPE div (MASK_TYPE const & mask, SIMDDivisor<SCALAR_TYPE> const & b) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::div<DERIVED_VEC_TYPE, SCALAR_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE const &>(*this), b);
+        }
+
+        // DIVDA
+        UME_FORCE_INLINE DERIVED_VEC_TYPE & diva (SIMDDivisor<SCALAR_TYPE> const & b) {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::divAssign<DERIVED_VEC_TYPE, SCALAR_TYPE> (static_cast<DERIVED_VEC_TYPE &>(*this), b);
+        }
+
+        UME_FORCE_INLINE DERIVED_VEC_TYPE & operator/= (SIMDDivisor<SCALAR_TYPE> const & b) {
+            return diva(b);
+        }
+
+        // MDIVDA
+        UME_FORCE_INLINE DERIVED_VEC_TYPE & diva (MASK_TYPE const & mask, SIMDDivisor<SCALAR_TYPE> const & b) {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::divAssign<DERIVED_VEC_TYPE, SCALAR_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE &>(*this), b);
+        }
+
         // RCP
         UME_FORCE_INLINE DERIVED_VEC_TYPE rcp () const {
             UME_EMULATION_WARNING();
@@ -2450,6 +2513,36 @@ namespace SIMD
             return SCALAR_EMULATION::reminderAssign<DERIVED_VEC_TYPE, SCALAR_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this), b);
         }
 
+        // REMD
+        UME_FORCE_INLINE DERIVED_VEC_TYPE rem(SIMDDivisor<SCALAR_TYPE> const & b) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::reminder<DERIVED_VEC_TYPE, SCALAR_TYPE>(static_cast<DERIVED_VEC_TYPE const &>(*this), b);
+        }
+        UME_FORCE_INLINE DERIVED_VEC_TYPE operator% (SIMDDivisor<SCALAR_TYPE> const & b) const {
+            return rem(b);
+        }
+
+        // MREMD
+        UME_FORCE_INLINE DERIVED_VEC_TYPE rem(MASK_TYPE const & mask, SIMDDivisor<SCALAR_TYPE> const & b) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::reminder<DERIVED_VEC_TYPE, SCALAR_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE const &>(*this), b);
+        }
+
+        // REMDA
+        UME_FORCE_INLINE DERIVED_VEC_TYPE & rema(SIMDDivisor<SCALAR_TYPE> const & b) {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::reminderAssign<DERIVED_VEC_TYPE, SCALAR_TYPE>(static_cast<DERIVED_VEC_TYPE &>(*this), b);
+        }
+        UME_FORCE_INLINE DERIVED_VEC_TYPE & operator%= (SIMDDivisor<SCALAR_TYPE> const & b) {
+            return rema(b);
+        }
+
+        // MREMDA
+        UME_FORCE_INLINE DERIVED_VEC_TYPE & rema(MASK_TYPE const & mask, SIMDDivisor<SCALAR_TYPE> const & b) {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::reminderAssign<DERIVED_VEC_TYPE, SCALAR_TYPE, MASK_TYPE>(mask, static_cast<DERIVED_VEC_TYPE &>(*this), b);
+        }
+
         // LANDV
         UME_FORCE_INLINE MASK_TYPE land(DERIVED_VEC_TYPE const & b) const {
             UME_EMULATION_WARNING();
@@ -2571,6 +2664,30 @@ namespace SIMD
             return SCALAR_EMULATION::gather<DERIVED_VEC_TYPE, SCALAR_TYPE, DERIVED_UINT_VEC_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE &>(*this), baseAddr, indices);
         }
 
+        // PREFETCHGATHER0
+        // Prefetches elements that a later 'gather(baseAddr, indices)' is going
+        // to read, so that the latency of independent cache misses overlaps
+        // with the work done in between.
+        static UME_FORCE_INLINE void prefetchgather0 (SCALAR_TYPE const * baseAddr, DERIVED_UINT_VEC_TYPE const & indices) {
+            SCALAR_UINT_TYPE raw[DERIVED_VEC_TYPE::length()];
+            indices.store(raw);
+            for (uint32_t i = 0; i < DERIVED_VEC_TYPE::length(); i++) UME_PREFETCH_T0(baseAddr + raw[i]);
+        }
+
+        // PREFETCHGATHER1
+        static UME_FORCE_INLINE void prefetchgather1 (SCALAR_TYPE const * baseAddr, DERIVED_UINT_VEC_TYPE const & indices) {
+            SCALAR_UINT_TYPE raw[DERIVED_VEC_TYPE::length()];
+            indices.store(raw);
+            for (uint32_t i = 0; i < DERIVED_VEC_TYPE::length(); i++) UME_PREFETCH_T1(baseAddr + raw[i]);
+        }
+
+        // PREFETCHGATHER2
+        static UME_FORCE_INLINE void prefetchgather2 (SCALAR_TYPE const * baseAddr, DERIVED_UINT_VEC_TYPE const & indices) {
+            SCALAR_UINT_TYPE raw[DERIVED_VEC_TYPE::length()];
+            indices.store(raw);
+            for (uint32_t i = 0; i < DERIVED_VEC_TYPE::length(); i++) UME_PREFETCH_T2(baseAddr + raw[i]);
+        }
+
         // SCATTERU
         UME_FORCE_INLINE SCALAR_TYPE* scatteru (SCALAR_TYPE * baseAddr, uint32_t stride) {
             UME_EMULATION_WARNING();
@@ -2605,7 +2722,23 @@ namespace SIMD
         UME_FORCE_INLINE SCALAR_TYPE*  scatter (MASK_TYPE const & mask, SCALAR_TYPE* baseAddr, DERIVED_UINT_VEC_TYPE const & indices) {
             UME_EMULATION_WARNING();
             return SCALAR_EMULATION::scatter<DERIVED_VEC_TYPE, SCALAR_TYPE, DERIVED_UINT_VEC_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE &>(*this), baseAddr, indices);
-        }       
+        }
+
+        // SCATTERADDV
+        // Adds lanes to baseAddr[indices[i]]. Unlike a 'gather', 'add',
+        // 'scatter' sequence, lanes with repeating indices all accumulate.
+        // Floating point lanes sharing an index may be summed in a different
+        // order than a scalar loop would use.
+        UME_FORCE_INLINE SCALAR_TYPE*  scatteradd (SCALAR_TYPE* baseAddr, DERIVED_UINT_VEC_TYPE const & indices) {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::scatteradd<DERIVED_VEC_TYPE, SCALAR_TYPE, DERIVED_UINT_VEC_TYPE> (static_cast<DERIVED_VEC_TYPE &>(*this), baseAddr, indices);
+        }
+
+        // MSCATTERADDV
+        UME_FORCE_INLINE SCALAR_TYPE*  scatteradd (MASK_TYPE const & mask, SCALAR_TYPE* baseAddr, DERIVED_UINT_VEC_TYPE const & indices) {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::scatteradd<DERIVED_VEC_TYPE, SCALAR_TYPE, DERIVED_UINT_VEC_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE &>(*this), baseAddr, indices);
+        }
     };
     
     // ***************************************************************************
@@ -3283,28 +3416,28 @@ namespace SIMD
         }
         
         // POWV
-        // Disabled, see Issue #10
-        //UME_FORCE_INLINE DERIVED_VEC_TYPE pow (DERIVED_VEC_TYPE const & b) const {
-        //    return SCALAR_EMULATION::MATH::pow<DERIVED_VEC_TYPE> (static_cast<DERIVED_VEC_TYPE const &>(*this), b);
-        // }
+        UME_FORCE_INLINE DERIVED_VEC_TYPE pow (DERIVED_VEC_TYPE const & b) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::pow<DERIVED_VEC_TYPE> (static_cast<DERIVED_VEC_TYPE const &>(*this), b);
+        }
 
-        // MPOWV    
-        // Disabled, see Issue #10    
-        //UME_FORCE_INLINE DERIVED_VEC_TYPE pow (MASK_TYPE const & mask, DERIVED_VEC_TYPE const & b) const {
-        //    return SCALAR_EMULATION::MATH::pow<DERIVED_VEC_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE const &>(*this), b);
-        //}
+        // MPOWV
+        UME_FORCE_INLINE DERIVED_VEC_TYPE pow (MASK_TYPE const & mask, DERIVED_VEC_TYPE const & b) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::pow<DERIVED_VEC_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE const &>(*this), b);
+        }
 
         // POWS
-        // Disabled, see Issue #10
-        //UME_FORCE_INLINE DERIVED_VEC_TYPE pow (SCALAR_FLOAT_TYPE b) const {
-        //    return SCALAR_EMULATION::MATH::pows<DERIVED_VEC_TYPE, SCALAR_FLOAT_TYPE> (static_cast<DERIVED_VEC_TYPE const &>(*this), b);
-        //}
+        UME_FORCE_INLINE DERIVED_VEC_TYPE pow (SCALAR_FLOAT_TYPE b) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::pows<DERIVED_VEC_TYPE, SCALAR_FLOAT_TYPE> (static_cast<DERIVED_VEC_TYPE const &>(*this), b);
+        }
 
         // MPOWS
-        // Disabled, see Issue #10
-        //UME_FORCE_INLINE DERIVED_VEC_TYPE pow (MASK_TYPE const & mask, SCALAR_FLOAT_TYPE b) const {
-        //    return SCALAR_EMULATION::MATH::pows<DERIVED_VEC_TYPE, SCALAR_FLOAT_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE const &>(*this), b);
-        //}
+        UME_FORCE_INLINE DERIVED_VEC_TYPE pow (MASK_TYPE const & mask, SCALAR_FLOAT_TYPE b) const {
+            UME_EMULATION_WARNING();
+            return SCALAR_EMULATION::MATH::pows<DERIVED_VEC_TYPE, SCALAR_FLOAT_TYPE, MASK_TYPE> (mask, static_cast<DERIVED_VEC_TYPE const &>(*this), b);
+        }
 
         // ROUND
         UME_FORCE_INLINE DERIVED_VEC_TYPE round () const {
@@ -2,6 +2,7 @@
 #define UME_SIMD_INTERFACE_FUNCTIONS_H_
 
 #include "UMESimdTraits.h"
+#include "UMESimdVectorEmulation.h"
 
 namespace UME
 {
@@ -801,6 +802,19 @@ namespace FUNCTIONS
     template<typename VEC_T>
     inline VEC_T log2(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.log2(mask); }
 
+    // POWV
+    template<typename VEC_T>
+    inline VEC_T pow(VEC_T const & src1, VEC_T const & src2) { return src1.pow(src2); }
+    // MPOWV
+    template<typename VEC_T>
+    inline VEC_T pow(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1, VEC_T const & src2) { return src1.pow(mask, src2); }
+    // POWS
+    template<typename VEC_T>
+    inline VEC_T pow(VEC_T const & src1, typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T const & src2) { return src1.pow(src2); }
+    // MPOWS
+    template<typename VEC_T>
+    inline VEC_T pow(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1, typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T const & src2) { return src1.pow(mask, src2); }
+
     // SIN
     template<typename VEC_T>
     inline VEC_T sin(VEC_T const & src1) { return src1.sin(); }
@@ -843,6 +857,255 @@ namespace FUNCTIONS
     template<typename VEC_T>
     inline VEC_T atan(typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T const & mask, VEC_T const & src1) { return src1.atan(mask); }
 
+    namespace details
+    {
+        // Tiered kernels selected by the scalar type of the vector
+        template<UME::SIMD::Precision P, typename VEC_T>
+        inline VEC_T expTier(VEC_T const & src1, float) {
+            return UME::SIMD::VECTOR_EMULATION::expf<P, VEC_T, typename UME::SIMD::SIMDTraits<VEC_T>::UINT_VEC_T>(src1);
+        }
+        template<UME::SIMD::Precision P, typename VEC_T>
+        inline VEC_T expTier(VEC_T const & src1, double) {
+            return UME::SIMD::VECTOR_EMULATION::expd<P, VEC_T, typename UME::SIMD::SIMDTraits<VEC_T>::UINT_VEC_T>(src1);
+        }
+        template<UME::SIMD::Precision P, typename VEC_T>
+        inline VEC_T logTier(VEC_T const & src1, float) {
+            return UME::SIMD::VECTOR_EMULATION::logf<P, VEC_T, typename UME::SIMD::SIMDTraits<VEC_T>::UINT_VEC_T>(src1);
+        }
+        template<UME::SIMD::Precision P, typename VEC_T>
+        inline VEC_T logTier(VEC_T const & src1, double) {
+            return UME::SIMD::VECTOR_EMULATION::logd<P, VEC_T, typename UME::SIMD::SIMDTraits<VEC_T>::UINT_VEC_T>(src1);
+        }
+        template<UME::SIMD::Precision P, typename VEC_T>
+        inline void sincosTier(VEC_T const & src1, VEC_T & dst1, VEC_T & dst2, float) {
+            UME::SIMD::VECTOR_EMULATION::sincosf<P, VEC_T,
+                typename UME::SIMD::SIMDTraits<VEC_T>::INT_VEC_T,
+                typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T>(src1, dst1, dst2);
+        }
+        template<UME::SIMD::Precision P, typename VEC_T>
+        inline void sincosTier(VEC_T const & src1, VEC_T & dst1, VEC_T & dst2, double) {
+            UME::SIMD::VECTOR_EMULATION::sincosd<P, VEC_T,
+                typename UME::SIMD::SIMDTraits<VEC_T>::INT_VEC_T,
+                typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T>(src1, dst1, dst2);
+        }
+    }
+
+    // Precision tiers: Precision::Accurate calls the default member implementation,
+    // Precision::Fast and Precision::Approx call the shorter VECTOR_EMULATION kernels.
+    // Usage: UME::SIMD::FUNCTIONS::exp<UME::SIMD::Precision::Fast>(x)
+
+    // EXP
+    template<UME::SIMD::Precision P, typename VEC_T>
+    inline VEC_T exp(VEC_T const & src1) {
+        if (P == UME::SIMD::Precision::Accurate) return src1.exp();
+        return details::expTier<P>(src1, typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T());
+    }
+    // LOG
+    template<UME::SIMD::Precision P, typename VEC_T>
+    inline VEC_T log(VEC_T const & src1) {
+        if (P == UME::SIMD::Precision::Accurate) return src1.log();
+        return details::logTier<P>(src1, typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T());
+    }
+    // SINCOS
+    template<UME::SIMD::Precision P, typename VEC_T>
+    inline void sincos(VEC_T const & src1, VEC_T & dst1, VEC_T & dst2) {
+        if (P == UME::SIMD::Precision::Accurate) src1.sincos(dst1, dst2);
+        else details::sincosTier<P>(src1, dst1, dst2, typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T());
+    }
+    // SIN
+    template<UME::SIMD::Precision P, typename VEC_T>
+    inline VEC_T sin(VEC_T const & src1) {
+        if (P == UME::SIMD::Precision::Accurate) return src1.sin();
+        VEC_T s, c;
+        details::sincosTier<P>(src1, s, c, typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T());
+        return s;
+    }
+    // COS
+    template<UME::SIMD::Precision P, typename VEC_T>
+    inline VEC_T cos(VEC_T const & src1) {
+        if (P == UME::SIMD::Precision::Accurate) return src1.cos();
+        VEC_T s, c;
+        details::sincosTier<P>(src1, s, c, typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T());
+        return c;
+    }
+
+    // Array helpers fusing a vector predicate with a reduction or a copy.
+    // 'pred' maps VEC_T to its mask type, e.g.
+    //   [](UME::SIMD::SIMD8_32f const & x) { return x.isnan(); }
+    // Arrays are processed in VEC_T::length() chunks; the trailing partial chunk
+    // is loaded with LOADN and its predicate is limited with a prefix mask.
+
+    // COUNT_IF - returns number of elements of src[0..n) for which pred is true.
+    // Counting is done with masked increments of a 32-bit counter vector, so
+    // VEC_T can have at most 32 lanes.
+    template<typename VEC_T, typename PRED_T>
+    inline uint32_t count_if(typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T const * src, uint32_t n, PRED_T pred) {
+        typedef typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T MASK_T;
+        typedef UME::SIMD::SIMDVec_u<uint32_t, VEC_T::length()> COUNT_VEC_T;
+
+        const uint32_t VEC_LEN = VEC_T::length();
+        uint32_t peel = n - n % VEC_LEN;
+        COUNT_VEC_T counter(uint32_t(0));
+        VEC_T x;
+
+        for (uint32_t i = 0; i < peel; i += VEC_LEN) {
+            x.load(src + i);
+            counter.adda(pred(x), uint32_t(1));
+        }
+        if (peel < n) {
+            x.loadn(n - peel, src + peel);
+            MASK_T m0 = pred(x).land(MASK_T::prefix(n - peel));
+            counter.adda(m0, uint32_t(1));
+        }
+        return counter.hadd();
+    }
+
+    // COMPACT - copies elements of src[0..n) for which pred is true to dst,
+    // preserving their order, and returns number of copied elements. dst has to
+    // have space for n elements. Chunks in which all lanes are selected are
+    // copied with a single vector store and chunks with no selected lanes are
+    // skipped, so mostly-clean data never leaves vector registers.
+    template<typename VEC_T, typename PRED_T>
+    inline uint32_t compact(typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T const * src, uint32_t n,
+                            typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T * dst, PRED_T pred) {
+        typedef typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T MASK_T;
+
+        const uint32_t VEC_LEN = VEC_T::length();
+        uint32_t peel = n - n % VEC_LEN;
+        uint32_t count = 0;
+        VEC_T x;
+
+        for (uint32_t i = 0; i < peel; i += VEC_LEN) {
+            x.load(src + i);
+            MASK_T m0 = pred(x);
+            if (m0.hland()) {
+                x.store(dst + count);
+                count += VEC_LEN;
+            }
+            else if (m0.hlor()) {
+                for (uint32_t j = 0; j < VEC_LEN; j++) {
+                    if (m0[j]) dst[count++] = src[i + j];
+                }
+            }
+        }
+        if (peel < n) {
+            x.loadn(n - peel, src + peel);
+            MASK_T m0 = pred(x);
+            for (uint32_t j = 0; j < n - peel; j++) {
+                if (m0[j]) dst[count++] = src[peel + j];
+            }
+        }
+        return count;
+    }
+
+    // ARGMAX/ARGMIN - return index of the first largest/smallest element of
+    // src[0..n), or n if the array is empty. Every lane keeps its own running
+    // extreme value together with the index it was found at, so the loop body
+    // is a compare and two blends; lanes are reduced only once, after the loop.
+    // The trailing partial chunk is handled by re-reading the last full
+    // VEC_T::length() elements, which is harmless as each lane carries the
+    // absolute index of its candidate. As with std::max_element, the result
+    // is unspecified if src contains NaN values.
+    template<typename VEC_T>
+    inline uint32_t argmax(typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T const * src, uint32_t n) {
+        typedef typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T MASK_T;
+        typedef UME::SIMD::SIMDVec_u<uint32_t, VEC_T::length()> INDEX_VEC_T;
+
+        const uint32_t VEC_LEN = VEC_T::length();
+        if (n < VEC_LEN) {
+            uint32_t best = 0;
+            for (uint32_t i = 1; i < n; i++) {
+                if (src[i] > src[best]) best = i;
+            }
+            return best;
+        }
+
+        uint32_t raw[VEC_LEN];
+        for (uint32_t i = 0; i < VEC_LEN; i++) raw[i] = i;
+        INDEX_VEC_T laneIndex(raw);
+        INDEX_VEC_T index = laneIndex;
+        INDEX_VEC_T bestIndex = laneIndex;
+        VEC_T best(src);
+        VEC_T x;
+        MASK_T m0;
+
+        uint32_t peel = n - n % VEC_LEN;
+        for (uint32_t i = VEC_LEN; i < peel; i += VEC_LEN) {
+            index.adda(VEC_LEN);
+            x.load(src + i);
+            m0 = x.cmpgt(best);
+            best.assign(m0, x);
+            bestIndex.assign(m0, index);
+        }
+        if (peel < n) {
+            index = laneIndex.add(n - VEC_LEN);
+            x.load(src + n - VEC_LEN);
+            m0 = x.cmpgt(best);
+            best.assign(m0, x);
+            bestIndex.assign(m0, index);
+        }
+        // Lanes are combined in scalar code: only VEC_T::length() candidates
+        // remain and ties have to be resolved to the lowest index.
+        typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T rawBest[VEC_LEN];
+        best.store(rawBest);
+        bestIndex.store(raw);
+        uint32_t result = 0;
+        for (uint32_t i = 1; i < VEC_LEN; i++) {
+            if (rawBest[i] > rawBest[result] || (rawBest[i] == rawBest[result] && raw[i] < raw[result])) result = i;
+        }
+        return raw[result];
+    }
+
+    template<typename VEC_T>
+    inline uint32_t argmin(typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T const * src, uint32_t n) {
+        typedef typename UME::SIMD::SIMDTraits<VEC_T>::MASK_T MASK_T;
+        typedef UME::SIMD::SIMDVec_u<uint32_t, VEC_T::length()> INDEX_VEC_T;
+
+        const uint32_t VEC_LEN = VEC_T::length();
+        if (n < VEC_LEN) {
+            uint32_t best = 0;
+            for (uint32_t i = 1; i < n; i++) {
+                if (src[i] < src[best]) best = i;
+            }
+            return best;
+        }
+
+        uint32_t raw[VEC_LEN];
+        for (uint32_t i = 0; i < VEC_LEN; i++) raw[i] = i;
+        INDEX_VEC_T laneIndex(raw);
+        INDEX_VEC_T index = laneIndex;
+        INDEX_VEC_T bestIndex = laneIndex;
+        VEC_T best(src);
+        VEC_T x;
+        MASK_T m0;
+
+        uint32_t peel = n - n % VEC_LEN;
+        for (uint32_t i = VEC_LEN; i < peel; i += VEC_LEN) {
+            index.adda(VEC_LEN);
+            x.load(src + i);
+            m0 = x.cmplt(best);
+            best.assign(m0, x);
+            bestIndex.assign(m0, index);
+        }
+        if (peel < n) {
+            index = laneIndex.add(n - VEC_LEN);
+            x.load(src + n - VEC_LEN);
+            m0 = x.cmplt(best);
+            best.assign(m0, x);
+            bestIndex.assign(m0, index);
+        }
+        // Lanes are combined in scalar code: only VEC_T::length() candidates
+        // remain and ties have to be resolved to the lowest index.
+        typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T rawBest[VEC_LEN];
+        best.store(rawBest);
+        bestIndex.store(raw);
+        uint32_t result = 0;
+        for (uint32_t i = 1; i < VEC_LEN; i++) {
+            if (rawBest[i] < rawBest[result] || (rawBest[i] == rawBest[result] && raw[i] < raw[result])) result = i;
+        }
+        return raw[result];
+    }
+
 }
 }
 }
@@ -33,9 +33,12 @@
 
 #include "UMEInline.h"
 #include "UMEBasicTypes.h"
+#include "UMESimdDivisor.h"
 
 #include <algorithm>
 #include <array>
+#include <limits>
+#include <type_traits>
 
 namespace UME
 {
@@ -149,6 +152,47 @@ namespace SCALAR_EMULATION
         UME_ALIGNMENT_CHECK(p, VEC_TYPE::alignment());
         return store<MASK_TYPE, VEC_TYPE, SCALAR_TYPE>(mask, src, p);
     }
+
+    // LOADN
+    template<typename VEC_TYPE, typename SCALAR_TYPE>
+    UME_FORCE_INLINE VEC_TYPE & loadn(VEC_TYPE & dst, uint32_t n, SCALAR_TYPE const * p) {
+        // Only the first 'n' elements are touched, so 'p' may point to
+        // the last partial vector of an allocation.
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            dst.insert(i, i < n ? p[i] : SCALAR_TYPE(0));
+        }
+        return dst;
+    }
+
+    // STOREN
+    template<typename VEC_TYPE, typename SCALAR_TYPE>
+    UME_FORCE_INLINE SCALAR_TYPE* storen(VEC_TYPE const & src, uint32_t n, SCALAR_TYPE * p) {
+        uint32_t count = n < VEC_TYPE::length() ? n : VEC_TYPE::length();
+        for (uint32_t i = 0; i < count; i++) {
+            p[i] = src[i];
+        }
+        return p;
+    }
+
+    // COMPRESSSTORE
+    template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE>
+    UME_FORCE_INLINE uint32_t compressstore(MASK_TYPE const & mask, VEC_TYPE const & src, SCALAR_TYPE * p) {
+        uint32_t count = 0;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            if (mask[i] == true) p[count++] = src[i];
+        }
+        return count;
+    }
+
+    // PREFIX
+    template<typename MASK_TYPE>
+    UME_FORCE_INLINE MASK_TYPE prefix(uint32_t n) {
+        MASK_TYPE retval(false);
+        for (uint32_t i = 0; i < MASK_TYPE::length(); i++) {
+            retval.insert(i, i < n);
+        }
+        return retval;
+    }
     
     // GATHERU
     template<typename VEC_TYPE, typename SCALAR_TYPE>
@@ -260,6 +304,26 @@ namespace SCALAR_EMULATION
         return base;
     }
 
+    // SCATTERADDV
+    template<typename VEC_TYPE, typename SCALAR_TYPE, typename UINT_VEC_TYPE>
+    UME_FORCE_INLINE SCALAR_TYPE* scatteradd(VEC_TYPE const & src, SCALAR_TYPE* base, UINT_VEC_TYPE const & indices) {
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++)
+        {
+            base[indices[i]] += src[i];
+        }
+        return base;
+    }
+
+    // MSCATTERADDV
+    template<typename VEC_TYPE, typename SCALAR_TYPE, typename UINT_VEC_TYPE, typename MASK_TYPE>
+    UME_FORCE_INLINE SCALAR_TYPE* scatteradd(MASK_TYPE const & mask, VEC_TYPE const & src, SCALAR_TYPE* base, UINT_VEC_TYPE const & indices) {
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++)
+        {
+            if (mask[i] == true) base[indices[i]] += src[i];
+        }
+        return base;
+    }
+
     // PACK
     template<typename VEC_TYPE, typename VEC_HALF_TYPE>
     UME_FORCE_INLINE VEC_TYPE & pack(VEC_TYPE & dst, VEC_HALF_TYPE const & src1, VEC_HALF_TYPE const & src2) {
@@ -392,26 +456,24 @@ namespace SCALAR_EMULATION
         return a;
     }
 
+    // Saturating add of a single element. Integer results are clamped to the
+    // range of the element type; floating-point addition already saturates
+    // to infinity.
+    template<typename SCALAR_TYPE>
+    UME_FORCE_INLINE SCALAR_TYPE addSaturatedLane(SCALAR_TYPE a, SCALAR_TYPE b) {
+        if (!std::is_floating_point<SCALAR_TYPE>::value) {
+            if (b > SCALAR_TYPE(0) && a > std::numeric_limits<SCALAR_TYPE>::max() - b) return std::numeric_limits<SCALAR_TYPE>::max();
+            if (b < SCALAR_TYPE(0) && a < std::numeric_limits<SCALAR_TYPE>::lowest() - b) return std::numeric_limits<SCALAR_TYPE>::lowest();
+        }
+        return SCALAR_TYPE(a + b);
+    }
+
     // SADDV
     template<typename VEC_TYPE>
     UME_FORCE_INLINE VEC_TYPE addSaturated(VEC_TYPE const & a, VEC_TYPE const & b) {
         VEC_TYPE retval;
-        decltype(a.extract(0)) temp = 0;
-        // maximum value
-        decltype(a.extract(0)) maxValue = std::numeric_limits<decltype(a.extract(0))>::max();
-        decltype(a.extract(0)) minValue = std::numeric_limits<decltype(a.extract(0))>::min();
         for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
-            if (a[i] > 0 && b[i] > 0) {
-                temp = a[i] > (maxValue - b[i]) ? maxValue : (a[i] + b[i]);
-            }
-            else if (a[i] < 0 && b[i] < 0) {
-                temp = a[i] < (minValue - b[i]) ? minValue : (a[i] + b[i]);
-            }
-            else
-            {
-                temp = a[i] + b[i];
-            }
-            retval.insert(i, temp);
+            retval.insert(i, addSaturatedLane<decltype(a.extract(0))>(a[i], b[i]));
         }
         return retval;
     }
@@ -420,17 +482,8 @@ namespace SCALAR_EMULATION
     template<typename VEC_TYPE, typename MASK_TYPE>
     UME_FORCE_INLINE VEC_TYPE addSaturated(MASK_TYPE const & mask, VEC_TYPE const & a, VEC_TYPE const & b) {
         VEC_TYPE retval;
-        decltype(a.extract(0)) temp = 0;
-        // maximum value
-        decltype(a.extract(0)) satValue = std::numeric_limits<decltype(a.extract(0))>::max();
         for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
-            if (mask[i] == true) {
-                temp = (a[i] >(satValue - b[i])) ? satValue : (a[i] + b[i]);
-                retval.insert(i, temp);
-            }
-            else {
-                retval.insert(i, a[i]);
-            }
+            retval.insert(i, (mask[i] == true) ? addSaturatedLane<decltype(a.extract(0))>(a[i], b[i]) : a[i]);
         }
         return retval;
     }
@@ -439,12 +492,8 @@ namespace SCALAR_EMULATION
     template<typename VEC_TYPE, typename SCALAR_TYPE>
     UME_FORCE_INLINE VEC_TYPE addSaturatedScalar(VEC_TYPE const & a, SCALAR_TYPE b) {
         VEC_TYPE retval;
-        decltype(a.extract(0)) temp = 0;
-        // maximum value
-        decltype(a.extract(0)) satValue = std::numeric_limits<decltype(a.extract(0))>::max();
         for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
-            temp = (a[i] >(satValue - b)) ? satValue : (a[i] + b);
-            retval.insert(i, temp);
+            retval.insert(i, addSaturatedLane<decltype(a.extract(0))>(a[i], b));
         }
         return retval;
     }
@@ -453,17 +502,8 @@ namespace SCALAR_EMULATION
     template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE>
     UME_FORCE_INLINE VEC_TYPE addSaturatedScalar(MASK_TYPE const & mask, VEC_TYPE const & a, SCALAR_TYPE b) {
         VEC_TYPE retval;
-        decltype(a.extract(0)) temp = 0;
-        // maximum value
-        decltype(a.extract(0)) satValue = std::numeric_limits<decltype(a.extract(0))>::max();
         for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
-            if (mask[i] == true) {
-                temp = (a[i] >(satValue - b)) ? satValue : (a[i] + b);
-                retval.insert(i, temp);
-            }
-            else {
-                retval.insert(i, a[i]);
-            }
+            retval.insert(i, (mask[i] == true) ? addSaturatedLane<decltype(a.extract(0))>(a[i], b) : a[i]);
         }
         return retval;
     }
@@ -471,12 +511,8 @@ namespace SCALAR_EMULATION
     // SADDVA
     template<typename VEC_TYPE>
     UME_FORCE_INLINE VEC_TYPE & addSaturatedAssign(VEC_TYPE & a, VEC_TYPE const & b) {
-        decltype(a.extract(0)) temp = 0;
-        // maximum value
-        decltype(a.extract(0)) satValue = std::numeric_limits<decltype(a.extract(0))>::max();
         for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
-            temp = (a[i] >(satValue - b[i])) ? satValue : (a[i] + b[i]);
-            a.insert(i, temp);
+            a.insert(i, addSaturatedLane<decltype(a.extract(0))>(a[i], b[i]));
         }
         return a;
     }
@@ -484,14 +520,8 @@ namespace SCALAR_EMULATION
     // MSADDVA
     template<typename VEC_TYPE, typename MASK_TYPE>
     UME_FORCE_INLINE VEC_TYPE & addSaturatedAssign(MASK_TYPE const & mask, VEC_TYPE & a, VEC_TYPE const & b) {
-        decltype(a.extract(0)) temp = 0;
-        // maximum value
-        decltype(a.extract(0)) satValue = std::numeric_limits<decltype(a.extract(0))>::max();
         for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
-            if (mask[i] == true) {
-                temp = (a[i] >(satValue - b[i])) ? satValue : (a[i] + b[i]);
-                a.insert(i, temp);
-            }
+            if (mask[i] == true) a.insert(i, addSaturatedLane<decltype(a.extract(0))>(a[i], b[i]));
         }
         return a;
     }
@@ -499,12 +529,8 @@ namespace SCALAR_EMULATION
     // SADDSA
     template<typename VEC_TYPE, typename SCALAR_TYPE>
     UME_FORCE_INLINE VEC_TYPE & addSaturatedScalarAssign(VEC_TYPE & a, SCALAR_TYPE b) {
-        decltype(a.extract(0)) temp = 0;
-        // maximum value
-        decltype(a.extract(0)) satValue = std::numeric_limits<decltype(a.extract(0))>::max();
         for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
-            temp = (a[i] >(satValue - b)) ? satValue : (a[i] + b);
-            a.insert(i, temp);
+            a.insert(i, addSaturatedLane<decltype(a.extract(0))>(a[i], b));
         }
         return a;
     }
@@ -512,14 +538,8 @@ namespace SCALAR_EMULATION
     // MSADDSA
     template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE>
     UME_FORCE_INLINE VEC_TYPE & addSaturatedScalarAssign(MASK_TYPE const & mask, VEC_TYPE & a, SCALAR_TYPE b) {
-        decltype(a.extract(0)) temp = 0;
-        // maximum value
-        decltype(a.extract(0)) satValue = std::numeric_limits<decltype(a.extract(0))>::max();
         for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
-            if (mask[i] == true) {
-                temp = (a[i] >(satValue - b)) ? satValue : (a[i] + b);
-                a.insert(i, temp);
-            }
+            if (mask[i] == true) a.insert(i, addSaturatedLane<decltype(a.extract(0))>(a[i], b));
         }
         return a;
     }
@@ -762,16 +782,22 @@ namespace SCALAR_EMULATION
         return dst;
     }
 
+    // Saturating subtraction of a single element.
+    template<typename SCALAR_TYPE>
+    UME_FORCE_INLINE SCALAR_TYPE subSaturatedLane(SCALAR_TYPE a, SCALAR_TYPE b) {
+        if (!std::is_floating_point<SCALAR_TYPE>::value) {
+            if (b < SCALAR_TYPE(0) && a > std::numeric_limits<SCALAR_TYPE>::max() + b) return std::numeric_limits<SCALAR_TYPE>::max();
+            if (b > SCALAR_TYPE(0) && a < std::numeric_limits<SCALAR_TYPE>::lowest() + b) return std::numeric_limits<SCALAR_TYPE>::lowest();
+        }
+        return SCALAR_TYPE(a - b);
+    }
+
     // SSUBV
     template<typename VEC_TYPE>
     UME_FORCE_INLINE VEC_TYPE subSaturated(VEC_TYPE const & a, VEC_TYPE const & b) {
         VEC_TYPE retval;
-        decltype(a.extract(0)) temp = 0;
-        // maximum value
-        decltype(a.extract(0)) satValue = std::numeric_limits<decltype(a.extract(0))>::min();
         for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
-            temp = (a[i] < (satValue + b[i])) ? satValue : (a[i] - b[i]);
-            retval.insert(i, temp);
+            retval.insert(i, subSaturatedLane<decltype(a.extract(0))>(a[i], b[i]));
         }
         return retval;
     }
@@ -780,17 +806,8 @@ namespace SCALAR_EMULATION
     template<typename VEC_TYPE, typename MASK_TYPE>
     UME_FORCE_INLINE VEC_TYPE subSaturated(MASK_TYPE const & mask, VEC_TYPE const & a, VEC_TYPE const & b) {
         VEC_TYPE retval;
-        decltype(a.extract(0)) temp = 0;
-        // maximum value
-        decltype(a.extract(0)) satValue = std::numeric_limits<decltype(a.extract(0))>::min();
         for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
-            if (mask[i] == true) {
-                temp = (a[i] < (satValue + b[i])) ? satValue : (a[i] - b[i]);
-                retval.insert(i, temp);
-            }
-            else {
-                retval.insert(i, a[i]);
-            }
+            retval.insert(i, (mask[i] == true) ? subSaturatedLane<decltype(a.extract(0))>(a[i], b[i]) : a[i]);
         }
         return retval;
     }
@@ -799,12 +816,8 @@ namespace SCALAR_EMULATION
     template<typename VEC_TYPE, typename SCALAR_TYPE>
     UME_FORCE_INLINE VEC_TYPE subSaturated(VEC_TYPE const & a, SCALAR_TYPE b) {
         VEC_TYPE retval;
-        decltype(a.extract(0)) temp = 0;
-        // maximum value
-        decltype(a.extract(0)) satValue = std::numeric_limits<decltype(a.extract(0))>::min();
         for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
-            temp = (a[i] < (satValue + b)) ? satValue : (a[i] - b);
-            retval.insert(i, temp);
+            retval.insert(i, subSaturatedLane<decltype(a.extract(0))>(a[i], b));
         }
         return retval;
     }
@@ -813,17 +826,8 @@ namespace SCALAR_EMULATION
     template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE>
     UME_FORCE_INLINE VEC_TYPE subSaturated(MASK_TYPE const & mask, VEC_TYPE const & a, SCALAR_TYPE b) {
         VEC_TYPE retval;
-        decltype(a.extract(0)) temp = 0;
-        // maximum value
-        decltype(a.extract(0)) satValue = std::numeric_limits<decltype(a.extract(0))>::min();
         for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
-            if (mask[i] == true) {
-                temp = (a[i] < (satValue + b)) ? satValue : (a[i] - b);
-                retval.insert(i, temp);
-            }
-            else {
-                retval.insert(i, a[i]);
-            }
+            retval.insert(i, (mask[i] == true) ? subSaturatedLane<decltype(a.extract(0))>(a[i], b) : a[i]);
         }
         return retval;
     }
@@ -831,55 +835,35 @@ namespace SCALAR_EMULATION
     // SSUBVA
     template<typename VEC_TYPE>
     UME_FORCE_INLINE VEC_TYPE & subSaturatedAssign(VEC_TYPE & a, VEC_TYPE const & b) {
-        decltype(a.extract(0)) temp = 0;
-        // maximum value
-        decltype(a.extract(0)) satValue = std::numeric_limits<decltype(a.extract(0))>::min();
         for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
-            temp = (a[i] < (satValue + b[i])) ? satValue : (a[i] - b[i]);
-            a.insert(i, temp);
+            a.insert(i, subSaturatedLane<decltype(a.extract(0))>(a[i], b[i]));
         }
         return a;
     }
 
-    // MSSUBV
+    // MSSUBVA
     template<typename VEC_TYPE, typename MASK_TYPE>
     UME_FORCE_INLINE VEC_TYPE & subSaturatedAssign(MASK_TYPE const & mask, VEC_TYPE & a, VEC_TYPE const & b) {
-        decltype(a.extract(0)) temp = 0;
-        // maximum value
-        decltype(a.extract(0)) satValue = std::numeric_limits<decltype(a.extract(0))>::min();
         for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
-            if (mask[i] == true) {
-                temp = (a[i] < (satValue + b[i])) ? satValue : (a[i] - b[i]);
-                a.insert(i, temp);
-            }
+            if (mask[i] == true) a.insert(i, subSaturatedLane<decltype(a.extract(0))>(a[i], b[i]));
         }
         return a;
     }
 
-    // SSUBS
+    // SSUBSA
     template<typename VEC_TYPE, typename SCALAR_TYPE>
     UME_FORCE_INLINE VEC_TYPE & subSaturatedScalarAssign(VEC_TYPE & a, SCALAR_TYPE b) {
-        decltype(a.extract(0)) temp = 0;
-        // maximum value
-        decltype(a.extract(0)) satValue = std::numeric_limits<decltype(a.extract(0))>::min();
         for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
-            temp = (a[i] < (satValue + b)) ? satValue : (a[i] - b);
-            a.insert(i, temp);
+            a.insert(i, subSaturatedLane<decltype(a.extract(0))>(a[i], b));
         }
         return a;
     }
 
-    // MSSUBS
+    // MSSUBSA
     template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE>
     UME_FORCE_INLINE VEC_TYPE & subSaturatedScalarAssign(MASK_TYPE const & mask, VEC_TYPE & a, SCALAR_TYPE b) {
-        decltype(a.extract(0)) temp = 0;
-        // maximum value
-        decltype(a.extract(0)) satValue = std::numeric_limits<decltype(a.extract(0))>::min();
         for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
-            if (mask[i] == true) {
-                temp = (a[i] < (satValue + b)) ? satValue : (a[i] - b);
-                a.insert(i, temp);
-            }
+            if (mask[i] == true) a.insert(i, subSaturatedLane<decltype(a.extract(0))>(a[i], b));
         }
         return a;
     }
@@ -1115,6 +1099,82 @@ namespace SCALAR_EMULATION
         return a;
     }
 
+    // DIVD
+    template<typename VEC_TYPE, typename SCALAR_TYPE>
+    UME_FORCE_INLINE VEC_TYPE div(VEC_TYPE const & a, SIMDDivisor<SCALAR_TYPE> const & b) {
+        VEC_TYPE retval;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            retval.insert(i, b.divide(a[i]));
+        }
+        return retval;
+    }
+
+    // MDIVD
+    template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE>
+    UME_FORCE_INLINE VEC_TYPE div(MASK_TYPE const & mask, VEC_TYPE const & a, SIMDDivisor<SCALAR_TYPE> const & b) {
+        VEC_TYPE retval;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            retval.insert(i, (mask[i] == true) ? b.divide(a[i]) : a[i]);
+        }
+        return retval;
+    }
+
+    // DIVDA
+    template<typename VEC_TYPE, typename SCALAR_TYPE>
+    UME_FORCE_INLINE VEC_TYPE & divAssign(VEC_TYPE & a, SIMDDivisor<SCALAR_TYPE> const & b) {
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            a.insert(i, b.divide(a[i]));
+        }
+        return a;
+    }
+
+    // MDIVDA
+    template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE>
+    UME_FORCE_INLINE VEC_TYPE & divAssign(MASK_TYPE const & mask, VEC_TYPE & a, SIMDDivisor<SCALAR_TYPE> const & b) {
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            if (mask[i] == true) a.insert(i, b.divide(a[i]));
+        }
+        return a;
+    }
+
+    // REMD
+    template<typename VEC_TYPE, typename SCALAR_TYPE>
+    UME_FORCE_INLINE VEC_TYPE reminder(VEC_TYPE const & a, SIMDDivisor<SCALAR_TYPE> const & b) {
+        VEC_TYPE retval;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            retval.insert(i, b.remainder(a[i]));
+        }
+        return retval;
+    }
+
+    // MREMD
+    template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE>
+    UME_FORCE_INLINE VEC_TYPE reminder(MASK_TYPE const & mask, VEC_TYPE const & a, SIMDDivisor<SCALAR_TYPE> const & b) {
+        VEC_TYPE retval;
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            retval.insert(i, (mask[i] == true) ? b.remainder(a[i]) : a[i]);
+        }
+        return retval;
+    }
+
+    // REMDA
+    template<typename VEC_TYPE, typename SCALAR_TYPE>
+    UME_FORCE_INLINE VEC_TYPE & reminderAssign(VEC_TYPE & a, SIMDDivisor<SCALAR_TYPE> const & b) {
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            a.insert(i, b.remainder(a[i]));
+        }
+        return a;
+    }
+
+    // MREMDA
+    template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE>
+    UME_FORCE_INLINE VEC_TYPE & reminderAssign(MASK_TYPE const & mask, VEC_TYPE & a, SIMDDivisor<SCALAR_TYPE> const & b) {
+        for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
+            if (mask[i] == true) a.insert(i, b.remainder(a[i]));
+        }
+        return a;
+    }
+
     // RCP
     template<typename VEC_TYPE, typename SCALAR_TYPE>
     UME_FORCE_INLINE VEC_TYPE div(SCALAR_TYPE a, VEC_TYPE const & b) {
@@ -3014,7 +3074,7 @@ namespace SCALAR_EMULATION
         template<typename VEC_TYPE, typename SCALAR_TYPE>
         UME_FORCE_INLINE uint32_t indexMin(VEC_TYPE const & a) {
             uint32_t indexMin = 0;
-            SCALAR_TYPE minVal = std::numeric_limits<SCALAR_TYPE>::max();
+            SCALAR_TYPE minVal = a[0];
             for (uint32_t i = 0; i < VEC_TYPE::length(); i++) {
                 if (a[i] < minVal) {
                     minVal = a[i];
@@ -0,0 +1,262 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_SORT_H_
+#define UME_SIMD_SORT_H_
+
+#include <algorithm>
+#include <limits>
+
+#include "UMESimd.h"
+
+namespace UME
+{
+namespace SIMD
+{
+    namespace details
+    {
+        // Partitions of up to this many vectors are sorted with sorting networks.
+        const uint32_t SORT_NETWORK_VECTORS = 4;
+        // Vector size used by sort() without VEC_LEN: one native register.
+#if defined(__AVX512F__) || defined(__MIC__)
+        const uint32_t SORT_VECTOR_BYTES = 64;
+#else
+        const uint32_t SORT_VECTOR_BYTES = 32;
+#endif
+
+        // Value used to fill the unused lanes of a sorting network. It has to
+        // sort after every value of the input.
+        template<typename SCALAR_T>
+        UME_FORCE_INLINE SCALAR_T sortPadding() {
+            return std::numeric_limits<SCALAR_T>::has_infinity ?
+                std::numeric_limits<SCALAR_T>::infinity() :
+                std::numeric_limits<SCALAR_T>::max();
+        }
+
+        // Turns two sorted vectors into one sorted sequence, with the lower
+        // half in 'a'. 'a' followed by reversed 'b' is a bitonic sequence, so
+        // one min/max step splits it into two halves that only need sorting.
+        template<typename VEC_T>
+        UME_FORCE_INLINE void sortMerge(VEC_T & a, VEC_T & b) {
+            VEC_T t0 = b.sortd();
+            VEC_T t1 = a.min(t0);
+            VEC_T t2 = t0.max(a);
+            a = t1.sorta();
+            b = t2.sorta();
+        }
+
+        // Sorts 'n' elements, where 'n' is at most SORT_NETWORK_VECTORS * VEC_LEN.
+        template<uint32_t VEC_LEN, typename SCALAR_T>
+        void sortNetwork(SCALAR_T * data, uint32_t n) {
+            typedef SIMDVec<SCALAR_T, VEC_LEN> VEC_T;
+            typedef SIMDVecMask<VEC_LEN>       MASK_T;
+
+            VEC_T v[SORT_NETWORK_VECTORS];
+            uint32_t count = (n + VEC_LEN - 1) / VEC_LEN;
+            if (count == 0) return;
+            VEC_T pad(sortPadding<SCALAR_T>());
+            for (uint32_t i = 0; i < count; i++) {
+                uint32_t t0 = n - i * VEC_LEN;
+                if (t0 >= VEC_LEN) {
+                    v[i].load(data + i * VEC_LEN);
+                }
+                else {
+                    VEC_T t1(SCALAR_T(0));
+                    t1.loadn(t0, data + i * VEC_LEN);
+                    v[i] = pad.blend(MASK_T::prefix(t0), t1);
+                }
+                v[i] = v[i].sorta();
+            }
+
+            if (count == 2) {
+                sortMerge(v[0], v[1]);
+            }
+            else if (count > 2) {
+                if (count == 3) v[3] = pad;
+                sortMerge(v[0], v[1]);
+                sortMerge(v[2], v[3]);
+                // Same as in sortMerge, for sequences of two vectors.
+                VEC_T t0 = v[3].sortd();
+                VEC_T t1 = v[2].sortd();
+                VEC_T t2 = v[0].min(t0);
+                VEC_T t3 = v[1].min(t1);
+                VEC_T t4 = t0.max(v[0]);
+                VEC_T t5 = t1.max(v[1]);
+                v[0] = t2.min(t3);
+                v[1] = t3.max(t2);
+                v[2] = t4.min(t5);
+                v[3] = t5.max(t4);
+                for (uint32_t i = 0; i < 4; i++) v[i] = v[i].sorta();
+            }
+
+            for (uint32_t i = 0; i < count; i++) {
+                uint32_t t0 = n - i * VEC_LEN;
+                if (t0 >= VEC_LEN) v[i].store(data + i * VEC_LEN);
+                else v[i].storen(t0, data + i * VEC_LEN);
+            }
+        }
+
+        // Moves lanes of 'v' selected by 'low' to 'left', and the remaining
+        // 'active' lanes to the space just below 'right'.
+        template<typename VEC_T, typename MASK_T, typename SCALAR_T>
+        UME_FORCE_INLINE void partitionVector(
+            VEC_T const & v,
+            MASK_T const & low,
+            MASK_T const & high,
+            uint32_t active,
+            SCALAR_T * & left,
+            SCALAR_T * & right)
+        {
+            uint32_t t0 = v.compressstore(low, left);
+            left += t0;
+            right -= active - t0;
+            v.compressstore(high, right);
+        }
+
+        // Partitions data[0, n) in place and returns the size of the left side.
+        // The left side gets elements less than 'pivot', or not greater than
+        // 'pivot' if OR_EQUAL is set. 'n' has to be at least 2 * VEC_LEN.
+        //
+        // The first and the last vector are set aside, which leaves a gap of
+        // one vector at each end. Every step then reads a vector from the end
+        // with the smaller gap, and writes its lanes to both gaps, so writes
+        // never overtake reads.
+        template<uint32_t VEC_LEN, bool OR_EQUAL, typename SCALAR_T>
+        uint64_t partition(SCALAR_T * data, uint64_t n, SCALAR_T pivot) {
+            typedef SIMDVec<SCALAR_T, VEC_LEN> VEC_T;
+            typedef SIMDVecMask<VEC_LEN>       MASK_T;
+
+            VEC_T first, last, t0(SCALAR_T(0));
+            MASK_T t1;
+            first.load(data);
+            last.load(data + n - VEC_LEN);
+
+            SCALAR_T * left = data;
+            SCALAR_T * right = data + n;
+            SCALAR_T * readLeft = data + VEC_LEN;
+            SCALAR_T * readRight = data + n - VEC_LEN;
+            while (readRight - readLeft >= VEC_LEN) {
+                if (readLeft - left <= right - readRight) {
+                    t0.load(readLeft);
+                    readLeft += VEC_LEN;
+                }
+                else {
+                    readRight -= VEC_LEN;
+                    t0.load(readRight);
+                }
+                t1 = OR_EQUAL ? t0.cmple(pivot) : t0.cmplt(pivot);
+                partitionVector(t0, t1, t1.lnot(), VEC_LEN, left, right);
+            }
+            // Fewer than VEC_LEN elements are left between the read pointers.
+            uint32_t rest = uint32_t(readRight - readLeft);
+            if (rest > 0) {
+                MASK_T t2 = MASK_T::prefix(rest);
+                t0.loadn(rest, readLeft);
+                t1 = OR_EQUAL ? t0.cmple(pivot) : t0.cmplt(pivot);
+                partitionVector(t0, t1.land(t2), t1.lnot().land(t2), rest, left, right);
+            }
+            t1 = OR_EQUAL ? first.cmple(pivot) : first.cmplt(pivot);
+            partitionVector(first, t1, t1.lnot(), VEC_LEN, left, right);
+            t1 = OR_EQUAL ? last.cmple(pivot) : last.cmplt(pivot);
+            partitionVector(last, t1, t1.lnot(), VEC_LEN, left, right);
+            return uint64_t(left - data);
+        }
+
+        template<typename SCALAR_T>
+        UME_FORCE_INLINE SCALAR_T medianOfThree(SCALAR_T a, SCALAR_T b, SCALAR_T c) {
+            if (b < a) std::swap(a, b);
+            if (c < b) b = c < a ? a : c;
+            return b;
+        }
+
+        template<uint32_t VEC_LEN, typename SCALAR_T>
+        void quickSort(SCALAR_T * data, uint64_t n, uint32_t depthLimit) {
+            while (n > SORT_NETWORK_VECTORS * VEC_LEN) {
+                // Inputs that keep producing bad pivots are left to std::sort,
+                // which guarantees O(n log n).
+                if (depthLimit == 0) {
+                    std::sort(data, data + n);
+                    return;
+                }
+                depthLimit--;
+
+                SCALAR_T pivot = medianOfThree(data[0], data[n / 2], data[n - 1]);
+                uint64_t t0 = partition<VEC_LEN, false>(data, n, pivot);
+                if (t0 == 0) {
+                    // 'pivot' is the smallest element. All its copies can be
+                    // split off, as they are already in their final place.
+                    t0 = partition<VEC_LEN, true>(data, n, pivot);
+                    data += t0;
+                    n -= t0;
+                    continue;
+                }
+                // Recurse into the smaller side to bound the stack depth.
+                if (t0 < n - t0) {
+                    quickSort<VEC_LEN>(data, t0, depthLimit);
+                    data += t0;
+                    n -= t0;
+                }
+                else {
+                    quickSort<VEC_LEN>(data + t0, n - t0, depthLimit);
+                    n = t0;
+                }
+            }
+            sortNetwork<VEC_LEN>(data, uint32_t(n));
+        }
+    }
+
+    // sort
+    //   Sorts 'count' elements of 'data' in ascending order.
+    //
+    //   This is a quicksort with vectorized partitioning: every vector is
+    //   compared with the pivot and its lanes are written to both sides with
+    //   compressstore. Partitions of up to four vectors are finished with
+    //   sorting networks built from sorta/sortd and min/max. The order of
+    //   NaN values is unspecified, as it is with std::sort.
+    //
+    //   Plugins provide native compressstore and sorta/sortd for float,
+    //   int32_t and int64_t vectors; other types work through emulation, and
+    //   are better served by std::sort. Without VEC_LEN, vectors of one
+    //   native register are used.
+    template<uint32_t VEC_LEN, typename SCALAR_T>
+    void sort(SCALAR_T * data, uint64_t count) {
+        uint32_t depthLimit = 0;
+        for (uint64_t i = count; i > 1; i >>= 1) depthLimit += 2;
+        details::quickSort<VEC_LEN>(data, count, depthLimit);
+    }
+
+    template<typename SCALAR_T>
+    void sort(SCALAR_T * data, uint64_t count) {
+        sort<details::SORT_VECTOR_BYTES / sizeof(SCALAR_T)>(data, count);
+    }
+}
+}
+
+#endif
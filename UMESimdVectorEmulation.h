@@ -31,6 +31,8 @@
 #ifndef UME_SIMD_VECTOR_EMULATION_H_
 #define UME_SIMD_VECTOR_EMULATION_H_
 
+#include <cmath>
+
 #include "UMEInline.h"
 #include "UMEBasicTypes.h"
 
@@ -38,6 +40,12 @@ namespace UME
 {
 namespace SIMD
 {
+    // Accuracy-vs-speed tiers for the transcendental functions.
+    //   Accurate - default kernels, ~1 ULP, handles special values and full input range
+    //   Fast     - shorter polynomials, ~2-4 ULP, no NaN/inf/denormal/out-of-range handling
+    //   Approx   - ~12 bits of precision, same restrictions as Fast
+    enum class Precision { Accurate, Fast, Approx };
+
     //   All functions in this namespace will have one purpose: emulation of single function in different backends.
     //   While scalar emulation is already handling primitive cases, there exists a need for emulation of more
     //   complex functions, and still benefit from vectorization. Functions present in this namespace are non-specialized
@@ -69,7 +77,8 @@ namespace SIMD
 
             x -= z * C1F;
             x -= z * C2F;
-            const UINT_VEC_T n = UINT_VEC_T ( z );
+            // Biased exponent is positive over the whole valid range
+            const UINT_VEC_T n = UINT_VEC_T ( z + 127.0f );
 
             const FLOAT_VEC_T x2 = x * x;
 
@@ -88,7 +97,7 @@ namespace SIMD
 
             /* multiply by power of 2 */
             alignas(FLOAT_VEC_T::alignment()) float raw[FLOAT_VEC_T::length()];
-            ((n + 0x7f) << 23).store((uint32_t*)&raw[0]);
+            (n << 23).store((uint32_t*)&raw[0]);
             FLOAT_VEC_T z_0(raw);
             z *= z_0;
 
@@ -119,7 +128,8 @@ namespace SIMD
             x -= px * 6.93145751953125E-1;
             x -= px * 1.42860682030941723212E-6;
 
-            const UINT_VEC_T n = UINT_VEC_T ( x );
+            // Biased exponent is positive over the whole valid range
+            const UINT_VEC_T n = UINT_VEC_T ( px + 1023.0 );
 
             const FLOAT_VEC_T xx = x * x;
 
@@ -146,8 +156,8 @@ namespace SIMD
 
             /* multiply by power of 2 */
             alignas(FLOAT_VEC_T::alignment()) double raw[FLOAT_VEC_T::length()];
-            ((n + 1023) << 52).store((uint64_t*)&raw[0]);
-            UINT_VEC_T x_0((uint64_t*)raw);
+            (n << 52).store((uint64_t*)&raw[0]);
+            FLOAT_VEC_T x_0(raw);
 
             x *= x_0;
 
@@ -196,8 +206,9 @@ namespace SIMD
             initial_x.storea(raw);
             UINT_VEC_T n;
             n.loada((uint32_t*)&raw[0]);
-            UINT_VEC_T e = (n >> 23)-127;
-            fe = FLOAT_VEC_T(e);
+            UINT_VEC_T e = (n >> 23);
+            // Unbias in floating point: exponent is negative for x < 1
+            fe = FLOAT_VEC_T(e) - 127.0f;
 
             // fractional part
             const uint32_t p05f = 0x3f000000; // //sp2uint32(0.5);
@@ -250,7 +261,7 @@ namespace SIMD
         // LOG - double precision
         template<typename FLOAT_VEC_T, typename UINT_VEC_T>
         UME_FORCE_INLINE FLOAT_VEC_T logd(FLOAT_VEC_T const & initial_x) {
-            const double LOG_UPPER_LIMIT = 1e307;
+            const double LOG_UPPER_LIMIT = 1.7976931348623157e308; // DBL_MAX
             const double LOG_LOWER_LIMIT = 0;
 
             const double SQRTH = 0.70710678118654752440;
@@ -270,7 +281,7 @@ namespace SIMD
 
             // chop the head of the number: an int contains more than 11 bits (32)
             UINT_VEC_T e = le;
-            fe = e-1023;
+            fe = FLOAT_VEC_T(e) - 1023.0;
 
             // This puts to 11 zeroes the exponent
             n.banda(0x800FFFFFFFFFFFFFULL);
@@ -369,9 +380,139 @@ namespace SIMD
             t0.assign(mask, t1);
             return t0;
         }
-    
-        // LOG2
-        // LOG10
+
+        // LOG2 - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T log2f(FLOAT_VEC_T const & initial_x) {
+            const float LOG2EF = 1.44269504088896341f;
+            return logf<FLOAT_VEC_T, UINT_VEC_T>(initial_x) * LOG2EF;
+        }
+        // LOG2 - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T log2d(FLOAT_VEC_T const & initial_x) {
+            const double LOG2E = 1.4426950408889634073599;
+            return logd<FLOAT_VEC_T, UINT_VEC_T>(initial_x) * LOG2E;
+        }
+        // MLOG2 - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T log2f(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = log2f<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MLOG2 - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T log2d(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = log2d<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // LOG10 - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T log10f(FLOAT_VEC_T const & initial_x) {
+            const float LOG10EF = 0.434294481903251827651f;
+            return logf<FLOAT_VEC_T, UINT_VEC_T>(initial_x) * LOG10EF;
+        }
+        // LOG10 - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T log10d(FLOAT_VEC_T const & initial_x) {
+            const double LOG10E = 0.434294481903251827651;
+            return logd<FLOAT_VEC_T, UINT_VEC_T>(initial_x) * LOG10E;
+        }
+        // MLOG10 - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T log10f(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = log10f<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MLOG10 - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T log10d(MASK_T const & mask, FLOAT_VEC_T const & initial_x) {
+            FLOAT_VEC_T t0 = initial_x;
+            FLOAT_VEC_T t1 = log10d<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // POW - single precision version
+        //   x**y computed as exp(y*log(|x|)). Negative base is only defined
+        //   for integral exponents, in which case the sign follows parity of y.
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T powf(FLOAT_VEC_T const & x, FLOAT_VEC_T const & y) {
+            const FLOAT_VEC_T abs_x = x.abs();
+            FLOAT_VEC_T res = expf<FLOAT_VEC_T, UINT_VEC_T>(y * logf<FLOAT_VEC_T, UINT_VEC_T>(abs_x));
+
+            const FLOAT_VEC_T half_y = y * 0.5f;
+            MASK_T y_int = (y.floor() == y);
+            MASK_T y_odd = y_int & (half_y.floor() != half_y);
+            MASK_T x_neg = (x < 0.0f);
+
+            res.nega(x_neg & y_odd);
+            res[x_neg & !y_int] = std::numeric_limits<float>::quiet_NaN();
+
+            MASK_T x_zero = (x == 0.0f);
+            res[x_zero] = 0.0f;
+            res[x_zero & (y < 0.0f)] = std::numeric_limits<float>::infinity();
+            res[y == 0.0f] = 1.0f;
+            return res;
+        }
+        // POW - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T powd(FLOAT_VEC_T const & x, FLOAT_VEC_T const & y) {
+            const FLOAT_VEC_T abs_x = x.abs();
+            FLOAT_VEC_T res = expd<FLOAT_VEC_T, UINT_VEC_T>(y * logd<FLOAT_VEC_T, UINT_VEC_T>(abs_x));
+
+            const FLOAT_VEC_T half_y = y * 0.5;
+            MASK_T y_int = (y.floor() == y);
+            MASK_T y_odd = y_int & (half_y.floor() != half_y);
+            MASK_T x_neg = (x < 0.0);
+
+            res.nega(x_neg & y_odd);
+            res[x_neg & !y_int] = std::numeric_limits<double>::quiet_NaN();
+
+            MASK_T x_zero = (x == 0.0);
+            res[x_zero] = 0.0;
+            res[x_zero & (y < 0.0)] = std::numeric_limits<double>::infinity();
+            res[y == 0.0] = 1.0;
+            return res;
+        }
+        // MPOW - single precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T powf(MASK_T const & mask, FLOAT_VEC_T const & x, FLOAT_VEC_T const & y) {
+            FLOAT_VEC_T t0 = x;
+            FLOAT_VEC_T t1 = powf<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(x, y);
+            t0.assign(mask, t1);
+            return t0;
+        }
+        // MPOW - double precision version
+        template<typename FLOAT_VEC_T, typename UINT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T powd(MASK_T const & mask, FLOAT_VEC_T const & x, FLOAT_VEC_T const & y) {
+            FLOAT_VEC_T t0 = x;
+            FLOAT_VEC_T t1 = powd<FLOAT_VEC_T, UINT_VEC_T, MASK_T>(x, y);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // The Cody-Waite reduction used by the SIN/COS kernels is only accurate
+        // for moderate arguments: past 8192 (single) or 2^30 (double) precision
+        // the quadrant index no longer fits the reduction constants. Such lanes
+        // are rare, so recompute them with the scalar library functions.
+        template<typename FLOAT_VEC_T, typename MASK_T, typename SCALAR_T>
+        UME_FORCE_INLINE void trigLargeArgs(FLOAT_VEC_T const & xx, SCALAR_T limit, FLOAT_VEC_T * s, FLOAT_VEC_T * c) {
+            MASK_T mask_large = (xx.abs() > limit);
+            if (mask_large.hlor()) {
+                for (uint32_t i = 0; i < FLOAT_VEC_T::length(); i++) {
+                    if (mask_large[i]) {
+                        if (s != nullptr) s->insert(i, std::sin(xx[i]));
+                        if (c != nullptr) c->insert(i, std::cos(xx[i]));
+                    }
+                }
+            }
+        }
 
         // SIN - single precision version
         template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
@@ -390,7 +531,7 @@ namespace SIMD
             /* make argument positive */
             FLOAT_VEC_T x_pos = xx.abs();
 
-            j = INT_VEC_T(ONEOPIO4F * x_pos); /* integer part of x/PIO4 */
+            j = INT_VEC_T((ONEOPIO4F * x_pos).floor()); /* integer part of x/PIO4 */
 
             j = (j + 1) & (~1);
             const FLOAT_VEC_T y = FLOAT_VEC_T(j);
@@ -430,6 +571,7 @@ namespace SIMD
             ls.assign(mask_xx, -ls);
 
             s = ls;
+            trigLargeArgs<FLOAT_VEC_T, MASK_T, float>(xx, 8192.0f, &s, nullptr);
             return s;
         }
 
@@ -461,7 +603,7 @@ namespace SIMD
             INT_VEC_T j;
 
             FLOAT_VEC_T x = xx.abs();
-            j = INT_VEC_T(ONEOPIO4 * x); // always positive, so (int) == std::floor
+            j = INT_VEC_T((ONEOPIO4 * x).floor()); // conversion may round, so floor explicitly
             j = (j + 1) & (~1);
             const FLOAT_VEC_T y = FLOAT_VEC_T(j);
             // Extended precision modular arithmetic
@@ -514,6 +656,7 @@ namespace SIMD
             MASK_T maskXX = (xx < 0);
             s.nega(maskXX);
 
+            trigLargeArgs<FLOAT_VEC_T, MASK_T, double>(xx, 1073741824.0, &s, nullptr);
             return s;
         }
 
@@ -552,7 +695,7 @@ namespace SIMD
             /* make argument positive */
             FLOAT_VEC_T x_pos = xx.abs();
 
-            j = INT_VEC_T(ONEOPIO4F * x_pos); /* integer part of x/PIO4 */
+            j = INT_VEC_T((ONEOPIO4F * x_pos).floor()); /* integer part of x/PIO4 */
 
             j = (j + 1) & (~1);
             const FLOAT_VEC_T y = FLOAT_VEC_T(j);
@@ -588,6 +731,7 @@ namespace SIMD
             lc.assign(mask_signC, -lc);
 
             c = lc;
+            trigLargeArgs<FLOAT_VEC_T, MASK_T, float>(xx, 8192.0f, nullptr, &c);
             return c;
         }
 
@@ -620,7 +764,7 @@ namespace SIMD
             INT_VEC_T j;
 
             FLOAT_VEC_T x = xx.abs();
-            j = INT_VEC_T(ONEOPIO4 * x); // always positive, so (int) == std::floor
+            j = INT_VEC_T((ONEOPIO4 * x).floor()); // conversion may round, so floor explicitly
             j = (j + 1) & (~1);
             const FLOAT_VEC_T y = FLOAT_VEC_T(j);
             // Extended precision modular arithmetic
@@ -669,6 +813,7 @@ namespace SIMD
             MASK_T maskSignC = (signC == 0);
             c.nega(maskSignC);
 
+            trigLargeArgs<FLOAT_VEC_T, MASK_T, double>(xx, 1073741824.0, nullptr, &c);
             return c;
         }
 
@@ -705,7 +850,7 @@ namespace SIMD
             /* make argument positive */
             FLOAT_VEC_T x_pos = xx.abs();
 
-            j = INT_VEC_T(ONEOPIO4F * x_pos); /* integer part of x/PIO4 */
+            j = INT_VEC_T((ONEOPIO4F * x_pos).floor()); /* integer part of x/PIO4 */
 
             j = (j + 1) & (~1);
             const FLOAT_VEC_T y = FLOAT_VEC_T(j);
@@ -750,6 +895,7 @@ namespace SIMD
 
             c = lc;
             s = ls;
+            trigLargeArgs<FLOAT_VEC_T, MASK_T, float>(xx, 8192.0f, &s, &c);
         }
 
         // SINCOS - double precision version
@@ -778,7 +924,7 @@ namespace SIMD
             INT_VEC_T j;
 
             FLOAT_VEC_T x = xx.abs();
-            j = INT_VEC_T(ONEOPIO4 * x); // always positive, so (int) == std::floor
+            j = INT_VEC_T((ONEOPIO4 * x).floor()); // conversion may round, so floor explicitly
             j = (j + 1) & (~1);
             const FLOAT_VEC_T y = FLOAT_VEC_T(j);
             // Extended precision modular arithmetic
@@ -834,34 +980,745 @@ namespace SIMD
 
             MASK_T maskXX = (xx < 0);
             s.nega(maskXX);
+
+            trigLargeArgs<FLOAT_VEC_T, MASK_T, double>(xx, 1073741824.0, &s, &c);
         }
 
         // MSINCOS - single precision version
-        template<typename FLOAT_VEC_T, typename MASK_TYPE>
-        UME_FORCE_INLINE void sincosf(MASK_TYPE const & mask, FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T & c) {
+        //   Both results come from a single polynomial evaluation and are
+        //   blended with the source so that inactive lanes keep the input value.
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE void sincosf(MASK_T const & mask, FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T & c) {
             FLOAT_VEC_T masked_s, masked_c;
+            sincosf<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx, masked_s, masked_c);
             s = xx;
             c = xx;
-            sincosf<FLOAT_VEC_T>(xx, masked_s, masked_c);
             s.assign(mask, masked_s);
             c.assign(mask, masked_c);
         }
 
         // MSINCOS - double precision version
-        template<typename FLOAT_VEC_T, typename MASK_TYPE>
-        UME_FORCE_INLINE void sincosd(MASK_TYPE const & mask, FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T & c) {
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE void sincosd(MASK_T const & mask, FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T & c) {
             FLOAT_VEC_T masked_s, masked_c;
+            sincosd<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx, masked_s, masked_c);
             s = xx;
             c = xx;
-            sincosd<FLOAT_VEC_T>(xx, masked_s, masked_c);
             s.assign(mask, masked_s);
             c.assign(mask, masked_c);
         }
 
-        // TAN
-        // MTAN
-        // CTAN
-        // MCTAN
+        // TAN - single precision version
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T tanf(FLOAT_VEC_T const & xx)
+        {
+            const float ONEOPIO4F = 4.0f / (3.1415927f);
+
+            const float DP1F = (float)0.78515625;
+            const float DP2F = (float)2.4187564849853515625e-4;
+            const float DP3F = (float)3.77489497744594108e-8;
+
+            INT_VEC_T j;
+
+            /* make argument positive */
+            FLOAT_VEC_T x_pos = xx.abs();
+
+            j = INT_VEC_T((ONEOPIO4F * x_pos).floor()); /* integer part of x/PIO4 */
+
+            j = (j + 1) & (~1);
+            const FLOAT_VEC_T y = FLOAT_VEC_T(j);
+
+            // Extended precision modular arithmetic
+            const FLOAT_VEC_T z = ((x_pos - y * DP1F) - y * DP2F) - y * DP3F;
+
+            const INT_VEC_T poly = j & 2;
+
+            FLOAT_VEC_T zz = z * z;
+
+            FLOAT_VEC_T t = (((((9.38540185543E-3f * zz
+                + 3.11992232697E-3f) * zz
+                + 2.44301354525E-2f) * zz
+                + 5.34112807005E-2f) * zz
+                + 1.33387994085E-1f) * zz
+                + 3.33331568548E-1f) * zz * z
+                + z;
+
+            // Odd octants: tan(x) = -1/tan(x - PIO2)
+            MASK_T mask_poly = (poly != 0);
+            t.assign(mask_poly, FLOAT_VEC_T(-1.0f) / t);
+
+            MASK_T mask_xx = (xx < 0);
+            t.nega(mask_xx);
+
+            // Reduction above is exact only up to 2^13, defer larger arguments to libm
+            MASK_T mask_big = (x_pos > 8192.0f);
+            if (mask_big.hlor()) {
+                for (unsigned int i = 0; i < FLOAT_VEC_T::length(); i++) {
+                    if (mask_big.extract(i)) t.insert(i, std::tan(xx.extract(i)));
+                }
+            }
+
+            return t;
+        }
+
+        // TAN - double precision version
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T tand(FLOAT_VEC_T const & xx)
+        {
+            const double ONEOPIO4 = 4.0 / (3.14159265358979323846);
+
+            const double PX1tan = -1.30936939181383777646E4;
+            const double PX2tan = 1.15351664838587416140E6;
+            const double PX3tan = -1.79565251976484877988E7;
+
+            const double QX1tan = 1.36812963470692954678E4;
+            const double QX2tan = -1.32089234440210967447E6;
+            const double QX3tan = 2.50083801823357915839E7;
+            const double QX4tan = -5.38695755929454629881E7;
+
+            const double DP1D = 7.853981554508209228515625E-1;
+            const double DP2D = 7.94662735614792836714E-9;
+            const double DP3D = 3.06161699786838294307E-17;
+
+            INT_VEC_T j;
+
+            FLOAT_VEC_T x = xx.abs();
+            j = INT_VEC_T((ONEOPIO4 * x).floor()); // conversion may round, so floor explicitly
+            j = (j + 1) & (~1);
+            const FLOAT_VEC_T y = FLOAT_VEC_T(j);
+            // Extended precision modular arithmetic
+            const FLOAT_VEC_T z = ((x - y * DP1D) - y * DP2D) - y * DP3D;
+
+            const INT_VEC_T poly = j & 2;
+
+            FLOAT_VEC_T zz = z * z;
+
+            FLOAT_VEC_T px(PX1tan);
+            px *= zz;
+            px += PX2tan;
+            px *= zz;
+            px += PX3tan;
+
+            FLOAT_VEC_T qx = zz;
+            qx += QX1tan;
+            qx *= zz;
+            qx += QX2tan;
+            qx *= zz;
+            qx += QX3tan;
+            qx *= zz;
+            qx += QX4tan;
+
+            FLOAT_VEC_T t = z + z * zz * px / qx;
+
+            // Odd octants: tan(x) = -1/tan(x - PIO2)
+            MASK_T maskPoly = (poly != 0);
+            t.assign(maskPoly, FLOAT_VEC_T(-1.0) / t);
+
+            MASK_T maskXX = (xx < 0);
+            t.nega(maskXX);
+
+            // Reduction above is exact only up to 2^30, defer larger arguments to libm
+            MASK_T maskBig = (x > 1.073741824e9);
+            if (maskBig.hlor()) {
+                for (unsigned int i = 0; i < FLOAT_VEC_T::length(); i++) {
+                    if (maskBig.extract(i)) t.insert(i, std::tan(xx.extract(i)));
+                }
+            }
+
+            return t;
+        }
+
+        // MTAN - single precision version
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T tanf(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = tanf<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // MTAN - double precision version
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T tand(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = tand<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // CTAN - single precision version
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T ctanf(FLOAT_VEC_T const & xx) {
+            return FLOAT_VEC_T(1.0f) / tanf<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
+        }
+
+        // CTAN - double precision version
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T ctand(FLOAT_VEC_T const & xx) {
+            return FLOAT_VEC_T(1.0) / tand<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
+        }
+
+        // MCTAN - single precision version
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T ctanf(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = ctanf<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // MCTAN - double precision version
+        template<typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T ctand(MASK_T const & mask, FLOAT_VEC_T const & xx) {
+            FLOAT_VEC_T t0 = xx;
+            FLOAT_VEC_T t1 = ctand<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
+            t0.assign(mask, t1);
+            return t0;
+        }
+
+        // ATAN - single precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T atanf(FLOAT_VEC_T const & xx)
+        {
+            const float T3PO8F = 2.414213562373095f;  // tan(3*pi/8)
+            const float PIO8F = 0.4142135623730950f;  // tan(pi/8)
+            const float PIO2F = 1.570796326794896619f;
+            const float PIO4F = 0.7853981633974483096f;
+
+            const FLOAT_VEC_T x = xx.abs();
+
+            // Range reduction to [0, tan(pi/8)]
+            MASK_T mask_big = (x > T3PO8F);
+            MASK_T mask_mid = (x > PIO8F) & !mask_big;
+
+            FLOAT_VEC_T y(0.0f);
+            FLOAT_VEC_T z = x;
+            y.assign(mask_mid, PIO4F);
+            z.assign(mask_mid, (x - 1.0f) / (x + 1.0f));
+            y.assign(mask_big, PIO2F);
+            z.assign(mask_big, FLOAT_VEC_T(-1.0f) / x);
+
+            const FLOAT_VEC_T zz = z * z;
+
+            FLOAT_VEC_T res = (((8.05374449538E-2f * zz
+                - 1.38776856032E-1f) * zz
+                + 1.99777106478E-1f) * zz
+                - 3.33329491539E-1f) * zz * z
+                + z;
+            res += y;
+
+            MASK_T mask_xx = (xx < 0);
+            res.nega(mask_xx);
+
+            return res;
+        }
+
+        // ATAN - double precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T atand(FLOAT_VEC_T const & xx)
+        {
+            const double T3P8 = 2.41421356237309504880;  // tan(3*pi/8)
+            const double MOREBITS = 6.123233995736765886130E-17;
+            const double PIO2 = 1.57079632679489661923;
+            const double PIO4 = 0.78539816339744830962;
+
+            const double PX1atan = -8.750608600031904122785E-1;
+            const double PX2atan = -1.615753718733365076637E1;
+            const double PX3atan = -7.500855792314704667340E1;
+            const double PX4atan = -1.228866684490136173410E2;
+            const double PX5atan = -6.485021904942025371773E1;
+
+            const double QX1atan = 2.485846490142306297962E1;
+            const double QX2atan = 1.650270098316988542046E2;
+            const double QX3atan = 4.328810604912902668951E2;
+            const double QX4atan = 4.853903996359136964868E2;
+            const double QX5atan = 1.945506571482613964425E2;
+
+            const FLOAT_VEC_T x = xx.abs();
+
+            // Range reduction to [0, 0.66]
+            MASK_T maskBig = (x > T3P8);
+            MASK_T maskMid = (x > 0.66) & !maskBig;
+
+            FLOAT_VEC_T y(0.0);
+            FLOAT_VEC_T morebits(0.0);
+            FLOAT_VEC_T z = x;
+            y.assign(maskMid, PIO4);
+            morebits.assign(maskMid, 0.5 * MOREBITS);
+            z.assign(maskMid, (x - 1.0) / (x + 1.0));
+            y.assign(maskBig, PIO2);
+            morebits.assign(maskBig, MOREBITS);
+            z.assign(maskBig, FLOAT_VEC_T(-1.0) / x);
+
+            const FLOAT_VEC_T zz = z * z;
+
+            FLOAT_VEC_T px(PX1atan);
+            px *= zz;
+            px += PX2atan;
+            px *= zz;
+            px += PX3atan;
+            px *= zz;
+            px += PX4atan;
+            px *= zz;
+            px += PX5atan;
+
+            FLOAT_VEC_T qx = zz;
+            qx += QX1atan;
+            qx *= zz;
+            qx += QX2atan;
+            qx *= zz;
+            qx += QX3atan;
+            qx *= zz;
+            qx += QX4atan;
+            qx *= zz;
+            qx += QX5atan;
+
+            FLOAT_VEC_T res = z * zz * px / qx + z;
+            res += morebits;
+            res += y;
+
+            MASK_T maskXX = (xx < 0);
+            res.nega(maskXX);
+
+            return res;
+        }
+
+        // ATAN2 - single precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T atan2f(FLOAT_VEC_T const & y, FLOAT_VEC_T const & x)
+        {
+            const float PIO8F = 0.4142135623730950f;  // tan(pi/8)
+            const float PIF = 3.141592653589793238f;
+            const float PIO2F = 1.570796326794896619f;
+            const float PIO4F = 0.7853981633974483096f;
+
+            // Move to the first octant: t = min(|x|,|y|) / max(|x|,|y|)
+            FLOAT_VEC_T xx = x.abs();
+            FLOAT_VEC_T yy = y.abs();
+            MASK_T mask_swap = (yy > xx);
+            const FLOAT_VEC_T tmp = xx;
+            xx.assign(mask_swap, yy);
+            yy.assign(mask_swap, tmp);
+
+            const FLOAT_VEC_T t = yy / xx;
+            MASK_T mask_mid = (t > PIO8F);
+            FLOAT_VEC_T z = t;
+            z.assign(mask_mid, (t - 1.0f) / (t + 1.0f));
+
+            const FLOAT_VEC_T zz = z * z;
+
+            FLOAT_VEC_T res = (((8.05374449538E-2f * zz
+                - 1.38776856032E-1f) * zz
+                + 1.99777106478E-1f) * zz
+                - 3.33329491539E-1f) * zz * z
+                + z;
+            res[xx == 0.0f] = 0.0f;
+
+            // Move back in place
+            res.adda(mask_mid, PIO4F);
+            res.assign(mask_swap, PIO2F - res);
+            res.assign(x < 0.0f, PIF - res);
+            res.nega(y < 0.0f);
+
+            return res;
+        }
+
+        // ATAN2 - double precision version
+        template<typename FLOAT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T atan2d(FLOAT_VEC_T const & y, FLOAT_VEC_T const & x)
+        {
+            const double MOREBITS = 6.123233995736765886130E-17;
+            const double PI = 3.14159265358979323846;
+            const double PIO2 = 1.57079632679489661923;
+            const double PIO4 = 0.78539816339744830962;
+
+            const double PX1atan = -8.750608600031904122785E-1;
+            const double PX2atan = -1.615753718733365076637E1;
+            const double PX3atan = -7.500855792314704667340E1;
+            const double PX4atan = -1.228866684490136173410E2;
+            const double PX5atan = -6.485021904942025371773E1;
+
+            const double QX1atan = 2.485846490142306297962E1;
+            const double QX2atan = 1.650270098316988542046E2;
+            const double QX3atan = 4.328810604912902668951E2;
+            const double QX4atan = 4.853903996359136964868E2;
+            const double QX5atan = 1.945506571482613964425E2;
+
+            // Move to the first octant: t = min(|x|,|y|) / max(|x|,|y|)
+            FLOAT_VEC_T xx = x.abs();
+            FLOAT_VEC_T yy = y.abs();
+            MASK_T maskSwap = (yy > xx);
+            const FLOAT_VEC_T tmp = xx;
+            xx.assign(maskSwap, yy);
+            yy.assign(maskSwap, tmp);
+
+            const FLOAT_VEC_T t = yy / xx;
+            MASK_T maskMid = (t > 0.66);
+            FLOAT_VEC_T z = t;
+            z.assign(maskMid, (t - 1.0) / (t + 1.0));
+
+            const FLOAT_VEC_T zz = z * z;
+
+            FLOAT_VEC_T px(PX1atan);
+            px *= zz;
+            px += PX2atan;
+            px *= zz;
+            px += PX3atan;
+            px *= zz;
+            px += PX4atan;
+            px *= zz;
+            px += PX5atan;
+
+            FLOAT_VEC_T qx = zz;
+            qx += QX1atan;
+            qx *= zz;
+            qx += QX2atan;
+            qx *= zz;
+            qx += QX3atan;
+            qx *= zz;
+            qx += QX4atan;
+            qx *= zz;
+            qx += QX5atan;
+
+            FLOAT_VEC_T res = z * zz * px / qx + z;
+            res[xx == 0.0] = 0.0;
+
+            // Move back in place
+            res.adda(maskMid, PIO4 + 0.5 * MOREBITS);
+            res.assign(maskSwap, PIO2 - res);
+            res.assign(x < 0.0, PI - res);
+            res.nega(y < 0.0);
+
+            return res;
+        }
+
+        // ---------------------------------------------------------------
+        // Precision tiers
+        //   Kernels below implement Precision::Fast and Precision::Approx
+        //   versions of EXP, LOG, SIN, COS and SINCOS. Precision::Accurate
+        //   forwards to the default kernels above. Fast and Approx versions
+        //   use shorter minimax polynomials and do not handle NaN, infinity,
+        //   denormals or arguments outside of the reduced range.
+        // ---------------------------------------------------------------
+
+        // EXP - single precision, tiered version
+        template<Precision P, typename FLOAT_VEC_T, typename UINT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T expf(FLOAT_VEC_T const & initial_x) {
+            if (P == Precision::Accurate) return expf<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+
+            const float C1F = 0.693359375f;
+            const float C2F = -2.12194440e-4f;
+            const float LOG2EF = 1.44269504088896341f;
+
+            FLOAT_VEC_T x = initial_x;
+            FLOAT_VEC_T z = (LOG2EF * x + 0.5f).floor();
+
+            x -= z * C1F;
+            x -= z * C2F;
+            const UINT_VEC_T n = UINT_VEC_T(z + 127.0f);
+
+            // e**x = 1 + x + x**2 * P(x)
+            FLOAT_VEC_T px;
+            if (P == Precision::Fast) {
+                px = x * 8.3125269690816373986E-3f + 4.18901162526025398777E-2f;
+                px = px * x + 1.66671144520421461653E-1f;
+                px = px * x + 4.99992317620525207545E-1f;
+            }
+            else {
+                px = x * 1.66628168513996040458E-1f + 5.03941088813088213684E-1f;
+            }
+            z = px * (x * x) + x + 1.0f;
+
+            /* multiply by power of 2 */
+            alignas(FLOAT_VEC_T::alignment()) float raw[FLOAT_VEC_T::length()];
+            (n << 23).store((uint32_t*)&raw[0]);
+            FLOAT_VEC_T z_0(raw);
+            return z * z_0;
+        }
+
+        // EXP - double precision, tiered version
+        template<Precision P, typename FLOAT_VEC_T, typename UINT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T expd(FLOAT_VEC_T const & initial_x) {
+            if (P == Precision::Accurate) return expd<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+
+            const double LOG2E = 1.4426950408889634073599;
+
+            FLOAT_VEC_T x = initial_x;
+            FLOAT_VEC_T z = (LOG2E * x + 0.5).floor();
+
+            x -= z * 6.93145751953125E-1;
+            x -= z * 1.42860682030941723212E-6;
+            const UINT_VEC_T n = UINT_VEC_T(z + 1023.0);
+
+            // e**x = 1 + x + x**2 * P(x), no division unlike the Pade form
+            FLOAT_VEC_T px;
+            if (P == Precision::Fast) {
+                px = x * 2.50000742363309957952E-8 + 2.76302344676464673246E-7;
+                px = px * x + 2.75575862629115306262E-6;
+                px = px * x + 2.48014931345522677558E-5;
+                px = px * x + 1.98412695067794019277E-4;
+                px = px * x + 1.38888889435993787197E-3;
+                px = px * x + 8.33333333349433599209E-3;
+                px = px * x + 4.16666666665302591780E-2;
+                px = px * x + 1.66666666666664127640E-1;
+                px = px * x + 5.00000000000001061759E-1;
+            }
+            else {
+                px = x * 1.66628168513996040458E-1 + 5.03941088813088213684E-1;
+            }
+            z = px * (x * x) + x + 1.0;
+
+            /* multiply by power of 2 */
+            alignas(FLOAT_VEC_T::alignment()) double raw[FLOAT_VEC_T::length()];
+            (n << 52).store((uint64_t*)&raw[0]);
+            FLOAT_VEC_T z_0(raw);
+            return z * z_0;
+        }
+
+        // LOG - single precision, tiered version
+        template<Precision P, typename FLOAT_VEC_T, typename UINT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T logf(FLOAT_VEC_T const & initial_x) {
+            if (P == Precision::Accurate) return logf<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+
+            const float SQRTHF = 0.707106781186547524f;
+
+            // Split into exponent and mantissa in [0.5, 1)
+            alignas(FLOAT_VEC_T::alignment()) float raw[FLOAT_VEC_T::length()];
+            initial_x.storea(raw);
+            UINT_VEC_T n;
+            n.loada((uint32_t*)&raw[0]);
+            FLOAT_VEC_T fe = FLOAT_VEC_T(n >> 23) - 127.0f;
+            n.banda(0x807fffff);
+            n |= 0x3f000000;
+            n.storea((uint32_t*)&raw[0]);
+            FLOAT_VEC_T x;
+            x.loada(raw);
+
+            fe.postinc(x > SQRTHF);
+            x.adda(x <= SQRTHF, x);
+            x -= 1.0f;
+
+            // log(1+x) = x - x**2/2 + x**3 * P(x)
+            FLOAT_VEC_T px;
+            if (P == Precision::Fast) {
+                px = x * 8.70035995893705793167E-2f - 1.42674763010103569877E-1f;
+                px = px * x + 1.49147870141389662940E-1f;
+                px = px * x - 1.65775860116911339653E-1f;
+                px = px * x + 1.99630622910247546966E-1f;
+                px = px * x - 2.50013370158437690900E-1f;
+                px = px * x + 3.33339107698746587033E-1f;
+            }
+            else {
+                px = x * 1.73248508776491854032E-1f - 2.64612389967695799623E-1f;
+                px = px * x + 3.35673476651665214019E-1f;
+            }
+            const FLOAT_VEC_T x2 = x * x;
+            FLOAT_VEC_T res = px * (x2 * x) - 0.5f * x2;
+            res += -2.12194440e-4f * fe;
+            res += x;
+            res += 0.693359375f * fe;
+            return res;
+        }
+
+        // LOG - double precision, tiered version
+        template<Precision P, typename FLOAT_VEC_T, typename UINT_VEC_T>
+        UME_FORCE_INLINE FLOAT_VEC_T logd(FLOAT_VEC_T const & initial_x) {
+            if (P == Precision::Accurate) return logd<FLOAT_VEC_T, UINT_VEC_T>(initial_x);
+
+            const double SQRTH = 0.70710678118654752440;
+
+            // Split into exponent and mantissa in [0.5, 1)
+            alignas(FLOAT_VEC_T::alignment()) double raw[FLOAT_VEC_T::length()];
+            initial_x.storea(raw);
+            UINT_VEC_T n;
+            n.loada((uint64_t*)&raw[0]);
+            FLOAT_VEC_T fe = FLOAT_VEC_T(n >> 52) - 1023.0;
+            n.banda(0x800FFFFFFFFFFFFFULL);
+            n |= 0x3FE0000000000000ULL;
+            n.storea((uint64_t*)&raw[0]);
+            FLOAT_VEC_T x;
+            x.loada(&raw[0]);
+
+            fe.postinc(x > SQRTH);
+            x.adda(x <= SQRTH, x);
+            x -= 1.0;
+
+            FLOAT_VEC_T res;
+            if (P == Precision::Fast) {
+                // log(1+x) = 2s + s**3 * R(s**2), s = x/(2+x)
+                const FLOAT_VEC_T s = x / (x + 2.0);
+                const FLOAT_VEC_T ss = s * s;
+                FLOAT_VEC_T rx = ss * 1.47954758391354998400E-1 + 1.53140987538708909939E-1;
+                rx = rx * ss + 1.81835624090234419617E-1;
+                rx = rx * ss + 2.22221986106904560824E-1;
+                rx = rx * ss + 2.85714287420166716922E-1;
+                rx = rx * ss + 3.99999999994163649819E-1;
+                rx = rx * ss + 6.66666666666673415693E-1;
+                res = rx * (ss * s) + 2.0 * s;
+            }
+            else {
+                // log(1+x) = x - x**2/2 + x**3 * P(x)
+                FLOAT_VEC_T px = x * 1.73248508776491854032E-1 - 2.64612389967695799623E-1;
+                px = px * x + 3.35673476651665214019E-1;
+                const FLOAT_VEC_T x2 = x * x;
+                res = px * (x2 * x) - 0.5 * x2 + x;
+            }
+            res -= fe * 2.121944400546905827679e-4;
+            res += fe * 0.693359375;
+            return res;
+        }
+
+        // SINCOS - single precision, tiered version
+        template<Precision P, typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE void sincosf(FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T & c) {
+            if (P == Precision::Accurate) {
+                sincosf<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx, s, c);
+                return;
+            }
+
+            const float ONEOPIO4F = 4.0f / (3.1415927f);
+
+            const float DP1F = 0.78515625f;
+            const float DP2F = 2.4187564849853515625e-4f;
+            const float DP3F = 3.77489497744594108e-8f;
+
+            FLOAT_VEC_T x_pos = xx.abs();
+            INT_VEC_T j = INT_VEC_T((ONEOPIO4F * x_pos).floor());
+            j = (j + 1) & (~1);
+            const FLOAT_VEC_T y = FLOAT_VEC_T(j);
+            const FLOAT_VEC_T x = ((x_pos - y * DP1F) - y * DP2F) - y * DP3F;
+
+            const INT_VEC_T signS = (j & 4);
+            j -= 2;
+            const INT_VEC_T signC = (j & 4);
+            const INT_VEC_T poly = j & 2;
+
+            const FLOAT_VEC_T z = x * x;
+            FLOAT_VEC_T ls, lc;
+            if (P == Precision::Fast) {
+                ls = ((-1.95152838454293109756E-4f * z
+                    + 8.33216076761005938093E-3f) * z
+                    - 1.66666546096628482971E-1f) * z * x + x;
+                lc = (-1.36487135630059356256E-3f * z
+                    + 4.16610712610964628465E-2f) * z * z
+                    - 0.5f * z + 1.0f;
+            }
+            else {
+                ls = (8.16328204814409805675E-3f * z
+                    - 1.66633903836622578993E-1f) * z * x + x;
+                lc = 4.08993029838712361524E-2f * z * z
+                    - 0.5f * z + 1.0f;
+            }
+
+            MASK_T mask_poly = (poly == 0);
+            const FLOAT_VEC_T tmp = lc;
+            lc.assign(mask_poly, ls);
+            ls.assign(mask_poly, tmp);
+
+            lc.nega(signC == 0);
+            ls.nega(signS != 0);
+            ls.nega(xx < 0);
+
+            s = ls;
+            c = lc;
+        }
+
+        // SINCOS - double precision, tiered version
+        template<Precision P, typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE void sincosd(FLOAT_VEC_T const & xx, FLOAT_VEC_T & s, FLOAT_VEC_T & c) {
+            if (P == Precision::Accurate) {
+                sincosd<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx, s, c);
+                return;
+            }
+
+            const double ONEOPIO4 = 4.0 / (3.14159265358979323846);
+
+            const double DP1D = 7.853981554508209228515625E-1;
+            const double DP2D = 7.94662735614792836714E-9;
+            const double DP3D = 3.06161699786838294307E-17;
+
+            FLOAT_VEC_T x_pos = xx.abs();
+            INT_VEC_T j = INT_VEC_T((ONEOPIO4 * x_pos).floor());
+            j = (j + 1) & (~1);
+            const FLOAT_VEC_T y = FLOAT_VEC_T(j);
+            const FLOAT_VEC_T x = ((x_pos - y * DP1D) - y * DP2D) - y * DP3D;
+
+            const INT_VEC_T signS = (j & 4);
+            j -= 2;
+            const INT_VEC_T signC = (j & 4);
+            const INT_VEC_T poly = j & 2;
+
+            const FLOAT_VEC_T zz = x * x;
+            FLOAT_VEC_T ls, lc;
+            if (P == Precision::Fast) {
+                FLOAT_VEC_T px = zz * 1.58962301576546568060E-10 - 2.50507477628578072866E-8;
+                px = px * zz + 2.75573136213857245213E-6;
+                px = px * zz - 1.98412698295895385996E-4;
+                px = px * zz + 8.33333333332211858878E-3;
+                px = px * zz - 1.66666666666666307295E-1;
+                ls = px * (zz * x) + x;
+
+                FLOAT_VEC_T qx = zz * 2.06451189384000197081E-9 - 2.75555231102540162958E-7;
+                qx = qx * zz + 2.48015807073181473292E-5;
+                qx = qx * zz - 1.38888888776117717965E-3;
+                qx = qx * zz + 4.16666666665965383189E-2;
+                lc = qx * (zz * zz) - 0.5 * zz + 1.0;
+            }
+            else {
+                ls = (8.16328204814409805675E-3 * zz
+                    - 1.66633903836622578993E-1) * zz * x + x;
+                lc = 4.08993029838712361524E-2 * zz * zz
+                    - 0.5 * zz + 1.0;
+            }
+
+            MASK_T maskPoly = (poly == 0);
+            const FLOAT_VEC_T tmp = lc;
+            lc.assign(maskPoly, ls);
+            ls.assign(maskPoly, tmp);
+
+            lc.nega(signC == 0);
+            ls.nega(signS != 0);
+            ls.nega(xx < 0);
+
+            s = ls;
+            c = lc;
+        }
+
+        // SIN - single precision, tiered version
+        template<Precision P, typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T sinf(FLOAT_VEC_T const & xx) {
+            if (P == Precision::Accurate) return sinf<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
+            FLOAT_VEC_T s, c;
+            sincosf<P, FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx, s, c);
+            return s;
+        }
+
+        // SIN - double precision, tiered version
+        template<Precision P, typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T sind(FLOAT_VEC_T const & xx) {
+            if (P == Precision::Accurate) return sind<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
+            FLOAT_VEC_T s, c;
+            sincosd<P, FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx, s, c);
+            return s;
+        }
+
+        // COS - single precision, tiered version
+        template<Precision P, typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T cosf(FLOAT_VEC_T const & xx) {
+            if (P == Precision::Accurate) return cosf<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
+            FLOAT_VEC_T s, c;
+            sincosf<P, FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx, s, c);
+            return c;
+        }
+
+        // COS - double precision, tiered version
+        template<Precision P, typename FLOAT_VEC_T, typename INT_VEC_T, typename MASK_T>
+        UME_FORCE_INLINE FLOAT_VEC_T cosd(FLOAT_VEC_T const & xx) {
+            if (P == Precision::Accurate) return cosd<FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx);
+            FLOAT_VEC_T s, c;
+            sincosd<P, FLOAT_VEC_T, INT_VEC_T, MASK_T>(xx, s, c);
+            return c;
+        }
     }
 }
 }
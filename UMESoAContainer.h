@@ -0,0 +1,246 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SOA_CONTAINER_H_
+#define UME_SOA_CONTAINER_H_
+
+#include <tuple>
+#include <cstring>
+#include <type_traits>
+
+#include "UMESimd.h"
+#include "UMEMemory.h"
+
+namespace UME
+{
+namespace SIMD
+{
+    namespace details
+    {
+        // C++11 replacement for std::index_sequence
+        template<int... I> struct IndexSequence {};
+        template<int N, int... I> struct MakeIndexSequence : MakeIndexSequence<N - 1, N - 1, I...> {};
+        template<int... I> struct MakeIndexSequence<0, I...> { typedef IndexSequence<I...> type; };
+
+        // Evaluate an expression for every element of a parameter pack
+        struct ExpandPack {
+            template<typename... T> ExpandPack(T&&...) {}
+        };
+    }
+
+    // SoAContainer
+    //   Structure-of-arrays storage. Each field is kept in its own array aligned
+    //   to PADDING bytes and padded with zeros to a multiple of PADDING elements,
+    //   so that SIMDVec<FIELD, VEC_LEN> of any supported length can be loaded
+    //   with aligned loads without going past the allocation.
+    //
+    //   Example:
+    //      SoAContainer<float, float, int32_t> particles(count);
+    //      particles.for_each_vector<8>(
+    //          [](SIMDVecMask<8> const & mask, SIMDVec<float, 8> & x, SIMDVec<float, 8> & v, SIMDVec<int32_t, 8> & id) {
+    //              x.adda(mask, v);
+    //          });
+    template<typename... FIELDS>
+    class SoAContainer
+    {
+    public:
+        static const int FIELD_COUNT = sizeof...(FIELDS);
+        // Alignment of the field arrays, large enough for 1024b vectors
+        static const std::size_t PADDING = 128;
+
+        template<int I>
+        using field_type = typename std::tuple_element<I, std::tuple<FIELDS...>>::type;
+
+        explicit SoAContainer(std::size_t size) : mSize(size), mCapacity(padded(size))
+        {
+            allocate(typename details::MakeIndexSequence<FIELD_COUNT>::type());
+        }
+
+        ~SoAContainer()
+        {
+            deallocate(typename details::MakeIndexSequence<FIELD_COUNT>::type());
+        }
+
+        SoAContainer(SoAContainer const &) = delete;
+        SoAContainer & operator= (SoAContainer const &) = delete;
+
+        UME_FORCE_INLINE std::size_t size() const { return mSize; }
+        // Number of elements allocated per field, including padding
+        UME_FORCE_INLINE std::size_t capacity() const { return mCapacity; }
+
+        template<int I>
+        UME_FORCE_INLINE field_type<I>* field() { return std::get<I>(mFields); }
+        template<int I>
+        UME_FORCE_INLINE field_type<I> const * field() const { return std::get<I>(mFields); }
+
+        // Call 'kernel(mask, fields...)' for every chunk of VEC_LEN elements.
+        // Fields are passed as SIMDVec<FIELD, VEC_LEN> references and written
+        // back after the call. The mask is all-true for full chunks and selects
+        // the valid elements of the last, partial chunk.
+        template<uint32_t VEC_LEN, typename KERNEL_T>
+        void for_each_vector(KERNEL_T kernel)
+        {
+            forEachVector<VEC_LEN>(kernel, typename details::MakeIndexSequence<FIELD_COUNT>::type());
+        }
+
+        // Fill the container from an array of structures, using a strided gather
+        // for each field. 'members' select the structure member for every field.
+        template<uint32_t VEC_LEN, typename STRUCT_T>
+        void fromAoS(STRUCT_T const * aos, FIELDS STRUCT_T::*... members)
+        {
+            fromAoSImpl<VEC_LEN>(aos, typename details::MakeIndexSequence<FIELD_COUNT>::type(), members...);
+        }
+
+        // Write the container into an array of structures, using a strided scatter
+        // for each field.
+        template<uint32_t VEC_LEN, typename STRUCT_T>
+        void toAoS(STRUCT_T * aos, FIELDS STRUCT_T::*... members) const
+        {
+            toAoSImpl<VEC_LEN>(aos, typename details::MakeIndexSequence<FIELD_COUNT>::type(), members...);
+        }
+
+    private:
+        std::size_t mSize;
+        std::size_t mCapacity;
+        std::tuple<FIELDS*...> mFields;
+
+        static UME_FORCE_INLINE std::size_t padded(std::size_t size)
+        {
+            return (size + PADDING - 1) / PADDING * PADDING;
+        }
+
+        template<uint32_t VEC_LEN>
+        static UME_FORCE_INLINE void tailMask(SIMDVecMask<VEC_LEN> & mask, std::size_t count)
+        {
+            alignas(SIMDVecMask<VEC_LEN>::alignment()) bool raw[VEC_LEN];
+            for (uint32_t i = 0; i < VEC_LEN; i++) raw[i] = (i < count);
+            mask.load(raw);
+        }
+
+        template<int... I>
+        void allocate(details::IndexSequence<I...>)
+        {
+            details::ExpandPack{ (std::get<I>(mFields) = allocateField<field_type<I>>(), 0)... };
+        }
+
+        template<typename T>
+        T* allocateField()
+        {
+            static_assert(std::is_arithmetic<T>::value, "SoAContainer fields have to be arithmetic types");
+            T* ptr = (T*)DynamicMemory::AlignedMalloc(mCapacity * sizeof(T), PADDING);
+            if (ptr == nullptr) throw std::bad_alloc();
+            std::memset(ptr, 0, mCapacity * sizeof(T));
+            return ptr;
+        }
+
+        template<int... I>
+        void deallocate(details::IndexSequence<I...>)
+        {
+            details::ExpandPack{ (DynamicMemory::AlignedFree(std::get<I>(mFields)), 0)... };
+        }
+
+        template<uint32_t VEC_LEN, typename KERNEL_T, int... I>
+        void forEachVector(KERNEL_T & kernel, details::IndexSequence<I...>)
+        {
+            static_assert(PADDING % VEC_LEN == 0, "VEC_LEN has to divide SoAContainer::PADDING");
+            std::tuple<SIMDVec<FIELDS, VEC_LEN>...> vecs;
+            const SIMDVecMask<VEC_LEN> fullMask(true);
+
+            std::size_t i = 0;
+            for (; i + VEC_LEN <= mSize; i += VEC_LEN) {
+                details::ExpandPack{ (std::get<I>(vecs).loada(std::get<I>(mFields) + i), 0)... };
+                kernel(fullMask, std::get<I>(vecs)...);
+                details::ExpandPack{ (std::get<I>(vecs).storea(std::get<I>(mFields) + i), 0)... };
+            }
+            // Remainder: masked load/store instead of a scalar loop
+            if (i < mSize) {
+                SIMDVecMask<VEC_LEN> mask;
+                tailMask<VEC_LEN>(mask, mSize - i);
+                details::ExpandPack{ (std::get<I>(vecs) = field_type<I>(0), 0)... };
+                details::ExpandPack{ (std::get<I>(vecs).loada(mask, std::get<I>(mFields) + i), 0)... };
+                kernel(mask, std::get<I>(vecs)...);
+                details::ExpandPack{ (std::get<I>(vecs).storea(mask, std::get<I>(mFields) + i), 0)... };
+            }
+        }
+
+        template<uint32_t VEC_LEN, typename STRUCT_T, int... I>
+        void fromAoSImpl(STRUCT_T const * aos, details::IndexSequence<I...>, FIELDS STRUCT_T::*... members)
+        {
+            details::ExpandPack{ (gatherField<VEC_LEN>(aos, std::get<I>(mFields), members), 0)... };
+        }
+
+        template<uint32_t VEC_LEN, typename STRUCT_T, int... I>
+        void toAoSImpl(STRUCT_T * aos, details::IndexSequence<I...>, FIELDS STRUCT_T::*... members) const
+        {
+            details::ExpandPack{ (scatterField<VEC_LEN>(aos, std::get<I>(mFields), members), 0)... };
+        }
+
+        template<uint32_t VEC_LEN, typename STRUCT_T, typename T>
+        void gatherField(STRUCT_T const * aos, T * dst, T STRUCT_T::* member)
+        {
+            static_assert(sizeof(STRUCT_T) % sizeof(T) == 0, "Structure size has to be a multiple of the field size");
+            const uint32_t stride = sizeof(STRUCT_T) / sizeof(T);
+            SIMDVec<T, VEC_LEN> vec(T(0));
+            std::size_t i = 0;
+            for (; i + VEC_LEN <= mSize; i += VEC_LEN) {
+                vec.gatheru(&(aos[i].*member), stride);
+                vec.storea(dst + i);
+            }
+            if (i < mSize) {
+                SIMDVecMask<VEC_LEN> mask;
+                tailMask<VEC_LEN>(mask, mSize - i);
+                vec.gatheru(mask, &(aos[i].*member), stride);
+                vec.storea(mask, dst + i);
+            }
+        }
+
+        template<uint32_t VEC_LEN, typename STRUCT_T, typename T>
+        void scatterField(STRUCT_T * aos, T const * src, T STRUCT_T::* member) const
+        {
+            static_assert(sizeof(STRUCT_T) % sizeof(T) == 0, "Structure size has to be a multiple of the field size");
+            const uint32_t stride = sizeof(STRUCT_T) / sizeof(T);
+            SIMDVec<T, VEC_LEN> vec;
+            std::size_t i = 0;
+            for (; i + VEC_LEN <= mSize; i += VEC_LEN) {
+                vec.loada(src + i);
+                vec.scatteru(&(aos[i].*member), stride);
+            }
+            if (i < mSize) {
+                SIMDVecMask<VEC_LEN> mask;
+                tailMask<VEC_LEN>(mask, mSize - i);
+                vec.loada(src + i);
+                vec.scatteru(mask, &(aos[i].*member), stride);
+            }
+        }
+    };
+}
+}
+
+#endif
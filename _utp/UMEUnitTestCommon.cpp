@@ -0,0 +1,356 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-3VEC_LEN596".
+//
+
+#include "UMEUnitTestCommon.h"
+
+int g_totalTests = 0;
+int g_totalFailed = 0;
+int g_testMaxId = 0;
+int g_failCount = 0;
+bool g_allSuccess = true;
+bool g_supressMessages = false;
+char *g_test_header_ptr = NULL;
+
+void check_condition(bool cond, std::string msg) {
+    g_totalTests++;
+    g_testMaxId++;
+    if (!(cond)) {
+        if (g_supressMessages == false) {
+            std::cout << "FAIL " << g_test_header_ptr << " Id: " << g_testMaxId << " - " << (msg.c_str()) << std::endl;
+        }
+        g_totalFailed++;
+        g_failCount++;
+        g_allSuccess = false;
+    }
+    else
+    {
+        if (g_supressMessages == false) {
+            std::cout << "OK   " << g_test_header_ptr << " Id: " << g_testMaxId << " - " << (msg.c_str()) << std::endl;
+        }
+    }
+}
+
+bool valueInRange(float value, float expectedValue, float errMargin) {
+
+    if(expectedValue == 0.0f)
+    {
+        return (errMargin >= value) & ((-errMargin) <= value);
+    }
+    else if(value > 0.0f)
+    {
+        return ((expectedValue)*(1.0f + errMargin) >= value) 
+             & ((expectedValue)*(1.0f - errMargin) <= value);
+    }
+    else
+    {
+        return ((expectedValue)*(1.0f + errMargin) <= value)
+             & ((expectedValue)*(1.0f - errMargin) >= value);
+    }
+}
+
+bool valueInRange(double value, double expectedValue, double errMargin) {
+    if (expectedValue == 0.0)
+    {
+        return (errMargin >= value) & ((-errMargin) <= value);
+    }
+    else if (value > 0.0f)
+    {
+        return ((expectedValue)*(1.0f + errMargin) >= value) 
+             & ((expectedValue)*(1.0f - errMargin) <= value);
+    }
+    else
+    {
+        return ((expectedValue)*(1.0f + errMargin) <= value)
+             & ((expectedValue)*(1.0f - errMargin) >= value);
+    }
+}
+
+#include "../utilities/ignore_warnings_push.h"
+#include "../utilities/ignore_warnings_unused_parameter.h"
+
+bool valueInRange(bool value, bool expectedValue, double errMargin) {
+    return value == expectedValue;
+}
+
+#include "../utilities/ignore_warnings_pop.h"
+
+bool valueInRange(uint32_t value, uint32_t expectedValue, float errMargin) {
+    return valueInRange((float)value, (float)expectedValue, errMargin);
+}
+
+bool valueInRange(int32_t value, int32_t expectedValue, float errMargin) {
+    return valueInRange((float)value, (float)expectedValue, errMargin);
+}
+
+bool valueInRange(uint64_t value, uint64_t expectedValue, float errMargin) {
+    return valueInRange((float)value, (float)expectedValue, errMargin);
+}
+
+bool valueInRange(int64_t value, int64_t expectedValue, float errMargin) {
+    return valueInRange((float)value, (float)expectedValue, errMargin);
+}
+
+bool valuesExact(uint8_t const *values, uint8_t const *expectedValues, unsigned int count)
+{
+    bool retval = true;
+    for (unsigned int i = 0; i < count; i++) {
+        if (values[i] != expectedValues[i])
+        {
+            retval = false;
+            break;
+        }
+    }
+    return retval;
+}
+
+bool valuesExact(int8_t const *values, int8_t const *expectedValues, unsigned int count)
+{
+    bool retval = true;
+    for (unsigned int i = 0; i < count; i++) {
+        if (values[i] != expectedValues[i])
+        {
+            retval = false;
+            break;
+        }
+    }
+    return retval;
+}
+
+bool valuesExact(uint16_t const *values, uint16_t const *expectedValues, unsigned int count)
+{
+    bool retval = true;
+    for (unsigned int i = 0; i < count; i++) {
+        if (values[i] != expectedValues[i])
+        {
+            retval = false;
+            break;
+        }
+    }
+    return retval;
+}
+
+bool valuesExact(int16_t const *values, int16_t const *expectedValues, unsigned int count)
+{
+    bool retval = true;
+    for (unsigned int i = 0; i < count; i++) {
+        if (values[i] != expectedValues[i])
+        {
+            retval = false;
+            break;
+        }
+    }
+    return retval;
+}
+
+bool valuesExact(int32_t const *values, int32_t const *expectedValues, unsigned int count) 
+{
+    bool retval = true;
+    for(unsigned int i = 0; i < count; i++) {
+        if(values[i] != expectedValues[i])
+        {
+            retval = false;
+            break;
+        }
+    }
+    return retval;
+}
+
+bool valuesExact(uint32_t const *values, uint32_t const *expectedValues, unsigned int count) 
+{
+    bool retval = true;
+    for(unsigned int i = 0; i < count; i++) {
+        if(values[i] != expectedValues[i])
+        {
+            retval = false;
+            break;
+        }
+    }
+    return retval;
+}
+
+bool valuesExact(int64_t const *values, int64_t const *expectedValues, unsigned int count)
+{
+    bool retval = true;
+    for (unsigned int i = 0; i < count; i++) {
+        if (values[i] != expectedValues[i])
+        {
+            retval = false;
+            break;
+        }
+    }
+    return retval;
+}
+
+bool valuesExact(uint64_t const *values, uint64_t const *expectedValues, unsigned int count)
+{
+    bool retval = true;
+    for (unsigned int i = 0; i < count; i++) {
+        if (values[i] != expectedValues[i])
+        {
+            retval = false;
+            break;
+        }
+    }
+    return retval;
+}
+
+bool valuesExact(bool const *values, bool const *expectedValues, unsigned int count)
+{
+    bool retval = true;
+    for(unsigned int i = 0; i < count; i++) {
+        if(values[i] != expectedValues[i])
+        {
+            retval = false;
+            break;
+        }
+    }
+    return retval;
+}
+
+bool valuesInRange(float const *values, float const *expectedValues, unsigned int count, float errMargin)
+{
+    bool retval = true;
+    for(unsigned int i = 0; i < count; i++) {
+        if(!valueInRange(values[i], expectedValues[i], errMargin))
+        {
+            retval = false;
+            break;
+        }
+    }
+    return retval;
+}
+
+bool valuesInRange(double const *values, double const *expectedValues, unsigned int count, double errMargin)
+{
+    bool retval = true;
+    for(unsigned int i = 0; i < count; i++) {
+        if(!valueInRange(values[i], expectedValues[i], errMargin))
+        {
+            retval = false;
+            break;
+        }
+    }
+    return retval;
+}
+
+#include "../utilities/ignore_warnings_push.h"
+#include "../utilities/ignore_warnings_unused_parameter.h"
+
+// This is a dirty hack to use the same testing function for both int and float types... 
+bool valuesInRange(bool const *values, bool const *expectedValues, unsigned int count, double errMargin)
+{
+    return valuesExact(values, expectedValues, count);
+}
+
+bool valuesInRange(uint8_t const *values, uint8_t const *expectedValues, unsigned int count, double errMargin)
+{
+    return valuesExact(values, expectedValues, count);
+}
+
+bool valuesInRange(int8_t const *values, int8_t const *expectedValues, unsigned int count, double errMargin)
+{
+    return valuesExact(values, expectedValues, count);
+}
+
+bool valuesInRange(uint16_t const *values, uint16_t const *expectedValues, unsigned int count, double errMargin)
+{
+    return valuesExact(values, expectedValues, count);
+}
+
+bool valuesInRange(int16_t const *values, int16_t const *expectedValues, unsigned int count, double errMargin)
+{
+    return valuesExact(values, expectedValues, count);
+}
+
+bool valuesInRange(uint32_t const *values, uint32_t const *expectedValues, unsigned int count, double errMargin)
+{
+    return valuesExact(values, expectedValues, count);
+}
+
+bool valuesInRange(uint64_t const *values, uint64_t const *expectedValues, unsigned int count, double errMargin)
+{
+    return valuesExact(values, expectedValues, count);
+}
+
+bool valuesInRange(int32_t const *values, int32_t const *expectedValues, unsigned int count, double errMargin)
+{
+    return valuesExact(values, expectedValues, count);
+}
+
+bool valuesInRange(int64_t const *values, int64_t const *expectedValues, unsigned int count, double errMargin)
+{
+    return valuesExact(values, expectedValues, count);
+}
+
+#include "../utilities/ignore_warnings_pop.h"
+
+template<>
+uint8_t randomValue<uint8_t>(std::mt19937 & generator) {
+    std::uniform_int_distribution<uint16_t> dist(0, 255);
+    return uint8_t(dist(generator));
+}
+
+template<>
+int8_t randomValue<int8_t>(std::mt19937 & generator) {
+    int16_t min = int16_t(std::numeric_limits<int8_t>::min());
+    int16_t max = int16_t(std::numeric_limits<int8_t>::max());
+
+    std::uniform_int_distribution<int16_t> dist(min, max);
+    int16_t t0 = dist(generator);
+    return int8_t(t0);
+}
+
+template<>
+float randomValue<float>(std::mt19937 & generator) {
+    std::uniform_real_distribution<float> dist(std::numeric_limits<float>::min(), std::numeric_limits<float>::max());
+    return dist(generator);
+}
+
+template<>
+double randomValue<double>(std::mt19937 & generator) {
+    std::uniform_real_distribution<double> dist(std::numeric_limits<double>::min(), std::numeric_limits<double>::max());
+    return dist(generator);
+}
+
+template<>
+bool randomValue<bool>(std::mt19937 & generator) {
+    std::uniform_int_distribution<int32_t> dist(std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max());
+    int32_t t0 = dist(generator);
+    return t0 > 0;
+}
+
+template<>
+uint32_t MAX_BIT_COUNT_helper<int8_t>() { return 6; }
+template<>
+uint32_t MAX_BIT_COUNT_helper<int16_t>() { return 14; }
+template<>
+uint32_t MAX_BIT_COUNT_helper<int32_t>() { return 30; }
+template<>
+uint32_t MAX_BIT_COUNT_helper<int64_t>() { return 62; }
@@ -0,0 +1,4417 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+// This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#include "UMEUnitTestDataSets8.h"
+
+#include <limits>
+
+
+const uint8_t DataSet_1_8u::inputs::inputA[128] = {
+    254u, 157, 129, 94,  99,  111, 22,  214,
+    60,  176, 234, 166, 113, 226, 61,  192,
+    30,  42,  119, 101, 207, 214, 168, 8,
+    19,  99,  253, 194, 171, 107, 253, 156,
+    90,  110, 54,  246, 52,  102, 198, 80,
+    42,  152, 254, 43,  212, 72,  57,  153,
+    14,  91,  98,  33,  245, 243, 246, 88,
+    184, 105, 219, 105, 3,   138, 77,  245,
+    61,  138, 188, 4,   3,   40,  83,  141,
+    19,  109, 205, 213, 178, 195, 181, 216,
+    227, 56,  153, 14,  96,  14,  244, 235,
+    115, 215, 133, 163, 164, 34,  79,  106,
+    82,  236, 48,  91,  45,  146, 188, 57,
+    48,  3,   222, 35,  194, 222, 82,  25,
+    63,  59,  230, 177, 131, 221, 144, 240,
+    132, 14,  51,  254, 195, 60,  163, 179
+};
+
+const uint8_t DataSet_1_8u::inputs::inputB[128] = {
+    224, 115, 11,  144, 161, 250, 208, 53,
+    6,   169, 98,  6,   13,  18,  37,  214,
+    150, 95,  24,  47,  92,  35,  122, 82,
+    161, 253, 54,  196, 102, 131, 162, 18,
+    56,  150, 217, 250, 33,  236, 219, 27,
+    95,  75,  238, 117, 158, 192, 196, 161,
+    203, 46,  180, 146, 238, 249, 175, 145,
+    83,  230, 83,  12,  243, 219, 206, 90,
+    177, 241, 231, 211, 50,  189, 140, 201,
+    108, 180, 207, 115, 154, 70,  9,   117,
+    190, 53,  91,  212, 91,  1,   204, 99,
+    122, 3,   130, 226, 183, 226, 197, 11,
+    118, 23,  54,  171, 12,  181, 164, 36,
+    28,  164, 184, 146, 134, 243, 241, 147,
+    144, 121, 64,  77,  44,  205, 116, 180,
+    170, 239, 172, 234, 51,  251, 144, 137
+};
+
+const uint8_t DataSet_1_8u::inputs::inputC[128] = {
+    248, 86,  192, 102, 17,  20,  21,  97,
+    226, 165, 25,  154, 242, 134, 89,  108,
+    100, 46,  24,  68,  24,  212, 215, 218,
+    110, 66,  228, 175, 196, 224, 9,   71,
+    4,   63,  85,  47,  210, 119, 59,  35,
+    236, 221, 81,  39,  243, 226, 63,  101,
+    247, 48,  24,  9,   173, 162, 172, 249,
+    1,   137, 175, 53,  60,  42,  57,  47,
+    216, 123, 228, 60,  101, 152, 59,  166,
+    70,  40,  221, 126, 209, 140, 108, 37,
+    124, 100, 157, 20,  79,  120, 150, 228,
+    123, 163, 45,  16,  110, 204, 110, 67,
+    62,  220, 187, 221, 16,  180, 69,  207,
+    238, 213, 238, 222, 60,  167, 195, 223,
+    34,  21,  64,  127, 232, 185, 2,   199,
+    251, 212, 173, 208, 5,   26,  200, 243
+};
+
+const uint8_t DataSet_1_8u::inputs::inputShiftA[128] = {
+    7, 5, 3, 3, 3, 3, 7, 7,
+    6, 2, 1, 2, 6, 1, 5, 5,
+    1, 2, 2, 2, 3, 7, 2, 3,
+    5, 4, 7, 3, 4, 3, 7, 1,
+    6, 1, 2, 2, 4, 5, 4, 7,
+    7, 3, 2, 5, 2, 3, 7, 5,
+    3, 7, 3, 5, 5, 4, 3, 1,
+    3, 6, 3, 7, 7, 4, 1, 4,
+    6, 3, 1, 4, 1, 6, 7, 4,
+    2, 3, 1, 3, 7, 7, 4, 6,
+    7, 1, 1, 5, 7, 1, 7, 5,
+    5, 6, 5, 3, 3, 6, 4, 6,
+    5, 5, 5, 3, 2, 1, 6, 2,
+    4, 1, 2, 7, 3, 5, 5, 7,
+    2, 2, 2, 6, 6, 6, 6, 1,
+    4, 5, 1, 4, 7, 2, 5, 7
+};
+
+const uint8_t DataSet_1_8u::inputs::scalarA = 14;
+const uint8_t DataSet_1_8u::inputs::inputShiftScalarA = 3;
+
+const bool DataSet_1_8u::inputs::maskA[128] = {
+    false,                              // 1
+    true,                               // 2
+    true,   false,                      // 4
+    true,   false,  false,  true,       // 8
+    true,   false,  false,  true,
+    false,  true,   true,   false,      // 16
+    false,  true,   true,   false,
+    true,   false,  false,  true,
+    true,   false,  false,  true,
+    false,  true,   true,   false,      // 32
+    false,  true,   true,   false,
+    true,   false,  false,  true,
+    true,   false,  false,  true,
+    false,  true,   true,   false,
+    false,  true,   true,   false,
+    true,   false,  false,  true,
+    true,   false,  false,  true,
+    false,  true,   true,   false,      // 64
+    false,  true,   true,   false,
+    true,   false,  false,  true,
+    true,   false,  false,  true,
+    false,  true,   true,   false,
+    false,  true,   true,   false,
+    true,   false,  false,  true,
+    true,   false,  false,  true,
+    false,  true,   true,   false,
+    false,  true,   true,   false,
+    true,   false,  false,  true,
+    true,   false,  false,  true,
+    false,  true,   true,   false,
+    false,  true,   true,   false,
+    true,   false,  false,  true,
+    true,   false,  false,  true,
+    false,  true,   true,   false       // 128
+};
+
+const uint8_t DataSet_1_8u::outputs::ADDV[128] = {
+    0xde,   0x10,   0x8c,   0xee,   0x04,   0x69,   0xe6,   0x0b,
+    0x42,   0x59,   0x4c,   0xac,   0x7e,   0xf4,   0x62,   0x96,
+    0xb4,   0x89,   0x8f,   0x94,   0x2b,   0xf9,   0x22,   0x5a,
+    0xb4,   0x60,   0x33,   0x86,   0x11,   0xee,   0x9f,   0xae,
+    0x92,   0x04,   0x0f,   0xf0,   0x55,   0x52,   0xa1,   0x6b,
+    0x89,   0xe3,   0xec,   0xa0,   0x72,   0x08,   0xfd,   0x3a,
+    0xd9,   0x89,   0x16,   0xb3,   0xe3,   0xec,   0xa5,   0xe9,
+    0x0b,   0x4f,   0x2e,   0x75,   0xf6,   0x65,   0x1b,   0x4f,
+    0xee,   0x7b,   0xa3,   0xd7,   0x35,   0xe5,   0xdf,   0x56,
+    0x7f,   0x21,   0x9c,   0x48,   0x4c,   0x09,   0xbe,   0x4d,
+    0xa1,   0x6d,   0xf4,   0xe2,   0xbb,   0x0f,   0xc0,   0x4e,
+    0xed,   0xda,   0x07,   0x85,   0x5b,   0x04,   0x14,   0x75,
+    0xc8,   0x03,   0x66,   0x06,   0x39,   0x47,   0x60,   0x5d,
+    0x4c,   0xa7,   0x96,   0xb5,   0x48,   0xd1,   0x43,   0xac,
+    0xcf,   0xb4,   0x26,   0xfe,   0xaf,   0xaa,   0x04,   0xa4,
+    0x2e,   0xfd,   0xdf,   0xe8,   0xf6,   0x37,   0x33,   0x3c
+};
+
+const uint8_t DataSet_1_8u::outputs::MADDV[128] = {
+    0xfe,   0x10,   0x8c,   0x5e,   0x04,   0x6f,   0x16,   0x0b,
+    0x42,   0xb0,   0xea,   0xac,   0x71,   0xf4,   0x62,   0xc0,
+    0x1e,   0x89,   0x8f,   0x65,   0x2b,   0xd6,   0xa8,   0x5a,
+    0xb4,   0x63,   0xfd,   0x86,   0xab,   0xee,   0x9f,   0x9c,
+    0x5a,   0x04,   0x0f,   0xf6,   0x55,   0x66,   0xc6,   0x6b,
+    0x89,   0x98,   0xfe,   0xa0,   0xd4,   0x08,   0xfd,   0x99,
+    0x0e,   0x89,   0x16,   0x21,   0xe3,   0xf3,   0xf6,   0xe9,
+    0x0b,   0x69,   0xdb,   0x75,   0x03,   0x65,   0x1b,   0xf5,
+    0x3d,   0x7b,   0xa3,   0x04,   0x35,   0x28,   0x53,   0x56,
+    0x7f,   0x6d,   0xcd,   0x48,   0xb2,   0x09,   0xbe,   0xd8,
+    0xe3,   0x6d,   0xf4,   0x0e,   0xbb,   0x0e,   0xf4,   0x4e,
+    0xed,   0xd7,   0x85,   0x85,   0xa4,   0x04,   0x14,   0x6a,
+    0x52,   0x03,   0x66,   0x5b,   0x39,   0x92,   0xbc,   0x5d,
+    0x4c,   0x03,   0xde,   0xb5,   0xc2,   0xd1,   0x43,   0x19,
+    0x3f,   0xb4,   0x26,   0xb1,   0xaf,   0xdd,   0x90,   0xa4,
+    0x2e,   0x0e,   0x33,   0xe8,   0xc3,   0x37,   0x33,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::ADDS[128] = {
+    0x0c,   0xab,   0x8f,   0x6c,   0x71,   0x7d,   0x24,   0xe4,
+    0x4a,   0xbe,   0xf8,   0xb4,   0x7f,   0xf0,   0x4b,   0xce,
+    0x2c,   0x38,   0x85,   0x73,   0xdd,   0xe4,   0xb6,   0x16,
+    0x21,   0x71,   0x0b,   0xd0,   0xb9,   0x79,   0x0b,   0xaa,
+    0x68,   0x7c,   0x44,   0x04,   0x42,   0x74,   0xd4,   0x5e,
+    0x38,   0xa6,   0x0c,   0x39,   0xe2,   0x56,   0x47,   0xa7,
+    0x1c,   0x69,   0x70,   0x2f,   0x03,   0x01,   0x04,   0x66,
+    0xc6,   0x77,   0xe9,   0x77,   0x11,   0x98,   0x5b,   0x03,
+    0x4b,   0x98,   0xca,   0x12,   0x11,   0x36,   0x61,   0x9b,
+    0x21,   0x7b,   0xdb,   0xe3,   0xc0,   0xd1,   0xc3,   0xe6,
+    0xf1,   0x46,   0xa7,   0x1c,   0x6e,   0x1c,   0x02,   0xf9,
+    0x81,   0xe5,   0x93,   0xb1,   0xb2,   0x30,   0x5d,   0x78,
+    0x60,   0xfa,   0x3e,   0x69,   0x3b,   0xa0,   0xca,   0x47,
+    0x3e,   0x11,   0xec,   0x31,   0xd0,   0xec,   0x60,   0x27,
+    0x4d,   0x49,   0xf4,   0xbf,   0x91,   0xeb,   0x9e,   0xfe,
+    0x92,   0x1c,   0x41,   0x0c,   0xd1,   0x4a,   0xb1,   0xc1
+};
+
+const uint8_t DataSet_1_8u::outputs::MADDS[128] = {
+    0xfe,   0xab,   0x8f,   0x5e,   0x71,   0x6f,   0x16,   0xe4,
+    0x4a,   0xb0,   0xea,   0xb4,   0x71,   0xf0,   0x4b,   0xc0,
+    0x1e,   0x38,   0x85,   0x65,   0xdd,   0xd6,   0xa8,   0x16,
+    0x21,   0x63,   0xfd,   0xd0,   0xab,   0x79,   0x0b,   0x9c,
+    0x5a,   0x7c,   0x44,   0xf6,   0x42,   0x66,   0xc6,   0x5e,
+    0x38,   0x98,   0xfe,   0x39,   0xd4,   0x56,   0x47,   0x99,
+    0x0e,   0x69,   0x70,   0x21,   0x03,   0xf3,   0xf6,   0x66,
+    0xc6,   0x69,   0xdb,   0x77,   0x03,   0x98,   0x5b,   0xf5,
+    0x3d,   0x98,   0xca,   0x04,   0x11,   0x28,   0x53,   0x9b,
+    0x21,   0x6d,   0xcd,   0xe3,   0xb2,   0xd1,   0xc3,   0xd8,
+    0xe3,   0x46,   0xa7,   0x0e,   0x6e,   0x0e,   0xf4,   0xf9,
+    0x81,   0xd7,   0x85,   0xb1,   0xa4,   0x30,   0x5d,   0x6a,
+    0x52,   0xfa,   0x3e,   0x5b,   0x3b,   0x92,   0xbc,   0x47,
+    0x3e,   0x03,   0xde,   0x31,   0xc2,   0xec,   0x60,   0x19,
+    0x3f,   0x49,   0xf4,   0xb1,   0x91,   0xdd,   0x90,   0xfe,
+    0x92,   0x0e,   0x33,   0x0c,   0xc3,   0x4a,   0xb1,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::POSTPREFINC[128] = {
+    0xff,   0x9e,   0x82,   0x5f,   0x64,   0x70,   0x17,   0xd7,
+    0x3d,   0xb1,   0xeb,   0xa7,   0x72,   0xe3,   0x3e,   0xc1,
+    0x1f,   0x2b,   0x78,   0x66,   0xd0,   0xd7,   0xa9,   0x09,
+    0x14,   0x64,   0xfe,   0xc3,   0xac,   0x6c,   0xfe,   0x9d,
+    0x5b,   0x6f,   0x37,   0xf7,   0x35,   0x67,   0xc7,   0x51,
+    0x2b,   0x99,   0xff,   0x2c,   0xd5,   0x49,   0x3a,   0x9a,
+    0x0f,   0x5c,   0x63,   0x22,   0xf6,   0xf4,   0xf7,   0x59,
+    0xb9,   0x6a,   0xdc,   0x6a,   0x04,   0x8b,   0x4e,   0xf6,
+    0x3e,   0x8b,   0xbd,   0x05,   0x04,   0x29,   0x54,   0x8e,
+    0x14,   0x6e,   0xce,   0xd6,   0xb3,   0xc4,   0xb6,   0xd9,
+    0xe4,   0x39,   0x9a,   0x0f,   0x61,   0x0f,   0xf5,   0xec,
+    0x74,   0xd8,   0x86,   0xa4,   0xa5,   0x23,   0x50,   0x6b,
+    0x53,   0xed,   0x31,   0x5c,   0x2e,   0x93,   0xbd,   0x3a,
+    0x31,   0x04,   0xdf,   0x24,   0xc3,   0xdf,   0x53,   0x1a,
+    0x40,   0x3c,   0xe7,   0xb2,   0x84,   0xde,   0x91,   0xf1,
+    0x85,   0x0f,   0x34,   0xff,   0xc4,   0x3d,   0xa4,   0xb4
+};
+
+const uint8_t DataSet_1_8u::outputs::MPOSTPREFINC[128] = {
+    0xfe,   0x9e,   0x82,   0x5e,   0x64,   0x6f,   0x16,   0xd7,
+    0x3d,   0xb0,   0xea,   0xa7,   0x71,   0xe3,   0x3e,   0xc0,
+    0x1e,   0x2b,   0x78,   0x65,   0xd0,   0xd6,   0xa8,   0x09,
+    0x14,   0x63,   0xfd,   0xc3,   0xab,   0x6c,   0xfe,   0x9c,
+    0x5a,   0x6f,   0x37,   0xf6,   0x35,   0x66,   0xc6,   0x51,
+    0x2b,   0x98,   0xfe,   0x2c,   0xd4,   0x49,   0x3a,   0x99,
+    0x0e,   0x5c,   0x63,   0x21,   0xf6,   0xf3,   0xf6,   0x59,
+    0xb9,   0x69,   0xdb,   0x6a,   0x03,   0x8b,   0x4e,   0xf5,
+    0x3d,   0x8b,   0xbd,   0x04,   0x04,   0x28,   0x53,   0x8e,
+    0x14,   0x6d,   0xcd,   0xd6,   0xb2,   0xc4,   0xb6,   0xd8,
+    0xe3,   0x39,   0x9a,   0x0e,   0x61,   0x0e,   0xf4,   0xec,
+    0x74,   0xd7,   0x85,   0xa4,   0xa4,   0x23,   0x50,   0x6a,
+    0x52,   0xed,   0x31,   0x5b,   0x2e,   0x92,   0xbc,   0x3a,
+    0x31,   0x03,   0xde,   0x24,   0xc2,   0xdf,   0x53,   0x19,
+    0x3f,   0x3c,   0xe7,   0xb1,   0x84,   0xdd,   0x90,   0xf1,
+    0x85,   0x0e,   0x33,   0xff,   0xc3,   0x3d,   0xa4,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::SUBV[128] = {
+    0x1e,   0x2a,   0x76,   0xce,   0xc2,   0x75,   0x46,   0xa1,
+    0x36,   0x07,   0x88,   0xa0,   0x64,   0xd0,   0x18,   0xea,
+    0x88,   0xcb,   0x5f,   0x36,   0x73,   0xb3,   0x2e,   0xb6,
+    0x72,   0x66,   0xc7,   0xfe,   0x45,   0xe8,   0x5b,   0x8a,
+    0x22,   0xd8,   0x5d,   0xfc,   0x13,   0x7a,   0xeb,   0x35,
+    0xcb,   0x4d,   0x10,   0xb6,   0x36,   0x88,   0x75,   0xf8,
+    0x43,   0x2d,   0xae,   0x8f,   0x07,   0xfa,   0x47,   0xc7,
+    0x65,   0x83,   0x88,   0x5d,   0x10,   0xaf,   0x7f,   0x9b,
+    0x8c,   0x99,   0xd5,   0x31,   0xd1,   0x6b,   0xc7,   0xc4,
+    0xa7,   0xb9,   0xfe,   0x62,   0x18,   0x7d,   0xac,   0x63,
+    0x25,   0x03,   0x3e,   0x3a,   0x05,   0x0d,   0x28,   0x88,
+    0xf9,   0xd4,   0x03,   0xc1,   0xed,   0x40,   0x8a,   0x5f,
+    0xdc,   0xd5,   0xfa,   0xb0,   0x21,   0xdd,   0x18,   0x15,
+    0x14,   0x5f,   0x26,   0x91,   0x3c,   0xeb,   0x61,   0x86,
+    0xaf,   0xc2,   0xa6,   0x64,   0x57,   0x10,   0x1c,   0x3c,
+    0xda,   0x1f,   0x87,   0x14,   0x90,   0x41,   0x13,   0x2a
+};
+
+const uint8_t DataSet_1_8u::outputs::MSUBV[128] = {
+    0xfe,   0x2a,   0x76,   0x5e,   0xc2,   0x6f,   0x16,   0xa1,
+    0x36,   0xb0,   0xea,   0xa0,   0x71,   0xd0,   0x18,   0xc0,
+    0x1e,   0xcb,   0x5f,   0x65,   0x73,   0xd6,   0xa8,   0xb6,
+    0x72,   0x63,   0xfd,   0xfe,   0xab,   0xe8,   0x5b,   0x9c,
+    0x5a,   0xd8,   0x5d,   0xf6,   0x13,   0x66,   0xc6,   0x35,
+    0xcb,   0x98,   0xfe,   0xb6,   0xd4,   0x88,   0x75,   0x99,
+    0x0e,   0x2d,   0xae,   0x21,   0x07,   0xf3,   0xf6,   0xc7,
+    0x65,   0x69,   0xdb,   0x5d,   0x03,   0xaf,   0x7f,   0xf5,
+    0x3d,   0x99,   0xd5,   0x04,   0xd1,   0x28,   0x53,   0xc4,
+    0xa7,   0x6d,   0xcd,   0x62,   0xb2,   0x7d,   0xac,   0xd8,
+    0xe3,   0x03,   0x3e,   0x0e,   0x05,   0x0e,   0xf4,   0x88,
+    0xf9,   0xd7,   0x85,   0xc1,   0xa4,   0x40,   0x8a,   0x6a,
+    0x52,   0xd5,   0xfa,   0x5b,   0x21,   0x92,   0xbc,   0x15,
+    0x14,   0x03,   0xde,   0x91,   0xc2,   0xeb,   0x61,   0x19,
+    0x3f,   0xc2,   0xa6,   0xb1,   0x57,   0xdd,   0x90,   0x3c,
+    0xda,   0x0e,   0x33,   0x14,   0xc3,   0x41,   0x13,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::SUBS[128] = {
+    0xf0,   0x8f,   0x73,   0x50,   0x55,   0x61,   0x08,   0xc8,
+    0x2e,   0xa2,   0xdc,   0x98,   0x63,   0xd4,   0x2f,   0xb2,
+    0x10,   0x1c,   0x69,   0x57,   0xc1,   0xc8,   0x9a,   0xfa,
+    0x05,   0x55,   0xef,   0xb4,   0x9d,   0x5d,   0xef,   0x8e,
+    0x4c,   0x60,   0x28,   0xe8,   0x26,   0x58,   0xb8,   0x42,
+    0x1c,   0x8a,   0xf0,   0x1d,   0xc6,   0x3a,   0x2b,   0x8b,
+    0x00,   0x4d,   0x54,   0x13,   0xe7,   0xe5,   0xe8,   0x4a,
+    0xaa,   0x5b,   0xcd,   0x5b,   0xf5,   0x7c,   0x3f,   0xe7,
+    0x2f,   0x7c,   0xae,   0xf6,   0xf5,   0x1a,   0x45,   0x7f,
+    0x05,   0x5f,   0xbf,   0xc7,   0xa4,   0xb5,   0xa7,   0xca,
+    0xd5,   0x2a,   0x8b,   0x00,   0x52,   0x00,   0xe6,   0xdd,
+    0x65,   0xc9,   0x77,   0x95,   0x96,   0x14,   0x41,   0x5c,
+    0x44,   0xde,   0x22,   0x4d,   0x1f,   0x84,   0xae,   0x2b,
+    0x22,   0xf5,   0xd0,   0x15,   0xb4,   0xd0,   0x44,   0x0b,
+    0x31,   0x2d,   0xd8,   0xa3,   0x75,   0xcf,   0x82,   0xe2,
+    0x76,   0x00,   0x25,   0xf0,   0xb5,   0x2e,   0x95,   0xa5
+};
+
+const uint8_t DataSet_1_8u::outputs::MSUBS[128] = {
+    0xfe,   0x8f,   0x73,   0x5e,   0x55,   0x6f,   0x16,   0xc8,
+    0x2e,   0xb0,   0xea,   0x98,   0x71,   0xd4,   0x2f,   0xc0,
+    0x1e,   0x1c,   0x69,   0x65,   0xc1,   0xd6,   0xa8,   0xfa,
+    0x05,   0x63,   0xfd,   0xb4,   0xab,   0x5d,   0xef,   0x9c,
+    0x5a,   0x60,   0x28,   0xf6,   0x26,   0x66,   0xc6,   0x42,
+    0x1c,   0x98,   0xfe,   0x1d,   0xd4,   0x3a,   0x2b,   0x99,
+    0x0e,   0x4d,   0x54,   0x21,   0xe7,   0xf3,   0xf6,   0x4a,
+    0xaa,   0x69,   0xdb,   0x5b,   0x03,   0x7c,   0x3f,   0xf5,
+    0x3d,   0x7c,   0xae,   0x04,   0xf5,   0x28,   0x53,   0x7f,
+    0x05,   0x6d,   0xcd,   0xc7,   0xb2,   0xb5,   0xa7,   0xd8,
+    0xe3,   0x2a,   0x8b,   0x0e,   0x52,   0x0e,   0xf4,   0xdd,
+    0x65,   0xd7,   0x85,   0x95,   0xa4,   0x14,   0x41,   0x6a,
+    0x52,   0xde,   0x22,   0x5b,   0x1f,   0x92,   0xbc,   0x2b,
+    0x22,   0x03,   0xde,   0x15,   0xc2,   0xd0,   0x44,   0x19,
+    0x3f,   0x2d,   0xd8,   0xb1,   0x75,   0xdd,   0x90,   0xe2,
+    0x76,   0x0e,   0x33,   0xf0,   0xc3,   0x2e,   0x95,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::SUBFROMV[128] = {
+    0xe2,   0xd6,   0x8a,   0x32,   0x3e,   0x8b,   0xba,   0x5f,
+    0xca,   0xf9,   0x78,   0x60,   0x9c,   0x30,   0xe8,   0x16,
+    0x78,   0x35,   0xa1,   0xca,   0x8d,   0x4d,   0xd2,   0x4a,
+    0x8e,   0x9a,   0x39,   0x02,   0xbb,   0x18,   0xa5,   0x76,
+    0xde,   0x28,   0xa3,   0x04,   0xed,   0x86,   0x15,   0xcb,
+    0x35,   0xb3,   0xf0,   0x4a,   0xca,   0x78,   0x8b,   0x08,
+    0xbd,   0xd3,   0x52,   0x71,   0xf9,   0x06,   0xb9,   0x39,
+    0x9b,   0x7d,   0x78,   0xa3,   0xf0,   0x51,   0x81,   0x65,
+    0x74,   0x67,   0x2b,   0xcf,   0x2f,   0x95,   0x39,   0x3c,
+    0x59,   0x47,   0x02,   0x9e,   0xe8,   0x83,   0x54,   0x9d,
+    0xdb,   0xfd,   0xc2,   0xc6,   0xfb,   0xf3,   0xd8,   0x78,
+    0x07,   0x2c,   0xfd,   0x3f,   0x13,   0xc0,   0x76,   0xa1,
+    0x24,   0x2b,   0x06,   0x50,   0xdf,   0x23,   0xe8,   0xeb,
+    0xec,   0xa1,   0xda,   0x6f,   0xc4,   0x15,   0x9f,   0x7a,
+    0x51,   0x3e,   0x5a,   0x9c,   0xa9,   0xf0,   0xe4,   0xc4,
+    0x26,   0xe1,   0x79,   0xec,   0x70,   0xbf,   0xed,   0xd6
+};
+
+const uint8_t DataSet_1_8u::outputs::MSUBFROMV[128] = {
+    0xe0,   0xd6,   0x8a,   0x90,   0x3e,   0xfa,   0xd0,   0x5f,
+    0xca,   0xa9,   0x62,   0x60,   0x0d,   0x30,   0xe8,   0xd6,
+    0x96,   0x35,   0xa1,   0x2f,   0x8d,   0x23,   0x7a,   0x4a,
+    0x8e,   0xfd,   0x36,   0x02,   0x66,   0x18,   0xa5,   0x12,
+    0x38,   0x28,   0xa3,   0xfa,   0xed,   0xec,   0xdb,   0xcb,
+    0x35,   0x4b,   0xee,   0x4a,   0x9e,   0x78,   0x8b,   0xa1,
+    0xcb,   0xd3,   0x52,   0x92,   0xf9,   0xf9,   0xaf,   0x39,
+    0x9b,   0xe6,   0x53,   0xa3,   0xf3,   0x51,   0x81,   0x5a,
+    0xb1,   0x67,   0x2b,   0xd3,   0x2f,   0xbd,   0x8c,   0x3c,
+    0x59,   0xb4,   0xcf,   0x9e,   0x9a,   0x83,   0x54,   0x75,
+    0xbe,   0xfd,   0xc2,   0xd4,   0xfb,   0x01,   0xcc,   0x78,
+    0x07,   0x03,   0x82,   0x3f,   0xb7,   0xc0,   0x76,   0x0b,
+    0x76,   0x2b,   0x06,   0xab,   0xdf,   0xb5,   0xa4,   0xeb,
+    0xec,   0xa4,   0xb8,   0x6f,   0x86,   0x15,   0x9f,   0x93,
+    0x90,   0x3e,   0x5a,   0x4d,   0xa9,   0xcd,   0x74,   0xc4,
+    0x26,   0xef,   0xac,   0xec,   0x33,   0xbf,   0xed,   0x89
+};
+
+const uint8_t DataSet_1_8u::outputs::SUBFROMS[128] = {
+    0x10,   0x71,   0x8d,   0xb0,   0xab,   0x9f,   0xf8,   0x38,
+    0xd2,   0x5e,   0x24,   0x68,   0x9d,   0x2c,   0xd1,   0x4e,
+    0xf0,   0xe4,   0x97,   0xa9,   0x3f,   0x38,   0x66,   0x06,
+    0xfb,   0xab,   0x11,   0x4c,   0x63,   0xa3,   0x11,   0x72,
+    0xb4,   0xa0,   0xd8,   0x18,   0xda,   0xa8,   0x48,   0xbe,
+    0xe4,   0x76,   0x10,   0xe3,   0x3a,   0xc6,   0xd5,   0x75,
+    0x00,   0xb3,   0xac,   0xed,   0x19,   0x1b,   0x18,   0xb6,
+    0x56,   0xa5,   0x33,   0xa5,   0x0b,   0x84,   0xc1,   0x19,
+    0xd1,   0x84,   0x52,   0x0a,   0x0b,   0xe6,   0xbb,   0x81,
+    0xfb,   0xa1,   0x41,   0x39,   0x5c,   0x4b,   0x59,   0x36,
+    0x2b,   0xd6,   0x75,   0x00,   0xae,   0x00,   0x1a,   0x23,
+    0x9b,   0x37,   0x89,   0x6b,   0x6a,   0xec,   0xbf,   0xa4,
+    0xbc,   0x22,   0xde,   0xb3,   0xe1,   0x7c,   0x52,   0xd5,
+    0xde,   0x0b,   0x30,   0xeb,   0x4c,   0x30,   0xbc,   0xf5,
+    0xcf,   0xd3,   0x28,   0x5d,   0x8b,   0x31,   0x7e,   0x1e,
+    0x8a,   0x00,   0xdb,   0x10,   0x4b,   0xd2,   0x6b,   0x5b
+};
+
+const uint8_t DataSet_1_8u::outputs::MSUBFROMS[128] = {
+    0x0e,   0x71,   0x8d,   0x0e,   0xab,   0x0e,   0x0e,   0x38,
+    0xd2,   0x0e,   0x0e,   0x68,   0x0e,   0x2c,   0xd1,   0x0e,
+    0x0e,   0xe4,   0x97,   0x0e,   0x3f,   0x0e,   0x0e,   0x06,
+    0xfb,   0x0e,   0x0e,   0x4c,   0x0e,   0xa3,   0x11,   0x0e,
+    0x0e,   0xa0,   0xd8,   0x0e,   0xda,   0x0e,   0x0e,   0xbe,
+    0xe4,   0x0e,   0x0e,   0xe3,   0x0e,   0xc6,   0xd5,   0x0e,
+    0x0e,   0xb3,   0xac,   0x0e,   0x19,   0x0e,   0x0e,   0xb6,
+    0x56,   0x0e,   0x0e,   0xa5,   0x0e,   0x84,   0xc1,   0x0e,
+    0x0e,   0x84,   0x52,   0x0e,   0x0b,   0x0e,   0x0e,   0x81,
+    0xfb,   0x0e,   0x0e,   0x39,   0x0e,   0x4b,   0x59,   0x0e,
+    0x0e,   0xd6,   0x75,   0x0e,   0xae,   0x0e,   0x0e,   0x23,
+    0x9b,   0x0e,   0x0e,   0x6b,   0x0e,   0xec,   0xbf,   0x0e,
+    0x0e,   0x22,   0xde,   0x0e,   0xe1,   0x0e,   0x0e,   0xd5,
+    0xde,   0x0e,   0x0e,   0xeb,   0x0e,   0x30,   0xbc,   0x0e,
+    0x0e,   0xd3,   0x28,   0x0e,   0x8b,   0x0e,   0x0e,   0x1e,
+    0x8a,   0x0e,   0x0e,   0x10,   0x0e,   0xd2,   0x6b,   0x0e
+};
+
+const uint8_t DataSet_1_8u::outputs::POSTPREFDEC[128] = {
+    0xfd,   0x9c,   0x80,   0x5d,   0x62,   0x6e,   0x15,   0xd5,
+    0x3b,   0xaf,   0xe9,   0xa5,   0x70,   0xe1,   0x3c,   0xbf,
+    0x1d,   0x29,   0x76,   0x64,   0xce,   0xd5,   0xa7,   0x07,
+    0x12,   0x62,   0xfc,   0xc1,   0xaa,   0x6a,   0xfc,   0x9b,
+    0x59,   0x6d,   0x35,   0xf5,   0x33,   0x65,   0xc5,   0x4f,
+    0x29,   0x97,   0xfd,   0x2a,   0xd3,   0x47,   0x38,   0x98,
+    0x0d,   0x5a,   0x61,   0x20,   0xf4,   0xf2,   0xf5,   0x57,
+    0xb7,   0x68,   0xda,   0x68,   0x02,   0x89,   0x4c,   0xf4,
+    0x3c,   0x89,   0xbb,   0x03,   0x02,   0x27,   0x52,   0x8c,
+    0x12,   0x6c,   0xcc,   0xd4,   0xb1,   0xc2,   0xb4,   0xd7,
+    0xe2,   0x37,   0x98,   0x0d,   0x5f,   0x0d,   0xf3,   0xea,
+    0x72,   0xd6,   0x84,   0xa2,   0xa3,   0x21,   0x4e,   0x69,
+    0x51,   0xeb,   0x2f,   0x5a,   0x2c,   0x91,   0xbb,   0x38,
+    0x2f,   0x02,   0xdd,   0x22,   0xc1,   0xdd,   0x51,   0x18,
+    0x3e,   0x3a,   0xe5,   0xb0,   0x82,   0xdc,   0x8f,   0xef,
+    0x83,   0x0d,   0x32,   0xfd,   0xc2,   0x3b,   0xa2,   0xb2
+};
+
+const uint8_t DataSet_1_8u::outputs::MPOSTPREFDEC[128] = {
+    0xfe,   0x9c,   0x80,   0x5e,   0x62,   0x6f,   0x16,   0xd5,
+    0x3b,   0xb0,   0xea,   0xa5,   0x71,   0xe1,   0x3c,   0xc0,
+    0x1e,   0x29,   0x76,   0x65,   0xce,   0xd6,   0xa8,   0x07,
+    0x12,   0x63,   0xfd,   0xc1,   0xab,   0x6a,   0xfc,   0x9c,
+    0x5a,   0x6d,   0x35,   0xf6,   0x33,   0x66,   0xc6,   0x4f,
+    0x29,   0x98,   0xfe,   0x2a,   0xd4,   0x47,   0x38,   0x99,
+    0x0e,   0x5a,   0x61,   0x21,   0xf4,   0xf3,   0xf6,   0x57,
+    0xb7,   0x69,   0xdb,   0x68,   0x03,   0x89,   0x4c,   0xf5,
+    0x3d,   0x89,   0xbb,   0x04,   0x02,   0x28,   0x53,   0x8c,
+    0x12,   0x6d,   0xcd,   0xd4,   0xb2,   0xc2,   0xb4,   0xd8,
+    0xe3,   0x37,   0x98,   0x0e,   0x5f,   0x0e,   0xf4,   0xea,
+    0x72,   0xd7,   0x85,   0xa2,   0xa4,   0x21,   0x4e,   0x6a,
+    0x52,   0xeb,   0x2f,   0x5b,   0x2c,   0x92,   0xbc,   0x38,
+    0x2f,   0x03,   0xde,   0x22,   0xc2,   0xdd,   0x51,   0x19,
+    0x3f,   0x3a,   0xe5,   0xb1,   0x82,   0xdd,   0x90,   0xef,
+    0x83,   0x0e,   0x33,   0xfd,   0xc3,   0x3b,   0xa2,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::MULV[128] = {
+    0x40,   0x87,   0x8b,   0xe0,   0x43,   0x66,   0xe0,   0x4e,
+    0x68,   0x30,   0x94,   0xe4,   0xbd,   0xe4,   0xd1,   0x80,
+    0x94,   0x96,   0x28,   0x8b,   0x64,   0x42,   0x10,   0x90,
+    0xf3,   0xd7,   0x5e,   0x88,   0x22,   0xc1,   0x1a,   0xf8,
+    0xb0,   0x74,   0xc6,   0x3c,   0xb4,   0x08,   0x62,   0x70,
+    0x96,   0x88,   0x24,   0xa7,   0xd8,   0x00,   0xa4,   0x39,
+    0x1a,   0x5a,   0xe8,   0xd2,   0xc6,   0x5b,   0x2a,   0xd8,
+    0xa8,   0x56,   0x01,   0xec,   0xd9,   0x0e,   0xf6,   0x22,
+    0x2d,   0xea,   0xa4,   0x4c,   0x96,   0x88,   0x64,   0xb5,
+    0x04,   0xa4,   0xc3,   0xaf,   0x14,   0x52,   0x5d,   0xb8,
+    0x7a,   0x98,   0x63,   0x98,   0x20,   0x0e,   0x70,   0xe1,
+    0xce,   0x85,   0x8a,   0xe6,   0x3c,   0x04,   0xcb,   0x8e,
+    0xcc,   0x34,   0x20,   0xc9,   0x1c,   0x3a,   0x70,   0x04,
+    0x40,   0xec,   0x90,   0xf6,   0x8c,   0xba,   0x32,   0x5b,
+    0x70,   0xe3,   0x80,   0x3d,   0x84,   0xf9,   0x40,   0xc0,
+    0xa8,   0x12,   0x44,   0x2c,   0xd9,   0xd4,   0xb0,   0xcb
+};
+
+const uint8_t DataSet_1_8u::outputs::MMULV[128] = {
+    0xfe,   0x87,   0x8b,   0x5e,   0x43,   0x6f,   0x16,   0x4e,
+    0x68,   0xb0,   0xea,   0xe4,   0x71,   0xe4,   0xd1,   0xc0,
+    0x1e,   0x96,   0x28,   0x65,   0x64,   0xd6,   0xa8,   0x90,
+    0xf3,   0x63,   0xfd,   0x88,   0xab,   0xc1,   0x1a,   0x9c,
+    0x5a,   0x74,   0xc6,   0xf6,   0xb4,   0x66,   0xc6,   0x70,
+    0x96,   0x98,   0xfe,   0xa7,   0xd4,   0x00,   0xa4,   0x99,
+    0x0e,   0x5a,   0xe8,   0x21,   0xc6,   0xf3,   0xf6,   0xd8,
+    0xa8,   0x69,   0xdb,   0xec,   0x03,   0x0e,   0xf6,   0xf5,
+    0x3d,   0xea,   0xa4,   0x04,   0x96,   0x28,   0x53,   0xb5,
+    0x04,   0x6d,   0xcd,   0xaf,   0xb2,   0x52,   0x5d,   0xd8,
+    0xe3,   0x98,   0x63,   0x0e,   0x20,   0x0e,   0xf4,   0xe1,
+    0xce,   0xd7,   0x85,   0xe6,   0xa4,   0x04,   0xcb,   0x6a,
+    0x52,   0x34,   0x20,   0x5b,   0x1c,   0x92,   0xbc,   0x04,
+    0x40,   0x03,   0xde,   0xf6,   0xc2,   0xba,   0x32,   0x19,
+    0x3f,   0xe3,   0x80,   0xb1,   0x84,   0xdd,   0x90,   0xc0,
+    0xa8,   0x0e,   0x33,   0x2c,   0xc3,   0xd4,   0xb0,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::MULS[128] = {
+    0xe4,   0x96,   0x0e,   0x24,   0x6a,   0x12,   0x34,   0xb4,
+    0x48,   0xa0,   0xcc,   0x14,   0x2e,   0x5c,   0x56,   0x80,
+    0xa4,   0x4c,   0x82,   0x86,   0x52,   0xb4,   0x30,   0x70,
+    0x0a,   0x6a,   0xd6,   0x9c,   0x5a,   0xda,   0xd6,   0x88,
+    0xec,   0x04,   0xf4,   0x74,   0xd8,   0x94,   0xd4,   0x60,
+    0x4c,   0x50,   0xe4,   0x5a,   0x98,   0xf0,   0x1e,   0x5e,
+    0xc4,   0xfa,   0x5c,   0xce,   0x66,   0x4a,   0x74,   0xd0,
+    0x10,   0xbe,   0xfa,   0xbe,   0x2a,   0x8c,   0x36,   0x66,
+    0x56,   0x8c,   0x48,   0x38,   0x2a,   0x30,   0x8a,   0xb6,
+    0x0a,   0xf6,   0x36,   0xa6,   0xbc,   0xaa,   0xe6,   0xd0,
+    0x6a,   0x10,   0x5e,   0xc4,   0x40,   0xc4,   0x58,   0xda,
+    0x4a,   0xc2,   0x46,   0xea,   0xf8,   0xdc,   0x52,   0xcc,
+    0x7c,   0xe8,   0xa0,   0xfa,   0x76,   0xfc,   0x48,   0x1e,
+    0xa0,   0x2a,   0x24,   0xea,   0x9c,   0x24,   0x7c,   0x5e,
+    0x72,   0x3a,   0x94,   0xae,   0x2a,   0x16,   0xe0,   0x20,
+    0x38,   0xc4,   0xca,   0xe4,   0xaa,   0x48,   0xea,   0xca
+};
+
+const uint8_t DataSet_1_8u::outputs::MMULS[128] = {
+    0xfe,   0x96,   0x0e,   0x5e,   0x6a,   0x6f,   0x16,   0xb4,
+    0x48,   0xb0,   0xea,   0x14,   0x71,   0x5c,   0x56,   0xc0,
+    0x1e,   0x4c,   0x82,   0x65,   0x52,   0xd6,   0xa8,   0x70,
+    0x0a,   0x63,   0xfd,   0x9c,   0xab,   0xda,   0xd6,   0x9c,
+    0x5a,   0x04,   0xf4,   0xf6,   0xd8,   0x66,   0xc6,   0x60,
+    0x4c,   0x98,   0xfe,   0x5a,   0xd4,   0xf0,   0x1e,   0x99,
+    0x0e,   0xfa,   0x5c,   0x21,   0x66,   0xf3,   0xf6,   0xd0,
+    0x10,   0x69,   0xdb,   0xbe,   0x03,   0x8c,   0x36,   0xf5,
+    0x3d,   0x8c,   0x48,   0x04,   0x2a,   0x28,   0x53,   0xb6,
+    0x0a,   0x6d,   0xcd,   0xa6,   0xb2,   0xaa,   0xe6,   0xd8,
+    0xe3,   0x10,   0x5e,   0x0e,   0x40,   0x0e,   0xf4,   0xda,
+    0x4a,   0xd7,   0x85,   0xea,   0xa4,   0xdc,   0x52,   0x6a,
+    0x52,   0xe8,   0xa0,   0x5b,   0x76,   0x92,   0xbc,   0x1e,
+    0xa0,   0x03,   0xde,   0xea,   0xc2,   0x24,   0x7c,   0x19,
+    0x3f,   0x3a,   0x94,   0xb1,   0x2a,   0xdd,   0x90,   0x20,
+    0x38,   0x0e,   0x33,   0xe4,   0xc3,   0x48,   0xea,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::DIVV[128] = {
+    0x01,   0x01,   0x0b,   0x00,   0x00,   0x00,   0x00,   0x04,
+    0x0a,   0x01,   0x02,   0x1b,   0x08,   0x0c,   0x01,   0x00,
+    0x00,   0x00,   0x04,   0x02,   0x02,   0x06,   0x01,   0x00,
+    0x00,   0x00,   0x04,   0x00,   0x01,   0x00,   0x01,   0x08,
+    0x01,   0x00,   0x00,   0x00,   0x01,   0x00,   0x00,   0x02,
+    0x00,   0x02,   0x01,   0x00,   0x01,   0x00,   0x00,   0x00,
+    0x00,   0x01,   0x00,   0x00,   0x01,   0x00,   0x01,   0x00,
+    0x02,   0x00,   0x02,   0x08,   0x00,   0x00,   0x00,   0x02,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x01,   0x01,   0x02,   0x14,   0x01,
+    0x01,   0x01,   0x01,   0x00,   0x01,   0x0e,   0x01,   0x02,
+    0x00,   0x47,   0x01,   0x00,   0x00,   0x00,   0x00,   0x09,
+    0x00,   0x0a,   0x00,   0x00,   0x03,   0x00,   0x01,   0x01,
+    0x01,   0x00,   0x01,   0x00,   0x01,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x03,   0x02,   0x02,   0x01,   0x01,   0x01,
+    0x00,   0x00,   0x00,   0x01,   0x03,   0x00,   0x01,   0x01
+};
+
+const uint8_t DataSet_1_8u::outputs::MDIVV[128] = {
+    0xfe,   0x01,   0x0b,   0x5e,   0x00,   0x6f,   0x16,   0x04,
+    0x0a,   0xb0,   0xea,   0x1b,   0x71,   0x0c,   0x01,   0xc0,
+    0x1e,   0x00,   0x04,   0x65,   0x02,   0xd6,   0xa8,   0x00,
+    0x00,   0x63,   0xfd,   0x00,   0xab,   0x00,   0x01,   0x9c,
+    0x5a,   0x00,   0x00,   0xf6,   0x01,   0x66,   0xc6,   0x02,
+    0x00,   0x98,   0xfe,   0x00,   0xd4,   0x00,   0x00,   0x99,
+    0x0e,   0x01,   0x00,   0x21,   0x01,   0xf3,   0xf6,   0x00,
+    0x02,   0x69,   0xdb,   0x08,   0x03,   0x00,   0x00,   0xf5,
+    0x3d,   0x00,   0x00,   0x04,   0x00,   0x28,   0x53,   0x00,
+    0x00,   0x6d,   0xcd,   0x01,   0xb2,   0x02,   0x14,   0xd8,
+    0xe3,   0x01,   0x01,   0x0e,   0x01,   0x0e,   0xf4,   0x02,
+    0x00,   0xd7,   0x85,   0x00,   0xa4,   0x00,   0x00,   0x6a,
+    0x52,   0x0a,   0x00,   0x5b,   0x03,   0x92,   0xbc,   0x01,
+    0x01,   0x03,   0xde,   0x00,   0xc2,   0x00,   0x00,   0x19,
+    0x3f,   0x00,   0x03,   0xb1,   0x02,   0xdd,   0x90,   0x01,
+    0x00,   0x0e,   0x33,   0x01,   0xc3,   0x00,   0x01,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::DIVS[128] = {
+    0x12,   0x0b,   0x09,   0x06,   0x07,   0x07,   0x01,   0x0f,
+    0x04,   0x0c,   0x10,   0x0b,   0x08,   0x10,   0x04,   0x0d,
+    0x02,   0x03,   0x08,   0x07,   0x0e,   0x0f,   0x0c,   0x00,
+    0x01,   0x07,   0x12,   0x0d,   0x0c,   0x07,   0x12,   0x0b,
+    0x06,   0x07,   0x03,   0x11,   0x03,   0x07,   0x0e,   0x05,
+    0x03,   0x0a,   0x12,   0x03,   0x0f,   0x05,   0x04,   0x0a,
+    0x01,   0x06,   0x07,   0x02,   0x11,   0x11,   0x11,   0x06,
+    0x0d,   0x07,   0x0f,   0x07,   0x00,   0x09,   0x05,   0x11,
+    0x04,   0x09,   0x0d,   0x00,   0x00,   0x02,   0x05,   0x0a,
+    0x01,   0x07,   0x0e,   0x0f,   0x0c,   0x0d,   0x0c,   0x0f,
+    0x10,   0x04,   0x0a,   0x01,   0x06,   0x01,   0x11,   0x10,
+    0x08,   0x0f,   0x09,   0x0b,   0x0b,   0x02,   0x05,   0x07,
+    0x05,   0x10,   0x03,   0x06,   0x03,   0x0a,   0x0d,   0x04,
+    0x03,   0x00,   0x0f,   0x02,   0x0d,   0x0f,   0x05,   0x01,
+    0x04,   0x04,   0x10,   0x0c,   0x09,   0x0f,   0x0a,   0x11,
+    0x09,   0x01,   0x03,   0x12,   0x0d,   0x04,   0x0b,   0x0c
+};
+
+const uint8_t DataSet_1_8u::outputs::MDIVS[128] = {
+    0xfe,   0x0b,   0x09,   0x5e,   0x07,   0x6f,   0x16,   0x0f,
+    0x04,   0xb0,   0xea,   0x0b,   0x71,   0x10,   0x04,   0xc0,
+    0x1e,   0x03,   0x08,   0x65,   0x0e,   0xd6,   0xa8,   0x00,
+    0x01,   0x63,   0xfd,   0x0d,   0xab,   0x07,   0x12,   0x9c,
+    0x5a,   0x07,   0x03,   0xf6,   0x03,   0x66,   0xc6,   0x05,
+    0x03,   0x98,   0xfe,   0x03,   0xd4,   0x05,   0x04,   0x99,
+    0x0e,   0x06,   0x07,   0x21,   0x11,   0xf3,   0xf6,   0x06,
+    0x0d,   0x69,   0xdb,   0x07,   0x03,   0x09,   0x05,   0xf5,
+    0x3d,   0x09,   0x0d,   0x04,   0x00,   0x28,   0x53,   0x0a,
+    0x01,   0x6d,   0xcd,   0x0f,   0xb2,   0x0d,   0x0c,   0xd8,
+    0xe3,   0x04,   0x0a,   0x0e,   0x06,   0x0e,   0xf4,   0x10,
+    0x08,   0xd7,   0x85,   0x0b,   0xa4,   0x02,   0x05,   0x6a,
+    0x52,   0x10,   0x03,   0x5b,   0x03,   0x92,   0xbc,   0x04,
+    0x03,   0x03,   0xde,   0x02,   0xc2,   0x0f,   0x05,   0x19,
+    0x3f,   0x04,   0x10,   0xb1,   0x09,   0xdd,   0x90,   0x11,
+    0x09,   0x0e,   0x33,   0x12,   0xc3,   0x04,   0x0b,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::RCP[128] = {
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00
+};
+
+const uint8_t DataSet_1_8u::outputs::MRCP[128] = {
+    0xfe,   0x00,   0x00,   0x5e,   0x00,   0x6f,   0x16,   0x00,
+    0x00,   0xb0,   0xea,   0x00,   0x71,   0x00,   0x00,   0xc0,
+    0x1e,   0x00,   0x00,   0x65,   0x00,   0xd6,   0xa8,   0x00,
+    0x00,   0x63,   0xfd,   0x00,   0xab,   0x00,   0x00,   0x9c,
+    0x5a,   0x00,   0x00,   0xf6,   0x00,   0x66,   0xc6,   0x00,
+    0x00,   0x98,   0xfe,   0x00,   0xd4,   0x00,   0x00,   0x99,
+    0x0e,   0x00,   0x00,   0x21,   0x00,   0xf3,   0xf6,   0x00,
+    0x00,   0x69,   0xdb,   0x00,   0x03,   0x00,   0x00,   0xf5,
+    0x3d,   0x00,   0x00,   0x04,   0x00,   0x28,   0x53,   0x00,
+    0x00,   0x6d,   0xcd,   0x00,   0xb2,   0x00,   0x00,   0xd8,
+    0xe3,   0x00,   0x00,   0x0e,   0x00,   0x0e,   0xf4,   0x00,
+    0x00,   0xd7,   0x85,   0x00,   0xa4,   0x00,   0x00,   0x6a,
+    0x52,   0x00,   0x00,   0x5b,   0x00,   0x92,   0xbc,   0x00,
+    0x00,   0x03,   0xde,   0x00,   0xc2,   0x00,   0x00,   0x19,
+    0x3f,   0x00,   0x00,   0xb1,   0x00,   0xdd,   0x90,   0x00,
+    0x00,   0x0e,   0x33,   0x00,   0xc3,   0x00,   0x00,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::RCPS[128] = {
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x01,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x01,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x04,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x03,   0x04,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x01,   0x00,   0x01,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x04,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x01,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00
+};
+
+const uint8_t DataSet_1_8u::outputs::MRCPS[128] = {
+    0xfe,   0x00,   0x00,   0x5e,   0x00,   0x6f,   0x16,   0x00,
+    0x00,   0xb0,   0xea,   0x00,   0x71,   0x00,   0x00,   0xc0,
+    0x1e,   0x00,   0x00,   0x65,   0x00,   0xd6,   0xa8,   0x01,
+    0x00,   0x63,   0xfd,   0x00,   0xab,   0x00,   0x00,   0x9c,
+    0x5a,   0x00,   0x00,   0xf6,   0x00,   0x66,   0xc6,   0x00,
+    0x00,   0x98,   0xfe,   0x00,   0xd4,   0x00,   0x00,   0x99,
+    0x0e,   0x00,   0x00,   0x21,   0x00,   0xf3,   0xf6,   0x00,
+    0x00,   0x69,   0xdb,   0x00,   0x03,   0x00,   0x00,   0xf5,
+    0x3d,   0x00,   0x00,   0x04,   0x04,   0x28,   0x53,   0x00,
+    0x00,   0x6d,   0xcd,   0x00,   0xb2,   0x00,   0x00,   0xd8,
+    0xe3,   0x00,   0x00,   0x0e,   0x00,   0x0e,   0xf4,   0x00,
+    0x00,   0xd7,   0x85,   0x00,   0xa4,   0x00,   0x00,   0x6a,
+    0x52,   0x00,   0x00,   0x5b,   0x00,   0x92,   0xbc,   0x00,
+    0x00,   0x03,   0xde,   0x00,   0xc2,   0x00,   0x00,   0x19,
+    0x3f,   0x00,   0x00,   0xb1,   0x00,   0xdd,   0x90,   0x00,
+    0x00,   0x0e,   0x33,   0x00,   0xc3,   0x00,   0x00,   0xb3
+};
+
+const bool DataSet_1_8u::outputs::CMPEQV[128] = {
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false
+};
+
+const bool DataSet_1_8u::outputs::CMPEQS[128] = {
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    true,   false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  true,   false,  true,   false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  true,   false,  false,  false,  false,  false,  false
+};
+
+const bool DataSet_1_8u::outputs::CMPNEV[128] = {
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true
+};
+
+const bool DataSet_1_8u::outputs::CMPNES[128] = {
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    false,  true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   false,  true,   false,  true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   false,  true,   true,   true,   true,   true,   true
+};
+
+const bool DataSet_1_8u::outputs::CMPGTV[128] = {
+    true,   true,   true,   false,  false,  false,  false,  true,
+    true,   true,   true,   true,   true,   true,   true,   false,
+    false,  false,  true,   true,   true,   true,   true,   false,
+    false,  false,  true,   false,  true,   false,  true,   true,
+    true,   false,  false,  false,  true,   false,  false,  true,
+    false,  true,   true,   false,  true,   false,  false,  false,
+    false,  true,   false,  false,  true,   false,  true,   false,
+    true,   false,  true,   true,   false,  false,  false,  true,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  true,   true,   true,   true,   true,
+    true,   true,   true,   false,  true,   true,   true,   true,
+    false,  true,   true,   false,  false,  false,  false,  true,
+    false,  true,   false,  false,  true,   false,  true,   true,
+    true,   false,  true,   false,  true,   false,  false,  false,
+    false,  false,  true,   true,   true,   true,   true,   true,
+    false,  false,  false,  true,   true,   false,  true,   true
+};
+
+const bool DataSet_1_8u::outputs::CMPGTS[128] = {
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   false,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    false,  true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   false,  true,   true,   true,
+    true,   true,   true,   false,  false,  true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   false,  true,   false,  true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   false,  true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   false,  true,   true,   true,   true,   true,   true
+};
+
+const bool DataSet_1_8u::outputs::CMPLTV[128] = {
+    false,  false,  false,  true,   true,   true,   true,   false,
+    false,  false,  false,  false,  false,  false,  false,  true,
+    true,   true,   false,  false,  false,  false,  false,  true,
+    true,   true,   false,  true,   false,  true,   false,  false,
+    false,  true,   true,   true,   false,  true,   true,   false,
+    true,   false,  false,  true,   false,  true,   true,   true,
+    true,   false,  true,   true,   false,  true,   false,  true,
+    false,  true,   false,  false,  true,   true,   true,   false,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   false,  false,  false,  false,  false,
+    false,  false,  false,  true,   false,  false,  false,  false,
+    true,   false,  false,  true,   true,   true,   true,   false,
+    true,   false,  true,   true,   false,  true,   false,  false,
+    false,  true,   false,  true,   false,  true,   true,   true,
+    true,   true,   false,  false,  false,  false,  false,  false,
+    true,   true,   true,   false,  false,  true,   false,  false
+};
+
+const bool DataSet_1_8u::outputs::CMPLTS[128] = {
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  true,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  true,   false,  false,  false,
+    false,  false,  false,  true,   true,   false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  true,   false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false
+};
+
+const bool DataSet_1_8u::outputs::CMPGEV[128] = {
+    true,   true,   true,   false,  false,  false,  false,  true,
+    true,   true,   true,   true,   true,   true,   true,   false,
+    false,  false,  true,   true,   true,   true,   true,   false,
+    false,  false,  true,   false,  true,   false,  true,   true,
+    true,   false,  false,  false,  true,   false,  false,  true,
+    false,  true,   true,   false,  true,   false,  false,  false,
+    false,  true,   false,  false,  true,   false,  true,   false,
+    true,   false,  true,   true,   false,  false,  false,  true,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  true,   true,   true,   true,   true,
+    true,   true,   true,   false,  true,   true,   true,   true,
+    false,  true,   true,   false,  false,  false,  false,  true,
+    false,  true,   false,  false,  true,   false,  true,   true,
+    true,   false,  true,   false,  true,   false,  false,  false,
+    false,  false,  true,   true,   true,   true,   true,   true,
+    false,  false,  false,  true,   true,   false,  true,   true
+};
+
+const bool DataSet_1_8u::outputs::CMPGES[128] = {
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   false,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   false,  true,   true,   true,
+    true,   true,   true,   false,  false,  true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   false,  true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true
+};
+
+const bool DataSet_1_8u::outputs::CMPLEV[128] = {
+    false,  false,  false,  true,   true,   true,   true,   false,
+    false,  false,  false,  false,  false,  false,  false,  true,
+    true,   true,   false,  false,  false,  false,  false,  true,
+    true,   true,   false,  true,   false,  true,   false,  false,
+    false,  true,   true,   true,   false,  true,   true,   false,
+    true,   false,  false,  true,   false,  true,   true,   true,
+    true,   false,  true,   true,   false,  true,   false,  true,
+    false,  true,   false,  false,  true,   true,   true,   false,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   false,  false,  false,  false,  false,
+    false,  false,  false,  true,   false,  false,  false,  false,
+    true,   false,  false,  true,   true,   true,   true,   false,
+    true,   false,  true,   true,   false,  true,   false,  false,
+    false,  true,   false,  true,   false,  true,   true,   true,
+    true,   true,   false,  false,  false,  false,  false,  false,
+    true,   true,   true,   false,  false,  true,   false,  false
+};
+
+const bool DataSet_1_8u::outputs::CMPLES[128] = {
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  true,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    true,   false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  true,   false,  false,  false,
+    false,  false,  false,  true,   true,   false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  true,   false,  true,   false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  true,   false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  true,   false,  false,  false,  false,  false,  false
+};
+
+const bool DataSet_1_8u::outputs::CMPEV = false;
+const bool DataSet_1_8u::outputs::CMPES = false;
+
+const uint8_t DataSet_1_8u::outputs::HADD[128] = {
+    0xfe,   0x9b,   0x1c,   0x7a,   0xdd,   0x4c,   0x62,   0x38,
+    0x74,   0x24,   0x0e,   0xb4,   0x25,   0x07,   0x44,   0x04,
+    0x22,   0x4c,   0xc3,   0x28,   0xf7,   0xcd,   0x75,   0x7d,
+    0x90,   0xf3,   0xf0,   0xb2,   0x5d,   0xc8,   0xc5,   0x61,
+    0xbb,   0x29,   0x5f,   0x55,   0x89,   0xef,   0xb5,   0x05,
+    0x2f,   0xc7,   0xc5,   0xf0,   0xc4,   0x0c,   0x45,   0xde,
+    0xec,   0x47,   0xa9,   0xca,   0xbf,   0xb2,   0xa8,   0x00,
+    0xb8,   0x21,   0xfc,   0x65,   0x68,   0xf2,   0x3f,   0x34,
+    0x71,   0xfb,   0xb7,   0xbb,   0xbe,   0xe6,   0x39,   0xc6,
+    0xd9,   0x46,   0x13,   0xe8,   0x9a,   0x5d,   0x12,   0xea,
+    0xcd,   0x05,   0x9e,   0xac,   0x0c,   0x1a,   0x0e,   0xf9,
+    0x6c,   0x43,   0xc8,   0x6b,   0x0f,   0x31,   0x80,   0xea,
+    0x3c,   0x28,   0x58,   0xb3,   0xe0,   0x72,   0x2e,   0x67,
+    0x97,   0x9a,   0x78,   0x9b,   0x5d,   0x3b,   0x8d,   0xa6,
+    0xe5,   0x20,   0x06,   0xb7,   0x3a,   0x17,   0xa7,   0x97,
+    0x1b,   0x29,   0x5c,   0x5a,   0x1d,   0x59,   0xfc,   0xaf
+};
+
+const uint8_t DataSet_1_8u::outputs::MHADD[128] = {
+    0x00,   0x9d,   0x1e,   0x1e,   0x81,   0x81,   0x81,   0x57,
+    0x93,   0x93,   0x93,   0x39,   0x39,   0x1b,   0x58,   0x58,
+    0x58,   0x82,   0xf9,   0xf9,   0xc8,   0xc8,   0xc8,   0xd0,
+    0xe3,   0xe3,   0xe3,   0xa5,   0xa5,   0x10,   0x0d,   0x0d,
+    0x0d,   0x7b,   0xb1,   0xb1,   0xe5,   0xe5,   0xe5,   0x35,
+    0x5f,   0x5f,   0x5f,   0x8a,   0x8a,   0xd2,   0x0b,   0x0b,
+    0x0b,   0x66,   0xc8,   0xc8,   0xbd,   0xbd,   0xbd,   0x15,
+    0xcd,   0xcd,   0xcd,   0x36,   0x36,   0xc0,   0x0d,   0x0d,
+    0x0d,   0x97,   0x53,   0x53,   0x56,   0x56,   0x56,   0xe3,
+    0xf6,   0xf6,   0xf6,   0xcb,   0xcb,   0x8e,   0x43,   0x43,
+    0x43,   0x7b,   0x14,   0x14,   0x74,   0x74,   0x74,   0x5f,
+    0xd2,   0xd2,   0xd2,   0x75,   0x75,   0x97,   0xe6,   0xe6,
+    0xe6,   0xd2,   0x02,   0x02,   0x2f,   0x2f,   0x2f,   0x68,
+    0x98,   0x98,   0x98,   0xbb,   0xbb,   0x99,   0xeb,   0xeb,
+    0xeb,   0x26,   0x0c,   0x0c,   0x8f,   0x8f,   0x8f,   0x7f,
+    0x03,   0x03,   0x03,   0x01,   0x01,   0x3d,   0xe0,   0xe0
+};
+
+const uint8_t DataSet_1_8u::outputs::HMUL[128] = {
+    0xfe,   0xc6,   0xc6,   0xb4,   0x9c,   0xa4,   0x18,   0x10,
+    0xc0,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00
+};
+
+const uint8_t DataSet_1_8u::outputs::MHMUL[128] = {
+    0x01,   0x9d,   0x1d,   0x1d,   0x37,   0x37,   0x37,   0xfa,
+    0x98,   0x98,   0x98,   0x90,   0x90,   0x20,   0xa0,   0xa0,
+    0xa0,   0x40,   0xc0,   0xc0,   0x40,   0x40,   0x40,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00
+};
+
+const uint8_t DataSet_1_8u::outputs::FMULADDV[128] = {
+    0x38,   0xdd,   0x4b,   0x46,   0x54,   0x7a,   0xf5,   0xaf,
+    0x4a,   0xd5,   0xad,   0x7e,   0xaf,   0x6a,   0x2a,   0xec,
+    0xf8,   0xc4,   0x40,   0xcf,   0x7c,   0x16,   0xe7,   0x6a,
+    0x61,   0x19,   0x42,   0x37,   0xe6,   0xa1,   0x23,   0x3f,
+    0xb4,   0xb3,   0x1b,   0x6b,   0x86,   0x7f,   0x9d,   0x93,
+    0x82,   0x65,   0x75,   0xce,   0xcb,   0xe2,   0xe3,   0x9e,
+    0x11,   0x8a,   0x00,   0xdb,   0x73,   0xfd,   0xd6,   0xd1,
+    0xa9,   0xdf,   0xb0,   0x21,   0x15,   0x38,   0x2f,   0x51,
+    0x05,   0x65,   0x88,   0x88,   0xfb,   0x20,   0x9f,   0x5b,
+    0x4a,   0xcc,   0xa0,   0x2d,   0xe5,   0xde,   0xc9,   0xdd,
+    0xf6,   0xfc,   0x00,   0xac,   0x6f,   0x86,   0x06,   0xc5,
+    0x49,   0x28,   0xb7,   0xf6,   0xaa,   0xd0,   0x39,   0xd1,
+    0x0a,   0x10,   0xdb,   0xa6,   0x2c,   0xee,   0xb5,   0xd3,
+    0x2e,   0xc1,   0x7e,   0xd4,   0xc8,   0x61,   0xf5,   0x3a,
+    0x92,   0xf8,   0xc0,   0xbc,   0x6c,   0xb2,   0x42,   0x87,
+    0xa3,   0xe6,   0xf1,   0xfc,   0xde,   0xee,   0x78,   0xbe
+};
+
+const uint8_t DataSet_1_8u::outputs::MFMULADDV[128] = {
+    0xfe,   0xdd,   0x4b,   0x5e,   0x54,   0x6f,   0x16,   0xaf,
+    0x4a,   0xb0,   0xea,   0x7e,   0x71,   0x6a,   0x2a,   0xc0,
+    0x1e,   0xc4,   0x40,   0x65,   0x7c,   0xd6,   0xa8,   0x6a,
+    0x61,   0x63,   0xfd,   0x37,   0xab,   0xa1,   0x23,   0x9c,
+    0x5a,   0xb3,   0x1b,   0xf6,   0x86,   0x66,   0xc6,   0x93,
+    0x82,   0x98,   0xfe,   0xce,   0xd4,   0xe2,   0xe3,   0x99,
+    0x0e,   0x8a,   0x00,   0x21,   0x73,   0xf3,   0xf6,   0xd1,
+    0xa9,   0x69,   0xdb,   0x21,   0x03,   0x38,   0x2f,   0xf5,
+    0x3d,   0x65,   0x88,   0x04,   0xfb,   0x28,   0x53,   0x5b,
+    0x4a,   0x6d,   0xcd,   0x2d,   0xb2,   0xde,   0xc9,   0xd8,
+    0xe3,   0xfc,   0x00,   0x0e,   0x6f,   0x0e,   0xf4,   0xc5,
+    0x49,   0xd7,   0x85,   0xf6,   0xa4,   0xd0,   0x39,   0x6a,
+    0x52,   0x10,   0xdb,   0x5b,   0x2c,   0x92,   0xbc,   0xd3,
+    0x2e,   0x03,   0xde,   0xd4,   0xc2,   0x61,   0xf5,   0x19,
+    0x3f,   0xf8,   0xc0,   0xb1,   0x6c,   0xdd,   0x90,   0x87,
+    0xa3,   0x0e,   0x33,   0xfc,   0xc3,   0xee,   0x78,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::FMULSUBV[128] = {
+    0x48,   0x31,   0xcb,   0x7a,   0x32,   0x52,   0xcb,   0xed,
+    0x86,   0x8b,   0x7b,   0x4a,   0xcb,   0x5e,   0x78,   0x14,
+    0x30,   0x68,   0x10,   0x47,   0x4c,   0x6e,   0x39,   0xb6,
+    0x85,   0x95,   0x7a,   0xd9,   0x5e,   0xe1,   0x11,   0xb1,
+    0xac,   0x35,   0x71,   0x0d,   0xe2,   0x91,   0x27,   0x4d,
+    0xaa,   0xab,   0xd3,   0x80,   0xe5,   0x1e,   0x65,   0xd4,
+    0x23,   0x2a,   0xd0,   0xc9,   0x19,   0xb9,   0x7e,   0xdf,
+    0xa7,   0xcd,   0x52,   0xb7,   0x9d,   0xe4,   0xbd,   0xf3,
+    0x55,   0x6f,   0xc0,   0x10,   0x31,   0xf0,   0x29,   0x0f,
+    0xbe,   0x7c,   0xe6,   0x31,   0x43,   0xc6,   0xf1,   0x93,
+    0xfe,   0x34,   0xc6,   0x84,   0xd1,   0x96,   0xda,   0xfd,
+    0x53,   0xe2,   0x5d,   0xd6,   0xce,   0x38,   0x5d,   0x4b,
+    0x8e,   0x58,   0x65,   0xec,   0x0c,   0x86,   0x2b,   0x35,
+    0x52,   0x17,   0xa2,   0x18,   0x50,   0x13,   0x6f,   0x7c,
+    0x4e,   0xce,   0x40,   0xbe,   0x9c,   0x40,   0x3e,   0xf9,
+    0xad,   0x3e,   0x97,   0x5c,   0xd4,   0xba,   0xe8,   0xd8
+};
+
+const uint8_t DataSet_1_8u::outputs::MFMULSUBV[128] = {
+    0xfe,   0x31,   0xcb,   0x5e,   0x32,   0x6f,   0x16,   0xed,
+    0x86,   0xb0,   0xea,   0x4a,   0x71,   0x5e,   0x78,   0xc0,
+    0x1e,   0x68,   0x10,   0x65,   0x4c,   0xd6,   0xa8,   0xb6,
+    0x85,   0x63,   0xfd,   0xd9,   0xab,   0xe1,   0x11,   0x9c,
+    0x5a,   0x35,   0x71,   0xf6,   0xe2,   0x66,   0xc6,   0x4d,
+    0xaa,   0x98,   0xfe,   0x80,   0xd4,   0x1e,   0x65,   0x99,
+    0x0e,   0x2a,   0xd0,   0x21,   0x19,   0xf3,   0xf6,   0xdf,
+    0xa7,   0x69,   0xdb,   0xb7,   0x03,   0xe4,   0xbd,   0xf5,
+    0x3d,   0x6f,   0xc0,   0x04,   0x31,   0x28,   0x53,   0x0f,
+    0xbe,   0x6d,   0xcd,   0x31,   0xb2,   0xc6,   0xf1,   0xd8,
+    0xe3,   0x34,   0xc6,   0x0e,   0xd1,   0x0e,   0xf4,   0xfd,
+    0x53,   0xd7,   0x85,   0xd6,   0xa4,   0x38,   0x5d,   0x6a,
+    0x52,   0x58,   0x65,   0x5b,   0x0c,   0x92,   0xbc,   0x35,
+    0x52,   0x03,   0xde,   0x18,   0xc2,   0x13,   0x6f,   0x19,
+    0x3f,   0xce,   0x40,   0xb1,   0x9c,   0xdd,   0x90,   0xf9,
+    0xad,   0x0e,   0x33,   0x5c,   0xc3,   0xba,   0xe8,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::FADDMULV[128] = {
+    0x10,   0x60,   0x00,   0xd4,   0x44,   0x34,   0xde,   0x2b,
+    0x44,   0x5d,   0x6c,   0x78,   0x1c,   0xb8,   0x12,   0x48,
+    0x50,   0x9e,   0x68,   0x50,   0x08,   0x34,   0x8e,   0xa4,
+    0x58,   0xc0,   0x6c,   0x9a,   0x04,   0x40,   0x97,   0x42,
+    0x48,   0xfc,   0xfb,   0x10,   0xba,   0x1e,   0x1b,   0xa1,
+    0x4c,   0xf7,   0xac,   0x60,   0x36,   0x10,   0x43,   0xe2,
+    0x5f,   0xb0,   0x10,   0x4b,   0x67,   0x58,   0xdc,   0xa1,
+    0x0b,   0x47,   0x72,   0x39,   0xa8,   0x92,   0x03,   0x81,
+    0xd0,   0x19,   0x2c,   0x64,   0xe9,   0xf8,   0x65,   0xc4,
+    0xba,   0x28,   0xac,   0x70,   0x0c,   0xec,   0x28,   0x21,
+    0xfc,   0x94,   0xa4,   0xa8,   0xb5,   0x08,   0x80,   0x78,
+    0xdf,   0xce,   0x3b,   0x50,   0x1a,   0x30,   0x98,   0x9f,
+    0x70,   0x94,   0x82,   0x2e,   0x90,   0xec,   0xe0,   0x33,
+    0xa8,   0xf3,   0x74,   0xf6,   0xe0,   0x57,   0x09,   0xd4,
+    0x7e,   0xc4,   0x80,   0x02,   0x98,   0xda,   0x08,   0x7c,
+    0x1a,   0x84,   0xb3,   0x80,   0xce,   0x96,   0xd8,   0xf4
+};
+
+const uint8_t DataSet_1_8u::outputs::MFADDMULV[128] = {
+    0xfe,   0x60,   0x00,   0x5e,   0x44,   0x6f,   0x16,   0x2b,
+    0x44,   0xb0,   0xea,   0x78,   0x71,   0xb8,   0x12,   0xc0,
+    0x1e,   0x9e,   0x68,   0x65,   0x08,   0xd6,   0xa8,   0xa4,
+    0x58,   0x63,   0xfd,   0x9a,   0xab,   0x40,   0x97,   0x9c,
+    0x5a,   0xfc,   0xfb,   0xf6,   0xba,   0x66,   0xc6,   0xa1,
+    0x4c,   0x98,   0xfe,   0x60,   0xd4,   0x10,   0x43,   0x99,
+    0x0e,   0xb0,   0x10,   0x21,   0x67,   0xf3,   0xf6,   0xa1,
+    0x0b,   0x69,   0xdb,   0x39,   0x03,   0x92,   0x03,   0xf5,
+    0x3d,   0x19,   0x2c,   0x04,   0xe9,   0x28,   0x53,   0xc4,
+    0xba,   0x6d,   0xcd,   0x70,   0xb2,   0xec,   0x28,   0xd8,
+    0xe3,   0x94,   0xa4,   0x0e,   0xb5,   0x0e,   0xf4,   0x78,
+    0xdf,   0xd7,   0x85,   0x50,   0xa4,   0x30,   0x98,   0x6a,
+    0x52,   0x94,   0x82,   0x5b,   0x90,   0x92,   0xbc,   0x33,
+    0xa8,   0x03,   0xde,   0xf6,   0xc2,   0x57,   0x09,   0x19,
+    0x3f,   0xc4,   0x80,   0xb1,   0x98,   0xdd,   0x90,   0x7c,
+    0x1a,   0x0e,   0x33,   0x80,   0xc3,   0x96,   0xd8,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::FSUBMULV[128] = {
+    0x10,   0x1c,   0x80,   0x14,   0xe2,   0x24,   0xbe,   0x01,
+    0xac,   0x83,   0x48,   0x40,   0x88,   0xe0,   0x58,   0xb8,
+    0x20,   0x7a,   0xe8,   0x58,   0xc8,   0x3c,   0xa2,   0xfc,
+    0xfc,   0x4c,   0x3c,   0xa2,   0xd4,   0x00,   0x33,   0x46,
+    0x88,   0x28,   0xe1,   0x44,   0x96,   0xb6,   0x29,   0x3f,
+    0x24,   0x79,   0x10,   0xba,   0x42,   0x10,   0xcb,   0xd8,
+    0xa5,   0x70,   0x50,   0x07,   0xbb,   0x34,   0xb4,   0x8f,
+    0x65,   0x1b,   0xf8,   0x41,   0xc0,   0xb6,   0x47,   0x75,
+    0x20,   0x83,   0xb4,   0x7c,   0x75,   0x88,   0xdd,   0x18,
+    0xaa,   0xe8,   0x46,   0x3c,   0x98,   0x5c,   0x90,   0x4f,
+    0xec,   0x2c,   0x06,   0x88,   0x8b,   0x18,   0x70,   0x20,
+    0xa3,   0xfc,   0x87,   0x10,   0xd6,   0x00,   0x4c,   0xdd,
+    0x48,   0x0c,   0x9e,   0xf0,   0x10,   0x64,   0x78,   0xfb,
+    0x98,   0x0b,   0x54,   0xbe,   0x10,   0x4d,   0xe3,   0xba,
+    0x3e,   0xea,   0x80,   0x9c,   0xd8,   0x90,   0x38,   0xa4,
+    0xbe,   0xac,   0x3b,   0x40,   0xd0,   0x9a,   0xd8,   0xde
+};
+
+const uint8_t DataSet_1_8u::outputs::MFSUBMULV[128] = {
+    0xfe,   0x1c,   0x80,   0x5e,   0xe2,   0x6f,   0x16,   0x01,
+    0xac,   0xb0,   0xea,   0x40,   0x71,   0xe0,   0x58,   0xc0,
+    0x1e,   0x7a,   0xe8,   0x65,   0xc8,   0xd6,   0xa8,   0xfc,
+    0xfc,   0x63,   0xfd,   0xa2,   0xab,   0x00,   0x33,   0x9c,
+    0x5a,   0x28,   0xe1,   0xf6,   0x96,   0x66,   0xc6,   0x3f,
+    0x24,   0x98,   0xfe,   0xba,   0xd4,   0x10,   0xcb,   0x99,
+    0x0e,   0x70,   0x50,   0x21,   0xbb,   0xf3,   0xf6,   0x8f,
+    0x65,   0x69,   0xdb,   0x41,   0x03,   0xb6,   0x47,   0xf5,
+    0x3d,   0x83,   0xb4,   0x04,   0x75,   0x28,   0x53,   0x18,
+    0xaa,   0x6d,   0xcd,   0x3c,   0xb2,   0x5c,   0x90,   0xd8,
+    0xe3,   0x2c,   0x06,   0x0e,   0x8b,   0x0e,   0xf4,   0x20,
+    0xa3,   0xd7,   0x85,   0x10,   0xa4,   0x00,   0x4c,   0x6a,
+    0x52,   0x0c,   0x9e,   0x5b,   0x10,   0x92,   0xbc,   0xfb,
+    0x98,   0x03,   0xde,   0xbe,   0xc2,   0x4d,   0xe3,   0x19,
+    0x3f,   0xea,   0x80,   0xb1,   0xd8,   0xdd,   0x90,   0xa4,
+    0xbe,   0x0e,   0x33,   0x40,   0xc3,   0x9a,   0xd8,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::MAXV[128] = {
+    0xfe,   0x9d,   0x81,   0x90,   0xa1,   0xfa,   0xd0,   0xd6,
+    0x3c,   0xb0,   0xea,   0xa6,   0x71,   0xe2,   0x3d,   0xd6,
+    0x96,   0x5f,   0x77,   0x65,   0xcf,   0xd6,   0xa8,   0x52,
+    0xa1,   0xfd,   0xfd,   0xc4,   0xab,   0x83,   0xfd,   0x9c,
+    0x5a,   0x96,   0xd9,   0xfa,   0x34,   0xec,   0xdb,   0x50,
+    0x5f,   0x98,   0xfe,   0x75,   0xd4,   0xc0,   0xc4,   0xa1,
+    0xcb,   0x5b,   0xb4,   0x92,   0xf5,   0xf9,   0xf6,   0x91,
+    0xb8,   0xe6,   0xdb,   0x69,   0xf3,   0xdb,   0xce,   0xf5,
+    0xb1,   0xf1,   0xe7,   0xd3,   0x32,   0xbd,   0x8c,   0xc9,
+    0x6c,   0xb4,   0xcf,   0xd5,   0xb2,   0xc3,   0xb5,   0xd8,
+    0xe3,   0x38,   0x99,   0xd4,   0x60,   0x0e,   0xf4,   0xeb,
+    0x7a,   0xd7,   0x85,   0xe2,   0xb7,   0xe2,   0xc5,   0x6a,
+    0x76,   0xec,   0x36,   0xab,   0x2d,   0xb5,   0xbc,   0x39,
+    0x30,   0xa4,   0xde,   0x92,   0xc2,   0xf3,   0xf1,   0x93,
+    0x90,   0x79,   0xe6,   0xb1,   0x83,   0xdd,   0x90,   0xf0,
+    0xaa,   0xef,   0xac,   0xfe,   0xc3,   0xfb,   0xa3,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::MMAXV[128] = {
+    0xfe,   0x9d,   0x81,   0x5e,   0xa1,   0x6f,   0x16,   0xd6,
+    0x3c,   0xb0,   0xea,   0xa6,   0x71,   0xe2,   0x3d,   0xc0,
+    0x1e,   0x5f,   0x77,   0x65,   0xcf,   0xd6,   0xa8,   0x52,
+    0xa1,   0x63,   0xfd,   0xc4,   0xab,   0x83,   0xfd,   0x9c,
+    0x5a,   0x96,   0xd9,   0xf6,   0x34,   0x66,   0xc6,   0x50,
+    0x5f,   0x98,   0xfe,   0x75,   0xd4,   0xc0,   0xc4,   0x99,
+    0x0e,   0x5b,   0xb4,   0x21,   0xf5,   0xf3,   0xf6,   0x91,
+    0xb8,   0x69,   0xdb,   0x69,   0x03,   0xdb,   0xce,   0xf5,
+    0x3d,   0xf1,   0xe7,   0x04,   0x32,   0x28,   0x53,   0xc9,
+    0x6c,   0x6d,   0xcd,   0xd5,   0xb2,   0xc3,   0xb5,   0xd8,
+    0xe3,   0x38,   0x99,   0x0e,   0x60,   0x0e,   0xf4,   0xeb,
+    0x7a,   0xd7,   0x85,   0xe2,   0xa4,   0xe2,   0xc5,   0x6a,
+    0x52,   0xec,   0x36,   0x5b,   0x2d,   0x92,   0xbc,   0x39,
+    0x30,   0x03,   0xde,   0x92,   0xc2,   0xf3,   0xf1,   0x19,
+    0x3f,   0x79,   0xe6,   0xb1,   0x83,   0xdd,   0x90,   0xf0,
+    0xaa,   0x0e,   0x33,   0xfe,   0xc3,   0xfb,   0xa3,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::MAXS[128] = {
+    0xfe,   0x9d,   0x81,   0x5e,   0x63,   0x6f,   0x16,   0xd6,
+    0x3c,   0xb0,   0xea,   0xa6,   0x71,   0xe2,   0x3d,   0xc0,
+    0x1e,   0x2a,   0x77,   0x65,   0xcf,   0xd6,   0xa8,   0x0e,
+    0x13,   0x63,   0xfd,   0xc2,   0xab,   0x6b,   0xfd,   0x9c,
+    0x5a,   0x6e,   0x36,   0xf6,   0x34,   0x66,   0xc6,   0x50,
+    0x2a,   0x98,   0xfe,   0x2b,   0xd4,   0x48,   0x39,   0x99,
+    0x0e,   0x5b,   0x62,   0x21,   0xf5,   0xf3,   0xf6,   0x58,
+    0xb8,   0x69,   0xdb,   0x69,   0x0e,   0x8a,   0x4d,   0xf5,
+    0x3d,   0x8a,   0xbc,   0x0e,   0x0e,   0x28,   0x53,   0x8d,
+    0x13,   0x6d,   0xcd,   0xd5,   0xb2,   0xc3,   0xb5,   0xd8,
+    0xe3,   0x38,   0x99,   0x0e,   0x60,   0x0e,   0xf4,   0xeb,
+    0x73,   0xd7,   0x85,   0xa3,   0xa4,   0x22,   0x4f,   0x6a,
+    0x52,   0xec,   0x30,   0x5b,   0x2d,   0x92,   0xbc,   0x39,
+    0x30,   0x0e,   0xde,   0x23,   0xc2,   0xde,   0x52,   0x19,
+    0x3f,   0x3b,   0xe6,   0xb1,   0x83,   0xdd,   0x90,   0xf0,
+    0x84,   0x0e,   0x33,   0xfe,   0xc3,   0x3c,   0xa3,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::MMAXS[128] = {
+    0xfe,   0x9d,   0x81,   0x5e,   0x63,   0x6f,   0x16,   0xd6,
+    0x3c,   0xb0,   0xea,   0xa6,   0x71,   0xe2,   0x3d,   0xc0,
+    0x1e,   0x2a,   0x77,   0x65,   0xcf,   0xd6,   0xa8,   0x0e,
+    0x13,   0x63,   0xfd,   0xc2,   0xab,   0x6b,   0xfd,   0x9c,
+    0x5a,   0x6e,   0x36,   0xf6,   0x34,   0x66,   0xc6,   0x50,
+    0x2a,   0x98,   0xfe,   0x2b,   0xd4,   0x48,   0x39,   0x99,
+    0x0e,   0x5b,   0x62,   0x21,   0xf5,   0xf3,   0xf6,   0x58,
+    0xb8,   0x69,   0xdb,   0x69,   0x03,   0x8a,   0x4d,   0xf5,
+    0x3d,   0x8a,   0xbc,   0x04,   0x0e,   0x28,   0x53,   0x8d,
+    0x13,   0x6d,   0xcd,   0xd5,   0xb2,   0xc3,   0xb5,   0xd8,
+    0xe3,   0x38,   0x99,   0x0e,   0x60,   0x0e,   0xf4,   0xeb,
+    0x73,   0xd7,   0x85,   0xa3,   0xa4,   0x22,   0x4f,   0x6a,
+    0x52,   0xec,   0x30,   0x5b,   0x2d,   0x92,   0xbc,   0x39,
+    0x30,   0x03,   0xde,   0x23,   0xc2,   0xde,   0x52,   0x19,
+    0x3f,   0x3b,   0xe6,   0xb1,   0x83,   0xdd,   0x90,   0xf0,
+    0x84,   0x0e,   0x33,   0xfe,   0xc3,   0x3c,   0xa3,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::MINV[128] = {
+    0xe0,   0x73,   0x0b,   0x5e,   0x63,   0x6f,   0x16,   0x35,
+    0x06,   0xa9,   0x62,   0x06,   0x0d,   0x12,   0x25,   0xc0,
+    0x1e,   0x2a,   0x18,   0x2f,   0x5c,   0x23,   0x7a,   0x08,
+    0x13,   0x63,   0x36,   0xc2,   0x66,   0x6b,   0xa2,   0x12,
+    0x38,   0x6e,   0x36,   0xf6,   0x21,   0x66,   0xc6,   0x1b,
+    0x2a,   0x4b,   0xee,   0x2b,   0x9e,   0x48,   0x39,   0x99,
+    0x0e,   0x2e,   0x62,   0x21,   0xee,   0xf3,   0xaf,   0x58,
+    0x53,   0x69,   0x53,   0x0c,   0x03,   0x8a,   0x4d,   0x5a,
+    0x3d,   0x8a,   0xbc,   0x04,   0x03,   0x28,   0x53,   0x8d,
+    0x13,   0x6d,   0xcd,   0x73,   0x9a,   0x46,   0x09,   0x75,
+    0xbe,   0x35,   0x5b,   0x0e,   0x5b,   0x01,   0xcc,   0x63,
+    0x73,   0x03,   0x82,   0xa3,   0xa4,   0x22,   0x4f,   0x0b,
+    0x52,   0x17,   0x30,   0x5b,   0x0c,   0x92,   0xa4,   0x24,
+    0x1c,   0x03,   0xb8,   0x23,   0x86,   0xde,   0x52,   0x19,
+    0x3f,   0x3b,   0x40,   0x4d,   0x2c,   0xcd,   0x74,   0xb4,
+    0x84,   0x0e,   0x33,   0xea,   0x33,   0x3c,   0x90,   0x89
+};
+
+const uint8_t DataSet_1_8u::outputs::MMINV[128] = {
+    0xfe,   0x73,   0x0b,   0x5e,   0x63,   0x6f,   0x16,   0x35,
+    0x06,   0xb0,   0xea,   0x06,   0x71,   0x12,   0x25,   0xc0,
+    0x1e,   0x2a,   0x18,   0x65,   0x5c,   0xd6,   0xa8,   0x08,
+    0x13,   0x63,   0xfd,   0xc2,   0xab,   0x6b,   0xa2,   0x9c,
+    0x5a,   0x6e,   0x36,   0xf6,   0x21,   0x66,   0xc6,   0x1b,
+    0x2a,   0x98,   0xfe,   0x2b,   0xd4,   0x48,   0x39,   0x99,
+    0x0e,   0x2e,   0x62,   0x21,   0xee,   0xf3,   0xf6,   0x58,
+    0x53,   0x69,   0xdb,   0x0c,   0x03,   0x8a,   0x4d,   0xf5,
+    0x3d,   0x8a,   0xbc,   0x04,   0x03,   0x28,   0x53,   0x8d,
+    0x13,   0x6d,   0xcd,   0x73,   0xb2,   0x46,   0x09,   0xd8,
+    0xe3,   0x35,   0x5b,   0x0e,   0x5b,   0x0e,   0xf4,   0x63,
+    0x73,   0xd7,   0x85,   0xa3,   0xa4,   0x22,   0x4f,   0x6a,
+    0x52,   0x17,   0x30,   0x5b,   0x0c,   0x92,   0xbc,   0x24,
+    0x1c,   0x03,   0xde,   0x23,   0xc2,   0xde,   0x52,   0x19,
+    0x3f,   0x3b,   0x40,   0xb1,   0x2c,   0xdd,   0x90,   0xb4,
+    0x84,   0x0e,   0x33,   0xea,   0xc3,   0x3c,   0x90,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::MINS[128] = {
+    0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,
+    0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,
+    0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x08,
+    0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,
+    0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,
+    0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,
+    0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,
+    0x0e,   0x0e,   0x0e,   0x0e,   0x03,   0x0e,   0x0e,   0x0e,
+    0x0e,   0x0e,   0x0e,   0x04,   0x03,   0x0e,   0x0e,   0x0e,
+    0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,
+    0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,
+    0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,
+    0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,
+    0x0e,   0x03,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,
+    0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,
+    0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e
+};
+
+const uint8_t DataSet_1_8u::outputs::MMINS[128] = {
+    0xfe,   0x0e,   0x0e,   0x5e,   0x0e,   0x6f,   0x16,   0x0e,
+    0x0e,   0xb0,   0xea,   0x0e,   0x71,   0x0e,   0x0e,   0xc0,
+    0x1e,   0x0e,   0x0e,   0x65,   0x0e,   0xd6,   0xa8,   0x08,
+    0x0e,   0x63,   0xfd,   0x0e,   0xab,   0x0e,   0x0e,   0x9c,
+    0x5a,   0x0e,   0x0e,   0xf6,   0x0e,   0x66,   0xc6,   0x0e,
+    0x0e,   0x98,   0xfe,   0x0e,   0xd4,   0x0e,   0x0e,   0x99,
+    0x0e,   0x0e,   0x0e,   0x21,   0x0e,   0xf3,   0xf6,   0x0e,
+    0x0e,   0x69,   0xdb,   0x0e,   0x03,   0x0e,   0x0e,   0xf5,
+    0x3d,   0x0e,   0x0e,   0x04,   0x03,   0x28,   0x53,   0x0e,
+    0x0e,   0x6d,   0xcd,   0x0e,   0xb2,   0x0e,   0x0e,   0xd8,
+    0xe3,   0x0e,   0x0e,   0x0e,   0x0e,   0x0e,   0xf4,   0x0e,
+    0x0e,   0xd7,   0x85,   0x0e,   0xa4,   0x0e,   0x0e,   0x6a,
+    0x52,   0x0e,   0x0e,   0x5b,   0x0e,   0x92,   0xbc,   0x0e,
+    0x0e,   0x03,   0xde,   0x0e,   0xc2,   0x0e,   0x0e,   0x19,
+    0x3f,   0x0e,   0x0e,   0xb1,   0x0e,   0xdd,   0x90,   0x0e,
+    0x0e,   0x0e,   0x33,   0x0e,   0xc3,   0x0e,   0x0e,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::HMAX[128] = {
+    0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,
+    0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,
+    0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,
+    0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,
+    0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,
+    0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,
+    0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,
+    0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,
+    0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,
+    0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,
+    0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,
+    0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,
+    0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,
+    0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,
+    0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,
+    0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe
+};
+
+const uint8_t DataSet_1_8u::outputs::MHMAX[128] = {
+    0x00,   0x9d,   0x9d,   0x9d,   0x9d,   0x9d,   0x9d,   0xd6,
+    0xd6,   0xd6,   0xd6,   0xd6,   0xd6,   0xe2,   0xe2,   0xe2,
+    0xe2,   0xe2,   0xe2,   0xe2,   0xe2,   0xe2,   0xe2,   0xe2,
+    0xe2,   0xe2,   0xe2,   0xe2,   0xe2,   0xe2,   0xfd,   0xfd,
+    0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,
+    0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,
+    0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,
+    0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,
+    0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,
+    0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,
+    0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,
+    0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,
+    0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,
+    0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,
+    0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,   0xfd,
+    0xfd,   0xfd,   0xfd,   0xfe,   0xfe,   0xfe,   0xfe,   0xfe
+};
+
+const uint8_t DataSet_1_8u::outputs::HMIN[128] = {
+    0xfe,   0x9d,   0x81,   0x5e,   0x5e,   0x5e,   0x16,   0x16,
+    0x16,   0x16,   0x16,   0x16,   0x16,   0x16,   0x16,   0x16,
+    0x16,   0x16,   0x16,   0x16,   0x16,   0x16,   0x16,   0x08,
+    0x08,   0x08,   0x08,   0x08,   0x08,   0x08,   0x08,   0x08,
+    0x08,   0x08,   0x08,   0x08,   0x08,   0x08,   0x08,   0x08,
+    0x08,   0x08,   0x08,   0x08,   0x08,   0x08,   0x08,   0x08,
+    0x08,   0x08,   0x08,   0x08,   0x08,   0x08,   0x08,   0x08,
+    0x08,   0x08,   0x08,   0x08,   0x03,   0x03,   0x03,   0x03,
+    0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,
+    0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,
+    0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,
+    0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,
+    0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,
+    0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,
+    0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,
+    0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03
+};
+
+const uint8_t DataSet_1_8u::outputs::MHMIN[128] = {
+    0xff,   0x9d,   0x81,   0x81,   0x63,   0x63,   0x63,   0x63,
+    0x3c,   0x3c,   0x3c,   0x3c,   0x3c,   0x3c,   0x3c,   0x3c,
+    0x3c,   0x2a,   0x2a,   0x2a,   0x2a,   0x2a,   0x2a,   0x08,
+    0x08,   0x08,   0x08,   0x08,   0x08,   0x08,   0x08,   0x08,
+    0x08,   0x08,   0x08,   0x08,   0x08,   0x08,   0x08,   0x08,
+    0x08,   0x08,   0x08,   0x08,   0x08,   0x08,   0x08,   0x08,
+    0x08,   0x08,   0x08,   0x08,   0x08,   0x08,   0x08,   0x08,
+    0x08,   0x08,   0x08,   0x08,   0x08,   0x08,   0x08,   0x08,
+    0x08,   0x08,   0x08,   0x08,   0x03,   0x03,   0x03,   0x03,
+    0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,
+    0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,
+    0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,
+    0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,
+    0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,
+    0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,
+    0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03,   0x03
+};
+
+const uint8_t DataSet_1_8u::outputs::BANDV[128] = {
+    0xe0,   0x11,   0x01,   0x10,   0x21,   0x6a,   0x10,   0x14,
+    0x04,   0xa0,   0x62,   0x06,   0x01,   0x02,   0x25,   0xc0,
+    0x16,   0x0a,   0x10,   0x25,   0x4c,   0x02,   0x28,   0x00,
+    0x01,   0x61,   0x34,   0xc0,   0x22,   0x03,   0xa0,   0x10,
+    0x18,   0x06,   0x10,   0xf2,   0x20,   0x64,   0xc2,   0x10,
+    0x0a,   0x08,   0xee,   0x21,   0x94,   0x40,   0x00,   0x81,
+    0x0a,   0x0a,   0x20,   0x00,   0xe4,   0xf1,   0xa6,   0x10,
+    0x10,   0x60,   0x53,   0x08,   0x03,   0x8a,   0x4c,   0x50,
+    0x31,   0x80,   0xa4,   0x00,   0x02,   0x28,   0x00,   0x89,
+    0x00,   0x24,   0xcd,   0x51,   0x92,   0x42,   0x01,   0x50,
+    0xa2,   0x30,   0x19,   0x04,   0x40,   0x00,   0xc4,   0x63,
+    0x72,   0x03,   0x80,   0xa2,   0xa4,   0x22,   0x45,   0x0a,
+    0x52,   0x04,   0x30,   0x0b,   0x0c,   0x90,   0xa4,   0x20,
+    0x10,   0x00,   0x98,   0x02,   0x82,   0xd2,   0x50,   0x11,
+    0x10,   0x39,   0x40,   0x01,   0x00,   0xcd,   0x10,   0xb0,
+    0x80,   0x0e,   0x20,   0xea,   0x03,   0x38,   0x80,   0x81
+};
+
+const uint8_t DataSet_1_8u::outputs::MBANDV[128] = {
+    0xfe,   0x11,   0x01,   0x5e,   0x21,   0x6f,   0x16,   0x14,
+    0x04,   0xb0,   0xea,   0x06,   0x71,   0x02,   0x25,   0xc0,
+    0x1e,   0x0a,   0x10,   0x65,   0x4c,   0xd6,   0xa8,   0x00,
+    0x01,   0x63,   0xfd,   0xc0,   0xab,   0x03,   0xa0,   0x9c,
+    0x5a,   0x06,   0x10,   0xf6,   0x20,   0x66,   0xc6,   0x10,
+    0x0a,   0x98,   0xfe,   0x21,   0xd4,   0x40,   0x00,   0x99,
+    0x0e,   0x0a,   0x20,   0x21,   0xe4,   0xf3,   0xf6,   0x10,
+    0x10,   0x69,   0xdb,   0x08,   0x03,   0x8a,   0x4c,   0xf5,
+    0x3d,   0x80,   0xa4,   0x04,   0x02,   0x28,   0x53,   0x89,
+    0x00,   0x6d,   0xcd,   0x51,   0xb2,   0x42,   0x01,   0xd8,
+    0xe3,   0x30,   0x19,   0x0e,   0x40,   0x0e,   0xf4,   0x63,
+    0x72,   0xd7,   0x85,   0xa2,   0xa4,   0x22,   0x45,   0x6a,
+    0x52,   0x04,   0x30,   0x5b,   0x0c,   0x92,   0xbc,   0x20,
+    0x10,   0x03,   0xde,   0x02,   0xc2,   0xd2,   0x50,   0x19,
+    0x3f,   0x39,   0x40,   0xb1,   0x00,   0xdd,   0x90,   0xb0,
+    0x80,   0x0e,   0x33,   0xea,   0xc3,   0x38,   0x80,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::BANDS[128] = {
+    0x0e,   0x0c,   0x00,   0x0e,   0x02,   0x0e,   0x06,   0x06,
+    0x0c,   0x00,   0x0a,   0x06,   0x00,   0x02,   0x0c,   0x00,
+    0x0e,   0x0a,   0x06,   0x04,   0x0e,   0x06,   0x08,   0x08,
+    0x02,   0x02,   0x0c,   0x02,   0x0a,   0x0a,   0x0c,   0x0c,
+    0x0a,   0x0e,   0x06,   0x06,   0x04,   0x06,   0x06,   0x00,
+    0x0a,   0x08,   0x0e,   0x0a,   0x04,   0x08,   0x08,   0x08,
+    0x0e,   0x0a,   0x02,   0x00,   0x04,   0x02,   0x06,   0x08,
+    0x08,   0x08,   0x0a,   0x08,   0x02,   0x0a,   0x0c,   0x04,
+    0x0c,   0x0a,   0x0c,   0x04,   0x02,   0x08,   0x02,   0x0c,
+    0x02,   0x0c,   0x0c,   0x04,   0x02,   0x02,   0x04,   0x08,
+    0x02,   0x08,   0x08,   0x0e,   0x00,   0x0e,   0x04,   0x0a,
+    0x02,   0x06,   0x04,   0x02,   0x04,   0x02,   0x0e,   0x0a,
+    0x02,   0x0c,   0x00,   0x0a,   0x0c,   0x02,   0x0c,   0x08,
+    0x00,   0x02,   0x0e,   0x02,   0x02,   0x0e,   0x02,   0x08,
+    0x0e,   0x0a,   0x06,   0x00,   0x02,   0x0c,   0x00,   0x00,
+    0x04,   0x0e,   0x02,   0x0e,   0x02,   0x0c,   0x02,   0x02
+};
+
+const uint8_t DataSet_1_8u::outputs::MBANDS[128] = {
+    0xfe,   0x0c,   0x00,   0x5e,   0x02,   0x6f,   0x16,   0x06,
+    0x0c,   0xb0,   0xea,   0x06,   0x71,   0x02,   0x0c,   0xc0,
+    0x1e,   0x0a,   0x06,   0x65,   0x0e,   0xd6,   0xa8,   0x08,
+    0x02,   0x63,   0xfd,   0x02,   0xab,   0x0a,   0x0c,   0x9c,
+    0x5a,   0x0e,   0x06,   0xf6,   0x04,   0x66,   0xc6,   0x00,
+    0x0a,   0x98,   0xfe,   0x0a,   0xd4,   0x08,   0x08,   0x99,
+    0x0e,   0x0a,   0x02,   0x21,   0x04,   0xf3,   0xf6,   0x08,
+    0x08,   0x69,   0xdb,   0x08,   0x03,   0x0a,   0x0c,   0xf5,
+    0x3d,   0x0a,   0x0c,   0x04,   0x02,   0x28,   0x53,   0x0c,
+    0x02,   0x6d,   0xcd,   0x04,   0xb2,   0x02,   0x04,   0xd8,
+    0xe3,   0x08,   0x08,   0x0e,   0x00,   0x0e,   0xf4,   0x0a,
+    0x02,   0xd7,   0x85,   0x02,   0xa4,   0x02,   0x0e,   0x6a,
+    0x52,   0x0c,   0x00,   0x5b,   0x0c,   0x92,   0xbc,   0x08,
+    0x00,   0x03,   0xde,   0x02,   0xc2,   0x0e,   0x02,   0x19,
+    0x3f,   0x0a,   0x06,   0xb1,   0x02,   0xdd,   0x90,   0x00,
+    0x04,   0x0e,   0x33,   0x0e,   0xc3,   0x0c,   0x02,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::BORV[128] = {
+    0xfe,   0xff,   0x8b,   0xde,   0xe3,   0xff,   0xd6,   0xf7,
+    0x3e,   0xb9,   0xea,   0xa6,   0x7d,   0xf2,   0x3d,   0xd6,
+    0x9e,   0x7f,   0x7f,   0x6f,   0xdf,   0xf7,   0xfa,   0x5a,
+    0xb3,   0xff,   0xff,   0xc6,   0xef,   0xeb,   0xff,   0x9e,
+    0x7a,   0xfe,   0xff,   0xfe,   0x35,   0xee,   0xdf,   0x5b,
+    0x7f,   0xdb,   0xfe,   0x7f,   0xde,   0xc8,   0xfd,   0xb9,
+    0xcf,   0x7f,   0xf6,   0xb3,   0xff,   0xfb,   0xff,   0xd9,
+    0xfb,   0xef,   0xdb,   0x6d,   0xf3,   0xdb,   0xcf,   0xff,
+    0xbd,   0xfb,   0xff,   0xd7,   0x33,   0xbd,   0xdf,   0xcd,
+    0x7f,   0xfd,   0xcf,   0xf7,   0xba,   0xc7,   0xbd,   0xfd,
+    0xff,   0x3d,   0xdb,   0xde,   0x7b,   0x0f,   0xfc,   0xeb,
+    0x7b,   0xd7,   0x87,   0xe3,   0xb7,   0xe2,   0xcf,   0x6b,
+    0x76,   0xff,   0x36,   0xfb,   0x2d,   0xb7,   0xbc,   0x3d,
+    0x3c,   0xa7,   0xfe,   0xb3,   0xc6,   0xff,   0xf3,   0x9b,
+    0xbf,   0x7b,   0xe6,   0xfd,   0xaf,   0xdd,   0xf4,   0xf4,
+    0xae,   0xef,   0xbf,   0xfe,   0xf3,   0xff,   0xb3,   0xbb
+};
+
+const uint8_t DataSet_1_8u::outputs::MBORV[128] = {
+    0xfe,   0xff,   0x8b,   0x5e,   0xe3,   0x6f,   0x16,   0xf7,
+    0x3e,   0xb0,   0xea,   0xa6,   0x71,   0xf2,   0x3d,   0xc0,
+    0x1e,   0x7f,   0x7f,   0x65,   0xdf,   0xd6,   0xa8,   0x5a,
+    0xb3,   0x63,   0xfd,   0xc6,   0xab,   0xeb,   0xff,   0x9c,
+    0x5a,   0xfe,   0xff,   0xf6,   0x35,   0x66,   0xc6,   0x5b,
+    0x7f,   0x98,   0xfe,   0x7f,   0xd4,   0xc8,   0xfd,   0x99,
+    0x0e,   0x7f,   0xf6,   0x21,   0xff,   0xf3,   0xf6,   0xd9,
+    0xfb,   0x69,   0xdb,   0x6d,   0x03,   0xdb,   0xcf,   0xf5,
+    0x3d,   0xfb,   0xff,   0x04,   0x33,   0x28,   0x53,   0xcd,
+    0x7f,   0x6d,   0xcd,   0xf7,   0xb2,   0xc7,   0xbd,   0xd8,
+    0xe3,   0x3d,   0xdb,   0x0e,   0x7b,   0x0e,   0xf4,   0xeb,
+    0x7b,   0xd7,   0x85,   0xe3,   0xa4,   0xe2,   0xcf,   0x6a,
+    0x52,   0xff,   0x36,   0x5b,   0x2d,   0x92,   0xbc,   0x3d,
+    0x3c,   0x03,   0xde,   0xb3,   0xc2,   0xff,   0xf3,   0x19,
+    0x3f,   0x7b,   0xe6,   0xb1,   0xaf,   0xdd,   0x90,   0xf4,
+    0xae,   0x0e,   0x33,   0xfe,   0xc3,   0xff,   0xb3,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::BORS[128] = {
+    0xfe,   0x9f,   0x8f,   0x5e,   0x6f,   0x6f,   0x1e,   0xde,
+    0x3e,   0xbe,   0xee,   0xae,   0x7f,   0xee,   0x3f,   0xce,
+    0x1e,   0x2e,   0x7f,   0x6f,   0xcf,   0xde,   0xae,   0x0e,
+    0x1f,   0x6f,   0xff,   0xce,   0xaf,   0x6f,   0xff,   0x9e,
+    0x5e,   0x6e,   0x3e,   0xfe,   0x3e,   0x6e,   0xce,   0x5e,
+    0x2e,   0x9e,   0xfe,   0x2f,   0xde,   0x4e,   0x3f,   0x9f,
+    0x0e,   0x5f,   0x6e,   0x2f,   0xff,   0xff,   0xfe,   0x5e,
+    0xbe,   0x6f,   0xdf,   0x6f,   0x0f,   0x8e,   0x4f,   0xff,
+    0x3f,   0x8e,   0xbe,   0x0e,   0x0f,   0x2e,   0x5f,   0x8f,
+    0x1f,   0x6f,   0xcf,   0xdf,   0xbe,   0xcf,   0xbf,   0xde,
+    0xef,   0x3e,   0x9f,   0x0e,   0x6e,   0x0e,   0xfe,   0xef,
+    0x7f,   0xdf,   0x8f,   0xaf,   0xae,   0x2e,   0x4f,   0x6e,
+    0x5e,   0xee,   0x3e,   0x5f,   0x2f,   0x9e,   0xbe,   0x3f,
+    0x3e,   0x0f,   0xde,   0x2f,   0xce,   0xde,   0x5e,   0x1f,
+    0x3f,   0x3f,   0xee,   0xbf,   0x8f,   0xdf,   0x9e,   0xfe,
+    0x8e,   0x0e,   0x3f,   0xfe,   0xcf,   0x3e,   0xaf,   0xbf
+};
+
+const uint8_t DataSet_1_8u::outputs::MBORS[128] = {
+    0xfe,   0x9f,   0x8f,   0x5e,   0x6f,   0x6f,   0x16,   0xde,
+    0x3e,   0xb0,   0xea,   0xae,   0x71,   0xee,   0x3f,   0xc0,
+    0x1e,   0x2e,   0x7f,   0x65,   0xcf,   0xd6,   0xa8,   0x0e,
+    0x1f,   0x63,   0xfd,   0xce,   0xab,   0x6f,   0xff,   0x9c,
+    0x5a,   0x6e,   0x3e,   0xf6,   0x3e,   0x66,   0xc6,   0x5e,
+    0x2e,   0x98,   0xfe,   0x2f,   0xd4,   0x4e,   0x3f,   0x99,
+    0x0e,   0x5f,   0x6e,   0x21,   0xff,   0xf3,   0xf6,   0x5e,
+    0xbe,   0x69,   0xdb,   0x6f,   0x03,   0x8e,   0x4f,   0xf5,
+    0x3d,   0x8e,   0xbe,   0x04,   0x0f,   0x28,   0x53,   0x8f,
+    0x1f,   0x6d,   0xcd,   0xdf,   0xb2,   0xcf,   0xbf,   0xd8,
+    0xe3,   0x3e,   0x9f,   0x0e,   0x6e,   0x0e,   0xf4,   0xef,
+    0x7f,   0xd7,   0x85,   0xaf,   0xa4,   0x2e,   0x4f,   0x6a,
+    0x52,   0xee,   0x3e,   0x5b,   0x2f,   0x92,   0xbc,   0x3f,
+    0x3e,   0x03,   0xde,   0x2f,   0xc2,   0xde,   0x5e,   0x19,
+    0x3f,   0x3f,   0xee,   0xb1,   0x8f,   0xdd,   0x90,   0xfe,
+    0x8e,   0x0e,   0x33,   0xfe,   0xc3,   0x3e,   0xaf,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::BXORV[128] = {
+    0x1e,   0xee,   0x8a,   0xce,   0xc2,   0x95,   0xc6,   0xe3,
+    0x3a,   0x19,   0x88,   0xa0,   0x7c,   0xf0,   0x18,   0x16,
+    0x88,   0x75,   0x6f,   0x4a,   0x93,   0xf5,   0xd2,   0x5a,
+    0xb2,   0x9e,   0xcb,   0x06,   0xcd,   0xe8,   0x5f,   0x8e,
+    0x62,   0xf8,   0xef,   0x0c,   0x15,   0x8a,   0x1d,   0x4b,
+    0x75,   0xd3,   0x10,   0x5e,   0x4a,   0x88,   0xfd,   0x38,
+    0xc5,   0x75,   0xd6,   0xb3,   0x1b,   0x0a,   0x59,   0xc9,
+    0xeb,   0x8f,   0x88,   0x65,   0xf0,   0x51,   0x83,   0xaf,
+    0x8c,   0x7b,   0x5b,   0xd7,   0x31,   0x95,   0xdf,   0x44,
+    0x7f,   0xd9,   0x02,   0xa6,   0x28,   0x85,   0xbc,   0xad,
+    0x5d,   0x0d,   0xc2,   0xda,   0x3b,   0x0f,   0x38,   0x88,
+    0x09,   0xd4,   0x07,   0x41,   0x13,   0xc0,   0x8a,   0x61,
+    0x24,   0xfb,   0x06,   0xf0,   0x21,   0x27,   0x18,   0x1d,
+    0x2c,   0xa7,   0x66,   0xb1,   0x44,   0x2d,   0xa3,   0x8a,
+    0xaf,   0x42,   0xa6,   0xfc,   0xaf,   0x10,   0xe4,   0x44,
+    0x2e,   0xe1,   0x9f,   0x14,   0xf0,   0xc7,   0x33,   0x3a
+};
+
+const uint8_t DataSet_1_8u::outputs::MBXORV[128] = {
+    0xfe,   0xee,   0x8a,   0x5e,   0xc2,   0x6f,   0x16,   0xe3,
+    0x3a,   0xb0,   0xea,   0xa0,   0x71,   0xf0,   0x18,   0xc0,
+    0x1e,   0x75,   0x6f,   0x65,   0x93,   0xd6,   0xa8,   0x5a,
+    0xb2,   0x63,   0xfd,   0x06,   0xab,   0xe8,   0x5f,   0x9c,
+    0x5a,   0xf8,   0xef,   0xf6,   0x15,   0x66,   0xc6,   0x4b,
+    0x75,   0x98,   0xfe,   0x5e,   0xd4,   0x88,   0xfd,   0x99,
+    0x0e,   0x75,   0xd6,   0x21,   0x1b,   0xf3,   0xf6,   0xc9,
+    0xeb,   0x69,   0xdb,   0x65,   0x03,   0x51,   0x83,   0xf5,
+    0x3d,   0x7b,   0x5b,   0x04,   0x31,   0x28,   0x53,   0x44,
+    0x7f,   0x6d,   0xcd,   0xa6,   0xb2,   0x85,   0xbc,   0xd8,
+    0xe3,   0x0d,   0xc2,   0x0e,   0x3b,   0x0e,   0xf4,   0x88,
+    0x09,   0xd7,   0x85,   0x41,   0xa4,   0xc0,   0x8a,   0x6a,
+    0x52,   0xfb,   0x06,   0x5b,   0x21,   0x92,   0xbc,   0x1d,
+    0x2c,   0x03,   0xde,   0xb1,   0xc2,   0x2d,   0xa3,   0x19,
+    0x3f,   0x42,   0xa6,   0xb1,   0xaf,   0xdd,   0x90,   0x44,
+    0x2e,   0x0e,   0x33,   0x14,   0xc3,   0xc7,   0x33,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::BXORS[128] = {
+    0xf0,   0x93,   0x8f,   0x50,   0x6d,   0x61,   0x18,   0xd8,
+    0x32,   0xbe,   0xe4,   0xa8,   0x7f,   0xec,   0x33,   0xce,
+    0x10,   0x24,   0x79,   0x6b,   0xc1,   0xd8,   0xa6,   0x06,
+    0x1d,   0x6d,   0xf3,   0xcc,   0xa5,   0x65,   0xf3,   0x92,
+    0x54,   0x60,   0x38,   0xf8,   0x3a,   0x68,   0xc8,   0x5e,
+    0x24,   0x96,   0xf0,   0x25,   0xda,   0x46,   0x37,   0x97,
+    0x00,   0x55,   0x6c,   0x2f,   0xfb,   0xfd,   0xf8,   0x56,
+    0xb6,   0x67,   0xd5,   0x67,   0x0d,   0x84,   0x43,   0xfb,
+    0x33,   0x84,   0xb2,   0x0a,   0x0d,   0x26,   0x5d,   0x83,
+    0x1d,   0x63,   0xc3,   0xdb,   0xbc,   0xcd,   0xbb,   0xd6,
+    0xed,   0x36,   0x97,   0x00,   0x6e,   0x00,   0xfa,   0xe5,
+    0x7d,   0xd9,   0x8b,   0xad,   0xaa,   0x2c,   0x41,   0x64,
+    0x5c,   0xe2,   0x3e,   0x55,   0x23,   0x9c,   0xb2,   0x37,
+    0x3e,   0x0d,   0xd0,   0x2d,   0xcc,   0xd0,   0x5c,   0x17,
+    0x31,   0x35,   0xe8,   0xbf,   0x8d,   0xd3,   0x9e,   0xfe,
+    0x8a,   0x00,   0x3d,   0xf0,   0xcd,   0x32,   0xad,   0xbd
+};
+
+const uint8_t DataSet_1_8u::outputs::MBXORS[128] = {
+    0xfe,   0x93,   0x8f,   0x5e,   0x6d,   0x6f,   0x16,   0xd8,
+    0x32,   0xb0,   0xea,   0xa8,   0x71,   0xec,   0x33,   0xc0,
+    0x1e,   0x24,   0x79,   0x65,   0xc1,   0xd6,   0xa8,   0x06,
+    0x1d,   0x63,   0xfd,   0xcc,   0xab,   0x65,   0xf3,   0x9c,
+    0x5a,   0x60,   0x38,   0xf6,   0x3a,   0x66,   0xc6,   0x5e,
+    0x24,   0x98,   0xfe,   0x25,   0xd4,   0x46,   0x37,   0x99,
+    0x0e,   0x55,   0x6c,   0x21,   0xfb,   0xf3,   0xf6,   0x56,
+    0xb6,   0x69,   0xdb,   0x67,   0x03,   0x84,   0x43,   0xf5,
+    0x3d,   0x84,   0xb2,   0x04,   0x0d,   0x28,   0x53,   0x83,
+    0x1d,   0x6d,   0xcd,   0xdb,   0xb2,   0xcd,   0xbb,   0xd8,
+    0xe3,   0x36,   0x97,   0x0e,   0x6e,   0x0e,   0xf4,   0xe5,
+    0x7d,   0xd7,   0x85,   0xad,   0xa4,   0x2c,   0x41,   0x6a,
+    0x52,   0xe2,   0x3e,   0x5b,   0x23,   0x92,   0xbc,   0x37,
+    0x3e,   0x03,   0xde,   0x2d,   0xc2,   0xd0,   0x5c,   0x19,
+    0x3f,   0x35,   0xe8,   0xb1,   0x8d,   0xdd,   0x90,   0xfe,
+    0x8a,   0x0e,   0x33,   0xf0,   0xc3,   0x32,   0xad,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::BNOT[128] = {
+    0x01,   0x62,   0x7e,   0xa1,   0x9c,   0x90,   0xe9,   0x29,
+    0xc3,   0x4f,   0x15,   0x59,   0x8e,   0x1d,   0xc2,   0x3f,
+    0xe1,   0xd5,   0x88,   0x9a,   0x30,   0x29,   0x57,   0xf7,
+    0xec,   0x9c,   0x02,   0x3d,   0x54,   0x94,   0x02,   0x63,
+    0xa5,   0x91,   0xc9,   0x09,   0xcb,   0x99,   0x39,   0xaf,
+    0xd5,   0x67,   0x01,   0xd4,   0x2b,   0xb7,   0xc6,   0x66,
+    0xf1,   0xa4,   0x9d,   0xde,   0x0a,   0x0c,   0x09,   0xa7,
+    0x47,   0x96,   0x24,   0x96,   0xfc,   0x75,   0xb2,   0x0a,
+    0xc2,   0x75,   0x43,   0xfb,   0xfc,   0xd7,   0xac,   0x72,
+    0xec,   0x92,   0x32,   0x2a,   0x4d,   0x3c,   0x4a,   0x27,
+    0x1c,   0xc7,   0x66,   0xf1,   0x9f,   0xf1,   0x0b,   0x14,
+    0x8c,   0x28,   0x7a,   0x5c,   0x5b,   0xdd,   0xb0,   0x95,
+    0xad,   0x13,   0xcf,   0xa4,   0xd2,   0x6d,   0x43,   0xc6,
+    0xcf,   0xfc,   0x21,   0xdc,   0x3d,   0x21,   0xad,   0xe6,
+    0xc0,   0xc4,   0x19,   0x4e,   0x7c,   0x22,   0x6f,   0x0f,
+    0x7b,   0xf1,   0xcc,   0x01,   0x3c,   0xc3,   0x5c,   0x4c
+};
+
+const uint8_t DataSet_1_8u::outputs::MBNOT[128] = {
+    0xfe,   0x62,   0x7e,   0x5e,   0x9c,   0x6f,   0x16,   0x29,
+    0xc3,   0xb0,   0xea,   0x59,   0x71,   0x1d,   0xc2,   0xc0,
+    0x1e,   0xd5,   0x88,   0x65,   0x30,   0xd6,   0xa8,   0xf7,
+    0xec,   0x63,   0xfd,   0x3d,   0xab,   0x94,   0x02,   0x9c,
+    0x5a,   0x91,   0xc9,   0xf6,   0xcb,   0x66,   0xc6,   0xaf,
+    0xd5,   0x98,   0xfe,   0xd4,   0xd4,   0xb7,   0xc6,   0x99,
+    0x0e,   0xa4,   0x9d,   0x21,   0x0a,   0xf3,   0xf6,   0xa7,
+    0x47,   0x69,   0xdb,   0x96,   0x03,   0x75,   0xb2,   0xf5,
+    0x3d,   0x75,   0x43,   0x04,   0xfc,   0x28,   0x53,   0x72,
+    0xec,   0x6d,   0xcd,   0x2a,   0xb2,   0x3c,   0x4a,   0xd8,
+    0xe3,   0xc7,   0x66,   0x0e,   0x9f,   0x0e,   0xf4,   0x14,
+    0x8c,   0xd7,   0x85,   0x5c,   0xa4,   0xdd,   0xb0,   0x6a,
+    0x52,   0x13,   0xcf,   0x5b,   0xd2,   0x92,   0xbc,   0xc6,
+    0xcf,   0x03,   0xde,   0xdc,   0xc2,   0x21,   0xad,   0x19,
+    0x3f,   0xc4,   0x19,   0xb1,   0x7c,   0xdd,   0x90,   0x0f,
+    0x7b,   0x0e,   0x33,   0x01,   0xc3,   0xc3,   0x5c,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::HBAND[128] = {
+    0xfe,   0x9c,   0x80,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00
+};
+
+const uint8_t DataSet_1_8u::outputs::MHBAND[128] = {
+    0xff,   0x9d,   0x81,   0x81,   0x01,   0x01,   0x01,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00
+};
+
+const uint8_t DataSet_1_8u::outputs::HBANDS[128] = {
+    0x0e,   0x0c,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00
+};
+
+const uint8_t DataSet_1_8u::outputs::MHBANDS[128] = {
+    0x0e,   0x0c,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,
+    0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00,   0x00
+};
+
+const uint8_t DataSet_1_8u::outputs::HBOR[128] = {
+    0xfe,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff
+};
+
+const uint8_t DataSet_1_8u::outputs::MHBOR[128] = {
+    0x00,   0x9d,   0x9d,   0x9d,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff
+};
+
+const uint8_t DataSet_1_8u::outputs::HBORS[128] = {
+    0xfe,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff
+};
+
+const uint8_t DataSet_1_8u::outputs::MHBORS[128] = {
+    0x0e,   0x9f,   0x9f,   0x9f,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,
+    0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff,   0xff
+};
+
+const uint8_t DataSet_1_8u::outputs::HBXOR[128] = {
+    0xfe,   0x63,   0xe2,   0xbc,   0xdf,   0xb0,   0xa6,   0x70,
+    0x4c,   0xfc,   0x16,   0xb0,   0xc1,   0x23,   0x1e,   0xde,
+    0xc0,   0xea,   0x9d,   0xf8,   0x37,   0xe1,   0x49,   0x41,
+    0x52,   0x31,   0xcc,   0x0e,   0xa5,   0xce,   0x33,   0xaf,
+    0xf5,   0x9b,   0xad,   0x5b,   0x6f,   0x09,   0xcf,   0x9f,
+    0xb5,   0x2d,   0xd3,   0xf8,   0x2c,   0x64,   0x5d,   0xc4,
+    0xca,   0x91,   0xf3,   0xd2,   0x27,   0xd4,   0x22,   0x7a,
+    0xc2,   0xab,   0x70,   0x19,   0x1a,   0x90,   0xdd,   0x28,
+    0x15,   0x9f,   0x23,   0x27,   0x24,   0x0c,   0x5f,   0xd2,
+    0xc1,   0xac,   0x61,   0xb4,   0x06,   0xc5,   0x70,   0xa8,
+    0x4b,   0x73,   0xea,   0xe4,   0x84,   0x8a,   0x7e,   0x95,
+    0xe6,   0x31,   0xb4,   0x17,   0xb3,   0x91,   0xde,   0xb4,
+    0xe6,   0x0a,   0x3a,   0x61,   0x4c,   0xde,   0x62,   0x5b,
+    0x6b,   0x68,   0xb6,   0x95,   0x57,   0x89,   0xdb,   0xc2,
+    0xfd,   0xc6,   0x20,   0x91,   0x12,   0xcf,   0x5f,   0xaf,
+    0x2b,   0x25,   0x16,   0xe8,   0x2b,   0x17,   0xb4,   0x07
+};
+
+const uint8_t DataSet_1_8u::outputs::MHBXOR[128] = {
+    0x00,   0x9d,   0x1c,   0x1c,   0x7f,   0x7f,   0x7f,   0xa9,
+    0x95,   0x95,   0x95,   0x33,   0x33,   0xd1,   0xec,   0xec,
+    0xec,   0xc6,   0xb1,   0xb1,   0x7e,   0x7e,   0x7e,   0x76,
+    0x65,   0x65,   0x65,   0xa7,   0xa7,   0xcc,   0x31,   0x31,
+    0x31,   0x5f,   0x69,   0x69,   0x5d,   0x5d,   0x5d,   0x0d,
+    0x27,   0x27,   0x27,   0x0c,   0x0c,   0x44,   0x7d,   0x7d,
+    0x7d,   0x26,   0x44,   0x44,   0xb1,   0xb1,   0xb1,   0xe9,
+    0x51,   0x51,   0x51,   0x38,   0x38,   0xb2,   0xff,   0xff,
+    0xff,   0x75,   0xc9,   0xc9,   0xca,   0xca,   0xca,   0x47,
+    0x54,   0x54,   0x54,   0x81,   0x81,   0x42,   0xf7,   0xf7,
+    0xf7,   0xcf,   0x56,   0x56,   0x36,   0x36,   0x36,   0xdd,
+    0xae,   0xae,   0xae,   0x0d,   0x0d,   0x2f,   0x60,   0x60,
+    0x60,   0x8c,   0xbc,   0xbc,   0x91,   0x91,   0x91,   0xa8,
+    0x98,   0x98,   0x98,   0xbb,   0xbb,   0x65,   0x37,   0x37,
+    0x37,   0x0c,   0xea,   0xea,   0x69,   0x69,   0x69,   0x99,
+    0x1d,   0x1d,   0x1d,   0xe3,   0xe3,   0xdf,   0x7c,   0x7c
+};
+
+const uint8_t DataSet_1_8u::outputs::HBXORS[128] = {
+    0xf0,   0x6d,   0xec,   0xb2,   0xd1,   0xbe,   0xa8,   0x7e,
+    0x42,   0xf2,   0x18,   0xbe,   0xcf,   0x2d,   0x10,   0xd0,
+    0xce,   0xe4,   0x93,   0xf6,   0x39,   0xef,   0x47,   0x4f,
+    0x5c,   0x3f,   0xc2,   0x00,   0xab,   0xc0,   0x3d,   0xa1,
+    0xfb,   0x95,   0xa3,   0x55,   0x61,   0x07,   0xc1,   0x91,
+    0xbb,   0x23,   0xdd,   0xf6,   0x22,   0x6a,   0x53,   0xca,
+    0xc4,   0x9f,   0xfd,   0xdc,   0x29,   0xda,   0x2c,   0x74,
+    0xcc,   0xa5,   0x7e,   0x17,   0x14,   0x9e,   0xd3,   0x26,
+    0x1b,   0x91,   0x2d,   0x29,   0x2a,   0x02,   0x51,   0xdc,
+    0xcf,   0xa2,   0x6f,   0xba,   0x08,   0xcb,   0x7e,   0xa6,
+    0x45,   0x7d,   0xe4,   0xea,   0x8a,   0x84,   0x70,   0x9b,
+    0xe8,   0x3f,   0xba,   0x19,   0xbd,   0x9f,   0xd0,   0xba,
+    0xe8,   0x04,   0x34,   0x6f,   0x42,   0xd0,   0x6c,   0x55,
+    0x65,   0x66,   0xb8,   0x9b,   0x59,   0x87,   0xd5,   0xcc,
+    0xf3,   0xc8,   0x2e,   0x9f,   0x1c,   0xc1,   0x51,   0xa1,
+    0x25,   0x2b,   0x18,   0xe6,   0x25,   0x19,   0xba,   0x09
+};
+
+const uint8_t DataSet_1_8u::outputs::MHBXORS[128] = {
+    0x0e,   0x93,   0x12,   0x12,   0x71,   0x71,   0x71,   0xa7,
+    0x9b,   0x9b,   0x9b,   0x3d,   0x3d,   0xdf,   0xe2,   0xe2,
+    0xe2,   0xc8,   0xbf,   0xbf,   0x70,   0x70,   0x70,   0x78,
+    0x6b,   0x6b,   0x6b,   0xa9,   0xa9,   0xc2,   0x3f,   0x3f,
+    0x3f,   0x51,   0x67,   0x67,   0x53,   0x53,   0x53,   0x03,
+    0x29,   0x29,   0x29,   0x02,   0x02,   0x4a,   0x73,   0x73,
+    0x73,   0x28,   0x4a,   0x4a,   0xbf,   0xbf,   0xbf,   0xe7,
+    0x5f,   0x5f,   0x5f,   0x36,   0x36,   0xbc,   0xf1,   0xf1,
+    0xf1,   0x7b,   0xc7,   0xc7,   0xc4,   0xc4,   0xc4,   0x49,
+    0x5a,   0x5a,   0x5a,   0x8f,   0x8f,   0x4c,   0xf9,   0xf9,
+    0xf9,   0xc1,   0x58,   0x58,   0x38,   0x38,   0x38,   0xd3,
+    0xa0,   0xa0,   0xa0,   0x03,   0x03,   0x21,   0x6e,   0x6e,
+    0x6e,   0x82,   0xb2,   0xb2,   0x9f,   0x9f,   0x9f,   0xa6,
+    0x96,   0x96,   0x96,   0xb5,   0xb5,   0x6b,   0x39,   0x39,
+    0x39,   0x02,   0xe4,   0xe4,   0x67,   0x67,   0x67,   0x97,
+    0x13,   0x13,   0x13,   0xed,   0xed,   0xd1,   0x72,   0x72
+};
+
+const uint8_t DataSet_1_8u::outputs::LSHV[128] = {
+    0x00,   0xa0,   0x08,   0xf0,   0x18,   0x78,   0x00,   0x00,
+    0x00,   0xc0,   0xd4,   0x98,   0x40,   0xc4,   0xa0,   0x00,
+    0x3c,   0xa8,   0xdc,   0x94,   0x78,   0x00,   0xa0,   0x40,
+    0x60,   0x30,   0x80,   0x10,   0xb0,   0x58,   0x80,   0x38,
+    0x80,   0xdc,   0xd8,   0xd8,   0x40,   0xc0,   0x60,   0x00,
+    0x00,   0xc0,   0xf8,   0x60,   0x50,   0x40,   0x80,   0x20,
+    0x70,   0x80,   0x10,   0x20,   0xa0,   0x30,   0xb0,   0xb0,
+    0xc0,   0x40,   0xd8,   0x80,   0x80,   0xa0,   0x9a,   0x50,
+    0x40,   0x50,   0x78,   0x40,   0x06,   0x00,   0x80,   0xd0,
+    0x4c,   0x68,   0x9a,   0xa8,   0x00,   0x80,   0x50,   0x00,
+    0x80,   0x70,   0x32,   0xc0,   0x00,   0x1c,   0x00,   0x60,
+    0x60,   0xc0,   0xa0,   0x18,   0x20,   0x80,   0xf0,   0x80,
+    0x40,   0x80,   0x00,   0xd8,   0xb4,   0x24,   0x00,   0xe4,
+    0x00,   0x06,   0x78,   0x80,   0x10,   0xc0,   0x40,   0x80,
+    0xfc,   0xec,   0x98,   0x40,   0xc0,   0x40,   0x00,   0xe0,
+    0x40,   0xc0,   0x66,   0xe0,   0x80,   0xf0,   0x60,   0x80
+};
+
+const uint8_t DataSet_1_8u::outputs::MLSHV[128] = {
+    0xfe,   0xa0,   0x08,   0x5e,   0x18,   0x6f,   0x16,   0x00,
+    0x00,   0xb0,   0xea,   0x98,   0x71,   0xc4,   0xa0,   0xc0,
+    0x1e,   0xa8,   0xdc,   0x65,   0x78,   0xd6,   0xa8,   0x40,
+    0x60,   0x63,   0xfd,   0x10,   0xab,   0x58,   0x80,   0x9c,
+    0x5a,   0xdc,   0xd8,   0xf6,   0x40,   0x66,   0xc6,   0x00,
+    0x00,   0x98,   0xfe,   0x60,   0xd4,   0x40,   0x80,   0x99,
+    0x0e,   0x80,   0x10,   0x21,   0xa0,   0xf3,   0xf6,   0xb0,
+    0xc0,   0x69,   0xdb,   0x80,   0x03,   0xa0,   0x9a,   0xf5,
+    0x3d,   0x50,   0x78,   0x04,   0x06,   0x28,   0x53,   0xd0,
+    0x4c,   0x6d,   0xcd,   0xa8,   0xb2,   0x80,   0x50,   0xd8,
+    0xe3,   0x70,   0x32,   0x0e,   0x00,   0x0e,   0xf4,   0x60,
+    0x60,   0xd7,   0x85,   0x18,   0xa4,   0x80,   0xf0,   0x6a,
+    0x52,   0x80,   0x00,   0x5b,   0xb4,   0x92,   0xbc,   0xe4,
+    0x00,   0x03,   0xde,   0x80,   0xc2,   0xc0,   0x40,   0x19,
+    0x3f,   0xec,   0x98,   0xb1,   0xc0,   0xdd,   0x90,   0xe0,
+    0x40,   0x0e,   0x33,   0xe0,   0xc3,   0xf0,   0x60,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::LSHS[128] = {
+    0xf0,   0xe8,   0x08,   0xf0,   0x18,   0x78,   0xb0,   0xb0,
+    0xe0,   0x80,   0x50,   0x30,   0x88,   0x10,   0xe8,   0x00,
+    0xf0,   0x50,   0xb8,   0x28,   0x78,   0xb0,   0x40,   0x40,
+    0x98,   0x18,   0xe8,   0x10,   0x58,   0x58,   0xe8,   0xe0,
+    0xd0,   0x70,   0xb0,   0xb0,   0xa0,   0x30,   0x30,   0x80,
+    0x50,   0xc0,   0xf0,   0x58,   0xa0,   0x40,   0xc8,   0xc8,
+    0x70,   0xd8,   0x10,   0x08,   0xa8,   0x98,   0xb0,   0xc0,
+    0xc0,   0x48,   0xd8,   0x48,   0x18,   0x50,   0x68,   0xa8,
+    0xe8,   0x50,   0xe0,   0x20,   0x18,   0x40,   0x98,   0x68,
+    0x98,   0x68,   0x68,   0xa8,   0x90,   0x18,   0xa8,   0xc0,
+    0x18,   0xc0,   0xc8,   0x70,   0x00,   0x70,   0xa0,   0x58,
+    0x98,   0xb8,   0x28,   0x18,   0x20,   0x10,   0x78,   0x50,
+    0x90,   0x60,   0x80,   0xd8,   0x68,   0x90,   0xe0,   0xc8,
+    0x80,   0x18,   0xf0,   0x18,   0x10,   0xf0,   0x90,   0xc8,
+    0xf8,   0xd8,   0x30,   0x88,   0x18,   0xe8,   0x80,   0x80,
+    0x20,   0x70,   0x98,   0xf0,   0x18,   0xe0,   0x18,   0x98
+};
+
+const uint8_t DataSet_1_8u::outputs::MLSHS[128] = {
+    0xfe,   0xe8,   0x08,   0x5e,   0x18,   0x6f,   0x16,   0xb0,
+    0xe0,   0xb0,   0xea,   0x30,   0x71,   0x10,   0xe8,   0xc0,
+    0x1e,   0x50,   0xb8,   0x65,   0x78,   0xd6,   0xa8,   0x40,
+    0x98,   0x63,   0xfd,   0x10,   0xab,   0x58,   0xe8,   0x9c,
+    0x5a,   0x70,   0xb0,   0xf6,   0xa0,   0x66,   0xc6,   0x80,
+    0x50,   0x98,   0xfe,   0x58,   0xd4,   0x40,   0xc8,   0x99,
+    0x0e,   0xd8,   0x10,   0x21,   0xa8,   0xf3,   0xf6,   0xc0,
+    0xc0,   0x69,   0xdb,   0x48,   0x03,   0x50,   0x68,   0xf5,
+    0x3d,   0x50,   0xe0,   0x04,   0x18,   0x28,   0x53,   0x68,
+    0x98,   0x6d,   0xcd,   0xa8,   0xb2,   0x18,   0xa8,   0xd8,
+    0xe3,   0xc0,   0xc8,   0x0e,   0x00,   0x0e,   0xf4,   0x58,
+    0x98,   0xd7,   0x85,   0x18,   0xa4,   0x10,   0x78,   0x6a,
+    0x52,   0x60,   0x80,   0x5b,   0x68,   0x92,   0xbc,   0xc8,
+    0x80,   0x03,   0xde,   0x18,   0xc2,   0xf0,   0x90,   0x19,
+    0x3f,   0xd8,   0x30,   0xb1,   0x18,   0xdd,   0x90,   0x80,
+    0x20,   0x0e,   0x33,   0xf0,   0xc3,   0xe0,   0x18,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::RSHV[128] = {
+    0x01,   0x04,   0x10,   0x0b,   0x0c,   0x0d,   0x00,   0x01,
+    0x00,   0x2c,   0x75,   0x29,   0x01,   0x71,   0x01,   0x06,
+    0x0f,   0x0a,   0x1d,   0x19,   0x19,   0x01,   0x2a,   0x01,
+    0x00,   0x06,   0x01,   0x18,   0x0a,   0x0d,   0x01,   0x4e,
+    0x01,   0x37,   0x0d,   0x3d,   0x03,   0x03,   0x0c,   0x00,
+    0x00,   0x13,   0x3f,   0x01,   0x35,   0x09,   0x00,   0x04,
+    0x01,   0x00,   0x0c,   0x01,   0x07,   0x0f,   0x1e,   0x2c,
+    0x17,   0x01,   0x1b,   0x00,   0x00,   0x08,   0x26,   0x0f,
+    0x00,   0x11,   0x5e,   0x00,   0x01,   0x00,   0x00,   0x08,
+    0x04,   0x0d,   0x66,   0x1a,   0x01,   0x01,   0x0b,   0x03,
+    0x01,   0x1c,   0x4c,   0x00,   0x00,   0x07,   0x01,   0x07,
+    0x03,   0x03,   0x04,   0x14,   0x14,   0x00,   0x04,   0x01,
+    0x02,   0x07,   0x01,   0x0b,   0x0b,   0x49,   0x02,   0x0e,
+    0x03,   0x01,   0x37,   0x00,   0x18,   0x06,   0x02,   0x00,
+    0x0f,   0x0e,   0x39,   0x02,   0x02,   0x03,   0x02,   0x78,
+    0x08,   0x00,   0x19,   0x0f,   0x01,   0x0f,   0x05,   0x01
+};
+
+const uint8_t DataSet_1_8u::outputs::MRSHV[128] = {
+    0xfe,   0x04,   0x10,   0x5e,   0x0c,   0x6f,   0x16,   0x01,
+    0x00,   0xb0,   0xea,   0x29,   0x71,   0x71,   0x01,   0xc0,
+    0x1e,   0x0a,   0x1d,   0x65,   0x19,   0xd6,   0xa8,   0x01,
+    0x00,   0x63,   0xfd,   0x18,   0xab,   0x0d,   0x01,   0x9c,
+    0x5a,   0x37,   0x0d,   0xf6,   0x03,   0x66,   0xc6,   0x00,
+    0x00,   0x98,   0xfe,   0x01,   0xd4,   0x09,   0x00,   0x99,
+    0x0e,   0x00,   0x0c,   0x21,   0x07,   0xf3,   0xf6,   0x2c,
+    0x17,   0x69,   0xdb,   0x00,   0x03,   0x08,   0x26,   0xf5,
+    0x3d,   0x11,   0x5e,   0x04,   0x01,   0x28,   0x53,   0x08,
+    0x04,   0x6d,   0xcd,   0x1a,   0xb2,   0x01,   0x0b,   0xd8,
+    0xe3,   0x1c,   0x4c,   0x0e,   0x00,   0x0e,   0xf4,   0x07,
+    0x03,   0xd7,   0x85,   0x14,   0xa4,   0x00,   0x04,   0x6a,
+    0x52,   0x07,   0x01,   0x5b,   0x0b,   0x92,   0xbc,   0x0e,
+    0x03,   0x03,   0xde,   0x00,   0xc2,   0x06,   0x02,   0x19,
+    0x3f,   0x0e,   0x39,   0xb1,   0x02,   0xdd,   0x90,   0x78,
+    0x08,   0x0e,   0x33,   0x0f,   0xc3,   0x0f,   0x05,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::RSHS[128] = {
+    0x1f,   0x13,   0x10,   0x0b,   0x0c,   0x0d,   0x02,   0x1a,
+    0x07,   0x16,   0x1d,   0x14,   0x0e,   0x1c,   0x07,   0x18,
+    0x03,   0x05,   0x0e,   0x0c,   0x19,   0x1a,   0x15,   0x01,
+    0x02,   0x0c,   0x1f,   0x18,   0x15,   0x0d,   0x1f,   0x13,
+    0x0b,   0x0d,   0x06,   0x1e,   0x06,   0x0c,   0x18,   0x0a,
+    0x05,   0x13,   0x1f,   0x05,   0x1a,   0x09,   0x07,   0x13,
+    0x01,   0x0b,   0x0c,   0x04,   0x1e,   0x1e,   0x1e,   0x0b,
+    0x17,   0x0d,   0x1b,   0x0d,   0x00,   0x11,   0x09,   0x1e,
+    0x07,   0x11,   0x17,   0x00,   0x00,   0x05,   0x0a,   0x11,
+    0x02,   0x0d,   0x19,   0x1a,   0x16,   0x18,   0x16,   0x1b,
+    0x1c,   0x07,   0x13,   0x01,   0x0c,   0x01,   0x1e,   0x1d,
+    0x0e,   0x1a,   0x10,   0x14,   0x14,   0x04,   0x09,   0x0d,
+    0x0a,   0x1d,   0x06,   0x0b,   0x05,   0x12,   0x17,   0x07,
+    0x06,   0x00,   0x1b,   0x04,   0x18,   0x1b,   0x0a,   0x03,
+    0x07,   0x07,   0x1c,   0x16,   0x10,   0x1b,   0x12,   0x1e,
+    0x10,   0x01,   0x06,   0x1f,   0x18,   0x07,   0x14,   0x16
+};
+
+const uint8_t DataSet_1_8u::outputs::MRSHS[128] = {
+    0xfe,   0x13,   0x10,   0x5e,   0x0c,   0x6f,   0x16,   0x1a,
+    0x07,   0xb0,   0xea,   0x14,   0x71,   0x1c,   0x07,   0xc0,
+    0x1e,   0x05,   0x0e,   0x65,   0x19,   0xd6,   0xa8,   0x01,
+    0x02,   0x63,   0xfd,   0x18,   0xab,   0x0d,   0x1f,   0x9c,
+    0x5a,   0x0d,   0x06,   0xf6,   0x06,   0x66,   0xc6,   0x0a,
+    0x05,   0x98,   0xfe,   0x05,   0xd4,   0x09,   0x07,   0x99,
+    0x0e,   0x0b,   0x0c,   0x21,   0x1e,   0xf3,   0xf6,   0x0b,
+    0x17,   0x69,   0xdb,   0x0d,   0x03,   0x11,   0x09,   0xf5,
+    0x3d,   0x11,   0x17,   0x04,   0x00,   0x28,   0x53,   0x11,
+    0x02,   0x6d,   0xcd,   0x1a,   0xb2,   0x18,   0x16,   0xd8,
+    0xe3,   0x07,   0x13,   0x0e,   0x0c,   0x0e,   0xf4,   0x1d,
+    0x0e,   0xd7,   0x85,   0x14,   0xa4,   0x04,   0x09,   0x6a,
+    0x52,   0x1d,   0x06,   0x5b,   0x05,   0x92,   0xbc,   0x07,
+    0x06,   0x03,   0xde,   0x04,   0xc2,   0x1b,   0x0a,   0x19,
+    0x3f,   0x07,   0x1c,   0xb1,   0x10,   0xdd,   0x90,   0x1e,
+    0x10,   0x0e,   0x33,   0x1f,   0xc3,   0x07,   0x14,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::ROLV[128] = {
+    0x7f,   0xb3,   0x0c,   0xf2,   0x1b,   0x7b,   0x0b,   0x6b,
+    0x0f,   0xc2,   0xd5,   0x9a,   0x5c,   0xc5,   0xa7,   0x18,
+    0x3c,   0xa8,   0xdd,   0x95,   0x7e,   0x6b,   0xa2,   0x40,
+    0x62,   0x36,   0xfe,   0x16,   0xba,   0x5b,   0xfe,   0x39,
+    0x96,   0xdc,   0xd8,   0xdb,   0x43,   0xcc,   0x6c,   0x28,
+    0x15,   0xc4,   0xfb,   0x65,   0x53,   0x42,   0x9c,   0x33,
+    0x70,   0xad,   0x13,   0x24,   0xbe,   0x3f,   0xb7,   0xb0,
+    0xc5,   0x5a,   0xde,   0xb4,   0x81,   0xa8,   0x9a,   0x5f,
+    0x4f,   0x54,   0x79,   0x40,   0x06,   0x0a,   0xa9,   0xd8,
+    0x4c,   0x6b,   0x9b,   0xae,   0x59,   0xe1,   0x5b,   0x36,
+    0xf1,   0x70,   0x33,   0xc1,   0x30,   0x1c,   0x7a,   0x7d,
+    0x6e,   0xf5,   0xb0,   0x1d,   0x25,   0x88,   0xf4,   0x9a,
+    0x4a,   0x9d,   0x06,   0xda,   0xb4,   0x25,   0x2f,   0xe4,
+    0x03,   0x06,   0x7b,   0x91,   0x16,   0xdb,   0x4a,   0x8c,
+    0xfc,   0xec,   0x9b,   0x6c,   0xe0,   0x77,   0x24,   0xe1,
+    0x48,   0xc1,   0x66,   0xef,   0xe1,   0xf0,   0x74,   0xd9
+};
+
+const uint8_t DataSet_1_8u::outputs::MROLV[128] = {
+    0xfe,   0xb3,   0x0c,   0x5e,   0x1b,   0x6f,   0x16,   0x6b,
+    0x0f,   0xb0,   0xea,   0x9a,   0x71,   0xc5,   0xa7,   0xc0,
+    0x1e,   0xa8,   0xdd,   0x65,   0x7e,   0xd6,   0xa8,   0x40,
+    0x62,   0x63,   0xfd,   0x16,   0xab,   0x5b,   0xfe,   0x9c,
+    0x5a,   0xdc,   0xd8,   0xf6,   0x43,   0x66,   0xc6,   0x28,
+    0x15,   0x98,   0xfe,   0x65,   0xd4,   0x42,   0x9c,   0x99,
+    0x0e,   0xad,   0x13,   0x21,   0xbe,   0xf3,   0xf6,   0xb0,
+    0xc5,   0x69,   0xdb,   0xb4,   0x03,   0xa8,   0x9a,   0xf5,
+    0x3d,   0x54,   0x79,   0x04,   0x06,   0x28,   0x53,   0xd8,
+    0x4c,   0x6d,   0xcd,   0xae,   0xb2,   0xe1,   0x5b,   0xd8,
+    0xe3,   0x70,   0x33,   0x0e,   0x30,   0x0e,   0xf4,   0x7d,
+    0x6e,   0xd7,   0x85,   0x1d,   0xa4,   0x88,   0xf4,   0x6a,
+    0x52,   0x9d,   0x06,   0x5b,   0xb4,   0x92,   0xbc,   0xe4,
+    0x03,   0x03,   0xde,   0x91,   0xc2,   0xdb,   0x4a,   0x19,
+    0x3f,   0xec,   0x9b,   0xb1,   0xe0,   0xdd,   0x90,   0xe1,
+    0x48,   0x0e,   0x33,   0xef,   0xc3,   0xf0,   0x74,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::ROLS[128] = {
+    0xf7,   0xec,   0x0c,   0xf2,   0x1b,   0x7b,   0xb0,   0xb6,
+    0xe1,   0x85,   0x57,   0x35,   0x8b,   0x17,   0xe9,   0x06,
+    0xf0,   0x51,   0xbb,   0x2b,   0x7e,   0xb6,   0x45,   0x40,
+    0x98,   0x1b,   0xef,   0x16,   0x5d,   0x5b,   0xef,   0xe4,
+    0xd2,   0x73,   0xb1,   0xb7,   0xa1,   0x33,   0x36,   0x82,
+    0x51,   0xc4,   0xf7,   0x59,   0xa6,   0x42,   0xc9,   0xcc,
+    0x70,   0xda,   0x13,   0x09,   0xaf,   0x9f,   0xb7,   0xc2,
+    0xc5,   0x4b,   0xde,   0x4b,   0x18,   0x54,   0x6a,   0xaf,
+    0xe9,   0x54,   0xe5,   0x20,   0x18,   0x41,   0x9a,   0x6c,
+    0x98,   0x6b,   0x6e,   0xae,   0x95,   0x1e,   0xad,   0xc6,
+    0x1f,   0xc1,   0xcc,   0x70,   0x03,   0x70,   0xa7,   0x5f,
+    0x9b,   0xbe,   0x2c,   0x1d,   0x25,   0x11,   0x7a,   0x53,
+    0x92,   0x67,   0x81,   0xda,   0x69,   0x94,   0xe5,   0xc9,
+    0x81,   0x18,   0xf6,   0x19,   0x16,   0xf6,   0x92,   0xc8,
+    0xf9,   0xd9,   0x37,   0x8d,   0x1c,   0xee,   0x84,   0x87,
+    0x24,   0x70,   0x99,   0xf7,   0x1e,   0xe1,   0x1d,   0x9d
+};
+
+const uint8_t DataSet_1_8u::outputs::MROLS[128] = {
+    0xfe,   0xec,   0x0c,   0x5e,   0x1b,   0x6f,   0x16,   0xb6,
+    0xe1,   0xb0,   0xea,   0x35,   0x71,   0x17,   0xe9,   0xc0,
+    0x1e,   0x51,   0xbb,   0x65,   0x7e,   0xd6,   0xa8,   0x40,
+    0x98,   0x63,   0xfd,   0x16,   0xab,   0x5b,   0xef,   0x9c,
+    0x5a,   0x73,   0xb1,   0xf6,   0xa1,   0x66,   0xc6,   0x82,
+    0x51,   0x98,   0xfe,   0x59,   0xd4,   0x42,   0xc9,   0x99,
+    0x0e,   0xda,   0x13,   0x21,   0xaf,   0xf3,   0xf6,   0xc2,
+    0xc5,   0x69,   0xdb,   0x4b,   0x03,   0x54,   0x6a,   0xf5,
+    0x3d,   0x54,   0xe5,   0x04,   0x18,   0x28,   0x53,   0x6c,
+    0x98,   0x6d,   0xcd,   0xae,   0xb2,   0x1e,   0xad,   0xd8,
+    0xe3,   0xc1,   0xcc,   0x0e,   0x03,   0x0e,   0xf4,   0x5f,
+    0x9b,   0xd7,   0x85,   0x1d,   0xa4,   0x11,   0x7a,   0x6a,
+    0x52,   0x67,   0x81,   0x5b,   0x69,   0x92,   0xbc,   0xc9,
+    0x81,   0x03,   0xde,   0x19,   0xc2,   0xf6,   0x92,   0x19,
+    0x3f,   0xd9,   0x37,   0xb1,   0x1c,   0xdd,   0x90,   0x87,
+    0x24,   0x0e,   0x33,   0xf7,   0xc3,   0xe1,   0x1d,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::RORV[128] = {
+    0xfd,   0xec,   0x30,   0xcb,   0x6c,   0xed,   0x2c,   0xad,
+    0xf0,   0x2c,   0x75,   0xa9,   0xc5,   0x71,   0xe9,   0x06,
+    0x0f,   0x8a,   0xdd,   0x59,   0xf9,   0xad,   0x2a,   0x01,
+    0x98,   0x36,   0xfb,   0x58,   0xba,   0x6d,   0xfb,   0x4e,
+    0x69,   0x37,   0x8d,   0xbd,   0x43,   0x33,   0x6c,   0xa0,
+    0x54,   0x13,   0xbf,   0x59,   0x35,   0x09,   0x72,   0xcc,
+    0xc1,   0xb6,   0x4c,   0x09,   0xaf,   0x3f,   0xde,   0x2c,
+    0x17,   0xa5,   0x7b,   0xd2,   0x06,   0xa8,   0xa6,   0x5f,
+    0xf4,   0x51,   0x5e,   0x40,   0x81,   0xa0,   0xa6,   0xd8,
+    0xc4,   0xad,   0xe6,   0xba,   0x65,   0x87,   0x5b,   0x63,
+    0xc7,   0x1c,   0xcc,   0x70,   0xc0,   0x07,   0xe9,   0x5f,
+    0x9b,   0x5f,   0x2c,   0x74,   0x94,   0x88,   0xf4,   0xa9,
+    0x92,   0x67,   0x81,   0x6b,   0x4b,   0x49,   0xf2,   0x4e,
+    0x03,   0x81,   0xb7,   0x46,   0x58,   0xf6,   0x92,   0x32,
+    0xcf,   0xce,   0xb9,   0xc6,   0x0e,   0x77,   0x42,   0x78,
+    0x48,   0x70,   0x99,   0xef,   0x87,   0x0f,   0x1d,   0x67
+};
+
+const uint8_t DataSet_1_8u::outputs::MRORV[128] = {
+    0xfe,   0xec,   0x30,   0x5e,   0x6c,   0x6f,   0x16,   0xad,
+    0xf0,   0xb0,   0xea,   0xa9,   0x71,   0x71,   0xe9,   0xc0,
+    0x1e,   0x8a,   0xdd,   0x65,   0xf9,   0xd6,   0xa8,   0x01,
+    0x98,   0x63,   0xfd,   0x58,   0xab,   0x6d,   0xfb,   0x9c,
+    0x5a,   0x37,   0x8d,   0xf6,   0x43,   0x66,   0xc6,   0xa0,
+    0x54,   0x98,   0xfe,   0x59,   0xd4,   0x09,   0x72,   0x99,
+    0x0e,   0xb6,   0x4c,   0x21,   0xaf,   0xf3,   0xf6,   0x2c,
+    0x17,   0x69,   0xdb,   0xd2,   0x03,   0xa8,   0xa6,   0xf5,
+    0x3d,   0x51,   0x5e,   0x04,   0x81,   0x28,   0x53,   0xd8,
+    0xc4,   0x6d,   0xcd,   0xba,   0xb2,   0x87,   0x5b,   0xd8,
+    0xe3,   0x1c,   0xcc,   0x0e,   0xc0,   0x0e,   0xf4,   0x5f,
+    0x9b,   0xd7,   0x85,   0x74,   0xa4,   0x88,   0xf4,   0x6a,
+    0x52,   0x67,   0x81,   0x5b,   0x4b,   0x92,   0xbc,   0x4e,
+    0x03,   0x03,   0xde,   0x46,   0xc2,   0xf6,   0x92,   0x19,
+    0x3f,   0xce,   0xb9,   0xb1,   0x0e,   0xdd,   0x90,   0x78,
+    0x48,   0x0e,   0x33,   0xef,   0xc3,   0x0f,   0x1d,   0xb3
+};
+
+const uint8_t DataSet_1_8u::outputs::RORS[128] = {
+    0xdf,   0xb3,   0x30,   0xcb,   0x6c,   0xed,   0xc2,   0xda,
+    0x87,   0x16,   0x5d,   0xd4,   0x2e,   0x5c,   0xa7,   0x18,
+    0xc3,   0x45,   0xee,   0xac,   0xf9,   0xda,   0x15,   0x01,
+    0x62,   0x6c,   0xbf,   0x58,   0x75,   0x6d,   0xbf,   0x93,
+    0x4b,   0xcd,   0xc6,   0xde,   0x86,   0xcc,   0xd8,   0x0a,
+    0x45,   0x13,   0xdf,   0x65,   0x9a,   0x09,   0x27,   0x33,
+    0xc1,   0x6b,   0x4c,   0x24,   0xbe,   0x7e,   0xde,   0x0b,
+    0x17,   0x2d,   0x7b,   0x2d,   0x60,   0x51,   0xa9,   0xbe,
+    0xa7,   0x51,   0x97,   0x80,   0x60,   0x05,   0x6a,   0xb1,
+    0x62,   0xad,   0xb9,   0xba,   0x56,   0x78,   0xb6,   0x1b,
+    0x7c,   0x07,   0x33,   0xc1,   0x0c,   0xc1,   0x9e,   0x7d,
+    0x6e,   0xfa,   0xb0,   0x74,   0x94,   0x44,   0xe9,   0x4d,
+    0x4a,   0x9d,   0x06,   0x6b,   0xa5,   0x52,   0x97,   0x27,
+    0x06,   0x60,   0xdb,   0x64,   0x58,   0xdb,   0x4a,   0x23,
+    0xe7,   0x67,   0xdc,   0x36,   0x70,   0xbb,   0x12,   0x1e,
+    0x90,   0xc1,   0x66,   0xdf,   0x78,   0x87,   0x74,   0x76
+};
+
+const uint8_t DataSet_1_8u::outputs::MRORS[128] = {
+    0xfe,   0xb3,   0x30,   0x5e,   0x6c,   0x6f,   0x16,   0xda,
+    0x87,   0xb0,   0xea,   0xd4,   0x71,   0x5c,   0xa7,   0xc0,
+    0x1e,   0x45,   0xee,   0x65,   0xf9,   0xd6,   0xa8,   0x01,
+    0x62,   0x63,   0xfd,   0x58,   0xab,   0x6d,   0xbf,   0x9c,
+    0x5a,   0xcd,   0xc6,   0xf6,   0x86,   0x66,   0xc6,   0x0a,
+    0x45,   0x98,   0xfe,   0x65,   0xd4,   0x09,   0x27,   0x99,
+    0x0e,   0x6b,   0x4c,   0x21,   0xbe,   0xf3,   0xf6,   0x0b,
+    0x17,   0x69,   0xdb,   0x2d,   0x03,   0x51,   0xa9,   0xf5,
+    0x3d,   0x51,   0x97,   0x04,   0x60,   0x28,   0x53,   0xb1,
+    0x62,   0x6d,   0xcd,   0xba,   0xb2,   0x78,   0xb6,   0xd8,
+    0xe3,   0x07,   0x33,   0x0e,   0x0c,   0x0e,   0xf4,   0x7d,
+    0x6e,   0xd7,   0x85,   0x74,   0xa4,   0x44,   0xe9,   0x6a,
+    0x52,   0x9d,   0x06,   0x5b,   0xa5,   0x92,   0xbc,   0x27,
+    0x06,   0x03,   0xde,   0x64,   0xc2,   0xdb,   0x4a,   0x19,
+    0x3f,   0x67,   0xdc,   0xb1,   0x70,   0xdd,   0x90,   0x1e,
+    0x90,   0x0e,   0x33,   0xdf,   0xc3,   0x87,   0x74,   0xb3
+};
+
+const int8_t DataSet_1_8u::outputs::UTOI[128] = {
+    (int8_t)0xfe,   (int8_t)0x9d,   (int8_t)0x81,   (int8_t)0x5e,   (int8_t)0x63,   (int8_t)0x6f,   (int8_t)0x16,   (int8_t)0xd6,
+    (int8_t)0x3c,   (int8_t)0xb0,   (int8_t)0xea,   (int8_t)0xa6,   (int8_t)0x71,   (int8_t)0xe2,   (int8_t)0x3d,   (int8_t)0xc0,
+    (int8_t)0x1e,   (int8_t)0x2a,   (int8_t)0x77,   (int8_t)0x65,   (int8_t)0xcf,   (int8_t)0xd6,   (int8_t)0xa8,   (int8_t)0x08,
+    (int8_t)0x13,   (int8_t)0x63,   (int8_t)0xfd,   (int8_t)0xc2,   (int8_t)0xab,   (int8_t)0x6b,   (int8_t)0xfd,   (int8_t)0x9c,
+    (int8_t)0x5a,   (int8_t)0x6e,   (int8_t)0x36,   (int8_t)0xf6,   (int8_t)0x34,   (int8_t)0x66,   (int8_t)0xc6,   (int8_t)0x50,
+    (int8_t)0x2a,   (int8_t)0x98,   (int8_t)0xfe,   (int8_t)0x2b,   (int8_t)0xd4,   (int8_t)0x48,   (int8_t)0x39,   (int8_t)0x99,
+    (int8_t)0x0e,   (int8_t)0x5b,   (int8_t)0x62,   (int8_t)0x21,   (int8_t)0xf5,   (int8_t)0xf3,   (int8_t)0xf6,   (int8_t)0x58,
+    (int8_t)0xb8,   (int8_t)0x69,   (int8_t)0xdb,   (int8_t)0x69,   (int8_t)0x03,   (int8_t)0x8a,   (int8_t)0x4d,   (int8_t)0xf5,
+    (int8_t)0x3d,   (int8_t)0x8a,   (int8_t)0xbc,   (int8_t)0x04,   (int8_t)0x03,   (int8_t)0x28,   (int8_t)0x53,   (int8_t)0x8d,
+    (int8_t)0x13,   (int8_t)0x6d,   (int8_t)0xcd,   (int8_t)0xd5,   (int8_t)0xb2,   (int8_t)0xc3,   (int8_t)0xb5,   (int8_t)0xd8,
+    (int8_t)0xe3,   (int8_t)0x38,   (int8_t)0x99,   (int8_t)0x0e,   (int8_t)0x60,   (int8_t)0x0e,   (int8_t)0xf4,   (int8_t)0xeb,
+    (int8_t)0x73,   (int8_t)0xd7,   (int8_t)0x85,   (int8_t)0xa3,   (int8_t)0xa4,   (int8_t)0x22,   (int8_t)0x4f,   (int8_t)0x6a,
+    (int8_t)0x52,   (int8_t)0xec,   (int8_t)0x30,   (int8_t)0x5b,   (int8_t)0x2d,   (int8_t)0x92,   (int8_t)0xbc,   (int8_t)0x39,
+    (int8_t)0x30,   (int8_t)0x03,   (int8_t)0xde,   (int8_t)0x23,   (int8_t)0xc2,   (int8_t)0xde,   (int8_t)0x52,   (int8_t)0x19,
+    (int8_t)0x3f,   (int8_t)0x3b,   (int8_t)0xe6,   (int8_t)0xb1,   (int8_t)0x83,   (int8_t)0xdd,   (int8_t)0x90,   (int8_t)0xf0,
+    (int8_t)0x84,   (int8_t)0x0e,   (int8_t)0x33,   (int8_t)0xfe,   (int8_t)0xc3,   (int8_t)0x3c,   (int8_t)0xa3,   (int8_t)0xb3
+};
+
+
+
+
+const int8_t DataSet_1_8i::inputs::inputA[128] = {
+    113,  -39,  99,  9,   120,  -47,  112,  -105,
+    -9,   53,   35,  -29, 10,   44,   3,    -50,
+    -40,  -39,  125, -96, -45,  -127, -4,   14,
+    1,    123,  -43, -46, 89,   -53,  93,   -66,
+    91,   108,  -91, -33, 120,  -98,  50,   -49,
+    -25,  -8,   31,  39,  -82,  -107, 60,   -104,
+    -101, 24,   106, -92, -47,  -12,  37,   10,
+    1,    -106, -31, -98, 34,   -24,  122,  -26,
+    -122, -10,  97,  -98, -105, 75,   88,   126,
+    8,    -29,  -20, -86, -21,  10,   -103, -90,
+    -37,  94,   104, -71, 15,   61,   -91,  -117,
+    77,   -60,  127, -51, -107, -89,  -24,  77,
+    14,   -64,  54,  -77, 19,   127,  71,   62,
+    105,  72,   -70, 12,  -101, 111,  -89,  -32,
+    -46,  -93,  -71, -67, -3,   114,  9,    77,
+    73,   -114, 48,  104, 106,  34,   94,   -21
+};
+
+const int8_t DataSet_1_8i::inputs::inputB[128] = {
+    -50,  8,    -66,  -18,  -85,  43,   83,   100,
+    69,   48,   -107, 58,   70,   -15,  103,  42,
+    18,   -97,  -70,  24,   101,  -84,  -28,  44,
+    28,   -61,  21,   -69,  -58,  40,   35,   26,
+    84,   86,   -24,  113,  -32,  107,  73,   -61,
+    80,   83,   -44,  80,   20,   -89,  40,   24,
+    -64,  -119, 11,   -77,  60,   -39,  -92,  33,
+    -89,  -58,  -123, -83,  124,  -25,  -96,  50,
+    105,  65,   -35,  113,  88,   -6,   79,   112,
+    -32,  -111, -78,  -88,  87,   -100, 27,   92,
+    -125, 71,   46,   19,   82,   71,   74,   -6,
+    33,   -59,  117,  104,  56,   81,   -95,  -45,
+    52,   -10,  75,   -123, 91,   -12,  -33,  28,
+    36,   22,   -48,  8,    -89,  -119, 16,   46,
+    74,   -80,  39,   -90,  -127, -78,  88,   -7,
+    -56,  -30,  115,  -98,  -19,  35,   75,   88
+};
+
+const int8_t DataSet_1_8i::inputs::inputC[128] = {
+    -35,  -18,  59,  -98, 21,   -42, -70,  -43,
+    89,   108,  -57, 23,  39,   58,  15,   -68,
+    -113, 25,   -50, 74,  -122, -29, -39,  26,
+    -90,  14,   -60, 85,  22,   64,  -71,  -73,
+    -67,  -95,  4,   75,  -41,  -20, -120, -24,
+    -118, 25,   110, 100, 25,   28,  -26,  56,
+    -41,  60,   6,   -59, -32,  38,  -3,   115,
+    -103, 28,   -45, 69,  -88,  17,  -1,   10,
+    -58,  -102, -25, 36,  -46,  -72, 11,   -8,
+    -108, 117,  46,  -53, -20,  75,  -83,  81,
+    -91,  -67,  -64, 124, 62,   31,  115,  -88,
+    -122, 17,   94,  -53, -58,  -24, -63,  64,
+    -119, -29,  -50, 99,  -28,  -56, 44,   77,
+    -59,  -104, -97, 72,  108,  125, -86,  -75,
+    14,   -48,  -80, -53, -85,  4,   -10,  -122,
+    -47,  119,  -63, -79, 31,   56,  65,   -72
+};
+
+const uint8_t DataSet_1_8i::inputs::inputShiftA[128] = {
+    4, 4, 5, 4, 6, 5, 6, 1,
+    3, 3, 1, 1, 3, 2, 5, 2,
+    5, 4, 2, 5, 7, 4, 4, 1,
+    6, 7, 3, 4, 6, 7, 5, 6,
+    4, 7, 2, 2, 7, 3, 2, 2,
+    4, 6, 4, 1, 4, 7, 1, 1,
+    5, 3, 6, 2, 6, 4, 1, 5,
+    4, 2, 4, 3, 4, 1, 1, 2,
+    7, 2, 7, 7, 5, 1, 5, 2,
+    5, 1, 4, 2, 7, 1, 1, 1,
+    6, 7, 4, 1, 3, 5, 7, 1,
+    3, 4, 1, 1, 6, 4, 5, 4,
+    5, 7, 7, 7, 4, 7, 4, 3,
+    2, 1, 3, 5, 4, 2, 3, 4,
+    2, 5, 7, 6, 6, 5, 6, 2,
+    1, 6, 2, 7, 6, 5, 5, 5
+};
+
+const int8_t DataSet_1_8i::inputs::scalarA = 14;
+const uint8_t DataSet_1_8i::inputs::inputShiftScalarA = 3;
+
+const bool    DataSet_1_8i::inputs::maskA[128] = {
+    false,                              // 1
+    true,                               // 2
+    true,   false,                      // 4
+    true,   false,  false,  true,       // 8
+    true,   false,  false,  true,
+    false,  true,   true,   false,      // 16
+    false,  true,   true,   false,
+    true,   false,  false,  true,
+    true,   false,  false,  true,
+    false,  true,   true,   false,      // 32
+    false,  true,   true,   false,
+    true,   false,  false,  true,
+    true,   false,  false,  true,
+    false,  true,   true,   false,
+    false,  true,   true,   false,
+    true,   false,  false,  true,
+    true,   false,  false,  true,
+    false,  true,   true,   false,      // 64
+    false,  true,   true,   false,
+    true,   false,  false,  true,
+    true,   false,  false,  true,
+    false,  true,   true,   false,
+    false,  true,   true,   false,
+    true,   false,  false,  true,
+    true,   false,  false,  true,
+    false,  true,   true,   false,
+    false,  true,   true,   false,
+    true,   false,  false,  true,
+    true,   false,  false,  true,
+    false,  true,   true,   false,
+    false,  true,   true,   false,
+    true,   false,  false,  true,
+    true,   false,  false,  true,
+    false,  true,   true,   false       // 128
+};
+
+const int8_t DataSet_1_8i::outputs::ADDV[128] = {
+    (int8_t)0x3f,   (int8_t)0xe1,   (int8_t)0x21,   (int8_t)0xf7,   (int8_t)0x23,   (int8_t)0xfc,   (int8_t)0xc3,   (int8_t)0xfb,
+    (int8_t)0x3c,   (int8_t)0x65,   (int8_t)0xb8,   (int8_t)0x1d,   (int8_t)0x50,   (int8_t)0x1d,   (int8_t)0x6a,   (int8_t)0xf8,
+    (int8_t)0xea,   (int8_t)0x78,   (int8_t)0x37,   (int8_t)0xb8,   (int8_t)0x38,   (int8_t)0x2d,   (int8_t)0xe0,   (int8_t)0x3a,
+    (int8_t)0x1d,   (int8_t)0x3e,   (int8_t)0xea,   (int8_t)0x8d,   (int8_t)0x1f,   (int8_t)0xf3,   (int8_t)0x80,   (int8_t)0xd8,
+    (int8_t)0xaf,   (int8_t)0xc2,   (int8_t)0x8d,   (int8_t)0x50,   (int8_t)0x58,   (int8_t)0x09,   (int8_t)0x7b,   (int8_t)0x92,
+    (int8_t)0x37,   (int8_t)0x4b,   (int8_t)0xf3,   (int8_t)0x77,   (int8_t)0xc2,   (int8_t)0x3c,   (int8_t)0x64,   (int8_t)0xb0,
+    (int8_t)0x5b,   (int8_t)0xa1,   (int8_t)0x75,   (int8_t)0x57,   (int8_t)0x0d,   (int8_t)0xcd,   (int8_t)0xc9,   (int8_t)0x2b,
+    (int8_t)0xa8,   (int8_t)0x5c,   (int8_t)0x66,   (int8_t)0x4b,   (int8_t)0x9e,   (int8_t)0xcf,   (int8_t)0x1a,   (int8_t)0x18,
+    (int8_t)0xef,   (int8_t)0x37,   (int8_t)0x3e,   (int8_t)0x0f,   (int8_t)0xef,   (int8_t)0x45,   (int8_t)0xa7,   (int8_t)0xee,
+    (int8_t)0xe8,   (int8_t)0x74,   (int8_t)0x9e,   (int8_t)0x52,   (int8_t)0x42,   (int8_t)0xa6,   (int8_t)0xb4,   (int8_t)0x02,
+    (int8_t)0x5e,   (int8_t)0xa5,   (int8_t)0x96,   (int8_t)0xcc,   (int8_t)0x61,   (int8_t)0x84,   (int8_t)0xef,   (int8_t)0x85,
+    (int8_t)0x6e,   (int8_t)0x89,   (int8_t)0xf4,   (int8_t)0x35,   (int8_t)0xcd,   (int8_t)0xf8,   (int8_t)0x89,   (int8_t)0x20,
+    (int8_t)0x42,   (int8_t)0xb6,   (int8_t)0x81,   (int8_t)0x38,   (int8_t)0x6e,   (int8_t)0x73,   (int8_t)0x26,   (int8_t)0x5a,
+    (int8_t)0x8d,   (int8_t)0x5e,   (int8_t)0x8a,   (int8_t)0x14,   (int8_t)0x42,   (int8_t)0xf8,   (int8_t)0xb7,   (int8_t)0x0e,
+    (int8_t)0x1c,   (int8_t)0x53,   (int8_t)0xe0,   (int8_t)0x63,   (int8_t)0x7e,   (int8_t)0x24,   (int8_t)0x61,   (int8_t)0x46,
+    (int8_t)0x11,   (int8_t)0x70,   (int8_t)0xa3,   (int8_t)0x06,   (int8_t)0x57,   (int8_t)0x45,   (int8_t)0xa9,   (int8_t)0x43
+};
+
+const int8_t DataSet_1_8i::outputs::MADDV[128] = {
+    (int8_t)0x71,   (int8_t)0xe1,   (int8_t)0x21,   (int8_t)0x09,   (int8_t)0x23,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0xfb,
+    (int8_t)0x3c,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0x1d,   (int8_t)0x0a,   (int8_t)0x1d,   (int8_t)0x6a,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0x78,   (int8_t)0x37,   (int8_t)0xa0,   (int8_t)0x38,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x3a,
+    (int8_t)0x1d,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0x8d,   (int8_t)0x59,   (int8_t)0xf3,   (int8_t)0x80,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0xc2,   (int8_t)0x8d,   (int8_t)0xdf,   (int8_t)0x58,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0x92,
+    (int8_t)0x37,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x77,   (int8_t)0xae,   (int8_t)0x3c,   (int8_t)0x64,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0xa1,   (int8_t)0x75,   (int8_t)0xa4,   (int8_t)0x0d,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x2b,
+    (int8_t)0xa8,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0x4b,   (int8_t)0x22,   (int8_t)0xcf,   (int8_t)0x1a,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0x37,   (int8_t)0x3e,   (int8_t)0x9e,   (int8_t)0xef,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0xee,
+    (int8_t)0xe8,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0x52,   (int8_t)0xeb,   (int8_t)0xa6,   (int8_t)0xb4,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0xa5,   (int8_t)0x96,   (int8_t)0xb9,   (int8_t)0x61,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x85,
+    (int8_t)0x6e,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0x35,   (int8_t)0x95,   (int8_t)0xf8,   (int8_t)0x89,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0xb6,   (int8_t)0x81,   (int8_t)0xb3,   (int8_t)0x6e,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x5a,
+    (int8_t)0x8d,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x14,   (int8_t)0x9b,   (int8_t)0xf8,   (int8_t)0xb7,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0x53,   (int8_t)0xe0,   (int8_t)0xbd,   (int8_t)0x7e,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x46,
+    (int8_t)0x11,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x06,   (int8_t)0x6a,   (int8_t)0x45,   (int8_t)0xa9,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::ADDS[128] = {
+    (int8_t)0x7f,   (int8_t)0xe7,   (int8_t)0x71,   (int8_t)0x17,   (int8_t)0x86,   (int8_t)0xdf,   (int8_t)0x7e,   (int8_t)0xa5,
+    (int8_t)0x05,   (int8_t)0x43,   (int8_t)0x31,   (int8_t)0xf1,   (int8_t)0x18,   (int8_t)0x3a,   (int8_t)0x11,   (int8_t)0xdc,
+    (int8_t)0xe6,   (int8_t)0xe7,   (int8_t)0x8b,   (int8_t)0xae,   (int8_t)0xe1,   (int8_t)0x8f,   (int8_t)0x0a,   (int8_t)0x1c,
+    (int8_t)0x0f,   (int8_t)0x89,   (int8_t)0xe3,   (int8_t)0xe0,   (int8_t)0x67,   (int8_t)0xd9,   (int8_t)0x6b,   (int8_t)0xcc,
+    (int8_t)0x69,   (int8_t)0x7a,   (int8_t)0xb3,   (int8_t)0xed,   (int8_t)0x86,   (int8_t)0xac,   (int8_t)0x40,   (int8_t)0xdd,
+    (int8_t)0xf5,   (int8_t)0x06,   (int8_t)0x2d,   (int8_t)0x35,   (int8_t)0xbc,   (int8_t)0xa3,   (int8_t)0x4a,   (int8_t)0xa6,
+    (int8_t)0xa9,   (int8_t)0x26,   (int8_t)0x78,   (int8_t)0xb2,   (int8_t)0xdf,   (int8_t)0x02,   (int8_t)0x33,   (int8_t)0x18,
+    (int8_t)0x0f,   (int8_t)0xa4,   (int8_t)0xef,   (int8_t)0xac,   (int8_t)0x30,   (int8_t)0xf6,   (int8_t)0x88,   (int8_t)0xf4,
+    (int8_t)0x94,   (int8_t)0x04,   (int8_t)0x6f,   (int8_t)0xac,   (int8_t)0xa5,   (int8_t)0x59,   (int8_t)0x66,   (int8_t)0x8c,
+    (int8_t)0x16,   (int8_t)0xf1,   (int8_t)0xfa,   (int8_t)0xb8,   (int8_t)0xf9,   (int8_t)0x18,   (int8_t)0xa7,   (int8_t)0xb4,
+    (int8_t)0xe9,   (int8_t)0x6c,   (int8_t)0x76,   (int8_t)0xc7,   (int8_t)0x1d,   (int8_t)0x4b,   (int8_t)0xb3,   (int8_t)0x99,
+    (int8_t)0x5b,   (int8_t)0xd2,   (int8_t)0x8d,   (int8_t)0xdb,   (int8_t)0xa3,   (int8_t)0xb5,   (int8_t)0xf6,   (int8_t)0x5b,
+    (int8_t)0x1c,   (int8_t)0xce,   (int8_t)0x44,   (int8_t)0xc1,   (int8_t)0x21,   (int8_t)0x8d,   (int8_t)0x55,   (int8_t)0x4c,
+    (int8_t)0x77,   (int8_t)0x56,   (int8_t)0xc8,   (int8_t)0x1a,   (int8_t)0xa9,   (int8_t)0x7d,   (int8_t)0xb5,   (int8_t)0xee,
+    (int8_t)0xe0,   (int8_t)0xb1,   (int8_t)0xc7,   (int8_t)0xcb,   (int8_t)0x0b,   (int8_t)0x80,   (int8_t)0x17,   (int8_t)0x5b,
+    (int8_t)0x57,   (int8_t)0x9c,   (int8_t)0x3e,   (int8_t)0x76,   (int8_t)0x78,   (int8_t)0x30,   (int8_t)0x6c,   (int8_t)0xf9
+};
+
+const int8_t DataSet_1_8i::outputs::MADDS[128] = {
+    (int8_t)0x71,   (int8_t)0xe7,   (int8_t)0x71,   (int8_t)0x09,   (int8_t)0x86,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0xa5,
+    (int8_t)0x05,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0xf1,   (int8_t)0x0a,   (int8_t)0x3a,   (int8_t)0x11,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0xe7,   (int8_t)0x8b,   (int8_t)0xa0,   (int8_t)0xe1,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x1c,
+    (int8_t)0x0f,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0xe0,   (int8_t)0x59,   (int8_t)0xd9,   (int8_t)0x6b,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x7a,   (int8_t)0xb3,   (int8_t)0xdf,   (int8_t)0x86,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0xdd,
+    (int8_t)0xf5,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x35,   (int8_t)0xae,   (int8_t)0xa3,   (int8_t)0x4a,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x26,   (int8_t)0x78,   (int8_t)0xa4,   (int8_t)0xdf,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x18,
+    (int8_t)0x0f,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0xac,   (int8_t)0x22,   (int8_t)0xf6,   (int8_t)0x88,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0x04,   (int8_t)0x6f,   (int8_t)0x9e,   (int8_t)0xa5,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x8c,
+    (int8_t)0x16,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0xb8,   (int8_t)0xeb,   (int8_t)0x18,   (int8_t)0xa7,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x6c,   (int8_t)0x76,   (int8_t)0xb9,   (int8_t)0x1d,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x99,
+    (int8_t)0x5b,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0xdb,   (int8_t)0x95,   (int8_t)0xb5,   (int8_t)0xf6,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0xce,   (int8_t)0x44,   (int8_t)0xb3,   (int8_t)0x21,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x4c,
+    (int8_t)0x77,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x1a,   (int8_t)0x9b,   (int8_t)0x7d,   (int8_t)0xb5,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0xb1,   (int8_t)0xc7,   (int8_t)0xbd,   (int8_t)0x0b,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x5b,
+    (int8_t)0x57,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x76,   (int8_t)0x6a,   (int8_t)0x30,   (int8_t)0x6c,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::POSTPREFINC[128] = {
+    (int8_t)0x72,   (int8_t)0xda,   (int8_t)0x64,   (int8_t)0x0a,   (int8_t)0x79,   (int8_t)0xd2,   (int8_t)0x71,   (int8_t)0x98,
+    (int8_t)0xf8,   (int8_t)0x36,   (int8_t)0x24,   (int8_t)0xe4,   (int8_t)0x0b,   (int8_t)0x2d,   (int8_t)0x04,   (int8_t)0xcf,
+    (int8_t)0xd9,   (int8_t)0xda,   (int8_t)0x7e,   (int8_t)0xa1,   (int8_t)0xd4,   (int8_t)0x82,   (int8_t)0xfd,   (int8_t)0x0f,
+    (int8_t)0x02,   (int8_t)0x7c,   (int8_t)0xd6,   (int8_t)0xd3,   (int8_t)0x5a,   (int8_t)0xcc,   (int8_t)0x5e,   (int8_t)0xbf,
+    (int8_t)0x5c,   (int8_t)0x6d,   (int8_t)0xa6,   (int8_t)0xe0,   (int8_t)0x79,   (int8_t)0x9f,   (int8_t)0x33,   (int8_t)0xd0,
+    (int8_t)0xe8,   (int8_t)0xf9,   (int8_t)0x20,   (int8_t)0x28,   (int8_t)0xaf,   (int8_t)0x96,   (int8_t)0x3d,   (int8_t)0x99,
+    (int8_t)0x9c,   (int8_t)0x19,   (int8_t)0x6b,   (int8_t)0xa5,   (int8_t)0xd2,   (int8_t)0xf5,   (int8_t)0x26,   (int8_t)0x0b,
+    (int8_t)0x02,   (int8_t)0x97,   (int8_t)0xe2,   (int8_t)0x9f,   (int8_t)0x23,   (int8_t)0xe9,   (int8_t)0x7b,   (int8_t)0xe7,
+    (int8_t)0x87,   (int8_t)0xf7,   (int8_t)0x62,   (int8_t)0x9f,   (int8_t)0x98,   (int8_t)0x4c,   (int8_t)0x59,   (int8_t)0x7f,
+    (int8_t)0x09,   (int8_t)0xe4,   (int8_t)0xed,   (int8_t)0xab,   (int8_t)0xec,   (int8_t)0x0b,   (int8_t)0x9a,   (int8_t)0xa7,
+    (int8_t)0xdc,   (int8_t)0x5f,   (int8_t)0x69,   (int8_t)0xba,   (int8_t)0x10,   (int8_t)0x3e,   (int8_t)0xa6,   (int8_t)0x8c,
+    (int8_t)0x4e,   (int8_t)0xc5,   (int8_t)0x80,   (int8_t)0xce,   (int8_t)0x96,   (int8_t)0xa8,   (int8_t)0xe9,   (int8_t)0x4e,
+    (int8_t)0x0f,   (int8_t)0xc1,   (int8_t)0x37,   (int8_t)0xb4,   (int8_t)0x14,   (int8_t)0x80,   (int8_t)0x48,   (int8_t)0x3f,
+    (int8_t)0x6a,   (int8_t)0x49,   (int8_t)0xbb,   (int8_t)0x0d,   (int8_t)0x9c,   (int8_t)0x70,   (int8_t)0xa8,   (int8_t)0xe1,
+    (int8_t)0xd3,   (int8_t)0xa4,   (int8_t)0xba,   (int8_t)0xbe,   (int8_t)0xfe,   (int8_t)0x73,   (int8_t)0x0a,   (int8_t)0x4e,
+    (int8_t)0x4a,   (int8_t)0x8f,   (int8_t)0x31,   (int8_t)0x69,   (int8_t)0x6b,   (int8_t)0x23,   (int8_t)0x5f,   (int8_t)0xec
+};
+
+const int8_t DataSet_1_8i::outputs::MPOSTPREFINC[128] = {
+    (int8_t)0x71,   (int8_t)0xda,   (int8_t)0x64,   (int8_t)0x09,   (int8_t)0x79,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0x98,
+    (int8_t)0xf8,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0xe4,   (int8_t)0x0a,   (int8_t)0x2d,   (int8_t)0x04,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0xda,   (int8_t)0x7e,   (int8_t)0xa0,   (int8_t)0xd4,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x0f,
+    (int8_t)0x02,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0xd3,   (int8_t)0x59,   (int8_t)0xcc,   (int8_t)0x5e,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x6d,   (int8_t)0xa6,   (int8_t)0xdf,   (int8_t)0x79,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0xd0,
+    (int8_t)0xe8,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x28,   (int8_t)0xae,   (int8_t)0x96,   (int8_t)0x3d,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x19,   (int8_t)0x6b,   (int8_t)0xa4,   (int8_t)0xd2,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x0b,
+    (int8_t)0x02,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0x9f,   (int8_t)0x22,   (int8_t)0xe9,   (int8_t)0x7b,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0xf7,   (int8_t)0x62,   (int8_t)0x9e,   (int8_t)0x98,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x7f,
+    (int8_t)0x09,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0xab,   (int8_t)0xeb,   (int8_t)0x0b,   (int8_t)0x9a,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x5f,   (int8_t)0x69,   (int8_t)0xb9,   (int8_t)0x10,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x8c,
+    (int8_t)0x4e,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0xce,   (int8_t)0x95,   (int8_t)0xa8,   (int8_t)0xe9,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0xc1,   (int8_t)0x37,   (int8_t)0xb3,   (int8_t)0x14,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x3f,
+    (int8_t)0x6a,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x0d,   (int8_t)0x9b,   (int8_t)0x70,   (int8_t)0xa8,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0xa4,   (int8_t)0xba,   (int8_t)0xbd,   (int8_t)0xfe,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x4e,
+    (int8_t)0x4a,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x69,   (int8_t)0x6a,   (int8_t)0x23,   (int8_t)0x5f,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::SUBV[128] = {
+    (int8_t)0xa3,   (int8_t)0xd1,   (int8_t)0xa5,   (int8_t)0x1b,   (int8_t)0xcd,   (int8_t)0xa6,   (int8_t)0x1d,   (int8_t)0x33,
+    (int8_t)0xb2,   (int8_t)0x05,   (int8_t)0x8e,   (int8_t)0xa9,   (int8_t)0xc4,   (int8_t)0x3b,   (int8_t)0x9c,   (int8_t)0xa4,
+    (int8_t)0xc6,   (int8_t)0x3a,   (int8_t)0xc3,   (int8_t)0x88,   (int8_t)0x6e,   (int8_t)0xd5,   (int8_t)0x18,   (int8_t)0xe2,
+    (int8_t)0xe5,   (int8_t)0xb8,   (int8_t)0xc0,   (int8_t)0x17,   (int8_t)0x93,   (int8_t)0xa3,   (int8_t)0x3a,   (int8_t)0xa4,
+    (int8_t)0x07,   (int8_t)0x16,   (int8_t)0xbd,   (int8_t)0x6e,   (int8_t)0x98,   (int8_t)0x33,   (int8_t)0xe9,   (int8_t)0x0c,
+    (int8_t)0x97,   (int8_t)0xa5,   (int8_t)0x4b,   (int8_t)0xd7,   (int8_t)0x9a,   (int8_t)0xee,   (int8_t)0x14,   (int8_t)0x80,
+    (int8_t)0xdb,   (int8_t)0x8f,   (int8_t)0x5f,   (int8_t)0xf1,   (int8_t)0x95,   (int8_t)0x1b,   (int8_t)0x81,   (int8_t)0xe9,
+    (int8_t)0x5a,   (int8_t)0xd0,   (int8_t)0x5c,   (int8_t)0xf1,   (int8_t)0xa6,   (int8_t)0x01,   (int8_t)0xda,   (int8_t)0xb4,
+    (int8_t)0x1d,   (int8_t)0xb5,   (int8_t)0x84,   (int8_t)0x2d,   (int8_t)0x3f,   (int8_t)0x51,   (int8_t)0x09,   (int8_t)0x0e,
+    (int8_t)0x28,   (int8_t)0x52,   (int8_t)0x3a,   (int8_t)0x02,   (int8_t)0x94,   (int8_t)0x6e,   (int8_t)0x7e,   (int8_t)0x4a,
+    (int8_t)0x58,   (int8_t)0x17,   (int8_t)0x3a,   (int8_t)0xa6,   (int8_t)0xbd,   (int8_t)0xf6,   (int8_t)0x5b,   (int8_t)0x91,
+    (int8_t)0x2c,   (int8_t)0xff,   (int8_t)0x0a,   (int8_t)0x65,   (int8_t)0x5d,   (int8_t)0x56,   (int8_t)0x47,   (int8_t)0x7a,
+    (int8_t)0xda,   (int8_t)0xca,   (int8_t)0xeb,   (int8_t)0x2e,   (int8_t)0xb8,   (int8_t)0x8b,   (int8_t)0x68,   (int8_t)0x22,
+    (int8_t)0x45,   (int8_t)0x32,   (int8_t)0xea,   (int8_t)0x04,   (int8_t)0xf4,   (int8_t)0xe6,   (int8_t)0x97,   (int8_t)0xb2,
+    (int8_t)0x88,   (int8_t)0xf3,   (int8_t)0x92,   (int8_t)0x17,   (int8_t)0x7c,   (int8_t)0xc0,   (int8_t)0xb1,   (int8_t)0x54,
+    (int8_t)0x81,   (int8_t)0xac,   (int8_t)0xbd,   (int8_t)0xca,   (int8_t)0x7d,   (int8_t)0xff,   (int8_t)0x13,   (int8_t)0x93
+};
+
+const int8_t DataSet_1_8i::outputs::MSUBV[128] = {
+    (int8_t)0x71,   (int8_t)0xd1,   (int8_t)0xa5,   (int8_t)0x09,   (int8_t)0xcd,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0x33,
+    (int8_t)0xb2,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0xa9,   (int8_t)0x0a,   (int8_t)0x3b,   (int8_t)0x9c,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0x3a,   (int8_t)0xc3,   (int8_t)0xa0,   (int8_t)0x6e,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0xe2,
+    (int8_t)0xe5,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0x17,   (int8_t)0x59,   (int8_t)0xa3,   (int8_t)0x3a,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x16,   (int8_t)0xbd,   (int8_t)0xdf,   (int8_t)0x98,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0x0c,
+    (int8_t)0x97,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0xd7,   (int8_t)0xae,   (int8_t)0xee,   (int8_t)0x14,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x8f,   (int8_t)0x5f,   (int8_t)0xa4,   (int8_t)0x95,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0xe9,
+    (int8_t)0x5a,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0xf1,   (int8_t)0x22,   (int8_t)0x01,   (int8_t)0xda,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0xb5,   (int8_t)0x84,   (int8_t)0x9e,   (int8_t)0x3f,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x0e,
+    (int8_t)0x28,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0x02,   (int8_t)0xeb,   (int8_t)0x6e,   (int8_t)0x7e,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x17,   (int8_t)0x3a,   (int8_t)0xb9,   (int8_t)0xbd,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x91,
+    (int8_t)0x2c,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0x65,   (int8_t)0x95,   (int8_t)0x56,   (int8_t)0x47,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0xca,   (int8_t)0xeb,   (int8_t)0xb3,   (int8_t)0xb8,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x22,
+    (int8_t)0x45,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x04,   (int8_t)0x9b,   (int8_t)0xe6,   (int8_t)0x97,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0xf3,   (int8_t)0x92,   (int8_t)0xbd,   (int8_t)0x7c,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x54,
+    (int8_t)0x81,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0xca,   (int8_t)0x6a,   (int8_t)0xff,   (int8_t)0x13,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::SUBS[128] = {
+    (int8_t)0x63,   (int8_t)0xcb,   (int8_t)0x55,   (int8_t)0xfb,   (int8_t)0x6a,   (int8_t)0xc3,   (int8_t)0x62,   (int8_t)0x89,
+    (int8_t)0xe9,   (int8_t)0x27,   (int8_t)0x15,   (int8_t)0xd5,   (int8_t)0xfc,   (int8_t)0x1e,   (int8_t)0xf5,   (int8_t)0xc0,
+    (int8_t)0xca,   (int8_t)0xcb,   (int8_t)0x6f,   (int8_t)0x92,   (int8_t)0xc5,   (int8_t)0x73,   (int8_t)0xee,   (int8_t)0x00,
+    (int8_t)0xf3,   (int8_t)0x6d,   (int8_t)0xc7,   (int8_t)0xc4,   (int8_t)0x4b,   (int8_t)0xbd,   (int8_t)0x4f,   (int8_t)0xb0,
+    (int8_t)0x4d,   (int8_t)0x5e,   (int8_t)0x97,   (int8_t)0xd1,   (int8_t)0x6a,   (int8_t)0x90,   (int8_t)0x24,   (int8_t)0xc1,
+    (int8_t)0xd9,   (int8_t)0xea,   (int8_t)0x11,   (int8_t)0x19,   (int8_t)0xa0,   (int8_t)0x87,   (int8_t)0x2e,   (int8_t)0x8a,
+    (int8_t)0x8d,   (int8_t)0x0a,   (int8_t)0x5c,   (int8_t)0x96,   (int8_t)0xc3,   (int8_t)0xe6,   (int8_t)0x17,   (int8_t)0xfc,
+    (int8_t)0xf3,   (int8_t)0x88,   (int8_t)0xd3,   (int8_t)0x90,   (int8_t)0x14,   (int8_t)0xda,   (int8_t)0x6c,   (int8_t)0xd8,
+    (int8_t)0x78,   (int8_t)0xe8,   (int8_t)0x53,   (int8_t)0x90,   (int8_t)0x89,   (int8_t)0x3d,   (int8_t)0x4a,   (int8_t)0x70,
+    (int8_t)0xfa,   (int8_t)0xd5,   (int8_t)0xde,   (int8_t)0x9c,   (int8_t)0xdd,   (int8_t)0xfc,   (int8_t)0x8b,   (int8_t)0x98,
+    (int8_t)0xcd,   (int8_t)0x50,   (int8_t)0x5a,   (int8_t)0xab,   (int8_t)0x01,   (int8_t)0x2f,   (int8_t)0x97,   (int8_t)0x7d,
+    (int8_t)0x3f,   (int8_t)0xb6,   (int8_t)0x71,   (int8_t)0xbf,   (int8_t)0x87,   (int8_t)0x99,   (int8_t)0xda,   (int8_t)0x3f,
+    (int8_t)0x00,   (int8_t)0xb2,   (int8_t)0x28,   (int8_t)0xa5,   (int8_t)0x05,   (int8_t)0x71,   (int8_t)0x39,   (int8_t)0x30,
+    (int8_t)0x5b,   (int8_t)0x3a,   (int8_t)0xac,   (int8_t)0xfe,   (int8_t)0x8d,   (int8_t)0x61,   (int8_t)0x99,   (int8_t)0xd2,
+    (int8_t)0xc4,   (int8_t)0x95,   (int8_t)0xab,   (int8_t)0xaf,   (int8_t)0xef,   (int8_t)0x64,   (int8_t)0xfb,   (int8_t)0x3f,
+    (int8_t)0x3b,   (int8_t)0x80,   (int8_t)0x22,   (int8_t)0x5a,   (int8_t)0x5c,   (int8_t)0x14,   (int8_t)0x50,   (int8_t)0xdd
+};
+
+const int8_t DataSet_1_8i::outputs::MSUBS[128] = {
+    (int8_t)0x71,   (int8_t)0xcb,   (int8_t)0x55,   (int8_t)0x09,   (int8_t)0x6a,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0x89,
+    (int8_t)0xe9,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0xd5,   (int8_t)0x0a,   (int8_t)0x1e,   (int8_t)0xf5,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0xcb,   (int8_t)0x6f,   (int8_t)0xa0,   (int8_t)0xc5,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x00,
+    (int8_t)0xf3,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0xc4,   (int8_t)0x59,   (int8_t)0xbd,   (int8_t)0x4f,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x5e,   (int8_t)0x97,   (int8_t)0xdf,   (int8_t)0x6a,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0xc1,
+    (int8_t)0xd9,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x19,   (int8_t)0xae,   (int8_t)0x87,   (int8_t)0x2e,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x0a,   (int8_t)0x5c,   (int8_t)0xa4,   (int8_t)0xc3,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0xfc,
+    (int8_t)0xf3,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0x90,   (int8_t)0x22,   (int8_t)0xda,   (int8_t)0x6c,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0xe8,   (int8_t)0x53,   (int8_t)0x9e,   (int8_t)0x89,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x70,
+    (int8_t)0xfa,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0x9c,   (int8_t)0xeb,   (int8_t)0xfc,   (int8_t)0x8b,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x50,   (int8_t)0x5a,   (int8_t)0xb9,   (int8_t)0x01,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x7d,
+    (int8_t)0x3f,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0xbf,   (int8_t)0x95,   (int8_t)0x99,   (int8_t)0xda,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0xb2,   (int8_t)0x28,   (int8_t)0xb3,   (int8_t)0x05,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x30,
+    (int8_t)0x5b,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0xfe,   (int8_t)0x9b,   (int8_t)0x61,   (int8_t)0x99,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0x95,   (int8_t)0xab,   (int8_t)0xbd,   (int8_t)0xef,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x3f,
+    (int8_t)0x3b,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x5a,   (int8_t)0x6a,   (int8_t)0x14,   (int8_t)0x50,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::SUBFROMV[128] = {
+    (int8_t)0x5d,   (int8_t)0x2f,   (int8_t)0x5b,   (int8_t)0xe5,   (int8_t)0x33,   (int8_t)0x5a,   (int8_t)0xe3,   (int8_t)0xcd,
+    (int8_t)0x4e,   (int8_t)0xfb,   (int8_t)0x72,   (int8_t)0x57,   (int8_t)0x3c,   (int8_t)0xc5,   (int8_t)0x64,   (int8_t)0x5c,
+    (int8_t)0x3a,   (int8_t)0xc6,   (int8_t)0x3d,   (int8_t)0x78,   (int8_t)0x92,   (int8_t)0x2b,   (int8_t)0xe8,   (int8_t)0x1e,
+    (int8_t)0x1b,   (int8_t)0x48,   (int8_t)0x40,   (int8_t)0xe9,   (int8_t)0x6d,   (int8_t)0x5d,   (int8_t)0xc6,   (int8_t)0x5c,
+    (int8_t)0xf9,   (int8_t)0xea,   (int8_t)0x43,   (int8_t)0x92,   (int8_t)0x68,   (int8_t)0xcd,   (int8_t)0x17,   (int8_t)0xf4,
+    (int8_t)0x69,   (int8_t)0x5b,   (int8_t)0xb5,   (int8_t)0x29,   (int8_t)0x66,   (int8_t)0x12,   (int8_t)0xec,   (int8_t)0x80,
+    (int8_t)0x25,   (int8_t)0x71,   (int8_t)0xa1,   (int8_t)0x0f,   (int8_t)0x6b,   (int8_t)0xe5,   (int8_t)0x7f,   (int8_t)0x17,
+    (int8_t)0xa6,   (int8_t)0x30,   (int8_t)0xa4,   (int8_t)0x0f,   (int8_t)0x5a,   (int8_t)0xff,   (int8_t)0x26,   (int8_t)0x4c,
+    (int8_t)0xe3,   (int8_t)0x4b,   (int8_t)0x7c,   (int8_t)0xd3,   (int8_t)0xc1,   (int8_t)0xaf,   (int8_t)0xf7,   (int8_t)0xf2,
+    (int8_t)0xd8,   (int8_t)0xae,   (int8_t)0xc6,   (int8_t)0xfe,   (int8_t)0x6c,   (int8_t)0x92,   (int8_t)0x82,   (int8_t)0xb6,
+    (int8_t)0xa8,   (int8_t)0xe9,   (int8_t)0xc6,   (int8_t)0x5a,   (int8_t)0x43,   (int8_t)0x0a,   (int8_t)0xa5,   (int8_t)0x6f,
+    (int8_t)0xd4,   (int8_t)0x01,   (int8_t)0xf6,   (int8_t)0x9b,   (int8_t)0xa3,   (int8_t)0xaa,   (int8_t)0xb9,   (int8_t)0x86,
+    (int8_t)0x26,   (int8_t)0x36,   (int8_t)0x15,   (int8_t)0xd2,   (int8_t)0x48,   (int8_t)0x75,   (int8_t)0x98,   (int8_t)0xde,
+    (int8_t)0xbb,   (int8_t)0xce,   (int8_t)0x16,   (int8_t)0xfc,   (int8_t)0x0c,   (int8_t)0x1a,   (int8_t)0x69,   (int8_t)0x4e,
+    (int8_t)0x78,   (int8_t)0x0d,   (int8_t)0x6e,   (int8_t)0xe9,   (int8_t)0x84,   (int8_t)0x40,   (int8_t)0x4f,   (int8_t)0xac,
+    (int8_t)0x7f,   (int8_t)0x54,   (int8_t)0x43,   (int8_t)0x36,   (int8_t)0x83,   (int8_t)0x01,   (int8_t)0xed,   (int8_t)0x6d
+};
+
+const int8_t DataSet_1_8i::outputs::MSUBFROMV[128] = {
+    (int8_t)0xce,   (int8_t)0x2f,   (int8_t)0x5b,   (int8_t)0xee,   (int8_t)0x33,   (int8_t)0x2b,   (int8_t)0x53,   (int8_t)0xcd,
+    (int8_t)0x4e,   (int8_t)0x30,   (int8_t)0x95,   (int8_t)0x57,   (int8_t)0x46,   (int8_t)0xc5,   (int8_t)0x64,   (int8_t)0x2a,
+    (int8_t)0x12,   (int8_t)0xc6,   (int8_t)0x3d,   (int8_t)0x18,   (int8_t)0x92,   (int8_t)0xac,   (int8_t)0xe4,   (int8_t)0x1e,
+    (int8_t)0x1b,   (int8_t)0xc3,   (int8_t)0x15,   (int8_t)0xe9,   (int8_t)0xc6,   (int8_t)0x5d,   (int8_t)0xc6,   (int8_t)0x1a,
+    (int8_t)0x54,   (int8_t)0xea,   (int8_t)0x43,   (int8_t)0x71,   (int8_t)0x68,   (int8_t)0x6b,   (int8_t)0x49,   (int8_t)0xf4,
+    (int8_t)0x69,   (int8_t)0x53,   (int8_t)0xd4,   (int8_t)0x29,   (int8_t)0x14,   (int8_t)0x12,   (int8_t)0xec,   (int8_t)0x18,
+    (int8_t)0xc0,   (int8_t)0x71,   (int8_t)0xa1,   (int8_t)0xb3,   (int8_t)0x6b,   (int8_t)0xd9,   (int8_t)0xa4,   (int8_t)0x17,
+    (int8_t)0xa6,   (int8_t)0xc6,   (int8_t)0x85,   (int8_t)0x0f,   (int8_t)0x7c,   (int8_t)0xff,   (int8_t)0x26,   (int8_t)0x32,
+    (int8_t)0x69,   (int8_t)0x4b,   (int8_t)0x7c,   (int8_t)0x71,   (int8_t)0xc1,   (int8_t)0xfa,   (int8_t)0x4f,   (int8_t)0xf2,
+    (int8_t)0xd8,   (int8_t)0x91,   (int8_t)0xb2,   (int8_t)0xfe,   (int8_t)0x57,   (int8_t)0x92,   (int8_t)0x82,   (int8_t)0x5c,
+    (int8_t)0x83,   (int8_t)0xe9,   (int8_t)0xc6,   (int8_t)0x13,   (int8_t)0x43,   (int8_t)0x47,   (int8_t)0x4a,   (int8_t)0x6f,
+    (int8_t)0xd4,   (int8_t)0xc5,   (int8_t)0x75,   (int8_t)0x9b,   (int8_t)0x38,   (int8_t)0xaa,   (int8_t)0xb9,   (int8_t)0xd3,
+    (int8_t)0x34,   (int8_t)0x36,   (int8_t)0x15,   (int8_t)0x85,   (int8_t)0x48,   (int8_t)0xf4,   (int8_t)0xdf,   (int8_t)0xde,
+    (int8_t)0xbb,   (int8_t)0x16,   (int8_t)0xd0,   (int8_t)0xfc,   (int8_t)0xa7,   (int8_t)0x1a,   (int8_t)0x69,   (int8_t)0x2e,
+    (int8_t)0x4a,   (int8_t)0x0d,   (int8_t)0x6e,   (int8_t)0xa6,   (int8_t)0x84,   (int8_t)0xb2,   (int8_t)0x58,   (int8_t)0xac,
+    (int8_t)0x7f,   (int8_t)0xe2,   (int8_t)0x73,   (int8_t)0x36,   (int8_t)0xed,   (int8_t)0x01,   (int8_t)0xed,   (int8_t)0x58
+};
+
+const int8_t DataSet_1_8i::outputs::SUBFROMS[128] = {
+    (int8_t)0x9d,   (int8_t)0x35,   (int8_t)0xab,   (int8_t)0x05,   (int8_t)0x96,   (int8_t)0x3d,   (int8_t)0x9e,   (int8_t)0x77,
+    (int8_t)0x17,   (int8_t)0xd9,   (int8_t)0xeb,   (int8_t)0x2b,   (int8_t)0x04,   (int8_t)0xe2,   (int8_t)0x0b,   (int8_t)0x40,
+    (int8_t)0x36,   (int8_t)0x35,   (int8_t)0x91,   (int8_t)0x6e,   (int8_t)0x3b,   (int8_t)0x8d,   (int8_t)0x12,   (int8_t)0x00,
+    (int8_t)0x0d,   (int8_t)0x93,   (int8_t)0x39,   (int8_t)0x3c,   (int8_t)0xb5,   (int8_t)0x43,   (int8_t)0xb1,   (int8_t)0x50,
+    (int8_t)0xb3,   (int8_t)0xa2,   (int8_t)0x69,   (int8_t)0x2f,   (int8_t)0x96,   (int8_t)0x70,   (int8_t)0xdc,   (int8_t)0x3f,
+    (int8_t)0x27,   (int8_t)0x16,   (int8_t)0xef,   (int8_t)0xe7,   (int8_t)0x60,   (int8_t)0x79,   (int8_t)0xd2,   (int8_t)0x76,
+    (int8_t)0x73,   (int8_t)0xf6,   (int8_t)0xa4,   (int8_t)0x6a,   (int8_t)0x3d,   (int8_t)0x1a,   (int8_t)0xe9,   (int8_t)0x04,
+    (int8_t)0x0d,   (int8_t)0x78,   (int8_t)0x2d,   (int8_t)0x70,   (int8_t)0xec,   (int8_t)0x26,   (int8_t)0x94,   (int8_t)0x28,
+    (int8_t)0x88,   (int8_t)0x18,   (int8_t)0xad,   (int8_t)0x70,   (int8_t)0x77,   (int8_t)0xc3,   (int8_t)0xb6,   (int8_t)0x90,
+    (int8_t)0x06,   (int8_t)0x2b,   (int8_t)0x22,   (int8_t)0x64,   (int8_t)0x23,   (int8_t)0x04,   (int8_t)0x75,   (int8_t)0x68,
+    (int8_t)0x33,   (int8_t)0xb0,   (int8_t)0xa6,   (int8_t)0x55,   (int8_t)0xff,   (int8_t)0xd1,   (int8_t)0x69,   (int8_t)0x83,
+    (int8_t)0xc1,   (int8_t)0x4a,   (int8_t)0x8f,   (int8_t)0x41,   (int8_t)0x79,   (int8_t)0x67,   (int8_t)0x26,   (int8_t)0xc1,
+    (int8_t)0x00,   (int8_t)0x4e,   (int8_t)0xd8,   (int8_t)0x5b,   (int8_t)0xfb,   (int8_t)0x8f,   (int8_t)0xc7,   (int8_t)0xd0,
+    (int8_t)0xa5,   (int8_t)0xc6,   (int8_t)0x54,   (int8_t)0x02,   (int8_t)0x73,   (int8_t)0x9f,   (int8_t)0x67,   (int8_t)0x2e,
+    (int8_t)0x3c,   (int8_t)0x6b,   (int8_t)0x55,   (int8_t)0x51,   (int8_t)0x11,   (int8_t)0x9c,   (int8_t)0x05,   (int8_t)0xc1,
+    (int8_t)0xc5,   (int8_t)0x80,   (int8_t)0xde,   (int8_t)0xa6,   (int8_t)0xa4,   (int8_t)0xec,   (int8_t)0xb0,   (int8_t)0x23
+};
+
+const int8_t DataSet_1_8i::outputs::MSUBFROMS[128] = {
+    (int8_t)0x0e,   (int8_t)0x35,   (int8_t)0xab,   (int8_t)0x0e,   (int8_t)0x96,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x77,
+    (int8_t)0x17,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x2b,   (int8_t)0x0e,   (int8_t)0xe2,   (int8_t)0x0b,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0x35,   (int8_t)0x91,   (int8_t)0x0e,   (int8_t)0x3b,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x00,
+    (int8_t)0x0d,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x3c,   (int8_t)0x0e,   (int8_t)0x43,   (int8_t)0xb1,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0xa2,   (int8_t)0x69,   (int8_t)0x0e,   (int8_t)0x96,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x3f,
+    (int8_t)0x27,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0xe7,   (int8_t)0x0e,   (int8_t)0x79,   (int8_t)0xd2,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0xf6,   (int8_t)0xa4,   (int8_t)0x0e,   (int8_t)0x3d,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x04,
+    (int8_t)0x0d,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x70,   (int8_t)0x0e,   (int8_t)0x26,   (int8_t)0x94,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0x18,   (int8_t)0xad,   (int8_t)0x0e,   (int8_t)0x77,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x90,
+    (int8_t)0x06,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x64,   (int8_t)0x0e,   (int8_t)0x04,   (int8_t)0x75,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0xb0,   (int8_t)0xa6,   (int8_t)0x0e,   (int8_t)0xff,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x83,
+    (int8_t)0xc1,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x41,   (int8_t)0x0e,   (int8_t)0x67,   (int8_t)0x26,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0x4e,   (int8_t)0xd8,   (int8_t)0x0e,   (int8_t)0xfb,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0xd0,
+    (int8_t)0xa5,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x02,   (int8_t)0x0e,   (int8_t)0x9f,   (int8_t)0x67,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0x6b,   (int8_t)0x55,   (int8_t)0x0e,   (int8_t)0x11,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0xc1,
+    (int8_t)0xc5,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0xa6,   (int8_t)0x0e,   (int8_t)0xec,   (int8_t)0xb0,   (int8_t)0x0e
+};
+
+const int8_t DataSet_1_8i::outputs::POSTPREFDEC[128] = {
+    (int8_t)0x70,   (int8_t)0xd8,   (int8_t)0x62,   (int8_t)0x08,   (int8_t)0x77,   (int8_t)0xd0,   (int8_t)0x6f,   (int8_t)0x96,
+    (int8_t)0xf6,   (int8_t)0x34,   (int8_t)0x22,   (int8_t)0xe2,   (int8_t)0x09,   (int8_t)0x2b,   (int8_t)0x02,   (int8_t)0xcd,
+    (int8_t)0xd7,   (int8_t)0xd8,   (int8_t)0x7c,   (int8_t)0x9f,   (int8_t)0xd2,   (int8_t)0x80,   (int8_t)0xfb,   (int8_t)0x0d,
+    (int8_t)0x00,   (int8_t)0x7a,   (int8_t)0xd4,   (int8_t)0xd1,   (int8_t)0x58,   (int8_t)0xca,   (int8_t)0x5c,   (int8_t)0xbd,
+    (int8_t)0x5a,   (int8_t)0x6b,   (int8_t)0xa4,   (int8_t)0xde,   (int8_t)0x77,   (int8_t)0x9d,   (int8_t)0x31,   (int8_t)0xce,
+    (int8_t)0xe6,   (int8_t)0xf7,   (int8_t)0x1e,   (int8_t)0x26,   (int8_t)0xad,   (int8_t)0x94,   (int8_t)0x3b,   (int8_t)0x97,
+    (int8_t)0x9a,   (int8_t)0x17,   (int8_t)0x69,   (int8_t)0xa3,   (int8_t)0xd0,   (int8_t)0xf3,   (int8_t)0x24,   (int8_t)0x09,
+    (int8_t)0x00,   (int8_t)0x95,   (int8_t)0xe0,   (int8_t)0x9d,   (int8_t)0x21,   (int8_t)0xe7,   (int8_t)0x79,   (int8_t)0xe5,
+    (int8_t)0x85,   (int8_t)0xf5,   (int8_t)0x60,   (int8_t)0x9d,   (int8_t)0x96,   (int8_t)0x4a,   (int8_t)0x57,   (int8_t)0x7d,
+    (int8_t)0x07,   (int8_t)0xe2,   (int8_t)0xeb,   (int8_t)0xa9,   (int8_t)0xea,   (int8_t)0x09,   (int8_t)0x98,   (int8_t)0xa5,
+    (int8_t)0xda,   (int8_t)0x5d,   (int8_t)0x67,   (int8_t)0xb8,   (int8_t)0x0e,   (int8_t)0x3c,   (int8_t)0xa4,   (int8_t)0x8a,
+    (int8_t)0x4c,   (int8_t)0xc3,   (int8_t)0x7e,   (int8_t)0xcc,   (int8_t)0x94,   (int8_t)0xa6,   (int8_t)0xe7,   (int8_t)0x4c,
+    (int8_t)0x0d,   (int8_t)0xbf,   (int8_t)0x35,   (int8_t)0xb2,   (int8_t)0x12,   (int8_t)0x7e,   (int8_t)0x46,   (int8_t)0x3d,
+    (int8_t)0x68,   (int8_t)0x47,   (int8_t)0xb9,   (int8_t)0x0b,   (int8_t)0x9a,   (int8_t)0x6e,   (int8_t)0xa6,   (int8_t)0xdf,
+    (int8_t)0xd1,   (int8_t)0xa2,   (int8_t)0xb8,   (int8_t)0xbc,   (int8_t)0xfc,   (int8_t)0x71,   (int8_t)0x08,   (int8_t)0x4c,
+    (int8_t)0x48,   (int8_t)0x8d,   (int8_t)0x2f,   (int8_t)0x67,   (int8_t)0x69,   (int8_t)0x21,   (int8_t)0x5d,   (int8_t)0xea
+};
+
+const int8_t DataSet_1_8i::outputs::MPOSTPREFDEC[128] = {
+    (int8_t)0x71,   (int8_t)0xd8,   (int8_t)0x62,   (int8_t)0x09,   (int8_t)0x77,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0x96,
+    (int8_t)0xf6,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0xe2,   (int8_t)0x0a,   (int8_t)0x2b,   (int8_t)0x02,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0xd8,   (int8_t)0x7c,   (int8_t)0xa0,   (int8_t)0xd2,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x0d,
+    (int8_t)0x00,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0xd1,   (int8_t)0x59,   (int8_t)0xca,   (int8_t)0x5c,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x6b,   (int8_t)0xa4,   (int8_t)0xdf,   (int8_t)0x77,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0xce,
+    (int8_t)0xe6,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x26,   (int8_t)0xae,   (int8_t)0x94,   (int8_t)0x3b,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x17,   (int8_t)0x69,   (int8_t)0xa4,   (int8_t)0xd0,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x09,
+    (int8_t)0x00,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0x9d,   (int8_t)0x22,   (int8_t)0xe7,   (int8_t)0x79,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0xf5,   (int8_t)0x60,   (int8_t)0x9e,   (int8_t)0x96,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x7d,
+    (int8_t)0x07,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0xa9,   (int8_t)0xeb,   (int8_t)0x09,   (int8_t)0x98,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x5d,   (int8_t)0x67,   (int8_t)0xb9,   (int8_t)0x0e,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x8a,
+    (int8_t)0x4c,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0xcc,   (int8_t)0x95,   (int8_t)0xa6,   (int8_t)0xe7,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0xbf,   (int8_t)0x35,   (int8_t)0xb3,   (int8_t)0x12,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x3d,
+    (int8_t)0x68,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x0b,   (int8_t)0x9b,   (int8_t)0x6e,   (int8_t)0xa6,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0xa2,   (int8_t)0xb8,   (int8_t)0xbd,   (int8_t)0xfc,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x4c,
+    (int8_t)0x48,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x67,   (int8_t)0x6a,   (int8_t)0x21,   (int8_t)0x5d,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::MULV[128] = {
+    (int8_t)0xee,   (int8_t)0xc8,   (int8_t)0x7a,   (int8_t)0x5e,   (int8_t)0x28,   (int8_t)0x1b,   (int8_t)0x50,   (int8_t)0xfc,
+    (int8_t)0x93,   (int8_t)0xf0,   (int8_t)0x5f,   (int8_t)0x6e,   (int8_t)0xbc,   (int8_t)0x6c,   (int8_t)0x35,   (int8_t)0xcc,
+    (int8_t)0x30,   (int8_t)0xc7,   (int8_t)0xd2,   (int8_t)0x00,   (int8_t)0x3f,   (int8_t)0xac,   (int8_t)0x70,   (int8_t)0x68,
+    (int8_t)0x1c,   (int8_t)0xb1,   (int8_t)0x79,   (int8_t)0x66,   (int8_t)0xd6,   (int8_t)0xb8,   (int8_t)0xb7,   (int8_t)0x4c,
+    (int8_t)0xdc,   (int8_t)0x48,   (int8_t)0x88,   (int8_t)0x6f,   (int8_t)0x00,   (int8_t)0x0a,   (int8_t)0x42,   (int8_t)0xad,
+    (int8_t)0x30,   (int8_t)0x68,   (int8_t)0xac,   (int8_t)0x30,   (int8_t)0x98,   (int8_t)0x33,   (int8_t)0x60,   (int8_t)0x40,
+    (int8_t)0x40,   (int8_t)0xd8,   (int8_t)0x8e,   (int8_t)0xac,   (int8_t)0xfc,   (int8_t)0xd4,   (int8_t)0xb4,   (int8_t)0x4a,
+    (int8_t)0xa7,   (int8_t)0x04,   (int8_t)0xe5,   (int8_t)0xc6,   (int8_t)0x78,   (int8_t)0x58,   (int8_t)0x40,   (int8_t)0xec,
+    (int8_t)0xf6,   (int8_t)0x76,   (int8_t)0xbd,   (int8_t)0xbe,   (int8_t)0xe8,   (int8_t)0x3e,   (int8_t)0x28,   (int8_t)0x20,
+    (int8_t)0x00,   (int8_t)0x93,   (int8_t)0x18,   (int8_t)0x90,   (int8_t)0xdd,   (int8_t)0x18,   (int8_t)0x23,   (int8_t)0xa8,
+    (int8_t)0x11,   (int8_t)0x12,   (int8_t)0xb0,   (int8_t)0xbb,   (int8_t)0xce,   (int8_t)0xeb,   (int8_t)0xb2,   (int8_t)0xbe,
+    (int8_t)0xed,   (int8_t)0xd4,   (int8_t)0x0b,   (int8_t)0x48,   (int8_t)0x98,   (int8_t)0xd7,   (int8_t)0xe8,   (int8_t)0x77,
+    (int8_t)0xd8,   (int8_t)0x80,   (int8_t)0xd2,   (int8_t)0xff,   (int8_t)0xc1,   (int8_t)0x0c,   (int8_t)0xd9,   (int8_t)0xc8,
+    (int8_t)0xc4,   (int8_t)0x30,   (int8_t)0x20,   (int8_t)0x60,   (int8_t)0x1d,   (int8_t)0x67,   (int8_t)0x70,   (int8_t)0x40,
+    (int8_t)0xb4,   (int8_t)0x10,   (int8_t)0x2f,   (int8_t)0x8e,   (int8_t)0x7d,   (int8_t)0x44,   (int8_t)0x18,   (int8_t)0xe5,
+    (int8_t)0x08,   (int8_t)0x5c,   (int8_t)0x90,   (int8_t)0x30,   (int8_t)0x22,   (int8_t)0xa6,   (int8_t)0x8a,   (int8_t)0xc8
+};
+
+const int8_t DataSet_1_8i::outputs::MMULV[128] = {
+    (int8_t)0x71,   (int8_t)0xc8,   (int8_t)0x7a,   (int8_t)0x09,   (int8_t)0x28,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0xfc,
+    (int8_t)0x93,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0x6e,   (int8_t)0x0a,   (int8_t)0x6c,   (int8_t)0x35,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0xc7,   (int8_t)0xd2,   (int8_t)0xa0,   (int8_t)0x3f,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x68,
+    (int8_t)0x1c,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0x66,   (int8_t)0x59,   (int8_t)0xb8,   (int8_t)0xb7,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x48,   (int8_t)0x88,   (int8_t)0xdf,   (int8_t)0x00,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0xad,
+    (int8_t)0x30,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x30,   (int8_t)0xae,   (int8_t)0x33,   (int8_t)0x60,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0xd8,   (int8_t)0x8e,   (int8_t)0xa4,   (int8_t)0xfc,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x4a,
+    (int8_t)0xa7,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0xc6,   (int8_t)0x22,   (int8_t)0x58,   (int8_t)0x40,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0x76,   (int8_t)0xbd,   (int8_t)0x9e,   (int8_t)0xe8,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x20,
+    (int8_t)0x00,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0x90,   (int8_t)0xeb,   (int8_t)0x18,   (int8_t)0x23,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x12,   (int8_t)0xb0,   (int8_t)0xb9,   (int8_t)0xce,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0xbe,
+    (int8_t)0xed,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0x48,   (int8_t)0x95,   (int8_t)0xd7,   (int8_t)0xe8,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0x80,   (int8_t)0xd2,   (int8_t)0xb3,   (int8_t)0xc1,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0xc8,
+    (int8_t)0xc4,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x60,   (int8_t)0x9b,   (int8_t)0x67,   (int8_t)0x70,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0x10,   (int8_t)0x2f,   (int8_t)0xbd,   (int8_t)0x7d,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0xe5,
+    (int8_t)0x08,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x30,   (int8_t)0x6a,   (int8_t)0xa6,   (int8_t)0x8a,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::MULS[128] = {
+    (int8_t)0x2e,   (int8_t)0xde,   (int8_t)0x6a,   (int8_t)0x7e,   (int8_t)0x90,   (int8_t)0x6e,   (int8_t)0x20,   (int8_t)0x42,
+    (int8_t)0x82,   (int8_t)0xe6,   (int8_t)0xea,   (int8_t)0x6a,   (int8_t)0x8c,   (int8_t)0x68,   (int8_t)0x2a,   (int8_t)0x44,
+    (int8_t)0xd0,   (int8_t)0xde,   (int8_t)0xd6,   (int8_t)0xc0,   (int8_t)0x8a,   (int8_t)0x0e,   (int8_t)0xc8,   (int8_t)0xc4,
+    (int8_t)0x0e,   (int8_t)0xba,   (int8_t)0xa6,   (int8_t)0x7c,   (int8_t)0xde,   (int8_t)0x1a,   (int8_t)0x16,   (int8_t)0x64,
+    (int8_t)0xfa,   (int8_t)0xe8,   (int8_t)0x06,   (int8_t)0x32,   (int8_t)0x90,   (int8_t)0xa4,   (int8_t)0xbc,   (int8_t)0x52,
+    (int8_t)0xa2,   (int8_t)0x90,   (int8_t)0xb2,   (int8_t)0x22,   (int8_t)0x84,   (int8_t)0x26,   (int8_t)0x48,   (int8_t)0x50,
+    (int8_t)0x7a,   (int8_t)0x50,   (int8_t)0xcc,   (int8_t)0xf8,   (int8_t)0x6e,   (int8_t)0x58,   (int8_t)0x06,   (int8_t)0x8c,
+    (int8_t)0x0e,   (int8_t)0x34,   (int8_t)0x4e,   (int8_t)0xa4,   (int8_t)0xdc,   (int8_t)0xb0,   (int8_t)0xac,   (int8_t)0x94,
+    (int8_t)0x54,   (int8_t)0x74,   (int8_t)0x4e,   (int8_t)0xa4,   (int8_t)0x42,   (int8_t)0x1a,   (int8_t)0xd0,   (int8_t)0xe4,
+    (int8_t)0x70,   (int8_t)0x6a,   (int8_t)0xe8,   (int8_t)0x4c,   (int8_t)0xda,   (int8_t)0x8c,   (int8_t)0x5e,   (int8_t)0x14,
+    (int8_t)0xfa,   (int8_t)0x24,   (int8_t)0xb0,   (int8_t)0x1e,   (int8_t)0xd2,   (int8_t)0x56,   (int8_t)0x06,   (int8_t)0x9a,
+    (int8_t)0x36,   (int8_t)0xb8,   (int8_t)0xf2,   (int8_t)0x36,   (int8_t)0x26,   (int8_t)0x22,   (int8_t)0xb0,   (int8_t)0x36,
+    (int8_t)0xc4,   (int8_t)0x80,   (int8_t)0xf4,   (int8_t)0xca,   (int8_t)0x0a,   (int8_t)0xf2,   (int8_t)0xe2,   (int8_t)0x64,
+    (int8_t)0xbe,   (int8_t)0xf0,   (int8_t)0x2c,   (int8_t)0xa8,   (int8_t)0x7a,   (int8_t)0x12,   (int8_t)0x22,   (int8_t)0x40,
+    (int8_t)0x7c,   (int8_t)0xea,   (int8_t)0x1e,   (int8_t)0x56,   (int8_t)0xd6,   (int8_t)0x3c,   (int8_t)0x7e,   (int8_t)0x36,
+    (int8_t)0xfe,   (int8_t)0xc4,   (int8_t)0xa0,   (int8_t)0xb0,   (int8_t)0xcc,   (int8_t)0xdc,   (int8_t)0x24,   (int8_t)0xda
+};
+
+const int8_t DataSet_1_8i::outputs::MMULS[128] = {
+    (int8_t)0x71,   (int8_t)0xde,   (int8_t)0x6a,   (int8_t)0x09,   (int8_t)0x90,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0x42,
+    (int8_t)0x82,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0x6a,   (int8_t)0x0a,   (int8_t)0x68,   (int8_t)0x2a,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0xde,   (int8_t)0xd6,   (int8_t)0xa0,   (int8_t)0x8a,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0xc4,
+    (int8_t)0x0e,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0x7c,   (int8_t)0x59,   (int8_t)0x1a,   (int8_t)0x16,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0xe8,   (int8_t)0x06,   (int8_t)0xdf,   (int8_t)0x90,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0x52,
+    (int8_t)0xa2,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x22,   (int8_t)0xae,   (int8_t)0x26,   (int8_t)0x48,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x50,   (int8_t)0xcc,   (int8_t)0xa4,   (int8_t)0x6e,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x8c,
+    (int8_t)0x0e,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0xa4,   (int8_t)0x22,   (int8_t)0xb0,   (int8_t)0xac,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0x74,   (int8_t)0x4e,   (int8_t)0x9e,   (int8_t)0x42,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0xe4,
+    (int8_t)0x70,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0x4c,   (int8_t)0xeb,   (int8_t)0x8c,   (int8_t)0x5e,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x24,   (int8_t)0xb0,   (int8_t)0xb9,   (int8_t)0xd2,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x9a,
+    (int8_t)0x36,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0x36,   (int8_t)0x95,   (int8_t)0x22,   (int8_t)0xb0,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0x80,   (int8_t)0xf4,   (int8_t)0xb3,   (int8_t)0x0a,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x64,
+    (int8_t)0xbe,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0xa8,   (int8_t)0x9b,   (int8_t)0x12,   (int8_t)0x22,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0xea,   (int8_t)0x1e,   (int8_t)0xbd,   (int8_t)0xd6,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x36,
+    (int8_t)0xfe,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0xb0,   (int8_t)0x6a,   (int8_t)0xdc,   (int8_t)0x24,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::DIVV[128] = {
+    (int8_t)0xfe,   (int8_t)0xfc,   (int8_t)0xff,   (int8_t)0x00,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0x01,   (int8_t)0xff,
+    (int8_t)0x00,   (int8_t)0x01,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xfe,   (int8_t)0x00,   (int8_t)0xff,
+    (int8_t)0xfe,   (int8_t)0x00,   (int8_t)0xff,   (int8_t)0xfc,   (int8_t)0x00,   (int8_t)0x01,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0xfe,   (int8_t)0xfe,   (int8_t)0x00,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0x02,   (int8_t)0xfe,
+    (int8_t)0x01,   (int8_t)0x01,   (int8_t)0x03,   (int8_t)0x00,   (int8_t)0xfd,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xfc,   (int8_t)0x01,   (int8_t)0x01,   (int8_t)0xfc,
+    (int8_t)0x01,   (int8_t)0x00,   (int8_t)0x09,   (int8_t)0x01,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x01,   (int8_t)0x00,   (int8_t)0x01,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xff,   (int8_t)0x00,
+    (int8_t)0xff,   (int8_t)0x00,   (int8_t)0xfe,   (int8_t)0x00,   (int8_t)0xff,   (int8_t)0xf4,   (int8_t)0x01,   (int8_t)0x01,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xfd,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x01,   (int8_t)0x02,   (int8_t)0xfd,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xff,   (int8_t)0x13,
+    (int8_t)0x02,   (int8_t)0x01,   (int8_t)0x01,   (int8_t)0x00,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0x00,   (int8_t)0xff,
+    (int8_t)0x00,   (int8_t)0x06,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xf6,   (int8_t)0xfe,   (int8_t)0x02,
+    (int8_t)0x02,   (int8_t)0x03,   (int8_t)0x01,   (int8_t)0x01,   (int8_t)0x01,   (int8_t)0x00,   (int8_t)0xfb,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x01,   (int8_t)0xff,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xff,   (int8_t)0x00,   (int8_t)0xf5,
+    (int8_t)0xff,   (int8_t)0x03,   (int8_t)0x00,   (int8_t)0xff,   (int8_t)0xfb,   (int8_t)0x00,   (int8_t)0x01,   (int8_t)0x00
+};
+
+const int8_t DataSet_1_8i::outputs::MDIVV[128] = {
+    (int8_t)0x71,   (int8_t)0xfc,   (int8_t)0xff,   (int8_t)0x09,   (int8_t)0xff,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0xff,
+    (int8_t)0x00,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0x00,   (int8_t)0x0a,   (int8_t)0xfe,   (int8_t)0x00,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0x00,   (int8_t)0xff,   (int8_t)0xa0,   (int8_t)0x00,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0x00,   (int8_t)0x59,   (int8_t)0xff,   (int8_t)0x02,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x01,   (int8_t)0x03,   (int8_t)0xdf,   (int8_t)0xfd,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x00,   (int8_t)0xae,   (int8_t)0x01,   (int8_t)0x01,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x00,   (int8_t)0x09,   (int8_t)0xa4,   (int8_t)0x00,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0x01,   (int8_t)0x22,   (int8_t)0x00,   (int8_t)0xff,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0x00,   (int8_t)0xfe,   (int8_t)0x9e,   (int8_t)0xff,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x01,
+    (int8_t)0x00,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0x00,   (int8_t)0xeb,   (int8_t)0x00,   (int8_t)0xfd,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x01,   (int8_t)0x02,   (int8_t)0xb9,   (int8_t)0x00,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x13,
+    (int8_t)0x02,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0x00,   (int8_t)0x95,   (int8_t)0xff,   (int8_t)0x00,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0x06,   (int8_t)0x00,   (int8_t)0xb3,   (int8_t)0x00,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x02,
+    (int8_t)0x02,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x01,   (int8_t)0x9b,   (int8_t)0x00,   (int8_t)0xfb,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0x01,   (int8_t)0xff,   (int8_t)0xbd,   (int8_t)0x00,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0xf5,
+    (int8_t)0xff,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0xff,   (int8_t)0x6a,   (int8_t)0x00,   (int8_t)0x01,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::DIVS[128] = {
+    (int8_t)0x08,   (int8_t)0xfe,   (int8_t)0x07,   (int8_t)0x00,   (int8_t)0x08,   (int8_t)0xfd,   (int8_t)0x08,   (int8_t)0xf9,
+    (int8_t)0x00,   (int8_t)0x03,   (int8_t)0x02,   (int8_t)0xfe,   (int8_t)0x00,   (int8_t)0x03,   (int8_t)0x00,   (int8_t)0xfd,
+    (int8_t)0xfe,   (int8_t)0xfe,   (int8_t)0x08,   (int8_t)0xfa,   (int8_t)0xfd,   (int8_t)0xf7,   (int8_t)0x00,   (int8_t)0x01,
+    (int8_t)0x00,   (int8_t)0x08,   (int8_t)0xfd,   (int8_t)0xfd,   (int8_t)0x06,   (int8_t)0xfd,   (int8_t)0x06,   (int8_t)0xfc,
+    (int8_t)0x06,   (int8_t)0x07,   (int8_t)0xfa,   (int8_t)0xfe,   (int8_t)0x08,   (int8_t)0xf9,   (int8_t)0x03,   (int8_t)0xfd,
+    (int8_t)0xff,   (int8_t)0x00,   (int8_t)0x02,   (int8_t)0x02,   (int8_t)0xfb,   (int8_t)0xf9,   (int8_t)0x04,   (int8_t)0xf9,
+    (int8_t)0xf9,   (int8_t)0x01,   (int8_t)0x07,   (int8_t)0xfa,   (int8_t)0xfd,   (int8_t)0x00,   (int8_t)0x02,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0xf9,   (int8_t)0xfe,   (int8_t)0xf9,   (int8_t)0x02,   (int8_t)0xff,   (int8_t)0x08,   (int8_t)0xff,
+    (int8_t)0xf8,   (int8_t)0x00,   (int8_t)0x06,   (int8_t)0xf9,   (int8_t)0xf9,   (int8_t)0x05,   (int8_t)0x06,   (int8_t)0x09,
+    (int8_t)0x00,   (int8_t)0xfe,   (int8_t)0xff,   (int8_t)0xfa,   (int8_t)0xff,   (int8_t)0x00,   (int8_t)0xf9,   (int8_t)0xfa,
+    (int8_t)0xfe,   (int8_t)0x06,   (int8_t)0x07,   (int8_t)0xfb,   (int8_t)0x01,   (int8_t)0x04,   (int8_t)0xfa,   (int8_t)0xf8,
+    (int8_t)0x05,   (int8_t)0xfc,   (int8_t)0x09,   (int8_t)0xfd,   (int8_t)0xf9,   (int8_t)0xfa,   (int8_t)0xff,   (int8_t)0x05,
+    (int8_t)0x01,   (int8_t)0xfc,   (int8_t)0x03,   (int8_t)0xfb,   (int8_t)0x01,   (int8_t)0x09,   (int8_t)0x05,   (int8_t)0x04,
+    (int8_t)0x07,   (int8_t)0x05,   (int8_t)0xfb,   (int8_t)0x00,   (int8_t)0xf9,   (int8_t)0x07,   (int8_t)0xfa,   (int8_t)0xfe,
+    (int8_t)0xfd,   (int8_t)0xfa,   (int8_t)0xfb,   (int8_t)0xfc,   (int8_t)0x00,   (int8_t)0x08,   (int8_t)0x00,   (int8_t)0x05,
+    (int8_t)0x05,   (int8_t)0xf8,   (int8_t)0x03,   (int8_t)0x07,   (int8_t)0x07,   (int8_t)0x02,   (int8_t)0x06,   (int8_t)0xff
+};
+
+const int8_t DataSet_1_8i::outputs::MDIVS[128] = {
+    (int8_t)0x71,   (int8_t)0xfe,   (int8_t)0x07,   (int8_t)0x09,   (int8_t)0x08,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0xf9,
+    (int8_t)0x00,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0xfe,   (int8_t)0x0a,   (int8_t)0x03,   (int8_t)0x00,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0xfe,   (int8_t)0x08,   (int8_t)0xa0,   (int8_t)0xfd,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x01,
+    (int8_t)0x00,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0xfd,   (int8_t)0x59,   (int8_t)0xfd,   (int8_t)0x06,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x07,   (int8_t)0xfa,   (int8_t)0xdf,   (int8_t)0x08,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0xfd,
+    (int8_t)0xff,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x02,   (int8_t)0xae,   (int8_t)0xf9,   (int8_t)0x04,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x01,   (int8_t)0x07,   (int8_t)0xa4,   (int8_t)0xfd,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0xf9,   (int8_t)0x22,   (int8_t)0xff,   (int8_t)0x08,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0x00,   (int8_t)0x06,   (int8_t)0x9e,   (int8_t)0xf9,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x09,
+    (int8_t)0x00,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0xfa,   (int8_t)0xeb,   (int8_t)0x00,   (int8_t)0xf9,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x06,   (int8_t)0x07,   (int8_t)0xb9,   (int8_t)0x01,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0xf8,
+    (int8_t)0x05,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0xfd,   (int8_t)0x95,   (int8_t)0xfa,   (int8_t)0xff,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0xfc,   (int8_t)0x03,   (int8_t)0xb3,   (int8_t)0x01,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x04,
+    (int8_t)0x07,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x00,   (int8_t)0x9b,   (int8_t)0x07,   (int8_t)0xfa,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0xfa,   (int8_t)0xfb,   (int8_t)0xbd,   (int8_t)0x00,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x05,
+    (int8_t)0x05,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x07,   (int8_t)0x6a,   (int8_t)0x02,   (int8_t)0x06,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::RCP[128] = {
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x01,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x01,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00
+};
+
+const int8_t DataSet_1_8i::outputs::MRCP[128] = {
+    (int8_t)0x71,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x09,   (int8_t)0x00,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0x00,   (int8_t)0x0a,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xa0,   (int8_t)0x00,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x00,
+    (int8_t)0x01,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0x00,   (int8_t)0x59,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xdf,   (int8_t)0x00,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x00,   (int8_t)0xae,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xa4,   (int8_t)0x00,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x00,
+    (int8_t)0x01,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0x00,   (int8_t)0x22,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x9e,   (int8_t)0x00,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0x00,   (int8_t)0xeb,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xb9,   (int8_t)0x00,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0x00,   (int8_t)0x95,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xb3,   (int8_t)0x00,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x00,   (int8_t)0x9b,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xbd,   (int8_t)0x00,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x00,   (int8_t)0x6a,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::RCPS[128] = {
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x01,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0xff,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x01,   (int8_t)0x00,   (int8_t)0x04,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xfd,   (int8_t)0x01,
+    (int8_t)0x0e,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0xff,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xff,   (int8_t)0x00,   (int8_t)0x01,
+    (int8_t)0x0e,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0xff,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x01,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x01,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x01,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x01,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xfc,   (int8_t)0x00,   (int8_t)0x01,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00
+};
+
+const int8_t DataSet_1_8i::outputs::MRCPS[128] = {
+    (int8_t)0x71,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x09,   (int8_t)0x00,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0x00,
+    (int8_t)0xff,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0x00,   (int8_t)0x0a,   (int8_t)0x00,   (int8_t)0x04,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xa0,   (int8_t)0x00,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x01,
+    (int8_t)0x0e,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0x00,   (int8_t)0x59,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xdf,   (int8_t)0x00,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x00,   (int8_t)0xae,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xa4,   (int8_t)0x00,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x01,
+    (int8_t)0x0e,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0x00,   (int8_t)0x22,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0xff,   (int8_t)0x00,   (int8_t)0x9e,   (int8_t)0x00,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x00,
+    (int8_t)0x01,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0x00,   (int8_t)0xeb,   (int8_t)0x01,   (int8_t)0x00,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xb9,   (int8_t)0x00,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0x00,   (int8_t)0x95,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xb3,   (int8_t)0x00,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x01,   (int8_t)0x9b,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xbd,   (int8_t)0xfc,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x00,   (int8_t)0x6a,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xeb
+};
+
+const bool DataSet_1_8i::outputs::CMPEQV[128] = {
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false
+};
+
+const bool DataSet_1_8i::outputs::CMPEQS[128] = {
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  true,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    true,   false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  false,  false,  false,  false,  false,  false,  false
+};
+
+const bool DataSet_1_8i::outputs::CMPNEV[128] = {
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true
+};
+
+const bool DataSet_1_8i::outputs::CMPNES[128] = {
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   false,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    false,  true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   true,   true,   true,   true,   true,   true,   true
+};
+
+const bool DataSet_1_8i::outputs::CMPGTV[128] = {
+    true,   false,  true,   true,   true,   false,  true,   false,
+    false,  true,   true,   false,  false,  true,   false,  false,
+    false,  true,   true,   false,  false,  false,  true,   false,
+    false,  true,   false,  true,   true,   false,  true,   false,
+    true,   true,   false,  false,  true,   false,  false,  true,
+    false,  false,  true,   false,  false,  false,  true,   false,
+    false,  true,   true,   false,  false,  true,   true,   false,
+    true,   false,  true,   false,  false,  true,   true,   false,
+    false,  false,  true,   false,  false,  true,   true,   true,
+    true,   true,   true,   true,   false,  true,   false,  false,
+    true,   true,   true,   false,  false,  false,  false,  false,
+    true,   false,  true,   false,  false,  false,  true,   true,
+    false,  false,  false,  true,   false,  true,   true,   true,
+    true,   true,   false,  true,   false,  true,   false,  false,
+    false,  false,  false,  true,   true,   true,   false,  true,
+    true,   false,  false,  true,   true,   false,  true,   false
+};
+
+const bool DataSet_1_8i::outputs::CMPGTS[128] = {
+    true,   false,  true,   false,  true,   false,  true,   false,
+    false,  true,   true,   false,  false,  true,   false,  false,
+    false,  false,  true,   false,  false,  false,  false,  false,
+    false,  true,   false,  false,  true,   false,  true,   false,
+    true,   true,   false,  false,  true,   false,  true,   false,
+    false,  false,  true,   true,   false,  false,  true,   false,
+    false,  true,   true,   false,  false,  false,  true,   false,
+    false,  false,  false,  false,  true,   false,  true,   false,
+    false,  false,  true,   false,  false,  true,   true,   true,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  true,   true,   false,  true,   true,   false,  false,
+    true,   false,  true,   false,  false,  false,  false,  true,
+    false,  false,  true,   false,  true,   true,   true,   true,
+    true,   true,   false,  false,  false,  true,   false,  false,
+    false,  false,  false,  false,  false,  true,   false,  true,
+    true,   false,  true,   true,   true,   true,   true,   false
+};
+
+const bool DataSet_1_8i::outputs::CMPLTV[128] = {
+    false,  true,   false,  false,  false,  true,   false,  true,
+    true,   false,  false,  true,   true,   false,  true,   true,
+    true,   false,  false,  true,   true,   true,   false,  true,
+    true,   false,  true,   false,  false,  true,   false,  true,
+    false,  false,  true,   true,   false,  true,   true,   false,
+    true,   true,   false,  true,   true,   true,   false,  true,
+    true,   false,  false,  true,   true,   false,  false,  true,
+    false,  true,   false,  true,   true,   false,  false,  true,
+    true,   true,   false,  true,   true,   false,  false,  false,
+    false,  false,  false,  false,  true,   false,  true,   true,
+    false,  false,  false,  true,   true,   true,   true,   true,
+    false,  true,   false,  true,   true,   true,   false,  false,
+    true,   true,   true,   false,  true,   false,  false,  false,
+    false,  false,  true,   false,  true,   false,  true,   true,
+    true,   true,   true,   false,  false,  false,  true,   false,
+    false,  true,   true,   false,  false,  true,   false,  true
+};
+
+const bool DataSet_1_8i::outputs::CMPLTS[128] = {
+    false,  true,   false,  true,   false,  true,   false,  true,
+    true,   false,  false,  true,   true,   false,  true,   true,
+    true,   true,   false,  true,   true,   true,   true,   false,
+    true,   false,  true,   true,   false,  true,   false,  true,
+    false,  false,  true,   true,   false,  true,   false,  true,
+    true,   true,   false,  false,  true,   true,   false,  true,
+    true,   false,  false,  true,   true,   true,   false,  true,
+    true,   true,   true,   true,   false,  true,   false,  true,
+    true,   true,   false,  true,   true,   false,  false,  false,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   false,  false,  true,   false,  false,  true,   true,
+    false,  true,   false,  true,   true,   true,   true,   false,
+    false,  true,   false,  true,   false,  false,  false,  false,
+    false,  false,  true,   true,   true,   false,  true,   true,
+    true,   true,   true,   true,   true,   false,  true,   false,
+    false,  true,   false,  false,  false,  false,  false,  true
+};
+
+const bool DataSet_1_8i::outputs::CMPGEV[128] = {
+    true,   false,  true,   true,   true,   false,  true,   false,
+    false,  true,   true,   false,  false,  true,   false,  false,
+    false,  true,   true,   false,  false,  false,  true,   false,
+    false,  true,   false,  true,   true,   false,  true,   false,
+    true,   true,   false,  false,  true,   false,  false,  true,
+    false,  false,  true,   false,  false,  false,  true,   false,
+    false,  true,   true,   false,  false,  true,   true,   false,
+    true,   false,  true,   false,  false,  true,   true,   false,
+    false,  false,  true,   false,  false,  true,   true,   true,
+    true,   true,   true,   true,   false,  true,   false,  false,
+    true,   true,   true,   false,  false,  false,  false,  false,
+    true,   false,  true,   false,  false,  false,  true,   true,
+    false,  false,  false,  true,   false,  true,   true,   true,
+    true,   true,   false,  true,   false,  true,   false,  false,
+    false,  false,  false,  true,   true,   true,   false,  true,
+    true,   false,  false,  true,   true,   false,  true,   false
+};
+
+const bool DataSet_1_8i::outputs::CMPGES[128] = {
+    true,   false,  true,   false,  true,   false,  true,   false,
+    false,  true,   true,   false,  false,  true,   false,  false,
+    false,  false,  true,   false,  false,  false,  false,  true,
+    false,  true,   false,  false,  true,   false,  true,   false,
+    true,   true,   false,  false,  true,   false,  true,   false,
+    false,  false,  true,   true,   false,  false,  true,   false,
+    false,  true,   true,   false,  false,  false,  true,   false,
+    false,  false,  false,  false,  true,   false,  true,   false,
+    false,  false,  true,   false,  false,  true,   true,   true,
+    false,  false,  false,  false,  false,  false,  false,  false,
+    false,  true,   true,   false,  true,   true,   false,  false,
+    true,   false,  true,   false,  false,  false,  false,  true,
+    true,   false,  true,   false,  true,   true,   true,   true,
+    true,   true,   false,  false,  false,  true,   false,  false,
+    false,  false,  false,  false,  false,  true,   false,  true,
+    true,   false,  true,   true,   true,   true,   true,   false
+};
+
+const bool DataSet_1_8i::outputs::CMPLEV[128] = {
+    false,  true,   false,  false,  false,  true,   false,  true,
+    true,   false,  false,  true,   true,   false,  true,   true,
+    true,   false,  false,  true,   true,   true,   false,  true,
+    true,   false,  true,   false,  false,  true,   false,  true,
+    false,  false,  true,   true,   false,  true,   true,   false,
+    true,   true,   false,  true,   true,   true,   false,  true,
+    true,   false,  false,  true,   true,   false,  false,  true,
+    false,  true,   false,  true,   true,   false,  false,  true,
+    true,   true,   false,  true,   true,   false,  false,  false,
+    false,  false,  false,  false,  true,   false,  true,   true,
+    false,  false,  false,  true,   true,   true,   true,   true,
+    false,  true,   false,  true,   true,   true,   false,  false,
+    true,   true,   true,   false,  true,   false,  false,  false,
+    false,  false,  true,   false,  true,   false,  true,   true,
+    true,   true,   true,   false,  false,  false,  true,   false,
+    false,  true,   true,   false,  false,  true,   false,  true
+};
+
+const bool DataSet_1_8i::outputs::CMPLES[128] = {
+    false,  true,   false,  true,   false,  true,   false,  true,
+    true,   false,  false,  true,   true,   false,  true,   true,
+    true,   true,   false,  true,   true,   true,   true,   true,
+    true,   false,  true,   true,   false,  true,   false,  true,
+    false,  false,  true,   true,   false,  true,   false,  true,
+    true,   true,   false,  false,  true,   true,   false,  true,
+    true,   false,  false,  true,   true,   true,   false,  true,
+    true,   true,   true,   true,   false,  true,   false,  true,
+    true,   true,   false,  true,   true,   false,  false,  false,
+    true,   true,   true,   true,   true,   true,   true,   true,
+    true,   false,  false,  true,   false,  false,  true,   true,
+    false,  true,   false,  true,   true,   true,   true,   false,
+    true,   true,   false,  true,   false,  false,  false,  false,
+    false,  false,  true,   true,   true,   false,  true,   true,
+    true,   true,   true,   true,   true,   false,  true,   false,
+    false,  true,   false,  false,  false,  false,  false,  true
+};
+
+const bool DataSet_1_8i::outputs::CMPEV = false;
+const bool DataSet_1_8i::outputs::CMPES = false;
+
+const int8_t DataSet_1_8i::outputs::HADD[128] = {
+    (int8_t)0x71,   (int8_t)0x4a,   (int8_t)0xad,   (int8_t)0xb6,   (int8_t)0x2e,   (int8_t)0xff,   (int8_t)0x6f,   (int8_t)0x06,
+    (int8_t)0xfd,   (int8_t)0x32,   (int8_t)0x55,   (int8_t)0x38,   (int8_t)0x42,   (int8_t)0x6e,   (int8_t)0x71,   (int8_t)0x3f,
+    (int8_t)0x17,   (int8_t)0xf0,   (int8_t)0x6d,   (int8_t)0x0d,   (int8_t)0xe0,   (int8_t)0x61,   (int8_t)0x5d,   (int8_t)0x6b,
+    (int8_t)0x6c,   (int8_t)0xe7,   (int8_t)0xbc,   (int8_t)0x8e,   (int8_t)0xe7,   (int8_t)0xb2,   (int8_t)0x0f,   (int8_t)0xcd,
+    (int8_t)0x28,   (int8_t)0x94,   (int8_t)0x39,   (int8_t)0x18,   (int8_t)0x90,   (int8_t)0x2e,   (int8_t)0x60,   (int8_t)0x2f,
+    (int8_t)0x16,   (int8_t)0x0e,   (int8_t)0x2d,   (int8_t)0x54,   (int8_t)0x02,   (int8_t)0x97,   (int8_t)0xd3,   (int8_t)0x6b,
+    (int8_t)0x06,   (int8_t)0x1e,   (int8_t)0x88,   (int8_t)0x2c,   (int8_t)0xfd,   (int8_t)0xf1,   (int8_t)0x16,   (int8_t)0x20,
+    (int8_t)0x21,   (int8_t)0xb7,   (int8_t)0x98,   (int8_t)0x36,   (int8_t)0x58,   (int8_t)0x40,   (int8_t)0xba,   (int8_t)0xa0,
+    (int8_t)0x26,   (int8_t)0x1c,   (int8_t)0x7d,   (int8_t)0x1b,   (int8_t)0xb2,   (int8_t)0xfd,   (int8_t)0x55,   (int8_t)0xd3,
+    (int8_t)0xdb,   (int8_t)0xbe,   (int8_t)0xaa,   (int8_t)0x54,   (int8_t)0x3f,   (int8_t)0x49,   (int8_t)0xe2,   (int8_t)0x88,
+    (int8_t)0x63,   (int8_t)0xc1,   (int8_t)0x29,   (int8_t)0xe2,   (int8_t)0xf1,   (int8_t)0x2e,   (int8_t)0xd3,   (int8_t)0x5e,
+    (int8_t)0xab,   (int8_t)0x6f,   (int8_t)0xee,   (int8_t)0xbb,   (int8_t)0x50,   (int8_t)0xf7,   (int8_t)0xdf,   (int8_t)0x2c,
+    (int8_t)0x3a,   (int8_t)0xfa,   (int8_t)0x30,   (int8_t)0xe3,   (int8_t)0xf6,   (int8_t)0x75,   (int8_t)0xbc,   (int8_t)0xfa,
+    (int8_t)0x63,   (int8_t)0xab,   (int8_t)0x65,   (int8_t)0x71,   (int8_t)0x0c,   (int8_t)0x7b,   (int8_t)0x22,   (int8_t)0x02,
+    (int8_t)0xd4,   (int8_t)0x77,   (int8_t)0x30,   (int8_t)0xed,   (int8_t)0xea,   (int8_t)0x5c,   (int8_t)0x65,   (int8_t)0xb2,
+    (int8_t)0xfb,   (int8_t)0x89,   (int8_t)0xb9,   (int8_t)0x21,   (int8_t)0x8b,   (int8_t)0xad,   (int8_t)0x0b,   (int8_t)0xf6
+};
+
+const int8_t DataSet_1_8i::outputs::MHADD[128] = {
+    (int8_t)0x00,   (int8_t)0xd9,   (int8_t)0x3c,   (int8_t)0x3c,   (int8_t)0xb4,   (int8_t)0xb4,   (int8_t)0xb4,   (int8_t)0x4b,
+    (int8_t)0x42,   (int8_t)0x42,   (int8_t)0x42,   (int8_t)0x25,   (int8_t)0x25,   (int8_t)0x51,   (int8_t)0x54,   (int8_t)0x54,
+    (int8_t)0x54,   (int8_t)0x2d,   (int8_t)0xaa,   (int8_t)0xaa,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x8b,
+    (int8_t)0x8c,   (int8_t)0x8c,   (int8_t)0x8c,   (int8_t)0x5e,   (int8_t)0x5e,   (int8_t)0x29,   (int8_t)0x86,   (int8_t)0x86,
+    (int8_t)0x86,   (int8_t)0xf2,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x0f,   (int8_t)0x0f,   (int8_t)0x0f,   (int8_t)0xde,
+    (int8_t)0xc5,   (int8_t)0xc5,   (int8_t)0xc5,   (int8_t)0xec,   (int8_t)0xec,   (int8_t)0x81,   (int8_t)0xbd,   (int8_t)0xbd,
+    (int8_t)0xbd,   (int8_t)0xd5,   (int8_t)0x3f,   (int8_t)0x3f,   (int8_t)0x10,   (int8_t)0x10,   (int8_t)0x10,   (int8_t)0x1a,
+    (int8_t)0x1b,   (int8_t)0x1b,   (int8_t)0x1b,   (int8_t)0xb9,   (int8_t)0xb9,   (int8_t)0xa1,   (int8_t)0x1b,   (int8_t)0x1b,
+    (int8_t)0x1b,   (int8_t)0x11,   (int8_t)0x72,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x09,   (int8_t)0x09,   (int8_t)0x87,
+    (int8_t)0x8f,   (int8_t)0x8f,   (int8_t)0x8f,   (int8_t)0x39,   (int8_t)0x39,   (int8_t)0x43,   (int8_t)0xdc,   (int8_t)0xdc,
+    (int8_t)0xdc,   (int8_t)0x3a,   (int8_t)0xa2,   (int8_t)0xa2,   (int8_t)0xb1,   (int8_t)0xb1,   (int8_t)0xb1,   (int8_t)0x3c,
+    (int8_t)0x89,   (int8_t)0x89,   (int8_t)0x89,   (int8_t)0x56,   (int8_t)0x56,   (int8_t)0xfd,   (int8_t)0xe5,   (int8_t)0xe5,
+    (int8_t)0xe5,   (int8_t)0xa5,   (int8_t)0xdb,   (int8_t)0xdb,   (int8_t)0xee,   (int8_t)0xee,   (int8_t)0xee,   (int8_t)0x2c,
+    (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0xa1,   (int8_t)0xa1,   (int8_t)0x10,   (int8_t)0xb7,   (int8_t)0xb7,
+    (int8_t)0xb7,   (int8_t)0x5a,   (int8_t)0x13,   (int8_t)0x13,   (int8_t)0x10,   (int8_t)0x10,   (int8_t)0x10,   (int8_t)0x5d,
+    (int8_t)0xa6,   (int8_t)0xa6,   (int8_t)0xa6,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x30,   (int8_t)0x8e,   (int8_t)0x8e
+};
+
+const int8_t DataSet_1_8i::outputs::HMUL[128] = {
+    (int8_t)0x71,   (int8_t)0xc9,   (int8_t)0xbb,   (int8_t)0x93,   (int8_t)0xe8,   (int8_t)0x68,   (int8_t)0x80,   (int8_t)0x80,
+    (int8_t)0x80,   (int8_t)0x80,   (int8_t)0x80,   (int8_t)0x80,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00
+};
+
+const int8_t DataSet_1_8i::outputs::MHMUL[128] = {
+    (int8_t)0x01,   (int8_t)0xd9,   (int8_t)0xeb,   (int8_t)0xeb,   (int8_t)0x28,   (int8_t)0x28,   (int8_t)0x28,   (int8_t)0x98,
+    (int8_t)0xa8,   (int8_t)0xa8,   (int8_t)0xa8,   (int8_t)0xf8,   (int8_t)0xf8,   (int8_t)0xa0,   (int8_t)0xe0,   (int8_t)0xe0,
+    (int8_t)0xe0,   (int8_t)0xe0,   (int8_t)0x60,   (int8_t)0x60,   (int8_t)0x20,   (int8_t)0x20,   (int8_t)0x20,   (int8_t)0xc0,
+    (int8_t)0xc0,   (int8_t)0xc0,   (int8_t)0xc0,   (int8_t)0x80,   (int8_t)0x80,   (int8_t)0x80,   (int8_t)0x80,   (int8_t)0x80,
+    (int8_t)0x80,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00
+};
+
+const int8_t DataSet_1_8i::outputs::FMULADDV[128] = {
+    (int8_t)0xcb,   (int8_t)0xb6,   (int8_t)0xb5,   (int8_t)0xfc,   (int8_t)0x3d,   (int8_t)0xf1,   (int8_t)0x0a,   (int8_t)0xd1,
+    (int8_t)0xec,   (int8_t)0x5c,   (int8_t)0x26,   (int8_t)0x85,   (int8_t)0xe3,   (int8_t)0xa6,   (int8_t)0x44,   (int8_t)0x88,
+    (int8_t)0xbf,   (int8_t)0xe0,   (int8_t)0xa0,   (int8_t)0x4a,   (int8_t)0xc5,   (int8_t)0x8f,   (int8_t)0x49,   (int8_t)0x82,
+    (int8_t)0xc2,   (int8_t)0xbf,   (int8_t)0x3d,   (int8_t)0xbb,   (int8_t)0xec,   (int8_t)0xf8,   (int8_t)0x70,   (int8_t)0x03,
+    (int8_t)0x99,   (int8_t)0xe9,   (int8_t)0x8c,   (int8_t)0xba,   (int8_t)0xd7,   (int8_t)0xf6,   (int8_t)0xca,   (int8_t)0x95,
+    (int8_t)0xba,   (int8_t)0x81,   (int8_t)0x1a,   (int8_t)0x94,   (int8_t)0xb1,   (int8_t)0x4f,   (int8_t)0x46,   (int8_t)0x78,
+    (int8_t)0x17,   (int8_t)0x14,   (int8_t)0x94,   (int8_t)0x71,   (int8_t)0xdc,   (int8_t)0xfa,   (int8_t)0xb1,   (int8_t)0xbd,
+    (int8_t)0x40,   (int8_t)0x20,   (int8_t)0xb8,   (int8_t)0x0b,   (int8_t)0x20,   (int8_t)0x69,   (int8_t)0x3f,   (int8_t)0xf6,
+    (int8_t)0xbc,   (int8_t)0x10,   (int8_t)0xa4,   (int8_t)0xe2,   (int8_t)0xba,   (int8_t)0xf6,   (int8_t)0x33,   (int8_t)0x18,
+    (int8_t)0x94,   (int8_t)0x08,   (int8_t)0x46,   (int8_t)0x5b,   (int8_t)0xc9,   (int8_t)0x63,   (int8_t)0xd0,   (int8_t)0xf9,
+    (int8_t)0xb6,   (int8_t)0xcf,   (int8_t)0x70,   (int8_t)0x37,   (int8_t)0x0c,   (int8_t)0x0a,   (int8_t)0x25,   (int8_t)0x66,
+    (int8_t)0x73,   (int8_t)0xe5,   (int8_t)0x69,   (int8_t)0x13,   (int8_t)0x5e,   (int8_t)0xbf,   (int8_t)0xa9,   (int8_t)0xb7,
+    (int8_t)0x61,   (int8_t)0x63,   (int8_t)0xa0,   (int8_t)0x62,   (int8_t)0xa5,   (int8_t)0xd4,   (int8_t)0x05,   (int8_t)0x15,
+    (int8_t)0x89,   (int8_t)0xc8,   (int8_t)0xbf,   (int8_t)0xa8,   (int8_t)0x89,   (int8_t)0xe4,   (int8_t)0x1a,   (int8_t)0xf5,
+    (int8_t)0xc2,   (int8_t)0xe0,   (int8_t)0xdf,   (int8_t)0x59,   (int8_t)0x28,   (int8_t)0x48,   (int8_t)0x0e,   (int8_t)0x6b,
+    (int8_t)0xd9,   (int8_t)0xd3,   (int8_t)0x51,   (int8_t)0xe1,   (int8_t)0x41,   (int8_t)0xde,   (int8_t)0xcb,   (int8_t)0x80
+};
+
+const int8_t DataSet_1_8i::outputs::MFMULADDV[128] = {
+    (int8_t)0x71,   (int8_t)0xb6,   (int8_t)0xb5,   (int8_t)0x09,   (int8_t)0x3d,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0xd1,
+    (int8_t)0xec,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0x85,   (int8_t)0x0a,   (int8_t)0xa6,   (int8_t)0x44,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0xe0,   (int8_t)0xa0,   (int8_t)0xa0,   (int8_t)0xc5,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x82,
+    (int8_t)0xc2,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0xbb,   (int8_t)0x59,   (int8_t)0xf8,   (int8_t)0x70,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0xe9,   (int8_t)0x8c,   (int8_t)0xdf,   (int8_t)0xd7,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0x95,
+    (int8_t)0xba,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x94,   (int8_t)0xae,   (int8_t)0x4f,   (int8_t)0x46,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x14,   (int8_t)0x94,   (int8_t)0xa4,   (int8_t)0xdc,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0xbd,
+    (int8_t)0x40,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0x0b,   (int8_t)0x22,   (int8_t)0x69,   (int8_t)0x3f,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0x10,   (int8_t)0xa4,   (int8_t)0x9e,   (int8_t)0xba,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x18,
+    (int8_t)0x94,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0x5b,   (int8_t)0xeb,   (int8_t)0x63,   (int8_t)0xd0,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0xcf,   (int8_t)0x70,   (int8_t)0xb9,   (int8_t)0x0c,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x66,
+    (int8_t)0x73,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0x13,   (int8_t)0x95,   (int8_t)0xbf,   (int8_t)0xa9,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0x63,   (int8_t)0xa0,   (int8_t)0xb3,   (int8_t)0xa5,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x15,
+    (int8_t)0x89,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0xa8,   (int8_t)0x9b,   (int8_t)0xe4,   (int8_t)0x1a,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0xe0,   (int8_t)0xdf,   (int8_t)0xbd,   (int8_t)0x28,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x6b,
+    (int8_t)0xd9,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0xe1,   (int8_t)0x6a,   (int8_t)0xde,   (int8_t)0xcb,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::FMULSUBV[128] = {
+    (int8_t)0x11,   (int8_t)0xda,   (int8_t)0x3f,   (int8_t)0xc0,   (int8_t)0x13,   (int8_t)0x45,   (int8_t)0x96,   (int8_t)0x27,
+    (int8_t)0x3a,   (int8_t)0x84,   (int8_t)0x98,   (int8_t)0x57,   (int8_t)0x95,   (int8_t)0x32,   (int8_t)0x26,   (int8_t)0x10,
+    (int8_t)0xa1,   (int8_t)0xae,   (int8_t)0x04,   (int8_t)0xb6,   (int8_t)0xb9,   (int8_t)0xc9,   (int8_t)0x97,   (int8_t)0x4e,
+    (int8_t)0x76,   (int8_t)0xa3,   (int8_t)0xb5,   (int8_t)0x11,   (int8_t)0xc0,   (int8_t)0x78,   (int8_t)0xfe,   (int8_t)0x95,
+    (int8_t)0x1f,   (int8_t)0xa7,   (int8_t)0x84,   (int8_t)0x24,   (int8_t)0x29,   (int8_t)0x1e,   (int8_t)0xba,   (int8_t)0xc5,
+    (int8_t)0xa6,   (int8_t)0x4f,   (int8_t)0x3e,   (int8_t)0xcc,   (int8_t)0x7f,   (int8_t)0x17,   (int8_t)0x7a,   (int8_t)0x08,
+    (int8_t)0x69,   (int8_t)0x9c,   (int8_t)0x88,   (int8_t)0xe7,   (int8_t)0x1c,   (int8_t)0xae,   (int8_t)0xb7,   (int8_t)0xd7,
+    (int8_t)0x0e,   (int8_t)0xe8,   (int8_t)0x12,   (int8_t)0x81,   (int8_t)0xd0,   (int8_t)0x47,   (int8_t)0x41,   (int8_t)0xe2,
+    (int8_t)0x30,   (int8_t)0xdc,   (int8_t)0xd6,   (int8_t)0x9a,   (int8_t)0x16,   (int8_t)0x86,   (int8_t)0x1d,   (int8_t)0x28,
+    (int8_t)0x6c,   (int8_t)0x1e,   (int8_t)0xea,   (int8_t)0xc5,   (int8_t)0xf1,   (int8_t)0xcd,   (int8_t)0x76,   (int8_t)0x57,
+    (int8_t)0x6c,   (int8_t)0x55,   (int8_t)0xf0,   (int8_t)0x3f,   (int8_t)0x90,   (int8_t)0xcc,   (int8_t)0x3f,   (int8_t)0x16,
+    (int8_t)0x67,   (int8_t)0xc3,   (int8_t)0xad,   (int8_t)0x7d,   (int8_t)0xd2,   (int8_t)0xef,   (int8_t)0x27,   (int8_t)0x37,
+    (int8_t)0x4f,   (int8_t)0x9d,   (int8_t)0x04,   (int8_t)0x9c,   (int8_t)0xdd,   (int8_t)0x44,   (int8_t)0xad,   (int8_t)0x7b,
+    (int8_t)0xff,   (int8_t)0x98,   (int8_t)0x81,   (int8_t)0x18,   (int8_t)0xb1,   (int8_t)0xea,   (int8_t)0xc6,   (int8_t)0x8b,
+    (int8_t)0xa6,   (int8_t)0x40,   (int8_t)0x7f,   (int8_t)0xc3,   (int8_t)0xd2,   (int8_t)0x40,   (int8_t)0x22,   (int8_t)0x5f,
+    (int8_t)0x37,   (int8_t)0xe5,   (int8_t)0xcf,   (int8_t)0x7f,   (int8_t)0x03,   (int8_t)0x6e,   (int8_t)0x49,   (int8_t)0x10
+};
+
+const int8_t DataSet_1_8i::outputs::MFMULSUBV[128] = {
+    (int8_t)0x71,   (int8_t)0xda,   (int8_t)0x3f,   (int8_t)0x09,   (int8_t)0x13,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0x27,
+    (int8_t)0x3a,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0x57,   (int8_t)0x0a,   (int8_t)0x32,   (int8_t)0x26,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0xae,   (int8_t)0x04,   (int8_t)0xa0,   (int8_t)0xb9,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x4e,
+    (int8_t)0x76,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0x11,   (int8_t)0x59,   (int8_t)0x78,   (int8_t)0xfe,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0xa7,   (int8_t)0x84,   (int8_t)0xdf,   (int8_t)0x29,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0xc5,
+    (int8_t)0xa6,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0xcc,   (int8_t)0xae,   (int8_t)0x17,   (int8_t)0x7a,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x9c,   (int8_t)0x88,   (int8_t)0xa4,   (int8_t)0x1c,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0xd7,
+    (int8_t)0x0e,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0x81,   (int8_t)0x22,   (int8_t)0x47,   (int8_t)0x41,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0xdc,   (int8_t)0xd6,   (int8_t)0x9e,   (int8_t)0x16,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x28,
+    (int8_t)0x6c,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0xc5,   (int8_t)0xeb,   (int8_t)0xcd,   (int8_t)0x76,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x55,   (int8_t)0xf0,   (int8_t)0xb9,   (int8_t)0x90,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x16,
+    (int8_t)0x67,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0x7d,   (int8_t)0x95,   (int8_t)0xef,   (int8_t)0x27,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0x9d,   (int8_t)0x04,   (int8_t)0xb3,   (int8_t)0xdd,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x7b,
+    (int8_t)0xff,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x18,   (int8_t)0x9b,   (int8_t)0xea,   (int8_t)0xc6,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0x40,   (int8_t)0x7f,   (int8_t)0xbd,   (int8_t)0xd2,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x5f,
+    (int8_t)0x37,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x7f,   (int8_t)0x6a,   (int8_t)0x6e,   (int8_t)0x49,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::FADDMULV[128] = {
+    (int8_t)0x63,   (int8_t)0x2e,   (int8_t)0x9b,   (int8_t)0x72,   (int8_t)0xdf,   (int8_t)0xa8,   (int8_t)0xae,   (int8_t)0xd7,
+    (int8_t)0xdc,   (int8_t)0x9c,   (int8_t)0x08,   (int8_t)0x9b,   (int8_t)0x30,   (int8_t)0x92,   (int8_t)0x36,   (int8_t)0x20,
+    (int8_t)0xb6,   (int8_t)0xb8,   (int8_t)0x42,   (int8_t)0x30,   (int8_t)0x50,   (int8_t)0xe7,   (int8_t)0xe0,   (int8_t)0xe4,
+    (int8_t)0xce,   (int8_t)0x64,   (int8_t)0x28,   (int8_t)0xd1,   (int8_t)0xaa,   (int8_t)0xc0,   (int8_t)0x80,   (int8_t)0x68,
+    (int8_t)0x33,   (int8_t)0x02,   (int8_t)0x34,   (int8_t)0x70,   (int8_t)0xe8,   (int8_t)0x4c,   (int8_t)0x58,   (int8_t)0x50,
+    (int8_t)0xa6,   (int8_t)0x53,   (int8_t)0x6a,   (int8_t)0x7c,   (int8_t)0xf2,   (int8_t)0x90,   (int8_t)0xd8,   (int8_t)0x80,
+    (int8_t)0x6d,   (int8_t)0xbc,   (int8_t)0xbe,   (int8_t)0xf3,   (int8_t)0x60,   (int8_t)0x6e,   (int8_t)0xa5,   (int8_t)0x51,
+    (int8_t)0x68,   (int8_t)0x10,   (int8_t)0x12,   (int8_t)0x37,   (int8_t)0xb0,   (int8_t)0xbf,   (int8_t)0xe6,   (int8_t)0xf0,
+    (int8_t)0xda,   (int8_t)0x16,   (int8_t)0xf2,   (int8_t)0x1c,   (int8_t)0x0e,   (int8_t)0x98,   (int8_t)0x2d,   (int8_t)0x90,
+    (int8_t)0x20,   (int8_t)0x04,   (int8_t)0x64,   (int8_t)0x06,   (int8_t)0xd8,   (int8_t)0xa2,   (int8_t)0xa4,   (int8_t)0xa2,
+    (int8_t)0x96,   (int8_t)0xd1,   (int8_t)0x80,   (int8_t)0xd0,   (int8_t)0x7e,   (int8_t)0xfc,   (int8_t)0x5d,   (int8_t)0x48,
+    (int8_t)0x94,   (int8_t)0x19,   (int8_t)0x98,   (int8_t)0x07,   (int8_t)0x8e,   (int8_t)0xc0,   (int8_t)0x49,   (int8_t)0x00,
+    (int8_t)0x52,   (int8_t)0x62,   (int8_t)0xce,   (int8_t)0xa8,   (int8_t)0xf8,   (int8_t)0xd8,   (int8_t)0x88,   (int8_t)0x12,
+    (int8_t)0x81,   (int8_t)0xd0,   (int8_t)0xb6,   (int8_t)0xa0,   (int8_t)0xd8,   (int8_t)0x18,   (int8_t)0x86,   (int8_t)0xe6,
+    (int8_t)0x88,   (int8_t)0x70,   (int8_t)0x00,   (int8_t)0x81,   (int8_t)0x2a,   (int8_t)0x90,   (int8_t)0x36,   (int8_t)0xa4,
+    (int8_t)0xe1,   (int8_t)0x10,   (int8_t)0xe3,   (int8_t)0x26,   (int8_t)0x89,   (int8_t)0x18,   (int8_t)0xe9,   (int8_t)0x28
+};
+
+const int8_t DataSet_1_8i::outputs::MFADDMULV[128] = {
+    (int8_t)0x71,   (int8_t)0x2e,   (int8_t)0x9b,   (int8_t)0x09,   (int8_t)0xdf,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0xd7,
+    (int8_t)0xdc,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0x9b,   (int8_t)0x0a,   (int8_t)0x92,   (int8_t)0x36,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0xb8,   (int8_t)0x42,   (int8_t)0xa0,   (int8_t)0x50,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0xe4,
+    (int8_t)0xce,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0xd1,   (int8_t)0x59,   (int8_t)0xc0,   (int8_t)0x80,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x02,   (int8_t)0x34,   (int8_t)0xdf,   (int8_t)0xe8,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0x50,
+    (int8_t)0xa6,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x7c,   (int8_t)0xae,   (int8_t)0x90,   (int8_t)0xd8,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0xbc,   (int8_t)0xbe,   (int8_t)0xa4,   (int8_t)0x60,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x51,
+    (int8_t)0x68,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0x37,   (int8_t)0x22,   (int8_t)0xbf,   (int8_t)0xe6,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0x16,   (int8_t)0xf2,   (int8_t)0x9e,   (int8_t)0x0e,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x90,
+    (int8_t)0x20,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0x06,   (int8_t)0xeb,   (int8_t)0xa2,   (int8_t)0xa4,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0xd1,   (int8_t)0x80,   (int8_t)0xb9,   (int8_t)0x7e,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x48,
+    (int8_t)0x94,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0x07,   (int8_t)0x95,   (int8_t)0xc0,   (int8_t)0x49,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0x62,   (int8_t)0xce,   (int8_t)0xb3,   (int8_t)0xf8,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x12,
+    (int8_t)0x81,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0xa0,   (int8_t)0x9b,   (int8_t)0x18,   (int8_t)0x86,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0x70,   (int8_t)0x00,   (int8_t)0xbd,   (int8_t)0x2a,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0xa4,
+    (int8_t)0xe1,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x26,   (int8_t)0x6a,   (int8_t)0x18,   (int8_t)0xe9,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::FSUBMULV[128] = {
+    (int8_t)0xb7,   (int8_t)0x4e,   (int8_t)0x07,   (int8_t)0xaa,   (int8_t)0xd1,   (int8_t)0xc4,   (int8_t)0x12,   (int8_t)0x6f,
+    (int8_t)0xe2,   (int8_t)0x1c,   (int8_t)0x62,   (int8_t)0x2f,   (int8_t)0xdc,   (int8_t)0x5e,   (int8_t)0x24,   (int8_t)0x70,
+    (int8_t)0x9a,   (int8_t)0xaa,   (int8_t)0xea,   (int8_t)0x50,   (int8_t)0x94,   (int8_t)0xdf,   (int8_t)0x58,   (int8_t)0xf4,
+    (int8_t)0x7e,   (int8_t)0x10,   (int8_t)0x00,   (int8_t)0xa3,   (int8_t)0xa2,   (int8_t)0xc0,   (int8_t)0xea,   (int8_t)0x3c,
+    (int8_t)0x2b,   (int8_t)0xd6,   (int8_t)0xf4,   (int8_t)0x3a,   (int8_t)0xa8,   (int8_t)0x04,   (int8_t)0xc8,   (int8_t)0xe0,
+    (int8_t)0x66,   (int8_t)0x1d,   (int8_t)0x3a,   (int8_t)0xfc,   (int8_t)0x0a,   (int8_t)0x08,   (int8_t)0xf8,   (int8_t)0x00,
+    (int8_t)0xed,   (int8_t)0x84,   (int8_t)0x3a,   (int8_t)0x75,   (int8_t)0x60,   (int8_t)0x02,   (int8_t)0x7d,   (int8_t)0xab,
+    (int8_t)0xca,   (int8_t)0xc0,   (int8_t)0xd4,   (int8_t)0xf5,   (int8_t)0xf0,   (int8_t)0x11,   (int8_t)0x26,   (int8_t)0x08,
+    (int8_t)0x6e,   (int8_t)0xe2,   (int8_t)0x1c,   (int8_t)0x54,   (int8_t)0xae,   (int8_t)0x38,   (int8_t)0x63,   (int8_t)0x90,
+    (int8_t)0x20,   (int8_t)0x7a,   (int8_t)0x6c,   (int8_t)0x96,   (int8_t)0x70,   (int8_t)0x3a,   (int8_t)0x26,   (int8_t)0x6a,
+    (int8_t)0xb8,   (int8_t)0xfb,   (int8_t)0x80,   (int8_t)0x68,   (int8_t)0xc6,   (int8_t)0xca,   (int8_t)0xe1,   (int8_t)0x28,
+    (int8_t)0x08,   (int8_t)0xef,   (int8_t)0xac,   (int8_t)0x17,   (int8_t)0xee,   (int8_t)0xf0,   (int8_t)0x87,   (int8_t)0x80,
+    (int8_t)0xaa,   (int8_t)0x1e,   (int8_t)0x1a,   (int8_t)0xca,   (int8_t)0xe0,   (int8_t)0x98,   (int8_t)0xe0,   (int8_t)0x3a,
+    (int8_t)0x19,   (int8_t)0xb0,   (int8_t)0x56,   (int8_t)0x20,   (int8_t)0xf0,   (int8_t)0x4e,   (int8_t)0x46,   (int8_t)0xda,
+    (int8_t)0x70,   (int8_t)0x70,   (int8_t)0x60,   (int8_t)0x3d,   (int8_t)0xd4,   (int8_t)0x00,   (int8_t)0x16,   (int8_t)0xf8,
+    (int8_t)0x51,   (int8_t)0xf4,   (int8_t)0x7d,   (int8_t)0xaa,   (int8_t)0x23,   (int8_t)0xc8,   (int8_t)0xd3,   (int8_t)0xa8
+};
+
+const int8_t DataSet_1_8i::outputs::MFSUBMULV[128] = {
+    (int8_t)0x71,   (int8_t)0x4e,   (int8_t)0x07,   (int8_t)0x09,   (int8_t)0xd1,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0x6f,
+    (int8_t)0xe2,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0x2f,   (int8_t)0x0a,   (int8_t)0x5e,   (int8_t)0x24,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0xaa,   (int8_t)0xea,   (int8_t)0xa0,   (int8_t)0x94,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0xf4,
+    (int8_t)0x7e,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0xa3,   (int8_t)0x59,   (int8_t)0xc0,   (int8_t)0xea,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0xd6,   (int8_t)0xf4,   (int8_t)0xdf,   (int8_t)0xa8,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0xe0,
+    (int8_t)0x66,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0xfc,   (int8_t)0xae,   (int8_t)0x08,   (int8_t)0xf8,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x84,   (int8_t)0x3a,   (int8_t)0xa4,   (int8_t)0x60,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0xab,
+    (int8_t)0xca,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0xf5,   (int8_t)0x22,   (int8_t)0x11,   (int8_t)0x26,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0xe2,   (int8_t)0x1c,   (int8_t)0x9e,   (int8_t)0xae,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x90,
+    (int8_t)0x20,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0x96,   (int8_t)0xeb,   (int8_t)0x3a,   (int8_t)0x26,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0xfb,   (int8_t)0x80,   (int8_t)0xb9,   (int8_t)0xc6,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x28,
+    (int8_t)0x08,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0x17,   (int8_t)0x95,   (int8_t)0xf0,   (int8_t)0x87,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0x1e,   (int8_t)0x1a,   (int8_t)0xb3,   (int8_t)0xe0,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x3a,
+    (int8_t)0x19,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x20,   (int8_t)0x9b,   (int8_t)0x4e,   (int8_t)0x46,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0x70,   (int8_t)0x60,   (int8_t)0xbd,   (int8_t)0xd4,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0xf8,
+    (int8_t)0x51,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0xaa,   (int8_t)0x6a,   (int8_t)0xc8,   (int8_t)0xd3,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::MAXV[128] = {
+    (int8_t)0x71,   (int8_t)0x08,   (int8_t)0x63,   (int8_t)0x09,   (int8_t)0x78,   (int8_t)0x2b,   (int8_t)0x70,   (int8_t)0x64,
+    (int8_t)0x45,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0x3a,   (int8_t)0x46,   (int8_t)0x2c,   (int8_t)0x67,   (int8_t)0x2a,
+    (int8_t)0x12,   (int8_t)0xd9,   (int8_t)0x7d,   (int8_t)0x18,   (int8_t)0x65,   (int8_t)0xac,   (int8_t)0xfc,   (int8_t)0x2c,
+    (int8_t)0x1c,   (int8_t)0x7b,   (int8_t)0x15,   (int8_t)0xd2,   (int8_t)0x59,   (int8_t)0x28,   (int8_t)0x5d,   (int8_t)0x1a,
+    (int8_t)0x5b,   (int8_t)0x6c,   (int8_t)0xe8,   (int8_t)0x71,   (int8_t)0x78,   (int8_t)0x6b,   (int8_t)0x49,   (int8_t)0xcf,
+    (int8_t)0x50,   (int8_t)0x53,   (int8_t)0x1f,   (int8_t)0x50,   (int8_t)0x14,   (int8_t)0xa7,   (int8_t)0x3c,   (int8_t)0x18,
+    (int8_t)0xc0,   (int8_t)0x18,   (int8_t)0x6a,   (int8_t)0xb3,   (int8_t)0x3c,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x21,
+    (int8_t)0x01,   (int8_t)0xc6,   (int8_t)0xe1,   (int8_t)0xad,   (int8_t)0x7c,   (int8_t)0xe8,   (int8_t)0x7a,   (int8_t)0x32,
+    (int8_t)0x69,   (int8_t)0x41,   (int8_t)0x61,   (int8_t)0x71,   (int8_t)0x58,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x7e,
+    (int8_t)0x08,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0xaa,   (int8_t)0x57,   (int8_t)0x0a,   (int8_t)0x1b,   (int8_t)0x5c,
+    (int8_t)0xdb,   (int8_t)0x5e,   (int8_t)0x68,   (int8_t)0x13,   (int8_t)0x52,   (int8_t)0x47,   (int8_t)0x4a,   (int8_t)0xfa,
+    (int8_t)0x4d,   (int8_t)0xc5,   (int8_t)0x7f,   (int8_t)0x68,   (int8_t)0x38,   (int8_t)0x51,   (int8_t)0xe8,   (int8_t)0x4d,
+    (int8_t)0x34,   (int8_t)0xf6,   (int8_t)0x4b,   (int8_t)0xb3,   (int8_t)0x5b,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x3e,
+    (int8_t)0x69,   (int8_t)0x48,   (int8_t)0xd0,   (int8_t)0x0c,   (int8_t)0xa7,   (int8_t)0x6f,   (int8_t)0x10,   (int8_t)0x2e,
+    (int8_t)0x4a,   (int8_t)0xb0,   (int8_t)0x27,   (int8_t)0xbd,   (int8_t)0xfd,   (int8_t)0x72,   (int8_t)0x58,   (int8_t)0x4d,
+    (int8_t)0x49,   (int8_t)0xe2,   (int8_t)0x73,   (int8_t)0x68,   (int8_t)0x6a,   (int8_t)0x23,   (int8_t)0x5e,   (int8_t)0x58
+};
+
+const int8_t DataSet_1_8i::outputs::MMAXV[128] = {
+    (int8_t)0x71,   (int8_t)0x08,   (int8_t)0x63,   (int8_t)0x09,   (int8_t)0x78,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0x64,
+    (int8_t)0x45,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0x3a,   (int8_t)0x0a,   (int8_t)0x2c,   (int8_t)0x67,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0xd9,   (int8_t)0x7d,   (int8_t)0xa0,   (int8_t)0x65,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x2c,
+    (int8_t)0x1c,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0xd2,   (int8_t)0x59,   (int8_t)0x28,   (int8_t)0x5d,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x6c,   (int8_t)0xe8,   (int8_t)0xdf,   (int8_t)0x78,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0xcf,
+    (int8_t)0x50,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x50,   (int8_t)0xae,   (int8_t)0xa7,   (int8_t)0x3c,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x18,   (int8_t)0x6a,   (int8_t)0xa4,   (int8_t)0x3c,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x21,
+    (int8_t)0x01,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0xad,   (int8_t)0x22,   (int8_t)0xe8,   (int8_t)0x7a,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0x41,   (int8_t)0x61,   (int8_t)0x9e,   (int8_t)0x58,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x7e,
+    (int8_t)0x08,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0xaa,   (int8_t)0xeb,   (int8_t)0x0a,   (int8_t)0x1b,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x5e,   (int8_t)0x68,   (int8_t)0xb9,   (int8_t)0x52,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0xfa,
+    (int8_t)0x4d,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0x68,   (int8_t)0x95,   (int8_t)0x51,   (int8_t)0xe8,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0xf6,   (int8_t)0x4b,   (int8_t)0xb3,   (int8_t)0x5b,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x3e,
+    (int8_t)0x69,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x0c,   (int8_t)0x9b,   (int8_t)0x6f,   (int8_t)0x10,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0xb0,   (int8_t)0x27,   (int8_t)0xbd,   (int8_t)0xfd,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x4d,
+    (int8_t)0x49,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x68,   (int8_t)0x6a,   (int8_t)0x23,   (int8_t)0x5e,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::MAXS[128] = {
+    (int8_t)0x71,   (int8_t)0x0e,   (int8_t)0x63,   (int8_t)0x0e,   (int8_t)0x78,   (int8_t)0x0e,   (int8_t)0x70,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x2c,   (int8_t)0x0e,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x7d,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0x7b,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x59,   (int8_t)0x0e,   (int8_t)0x5d,   (int8_t)0x0e,
+    (int8_t)0x5b,   (int8_t)0x6c,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x78,   (int8_t)0x0e,   (int8_t)0x32,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x1f,   (int8_t)0x27,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x3c,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0x18,   (int8_t)0x6a,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x25,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x22,   (int8_t)0x0e,   (int8_t)0x7a,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x61,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x7e,
+    (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0x5e,   (int8_t)0x68,   (int8_t)0x0e,   (int8_t)0x0f,   (int8_t)0x3d,   (int8_t)0x0e,   (int8_t)0x0e,
+    (int8_t)0x4d,   (int8_t)0x0e,   (int8_t)0x7f,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x36,   (int8_t)0x0e,   (int8_t)0x13,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x3e,
+    (int8_t)0x69,   (int8_t)0x48,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x6f,   (int8_t)0x0e,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x72,   (int8_t)0x0e,   (int8_t)0x4d,
+    (int8_t)0x49,   (int8_t)0x0e,   (int8_t)0x30,   (int8_t)0x68,   (int8_t)0x6a,   (int8_t)0x22,   (int8_t)0x5e,   (int8_t)0x0e
+};
+
+const int8_t DataSet_1_8i::outputs::MMAXS[128] = {
+    (int8_t)0x71,   (int8_t)0x0e,   (int8_t)0x63,   (int8_t)0x09,   (int8_t)0x78,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0x0e,   (int8_t)0x0a,   (int8_t)0x2c,   (int8_t)0x0e,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0x0e,   (int8_t)0x7d,   (int8_t)0xa0,   (int8_t)0x0e,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0x0e,   (int8_t)0x59,   (int8_t)0x0e,   (int8_t)0x5d,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x6c,   (int8_t)0x0e,   (int8_t)0xdf,   (int8_t)0x78,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x27,   (int8_t)0xae,   (int8_t)0x0e,   (int8_t)0x3c,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x18,   (int8_t)0x6a,   (int8_t)0xa4,   (int8_t)0x0e,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0x0e,   (int8_t)0x22,   (int8_t)0x0e,   (int8_t)0x7a,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0x0e,   (int8_t)0x61,   (int8_t)0x9e,   (int8_t)0x0e,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x7e,
+    (int8_t)0x0e,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0x0e,   (int8_t)0xeb,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x5e,   (int8_t)0x68,   (int8_t)0xb9,   (int8_t)0x0f,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x0e,
+    (int8_t)0x4d,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0x0e,   (int8_t)0x95,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x36,   (int8_t)0xb3,   (int8_t)0x13,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x3e,
+    (int8_t)0x69,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x0e,   (int8_t)0x9b,   (int8_t)0x6f,   (int8_t)0x0e,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0xbd,   (int8_t)0x0e,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x4d,
+    (int8_t)0x49,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x68,   (int8_t)0x6a,   (int8_t)0x22,   (int8_t)0x5e,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::MINV[128] = {
+    (int8_t)0xce,   (int8_t)0xd9,   (int8_t)0xbe,   (int8_t)0xee,   (int8_t)0xab,   (int8_t)0xd1,   (int8_t)0x53,   (int8_t)0x97,
+    (int8_t)0xf7,   (int8_t)0x30,   (int8_t)0x95,   (int8_t)0xe3,   (int8_t)0x0a,   (int8_t)0xf1,   (int8_t)0x03,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0x9f,   (int8_t)0xba,   (int8_t)0xa0,   (int8_t)0xd3,   (int8_t)0x81,   (int8_t)0xe4,   (int8_t)0x0e,
+    (int8_t)0x01,   (int8_t)0xc3,   (int8_t)0xd5,   (int8_t)0xbb,   (int8_t)0xc6,   (int8_t)0xcb,   (int8_t)0x23,   (int8_t)0xbe,
+    (int8_t)0x54,   (int8_t)0x56,   (int8_t)0xa5,   (int8_t)0xdf,   (int8_t)0xe0,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0xc3,
+    (int8_t)0xe7,   (int8_t)0xf8,   (int8_t)0xd4,   (int8_t)0x27,   (int8_t)0xae,   (int8_t)0x95,   (int8_t)0x28,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x89,   (int8_t)0x0b,   (int8_t)0xa4,   (int8_t)0xd1,   (int8_t)0xd9,   (int8_t)0xa4,   (int8_t)0x0a,
+    (int8_t)0xa7,   (int8_t)0x96,   (int8_t)0x85,   (int8_t)0x9e,   (int8_t)0x22,   (int8_t)0xe7,   (int8_t)0xa0,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0xf6,   (int8_t)0xdd,   (int8_t)0x9e,   (int8_t)0x97,   (int8_t)0xfa,   (int8_t)0x4f,   (int8_t)0x70,
+    (int8_t)0xe0,   (int8_t)0x91,   (int8_t)0xb2,   (int8_t)0xa8,   (int8_t)0xeb,   (int8_t)0x9c,   (int8_t)0x99,   (int8_t)0xa6,
+    (int8_t)0x83,   (int8_t)0x47,   (int8_t)0x2e,   (int8_t)0xb9,   (int8_t)0x0f,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x8b,
+    (int8_t)0x21,   (int8_t)0xc4,   (int8_t)0x75,   (int8_t)0xcd,   (int8_t)0x95,   (int8_t)0xa7,   (int8_t)0xa1,   (int8_t)0xd3,
+    (int8_t)0x0e,   (int8_t)0xc0,   (int8_t)0x36,   (int8_t)0x85,   (int8_t)0x13,   (int8_t)0xf4,   (int8_t)0xdf,   (int8_t)0x1c,
+    (int8_t)0x24,   (int8_t)0x16,   (int8_t)0xba,   (int8_t)0x08,   (int8_t)0x9b,   (int8_t)0x89,   (int8_t)0xa7,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0xa3,   (int8_t)0xb9,   (int8_t)0xa6,   (int8_t)0x81,   (int8_t)0xb2,   (int8_t)0x09,   (int8_t)0xf9,
+    (int8_t)0xc8,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x9e,   (int8_t)0xed,   (int8_t)0x22,   (int8_t)0x4b,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::MMINV[128] = {
+    (int8_t)0x71,   (int8_t)0xd9,   (int8_t)0xbe,   (int8_t)0x09,   (int8_t)0xab,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0x97,
+    (int8_t)0xf7,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0xe3,   (int8_t)0x0a,   (int8_t)0xf1,   (int8_t)0x03,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0x9f,   (int8_t)0xba,   (int8_t)0xa0,   (int8_t)0xd3,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x0e,
+    (int8_t)0x01,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0xbb,   (int8_t)0x59,   (int8_t)0xcb,   (int8_t)0x23,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x56,   (int8_t)0xa5,   (int8_t)0xdf,   (int8_t)0xe0,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0xc3,
+    (int8_t)0xe7,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x27,   (int8_t)0xae,   (int8_t)0x95,   (int8_t)0x28,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x89,   (int8_t)0x0b,   (int8_t)0xa4,   (int8_t)0xd1,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x0a,
+    (int8_t)0xa7,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0x9e,   (int8_t)0x22,   (int8_t)0xe7,   (int8_t)0xa0,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0xf6,   (int8_t)0xdd,   (int8_t)0x9e,   (int8_t)0x97,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x70,
+    (int8_t)0xe0,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0xa8,   (int8_t)0xeb,   (int8_t)0x9c,   (int8_t)0x99,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x47,   (int8_t)0x2e,   (int8_t)0xb9,   (int8_t)0x0f,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x8b,
+    (int8_t)0x21,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0xcd,   (int8_t)0x95,   (int8_t)0xa7,   (int8_t)0xa1,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0xc0,   (int8_t)0x36,   (int8_t)0xb3,   (int8_t)0x13,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x1c,
+    (int8_t)0x24,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x08,   (int8_t)0x9b,   (int8_t)0x89,   (int8_t)0xa7,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0xa3,   (int8_t)0xb9,   (int8_t)0xbd,   (int8_t)0x81,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0xf9,
+    (int8_t)0xc8,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x9e,   (int8_t)0x6a,   (int8_t)0x22,   (int8_t)0x4b,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::MINS[128] = {
+    (int8_t)0x0e,   (int8_t)0xd9,   (int8_t)0x0e,   (int8_t)0x09,   (int8_t)0x0e,   (int8_t)0xd1,   (int8_t)0x0e,   (int8_t)0x97,
+    (int8_t)0xf7,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0xe3,   (int8_t)0x0a,   (int8_t)0x0e,   (int8_t)0x03,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0xd9,   (int8_t)0x0e,   (int8_t)0xa0,   (int8_t)0xd3,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x0e,
+    (int8_t)0x01,   (int8_t)0x0e,   (int8_t)0xd5,   (int8_t)0xd2,   (int8_t)0x0e,   (int8_t)0xcb,   (int8_t)0x0e,   (int8_t)0xbe,
+    (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0xa5,   (int8_t)0xdf,   (int8_t)0x0e,   (int8_t)0x9e,   (int8_t)0x0e,   (int8_t)0xcf,
+    (int8_t)0xe7,   (int8_t)0xf8,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0xae,   (int8_t)0x95,   (int8_t)0x0e,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0xa4,   (int8_t)0xd1,   (int8_t)0xf4,   (int8_t)0x0e,   (int8_t)0x0a,
+    (int8_t)0x01,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0x9e,   (int8_t)0x0e,   (int8_t)0xe8,   (int8_t)0x0e,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0xf6,   (int8_t)0x0e,   (int8_t)0x9e,   (int8_t)0x97,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,
+    (int8_t)0x08,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0xaa,   (int8_t)0xeb,   (int8_t)0x0a,   (int8_t)0x99,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0xb9,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0xa5,   (int8_t)0x8b,
+    (int8_t)0x0e,   (int8_t)0xc4,   (int8_t)0x0e,   (int8_t)0xcd,   (int8_t)0x95,   (int8_t)0xa7,   (int8_t)0xe8,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0xc0,   (int8_t)0x0e,   (int8_t)0xb3,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0xba,   (int8_t)0x0c,   (int8_t)0x9b,   (int8_t)0x0e,   (int8_t)0xa7,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0xa3,   (int8_t)0xb9,   (int8_t)0xbd,   (int8_t)0xfd,   (int8_t)0x0e,   (int8_t)0x09,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0x8e,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::MMINS[128] = {
+    (int8_t)0x71,   (int8_t)0xd9,   (int8_t)0x0e,   (int8_t)0x09,   (int8_t)0x0e,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0x97,
+    (int8_t)0xf7,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0xe3,   (int8_t)0x0a,   (int8_t)0x0e,   (int8_t)0x03,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0xd9,   (int8_t)0x0e,   (int8_t)0xa0,   (int8_t)0xd3,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x0e,
+    (int8_t)0x01,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0xd2,   (int8_t)0x59,   (int8_t)0xcb,   (int8_t)0x0e,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x0e,   (int8_t)0xa5,   (int8_t)0xdf,   (int8_t)0x0e,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0xcf,
+    (int8_t)0xe7,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x0e,   (int8_t)0xae,   (int8_t)0x95,   (int8_t)0x0e,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0xa4,   (int8_t)0xd1,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x0a,
+    (int8_t)0x01,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0x9e,   (int8_t)0x22,   (int8_t)0xe8,   (int8_t)0x0e,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0xf6,   (int8_t)0x0e,   (int8_t)0x9e,   (int8_t)0x97,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x0e,
+    (int8_t)0x08,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0xaa,   (int8_t)0xeb,   (int8_t)0x0a,   (int8_t)0x99,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0xb9,   (int8_t)0x0e,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x8b,
+    (int8_t)0x0e,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0xcd,   (int8_t)0x95,   (int8_t)0xa7,   (int8_t)0xe8,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0xc0,   (int8_t)0x0e,   (int8_t)0xb3,   (int8_t)0x0e,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x0c,   (int8_t)0x9b,   (int8_t)0x0e,   (int8_t)0xa7,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0xa3,   (int8_t)0xb9,   (int8_t)0xbd,   (int8_t)0xfd,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x0e,
+    (int8_t)0x0e,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x0e,   (int8_t)0x6a,   (int8_t)0x0e,   (int8_t)0x0e,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::HMAX[128] = {
+    (int8_t)0x71,   (int8_t)0x71,   (int8_t)0x71,   (int8_t)0x71,   (int8_t)0x78,   (int8_t)0x78,   (int8_t)0x78,   (int8_t)0x78,
+    (int8_t)0x78,   (int8_t)0x78,   (int8_t)0x78,   (int8_t)0x78,   (int8_t)0x78,   (int8_t)0x78,   (int8_t)0x78,   (int8_t)0x78,
+    (int8_t)0x78,   (int8_t)0x78,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,
+    (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,
+    (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,
+    (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,
+    (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,
+    (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,
+    (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7e,
+    (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,
+    (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,
+    (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,
+    (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,
+    (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,
+    (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,
+    (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f,   (int8_t)0x7f
+};
+
+const int8_t DataSet_1_8i::outputs::MHMAX[128] = {
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x63,   (int8_t)0x63,   (int8_t)0x78,   (int8_t)0x78,   (int8_t)0x78,   (int8_t)0x78,
+    (int8_t)0x78,   (int8_t)0x78,   (int8_t)0x78,   (int8_t)0x78,   (int8_t)0x78,   (int8_t)0x78,   (int8_t)0x78,   (int8_t)0x78,
+    (int8_t)0x78,   (int8_t)0x78,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,
+    (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,
+    (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,
+    (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,
+    (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,
+    (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,
+    (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x7e,
+    (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,
+    (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,
+    (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,
+    (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,
+    (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,
+    (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,
+    (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e,   (int8_t)0x7e
+};
+
+const int8_t DataSet_1_8i::outputs::HMIN[128] = {
+    (int8_t)0x71,   (int8_t)0xd9,   (int8_t)0xd9,   (int8_t)0xd9,   (int8_t)0xd9,   (int8_t)0xd1,   (int8_t)0xd1,   (int8_t)0x97,
+    (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,
+    (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,
+    (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,
+    (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,
+    (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,
+    (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,
+    (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,
+    (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,
+    (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,
+    (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,
+    (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,
+    (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,
+    (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,
+    (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,
+    (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81,   (int8_t)0x81
+};
+
+const int8_t DataSet_1_8i::outputs::MHMIN[128] = {
+    (int8_t)0x7f,   (int8_t)0xd9,   (int8_t)0xd9,   (int8_t)0xd9,   (int8_t)0xd9,   (int8_t)0xd9,   (int8_t)0xd9,   (int8_t)0x97,
+    (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,
+    (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,
+    (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,
+    (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,
+    (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,
+    (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,
+    (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,
+    (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,
+    (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,
+    (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0x8b,
+    (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,
+    (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,
+    (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,
+    (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,
+    (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b,   (int8_t)0x8b
+};
+
+const int8_t DataSet_1_8i::outputs::BANDV[128] = {
+    (int8_t)0x40,   (int8_t)0x08,   (int8_t)0x22,   (int8_t)0x08,   (int8_t)0x28,   (int8_t)0x01,   (int8_t)0x50,   (int8_t)0x04,
+    (int8_t)0x45,   (int8_t)0x30,   (int8_t)0x01,   (int8_t)0x22,   (int8_t)0x02,   (int8_t)0x20,   (int8_t)0x03,   (int8_t)0x0a,
+    (int8_t)0x10,   (int8_t)0x99,   (int8_t)0x38,   (int8_t)0x00,   (int8_t)0x41,   (int8_t)0x80,   (int8_t)0xe4,   (int8_t)0x0c,
+    (int8_t)0x00,   (int8_t)0x43,   (int8_t)0x15,   (int8_t)0x92,   (int8_t)0x40,   (int8_t)0x08,   (int8_t)0x01,   (int8_t)0x1a,
+    (int8_t)0x50,   (int8_t)0x44,   (int8_t)0xa0,   (int8_t)0x51,   (int8_t)0x60,   (int8_t)0x0a,   (int8_t)0x00,   (int8_t)0xc3,
+    (int8_t)0x40,   (int8_t)0x50,   (int8_t)0x14,   (int8_t)0x00,   (int8_t)0x04,   (int8_t)0x85,   (int8_t)0x28,   (int8_t)0x18,
+    (int8_t)0x80,   (int8_t)0x08,   (int8_t)0x0a,   (int8_t)0xa0,   (int8_t)0x10,   (int8_t)0xd0,   (int8_t)0x24,   (int8_t)0x00,
+    (int8_t)0x01,   (int8_t)0x86,   (int8_t)0x81,   (int8_t)0x8c,   (int8_t)0x20,   (int8_t)0xe0,   (int8_t)0x20,   (int8_t)0x22,
+    (int8_t)0x00,   (int8_t)0x40,   (int8_t)0x41,   (int8_t)0x10,   (int8_t)0x10,   (int8_t)0x4a,   (int8_t)0x48,   (int8_t)0x70,
+    (int8_t)0x00,   (int8_t)0x81,   (int8_t)0xa0,   (int8_t)0xa8,   (int8_t)0x43,   (int8_t)0x08,   (int8_t)0x19,   (int8_t)0x04,
+    (int8_t)0x83,   (int8_t)0x46,   (int8_t)0x28,   (int8_t)0x11,   (int8_t)0x02,   (int8_t)0x05,   (int8_t)0x00,   (int8_t)0x8a,
+    (int8_t)0x01,   (int8_t)0xc4,   (int8_t)0x75,   (int8_t)0x48,   (int8_t)0x10,   (int8_t)0x01,   (int8_t)0xa0,   (int8_t)0x41,
+    (int8_t)0x04,   (int8_t)0xc0,   (int8_t)0x02,   (int8_t)0x81,   (int8_t)0x13,   (int8_t)0x74,   (int8_t)0x47,   (int8_t)0x1c,
+    (int8_t)0x20,   (int8_t)0x00,   (int8_t)0x90,   (int8_t)0x08,   (int8_t)0x83,   (int8_t)0x09,   (int8_t)0x00,   (int8_t)0x20,
+    (int8_t)0x42,   (int8_t)0xa0,   (int8_t)0x21,   (int8_t)0xa4,   (int8_t)0x81,   (int8_t)0x32,   (int8_t)0x08,   (int8_t)0x49,
+    (int8_t)0x48,   (int8_t)0x82,   (int8_t)0x30,   (int8_t)0x08,   (int8_t)0x68,   (int8_t)0x22,   (int8_t)0x4a,   (int8_t)0x48
+};
+
+const int8_t DataSet_1_8i::outputs::MBANDV[128] = {
+    (int8_t)0x71,   (int8_t)0x08,   (int8_t)0x22,   (int8_t)0x09,   (int8_t)0x28,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0x04,
+    (int8_t)0x45,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0x22,   (int8_t)0x0a,   (int8_t)0x20,   (int8_t)0x03,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0x99,   (int8_t)0x38,   (int8_t)0xa0,   (int8_t)0x41,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x0c,
+    (int8_t)0x00,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0x92,   (int8_t)0x59,   (int8_t)0x08,   (int8_t)0x01,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x44,   (int8_t)0xa0,   (int8_t)0xdf,   (int8_t)0x60,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0xc3,
+    (int8_t)0x40,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x00,   (int8_t)0xae,   (int8_t)0x85,   (int8_t)0x28,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x08,   (int8_t)0x0a,   (int8_t)0xa4,   (int8_t)0x10,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x00,
+    (int8_t)0x01,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0x8c,   (int8_t)0x22,   (int8_t)0xe0,   (int8_t)0x20,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0x40,   (int8_t)0x41,   (int8_t)0x9e,   (int8_t)0x10,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x70,
+    (int8_t)0x00,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0xa8,   (int8_t)0xeb,   (int8_t)0x08,   (int8_t)0x19,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x46,   (int8_t)0x28,   (int8_t)0xb9,   (int8_t)0x02,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x8a,
+    (int8_t)0x01,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0x48,   (int8_t)0x95,   (int8_t)0x01,   (int8_t)0xa0,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0xc0,   (int8_t)0x02,   (int8_t)0xb3,   (int8_t)0x13,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x1c,
+    (int8_t)0x20,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x08,   (int8_t)0x9b,   (int8_t)0x09,   (int8_t)0x00,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0xa0,   (int8_t)0x21,   (int8_t)0xbd,   (int8_t)0x81,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x49,
+    (int8_t)0x48,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x08,   (int8_t)0x6a,   (int8_t)0x22,   (int8_t)0x4a,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::BANDS[128] = {
+    (int8_t)0x00,   (int8_t)0x08,   (int8_t)0x02,   (int8_t)0x08,   (int8_t)0x08,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x06,
+    (int8_t)0x06,   (int8_t)0x04,   (int8_t)0x02,   (int8_t)0x02,   (int8_t)0x0a,   (int8_t)0x0c,   (int8_t)0x02,   (int8_t)0x0e,
+    (int8_t)0x08,   (int8_t)0x08,   (int8_t)0x0c,   (int8_t)0x00,   (int8_t)0x02,   (int8_t)0x00,   (int8_t)0x0c,   (int8_t)0x0e,
+    (int8_t)0x00,   (int8_t)0x0a,   (int8_t)0x04,   (int8_t)0x02,   (int8_t)0x08,   (int8_t)0x0a,   (int8_t)0x0c,   (int8_t)0x0e,
+    (int8_t)0x0a,   (int8_t)0x0c,   (int8_t)0x04,   (int8_t)0x0e,   (int8_t)0x08,   (int8_t)0x0e,   (int8_t)0x02,   (int8_t)0x0e,
+    (int8_t)0x06,   (int8_t)0x08,   (int8_t)0x0e,   (int8_t)0x06,   (int8_t)0x0e,   (int8_t)0x04,   (int8_t)0x0c,   (int8_t)0x08,
+    (int8_t)0x0a,   (int8_t)0x08,   (int8_t)0x0a,   (int8_t)0x04,   (int8_t)0x00,   (int8_t)0x04,   (int8_t)0x04,   (int8_t)0x0a,
+    (int8_t)0x00,   (int8_t)0x06,   (int8_t)0x00,   (int8_t)0x0e,   (int8_t)0x02,   (int8_t)0x08,   (int8_t)0x0a,   (int8_t)0x06,
+    (int8_t)0x06,   (int8_t)0x06,   (int8_t)0x00,   (int8_t)0x0e,   (int8_t)0x06,   (int8_t)0x0a,   (int8_t)0x08,   (int8_t)0x0e,
+    (int8_t)0x08,   (int8_t)0x02,   (int8_t)0x0c,   (int8_t)0x0a,   (int8_t)0x0a,   (int8_t)0x0a,   (int8_t)0x08,   (int8_t)0x06,
+    (int8_t)0x0a,   (int8_t)0x0e,   (int8_t)0x08,   (int8_t)0x08,   (int8_t)0x0e,   (int8_t)0x0c,   (int8_t)0x04,   (int8_t)0x0a,
+    (int8_t)0x0c,   (int8_t)0x04,   (int8_t)0x0e,   (int8_t)0x0c,   (int8_t)0x04,   (int8_t)0x06,   (int8_t)0x08,   (int8_t)0x0c,
+    (int8_t)0x0e,   (int8_t)0x00,   (int8_t)0x06,   (int8_t)0x02,   (int8_t)0x02,   (int8_t)0x0e,   (int8_t)0x06,   (int8_t)0x0e,
+    (int8_t)0x08,   (int8_t)0x08,   (int8_t)0x0a,   (int8_t)0x0c,   (int8_t)0x0a,   (int8_t)0x0e,   (int8_t)0x06,   (int8_t)0x00,
+    (int8_t)0x02,   (int8_t)0x02,   (int8_t)0x08,   (int8_t)0x0c,   (int8_t)0x0c,   (int8_t)0x02,   (int8_t)0x08,   (int8_t)0x0c,
+    (int8_t)0x08,   (int8_t)0x0e,   (int8_t)0x00,   (int8_t)0x08,   (int8_t)0x0a,   (int8_t)0x02,   (int8_t)0x0e,   (int8_t)0x0a
+};
+
+const int8_t DataSet_1_8i::outputs::MBANDS[128] = {
+    (int8_t)0x71,   (int8_t)0x08,   (int8_t)0x02,   (int8_t)0x09,   (int8_t)0x08,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0x06,
+    (int8_t)0x06,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0x02,   (int8_t)0x0a,   (int8_t)0x0c,   (int8_t)0x02,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0x08,   (int8_t)0x0c,   (int8_t)0xa0,   (int8_t)0x02,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x0e,
+    (int8_t)0x00,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0x02,   (int8_t)0x59,   (int8_t)0x0a,   (int8_t)0x0c,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x0c,   (int8_t)0x04,   (int8_t)0xdf,   (int8_t)0x08,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0x0e,
+    (int8_t)0x06,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x06,   (int8_t)0xae,   (int8_t)0x04,   (int8_t)0x0c,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x08,   (int8_t)0x0a,   (int8_t)0xa4,   (int8_t)0x00,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x0a,
+    (int8_t)0x00,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0x0e,   (int8_t)0x22,   (int8_t)0x08,   (int8_t)0x0a,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0x06,   (int8_t)0x00,   (int8_t)0x9e,   (int8_t)0x06,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x0e,
+    (int8_t)0x08,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0x0a,   (int8_t)0xeb,   (int8_t)0x0a,   (int8_t)0x08,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x0e,   (int8_t)0x08,   (int8_t)0xb9,   (int8_t)0x0e,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x0a,
+    (int8_t)0x0c,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0x0c,   (int8_t)0x95,   (int8_t)0x06,   (int8_t)0x08,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0x00,   (int8_t)0x06,   (int8_t)0xb3,   (int8_t)0x02,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x0e,
+    (int8_t)0x08,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x0c,   (int8_t)0x9b,   (int8_t)0x0e,   (int8_t)0x06,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0x02,   (int8_t)0x08,   (int8_t)0xbd,   (int8_t)0x0c,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x0c,
+    (int8_t)0x08,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x08,   (int8_t)0x6a,   (int8_t)0x02,   (int8_t)0x0e,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::BORV[128] = {
+    (int8_t)0xff,   (int8_t)0xd9,   (int8_t)0xff,   (int8_t)0xef,   (int8_t)0xfb,   (int8_t)0xfb,   (int8_t)0x73,   (int8_t)0xf7,
+    (int8_t)0xf7,   (int8_t)0x35,   (int8_t)0xb7,   (int8_t)0xfb,   (int8_t)0x4e,   (int8_t)0xfd,   (int8_t)0x67,   (int8_t)0xee,
+    (int8_t)0xda,   (int8_t)0xdf,   (int8_t)0xff,   (int8_t)0xb8,   (int8_t)0xf7,   (int8_t)0xad,   (int8_t)0xfc,   (int8_t)0x2e,
+    (int8_t)0x1d,   (int8_t)0xfb,   (int8_t)0xd5,   (int8_t)0xfb,   (int8_t)0xdf,   (int8_t)0xeb,   (int8_t)0x7f,   (int8_t)0xbe,
+    (int8_t)0x5f,   (int8_t)0x7e,   (int8_t)0xed,   (int8_t)0xff,   (int8_t)0xf8,   (int8_t)0xff,   (int8_t)0x7b,   (int8_t)0xcf,
+    (int8_t)0xf7,   (int8_t)0xfb,   (int8_t)0xdf,   (int8_t)0x77,   (int8_t)0xbe,   (int8_t)0xb7,   (int8_t)0x3c,   (int8_t)0x98,
+    (int8_t)0xdb,   (int8_t)0x99,   (int8_t)0x6b,   (int8_t)0xb7,   (int8_t)0xfd,   (int8_t)0xfd,   (int8_t)0xa5,   (int8_t)0x2b,
+    (int8_t)0xa7,   (int8_t)0xd6,   (int8_t)0xe5,   (int8_t)0xbf,   (int8_t)0x7e,   (int8_t)0xef,   (int8_t)0xfa,   (int8_t)0xf6,
+    (int8_t)0xef,   (int8_t)0xf7,   (int8_t)0xfd,   (int8_t)0xff,   (int8_t)0xdf,   (int8_t)0xfb,   (int8_t)0x5f,   (int8_t)0x7e,
+    (int8_t)0xe8,   (int8_t)0xf3,   (int8_t)0xfe,   (int8_t)0xaa,   (int8_t)0xff,   (int8_t)0x9e,   (int8_t)0x9b,   (int8_t)0xfe,
+    (int8_t)0xdb,   (int8_t)0x5f,   (int8_t)0x6e,   (int8_t)0xbb,   (int8_t)0x5f,   (int8_t)0x7f,   (int8_t)0xef,   (int8_t)0xfb,
+    (int8_t)0x6d,   (int8_t)0xc5,   (int8_t)0x7f,   (int8_t)0xed,   (int8_t)0xbd,   (int8_t)0xf7,   (int8_t)0xe9,   (int8_t)0xdf,
+    (int8_t)0x3e,   (int8_t)0xf6,   (int8_t)0x7f,   (int8_t)0xb7,   (int8_t)0x5b,   (int8_t)0xff,   (int8_t)0xdf,   (int8_t)0x3e,
+    (int8_t)0x6d,   (int8_t)0x5e,   (int8_t)0xfa,   (int8_t)0x0c,   (int8_t)0xbf,   (int8_t)0xef,   (int8_t)0xb7,   (int8_t)0xee,
+    (int8_t)0xda,   (int8_t)0xb3,   (int8_t)0xbf,   (int8_t)0xbf,   (int8_t)0xfd,   (int8_t)0xf2,   (int8_t)0x59,   (int8_t)0xfd,
+    (int8_t)0xc9,   (int8_t)0xee,   (int8_t)0x73,   (int8_t)0xfe,   (int8_t)0xef,   (int8_t)0x23,   (int8_t)0x5f,   (int8_t)0xfb
+};
+
+const int8_t DataSet_1_8i::outputs::MBORV[128] = {
+    (int8_t)0x71,   (int8_t)0xd9,   (int8_t)0xff,   (int8_t)0x09,   (int8_t)0xfb,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0xf7,
+    (int8_t)0xf7,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0xfb,   (int8_t)0x0a,   (int8_t)0xfd,   (int8_t)0x67,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0xdf,   (int8_t)0xff,   (int8_t)0xa0,   (int8_t)0xf7,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x2e,
+    (int8_t)0x1d,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0xfb,   (int8_t)0x59,   (int8_t)0xeb,   (int8_t)0x7f,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x7e,   (int8_t)0xed,   (int8_t)0xdf,   (int8_t)0xf8,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0xcf,
+    (int8_t)0xf7,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x77,   (int8_t)0xae,   (int8_t)0xb7,   (int8_t)0x3c,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x99,   (int8_t)0x6b,   (int8_t)0xa4,   (int8_t)0xfd,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x2b,
+    (int8_t)0xa7,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0xbf,   (int8_t)0x22,   (int8_t)0xef,   (int8_t)0xfa,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0xf7,   (int8_t)0xfd,   (int8_t)0x9e,   (int8_t)0xdf,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x7e,
+    (int8_t)0xe8,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0xaa,   (int8_t)0xeb,   (int8_t)0x9e,   (int8_t)0x9b,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x5f,   (int8_t)0x6e,   (int8_t)0xb9,   (int8_t)0x5f,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0xfb,
+    (int8_t)0x6d,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0xed,   (int8_t)0x95,   (int8_t)0xf7,   (int8_t)0xe9,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0xf6,   (int8_t)0x7f,   (int8_t)0xb3,   (int8_t)0x5b,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x3e,
+    (int8_t)0x6d,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x0c,   (int8_t)0x9b,   (int8_t)0xef,   (int8_t)0xb7,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0xb3,   (int8_t)0xbf,   (int8_t)0xbd,   (int8_t)0xfd,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0xfd,
+    (int8_t)0xc9,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0xfe,   (int8_t)0x6a,   (int8_t)0x23,   (int8_t)0x5f,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::BORS[128] = {
+    (int8_t)0x7f,   (int8_t)0xdf,   (int8_t)0x6f,   (int8_t)0x0f,   (int8_t)0x7e,   (int8_t)0xdf,   (int8_t)0x7e,   (int8_t)0x9f,
+    (int8_t)0xff,   (int8_t)0x3f,   (int8_t)0x2f,   (int8_t)0xef,   (int8_t)0x0e,   (int8_t)0x2e,   (int8_t)0x0f,   (int8_t)0xce,
+    (int8_t)0xde,   (int8_t)0xdf,   (int8_t)0x7f,   (int8_t)0xae,   (int8_t)0xdf,   (int8_t)0x8f,   (int8_t)0xfe,   (int8_t)0x0e,
+    (int8_t)0x0f,   (int8_t)0x7f,   (int8_t)0xdf,   (int8_t)0xde,   (int8_t)0x5f,   (int8_t)0xcf,   (int8_t)0x5f,   (int8_t)0xbe,
+    (int8_t)0x5f,   (int8_t)0x6e,   (int8_t)0xaf,   (int8_t)0xdf,   (int8_t)0x7e,   (int8_t)0x9e,   (int8_t)0x3e,   (int8_t)0xcf,
+    (int8_t)0xef,   (int8_t)0xfe,   (int8_t)0x1f,   (int8_t)0x2f,   (int8_t)0xae,   (int8_t)0x9f,   (int8_t)0x3e,   (int8_t)0x9e,
+    (int8_t)0x9f,   (int8_t)0x1e,   (int8_t)0x6e,   (int8_t)0xae,   (int8_t)0xdf,   (int8_t)0xfe,   (int8_t)0x2f,   (int8_t)0x0e,
+    (int8_t)0x0f,   (int8_t)0x9e,   (int8_t)0xef,   (int8_t)0x9e,   (int8_t)0x2e,   (int8_t)0xee,   (int8_t)0x7e,   (int8_t)0xee,
+    (int8_t)0x8e,   (int8_t)0xfe,   (int8_t)0x6f,   (int8_t)0x9e,   (int8_t)0x9f,   (int8_t)0x4f,   (int8_t)0x5e,   (int8_t)0x7e,
+    (int8_t)0x0e,   (int8_t)0xef,   (int8_t)0xee,   (int8_t)0xae,   (int8_t)0xef,   (int8_t)0x0e,   (int8_t)0x9f,   (int8_t)0xae,
+    (int8_t)0xdf,   (int8_t)0x5e,   (int8_t)0x6e,   (int8_t)0xbf,   (int8_t)0x0f,   (int8_t)0x3f,   (int8_t)0xaf,   (int8_t)0x8f,
+    (int8_t)0x4f,   (int8_t)0xce,   (int8_t)0x7f,   (int8_t)0xcf,   (int8_t)0x9f,   (int8_t)0xaf,   (int8_t)0xee,   (int8_t)0x4f,
+    (int8_t)0x0e,   (int8_t)0xce,   (int8_t)0x3e,   (int8_t)0xbf,   (int8_t)0x1f,   (int8_t)0x7f,   (int8_t)0x4f,   (int8_t)0x3e,
+    (int8_t)0x6f,   (int8_t)0x4e,   (int8_t)0xbe,   (int8_t)0x0e,   (int8_t)0x9f,   (int8_t)0x6f,   (int8_t)0xaf,   (int8_t)0xee,
+    (int8_t)0xde,   (int8_t)0xaf,   (int8_t)0xbf,   (int8_t)0xbf,   (int8_t)0xff,   (int8_t)0x7e,   (int8_t)0x0f,   (int8_t)0x4f,
+    (int8_t)0x4f,   (int8_t)0x8e,   (int8_t)0x3e,   (int8_t)0x6e,   (int8_t)0x6e,   (int8_t)0x2e,   (int8_t)0x5e,   (int8_t)0xef
+};
+
+const int8_t DataSet_1_8i::outputs::MBORS[128] = {
+    (int8_t)0x71,   (int8_t)0xdf,   (int8_t)0x6f,   (int8_t)0x09,   (int8_t)0x7e,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0x9f,
+    (int8_t)0xff,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0xef,   (int8_t)0x0a,   (int8_t)0x2e,   (int8_t)0x0f,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0xdf,   (int8_t)0x7f,   (int8_t)0xa0,   (int8_t)0xdf,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x0e,
+    (int8_t)0x0f,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0xde,   (int8_t)0x59,   (int8_t)0xcf,   (int8_t)0x5f,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x6e,   (int8_t)0xaf,   (int8_t)0xdf,   (int8_t)0x7e,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0xcf,
+    (int8_t)0xef,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x2f,   (int8_t)0xae,   (int8_t)0x9f,   (int8_t)0x3e,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x1e,   (int8_t)0x6e,   (int8_t)0xa4,   (int8_t)0xdf,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x0e,
+    (int8_t)0x0f,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0x9e,   (int8_t)0x22,   (int8_t)0xee,   (int8_t)0x7e,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0xfe,   (int8_t)0x6f,   (int8_t)0x9e,   (int8_t)0x9f,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x7e,
+    (int8_t)0x0e,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0xae,   (int8_t)0xeb,   (int8_t)0x0e,   (int8_t)0x9f,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x5e,   (int8_t)0x6e,   (int8_t)0xb9,   (int8_t)0x0f,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x8f,
+    (int8_t)0x4f,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0xcf,   (int8_t)0x95,   (int8_t)0xaf,   (int8_t)0xee,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0xce,   (int8_t)0x3e,   (int8_t)0xb3,   (int8_t)0x1f,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x3e,
+    (int8_t)0x6f,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x0e,   (int8_t)0x9b,   (int8_t)0x6f,   (int8_t)0xaf,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0xaf,   (int8_t)0xbf,   (int8_t)0xbd,   (int8_t)0xff,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x4f,
+    (int8_t)0x4f,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x6e,   (int8_t)0x6a,   (int8_t)0x2e,   (int8_t)0x5e,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::BXORV[128] = {
+    (int8_t)0xbf,   (int8_t)0xd1,   (int8_t)0xdd,   (int8_t)0xe7,   (int8_t)0xd3,   (int8_t)0xfa,   (int8_t)0x23,   (int8_t)0xf3,
+    (int8_t)0xb2,   (int8_t)0x05,   (int8_t)0xb6,   (int8_t)0xd9,   (int8_t)0x4c,   (int8_t)0xdd,   (int8_t)0x64,   (int8_t)0xe4,
+    (int8_t)0xca,   (int8_t)0x46,   (int8_t)0xc7,   (int8_t)0xb8,   (int8_t)0xb6,   (int8_t)0x2d,   (int8_t)0x18,   (int8_t)0x22,
+    (int8_t)0x1d,   (int8_t)0xb8,   (int8_t)0xc0,   (int8_t)0x69,   (int8_t)0x9f,   (int8_t)0xe3,   (int8_t)0x7e,   (int8_t)0xa4,
+    (int8_t)0x0f,   (int8_t)0x3a,   (int8_t)0x4d,   (int8_t)0xae,   (int8_t)0x98,   (int8_t)0xf5,   (int8_t)0x7b,   (int8_t)0x0c,
+    (int8_t)0xb7,   (int8_t)0xab,   (int8_t)0xcb,   (int8_t)0x77,   (int8_t)0xba,   (int8_t)0x32,   (int8_t)0x14,   (int8_t)0x80,
+    (int8_t)0x5b,   (int8_t)0x91,   (int8_t)0x61,   (int8_t)0x17,   (int8_t)0xed,   (int8_t)0x2d,   (int8_t)0x81,   (int8_t)0x2b,
+    (int8_t)0xa6,   (int8_t)0x50,   (int8_t)0x64,   (int8_t)0x33,   (int8_t)0x5e,   (int8_t)0x0f,   (int8_t)0xda,   (int8_t)0xd4,
+    (int8_t)0xef,   (int8_t)0xb7,   (int8_t)0xbc,   (int8_t)0xef,   (int8_t)0xcf,   (int8_t)0xb1,   (int8_t)0x17,   (int8_t)0x0e,
+    (int8_t)0xe8,   (int8_t)0x72,   (int8_t)0x5e,   (int8_t)0x02,   (int8_t)0xbc,   (int8_t)0x96,   (int8_t)0x82,   (int8_t)0xfa,
+    (int8_t)0x58,   (int8_t)0x19,   (int8_t)0x46,   (int8_t)0xaa,   (int8_t)0x5d,   (int8_t)0x7a,   (int8_t)0xef,   (int8_t)0x71,
+    (int8_t)0x6c,   (int8_t)0x01,   (int8_t)0x0a,   (int8_t)0xa5,   (int8_t)0xad,   (int8_t)0xf6,   (int8_t)0x49,   (int8_t)0x9e,
+    (int8_t)0x3a,   (int8_t)0x36,   (int8_t)0x7d,   (int8_t)0x36,   (int8_t)0x48,   (int8_t)0x8b,   (int8_t)0x98,   (int8_t)0x22,
+    (int8_t)0x4d,   (int8_t)0x5e,   (int8_t)0x6a,   (int8_t)0x04,   (int8_t)0x3c,   (int8_t)0xe6,   (int8_t)0xb7,   (int8_t)0xce,
+    (int8_t)0x98,   (int8_t)0x13,   (int8_t)0x9e,   (int8_t)0x1b,   (int8_t)0x7c,   (int8_t)0xc0,   (int8_t)0x51,   (int8_t)0xb4,
+    (int8_t)0x81,   (int8_t)0x6c,   (int8_t)0x43,   (int8_t)0xf6,   (int8_t)0x87,   (int8_t)0x01,   (int8_t)0x15,   (int8_t)0xb3
+};
+
+const int8_t DataSet_1_8i::outputs::MBXORV[128] = {
+    (int8_t)0x71,   (int8_t)0xd1,   (int8_t)0xdd,   (int8_t)0x09,   (int8_t)0xd3,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0xf3,
+    (int8_t)0xb2,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0xd9,   (int8_t)0x0a,   (int8_t)0xdd,   (int8_t)0x64,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0x46,   (int8_t)0xc7,   (int8_t)0xa0,   (int8_t)0xb6,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x22,
+    (int8_t)0x1d,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0x69,   (int8_t)0x59,   (int8_t)0xe3,   (int8_t)0x7e,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x3a,   (int8_t)0x4d,   (int8_t)0xdf,   (int8_t)0x98,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0x0c,
+    (int8_t)0xb7,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x77,   (int8_t)0xae,   (int8_t)0x32,   (int8_t)0x14,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x91,   (int8_t)0x61,   (int8_t)0xa4,   (int8_t)0xed,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x2b,
+    (int8_t)0xa6,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0x33,   (int8_t)0x22,   (int8_t)0x0f,   (int8_t)0xda,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0xb7,   (int8_t)0xbc,   (int8_t)0x9e,   (int8_t)0xcf,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x0e,
+    (int8_t)0xe8,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0x02,   (int8_t)0xeb,   (int8_t)0x96,   (int8_t)0x82,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x19,   (int8_t)0x46,   (int8_t)0xb9,   (int8_t)0x5d,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x71,
+    (int8_t)0x6c,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0xa5,   (int8_t)0x95,   (int8_t)0xf6,   (int8_t)0x49,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0x36,   (int8_t)0x7d,   (int8_t)0xb3,   (int8_t)0x48,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x22,
+    (int8_t)0x4d,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x04,   (int8_t)0x9b,   (int8_t)0xe6,   (int8_t)0xb7,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0x13,   (int8_t)0x9e,   (int8_t)0xbd,   (int8_t)0x7c,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0xb4,
+    (int8_t)0x81,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0xf6,   (int8_t)0x6a,   (int8_t)0x01,   (int8_t)0x15,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::BXORS[128] = {
+    (int8_t)0x7f,   (int8_t)0xd7,   (int8_t)0x6d,   (int8_t)0x07,   (int8_t)0x76,   (int8_t)0xdf,   (int8_t)0x7e,   (int8_t)0x99,
+    (int8_t)0xf9,   (int8_t)0x3b,   (int8_t)0x2d,   (int8_t)0xed,   (int8_t)0x04,   (int8_t)0x22,   (int8_t)0x0d,   (int8_t)0xc0,
+    (int8_t)0xd6,   (int8_t)0xd7,   (int8_t)0x73,   (int8_t)0xae,   (int8_t)0xdd,   (int8_t)0x8f,   (int8_t)0xf2,   (int8_t)0x00,
+    (int8_t)0x0f,   (int8_t)0x75,   (int8_t)0xdb,   (int8_t)0xdc,   (int8_t)0x57,   (int8_t)0xc5,   (int8_t)0x53,   (int8_t)0xb0,
+    (int8_t)0x55,   (int8_t)0x62,   (int8_t)0xab,   (int8_t)0xd1,   (int8_t)0x76,   (int8_t)0x90,   (int8_t)0x3c,   (int8_t)0xc1,
+    (int8_t)0xe9,   (int8_t)0xf6,   (int8_t)0x11,   (int8_t)0x29,   (int8_t)0xa0,   (int8_t)0x9b,   (int8_t)0x32,   (int8_t)0x96,
+    (int8_t)0x95,   (int8_t)0x16,   (int8_t)0x64,   (int8_t)0xaa,   (int8_t)0xdf,   (int8_t)0xfa,   (int8_t)0x2b,   (int8_t)0x04,
+    (int8_t)0x0f,   (int8_t)0x98,   (int8_t)0xef,   (int8_t)0x90,   (int8_t)0x2c,   (int8_t)0xe6,   (int8_t)0x74,   (int8_t)0xe8,
+    (int8_t)0x88,   (int8_t)0xf8,   (int8_t)0x6f,   (int8_t)0x90,   (int8_t)0x99,   (int8_t)0x45,   (int8_t)0x56,   (int8_t)0x70,
+    (int8_t)0x06,   (int8_t)0xed,   (int8_t)0xe2,   (int8_t)0xa4,   (int8_t)0xe5,   (int8_t)0x04,   (int8_t)0x97,   (int8_t)0xa8,
+    (int8_t)0xd5,   (int8_t)0x50,   (int8_t)0x66,   (int8_t)0xb7,   (int8_t)0x01,   (int8_t)0x33,   (int8_t)0xab,   (int8_t)0x85,
+    (int8_t)0x43,   (int8_t)0xca,   (int8_t)0x71,   (int8_t)0xc3,   (int8_t)0x9b,   (int8_t)0xa9,   (int8_t)0xe6,   (int8_t)0x43,
+    (int8_t)0x00,   (int8_t)0xce,   (int8_t)0x38,   (int8_t)0xbd,   (int8_t)0x1d,   (int8_t)0x71,   (int8_t)0x49,   (int8_t)0x30,
+    (int8_t)0x67,   (int8_t)0x46,   (int8_t)0xb4,   (int8_t)0x02,   (int8_t)0x95,   (int8_t)0x61,   (int8_t)0xa9,   (int8_t)0xee,
+    (int8_t)0xdc,   (int8_t)0xad,   (int8_t)0xb7,   (int8_t)0xb3,   (int8_t)0xf3,   (int8_t)0x7c,   (int8_t)0x07,   (int8_t)0x43,
+    (int8_t)0x47,   (int8_t)0x80,   (int8_t)0x3e,   (int8_t)0x66,   (int8_t)0x64,   (int8_t)0x2c,   (int8_t)0x50,   (int8_t)0xe5
+};
+
+const int8_t DataSet_1_8i::outputs::MBXORS[128] = {
+    (int8_t)0x71,   (int8_t)0xd7,   (int8_t)0x6d,   (int8_t)0x09,   (int8_t)0x76,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0x99,
+    (int8_t)0xf9,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0xed,   (int8_t)0x0a,   (int8_t)0x22,   (int8_t)0x0d,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0xd7,   (int8_t)0x73,   (int8_t)0xa0,   (int8_t)0xdd,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x00,
+    (int8_t)0x0f,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0xdc,   (int8_t)0x59,   (int8_t)0xc5,   (int8_t)0x53,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x62,   (int8_t)0xab,   (int8_t)0xdf,   (int8_t)0x76,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0xc1,
+    (int8_t)0xe9,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x29,   (int8_t)0xae,   (int8_t)0x9b,   (int8_t)0x32,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x16,   (int8_t)0x64,   (int8_t)0xa4,   (int8_t)0xdf,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x04,
+    (int8_t)0x0f,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0x90,   (int8_t)0x22,   (int8_t)0xe6,   (int8_t)0x74,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0xf8,   (int8_t)0x6f,   (int8_t)0x9e,   (int8_t)0x99,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x70,
+    (int8_t)0x06,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0xa4,   (int8_t)0xeb,   (int8_t)0x04,   (int8_t)0x97,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x50,   (int8_t)0x66,   (int8_t)0xb9,   (int8_t)0x01,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x85,
+    (int8_t)0x43,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0xc3,   (int8_t)0x95,   (int8_t)0xa9,   (int8_t)0xe6,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0xce,   (int8_t)0x38,   (int8_t)0xb3,   (int8_t)0x1d,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x30,
+    (int8_t)0x67,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x02,   (int8_t)0x9b,   (int8_t)0x61,   (int8_t)0xa9,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0xad,   (int8_t)0xb7,   (int8_t)0xbd,   (int8_t)0xf3,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x43,
+    (int8_t)0x47,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x66,   (int8_t)0x6a,   (int8_t)0x2c,   (int8_t)0x50,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::BNOT[128] = {
+    (int8_t)0x8e,   (int8_t)0x26,   (int8_t)0x9c,   (int8_t)0xf6,   (int8_t)0x87,   (int8_t)0x2e,   (int8_t)0x8f,   (int8_t)0x68,
+    (int8_t)0x08,   (int8_t)0xca,   (int8_t)0xdc,   (int8_t)0x1c,   (int8_t)0xf5,   (int8_t)0xd3,   (int8_t)0xfc,   (int8_t)0x31,
+    (int8_t)0x27,   (int8_t)0x26,   (int8_t)0x82,   (int8_t)0x5f,   (int8_t)0x2c,   (int8_t)0x7e,   (int8_t)0x03,   (int8_t)0xf1,
+    (int8_t)0xfe,   (int8_t)0x84,   (int8_t)0x2a,   (int8_t)0x2d,   (int8_t)0xa6,   (int8_t)0x34,   (int8_t)0xa2,   (int8_t)0x41,
+    (int8_t)0xa4,   (int8_t)0x93,   (int8_t)0x5a,   (int8_t)0x20,   (int8_t)0x87,   (int8_t)0x61,   (int8_t)0xcd,   (int8_t)0x30,
+    (int8_t)0x18,   (int8_t)0x07,   (int8_t)0xe0,   (int8_t)0xd8,   (int8_t)0x51,   (int8_t)0x6a,   (int8_t)0xc3,   (int8_t)0x67,
+    (int8_t)0x64,   (int8_t)0xe7,   (int8_t)0x95,   (int8_t)0x5b,   (int8_t)0x2e,   (int8_t)0x0b,   (int8_t)0xda,   (int8_t)0xf5,
+    (int8_t)0xfe,   (int8_t)0x69,   (int8_t)0x1e,   (int8_t)0x61,   (int8_t)0xdd,   (int8_t)0x17,   (int8_t)0x85,   (int8_t)0x19,
+    (int8_t)0x79,   (int8_t)0x09,   (int8_t)0x9e,   (int8_t)0x61,   (int8_t)0x68,   (int8_t)0xb4,   (int8_t)0xa7,   (int8_t)0x81,
+    (int8_t)0xf7,   (int8_t)0x1c,   (int8_t)0x13,   (int8_t)0x55,   (int8_t)0x14,   (int8_t)0xf5,   (int8_t)0x66,   (int8_t)0x59,
+    (int8_t)0x24,   (int8_t)0xa1,   (int8_t)0x97,   (int8_t)0x46,   (int8_t)0xf0,   (int8_t)0xc2,   (int8_t)0x5a,   (int8_t)0x74,
+    (int8_t)0xb2,   (int8_t)0x3b,   (int8_t)0x80,   (int8_t)0x32,   (int8_t)0x6a,   (int8_t)0x58,   (int8_t)0x17,   (int8_t)0xb2,
+    (int8_t)0xf1,   (int8_t)0x3f,   (int8_t)0xc9,   (int8_t)0x4c,   (int8_t)0xec,   (int8_t)0x80,   (int8_t)0xb8,   (int8_t)0xc1,
+    (int8_t)0x96,   (int8_t)0xb7,   (int8_t)0x45,   (int8_t)0xf3,   (int8_t)0x64,   (int8_t)0x90,   (int8_t)0x58,   (int8_t)0x1f,
+    (int8_t)0x2d,   (int8_t)0x5c,   (int8_t)0x46,   (int8_t)0x42,   (int8_t)0x02,   (int8_t)0x8d,   (int8_t)0xf6,   (int8_t)0xb2,
+    (int8_t)0xb6,   (int8_t)0x71,   (int8_t)0xcf,   (int8_t)0x97,   (int8_t)0x95,   (int8_t)0xdd,   (int8_t)0xa1,   (int8_t)0x14
+};
+
+const int8_t DataSet_1_8i::outputs::MBNOT[128] = {
+    (int8_t)0x71,   (int8_t)0x26,   (int8_t)0x9c,   (int8_t)0x09,   (int8_t)0x87,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0x68,
+    (int8_t)0x08,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0x1c,   (int8_t)0x0a,   (int8_t)0xd3,   (int8_t)0xfc,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0x26,   (int8_t)0x82,   (int8_t)0xa0,   (int8_t)0x2c,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0xf1,
+    (int8_t)0xfe,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0x2d,   (int8_t)0x59,   (int8_t)0x34,   (int8_t)0xa2,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x93,   (int8_t)0x5a,   (int8_t)0xdf,   (int8_t)0x87,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0x30,
+    (int8_t)0x18,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0xd8,   (int8_t)0xae,   (int8_t)0x6a,   (int8_t)0xc3,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0xe7,   (int8_t)0x95,   (int8_t)0xa4,   (int8_t)0x2e,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0xf5,
+    (int8_t)0xfe,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0x61,   (int8_t)0x22,   (int8_t)0x17,   (int8_t)0x85,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0x09,   (int8_t)0x9e,   (int8_t)0x9e,   (int8_t)0x68,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x81,
+    (int8_t)0xf7,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0x55,   (int8_t)0xeb,   (int8_t)0xf5,   (int8_t)0x66,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0xa1,   (int8_t)0x97,   (int8_t)0xb9,   (int8_t)0xf0,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x74,
+    (int8_t)0xb2,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0x32,   (int8_t)0x95,   (int8_t)0x58,   (int8_t)0x17,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0x3f,   (int8_t)0xc9,   (int8_t)0xb3,   (int8_t)0xec,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0xc1,
+    (int8_t)0x96,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0xf3,   (int8_t)0x9b,   (int8_t)0x90,   (int8_t)0x58,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0x5c,   (int8_t)0x46,   (int8_t)0xbd,   (int8_t)0x02,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0xb2,
+    (int8_t)0xb6,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x97,   (int8_t)0x6a,   (int8_t)0xdd,   (int8_t)0xa1,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::HBAND[128] = {
+    (int8_t)0x71,   (int8_t)0x51,   (int8_t)0x41,   (int8_t)0x01,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00
+};
+
+const int8_t DataSet_1_8i::outputs::MHBAND[128] = {
+    (int8_t)0xff,   (int8_t)0xd9,   (int8_t)0x41,   (int8_t)0x41,   (int8_t)0x40,   (int8_t)0x40,   (int8_t)0x40,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00
+};
+
+const int8_t DataSet_1_8i::outputs::HBANDS[128] = {
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00
+};
+
+const int8_t DataSet_1_8i::outputs::MHBANDS[128] = {
+    (int8_t)0x0e,   (int8_t)0x08,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x00
+};
+
+const int8_t DataSet_1_8i::outputs::HBOR[128] = {
+    (int8_t)0x71,   (int8_t)0xf9,   (int8_t)0xfb,   (int8_t)0xfb,   (int8_t)0xfb,   (int8_t)0xfb,   (int8_t)0xfb,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff
+};
+
+const int8_t DataSet_1_8i::outputs::MHBOR[128] = {
+    (int8_t)0x00,   (int8_t)0xd9,   (int8_t)0xfb,   (int8_t)0xfb,   (int8_t)0xfb,   (int8_t)0xfb,   (int8_t)0xfb,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff
+};
+
+const int8_t DataSet_1_8i::outputs::HBORS[128] = {
+    (int8_t)0x7f,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff
+};
+
+const int8_t DataSet_1_8i::outputs::MHBORS[128] = {
+    (int8_t)0x0e,   (int8_t)0xdf,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,
+    (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0xff
+};
+
+const int8_t DataSet_1_8i::outputs::HBXOR[128] = {
+    (int8_t)0x71,   (int8_t)0xa8,   (int8_t)0xcb,   (int8_t)0xc2,   (int8_t)0xba,   (int8_t)0x6b,   (int8_t)0x1b,   (int8_t)0x8c,
+    (int8_t)0x7b,   (int8_t)0x4e,   (int8_t)0x6d,   (int8_t)0x8e,   (int8_t)0x84,   (int8_t)0xa8,   (int8_t)0xab,   (int8_t)0x65,
+    (int8_t)0xbd,   (int8_t)0x64,   (int8_t)0x19,   (int8_t)0xb9,   (int8_t)0x6a,   (int8_t)0xeb,   (int8_t)0x17,   (int8_t)0x19,
+    (int8_t)0x18,   (int8_t)0x63,   (int8_t)0xb6,   (int8_t)0x64,   (int8_t)0x3d,   (int8_t)0xf6,   (int8_t)0xab,   (int8_t)0x15,
+    (int8_t)0x4e,   (int8_t)0x22,   (int8_t)0x87,   (int8_t)0x58,   (int8_t)0x20,   (int8_t)0xbe,   (int8_t)0x8c,   (int8_t)0x43,
+    (int8_t)0xa4,   (int8_t)0x5c,   (int8_t)0x43,   (int8_t)0x64,   (int8_t)0xca,   (int8_t)0x5f,   (int8_t)0x63,   (int8_t)0xfb,
+    (int8_t)0x60,   (int8_t)0x78,   (int8_t)0x12,   (int8_t)0xb6,   (int8_t)0x67,   (int8_t)0x93,   (int8_t)0xb6,   (int8_t)0xbc,
+    (int8_t)0xbd,   (int8_t)0x2b,   (int8_t)0xca,   (int8_t)0x54,   (int8_t)0x76,   (int8_t)0x9e,   (int8_t)0xe4,   (int8_t)0x02,
+    (int8_t)0x84,   (int8_t)0x72,   (int8_t)0x13,   (int8_t)0x8d,   (int8_t)0x1a,   (int8_t)0x51,   (int8_t)0x09,   (int8_t)0x77,
+    (int8_t)0x7f,   (int8_t)0x9c,   (int8_t)0x70,   (int8_t)0xda,   (int8_t)0x31,   (int8_t)0x3b,   (int8_t)0xa2,   (int8_t)0x04,
+    (int8_t)0xdf,   (int8_t)0x81,   (int8_t)0xe9,   (int8_t)0x50,   (int8_t)0x5f,   (int8_t)0x62,   (int8_t)0xc7,   (int8_t)0x4c,
+    (int8_t)0x01,   (int8_t)0xc5,   (int8_t)0xba,   (int8_t)0x77,   (int8_t)0xe2,   (int8_t)0x45,   (int8_t)0xad,   (int8_t)0xe0,
+    (int8_t)0xee,   (int8_t)0x2e,   (int8_t)0x18,   (int8_t)0xab,   (int8_t)0xb8,   (int8_t)0xc7,   (int8_t)0x80,   (int8_t)0xbe,
+    (int8_t)0xd7,   (int8_t)0x9f,   (int8_t)0x25,   (int8_t)0x29,   (int8_t)0xb2,   (int8_t)0xdd,   (int8_t)0x7a,   (int8_t)0x9a,
+    (int8_t)0x48,   (int8_t)0xeb,   (int8_t)0x52,   (int8_t)0xef,   (int8_t)0x12,   (int8_t)0x60,   (int8_t)0x69,   (int8_t)0x24,
+    (int8_t)0x6d,   (int8_t)0xe3,   (int8_t)0xd3,   (int8_t)0xbb,   (int8_t)0xd1,   (int8_t)0xf3,   (int8_t)0xad,   (int8_t)0x46
+};
+
+const int8_t DataSet_1_8i::outputs::MHBXOR[128] = {
+    (int8_t)0x00,   (int8_t)0xd9,   (int8_t)0xba,   (int8_t)0xba,   (int8_t)0xc2,   (int8_t)0xc2,   (int8_t)0xc2,   (int8_t)0x55,
+    (int8_t)0xa2,   (int8_t)0xa2,   (int8_t)0xa2,   (int8_t)0x41,   (int8_t)0x41,   (int8_t)0x6d,   (int8_t)0x6e,   (int8_t)0x6e,
+    (int8_t)0x6e,   (int8_t)0xb7,   (int8_t)0xca,   (int8_t)0xca,   (int8_t)0x19,   (int8_t)0x19,   (int8_t)0x19,   (int8_t)0x17,
+    (int8_t)0x16,   (int8_t)0x16,   (int8_t)0x16,   (int8_t)0xc4,   (int8_t)0xc4,   (int8_t)0x0f,   (int8_t)0x52,   (int8_t)0x52,
+    (int8_t)0x52,   (int8_t)0x3e,   (int8_t)0x9b,   (int8_t)0x9b,   (int8_t)0xe3,   (int8_t)0xe3,   (int8_t)0xe3,   (int8_t)0x2c,
+    (int8_t)0xcb,   (int8_t)0xcb,   (int8_t)0xcb,   (int8_t)0xec,   (int8_t)0xec,   (int8_t)0x79,   (int8_t)0x45,   (int8_t)0x45,
+    (int8_t)0x45,   (int8_t)0x5d,   (int8_t)0x37,   (int8_t)0x37,   (int8_t)0xe6,   (int8_t)0xe6,   (int8_t)0xe6,   (int8_t)0xec,
+    (int8_t)0xed,   (int8_t)0xed,   (int8_t)0xed,   (int8_t)0x73,   (int8_t)0x73,   (int8_t)0x9b,   (int8_t)0xe1,   (int8_t)0xe1,
+    (int8_t)0xe1,   (int8_t)0x17,   (int8_t)0x76,   (int8_t)0x76,   (int8_t)0xe1,   (int8_t)0xe1,   (int8_t)0xe1,   (int8_t)0x9f,
+    (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x3d,   (int8_t)0x3d,   (int8_t)0x37,   (int8_t)0xae,   (int8_t)0xae,
+    (int8_t)0xae,   (int8_t)0xf0,   (int8_t)0x98,   (int8_t)0x98,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x97,   (int8_t)0x1c,
+    (int8_t)0x51,   (int8_t)0x51,   (int8_t)0x51,   (int8_t)0x9c,   (int8_t)0x9c,   (int8_t)0x3b,   (int8_t)0xd3,   (int8_t)0xd3,
+    (int8_t)0xd3,   (int8_t)0x13,   (int8_t)0x25,   (int8_t)0x25,   (int8_t)0x36,   (int8_t)0x36,   (int8_t)0x36,   (int8_t)0x08,
+    (int8_t)0x61,   (int8_t)0x61,   (int8_t)0x61,   (int8_t)0x6d,   (int8_t)0x6d,   (int8_t)0x02,   (int8_t)0xa5,   (int8_t)0xa5,
+    (int8_t)0xa5,   (int8_t)0x06,   (int8_t)0xbf,   (int8_t)0xbf,   (int8_t)0x42,   (int8_t)0x42,   (int8_t)0x42,   (int8_t)0x0f,
+    (int8_t)0x46,   (int8_t)0x46,   (int8_t)0x46,   (int8_t)0x2e,   (int8_t)0x2e,   (int8_t)0x0c,   (int8_t)0x52,   (int8_t)0x52
+};
+
+const int8_t DataSet_1_8i::outputs::HBXORS[128] = {
+    (int8_t)0x7f,   (int8_t)0xa6,   (int8_t)0xc5,   (int8_t)0xcc,   (int8_t)0xb4,   (int8_t)0x65,   (int8_t)0x15,   (int8_t)0x82,
+    (int8_t)0x75,   (int8_t)0x40,   (int8_t)0x63,   (int8_t)0x80,   (int8_t)0x8a,   (int8_t)0xa6,   (int8_t)0xa5,   (int8_t)0x6b,
+    (int8_t)0xb3,   (int8_t)0x6a,   (int8_t)0x17,   (int8_t)0xb7,   (int8_t)0x64,   (int8_t)0xe5,   (int8_t)0x19,   (int8_t)0x17,
+    (int8_t)0x16,   (int8_t)0x6d,   (int8_t)0xb8,   (int8_t)0x6a,   (int8_t)0x33,   (int8_t)0xf8,   (int8_t)0xa5,   (int8_t)0x1b,
+    (int8_t)0x40,   (int8_t)0x2c,   (int8_t)0x89,   (int8_t)0x56,   (int8_t)0x2e,   (int8_t)0xb0,   (int8_t)0x82,   (int8_t)0x4d,
+    (int8_t)0xaa,   (int8_t)0x52,   (int8_t)0x4d,   (int8_t)0x6a,   (int8_t)0xc4,   (int8_t)0x51,   (int8_t)0x6d,   (int8_t)0xf5,
+    (int8_t)0x6e,   (int8_t)0x76,   (int8_t)0x1c,   (int8_t)0xb8,   (int8_t)0x69,   (int8_t)0x9d,   (int8_t)0xb8,   (int8_t)0xb2,
+    (int8_t)0xb3,   (int8_t)0x25,   (int8_t)0xc4,   (int8_t)0x5a,   (int8_t)0x78,   (int8_t)0x90,   (int8_t)0xea,   (int8_t)0x0c,
+    (int8_t)0x8a,   (int8_t)0x7c,   (int8_t)0x1d,   (int8_t)0x83,   (int8_t)0x14,   (int8_t)0x5f,   (int8_t)0x07,   (int8_t)0x79,
+    (int8_t)0x71,   (int8_t)0x92,   (int8_t)0x7e,   (int8_t)0xd4,   (int8_t)0x3f,   (int8_t)0x35,   (int8_t)0xac,   (int8_t)0x0a,
+    (int8_t)0xd1,   (int8_t)0x8f,   (int8_t)0xe7,   (int8_t)0x5e,   (int8_t)0x51,   (int8_t)0x6c,   (int8_t)0xc9,   (int8_t)0x42,
+    (int8_t)0x0f,   (int8_t)0xcb,   (int8_t)0xb4,   (int8_t)0x79,   (int8_t)0xec,   (int8_t)0x4b,   (int8_t)0xa3,   (int8_t)0xee,
+    (int8_t)0xe0,   (int8_t)0x20,   (int8_t)0x16,   (int8_t)0xa5,   (int8_t)0xb6,   (int8_t)0xc9,   (int8_t)0x8e,   (int8_t)0xb0,
+    (int8_t)0xd9,   (int8_t)0x91,   (int8_t)0x2b,   (int8_t)0x27,   (int8_t)0xbc,   (int8_t)0xd3,   (int8_t)0x74,   (int8_t)0x94,
+    (int8_t)0x46,   (int8_t)0xe5,   (int8_t)0x5c,   (int8_t)0xe1,   (int8_t)0x1c,   (int8_t)0x6e,   (int8_t)0x67,   (int8_t)0x2a,
+    (int8_t)0x63,   (int8_t)0xed,   (int8_t)0xdd,   (int8_t)0xb5,   (int8_t)0xdf,   (int8_t)0xfd,   (int8_t)0xa3,   (int8_t)0x48
+};
+
+const int8_t DataSet_1_8i::outputs::MHBXORS[128] = {
+    (int8_t)0x0e,   (int8_t)0xd7,   (int8_t)0xb4,   (int8_t)0xb4,   (int8_t)0xcc,   (int8_t)0xcc,   (int8_t)0xcc,   (int8_t)0x5b,
+    (int8_t)0xac,   (int8_t)0xac,   (int8_t)0xac,   (int8_t)0x4f,   (int8_t)0x4f,   (int8_t)0x63,   (int8_t)0x60,   (int8_t)0x60,
+    (int8_t)0x60,   (int8_t)0xb9,   (int8_t)0xc4,   (int8_t)0xc4,   (int8_t)0x17,   (int8_t)0x17,   (int8_t)0x17,   (int8_t)0x19,
+    (int8_t)0x18,   (int8_t)0x18,   (int8_t)0x18,   (int8_t)0xca,   (int8_t)0xca,   (int8_t)0x01,   (int8_t)0x5c,   (int8_t)0x5c,
+    (int8_t)0x5c,   (int8_t)0x30,   (int8_t)0x95,   (int8_t)0x95,   (int8_t)0xed,   (int8_t)0xed,   (int8_t)0xed,   (int8_t)0x22,
+    (int8_t)0xc5,   (int8_t)0xc5,   (int8_t)0xc5,   (int8_t)0xe2,   (int8_t)0xe2,   (int8_t)0x77,   (int8_t)0x4b,   (int8_t)0x4b,
+    (int8_t)0x4b,   (int8_t)0x53,   (int8_t)0x39,   (int8_t)0x39,   (int8_t)0xe8,   (int8_t)0xe8,   (int8_t)0xe8,   (int8_t)0xe2,
+    (int8_t)0xe3,   (int8_t)0xe3,   (int8_t)0xe3,   (int8_t)0x7d,   (int8_t)0x7d,   (int8_t)0x95,   (int8_t)0xef,   (int8_t)0xef,
+    (int8_t)0xef,   (int8_t)0x19,   (int8_t)0x78,   (int8_t)0x78,   (int8_t)0xef,   (int8_t)0xef,   (int8_t)0xef,   (int8_t)0x91,
+    (int8_t)0x99,   (int8_t)0x99,   (int8_t)0x99,   (int8_t)0x33,   (int8_t)0x33,   (int8_t)0x39,   (int8_t)0xa0,   (int8_t)0xa0,
+    (int8_t)0xa0,   (int8_t)0xfe,   (int8_t)0x96,   (int8_t)0x96,   (int8_t)0x99,   (int8_t)0x99,   (int8_t)0x99,   (int8_t)0x12,
+    (int8_t)0x5f,   (int8_t)0x5f,   (int8_t)0x5f,   (int8_t)0x92,   (int8_t)0x92,   (int8_t)0x35,   (int8_t)0xdd,   (int8_t)0xdd,
+    (int8_t)0xdd,   (int8_t)0x1d,   (int8_t)0x2b,   (int8_t)0x2b,   (int8_t)0x38,   (int8_t)0x38,   (int8_t)0x38,   (int8_t)0x06,
+    (int8_t)0x6f,   (int8_t)0x6f,   (int8_t)0x6f,   (int8_t)0x63,   (int8_t)0x63,   (int8_t)0x0c,   (int8_t)0xab,   (int8_t)0xab,
+    (int8_t)0xab,   (int8_t)0x08,   (int8_t)0xb1,   (int8_t)0xb1,   (int8_t)0x4c,   (int8_t)0x4c,   (int8_t)0x4c,   (int8_t)0x01,
+    (int8_t)0x48,   (int8_t)0x48,   (int8_t)0x48,   (int8_t)0x20,   (int8_t)0x20,   (int8_t)0x02,   (int8_t)0x5c,   (int8_t)0x5c
+};
+
+const int8_t DataSet_1_8i::outputs::LSHV[128] = {
+    (int8_t)0x10,   (int8_t)0x90,   (int8_t)0x60,   (int8_t)0x90,   (int8_t)0x00,   (int8_t)0x20,   (int8_t)0x00,   (int8_t)0x2e,
+    (int8_t)0xb8,   (int8_t)0xa8,   (int8_t)0x46,   (int8_t)0xc6,   (int8_t)0x50,   (int8_t)0xb0,   (int8_t)0x60,   (int8_t)0x38,
+    (int8_t)0x00,   (int8_t)0x90,   (int8_t)0xf4,   (int8_t)0x00,   (int8_t)0x80,   (int8_t)0x10,   (int8_t)0xc0,   (int8_t)0x1c,
+    (int8_t)0x40,   (int8_t)0x80,   (int8_t)0xa8,   (int8_t)0x20,   (int8_t)0x40,   (int8_t)0x80,   (int8_t)0xa0,   (int8_t)0x80,
+    (int8_t)0xb0,   (int8_t)0x00,   (int8_t)0x94,   (int8_t)0x7c,   (int8_t)0x00,   (int8_t)0xf0,   (int8_t)0xc8,   (int8_t)0x3c,
+    (int8_t)0x70,   (int8_t)0x00,   (int8_t)0xf0,   (int8_t)0x4e,   (int8_t)0xe0,   (int8_t)0x80,   (int8_t)0x78,   (int8_t)0x30,
+    (int8_t)0x60,   (int8_t)0xc0,   (int8_t)0x80,   (int8_t)0x90,   (int8_t)0x40,   (int8_t)0x40,   (int8_t)0x4a,   (int8_t)0x40,
+    (int8_t)0x10,   (int8_t)0x58,   (int8_t)0x10,   (int8_t)0xf0,   (int8_t)0x20,   (int8_t)0xd0,   (int8_t)0xf4,   (int8_t)0x98,
+    (int8_t)0x00,   (int8_t)0xd8,   (int8_t)0x80,   (int8_t)0x00,   (int8_t)0xe0,   (int8_t)0x96,   (int8_t)0x00,   (int8_t)0xf8,
+    (int8_t)0x00,   (int8_t)0xc6,   (int8_t)0xc0,   (int8_t)0xa8,   (int8_t)0x80,   (int8_t)0x14,   (int8_t)0x32,   (int8_t)0x4c,
+    (int8_t)0xc0,   (int8_t)0x00,   (int8_t)0x80,   (int8_t)0x72,   (int8_t)0x78,   (int8_t)0xa0,   (int8_t)0x80,   (int8_t)0x16,
+    (int8_t)0x68,   (int8_t)0x40,   (int8_t)0xfe,   (int8_t)0x9a,   (int8_t)0x40,   (int8_t)0x70,   (int8_t)0x00,   (int8_t)0xd0,
+    (int8_t)0xc0,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0x80,   (int8_t)0x30,   (int8_t)0x80,   (int8_t)0x70,   (int8_t)0xf0,
+    (int8_t)0xa4,   (int8_t)0x90,   (int8_t)0xd0,   (int8_t)0x80,   (int8_t)0xb0,   (int8_t)0xbc,   (int8_t)0x38,   (int8_t)0x00,
+    (int8_t)0x48,   (int8_t)0x60,   (int8_t)0x80,   (int8_t)0x40,   (int8_t)0x40,   (int8_t)0x40,   (int8_t)0x40,   (int8_t)0x34,
+    (int8_t)0x92,   (int8_t)0x80,   (int8_t)0xc0,   (int8_t)0x00,   (int8_t)0x80,   (int8_t)0x40,   (int8_t)0xc0,   (int8_t)0x60
+};
+
+const int8_t DataSet_1_8i::outputs::MLSHV[128] = {
+    (int8_t)0x71,   (int8_t)0x90,   (int8_t)0x60,   (int8_t)0x09,   (int8_t)0x00,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0x2e,
+    (int8_t)0xb8,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0xc6,   (int8_t)0x0a,   (int8_t)0xb0,   (int8_t)0x60,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0x90,   (int8_t)0xf4,   (int8_t)0xa0,   (int8_t)0x80,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x1c,
+    (int8_t)0x40,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0x20,   (int8_t)0x59,   (int8_t)0x80,   (int8_t)0xa0,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x00,   (int8_t)0x94,   (int8_t)0xdf,   (int8_t)0x00,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0x3c,
+    (int8_t)0x70,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x4e,   (int8_t)0xae,   (int8_t)0x80,   (int8_t)0x78,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0xc0,   (int8_t)0x80,   (int8_t)0xa4,   (int8_t)0x40,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x40,
+    (int8_t)0x10,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0xf0,   (int8_t)0x22,   (int8_t)0xd0,   (int8_t)0xf4,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0xd8,   (int8_t)0x80,   (int8_t)0x9e,   (int8_t)0xe0,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0xf8,
+    (int8_t)0x00,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0xa8,   (int8_t)0xeb,   (int8_t)0x14,   (int8_t)0x32,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x00,   (int8_t)0x80,   (int8_t)0xb9,   (int8_t)0x78,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x16,
+    (int8_t)0x68,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0x9a,   (int8_t)0x95,   (int8_t)0x70,   (int8_t)0x00,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xb3,   (int8_t)0x30,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0xf0,
+    (int8_t)0xa4,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x80,   (int8_t)0x9b,   (int8_t)0xbc,   (int8_t)0x38,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0x60,   (int8_t)0x80,   (int8_t)0xbd,   (int8_t)0x40,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x34,
+    (int8_t)0x92,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x00,   (int8_t)0x6a,   (int8_t)0x40,   (int8_t)0xc0,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::LSHS[128] = {
+    (int8_t)0x88,   (int8_t)0xc8,   (int8_t)0x18,   (int8_t)0x48,   (int8_t)0xc0,   (int8_t)0x88,   (int8_t)0x80,   (int8_t)0xb8,
+    (int8_t)0xb8,   (int8_t)0xa8,   (int8_t)0x18,   (int8_t)0x18,   (int8_t)0x50,   (int8_t)0x60,   (int8_t)0x18,   (int8_t)0x70,
+    (int8_t)0xc0,   (int8_t)0xc8,   (int8_t)0xe8,   (int8_t)0x00,   (int8_t)0x98,   (int8_t)0x08,   (int8_t)0xe0,   (int8_t)0x70,
+    (int8_t)0x08,   (int8_t)0xd8,   (int8_t)0xa8,   (int8_t)0x90,   (int8_t)0xc8,   (int8_t)0x58,   (int8_t)0xe8,   (int8_t)0xf0,
+    (int8_t)0xd8,   (int8_t)0x60,   (int8_t)0x28,   (int8_t)0xf8,   (int8_t)0xc0,   (int8_t)0xf0,   (int8_t)0x90,   (int8_t)0x78,
+    (int8_t)0x38,   (int8_t)0xc0,   (int8_t)0xf8,   (int8_t)0x38,   (int8_t)0x70,   (int8_t)0xa8,   (int8_t)0xe0,   (int8_t)0xc0,
+    (int8_t)0xd8,   (int8_t)0xc0,   (int8_t)0x50,   (int8_t)0x20,   (int8_t)0x88,   (int8_t)0xa0,   (int8_t)0x28,   (int8_t)0x50,
+    (int8_t)0x08,   (int8_t)0xb0,   (int8_t)0x08,   (int8_t)0xf0,   (int8_t)0x10,   (int8_t)0x40,   (int8_t)0xd0,   (int8_t)0x30,
+    (int8_t)0x30,   (int8_t)0xb0,   (int8_t)0x08,   (int8_t)0xf0,   (int8_t)0xb8,   (int8_t)0x58,   (int8_t)0xc0,   (int8_t)0xf0,
+    (int8_t)0x40,   (int8_t)0x18,   (int8_t)0x60,   (int8_t)0x50,   (int8_t)0x58,   (int8_t)0x50,   (int8_t)0xc8,   (int8_t)0x30,
+    (int8_t)0xd8,   (int8_t)0xf0,   (int8_t)0x40,   (int8_t)0xc8,   (int8_t)0x78,   (int8_t)0xe8,   (int8_t)0x28,   (int8_t)0x58,
+    (int8_t)0x68,   (int8_t)0x20,   (int8_t)0xf8,   (int8_t)0x68,   (int8_t)0xa8,   (int8_t)0x38,   (int8_t)0x40,   (int8_t)0x68,
+    (int8_t)0x70,   (int8_t)0x00,   (int8_t)0xb0,   (int8_t)0x98,   (int8_t)0x98,   (int8_t)0xf8,   (int8_t)0x38,   (int8_t)0xf0,
+    (int8_t)0x48,   (int8_t)0x40,   (int8_t)0xd0,   (int8_t)0x60,   (int8_t)0xd8,   (int8_t)0x78,   (int8_t)0x38,   (int8_t)0x00,
+    (int8_t)0x90,   (int8_t)0x18,   (int8_t)0xc8,   (int8_t)0xe8,   (int8_t)0xe8,   (int8_t)0x90,   (int8_t)0x48,   (int8_t)0x68,
+    (int8_t)0x48,   (int8_t)0x70,   (int8_t)0x80,   (int8_t)0x40,   (int8_t)0x50,   (int8_t)0x10,   (int8_t)0xf0,   (int8_t)0x58
+};
+
+const int8_t DataSet_1_8i::outputs::MLSHS[128] = {
+    (int8_t)0x71,   (int8_t)0xc8,   (int8_t)0x18,   (int8_t)0x09,   (int8_t)0xc0,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0xb8,
+    (int8_t)0xb8,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0x18,   (int8_t)0x0a,   (int8_t)0x60,   (int8_t)0x18,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0xc8,   (int8_t)0xe8,   (int8_t)0xa0,   (int8_t)0x98,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x70,
+    (int8_t)0x08,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0x90,   (int8_t)0x59,   (int8_t)0x58,   (int8_t)0xe8,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x60,   (int8_t)0x28,   (int8_t)0xdf,   (int8_t)0xc0,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0x78,
+    (int8_t)0x38,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x38,   (int8_t)0xae,   (int8_t)0xa8,   (int8_t)0xe0,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0xc0,   (int8_t)0x50,   (int8_t)0xa4,   (int8_t)0x88,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x50,
+    (int8_t)0x08,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0xf0,   (int8_t)0x22,   (int8_t)0x40,   (int8_t)0xd0,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0xb0,   (int8_t)0x08,   (int8_t)0x9e,   (int8_t)0xb8,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0xf0,
+    (int8_t)0x40,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0x50,   (int8_t)0xeb,   (int8_t)0x50,   (int8_t)0xc8,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0xf0,   (int8_t)0x40,   (int8_t)0xb9,   (int8_t)0x78,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x58,
+    (int8_t)0x68,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0x68,   (int8_t)0x95,   (int8_t)0x38,   (int8_t)0x40,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0x00,   (int8_t)0xb0,   (int8_t)0xb3,   (int8_t)0x98,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0xf0,
+    (int8_t)0x48,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x60,   (int8_t)0x9b,   (int8_t)0x78,   (int8_t)0x38,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0x18,   (int8_t)0xc8,   (int8_t)0xbd,   (int8_t)0xe8,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x68,
+    (int8_t)0x48,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x40,   (int8_t)0x6a,   (int8_t)0x10,   (int8_t)0xf0,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::RSHV[128] = {
+    (int8_t)0x07,   (int8_t)0xfd,   (int8_t)0x03,   (int8_t)0x00,   (int8_t)0x01,   (int8_t)0xfe,   (int8_t)0x01,   (int8_t)0xcb,
+    (int8_t)0xfe,   (int8_t)0x06,   (int8_t)0x11,   (int8_t)0xf1,   (int8_t)0x01,   (int8_t)0x0b,   (int8_t)0x00,   (int8_t)0xf3,
+    (int8_t)0xfe,   (int8_t)0xfd,   (int8_t)0x1f,   (int8_t)0xfd,   (int8_t)0xff,   (int8_t)0xf8,   (int8_t)0xff,   (int8_t)0x07,
+    (int8_t)0x00,   (int8_t)0x00,   (int8_t)0xfa,   (int8_t)0xfd,   (int8_t)0x01,   (int8_t)0xff,   (int8_t)0x02,   (int8_t)0xfe,
+    (int8_t)0x05,   (int8_t)0x00,   (int8_t)0xe9,   (int8_t)0xf7,   (int8_t)0x00,   (int8_t)0xf3,   (int8_t)0x0c,   (int8_t)0xf3,
+    (int8_t)0xfe,   (int8_t)0xff,   (int8_t)0x01,   (int8_t)0x13,   (int8_t)0xfa,   (int8_t)0xff,   (int8_t)0x1e,   (int8_t)0xcc,
+    (int8_t)0xfc,   (int8_t)0x03,   (int8_t)0x01,   (int8_t)0xe9,   (int8_t)0xff,   (int8_t)0xff,   (int8_t)0x12,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0xe5,   (int8_t)0xfe,   (int8_t)0xf3,   (int8_t)0x02,   (int8_t)0xf4,   (int8_t)0x3d,   (int8_t)0xf9,
+    (int8_t)0xff,   (int8_t)0xfd,   (int8_t)0x00,   (int8_t)0xff,   (int8_t)0xfc,   (int8_t)0x25,   (int8_t)0x02,   (int8_t)0x1f,
+    (int8_t)0x00,   (int8_t)0xf1,   (int8_t)0xfe,   (int8_t)0xea,   (int8_t)0xff,   (int8_t)0x05,   (int8_t)0xcc,   (int8_t)0xd3,
+    (int8_t)0xff,   (int8_t)0x00,   (int8_t)0x06,   (int8_t)0xdc,   (int8_t)0x01,   (int8_t)0x01,   (int8_t)0xff,   (int8_t)0xc5,
+    (int8_t)0x09,   (int8_t)0xfc,   (int8_t)0x3f,   (int8_t)0xe6,   (int8_t)0xfe,   (int8_t)0xfa,   (int8_t)0xff,   (int8_t)0x04,
+    (int8_t)0x00,   (int8_t)0xff,   (int8_t)0x00,   (int8_t)0xff,   (int8_t)0x01,   (int8_t)0x00,   (int8_t)0x04,   (int8_t)0x07,
+    (int8_t)0x1a,   (int8_t)0x24,   (int8_t)0xf7,   (int8_t)0x00,   (int8_t)0xf9,   (int8_t)0x1b,   (int8_t)0xf4,   (int8_t)0xfe,
+    (int8_t)0xf4,   (int8_t)0xfd,   (int8_t)0xff,   (int8_t)0xfe,   (int8_t)0xff,   (int8_t)0x03,   (int8_t)0x00,   (int8_t)0x13,
+    (int8_t)0x24,   (int8_t)0xfe,   (int8_t)0x0c,   (int8_t)0x00,   (int8_t)0x01,   (int8_t)0x01,   (int8_t)0x02,   (int8_t)0xff
+};
+
+const int8_t DataSet_1_8i::outputs::MRSHV[128] = {
+    (int8_t)0x71,   (int8_t)0xfd,   (int8_t)0x03,   (int8_t)0x09,   (int8_t)0x01,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0xcb,
+    (int8_t)0xfe,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0xf1,   (int8_t)0x0a,   (int8_t)0x0b,   (int8_t)0x00,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0xfd,   (int8_t)0x1f,   (int8_t)0xa0,   (int8_t)0xff,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x07,
+    (int8_t)0x00,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0xfd,   (int8_t)0x59,   (int8_t)0xff,   (int8_t)0x02,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x00,   (int8_t)0xe9,   (int8_t)0xdf,   (int8_t)0x00,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0xf3,
+    (int8_t)0xfe,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x13,   (int8_t)0xae,   (int8_t)0xff,   (int8_t)0x1e,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x03,   (int8_t)0x01,   (int8_t)0xa4,   (int8_t)0xff,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x00,
+    (int8_t)0x00,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0xf3,   (int8_t)0x22,   (int8_t)0xf4,   (int8_t)0x3d,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0xfd,   (int8_t)0x00,   (int8_t)0x9e,   (int8_t)0xfc,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x1f,
+    (int8_t)0x00,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0xea,   (int8_t)0xeb,   (int8_t)0x05,   (int8_t)0xcc,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x00,   (int8_t)0x06,   (int8_t)0xb9,   (int8_t)0x01,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0xc5,
+    (int8_t)0x09,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0xe6,   (int8_t)0x95,   (int8_t)0xfa,   (int8_t)0xff,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0xff,   (int8_t)0x00,   (int8_t)0xb3,   (int8_t)0x01,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x07,
+    (int8_t)0x1a,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x00,   (int8_t)0x9b,   (int8_t)0x1b,   (int8_t)0xf4,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0xfd,   (int8_t)0xff,   (int8_t)0xbd,   (int8_t)0xff,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x13,
+    (int8_t)0x24,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x00,   (int8_t)0x6a,   (int8_t)0x01,   (int8_t)0x02,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::RSHS[128] = {
+    (int8_t)0x0e,   (int8_t)0xfb,   (int8_t)0x0c,   (int8_t)0x01,   (int8_t)0x0f,   (int8_t)0xfa,   (int8_t)0x0e,   (int8_t)0xf2,
+    (int8_t)0xfe,   (int8_t)0x06,   (int8_t)0x04,   (int8_t)0xfc,   (int8_t)0x01,   (int8_t)0x05,   (int8_t)0x00,   (int8_t)0xf9,
+    (int8_t)0xfb,   (int8_t)0xfb,   (int8_t)0x0f,   (int8_t)0xf4,   (int8_t)0xfa,   (int8_t)0xf0,   (int8_t)0xff,   (int8_t)0x01,
+    (int8_t)0x00,   (int8_t)0x0f,   (int8_t)0xfa,   (int8_t)0xfa,   (int8_t)0x0b,   (int8_t)0xf9,   (int8_t)0x0b,   (int8_t)0xf7,
+    (int8_t)0x0b,   (int8_t)0x0d,   (int8_t)0xf4,   (int8_t)0xfb,   (int8_t)0x0f,   (int8_t)0xf3,   (int8_t)0x06,   (int8_t)0xf9,
+    (int8_t)0xfc,   (int8_t)0xff,   (int8_t)0x03,   (int8_t)0x04,   (int8_t)0xf5,   (int8_t)0xf2,   (int8_t)0x07,   (int8_t)0xf3,
+    (int8_t)0xf3,   (int8_t)0x03,   (int8_t)0x0d,   (int8_t)0xf4,   (int8_t)0xfa,   (int8_t)0xfe,   (int8_t)0x04,   (int8_t)0x01,
+    (int8_t)0x00,   (int8_t)0xf2,   (int8_t)0xfc,   (int8_t)0xf3,   (int8_t)0x04,   (int8_t)0xfd,   (int8_t)0x0f,   (int8_t)0xfc,
+    (int8_t)0xf0,   (int8_t)0xfe,   (int8_t)0x0c,   (int8_t)0xf3,   (int8_t)0xf2,   (int8_t)0x09,   (int8_t)0x0b,   (int8_t)0x0f,
+    (int8_t)0x01,   (int8_t)0xfc,   (int8_t)0xfd,   (int8_t)0xf5,   (int8_t)0xfd,   (int8_t)0x01,   (int8_t)0xf3,   (int8_t)0xf4,
+    (int8_t)0xfb,   (int8_t)0x0b,   (int8_t)0x0d,   (int8_t)0xf7,   (int8_t)0x01,   (int8_t)0x07,   (int8_t)0xf4,   (int8_t)0xf1,
+    (int8_t)0x09,   (int8_t)0xf8,   (int8_t)0x0f,   (int8_t)0xf9,   (int8_t)0xf2,   (int8_t)0xf4,   (int8_t)0xfd,   (int8_t)0x09,
+    (int8_t)0x01,   (int8_t)0xf8,   (int8_t)0x06,   (int8_t)0xf6,   (int8_t)0x02,   (int8_t)0x0f,   (int8_t)0x08,   (int8_t)0x07,
+    (int8_t)0x0d,   (int8_t)0x09,   (int8_t)0xf7,   (int8_t)0x01,   (int8_t)0xf3,   (int8_t)0x0d,   (int8_t)0xf4,   (int8_t)0xfc,
+    (int8_t)0xfa,   (int8_t)0xf4,   (int8_t)0xf7,   (int8_t)0xf7,   (int8_t)0xff,   (int8_t)0x0e,   (int8_t)0x01,   (int8_t)0x09,
+    (int8_t)0x09,   (int8_t)0xf1,   (int8_t)0x06,   (int8_t)0x0d,   (int8_t)0x0d,   (int8_t)0x04,   (int8_t)0x0b,   (int8_t)0xfd
+};
+
+const int8_t DataSet_1_8i::outputs::MRSHS[128] = {
+    (int8_t)0x71,   (int8_t)0xfb,   (int8_t)0x0c,   (int8_t)0x09,   (int8_t)0x0f,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0xf2,
+    (int8_t)0xfe,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0xfc,   (int8_t)0x0a,   (int8_t)0x05,   (int8_t)0x00,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0xfb,   (int8_t)0x0f,   (int8_t)0xa0,   (int8_t)0xfa,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x01,
+    (int8_t)0x00,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0xfa,   (int8_t)0x59,   (int8_t)0xf9,   (int8_t)0x0b,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x0d,   (int8_t)0xf4,   (int8_t)0xdf,   (int8_t)0x0f,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0xf9,
+    (int8_t)0xfc,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x04,   (int8_t)0xae,   (int8_t)0xf2,   (int8_t)0x07,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x03,   (int8_t)0x0d,   (int8_t)0xa4,   (int8_t)0xfa,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x01,
+    (int8_t)0x00,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0xf3,   (int8_t)0x22,   (int8_t)0xfd,   (int8_t)0x0f,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0xfe,   (int8_t)0x0c,   (int8_t)0x9e,   (int8_t)0xf2,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x0f,
+    (int8_t)0x01,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0xf5,   (int8_t)0xeb,   (int8_t)0x01,   (int8_t)0xf3,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x0b,   (int8_t)0x0d,   (int8_t)0xb9,   (int8_t)0x01,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0xf1,
+    (int8_t)0x09,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0xf9,   (int8_t)0x95,   (int8_t)0xf4,   (int8_t)0xfd,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0xf8,   (int8_t)0x06,   (int8_t)0xb3,   (int8_t)0x02,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x07,
+    (int8_t)0x0d,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x01,   (int8_t)0x9b,   (int8_t)0x0d,   (int8_t)0xf4,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0xf4,   (int8_t)0xf7,   (int8_t)0xbd,   (int8_t)0xff,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x09,
+    (int8_t)0x09,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x0d,   (int8_t)0x6a,   (int8_t)0x04,   (int8_t)0x0b,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::ROLV[128] = {
+    (int8_t)0x17,   (int8_t)0x9d,   (int8_t)0x6c,   (int8_t)0x90,   (int8_t)0x1e,   (int8_t)0x3a,   (int8_t)0x1c,   (int8_t)0x2f,
+    (int8_t)0xbf,   (int8_t)0xa9,   (int8_t)0x46,   (int8_t)0xc7,   (int8_t)0x50,   (int8_t)0xb0,   (int8_t)0x60,   (int8_t)0x3b,
+    (int8_t)0x1b,   (int8_t)0x9d,   (int8_t)0xf5,   (int8_t)0x14,   (int8_t)0xe9,   (int8_t)0x18,   (int8_t)0xcf,   (int8_t)0x1c,
+    (int8_t)0x40,   (int8_t)0xbd,   (int8_t)0xae,   (int8_t)0x2d,   (int8_t)0x56,   (int8_t)0xe5,   (int8_t)0xab,   (int8_t)0xaf,
+    (int8_t)0xb5,   (int8_t)0x36,   (int8_t)0x96,   (int8_t)0x7f,   (int8_t)0x3c,   (int8_t)0xf4,   (int8_t)0xc8,   (int8_t)0x3f,
+    (int8_t)0x7e,   (int8_t)0x3e,   (int8_t)0xf1,   (int8_t)0x4e,   (int8_t)0xea,   (int8_t)0xca,   (int8_t)0x78,   (int8_t)0x31,
+    (int8_t)0x73,   (int8_t)0xc0,   (int8_t)0x9a,   (int8_t)0x92,   (int8_t)0x74,   (int8_t)0x4f,   (int8_t)0x4a,   (int8_t)0x41,
+    (int8_t)0x10,   (int8_t)0x5a,   (int8_t)0x1e,   (int8_t)0xf4,   (int8_t)0x22,   (int8_t)0xd1,   (int8_t)0xf4,   (int8_t)0x9b,
+    (int8_t)0x43,   (int8_t)0xdb,   (int8_t)0xb0,   (int8_t)0x4f,   (int8_t)0xf2,   (int8_t)0x96,   (int8_t)0x0b,   (int8_t)0xf9,
+    (int8_t)0x01,   (int8_t)0xc7,   (int8_t)0xce,   (int8_t)0xaa,   (int8_t)0xf5,   (int8_t)0x14,   (int8_t)0x33,   (int8_t)0x4d,
+    (int8_t)0xf6,   (int8_t)0x2f,   (int8_t)0x86,   (int8_t)0x73,   (int8_t)0x78,   (int8_t)0xa7,   (int8_t)0xd2,   (int8_t)0x17,
+    (int8_t)0x6a,   (int8_t)0x4c,   (int8_t)0xfe,   (int8_t)0x9b,   (int8_t)0x65,   (int8_t)0x7a,   (int8_t)0x1d,   (int8_t)0xd4,
+    (int8_t)0xc1,   (int8_t)0x60,   (int8_t)0x1b,   (int8_t)0xd9,   (int8_t)0x31,   (int8_t)0xbf,   (int8_t)0x74,   (int8_t)0xf1,
+    (int8_t)0xa5,   (int8_t)0x90,   (int8_t)0xd5,   (int8_t)0x81,   (int8_t)0xb9,   (int8_t)0xbd,   (int8_t)0x3d,   (int8_t)0x0e,
+    (int8_t)0x4b,   (int8_t)0x74,   (int8_t)0xdc,   (int8_t)0x6f,   (int8_t)0x7f,   (int8_t)0x4e,   (int8_t)0x42,   (int8_t)0x35,
+    (int8_t)0x92,   (int8_t)0xa3,   (int8_t)0xc0,   (int8_t)0x34,   (int8_t)0x9a,   (int8_t)0x44,   (int8_t)0xcb,   (int8_t)0x7d
+};
+
+const int8_t DataSet_1_8i::outputs::MROLV[128] = {
+    (int8_t)0x71,   (int8_t)0x9d,   (int8_t)0x6c,   (int8_t)0x09,   (int8_t)0x1e,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0x2f,
+    (int8_t)0xbf,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0xc7,   (int8_t)0x0a,   (int8_t)0xb0,   (int8_t)0x60,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0x9d,   (int8_t)0xf5,   (int8_t)0xa0,   (int8_t)0xe9,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x1c,
+    (int8_t)0x40,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0x2d,   (int8_t)0x59,   (int8_t)0xe5,   (int8_t)0xab,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x36,   (int8_t)0x96,   (int8_t)0xdf,   (int8_t)0x3c,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0x3f,
+    (int8_t)0x7e,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x4e,   (int8_t)0xae,   (int8_t)0xca,   (int8_t)0x78,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0xc0,   (int8_t)0x9a,   (int8_t)0xa4,   (int8_t)0x74,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x41,
+    (int8_t)0x10,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0xf4,   (int8_t)0x22,   (int8_t)0xd1,   (int8_t)0xf4,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0xdb,   (int8_t)0xb0,   (int8_t)0x9e,   (int8_t)0xf2,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0xf9,
+    (int8_t)0x01,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0xaa,   (int8_t)0xeb,   (int8_t)0x14,   (int8_t)0x33,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x2f,   (int8_t)0x86,   (int8_t)0xb9,   (int8_t)0x78,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x17,
+    (int8_t)0x6a,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0x9b,   (int8_t)0x95,   (int8_t)0x7a,   (int8_t)0x1d,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0x60,   (int8_t)0x1b,   (int8_t)0xb3,   (int8_t)0x31,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0xf1,
+    (int8_t)0xa5,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x81,   (int8_t)0x9b,   (int8_t)0xbd,   (int8_t)0x3d,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0x74,   (int8_t)0xdc,   (int8_t)0xbd,   (int8_t)0x7f,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x35,
+    (int8_t)0x92,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x34,   (int8_t)0x6a,   (int8_t)0x44,   (int8_t)0xcb,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::ROLS[128] = {
+    (int8_t)0x8b,   (int8_t)0xce,   (int8_t)0x1b,   (int8_t)0x48,   (int8_t)0xc3,   (int8_t)0x8e,   (int8_t)0x83,   (int8_t)0xbc,
+    (int8_t)0xbf,   (int8_t)0xa9,   (int8_t)0x19,   (int8_t)0x1f,   (int8_t)0x50,   (int8_t)0x61,   (int8_t)0x18,   (int8_t)0x76,
+    (int8_t)0xc6,   (int8_t)0xce,   (int8_t)0xeb,   (int8_t)0x05,   (int8_t)0x9e,   (int8_t)0x0c,   (int8_t)0xe7,   (int8_t)0x70,
+    (int8_t)0x08,   (int8_t)0xdb,   (int8_t)0xae,   (int8_t)0x96,   (int8_t)0xca,   (int8_t)0x5e,   (int8_t)0xea,   (int8_t)0xf5,
+    (int8_t)0xda,   (int8_t)0x63,   (int8_t)0x2d,   (int8_t)0xfe,   (int8_t)0xc3,   (int8_t)0xf4,   (int8_t)0x91,   (int8_t)0x7e,
+    (int8_t)0x3f,   (int8_t)0xc7,   (int8_t)0xf8,   (int8_t)0x39,   (int8_t)0x75,   (int8_t)0xac,   (int8_t)0xe1,   (int8_t)0xc4,
+    (int8_t)0xdc,   (int8_t)0xc0,   (int8_t)0x53,   (int8_t)0x25,   (int8_t)0x8e,   (int8_t)0xa7,   (int8_t)0x29,   (int8_t)0x50,
+    (int8_t)0x08,   (int8_t)0xb4,   (int8_t)0x0f,   (int8_t)0xf4,   (int8_t)0x11,   (int8_t)0x47,   (int8_t)0xd3,   (int8_t)0x37,
+    (int8_t)0x34,   (int8_t)0xb7,   (int8_t)0x0b,   (int8_t)0xf4,   (int8_t)0xbc,   (int8_t)0x5a,   (int8_t)0xc2,   (int8_t)0xf3,
+    (int8_t)0x40,   (int8_t)0x1f,   (int8_t)0x67,   (int8_t)0x55,   (int8_t)0x5f,   (int8_t)0x50,   (int8_t)0xcc,   (int8_t)0x35,
+    (int8_t)0xde,   (int8_t)0xf2,   (int8_t)0x43,   (int8_t)0xcd,   (int8_t)0x78,   (int8_t)0xe9,   (int8_t)0x2d,   (int8_t)0x5c,
+    (int8_t)0x6a,   (int8_t)0x26,   (int8_t)0xfb,   (int8_t)0x6e,   (int8_t)0xac,   (int8_t)0x3d,   (int8_t)0x47,   (int8_t)0x6a,
+    (int8_t)0x70,   (int8_t)0x06,   (int8_t)0xb1,   (int8_t)0x9d,   (int8_t)0x98,   (int8_t)0xfb,   (int8_t)0x3a,   (int8_t)0xf1,
+    (int8_t)0x4b,   (int8_t)0x42,   (int8_t)0xd5,   (int8_t)0x60,   (int8_t)0xdc,   (int8_t)0x7b,   (int8_t)0x3d,   (int8_t)0x07,
+    (int8_t)0x96,   (int8_t)0x1d,   (int8_t)0xcd,   (int8_t)0xed,   (int8_t)0xef,   (int8_t)0x93,   (int8_t)0x48,   (int8_t)0x6a,
+    (int8_t)0x4a,   (int8_t)0x74,   (int8_t)0x81,   (int8_t)0x43,   (int8_t)0x53,   (int8_t)0x11,   (int8_t)0xf2,   (int8_t)0x5f
+};
+
+const int8_t DataSet_1_8i::outputs::MROLS[128] = {
+    (int8_t)0x71,   (int8_t)0xce,   (int8_t)0x1b,   (int8_t)0x09,   (int8_t)0xc3,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0xbc,
+    (int8_t)0xbf,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0x1f,   (int8_t)0x0a,   (int8_t)0x61,   (int8_t)0x18,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0xce,   (int8_t)0xeb,   (int8_t)0xa0,   (int8_t)0x9e,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x70,
+    (int8_t)0x08,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0x96,   (int8_t)0x59,   (int8_t)0x5e,   (int8_t)0xea,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x63,   (int8_t)0x2d,   (int8_t)0xdf,   (int8_t)0xc3,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0x7e,
+    (int8_t)0x3f,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x39,   (int8_t)0xae,   (int8_t)0xac,   (int8_t)0xe1,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0xc0,   (int8_t)0x53,   (int8_t)0xa4,   (int8_t)0x8e,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x50,
+    (int8_t)0x08,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0xf4,   (int8_t)0x22,   (int8_t)0x47,   (int8_t)0xd3,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0xb7,   (int8_t)0x0b,   (int8_t)0x9e,   (int8_t)0xbc,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0xf3,
+    (int8_t)0x40,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0x55,   (int8_t)0xeb,   (int8_t)0x50,   (int8_t)0xcc,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0xf2,   (int8_t)0x43,   (int8_t)0xb9,   (int8_t)0x78,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x5c,
+    (int8_t)0x6a,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0x6e,   (int8_t)0x95,   (int8_t)0x3d,   (int8_t)0x47,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0x06,   (int8_t)0xb1,   (int8_t)0xb3,   (int8_t)0x98,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0xf1,
+    (int8_t)0x4b,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x60,   (int8_t)0x9b,   (int8_t)0x7b,   (int8_t)0x3d,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0x1d,   (int8_t)0xcd,   (int8_t)0xbd,   (int8_t)0xef,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x6a,
+    (int8_t)0x4a,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x43,   (int8_t)0x6a,   (int8_t)0x11,   (int8_t)0xf2,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::RORV[128] = {
+    (int8_t)0x17,   (int8_t)0x9d,   (int8_t)0x1b,   (int8_t)0x90,   (int8_t)0xe1,   (int8_t)0x8e,   (int8_t)0xc1,   (int8_t)0xcb,
+    (int8_t)0xfe,   (int8_t)0xa6,   (int8_t)0x91,   (int8_t)0xf1,   (int8_t)0x41,   (int8_t)0x0b,   (int8_t)0x18,   (int8_t)0xb3,
+    (int8_t)0xc6,   (int8_t)0x9d,   (int8_t)0x5f,   (int8_t)0x05,   (int8_t)0xa7,   (int8_t)0x18,   (int8_t)0xcf,   (int8_t)0x07,
+    (int8_t)0x04,   (int8_t)0xf6,   (int8_t)0xba,   (int8_t)0x2d,   (int8_t)0x65,   (int8_t)0x97,   (int8_t)0xea,   (int8_t)0xfa,
+    (int8_t)0xb5,   (int8_t)0xd8,   (int8_t)0x69,   (int8_t)0xf7,   (int8_t)0xf0,   (int8_t)0xd3,   (int8_t)0x8c,   (int8_t)0xf3,
+    (int8_t)0x7e,   (int8_t)0xe3,   (int8_t)0xf1,   (int8_t)0x93,   (int8_t)0xea,   (int8_t)0x2b,   (int8_t)0x1e,   (int8_t)0x4c,
+    (int8_t)0xdc,   (int8_t)0x03,   (int8_t)0xa9,   (int8_t)0x29,   (int8_t)0x47,   (int8_t)0x4f,   (int8_t)0x92,   (int8_t)0x50,
+    (int8_t)0x10,   (int8_t)0xa5,   (int8_t)0x1e,   (int8_t)0xd3,   (int8_t)0x22,   (int8_t)0x74,   (int8_t)0x3d,   (int8_t)0xb9,
+    (int8_t)0x0d,   (int8_t)0xbd,   (int8_t)0xc2,   (int8_t)0x3d,   (int8_t)0xbc,   (int8_t)0xa5,   (int8_t)0xc2,   (int8_t)0x9f,
+    (int8_t)0x40,   (int8_t)0xf1,   (int8_t)0xce,   (int8_t)0xaa,   (int8_t)0xd7,   (int8_t)0x05,   (int8_t)0xcc,   (int8_t)0x53,
+    (int8_t)0x6f,   (int8_t)0xbc,   (int8_t)0x86,   (int8_t)0xdc,   (int8_t)0xe1,   (int8_t)0xe9,   (int8_t)0x4b,   (int8_t)0xc5,
+    (int8_t)0xa9,   (int8_t)0x4c,   (int8_t)0xbf,   (int8_t)0xe6,   (int8_t)0x56,   (int8_t)0x7a,   (int8_t)0x47,   (int8_t)0xd4,
+    (int8_t)0x70,   (int8_t)0x81,   (int8_t)0x6c,   (int8_t)0x67,   (int8_t)0x31,   (int8_t)0xfe,   (int8_t)0x74,   (int8_t)0xc7,
+    (int8_t)0x5a,   (int8_t)0x24,   (int8_t)0x57,   (int8_t)0x60,   (int8_t)0xb9,   (int8_t)0xdb,   (int8_t)0xf4,   (int8_t)0x0e,
+    (int8_t)0xb4,   (int8_t)0x1d,   (int8_t)0x73,   (int8_t)0xf6,   (int8_t)0xf7,   (int8_t)0x93,   (int8_t)0x24,   (int8_t)0x53,
+    (int8_t)0xa4,   (int8_t)0x3a,   (int8_t)0x0c,   (int8_t)0xd0,   (int8_t)0xa9,   (int8_t)0x11,   (int8_t)0xf2,   (int8_t)0x5f
+};
+
+const int8_t DataSet_1_8i::outputs::MRORV[128] = {
+    (int8_t)0x71,   (int8_t)0x9d,   (int8_t)0x1b,   (int8_t)0x09,   (int8_t)0xe1,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0xcb,
+    (int8_t)0xfe,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0xf1,   (int8_t)0x0a,   (int8_t)0x0b,   (int8_t)0x18,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0x9d,   (int8_t)0x5f,   (int8_t)0xa0,   (int8_t)0xa7,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x07,
+    (int8_t)0x04,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0x2d,   (int8_t)0x59,   (int8_t)0x97,   (int8_t)0xea,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0xd8,   (int8_t)0x69,   (int8_t)0xdf,   (int8_t)0xf0,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0xf3,
+    (int8_t)0x7e,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x93,   (int8_t)0xae,   (int8_t)0x2b,   (int8_t)0x1e,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x03,   (int8_t)0xa9,   (int8_t)0xa4,   (int8_t)0x47,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x50,
+    (int8_t)0x10,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0xd3,   (int8_t)0x22,   (int8_t)0x74,   (int8_t)0x3d,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0xbd,   (int8_t)0xc2,   (int8_t)0x9e,   (int8_t)0xbc,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x9f,
+    (int8_t)0x40,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0xaa,   (int8_t)0xeb,   (int8_t)0x05,   (int8_t)0xcc,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0xbc,   (int8_t)0x86,   (int8_t)0xb9,   (int8_t)0xe1,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0xc5,
+    (int8_t)0xa9,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0xe6,   (int8_t)0x95,   (int8_t)0x7a,   (int8_t)0x47,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0x81,   (int8_t)0x6c,   (int8_t)0xb3,   (int8_t)0x31,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0xc7,
+    (int8_t)0x5a,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x60,   (int8_t)0x9b,   (int8_t)0xdb,   (int8_t)0xf4,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0x1d,   (int8_t)0x73,   (int8_t)0xbd,   (int8_t)0xf7,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x53,
+    (int8_t)0xa4,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0xd0,   (int8_t)0x6a,   (int8_t)0x11,   (int8_t)0xf2,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::RORS[128] = {
+    (int8_t)0x2e,   (int8_t)0x3b,   (int8_t)0x6c,   (int8_t)0x21,   (int8_t)0x0f,   (int8_t)0x3a,   (int8_t)0x0e,   (int8_t)0xf2,
+    (int8_t)0xfe,   (int8_t)0xa6,   (int8_t)0x64,   (int8_t)0x7c,   (int8_t)0x41,   (int8_t)0x85,   (int8_t)0x60,   (int8_t)0xd9,
+    (int8_t)0x1b,   (int8_t)0x3b,   (int8_t)0xaf,   (int8_t)0x14,   (int8_t)0x7a,   (int8_t)0x30,   (int8_t)0x9f,   (int8_t)0xc1,
+    (int8_t)0x20,   (int8_t)0x6f,   (int8_t)0xba,   (int8_t)0x5a,   (int8_t)0x2b,   (int8_t)0x79,   (int8_t)0xab,   (int8_t)0xd7,
+    (int8_t)0x6b,   (int8_t)0x8d,   (int8_t)0xb4,   (int8_t)0xfb,   (int8_t)0x0f,   (int8_t)0xd3,   (int8_t)0x46,   (int8_t)0xf9,
+    (int8_t)0xfc,   (int8_t)0x1f,   (int8_t)0xe3,   (int8_t)0xe4,   (int8_t)0xd5,   (int8_t)0xb2,   (int8_t)0x87,   (int8_t)0x13,
+    (int8_t)0x73,   (int8_t)0x03,   (int8_t)0x4d,   (int8_t)0x94,   (int8_t)0x3a,   (int8_t)0x9e,   (int8_t)0xa4,   (int8_t)0x41,
+    (int8_t)0x20,   (int8_t)0xd2,   (int8_t)0x3c,   (int8_t)0xd3,   (int8_t)0x44,   (int8_t)0x1d,   (int8_t)0x4f,   (int8_t)0xdc,
+    (int8_t)0xd0,   (int8_t)0xde,   (int8_t)0x2c,   (int8_t)0xd3,   (int8_t)0xf2,   (int8_t)0x69,   (int8_t)0x0b,   (int8_t)0xcf,
+    (int8_t)0x01,   (int8_t)0x7c,   (int8_t)0x9d,   (int8_t)0x55,   (int8_t)0x7d,   (int8_t)0x41,   (int8_t)0x33,   (int8_t)0xd4,
+    (int8_t)0x7b,   (int8_t)0xcb,   (int8_t)0x0d,   (int8_t)0x37,   (int8_t)0xe1,   (int8_t)0xa7,   (int8_t)0xb4,   (int8_t)0x71,
+    (int8_t)0xa9,   (int8_t)0x98,   (int8_t)0xef,   (int8_t)0xb9,   (int8_t)0xb2,   (int8_t)0xf4,   (int8_t)0x1d,   (int8_t)0xa9,
+    (int8_t)0xc1,   (int8_t)0x18,   (int8_t)0xc6,   (int8_t)0x76,   (int8_t)0x62,   (int8_t)0xef,   (int8_t)0xe8,   (int8_t)0xc7,
+    (int8_t)0x2d,   (int8_t)0x09,   (int8_t)0x57,   (int8_t)0x81,   (int8_t)0x73,   (int8_t)0xed,   (int8_t)0xf4,   (int8_t)0x1c,
+    (int8_t)0x5a,   (int8_t)0x74,   (int8_t)0x37,   (int8_t)0xb7,   (int8_t)0xbf,   (int8_t)0x4e,   (int8_t)0x21,   (int8_t)0xa9,
+    (int8_t)0x29,   (int8_t)0xd1,   (int8_t)0x06,   (int8_t)0x0d,   (int8_t)0x4d,   (int8_t)0x44,   (int8_t)0xcb,   (int8_t)0x7d
+};
+
+const int8_t DataSet_1_8i::outputs::MRORS[128] = {
+    (int8_t)0x71,   (int8_t)0x3b,   (int8_t)0x6c,   (int8_t)0x09,   (int8_t)0x0f,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0xf2,
+    (int8_t)0xfe,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0x7c,   (int8_t)0x0a,   (int8_t)0x85,   (int8_t)0x60,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0x3b,   (int8_t)0xaf,   (int8_t)0xa0,   (int8_t)0x7a,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0xc1,
+    (int8_t)0x20,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0x5a,   (int8_t)0x59,   (int8_t)0x79,   (int8_t)0xab,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x8d,   (int8_t)0xb4,   (int8_t)0xdf,   (int8_t)0x0f,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0xf9,
+    (int8_t)0xfc,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0xe4,   (int8_t)0xae,   (int8_t)0xb2,   (int8_t)0x87,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x03,   (int8_t)0x4d,   (int8_t)0xa4,   (int8_t)0x3a,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x41,
+    (int8_t)0x20,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0xd3,   (int8_t)0x22,   (int8_t)0x1d,   (int8_t)0x4f,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0xde,   (int8_t)0x2c,   (int8_t)0x9e,   (int8_t)0xf2,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0xcf,
+    (int8_t)0x01,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0x55,   (int8_t)0xeb,   (int8_t)0x41,   (int8_t)0x33,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0xcb,   (int8_t)0x0d,   (int8_t)0xb9,   (int8_t)0xe1,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x71,
+    (int8_t)0xa9,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0xb9,   (int8_t)0x95,   (int8_t)0xf4,   (int8_t)0x1d,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0x18,   (int8_t)0xc6,   (int8_t)0xb3,   (int8_t)0x62,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0xc7,
+    (int8_t)0x2d,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x81,   (int8_t)0x9b,   (int8_t)0xed,   (int8_t)0xf4,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0x74,   (int8_t)0x37,   (int8_t)0xbd,   (int8_t)0xbf,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0xa9,
+    (int8_t)0x29,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x0d,   (int8_t)0x6a,   (int8_t)0x44,   (int8_t)0xcb,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::NEG[128] = {
+    (int8_t)0x8f,   (int8_t)0x27,   (int8_t)0x9d,   (int8_t)0xf7,   (int8_t)0x88,   (int8_t)0x2f,   (int8_t)0x90,   (int8_t)0x69,
+    (int8_t)0x09,   (int8_t)0xcb,   (int8_t)0xdd,   (int8_t)0x1d,   (int8_t)0xf6,   (int8_t)0xd4,   (int8_t)0xfd,   (int8_t)0x32,
+    (int8_t)0x28,   (int8_t)0x27,   (int8_t)0x83,   (int8_t)0x60,   (int8_t)0x2d,   (int8_t)0x7f,   (int8_t)0x04,   (int8_t)0xf2,
+    (int8_t)0xff,   (int8_t)0x85,   (int8_t)0x2b,   (int8_t)0x2e,   (int8_t)0xa7,   (int8_t)0x35,   (int8_t)0xa3,   (int8_t)0x42,
+    (int8_t)0xa5,   (int8_t)0x94,   (int8_t)0x5b,   (int8_t)0x21,   (int8_t)0x88,   (int8_t)0x62,   (int8_t)0xce,   (int8_t)0x31,
+    (int8_t)0x19,   (int8_t)0x08,   (int8_t)0xe1,   (int8_t)0xd9,   (int8_t)0x52,   (int8_t)0x6b,   (int8_t)0xc4,   (int8_t)0x68,
+    (int8_t)0x65,   (int8_t)0xe8,   (int8_t)0x96,   (int8_t)0x5c,   (int8_t)0x2f,   (int8_t)0x0c,   (int8_t)0xdb,   (int8_t)0xf6,
+    (int8_t)0xff,   (int8_t)0x6a,   (int8_t)0x1f,   (int8_t)0x62,   (int8_t)0xde,   (int8_t)0x18,   (int8_t)0x86,   (int8_t)0x1a,
+    (int8_t)0x7a,   (int8_t)0x0a,   (int8_t)0x9f,   (int8_t)0x62,   (int8_t)0x69,   (int8_t)0xb5,   (int8_t)0xa8,   (int8_t)0x82,
+    (int8_t)0xf8,   (int8_t)0x1d,   (int8_t)0x14,   (int8_t)0x56,   (int8_t)0x15,   (int8_t)0xf6,   (int8_t)0x67,   (int8_t)0x5a,
+    (int8_t)0x25,   (int8_t)0xa2,   (int8_t)0x98,   (int8_t)0x47,   (int8_t)0xf1,   (int8_t)0xc3,   (int8_t)0x5b,   (int8_t)0x75,
+    (int8_t)0xb3,   (int8_t)0x3c,   (int8_t)0x81,   (int8_t)0x33,   (int8_t)0x6b,   (int8_t)0x59,   (int8_t)0x18,   (int8_t)0xb3,
+    (int8_t)0xf2,   (int8_t)0x40,   (int8_t)0xca,   (int8_t)0x4d,   (int8_t)0xed,   (int8_t)0x81,   (int8_t)0xb9,   (int8_t)0xc2,
+    (int8_t)0x97,   (int8_t)0xb8,   (int8_t)0x46,   (int8_t)0xf4,   (int8_t)0x65,   (int8_t)0x91,   (int8_t)0x59,   (int8_t)0x20,
+    (int8_t)0x2e,   (int8_t)0x5d,   (int8_t)0x47,   (int8_t)0x43,   (int8_t)0x03,   (int8_t)0x8e,   (int8_t)0xf7,   (int8_t)0xb3,
+    (int8_t)0xb7,   (int8_t)0x72,   (int8_t)0xd0,   (int8_t)0x98,   (int8_t)0x96,   (int8_t)0xde,   (int8_t)0xa2,   (int8_t)0x15
+};
+
+const int8_t DataSet_1_8i::outputs::MNEG[128] = {
+    (int8_t)0x71,   (int8_t)0x27,   (int8_t)0x9d,   (int8_t)0x09,   (int8_t)0x88,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0x69,
+    (int8_t)0x09,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0x1d,   (int8_t)0x0a,   (int8_t)0xd4,   (int8_t)0xfd,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0x27,   (int8_t)0x83,   (int8_t)0xa0,   (int8_t)0x2d,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0xf2,
+    (int8_t)0xff,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0x2e,   (int8_t)0x59,   (int8_t)0x35,   (int8_t)0xa3,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x94,   (int8_t)0x5b,   (int8_t)0xdf,   (int8_t)0x88,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0x31,
+    (int8_t)0x19,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0xd9,   (int8_t)0xae,   (int8_t)0x6b,   (int8_t)0xc4,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0xe8,   (int8_t)0x96,   (int8_t)0xa4,   (int8_t)0x2f,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0xf6,
+    (int8_t)0xff,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0x62,   (int8_t)0x22,   (int8_t)0x18,   (int8_t)0x86,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0x0a,   (int8_t)0x9f,   (int8_t)0x9e,   (int8_t)0x69,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x82,
+    (int8_t)0xf8,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0x56,   (int8_t)0xeb,   (int8_t)0xf6,   (int8_t)0x67,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0xa2,   (int8_t)0x98,   (int8_t)0xb9,   (int8_t)0xf1,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x75,
+    (int8_t)0xb3,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0x33,   (int8_t)0x95,   (int8_t)0x59,   (int8_t)0x18,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0x40,   (int8_t)0xca,   (int8_t)0xb3,   (int8_t)0xed,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0xc2,
+    (int8_t)0x97,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0xf4,   (int8_t)0x9b,   (int8_t)0x91,   (int8_t)0x59,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0x5d,   (int8_t)0x47,   (int8_t)0xbd,   (int8_t)0x03,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0xb3,
+    (int8_t)0xb7,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x98,   (int8_t)0x6a,   (int8_t)0xde,   (int8_t)0xa2,   (int8_t)0xeb
+};
+
+const int8_t DataSet_1_8i::outputs::ABS[128] = {
+    (int8_t)0x71,   (int8_t)0x27,   (int8_t)0x63,   (int8_t)0x09,   (int8_t)0x78,   (int8_t)0x2f,   (int8_t)0x70,   (int8_t)0x69,
+    (int8_t)0x09,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0x1d,   (int8_t)0x0a,   (int8_t)0x2c,   (int8_t)0x03,   (int8_t)0x32,
+    (int8_t)0x28,   (int8_t)0x27,   (int8_t)0x7d,   (int8_t)0x60,   (int8_t)0x2d,   (int8_t)0x7f,   (int8_t)0x04,   (int8_t)0x0e,
+    (int8_t)0x01,   (int8_t)0x7b,   (int8_t)0x2b,   (int8_t)0x2e,   (int8_t)0x59,   (int8_t)0x35,   (int8_t)0x5d,   (int8_t)0x42,
+    (int8_t)0x5b,   (int8_t)0x6c,   (int8_t)0x5b,   (int8_t)0x21,   (int8_t)0x78,   (int8_t)0x62,   (int8_t)0x32,   (int8_t)0x31,
+    (int8_t)0x19,   (int8_t)0x08,   (int8_t)0x1f,   (int8_t)0x27,   (int8_t)0x52,   (int8_t)0x6b,   (int8_t)0x3c,   (int8_t)0x68,
+    (int8_t)0x65,   (int8_t)0x18,   (int8_t)0x6a,   (int8_t)0x5c,   (int8_t)0x2f,   (int8_t)0x0c,   (int8_t)0x25,   (int8_t)0x0a,
+    (int8_t)0x01,   (int8_t)0x6a,   (int8_t)0x1f,   (int8_t)0x62,   (int8_t)0x22,   (int8_t)0x18,   (int8_t)0x7a,   (int8_t)0x1a,
+    (int8_t)0x7a,   (int8_t)0x0a,   (int8_t)0x61,   (int8_t)0x62,   (int8_t)0x69,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x7e,
+    (int8_t)0x08,   (int8_t)0x1d,   (int8_t)0x14,   (int8_t)0x56,   (int8_t)0x15,   (int8_t)0x0a,   (int8_t)0x67,   (int8_t)0x5a,
+    (int8_t)0x25,   (int8_t)0x5e,   (int8_t)0x68,   (int8_t)0x47,   (int8_t)0x0f,   (int8_t)0x3d,   (int8_t)0x5b,   (int8_t)0x75,
+    (int8_t)0x4d,   (int8_t)0x3c,   (int8_t)0x7f,   (int8_t)0x33,   (int8_t)0x6b,   (int8_t)0x59,   (int8_t)0x18,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0x40,   (int8_t)0x36,   (int8_t)0x4d,   (int8_t)0x13,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x3e,
+    (int8_t)0x69,   (int8_t)0x48,   (int8_t)0x46,   (int8_t)0x0c,   (int8_t)0x65,   (int8_t)0x6f,   (int8_t)0x59,   (int8_t)0x20,
+    (int8_t)0x2e,   (int8_t)0x5d,   (int8_t)0x47,   (int8_t)0x43,   (int8_t)0x03,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x4d,
+    (int8_t)0x49,   (int8_t)0x72,   (int8_t)0x30,   (int8_t)0x68,   (int8_t)0x6a,   (int8_t)0x22,   (int8_t)0x5e,   (int8_t)0x15
+};
+
+const int8_t DataSet_1_8i::outputs::MABS[128] = {
+    (int8_t)0x71,   (int8_t)0x27,   (int8_t)0x63,   (int8_t)0x09,   (int8_t)0x78,   (int8_t)0xd1,   (int8_t)0x70,   (int8_t)0x69,
+    (int8_t)0x09,   (int8_t)0x35,   (int8_t)0x23,   (int8_t)0x1d,   (int8_t)0x0a,   (int8_t)0x2c,   (int8_t)0x03,   (int8_t)0xce,
+    (int8_t)0xd8,   (int8_t)0x27,   (int8_t)0x7d,   (int8_t)0xa0,   (int8_t)0x2d,   (int8_t)0x81,   (int8_t)0xfc,   (int8_t)0x0e,
+    (int8_t)0x01,   (int8_t)0x7b,   (int8_t)0xd5,   (int8_t)0x2e,   (int8_t)0x59,   (int8_t)0x35,   (int8_t)0x5d,   (int8_t)0xbe,
+    (int8_t)0x5b,   (int8_t)0x6c,   (int8_t)0x5b,   (int8_t)0xdf,   (int8_t)0x78,   (int8_t)0x9e,   (int8_t)0x32,   (int8_t)0x31,
+    (int8_t)0x19,   (int8_t)0xf8,   (int8_t)0x1f,   (int8_t)0x27,   (int8_t)0xae,   (int8_t)0x6b,   (int8_t)0x3c,   (int8_t)0x98,
+    (int8_t)0x9b,   (int8_t)0x18,   (int8_t)0x6a,   (int8_t)0xa4,   (int8_t)0x2f,   (int8_t)0xf4,   (int8_t)0x25,   (int8_t)0x0a,
+    (int8_t)0x01,   (int8_t)0x96,   (int8_t)0xe1,   (int8_t)0x62,   (int8_t)0x22,   (int8_t)0x18,   (int8_t)0x7a,   (int8_t)0xe6,
+    (int8_t)0x86,   (int8_t)0x0a,   (int8_t)0x61,   (int8_t)0x9e,   (int8_t)0x69,   (int8_t)0x4b,   (int8_t)0x58,   (int8_t)0x7e,
+    (int8_t)0x08,   (int8_t)0xe3,   (int8_t)0xec,   (int8_t)0x56,   (int8_t)0xeb,   (int8_t)0x0a,   (int8_t)0x67,   (int8_t)0xa6,
+    (int8_t)0xdb,   (int8_t)0x5e,   (int8_t)0x68,   (int8_t)0xb9,   (int8_t)0x0f,   (int8_t)0x3d,   (int8_t)0xa5,   (int8_t)0x75,
+    (int8_t)0x4d,   (int8_t)0xc4,   (int8_t)0x7f,   (int8_t)0x33,   (int8_t)0x95,   (int8_t)0x59,   (int8_t)0x18,   (int8_t)0x4d,
+    (int8_t)0x0e,   (int8_t)0x40,   (int8_t)0x36,   (int8_t)0xb3,   (int8_t)0x13,   (int8_t)0x7f,   (int8_t)0x47,   (int8_t)0x3e,
+    (int8_t)0x69,   (int8_t)0x48,   (int8_t)0xba,   (int8_t)0x0c,   (int8_t)0x9b,   (int8_t)0x6f,   (int8_t)0x59,   (int8_t)0xe0,
+    (int8_t)0xd2,   (int8_t)0x5d,   (int8_t)0x47,   (int8_t)0xbd,   (int8_t)0x03,   (int8_t)0x72,   (int8_t)0x09,   (int8_t)0x4d,
+    (int8_t)0x49,   (int8_t)0x8e,   (int8_t)0x30,   (int8_t)0x68,   (int8_t)0x6a,   (int8_t)0x22,   (int8_t)0x5e,   (int8_t)0xeb
+};
+
+const uint8_t DataSet_1_8i::outputs::ITOU[128] = {
+    0x71,   0xd9,   0x63,   0x09,   0x78,   0xd1,   0x70,   0x97,
+    0xf7,   0x35,   0x23,   0xe3,   0x0a,   0x2c,   0x03,   0xce,
+    0xd8,   0xd9,   0x7d,   0xa0,   0xd3,   0x81,   0xfc,   0x0e,
+    0x01,   0x7b,   0xd5,   0xd2,   0x59,   0xcb,   0x5d,   0xbe,
+    0x5b,   0x6c,   0xa5,   0xdf,   0x78,   0x9e,   0x32,   0xcf,
+    0xe7,   0xf8,   0x1f,   0x27,   0xae,   0x95,   0x3c,   0x98,
+    0x9b,   0x18,   0x6a,   0xa4,   0xd1,   0xf4,   0x25,   0x0a,
+    0x01,   0x96,   0xe1,   0x9e,   0x22,   0xe8,   0x7a,   0xe6,
+    0x86,   0xf6,   0x61,   0x9e,   0x97,   0x4b,   0x58,   0x7e,
+    0x08,   0xe3,   0xec,   0xaa,   0xeb,   0x0a,   0x99,   0xa6,
+    0xdb,   0x5e,   0x68,   0xb9,   0x0f,   0x3d,   0xa5,   0x8b,
+    0x4d,   0xc4,   0x7f,   0xcd,   0x95,   0xa7,   0xe8,   0x4d,
+    0x0e,   0xc0,   0x36,   0xb3,   0x13,   0x7f,   0x47,   0x3e,
+    0x69,   0x48,   0xba,   0x0c,   0x9b,   0x6f,   0xa7,   0xe0,
+    0xd2,   0xa3,   0xb9,   0xbd,   0xfd,   0x72,   0x09,   0x4d,
+    0x49,   0x8e,   0x30,   0x68,   0x6a,   0x22,   0x5e,   0xeb
+};
@@ -0,0 +1,93 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_UNIT_TEST_HISTOGRAM_H_
+#define UME_UNIT_TEST_HISTOGRAM_H_
+
+#include <vector>
+
+#include "UMEUnitTestCommon.h"
+#include "../UMESimdHistogram.h"
+
+template<uint32_t VEC_LEN>
+struct HistogramTestBinning {
+    uint32_t divisor;
+
+    UME::SIMD::SIMDVec<uint32_t, VEC_LEN> operator() (UME::SIMD::SIMDVec<uint32_t, VEC_LEN> const & x) const {
+        return x.div(divisor);
+    }
+};
+
+template<uint32_t VEC_LEN>
+void generic_HistogramTest(uint32_t count, uint32_t binCount, uint32_t threadCount) {
+    const uint32_t DIVISOR = 3;
+    std::vector<uint32_t> data(count);
+    // Counts are accumulated on top of the existing contents.
+    std::vector<uint32_t> hist(binCount, 1);
+    std::vector<uint32_t> expected(binCount, 1);
+
+    for (uint32_t i = 0; i < count; i++) {
+        data[i] = (i * 7919) % (binCount * DIVISOR);
+        expected[data[i] / DIVISOR]++;
+    }
+
+    HistogramTestBinning<VEC_LEN> binning;
+    binning.divisor = DIVISOR;
+    UME::SIMD::histogram<VEC_LEN>(data.data(), count, hist.data(), binCount, binning, threadCount);
+
+    std::string msg = "HISTOGRAM <";
+    msg.append(std::to_string(VEC_LEN));
+    msg.append(">, size ");
+    msg.append(std::to_string(count));
+    msg.append(", bins ");
+    msg.append(std::to_string(binCount));
+    msg.append(", threads ");
+    msg.append(std::to_string(threadCount));
+    check_condition(hist == expected, msg.c_str());
+}
+
+int test_histogram(bool supressMessages)
+{
+    char header[] = "UME::SIMD::histogram test";
+    INIT_TEST(header, supressMessages);
+
+    // Per-lane sub-histograms
+    generic_HistogramTest<1>(1001, 10, 1);
+    generic_HistogramTest<4>(0, 10, 1);
+    generic_HistogramTest<8>(1001, 100, 1);
+    generic_HistogramTest<16>(300001, 100, 4);
+    generic_HistogramTest<32>(77, 3, 2);
+    // One sub-histogram per thread, updated with scatteradd
+    generic_HistogramTest<8>(300001, 5001, 3);
+    generic_HistogramTest<16>(1001, 10000, 1);
+
+    return g_failCount;
+}
+#endif
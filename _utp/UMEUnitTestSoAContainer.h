@@ -0,0 +1,116 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_UNIT_TEST_SOA_CONTAINER_H_
+#define UME_UNIT_TEST_SOA_CONTAINER_H_
+
+#include "UMEUnitTestCommon.h"
+#include "../UMESoAContainer.h"
+
+struct SoATestParticle {
+    float x;
+    float v;
+    int32_t id;
+    float pad;
+};
+
+template<uint32_t VEC_LEN>
+void generic_SoAContainerTest(std::size_t count) {
+    UME::SIMD::SoAContainer<float, float, int32_t> soa(count);
+
+    std::vector<SoATestParticle> aos(count);
+    for (std::size_t i = 0; i < count; i++) {
+        aos[i].x = float(i);
+        aos[i].v = 0.5f * float(i);
+        aos[i].id = int32_t(i);
+        aos[i].pad = -1.0f;
+    }
+
+    bool isAligned = ((uint64_t(soa.field<0>()) % 128) == 0) && ((uint64_t(soa.field<2>()) % 128) == 0);
+    bool isPadded = (soa.capacity() % 128) == 0 && soa.capacity() >= count;
+
+    // AoS -> SoA
+    soa.fromAoS<VEC_LEN>(aos.data(), &SoATestParticle::x, &SoATestParticle::v, &SoATestParticle::id);
+    bool isGathered = true;
+    for (std::size_t i = 0; i < count; i++) {
+        isGathered &= (soa.field<0>()[i] == aos[i].x) && (soa.field<1>()[i] == aos[i].v) && (soa.field<2>()[i] == aos[i].id);
+    }
+
+    // x += v, id = -id, counting visited lanes through the mask
+    std::size_t visited = 0;
+    soa.for_each_vector<VEC_LEN>(
+        [&visited](UME::SIMD::SIMDVecMask<VEC_LEN> const & mask,
+            UME::SIMD::SIMDVec<float, VEC_LEN> & x,
+            UME::SIMD::SIMDVec<float, VEC_LEN> & v,
+            UME::SIMD::SIMDVec<int32_t, VEC_LEN> & id) {
+        x.adda(mask, v);
+        id = id.neg();
+        for (uint32_t i = 0; i < VEC_LEN; i++) visited += mask[i] ? 1 : 0;
+    });
+    bool isComputed = (visited == count);
+    for (std::size_t i = 0; i < count; i++) {
+        isComputed &= (soa.field<0>()[i] == 1.5f * float(i)) && (soa.field<2>()[i] == -int32_t(i));
+    }
+    // Padding has to stay untouched by the masked remainder
+    bool isPaddingZero = true;
+    for (std::size_t i = count; i < soa.capacity(); i++) {
+        isPaddingZero &= (soa.field<0>()[i] == 0.0f) && (soa.field<2>()[i] == 0);
+    }
+
+    // SoA -> AoS
+    soa.toAoS<VEC_LEN>(aos.data(), &SoATestParticle::x, &SoATestParticle::v, &SoATestParticle::id);
+    bool isScattered = true;
+    for (std::size_t i = 0; i < count; i++) {
+        isScattered &= (aos[i].x == 1.5f * float(i)) && (aos[i].id == -int32_t(i)) && (aos[i].pad == -1.0f);
+    }
+
+    std::string msg = "SOA CONTAINER <";
+    msg.append(std::to_string(VEC_LEN));
+    msg.append(">, size ");
+    msg.append(std::to_string(count));
+    check_condition(isAligned && isPadded && isGathered && isComputed && isPaddingZero && isScattered, msg.c_str());
+}
+
+int test_soa_container(bool supressMessages)
+{
+    char header[] = "UME::SIMD::SoAContainer test";
+    INIT_TEST(header, supressMessages);
+
+    generic_SoAContainerTest<1>(7);
+    generic_SoAContainerTest<4>(0);
+    generic_SoAContainerTest<4>(3);
+    generic_SoAContainerTest<4>(128);
+    generic_SoAContainerTest<8>(1001);
+    generic_SoAContainerTest<16>(1001);
+    generic_SoAContainerTest<32>(77);
+
+    return g_failCount;
+}
+#endif
@@ -0,0 +1,128 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_UNIT_TEST_SORT_H_
+#define UME_UNIT_TEST_SORT_H_
+
+
+#include <algorithm>
+#include <vector>
+
+#include "UMEUnitTestCommon.h"
+#include "../UMESimdSort.h"
+
+template<uint32_t VEC_LEN, typename SCALAR_T>
+void generic_SortTest(uint32_t count, uint32_t range) {
+    std::vector<SCALAR_T> data(count);
+    std::vector<SCALAR_T> expected(count);
+
+    for (uint32_t i = 0; i < count; i++) {
+        // Signed values with many duplicates when 'range' is small.
+        data[i] = SCALAR_T(int64_t((uint64_t(i) * 2654435761u) % range) - int64_t(range / 2));
+        expected[i] = data[i];
+    }
+    std::sort(expected.begin(), expected.end());
+
+    UME::SIMD::sort<VEC_LEN>(data.data(), count);
+
+    std::string msg = "SORT <";
+    msg.append(std::to_string(VEC_LEN));
+    msg.append(", ");
+    msg.append(sizeof(SCALAR_T) == 4 ? "32" : "64");
+    msg.append(std::is_floating_point<SCALAR_T>::value ? "f" : "i");
+    msg.append(">, size ");
+    msg.append(std::to_string(count));
+    msg.append(", range ");
+    msg.append(std::to_string(range));
+    check_condition(data == expected, msg.c_str());
+}
+
+template<typename VEC_T, typename MASK_T, typename SCALAR_T, uint32_t VEC_LEN>
+void generic_SortaCompressstoreTest() {
+    SCALAR_T values[VEC_LEN];
+    SCALAR_T compressed[VEC_LEN];
+    SCALAR_T result[VEC_LEN + 1];
+    bool maskValues[VEC_LEN];
+    uint32_t expectedCount = 0;
+
+    for (uint32_t i = 0; i < VEC_LEN; i++) {
+        values[i] = SCALAR_T(int32_t((i * 7 + 3) % VEC_LEN) - 2);
+        maskValues[i] = (i % 3) != 1;
+        if (maskValues[i]) compressed[expectedCount++] = values[i];
+    }
+
+    VEC_T vec(values);
+    MASK_T mask(maskValues);
+
+    // Element past the stored lanes must stay untouched.
+    for (uint32_t i = 0; i <= VEC_LEN; i++) result[i] = SCALAR_T(100);
+    uint32_t count = vec.compressstore(mask, result);
+    check_condition(count == expectedCount && result[count] == SCALAR_T(100) &&
+                    std::equal(compressed, compressed + count, result), "COMPRESSSTORE");
+
+    std::sort(values, values + VEC_LEN);
+    vec.sorta().store(result);
+    check_condition(std::equal(values, values + VEC_LEN, result), "SORTA");
+    vec.sortd().store(result);
+    std::reverse(result, result + VEC_LEN);
+    check_condition(std::equal(values, values + VEC_LEN, result), "SORTD");
+}
+
+int test_sort(bool supressMessages)
+{
+    char header[] = "UME::SIMD::sort test";
+    INIT_TEST(header, supressMessages);
+
+    generic_SortaCompressstoreTest<UME::SIMD::SIMD4_32f, UME::SIMD::SIMDMask4, float, 4>();
+    generic_SortaCompressstoreTest<UME::SIMD::SIMD8_32f, UME::SIMD::SIMDMask8, float, 8>();
+    generic_SortaCompressstoreTest<UME::SIMD::SIMD16_32f, UME::SIMD::SIMDMask16, float, 16>();
+    generic_SortaCompressstoreTest<UME::SIMD::SIMD8_32i, UME::SIMD::SIMDMask8, int32_t, 8>();
+    generic_SortaCompressstoreTest<UME::SIMD::SIMD16_32i, UME::SIMD::SIMDMask16, int32_t, 16>();
+    generic_SortaCompressstoreTest<UME::SIMD::SIMD8_32u, UME::SIMD::SIMDMask8, uint32_t, 8>();
+    generic_SortaCompressstoreTest<UME::SIMD::SIMD4_64i, UME::SIMD::SIMDMask4, int64_t, 4>();
+    generic_SortaCompressstoreTest<UME::SIMD::SIMD8_64i, UME::SIMD::SIMDMask8, int64_t, 8>();
+    generic_SortaCompressstoreTest<UME::SIMD::SIMD16_64i, UME::SIMD::SIMDMask16, int64_t, 16>();
+
+    // Sorting networks only
+    generic_SortTest<8, float>(1, 10);
+    generic_SortTest<8, float>(29, 1000);
+    generic_SortTest<16, int32_t>(64, 1000);
+    // Vectorized partitioning
+    generic_SortTest<4, float>(10001, 100000);
+    generic_SortTest<8, float>(100001, 100000);
+    generic_SortTest<16, float>(100001, 7);
+    generic_SortTest<8, int32_t>(100001, 1);
+    generic_SortTest<16, int32_t>(100001, 100000);
+    generic_SortTest<4, int64_t>(10001, 100000);
+    generic_SortTest<8, int64_t>(100001, 3);
+
+    return g_failCount;
+}
+#endif
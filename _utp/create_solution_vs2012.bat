@@ -0,0 +1,4 @@
+mkdir vs2012project
+cd vs2012project
+cmake .. -G "Visual Studio 11 2012" 	
+cd ..
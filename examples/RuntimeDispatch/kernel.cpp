@@ -0,0 +1,68 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+
+// Kernel translation unit. This file is compiled once for every instruction set
+// (see Makefile). Each compilation places the kernel in a different namespace
+// ('UME_SIMD_ISA_NAMESPACE') and uses the plugin selected by the compiler flags.
+
+#define UME_SIMD_MULTIVERSION
+#include "../../UMESimd.h"
+
+namespace UME_SIMD_ISA_NAMESPACE
+{
+    // Computes y[i] = a*x[i] + y[i]
+    template<typename FLOAT_T, int VEC_LEN>
+    void axpy_impl(FLOAT_T a, FLOAT_T const * x, FLOAT_T * y, int n) {
+        typedef UME::SIMD::SIMDVec<FLOAT_T, VEC_LEN> FLOAT_VEC_T;
+
+        int PEEL_COUNT = n / VEC_LEN;
+        int REM_COUNT = n % VEC_LEN;
+
+        FLOAT_VEC_T a_vec(a);
+        for (int i = 0; i < PEEL_COUNT * VEC_LEN; i += VEC_LEN) {
+            FLOAT_VEC_T x_vec(&x[i]);
+            FLOAT_VEC_T y_vec(&y[i]);
+            y_vec = a_vec.fmuladd(x_vec, y_vec);
+            y_vec.store(&y[i]);
+        }
+        for (int i = PEEL_COUNT * VEC_LEN; i < PEEL_COUNT * VEC_LEN + REM_COUNT; i++) {
+            y[i] = a * x[i] + y[i];
+        }
+    }
+
+    void axpy(float a, float const * x, float * y, int n) {
+        axpy_impl<float, UME::SIMD::ISATraits::NativeLength<float>()>(a, x, y, n);
+    }
+
+    const char* isa_name() {
+        return UME::SIMD::RuntimeISA::name(UME_SIMD_COMPILED_ISA);
+    }
+}
@@ -0,0 +1,69 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+
+// Dispatching translation unit. This file is compiled with baseline compiler
+// flags and selects the best version of 'axpy' at runtime.
+
+#include <iostream>
+#include <vector>
+
+#include "../../UMESimdDispatch.h"
+
+UME_SIMD_MULTIVERSION_DECLARE(void, axpy, (float, float const *, float *, int));
+UME_SIMD_MULTIVERSION_DECLARE(const char*, isa_name, ());
+
+void axpy(float a, float const * x, float * y, int n) {
+    // Selection happens only once. Every following call is a single indirect call.
+    static auto func = UME_SIMD_MULTIVERSION_SELECT(axpy);
+    func(a, x, y, n);
+}
+
+int main()
+{
+    const int N = 1003;
+    std::vector<float> x(N), y(N);
+    for (int i = 0; i < N; i++) {
+        x[i] = float(i);
+        y[i] = 1.0f;
+    }
+
+    axpy(2.0f, x.data(), y.data(), N);
+
+    int errors = 0;
+    for (int i = 0; i < N; i++) {
+        if (y[i] != 2.0f * float(i) + 1.0f) errors++;
+    }
+
+    auto name = UME_SIMD_MULTIVERSION_SELECT(isa_name);
+    std::cout << "Selected kernel: " << name() << "\n";
+    std::cout << "Errors: " << errors << "\n";
+    return errors == 0 ? 0 : 1;
+}
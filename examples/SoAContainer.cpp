@@ -0,0 +1,77 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#include <vector>
+
+#include "../UMESimd.h"
+#include "../UMESoAContainer.h"
+
+using namespace UME::SIMD;
+
+// Particle data as usually kept by the application (array of structures)
+struct Particle {
+    float x, y;
+    float vx, vy;
+};
+
+int main() {
+    const int COUNT = 1003; // not a multiple of the vector length
+    const float DT = 0.1f;
+
+    std::vector<Particle> particles(COUNT);
+    for (int i = 0; i < COUNT; i++) {
+        particles[i].x = 0.0f;
+        particles[i].y = float(i);
+        particles[i].vx = 1.0f;
+        particles[i].vy = -0.5f;
+    }
+
+    // Each field is stored in its own aligned, padded array.
+    SoAContainer<float, float, float, float> soa(COUNT);
+
+    // AoS -> SoA conversion using strided gathers.
+    soa.fromAoS<8>(particles.data(), &Particle::x, &Particle::y, &Particle::vx, &Particle::vy);
+
+    // The kernel is called once per 8 elements. There is no scalar remainder
+    // loop: the last, partial chunk is loaded and stored under a mask, so
+    // the kernel can use unmasked operations unless it has side effects.
+    soa.for_each_vector<8>(
+        [DT](SIMDVecMask<8> const &, SIMDVec<float, 8> & x, SIMDVec<float, 8> & y,
+             SIMDVec<float, 8> & vx, SIMDVec<float, 8> & vy) {
+        x = vx.fmuladd(DT, x);
+        y = vy.fmuladd(DT, y);
+    });
+
+    // SoA -> AoS conversion using strided scatters.
+    soa.toAoS<8>(particles.data(), &Particle::x, &Particle::y, &Particle::vx, &Particle::vy);
+
+    std::cout << "particles[" << COUNT - 1 << "] = (" << particles[COUNT - 1].x << ", " << particles[COUNT - 1].y << ")" << std::endl;
+    return 0;
+}
@@ -0,0 +1,136 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <algorithm>
+
+#include "../../UMESimd.h"
+#include "../utilities/TimingStatistics.h"
+
+// Finds position of the largest and of the smallest element of an array.
+// The reference is std::max_element/std::min_element. The SIMD versions use
+// FUNCTIONS::argmax/argmin, which keep a running extreme and its index in
+// every vector lane and reduce across lanes only once, after the whole array
+// has been processed.
+
+const int ARRAY_SIZE = 1 << 20;
+const int MEASUREMENTS = 10;
+
+template<typename SCALAR_T>
+UME_NEVER_INLINE uint32_t argmax_scalar(SCALAR_T const * data, uint32_t count) {
+    return uint32_t(std::max_element(data, data + count) - data);
+}
+
+template<typename SCALAR_T>
+UME_NEVER_INLINE uint32_t argmin_scalar(SCALAR_T const * data, uint32_t count) {
+    return uint32_t(std::min_element(data, data + count) - data);
+}
+
+template<typename VEC_T, typename SCALAR_T>
+UME_NEVER_INLINE uint32_t argmax_simd(SCALAR_T const * data, uint32_t count) {
+    return UME::SIMD::FUNCTIONS::argmax<VEC_T>(data, count);
+}
+
+template<typename VEC_T, typename SCALAR_T>
+UME_NEVER_INLINE uint32_t argmin_simd(SCALAR_T const * data, uint32_t count) {
+    return UME::SIMD::FUNCTIONS::argmin<VEC_T>(data, count);
+}
+
+template<typename SCALAR_T, typename FUNC_T>
+TimingStatistics measure(FUNC_T func, SCALAR_T const * data, uint32_t reference) {
+    TimingStatistics stats;
+    uint32_t result = 0;
+    for (int m = 0; m < MEASUREMENTS; m++) {
+        unsigned long long start = get_timestamp();
+        result = func(data, ARRAY_SIZE);
+        unsigned long long end = get_timestamp();
+        stats.update(end - start);
+    }
+    if (result != reference) {
+        std::cout << "Result invalid: " << result << " instead of " << reference << std::endl;
+    }
+    return stats;
+}
+
+template<typename VEC_T, typename SCALAR_T>
+void benchmark(char const * name) {
+    SCALAR_T* data = (SCALAR_T*)UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE * sizeof(SCALAR_T), VEC_T::alignment());
+
+    // Small value range, so that both extremes appear many times and the
+    // first-occurrence rule is exercised.
+    for (int i = 0; i < ARRAY_SIZE; i++) {
+        data[i] = SCALAR_T(rand() % 10000) / SCALAR_T(100);
+    }
+    uint32_t maxIndex = argmax_scalar(data, ARRAY_SIZE);
+    uint32_t minIndex = argmin_scalar(data, ARRAY_SIZE);
+
+    TimingStatistics scalarMax = measure(argmax_scalar<SCALAR_T>, data, maxIndex);
+    TimingStatistics simdMax = measure(argmax_simd<VEC_T, SCALAR_T>, data, maxIndex);
+    TimingStatistics scalarMin = measure(argmin_scalar<SCALAR_T>, data, minIndex);
+    TimingStatistics simdMin = measure(argmin_simd<VEC_T, SCALAR_T>, data, minIndex);
+
+    std::cout << std::setw(12) << name << std::fixed << std::setprecision(2)
+        << std::setw(14) << scalarMax.getAverage()
+        << std::setw(14) << simdMax.getAverage()
+        << std::setw(12) << simdMax.calculateSpeedup(scalarMax)
+        << std::setw(14) << scalarMin.getAverage()
+        << std::setw(14) << simdMin.getAverage()
+        << std::setw(12) << simdMin.calculateSpeedup(scalarMin) << "\n";
+
+    UME::DynamicMemory::AlignedFree(data);
+}
+
+int main()
+{
+    srand((unsigned int)time(NULL));
+
+    std::cout << "The result is the average time (ns) of finding the extreme element of\n"
+        << ARRAY_SIZE << " elements. Speedups are calculated against std::max_element\n"
+        "and std::min_element.\n\n";
+
+    std::cout << std::setw(12) << "vector"
+        << std::setw(14) << "max_element"
+        << std::setw(14) << "argmax"
+        << std::setw(12) << "speedup"
+        << std::setw(14) << "min_element"
+        << std::setw(14) << "argmin"
+        << std::setw(12) << "speedup" << "\n";
+
+    benchmark<UME::SIMD::SIMD4_32f, float>("SIMD4_32f");
+    benchmark<UME::SIMD::SIMD8_32f, float>("SIMD8_32f");
+    benchmark<UME::SIMD::SIMD16_32f, float>("SIMD16_32f");
+    benchmark<UME::SIMD::SIMD2_64f, double>("SIMD2_64f");
+    benchmark<UME::SIMD::SIMD4_64f, double>("SIMD4_64f");
+    benchmark<UME::SIMD::SIMD8_64f, double>("SIMD8_64f");
+
+    return 0;
+}
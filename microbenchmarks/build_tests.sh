@@ -9,6 +9,16 @@ ISA="ISA=$2"
 BUILD="BUILD=$3"
 
 
+RESULT="argmax_$1_$2_$3.txt"
+cd argmax
+make $COMPILER $ISA $BUILD
+if [ $? -ne 0 ]
+then
+    exit 1
+fi
+rm *.out
+cd ..
+
 RESULT="average_$1_$2_$3.txt"
 cd average
 make $COMPILER $ISA $BUILD
@@ -29,6 +39,16 @@ fi
 rm *.out
 cd ..
 
+RESULT="hash_$1_$2_$3.txt"
+cd hash
+make $COMPILER $ISA $BUILD
+if [ $? -ne 0 ]
+then
+    exit 1
+fi
+rm *.out
+cd ..
+
 RESULT="histogram1_$1_$2_$3.txt"
 cd histogram1
 make $COMPILER $ISA $BUILD
@@ -81,6 +101,16 @@ cd ..
 #rm *.out
 #cd ..
 
+RESULT="memcopy_$1_$2_$3.txt"
+cd memcopy
+make $COMPILER $ISA $BUILD
+if [ $? -ne 0 ]
+then
+    exit 1
+fi
+rm *.out
+cd ..
+
 RESULT="polynomial_$1_$2_$3.txt"
 cd polynomial
 make $COMPILER $ISA $BUILD
@@ -91,6 +121,26 @@ fi
 rm *.out
 cd ..
 
+RESULT="precision_$1_$2_$3.txt"
+cd precision
+make $COMPILER $ISA $BUILD
+if [ $? -ne 0 ]
+then
+    exit 1
+fi
+rm *.out
+cd ..
+
+RESULT="prefetch_$1_$2_$3.txt"
+cd prefetch
+make $COMPILER $ISA $BUILD
+if [ $? -ne 0 ]
+then
+    exit 1
+fi
+rm *.out
+cd ..
+
 RESULT="quadraticsolver_$1_$2_$3.txt"
 cd QuadraticSolver
 make $COMPILER $ISA $BUILD
@@ -110,3 +160,13 @@ then
 fi
 rm *.out
 cd ..
+
+RESULT="sort_$1_$2_$3.txt"
+cd sort
+make $COMPILER $ISA $BUILD
+if [ $? -ne 0 ]
+then
+    exit 1
+fi
+rm *.out
+cd ..
@@ -78,11 +78,15 @@ struct ExplogResults {
     TimingStatistics time_log;
     TimingStatistics time_log2;
     TimingStatistics time_log10;
+    TimingStatistics time_pow;
     
     SCALAR_FLOAT_T max_err_exp;
     SCALAR_FLOAT_T max_err_log;
     SCALAR_FLOAT_T max_err_log2;
     SCALAR_FLOAT_T max_err_log10;
+    SCALAR_FLOAT_T max_err_pow;
+
+    ExplogResults() : max_err_exp(0), max_err_log(0), max_err_log2(0), max_err_log10(0), max_err_pow(0) {}
     
     void update_exp(benchmark_results<SCALAR_FLOAT_T> const & res) {
         time_exp.update(res.elapsedTime);
@@ -100,6 +104,10 @@ struct ExplogResults {
         time_log10.update(res.elapsedTime);
         if (max_err_log10 < res.error_ulp) max_err_log10 = res.error_ulp;
     }
+    void update_pow(benchmark_results<SCALAR_FLOAT_T> const & res) {
+        time_pow.update(res.elapsedTime);
+        if (max_err_pow < res.error_ulp) max_err_pow = res.error_ulp;
+    }
 };
 
 #include "explog.h"
@@ -115,12 +123,12 @@ int main()
     ExplogResults<float> stats_scalar_f, stats_scalar_vdt_f;
     ExplogResults<double> stats_scalar_d, stats_scalar_vdt_d;
 
-    std::cout << "The result is amount of time it takes to calculate exp, log_10 (base-10), log_2 (base-2) and log (base-e) of: " << ARRAY_SIZE << " elements.\n"
+    std::cout << "The result is amount of time it takes to calculate exp, log_10 (base-10), log_2 (base-2), log (base-e) and pow of: " << ARRAY_SIZE << " elements.\n"
         "All timing results in nanoseconds. \n"
         "Speedup calculated with scalar single precision floating point result as reference.\n"
         "VDT version used as a reference for auto-vectorization capabilities.\n"
         "SIMD version uses following operations: \n"
-        " EXP, LOG10, LOG2, LOG\n\n";
+        " EXP, LOG10, LOG2, LOG, POW\n\n";
 
     // ----------------------------------------
     // Benchmark using single precision.
@@ -132,6 +140,7 @@ int main()
         stats_scalar_f.update_log(test_log_scalar<float>(ARRAY_SIZE));
         stats_scalar_f.update_log2(test_log2_scalar<float>(ARRAY_SIZE));
         stats_scalar_f.update_log10(test_log10_scalar<float>(ARRAY_SIZE));
+        stats_scalar_f.update_pow(test_pow_scalar<float>(ARRAY_SIZE));
     }
 
     std::cout << "Scalar code (float): \n"
@@ -154,7 +163,12 @@ int main()
         << "    LOG10: time: " << (unsigned long long)stats_scalar_f.time_log10.getAverage()
         << ", dev: " << (unsigned long long) stats_scalar_f.time_log10.getStdDev()
         << " (speedup: 1.0x) " 
-        << "  Error:   " << (unsigned int) stats_scalar_f.max_err_log10   << std::endl;
+        << "  Error:   " << (unsigned int) stats_scalar_f.max_err_log10   << "\n"
+        
+        << "    POW: time:   " << (unsigned long long)stats_scalar_f.time_pow.getAverage()
+        << ", dev: " << (unsigned long long) stats_scalar_f.time_pow.getStdDev()
+        << " (speedup: 1.0x) " 
+        << "  Error:   " << (unsigned int) stats_scalar_f.max_err_pow   << std::endl;
         
     // 2. Benchmark using VDT fast_exp functions. This version has been designed to auto-vectorize smoothly.
     for (int i = 0; i < ITERATIONS; i++) {
@@ -162,6 +176,7 @@ int main()
         stats_scalar_vdt_f.update_log(test_log_vdt_scalar<float>(ARRAY_SIZE));
         stats_scalar_vdt_f.update_log2(test_log2_vdt_scalar<float>(ARRAY_SIZE));
         stats_scalar_vdt_f.update_log10(test_log10_vdt_scalar<float>(ARRAY_SIZE));
+        stats_scalar_vdt_f.update_pow(test_pow_vdt_scalar<float>(ARRAY_SIZE));
     }
 
     std::cout << "VDT code (float): \n"
@@ -183,9 +198,14 @@ int main()
         << "    LOG10: time:   " << (unsigned long long)stats_scalar_vdt_f.time_log10.getAverage()
         << ", dev: " << (unsigned long long) stats_scalar_vdt_f.time_log10.getStdDev()
         << " (speedup: " << stats_scalar_f.time_log10.getAverage() / stats_scalar_vdt_f.time_log10.getAverage() << ") "
-        << "  Error:   " << (unsigned int) stats_scalar_vdt_f.max_err_log10   << std::endl;
+        << "  Error:   " << (unsigned int) stats_scalar_vdt_f.max_err_log10   << "\n"
+        
+        << "    POW: time:     " << (unsigned long long)stats_scalar_vdt_f.time_pow.getAverage()
+        << ", dev: " << (unsigned long long) stats_scalar_vdt_f.time_pow.getStdDev()
+        << " (speedup: " << stats_scalar_f.time_pow.getAverage() / stats_scalar_vdt_f.time_pow.getAverage() << ") "
+        << "  Error:   " << (unsigned int) stats_scalar_vdt_f.max_err_pow   << std::endl;
 
-    // 3. Benchmark using UME::SIMD separate EXP/LOG/LOG2/LOG10 functions.
+    // 3. Benchmark using UME::SIMD separate EXP/LOG/LOG2/LOG10/POW functions.
     benchmarkUMESIMD<float, 1>("SIMD code(1x32f) ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
     benchmarkUMESIMD<float, 2>("SIMD code(2x32f) ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
     benchmarkUMESIMD<float, 4>("SIMD code(4x32f) ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
@@ -204,6 +224,7 @@ int main()
         stats_scalar_d.update_log(test_log_scalar<double>(ARRAY_SIZE));
         stats_scalar_d.update_log2(test_log2_scalar<double>(ARRAY_SIZE));
         stats_scalar_d.update_log10(test_log10_scalar<double>(ARRAY_SIZE));
+        stats_scalar_d.update_pow(test_pow_scalar<double>(ARRAY_SIZE));
     }
     
     std::cout << "Scalar code (double): \n" 
@@ -225,7 +246,12 @@ int main()
         << "    LOG10: time:   " << (unsigned long long)stats_scalar_d.time_log10.getAverage()
         << ", dev: " << (unsigned long long) stats_scalar_d.time_log10.getStdDev()
         << " (speedup: " << stats_scalar_f.time_log10.getAverage() / stats_scalar_d.time_log10.getAverage() << ") "
-        << "  Error:   " << (unsigned int)stats_scalar_d.max_err_log10   << std::endl;
+        << "  Error:   " << (unsigned int)stats_scalar_d.max_err_log10   << "\n"
+        
+        << "    POW: time:     " << (unsigned long long)stats_scalar_d.time_pow.getAverage()
+        << ", dev: " << (unsigned long long) stats_scalar_d.time_pow.getStdDev()
+        << " (speedup: " << stats_scalar_f.time_pow.getAverage() / stats_scalar_d.time_pow.getAverage() << ") "
+        << "  Error:   " << (unsigned int)stats_scalar_d.max_err_pow   << std::endl;
         
     // 5. Benchmark using VDT fast_exp/fast_log function. This version has been designed to auto-vectorize smoothly.
     for (int i = 0; i < ITERATIONS; i++) {
@@ -233,6 +259,7 @@ int main()
         stats_scalar_vdt_d.update_log(test_log_vdt_scalar<double>(ARRAY_SIZE));
         stats_scalar_vdt_d.update_log2(test_log2_vdt_scalar<double>(ARRAY_SIZE));
         stats_scalar_vdt_d.update_log10(test_log10_vdt_scalar<double>(ARRAY_SIZE));
+        stats_scalar_vdt_d.update_pow(test_pow_vdt_scalar<double>(ARRAY_SIZE));
     }
 
     std::cout << "VDT code (double): \n"
@@ -254,9 +281,14 @@ int main()
         << "    LOG10: time:   " << (unsigned long long)stats_scalar_vdt_d.time_log10.getAverage()
         << ", dev: " << (unsigned long long) stats_scalar_vdt_d.time_log10.getStdDev()
         << " (speedup: " << stats_scalar_f.time_log10.getAverage() / stats_scalar_vdt_d.time_log10.getAverage() << ") "
-        << "  Error:   " << (unsigned int) stats_scalar_vdt_d.max_err_log10   << std::endl;
+        << "  Error:   " << (unsigned int) stats_scalar_vdt_d.max_err_log10   << "\n"
+        
+        << "    POW: time:     " << (unsigned long long)stats_scalar_vdt_d.time_pow.getAverage()
+        << ", dev: " << (unsigned long long) stats_scalar_vdt_d.time_pow.getStdDev()
+        << " (speedup: " << stats_scalar_f.time_pow.getAverage() / stats_scalar_vdt_d.time_pow.getAverage() << ") "
+        << "  Error:   " << (unsigned int) stats_scalar_vdt_d.max_err_pow   << std::endl;
 
-    // 3. Benchmark using UME::SIMD separate EXP/LOG/LOG2/LOG10 functions.
+    // 3. Benchmark using UME::SIMD separate EXP/LOG/LOG2/LOG10/POW functions.
     benchmarkUMESIMD<double, 1>("SIMD code(1x64f) ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
     benchmarkUMESIMD<double, 2>("SIMD code(2x64f) ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
     benchmarkUMESIMD<double, 4>("SIMD code(4x64f) ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
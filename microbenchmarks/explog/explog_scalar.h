@@ -109,6 +109,21 @@ UME_NEVER_INLINE void generate_some_log10_values(int N, SCALAR_FLOAT_T * in, SCA
     }
 }
 
+template<typename SCALAR_FLOAT_T>
+UME_NEVER_INLINE void generate_some_pow_values(int N, SCALAR_FLOAT_T * inX, SCALAR_FLOAT_T * inY, SCALAR_FLOAT_T * out) {
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    // Keep x^y within the range of single precision.
+    std::uniform_real_distribution<SCALAR_FLOAT_T> distX(SCALAR_FLOAT_T(0.01), SCALAR_FLOAT_T(100.0));
+    std::uniform_real_distribution<SCALAR_FLOAT_T> distY(SCALAR_FLOAT_T(-15.0), SCALAR_FLOAT_T(15.0));
+
+    for (int i = 0; i < N; i++) {
+        inX[i] = distX(gen);
+        inY[i] = distY(gen);
+        out[i] = std::pow(inX[i], inY[i]);
+    }
+}
+
 // Kernel for benchmarking using std::exp function calls.
 template<typename SCALAR_FLOAT_T>
 UME_NEVER_INLINE benchmark_results<SCALAR_FLOAT_T> test_exp_scalar(const int ARRAY_SIZE)
@@ -316,4 +331,48 @@ UME_NEVER_INLINE benchmark_results<SCALAR_FLOAT_T> test_log10_scalar(int ARRAY_S
 
     return result;
 }
+// Kernel for benchmarking using std::pow function calls.
+template<typename SCALAR_FLOAT_T>
+UME_NEVER_INLINE benchmark_results<SCALAR_FLOAT_T> test_pow_scalar(const int ARRAY_SIZE)
+{
+    unsigned long long start, end;    // Time measurements
+
+    const int LEN = ARRAY_SIZE;
+    SCALAR_FLOAT_T* inputX = (SCALAR_FLOAT_T*) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), 64);
+    SCALAR_FLOAT_T* inputY = (SCALAR_FLOAT_T*) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), 64);
+    SCALAR_FLOAT_T* output = (SCALAR_FLOAT_T*) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), 64);
+    SCALAR_FLOAT_T* values = (SCALAR_FLOAT_T*) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), 64);
+
+    generate_some_pow_values<SCALAR_FLOAT_T>(LEN, inputX, inputY, output);
+
+    start = get_timestamp();
+
+    for (int i = 0; i < LEN; i++) {
+        values[i] = std::pow(inputX[i], inputY[i]);
+    }
+
+    end = get_timestamp();
+
+    SCALAR_FLOAT_T max_err = 0;
+
+    for (int i = 0; i < LEN; i++) {
+        SCALAR_FLOAT_T next = NEXT_AFTER(values[i], HUGE_VALUE<SCALAR_FLOAT_T>());
+        SCALAR_FLOAT_T reference_value_ulp = std::abs(next - values[i]);
+        SCALAR_FLOAT_T error_ulp = (values[i] - output[i]) / reference_value_ulp;
+
+        if (max_err < std::abs(error_ulp)) max_err = std::abs(error_ulp);
+    }
+
+    benchmark_results<SCALAR_FLOAT_T> result;
+    result.elapsedTime = end - start;
+    result.error_ulp = max_err;
+
+    UME::DynamicMemory::AlignedFree(inputX);
+    UME::DynamicMemory::AlignedFree(inputY);
+    UME::DynamicMemory::AlignedFree(output);
+    UME::DynamicMemory::AlignedFree(values);
+
+    return result;
+}
+
 #endif
@@ -229,6 +229,60 @@ UME_NEVER_INLINE benchmark_results<SCALAR_FLOAT_T> test_log10_ume(const int ARRA
     return result;
 }
 
+// Kernel for benchmarking using POW function.
+template<typename SCALAR_FLOAT_T, int VEC_LEN>
+UME_NEVER_INLINE benchmark_results<SCALAR_FLOAT_T> test_pow_ume(const int ARRAY_SIZE)
+{
+    SIMDVec<SCALAR_FLOAT_T, VEC_LEN> x;
+    SIMDVec<SCALAR_FLOAT_T, VEC_LEN> y;
+    SIMDVec<SCALAR_FLOAT_T, VEC_LEN> z;
+
+    unsigned long long start, end;    // Time measurements
+
+    const int LEN = ARRAY_SIZE;
+    SCALAR_FLOAT_T* inputX = (SCALAR_FLOAT_T*) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), 64);
+    SCALAR_FLOAT_T* inputY = (SCALAR_FLOAT_T*) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), 64);
+    SCALAR_FLOAT_T* output = (SCALAR_FLOAT_T*) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), 64);
+    SCALAR_FLOAT_T* values = (SCALAR_FLOAT_T*) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), 64);
+
+    generate_some_pow_values<SCALAR_FLOAT_T>(LEN, inputX, inputY, output);
+
+    start = get_timestamp();
+
+    for (int i = 0; i < LEN; i += VEC_LEN) {
+        x.load(&inputX[i]);
+        y.load(&inputY[i]);
+
+        z = x.pow(y);
+
+        z.store(&values[i]);
+    }
+    
+
+    end = get_timestamp();
+
+    SCALAR_FLOAT_T max_err = 0;
+
+    for (int i = 0; i < LEN; i++) {
+        SCALAR_FLOAT_T next = NEXT_AFTER(values[i], HUGE_VALUE<SCALAR_FLOAT_T>());
+        SCALAR_FLOAT_T reference_value_ulp = std::abs(next - values[i]);
+        SCALAR_FLOAT_T error_ulp = (values[i] - output[i]) / reference_value_ulp;
+
+        if (max_err < std::abs(error_ulp)) max_err = std::abs(error_ulp);
+    }
+
+    benchmark_results<SCALAR_FLOAT_T> result;
+    result.elapsedTime = end - start;
+    result.error_ulp = max_err;
+
+    UME::DynamicMemory::AlignedFree(inputX);
+    UME::DynamicMemory::AlignedFree(inputY);
+    UME::DynamicMemory::AlignedFree(output);
+    UME::DynamicMemory::AlignedFree(values);
+
+    return result;
+}
+
 // Benchmark using SINCOS function call.
 template<typename SCALAR_FLOAT_T, int VEC_LEN>
 void benchmarkUMESIMD(std::string resultPrefix, int iterations, int array_size, ExplogResults<float> & reference)
@@ -241,6 +295,7 @@ void benchmarkUMESIMD(std::string resultPrefix, int iterations, int array_size,
         result.update_log(test_log_ume<SCALAR_FLOAT_T, VEC_LEN>(array_size));
         result.update_log2(test_log2_ume<SCALAR_FLOAT_T, VEC_LEN>(array_size));
         result.update_log10(test_log10_ume<SCALAR_FLOAT_T, VEC_LEN>(array_size));
+        result.update_pow(test_pow_ume<SCALAR_FLOAT_T, VEC_LEN>(array_size));
     }
 
     std::cout << resultPrefix.c_str() << "\n"
@@ -262,7 +317,12 @@ void benchmarkUMESIMD(std::string resultPrefix, int iterations, int array_size,
         << "    LOG10: time:   " << (unsigned long long)result.time_log10.getAverage()
         << ", dev: " << (unsigned long long) result.time_log10.getStdDev()
         << " (speedup: " << reference.time_log10.getAverage() / result.time_log10.getAverage() << ") "
-        << "  Error:   " << (unsigned int) result.max_err_log10   << std::endl;
+        << "  Error:   " << (unsigned int) result.max_err_log10   << "\n"
+        
+        << "    POW: time:     " << (unsigned long long)result.time_pow.getAverage()
+        << ", dev: " << (unsigned long long) result.time_pow.getStdDev()
+        << " (speedup: " << reference.time_pow.getAverage() / result.time_pow.getAverage() << ") "
+        << "  Error:   " << (unsigned int) result.max_err_pow   << std::endl;
 }
 
 #endif
@@ -114,6 +114,14 @@ UME_FORCE_INLINE double call_log10_vdt(double in) {
     return inv_log_of_10 * vdt::fast_log(in);
 }
 
+UME_FORCE_INLINE float call_pow_vdt(float x, float y) {
+    return vdt::fast_expf(y * vdt::fast_logf(x));
+}
+
+UME_FORCE_INLINE double call_pow_vdt(double x, double y) {
+    return vdt::fast_exp(y * vdt::fast_log(x));
+}
+
 template<typename SCALAR_FLOAT_T>
 UME_NEVER_INLINE benchmark_results<SCALAR_FLOAT_T> test_log_vdt_scalar(int ARRAY_SIZE)
 {
@@ -249,4 +257,48 @@ UME_NEVER_INLINE benchmark_results<SCALAR_FLOAT_T> test_log10_vdt_scalar(int ARR
     return result;
 }
 
+// Kernel for benchmarking using VDT based pow.
+template<typename SCALAR_FLOAT_T>
+UME_NEVER_INLINE benchmark_results<SCALAR_FLOAT_T> test_pow_vdt_scalar(const int ARRAY_SIZE)
+{
+    unsigned long long start, end;    // Time measurements
+
+    const int LEN = ARRAY_SIZE;
+    SCALAR_FLOAT_T* inputX = (SCALAR_FLOAT_T*) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), 64);
+    SCALAR_FLOAT_T* inputY = (SCALAR_FLOAT_T*) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), 64);
+    SCALAR_FLOAT_T* output = (SCALAR_FLOAT_T*) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), 64);
+    SCALAR_FLOAT_T* values = (SCALAR_FLOAT_T*) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), 64);
+
+    generate_some_pow_values<SCALAR_FLOAT_T>(LEN, inputX, inputY, output);
+
+    start = get_timestamp();
+
+    for (int i = 0; i < LEN; i++) {
+        values[i] = call_pow_vdt(inputX[i], inputY[i]);
+    }
+
+    end = get_timestamp();
+
+    SCALAR_FLOAT_T max_err = 0;
+
+    for (int i = 0; i < LEN; i++) {
+        SCALAR_FLOAT_T next = NEXT_AFTER(values[i], HUGE_VALUE<SCALAR_FLOAT_T>());
+        SCALAR_FLOAT_T reference_value_ulp = std::abs(next - values[i]);
+        SCALAR_FLOAT_T error_ulp = (values[i] - output[i]) / reference_value_ulp;
+
+        if (max_err < std::abs(error_ulp)) max_err = std::abs(error_ulp);
+    }
+
+    benchmark_results<SCALAR_FLOAT_T> result;
+    result.elapsedTime = end - start;
+    result.error_ulp = max_err;
+
+    UME::DynamicMemory::AlignedFree(inputX);
+    UME::DynamicMemory::AlignedFree(inputY);
+    UME::DynamicMemory::AlignedFree(output);
+    UME::DynamicMemory::AlignedFree(values);
+
+    return result;
+}
+
 #endif 
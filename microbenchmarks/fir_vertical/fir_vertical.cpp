@@ -49,6 +49,7 @@ const int ITERATIONS = 20;
 //#define ENABLE_DEBUG
 #include "fir_vertical_umesimd.h"
 #include "fir_vertical_intel.h"
+#include "fir_vertical_fixed.h"
 
 // FIR_ORDER == 1 means a 0-order gain filter y[t]=a*x[t]
 // FIR_ORDER == 4 means a 3-order FIR filter y[t]=a*x[t] + b*x[t-1] + c*x[t-2]
@@ -137,6 +138,7 @@ int main()
                  "int: LOAD-CONSTR, SWIZZLEA\n"
                  "float: LOAD-CONSTR, GATHERV, MULV, HADD\n"
                  "swizzle: LOAD-CONSTR\n"
+                 "fixed point: LOAD-CONSTR, RSHSA, MULSA, SADDVA, STOREA\n"
                  "\n";
 /*
     {
@@ -250,5 +252,27 @@ int main()
         benchmarkSIMD_FIR16<double>("SIMD code (16x64f, fixed permute): ", ITERATIONS, stats_scalar_f);
     }
 
+    std::cout << "\n\nFIR-8 fixed point (int16, saturating):\n";
+    {
+        TimingStatistics stats_scalar;
+
+        benchmarkScalar_fixed<8>("Scalar code (16i): ", ITERATIONS, stats_scalar);
+
+        benchmarkSIMD_fixed<8, 8>("SIMD code (8x16i): ", ITERATIONS, stats_scalar);
+        benchmarkSIMD_fixed<16, 8>("SIMD code (16x16i): ", ITERATIONS, stats_scalar);
+        benchmarkSIMD_fixed<32, 8>("SIMD code (32x16i): ", ITERATIONS, stats_scalar);
+    }
+
+    std::cout << "\n\nFIR-16 fixed point (int16, saturating):\n";
+    {
+        TimingStatistics stats_scalar;
+
+        benchmarkScalar_fixed<16>("Scalar code (16i): ", ITERATIONS, stats_scalar);
+
+        benchmarkSIMD_fixed<8, 16>("SIMD code (8x16i): ", ITERATIONS, stats_scalar);
+        benchmarkSIMD_fixed<16, 16>("SIMD code (16x16i): ", ITERATIONS, stats_scalar);
+        benchmarkSIMD_fixed<32, 16>("SIMD code (32x16i): ", ITERATIONS, stats_scalar);
+    }
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,194 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_FIR_VERTICAL_FIXED_H_
+#define UME_FIR_VERTICAL_FIXED_H_
+
+#include <limits>
+#include <string>
+
+using namespace UME::SIMD;
+
+// Fixed-point variant of the FIR filter. Samples are Q15 values in int16_t,
+// coefficients are Q8 gains in range [0;1). Each tap computes
+// (x >> 8) * c, which is again a Q15 value that always fits in 16 bits, and
+// the taps are accumulated with saturation, as a fixed-point DSP pipeline would.
+//
+// Unlike the floating-point kernels, the SIMD version keeps one output sample
+// per vector lane and loops over the taps, so that every accumulation step
+// is a full-width saturating add.
+
+const int FIXED_SHIFT = 8;
+
+UME_FORCE_INLINE int16_t saturate_q15(int32_t x) {
+    if (x > std::numeric_limits<int16_t>::max()) return std::numeric_limits<int16_t>::max();
+    if (x < std::numeric_limits<int16_t>::min()) return std::numeric_limits<int16_t>::min();
+    return int16_t(x);
+}
+
+// Input signal is prefixed with FIR_ORDER - 1 zero samples so that
+// x[i - j] is always valid for the first outputs.
+template<uint32_t FIR_ORDER>
+void init_fixed(int16_t *x, int16_t *coeffs) {
+    //srand ((unsigned int)time(NULL));
+    srand(0);
+    for (uint32_t i = 0; i < FIR_ORDER - 1; i++) {
+        x[i] = 0;
+    }
+    // Generate random samples in range (-1.0;1.0), scaled by 2^15
+    for (int i = 0; i < ARRAY_SIZE; i++) {
+        x[FIR_ORDER - 1 + i] = int16_t((rand() % 65536) - 32768);
+    }
+    // Generate random coefficients in range (0.0;1.0), scaled by 2^8
+    for (uint32_t i = 0; i < FIR_ORDER; i++) {
+        coeffs[i] = int16_t(rand() % 256);
+    }
+}
+
+template<uint32_t FIR_ORDER>
+UME_NEVER_INLINE TIMING_RES test_scalar_fixed()
+{
+    unsigned long long start, end; // Time measurements
+    int16_t coeffs[FIR_ORDER];
+    int16_t *x;
+    int16_t *y;
+
+    x = (int16_t *) UME::DynamicMemory::AlignedMalloc((ARRAY_SIZE + FIR_ORDER)*sizeof(int16_t), 64);
+    y = (int16_t *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(int16_t), 64);
+
+    init_fixed<FIR_ORDER>(x, coeffs);
+
+    start = get_timestamp();
+
+    for (int i = 0; i < ARRAY_SIZE; i++) {
+        int16_t const *in = x + FIR_ORDER - 1 + i;
+        int16_t acc = 0;
+        for (uint32_t j = 0; j < FIR_ORDER; j++) {
+            int16_t t0 = int16_t((in[-int(j)] >> FIXED_SHIFT) * coeffs[j]);
+            acc = saturate_q15(int32_t(acc) + int32_t(t0));
+        }
+        y[i] = acc;
+    }
+
+    end = get_timestamp();
+
+    // Perform reduction to avoid dead-code removals.
+    volatile int32_t red = 0;
+    for (int i = 0; i < ARRAY_SIZE; i++) {
+        red += y[i];
+    }
+    // cast to void to avoid reduction
+    (void)red;
+
+    UME::DynamicMemory::AlignedFree(x);
+    UME::DynamicMemory::AlignedFree(y);
+
+    return end - start;
+}
+
+template<uint32_t VEC_LEN, uint32_t FIR_ORDER>
+UME_NEVER_INLINE TIMING_RES test_ume_fixed()
+{
+    typedef SIMDVec<int16_t, VEC_LEN> VEC_T;
+
+    unsigned long long start, end; // Time measurements
+    int16_t coeffs[FIR_ORDER];
+    int16_t *x;
+    int16_t *y;
+
+    x = (int16_t *) UME::DynamicMemory::AlignedMalloc((ARRAY_SIZE + FIR_ORDER)*sizeof(int16_t), 64);
+    y = (int16_t *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(int16_t), VEC_T::alignment());
+
+    init_fixed<FIR_ORDER>(x, coeffs);
+
+    start = get_timestamp();
+
+    // ARRAY_SIZE is a multiple of all tested vector lengths.
+    for (int i = 0; i < ARRAY_SIZE; i += VEC_LEN) {
+        int16_t const *in = x + FIR_ORDER - 1 + i;
+        VEC_T acc(int16_t(0));
+        for (uint32_t j = 0; j < FIR_ORDER; j++) {
+            VEC_T t0(in - j);
+            t0.rsha(uint16_t(FIXED_SHIFT));
+            t0.mula(coeffs[j]);
+            acc.sadda(t0);
+        }
+        acc.storea(y + i);
+    }
+
+    end = get_timestamp();
+
+    // Perform reduction to avoid dead-code removals.
+    volatile int32_t red = 0;
+    for (int i = 0; i < ARRAY_SIZE; i++) {
+        red += y[i];
+    }
+    // cast to void to avoid reduction
+    (void)red;
+
+    UME::DynamicMemory::AlignedFree(x);
+    UME::DynamicMemory::AlignedFree(y);
+
+    return end - start;
+}
+
+template<uint32_t FIR_ORDER>
+void benchmarkScalar_fixed(std::string const & resultPrefix,
+                           int iterations,
+                           TimingStatistics & stats)
+{
+    for (int i = 0; i < iterations; i++)
+    {
+        stats.update(test_scalar_fixed<FIR_ORDER>());
+    }
+
+    std::cout << resultPrefix << (unsigned long long) stats.getAverage()
+        << ", dev: " << (unsigned long long) stats.getStdDev()
+        << " (speedup: 1.0x)\n";
+}
+
+template<uint32_t VEC_LEN, uint32_t FIR_ORDER>
+void benchmarkSIMD_fixed(std::string const & resultPrefix,
+                         int iterations,
+                         TimingStatistics & reference)
+{
+    TimingStatistics stats;
+
+    for (int i = 0; i < iterations; i++)
+    {
+        stats.update(test_ume_fixed<VEC_LEN, FIR_ORDER>());
+    }
+
+    std::cout << resultPrefix << (unsigned long long) stats.getAverage()
+        << ", dev: " << (unsigned long long) stats.getStdDev()
+        << " (speedup: " << stats.calculateSpeedup(reference) << "x)\n";
+}
+
+#endif
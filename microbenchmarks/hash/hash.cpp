@@ -0,0 +1,214 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+
+#include "../../UMESimd.h"
+#include "../utilities/TimingStatistics.h"
+
+// Hashes an array of 32-bit and 64-bit keys with shift/rotate based mixing
+// functions. Every key is hashed independently, so the SIMD versions process
+// a full vector of keys per iteration. The 'emulated' column calls the scalar
+// emulation routines directly, which is what the shift and rotate operations
+// compiled to before they were implemented natively.
+
+const int ARRAY_SIZE = 1 << 20;
+const int MEASUREMENTS = 10;
+
+// xxHash32-style avalanche of a single 32-bit key
+UME_FORCE_INLINE uint32_t hash32(uint32_t key) {
+    uint32_t h = 0x165667B1u + key * 0xC2B2AE3Du;
+    h = ((h << 17) | (h >> 15)) * 0x27D4EB2Fu;
+    h ^= h >> 15;
+    h *= 0x85EBCA77u;
+    h ^= h >> 13;
+    h *= 0xC2B2AE3Du;
+    h ^= h >> 16;
+    return h;
+}
+
+// Multiplication-free xorshift/rotate mixing of a single 64-bit key
+UME_FORCE_INLINE uint64_t hash64(uint64_t key) {
+    uint64_t h = key ^ 0x9E3779B97F4A7C15ull;
+    h ^= h << 13;
+    h ^= h >> 7;
+    h ^= h << 17;
+    h = ((h << 31) | (h >> 33)) ^ key;
+    h ^= h >> 29;
+    h = (h << 11) | (h >> 53);
+    return h;
+}
+
+template<typename VEC_T, typename SCALAR_T>
+struct HashSIMD;
+
+template<typename VEC_T>
+struct HashSIMD<VEC_T, uint32_t> {
+    UME_FORCE_INLINE static VEC_T native(VEC_T const & key) {
+        VEC_T h = key * 0xC2B2AE3Du + 0x165667B1u;
+        h = h.rol(17) * 0x27D4EB2Fu;
+        h ^= h >> 15;
+        h *= 0x85EBCA77u;
+        h ^= h >> 13;
+        h *= 0xC2B2AE3Du;
+        h ^= h >> 16;
+        return h;
+    }
+    UME_FORCE_INLINE static VEC_T emulated(VEC_T const & key) {
+        using namespace UME::SIMD::SCALAR_EMULATION;
+        VEC_T h = key * 0xC2B2AE3Du + 0x165667B1u;
+        h = rotateBitsLeftScalar<VEC_T, uint32_t, uint32_t>(h, 17) * 0x27D4EB2Fu;
+        h ^= shiftBitsRightScalar<VEC_T, uint32_t>(h, 15);
+        h *= 0x85EBCA77u;
+        h ^= shiftBitsRightScalar<VEC_T, uint32_t>(h, 13);
+        h *= 0xC2B2AE3Du;
+        h ^= shiftBitsRightScalar<VEC_T, uint32_t>(h, 16);
+        return h;
+    }
+};
+
+template<typename VEC_T>
+struct HashSIMD<VEC_T, uint64_t> {
+    UME_FORCE_INLINE static VEC_T native(VEC_T const & key) {
+        VEC_T h = key ^ 0x9E3779B97F4A7C15ull;
+        h ^= h << 13;
+        h ^= h >> 7;
+        h ^= h << 17;
+        h = h.rol(31) ^ key;
+        h ^= h >> 29;
+        h = h.rol(11);
+        return h;
+    }
+    UME_FORCE_INLINE static VEC_T emulated(VEC_T const & key) {
+        using namespace UME::SIMD::SCALAR_EMULATION;
+        VEC_T h = key ^ 0x9E3779B97F4A7C15ull;
+        h ^= shiftBitsLeftScalar<VEC_T, uint64_t>(h, 13);
+        h ^= shiftBitsRightScalar<VEC_T, uint64_t>(h, 7);
+        h ^= shiftBitsLeftScalar<VEC_T, uint64_t>(h, 17);
+        h = rotateBitsLeftScalar<VEC_T, uint64_t, uint64_t>(h, 31) ^ key;
+        h ^= shiftBitsRightScalar<VEC_T, uint64_t>(h, 29);
+        h = rotateBitsLeftScalar<VEC_T, uint64_t, uint64_t>(h, 11);
+        return h;
+    }
+};
+
+UME_NEVER_INLINE void hash_scalar(uint32_t const * keys, uint32_t * hashes, int count) {
+    for (int i = 0; i < count; i++) hashes[i] = hash32(keys[i]);
+}
+
+UME_NEVER_INLINE void hash_scalar(uint64_t const * keys, uint64_t * hashes, int count) {
+    for (int i = 0; i < count; i++) hashes[i] = hash64(keys[i]);
+}
+
+template<typename VEC_T, typename SCALAR_T, bool NATIVE>
+UME_NEVER_INLINE void hash_simd(SCALAR_T const * keys, SCALAR_T * hashes, int count) {
+    const int VEC_LEN = VEC_T::length();
+    int i = 0;
+    for (; i <= count - VEC_LEN; i += VEC_LEN) {
+        VEC_T key(keys + i);
+        VEC_T h = NATIVE ? HashSIMD<VEC_T, SCALAR_T>::native(key) : HashSIMD<VEC_T, SCALAR_T>::emulated(key);
+        h.store(hashes + i);
+    }
+    hash_scalar(keys + i, hashes + i, count - i);
+}
+
+template<typename SCALAR_T, typename FUNC_T>
+TimingStatistics measure(FUNC_T func, SCALAR_T const * keys, SCALAR_T * hashes, SCALAR_T const * reference) {
+    TimingStatistics stats;
+    for (int m = 0; m < MEASUREMENTS; m++) {
+        unsigned long long start = get_timestamp();
+        func(keys, hashes, ARRAY_SIZE);
+        unsigned long long end = get_timestamp();
+        stats.update(end - start);
+    }
+    for (int i = 0; i < ARRAY_SIZE; i++) {
+        if (hashes[i] != reference[i]) {
+            std::cout << "Result invalid at index " << i << std::endl;
+            break;
+        }
+    }
+    return stats;
+}
+
+template<typename VEC_T, typename SCALAR_T>
+void benchmark(char const * name) {
+    SCALAR_T* keys = (SCALAR_T*)UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE * sizeof(SCALAR_T), VEC_T::alignment());
+    SCALAR_T* hashes = (SCALAR_T*)UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE * sizeof(SCALAR_T), VEC_T::alignment());
+    SCALAR_T* reference = (SCALAR_T*)UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE * sizeof(SCALAR_T), VEC_T::alignment());
+
+    for (int i = 0; i < ARRAY_SIZE; i++) {
+        keys[i] = SCALAR_T((uint64_t(rand()) << 32) ^ uint64_t(rand()));
+    }
+    hash_scalar(keys, reference, ARRAY_SIZE);
+
+    void(*scalar_fn)(SCALAR_T const *, SCALAR_T *, int) = hash_scalar;
+    TimingStatistics scalar = measure(scalar_fn, keys, hashes, reference);
+    TimingStatistics emulated = measure(hash_simd<VEC_T, SCALAR_T, false>, keys, hashes, reference);
+    TimingStatistics native = measure(hash_simd<VEC_T, SCALAR_T, true>, keys, hashes, reference);
+
+    std::cout << std::setw(12) << name << std::fixed << std::setprecision(2)
+        << std::setw(14) << scalar.getAverage()
+        << std::setw(14) << emulated.getAverage()
+        << std::setw(14) << native.getAverage()
+        << std::setw(12) << native.calculateSpeedup(emulated)
+        << std::setw(12) << native.calculateSpeedup(scalar) << "\n";
+
+    UME::DynamicMemory::AlignedFree(keys);
+    UME::DynamicMemory::AlignedFree(hashes);
+    UME::DynamicMemory::AlignedFree(reference);
+}
+
+int main()
+{
+    srand((unsigned int)time(NULL));
+
+    std::cout << "The result is the average time (ns) of hashing " << ARRAY_SIZE << " keys.\n"
+        "Speedups of the native shift/rotate version are calculated against the\n"
+        "emulated and the scalar versions.\n\n";
+
+    std::cout << std::setw(12) << "vector"
+        << std::setw(14) << "scalar"
+        << std::setw(14) << "emulated"
+        << std::setw(14) << "native"
+        << std::setw(12) << "vs. emul"
+        << std::setw(12) << "vs. scalar" << "\n";
+
+    benchmark<UME::SIMD::SIMD4_32u, uint32_t>("SIMD4_32u");
+    benchmark<UME::SIMD::SIMD8_32u, uint32_t>("SIMD8_32u");
+    benchmark<UME::SIMD::SIMD16_32u, uint32_t>("SIMD16_32u");
+    benchmark<UME::SIMD::SIMD2_64u, uint64_t>("SIMD2_64u");
+    benchmark<UME::SIMD::SIMD4_64u, uint64_t>("SIMD4_64u");
+    benchmark<UME::SIMD::SIMD8_64u, uint64_t>("SIMD8_64u");
+
+    return 0;
+}
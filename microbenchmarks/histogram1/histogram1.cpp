@@ -39,6 +39,7 @@
 
 //#define UME_SIMD_SHOW_EMULATION_WARNINGS 1
 #include "../../UMESimd.h"
+#include "../../UMESimdHistogram.h"
 #include "../utilities/TimingStatistics.h"
 
 const int INPUT_SIZE = 1000000; // Number of data samples
@@ -120,6 +121,14 @@ inline void test_UME_SIMD_float_recursive_helper<UME::SIMD::SIMD1_32f, UME::SIMD
     hist[bin]++;
 }
 
+// Specialization for SIMD1_32u, used by the integer binning variant.
+template<>
+inline void test_UME_SIMD_float_recursive_helper<UME::SIMD::SIMD1_32u, UME::SIMD::SIMD1_32u>(UME::SIMD::SIMD1_32u const & index_vec, unsigned int * hist)
+{
+    unsigned int bin = index_vec[0];
+    hist[bin]++;
+}
+
 template<typename FLOAT_VEC_T>
 TIMING_RES test_UME_SIMD()
 {
@@ -207,6 +216,207 @@ TIMING_RES test_UME_SIMD()
     return end - start;
 }
 
+// Integer binning variant. Samples are integers in range [0;DATA_RANGE) and
+// the bin is computed as (sample / BIN_WIDTH). The divisor is loop-invariant,
+// so SIMD version precomputes it once as a SIMDDivisor and performs each
+// division as a multiply-high and shifts.
+const uint32_t DATA_RANGE = 1000;
+const uint32_t BIN_WIDTH = DATA_RANGE / HIST_SIZE;
+
+TIMING_RES test_scalar_int()
+{
+    unsigned long long start, end;    // Time measurements
+
+    uint32_t *data;
+    unsigned int *hist;
+
+    data = (uint32_t *) UME::DynamicMemory::AlignedMalloc(INPUT_SIZE*sizeof(uint32_t), sizeof(uint32_t));
+
+    // Initialize arrays with random data
+    for(int i = 0; i < INPUT_SIZE; i++) {
+        // Generate random numbers in range [0;1000)
+        data[i] = static_cast<uint32_t>(rand()) % DATA_RANGE;
+    }
+
+    hist = (unsigned int *) UME::DynamicMemory::AlignedMalloc(HIST_SIZE*sizeof(unsigned int), sizeof(unsigned int));
+
+    for(unsigned int i = 0; i < HIST_SIZE; i++) {
+        hist[i] = 0;
+    }
+
+    // This is the actual binning code
+    {
+        unsigned int bin;
+        start = get_timestamp();
+
+        for(int i = 0; i < INPUT_SIZE; i++)
+        {
+            bin = data[i] / BIN_WIDTH;
+            hist[bin]++;
+        }
+
+        end = get_timestamp();
+    }
+
+    UME::DynamicMemory::AlignedFree(data);
+    UME::DynamicMemory::AlignedFree(hist);
+
+    return end - start;
+}
+
+template<typename UINT_VEC_T>
+TIMING_RES test_UME_SIMD_int()
+{
+    const uint32_t VEC_LEN = UINT_VEC_T::length();
+    const int ALIGNMENT = UINT_VEC_T::alignment();
+    unsigned long long start, end;    // Time measurements
+
+    uint32_t *data;
+    unsigned int *hist;
+
+    unsigned int *verify_hist;
+
+    data = (uint32_t *)UME::DynamicMemory::AlignedMalloc(INPUT_SIZE*sizeof(uint32_t), ALIGNMENT);
+
+    // Initialize arrays with random data
+    for (int i = 0; i < INPUT_SIZE; i++) {
+        // Generate random numbers in range [0;1000)
+        data[i] = static_cast<uint32_t>(rand()) % DATA_RANGE;
+    }
+
+    hist = (unsigned int *)UME::DynamicMemory::AlignedMalloc(HIST_SIZE*sizeof(unsigned int), ALIGNMENT);
+    verify_hist = (unsigned int *)UME::DynamicMemory::AlignedMalloc(HIST_SIZE*sizeof(unsigned int), ALIGNMENT);
+
+    for (int i = 0; i < HIST_SIZE; i++) {
+        hist[i] = 0;
+        verify_hist[i] = 0;
+    }
+
+    // This is the actual binning code
+    {
+        // Calculate loop-peeling division
+        uint32_t PEEL_COUNT = INPUT_SIZE / VEC_LEN;
+        uint32_t REM_COUNT = INPUT_SIZE - PEEL_COUNT*VEC_LEN;
+
+        UINT_VEC_T data_vec;
+        UINT_VEC_T index_vec;
+
+        UME::SIMD::SIMDDivisor<uint32_t> bin_width(BIN_WIDTH);
+
+        unsigned int bin;
+
+        start = get_timestamp();
+
+        for (uint32_t i = 0; i < PEEL_COUNT; i++) {
+            // Calculate indices
+            data_vec.loada(&data[i*VEC_LEN]);
+            index_vec = data_vec.div(bin_width);
+            // Perform histogram update
+            test_UME_SIMD_float_recursive_helper<UINT_VEC_T, UINT_VEC_T>(index_vec, hist);
+        }
+
+        // Calculate reminder elements using scalar code
+        for (uint32_t i = 0; i < REM_COUNT; i++) {
+            bin = bin_width.divide(data[PEEL_COUNT*VEC_LEN + i]);
+            hist[bin]++;
+        }
+
+        end = get_timestamp();
+
+        // Verify results
+        for (int i = 0; i < INPUT_SIZE; i++)
+        {
+            unsigned int bin = data[i] / BIN_WIDTH;
+            verify_hist[bin]++;
+        }
+
+        for (int i = 0; i < HIST_SIZE; i++) {
+            if (hist[i] != verify_hist[i]) {
+                std::cout << VEC_LEN << ": Invalid result at index " << i << " expected: " << verify_hist[i] << ", actual: " << hist[i] << "\n";
+            }
+        }
+    }
+
+    UME::DynamicMemory::AlignedFree(data);
+    UME::DynamicMemory::AlignedFree(hist);
+    UME::DynamicMemory::AlignedFree(verify_hist);
+
+    return end - start;
+}
+
+// Multi-threaded variant using UME::SIMD::histogram. Bins are calculated
+// the same way as in test_UME_SIMD(), every thread counts into private
+// sub-histograms and these are merged with vector additions at the end.
+template<typename FLOAT_VEC_T>
+struct HistogramBinning
+{
+    typedef typename UME::SIMD::SIMDTraits<FLOAT_VEC_T>::SCALAR_T   FLOAT_T;
+    typedef typename UME::SIMD::SIMDTraits<FLOAT_VEC_T>::UINT_VEC_T UINT_VEC_T;
+
+    UINT_VEC_T operator() (FLOAT_VEC_T const & x) const {
+        return UINT_VEC_T(x.mul(FLOAT_T(HIST_SIZE) / static_cast<FLOAT_T>(1000)).trunc());
+    }
+};
+
+template<typename FLOAT_VEC_T>
+TIMING_RES test_UME_SIMD_histogram(uint32_t threadCount)
+{
+    typedef typename UME::SIMD::SIMDTraits<FLOAT_VEC_T>::SCALAR_T   FLOAT_T;
+
+    const uint32_t VEC_LEN = FLOAT_VEC_T::length();
+    const int ALIGNMENT = FLOAT_VEC_T::alignment();
+    unsigned long long start, end;    // Time measurements
+
+    FLOAT_T *data;
+    unsigned int *hist;
+
+    unsigned int *verify_hist;
+
+    data = (FLOAT_T *)UME::DynamicMemory::AlignedMalloc(INPUT_SIZE*sizeof(FLOAT_T), ALIGNMENT);
+
+    // Initialize arrays with random data
+    for (int i = 0; i < INPUT_SIZE; i++) {
+        // Generate random numbers in range (0.0;1000.0)
+        data[i] = static_cast <FLOAT_T> (rand()) / (static_cast <FLOAT_T> (RAND_MAX) / static_cast<FLOAT_T>(999));
+    }
+
+    hist = (unsigned int *)UME::DynamicMemory::AlignedMalloc(HIST_SIZE*sizeof(unsigned int), ALIGNMENT);
+    verify_hist = (unsigned int *)UME::DynamicMemory::AlignedMalloc(HIST_SIZE*sizeof(unsigned int), ALIGNMENT);
+
+    for (int i = 0; i < HIST_SIZE; i++) {
+        hist[i] = 0;
+        verify_hist[i] = 0;
+    }
+
+    // This is the actual binning code
+    {
+        start = get_timestamp();
+
+        UME::SIMD::histogram<VEC_LEN>(data, INPUT_SIZE, hist, HIST_SIZE, HistogramBinning<FLOAT_VEC_T>(), threadCount);
+
+        end = get_timestamp();
+
+        // Verify results
+        for (int i = 0; i < INPUT_SIZE; i++)
+        {
+            unsigned int bin = (unsigned int)((FLOAT_T(HIST_SIZE) / static_cast<FLOAT_T>(1000))*data[i]);
+            verify_hist[bin]++;
+        }
+
+        for (int i = 0; i < HIST_SIZE; i++) {
+            if (hist[i] != verify_hist[i]) {
+                std::cout << VEC_LEN << ": Invalid result at index " << i << " expected: " << verify_hist[i] << ", actual: " << hist[i] << "\n";
+            }
+        }
+    }
+
+    UME::DynamicMemory::AlignedFree(data);
+    UME::DynamicMemory::AlignedFree(hist);
+    UME::DynamicMemory::AlignedFree(verify_hist);
+
+    return end - start;
+}
+
 template<typename VEC_T>
 void benchmarkUMESIMD(std::string const & resultPrefix, int iterations, TimingStatistics & reference)
 {
@@ -227,11 +437,51 @@ void benchmarkUMESIMD(std::string const & resultPrefix, int iterations, TimingSt
         << std::endl;
 }
 
+template<typename VEC_T>
+void benchmarkUMESIMD_int(std::string const & resultPrefix, int iterations, TimingStatistics & reference)
+{
+    TimingStatistics stats;
+
+    for (int i = 0; i < iterations; i++)
+    {
+        unsigned long long elapsed = test_UME_SIMD_int<VEC_T>();
+        stats.update(elapsed);
+    }
+
+    std::cout << resultPrefix << (unsigned long long) stats.getAverage()
+        << ", dev: " << (unsigned long long) stats.getStdDev()
+        << ", 90% confidence: " << (unsigned long long) stats.confidence90()
+        << ", 95% confidence: " << (unsigned long long) stats.confidence95()
+        << " (speedup: "
+        << stats.calculateSpeedup(reference) << ")"
+        << std::endl;
+}
+
+template<typename VEC_T>
+void benchmarkUMESIMD_histogram(std::string const & resultPrefix, uint32_t threadCount, int iterations, TimingStatistics & reference)
+{
+    TimingStatistics stats;
+
+    for (int i = 0; i < iterations; i++)
+    {
+        unsigned long long elapsed = test_UME_SIMD_histogram<VEC_T>(threadCount);
+        stats.update(elapsed);
+    }
+
+    std::cout << resultPrefix << (unsigned long long) stats.getAverage()
+        << ", dev: " << (unsigned long long) stats.getStdDev()
+        << ", 90% confidence: " << (unsigned long long) stats.confidence90()
+        << ", 95% confidence: " << (unsigned long long) stats.confidence95()
+        << " (speedup: "
+        << stats.calculateSpeedup(reference) << ")"
+        << std::endl;
+}
+
 int main()
 {
     const int ITERATIONS = 1000;
 
-    TimingStatistics stats_scalar_f, stats_scalar_d;
+    TimingStatistics stats_scalar_f, stats_scalar_d, stats_scalar_u;
 
     srand ((unsigned int)time(NULL));
 
@@ -241,7 +491,10 @@ int main()
         "SIMD versions use following operations: \n"
         "float 32b: LOADA, MULV, TRUNC\n"
         "int   32b:  ITOU\n"
-        "uint  32b:  ASSIGNV, UNIQUE, GATHERV, SCATTERV, PREFINC, UNPACK\n\n";
+        "uint  32b:  ASSIGNV, UNIQUE, GATHERV, SCATTERV, PREFINC, UNPACK\n"
+        "Integer binning variant uses LOADA, DIVD (division by SIMDDivisor) instead of MULV and TRUNC.\n"
+        "UME::SIMD::histogram variant uses LOAD, MULS, TRUNC, ITOU, GATHERV, SCATTERV, ADDV and HADD\n"
+        "on per-thread and per-lane sub-histograms.\n\n";
 
     for (int i = 0; i < ITERATIONS; i++)
     {
@@ -262,5 +515,30 @@ int main()
     benchmarkUMESIMD<UME::SIMD::SIMD16_32f>("SIMD code (16x32f): ", ITERATIONS, stats_scalar_f);
     benchmarkUMESIMD<UME::SIMD::SIMD32_32f>("SIMD code (32x32f): ", ITERATIONS, stats_scalar_f);
 
+    const uint32_t THREADS = std::max(1u, std::thread::hardware_concurrency());
+    benchmarkUMESIMD_histogram<UME::SIMD::SIMD8_32f>("UME::SIMD::histogram (8x32f, 1 thread): ", 1, ITERATIONS, stats_scalar_f);
+    benchmarkUMESIMD_histogram<UME::SIMD::SIMD16_32f>("UME::SIMD::histogram (16x32f, 1 thread): ", 1, ITERATIONS, stats_scalar_f);
+    benchmarkUMESIMD_histogram<UME::SIMD::SIMD8_32f>("UME::SIMD::histogram (8x32f, " + std::to_string(THREADS) + " threads): ", THREADS, ITERATIONS, stats_scalar_f);
+    benchmarkUMESIMD_histogram<UME::SIMD::SIMD16_32f>("UME::SIMD::histogram (16x32f, " + std::to_string(THREADS) + " threads): ", THREADS, ITERATIONS, stats_scalar_f);
+
+    for (int i = 0; i < ITERATIONS; i++)
+    {
+        stats_scalar_u.update(test_scalar_int());
+    }
+
+    std::cout << "Scalar code (uint): " << (unsigned long long) stats_scalar_u.getAverage()
+        << ", dev: " << (unsigned long long) stats_scalar_u.getStdDev()
+        << ", 90% confidence: " << (unsigned long long) stats_scalar_u.confidence90()
+        << ", 95% confidence: " << (unsigned long long) stats_scalar_u.confidence95()
+        << " (speedup: 1.0x)"
+        << std::endl;
+
+    benchmarkUMESIMD_int<UME::SIMD::SIMD1_32u>("SIMD code (1x32u): ", ITERATIONS, stats_scalar_u);
+    benchmarkUMESIMD_int<UME::SIMD::SIMD2_32u>("SIMD code (2x32u): ", ITERATIONS, stats_scalar_u);
+    benchmarkUMESIMD_int<UME::SIMD::SIMD4_32u>("SIMD code (4x32u): ", ITERATIONS, stats_scalar_u);
+    benchmarkUMESIMD_int<UME::SIMD::SIMD8_32u>("SIMD code (8x32u): ", ITERATIONS, stats_scalar_u);
+    benchmarkUMESIMD_int<UME::SIMD::SIMD16_32u>("SIMD code (16x32u): ", ITERATIONS, stats_scalar_u);
+    benchmarkUMESIMD_int<UME::SIMD::SIMD32_32u>("SIMD code (32x32u): ", ITERATIONS, stats_scalar_u);
+
     return 0;
 }
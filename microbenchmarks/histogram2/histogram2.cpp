@@ -302,6 +302,20 @@ TIMING_RES test_AVX_d_256()
 #endif
 
 #if defined(__AVX512F__)
+// Population count of every 32-bit lane. VPOPCNTD requires AVX512_VPOPCNTDQ,
+// so the count is calculated with bit arithmetic available in AVX512F.
+UME_FORCE_INLINE __m512i popcount_epi32(__m512i x)
+{
+    __m512i t0 = _mm512_sub_epi32(x, _mm512_and_si512(_mm512_srli_epi32(x, 1), _mm512_set1_epi32(0x55555555)));
+    __m512i t1 = _mm512_add_epi32(
+        _mm512_and_si512(t0, _mm512_set1_epi32(0x33333333)),
+        _mm512_and_si512(_mm512_srli_epi32(t0, 2), _mm512_set1_epi32(0x33333333)));
+    __m512i t2 = _mm512_and_si512(_mm512_add_epi32(t1, _mm512_srli_epi32(t1, 4)), _mm512_set1_epi32(0x0F0F0F0F));
+    __m512i t3 = _mm512_add_epi32(t2, _mm512_srli_epi32(t2, 8));
+    __m512i t4 = _mm512_add_epi32(t3, _mm512_srli_epi32(t3, 16));
+    return _mm512_and_si512(t4, _mm512_set1_epi32(0x3F));
+}
+
 TIMING_RES test_AVX512_f()
 {
     const uint32_t VEC_LEN = 16;
@@ -340,7 +354,7 @@ TIMING_RES test_AVX512_f()
         __m512 coeff_vec = _mm512_set1_ps(float(HIST_SIZE) / static_cast<float>(1000));
 
         __m512i index_vec;
-        alignas(ALIGNMENT) uint32_t indices[VEC_LEN];
+        __m512i one_vec = _mm512_set1_epi32(1);
 
         unsigned int bin;
 
@@ -353,24 +367,17 @@ TIMING_RES test_AVX512_f()
             index_vec = _mm512_cvttps_epi32(t0);
             // Perform histogram update
 
-            // check for conflicts
-            __m512i t0 = _mm512_conflict_epi32(index_vec);
-            __mmask16 m0 = 0xFFFF & _mm512_cmpeq_epu32_mask(t0, _mm512_setzero_epi32());
-
-            // Perform histogram update. Use scalar emulation
-            if(m0 == 0xFFFF)
-            {
-                __m512i bin_vec = _mm512_i32gather_epi32(index_vec, (const int *)hist, 4);
-                bin_vec = _mm512_add_epi32(bin_vec, _mm512_set1_epi32(1));
-                _mm512_i32scatter_epi32((int *)hist, index_vec, bin_vec, 4);
-            }
-            else
-            {
-                _mm512_store_epi32(indices, index_vec);
-                for (unsigned int i = 0; i < VEC_LEN; i++) {
-                    hist[indices[i]]++;
-                }
-            }
+            // Resolve lanes falling into the same bin. Bit 'j' of conflict
+            // lane 'i' is set if lane 'j < i' has the same index, so every lane
+            // increments its bin by the number of its predecessors plus one.
+            // Writes of a scatter to the same address are ordered from the
+            // lowest to the highest lane, so the last occurrence of a bin, which
+            // carries the complete count, is the one that stays in memory.
+            __m512i t1 = _mm512_conflict_epi32(index_vec);
+            __m512i t2 = _mm512_add_epi32(popcount_epi32(t1), one_vec);
+            __m512i bin_vec = _mm512_i32gather_epi32(index_vec, (const int *)hist, 4);
+            bin_vec = _mm512_add_epi32(bin_vec, t2);
+            _mm512_i32scatter_epi32((int *)hist, index_vec, bin_vec, 4);
         }
 
         // Calculate reminder elements using scalar code
@@ -440,7 +447,7 @@ TIMING_RES test_AVX512_d()
 
         __m256i index_vec;
         __m256i bin_vec;
-        alignas(ALIGNMENT) uint32_t indices[VEC_LEN];
+        __m256i one_vec = _mm256_set1_epi32(1);
 
         unsigned int bin;
 
@@ -452,30 +459,19 @@ TIMING_RES test_AVX512_d()
             t0 = _mm512_mul_pd(data_vec, coeff_vec);
             index_vec = _mm512_cvttpd_epi32(t0);
 
-            // check for conflicts
-            __m512i t0 = _mm512_conflict_epi32(_mm512_castsi256_si512(index_vec));
-            __mmask16 m0 = 0xFF & _mm512_cmpeq_epu32_mask(t0, _mm512_setzero_epi32());
-
-            // Perform histogram update. Use scalar emulation
-            if(m0 == 0xFF)
-            {
-                bin_vec = _mm256_i32gather_epi32((const int *)hist, index_vec, 4);
-                bin_vec = _mm256_add_epi32(bin_vec, _mm256_set1_epi32(1));
-                //_mm512_i32scatter_epi32(hist, index_vec, bin_vec, 4);
-                _mm512_mask_i32scatter_epi32(
-                    (int*)hist,
-                    0xFF,
-                    _mm512_castsi256_si512(index_vec),
-                    _mm512_castsi256_si512(bin_vec),
-                    4);
-            }
-            else
-            {
-                _mm256_store_si256((__m256i*)indices, index_vec);
-                for (unsigned int i = 0; i < VEC_LEN; i++) {
-                    hist[indices[i]]++;
-                }
-            }
+            // Resolve lanes falling into the same bin, as in test_AVX512_f().
+            // Conflicts of the lower 8 lanes do not depend on the upper half
+            // of the register, so it does not have to be cleared.
+            __m512i t1 = _mm512_conflict_epi32(_mm512_castsi256_si512(index_vec));
+            __m256i t2 = _mm256_add_epi32(_mm512_castsi512_si256(popcount_epi32(t1)), one_vec);
+            bin_vec = _mm256_i32gather_epi32((const int *)hist, index_vec, 4);
+            bin_vec = _mm256_add_epi32(bin_vec, t2);
+            _mm512_mask_i32scatter_epi32(
+                (int*)hist,
+                0xFF,
+                _mm512_castsi256_si512(index_vec),
+                _mm512_castsi256_si512(bin_vec),
+                4);
         }
 
         // Calculate reminder elements using scalar code
@@ -331,6 +331,53 @@ void instr_name##Latency() { \
         " cycles per element: " << latency_avg / float(VEC_LEN) << std::endl; \
 }
 
+// Generate test function for shift operations of following form:
+//
+//   VEC_T vec0, vec1;
+//   uint32_t shiftOp;
+//   vec1 = vec0.<MFI_FUNCTION>(shiftOp);
+//
+// The shift count is kept below the scalar width, so that the emulated
+// and native versions perform the same work.
+//
+// instr_name - name of instruction as defined in UME::SIMD interface spec
+// MFI_name   - name of function in Member Function Interface used to implement instr_name
+#define DEFINE_VEC_SHIFT_TEST_TEMPLATE(instr_name, MFI_name) \
+template<typename VEC_T> \
+void instr_name##Latency() { \
+    unsigned long long start = 0, end = 0; \
+    float delta = 0.0f; \
+    float latency_avg = 0.0f; \
+ \
+    typedef typename UME::SIMD::SIMDTraits<VEC_T>::SCALAR_T SCALAR_T; \
+    const int VEC_LEN = VEC_T::length(); \
+ \
+    alignas(VEC_T::alignment()) SCALAR_T raw1[VEC_LEN]; \
+ \
+    for (int i = 0; i < ITERATIONS; i++) { \
+        getRandomArray<SCALAR_T>(raw1, VEC_LEN); \
+        uint32_t shiftOp = getRandomValue<uint32_t>() % (8 * sizeof(SCALAR_T)); \
+ \
+        VEC_T vec0(raw1); \
+        VEC_T res; \
+ \
+        start = __rdtsc(); \
+            REPEAT_LINE1024(vec0.assign(vec0.MFI_name(shiftOp))); \
+            vec0.store(raw1); /* force memory store operation */\
+        end = __rdtsc(); \
+ \
+        volatile SCALAR_T x = forceReductionArray<SCALAR_T>(raw1, VEC_LEN); \
+ \
+        delta = float(end - start)/ float(1024); \
+        float d = delta - latency_avg; \
+        latency_avg += d / (1.0f + float(i)); \
+ \
+    } \
+ \
+    std::cout << " Average latency is: " << latency_avg << \
+        " cycles per element: " << latency_avg / float(VEC_LEN) << std::endl; \
+}
+
 
 // Generate test function for Base vector operations of following form:
 //
@@ -1292,6 +1339,11 @@ DEFINE_ASSIGN_MASK_SCALAR_TEST_TEMPLATE(MBANDSA, banda);
 DEFINE_ASSIGN_MASK_SCALAR_TEST_TEMPLATE(MBORSA, bora);
 DEFINE_ASSIGN_MASK_SCALAR_TEST_TEMPLATE(MBXORSA, bxora);
 
+// vec0 = vec1.<INSTR>(shift)
+//      Shift interface operations
+DEFINE_VEC_SHIFT_TEST_TEMPLATE(LSHS, lsh);
+DEFINE_VEC_SHIFT_TEST_TEMPLATE(RSHS, rsh);
+
 // vec1 = vec0.<INSTR>()
 //      Base interface operations
 DEFINE_VEC_TEST_TEMPLATE(POSTINC, postinc);
@@ -1640,6 +1692,10 @@ DEFINE_VEC_MASK_VEC_VEC_TEST_TEMPLATE(MFSUBMULV, fsubmul);
     CALL_TEST(ABSA, vecname); \
     CALL_TEST(MABSA, vecname);
 
+#define CALL_TESTS_SHIFT(vecname) \
+    CALL_TEST(LSHS, vecname); \
+    CALL_TEST(RSHS, vecname);
+
 #define CALL_TESTS_MASK(vecname) \
     std::cout << "Testing: " << TOSTRING(vecname) << "\n"; \
     CALL_TEST(LANDV, vecname); \
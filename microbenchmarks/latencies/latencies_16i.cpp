@@ -40,4 +40,10 @@ void main() {
     CALL_TESTS_INT(SIMD32_16i);
     CALL_TESTS_INT(SIMD64_16i);
 
+    // SIMD8_16i, SIMD16_16i and SIMD32_16i are native in AVX2 plugin, SIMD64_16i is emulated.
+    CALL_TESTS_SHIFT(SIMD8_16i);
+    CALL_TESTS_SHIFT(SIMD16_16i);
+    CALL_TESTS_SHIFT(SIMD32_16i);
+    CALL_TESTS_SHIFT(SIMD64_16i);
+
 }
@@ -38,4 +38,8 @@ void main() {
     CALL_TESTS_UINT(SIMD8_64u);
     CALL_TESTS_UINT(SIMD16_64u);
 
+    // SIMD4_64u is native in AVX2 plugin, SIMD8_64u is emulated.
+    CALL_TESTS_SHIFT(SIMD4_64u);
+    CALL_TESTS_SHIFT(SIMD8_64u);
+
 }
@@ -41,4 +41,9 @@ void main() {
     CALL_TESTS_UINT(SIMD64_8u);
     CALL_TESTS_UINT(SIMD128_8u);
 
+    // SIMD16_8u and SIMD32_8u are native in AVX2 plugin, SIMD64_8u is emulated.
+    CALL_TESTS_SHIFT(SIMD16_8u);
+    CALL_TESTS_SHIFT(SIMD32_8u);
+    CALL_TESTS_SHIFT(SIMD64_8u);
+
 }
@@ -0,0 +1,146 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#include <iostream>
+#include <iomanip>
+#include <cstring>
+
+#include "../../UMESimd.h"
+#include "../../UMEMemory.h"
+#include "../utilities/TimingStatistics.h"
+
+// Compares UME::DynamicMemory::MemCopy/MemSet against glibc memcpy/memset
+// for buffer sizes from 64B to 1GB. The UME versions are measured twice:
+// with the default streaming threshold and with streaming stores forced
+// for every size.
+
+const std::size_t MIN_SIZE = 64;
+const std::size_t MAX_SIZE = std::size_t(1) << 30;
+// Amount of data processed for each measurement of small buffers
+const std::size_t BYTES_PER_MEASUREMENT = std::size_t(1) << 28;
+const int MEASUREMENTS = 5;
+
+template<typename FUNC_T>
+double measure(FUNC_T func, std::size_t size) {
+    std::size_t repetitions = BYTES_PER_MEASUREMENT / size;
+    if (repetitions < 1) repetitions = 1;
+
+    // Warm up
+    func();
+
+    TimingStatistics stats;
+    for (int m = 0; m < MEASUREMENTS; m++) {
+        unsigned long long start = get_timestamp();
+        for (std::size_t r = 0; r < repetitions; r++) func();
+        unsigned long long end = get_timestamp();
+        stats.update(end - start);
+    }
+    // Return bandwidth in GB/s (timestamps are in nanoseconds)
+    return double(size) * double(repetitions) / double(stats.getAverage());
+}
+
+UME_NEVER_INLINE void glibc_copy(char* dst, char* src, std::size_t size) {
+    std::memcpy(dst, src, size);
+}
+
+UME_NEVER_INLINE void ume_copy(char* dst, char* src, std::size_t size) {
+    UME::DynamicMemory::MemCopy(dst, src, size);
+}
+
+UME_NEVER_INLINE void glibc_set(char* dst, std::size_t size) {
+    std::memset(dst, 0x5A, size);
+}
+
+UME_NEVER_INLINE void ume_set(char* dst, std::size_t size) {
+    UME::DynamicMemory::MemSet(dst, 0x5A, size);
+}
+
+int main()
+{
+    const std::size_t defaultThreshold = UME::DynamicMemory::StreamingThreshold();
+
+    char* src = (char*)UME::DynamicMemory::AlignedMalloc(MAX_SIZE, 64);
+    char* dst = (char*)UME::DynamicMemory::AlignedMalloc(MAX_SIZE, 64);
+    if (src == nullptr || dst == nullptr) {
+        std::cout << "Cannot allocate " << 2 * MAX_SIZE << " bytes.\n";
+        return 1;
+    }
+    std::memset(src, 1, MAX_SIZE);
+    std::memset(dst, 2, MAX_SIZE);
+
+    std::cout << "The result is bandwidth (GB/s) of copying/setting a buffer of given size.\n"
+        "UME versions use non-temporal stores from " << defaultThreshold << " bytes (default)\n"
+        "or for every size (stream). Speedup calculated with glibc result as reference.\n\n";
+
+    std::cout << std::setw(12) << "size"
+        << std::setw(12) << "memcpy"
+        << std::setw(12) << "MemCopy"
+        << std::setw(12) << "(stream)"
+        << std::setw(10) << "speedup"
+        << std::setw(12) << "memset"
+        << std::setw(12) << "MemSet"
+        << std::setw(12) << "(stream)"
+        << std::setw(10) << "speedup" << "\n";
+
+    for (std::size_t size = MIN_SIZE; size <= MAX_SIZE; size *= 4) {
+        double bw_memcpy = measure([&]() { glibc_copy(dst, src, size); }, size);
+        UME::DynamicMemory::SetStreamingThreshold(defaultThreshold);
+        double bw_ume_copy = measure([&]() { ume_copy(dst, src, size); }, size);
+        UME::DynamicMemory::SetStreamingThreshold(0);
+        double bw_ume_copy_stream = measure([&]() { ume_copy(dst, src, size); }, size);
+
+        double bw_memset = measure([&]() { glibc_set(dst, size); }, size);
+        UME::DynamicMemory::SetStreamingThreshold(defaultThreshold);
+        double bw_ume_set = measure([&]() { ume_set(dst, size); }, size);
+        UME::DynamicMemory::SetStreamingThreshold(0);
+        double bw_ume_set_stream = measure([&]() { ume_set(dst, size); }, size);
+
+        std::cout << std::setw(12) << size << std::fixed << std::setprecision(2)
+            << std::setw(12) << bw_memcpy
+            << std::setw(12) << bw_ume_copy
+            << std::setw(12) << bw_ume_copy_stream
+            << std::setw(10) << bw_ume_copy / bw_memcpy
+            << std::setw(12) << bw_memset
+            << std::setw(12) << bw_ume_set
+            << std::setw(12) << bw_ume_set_stream
+            << std::setw(10) << bw_ume_set / bw_memset << "\n";
+    }
+
+    // Verify the result of the last operations
+    UME::DynamicMemory::MemCopy(dst + 3, src + 5, MAX_SIZE - 8);
+    bool copyCorrect = std::memcmp(dst + 3, src + 5, MAX_SIZE - 8) == 0;
+    UME::DynamicMemory::MemSet(dst + 1, 7, MAX_SIZE - 2);
+    bool setCorrect = (dst[0] == 0x5A) && (dst[1] == 7) && (dst[MAX_SIZE - 2] == 7) && (dst[MAX_SIZE - 1] == 0x5A);
+    std::cout << "\nCorrectness check: " << ((copyCorrect && setCorrect) ? "PASS" : "FAIL") << std::endl;
+
+    UME::DynamicMemory::AlignedFree(src);
+    UME::DynamicMemory::AlignedFree(dst);
+    return 0;
+}
@@ -0,0 +1,192 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#include <random>
+#include <iomanip>
+#include <cmath>
+
+#include "../../UMESimd.h"
+#include "../utilities/TimingStatistics.h"
+
+using namespace UME::SIMD;
+
+// Reports measured maximum ULP error and execution time of each Precision
+// tier of EXP, LOG, SIN and COS. The reference is computed in long double.
+
+enum Function { FUNC_EXP, FUNC_LOG, FUNC_SIN, FUNC_COS, FUNC_COUNT };
+const char * FUNCTION_NAMES[FUNC_COUNT] = { "EXP", "LOG", "SIN", "COS" };
+const char * PRECISION_NAMES[3] = { "Accurate", "Fast", "Approx" };
+
+template<typename SCALAR_FLOAT_T>
+void generate_inputs(Function func, int count, SCALAR_FLOAT_T * input, long double * reference) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<SCALAR_FLOAT_T> distExp(SCALAR_FLOAT_T(-80.0), SCALAR_FLOAT_T(80.0));
+    std::uniform_real_distribution<SCALAR_FLOAT_T> distLog(SCALAR_FLOAT_T(-60.0), SCALAR_FLOAT_T(60.0));
+    std::uniform_real_distribution<SCALAR_FLOAT_T> distTrig(SCALAR_FLOAT_T(-100.0), SCALAR_FLOAT_T(100.0));
+
+    for (int i = 0; i < count; i++) {
+        switch (func) {
+        case FUNC_EXP:
+            input[i] = distExp(gen);
+            reference[i] = std::exp((long double)input[i]);
+            break;
+        case FUNC_LOG:
+            input[i] = std::exp(distLog(gen));
+            reference[i] = std::log((long double)input[i]);
+            break;
+        case FUNC_SIN:
+            input[i] = distTrig(gen);
+            reference[i] = std::sin((long double)input[i]);
+            break;
+        default:
+            input[i] = distTrig(gen);
+            reference[i] = std::cos((long double)input[i]);
+            break;
+        }
+    }
+}
+
+// Error in units of the last place of the correctly rounded result.
+template<typename SCALAR_FLOAT_T>
+double error_ulp(SCALAR_FLOAT_T value, long double reference) {
+    // Absolute error of a result close to zero is not meaningful in ULP.
+    if (std::abs(reference) < 1e-3L) return 0.0;
+    int exponent;
+    std::frexp(reference, &exponent);
+    long double ulp = std::ldexp(1.0L, exponent - std::numeric_limits<SCALAR_FLOAT_T>::digits);
+    return double(std::abs((long double)value - reference) / ulp);
+}
+
+template<Precision P, typename SCALAR_FLOAT_T, int VEC_LEN>
+UME_NEVER_INLINE void test_tier(Function func, const int ARRAY_SIZE, SCALAR_FLOAT_T * input, SCALAR_FLOAT_T * values, unsigned long long & elapsed) {
+    SIMDVec<SCALAR_FLOAT_T, VEC_LEN> x, y;
+    unsigned long long start, end;
+
+    start = get_timestamp();
+    switch (func) {
+    case FUNC_EXP:
+        for (int i = 0; i < ARRAY_SIZE; i += VEC_LEN) {
+            x.load(&input[i]);
+            y = FUNCTIONS::exp<P>(x);
+            y.store(&values[i]);
+        }
+        break;
+    case FUNC_LOG:
+        for (int i = 0; i < ARRAY_SIZE; i += VEC_LEN) {
+            x.load(&input[i]);
+            y = FUNCTIONS::log<P>(x);
+            y.store(&values[i]);
+        }
+        break;
+    case FUNC_SIN:
+        for (int i = 0; i < ARRAY_SIZE; i += VEC_LEN) {
+            x.load(&input[i]);
+            y = FUNCTIONS::sin<P>(x);
+            y.store(&values[i]);
+        }
+        break;
+    default:
+        for (int i = 0; i < ARRAY_SIZE; i += VEC_LEN) {
+            x.load(&input[i]);
+            y = FUNCTIONS::cos<P>(x);
+            y.store(&values[i]);
+        }
+        break;
+    }
+    end = get_timestamp();
+    elapsed = end - start;
+}
+
+template<Precision P, typename SCALAR_FLOAT_T, int VEC_LEN>
+void benchmarkTier(int ITERATIONS, const int ARRAY_SIZE, Function func, TimingStatistics & reference) {
+    SCALAR_FLOAT_T* input = (SCALAR_FLOAT_T*)UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), 64);
+    SCALAR_FLOAT_T* values = (SCALAR_FLOAT_T*)UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), 64);
+    long double* output = new long double[ARRAY_SIZE];
+
+    generate_inputs<SCALAR_FLOAT_T>(func, ARRAY_SIZE, input, output);
+
+    TimingStatistics time;
+    for (int i = 0; i < ITERATIONS; i++) {
+        unsigned long long elapsed;
+        test_tier<P, SCALAR_FLOAT_T, VEC_LEN>(func, ARRAY_SIZE, input, values, elapsed);
+        time.update(elapsed);
+    }
+    if (P == Precision::Accurate) reference = time;
+
+    double max_err = 0.0;
+    for (int i = 0; i < ARRAY_SIZE; i++) {
+        double err = error_ulp<SCALAR_FLOAT_T>(values[i], output[i]);
+        if (max_err < err) max_err = err;
+    }
+
+    std::cout << "    " << std::setw(4) << FUNCTION_NAMES[func]
+        << " " << std::setw(9) << PRECISION_NAMES[int(P)]
+        << " time: " << std::setw(9) << (unsigned long long)time.getAverage()
+        << ", dev: " << std::setw(7) << (unsigned long long)time.getStdDev()
+        << " (speedup: " << std::setprecision(3) << time.calculateSpeedup(reference) << "x)"
+        << "  Max error (ULP): " << std::setprecision(6) << max_err << "\n";
+
+    delete[] output;
+    UME::DynamicMemory::AlignedFree(input);
+    UME::DynamicMemory::AlignedFree(values);
+}
+
+template<typename SCALAR_FLOAT_T, int VEC_LEN>
+void benchmarkUMESIMD(char const * resultPrefix, int ITERATIONS, const int ARRAY_SIZE) {
+    std::cout << resultPrefix << ":\n";
+    for (int f = 0; f < FUNC_COUNT; f++) {
+        TimingStatistics reference;
+        benchmarkTier<Precision::Accurate, SCALAR_FLOAT_T, VEC_LEN>(ITERATIONS, ARRAY_SIZE, Function(f), reference);
+        benchmarkTier<Precision::Fast, SCALAR_FLOAT_T, VEC_LEN>(ITERATIONS, ARRAY_SIZE, Function(f), reference);
+        benchmarkTier<Precision::Approx, SCALAR_FLOAT_T, VEC_LEN>(ITERATIONS, ARRAY_SIZE, Function(f), reference);
+    }
+    std::cout << std::endl;
+}
+
+int main()
+{
+    const int ITERATIONS = 1000;
+    const int ARRAY_SIZE = 10240;
+
+    std::cout << "The result is amount of time it takes to calculate exp, log, sin and cos of: " << ARRAY_SIZE << " elements\n"
+        "using each Precision tier (Accurate, Fast, Approx).\n"
+        "All timing results in nanoseconds. \n"
+        "Speedup calculated with Precision::Accurate of the same function and vector length as reference.\n"
+        "Error is the maximum ULP error measured against a long double reference.\n\n";
+
+    benchmarkUMESIMD<float, 4>("SIMD code(4x32f) ", ITERATIONS, ARRAY_SIZE);
+    benchmarkUMESIMD<float, 8>("SIMD code(8x32f) ", ITERATIONS, ARRAY_SIZE);
+    benchmarkUMESIMD<float, 16>("SIMD code(16x32f) ", ITERATIONS, ARRAY_SIZE);
+    benchmarkUMESIMD<double, 2>("SIMD code(2x64f) ", ITERATIONS, ARRAY_SIZE);
+    benchmarkUMESIMD<double, 4>("SIMD code(4x64f) ", ITERATIONS, ARRAY_SIZE);
+    benchmarkUMESIMD<double, 8>("SIMD code(8x64f) ", ITERATIONS, ARRAY_SIZE);
+
+    return 0;
+}
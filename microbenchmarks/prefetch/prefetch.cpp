@@ -0,0 +1,154 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+
+#include "../../UMESimd.h"
+#include "../utilities/TimingStatistics.h"
+
+// Sums elements of a large table read through an array of random indices,
+// i.e. every access is a dependent-free cache miss. The SIMD versions read a
+// vector of elements per iteration with 'gather'. The prefetched versions
+// additionally issue 'prefetchgather0' for the indices PREFETCH_DIST vectors
+// ahead, so that misses of future gathers overlap with the current one. The
+// relative difference between the plain and the prefetched gather is the
+// part of the memory latency that was hidden.
+
+const int TABLE_SIZE = 1 << 24;   // 64MB of uint32_t, well above LLC size
+const int INDEX_COUNT = 1 << 22;
+const int MAX_PREFETCH_DIST = 64; // in vectors
+const int MEASUREMENTS = 10;
+
+UME_NEVER_INLINE uint32_t sum_scalar(uint32_t const * table, uint32_t const * indices) {
+    uint32_t sum = 0;
+    for (int i = 0; i < INDEX_COUNT; i++) sum += table[indices[i]];
+    return sum;
+}
+
+template<typename VEC_T, int PREFETCH_DIST>
+UME_NEVER_INLINE uint32_t sum_gather(uint32_t const * table, uint32_t const * indices) {
+    const int VEC_LEN = VEC_T::length();
+    VEC_T sum(uint32_t(0));
+    VEC_T x;
+    for (int i = 0; i < INDEX_COUNT; i += VEC_LEN) {
+        if (PREFETCH_DIST > 0) {
+            // 'indices' is padded, so the look-ahead never leaves the array.
+            VEC_T future(indices + i + PREFETCH_DIST * VEC_LEN);
+            VEC_T::prefetchgather0(table, future);
+        }
+        VEC_T idx(indices + i);
+        x.gather(table, idx);
+        sum.adda(x);
+    }
+    return sum.hadd();
+}
+
+template<typename FUNC_T>
+TimingStatistics measure(FUNC_T func, uint32_t const * table, uint32_t const * indices, uint32_t reference) {
+    TimingStatistics stats;
+    uint32_t result = 0;
+    for (int m = 0; m < MEASUREMENTS; m++) {
+        unsigned long long start = get_timestamp();
+        result = func(table, indices);
+        unsigned long long end = get_timestamp();
+        stats.update(end - start);
+    }
+    if (result != reference) {
+        std::cout << "Result invalid: " << result << " instead of " << reference << std::endl;
+    }
+    return stats;
+}
+
+template<typename VEC_T>
+void benchmark(char const * name, uint32_t const * table, uint32_t const * indices,
+               uint32_t reference, TimingStatistics & scalar) {
+    TimingStatistics plain = measure(sum_gather<VEC_T, 0>, table, indices, reference);
+    TimingStatistics dist4 = measure(sum_gather<VEC_T, 4>, table, indices, reference);
+    TimingStatistics dist16 = measure(sum_gather<VEC_T, 16>, table, indices, reference);
+    TimingStatistics dist64 = measure(sum_gather<VEC_T, 64>, table, indices, reference);
+
+    std::cout << std::setw(12) << name << std::fixed << std::setprecision(2)
+        << std::setw(14) << plain.getAverage()
+        << std::setw(10) << plain.calculateSpeedup(scalar)
+        << std::setw(14) << dist4.getAverage()
+        << std::setw(10) << dist4.calculateSpeedup(plain)
+        << std::setw(14) << dist16.getAverage()
+        << std::setw(10) << dist16.calculateSpeedup(plain)
+        << std::setw(14) << dist64.getAverage()
+        << std::setw(10) << dist64.calculateSpeedup(plain) << "\n";
+}
+
+int main()
+{
+    srand((unsigned int)time(NULL));
+
+    const int INDEX_ARRAY_SIZE = INDEX_COUNT + MAX_PREFETCH_DIST * 32;
+    uint32_t* table = (uint32_t*)UME::DynamicMemory::AlignedMalloc(TABLE_SIZE * sizeof(uint32_t), 64);
+    uint32_t* indices = (uint32_t*)UME::DynamicMemory::AlignedMalloc(INDEX_ARRAY_SIZE * sizeof(uint32_t), 64);
+
+    for (int i = 0; i < TABLE_SIZE; i++) {
+        table[i] = uint32_t(rand());
+    }
+    for (int i = 0; i < INDEX_ARRAY_SIZE; i++) {
+        indices[i] = uint32_t((uint64_t(rand()) * uint64_t(RAND_MAX) + uint64_t(rand())) % TABLE_SIZE);
+    }
+
+    uint32_t reference = sum_scalar(table, indices);
+    TimingStatistics scalar = measure(sum_scalar, table, indices, reference);
+
+    std::cout << "The result is the average time (ns) of summing " << INDEX_COUNT << " randomly\n"
+        "indexed elements of a " << (TABLE_SIZE * sizeof(uint32_t)) / (1024 * 1024) << "MB table.\n"
+        "Scalar code: " << std::fixed << std::setprecision(2) << scalar.getAverage() << "\n"
+        "Speedup of the plain gather is calculated against scalar code. Speedups of\n"
+        "the prefetched versions (look-ahead in vectors) are calculated against the\n"
+        "plain gather.\n\n";
+
+    std::cout << std::setw(12) << "vector"
+        << std::setw(14) << "gather"
+        << std::setw(10) << "speedup"
+        << std::setw(14) << "dist 4"
+        << std::setw(10) << "speedup"
+        << std::setw(14) << "dist 16"
+        << std::setw(10) << "speedup"
+        << std::setw(14) << "dist 64"
+        << std::setw(10) << "speedup" << "\n";
+
+    benchmark<UME::SIMD::SIMD4_32u>("SIMD4_32u", table, indices, reference, scalar);
+    benchmark<UME::SIMD::SIMD8_32u>("SIMD8_32u", table, indices, reference, scalar);
+    benchmark<UME::SIMD::SIMD16_32u>("SIMD16_32u", table, indices, reference, scalar);
+    benchmark<UME::SIMD::SIMD32_32u>("SIMD32_32u", table, indices, reference, scalar);
+
+    UME::DynamicMemory::AlignedFree(table);
+    UME::DynamicMemory::AlignedFree(indices);
+
+    return 0;
+}
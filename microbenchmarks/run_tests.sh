@@ -9,6 +9,13 @@ ISA="ISA=$2"
 BUILD="BUILD=$3"
 
 
+RESULT="argmax_$1_$2_$3.txt"
+cd argmax
+make $COMPILER $ISA $BUILD
+for i in *.out; do "./$i" > "../$RESULT"; done
+rm *.out
+cd ..
+
 RESULT="average_$1_$2_$3.txt"
 cd average
 make $COMPILER $ISA $BUILD
@@ -23,6 +30,13 @@ for i in *.out; do "./$i" > "../$RESULT"; done
 rm *.out
 cd ..
 
+RESULT="hash_$1_$2_$3.txt"
+cd hash
+make $COMPILER $ISA $BUILD
+for i in *.out; do "./$i" > "../$RESULT"; done
+rm *.out
+cd ..
+
 RESULT="histogram1_$1_$2_$3.txt"
 cd histogram1
 make $COMPILER $ISA $BUILD
@@ -61,6 +75,13 @@ cd ..
 #rm *.out
 #cd ..
 
+RESULT="memcopy_$1_$2_$3.txt"
+cd memcopy
+make $COMPILER $ISA $BUILD
+for i in *.out; do "./$i" > "../$RESULT"; done
+rm *.out
+cd ..
+
 RESULT="polynomial_$1_$2_$3.txt"
 cd polynomial
 make $COMPILER $ISA $BUILD
@@ -68,6 +89,20 @@ for i in *.out; do "./$i" > "../$RESULT"; done
 rm *.out
 cd ..
 
+RESULT="precision_$1_$2_$3.txt"
+cd precision
+make $COMPILER $ISA $BUILD
+for i in *.out; do "./$i" > "../$RESULT"; done
+rm *.out
+cd ..
+
+RESULT="prefetch_$1_$2_$3.txt"
+cd prefetch
+make $COMPILER $ISA $BUILD
+for i in *.out; do "./$i" > "../$RESULT"; done
+rm *.out
+cd ..
+
 RESULT="quadraticsolver_$1_$2_$3.txt"
 cd QuadraticSolver
 make $COMPILER $ISA $BUILD
@@ -81,3 +116,10 @@ make $COMPILER $ISA $BUILD
 for i in *.out; do "./$i" > "../$RESULT"; done
 rm *.out
 cd ..
+
+RESULT="sort_$1_$2_$3.txt"
+cd sort
+make $COMPILER $ISA $BUILD
+for i in *.out; do "./$i" > "../$RESULT"; done
+rm *.out
+cd ..
@@ -73,8 +73,73 @@ struct benchmark_results {
     SCALAR_FLOAT_T cos_error_ulp;
 };
 
+template<typename SCALAR_FLOAT_T>
+struct trig_results {
+    unsigned long long elapsedTime;
+    SCALAR_FLOAT_T error_ulp;
+};
+
+template<typename SCALAR_FLOAT_T>
+struct TrigResults {
+    TimingStatistics time_tan;
+    TimingStatistics time_atan;
+    TimingStatistics time_atan2;
+
+    SCALAR_FLOAT_T max_err_tan;
+    SCALAR_FLOAT_T max_err_atan;
+    SCALAR_FLOAT_T max_err_atan2;
+
+    TrigResults() : max_err_tan(0), max_err_atan(0), max_err_atan2(0) {}
+
+    void update_tan(trig_results<SCALAR_FLOAT_T> const & res) {
+        time_tan.update(res.elapsedTime);
+        if (max_err_tan < res.error_ulp) max_err_tan = res.error_ulp;
+    }
+    void update_atan(trig_results<SCALAR_FLOAT_T> const & res) {
+        time_atan.update(res.elapsedTime);
+        if (max_err_atan < res.error_ulp) max_err_atan = res.error_ulp;
+    }
+    void update_atan2(trig_results<SCALAR_FLOAT_T> const & res) {
+        time_atan2.update(res.elapsedTime);
+        if (max_err_atan2 < res.error_ulp) max_err_atan2 = res.error_ulp;
+    }
+};
+
+template<typename SCALAR_FLOAT_T>
+SCALAR_FLOAT_T calculate_max_error_ulp(SCALAR_FLOAT_T const * values, SCALAR_FLOAT_T const * expected, int count) {
+    SCALAR_FLOAT_T max_err = 0;
+    for (int i = 0; i < count; i++) {
+        SCALAR_FLOAT_T next = NEXT_AFTER(values[i], HUGE_VALUE<SCALAR_FLOAT_T>());
+        SCALAR_FLOAT_T reference_value_ulp = std::abs(next - values[i]);
+        SCALAR_FLOAT_T error_ulp = (values[i] - expected[i]) / reference_value_ulp;
+
+        if (max_err < std::abs(error_ulp)) max_err = std::abs(error_ulp);
+    }
+    return max_err;
+}
+
+template<typename SCALAR_FLOAT_T>
+void printTrigResults(std::string resultPrefix, TrigResults<SCALAR_FLOAT_T> & result, TrigResults<float> & reference) {
+    std::cout << resultPrefix.c_str() << "\n"
+        << "    TAN: time:   " << (unsigned long long) result.time_tan.getAverage()
+        << ", dev: " << (unsigned long long) result.time_tan.getStdDev()
+        << " (speedup: " << result.time_tan.calculateSpeedup(reference.time_tan) << ") "
+        << "  Error:   " << result.max_err_tan << "\n"
+
+        << "    ATAN: time:  " << (unsigned long long) result.time_atan.getAverage()
+        << ", dev: " << (unsigned long long) result.time_atan.getStdDev()
+        << " (speedup: " << result.time_atan.calculateSpeedup(reference.time_atan) << ") "
+        << "  Error:   " << result.max_err_atan << "\n"
+
+        << "    ATAN2: time: " << (unsigned long long) result.time_atan2.getAverage()
+        << ", dev: " << (unsigned long long) result.time_atan2.getStdDev()
+        << " (speedup: " << result.time_atan2.calculateSpeedup(reference.time_atan2) << ") "
+        << "  Error:   " << result.max_err_atan2 << std::endl;
+}
+
 #include "sincos_scalar.h"
 #include "sincos_vdt.h"
+#include "trig_vdt.h"
 #include "sincos_ume.h"
 
 int main()
@@ -88,12 +153,12 @@ int main()
     double max_err_sin_d = 0.0, max_err_cos_d = 0.0;
 
 
-    std::cout << "The result is amount of time it takes to calculate sine and cosine of: " << ARRAY_SIZE << " elements.\n"
+    std::cout << "The result is amount of time it takes to calculate sine, cosine, tangent, arctangent and atan2 of: " << ARRAY_SIZE << " elements.\n"
         "All timing results in nanoseconds. \n"
         "Speedup calculated with scalar single precision floating point result as reference.\n"
         "VDT version used as a reference for auto-vectorization capabilities.\n"
         "SIMD version uses following operations: \n"
-        " SIN, COS, SINCOS\n\n";
+        " SIN, COS, SINCOS, masked SINCOS, TAN, ATAN, ATAN2\n\n";
 
     // ----------------------------------------
     // Benchmark using single precision.
@@ -144,6 +209,33 @@ int main()
     benchmarkUMESIMD_separate<float, 16>("SIMD code(16x32f) separate sin/cos: ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
     benchmarkUMESIMD_separate<float, 32>("SIMD code(32x32f) separate sin/cos: ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
 
+    // 5. Benchmark using UME::SIMD masked SINCOS functions.
+    benchmarkUMESIMD_masked<float, 1>("SIMD code(1x32f) masked sincos: ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
+    benchmarkUMESIMD_masked<float, 2>("SIMD code(2x32f) masked sincos: ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
+    benchmarkUMESIMD_masked<float, 4>("SIMD code(4x32f) masked sincos: ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
+    benchmarkUMESIMD_masked<float, 8>("SIMD code(8x32f) masked sincos: ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
+    benchmarkUMESIMD_masked<float, 16>("SIMD code(16x32f) masked sincos: ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
+    benchmarkUMESIMD_masked<float, 32>("SIMD code(32x32f) masked sincos: ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
+
+    // 6. Benchmark TAN/ATAN/ATAN2 using std, VDT and UME::SIMD functions.
+    TrigResults<float> trig_scalar_f, trig_vdt_f;
+    for (int i = 0; i < ITERATIONS; i++) {
+        trig_scalar_f.update_tan(test_tan_scalar<float>(ARRAY_SIZE));
+        trig_scalar_f.update_atan(test_atan_scalar<float>(ARRAY_SIZE));
+        trig_scalar_f.update_atan2(test_atan2_scalar<float>(ARRAY_SIZE));
+        trig_vdt_f.update_tan(test_tan_vdt_scalar<float>(ARRAY_SIZE));
+        trig_vdt_f.update_atan(test_atan_vdt_scalar<float>(ARRAY_SIZE));
+        trig_vdt_f.update_atan2(test_atan2_vdt_scalar<float>(ARRAY_SIZE));
+    }
+    printTrigResults("\nScalar code (float):", trig_scalar_f, trig_scalar_f);
+    printTrigResults("VDT code (float):", trig_vdt_f, trig_scalar_f);
+    benchmarkUMESIMD_trig<float, 1>("SIMD code(1x32f) :", ITERATIONS, ARRAY_SIZE, trig_scalar_f);
+    benchmarkUMESIMD_trig<float, 2>("SIMD code(2x32f) :", ITERATIONS, ARRAY_SIZE, trig_scalar_f);
+    benchmarkUMESIMD_trig<float, 4>("SIMD code(4x32f) :", ITERATIONS, ARRAY_SIZE, trig_scalar_f);
+    benchmarkUMESIMD_trig<float, 8>("SIMD code(8x32f) :", ITERATIONS, ARRAY_SIZE, trig_scalar_f);
+    benchmarkUMESIMD_trig<float, 16>("SIMD code(16x32f) :", ITERATIONS, ARRAY_SIZE, trig_scalar_f);
+    benchmarkUMESIMD_trig<float, 32>("SIMD code(32x32f) :", ITERATIONS, ARRAY_SIZE, trig_scalar_f);
+
     for (int i = 0; i < ITERATIONS; i++) {
         benchmark_results<double> res = test_sincos_scalar<double>(ARRAY_SIZE);
         if (max_err_sin_d < res.sin_error_ulp) max_err_sin_d = res.sin_error_ulp;
@@ -156,7 +248,7 @@ int main()
     // Scalar float used as a reference.
     // ----------------------------------------
 
-    // 5. Benchmark using std::sin/cos functions.
+    // 7. Benchmark using std::sin/cos functions.
     std::cout << "\nScalar code (double): " << (unsigned long long)stats_scalar_d.getAverage()
         << ", dev: " << (unsigned long long) stats_scalar_d.getStdDev()
         << " (speedup: " << stats_scalar_f.getAverage() / stats_scalar_d.getAverage() << ") "
@@ -172,26 +264,51 @@ int main()
         stats_scalar_vdt_d.update(res.elapsedTime);
     }
 
-    // 6. Benchmark using VDT sincos function. This version has been designed to auto-vectorize smoothly.
+    // 8. Benchmark using VDT sincos function. This version has been designed to auto-vectorize smoothly.
     std::cout << "VDT code (double): " << (unsigned long long)stats_scalar_vdt_d.getAverage()
         << ", dev: " << (unsigned long long) stats_scalar_vdt_d.getStdDev()
         << " (speedup: " << stats_scalar_f.getAverage() / stats_scalar_vdt_d.getAverage() << ") "
         << " Error sin: " << max_err_sin_d << " error cos: " << max_err_cos_d
         << std::endl;
 
-    // 7. Benchmark using UME::SIMD embedded SINCOS functions.
+    // 9. Benchmark using UME::SIMD embedded SINCOS functions.
     benchmarkUMESIMD<double, 1>("SIMD code(1x64f) :", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
     benchmarkUMESIMD<double, 2>("SIMD code(2x64f) :", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
     benchmarkUMESIMD<double, 4>("SIMD code(4x64f) :", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
     benchmarkUMESIMD<double, 8>("SIMD code(8x64f) :", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
     benchmarkUMESIMD<double, 16>("SIMD code(16x64f) :", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
 
-    // 8. Benchmark using UME::SIMD separate SIN/COS functions.
+    // 10. Benchmark using UME::SIMD separate SIN/COS functions.
     benchmarkUMESIMD_separate<double, 1>("SIMD code(1x64f) separate sin/cos: ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
     benchmarkUMESIMD_separate<double, 2>("SIMD code(2x64f) separate sin/cos: ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
     benchmarkUMESIMD_separate<double, 4>("SIMD code(4x64f) separate sin/cos: ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
     benchmarkUMESIMD_separate<double, 8>("SIMD code(8x64f) separate sin/cos: ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
     benchmarkUMESIMD_separate<double, 16>("SIMD code(16x64f) separate sin/cos: ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
 
+    // 11. Benchmark using UME::SIMD masked SINCOS functions.
+    benchmarkUMESIMD_masked<double, 1>("SIMD code(1x64f) masked sincos: ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
+    benchmarkUMESIMD_masked<double, 2>("SIMD code(2x64f) masked sincos: ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
+    benchmarkUMESIMD_masked<double, 4>("SIMD code(4x64f) masked sincos: ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
+    benchmarkUMESIMD_masked<double, 8>("SIMD code(8x64f) masked sincos: ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
+    benchmarkUMESIMD_masked<double, 16>("SIMD code(16x64f) masked sincos: ", ITERATIONS, ARRAY_SIZE, stats_scalar_f);
+
+    // 12. Benchmark TAN/ATAN/ATAN2 using std, VDT and UME::SIMD functions.
+    TrigResults<double> trig_scalar_d, trig_vdt_d;
+    for (int i = 0; i < ITERATIONS; i++) {
+        trig_scalar_d.update_tan(test_tan_scalar<double>(ARRAY_SIZE));
+        trig_scalar_d.update_atan(test_atan_scalar<double>(ARRAY_SIZE));
+        trig_scalar_d.update_atan2(test_atan2_scalar<double>(ARRAY_SIZE));
+        trig_vdt_d.update_tan(test_tan_vdt_scalar<double>(ARRAY_SIZE));
+        trig_vdt_d.update_atan(test_atan_vdt_scalar<double>(ARRAY_SIZE));
+        trig_vdt_d.update_atan2(test_atan2_vdt_scalar<double>(ARRAY_SIZE));
+    }
+    printTrigResults("\nScalar code (double):", trig_scalar_d, trig_scalar_f);
+    printTrigResults("VDT code (double):", trig_vdt_d, trig_scalar_f);
+    benchmarkUMESIMD_trig<double, 1>("SIMD code(1x64f) :", ITERATIONS, ARRAY_SIZE, trig_scalar_f);
+    benchmarkUMESIMD_trig<double, 2>("SIMD code(2x64f) :", ITERATIONS, ARRAY_SIZE, trig_scalar_f);
+    benchmarkUMESIMD_trig<double, 4>("SIMD code(4x64f) :", ITERATIONS, ARRAY_SIZE, trig_scalar_f);
+    benchmarkUMESIMD_trig<double, 8>("SIMD code(8x64f) :", ITERATIONS, ARRAY_SIZE, trig_scalar_f);
+    benchmarkUMESIMD_trig<double, 16>("SIMD code(16x64f) :", ITERATIONS, ARRAY_SIZE, trig_scalar_f);
+
     return 0;
 }
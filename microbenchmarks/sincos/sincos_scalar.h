@@ -105,4 +105,127 @@ benchmark_results<SCALAR_FLOAT_T> test_sincos_scalar(int ARRAY_SIZE)
     return result;
 }
 
+// Kernel for benchmarking using std::tan function calls.
+template<typename SCALAR_FLOAT_T>
+trig_results<SCALAR_FLOAT_T> test_tan_scalar(int ARRAY_SIZE)
+{
+    unsigned long long start, end;    // Time measurements
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    const int LEN = ARRAY_SIZE;
+    SCALAR_FLOAT_T *inputA = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *output = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *values = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+
+    std::uniform_real_distribution<SCALAR_FLOAT_T> dist(-5 * SCALAR_FLOAT_T(M_PI), 5 * SCALAR_FLOAT_T(M_PI));
+
+    for (int i = 0; i < LEN; i++) {
+        inputA[i] = dist(gen);
+        output[i] = std::tan(inputA[i]);
+    }
+
+    start = get_timestamp();
+
+    for (int i = 0; i < LEN; i++) {
+        values[i] = std::tan(inputA[i]);
+    }
+
+    end = get_timestamp();
+
+    trig_results<SCALAR_FLOAT_T> result;
+    result.elapsedTime = end - start;
+    result.error_ulp = calculate_max_error_ulp(values, output, LEN);
+
+    UME::DynamicMemory::AlignedFree(inputA);
+    UME::DynamicMemory::AlignedFree(output);
+    UME::DynamicMemory::AlignedFree(values);
+
+    return result;
+}
+
+// Kernel for benchmarking using std::atan function calls.
+template<typename SCALAR_FLOAT_T>
+trig_results<SCALAR_FLOAT_T> test_atan_scalar(int ARRAY_SIZE)
+{
+    unsigned long long start, end;    // Time measurements
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    const int LEN = ARRAY_SIZE;
+    SCALAR_FLOAT_T *inputA = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *output = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *values = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+
+    std::uniform_real_distribution<SCALAR_FLOAT_T> dist(SCALAR_FLOAT_T(-100.0), SCALAR_FLOAT_T(100.0));
+
+    for (int i = 0; i < LEN; i++) {
+        inputA[i] = dist(gen);
+        output[i] = std::atan(inputA[i]);
+    }
+
+    start = get_timestamp();
+
+    for (int i = 0; i < LEN; i++) {
+        values[i] = std::atan(inputA[i]);
+    }
+
+    end = get_timestamp();
+
+    trig_results<SCALAR_FLOAT_T> result;
+    result.elapsedTime = end - start;
+    result.error_ulp = calculate_max_error_ulp(values, output, LEN);
+
+    UME::DynamicMemory::AlignedFree(inputA);
+    UME::DynamicMemory::AlignedFree(output);
+    UME::DynamicMemory::AlignedFree(values);
+
+    return result;
+}
+
+// Kernel for benchmarking using std::atan2 function calls.
+template<typename SCALAR_FLOAT_T>
+trig_results<SCALAR_FLOAT_T> test_atan2_scalar(int ARRAY_SIZE)
+{
+    unsigned long long start, end;    // Time measurements
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    const int LEN = ARRAY_SIZE;
+    SCALAR_FLOAT_T *inputA = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *inputB = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *output = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *values = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+
+    std::uniform_real_distribution<SCALAR_FLOAT_T> dist(SCALAR_FLOAT_T(-10.0), SCALAR_FLOAT_T(10.0));
+
+    for (int i = 0; i < LEN; i++) {
+        inputA[i] = dist(gen);
+        inputB[i] = dist(gen);
+        output[i] = std::atan2(inputA[i], inputB[i]);
+    }
+
+    start = get_timestamp();
+
+    for (int i = 0; i < LEN; i++) {
+        values[i] = std::atan2(inputA[i], inputB[i]);
+    }
+
+    end = get_timestamp();
+
+    trig_results<SCALAR_FLOAT_T> result;
+    result.elapsedTime = end - start;
+    result.error_ulp = calculate_max_error_ulp(values, output, LEN);
+
+    UME::DynamicMemory::AlignedFree(inputA);
+    UME::DynamicMemory::AlignedFree(inputB);
+    UME::DynamicMemory::AlignedFree(output);
+    UME::DynamicMemory::AlignedFree(values);
+
+    return result;
+}
+
 #endif
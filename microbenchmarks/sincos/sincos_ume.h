@@ -114,6 +114,81 @@ benchmark_results<SCALAR_FLOAT_T> test_sincos_ume(int ARRAY_SIZE)
     return result;
 }
 
+// Kernel for benchmarking using masked SINCOS function. Only lanes with
+// positive arguments are evaluated, remaining lanes keep the input value.
+template<typename SCALAR_FLOAT_T, int VEC_LEN>
+benchmark_results<SCALAR_FLOAT_T> test_sincos_ume_masked(int ARRAY_SIZE)
+{
+    SIMDVec<SCALAR_FLOAT_T, VEC_LEN> x;
+    SIMDVec<SCALAR_FLOAT_T, VEC_LEN> y_sin;
+    SIMDVec<SCALAR_FLOAT_T, VEC_LEN> y_cos;
+    SIMDVecMask<VEC_LEN> mask;
+
+    unsigned long long start, end;    // Time measurements
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    const int LEN = ARRAY_SIZE;
+    SCALAR_FLOAT_T *inputA = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *output_sin = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *output_cos = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *values_sin = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *values_cos = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+
+    std::uniform_real_distribution<SCALAR_FLOAT_T> dist(-5 * SCALAR_FLOAT_T(M_PI), 5 * SCALAR_FLOAT_T(M_PI));
+
+    for (int i = 0; i < LEN; i++) {
+        inputA[i] = dist(gen);
+        output_sin[i] = inputA[i] > 0 ? std::sin(inputA[i]) : inputA[i];
+        output_cos[i] = inputA[i] > 0 ? std::cos(inputA[i]) : inputA[i];
+    }
+
+    start = get_timestamp();
+
+    for (int i = 0; i < LEN; i += VEC_LEN) {
+        x.load(&inputA[i]);
+        mask = x > SCALAR_FLOAT_T(0);
+
+        x.sincos(mask, y_sin, y_cos);
+
+        y_sin.store(&values_sin[i]);
+        y_cos.store(&values_cos[i]);
+    }
+
+    end = get_timestamp();
+
+    SCALAR_FLOAT_T max_sin_err = 0;
+    SCALAR_FLOAT_T max_cos_err = 0;
+
+    for (int i = 0; i < LEN; i++) {
+        SCALAR_FLOAT_T next = NEXT_AFTER(values_sin[i], HUGE_VALUE<SCALAR_FLOAT_T>());
+        SCALAR_FLOAT_T reference_value_ulp = std::abs(next - values_sin[i]);
+        SCALAR_FLOAT_T error_ulp = (values_sin[i] - output_sin[i]) / reference_value_ulp;
+
+        if (max_sin_err < std::abs(error_ulp)) max_sin_err = std::abs(error_ulp);
+
+        next = NEXT_AFTER(values_cos[i], HUGE_VALUE<SCALAR_FLOAT_T>());
+        reference_value_ulp = std::abs(next - values_cos[i]);
+        error_ulp = (values_cos[i] - output_cos[i]) / reference_value_ulp;
+
+        if (max_cos_err < std::abs(error_ulp)) max_cos_err = std::abs(error_ulp);
+    }
+
+    benchmark_results<SCALAR_FLOAT_T> result;
+    result.elapsedTime = end - start;
+    result.sin_error_ulp = max_sin_err;
+    result.cos_error_ulp = max_cos_err;
+
+    UME::DynamicMemory::AlignedFree(inputA);
+    UME::DynamicMemory::AlignedFree(output_sin);
+    UME::DynamicMemory::AlignedFree(output_cos);
+    UME::DynamicMemory::AlignedFree(values_sin);
+    UME::DynamicMemory::AlignedFree(values_cos);
+
+    return result;
+}
+
 // Kernel for benchmarking using separate SIN/COS functions.
 template<typename SCALAR_FLOAT_T, int VEC_LEN>
 benchmark_results<SCALAR_FLOAT_T> test_sincos_ume_separate(int ARRAY_SIZE)
@@ -222,6 +297,33 @@ void benchmarkUMESIMD(std::string resultPrefix, int iterations, int array_size,
         << std::endl;
 }
 
+// Benchmark using masked SINCOS function call.
+template<typename SCALAR_FLOAT_T, int VEC_LEN>
+void benchmarkUMESIMD_masked(std::string resultPrefix, int iterations, int array_size, TimingStatistics & reference)
+{
+    TimingStatistics stats;
+    benchmark_results<SCALAR_FLOAT_T> result;
+    SCALAR_FLOAT_T max_err_sin = 0, max_err_cos = 0;
+
+    for (int i = 0; i < iterations; i++)
+    {
+        result = test_sincos_ume_masked<SCALAR_FLOAT_T, VEC_LEN>(array_size);
+        if (max_err_sin < result.sin_error_ulp) max_err_sin = result.sin_error_ulp;
+        if (max_err_cos < result.cos_error_ulp) max_err_cos = result.cos_error_ulp;
+
+        stats.update(result.elapsedTime);
+    }
+
+    std::cout << resultPrefix.c_str() << (unsigned long long) stats.getAverage()
+        << ", dev: " << (unsigned long long) stats.getStdDev()
+        << ", 90% confidence: " << (unsigned long long) stats.confidence90()
+        << ", 95% confidence: " << (unsigned long long) stats.confidence95()
+        << " (speedup: "
+        << stats.calculateSpeedup(reference) << ")"
+        << " Error sin: " << max_err_sin << " error cos: " << max_err_cos
+        << std::endl;
+}
+
 // Benchmark using separate SIN/COS function calls.
 template<typename SCALAR_FLOAT_T, int VEC_LEN>
 void benchmarkUMESIMD_separate(std::string resultPrefix, int iterations, int array_size, TimingStatistics & reference)
@@ -249,4 +351,159 @@ void benchmarkUMESIMD_separate(std::string resultPrefix, int iterations, int arr
         << std::endl;
 }
 
+// Kernel for benchmarking using TAN function.
+template<typename SCALAR_FLOAT_T, int VEC_LEN>
+trig_results<SCALAR_FLOAT_T> test_tan_ume(int ARRAY_SIZE)
+{
+    SIMDVec<SCALAR_FLOAT_T, VEC_LEN> x;
+    SIMDVec<SCALAR_FLOAT_T, VEC_LEN> y;
+
+    unsigned long long start, end;    // Time measurements
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    const int LEN = ARRAY_SIZE;
+    SCALAR_FLOAT_T *inputA = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *output = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *values = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+
+    std::uniform_real_distribution<SCALAR_FLOAT_T> dist(-5 * SCALAR_FLOAT_T(M_PI), 5 * SCALAR_FLOAT_T(M_PI));
+
+    for (int i = 0; i < LEN; i++) {
+        inputA[i] = dist(gen);
+        output[i] = std::tan(inputA[i]);
+    }
+
+    start = get_timestamp();
+
+    for (int i = 0; i < LEN; i += VEC_LEN) {
+        x.load(&inputA[i]);
+        y = x.tan();
+        y.store(&values[i]);
+    }
+
+    end = get_timestamp();
+
+    trig_results<SCALAR_FLOAT_T> result;
+    result.elapsedTime = end - start;
+    result.error_ulp = calculate_max_error_ulp(values, output, LEN);
+
+    UME::DynamicMemory::AlignedFree(inputA);
+    UME::DynamicMemory::AlignedFree(output);
+    UME::DynamicMemory::AlignedFree(values);
+
+    return result;
+}
+
+// Kernel for benchmarking using ATAN function.
+template<typename SCALAR_FLOAT_T, int VEC_LEN>
+trig_results<SCALAR_FLOAT_T> test_atan_ume(int ARRAY_SIZE)
+{
+    SIMDVec<SCALAR_FLOAT_T, VEC_LEN> x;
+    SIMDVec<SCALAR_FLOAT_T, VEC_LEN> y;
+
+    unsigned long long start, end;    // Time measurements
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    const int LEN = ARRAY_SIZE;
+    SCALAR_FLOAT_T *inputA = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *output = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *values = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+
+    std::uniform_real_distribution<SCALAR_FLOAT_T> dist(SCALAR_FLOAT_T(-100.0), SCALAR_FLOAT_T(100.0));
+
+    for (int i = 0; i < LEN; i++) {
+        inputA[i] = dist(gen);
+        output[i] = std::atan(inputA[i]);
+    }
+
+    start = get_timestamp();
+
+    for (int i = 0; i < LEN; i += VEC_LEN) {
+        x.load(&inputA[i]);
+        y = x.atan();
+        y.store(&values[i]);
+    }
+
+    end = get_timestamp();
+
+    trig_results<SCALAR_FLOAT_T> result;
+    result.elapsedTime = end - start;
+    result.error_ulp = calculate_max_error_ulp(values, output, LEN);
+
+    UME::DynamicMemory::AlignedFree(inputA);
+    UME::DynamicMemory::AlignedFree(output);
+    UME::DynamicMemory::AlignedFree(values);
+
+    return result;
+}
+
+// Kernel for benchmarking using ATAN2 function.
+template<typename SCALAR_FLOAT_T, int VEC_LEN>
+trig_results<SCALAR_FLOAT_T> test_atan2_ume(int ARRAY_SIZE)
+{
+    SIMDVec<SCALAR_FLOAT_T, VEC_LEN> x;
+    SIMDVec<SCALAR_FLOAT_T, VEC_LEN> y;
+
+    unsigned long long start, end;    // Time measurements
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    const int LEN = ARRAY_SIZE;
+    SCALAR_FLOAT_T *inputA = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *inputB = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *output = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *values = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+
+    std::uniform_real_distribution<SCALAR_FLOAT_T> dist(SCALAR_FLOAT_T(-10.0), SCALAR_FLOAT_T(10.0));
+
+    for (int i = 0; i < LEN; i++) {
+        inputA[i] = dist(gen);
+        inputB[i] = dist(gen);
+        output[i] = std::atan2(inputA[i], inputB[i]);
+    }
+
+    start = get_timestamp();
+
+    for (int i = 0; i < LEN; i += VEC_LEN) {
+        x.load(&inputA[i]);
+        y.load(&inputB[i]);
+        y = x.atan2(y);
+        y.store(&values[i]);
+    }
+
+    end = get_timestamp();
+
+    trig_results<SCALAR_FLOAT_T> result;
+    result.elapsedTime = end - start;
+    result.error_ulp = calculate_max_error_ulp(values, output, LEN);
+
+    UME::DynamicMemory::AlignedFree(inputA);
+    UME::DynamicMemory::AlignedFree(inputB);
+    UME::DynamicMemory::AlignedFree(output);
+    UME::DynamicMemory::AlignedFree(values);
+
+    return result;
+}
+
+// Benchmark using TAN, ATAN and ATAN2 function calls.
+template<typename SCALAR_FLOAT_T, int VEC_LEN>
+void benchmarkUMESIMD_trig(std::string resultPrefix, int iterations, int array_size, TrigResults<float> & reference)
+{
+    TrigResults<SCALAR_FLOAT_T> result;
+
+    for (int i = 0; i < iterations; i++)
+    {
+        result.update_tan(test_tan_ume<SCALAR_FLOAT_T, VEC_LEN>(array_size));
+        result.update_atan(test_atan_ume<SCALAR_FLOAT_T, VEC_LEN>(array_size));
+        result.update_atan2(test_atan2_ume<SCALAR_FLOAT_T, VEC_LEN>(array_size));
+    }
+
+    printTrigResults(resultPrefix, result, reference);
+}
+
 #endif
@@ -0,0 +1,406 @@
+//
+// This piece of code is based on tan.h, atan.h and atan2.h from
+// https://svnweb.cern.ch/trac/vdt. This code is not a part of UME::SIMD
+// library code and is used purely for performance measurement reference.
+//
+// Modifications have been made to original files to fit them for benchmarking
+// of UME::SIMD.
+
+/*
+ * The basic idea is to exploit Pade polynomials.
+ * A lot of ideas were inspired by the cephes math library (by Stephen L. Moshier
+ * moshier@na-net.ornl.gov) as well as actual code.
+ * The Cephes library can be found here:  http://www.netlib.org/cephes/
+ */
+
+/*
+ * VDT is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRIG_VDT_H_
+#define TRIG_VDT_H_
+
+#include "sincos_vdt.h"
+
+namespace vdt{
+
+namespace details{
+
+const double PX1tan = -1.30936939181383777646E4;
+const double PX2tan = 1.15351664838587416140E6;
+const double PX3tan = -1.79565251976484877988E7;
+
+const double QX1tan = 1.36812963470692954678E4;
+const double QX2tan = -1.32089234440210967447E6;
+const double QX3tan = 2.50083801823357915839E7;
+const double QX4tan = -5.38695755929454629881E7;
+
+const double PX1atan = -8.750608600031904122785E-1;
+const double PX2atan = -1.615753718733365076637E1;
+const double PX3atan = -7.500855792314704667340E1;
+const double PX4atan = -1.228866684490136173410E2;
+const double PX5atan = -6.485021904942025371773E1;
+
+const double QX1atan = 2.485846490142306297962E1;
+const double QX2atan = 1.650270098316988542046E2;
+const double QX3atan = 4.328810604912902668951E2;
+const double QX4atan = 4.853903996359136964868E2;
+const double QX5atan = 1.945506571482613964425E2;
+
+const double T3PO8 = 2.41421356237309504880;
+const double MOREBITS = 6.123233995736765886130E-17;
+const double MOREBITSO2 = MOREBITS * 0.5;
+const double PIO2_D = 1.57079632679489661923;
+const double PIO4_D = 7.85398163397448309616E-1;
+const double PI_D = 3.14159265358979323846;
+
+const float T3PO8F = 2.414213562373095f;
+const float TPO8F = 0.4142135623730950f;
+const float PIO2F = 1.5707963267948966192f;
+const float PIO4F = 0.7853981633974483096f;
+const float PIF = 3.14159265358979323846f;
+
+//------------------------------------------------------------------------------
+
+inline double get_atan_px(const double x2){
+    double px = PX1atan;
+    px *= x2;
+    px += PX2atan;
+    px *= x2;
+    px += PX3atan;
+    px *= x2;
+    px += PX4atan;
+    px *= x2;
+    px += PX5atan;
+    return px;
+}
+
+//------------------------------------------------------------------------------
+
+inline double get_atan_qx(const double x2){
+    double qx = x2;
+    qx += QX1atan;
+    qx *= x2;
+    qx += QX2atan;
+    qx *= x2;
+    qx += QX3atan;
+    qx *= x2;
+    qx += QX4atan;
+    qx *= x2;
+    qx += QX5atan;
+    return qx;
+}
+
+//------------------------------------------------------------------------------
+/// Arctangent for 0 <= x, without the sign handling
+inline double fast_atan_positive(double x){
+    double y = 0.0;
+    double morebits = 0.0;
+    if (x > T3PO8) {
+        y = PIO2_D;
+        morebits = MOREBITS;
+        x = -1.0 / x;
+    }
+    else if (x > 0.66) {
+        y = PIO4_D;
+        morebits = MOREBITSO2;
+        x = (x - 1.0) / (x + 1.0);
+    }
+    const double x2 = x * x;
+    return y + (x + x * x2 * get_atan_px(x2) / get_atan_qx(x2) + morebits);
+}
+
+//------------------------------------------------------------------------------
+/// Arctangent for 0 <= x, without the sign handling
+inline float fast_atanf_positive(float x){
+    float y = 0.0f;
+    if (x > T3PO8F) {
+        y = PIO2F;
+        x = -1.0f / x;
+    }
+    else if (x > TPO8F) {
+        y = PIO4F;
+        x = (x - 1.0f) / (x + 1.0f);
+    }
+    const float z = x * x;
+    return y + ((((8.05374449538e-2f * z
+        - 1.38776856032E-1f) * z
+        + 1.99777106478E-1f) * z
+        - 3.33329491539E-1f) * z * x
+        + x);
+}
+
+} // End namespace details
+
+//------------------------------------------------------------------------------
+/// Double precision tangent, Cephes Pade approximation
+inline double fast_tan(double x){
+    int32_t quad = 0;
+    const double z = details::reduce2quadrant(x, quad);
+    const double zz = z * z;
+
+    double px = details::PX1tan;
+    px *= zz;
+    px += details::PX2tan;
+    px *= zz;
+    px += details::PX3tan;
+
+    double qx = zz;
+    qx += details::QX1tan;
+    qx *= zz;
+    qx += details::QX2tan;
+    qx *= zz;
+    qx += details::QX3tan;
+    qx *= zz;
+    qx += details::QX4tan;
+
+    double res = z + z * zz * px / qx;
+
+    // Odd octants: tan(x) = -1/tan(x - PI/2)
+    if (quad & 2) res = -1.0 / res;
+    return x < 0.0 ? -res : res;
+}
+
+//------------------------------------------------------------------------------
+/// Single precision tangent
+inline float fast_tanf(float x){
+    int32_t quad = 0;
+    const float z = details::reduce2quadrant(x, quad);
+    const float zz = z * z;
+
+    float res = (((((9.38540185543E-3f * zz
+        + 3.11992232697E-3f) * zz
+        + 2.44301354525E-2f) * zz
+        + 5.34112807005E-2f) * zz
+        + 1.33387994085E-1f) * zz
+        + 3.33331568548E-1f) * zz * z
+        + z;
+
+    if (quad & 2) res = -1.0f / res;
+    return x < 0.0f ? -res : res;
+}
+
+//------------------------------------------------------------------------------
+/// Double precision arctangent
+inline double fast_atan(double x){
+    const double res = details::fast_atan_positive(std::fabs(x));
+    return x < 0.0 ? -res : res;
+}
+
+//------------------------------------------------------------------------------
+/// Single precision arctangent
+inline float fast_atanf(float x){
+    const float res = details::fast_atanf_positive(std::fabs(x));
+    return x < 0.0f ? -res : res;
+}
+
+//------------------------------------------------------------------------------
+/// Double precision atan2: move to the first octant, then reconstruct.
+inline double fast_atan2(double y, double x){
+    double xx = std::fabs(x);
+    double yy = std::fabs(y);
+    const bool swap = yy > xx;
+    if (swap) {
+        const double tmp = xx;
+        xx = yy;
+        yy = tmp;
+    }
+    double res = xx == 0.0 ? 0.0 : details::fast_atan_positive(yy / xx);
+    if (swap) res = details::PIO2_D - res;
+    if (x < 0.0) res = details::PI_D - res;
+    return y < 0.0 ? -res : res;
+}
+
+//------------------------------------------------------------------------------
+/// Single precision atan2
+inline float fast_atan2f(float y, float x){
+    float xx = std::fabs(x);
+    float yy = std::fabs(y);
+    const bool swap = yy > xx;
+    if (swap) {
+        const float tmp = xx;
+        xx = yy;
+        yy = tmp;
+    }
+    float res = xx == 0.0f ? 0.0f : details::fast_atanf_positive(yy / xx);
+    if (swap) res = details::PIO2F - res;
+    if (x < 0.0f) res = details::PIF - res;
+    return y < 0.0f ? -res : res;
+}
+
+} // end namespace vdt
+
+template<typename SCALAR_FLOAT_T>
+inline SCALAR_FLOAT_T call_tan_vdt(SCALAR_FLOAT_T const x);
+
+template<>
+inline float call_tan_vdt<float>(float const x) {
+    return vdt::fast_tanf(x);
+}
+
+template<>
+inline double call_tan_vdt<double>(double const x) {
+    return vdt::fast_tan(x);
+}
+
+template<typename SCALAR_FLOAT_T>
+inline SCALAR_FLOAT_T call_atan_vdt(SCALAR_FLOAT_T const x);
+
+template<>
+inline float call_atan_vdt<float>(float const x) {
+    return vdt::fast_atanf(x);
+}
+
+template<>
+inline double call_atan_vdt<double>(double const x) {
+    return vdt::fast_atan(x);
+}
+
+template<typename SCALAR_FLOAT_T>
+inline SCALAR_FLOAT_T call_atan2_vdt(SCALAR_FLOAT_T const y, SCALAR_FLOAT_T const x);
+
+template<>
+inline float call_atan2_vdt<float>(float const y, float const x) {
+    return vdt::fast_atan2f(y, x);
+}
+
+template<>
+inline double call_atan2_vdt<double>(double const y, double const x) {
+    return vdt::fast_atan2(y, x);
+}
+
+// Kernel for benchmarking using VDT fast_tan function.
+template<typename SCALAR_FLOAT_T>
+trig_results<SCALAR_FLOAT_T> test_tan_vdt_scalar(int ARRAY_SIZE)
+{
+    unsigned long long start, end;    // Time measurements
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    const int LEN = ARRAY_SIZE;
+    SCALAR_FLOAT_T *inputA = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *output = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *values = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+
+    std::uniform_real_distribution<SCALAR_FLOAT_T> dist(-5 * SCALAR_FLOAT_T(M_PI), 5 * SCALAR_FLOAT_T(M_PI));
+
+    for (int i = 0; i < LEN; i++) {
+        inputA[i] = dist(gen);
+        output[i] = std::tan(inputA[i]);
+    }
+
+    start = get_timestamp();
+
+    for (int i = 0; i < LEN; i++) {
+        values[i] = call_tan_vdt<SCALAR_FLOAT_T>(inputA[i]);
+    }
+
+    end = get_timestamp();
+
+    trig_results<SCALAR_FLOAT_T> result;
+    result.elapsedTime = end - start;
+    result.error_ulp = calculate_max_error_ulp(values, output, LEN);
+
+    UME::DynamicMemory::AlignedFree(inputA);
+    UME::DynamicMemory::AlignedFree(output);
+    UME::DynamicMemory::AlignedFree(values);
+
+    return result;
+}
+
+// Kernel for benchmarking using VDT fast_atan function.
+template<typename SCALAR_FLOAT_T>
+trig_results<SCALAR_FLOAT_T> test_atan_vdt_scalar(int ARRAY_SIZE)
+{
+    unsigned long long start, end;    // Time measurements
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    const int LEN = ARRAY_SIZE;
+    SCALAR_FLOAT_T *inputA = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *output = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *values = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+
+    std::uniform_real_distribution<SCALAR_FLOAT_T> dist(SCALAR_FLOAT_T(-100.0), SCALAR_FLOAT_T(100.0));
+
+    for (int i = 0; i < LEN; i++) {
+        inputA[i] = dist(gen);
+        output[i] = std::atan(inputA[i]);
+    }
+
+    start = get_timestamp();
+
+    for (int i = 0; i < LEN; i++) {
+        values[i] = call_atan_vdt<SCALAR_FLOAT_T>(inputA[i]);
+    }
+
+    end = get_timestamp();
+
+    trig_results<SCALAR_FLOAT_T> result;
+    result.elapsedTime = end - start;
+    result.error_ulp = calculate_max_error_ulp(values, output, LEN);
+
+    UME::DynamicMemory::AlignedFree(inputA);
+    UME::DynamicMemory::AlignedFree(output);
+    UME::DynamicMemory::AlignedFree(values);
+
+    return result;
+}
+
+// Kernel for benchmarking using VDT fast_atan2 function.
+template<typename SCALAR_FLOAT_T>
+trig_results<SCALAR_FLOAT_T> test_atan2_vdt_scalar(int ARRAY_SIZE)
+{
+    unsigned long long start, end;    // Time measurements
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    const int LEN = ARRAY_SIZE;
+    SCALAR_FLOAT_T *inputA = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *inputB = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *output = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+    SCALAR_FLOAT_T *values = (SCALAR_FLOAT_T *) UME::DynamicMemory::AlignedMalloc(ARRAY_SIZE*sizeof(SCALAR_FLOAT_T), sizeof(SCALAR_FLOAT_T));
+
+    std::uniform_real_distribution<SCALAR_FLOAT_T> dist(SCALAR_FLOAT_T(-10.0), SCALAR_FLOAT_T(10.0));
+
+    for (int i = 0; i < LEN; i++) {
+        inputA[i] = dist(gen);
+        inputB[i] = dist(gen);
+        output[i] = std::atan2(inputA[i], inputB[i]);
+    }
+
+    start = get_timestamp();
+
+    for (int i = 0; i < LEN; i++) {
+        values[i] = call_atan2_vdt<SCALAR_FLOAT_T>(inputA[i], inputB[i]);
+    }
+
+    end = get_timestamp();
+
+    trig_results<SCALAR_FLOAT_T> result;
+    result.elapsedTime = end - start;
+    result.error_ulp = calculate_max_error_ulp(values, output, LEN);
+
+    UME::DynamicMemory::AlignedFree(inputA);
+    UME::DynamicMemory::AlignedFree(inputB);
+    UME::DynamicMemory::AlignedFree(output);
+    UME::DynamicMemory::AlignedFree(values);
+
+    return result;
+}
+
+#endif
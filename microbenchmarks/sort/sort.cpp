@@ -0,0 +1,140 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <algorithm>
+#include <random>
+
+#include "../../UMESimd.h"
+#include "../../UMESimdSort.h"
+#include "../utilities/TimingStatistics.h"
+
+// Sorts arrays of 1K to 100M random elements with std::sort and with
+// UME::SIMD::sort, the vectorized quicksort. Every measurement sorts a fresh
+// copy of the same random input, and the result is compared with the output
+// of std::sort.
+
+const uint64_t MIN_SIZE = 1000;
+const uint64_t MAX_SIZE = 100000000;
+// Number of elements sorted for every size, split between measurements.
+const uint64_t ELEMENTS_PER_SIZE = 20000000;
+
+template<typename SCALAR_T>
+UME_NEVER_INLINE void sort_scalar(SCALAR_T * data, uint64_t count) {
+    std::sort(data, data + count);
+}
+
+template<uint32_t VEC_LEN, typename SCALAR_T>
+UME_NEVER_INLINE void sort_simd(SCALAR_T * data, uint64_t count) {
+    UME::SIMD::sort<VEC_LEN>(data, count);
+}
+
+template<typename SCALAR_T, typename FUNC_T>
+TimingStatistics measure(
+    FUNC_T func,
+    SCALAR_T const * input,
+    SCALAR_T * work,
+    SCALAR_T const * reference,
+    uint64_t count)
+{
+    TimingStatistics stats;
+    uint64_t measurements = std::max<uint64_t>(1, ELEMENTS_PER_SIZE / count);
+    for (uint64_t m = 0; m < measurements; m++) {
+        std::copy(input, input + count, work);
+        unsigned long long start = get_timestamp();
+        func(work, count);
+        unsigned long long end = get_timestamp();
+        stats.update(end - start);
+    }
+    if (reference != NULL && !std::equal(work, work + count, reference)) {
+        std::cout << "Result invalid!\n";
+    }
+    return stats;
+}
+
+template<typename SCALAR_T>
+SCALAR_T randomValue(std::mt19937_64 & gen) {
+    return SCALAR_T(gen());
+}
+
+template<>
+float randomValue<float>(std::mt19937_64 & gen) {
+    return std::uniform_real_distribution<float>(-1.0e6f, 1.0e6f)(gen);
+}
+
+template<uint32_t VEC_LEN, typename SCALAR_T>
+void benchmark(char const * name) {
+    std::mt19937_64 gen(0);
+    SCALAR_T * input = new SCALAR_T[MAX_SIZE];
+    SCALAR_T * work = new SCALAR_T[MAX_SIZE];
+    SCALAR_T * reference = new SCALAR_T[MAX_SIZE];
+    for (uint64_t i = 0; i < MAX_SIZE; i++) {
+        input[i] = randomValue<SCALAR_T>(gen);
+    }
+
+    for (uint64_t count = MIN_SIZE; count <= MAX_SIZE; count *= 10) {
+        TimingStatistics scalar = measure(sort_scalar<SCALAR_T>, input, reference, (SCALAR_T*)NULL, count);
+        TimingStatistics simd = measure(sort_simd<VEC_LEN, SCALAR_T>, input, work, reference, count);
+
+        std::cout << std::setw(12) << name << std::setw(12) << count
+            << std::fixed << std::setprecision(3)
+            << std::setw(14) << scalar.getAverage() / 1.0e6
+            << std::setw(14) << simd.getAverage() / 1.0e6
+            << std::setprecision(2)
+            << std::setw(12) << simd.calculateSpeedup(scalar) << "\n";
+    }
+
+    delete[] input;
+    delete[] work;
+    delete[] reference;
+}
+
+int main()
+{
+    std::cout << "The result is the average time (ms) of sorting an array of random\n"
+        "elements. Speedups are calculated against std::sort.\n\n";
+
+    std::cout << std::setw(12) << "vector"
+        << std::setw(12) << "elements"
+        << std::setw(14) << "std::sort"
+        << std::setw(14) << "SIMD sort"
+        << std::setw(12) << "speedup" << "\n";
+
+    benchmark<8, float>("SIMD8_32f");
+    benchmark<16, float>("SIMD16_32f");
+    benchmark<8, int32_t>("SIMD8_32i");
+    benchmark<16, int32_t>("SIMD16_32i");
+    benchmark<4, int64_t>("SIMD4_64i");
+    benchmark<8, int64_t>("SIMD8_64i");
+
+    return 0;
+}
@@ -118,6 +118,34 @@ namespace SIMD
 }
 }
 
+// GCC 12 folds the 256-bit BLENDV intrinsics into a sign test on an integer
+// vector. AVX has no 256-bit integer compare, so the folded blend is expanded
+// lane by lane, with a branch per lane. For that compiler blend the two
+// 128-bit halves instead; this keeps the sign-bit semantics of BLENDV.
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__INTEL_COMPILER) && (__GNUC__ >= 12)
+namespace UME
+{
+namespace SIMD
+{
+    UME_FORCE_INLINE __m256 blendv_ps_avx(__m256 a, __m256 b, __m256 mask) {
+        __m128 t0 = _mm_blendv_ps(_mm256_castps256_ps128(a), _mm256_castps256_ps128(b), _mm256_castps256_ps128(mask));
+        __m128 t1 = _mm_blendv_ps(_mm256_extractf128_ps(a, 1), _mm256_extractf128_ps(b, 1), _mm256_extractf128_ps(mask, 1));
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(t0), t1, 1);
+    }
+    UME_FORCE_INLINE __m256d blendv_pd_avx(__m256d a, __m256d b, __m256d mask) {
+        __m128d t0 = _mm_blendv_pd(_mm256_castpd256_pd128(a), _mm256_castpd256_pd128(b), _mm256_castpd256_pd128(mask));
+        __m128d t1 = _mm_blendv_pd(_mm256_extractf128_pd(a, 1), _mm256_extractf128_pd(b, 1), _mm256_extractf128_pd(mask, 1));
+        return _mm256_insertf128_pd(_mm256_castpd128_pd256(t0), t1, 1);
+    }
+}
+}
+#define UME_MM256_BLENDV_PS(a, b, mask) UME::SIMD::blendv_ps_avx(a, b, mask)
+#define UME_MM256_BLENDV_PD(a, b, mask) UME::SIMD::blendv_pd_avx(a, b, mask)
+#else
+#define UME_MM256_BLENDV_PS(a, b, mask) _mm256_blendv_ps(a, b, mask)
+#define UME_MM256_BLENDV_PD(a, b, mask) _mm256_blendv_pd(a, b, mask)
+#endif
+
 #include "avx/UMESimdMaskAVX.h"
 #include "avx/UMESimdSwizzleAVX.h"
 #include "avx/UMESimdVecUintAVX.h"
@@ -71,11 +71,18 @@ namespace SIMD
     template<> struct SuggestedVecLen<int64_t> { static const int value = 1; };
     template<> struct SuggestedVecLen<float> { static const int value = 1; };
     template<> struct SuggestedVecLen<double> { static const int value = 1; };
+#else
+#if defined(__AVX512BW__)
+    template<> struct SuggestedVecLen<uint8_t> { static const int value = 64; };
+    template<> struct SuggestedVecLen<int8_t> { static const int value = 64; };
+    template<> struct SuggestedVecLen<uint16_t> { static const int value = 32; };
+    template<> struct SuggestedVecLen<int16_t> { static const int value = 32; };
 #else
     template<> struct SuggestedVecLen<uint8_t> { static const int value = 1; };
     template<> struct SuggestedVecLen<int8_t> { static const int value = 1; };
     template<> struct SuggestedVecLen<uint16_t> { static const int value = 4; };
     template<> struct SuggestedVecLen<int16_t> { static const int value = 4; };
+#endif
     template<> struct SuggestedVecLen<uint32_t> { static const int value = 16; };
     template<> struct SuggestedVecLen<int32_t> { static const int value = 16; };
     template<> struct SuggestedVecLen<uint64_t> { static const int value = 8; };
@@ -92,6 +99,20 @@ namespace SIMD
 
     // Forward declarations of template specializations.
     // Only fully specialized classes should be listed here.
+#if defined(__AVX512BW__)
+#if defined(__AVX512VL__)
+    template<> class SIMDVec_u<uint8_t, 16>;
+    template<> class SIMDVec_u<uint8_t, 32>;
+#endif
+    template<> class SIMDVec_u<uint8_t, 64>;
+
+#if defined(__AVX512VL__)
+    template<> class SIMDVec_u<uint16_t, 8>;
+    template<> class SIMDVec_u<uint16_t, 16>;
+#endif
+    template<> class SIMDVec_u<uint16_t, 32>;
+#endif
+
     template<> class SIMDVec_u<uint32_t, 1>;
     template<> class SIMDVec_u<uint32_t, 2>;
     template<> class SIMDVec_u<uint32_t, 4>;
@@ -105,6 +126,20 @@ namespace SIMD
     template<> class SIMDVec_u<uint64_t, 8>;
     template<> class SIMDVec_u<uint64_t, 16>;
     
+#if defined(__AVX512BW__)
+#if defined(__AVX512VL__)
+    template<> class SIMDVec_i<int8_t, 16>;
+    template<> class SIMDVec_i<int8_t, 32>;
+#endif
+    template<> class SIMDVec_i<int8_t, 64>;
+
+#if defined(__AVX512VL__)
+    template<> class SIMDVec_i<int16_t, 8>;
+    template<> class SIMDVec_i<int16_t, 16>;
+#endif
+    template<> class SIMDVec_i<int16_t, 32>;
+#endif
+
     template<> class SIMDVec_i<int32_t, 1>;
     template<> class SIMDVec_i<int32_t, 2>;
     template<> class SIMDVec_i<int32_t, 4>;
@@ -611,6 +611,32 @@ namespace SIMD {
             mVec = mask.mMask ? mVec / b : mVec;
             return *this;
         }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDDivisor<uint32_t> const & b) const {
+            uint32_t t0 = b.divide(mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (SIMDDivisor<uint32_t> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<1> const & mask, SIMDDivisor<uint32_t> const & b) const {
+            uint32_t t0 = mask.mMask ? b.divide(mVec) : mVec;
+            return SIMDVec_u(t0);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDDivisor<uint32_t> const & b) {
+            mVec = b.divide(mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDDivisor<uint32_t> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<1> const & mask, SIMDDivisor<uint32_t> const & b) {
+            mVec = mask.mMask ? b.divide(mVec) : mVec;
+            return *this;
+        }
         // RCP
         // MRCP
         // RCPS
@@ -1641,9 +1641,21 @@ namespace SIMD {
         // SQRTA
         // MSQRTA
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         // MROUND
 
@@ -1688,9 +1700,21 @@ namespace SIMD {
             return VECTOR_EMULATION::logf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
 
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
@@ -1714,13 +1738,32 @@ namespace SIMD {
         }
         // MSINCOS
         UME_FORCE_INLINE void sincos(SIMDVecMask<4> const & mask, SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
-            sinvec = SCALAR_EMULATION::MATH::sin<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
-            cosvec = SCALAR_EMULATION::MATH::cos<SIMDVec_f, SIMDVecMask<4>>(mask, *this);
+            VECTOR_EMULATION::sincosf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(mask, *this, sinvec, cosvec);
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(*this);
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<4>>(*this, b);
+        }
 
         /*
         // PACK
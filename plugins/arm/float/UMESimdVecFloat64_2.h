@@ -1171,9 +1171,21 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<2> const & mask, double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             double t0 = std::roundf(mVec[0]);
@@ -1226,9 +1238,21 @@ namespace SIMD {
             return VECTOR_EMULATION::logd<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 2>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 2>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
             return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(*this);
@@ -1251,13 +1275,32 @@ namespace SIMD {
         }
         // MSINCOS
         UME_FORCE_INLINE void sincos(SIMDVecMask<2> const & mask, SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
-            sinvec = VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(mask, *this);
-            cosvec = VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(mask, *this);
+            VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(mask, *this, sinvec, cosvec);
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(*this);
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<2> const & mask) const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVec_i<int64_t, 2>, SIMDVecMask<2>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<2>>(*this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2d<SIMDVec_f, SIMDVecMask<2>>(*this, b);
+        }
 
         // PACK
         UME_FORCE_INLINE SIMDVec_f & pack(HALF_LEN_VEC_TYPE const & a, HALF_LEN_VEC_TYPE const & b) {
@@ -71,6 +71,22 @@ namespace SIMD {
         UME_FORCE_INLINE explicit SIMDVec_i(int32x4_t const & x) {
             this->mVec = x;
         }
+        // Division by a precomputed divisor, used by DIVD*/REMD*.
+        static UME_FORCE_INLINE int32x4_t divideMagic(int32x4_t const & a, SIMDDivisor<int32_t> const & b) {
+            int32x2_t t0 = vdup_n_s32(b.magic());
+            int64x2_t t1 = vmull_s32(vget_low_s32(a), t0);
+            int64x2_t t2 = vmull_s32(vget_high_s32(a), t0);
+            int32x4_t t3 = vcombine_s32(vshrn_n_s64(t1, 32), vshrn_n_s64(t2, 32));
+            int32x4_t t4 = vaddq_s32(t3, a);
+            int32x4_t t5 = vandq_s32(vshrq_n_s32(t4, 31), vdupq_n_s32(b.mask()));
+            int32x4_t t6 = vshlq_s32(vaddq_s32(t4, t5), vdupq_n_s32(-int32_t(b.shift())));
+            int32x4_t t7 = vdupq_n_s32(b.sign());
+            return vsubq_s32(veorq_s32(t6, t7), t7);
+        }
+        static UME_FORCE_INLINE int32x4_t remainderMagic(int32x4_t const & a, SIMDDivisor<int32_t> const & b) {
+            int32x4_t t0 = divideMagic(a, b);
+            return vmlsq_n_s32(a, t0, b.divisor());
+        }
     public:
         constexpr static uint32_t length() { return 4; }
         constexpr static uint32_t alignment() { return 16; }
@@ -953,6 +969,138 @@ namespace SIMD {
             mVec[3] = mask.mMask[3] ? mVec[3] / b : mVec[3];
             return *this;
         }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDDivisor<int32_t> const & b) const {
+            int32x4_t t0 = divideMagic(mVec, b);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (SIMDDivisor<int32_t> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<4> const & mask, SIMDDivisor<int32_t> const & b) const {
+            int32x4_t t0 = divideMagic(mVec, b);
+            int32x4_t t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDDivisor<int32_t> const & b) {
+            mVec = divideMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDDivisor<int32_t> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<4> const & mask, SIMDDivisor<int32_t> const & b) {
+            int32x4_t t0 = divideMagic(mVec, b);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // REMV
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVec_i const & b) const {
+            int32_t t0 = mVec[0] % b.mVec[0];
+            int32_t t1 = mVec[1] % b.mVec[1];
+            int32_t t2 = mVec[2] % b.mVec[2];
+            int32_t t3 = mVec[3] % b.mVec[3];
+            return SIMDVec_i(t0, t1, t2, t3);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (SIMDVec_i const & b) const {
+            return rem(b);
+        }
+        // MREMV
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            int32_t t0 = mask.mMask[0] ? mVec[0] % b.mVec[0] : mVec[0];
+            int32_t t1 = mask.mMask[1] ? mVec[1] % b.mVec[1] : mVec[1];
+            int32_t t2 = mask.mMask[2] ? mVec[2] % b.mVec[2] : mVec[2];
+            int32_t t3 = mask.mMask[3] ? mVec[3] % b.mVec[3] : mVec[3];
+            return SIMDVec_i(t0, t1, t2, t3);
+        }
+        // REMS
+        UME_FORCE_INLINE SIMDVec_i rem(int32_t b) const {
+            int32_t t0 = mVec[0] % b;
+            int32_t t1 = mVec[1] % b;
+            int32_t t2 = mVec[2] % b;
+            int32_t t3 = mVec[3] % b;
+            return SIMDVec_i(t0, t1, t2, t3);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (int32_t b) const {
+            return rem(b);
+        }
+        // MREMS
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<4> const & mask, int32_t b) const {
+            int32_t t0 = mask.mMask[0] ? mVec[0] % b : mVec[0];
+            int32_t t1 = mask.mMask[1] ? mVec[1] % b : mVec[1];
+            int32_t t2 = mask.mMask[2] ? mVec[2] % b : mVec[2];
+            int32_t t3 = mask.mMask[3] ? mVec[3] % b : mVec[3];
+            return SIMDVec_i(t0, t1, t2, t3);
+        }
+        // REMVA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVec_i const & b) {
+            mVec[0] %= b.mVec[0];
+            mVec[1] %= b.mVec[1];
+            mVec[2] %= b.mVec[2];
+            mVec[3] %= b.mVec[3];
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (SIMDVec_i const & b) {
+            return rema(b);
+        }
+        // MREMVA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            mVec[0] = mask.mMask[0] ? mVec[0] % b.mVec[0] : mVec[0];
+            mVec[1] = mask.mMask[1] ? mVec[1] % b.mVec[1] : mVec[1];
+            mVec[2] = mask.mMask[2] ? mVec[2] % b.mVec[2] : mVec[2];
+            mVec[3] = mask.mMask[3] ? mVec[3] % b.mVec[3] : mVec[3];
+            return *this;
+        }
+        // REMSA
+        UME_FORCE_INLINE SIMDVec_i & rema(int32_t b) {
+            mVec[0] %= b;
+            mVec[1] %= b;
+            mVec[2] %= b;
+            mVec[3] %= b;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (int32_t b) {
+            return rema(b);
+        }
+        // MREMSA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<4> const & mask, int32_t b) {
+            mVec[0] = mask.mMask[0] ? mVec[0] % b : mVec[0];
+            mVec[1] = mask.mMask[1] ? mVec[1] % b : mVec[1];
+            mVec[2] = mask.mMask[2] ? mVec[2] % b : mVec[2];
+            mVec[3] = mask.mMask[3] ? mVec[3] % b : mVec[3];
+            return *this;
+        }
+        // REMD
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDDivisor<int32_t> const & b) const {
+            int32x4_t t0 = remainderMagic(mVec, b);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (SIMDDivisor<int32_t> const & b) const {
+            return rem(b);
+        }
+        // MREMD
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<4> const & mask, SIMDDivisor<int32_t> const & b) const {
+            int32x4_t t0 = remainderMagic(mVec, b);
+            int32x4_t t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // REMDA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDDivisor<int32_t> const & b) {
+            mVec = remainderMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (SIMDDivisor<int32_t> const & b) {
+            return rema(b);
+        }
+        // MREMDA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<4> const & mask, SIMDDivisor<int32_t> const & b) {
+            int32x4_t t0 = remainderMagic(mVec, b);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // RCP
         // MRCP
         // RCPS
@@ -710,6 +710,36 @@ namespace SIMD {
             mVec[1] = mask.mMask[1] ? mVec[1] / b : mVec[1];
             return *this;
         }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDDivisor<uint32_t> const & b) const {
+            uint32_t t0 = b.divide(mVec[0]);
+            uint32_t t1 = b.divide(mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (SIMDDivisor<uint32_t> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<2> const & mask, SIMDDivisor<uint32_t> const & b) const {
+            uint32_t t0 = mask.mMask[0] ? b.divide(mVec[0]) : mVec[0];
+            uint32_t t1 = mask.mMask[1] ? b.divide(mVec[1]) : mVec[1];
+            return SIMDVec_u(t0, t1);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDDivisor<uint32_t> const & b) {
+            mVec[0] = b.divide(mVec[0]);
+            mVec[1] = b.divide(mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDDivisor<uint32_t> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<2> const & mask, SIMDDivisor<uint32_t> const & b) {
+            mVec[0] = mask.mMask[0] ? b.divide(mVec[0]) : mVec[0];
+            mVec[1] = mask.mMask[1] ? b.divide(mVec[1]) : mVec[1];
+            return *this;
+        }
         // RCP
         // MRCP
         // RCPS
@@ -66,6 +66,19 @@ namespace SIMD {
         UME_FORCE_INLINE explicit SIMDVec_u(uint32x4_t const & x) {
             this->mVec = x;
         }
+        // Division by a precomputed divisor, used by DIVD*/REMD*.
+        static UME_FORCE_INLINE uint32x4_t divideMagic(uint32x4_t const & a, SIMDDivisor<uint32_t> const & b) {
+            uint32x2_t t0 = vdup_n_u32(b.magic());
+            uint64x2_t t1 = vmull_u32(vget_low_u32(a), t0);
+            uint64x2_t t2 = vmull_u32(vget_high_u32(a), t0);
+            uint32x4_t t3 = vcombine_u32(vshrn_n_u64(t1, 32), vshrn_n_u64(t2, 32));
+            uint32x4_t t4 = vshlq_u32(vsubq_u32(a, t3), vdupq_n_s32(-int32_t(b.shift1())));
+            return vshlq_u32(vaddq_u32(t3, t4), vdupq_n_s32(-int32_t(b.shift2())));
+        }
+        static UME_FORCE_INLINE uint32x4_t remainderMagic(uint32x4_t const & a, SIMDDivisor<uint32_t> const & b) {
+            uint32x4_t t0 = divideMagic(a, b);
+            return vmlsq_n_u32(a, t0, b.divisor());
+        }
     public:
         constexpr static uint32_t length() { return 4; }
         constexpr static uint32_t alignment() { return 16; }
@@ -870,6 +883,138 @@ namespace SIMD {
             mVec[3] = mask.mMask[3] ? mVec[3] / b : mVec[3];
             return *this;
         }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDDivisor<uint32_t> const & b) const {
+            uint32x4_t t0 = divideMagic(mVec, b);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (SIMDDivisor<uint32_t> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<4> const & mask, SIMDDivisor<uint32_t> const & b) const {
+            uint32x4_t t0 = divideMagic(mVec, b);
+            uint32x4_t t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDDivisor<uint32_t> const & b) {
+            mVec = divideMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDDivisor<uint32_t> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<4> const & mask, SIMDDivisor<uint32_t> const & b) {
+            uint32x4_t t0 = divideMagic(mVec, b);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // REMV
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVec_u const & b) const {
+            uint32_t t0 = mVec[0] % b.mVec[0];
+            uint32_t t1 = mVec[1] % b.mVec[1];
+            uint32_t t2 = mVec[2] % b.mVec[2];
+            uint32_t t3 = mVec[3] % b.mVec[3];
+            return SIMDVec_u(t0, t1, t2, t3);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (SIMDVec_u const & b) const {
+            return rem(b);
+        }
+        // MREMV
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            uint32_t t0 = mask.mMask[0] ? mVec[0] % b.mVec[0] : mVec[0];
+            uint32_t t1 = mask.mMask[1] ? mVec[1] % b.mVec[1] : mVec[1];
+            uint32_t t2 = mask.mMask[2] ? mVec[2] % b.mVec[2] : mVec[2];
+            uint32_t t3 = mask.mMask[3] ? mVec[3] % b.mVec[3] : mVec[3];
+            return SIMDVec_u(t0, t1, t2, t3);
+        }
+        // REMS
+        UME_FORCE_INLINE SIMDVec_u rem(uint32_t b) const {
+            uint32_t t0 = mVec[0] % b;
+            uint32_t t1 = mVec[1] % b;
+            uint32_t t2 = mVec[2] % b;
+            uint32_t t3 = mVec[3] % b;
+            return SIMDVec_u(t0, t1, t2, t3);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (uint32_t b) const {
+            return rem(b);
+        }
+        // MREMS
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<4> const & mask, uint32_t b) const {
+            uint32_t t0 = mask.mMask[0] ? mVec[0] % b : mVec[0];
+            uint32_t t1 = mask.mMask[1] ? mVec[1] % b : mVec[1];
+            uint32_t t2 = mask.mMask[2] ? mVec[2] % b : mVec[2];
+            uint32_t t3 = mask.mMask[3] ? mVec[3] % b : mVec[3];
+            return SIMDVec_u(t0, t1, t2, t3);
+        }
+        // REMVA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVec_u const & b) {
+            mVec[0] %= b.mVec[0];
+            mVec[1] %= b.mVec[1];
+            mVec[2] %= b.mVec[2];
+            mVec[3] %= b.mVec[3];
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (SIMDVec_u const & b) {
+            return rema(b);
+        }
+        // MREMVA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            mVec[0] = mask.mMask[0] ? mVec[0] % b.mVec[0] : mVec[0];
+            mVec[1] = mask.mMask[1] ? mVec[1] % b.mVec[1] : mVec[1];
+            mVec[2] = mask.mMask[2] ? mVec[2] % b.mVec[2] : mVec[2];
+            mVec[3] = mask.mMask[3] ? mVec[3] % b.mVec[3] : mVec[3];
+            return *this;
+        }
+        // REMSA
+        UME_FORCE_INLINE SIMDVec_u & rema(uint32_t b) {
+            mVec[0] %= b;
+            mVec[1] %= b;
+            mVec[2] %= b;
+            mVec[3] %= b;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (uint32_t b) {
+            return rema(b);
+        }
+        // MREMSA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<4> const & mask, uint32_t b) {
+            mVec[0] = mask.mMask[0] ? mVec[0] % b : mVec[0];
+            mVec[1] = mask.mMask[1] ? mVec[1] % b : mVec[1];
+            mVec[2] = mask.mMask[2] ? mVec[2] % b : mVec[2];
+            mVec[3] = mask.mMask[3] ? mVec[3] % b : mVec[3];
+            return *this;
+        }
+        // REMD
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDDivisor<uint32_t> const & b) const {
+            uint32x4_t t0 = remainderMagic(mVec, b);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (SIMDDivisor<uint32_t> const & b) const {
+            return rem(b);
+        }
+        // MREMD
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<4> const & mask, SIMDDivisor<uint32_t> const & b) const {
+            uint32x4_t t0 = remainderMagic(mVec, b);
+            uint32x4_t t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // REMDA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDDivisor<uint32_t> const & b) {
+            mVec = remainderMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (SIMDDivisor<uint32_t> const & b) {
+            return rema(b);
+        }
+        // MREMDA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<4> const & mask, SIMDDivisor<uint32_t> const & b) {
+            uint32x4_t t0 = remainderMagic(mVec, b);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // RCP
         // MRCP
         // RCPS
@@ -1832,6 +1977,22 @@ namespace SIMD {
             if (mask.mMask[2] == true) baseAddr[indices.mVec[2]] = mVec[2];
             if (mask.mMask[3] == true) baseAddr[indices.mVec[3]] = mVec[3];
             return baseAddr;
+        }
+        // SCATTERADDV
+        UME_FORCE_INLINE uint32_t* scatteradd(uint32_t* baseAddr, SIMDVec_u const & indices) const {
+            baseAddr[vgetq_lane_u32(indices.mVec, 0)] += vgetq_lane_u32(mVec, 0);
+            baseAddr[vgetq_lane_u32(indices.mVec, 1)] += vgetq_lane_u32(mVec, 1);
+            baseAddr[vgetq_lane_u32(indices.mVec, 2)] += vgetq_lane_u32(mVec, 2);
+            baseAddr[vgetq_lane_u32(indices.mVec, 3)] += vgetq_lane_u32(mVec, 3);
+            return baseAddr;
+        }
+        // MSCATTERADDV
+        UME_FORCE_INLINE uint32_t* scatteradd(SIMDVecMask<4> const & mask, uint32_t* baseAddr, SIMDVec_u const & indices) const {
+            if (mask.mMask[0] == true) baseAddr[vgetq_lane_u32(indices.mVec, 0)] += vgetq_lane_u32(mVec, 0);
+            if (mask.mMask[1] == true) baseAddr[vgetq_lane_u32(indices.mVec, 1)] += vgetq_lane_u32(mVec, 1);
+            if (mask.mMask[2] == true) baseAddr[vgetq_lane_u32(indices.mVec, 2)] += vgetq_lane_u32(mVec, 2);
+            if (mask.mMask[3] == true) baseAddr[vgetq_lane_u32(indices.mVec, 3)] += vgetq_lane_u32(mVec, 3);
+            return baseAddr;
         }/*
 
         // LSHV
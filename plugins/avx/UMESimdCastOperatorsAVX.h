@@ -175,11 +175,27 @@ namespace SIMD {
     }
 
     inline SIMDVec_u<uint32_t, 4>::operator SIMDVec_f<float, 4>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_f<float, 4>, float, SIMDVec_u<uint32_t, 4>>(*this);
+        // There is no unsigned conversion: convert the 16-bit halves
+        // separately. Both partial results are exact, so only the final
+        // addition rounds.
+        __m128i t0 = _mm_srli_epi32(mVec, 16);
+        __m128i t1 = _mm_and_si128(mVec, _mm_set1_epi32(0xFFFF));
+        __m128 t2 = _mm_mul_ps(_mm_cvtepi32_ps(t0), _mm_set1_ps(65536.0f));
+        __m128 t3 = _mm_add_ps(t2, _mm_cvtepi32_ps(t1));
+        return SIMDVec_f<float, 4>(t3);
     }
 
     inline SIMDVec_u<uint32_t, 8>::operator SIMDVec_f<float, 8>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_f<float, 8>, float, SIMDVec_u<uint32_t, 8>>(*this);
+        // There is no unsigned conversion: convert the 16-bit halves
+        // separately. Both partial results are exact, so only the final
+        // addition rounds.
+        __m128i t0 = _mm_srli_epi32(_mm256_castsi256_si128(mVec), 16);
+        __m128i t1 = _mm_srli_epi32(_mm256_extractf128_si256(mVec, 1), 16);
+        __m256i t2 = _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+        __m256 t3 = _mm256_and_ps(_mm256_castsi256_ps(mVec), _mm256_castsi256_ps(_mm256_set1_epi32(0xFFFF)));
+        __m256 t4 = _mm256_mul_ps(_mm256_cvtepi32_ps(t2), _mm256_set1_ps(65536.0f));
+        __m256 t5 = _mm256_add_ps(t4, _mm256_cvtepi32_ps(_mm256_castps_si256(t3)));
+        return SIMDVec_f<float, 8>(t5);
     }
 
     inline SIMDVec_u<uint32_t, 16>::operator SIMDVec_f<float, 16>() const {
@@ -201,7 +217,24 @@ namespace SIMD {
 
     template<>
     inline SIMDVec_u<uint64_t, 4>::operator SIMDVec_f<double, 4>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_f<double, 4>, double, SIMDVec_u<uint64_t, 4>>(*this);
+        // Embed the upper and lower 32 bits of each element into the mantissas
+        // of 2^84 and 2^52 and let the floating-point unit do the conversion.
+        // SIMDVec_u<uint64_t, 4> is emulated, so its elements go through memory.
+        alignas(32) uint64_t raw[4];
+        this->storea(raw);
+        __m128i t0 = _mm_load_si128((__m128i*)&raw[0]);
+        __m128i t1 = _mm_load_si128((__m128i*)&raw[2]);
+        __m128i t2 = _mm_set1_epi64x(0x4530000000000000);   // 2^84
+        __m128i t3 = _mm_set1_epi64x(0x4330000000000000);   // 2^52
+        __m128i t4 = _mm_or_si128(_mm_srli_epi64(t0, 32), t2);
+        __m128i t5 = _mm_or_si128(_mm_srli_epi64(t1, 32), t2);
+        __m128i t6 = _mm_blend_epi16(t3, t0, 0x33);
+        __m128i t7 = _mm_blend_epi16(t3, t1, 0x33);
+        __m256d t8 = _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_castsi128_pd(t4)), _mm_castsi128_pd(t5), 1);
+        __m256d t9 = _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_castsi128_pd(t6)), _mm_castsi128_pd(t7), 1);
+        __m256d t10 = _mm256_sub_pd(t8, _mm256_castsi256_pd(_mm256_set1_epi64x(0x4530000000100000))); // 2^84 + 2^52
+        __m256d t11 = _mm256_add_pd(t10, t9);
+        return SIMDVec_f<double, 4>(t11);
     }
 
     template<>
@@ -344,7 +377,8 @@ namespace SIMD {
     }
 
     inline SIMDVec_i<int32_t, 4>::operator SIMDVec_f<float, 4>() const {
-        return SCALAR_EMULATION::xtoy < SIMDVec_f<float, 4>, float, SIMDVec_i<int32_t, 4>>(*this);
+        __m128 t0 = _mm_cvtepi32_ps(mVec);
+        return SIMDVec_f<float, 4>(t0);
     }
 
     inline SIMDVec_i<int32_t, 8>::operator SIMDVec_f<float, 8>() const {
@@ -369,15 +403,22 @@ namespace SIMD {
     }
 
     inline SIMDVec_i<int64_t, 4>::operator SIMDVec_f<double, 4>() const {
-        alignas(32) int64_t raw_i[4];
-        alignas(32) double raw_d[4];
-        _mm256_store_si256((__m256i*)raw_i, mVec);
-        raw_d[0] = double(raw_i[0]);
-        raw_d[1] = double(raw_i[1]);
-        raw_d[2] = double(raw_i[2]);
-        raw_d[3] = double(raw_i[3]);
-        __m256d t0 = _mm256_load_pd(raw_d);
-        return SIMDVec_f<double, 4>(t0);
+        // Embed the upper (sign-flipped) and lower 32 bits of each element into
+        // the mantissas of 2^84 + 2^63 and 2^52 and let the floating-point unit
+        // do the conversion. Integer steps are done on 128-bit halves.
+        __m128i t0 = _mm256_castsi256_si128(mVec);
+        __m128i t1 = _mm256_extractf128_si256(mVec, 1);
+        __m128i t2 = _mm_set1_epi64x(0x4530000080000000);   // 2^84 + 2^63
+        __m128i t3 = _mm_set1_epi64x(0x4330000000000000);   // 2^52
+        __m128i t4 = _mm_xor_si128(_mm_srli_epi64(t0, 32), t2);
+        __m128i t5 = _mm_xor_si128(_mm_srli_epi64(t1, 32), t2);
+        __m128i t6 = _mm_blend_epi16(t3, t0, 0x33);
+        __m128i t7 = _mm_blend_epi16(t3, t1, 0x33);
+        __m256d t8 = _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_castsi128_pd(t4)), _mm_castsi128_pd(t5), 1);
+        __m256d t9 = _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_castsi128_pd(t6)), _mm_castsi128_pd(t7), 1);
+        __m256d t10 = _mm256_sub_pd(t8, _mm256_castsi256_pd(_mm256_set1_epi64x(0x4530000080100000))); // 2^84 + 2^63 + 2^52
+        __m256d t11 = _mm256_add_pd(t10, t9);
+        return SIMDVec_f<double, 4>(t11);
     }
 
     inline SIMDVec_i<int64_t, 8>::operator SIMDVec_f<double, 8>() const {
@@ -530,6 +571,19 @@ namespace SIMD {
 
     inline SIMDVec_f<double, 4>::operator SIMDVec_i<int64_t, 4>() const {
         // C++: Truncation is default rounding mode for floating-integer conversion.
+        __m256d t0 = _mm256_round_pd(mVec, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        __m256d t1 = _mm256_andnot_pd(_mm256_set1_pd(-0.0), t0);
+        __m256d t2 = _mm256_cmp_pd(t1, _mm256_set1_pd(2251799813685248.0), _CMP_LT_OQ); // 2^51
+        if (_mm256_movemask_pd(t2) == 0xF) {
+            // All elements fit into 52 bits: adding 1.5*2^52 places the
+            // integer value in the low bits of the mantissa.
+            __m256d t3 = _mm256_set1_pd(6755399441055744.0);                            // 1.5*2^52
+            __m256d t4 = _mm256_add_pd(t0, t3);
+            __m128i t5_lo = _mm_sub_epi64(_mm_castpd_si128(_mm256_castpd256_pd128(t4)), _mm_castpd_si128(_mm256_castpd256_pd128(t3)));
+            __m128i t5_hi = _mm_sub_epi64(_mm_castpd_si128(_mm256_extractf128_pd(t4, 1)), _mm_castpd_si128(_mm256_castpd256_pd128(t3)));
+            __m256i t5 = _mm256_insertf128_si256(_mm256_castsi128_si256(t5_lo), t5_hi, 1);
+            return SIMDVec_i<int64_t, 4>(t5);
+        }
         alignas(32) double raw_64f[4];
         alignas(32) int64_t raw_64i[4];
         _mm256_store_pd(raw_64f, mVec);
@@ -537,8 +591,8 @@ namespace SIMD {
         raw_64i[1] = int64_t(raw_64f[1]);
         raw_64i[2] = int64_t(raw_64f[2]);
         raw_64i[3] = int64_t(raw_64f[3]);
-        __m256i t0 = _mm256_load_si256((__m256i *)raw_64i);
-        return SIMDVec_i<int64_t, 4>(t0);
+        __m256i t6 = _mm256_load_si256((__m256i *)raw_64i);
+        return SIMDVec_i<int64_t, 4>(t6);
     }
 
     inline SIMDVec_f<double, 8>::operator SIMDVec_i<int64_t, 8>() const {
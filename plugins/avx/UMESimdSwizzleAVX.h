@@ -44,5 +44,6 @@
 // MASK VECTOR SPECIALIZATIONS
 // ********************************************************************************************
 #include "swizzle/UMESimdSwizzle4.h"
+#include "swizzle/UMESimdSwizzle8.h"
 
 #endif
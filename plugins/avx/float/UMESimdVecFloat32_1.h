@@ -258,13 +258,37 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVec_f const & b) const {
+            return add(b);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<1> const & mask, SIMDVec_f const & b) const {
+            return add(mask, b);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(float b) const {
+            return add(b);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<1> const & mask, float b) const {
+            return add(mask, b);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVec_f const & b) {
+            return adda(b);
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<1> const & mask, SIMDVec_f const & b) {
+            return adda(mask, b);
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(float b) {
+            return adda(b);
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<1> const & mask, float b) {
+            return adda(mask, b);
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_f postinc() {
             float t0 = mVec++;
@@ -344,13 +368,37 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVec_f const & b) const {
+            return sub(b);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<1> const & mask, SIMDVec_f const & b) const {
+            return sub(mask, b);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(float b) const {
+            return sub(b);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<1> const & mask, float b) const {
+            return sub(mask, b);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVec_f const & b) {
+            return suba(b);
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<1> const & mask, SIMDVec_f const & b) {
+            return suba(mask, b);
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(float b) {
+            return suba(b);
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<1> const & mask, float b) {
+            return suba(mask, b);
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVec_f const & a) const {
             float t0 = a.mVec - mVec;
@@ -1036,12 +1084,33 @@ namespace SIMD {
         // CEIL
         // MCEIL
         // ISFIN
+        UME_FORCE_INLINE SIMDVecMask<1> isfin() const {
+            return SIMDVecMask<1>(std::isfinite(mVec));
+        }
         // ISINF
+        UME_FORCE_INLINE SIMDVecMask<1> isinf() const {
+            return SIMDVecMask<1>(std::isinf(mVec));
+        }
         // ISAN
+        UME_FORCE_INLINE SIMDVecMask<1> isan() const {
+            return SIMDVecMask<1>(std::isfinite(mVec));
+        }
         // ISNAN
+        UME_FORCE_INLINE SIMDVecMask<1> isnan() const {
+            return SIMDVecMask<1>(std::isnan(mVec));
+        }
         // ISSUB
+        UME_FORCE_INLINE SIMDVecMask<1> issub() const {
+            return SIMDVecMask<1>((std::abs(mVec) < std::numeric_limits<float>::min()) && (mVec != 0.0f));
+        }
         // ISZERO
+        UME_FORCE_INLINE SIMDVecMask<1> iszero() const {
+            return SIMDVecMask<1>(mVec == 0.0f);
+        }
         // ISZEROSUB
+        UME_FORCE_INLINE SIMDVecMask<1> iszerosub() const {
+            return SIMDVecMask<1>(std::abs(mVec) < std::numeric_limits<float>::min());
+        }
 
         // EXP
         UME_FORCE_INLINE SIMDVec_f exp() const {
@@ -65,6 +65,32 @@ namespace SIMD {
             this->mVec[1] = hi;
         }
 
+        // Lane classification kernels used by ISFIN..ISZEROSUB. Lanes for which
+        // the predicate holds are set to all ones.
+        static UME_FORCE_INLINE __m256 absLanes(__m256 const & a) {
+            return _mm256_and_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF)));
+        }
+        static UME_FORCE_INLINE __m256 finiteLanes(__m256 const & a) {
+            __m256 t0 = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+            return _mm256_cmp_ps(absLanes(a), t0, _CMP_LT_OQ);
+        }
+        static UME_FORCE_INLINE __m256 infiniteLanes(__m256 const & a) {
+            __m256 t0 = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+            return _mm256_cmp_ps(absLanes(a), t0, _CMP_EQ_OQ);
+        }
+        static UME_FORCE_INLINE __m256 nanLanes(__m256 const & a) {
+            return _mm256_cmp_ps(a, a, _CMP_UNORD_Q);
+        }
+        static UME_FORCE_INLINE __m256 zeroLanes(__m256 const & a) {
+            return _mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_EQ_OQ);
+        }
+        static UME_FORCE_INLINE __m256 zeroOrSubnormalLanes(__m256 const & a) {
+            __m256 t0 = _mm256_set1_ps(std::numeric_limits<float>::min());
+            return _mm256_cmp_ps(absLanes(a), t0, _CMP_LT_OQ);
+        }
+        static UME_FORCE_INLINE __m256 subnormalLanes(__m256 const & a) {
+            return _mm256_andnot_ps(zeroLanes(a), zeroOrSubnormalLanes(a));
+        }
     public:
         // ZERO-CONSTR
         UME_FORCE_INLINE SIMDVec_f() {}
@@ -163,8 +189,8 @@ namespace SIMD {
         }
         // MASSIGNV
         UME_FORCE_INLINE SIMDVec_f & assign(SIMDVecMask<16> const & mask, SIMDVec_f const & b) {
-            mVec[0] = _mm256_blendv_ps(mVec[0], b.mVec[0], _mm256_castsi256_ps(mask.mMask[0]));
-            mVec[1] = _mm256_blendv_ps(mVec[1], b.mVec[1], _mm256_castsi256_ps(mask.mMask[1]));
+            mVec[0] = UME_MM256_BLENDV_PS(mVec[0], b.mVec[0], _mm256_castsi256_ps(mask.mMask[0]));
+            mVec[1] = UME_MM256_BLENDV_PS(mVec[1], b.mVec[1], _mm256_castsi256_ps(mask.mMask[1]));
             return *this;
         }
         // ASSIGNS
@@ -179,8 +205,8 @@ namespace SIMD {
         // MASSIGNS
         UME_FORCE_INLINE SIMDVec_f & assign(SIMDVecMask<16> const & mask, float b) {
             __m256 t0 = _mm256_set1_ps(b);
-            mVec[0] = _mm256_blendv_ps(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
-            mVec[1] = _mm256_blendv_ps(mVec[1], t0, _mm256_castsi256_ps(mask.mMask[1]));
+            mVec[0] = UME_MM256_BLENDV_PS(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
+            mVec[1] = UME_MM256_BLENDV_PS(mVec[1], t0, _mm256_castsi256_ps(mask.mMask[1]));
             return *this;
         }
 
@@ -198,8 +224,8 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<16> const & mask, float const * p) {
             __m256 t0 = _mm256_loadu_ps(p);
             __m256 t1 = _mm256_loadu_ps(p + 8);
-            mVec[0] = _mm256_blendv_ps(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
-            mVec[1] = _mm256_blendv_ps(mVec[1], t1, _mm256_castsi256_ps(mask.mMask[1]));
+            mVec[0] = UME_MM256_BLENDV_PS(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
+            mVec[1] = UME_MM256_BLENDV_PS(mVec[1], t1, _mm256_castsi256_ps(mask.mMask[1]));
             return *this;
         }
         // LOADA
@@ -211,9 +237,9 @@ namespace SIMD {
         // MLOADA
         UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<16> const & mask, float const * p) {
             __m256 t0 = _mm256_load_ps(p);
-            mVec[0] = _mm256_blendv_ps(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
+            mVec[0] = UME_MM256_BLENDV_PS(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
             __m256 t1 = _mm256_load_ps(p + 8);
-            mVec[1] = _mm256_blendv_ps(mVec[1], t1, _mm256_castsi256_ps(mask.mMask[1]));
+            mVec[1] = UME_MM256_BLENDV_PS(mVec[1], t1, _mm256_castsi256_ps(mask.mMask[1]));
             return *this;
         }
         // STORE
@@ -226,8 +252,8 @@ namespace SIMD {
         UME_FORCE_INLINE float* store(SIMDVecMask<16> const & mask, float * p) const {
             __m256 t0 = _mm256_loadu_ps(p);
             __m256 t1 = _mm256_loadu_ps(p + 8);
-            __m256 t2 = _mm256_blendv_ps(t0, mVec[0], _mm256_castsi256_ps(mask.mMask[0]));
-            __m256 t3 = _mm256_blendv_ps(t1, mVec[1], _mm256_castsi256_ps(mask.mMask[1]));
+            __m256 t2 = UME_MM256_BLENDV_PS(t0, mVec[0], _mm256_castsi256_ps(mask.mMask[0]));
+            __m256 t3 = UME_MM256_BLENDV_PS(t1, mVec[1], _mm256_castsi256_ps(mask.mMask[1]));
             _mm256_storeu_ps(p, t2);
             _mm256_storeu_ps(p + 8, t3);
             return p;
@@ -262,9 +288,9 @@ namespace SIMD {
         // MADDV    - Masked add with vector
         UME_FORCE_INLINE SIMDVec_f add(SIMDVecMask<16> const & mask, SIMDVec_f const & b) const {
             __m256 t0 = _mm256_add_ps(this->mVec[0], b.mVec[0]);
-            __m256 t1 = _mm256_blendv_ps(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
+            __m256 t1 = UME_MM256_BLENDV_PS(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
             __m256 t2 = _mm256_add_ps(this->mVec[1], b.mVec[1]);
-            __m256 t3 = _mm256_blendv_ps(mVec[1], t2, _mm256_castsi256_ps(mask.mMask[1]));
+            __m256 t3 = UME_MM256_BLENDV_PS(mVec[1], t2, _mm256_castsi256_ps(mask.mMask[1]));
             return SIMDVec_f(t1, t3);
         }
         // ADDS     - Add with scalar
@@ -282,8 +308,8 @@ namespace SIMD {
             __m256 t0 = _mm256_set1_ps(b);
             __m256 t1 = _mm256_add_ps(mVec[0], t0);
             __m256 t2 = _mm256_add_ps(mVec[1], t0);
-            __m256 t3 = _mm256_blendv_ps(mVec[0], t1, _mm256_castsi256_ps(mask.mMask[0]));
-            __m256 t4 = _mm256_blendv_ps(mVec[1], t2, _mm256_castsi256_ps(mask.mMask[1]));
+            __m256 t3 = UME_MM256_BLENDV_PS(mVec[0], t1, _mm256_castsi256_ps(mask.mMask[0]));
+            __m256 t4 = UME_MM256_BLENDV_PS(mVec[1], t2, _mm256_castsi256_ps(mask.mMask[1]));
             return SIMDVec_f(t3, t4);
         }
         // ADDVA    - Add with vector and assign
@@ -298,9 +324,9 @@ namespace SIMD {
         // MADDVA   - Masked add with vector and assign
         UME_FORCE_INLINE SIMDVec_f & adda(SIMDVecMask<16> const & mask, SIMDVec_f const & b) {
             __m256 t0 = _mm256_add_ps(mVec[0], b.mVec[0]);
-            mVec[0] = _mm256_blendv_ps(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
+            mVec[0] = UME_MM256_BLENDV_PS(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
             __m256 t1 = _mm256_add_ps(mVec[1], b.mVec[1]);
-            mVec[1] = _mm256_blendv_ps(mVec[1], t1, _mm256_castsi256_ps(mask.mMask[1]));
+            mVec[1] = UME_MM256_BLENDV_PS(mVec[1], t1, _mm256_castsi256_ps(mask.mMask[1]));
             return *this;
         }
         // ADDSA    - Add with scalar and assign
@@ -318,8 +344,8 @@ namespace SIMD {
             __m256 t0 = _mm256_set1_ps(b);
             __m256 t1 = _mm256_add_ps(mVec[0], t0);
             __m256 t2 = _mm256_add_ps(mVec[1], t0);
-            mVec[0] = _mm256_blendv_ps(mVec[0], t1, _mm256_castsi256_ps(mask.mMask[0]));
-            mVec[1] = _mm256_blendv_ps(mVec[1], t2, _mm256_castsi256_ps(mask.mMask[1]));
+            mVec[0] = UME_MM256_BLENDV_PS(mVec[0], t1, _mm256_castsi256_ps(mask.mMask[0]));
+            mVec[1] = UME_MM256_BLENDV_PS(mVec[1], t2, _mm256_castsi256_ps(mask.mMask[1]));
             return *this;
         }
         // SADDV    - Saturated add with vector
@@ -348,9 +374,9 @@ namespace SIMD {
         // MSUBV
         UME_FORCE_INLINE SIMDVec_f sub(SIMDVecMask<16> const & mask, SIMDVec_f const & b) const {
             __m256 t0 = _mm256_sub_ps(this->mVec[0], b.mVec[0]);
-            __m256 t1 = _mm256_blendv_ps(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
+            __m256 t1 = UME_MM256_BLENDV_PS(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
             __m256 t2 = _mm256_sub_ps(this->mVec[1], b.mVec[1]);
-            __m256 t3 = _mm256_blendv_ps(mVec[1], t2, _mm256_castsi256_ps(mask.mMask[1]));
+            __m256 t3 = UME_MM256_BLENDV_PS(mVec[1], t2, _mm256_castsi256_ps(mask.mMask[1]));
             return SIMDVec_f(t1, t3);
         }
         // SUBS
@@ -368,8 +394,8 @@ namespace SIMD {
             __m256 t0 = _mm256_set1_ps(b);
             __m256 t1 = _mm256_sub_ps(mVec[0], t0);
             __m256 t2 = _mm256_sub_ps(mVec[1], t0);
-            __m256 t3 = _mm256_blendv_ps(mVec[0], t1, _mm256_castsi256_ps(mask.mMask[0]));
-            __m256 t4 = _mm256_blendv_ps(mVec[1], t2, _mm256_castsi256_ps(mask.mMask[1]));
+            __m256 t3 = UME_MM256_BLENDV_PS(mVec[0], t1, _mm256_castsi256_ps(mask.mMask[0]));
+            __m256 t4 = UME_MM256_BLENDV_PS(mVec[1], t2, _mm256_castsi256_ps(mask.mMask[1]));
             return SIMDVec_f(t3, t4);
         }
         // SUBVA      - Sub with vector and assign
@@ -410,9 +436,9 @@ namespace SIMD {
         // MMULV  - Masked multiplication with vector
         UME_FORCE_INLINE SIMDVec_f mul(SIMDVecMask<16> const & mask, SIMDVec_f const & b) const {
             __m256 t0 = _mm256_mul_ps(this->mVec[0], b.mVec[0]);
-            __m256 t1 = _mm256_blendv_ps(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
+            __m256 t1 = UME_MM256_BLENDV_PS(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
             __m256 t2 = _mm256_mul_ps(this->mVec[1], b.mVec[1]);
-            __m256 t3 = _mm256_blendv_ps(mVec[1], t2, _mm256_castsi256_ps(mask.mMask[1]));
+            __m256 t3 = UME_MM256_BLENDV_PS(mVec[1], t2, _mm256_castsi256_ps(mask.mMask[1]));
             return SIMDVec_f(t1, t3);
         }
         // MULS   - Multiplication with scalar
@@ -430,8 +456,8 @@ namespace SIMD {
             __m256 t0 = _mm256_set1_ps(b);
             __m256 t1 = _mm256_mul_ps(mVec[0], t0);
             __m256 t2 = _mm256_mul_ps(mVec[1], t0);
-            __m256 t3 = _mm256_blendv_ps(mVec[0], t1, _mm256_castsi256_ps(mask.mMask[0]));
-            __m256 t4 = _mm256_blendv_ps(mVec[1], t2, _mm256_castsi256_ps(mask.mMask[1]));
+            __m256 t3 = UME_MM256_BLENDV_PS(mVec[0], t1, _mm256_castsi256_ps(mask.mMask[0]));
+            __m256 t4 = UME_MM256_BLENDV_PS(mVec[1], t2, _mm256_castsi256_ps(mask.mMask[1]));
             return SIMDVec_f(t3, t4);
         }
         // MULVA  - Multiplication with vector and assign
@@ -457,9 +483,9 @@ namespace SIMD {
         // MRCP   - Masked reciprocal
         UME_FORCE_INLINE SIMDVec_f rcp(SIMDVecMask<16> const & mask) const {
             __m256 t0 = _mm256_rcp_ps(this->mVec[0]);
-            __m256 t1 = _mm256_blendv_ps(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
+            __m256 t1 = UME_MM256_BLENDV_PS(mVec[0], t0, _mm256_castsi256_ps(mask.mMask[0]));
             __m256 t2 = _mm256_rcp_ps(this->mVec[1]);
-            __m256 t3 = _mm256_blendv_ps(mVec[1], t2, _mm256_castsi256_ps(mask.mMask[1]));
+            __m256 t3 = UME_MM256_BLENDV_PS(mVec[1], t2, _mm256_castsi256_ps(mask.mMask[1]));
             return SIMDVec_f(t1, t3);
         }
         // RCPS   - Reciprocal with scalar numerator
@@ -473,9 +499,9 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVec_f rcp(SIMDVecMask<16> const & mask, float b) const {
             __m256 t0 = _mm256_set1_ps(b);
             __m256 t1 = _mm256_div_ps(t0, mVec[0]);
-            __m256 t2 = _mm256_blendv_ps(mVec[0], t1, _mm256_castsi256_ps(mask.mMask[0]));
+            __m256 t2 = UME_MM256_BLENDV_PS(mVec[0], t1, _mm256_castsi256_ps(mask.mMask[0]));
             __m256 t3 = _mm256_div_ps(t0, mVec[1]);
-            __m256 t4 = _mm256_blendv_ps(mVec[1], t3, _mm256_castsi256_ps(mask.mMask[1]));
+            __m256 t4 = UME_MM256_BLENDV_PS(mVec[1], t3, _mm256_castsi256_ps(mask.mMask[1]));
             return SIMDVec_f(t2, t4);
         }
         // RCPA   - Reciprocal and assign
@@ -592,8 +618,8 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVecMask<16> const & mask, SIMDVec_f const & a, SIMDVec_f const & b) const {
             __m256 t0 = _mm256_add_ps(_mm256_mul_ps(mVec[0], a.mVec[0]), b.mVec[0]);
             __m256 t1 = _mm256_add_ps(_mm256_mul_ps(mVec[1], a.mVec[1]), b.mVec[1]);
-            __m256 t2 = _mm256_blendv_ps(mVec[0], t0, _mm256_cvtepi32_ps(mask.mMask[0]));
-            __m256 t3 = _mm256_blendv_ps(mVec[1], t1, _mm256_cvtepi32_ps(mask.mMask[1]));
+            __m256 t2 = UME_MM256_BLENDV_PS(mVec[0], t0, _mm256_cvtepi32_ps(mask.mMask[0]));
+            __m256 t3 = UME_MM256_BLENDV_PS(mVec[1], t1, _mm256_cvtepi32_ps(mask.mMask[1]));
             return SIMDVec_f(t2, t3);
         }
         // FMULSUBV  - Fused multiply and sub (A*B - C) with vectors
@@ -729,8 +755,8 @@ namespace SIMD {
             __m256 m1 = _mm256_castsi256_ps(mask.mMask[1]);
             __m256 t0 = _mm256_sqrt_ps(mVec[0]);
             __m256 t1 = _mm256_sqrt_ps(mVec[1]);
-            __m256 t2 = _mm256_blendv_ps(mVec[0], t0, m0);
-            __m256 t3 = _mm256_blendv_ps(mVec[1], t1, m1);
+            __m256 t2 = UME_MM256_BLENDV_PS(mVec[0], t0, m0);
+            __m256 t3 = UME_MM256_BLENDV_PS(mVec[1], t1, m1);
             return SIMDVec_f(t2, t3);
         }
         // SQRTA     - Square root of vector values and assign
@@ -751,8 +777,8 @@ namespace SIMD {
             __m256 m1 = _mm256_castsi256_ps(mask.mMask[1]);
             __m256 t0 = _mm256_round_ps(mVec[0], _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
             __m256 t1 = _mm256_round_ps(mVec[1], _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
-            __m256 t2 = _mm256_blendv_ps(mVec[0], t0, m0);
-            __m256 t3 = _mm256_blendv_ps(mVec[1], t1, m1);
+            __m256 t2 = UME_MM256_BLENDV_PS(mVec[0], t0, m0);
+            __m256 t3 = UME_MM256_BLENDV_PS(mVec[1], t1, m1);
             return SIMDVec_f(t2, t3);
         }
         // TRUNC     - Truncate to integer (returns Signed integer vector)
@@ -767,8 +793,8 @@ namespace SIMD {
             __m256 t0 = _mm256_round_ps(mVec[0], _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
             __m256 t1 = _mm256_round_ps(mVec[1], _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
             __m256 t2 = _mm256_setzero_ps();
-            __m256 t3 = _mm256_blendv_ps(t2, t0, _mm256_cvtepi32_ps(mask.mMask[0]));
-            __m256 t4 = _mm256_blendv_ps(t2, t1, _mm256_cvtepi32_ps(mask.mMask[1]));
+            __m256 t3 = UME_MM256_BLENDV_PS(t2, t0, _mm256_cvtepi32_ps(mask.mMask[0]));
+            __m256 t4 = UME_MM256_BLENDV_PS(t2, t1, _mm256_cvtepi32_ps(mask.mMask[1]));
 
             __m256i t5 = _mm256_cvtps_epi32(t3);
             __m256i t6 = _mm256_cvtps_epi32(t4);
@@ -778,13 +804,48 @@ namespace SIMD {
         // MFLOOR    - Masked floor
         // CEIL      - Ceil
         // MCEIL     - Masked ceil
-        // ISFIN     - Is finite
-        // ISINF     - Is infinite (INF)
-        // ISAN      - Is a number
-        // ISNAN     - Is 'Not a Number (NaN)'
-        // ISSUB     - Is subnormal
-        // ISZERO    - Is zero
-        // ISZEROSUB - Is zero or subnormal
+        // ISFIN
+        UME_FORCE_INLINE SIMDVecMask<16> isfin() const {
+            __m256i t0 = _mm256_castps_si256(finiteLanes(mVec[0]));
+            __m256i t1 = _mm256_castps_si256(finiteLanes(mVec[1]));
+            return SIMDVecMask<16>(t0, t1);
+        }
+        // ISINF
+        UME_FORCE_INLINE SIMDVecMask<16> isinf() const {
+            __m256i t0 = _mm256_castps_si256(infiniteLanes(mVec[0]));
+            __m256i t1 = _mm256_castps_si256(infiniteLanes(mVec[1]));
+            return SIMDVecMask<16>(t0, t1);
+        }
+        // ISAN
+        UME_FORCE_INLINE SIMDVecMask<16> isan() const {
+            __m256i t0 = _mm256_castps_si256(finiteLanes(mVec[0]));
+            __m256i t1 = _mm256_castps_si256(finiteLanes(mVec[1]));
+            return SIMDVecMask<16>(t0, t1);
+        }
+        // ISNAN
+        UME_FORCE_INLINE SIMDVecMask<16> isnan() const {
+            __m256i t0 = _mm256_castps_si256(nanLanes(mVec[0]));
+            __m256i t1 = _mm256_castps_si256(nanLanes(mVec[1]));
+            return SIMDVecMask<16>(t0, t1);
+        }
+        // ISSUB
+        UME_FORCE_INLINE SIMDVecMask<16> issub() const {
+            __m256i t0 = _mm256_castps_si256(subnormalLanes(mVec[0]));
+            __m256i t1 = _mm256_castps_si256(subnormalLanes(mVec[1]));
+            return SIMDVecMask<16>(t0, t1);
+        }
+        // ISZERO
+        UME_FORCE_INLINE SIMDVecMask<16> iszero() const {
+            __m256i t0 = _mm256_castps_si256(zeroLanes(mVec[0]));
+            __m256i t1 = _mm256_castps_si256(zeroLanes(mVec[1]));
+            return SIMDVecMask<16>(t0, t1);
+        }
+        // ISZEROSUB
+        UME_FORCE_INLINE SIMDVecMask<16> iszerosub() const {
+            __m256i t0 = _mm256_castps_si256(zeroOrSubnormalLanes(mVec[0]));
+            __m256i t1 = _mm256_castps_si256(zeroOrSubnormalLanes(mVec[1]));
+            return SIMDVecMask<16>(t0, t1);
+        }
         // EXP
         UME_FORCE_INLINE SIMDVec_f exp() const {
             return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
@@ -794,15 +855,65 @@ namespace SIMD {
             return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
         }
         // LOG
+        UME_FORCE_INLINE SIMDVec_f log() const {
+            // Evaluate the SIMDVec_f<float, 8> kernel on each register.
+            __m256 t0 = SIMDVec_f<float, 8>(mVec[0]).log().mVec;
+            __m256 t1 = SIMDVec_f<float, 8>(mVec[1]).log().mVec;
+            return SIMDVec_f(t0, t1);
+        }
         // MLOG
+        UME_FORCE_INLINE SIMDVec_f log(SIMDVecMask<16> const & mask) const {
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, log());
+            return t0;
+        }
         // LOG2
         // MLOG2
         // LOG10
         // MLOG10
         // SIN       - Sine
+        UME_FORCE_INLINE SIMDVec_f sin() const {
+            __m256 t0 = SIMDVec_f<float, 8>(mVec[0]).sin().mVec;
+            __m256 t1 = SIMDVec_f<float, 8>(mVec[1]).sin().mVec;
+            return SIMDVec_f(t0, t1);
+        }
         // MSIN      - Masked sine
+        UME_FORCE_INLINE SIMDVec_f sin(SIMDVecMask<16> const & mask) const {
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, sin());
+            return t0;
+        }
         // COS       - Cosine
+        UME_FORCE_INLINE SIMDVec_f cos() const {
+            __m256 t0 = SIMDVec_f<float, 8>(mVec[0]).cos().mVec;
+            __m256 t1 = SIMDVec_f<float, 8>(mVec[1]).cos().mVec;
+            return SIMDVec_f(t0, t1);
+        }
         // MCOS      - Masked cosine
+        UME_FORCE_INLINE SIMDVec_f cos(SIMDVecMask<16> const & mask) const {
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, cos());
+            return t0;
+        }
+        // SINCOS
+        UME_FORCE_INLINE void sincos(SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            SIMDVec_f<float, 8> t0, t1;
+            SIMDVec_f<float, 8>(mVec[0]).sincos(t0, t1);
+            sinvec.mVec[0] = t0.mVec;
+            cosvec.mVec[0] = t1.mVec;
+            SIMDVec_f<float, 8>(mVec[1]).sincos(t0, t1);
+            sinvec.mVec[1] = t0.mVec;
+            cosvec.mVec[1] = t1.mVec;
+        }
+        // MSINCOS
+        UME_FORCE_INLINE void sincos(SIMDVecMask<16> const & mask, SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            SIMDVec_f t0, t1;
+            sincos(t0, t1);
+            sinvec = *this;
+            cosvec = *this;
+            sinvec.assign(mask, t0);
+            cosvec.assign(mask, t1);
+        }
         // TAN       - Tangent
         // MTAN      - Masked tangent
         // CTAN      - Cotangent
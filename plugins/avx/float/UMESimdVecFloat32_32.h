@@ -36,7 +36,7 @@
 
 #include "../../../UMESimdInterface.h"
 
-#define BLEND(a_256, b_256, mask_256i) _mm256_blendv_ps(a_256, b_256, _mm256_castsi256_ps(mask_256i))
+#define BLEND(a_256, b_256, mask_256i) UME_MM256_BLENDV_PS(a_256, b_256, _mm256_castsi256_ps(mask_256i))
 
 namespace UME {
 namespace SIMD {
@@ -70,6 +70,32 @@ namespace SIMD {
             this->mVec[3] = x3;
         }
 
+        // Lane classification kernels used by ISFIN..ISZEROSUB. Lanes for which
+        // the predicate holds are set to all ones.
+        static UME_FORCE_INLINE __m256 absLanes(__m256 const & a) {
+            return _mm256_and_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF)));
+        }
+        static UME_FORCE_INLINE __m256 finiteLanes(__m256 const & a) {
+            __m256 t0 = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+            return _mm256_cmp_ps(absLanes(a), t0, _CMP_LT_OQ);
+        }
+        static UME_FORCE_INLINE __m256 infiniteLanes(__m256 const & a) {
+            __m256 t0 = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+            return _mm256_cmp_ps(absLanes(a), t0, _CMP_EQ_OQ);
+        }
+        static UME_FORCE_INLINE __m256 nanLanes(__m256 const & a) {
+            return _mm256_cmp_ps(a, a, _CMP_UNORD_Q);
+        }
+        static UME_FORCE_INLINE __m256 zeroLanes(__m256 const & a) {
+            return _mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_EQ_OQ);
+        }
+        static UME_FORCE_INLINE __m256 zeroOrSubnormalLanes(__m256 const & a) {
+            __m256 t0 = _mm256_set1_ps(std::numeric_limits<float>::min());
+            return _mm256_cmp_ps(absLanes(a), t0, _CMP_LT_OQ);
+        }
+        static UME_FORCE_INLINE __m256 subnormalLanes(__m256 const & a) {
+            return _mm256_andnot_ps(zeroLanes(a), zeroOrSubnormalLanes(a));
+        }
     public:
         // ZERO-CONSTR - Zero element constructor 
         UME_FORCE_INLINE SIMDVec_f() {}
@@ -211,27 +237,16 @@ namespace SIMD {
         // MASSIGNS
         UME_FORCE_INLINE SIMDVec_f & assign(SIMDVecMask<32> const & mask, float b) {
             __m256 t0 = _mm256_set1_ps(b);
-            mVec[0] = _mm256_blendv_ps(mVec[0], t0, _mm256_cvtepi32_ps(mask.mMask[0]));
-            mVec[1] = _mm256_blendv_ps(mVec[1], t0, _mm256_cvtepi32_ps(mask.mMask[1]));
-            mVec[2] = _mm256_blendv_ps(mVec[2], t0, _mm256_cvtepi32_ps(mask.mMask[2]));
-            mVec[3] = _mm256_blendv_ps(mVec[3], t0, _mm256_cvtepi32_ps(mask.mMask[3]));
+            mVec[0] = UME_MM256_BLENDV_PS(mVec[0], t0, _mm256_cvtepi32_ps(mask.mMask[0]));
+            mVec[1] = UME_MM256_BLENDV_PS(mVec[1], t0, _mm256_cvtepi32_ps(mask.mMask[1]));
+            mVec[2] = UME_MM256_BLENDV_PS(mVec[2], t0, _mm256_cvtepi32_ps(mask.mMask[2]));
+            mVec[3] = UME_MM256_BLENDV_PS(mVec[3], t0, _mm256_cvtepi32_ps(mask.mMask[3]));
             return *this;
         }
 
-        // PREFETCH0  
-        static UME_FORCE_INLINE void prefetch0(float *p) {
-            _mm_prefetch((const char *)p, _MM_HINT_T0);
-        }
-
+        // PREFETCH0
         // PREFETCH1
-        static UME_FORCE_INLINE void prefetch1(float *p) {
-            _mm_prefetch((const char *)p, _MM_HINT_T1);
-        }
-
         // PREFETCH2
-        static UME_FORCE_INLINE void prefetch2(float *p) {
-            _mm_prefetch((const char *)p, _MM_HINT_T2);
-        }
 
         //(Memory access)
         // LOAD
@@ -248,10 +263,10 @@ namespace SIMD {
             __m256 t1 = _mm256_loadu_ps(p + 8);
             __m256 t2 = _mm256_loadu_ps(p + 16);
             __m256 t3 = _mm256_loadu_ps(p + 24);
-            mVec[0] = _mm256_blendv_ps(mVec[0], t0, _mm256_cvtepi32_ps(mask.mMask[0]));
-            mVec[1] = _mm256_blendv_ps(mVec[1], t1, _mm256_cvtepi32_ps(mask.mMask[1]));
-            mVec[2] = _mm256_blendv_ps(mVec[2], t2, _mm256_cvtepi32_ps(mask.mMask[2]));
-            mVec[3] = _mm256_blendv_ps(mVec[3], t3, _mm256_cvtepi32_ps(mask.mMask[3]));
+            mVec[0] = UME_MM256_BLENDV_PS(mVec[0], t0, _mm256_cvtepi32_ps(mask.mMask[0]));
+            mVec[1] = UME_MM256_BLENDV_PS(mVec[1], t1, _mm256_cvtepi32_ps(mask.mMask[1]));
+            mVec[2] = UME_MM256_BLENDV_PS(mVec[2], t2, _mm256_cvtepi32_ps(mask.mMask[2]));
+            mVec[3] = UME_MM256_BLENDV_PS(mVec[3], t3, _mm256_cvtepi32_ps(mask.mMask[3]));
             return *this;
         }
         // LOADA
@@ -269,10 +284,10 @@ namespace SIMD {
             __m256 t1 = _mm256_load_ps(p + 8);
             __m256 t2 = _mm256_load_ps(p + 16);
             __m256 t3 = _mm256_load_ps(p + 24);
-            mVec[0] = _mm256_blendv_ps(mVec[0], t0, _mm256_cvtepi32_ps(mask.mMask[0]));
-            mVec[1] = _mm256_blendv_ps(mVec[1], t1, _mm256_cvtepi32_ps(mask.mMask[1]));
-            mVec[2] = _mm256_blendv_ps(mVec[2], t2, _mm256_cvtepi32_ps(mask.mMask[2]));
-            mVec[3] = _mm256_blendv_ps(mVec[3], t3, _mm256_cvtepi32_ps(mask.mMask[3]));
+            mVec[0] = UME_MM256_BLENDV_PS(mVec[0], t0, _mm256_cvtepi32_ps(mask.mMask[0]));
+            mVec[1] = UME_MM256_BLENDV_PS(mVec[1], t1, _mm256_cvtepi32_ps(mask.mMask[1]));
+            mVec[2] = UME_MM256_BLENDV_PS(mVec[2], t2, _mm256_cvtepi32_ps(mask.mMask[2]));
+            mVec[3] = UME_MM256_BLENDV_PS(mVec[3], t3, _mm256_cvtepi32_ps(mask.mMask[3]));
             return *this;
         }
         // STORE
@@ -289,10 +304,10 @@ namespace SIMD {
             __m256 t1 = _mm256_loadu_ps(p + 8);
             __m256 t2 = _mm256_loadu_ps(p + 16);
             __m256 t3 = _mm256_loadu_ps(p + 24);
-            __m256 t4 = _mm256_blendv_ps(t0, mVec[0], _mm256_cvtepi32_ps(mask.mMask[0]));
-            __m256 t5 = _mm256_blendv_ps(t1, mVec[1], _mm256_cvtepi32_ps(mask.mMask[1]));
-            __m256 t6 = _mm256_blendv_ps(t2, mVec[2], _mm256_cvtepi32_ps(mask.mMask[2]));
-            __m256 t7 = _mm256_blendv_ps(t3, mVec[3], _mm256_cvtepi32_ps(mask.mMask[3]));
+            __m256 t4 = UME_MM256_BLENDV_PS(t0, mVec[0], _mm256_cvtepi32_ps(mask.mMask[0]));
+            __m256 t5 = UME_MM256_BLENDV_PS(t1, mVec[1], _mm256_cvtepi32_ps(mask.mMask[1]));
+            __m256 t6 = UME_MM256_BLENDV_PS(t2, mVec[2], _mm256_cvtepi32_ps(mask.mMask[2]));
+            __m256 t7 = UME_MM256_BLENDV_PS(t3, mVec[3], _mm256_cvtepi32_ps(mask.mMask[3]));
             _mm256_storeu_ps(p, t4);
             _mm256_storeu_ps(p + 8, t5);
             _mm256_storeu_ps(p + 16, t6);
@@ -313,10 +328,10 @@ namespace SIMD {
             __m256 t1 = _mm256_load_ps(p + 8);
             __m256 t2 = _mm256_load_ps(p + 16);
             __m256 t3 = _mm256_load_ps(p + 24);
-            __m256 t4 = _mm256_blendv_ps(t0, mVec[0], _mm256_cvtepi32_ps(mask.mMask[0]));
-            __m256 t5 = _mm256_blendv_ps(t1, mVec[1], _mm256_cvtepi32_ps(mask.mMask[1]));
-            __m256 t6 = _mm256_blendv_ps(t2, mVec[2], _mm256_cvtepi32_ps(mask.mMask[2]));
-            __m256 t7 = _mm256_blendv_ps(t3, mVec[3], _mm256_cvtepi32_ps(mask.mMask[3]));
+            __m256 t4 = UME_MM256_BLENDV_PS(t0, mVec[0], _mm256_cvtepi32_ps(mask.mMask[0]));
+            __m256 t5 = UME_MM256_BLENDV_PS(t1, mVec[1], _mm256_cvtepi32_ps(mask.mMask[1]));
+            __m256 t6 = UME_MM256_BLENDV_PS(t2, mVec[2], _mm256_cvtepi32_ps(mask.mMask[2]));
+            __m256 t7 = UME_MM256_BLENDV_PS(t3, mVec[3], _mm256_cvtepi32_ps(mask.mMask[3]));
             _mm256_storeu_ps(p, t4);
             _mm256_storeu_ps(p + 8, t5);
             _mm256_storeu_ps(p + 16, t6);
@@ -342,10 +357,10 @@ namespace SIMD {
             __m256 t1 = _mm256_add_ps(mVec[1], b.mVec[1]);
             __m256 t2 = _mm256_add_ps(mVec[2], b.mVec[2]);
             __m256 t3 = _mm256_add_ps(mVec[3], b.mVec[3]);
-            __m256 t4 = _mm256_blendv_ps(mVec[0], t0, _mm256_cvtepi32_ps(mask.mMask[0]));
-            __m256 t5 = _mm256_blendv_ps(mVec[1], t1, _mm256_cvtepi32_ps(mask.mMask[1]));
-            __m256 t6 = _mm256_blendv_ps(mVec[2], t2, _mm256_cvtepi32_ps(mask.mMask[2]));
-            __m256 t7 = _mm256_blendv_ps(mVec[3], t3, _mm256_cvtepi32_ps(mask.mMask[3]));
+            __m256 t4 = UME_MM256_BLENDV_PS(mVec[0], t0, _mm256_cvtepi32_ps(mask.mMask[0]));
+            __m256 t5 = UME_MM256_BLENDV_PS(mVec[1], t1, _mm256_cvtepi32_ps(mask.mMask[1]));
+            __m256 t6 = UME_MM256_BLENDV_PS(mVec[2], t2, _mm256_cvtepi32_ps(mask.mMask[2]));
+            __m256 t7 = UME_MM256_BLENDV_PS(mVec[3], t3, _mm256_cvtepi32_ps(mask.mMask[3]));
             return SIMDVec_f(t4, t5, t6, t7);
         }
         // ADDS     - Add with scalar
@@ -367,10 +382,10 @@ namespace SIMD {
             __m256 t2 = _mm256_add_ps(mVec[1], t0);
             __m256 t3 = _mm256_add_ps(mVec[2], t0);
             __m256 t4 = _mm256_add_ps(mVec[3], t0);
-            __m256 t5 = _mm256_blendv_ps(mVec[0], t1, _mm256_cvtepi32_ps(mask.mMask[0]));
-            __m256 t6 = _mm256_blendv_ps(mVec[1], t2, _mm256_cvtepi32_ps(mask.mMask[1]));
-            __m256 t7 = _mm256_blendv_ps(mVec[2], t3, _mm256_cvtepi32_ps(mask.mMask[2]));
-            __m256 t8 = _mm256_blendv_ps(mVec[3], t4, _mm256_cvtepi32_ps(mask.mMask[3]));
+            __m256 t5 = UME_MM256_BLENDV_PS(mVec[0], t1, _mm256_cvtepi32_ps(mask.mMask[0]));
+            __m256 t6 = UME_MM256_BLENDV_PS(mVec[1], t2, _mm256_cvtepi32_ps(mask.mMask[1]));
+            __m256 t7 = UME_MM256_BLENDV_PS(mVec[2], t3, _mm256_cvtepi32_ps(mask.mMask[2]));
+            __m256 t8 = UME_MM256_BLENDV_PS(mVec[3], t4, _mm256_cvtepi32_ps(mask.mMask[3]));
             return SIMDVec_f(t5, t6, t7, t8);
         }
         // ADDVA    - Add with vector and assign
@@ -390,10 +405,10 @@ namespace SIMD {
             __m256 t1 = _mm256_add_ps(mVec[1], b.mVec[1]);
             __m256 t2 = _mm256_add_ps(mVec[2], b.mVec[2]);
             __m256 t3 = _mm256_add_ps(mVec[3], b.mVec[3]);
-            mVec[0] = _mm256_blendv_ps(mVec[0], t0, _mm256_cvtepi32_ps(mask.mMask[0]));
-            mVec[1] = _mm256_blendv_ps(mVec[1], t1, _mm256_cvtepi32_ps(mask.mMask[1]));
-            mVec[2] = _mm256_blendv_ps(mVec[2], t2, _mm256_cvtepi32_ps(mask.mMask[2]));
-            mVec[3] = _mm256_blendv_ps(mVec[3], t3, _mm256_cvtepi32_ps(mask.mMask[3]));
+            mVec[0] = UME_MM256_BLENDV_PS(mVec[0], t0, _mm256_cvtepi32_ps(mask.mMask[0]));
+            mVec[1] = UME_MM256_BLENDV_PS(mVec[1], t1, _mm256_cvtepi32_ps(mask.mMask[1]));
+            mVec[2] = UME_MM256_BLENDV_PS(mVec[2], t2, _mm256_cvtepi32_ps(mask.mMask[2]));
+            mVec[3] = UME_MM256_BLENDV_PS(mVec[3], t3, _mm256_cvtepi32_ps(mask.mMask[3]));
             return *this;
         }
         // ADDSA    - Add with scalar and assign
@@ -415,10 +430,10 @@ namespace SIMD {
             __m256 t2 = _mm256_add_ps(mVec[1], t0);
             __m256 t3 = _mm256_add_ps(mVec[2], t0);
             __m256 t4 = _mm256_add_ps(mVec[3], t0);
-            mVec[0] = _mm256_blendv_ps(mVec[0], t1, _mm256_cvtepi32_ps(mask.mMask[0]));
-            mVec[1] = _mm256_blendv_ps(mVec[1], t2, _mm256_cvtepi32_ps(mask.mMask[1]));
-            mVec[2] = _mm256_blendv_ps(mVec[2], t3, _mm256_cvtepi32_ps(mask.mMask[2]));
-            mVec[3] = _mm256_blendv_ps(mVec[3], t4, _mm256_cvtepi32_ps(mask.mMask[3]));
+            mVec[0] = UME_MM256_BLENDV_PS(mVec[0], t1, _mm256_cvtepi32_ps(mask.mMask[0]));
+            mVec[1] = UME_MM256_BLENDV_PS(mVec[1], t2, _mm256_cvtepi32_ps(mask.mMask[1]));
+            mVec[2] = UME_MM256_BLENDV_PS(mVec[2], t3, _mm256_cvtepi32_ps(mask.mMask[2]));
+            mVec[3] = UME_MM256_BLENDV_PS(mVec[3], t4, _mm256_cvtepi32_ps(mask.mMask[3]));
             return *this;
         }
         // SADDV    - Saturated add with vector
@@ -524,10 +539,10 @@ namespace SIMD {
             __m256 t1 = _mm256_mul_ps(mVec[1], b.mVec[1]);
             __m256 t2 = _mm256_mul_ps(mVec[2], b.mVec[2]);
             __m256 t3 = _mm256_mul_ps(mVec[3], b.mVec[3]);
-            __m256 t4 = _mm256_blendv_ps(mVec[0], t0, _mm256_cvtepi32_ps(mask.mMask[0]));
-            __m256 t5 = _mm256_blendv_ps(mVec[1], t1, _mm256_cvtepi32_ps(mask.mMask[1]));
-            __m256 t6 = _mm256_blendv_ps(mVec[2], t2, _mm256_cvtepi32_ps(mask.mMask[2]));
-            __m256 t7 = _mm256_blendv_ps(mVec[3], t3, _mm256_cvtepi32_ps(mask.mMask[3]));
+            __m256 t4 = UME_MM256_BLENDV_PS(mVec[0], t0, _mm256_cvtepi32_ps(mask.mMask[0]));
+            __m256 t5 = UME_MM256_BLENDV_PS(mVec[1], t1, _mm256_cvtepi32_ps(mask.mMask[1]));
+            __m256 t6 = UME_MM256_BLENDV_PS(mVec[2], t2, _mm256_cvtepi32_ps(mask.mMask[2]));
+            __m256 t7 = UME_MM256_BLENDV_PS(mVec[3], t3, _mm256_cvtepi32_ps(mask.mMask[3]));
             return SIMDVec_f(t4, t5, t6, t7);
         }
         // MULS
@@ -549,10 +564,10 @@ namespace SIMD {
             __m256 t2 = _mm256_mul_ps(mVec[1], t0);
             __m256 t3 = _mm256_mul_ps(mVec[2], t0);
             __m256 t4 = _mm256_mul_ps(mVec[3], t0);
-            __m256 t5 = _mm256_blendv_ps(mVec[0], t1, _mm256_cvtepi32_ps(mask.mMask[0]));
-            __m256 t6 = _mm256_blendv_ps(mVec[1], t2, _mm256_cvtepi32_ps(mask.mMask[1]));
-            __m256 t7 = _mm256_blendv_ps(mVec[2], t3, _mm256_cvtepi32_ps(mask.mMask[2]));
-            __m256 t8 = _mm256_blendv_ps(mVec[3], t4, _mm256_cvtepi32_ps(mask.mMask[3]));
+            __m256 t5 = UME_MM256_BLENDV_PS(mVec[0], t1, _mm256_cvtepi32_ps(mask.mMask[0]));
+            __m256 t6 = UME_MM256_BLENDV_PS(mVec[1], t2, _mm256_cvtepi32_ps(mask.mMask[1]));
+            __m256 t7 = UME_MM256_BLENDV_PS(mVec[2], t3, _mm256_cvtepi32_ps(mask.mMask[2]));
+            __m256 t8 = UME_MM256_BLENDV_PS(mVec[3], t4, _mm256_cvtepi32_ps(mask.mMask[3]));
             return SIMDVec_f(t5, t6, t7, t8);
         }
         // MULVA  - Multiplication with vector and assign
@@ -671,10 +686,10 @@ namespace SIMD {
             __m256 t2 = _mm256_add_ps(_mm256_mul_ps(mVec[2], a.mVec[2]), b.mVec[2]);
             __m256 t3 = _mm256_add_ps(_mm256_mul_ps(mVec[3], a.mVec[3]), b.mVec[3]);
 #endif
-            __m256 t4 = _mm256_blendv_ps(mVec[0], t0, _mm256_cvtepi32_ps(mask.mMask[0]));
-            __m256 t5 = _mm256_blendv_ps(mVec[1], t1, _mm256_cvtepi32_ps(mask.mMask[1]));
-            __m256 t6 = _mm256_blendv_ps(mVec[2], t2, _mm256_cvtepi32_ps(mask.mMask[2]));
-            __m256 t7 = _mm256_blendv_ps(mVec[3], t3, _mm256_cvtepi32_ps(mask.mMask[3]));
+            __m256 t4 = UME_MM256_BLENDV_PS(mVec[0], t0, _mm256_cvtepi32_ps(mask.mMask[0]));
+            __m256 t5 = UME_MM256_BLENDV_PS(mVec[1], t1, _mm256_cvtepi32_ps(mask.mMask[1]));
+            __m256 t6 = UME_MM256_BLENDV_PS(mVec[2], t2, _mm256_cvtepi32_ps(mask.mMask[2]));
+            __m256 t7 = UME_MM256_BLENDV_PS(mVec[3], t3, _mm256_cvtepi32_ps(mask.mMask[3]));
 
             return SIMDVec_f(t4, t5, t6, t7);
         }
@@ -799,13 +814,62 @@ namespace SIMD {
         // MFLOOR    - Masked floor
         // CEIL      - Ceil
         // MCEIL     - Masked ceil
-        // ISFIN     - Is finite
-        // ISINF     - Is infinite (INF)
-        // ISAN      - Is a number
-        // ISNAN     - Is 'Not a Number (NaN)'
-        // ISSUB     - Is subnormal
-        // ISZERO    - Is zero
-        // ISZEROSUB - Is zero or subnormal
+        // ISFIN
+        UME_FORCE_INLINE SIMDVecMask<32> isfin() const {
+            __m256i t0 = _mm256_castps_si256(finiteLanes(mVec[0]));
+            __m256i t1 = _mm256_castps_si256(finiteLanes(mVec[1]));
+            __m256i t2 = _mm256_castps_si256(finiteLanes(mVec[2]));
+            __m256i t3 = _mm256_castps_si256(finiteLanes(mVec[3]));
+            return SIMDVecMask<32>(t0, t1, t2, t3);
+        }
+        // ISINF
+        UME_FORCE_INLINE SIMDVecMask<32> isinf() const {
+            __m256i t0 = _mm256_castps_si256(infiniteLanes(mVec[0]));
+            __m256i t1 = _mm256_castps_si256(infiniteLanes(mVec[1]));
+            __m256i t2 = _mm256_castps_si256(infiniteLanes(mVec[2]));
+            __m256i t3 = _mm256_castps_si256(infiniteLanes(mVec[3]));
+            return SIMDVecMask<32>(t0, t1, t2, t3);
+        }
+        // ISAN
+        UME_FORCE_INLINE SIMDVecMask<32> isan() const {
+            __m256i t0 = _mm256_castps_si256(finiteLanes(mVec[0]));
+            __m256i t1 = _mm256_castps_si256(finiteLanes(mVec[1]));
+            __m256i t2 = _mm256_castps_si256(finiteLanes(mVec[2]));
+            __m256i t3 = _mm256_castps_si256(finiteLanes(mVec[3]));
+            return SIMDVecMask<32>(t0, t1, t2, t3);
+        }
+        // ISNAN
+        UME_FORCE_INLINE SIMDVecMask<32> isnan() const {
+            __m256i t0 = _mm256_castps_si256(nanLanes(mVec[0]));
+            __m256i t1 = _mm256_castps_si256(nanLanes(mVec[1]));
+            __m256i t2 = _mm256_castps_si256(nanLanes(mVec[2]));
+            __m256i t3 = _mm256_castps_si256(nanLanes(mVec[3]));
+            return SIMDVecMask<32>(t0, t1, t2, t3);
+        }
+        // ISSUB
+        UME_FORCE_INLINE SIMDVecMask<32> issub() const {
+            __m256i t0 = _mm256_castps_si256(subnormalLanes(mVec[0]));
+            __m256i t1 = _mm256_castps_si256(subnormalLanes(mVec[1]));
+            __m256i t2 = _mm256_castps_si256(subnormalLanes(mVec[2]));
+            __m256i t3 = _mm256_castps_si256(subnormalLanes(mVec[3]));
+            return SIMDVecMask<32>(t0, t1, t2, t3);
+        }
+        // ISZERO
+        UME_FORCE_INLINE SIMDVecMask<32> iszero() const {
+            __m256i t0 = _mm256_castps_si256(zeroLanes(mVec[0]));
+            __m256i t1 = _mm256_castps_si256(zeroLanes(mVec[1]));
+            __m256i t2 = _mm256_castps_si256(zeroLanes(mVec[2]));
+            __m256i t3 = _mm256_castps_si256(zeroLanes(mVec[3]));
+            return SIMDVecMask<32>(t0, t1, t2, t3);
+        }
+        // ISZEROSUB
+        UME_FORCE_INLINE SIMDVecMask<32> iszerosub() const {
+            __m256i t0 = _mm256_castps_si256(zeroOrSubnormalLanes(mVec[0]));
+            __m256i t1 = _mm256_castps_si256(zeroOrSubnormalLanes(mVec[1]));
+            __m256i t2 = _mm256_castps_si256(zeroOrSubnormalLanes(mVec[2]));
+            __m256i t3 = _mm256_castps_si256(zeroOrSubnormalLanes(mVec[3]));
+            return SIMDVecMask<32>(t0, t1, t2, t3);
+        }
         
         // EXP
         UME_FORCE_INLINE SIMDVec_f exp() const {
@@ -816,15 +880,77 @@ namespace SIMD {
             return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(mask, *this);
         }
         // LOG
+        UME_FORCE_INLINE SIMDVec_f log() const {
+            // Evaluate the SIMDVec_f<float, 8> kernel on each register.
+            __m256 t0 = SIMDVec_f<float, 8>(mVec[0]).log().mVec;
+            __m256 t1 = SIMDVec_f<float, 8>(mVec[1]).log().mVec;
+            __m256 t2 = SIMDVec_f<float, 8>(mVec[2]).log().mVec;
+            __m256 t3 = SIMDVec_f<float, 8>(mVec[3]).log().mVec;
+            return SIMDVec_f(t0, t1, t2, t3);
+        }
         // MLOG
+        UME_FORCE_INLINE SIMDVec_f log(SIMDVecMask<32> const & mask) const {
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, log());
+            return t0;
+        }
         // LOG2
         // MLOG2
         // LOG10
         // MLOG10
         // SIN       - Sine
+        UME_FORCE_INLINE SIMDVec_f sin() const {
+            __m256 t0 = SIMDVec_f<float, 8>(mVec[0]).sin().mVec;
+            __m256 t1 = SIMDVec_f<float, 8>(mVec[1]).sin().mVec;
+            __m256 t2 = SIMDVec_f<float, 8>(mVec[2]).sin().mVec;
+            __m256 t3 = SIMDVec_f<float, 8>(mVec[3]).sin().mVec;
+            return SIMDVec_f(t0, t1, t2, t3);
+        }
         // MSIN      - Masked sine
+        UME_FORCE_INLINE SIMDVec_f sin(SIMDVecMask<32> const & mask) const {
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, sin());
+            return t0;
+        }
         // COS       - Cosine
+        UME_FORCE_INLINE SIMDVec_f cos() const {
+            __m256 t0 = SIMDVec_f<float, 8>(mVec[0]).cos().mVec;
+            __m256 t1 = SIMDVec_f<float, 8>(mVec[1]).cos().mVec;
+            __m256 t2 = SIMDVec_f<float, 8>(mVec[2]).cos().mVec;
+            __m256 t3 = SIMDVec_f<float, 8>(mVec[3]).cos().mVec;
+            return SIMDVec_f(t0, t1, t2, t3);
+        }
         // MCOS      - Masked cosine
+        UME_FORCE_INLINE SIMDVec_f cos(SIMDVecMask<32> const & mask) const {
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, cos());
+            return t0;
+        }
+        // SINCOS
+        UME_FORCE_INLINE void sincos(SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            SIMDVec_f<float, 8> t0, t1;
+            SIMDVec_f<float, 8>(mVec[0]).sincos(t0, t1);
+            sinvec.mVec[0] = t0.mVec;
+            cosvec.mVec[0] = t1.mVec;
+            SIMDVec_f<float, 8>(mVec[1]).sincos(t0, t1);
+            sinvec.mVec[1] = t0.mVec;
+            cosvec.mVec[1] = t1.mVec;
+            SIMDVec_f<float, 8>(mVec[2]).sincos(t0, t1);
+            sinvec.mVec[2] = t0.mVec;
+            cosvec.mVec[2] = t1.mVec;
+            SIMDVec_f<float, 8>(mVec[3]).sincos(t0, t1);
+            sinvec.mVec[3] = t0.mVec;
+            cosvec.mVec[3] = t1.mVec;
+        }
+        // MSINCOS
+        UME_FORCE_INLINE void sincos(SIMDVecMask<32> const & mask, SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            SIMDVec_f t0, t1;
+            sincos(t0, t1);
+            sinvec = *this;
+            cosvec = *this;
+            sinvec.assign(mask, t0);
+            cosvec.assign(mask, t1);
+        }
         // TAN       - Tangent
         // MTAN      - Masked tangent
         // CTAN      - Cotangent
@@ -36,7 +36,7 @@
 
 #include "../../../UMESimdInterface.h"
 
-#define BLEND(a_256, b_256, mask_256i) _mm256_blendv_ps(a_256, b_256, _mm256_castsi256_ps(mask_256i))
+#define BLEND(a_256, b_256, mask_256i) UME_MM256_BLENDV_PS(a_256, b_256, _mm256_castsi256_ps(mask_256i))
 
 namespace UME {
 namespace SIMD {
@@ -63,6 +63,7 @@ namespace SIMD {
         friend class SIMDVec_u<uint32_t, 8>;
 
         friend class SIMDVec_f<float, 16>;
+        friend class SIMDVec_f<float, 32>;
     private:
         __m256 mVec;
 
@@ -70,6 +71,32 @@ namespace SIMD {
             this->mVec = x;
         }
 
+        // Lane classification kernels used by ISFIN..ISZEROSUB. Lanes for which
+        // the predicate holds are set to all ones.
+        static UME_FORCE_INLINE __m256 absLanes(__m256 const & a) {
+            return _mm256_and_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF)));
+        }
+        static UME_FORCE_INLINE __m256 finiteLanes(__m256 const & a) {
+            __m256 t0 = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+            return _mm256_cmp_ps(absLanes(a), t0, _CMP_LT_OQ);
+        }
+        static UME_FORCE_INLINE __m256 infiniteLanes(__m256 const & a) {
+            __m256 t0 = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+            return _mm256_cmp_ps(absLanes(a), t0, _CMP_EQ_OQ);
+        }
+        static UME_FORCE_INLINE __m256 nanLanes(__m256 const & a) {
+            return _mm256_cmp_ps(a, a, _CMP_UNORD_Q);
+        }
+        static UME_FORCE_INLINE __m256 zeroLanes(__m256 const & a) {
+            return _mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_EQ_OQ);
+        }
+        static UME_FORCE_INLINE __m256 zeroOrSubnormalLanes(__m256 const & a) {
+            __m256 t0 = _mm256_set1_ps(std::numeric_limits<float>::min());
+            return _mm256_cmp_ps(absLanes(a), t0, _CMP_LT_OQ);
+        }
+        static UME_FORCE_INLINE __m256 subnormalLanes(__m256 const & a) {
+            return _mm256_andnot_ps(zeroLanes(a), zeroOrSubnormalLanes(a));
+        }
     public:
         // ZERO-CONSTR
         UME_FORCE_INLINE SIMDVec_f() {}
@@ -168,7 +195,7 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<8> const & mask, float const * p) {
-            __m256 t0 = _mm256_loadu_ps(p);
+            __m256 t0 = _mm256_maskload_ps(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -183,6 +210,11 @@ namespace SIMD {
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
+        // LOADN
+        UME_FORCE_INLINE SIMDVec_f & loadn(uint32_t n, float const * p) {
+            mVec = _mm256_maskload_ps(p, SIMDVecMask<8>::prefix(n).mMask);
+            return *this;
+        }
         // STORE
         UME_FORCE_INLINE float* store(float* p) const {
             _mm256_storeu_ps(p, mVec);
@@ -193,6 +225,11 @@ namespace SIMD {
             _mm256_maskstore_ps(p, mask.mMask, mVec);
             return p;
         }
+        // STOREN
+        UME_FORCE_INLINE float* storen(uint32_t n, float * p) const {
+            _mm256_maskstore_ps(p, SIMDVecMask<8>::prefix(n).mMask, mVec);
+            return p;
+        }
         // STOREA
         UME_FORCE_INLINE float* storea(float* p) const {
             _mm256_store_ps(p, mVec);
@@ -207,7 +244,41 @@ namespace SIMD {
         // BLENDV
         // BLENDS
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_f swizzle(SIMDSwizzle<8> const & sMask) const {
+            // Permute both 128-bit halves within lanes, then select per element
+            // using bit 2 of the index.
+            __m256 t0 = mVec;
+            __m256 t1 = _mm256_permute2f128_ps(t0, t0, 0x00);
+            __m256 t2 = _mm256_permute2f128_ps(t0, t0, 0x11);
+            __m256 t3 = _mm256_permutevar_ps(t1, sMask.mVec);
+            __m256 t4 = _mm256_permutevar_ps(t2, sMask.mVec);
+            __m256 t5 = _mm256_cmp_ps(_mm256_cvtepi32_ps(sMask.mVec), _mm256_set1_ps(3.5f), _CMP_GT_OQ);
+            __m256 t6 = UME_MM256_BLENDV_PS(t3, t4, t5);
+            return SIMDVec_f(t6);
+        }
+        template<int i0, int i1, int i2, int i3, int i4, int i5, int i6, int i7>
+        UME_FORCE_INLINE SIMDVec_f swizzle() const {
+            const int imm = (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6);
+            __m256 t0 = mVec;
+            // Patterns repeated in both 128-bit lanes need only an immediate shuffle.
+            if (i0 < 4 && i1 < 4 && i2 < 4 && i3 < 4 && i4 == i0 + 4 && i5 == i1 + 4 &&
+                i6 == i2 + 4 && i7 == i3 + 4) {
+                __m256 t1 = _mm256_permute_ps(t0, imm);
+                return SIMDVec_f(t1);
+            }
+            const int blendImm = (i0 > 3) | ((i1 > 3) << 1) | ((i2 > 3) << 2) | ((i3 > 3) << 3) | ((i4 > 3) << 4) | ((i5 > 3) << 5) | ((i6 > 3) << 6) | ((i7 > 3) << 7);
+            __m256i t3 = _mm256_setr_epi32(i0, i1, i2, i3, i4, i5, i6, i7);
+            __m256 t4 = _mm256_permute2f128_ps(t0, t0, 0x00);
+            __m256 t5 = _mm256_permute2f128_ps(t0, t0, 0x11);
+            __m256 t6 = _mm256_blend_ps(_mm256_permutevar_ps(t4, t3), _mm256_permutevar_ps(t5, t3), blendImm);
+            return SIMDVec_f(t6);
+        }
         // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_f & swizzlea(SIMDSwizzle<8> const & sMask) {
+            SIMDVec_f t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
@@ -270,13 +341,37 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVec_f const & b) const {
+            return add(b);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return add(mask, b);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(float b) const {
+            return add(b);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<8> const & mask, float b) const {
+            return add(mask, b);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVec_f const & b) {
+            return adda(b);
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<8> const & mask, SIMDVec_f const & b) {
+            return adda(mask, b);
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(float b) {
+            return adda(b);
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<8> const & mask, float b) {
+            return adda(mask, b);
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_f postinc() {
             __m256 t0 = _mm256_set1_ps(1);
@@ -368,13 +463,37 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVec_f const & b) const {
+            return sub(b);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return sub(mask, b);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(float b) const {
+            return sub(b);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<8> const & mask, float b) const {
+            return sub(mask, b);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVec_f const & b) {
+            return suba(b);
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<8> const & mask, SIMDVec_f const & b) {
+            return suba(mask, b);
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(float b) {
+            return suba(b);
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<8> const & mask, float b) {
+            return suba(mask, b);
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVec_f const & b) const {
             __m256 t0 = _mm256_sub_ps(b.mVec, mVec);
@@ -863,7 +982,7 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVecMask<8> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
 #ifdef FMA
             __m256 t0 = _mm256_fmadd_ps(this->mVec, b.mVec, c.mVec);
-            return _mm256_blendv_ps(this->mVec, t0, _mm256_cvtepi32_ps(mask.mMask));
+            return UME_MM256_BLENDV_PS(this->mVec, t0, _mm256_cvtepi32_ps(mask.mMask));
 #else
             __m256 t0 = _mm256_add_ps(_mm256_mul_ps(mVec, b.mVec), c.mVec);
             return BLEND(mVec, t0, mask.mMask);
@@ -1096,7 +1215,7 @@ namespace SIMD {
             __m256 t0 = _mm256_set1_ps(0.0f);
             __m256 t1 = _mm256_cmp_ps(mVec, t0, _CMP_LT_OS);
             __m256 t2 = _mm256_sub_ps(t0, mVec);
-            __m256 t3 = _mm256_blendv_ps(mVec, t2, t1);
+            __m256 t3 = UME_MM256_BLENDV_PS(mVec, t2, t1);
             return SIMDVec_f(t3);
         }
         // MABS
@@ -1105,7 +1224,7 @@ namespace SIMD {
             __m256 t1 = _mm256_cmp_ps(mVec, t0, _CMP_LT_OS);
             __m256 t2 = _mm256_and_ps(t1, _mm256_castsi256_ps(mask.mMask));
             __m256 t3 = _mm256_sub_ps(t0, mVec);
-            __m256 t4 = _mm256_blendv_ps(mVec, t3, t2);
+            __m256 t4 = UME_MM256_BLENDV_PS(mVec, t3, t2);
             return SIMDVec_f(t4);
         }
         // ABSA
@@ -1113,7 +1232,7 @@ namespace SIMD {
             __m256 t0 = _mm256_set1_ps(0.0f);
             __m256 t1 = _mm256_cmp_ps(mVec, t0, _CMP_LT_OS);
             __m256 t2 = _mm256_sub_ps(t0, mVec);
-            mVec = _mm256_blendv_ps(mVec, t2, t1);
+            mVec = UME_MM256_BLENDV_PS(mVec, t2, t1);
             return *this;
         }
         // MABSA
@@ -1122,7 +1241,7 @@ namespace SIMD {
             __m256 t1 = _mm256_cmp_ps(mVec, t0, _CMP_LT_OS);
             __m256 t2 = _mm256_and_ps(t1, _mm256_castsi256_ps(mask.mMask));
             __m256 t3 = _mm256_sub_ps(t0, mVec);
-            mVec = _mm256_blendv_ps(mVec, t3, t2);
+            mVec = UME_MM256_BLENDV_PS(mVec, t3, t2);
             return *this;
         }
         // CMPEQRV
@@ -1171,9 +1290,21 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256 t0 = _mm256_round_ps(mVec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
@@ -1220,12 +1351,33 @@ namespace SIMD {
             return SIMDVec_f(t1);
         }
         // ISFIN
+        UME_FORCE_INLINE SIMDVecMask<8> isfin() const {
+            return SIMDVecMask<8>(_mm256_castps_si256(finiteLanes(mVec)));
+        }
         // ISINF
+        UME_FORCE_INLINE SIMDVecMask<8> isinf() const {
+            return SIMDVecMask<8>(_mm256_castps_si256(infiniteLanes(mVec)));
+        }
         // ISAN
+        UME_FORCE_INLINE SIMDVecMask<8> isan() const {
+            return SIMDVecMask<8>(_mm256_castps_si256(finiteLanes(mVec)));
+        }
         // ISNAN
+        UME_FORCE_INLINE SIMDVecMask<8> isnan() const {
+            return SIMDVecMask<8>(_mm256_castps_si256(nanLanes(mVec)));
+        }
         // ISSUB
+        UME_FORCE_INLINE SIMDVecMask<8> issub() const {
+            return SIMDVecMask<8>(_mm256_castps_si256(subnormalLanes(mVec)));
+        }
         // ISZERO
+        UME_FORCE_INLINE SIMDVecMask<8> iszero() const {
+            return SIMDVecMask<8>(_mm256_castps_si256(zeroLanes(mVec)));
+        }
         // ISZEROSUB
+        UME_FORCE_INLINE SIMDVecMask<8> iszerosub() const {
+            return SIMDVecMask<8>(_mm256_castps_si256(zeroOrSubnormalLanes(mVec)));
+        }
 
         // EXP
         UME_FORCE_INLINE SIMDVec_f exp() const {
@@ -1236,19 +1388,77 @@ namespace SIMD {
             return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
         }
         // LOG
+        UME_FORCE_INLINE SIMDVec_f log() const {
+            return VECTOR_EMULATION::logf<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        }
         // MLOG
+        UME_FORCE_INLINE SIMDVec_f log(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::logf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // SIN
+        UME_FORCE_INLINE SIMDVec_f sin() const {
+            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(*this);
+        }
         // MSIN
+        UME_FORCE_INLINE SIMDVec_f sin(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // COS
+        UME_FORCE_INLINE SIMDVec_f cos() const {
+            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(*this);
+        }
         // MCOS
+        UME_FORCE_INLINE SIMDVec_f cos(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // SINCOS
+        UME_FORCE_INLINE void sincos(SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            VECTOR_EMULATION::sincosf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(*this, sinvec, cosvec);
+        }
+        // MSINCOS
+        UME_FORCE_INLINE void sincos(SIMDVecMask<8> const & mask, SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            VECTOR_EMULATION::sincosf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this, sinvec, cosvec);
+        }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(*this);
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<8>>(*this, b);
+        }
 
         // PACK
         UME_FORCE_INLINE SIMDVec_f & pack(SIMDVec_f<float, 4> const & a, SIMDVec_f<float, 4> const & b) {
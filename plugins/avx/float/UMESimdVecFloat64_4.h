@@ -37,7 +37,7 @@
 #include "../../../UMESimdInterface.h"
 
 #define BLEND(a_256d, b_256d, mask_128i) \
-                _mm256_blendv_pd( \
+                UME_MM256_BLENDV_PD( \
                     a_256d, \
                     b_256d, \
                     _mm256_castsi256_pd( \
@@ -77,6 +77,7 @@ namespace SIMD {
         friend class SIMDVec_i<int64_t, 4>;
 
         friend class SIMDVec_f<double, 8>;
+        friend class SIMDVec_f<double, 16>;
     private:
         __m256d mVec;
 
@@ -84,6 +85,38 @@ namespace SIMD {
             this->mVec = x;
         }
 
+        // Lane classification kernels used by ISFIN..ISZEROSUB. Lanes for which
+        // the predicate holds are set to all ones.
+        static UME_FORCE_INLINE __m256d absLanes(__m256d const & a) {
+            return _mm256_and_pd(a, _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL)));
+        }
+        static UME_FORCE_INLINE __m256d finiteLanes(__m256d const & a) {
+            __m256d t0 = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+            return _mm256_cmp_pd(absLanes(a), t0, _CMP_LT_OQ);
+        }
+        static UME_FORCE_INLINE __m256d infiniteLanes(__m256d const & a) {
+            __m256d t0 = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+            return _mm256_cmp_pd(absLanes(a), t0, _CMP_EQ_OQ);
+        }
+        static UME_FORCE_INLINE __m256d nanLanes(__m256d const & a) {
+            return _mm256_cmp_pd(a, a, _CMP_UNORD_Q);
+        }
+        static UME_FORCE_INLINE __m256d zeroLanes(__m256d const & a) {
+            return _mm256_cmp_pd(a, _mm256_setzero_pd(), _CMP_EQ_OQ);
+        }
+        static UME_FORCE_INLINE __m256d zeroOrSubnormalLanes(__m256d const & a) {
+            __m256d t0 = _mm256_set1_pd(std::numeric_limits<double>::min());
+            return _mm256_cmp_pd(absLanes(a), t0, _CMP_LT_OQ);
+        }
+        static UME_FORCE_INLINE __m256d subnormalLanes(__m256d const & a) {
+            return _mm256_andnot_pd(zeroLanes(a), zeroOrSubnormalLanes(a));
+        }
+        // Packs 64-bit lane masks into the 32-bit lane layout used by masks.
+        static UME_FORCE_INLINE __m128i packLanes(__m256d const & a) {
+            __m128 t0 = _mm256_castps256_ps128(_mm256_castpd_ps(a));
+            __m128 t1 = _mm256_extractf128_ps(_mm256_castpd_ps(a), 1);
+            return _mm_castps_si128(_mm_shuffle_ps(t0, t1, 0x88));
+        }
     public:
 
         static constexpr uint32_t length() { return 4; }
@@ -167,7 +200,7 @@ namespace SIMD {
         }
         // MASSIGNV
         UME_FORCE_INLINE SIMDVec_f & assign(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
-            mVec = _mm256_blendv_pd(mVec, b.mVec, _mm256_cvtepi32_pd(mask.mMask));
+            mVec = UME_MM256_BLENDV_PD(mVec, b.mVec, _mm256_cvtepi32_pd(mask.mMask));
             return *this;
         }
         // ASSIGNS
@@ -180,7 +213,7 @@ namespace SIMD {
         }
         // MASSIGNS
         UME_FORCE_INLINE SIMDVec_f & assign(SIMDVecMask<4> const & mask, double b) {
-            mVec = _mm256_blendv_pd(mVec, _mm256_set1_pd(b), _mm256_cvtepi32_pd(mask.mMask));
+            mVec = UME_MM256_BLENDV_PD(mVec, _mm256_set1_pd(b), _mm256_cvtepi32_pd(mask.mMask));
             return *this;
         }
 
@@ -192,9 +225,9 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<4> const & mask, double const * p) {
-            __m256d t0 = _mm256_loadu_pd(p);
             __m256d mask_pd = _mm256_cvtepi32_pd(mask.mMask);
-            mVec = _mm256_blendv_pd(mVec, t0, mask_pd);
+            __m256d t0 = _mm256_maskload_pd(p, _mm256_castpd_si256(mask_pd));
+            mVec = UME_MM256_BLENDV_PD(mVec, t0, mask_pd);
             return *this;
         }
         // LOADA
@@ -206,7 +239,14 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<4> const & mask, double const * p) {
             __m256d t0 = _mm256_load_pd(p);
             __m256d mask_pd = _mm256_cvtepi32_pd(mask.mMask);
-            mVec = _mm256_blendv_pd(mVec, t0, mask_pd);
+            mVec = UME_MM256_BLENDV_PD(mVec, t0, mask_pd);
+            return *this;
+        }
+        // LOADN
+        UME_FORCE_INLINE SIMDVec_f & loadn(uint32_t n, double const * p) {
+            __m256d t0 = _mm256_setr_pd(0.0, 1.0, 2.0, 3.0);
+            __m256d t1 = _mm256_cmp_pd(_mm256_set1_pd(n < 4 ? double(n) : 4.0), t0, _CMP_GT_OQ);
+            mVec = _mm256_maskload_pd(p, _mm256_castpd_si256(t1));
             return *this;
         }
         // STORE
@@ -216,9 +256,15 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE double* store(SIMDVecMask<4> const & mask, double* p) const {
-            __m256d t0 = _mm256_loadu_pd(p);
-            __m256d t1 = _mm256_blendv_pd(t0, mVec, _mm256_cvtepi32_pd(mask.mMask));
-            _mm256_storeu_pd(p, t1);
+            __m256d mask_pd = _mm256_cvtepi32_pd(mask.mMask);
+            _mm256_maskstore_pd(p, _mm256_castpd_si256(mask_pd), mVec);
+            return p;
+        }
+        // STOREN
+        UME_FORCE_INLINE double* storen(uint32_t n, double * p) const {
+            __m256d t0 = _mm256_setr_pd(0.0, 1.0, 2.0, 3.0);
+            __m256d t1 = _mm256_cmp_pd(_mm256_set1_pd(n < 4 ? double(n) : 4.0), t0, _CMP_GT_OQ);
+            _mm256_maskstore_pd(p, _mm256_castpd_si256(t1), mVec);
             return p;
         }
         // STOREA
@@ -238,6 +284,40 @@ namespace SIMD {
             return p;
         }
         //(Addition operations)
+        // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_f swizzle(SIMDSwizzle<4> const & sMask) const {
+            __m256d t0 = mVec;
+            __m256d t1 = _mm256_permute2f128_pd(t0, t0, 0x00);
+            __m256d t2 = _mm256_permute2f128_pd(t0, t0, 0x11);
+            // vpermilpd selects with bit 1 of each 64-bit index.
+            __m128i t3 = _mm_slli_epi32(_mm_and_si128(sMask.mVec, _mm_set1_epi32(1)), 1);
+            __m128i t4 = _mm_cvtepu32_epi64(t3);
+            __m128i t5 = _mm_cvtepu32_epi64(_mm_unpackhi_epi64(t3, t3));
+            __m256i t6 = _mm256_insertf128_si256(_mm256_castsi128_si256(t4), t5, 1);
+            __m256d t7 = _mm256_cmp_pd(_mm256_cvtepi32_pd(sMask.mVec), _mm256_set1_pd(1.5), _CMP_GT_OQ);
+            __m256d t8 = UME_MM256_BLENDV_PD(_mm256_permutevar_pd(t1, t6), _mm256_permutevar_pd(t2, t6), t7);
+            return SIMDVec_f(t8);
+        }
+        template<int i0, int i1, int i2, int i3>
+        UME_FORCE_INLINE SIMDVec_f swizzle() const {
+            const int imm = (i0 & 1) | ((i1 & 1) << 1) | ((i2 & 1) << 2) | ((i3 & 1) << 3);
+            const int blendImm = (i0 > 1) | ((i1 > 1) << 1) | ((i2 > 1) << 2) | ((i3 > 1) << 3);
+            __m256d t0 = mVec;
+            if (i0 < 2 && i1 < 2 && i2 > 1 && i3 > 1) {
+                __m256d t1 = _mm256_permute_pd(t0, imm);
+                return SIMDVec_f(t1);
+            }
+            __m256d t2 = _mm256_permute_pd(_mm256_permute2f128_pd(t0, t0, 0x00), imm);
+            __m256d t3 = _mm256_permute_pd(_mm256_permute2f128_pd(t0, t0, 0x11), imm);
+            __m256d t4 = _mm256_blend_pd(t2, t3, blendImm);
+            return SIMDVec_f(t4);
+        }
+        // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_f & swizzlea(SIMDSwizzle<4> const & sMask) {
+            SIMDVec_f t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
             __m256d t0 = _mm256_add_pd(mVec, b.mVec);
@@ -250,7 +330,7 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVec_f add(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
             __m256d t0 = _mm256_add_pd(mVec, b.mVec);
             __m256d m0 = _mm256_cvtepi32_pd(mask.mMask);
-            __m256d t1 = _mm256_blendv_pd(mVec, t0, m0);
+            __m256d t1 = UME_MM256_BLENDV_PD(mVec, t0, m0);
             return SIMDVec_f(t1);
         }
         // ADDS
@@ -269,7 +349,7 @@ namespace SIMD {
             __m256d t0 = _mm256_set1_pd(b);
             __m256d t1 = _mm256_add_pd(mVec, t0);
             __m256d m0 = _mm256_cvtepi32_pd(mask.mMask);
-            __m256d t2 = _mm256_blendv_pd(mVec, t1, m0);
+            __m256d t2 = UME_MM256_BLENDV_PD(mVec, t1, m0);
             return SIMDVec_f(t2);
         }
         // ADDVA    - Add with vector and assign
@@ -284,7 +364,7 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVec_f & adda(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
             __m256d t0 = _mm256_add_pd(mVec, b.mVec);
             __m256d m0 = _mm256_cvtepi32_pd(mask.mMask);
-            mVec = _mm256_blendv_pd(mVec, t0, m0);
+            mVec = UME_MM256_BLENDV_PD(mVec, t0, m0);
             return *this;
         }
         // ADDSA    - Add with scalar and assign
@@ -300,7 +380,7 @@ namespace SIMD {
             __m256d t0 = _mm256_set1_pd(b);
             __m256d t1 = _mm256_add_pd(mVec, t0);
             __m256d m0 = _mm256_cvtepi32_pd(mask.mMask);
-            mVec = _mm256_blendv_pd(mVec, t1, m0);
+            mVec = UME_MM256_BLENDV_PD(mVec, t1, m0);
             return *this;
         }
         // SADDV    - Saturated add with vector
@@ -312,11 +392,73 @@ namespace SIMD {
         // SADDSA   - Satureated add with scalar and assign
         // MSADDSA  - Masked staturated add with vector and assign
         // POSTINC  - Postfix increment
+        UME_FORCE_INLINE SIMDVec_f postinc() {
+            __m256d t0 = _mm256_set1_pd(1.0);
+            __m256d t1 = mVec;
+            mVec = _mm256_add_pd(mVec, t0);
+            return SIMDVec_f(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator++ (int) {
+            return postinc();
+        }
         // MPOSTINC - Masked postfix increment
+        UME_FORCE_INLINE SIMDVec_f postinc(SIMDVecMask<4> const & mask) {
+            __m256d t0 = _mm256_set1_pd(1.0);
+            __m256d t1 = mVec;
+            __m256d t2 = _mm256_add_pd(mVec, t0);
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return SIMDVec_f(t1);
+        }
         // PREFINC  - Prefix increment
+        UME_FORCE_INLINE SIMDVec_f & prefinc() {
+            __m256d t0 = _mm256_set1_pd(1.0);
+            mVec = _mm256_add_pd(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator++ () {
+            return prefinc();
+        }
         // MPREFINC - Masked prefix increment
+        UME_FORCE_INLINE SIMDVec_f & prefinc(SIMDVecMask<4> const & mask) {
+            __m256d t0 = _mm256_set1_pd(1.0);
+            __m256d t1 = _mm256_add_pd(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
 
         //(Subtraction operations)
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVec_f const & b) const {
+            return add(b);
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return add(mask, b);
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(double b) const {
+            return add(b);
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<4> const & mask, double b) const {
+            return add(mask, b);
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVec_f const & b) {
+            return adda(b);
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            return adda(mask, b);
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(double b) {
+            return adda(b);
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<4> const & mask, double b) {
+            return adda(mask, b);
+        }
         // SUBV
         UME_FORCE_INLINE SIMDVec_f sub(SIMDVec_f const & b) const {
             __m256d t0 = _mm256_sub_pd(mVec, b.mVec);
@@ -346,9 +488,33 @@ namespace SIMD {
             return SIMDVec_f(t1);
         }
         // SUBVA      - Sub with vector and assign
+        UME_FORCE_INLINE SIMDVec_f & suba(SIMDVec_f const & b) {
+            mVec = _mm256_sub_pd(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator-= (SIMDVec_f const & b) {
+            return suba(b);
+        }
         // MSUBVA     - Masked sub with vector and assign
+        UME_FORCE_INLINE SIMDVec_f & suba(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            __m256d t0 = _mm256_sub_pd(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // SUBSA      - Sub with scalar and assign
+        UME_FORCE_INLINE SIMDVec_f & suba(const double b) {
+            mVec = _mm256_sub_pd(mVec, _mm256_set1_pd(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator-= (double b) {
+            return suba(b);
+        }
         // MSUBSA     - Masked sub with scalar and assign
+        UME_FORCE_INLINE SIMDVec_f & suba(SIMDVecMask<4> const & mask, const double b) {
+            __m256d t0 = _mm256_sub_pd(mVec, _mm256_set1_pd(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // SSUBV      - Saturated sub with vector
         // MSSUBV     - Masked saturated sub with vector
         // SSUBS      - Saturated sub with scalar
@@ -357,6 +523,38 @@ namespace SIMD {
         // MSSUBVA    - Masked saturated sub with vector and assign
         // SSUBSA     - Saturated sub with scalar and assign
         // MSSUBSA    - Masked saturated sub with scalar and assign
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVec_f const & b) const {
+            return sub(b);
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return sub(mask, b);
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(double b) const {
+            return sub(b);
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<4> const & mask, double b) const {
+            return sub(mask, b);
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVec_f const & b) {
+            return suba(b);
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            return suba(mask, b);
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(double b) {
+            return suba(b);
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<4> const & mask, double b) {
+            return suba(mask, b);
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVec_f const & b) const {
             __m256d t0 = _mm256_sub_pd(b.mVec, mVec);
@@ -401,7 +599,7 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVec_f mul(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
             __m256d t0 = _mm256_mul_pd(mVec, b.mVec);
             __m256d m0 = _mm256_cvtepi32_pd(mask.mMask);
-            __m256d t1 = _mm256_blendv_pd(mVec, t0, m0);
+            __m256d t1 = UME_MM256_BLENDV_PD(mVec, t0, m0);
             return SIMDVec_f(t1);
         }
         // MULS
@@ -418,7 +616,7 @@ namespace SIMD {
             __m256d t0 = _mm256_set1_pd(b);
             __m256d t1 = _mm256_mul_pd(mVec, t0);
             __m256d m0 = _mm256_cvtepi32_pd(mask.mMask);
-            __m256d t2 = _mm256_blendv_pd(mVec, t1, m0);
+            __m256d t2 = UME_MM256_BLENDV_PD(mVec, t1, m0);
             return SIMDVec_f(t2);
         }
         // MULVA
@@ -433,7 +631,7 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVec_f & mula(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
             __m256d t0 = _mm256_mul_pd(mVec, b.mVec);
             __m256d m0 = _mm256_cvtepi32_pd(mask.mMask);
-            mVec = _mm256_blendv_pd(mVec, t0, m0);
+            mVec = UME_MM256_BLENDV_PD(mVec, t0, m0);
             return *this;
         }
         // MULSA
@@ -450,7 +648,7 @@ namespace SIMD {
             __m256d t0 = _mm256_set1_pd(b);
             __m256d t1 = _mm256_mul_pd(mVec, t0);
             __m256d m0 = _mm256_cvtepi32_pd(mask.mMask);
-            mVec = _mm256_blendv_pd(mVec, t1, m0);
+            mVec = UME_MM256_BLENDV_PD(mVec, t1, m0);
             return *this;
         }
 
@@ -809,7 +1007,7 @@ namespace SIMD {
 #else
             __m256d t0 = _mm256_add_pd(_mm256_mul_pd(mVec, b.mVec), c.mVec);
 #endif
-            __m256d t1 = _mm256_blendv_pd(mVec, t0, _mm256_cvtepi32_pd(mask.mMask));
+            __m256d t1 = UME_MM256_BLENDV_PD(mVec, t0, _mm256_cvtepi32_pd(mask.mMask));
             return SIMDVec_f(t1);
         }
         // FMULSUBV  - Fused multiply and sub (A*B - C) with vectors
@@ -975,10 +1173,22 @@ namespace SIMD {
         }
         // SQRTA     - Square root of vector values and assign
         // MSQRTA    - Masked square root of vector values and assign
-        // POWV      - Power (exponents in vector)
-        // MPOWV     - Masked power (exponents in vector)
-        // POWS      - Power (exponent in scalar)
-        // MPOWS     - Masked power (exponent in scalar) 
+        // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this, b);
+        }
+        // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this, b);
+        }
+        // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this, SIMDVec_f(b));
+        }
+        // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256d t0 = _mm256_round_pd(mVec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
@@ -993,16 +1203,55 @@ namespace SIMD {
         // TRUNC     - Truncate to integer (returns Signed integer vector)
         // MTRUNC    - Masked truncate to integer (returns Signed integer vector)
         // FLOOR     - Floor
+        UME_FORCE_INLINE SIMDVec_f floor() const {
+            __m256d t0 = _mm256_floor_pd(mVec);
+            return SIMDVec_f(t0);
+        }
         // MFLOOR    - Masked floor
+        UME_FORCE_INLINE SIMDVec_f floor(SIMDVecMask<4> const & mask) const {
+            __m256d t0 = _mm256_floor_pd(mVec);
+            __m256d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
         // CEIL      - Ceil
+        UME_FORCE_INLINE SIMDVec_f ceil() const {
+            __m256d t0 = _mm256_ceil_pd(mVec);
+            return SIMDVec_f(t0);
+        }
         // MCEIL     - Masked ceil
-        // ISFIN     - Is finite
-        // ISINF     - Is infinite (INF)
-        // ISAN      - Is a number
-        // ISNAN     - Is 'Not a Number (NaN)'
-        // ISSUB     - Is subnormal
-        // ISZERO    - Is zero
-        // ISZEROSUB - Is zero or subnormal
+        UME_FORCE_INLINE SIMDVec_f ceil(SIMDVecMask<4> const & mask) const {
+            __m256d t0 = _mm256_ceil_pd(mVec);
+            __m256d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // ISFIN
+        UME_FORCE_INLINE SIMDVecMask<4> isfin() const {
+            return SIMDVecMask<4>(packLanes(finiteLanes(mVec)));
+        }
+        // ISINF
+        UME_FORCE_INLINE SIMDVecMask<4> isinf() const {
+            return SIMDVecMask<4>(packLanes(infiniteLanes(mVec)));
+        }
+        // ISAN
+        UME_FORCE_INLINE SIMDVecMask<4> isan() const {
+            return SIMDVecMask<4>(packLanes(finiteLanes(mVec)));
+        }
+        // ISNAN
+        UME_FORCE_INLINE SIMDVecMask<4> isnan() const {
+            return SIMDVecMask<4>(packLanes(nanLanes(mVec)));
+        }
+        // ISSUB
+        UME_FORCE_INLINE SIMDVecMask<4> issub() const {
+            return SIMDVecMask<4>(packLanes(subnormalLanes(mVec)));
+        }
+        // ISZERO
+        UME_FORCE_INLINE SIMDVecMask<4> iszero() const {
+            return SIMDVecMask<4>(packLanes(zeroLanes(mVec)));
+        }
+        // ISZEROSUB
+        UME_FORCE_INLINE SIMDVecMask<4> iszerosub() const {
+            return SIMDVecMask<4>(packLanes(zeroOrSubnormalLanes(mVec)));
+        }
         // EXP
         UME_FORCE_INLINE SIMDVec_f exp() const {
             return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
@@ -1012,19 +1261,77 @@ namespace SIMD {
             return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>> (mask, *this);
         }
         // LOG
+        UME_FORCE_INLINE SIMDVec_f log() const {
+            return VECTOR_EMULATION::logd<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
         // MLOG
+        UME_FORCE_INLINE SIMDVec_f log(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::logd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // SIN       - Sine
+        UME_FORCE_INLINE SIMDVec_f sin() const {
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(*this);
+        }
         // MSIN      - Masked sine
+        UME_FORCE_INLINE SIMDVec_f sin(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // COS       - Cosine
+        UME_FORCE_INLINE SIMDVec_f cos() const {
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(*this);
+        }
         // MCOS      - Masked cosine
-        // TAN       - Tangent
-        // MTAN      - Masked tangent
-        // CTAN      - Cotangent
-        // MCTAN     - Masked cotangent
+        UME_FORCE_INLINE SIMDVec_f cos(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // SINCOS
+        UME_FORCE_INLINE void sincos(SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(*this, sinvec, cosvec);
+        }
+        // MSINCOS
+        UME_FORCE_INLINE void sincos(SIMDVecMask<4> const & mask, SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(mask, *this, sinvec, cosvec);
+        }
+        // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2d<SIMDVec_f, SIMDVecMask<4>>(*this, b);
+        }
 
         // PROMOTE
         // -
@@ -36,7 +36,7 @@
 #include <immintrin.h>
 
 #define BLEND_LO(a_256d, b_256d, mask_256i) \
-    _mm256_blendv_pd( \
+    UME_MM256_BLENDV_PD( \
         a_256d, \
         b_256d, \
         _mm256_castsi256_pd(_mm256_insertf128_si256( \
@@ -48,7 +48,7 @@
                                 1)));
 
 #define BLEND_HI(a_256d, b_256d, mask_256i) \
-    _mm256_blendv_pd( \
+    UME_MM256_BLENDV_PD( \
         a_256d, \
         b_256d, \
         _mm256_castsi256_pd(_mm256_insertf128_si256( \
@@ -90,6 +90,38 @@ namespace SIMD {
             this->mVec[1] = x1;
         }
 
+        // Lane classification kernels used by ISFIN..ISZEROSUB. Lanes for which
+        // the predicate holds are set to all ones.
+        static UME_FORCE_INLINE __m256d absLanes(__m256d const & a) {
+            return _mm256_and_pd(a, _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL)));
+        }
+        static UME_FORCE_INLINE __m256d finiteLanes(__m256d const & a) {
+            __m256d t0 = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+            return _mm256_cmp_pd(absLanes(a), t0, _CMP_LT_OQ);
+        }
+        static UME_FORCE_INLINE __m256d infiniteLanes(__m256d const & a) {
+            __m256d t0 = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+            return _mm256_cmp_pd(absLanes(a), t0, _CMP_EQ_OQ);
+        }
+        static UME_FORCE_INLINE __m256d nanLanes(__m256d const & a) {
+            return _mm256_cmp_pd(a, a, _CMP_UNORD_Q);
+        }
+        static UME_FORCE_INLINE __m256d zeroLanes(__m256d const & a) {
+            return _mm256_cmp_pd(a, _mm256_setzero_pd(), _CMP_EQ_OQ);
+        }
+        static UME_FORCE_INLINE __m256d zeroOrSubnormalLanes(__m256d const & a) {
+            __m256d t0 = _mm256_set1_pd(std::numeric_limits<double>::min());
+            return _mm256_cmp_pd(absLanes(a), t0, _CMP_LT_OQ);
+        }
+        static UME_FORCE_INLINE __m256d subnormalLanes(__m256d const & a) {
+            return _mm256_andnot_pd(zeroLanes(a), zeroOrSubnormalLanes(a));
+        }
+        // Packs 64-bit lane masks into the 32-bit lane layout used by masks.
+        static UME_FORCE_INLINE __m128i packLanes(__m256d const & a) {
+            __m128 t0 = _mm256_castps256_ps128(_mm256_castpd_ps(a));
+            __m128 t1 = _mm256_extractf128_ps(_mm256_castpd_ps(a), 1);
+            return _mm_castps_si128(_mm_shuffle_ps(t0, t1, 0x88));
+        }
     public:
 
         static constexpr uint32_t length() { return 8; }
@@ -223,10 +255,10 @@ namespace SIMD {
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<8> const & mask, double const * p) {
             __m256d t0 = _mm256_loadu_pd(p);
             __m128i t1 = _mm256_extractf128_si256(mask.mMask, 0);
-            mVec[0] = _mm256_blendv_pd(mVec[0], t0, _mm256_cvtepi32_pd(t1));
+            mVec[0] = UME_MM256_BLENDV_PD(mVec[0], t0, _mm256_cvtepi32_pd(t1));
             __m256d t2 = _mm256_loadu_pd(p + 4);
             __m128i t3 = _mm256_extractf128_si256(mask.mMask, 1);
-            mVec[1] = _mm256_blendv_pd(mVec[1], t2, _mm256_cvtepi32_pd(t3));
+            mVec[1] = UME_MM256_BLENDV_PD(mVec[1], t2, _mm256_cvtepi32_pd(t3));
             return *this;
         }
         // LOADA
@@ -245,8 +277,8 @@ namespace SIMD {
 
             __m256d mask_pd_lo = _mm256_cvtepi32_pd(t2);
             __m256d mask_pd_hi = _mm256_cvtepi32_pd(t3);
-            mVec[0] = _mm256_blendv_pd(mVec[0], t0, mask_pd_lo);
-            mVec[1] = _mm256_blendv_pd(mVec[1], t1, mask_pd_hi);
+            mVec[0] = UME_MM256_BLENDV_PD(mVec[0], t0, mask_pd_lo);
+            mVec[1] = UME_MM256_BLENDV_PD(mVec[1], t1, mask_pd_hi);
             return *this;
         }
         // STORE
@@ -259,11 +291,11 @@ namespace SIMD {
         UME_FORCE_INLINE double* store(SIMDVecMask<8> const & mask, double* p) const {
             __m256d t0 = _mm256_loadu_pd(p);
             __m128i t1 = _mm256_extractf128_si256(mask.mMask, 0);
-            __m256d t2 = _mm256_blendv_pd(t0, mVec[0], _mm256_cvtepi32_pd(t1));
+            __m256d t2 = UME_MM256_BLENDV_PD(t0, mVec[0], _mm256_cvtepi32_pd(t1));
             _mm256_storeu_pd(p, t2);
             __m256d t3 = _mm256_loadu_pd(p + 4);
             __m128i t4 = _mm256_extractf128_si256(mask.mMask, 1);
-            __m256d t5 = _mm256_blendv_pd(t3, mVec[1], _mm256_cvtepi32_pd(t4));
+            __m256d t5 = UME_MM256_BLENDV_PD(t3, mVec[1], _mm256_cvtepi32_pd(t4));
             _mm256_storeu_pd(p + 4, t5);
             return p;
         }
@@ -368,7 +400,7 @@ namespace SIMD {
             __m128i t5 = _mm_cvtepi32_epi64(t4);
             __m256i t6 = _mm256_castsi128_si256(t3);
             __m256i t7 = _mm256_insertf128_si256(t6, t5, 1); // mask for mVec[0]
-            mVec[0] = _mm256_blendv_pd(mVec[0], t0, _mm256_castsi256_pd(t7)); // result 
+            mVec[0] = UME_MM256_BLENDV_PD(mVec[0], t0, _mm256_castsi256_pd(t7)); // result 
 
             __m128i t9 = _mm256_extractf128_si256(mask.mMask, 1);
             __m128i t10 = _mm_cvtepi32_epi64(t9);
@@ -376,7 +408,7 @@ namespace SIMD {
             __m128i t12 = _mm_cvtepi32_epi64(t11);
             __m256i t13 = _mm256_castsi128_si256(t10);
             __m256i t14 = _mm256_insertf128_si256(t13, t12, 1); // mask for mVec[1]
-            mVec[1] = _mm256_blendv_pd(mVec[1], t1, _mm256_castsi256_pd(t14)); // result 
+            mVec[1] = UME_MM256_BLENDV_PD(mVec[1], t1, _mm256_castsi256_pd(t14)); // result 
 
             return *this;
         }
@@ -394,6 +426,38 @@ namespace SIMD {
         // MPREFINC - Masked prefix increment
 
         //(Subtraction operations)
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVec_f const & b) const {
+            return add(b);
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return add(mask, b);
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(double b) const {
+            return add(b);
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<8> const & mask, double b) const {
+            return add(mask, b);
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVec_f const & b) {
+            return adda(b);
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<8> const & mask, SIMDVec_f const & b) {
+            return adda(mask, b);
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(double b) {
+            return adda(b);
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<8> const & mask, double b) {
+            return adda(mask, b);
+        }
         // SUBV
         UME_FORCE_INLINE SIMDVec_f sub(SIMDVec_f const & b) const {
             __m256d t0 = _mm256_sub_pd(mVec[0], b.mVec[0]);
@@ -444,6 +508,38 @@ namespace SIMD {
         // MSSUBVA    - Masked saturated sub with vector and assign
         // SSUBSA     - Saturated sub with scalar and assign
         // MSSUBSA    - Masked saturated sub with scalar and assign
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVec_f const & b) const {
+            return sub(b);
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return sub(mask, b);
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(double b) const {
+            return sub(b);
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<8> const & mask, double b) const {
+            return sub(mask, b);
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVec_f const & b) {
+            return suba(b);
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<8> const & mask, SIMDVec_f const & b) {
+            return suba(mask, b);
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(double b) {
+            return suba(b);
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<8> const & mask, double b) {
+            return suba(mask, b);
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVec_f const & b) const {
             __m256d t0 = _mm256_sub_pd(b.mVec[0], mVec[0]);
@@ -851,13 +947,55 @@ namespace SIMD {
         // MFLOOR    - Masked floor
         // CEIL      - Ceil
         // MCEIL     - Masked ceil
-        // ISFIN     - Is finite
-        // ISINF     - Is infinite (INF)
-        // ISAN      - Is a number
-        // ISNAN     - Is 'Not a Number (NaN)'
-        // ISSUB     - Is subnormal
-        // ISZERO    - Is zero
-        // ISZEROSUB - Is zero or subnormal
+        // ISFIN
+        UME_FORCE_INLINE SIMDVecMask<8> isfin() const {
+            __m128i t0 = packLanes(finiteLanes(mVec[0]));
+            __m128i t1 = packLanes(finiteLanes(mVec[1]));
+            __m256i t2 = _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+            return SIMDVecMask<8>(t2);
+        }
+        // ISINF
+        UME_FORCE_INLINE SIMDVecMask<8> isinf() const {
+            __m128i t0 = packLanes(infiniteLanes(mVec[0]));
+            __m128i t1 = packLanes(infiniteLanes(mVec[1]));
+            __m256i t2 = _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+            return SIMDVecMask<8>(t2);
+        }
+        // ISAN
+        UME_FORCE_INLINE SIMDVecMask<8> isan() const {
+            __m128i t0 = packLanes(finiteLanes(mVec[0]));
+            __m128i t1 = packLanes(finiteLanes(mVec[1]));
+            __m256i t2 = _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+            return SIMDVecMask<8>(t2);
+        }
+        // ISNAN
+        UME_FORCE_INLINE SIMDVecMask<8> isnan() const {
+            __m128i t0 = packLanes(nanLanes(mVec[0]));
+            __m128i t1 = packLanes(nanLanes(mVec[1]));
+            __m256i t2 = _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+            return SIMDVecMask<8>(t2);
+        }
+        // ISSUB
+        UME_FORCE_INLINE SIMDVecMask<8> issub() const {
+            __m128i t0 = packLanes(subnormalLanes(mVec[0]));
+            __m128i t1 = packLanes(subnormalLanes(mVec[1]));
+            __m256i t2 = _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+            return SIMDVecMask<8>(t2);
+        }
+        // ISZERO
+        UME_FORCE_INLINE SIMDVecMask<8> iszero() const {
+            __m128i t0 = packLanes(zeroLanes(mVec[0]));
+            __m128i t1 = packLanes(zeroLanes(mVec[1]));
+            __m256i t2 = _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+            return SIMDVecMask<8>(t2);
+        }
+        // ISZEROSUB
+        UME_FORCE_INLINE SIMDVecMask<8> iszerosub() const {
+            __m128i t0 = packLanes(zeroOrSubnormalLanes(mVec[0]));
+            __m128i t1 = packLanes(zeroOrSubnormalLanes(mVec[1]));
+            __m256i t2 = _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+            return SIMDVecMask<8>(t2);
+        }
         // EXP
         UME_FORCE_INLINE SIMDVec_f exp() const {
             return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 8>>(*this);
@@ -867,15 +1005,65 @@ namespace SIMD {
             return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
         }
         // LOG
+        UME_FORCE_INLINE SIMDVec_f log() const {
+            // Evaluate the SIMDVec_f<double, 4> kernel on each register.
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).log().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).log().mVec;
+            return SIMDVec_f(t0, t1);
+        }
         // MLOG
+        UME_FORCE_INLINE SIMDVec_f log(SIMDVecMask<8> const & mask) const {
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, log());
+            return t0;
+        }
         // LOG2
         // MLOG2
         // LOG10
         // MLOG10
         // SIN       - Sine
+        UME_FORCE_INLINE SIMDVec_f sin() const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).sin().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).sin().mVec;
+            return SIMDVec_f(t0, t1);
+        }
         // MSIN      - Masked sine
+        UME_FORCE_INLINE SIMDVec_f sin(SIMDVecMask<8> const & mask) const {
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, sin());
+            return t0;
+        }
         // COS       - Cosine
+        UME_FORCE_INLINE SIMDVec_f cos() const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).cos().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).cos().mVec;
+            return SIMDVec_f(t0, t1);
+        }
         // MCOS      - Masked cosine
+        UME_FORCE_INLINE SIMDVec_f cos(SIMDVecMask<8> const & mask) const {
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, cos());
+            return t0;
+        }
+        // SINCOS
+        UME_FORCE_INLINE void sincos(SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            SIMDVec_f<double, 4> t0, t1;
+            SIMDVec_f<double, 4>(mVec[0]).sincos(t0, t1);
+            sinvec.mVec[0] = t0.mVec;
+            cosvec.mVec[0] = t1.mVec;
+            SIMDVec_f<double, 4>(mVec[1]).sincos(t0, t1);
+            sinvec.mVec[1] = t0.mVec;
+            cosvec.mVec[1] = t1.mVec;
+        }
+        // MSINCOS
+        UME_FORCE_INLINE void sincos(SIMDVecMask<8> const & mask, SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            SIMDVec_f t0, t1;
+            sincos(t0, t1);
+            sinvec = *this;
+            cosvec = *this;
+            sinvec.assign(mask, t0);
+            cosvec.assign(mask, t1);
+        }
         // TAN       - Tangent
         // MTAN      - Masked tangent
         // CTAN      - Cotangent
@@ -37,7 +37,7 @@
 
 
 #define BLEND(a_256i, b_256i, mask_256i) _mm256_castps_si256( \
-                                        _mm256_blendv_ps( \
+                                        UME_MM256_BLENDV_PS( \
                                             _mm256_castsi256_ps(a_256i), \
                                             _mm256_castsi256_ps(b_256i), \
                                             _mm256_castsi256_ps(mask_256i)))
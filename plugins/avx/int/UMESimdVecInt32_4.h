@@ -63,6 +63,20 @@ namespace SIMD {
 
         UME_FORCE_INLINE explicit SIMDVec_i(__m128i & x) { mVec = x; }
         UME_FORCE_INLINE explicit SIMDVec_i(const __m128i & x) { mVec = x; }
+
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m128i saturatedAdd(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_add_epi32(a, b);
+            __m128i t1 = _mm_andnot_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, t0));
+            __m128i t2 = _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(0x7FFFFFFF));
+            return _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(t0), _mm_castsi128_ps(t2), _mm_castsi128_ps(t1)));
+        }
+        static UME_FORCE_INLINE __m128i saturatedSub(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_sub_epi32(a, b);
+            __m128i t1 = _mm_and_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, t0));
+            __m128i t2 = _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(0x7FFFFFFF));
+            return _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(t0), _mm_castsi128_ps(t2), _mm_castsi128_ps(t1)));
+        }
     public:
 
         constexpr static uint32_t length() { return 4; }
@@ -221,7 +235,22 @@ namespace SIMD {
             return SIMDVec_i(t1);
         }
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_i swizzle(SIMDSwizzle<4> const & sMask) const {
+            __m128 t0 = _mm_permutevar_ps(_mm_castsi128_ps(mVec), sMask.mVec);
+            __m128i t1 = _mm_castps_si128(t0);
+            return SIMDVec_i(t1);
+        }
+        template<int i0, int i1, int i2, int i3>
+        UME_FORCE_INLINE SIMDVec_i swizzle() const {
+            __m128i t0 = _mm_shuffle_epi32(mVec, (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6));
+            return SIMDVec_i(t0);
+        }
         // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_i & swizzlea(SIMDSwizzle<4> const & sMask) {
+            SIMDVec_i t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
 
         // SORTA
         UME_FORCE_INLINE SIMDVec_i sorta() {
@@ -315,13 +344,53 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            return SIMDVec_i(t1);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<4> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec = saturatedAdd(mVec, b.mVec);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = saturatedAdd(mVec, t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<4> const & mask, int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_i postinc() {
             __m128i t0 = _mm_set1_epi32(1);
@@ -415,13 +484,53 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            return SIMDVec_i(t1);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<4> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec = saturatedSub(mVec, b.mVec);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = saturatedSub(mVec, t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<4> const & mask, int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
             __m128i t0 = _mm_sub_epi32(b.mVec, mVec);
@@ -959,6 +1068,9 @@ namespace SIMD {
             __m128i t0 = _mm_and_si128(mVec, b.mVec);
             return SIMDVec_i(t0);
         }
+        UME_FORCE_INLINE SIMDVec_i operator& (SIMDVec_i const & b) const {
+            return band(b);
+        }
         // MBANDV
         UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
             __m128i t0 = _mm_and_si128(mVec, b.mVec);
@@ -971,6 +1083,9 @@ namespace SIMD {
             __m128i t1 = _mm_and_si128(mVec, t0);
             return SIMDVec_i(t1);
         }
+        UME_FORCE_INLINE SIMDVec_i operator& (int32_t b) const {
+            return band(b);
+        }
         // MBANDS
         UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<4> const & mask, int32_t b) const {
             __m128i t0 = _mm_set1_epi32(b);
@@ -983,6 +1098,9 @@ namespace SIMD {
             mVec = _mm_and_si128(mVec, b.mVec);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (SIMDVec_i const & b) {
+            return banda(b);
+        }
         // MBANDVA
         UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
             __m128i t0 = _mm_and_si128(mVec, b.mVec);
@@ -995,6 +1113,9 @@ namespace SIMD {
             mVec = _mm_and_si128(mVec, t0);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (int32_t b) {
+            return banda(b);
+        }
         // MBANDSA
         UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<4> const & mask, int32_t b) {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1007,6 +1128,9 @@ namespace SIMD {
             __m128i t0 = _mm_or_si128(mVec, b.mVec);
             return SIMDVec_i(t0);
         }
+        UME_FORCE_INLINE SIMDVec_i operator| (SIMDVec_i const & b) const {
+            return bor(b);
+        }
         // MBORV
         UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
             __m128i t0 = _mm_or_si128(mVec, b.mVec);
@@ -1019,6 +1143,9 @@ namespace SIMD {
             __m128i t1 = _mm_or_si128(mVec, t0);
             return SIMDVec_i(t1);
         }
+        UME_FORCE_INLINE SIMDVec_i operator| (int32_t b) const {
+            return bor(b);
+        }
         // MBORS
         UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<4> const & mask, int32_t b) const {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1031,6 +1158,9 @@ namespace SIMD {
             mVec = _mm_or_si128(mVec, b.mVec);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (SIMDVec_i const & b) {
+            return bora(b);
+        }
         // MBORVA
         UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
             __m128i t0 = _mm_or_si128(mVec, b.mVec);
@@ -1043,6 +1173,9 @@ namespace SIMD {
             mVec = _mm_or_si128(mVec, t0);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (int32_t b) {
+            return bora(b);
+        }
         // MBORSA
         UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<4> const & mask, int32_t b) {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1055,6 +1188,9 @@ namespace SIMD {
             __m128i t0 = _mm_xor_si128(mVec, b.mVec);
             return SIMDVec_i(t0);
         }
+        UME_FORCE_INLINE SIMDVec_i operator^ (SIMDVec_i const & b) const {
+            return bxor(b);
+        }
         // MBXORV
         UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
             __m128i t0 = _mm_xor_si128(mVec, b.mVec);
@@ -1067,6 +1203,9 @@ namespace SIMD {
             __m128i t1 = _mm_xor_si128(mVec, t0);
             return SIMDVec_i(t1);
         }
+        UME_FORCE_INLINE SIMDVec_i operator^ (int32_t b) const {
+            return bxor(b);
+        }
         // MBXORS
         UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<4> const & mask, int32_t b) const {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1079,6 +1218,9 @@ namespace SIMD {
             mVec = _mm_xor_si128(mVec, b.mVec);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (SIMDVec_i const & b) {
+            return bxora(b);
+        }
         // MBXORVA
         UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
             __m128i t0 = _mm_xor_si128(mVec, b.mVec);
@@ -1091,6 +1233,9 @@ namespace SIMD {
             mVec = _mm_xor_si128(mVec, t0);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (int32_t b) {
+            return bxora(b);
+        }
         // MBXORSA
         UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<4> const & mask, int32_t b) {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1104,6 +1249,9 @@ namespace SIMD {
             __m128i t1 = _mm_xor_si128(mVec, t0);
             return SIMDVec_i(t1);
         }
+        UME_FORCE_INLINE SIMDVec_i operator~ () const {
+            return bnot();
+        }
         // MBNOT
         UME_FORCE_INLINE SIMDVec_i bnot(SIMDVecMask<4> const & mask) const {
             __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
@@ -1286,21 +1434,113 @@ namespace SIMD {
         }
 
         // LSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVec_u<uint32_t, 4> const & b) const {
+            return SCALAR_EMULATION::shiftBitsLeft<SIMDVec_i, SIMDVec_u<uint32_t, 4>>(*this, b);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (SIMDVec_u<uint32_t, 4> const & b) const {
+            return lsh(b);
+        }
         // MLSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<4> const & mask, SIMDVec_u<uint32_t, 4> const & b) const {
+            return SCALAR_EMULATION::shiftBitsLeft<SIMDVec_i, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this, b);
+        }
         // LSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi32(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (uint32_t b) const {
+            return lsh(b);
+        }
         // MLSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi32(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // LSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVec_u<uint32_t, 4> const & b) {
+            return SCALAR_EMULATION::shiftBitsLeftAssign<SIMDVec_i, SIMDVec_u<uint32_t, 4>>(*this, b);
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (SIMDVec_u<uint32_t, 4> const & b) {
+            return lsha(b);
+        }
         // MLSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<4> const & mask, SIMDVec_u<uint32_t, 4> const & b) {
+            return SCALAR_EMULATION::shiftBitsLeftAssign<SIMDVec_i, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this, b);
+        }
         // LSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = _mm_sll_epi32(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (uint32_t b) {
+            return lsha(b);
+        }
         // MLSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi32(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
         // RSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVec_u<uint32_t, 4> const & b) const {
+            return SCALAR_EMULATION::shiftBitsRight<SIMDVec_i, SIMDVec_u<uint32_t, 4>>(*this, b);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (SIMDVec_u<uint32_t, 4> const & b) const {
+            return rsh(b);
+        }
         // MRSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<4> const & mask, SIMDVec_u<uint32_t, 4> const & b) const {
+            return SCALAR_EMULATION::shiftBitsRight<SIMDVec_i, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this, b);
+        }
         // RSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sra_epi32(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (uint32_t b) const {
+            return rsh(b);
+        }
         // MRSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sra_epi32(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // RSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVec_u<uint32_t, 4> const & b) {
+            return SCALAR_EMULATION::shiftBitsRightAssign<SIMDVec_i, SIMDVec_u<uint32_t, 4>>(*this, b);
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (SIMDVec_u<uint32_t, 4> const & b) {
+            return rsha(b);
+        }
         // MRSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<4> const & mask, SIMDVec_u<uint32_t, 4> const & b) {
+            return SCALAR_EMULATION::shiftBitsRightAssign<SIMDVec_i, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this, b);
+        }
         // RSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = _mm_sra_epi32(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (uint32_t b) {
+            return rsha(b);
+        }
         // MRSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sra_epi32(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
         // ROLV
         // MROLV
         // ROLS
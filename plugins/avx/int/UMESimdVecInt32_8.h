@@ -37,7 +37,7 @@
 #include "../../../UMESimdInterface.h"
 
 #define BLEND(a_256i, b_256i, mask_256i) _mm256_castps_si256( \
-                                        _mm256_blendv_ps( \
+                                        UME_MM256_BLENDV_PS( \
                                             _mm256_castsi256_ps(a_256i), \
                                             _mm256_castsi256_ps(b_256i), \
                                             _mm256_castsi256_ps(mask_256i)))
@@ -174,6 +174,20 @@ namespace SIMD {
 
         UME_FORCE_INLINE explicit SIMDVec_i(__m256i & x) { mVec = x; }
         UME_FORCE_INLINE explicit SIMDVec_i(const __m256i & x) { mVec = x; }
+
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m128i saturatedAdd(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_add_epi32(a, b);
+            __m128i t1 = _mm_andnot_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, t0));
+            __m128i t2 = _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(0x7FFFFFFF));
+            return _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(t0), _mm_castsi128_ps(t2), _mm_castsi128_ps(t1)));
+        }
+        static UME_FORCE_INLINE __m128i saturatedSub(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_sub_epi32(a, b);
+            __m128i t1 = _mm_and_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, t0));
+            __m128i t2 = _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(0x7FFFFFFF));
+            return _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(t0), _mm_castsi128_ps(t2), _mm_castsi128_ps(t1)));
+        }
     public:
 
         constexpr static uint32_t length() { return 8; }
@@ -320,7 +334,44 @@ namespace SIMD {
         // BLENDV
         // BLENDS
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_i swizzle(SIMDSwizzle<8> const & sMask) const {
+            // Permute both 128-bit halves within lanes, then select per element
+            // using bit 2 of the index.
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_permute2f128_ps(t0, t0, 0x00);
+            __m256 t2 = _mm256_permute2f128_ps(t0, t0, 0x11);
+            __m256 t3 = _mm256_permutevar_ps(t1, sMask.mVec);
+            __m256 t4 = _mm256_permutevar_ps(t2, sMask.mVec);
+            __m256 t5 = _mm256_cmp_ps(_mm256_cvtepi32_ps(sMask.mVec), _mm256_set1_ps(3.5f), _CMP_GT_OQ);
+            __m256 t6 = UME_MM256_BLENDV_PS(t3, t4, t5);
+            __m256i t9 = _mm256_castps_si256(t6);
+            return SIMDVec_i(t9);
+        }
+        template<int i0, int i1, int i2, int i3, int i4, int i5, int i6, int i7>
+        UME_FORCE_INLINE SIMDVec_i swizzle() const {
+            const int imm = (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6);
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            // Patterns repeated in both 128-bit lanes need only an immediate shuffle.
+            if (i0 < 4 && i1 < 4 && i2 < 4 && i3 < 4 && i4 == i0 + 4 && i5 == i1 + 4 &&
+                i6 == i2 + 4 && i7 == i3 + 4) {
+                __m256 t1 = _mm256_permute_ps(t0, imm);
+                __m256i t2 = _mm256_castps_si256(t1);
+                return SIMDVec_i(t2);
+            }
+            const int blendImm = (i0 > 3) | ((i1 > 3) << 1) | ((i2 > 3) << 2) | ((i3 > 3) << 3) | ((i4 > 3) << 4) | ((i5 > 3) << 5) | ((i6 > 3) << 6) | ((i7 > 3) << 7);
+            __m256i t3 = _mm256_setr_epi32(i0, i1, i2, i3, i4, i5, i6, i7);
+            __m256 t4 = _mm256_permute2f128_ps(t0, t0, 0x00);
+            __m256 t5 = _mm256_permute2f128_ps(t0, t0, 0x11);
+            __m256 t6 = _mm256_blend_ps(_mm256_permutevar_ps(t4, t3), _mm256_permutevar_ps(t5, t3), blendImm);
+            __m256i t9 = _mm256_castps_si256(t6);
+            return SIMDVec_i(t9);
+        }
         // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_i & swizzlea(SIMDSwizzle<8> const & sMask) {
+            SIMDVec_i t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
@@ -379,13 +430,45 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m256i t0 = SPLIT_CALL_BINARY(mVec, b.mVec, saturatedAdd);
+            return SIMDVec_i(t0);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = SPLIT_CALL_BINARY_MASK(mVec, b.mVec, mask.mMask, saturatedAdd);
+            return SIMDVec_i(t0);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int32_t b) const {
+            __m256i t0 = SPLIT_CALL_BINARY_SCALAR(mVec, _mm_set1_epi32(b), saturatedAdd);
+            return SIMDVec_i(t0);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m256i t0 = SPLIT_CALL_BINARY_SCALAR_MASK(mVec, _mm_set1_epi32(b), mask.mMask, saturatedAdd);
+            return SIMDVec_i(t0);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec = SPLIT_CALL_BINARY(mVec, b.mVec, saturatedAdd);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            mVec = SPLIT_CALL_BINARY_MASK(mVec, b.mVec, mask.mMask, saturatedAdd);
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int32_t b) {
+            mVec = SPLIT_CALL_BINARY_SCALAR(mVec, _mm_set1_epi32(b), saturatedAdd);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<8> const & mask, int32_t b) {
+            mVec = SPLIT_CALL_BINARY_SCALAR_MASK(mVec, _mm_set1_epi32(b), mask.mMask, saturatedAdd);
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_i postinc() {
             __m128i t0 = _mm_set1_epi32(1);
@@ -475,13 +558,45 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m256i t0 = SPLIT_CALL_BINARY(mVec, b.mVec, saturatedSub);
+            return SIMDVec_i(t0);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = SPLIT_CALL_BINARY_MASK(mVec, b.mVec, mask.mMask, saturatedSub);
+            return SIMDVec_i(t0);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int32_t b) const {
+            __m256i t0 = SPLIT_CALL_BINARY_SCALAR(mVec, _mm_set1_epi32(b), saturatedSub);
+            return SIMDVec_i(t0);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m256i t0 = SPLIT_CALL_BINARY_SCALAR_MASK(mVec, _mm_set1_epi32(b), mask.mMask, saturatedSub);
+            return SIMDVec_i(t0);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec = SPLIT_CALL_BINARY(mVec, b.mVec, saturatedSub);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            mVec = SPLIT_CALL_BINARY_MASK(mVec, b.mVec, mask.mMask, saturatedSub);
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int32_t b) {
+            mVec = SPLIT_CALL_BINARY_SCALAR(mVec, _mm_set1_epi32(b), saturatedSub);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<8> const & mask, int32_t b) {
+            mVec = SPLIT_CALL_BINARY_SCALAR_MASK(mVec, _mm_set1_epi32(b), mask.mMask, saturatedSub);
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
             __m256i t0 = SPLIT_CALL_BINARY(b.mVec, mVec, _mm_sub_epi32);
@@ -636,6 +751,14 @@ namespace SIMD {
             return diva(b);
         }
         // MDIVSA
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_i operator/ (SIMDDivisor<int32_t> const & b) const {
+            return div(b);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDDivisor<int32_t> const & b) {
+            return diva(b);
+        }
         // RCP
         // MRCP
         // RCPS
@@ -1752,21 +1875,109 @@ namespace SIMD {
             return baseAddr;
         }
         // LSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVec_u<uint32_t, 8> const & b) const {
+            return SCALAR_EMULATION::shiftBitsLeft<SIMDVec_i, SIMDVec_u<uint32_t, 8>>(*this, b);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (SIMDVec_u<uint32_t, 8> const & b) const {
+            return lsh(b);
+        }
         // MLSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) const {
+            return SCALAR_EMULATION::shiftBitsLeft<SIMDVec_i, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this, b);
+        }
         // LSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = SPLIT_CALL_BINARY_SCALAR(mVec, t0, _mm_sll_epi32);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (uint32_t b) const {
+            return lsh(b);
+        }
         // MLSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = SPLIT_CALL_BINARY_SCALAR_MASK(mVec, t0, mask.mMask, _mm_sll_epi32);
+            return SIMDVec_i(t1);
+        }
         // LSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVec_u<uint32_t, 8> const & b) {
+            return SCALAR_EMULATION::shiftBitsLeftAssign<SIMDVec_i, SIMDVec_u<uint32_t, 8>>(*this, b);
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (SIMDVec_u<uint32_t, 8> const & b) {
+            return lsha(b);
+        }
         // MLSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) {
+            return SCALAR_EMULATION::shiftBitsLeftAssign<SIMDVec_i, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this, b);
+        }
         // LSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = SPLIT_CALL_BINARY_SCALAR(mVec, t0, _mm_sll_epi32);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (uint32_t b) {
+            return lsha(b);
+        }
         // MLSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = SPLIT_CALL_BINARY_SCALAR_MASK(mVec, t0, mask.mMask, _mm_sll_epi32);
+            return *this;
+        }
         // RSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVec_u<uint32_t, 8> const & b) const {
+            return SCALAR_EMULATION::shiftBitsRight<SIMDVec_i, SIMDVec_u<uint32_t, 8>>(*this, b);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (SIMDVec_u<uint32_t, 8> const & b) const {
+            return rsh(b);
+        }
         // MRSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) const {
+            return SCALAR_EMULATION::shiftBitsRight<SIMDVec_i, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this, b);
+        }
         // RSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = SPLIT_CALL_BINARY_SCALAR(mVec, t0, _mm_sra_epi32);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (uint32_t b) const {
+            return rsh(b);
+        }
         // MRSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = SPLIT_CALL_BINARY_SCALAR_MASK(mVec, t0, mask.mMask, _mm_sra_epi32);
+            return SIMDVec_i(t1);
+        }
         // RSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVec_u<uint32_t, 8> const & b) {
+            return SCALAR_EMULATION::shiftBitsRightAssign<SIMDVec_i, SIMDVec_u<uint32_t, 8>>(*this, b);
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (SIMDVec_u<uint32_t, 8> const & b) {
+            return rsha(b);
+        }
         // MRSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) {
+            return SCALAR_EMULATION::shiftBitsRightAssign<SIMDVec_i, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this, b);
+        }
         // RSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = SPLIT_CALL_BINARY_SCALAR(mVec, t0, _mm_sra_epi32);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (uint32_t b) {
+            return rsha(b);
+        }
         // MRSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = SPLIT_CALL_BINARY_SCALAR_MASK(mVec, t0, mask.mMask, _mm_sra_epi32);
+            return *this;
+        }
         // ROLV
         // MROLV
         // ROLS
@@ -715,6 +715,32 @@ namespace SIMD {
             mVec = mask.mMask ? mVec / b : mVec;
             return *this;
         }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDDivisor<int64_t> const & b) const {
+            int64_t t0 = b.divide(mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (SIMDDivisor<int64_t> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<1> const & mask, SIMDDivisor<int64_t> const & b) const {
+            int64_t t0 = mask.mMask ? b.divide(mVec) : mVec;
+            return SIMDVec_i(t0);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDDivisor<int64_t> const & b) {
+            mVec = b.divide(mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDDivisor<int64_t> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<1> const & mask, SIMDDivisor<int64_t> const & b) {
+            mVec = mask.mMask ? b.divide(mVec) : mVec;
+            return *this;
+        }
         // RCP
         // MRCP
         // RCPS
@@ -53,7 +53,7 @@
 #endif
 
 #define BLEND(a_256i, b_256i, mask_128i) \
-                _mm256_castpd_si256(_mm256_blendv_pd( \
+                _mm256_castpd_si256(UME_MM256_BLENDV_PD( \
                     _mm256_castsi256_pd(a_256i), \
                     _mm256_castsi256_pd(b_256i), \
                     _mm256_castsi256_pd(_mm256_insertf128_si256( \
@@ -191,6 +191,20 @@ namespace SIMD {
 
         UME_FORCE_INLINE explicit SIMDVec_i(__m256i & x) { mVec = x; }
         UME_FORCE_INLINE explicit SIMDVec_i(const __m256i & x) { mVec = x; }
+
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m128i saturatedAdd(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_add_epi64(a, b);
+            __m128i t1 = _mm_andnot_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, t0));
+            __m128i t2 = _mm_xor_si128(_mm_cmpgt_epi64(_mm_setzero_si128(), a), _mm_srli_epi64(_mm_cmpeq_epi64(a, a), 1));
+            return _mm_castpd_si128(_mm_blendv_pd(_mm_castsi128_pd(t0), _mm_castsi128_pd(t2), _mm_castsi128_pd(t1)));
+        }
+        static UME_FORCE_INLINE __m128i saturatedSub(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_sub_epi64(a, b);
+            __m128i t1 = _mm_and_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, t0));
+            __m128i t2 = _mm_xor_si128(_mm_cmpgt_epi64(_mm_setzero_si128(), a), _mm_srli_epi64(_mm_cmpeq_epi64(a, a), 1));
+            return _mm_castpd_si128(_mm_blendv_pd(_mm_castsi128_pd(t0), _mm_castsi128_pd(t2), _mm_castsi128_pd(t1)));
+        }
     public:
 
         constexpr static uint32_t length() { return 4; }
@@ -349,7 +363,42 @@ namespace SIMD {
             return SIMDVec_i(t1);
         }
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_i swizzle(SIMDSwizzle<4> const & sMask) const {
+            __m256d t0 = _mm256_castsi256_pd(mVec);
+            __m256d t1 = _mm256_permute2f128_pd(t0, t0, 0x00);
+            __m256d t2 = _mm256_permute2f128_pd(t0, t0, 0x11);
+            // vpermilpd selects with bit 1 of each 64-bit index.
+            __m128i t3 = _mm_slli_epi32(_mm_and_si128(sMask.mVec, _mm_set1_epi32(1)), 1);
+            __m128i t4 = _mm_cvtepu32_epi64(t3);
+            __m128i t5 = _mm_cvtepu32_epi64(_mm_unpackhi_epi64(t3, t3));
+            __m256i t6 = _mm256_insertf128_si256(_mm256_castsi128_si256(t4), t5, 1);
+            __m256d t7 = _mm256_cmp_pd(_mm256_cvtepi32_pd(sMask.mVec), _mm256_set1_pd(1.5), _CMP_GT_OQ);
+            __m256d t8 = UME_MM256_BLENDV_PD(_mm256_permutevar_pd(t1, t6), _mm256_permutevar_pd(t2, t6), t7);
+            __m256i t9 = _mm256_castpd_si256(t8);
+            return SIMDVec_i(t9);
+        }
+        template<int i0, int i1, int i2, int i3>
+        UME_FORCE_INLINE SIMDVec_i swizzle() const {
+            const int imm = (i0 & 1) | ((i1 & 1) << 1) | ((i2 & 1) << 2) | ((i3 & 1) << 3);
+            const int blendImm = (i0 > 1) | ((i1 > 1) << 1) | ((i2 > 1) << 2) | ((i3 > 1) << 3);
+            __m256d t0 = _mm256_castsi256_pd(mVec);
+            if (i0 < 2 && i1 < 2 && i2 > 1 && i3 > 1) {
+                __m256d t1 = _mm256_permute_pd(t0, imm);
+                __m256i t9 = _mm256_castpd_si256(t1);
+                return SIMDVec_i(t9);
+            }
+            __m256d t2 = _mm256_permute_pd(_mm256_permute2f128_pd(t0, t0, 0x00), imm);
+            __m256d t3 = _mm256_permute_pd(_mm256_permute2f128_pd(t0, t0, 0x11), imm);
+            __m256d t4 = _mm256_blend_pd(t2, t3, blendImm);
+            __m256i t9 = _mm256_castpd_si256(t4);
+            return SIMDVec_i(t9);
+        }
         // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_i & swizzlea(SIMDSwizzle<4> const & sMask) {
+            SIMDVec_i t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
@@ -404,13 +453,45 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m256i t0 = SPLIT_CALL_BINARY(mVec, b.mVec, saturatedAdd);
+            return SIMDVec_i(t0);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = SPLIT_CALL_BINARY_MASK(mVec, b.mVec, mask.mMask, saturatedAdd);
+            return SIMDVec_i(t0);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int64_t b) const {
+            __m256i t0 = SPLIT_CALL_BINARY_SCALAR(mVec, _mm_set1_epi64x(b), saturatedAdd);
+            return SIMDVec_i(t0);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256i t0 = SPLIT_CALL_BINARY_SCALAR_MASK(mVec, _mm_set1_epi64x(b), mask.mMask, saturatedAdd);
+            return SIMDVec_i(t0);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec = SPLIT_CALL_BINARY(mVec, b.mVec, saturatedAdd);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            mVec = SPLIT_CALL_BINARY_MASK(mVec, b.mVec, mask.mMask, saturatedAdd);
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int64_t b) {
+            mVec = SPLIT_CALL_BINARY_SCALAR(mVec, _mm_set1_epi64x(b), saturatedAdd);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<4> const & mask, int64_t b) {
+            mVec = SPLIT_CALL_BINARY_SCALAR_MASK(mVec, _mm_set1_epi64x(b), mask.mMask, saturatedAdd);
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_i postinc() {
             __m256i t0 = mVec;
@@ -492,13 +573,45 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m256i t0 = SPLIT_CALL_BINARY(mVec, b.mVec, saturatedSub);
+            return SIMDVec_i(t0);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = SPLIT_CALL_BINARY_MASK(mVec, b.mVec, mask.mMask, saturatedSub);
+            return SIMDVec_i(t0);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int64_t b) const {
+            __m256i t0 = SPLIT_CALL_BINARY_SCALAR(mVec, _mm_set1_epi64x(b), saturatedSub);
+            return SIMDVec_i(t0);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256i t0 = SPLIT_CALL_BINARY_SCALAR_MASK(mVec, _mm_set1_epi64x(b), mask.mMask, saturatedSub);
+            return SIMDVec_i(t0);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec = SPLIT_CALL_BINARY(mVec, b.mVec, saturatedSub);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            mVec = SPLIT_CALL_BINARY_MASK(mVec, b.mVec, mask.mMask, saturatedSub);
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int64_t b) {
+            mVec = SPLIT_CALL_BINARY_SCALAR(mVec, _mm_set1_epi64x(b), saturatedSub);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<4> const & mask, int64_t b) {
+            mVec = SPLIT_CALL_BINARY_SCALAR_MASK(mVec, _mm_set1_epi64x(b), mask.mMask, saturatedSub);
+            return *this;
+        }
         // SUBFROMV
         // MSUBFROMV
         // SUBFROMS
@@ -537,9 +650,49 @@ namespace SIMD {
         // MRCPSA
 
         // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpeq(SIMDVec_i const & b) const {
+            __m256i t0 = SPLIT_CALL_BINARY(mVec, b.mVec, _mm_cmpeq_epi64);
+            __m256 t1 = _mm256_castsi256_ps(t0);
+            __m128 t2 = _mm_shuffle_ps(_mm256_castps256_ps128(t1), _mm256_extractf128_ps(t1, 1), 0x88);
+            __m128i t3 = _mm_castps_si128(t2);
+            return SIMDVecMask<4>(t3);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator== (SIMDVec_i const & b) const {
+            return cmpeq(b);
+        }
         // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<4> cmpeq(int64_t b) const {
+            __m256i t0 = SPLIT_CALL_BINARY(mVec, SET1_EPI64(b), _mm_cmpeq_epi64);
+            __m256 t1 = _mm256_castsi256_ps(t0);
+            __m128 t2 = _mm_shuffle_ps(_mm256_castps256_ps128(t1), _mm256_extractf128_ps(t1, 1), 0x88);
+            __m128i t3 = _mm_castps_si128(t2);
+            return SIMDVecMask<4>(t3);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator== (int64_t b) const {
+            return cmpeq(b);
+        }
         // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpne(SIMDVec_i const & b) const {
+            __m256i t0 = SPLIT_CALL_BINARY(mVec, b.mVec, _mm_cmpeq_epi64);
+            __m256 t1 = _mm256_castsi256_ps(t0);
+            __m128 t2 = _mm_shuffle_ps(_mm256_castps256_ps128(t1), _mm256_extractf128_ps(t1, 1), 0x88);
+            __m128i t3 = _mm_xor_si128(_mm_castps_si128(t2), _mm_set1_epi32(0xFFFFFFFF));
+            return SIMDVecMask<4>(t3);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator!= (SIMDVec_i const & b) const {
+            return cmpne(b);
+        }
         // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<4> cmpne(int64_t b) const {
+            __m256i t0 = SPLIT_CALL_BINARY(mVec, SET1_EPI64(b), _mm_cmpeq_epi64);
+            __m256 t1 = _mm256_castsi256_ps(t0);
+            __m128 t2 = _mm_shuffle_ps(_mm256_castps256_ps128(t1), _mm256_extractf128_ps(t1, 1), 0x88);
+            __m128i t3 = _mm_xor_si128(_mm_castps_si128(t2), _mm_set1_epi32(0xFFFFFFFF));
+            return SIMDVecMask<4>(t3);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator!= (int64_t b) const {
+            return cmpne(b);
+        }
         // CMPGTV
         // CMPGTS
         // CMPLTV
@@ -633,27 +786,213 @@ namespace SIMD {
             return SIMDVec_i(t4);
         }
         // BANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVec_i const & b) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(b.mVec);
+            mVec = _mm256_castps_si256(_mm256_and_ps(t0, t1));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (SIMDVec_i const & b) {
+            return banda(b);
+        }
         // MBANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(b.mVec);
+            __m256i t2 = _mm256_castps_si256(_mm256_and_ps(t0, t1));
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
         // BANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(int64_t b) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(SET1_EPI64(b));
+            mVec = _mm256_castps_si256(_mm256_and_ps(t0, t1));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (int64_t b) {
+            return banda(b);
+        }
         // MBANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<4> const & mask, int64_t b) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(SET1_EPI64(b));
+            __m256i t2 = _mm256_castps_si256(_mm256_and_ps(t0, t1));
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
         // BORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVec_i const & b) const {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(b.mVec);
+            __m256 t2 = _mm256_or_ps(t0, t1);
+            __m256i t3 = _mm256_castps_si256(t2);
+            return SIMDVec_i(t3);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (SIMDVec_i const & b) const {
+            return bor(b);
+        }
         // MBORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(b.mVec);
+            __m256 t2 = _mm256_or_ps(t0, t1);
+            __m256i t3 = _mm256_castps_si256(t2);
+            __m256i t4 = BLEND(mVec, t3, mask.mMask);
+            return SIMDVec_i(t4);
+        }
         // BORS
+        UME_FORCE_INLINE SIMDVec_i bor(int64_t b) const {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(SET1_EPI64(b));
+            __m256 t2 = _mm256_or_ps(t0, t1);
+            __m256i t3 = _mm256_castps_si256(t2);
+            return SIMDVec_i(t3);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (int64_t b) const {
+            return bor(b);
+        }
         // MBORS
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(SET1_EPI64(b));
+            __m256 t2 = _mm256_or_ps(t0, t1);
+            __m256i t3 = _mm256_castps_si256(t2);
+            __m256i t4 = BLEND(mVec, t3, mask.mMask);
+            return SIMDVec_i(t4);
+        }
         // BORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVec_i const & b) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(b.mVec);
+            mVec = _mm256_castps_si256(_mm256_or_ps(t0, t1));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (SIMDVec_i const & b) {
+            return bora(b);
+        }
         // MBORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(b.mVec);
+            __m256i t2 = _mm256_castps_si256(_mm256_or_ps(t0, t1));
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
         // BORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(int64_t b) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(SET1_EPI64(b));
+            mVec = _mm256_castps_si256(_mm256_or_ps(t0, t1));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (int64_t b) {
+            return bora(b);
+        }
         // MBORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<4> const & mask, int64_t b) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(SET1_EPI64(b));
+            __m256i t2 = _mm256_castps_si256(_mm256_or_ps(t0, t1));
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
         // BXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVec_i const & b) const {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(b.mVec);
+            __m256 t2 = _mm256_xor_ps(t0, t1);
+            __m256i t3 = _mm256_castps_si256(t2);
+            return SIMDVec_i(t3);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (SIMDVec_i const & b) const {
+            return bxor(b);
+        }
         // MBXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(b.mVec);
+            __m256 t2 = _mm256_xor_ps(t0, t1);
+            __m256i t3 = _mm256_castps_si256(t2);
+            __m256i t4 = BLEND(mVec, t3, mask.mMask);
+            return SIMDVec_i(t4);
+        }
         // BXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(int64_t b) const {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(SET1_EPI64(b));
+            __m256 t2 = _mm256_xor_ps(t0, t1);
+            __m256i t3 = _mm256_castps_si256(t2);
+            return SIMDVec_i(t3);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (int64_t b) const {
+            return bxor(b);
+        }
         // MBXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(SET1_EPI64(b));
+            __m256 t2 = _mm256_xor_ps(t0, t1);
+            __m256i t3 = _mm256_castps_si256(t2);
+            __m256i t4 = BLEND(mVec, t3, mask.mMask);
+            return SIMDVec_i(t4);
+        }
         // BXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVec_i const & b) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(b.mVec);
+            mVec = _mm256_castps_si256(_mm256_xor_ps(t0, t1));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (SIMDVec_i const & b) {
+            return bxora(b);
+        }
         // MBXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(b.mVec);
+            __m256i t2 = _mm256_castps_si256(_mm256_xor_ps(t0, t1));
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
         // BXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(int64_t b) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(SET1_EPI64(b));
+            mVec = _mm256_castps_si256(_mm256_xor_ps(t0, t1));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (int64_t b) {
+            return bxora(b);
+        }
         // MBXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<4> const & mask, int64_t b) {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(SET1_EPI64(b));
+            __m256i t2 = _mm256_castps_si256(_mm256_xor_ps(t0, t1));
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
         // BNOT
+        UME_FORCE_INLINE SIMDVec_i bnot() const {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(_mm256_set1_epi32(0xFFFFFFFF));
+            __m256 t2 = _mm256_xor_ps(t0, t1);
+            __m256i t3 = _mm256_castps_si256(t2);
+            return SIMDVec_i(t3);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator~ () const {
+            return bnot();
+        }
         // MBNOT
+        UME_FORCE_INLINE SIMDVec_i bnot(SIMDVecMask<4> const & mask) const {
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_castsi256_ps(_mm256_set1_epi32(0xFFFFFFFF));
+            __m256 t2 = _mm256_xor_ps(t0, t1);
+            __m256i t3 = _mm256_castps_si256(t2);
+            __m256i t4 = BLEND(mVec, t3, mask.mMask);
+            return SIMDVec_i(t4);
+        }
         // BNOTA
         // MBNOTA
         // HBAND
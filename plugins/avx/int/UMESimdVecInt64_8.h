@@ -51,7 +51,7 @@
 #endif
 
 #define BLEND_LO(a_256i, b_256i, mask_256i) \
-        _mm256_castpd_si256(_mm256_blendv_pd(\
+        _mm256_castpd_si256(UME_MM256_BLENDV_PD(\
             _mm256_castsi256_pd(a_256i), \
             _mm256_castsi256_pd(b_256i), \
             _mm256_castsi256_pd(_mm256_insertf128_si256(\
@@ -63,7 +63,7 @@
                 1))));
 
 #define BLEND_HI(a_256i, b_256i, mask_256i) \
-    _mm256_castpd_si256(_mm256_blendv_pd( \
+    _mm256_castpd_si256(UME_MM256_BLENDV_PD( \
             _mm256_castsi256_pd(a_256i), \
             _mm256_castsi256_pd(b_256i), \
             _mm256_castsi256_pd(_mm256_insertf128_si256( \
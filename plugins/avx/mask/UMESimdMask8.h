@@ -94,6 +94,14 @@ namespace SIMD {
         inline SIMDVecMask(SIMDVecMask const & mask) {
             this->mMask = mask.mMask;
         }
+        // PREFIX
+        static inline SIMDVecMask prefix(uint32_t n) {
+            // AVX has no 256-bit integer comparison; lane indices are exact in float.
+            float t0 = n < 8 ? float(n) : 8.0f;
+            __m256 t1 = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+            __m256 t2 = _mm256_cmp_ps(_mm256_set1_ps(t0), t1, _CMP_GT_OQ);
+            return SIMDVecMask(_mm256_castps_si256(t2));
+        }
         // EXTRACT
         inline bool extract(uint32_t index) const {
             alignas(32) uint32_t raw[8];
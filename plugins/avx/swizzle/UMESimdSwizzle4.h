@@ -34,97 +34,74 @@
 #include "UMESimdSwizzlePrototype.h"
 
 namespace UME {
-    namespace SIMD {
-        /*
-        template<>
-        class SIMDVecMask<4> :
-            public SIMDMaskBaseInterface<
-            SIMDVecMask<4>,
-            uint32_t,
+namespace SIMD {
+
+    template<>
+    class SIMDSwizzle<4> :
+        public SIMDSwizzleMaskBaseInterface<
+            SIMDSwizzle<4>,
             4>
-        {
-            static uint32_t TRUE() { return 0xFFFFFFFF; };
-            static uint32_t FALSE() { return 0x00000000; };
+    {
+        friend class SIMDVec_u<uint8_t, 4>;
+        friend class SIMDVec_u<uint16_t, 4>;
+        friend class SIMDVec_u<uint32_t, 4>;
+        friend class SIMDVec_u<uint64_t, 4>;
+        friend class SIMDVec_i<int8_t, 4>;
+        friend class SIMDVec_i<int16_t, 4>;
+        friend class SIMDVec_i<int32_t, 4>;
+        friend class SIMDVec_i<int64_t, 4>;
+        friend class SIMDVec_f<float, 4>;
+        friend class SIMDVec_f<double, 4>;
 
-            // This function returns internal representation of boolean value based on bool input
-            static inline uint32_t toMaskBool(bool m) { if (m == true) return TRUE(); else return FALSE(); }
-            // This function returns a boolean value based on internal representation
-            static inline bool toBool(uint32_t m) { if ((m & 0x80000000) != 0) return true; else return false; }
+    private:
+        __m128i mVec;
 
-            friend class SIMDVec_u<uint8_t, 4>;
-            friend class SIMDVec_u<uint16_t, 4>;
-            friend class SIMDVec_u<uint32_t, 4>;
-            friend class SIMDVec_u<uint64_t, 4>;
-            friend class SIMDVec_i<int8_t, 4>;
-            friend class SIMDVec_i<int16_t, 4>;
-            friend class SIMDVec_i<int32_t, 4>;
-            friend class SIMDVec_i<int64_t, 4>;
-            friend class SIMDVec_f<float, 4>;
-            friend class SIMDVec_f<double, 4>;
-        private:
-            __m128i mMask;
+    public:
+        UME_FORCE_INLINE SIMDSwizzle() {}
 
-            inline SIMDVecMask(__m128i const & x) { mMask = x; };
-        public:
-            constexpr static uint32_t length() { return 4; }
-            constexpr static uint32_t alignment() { return 16; }
-            inline SIMDVecMask() {}
+        UME_FORCE_INLINE explicit SIMDSwizzle(uint32_t m) {
+            mVec = _mm_set1_epi32(m);
+        }
 
-            // Regardless of the mask representation, the interface should only allow initialization using 
-            // standard bool or using equivalent mask
-            // SET-CONSTR
-            inline explicit SIMDVecMask(bool m) {
-                mMask = _mm_set1_epi32(toMaskBool(m));
-            }
+        // LOAD-CONSTR - Construct by loading from memory
+        UME_FORCE_INLINE explicit SIMDSwizzle(uint32_t const * p) {
+            mVec = _mm_loadu_si128((__m128i*)p);
+        }
+        UME_FORCE_INLINE explicit SIMDSwizzle(uint64_t const * p) {
+            uint32_t raw[4] = {(uint32_t)p[0], (uint32_t)p[1], (uint32_t)p[2], (uint32_t)p[3]};
+            mVec = _mm_loadu_si128((__m128i*)raw);
+        }
 
-            // LOAD-CONSTR
-            inline explicit SIMDVecMask(bool const *p) {
-                alignas(16) uint32_t raw[4];
-                for (int i = 0; i < 4; i++) {
-                    raw[i] = p[i] ? TRUE() : FALSE();
-                }
-                mMask = _mm_load_si128((__m128i*)raw);
-            }
-            // FULL-CONSTR
-            inline explicit SIMDVecMask(bool m0, bool m1, bool m2, bool m3) {
-                mMask = _mm_setr_epi32(toMaskBool(m0), toMaskBool(m1),
-                    toMaskBool(m2), toMaskBool(m3));
-            }
+        UME_FORCE_INLINE SIMDSwizzle(uint32_t m0, uint32_t m1, uint32_t m2, uint32_t m3)
+        {
+            mVec = _mm_set_epi32(m3, m2, m1, m0);
+        }
+        
+        // A non-modifying element-wise access operator
+        UME_FORCE_INLINE uint32_t extract(uint32_t index) const
+        {
+            alignas(16) uint32_t raw[4];
+            _mm_store_si128((__m128i*) raw, mVec);
+            return raw[index];
+        }
+        
+        UME_FORCE_INLINE uint32_t operator[] (uint32_t index) const { return extract(index); }
 
-            inline SIMDVecMask(SIMDVecMask const & mask) {
-                this->mMask = mask.mMask;
-            }
-            // EXTRACT
-            inline bool extract(uint32_t index) const {
-                UME_PERFORMANCE_UNOPTIMAL_WARNING()
-                    alignas(16) uint32_t raw[4];
-                _mm_store_si128((__m128i*)raw, mMask);
-                return raw[index] == TRUE();
-            }
-            inline bool operator[] (uint32_t index) const {
-                return extract(index);
-            }
-            // INSERT
-            inline void insert(uint32_t index, bool x) {
-                UME_PERFORMANCE_UNOPTIMAL_WARNING()
-                    alignas(16) static uint32_t raw[4] = { 0, 0, 0, 0 };
-                _mm_store_si128((__m128i*)raw, mMask);
-                raw[index] = toMaskBool(x);
-                mMask = _mm_load_si128((__m128i*)raw);
-            }
-            // LOAD
-            inline SIMDVecMask & load(bool const * p) {
-                alignas(16) uint32_t raw[4];
-                raw[0] = p[0] ? TRUE() : FALSE();
-                raw[1] = p[1] ? TRUE() : FALSE();
-                raw[2] = p[2] ? TRUE() : FALSE();
-                raw[3] = p[3] ? TRUE() : FALSE();
-                mMask = _mm_load_si128((__m128i*)raw);
-                return *this;
-            }
-        };
-        */
-    }
+        // Element-wise modification operator
+        UME_FORCE_INLINE SIMDSwizzle & insert(uint32_t index, uint32_t value) {
+            alignas(16) uint32_t raw[4];
+            _mm_store_si128((__m128i*)raw, mVec);
+            raw[index] = value;
+            mVec = _mm_load_si128((__m128i*)raw);
+            return *this;
+        }
+
+        UME_FORCE_INLINE SIMDSwizzle(SIMDSwizzle const & swizzle) {
+            mVec = swizzle.mVec;
+        }
+    };
+
+}
 }
 
 #endif
@@ -64,6 +64,14 @@ namespace SIMD {
         UME_FORCE_INLINE explicit SIMDVec_u(__m128i & x) { this->mVec = x; }
         UME_FORCE_INLINE explicit SIMDVec_u(const __m128i & x) { this->mVec = x; }
 
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m128i saturatedAdd(__m128i const & a, __m128i const & b) {
+            return _mm_add_epi32(a, _mm_min_epu32(b, _mm_xor_si128(a, _mm_set1_epi32(-1))));
+        }
+        static UME_FORCE_INLINE __m128i saturatedSub(__m128i const & a, __m128i const & b) {
+            return _mm_sub_epi32(_mm_max_epu32(a, b), b);
+        }
+
     public:
 
         constexpr static uint32_t length() { return 4; }
@@ -217,7 +225,22 @@ namespace SIMD {
             return SIMDVec_u(t1);
         }
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_u swizzle(SIMDSwizzle<4> const & sMask) const {
+            __m128 t0 = _mm_permutevar_ps(_mm_castsi128_ps(mVec), sMask.mVec);
+            __m128i t1 = _mm_castps_si128(t0);
+            return SIMDVec_u(t1);
+        }
+        template<int i0, int i1, int i2, int i3>
+        UME_FORCE_INLINE SIMDVec_u swizzle() const {
+            __m128i t0 = _mm_shuffle_epi32(mVec, (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6));
+            return SIMDVec_u(t0);
+        }
         // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_u & swizzlea(SIMDSwizzle<4> const & sMask) {
+            SIMDVec_u t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
             __m128i t0 = _mm_add_epi32(mVec, b.mVec);
@@ -277,13 +300,53 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVec_u const & b) const {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            return SIMDVec_u(t1);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVec_u const & b) {
+            mVec = saturatedAdd(mVec, b.mVec);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = saturatedAdd(mVec, t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_u postinc() {
             __m128i t0 = _mm_set1_epi32(1);
@@ -377,13 +440,53 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVec_u const & b) const {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            return SIMDVec_u(t1);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVec_u const & b) {
+            mVec = saturatedSub(mVec, b.mVec);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = saturatedSub(mVec, t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVec_u const & b) const {
             __m128i t0 = _mm_sub_epi32(b.mVec, mVec);
@@ -930,6 +1033,9 @@ namespace SIMD {
             __m128i t0 = _mm_and_si128(mVec, b.mVec);
             return SIMDVec_u(t0);
         }
+        UME_FORCE_INLINE SIMDVec_u operator& (SIMDVec_u const & b) const {
+            return band(b);
+        }
         // MBANDV
         UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
             __m128i t0 = _mm_and_si128(mVec, b.mVec);
@@ -942,6 +1048,9 @@ namespace SIMD {
             __m128i t1 = _mm_and_si128(mVec, t0);
             return SIMDVec_u(t1);
         }
+        UME_FORCE_INLINE SIMDVec_u operator& (uint32_t b) const {
+            return band(b);
+        }
         // MBANDS
         UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<4> const & mask, uint32_t b) const {
             __m128i t0 = _mm_set1_epi32(b);
@@ -954,6 +1063,9 @@ namespace SIMD {
             mVec = _mm_and_si128(mVec, b.mVec);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (SIMDVec_u const & b) {
+            return banda(b);
+        }
         // MBANDVA
         UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
             __m128i t0 = _mm_and_si128(mVec, b.mVec);
@@ -966,6 +1078,9 @@ namespace SIMD {
             mVec = _mm_and_si128(mVec, t0);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (uint32_t b) {
+            return banda(b);
+        }
         // MBANDSA
         UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<4> const & mask, uint32_t b) {
             __m128i t0 = _mm_set1_epi32(b);
@@ -978,6 +1093,9 @@ namespace SIMD {
             __m128i t0 = _mm_or_si128(mVec, b.mVec);
             return SIMDVec_u(t0);
         }
+        UME_FORCE_INLINE SIMDVec_u operator| (SIMDVec_u const & b) const {
+            return bor(b);
+        }
         // MBORV
         UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
             __m128i t0 = _mm_or_si128(mVec, b.mVec);
@@ -990,6 +1108,9 @@ namespace SIMD {
             __m128i t1 = _mm_or_si128(mVec, t0);
             return SIMDVec_u(t1);
         }
+        UME_FORCE_INLINE SIMDVec_u operator| (uint32_t b) const {
+            return bor(b);
+        }
         // MBORS
         UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<4> const & mask, uint32_t b) const {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1002,6 +1123,9 @@ namespace SIMD {
             mVec = _mm_or_si128(mVec, b.mVec);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (SIMDVec_u const & b) {
+            return bora(b);
+        }
         // MBORVA
         UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
             __m128i t0 = _mm_or_si128(mVec, b.mVec);
@@ -1014,6 +1138,9 @@ namespace SIMD {
             mVec = _mm_or_si128(mVec, t0);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (uint32_t b) {
+            return bora(b);
+        }
         // MBORSA
         UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<4> const & mask, uint32_t b) {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1026,6 +1153,9 @@ namespace SIMD {
             __m128i t0 = _mm_xor_si128(mVec, b.mVec);
             return SIMDVec_u(t0);
         }
+        UME_FORCE_INLINE SIMDVec_u operator^ (SIMDVec_u const & b) const {
+            return bxor(b);
+        }
         // MBXORV
         UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
             __m128i t0 = _mm_xor_si128(mVec, b.mVec);
@@ -1038,6 +1168,9 @@ namespace SIMD {
             __m128i t1 = _mm_xor_si128(mVec, t0);
             return SIMDVec_u(t1);
         }
+        UME_FORCE_INLINE SIMDVec_u operator^ (uint32_t b) const {
+            return bxor(b);
+        }
         // MBXORS
         UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<4> const & mask, uint32_t b) const {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1050,6 +1183,9 @@ namespace SIMD {
             mVec = _mm_xor_si128(mVec, b.mVec);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_u & operator^= (SIMDVec_u const & b) {
+            return bxora(b);
+        }
         // MBXORVA
         UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
             __m128i t0 = _mm_xor_si128(mVec, b.mVec);
@@ -1062,6 +1198,9 @@ namespace SIMD {
             mVec = _mm_xor_si128(mVec, t0);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_u & operator^= (uint32_t b) {
+            return bxora(b);
+        }
         // MBXORSA
         UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<4> const & mask, uint32_t b) {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1075,6 +1214,9 @@ namespace SIMD {
             __m128i t1 = _mm_xor_si128(mVec, t0);
             return SIMDVec_u(t1);
         }
+        UME_FORCE_INLINE SIMDVec_u operator~ () const {
+            return bnot();
+        }
         // MBNOT
         UME_FORCE_INLINE SIMDVec_u bnot(SIMDVecMask<4> const & mask) const {
             __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
@@ -1255,21 +1397,113 @@ namespace SIMD {
         }
 
         // LSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVec_u<uint32_t, 4> const & b) const {
+            return SCALAR_EMULATION::shiftBitsLeft<SIMDVec_u, SIMDVec_u<uint32_t, 4>>(*this, b);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (SIMDVec_u<uint32_t, 4> const & b) const {
+            return lsh(b);
+        }
         // MLSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<4> const & mask, SIMDVec_u<uint32_t, 4> const & b) const {
+            return SCALAR_EMULATION::shiftBitsLeft<SIMDVec_u, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this, b);
+        }
         // LSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi32(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (uint32_t b) const {
+            return lsh(b);
+        }
         // MLSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi32(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // LSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVec_u<uint32_t, 4> const & b) {
+            return SCALAR_EMULATION::shiftBitsLeftAssign<SIMDVec_u, SIMDVec_u<uint32_t, 4>>(*this, b);
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (SIMDVec_u<uint32_t, 4> const & b) {
+            return lsha(b);
+        }
         // MLSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<4> const & mask, SIMDVec_u<uint32_t, 4> const & b) {
+            return SCALAR_EMULATION::shiftBitsLeftAssign<SIMDVec_u, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this, b);
+        }
         // LSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = _mm_sll_epi32(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (uint32_t b) {
+            return lsha(b);
+        }
         // MLSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi32(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
         // RSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVec_u<uint32_t, 4> const & b) const {
+            return SCALAR_EMULATION::shiftBitsRight<SIMDVec_u, SIMDVec_u<uint32_t, 4>>(*this, b);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (SIMDVec_u<uint32_t, 4> const & b) const {
+            return rsh(b);
+        }
         // MRSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<4> const & mask, SIMDVec_u<uint32_t, 4> const & b) const {
+            return SCALAR_EMULATION::shiftBitsRight<SIMDVec_u, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this, b);
+        }
         // RSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_srl_epi32(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (uint32_t b) const {
+            return rsh(b);
+        }
         // MRSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_srl_epi32(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // RSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVec_u<uint32_t, 4> const & b) {
+            return SCALAR_EMULATION::shiftBitsRightAssign<SIMDVec_u, SIMDVec_u<uint32_t, 4>>(*this, b);
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (SIMDVec_u<uint32_t, 4> const & b) {
+            return rsha(b);
+        }
         // MRSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<4> const & mask, SIMDVec_u<uint32_t, 4> const & b) {
+            return SCALAR_EMULATION::shiftBitsRightAssign<SIMDVec_u, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this, b);
+        }
         // RSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = _mm_srl_epi32(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (uint32_t b) {
+            return rsha(b);
+        }
         // MRSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_srl_epi32(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
         // ROLV
         // MROLV
         // ROLS
@@ -37,7 +37,7 @@
 #include "../../../UMESimdInterface.h"
 
 #define BLEND(a_256i, b_256i, mask_256i) _mm256_castps_si256( \
-                                        _mm256_blendv_ps( \
+                                        UME_MM256_BLENDV_PS( \
                                             _mm256_castsi256_ps(a_256i), \
                                             _mm256_castsi256_ps(b_256i), \
                                             _mm256_castsi256_ps(mask_256i)))
@@ -174,6 +174,14 @@ namespace SIMD {
 
         UME_FORCE_INLINE explicit SIMDVec_u(__m256i & x) { this->mVec = x; }
         UME_FORCE_INLINE explicit SIMDVec_u(const __m256i & x) { this->mVec = x; }
+
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m128i saturatedAdd(__m128i const & a, __m128i const & b) {
+            return _mm_add_epi32(a, _mm_min_epu32(b, _mm_xor_si128(a, _mm_set1_epi32(-1))));
+        }
+        static UME_FORCE_INLINE __m128i saturatedSub(__m128i const & a, __m128i const & b) {
+            return _mm_sub_epi32(_mm_max_epu32(a, b), b);
+        }
     public:
 
         constexpr static uint32_t length() { return 8; }
@@ -295,15 +303,56 @@ namespace SIMD {
         // STORE
         // MSTORE
         // STOREA
-        /*UME_FORCE_INLINE uint32_t * storea(uint32_t * addrAligned) const {
+        UME_FORCE_INLINE uint32_t * storea(uint32_t * addrAligned) const {
             _mm256_store_si256((__m256i*)addrAligned, mVec);
             return addrAligned;
-        }*/
+        }
         // MSTOREA
+        UME_FORCE_INLINE uint32_t * storea(SIMDVecMask<8> const & mask, uint32_t * addrAligned) const {
+            _mm256_maskstore_ps((float*)addrAligned, mask.mMask, _mm256_castsi256_ps(mVec));
+            return addrAligned;
+        }
         // BLENDV
         // BLENDS
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_u swizzle(SIMDSwizzle<8> const & sMask) const {
+            // Permute both 128-bit halves within lanes, then select per element
+            // using bit 2 of the index.
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            __m256 t1 = _mm256_permute2f128_ps(t0, t0, 0x00);
+            __m256 t2 = _mm256_permute2f128_ps(t0, t0, 0x11);
+            __m256 t3 = _mm256_permutevar_ps(t1, sMask.mVec);
+            __m256 t4 = _mm256_permutevar_ps(t2, sMask.mVec);
+            __m256 t5 = _mm256_cmp_ps(_mm256_cvtepi32_ps(sMask.mVec), _mm256_set1_ps(3.5f), _CMP_GT_OQ);
+            __m256 t6 = UME_MM256_BLENDV_PS(t3, t4, t5);
+            __m256i t9 = _mm256_castps_si256(t6);
+            return SIMDVec_u(t9);
+        }
+        template<int i0, int i1, int i2, int i3, int i4, int i5, int i6, int i7>
+        UME_FORCE_INLINE SIMDVec_u swizzle() const {
+            const int imm = (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6);
+            __m256 t0 = _mm256_castsi256_ps(mVec);
+            // Patterns repeated in both 128-bit lanes need only an immediate shuffle.
+            if (i0 < 4 && i1 < 4 && i2 < 4 && i3 < 4 && i4 == i0 + 4 && i5 == i1 + 4 &&
+                i6 == i2 + 4 && i7 == i3 + 4) {
+                __m256 t1 = _mm256_permute_ps(t0, imm);
+                __m256i t2 = _mm256_castps_si256(t1);
+                return SIMDVec_u(t2);
+            }
+            const int blendImm = (i0 > 3) | ((i1 > 3) << 1) | ((i2 > 3) << 2) | ((i3 > 3) << 3) | ((i4 > 3) << 4) | ((i5 > 3) << 5) | ((i6 > 3) << 6) | ((i7 > 3) << 7);
+            __m256i t3 = _mm256_setr_epi32(i0, i1, i2, i3, i4, i5, i6, i7);
+            __m256 t4 = _mm256_permute2f128_ps(t0, t0, 0x00);
+            __m256 t5 = _mm256_permute2f128_ps(t0, t0, 0x11);
+            __m256 t6 = _mm256_blend_ps(_mm256_permutevar_ps(t4, t3), _mm256_permutevar_ps(t5, t3), blendImm);
+            __m256i t9 = _mm256_castps_si256(t6);
+            return SIMDVec_u(t9);
+        }
         // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_u & swizzlea(SIMDSwizzle<8> const & sMask) {
+            SIMDVec_u t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
@@ -362,13 +411,45 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVec_u const & b) const {
+            __m256i t0 = SPLIT_CALL_BINARY(mVec, b.mVec, saturatedAdd);
+            return SIMDVec_u(t0);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = SPLIT_CALL_BINARY_MASK(mVec, b.mVec, mask.mMask, saturatedAdd);
+            return SIMDVec_u(t0);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(uint32_t b) const {
+            __m256i t0 = SPLIT_CALL_BINARY_SCALAR(mVec, _mm_set1_epi32(b), saturatedAdd);
+            return SIMDVec_u(t0);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m256i t0 = SPLIT_CALL_BINARY_SCALAR_MASK(mVec, _mm_set1_epi32(b), mask.mMask, saturatedAdd);
+            return SIMDVec_u(t0);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVec_u const & b) {
+            mVec = SPLIT_CALL_BINARY(mVec, b.mVec, saturatedAdd);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            mVec = SPLIT_CALL_BINARY_MASK(mVec, b.mVec, mask.mMask, saturatedAdd);
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(uint32_t b) {
+            mVec = SPLIT_CALL_BINARY_SCALAR(mVec, _mm_set1_epi32(b), saturatedAdd);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<8> const & mask, uint32_t b) {
+            mVec = SPLIT_CALL_BINARY_SCALAR_MASK(mVec, _mm_set1_epi32(b), mask.mMask, saturatedAdd);
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_u postinc() {
             __m128i t0 = _mm_set1_epi32(1);
@@ -458,13 +539,45 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVec_u const & b) const {
+            __m256i t0 = SPLIT_CALL_BINARY(mVec, b.mVec, saturatedSub);
+            return SIMDVec_u(t0);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = SPLIT_CALL_BINARY_MASK(mVec, b.mVec, mask.mMask, saturatedSub);
+            return SIMDVec_u(t0);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(uint32_t b) const {
+            __m256i t0 = SPLIT_CALL_BINARY_SCALAR(mVec, _mm_set1_epi32(b), saturatedSub);
+            return SIMDVec_u(t0);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m256i t0 = SPLIT_CALL_BINARY_SCALAR_MASK(mVec, _mm_set1_epi32(b), mask.mMask, saturatedSub);
+            return SIMDVec_u(t0);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVec_u const & b) {
+            mVec = SPLIT_CALL_BINARY(mVec, b.mVec, saturatedSub);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            mVec = SPLIT_CALL_BINARY_MASK(mVec, b.mVec, mask.mMask, saturatedSub);
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(uint32_t b) {
+            mVec = SPLIT_CALL_BINARY_SCALAR(mVec, _mm_set1_epi32(b), saturatedSub);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<8> const & mask, uint32_t b) {
+            mVec = SPLIT_CALL_BINARY_SCALAR_MASK(mVec, _mm_set1_epi32(b), mask.mMask, saturatedSub);
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVec_u const & b) const {
             __m256i t0 = SPLIT_CALL_BINARY(b.mVec, mVec, _mm_sub_epi32);
@@ -619,6 +732,14 @@ namespace SIMD {
             return diva(b);
         }
         // MDIVSA
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_u operator/ (SIMDDivisor<uint32_t> const & b) const {
+            return div(b);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDDivisor<uint32_t> const & b) {
+            return diva(b);
+        }
         // RCP
         // MRCP
         // RCPS
@@ -1757,21 +1878,109 @@ namespace SIMD {
             return baseAddr;
         }
         // LSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVec_u<uint32_t, 8> const & b) const {
+            return SCALAR_EMULATION::shiftBitsLeft<SIMDVec_u, SIMDVec_u<uint32_t, 8>>(*this, b);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (SIMDVec_u<uint32_t, 8> const & b) const {
+            return lsh(b);
+        }
         // MLSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) const {
+            return SCALAR_EMULATION::shiftBitsLeft<SIMDVec_u, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this, b);
+        }
         // LSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = SPLIT_CALL_BINARY_SCALAR(mVec, t0, _mm_sll_epi32);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (uint32_t b) const {
+            return lsh(b);
+        }
         // MLSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = SPLIT_CALL_BINARY_SCALAR_MASK(mVec, t0, mask.mMask, _mm_sll_epi32);
+            return SIMDVec_u(t1);
+        }
         // LSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVec_u<uint32_t, 8> const & b) {
+            return SCALAR_EMULATION::shiftBitsLeftAssign<SIMDVec_u, SIMDVec_u<uint32_t, 8>>(*this, b);
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (SIMDVec_u<uint32_t, 8> const & b) {
+            return lsha(b);
+        }
         // MLSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) {
+            return SCALAR_EMULATION::shiftBitsLeftAssign<SIMDVec_u, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this, b);
+        }
         // LSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = SPLIT_CALL_BINARY_SCALAR(mVec, t0, _mm_sll_epi32);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (uint32_t b) {
+            return lsha(b);
+        }
         // MLSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = SPLIT_CALL_BINARY_SCALAR_MASK(mVec, t0, mask.mMask, _mm_sll_epi32);
+            return *this;
+        }
         // RSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVec_u<uint32_t, 8> const & b) const {
+            return SCALAR_EMULATION::shiftBitsRight<SIMDVec_u, SIMDVec_u<uint32_t, 8>>(*this, b);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (SIMDVec_u<uint32_t, 8> const & b) const {
+            return rsh(b);
+        }
         // MRSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) const {
+            return SCALAR_EMULATION::shiftBitsRight<SIMDVec_u, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this, b);
+        }
         // RSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = SPLIT_CALL_BINARY_SCALAR(mVec, t0, _mm_srl_epi32);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (uint32_t b) const {
+            return rsh(b);
+        }
         // MRSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = SPLIT_CALL_BINARY_SCALAR_MASK(mVec, t0, mask.mMask, _mm_srl_epi32);
+            return SIMDVec_u(t1);
+        }
         // RSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVec_u<uint32_t, 8> const & b) {
+            return SCALAR_EMULATION::shiftBitsRightAssign<SIMDVec_u, SIMDVec_u<uint32_t, 8>>(*this, b);
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (SIMDVec_u<uint32_t, 8> const & b) {
+            return rsha(b);
+        }
         // MRSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) {
+            return SCALAR_EMULATION::shiftBitsRightAssign<SIMDVec_u, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this, b);
+        }
         // RSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = SPLIT_CALL_BINARY_SCALAR(mVec, t0, _mm_srl_epi32);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (uint32_t b) {
+            return rsha(b);
+        }
         // MRSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = SPLIT_CALL_BINARY_SCALAR_MASK(mVec, t0, mask.mMask, _mm_srl_epi32);
+            return *this;
+        }
         // ROLV
         // MROLV
         // ROLS
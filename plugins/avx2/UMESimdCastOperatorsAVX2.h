@@ -62,14 +62,12 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 8>, int8_t, SIMDVec_u<uint8_t, 8>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_u<uint8_t, 16>::operator SIMDVec_i<int8_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 16>, int8_t, SIMDVec_u<uint8_t, 16>>(*this);
+        return SIMDVec_i<int8_t, 16>(mVec);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_u<uint8_t, 32>::operator SIMDVec_i<int8_t, 32>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 32>, int8_t, SIMDVec_u<uint8_t, 32>>(*this);
+        return SIMDVec_i<int8_t, 32>(mVec);
     }
 
     template<>
@@ -97,19 +95,16 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 4>, int16_t, SIMDVec_u<uint16_t, 4>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 8>::operator SIMDVec_i<int16_t, 8>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 8>, int16_t, SIMDVec_u<uint16_t, 8>>(*this);
+        return SIMDVec_i<int16_t, 8>(mVec);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 16>::operator SIMDVec_i<int16_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 16>, int16_t, SIMDVec_u<uint16_t, 16>>(*this);
+        return SIMDVec_i<int16_t, 16>(mVec);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 32>::operator SIMDVec_i<int16_t, 32>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 32>, int16_t, SIMDVec_u<uint16_t, 32>>(*this);
+        return SIMDVec_i<int16_t, 32>(mVec[0], mVec[1]);
     }
 
     template<>
@@ -126,15 +121,19 @@ namespace SIMD {
     }
 
     UME_FORCE_INLINE SIMDVec_u<uint32_t, 4>::operator SIMDVec_i<int32_t, 4>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int32_t, 4>, int32_t, SIMDVec_u<uint32_t, 4>> (*this);
+        __m128i t0 = mVec;
+        return SIMDVec_i<int32_t, 4>(t0);
     }
 
     UME_FORCE_INLINE SIMDVec_u<uint32_t, 8>::operator SIMDVec_i<int32_t, 8>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int32_t, 8>, int32_t, SIMDVec_u<uint32_t, 8>>(*this);
+        __m256i t0 = mVec;
+        return SIMDVec_i<int32_t, 8>(t0);
     }
 
     UME_FORCE_INLINE SIMDVec_u<uint32_t, 16>::operator SIMDVec_i<int32_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int32_t, 16>, int32_t, SIMDVec_u<uint32_t, 16>>(*this);
+        __m256i t0 = mVec[0];
+        __m256i t1 = mVec[1];
+        return SIMDVec_i<int32_t, 16>(t0, t1);
     }
 
     template<>
@@ -174,27 +173,25 @@ namespace SIMD {
     }
 
     UME_FORCE_INLINE SIMDVec_u<uint32_t, 4>::operator SIMDVec_f<float, 4>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_f<float, 4>, float, SIMDVec_u<uint32_t, 4>>(*this);
+        // There is no unsigned conversion: convert the 16-bit halves
+        // separately. Both partial results are exact, so only the final
+        // addition rounds.
+        __m128i t0 = _mm_srli_epi32(mVec, 16);
+        __m128i t1 = _mm_and_si128(mVec, _mm_set1_epi32(0xFFFF));
+        __m128 t2 = _mm_mul_ps(_mm_cvtepi32_ps(t0), _mm_set1_ps(65536.0f));
+        __m128 t3 = _mm_add_ps(t2, _mm_cvtepi32_ps(t1));
+        return SIMDVec_f<float, 4>(t3);
     }
 
     UME_FORCE_INLINE SIMDVec_u<uint32_t, 8>::operator SIMDVec_f<float, 8>() const {
         // AVX2 does not provide instruction for converting unsinged
-        // integer to floating point.
-        alignas(32) uint32_t raw_u[8];
-        alignas(32) float raw_f[8];
-
-        _mm256_store_si256((__m256i*)raw_u, mVec);
-        raw_f[0] = (float)raw_u[0];
-        raw_f[1] = (float)raw_u[1];
-        raw_f[2] = (float)raw_u[2];
-        raw_f[3] = (float)raw_u[3];
-        raw_f[4] = (float)raw_u[4];
-        raw_f[5] = (float)raw_u[5];
-        raw_f[6] = (float)raw_u[6];
-        raw_f[7] = (float)raw_u[7];
-        __m256 t0 = _mm256_load_ps(raw_f);
-
-        return SIMDVec_f<float, 8>(t0);
+        // integer to floating point: convert the 16-bit halves separately.
+        // Both partial results are exact, so only the final addition rounds.
+        __m256i t0 = _mm256_srli_epi32(mVec, 16);
+        __m256i t1 = _mm256_and_si256(mVec, _mm256_set1_epi32(0xFFFF));
+        __m256 t2 = _mm256_mul_ps(_mm256_cvtepi32_ps(t0), _mm256_set1_ps(65536.0f));
+        __m256 t3 = _mm256_add_ps(t2, _mm256_cvtepi32_ps(t1));
+        return SIMDVec_f<float, 8>(t3);
     }
 
     UME_FORCE_INLINE SIMDVec_u<uint32_t, 16>::operator SIMDVec_f<float, 16>() const {
@@ -215,7 +212,14 @@ namespace SIMD {
     }
 
     UME_FORCE_INLINE SIMDVec_u<uint64_t, 4>::operator SIMDVec_f<double, 4>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_f<double, 4>, double, SIMDVec_u<uint64_t, 4>>(*this);
+        // Embed the upper and lower 32 bits of each element into the mantissas
+        // of 2^84 and 2^52 and let the floating-point unit do the conversion.
+        __m256i t0 = _mm256_srli_epi64(mVec, 32);
+        t0 = _mm256_or_si256(t0, _mm256_set1_epi64x(0x4530000000000000));                 // 2^84
+        __m256i t1 = _mm256_blend_epi32(_mm256_set1_epi64x(0x4330000000000000), mVec, 0x55); // 2^52
+        __m256d t2 = _mm256_sub_pd(_mm256_castsi256_pd(t0), _mm256_castsi256_pd(_mm256_set1_epi64x(0x4530000000100000))); // 2^84 + 2^52
+        __m256d t3 = _mm256_add_pd(t2, _mm256_castsi256_pd(t1));
+        return SIMDVec_f<double, 4>(t3);
     }
 
     template<>
@@ -249,14 +253,12 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 8>, uint8_t, SIMDVec_i<int8_t, 8>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_i<int8_t, 16>::operator SIMDVec_u<uint8_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 16>, uint8_t, SIMDVec_i<int8_t, 16>>(*this);
+        return SIMDVec_u<uint8_t, 16>(mVec);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_i<int8_t, 32>::operator SIMDVec_u<uint8_t, 32>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 32>, uint8_t, SIMDVec_i<int8_t, 32>>(*this);
+        return SIMDVec_u<uint8_t, 32>(mVec);
     }
 
     template<>
@@ -284,19 +286,16 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 4>, uint16_t, SIMDVec_i<int16_t, 4>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 8>::operator SIMDVec_u<uint16_t, 8>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 8>, uint16_t, SIMDVec_i<int16_t, 8>>(*this);
+        return SIMDVec_u<uint16_t, 8>(mVec);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 16>::operator SIMDVec_u<uint16_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 16>, uint16_t, SIMDVec_i<int16_t, 16>>(*this);
+        return SIMDVec_u<uint16_t, 16>(mVec);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 32>::operator SIMDVec_u<uint16_t, 32>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 32>, uint32_t, SIMDVec_i<int16_t, 32>>(*this);
+        return SIMDVec_u<uint16_t, 32>(mVec[0], mVec[1]);
     }
 
     template<>
@@ -313,15 +312,19 @@ namespace SIMD {
     }
 
     UME_FORCE_INLINE SIMDVec_i<int32_t, 4>::operator SIMDVec_u<uint32_t, 4>() const {
-        return SCALAR_EMULATION::xtoy < SIMDVec_u<uint32_t, 4>, uint32_t, SIMDVec_i<int32_t, 4>> (*this);
+        __m128i t0 = mVec;
+        return SIMDVec_u<uint32_t, 4>(t0);
     }
 
     UME_FORCE_INLINE SIMDVec_i<int32_t, 8>::operator SIMDVec_u<uint32_t, 8>() const {
-        return SCALAR_EMULATION::xtoy < SIMDVec_u<uint32_t, 8>, uint32_t, SIMDVec_i<int32_t, 8>>(*this);
+        __m256i t0 = mVec;
+        return SIMDVec_u<uint32_t, 8>(t0);
     }
 
     UME_FORCE_INLINE SIMDVec_i<int32_t, 16>::operator SIMDVec_u<uint32_t, 16>() const {
-        return SCALAR_EMULATION::xtoy < SIMDVec_u<uint32_t, 16>, uint32_t, SIMDVec_i<int32_t, 16>>(*this);
+        __m256i t0 = mVec[0];
+        __m256i t1 = mVec[1];
+        return SIMDVec_u<uint32_t, 16>(t0, t1);
     }
 
     UME_FORCE_INLINE SIMDVec_i<int32_t, 32>::operator SIMDVec_u<uint32_t, 32>() const {
@@ -358,7 +361,8 @@ namespace SIMD {
     }
 
     UME_FORCE_INLINE SIMDVec_i<int32_t, 4>::operator SIMDVec_f<float, 4>() const {
-        return SCALAR_EMULATION::xtoy < SIMDVec_f<float, 4>, float, SIMDVec_i<int32_t, 4>>(*this);
+        __m128 t0 = _mm_cvtepi32_ps(mVec);
+        return SIMDVec_f<float, 4>(t0);
     }
 
     UME_FORCE_INLINE SIMDVec_i<int32_t, 8>::operator SIMDVec_f<float, 8>() const {
@@ -383,7 +387,15 @@ namespace SIMD {
     }
 
     UME_FORCE_INLINE SIMDVec_i<int64_t, 4>::operator SIMDVec_f<double, 4>() const {
-        return SCALAR_EMULATION::xtoy < SIMDVec_f<double, 4>, double, SIMDVec_i<int64_t, 4>>(*this);
+        // Embed the upper (sign-flipped) and lower 32 bits of each element into
+        // the mantissas of 2^84 + 2^63 and 2^52 and let the floating-point unit
+        // do the conversion.
+        __m256i t0 = _mm256_srli_epi64(mVec, 32);
+        t0 = _mm256_xor_si256(t0, _mm256_set1_epi64x(0x4530000080000000));                // 2^84 + 2^63
+        __m256i t1 = _mm256_blend_epi32(_mm256_set1_epi64x(0x4330000000000000), mVec, 0x55); // 2^52
+        __m256d t2 = _mm256_sub_pd(_mm256_castsi256_pd(t0), _mm256_castsi256_pd(_mm256_set1_epi64x(0x4530000080100000))); // 2^84 + 2^63 + 2^52
+        __m256d t3 = _mm256_add_pd(t2, _mm256_castsi256_pd(t1));
+        return SIMDVec_f<double, 4>(t3);
     }
 
     UME_FORCE_INLINE SIMDVec_i<int64_t, 8>::operator SIMDVec_f<double, 8>() const {
@@ -480,7 +492,8 @@ namespace SIMD {
     }
 
     UME_FORCE_INLINE SIMDVec_f<float, 4>::operator SIMDVec_i<int32_t, 4>() const {
-        __m128i t0 = _mm_cvtps_epi32(mVec);
+        // C++: Truncation is default rounding mode for floating-integer conversion.
+        __m128i t0 = _mm_cvttps_epi32(mVec);
         return SIMDVec_i<int32_t, 4>(t0);
     }
 
@@ -525,6 +538,17 @@ namespace SIMD {
 
     UME_FORCE_INLINE SIMDVec_f<double, 4>::operator SIMDVec_i<int64_t, 4>() const {
         // C++: Truncation is default rounding mode for floating-integer conversion.
+        __m256d t0 = _mm256_round_pd(mVec, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        __m256d t1 = _mm256_andnot_pd(_mm256_set1_pd(-0.0), t0);
+        __m256d t2 = _mm256_cmp_pd(t1, _mm256_set1_pd(2251799813685248.0), _CMP_LT_OQ); // 2^51
+        if (_mm256_movemask_pd(t2) == 0xF) {
+            // All elements fit into 52 bits: adding 1.5*2^52 places the
+            // integer value in the low bits of the mantissa.
+            __m256d t3 = _mm256_set1_pd(6755399441055744.0);                            // 1.5*2^52
+            __m256d t4 = _mm256_add_pd(t0, t3);
+            __m256i t5 = _mm256_sub_epi64(_mm256_castpd_si256(t4), _mm256_castpd_si256(t3));
+            return SIMDVec_i<int64_t, 4>(t5);
+        }
         alignas(32) double raw_64f[4];
         alignas(32) int64_t raw_64i[4];
         _mm256_store_pd(raw_64f, mVec);
@@ -532,8 +556,8 @@ namespace SIMD {
         raw_64i[1] = int64_t(raw_64f[1]);
         raw_64i[2] = int64_t(raw_64f[2]);
         raw_64i[3] = int64_t(raw_64f[3]);
-        __m256i t0 = _mm256_load_si256((__m256i *)raw_64i);
-        return SIMDVec_i<int64_t, 4>(t0);
+        __m256i t6 = _mm256_load_si256((__m256i *)raw_64i);
+        return SIMDVec_i<int64_t, 4>(t6);
     }
 
     UME_FORCE_INLINE SIMDVec_f<double, 8>::operator SIMDVec_i<int64_t, 8>() const {
@@ -607,14 +631,15 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 8>, uint16_t, SIMDVec_u<uint8_t, 8>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_u<uint8_t, 16>::operator SIMDVec_u<uint16_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 16>, uint16_t, SIMDVec_u<uint8_t, 16>>(*this);
+        __m256i t0 = _mm256_cvtepu8_epi16(mVec);
+        return SIMDVec_u<uint16_t, 16>(t0);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_u<uint8_t, 32>::operator SIMDVec_u<uint16_t, 32>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 32>, uint16_t, SIMDVec_u<uint8_t, 32>>(*this);
+        __m256i t0 = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(mVec, 0));
+        __m256i t1 = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(mVec, 1));
+        return SIMDVec_u<uint16_t, 32>(t0, t1);
     }
 
     template<>
@@ -637,17 +662,17 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint32_t, 4>, uint32_t, SIMDVec_u<uint16_t, 4>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 8>::operator SIMDVec_u<uint32_t, 8>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint32_t, 8>, uint32_t, SIMDVec_u<uint16_t, 8>>(*this);
+        __m256i t0 = _mm256_cvtepu16_epi32(mVec);
+        return SIMDVec_u<uint32_t, 8>(t0);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 16>::operator SIMDVec_u<uint32_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint32_t, 16>, uint32_t, SIMDVec_u<uint16_t, 16>>(*this);
+        __m256i t0 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec, 0));
+        __m256i t1 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec, 1));
+        return SIMDVec_u<uint32_t, 16>(t0, t1);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 32>::operator SIMDVec_u<uint32_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint32_t, 32>, uint32_t, SIMDVec_u<uint16_t, 32>>(*this);
     }
@@ -692,14 +717,15 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 8>, int16_t, SIMDVec_i<int8_t, 8>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_i<int8_t, 16>::operator SIMDVec_i<int16_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 16>, int16_t, SIMDVec_i<int8_t, 16>>(*this);
+        __m256i t0 = _mm256_cvtepi8_epi16(mVec);
+        return SIMDVec_i<int16_t, 16>(t0);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_i<int8_t, 32>::operator SIMDVec_i<int16_t, 32>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 32>, int16_t, SIMDVec_i<int8_t, 32>>(*this);
+        __m256i t0 = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(mVec, 0));
+        __m256i t1 = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(mVec, 1));
+        return SIMDVec_i<int16_t, 32>(t0, t1);
     }
 
     template<>
@@ -722,17 +748,17 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int32_t, 4>, int32_t, SIMDVec_i<int16_t, 4>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 8>::operator SIMDVec_i<int32_t, 8>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int32_t, 8>, int32_t, SIMDVec_i<int16_t, 8>>(*this);
+        __m256i t0 = _mm256_cvtepi16_epi32(mVec);
+        return SIMDVec_i<int32_t, 8>(t0);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 16>::operator SIMDVec_i<int32_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int32_t, 16>, int32_t, SIMDVec_i<int16_t, 16>>(*this);
+        __m256i t0 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec, 0));
+        __m256i t1 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec, 1));
+        return SIMDVec_i<int32_t, 16>(t0, t1);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 32>::operator SIMDVec_i<int32_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int32_t, 32>, int32_t, SIMDVec_i<int16_t, 32>>(*this);
     }
@@ -792,19 +818,22 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 4>, uint8_t, SIMDVec_u<uint16_t, 4>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 8>::operator SIMDVec_u<uint8_t, 8>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 8>, uint8_t, SIMDVec_u<uint16_t, 8>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 16>::operator SIMDVec_u<uint8_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 16>, uint8_t, SIMDVec_u<uint16_t, 16>>(*this);
+        __m256i t0 = _mm256_and_si256(mVec, _mm256_set1_epi16(0x00FF));
+        __m128i t1 = _mm_packus_epi16(_mm256_extracti128_si256(t0, 0), _mm256_extracti128_si256(t0, 1));
+        return SIMDVec_u<uint8_t, 16>(t1);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 32>::operator SIMDVec_u<uint8_t, 32>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 32>, uint8_t, SIMDVec_u<uint16_t, 32>>(*this);
+        __m256i t0 = _mm256_and_si256(mVec[0], _mm256_set1_epi16(0x00FF));
+        __m256i t1 = _mm256_and_si256(mVec[1], _mm256_set1_epi16(0x00FF));
+        __m256i t2 = _mm256_packus_epi16(t0, t1);
+        __m256i t3 = _mm256_permute4x64_epi64(t2, 0xD8);
+        return SIMDVec_u<uint8_t, 32>(t3);
     }
 
     template<>
@@ -825,11 +854,17 @@ namespace SIMD {
     }
 
     UME_FORCE_INLINE SIMDVec_u<uint32_t, 8>::operator SIMDVec_u<uint16_t, 8>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 8>, uint16_t, SIMDVec_u<uint32_t, 8>>(*this);
+        __m256i t0 = _mm256_and_si256(mVec, _mm256_set1_epi32(0xFFFF));
+        __m128i t1 = _mm_packus_epi32(_mm256_extracti128_si256(t0, 0), _mm256_extracti128_si256(t0, 1));
+        return SIMDVec_u<uint16_t, 8>(t1);
     }
 
     UME_FORCE_INLINE SIMDVec_u<uint32_t, 16>::operator SIMDVec_u<uint16_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 16>, uint16_t, SIMDVec_u<uint32_t, 16>>(*this);
+        __m256i t0 = _mm256_and_si256(mVec[0], _mm256_set1_epi32(0xFFFF));
+        __m256i t1 = _mm256_and_si256(mVec[1], _mm256_set1_epi32(0xFFFF));
+        __m256i t2 = _mm256_packus_epi32(t0, t1);
+        __m256i t3 = _mm256_permute4x64_epi64(t2, 0xD8);
+        return SIMDVec_u<uint16_t, 16>(t3);
     }
 
     template<>
@@ -873,19 +908,22 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 4>, int8_t, SIMDVec_i<int16_t, 4>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 8>::operator SIMDVec_i<int8_t, 8>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 8>, int8_t, SIMDVec_i<int16_t, 8>>(*this);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 16>::operator SIMDVec_i<int8_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 16>, int8_t, SIMDVec_i<int16_t, 16>>(*this);
+        __m256i t0 = _mm256_and_si256(mVec, _mm256_set1_epi16(0x00FF));
+        __m128i t1 = _mm_packus_epi16(_mm256_extracti128_si256(t0, 0), _mm256_extracti128_si256(t0, 1));
+        return SIMDVec_i<int8_t, 16>(t1);
     }
 
-    template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 32>::operator SIMDVec_i<int8_t, 32>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 32>, int8_t, SIMDVec_i<int16_t, 32>>(*this);
+        __m256i t0 = _mm256_and_si256(mVec[0], _mm256_set1_epi16(0x00FF));
+        __m256i t1 = _mm256_and_si256(mVec[1], _mm256_set1_epi16(0x00FF));
+        __m256i t2 = _mm256_packus_epi16(t0, t1);
+        __m256i t3 = _mm256_permute4x64_epi64(t2, 0xD8);
+        return SIMDVec_i<int8_t, 32>(t3);
     }
 
     template<>
@@ -906,11 +944,17 @@ namespace SIMD {
     }
 
     UME_FORCE_INLINE SIMDVec_i<int32_t, 8>::operator SIMDVec_i<int16_t, 8>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 8>, int16_t, SIMDVec_i<int32_t, 8>>(*this);
+        __m256i t0 = _mm256_and_si256(mVec, _mm256_set1_epi32(0xFFFF));
+        __m128i t1 = _mm_packus_epi32(_mm256_extracti128_si256(t0, 0), _mm256_extracti128_si256(t0, 1));
+        return SIMDVec_i<int16_t, 8>(t1);
     }
 
     UME_FORCE_INLINE SIMDVec_i<int32_t, 16>::operator SIMDVec_i<int16_t, 16>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 16>, int16_t, SIMDVec_i<int32_t, 16>>(*this);
+        __m256i t0 = _mm256_and_si256(mVec[0], _mm256_set1_epi32(0xFFFF));
+        __m256i t1 = _mm256_and_si256(mVec[1], _mm256_set1_epi32(0xFFFF));
+        __m256i t2 = _mm256_packus_epi32(t0, t1);
+        __m256i t3 = _mm256_permute4x64_epi64(t2, 0xD8);
+        return SIMDVec_i<int16_t, 16>(t3);
     }
 
     UME_FORCE_INLINE SIMDVec_i<int32_t, 32>::operator SIMDVec_i<int16_t, 32>() const {
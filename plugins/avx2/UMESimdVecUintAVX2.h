@@ -46,6 +46,13 @@
 // ********************************************************************************************
 // UNSIGNED INTEGER VECTOR SPECIALIZATIONS
 // ********************************************************************************************
+#include "uint/UMESimdVecUint8_16.h"
+#include "uint/UMESimdVecUint8_32.h"
+
+#include "uint/UMESimdVecUint16_8.h"
+#include "uint/UMESimdVecUint16_16.h"
+#include "uint/UMESimdVecUint16_32.h"
+
 #include "uint/UMESimdVecUint32_1.h"
 #include "uint/UMESimdVecUint32_2.h"
 #include "uint/UMESimdVecUint32_4.h"
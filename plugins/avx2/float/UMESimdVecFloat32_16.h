@@ -67,6 +67,74 @@ namespace SIMD {
 
         typedef SIMDVec_u<uint32_t, 16>    VEC_UINT_TYPE;
         typedef SIMDVec_i<int32_t, 16>     VEC_INT_TYPE;
+
+        // Lane classification kernels used by ISFIN..ISZEROSUB. Lanes for which
+        // the predicate holds are set to all ones.
+        static UME_FORCE_INLINE __m256 absLanes(__m256 const & a) {
+            return _mm256_and_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF)));
+        }
+        static UME_FORCE_INLINE __m256 finiteLanes(__m256 const & a) {
+            __m256 t0 = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+            return _mm256_cmp_ps(absLanes(a), t0, _CMP_LT_OQ);
+        }
+        static UME_FORCE_INLINE __m256 infiniteLanes(__m256 const & a) {
+            __m256 t0 = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+            return _mm256_cmp_ps(absLanes(a), t0, _CMP_EQ_OQ);
+        }
+        static UME_FORCE_INLINE __m256 nanLanes(__m256 const & a) {
+            return _mm256_cmp_ps(a, a, _CMP_UNORD_Q);
+        }
+        static UME_FORCE_INLINE __m256 zeroLanes(__m256 const & a) {
+            return _mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_EQ_OQ);
+        }
+        static UME_FORCE_INLINE __m256 zeroOrSubnormalLanes(__m256 const & a) {
+            __m256 t0 = _mm256_set1_ps(std::numeric_limits<float>::min());
+            return _mm256_cmp_ps(absLanes(a), t0, _CMP_LT_OQ);
+        }
+        static UME_FORCE_INLINE __m256 subnormalLanes(__m256 const & a) {
+            return _mm256_andnot_ps(zeroLanes(a), zeroOrSubnormalLanes(a));
+        }
+        // Writes lanes of 'v' selected by bits of 'm' to baseAddr[indices[i]],
+        // in lane order. Indices are moved to general purpose registers in
+        // pairs, so neither vector makes a round trip through the stack.
+        static UME_FORCE_INLINE void scatterLanes(float * baseAddr, __m256 v, __m256i indices, int m) {
+            __m128 v0 = _mm256_castps256_ps128(v);
+            __m128 v1 = _mm256_extractf128_ps(v, 1);
+            __m128i t0 = _mm256_castsi256_si128(indices);
+            __m128i t1 = _mm256_extracti128_si256(indices, 1);
+            uint64_t i0 = uint64_t(_mm_cvtsi128_si64(t0));
+            uint64_t i1 = uint64_t(_mm_extract_epi64(t0, 1));
+            uint64_t i2 = uint64_t(_mm_cvtsi128_si64(t1));
+            uint64_t i3 = uint64_t(_mm_extract_epi64(t1, 1));
+            if (m & 0x01) _mm_store_ss(baseAddr + uint32_t(i0), v0);
+            if (m & 0x02) _mm_store_ss(baseAddr + uint32_t(i0 >> 32), _mm_movehdup_ps(v0));
+            if (m & 0x04) _mm_store_ss(baseAddr + uint32_t(i1), _mm_movehl_ps(v0, v0));
+            if (m & 0x08) _mm_store_ss(baseAddr + uint32_t(i1 >> 32), _mm_permute_ps(v0, 0x03));
+            if (m & 0x10) _mm_store_ss(baseAddr + uint32_t(i2), v1);
+            if (m & 0x20) _mm_store_ss(baseAddr + uint32_t(i2 >> 32), _mm_movehdup_ps(v1));
+            if (m & 0x40) _mm_store_ss(baseAddr + uint32_t(i3), _mm_movehl_ps(v1, v1));
+            if (m & 0x80) _mm_store_ss(baseAddr + uint32_t(i3 >> 32), _mm_permute_ps(v1, 0x03));
+        }
+        // Adds lanes of 'v' selected by bits of 'm' to baseAddr[indices[i]],
+        // in lane order, so that lanes with repeating indices accumulate.
+        static UME_FORCE_INLINE void scatterAddLanes(float * baseAddr, __m256 v, __m256i indices, int m) {
+            __m128 v0 = _mm256_castps256_ps128(v);
+            __m128 v1 = _mm256_extractf128_ps(v, 1);
+            __m128i t0 = _mm256_castsi256_si128(indices);
+            __m128i t1 = _mm256_extracti128_si256(indices, 1);
+            uint64_t i0 = uint64_t(_mm_cvtsi128_si64(t0));
+            uint64_t i1 = uint64_t(_mm_extract_epi64(t0, 1));
+            uint64_t i2 = uint64_t(_mm_cvtsi128_si64(t1));
+            uint64_t i3 = uint64_t(_mm_extract_epi64(t1, 1));
+            if (m & 0x01) baseAddr[uint32_t(i0)] += _mm_cvtss_f32(v0);
+            if (m & 0x02) baseAddr[uint32_t(i0 >> 32)] += _mm_cvtss_f32(_mm_movehdup_ps(v0));
+            if (m & 0x04) baseAddr[uint32_t(i1)] += _mm_cvtss_f32(_mm_movehl_ps(v0, v0));
+            if (m & 0x08) baseAddr[uint32_t(i1 >> 32)] += _mm_cvtss_f32(_mm_permute_ps(v0, 0x03));
+            if (m & 0x10) baseAddr[uint32_t(i2)] += _mm_cvtss_f32(v1);
+            if (m & 0x20) baseAddr[uint32_t(i2 >> 32)] += _mm_cvtss_f32(_mm_movehdup_ps(v1));
+            if (m & 0x40) baseAddr[uint32_t(i3)] += _mm_cvtss_f32(_mm_movehl_ps(v1, v1));
+            if (m & 0x80) baseAddr[uint32_t(i3 >> 32)] += _mm_cvtss_f32(_mm_permute_ps(v1, 0x03));
+        }
     public:
         // ZERO-CONSTR
         UME_FORCE_INLINE SIMDVec_f() {}
@@ -274,6 +342,12 @@ namespace SIMD {
             return p;
         }
 
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressstore(SIMDVecMask<16> const & mask, float * p) const {
+            uint32_t t0 = SIMDVec_f<float, 8>::compressLanes(p, mVec[0], _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[0])));
+            uint32_t t1 = SIMDVec_f<float, 8>::compressLanes(p + t0, mVec[1], _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[1])));
+            return t0 + t1;
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<16> const & mask, SIMDVec_f const & b) const {
             __m256 t0 = BLEND(mVec[0], b.mVec[0], mask.mMask[0]);
@@ -288,6 +362,23 @@ namespace SIMD {
         }
         // SWIZZLE
         // SWIZZLEA
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_f sorta() const {
+            // Sorting the halves in opposite directions gives a bitonic sequence.
+            __m256 t0 = SIMDVec_f<float, 8>::sortLanes(mVec[0]);
+            __m256 t1 = SIMDVec_f<float, 8>::reverseLanes(SIMDVec_f<float, 8>::sortLanes(mVec[1]));
+            __m256 t2 = SIMDVec_f<float, 8>::mergeLanes(_mm256_min_ps(t0, t1));
+            __m256 t3 = SIMDVec_f<float, 8>::mergeLanes(_mm256_max_ps(t1, t0));
+            return SIMDVec_f(t2, t3);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_f sortd() const {
+            __m256 t0 = SIMDVec_f<float, 8>::sortLanes(mVec[0]);
+            __m256 t1 = SIMDVec_f<float, 8>::reverseLanes(SIMDVec_f<float, 8>::sortLanes(mVec[1]));
+            __m256 t2 = SIMDVec_f<float, 8>::mergeLanes(_mm256_min_ps(t0, t1));
+            __m256 t3 = SIMDVec_f<float, 8>::mergeLanes(_mm256_max_ps(t1, t0));
+            return SIMDVec_f(SIMDVec_f<float, 8>::reverseLanes(t3), SIMDVec_f<float, 8>::reverseLanes(t2));
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
@@ -358,13 +449,37 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVec_f const & b) const {
+            return add(b);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<16> const & mask, SIMDVec_f const & b) const {
+            return add(mask, b);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(float b) const {
+            return add(b);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<16> const & mask, float b) const {
+            return add(mask, b);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVec_f const & b) {
+            return adda(b);
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<16> const & mask, SIMDVec_f const & b) {
+            return adda(mask, b);
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(float b) {
+            return adda(b);
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<16> const & mask, float b) {
+            return adda(mask, b);
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_f postinc() {
             __m256 t0 = _mm256_set1_ps(1);
@@ -476,13 +591,37 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVec_f const & b) const {
+            return sub(b);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<16> const & mask, SIMDVec_f const & b) const {
+            return sub(mask, b);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(float b) const {
+            return sub(b);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<16> const & mask, float b) const {
+            return sub(mask, b);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVec_f const & b) {
+            return suba(b);
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<16> const & mask, SIMDVec_f const & b) {
+            return suba(mask, b);
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(float b) {
+            return suba(b);
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<16> const & mask, float b) {
+            return suba(mask, b);
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVec_f const & b) const {
             __m256 t0 = _mm256_sub_ps(b.mVec[0], mVec[0]);
@@ -1285,8 +1424,8 @@ namespace SIMD {
         }
         // MHMAX
         UME_FORCE_INLINE float hmax(SIMDVecMask<16> const & mask) const {
-            __m128 t0 = _mm_set1_ps(std::numeric_limits<float>::min());
-            __m256 t1 = _mm256_set1_ps(std::numeric_limits<float>::min());
+            __m128 t0 = _mm_set1_ps(std::numeric_limits<float>::lowest());
+            __m256 t1 = _mm256_set1_ps(std::numeric_limits<float>::lowest());
             __m256 t2 = BLEND(mVec[0], t1, mask.mMask[0]);
             __m128 t3 = _mm256_castps256_ps128(t2);
             __m128 t4 = _mm256_extractf128_ps(t2, 1);
@@ -1383,56 +1522,38 @@ namespace SIMD {
         }
         // SCATTERS
         UME_FORCE_INLINE float* scatter(float* baseAddr, uint32_t* indices) const {
-            alignas(32) float raw[16];
-            _mm256_store_ps(raw, mVec[0]);
-            for (int i = 0; i < 8; i++) { baseAddr[indices[i]] = raw[i]; };
-            _mm256_store_ps((raw + 8), mVec[1]);
-            for (int i = 0; i < 8; i++) { baseAddr[indices[i+8]] = raw[i+8]; };
+            scatterLanes(baseAddr, mVec[0], _mm256_loadu_si256((__m256i*)indices), 0xFF);
+            scatterLanes(baseAddr, mVec[1], _mm256_loadu_si256((__m256i*)(indices + 8)), 0xFF);
             return baseAddr;
         }
         // MSCATTERS
         UME_FORCE_INLINE float* scatter(SIMDVecMask<16> const & mask, float* baseAddr, uint32_t* indices) const {
-            alignas(32) float raw[16];
-            alignas(32) uint32_t rawMask[16];
-            _mm256_store_ps(raw, mVec[0]);
-            _mm256_store_si256((__m256i*) rawMask, mask.mMask[0]);
-            for (int i = 0; i < 8; i++) { if (rawMask[i] == SIMDVecMask<16>::TRUE_VAL()) baseAddr[indices[i]] = raw[i]; };
-            _mm256_store_ps(raw + 8, mVec[1]);
-            _mm256_store_si256((__m256i*) (rawMask + 8), mask.mMask[1]);
-            for (int i = 0; i < 8; i++) { if (rawMask[i+8] == SIMDVecMask<16>::TRUE_VAL()) baseAddr[indices[i + 8]] = raw[i + 8]; };
+            scatterLanes(baseAddr, mVec[0], _mm256_loadu_si256((__m256i*)indices), _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[0])));
+            scatterLanes(baseAddr, mVec[1], _mm256_loadu_si256((__m256i*)(indices + 8)), _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[1])));
             return baseAddr;
         }
         // SCATTERV
         UME_FORCE_INLINE float* scatter(float* baseAddr, SIMDVec_u<uint32_t, 16> const & indices) const {
-            alignas(32) float raw[16];
-            alignas(32) uint32_t rawIndices[16];
-            _mm256_store_ps(raw, mVec[0]);
-            _mm256_store_si256((__m256i*) rawIndices, indices.mVec[0]);
-            for (int i = 0; i < 8; i++) { baseAddr[rawIndices[i]] = raw[i]; };
-            _mm256_store_ps((raw + 8), mVec[1]);
-            _mm256_store_si256((__m256i*) (rawIndices + 8), indices.mVec[1]);
-            for (int i = 0; i < 8; i++) { baseAddr[rawIndices[i+8]] = raw[i+8]; };
+            scatterLanes(baseAddr, mVec[0], indices.mVec[0], 0xFF);
+            scatterLanes(baseAddr, mVec[1], indices.mVec[1], 0xFF);
             return baseAddr;
         }
         // MSCATTERV
         UME_FORCE_INLINE float* scatter(SIMDVecMask<16> const & mask, float* baseAddr, SIMDVec_u<uint32_t, 16> const & indices) const {
-            alignas(32) float raw[16];
-            alignas(32) uint32_t rawIndices[16];
-            alignas(32) uint32_t rawMask[16];
-            _mm256_store_ps(raw, mVec[0]);
-            _mm256_store_si256((__m256i*) rawIndices, indices.mVec[0]);
-            _mm256_store_si256((__m256i*) rawMask, mask.mMask[0]);
-            for (int i = 0; i < 8; i++) {
-                if (rawMask[i] == SIMDVecMask<16>::TRUE_VAL())
-                    baseAddr[rawIndices[i]] = raw[i];
-            }
-            _mm256_store_ps(raw + 8, mVec[1]);
-            _mm256_store_si256((__m256i*) (rawIndices + 8), indices.mVec[1]);
-            _mm256_store_si256((__m256i*) (rawMask + 8), mask.mMask[1]);
-            for (int i = 0; i < 8; i++) {
-                if (rawMask[i + 8] == SIMDVecMask<16>::TRUE_VAL())
-                    baseAddr[rawIndices[i+8]] = raw[i+8];
-            }
+            scatterLanes(baseAddr, mVec[0], indices.mVec[0], _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[0])));
+            scatterLanes(baseAddr, mVec[1], indices.mVec[1], _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[1])));
+            return baseAddr;
+        }
+        // SCATTERADDV
+        UME_FORCE_INLINE float* scatteradd(float* baseAddr, SIMDVec_u<uint32_t, 16> const & indices) const {
+            scatterAddLanes(baseAddr, mVec[0], indices.mVec[0], 0xFF);
+            scatterAddLanes(baseAddr, mVec[1], indices.mVec[1], 0xFF);
+            return baseAddr;
+        }
+        // MSCATTERADDV
+        UME_FORCE_INLINE float* scatteradd(SIMDVecMask<16> const & mask, float* baseAddr, SIMDVec_u<uint32_t, 16> const & indices) const {
+            scatterAddLanes(baseAddr, mVec[0], indices.mVec[0], _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[0])));
+            scatterAddLanes(baseAddr, mVec[1], indices.mVec[1], _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[1])));
             return baseAddr;
         }
         // NEG
@@ -1635,12 +1756,47 @@ namespace SIMD {
             return SIMDVec_f(t1, t3);
         }
         // ISFIN
+        UME_FORCE_INLINE SIMDVecMask<16> isfin() const {
+            __m256i t0 = _mm256_castps_si256(finiteLanes(mVec[0]));
+            __m256i t1 = _mm256_castps_si256(finiteLanes(mVec[1]));
+            return SIMDVecMask<16>(t0, t1);
+        }
         // ISINF
+        UME_FORCE_INLINE SIMDVecMask<16> isinf() const {
+            __m256i t0 = _mm256_castps_si256(infiniteLanes(mVec[0]));
+            __m256i t1 = _mm256_castps_si256(infiniteLanes(mVec[1]));
+            return SIMDVecMask<16>(t0, t1);
+        }
         // ISAN
+        UME_FORCE_INLINE SIMDVecMask<16> isan() const {
+            __m256i t0 = _mm256_castps_si256(finiteLanes(mVec[0]));
+            __m256i t1 = _mm256_castps_si256(finiteLanes(mVec[1]));
+            return SIMDVecMask<16>(t0, t1);
+        }
         // ISNAN
+        UME_FORCE_INLINE SIMDVecMask<16> isnan() const {
+            __m256i t0 = _mm256_castps_si256(nanLanes(mVec[0]));
+            __m256i t1 = _mm256_castps_si256(nanLanes(mVec[1]));
+            return SIMDVecMask<16>(t0, t1);
+        }
         // ISSUB
+        UME_FORCE_INLINE SIMDVecMask<16> issub() const {
+            __m256i t0 = _mm256_castps_si256(subnormalLanes(mVec[0]));
+            __m256i t1 = _mm256_castps_si256(subnormalLanes(mVec[1]));
+            return SIMDVecMask<16>(t0, t1);
+        }
         // ISZERO
+        UME_FORCE_INLINE SIMDVecMask<16> iszero() const {
+            __m256i t0 = _mm256_castps_si256(zeroLanes(mVec[0]));
+            __m256i t1 = _mm256_castps_si256(zeroLanes(mVec[1]));
+            return SIMDVecMask<16>(t0, t1);
+        }
         // ISZEROSUB
+        UME_FORCE_INLINE SIMDVecMask<16> iszerosub() const {
+            __m256i t0 = _mm256_castps_si256(zeroOrSubnormalLanes(mVec[0]));
+            __m256i t1 = _mm256_castps_si256(zeroOrSubnormalLanes(mVec[1]));
+            return SIMDVecMask<16>(t0, t1);
+        }
         // EXP
         UME_FORCE_INLINE SIMDVec_f exp() const {
 #if defined(UME_USE_SVML)
@@ -1656,15 +1812,65 @@ namespace SIMD {
             return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
         }
         // LOG
+        UME_FORCE_INLINE SIMDVec_f log() const {
+            // Evaluate the SIMDVec_f<float, 8> kernel on each register.
+            __m256 t0 = SIMDVec_f<float, 8>(mVec[0]).log().mVec;
+            __m256 t1 = SIMDVec_f<float, 8>(mVec[1]).log().mVec;
+            return SIMDVec_f(t0, t1);
+        }
         // MLOG
+        UME_FORCE_INLINE SIMDVec_f log(SIMDVecMask<16> const & mask) const {
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, log());
+            return t0;
+        }
         // LOG2
         // MLOG2
         // LOG10
         // MLOG10
         // SIN
+        UME_FORCE_INLINE SIMDVec_f sin() const {
+            __m256 t0 = SIMDVec_f<float, 8>(mVec[0]).sin().mVec;
+            __m256 t1 = SIMDVec_f<float, 8>(mVec[1]).sin().mVec;
+            return SIMDVec_f(t0, t1);
+        }
         // MSIN
+        UME_FORCE_INLINE SIMDVec_f sin(SIMDVecMask<16> const & mask) const {
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, sin());
+            return t0;
+        }
         // COS
+        UME_FORCE_INLINE SIMDVec_f cos() const {
+            __m256 t0 = SIMDVec_f<float, 8>(mVec[0]).cos().mVec;
+            __m256 t1 = SIMDVec_f<float, 8>(mVec[1]).cos().mVec;
+            return SIMDVec_f(t0, t1);
+        }
         // MCOS
+        UME_FORCE_INLINE SIMDVec_f cos(SIMDVecMask<16> const & mask) const {
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, cos());
+            return t0;
+        }
+        // SINCOS
+        UME_FORCE_INLINE void sincos(SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            SIMDVec_f<float, 8> t0, t1;
+            SIMDVec_f<float, 8>(mVec[0]).sincos(t0, t1);
+            sinvec.mVec[0] = t0.mVec;
+            cosvec.mVec[0] = t1.mVec;
+            SIMDVec_f<float, 8>(mVec[1]).sincos(t0, t1);
+            sinvec.mVec[1] = t0.mVec;
+            cosvec.mVec[1] = t1.mVec;
+        }
+        // MSINCOS
+        UME_FORCE_INLINE void sincos(SIMDVecMask<16> const & mask, SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            SIMDVec_f t0, t1;
+            sincos(t0, t1);
+            sinvec = *this;
+            cosvec = *this;
+            sinvec.assign(mask, t0);
+            cosvec.assign(mask, t1);
+        }
         // TAN
         // MTAN
         // CTAN
@@ -94,6 +94,45 @@ namespace SIMD {
             this->mVec = x;
         }
 
+        // Lane classification kernels used by ISFIN..ISZEROSUB. Lanes for which
+        // the predicate holds are set to all ones.
+        static UME_FORCE_INLINE __m128 absLanes(__m128 const & a) {
+            return _mm_and_ps(a, _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF)));
+        }
+        static UME_FORCE_INLINE __m128 finiteLanes(__m128 const & a) {
+            __m128 t0 = _mm_set1_ps(std::numeric_limits<float>::infinity());
+            return _mm_cmp_ps(absLanes(a), t0, _CMP_LT_OQ);
+        }
+        static UME_FORCE_INLINE __m128 infiniteLanes(__m128 const & a) {
+            __m128 t0 = _mm_set1_ps(std::numeric_limits<float>::infinity());
+            return _mm_cmp_ps(absLanes(a), t0, _CMP_EQ_OQ);
+        }
+        static UME_FORCE_INLINE __m128 nanLanes(__m128 const & a) {
+            return _mm_cmp_ps(a, a, _CMP_UNORD_Q);
+        }
+        static UME_FORCE_INLINE __m128 zeroLanes(__m128 const & a) {
+            return _mm_cmp_ps(a, _mm_setzero_ps(), _CMP_EQ_OQ);
+        }
+        static UME_FORCE_INLINE __m128 zeroOrSubnormalLanes(__m128 const & a) {
+            __m128 t0 = _mm_set1_ps(std::numeric_limits<float>::min());
+            return _mm_cmp_ps(absLanes(a), t0, _CMP_LT_OQ);
+        }
+        static UME_FORCE_INLINE __m128 subnormalLanes(__m128 const & a) {
+            return _mm_andnot_ps(zeroLanes(a), zeroOrSubnormalLanes(a));
+        }
+        // Bitonic sorting network kernels used by SORTA/SORTD. Every step pairs
+        // each lane with a partner lane, and keeps the minimum or the maximum of
+        // the pair, as selected by bits of BLEND_MASK.
+        template<int BLEND_MASK>
+        static UME_FORCE_INLINE __m128 sortStep(__m128 const & a, __m128 const & b) {
+            return _mm_blend_ps(_mm_min_ps(a, b), _mm_max_ps(a, b), BLEND_MASK);
+        }
+        static UME_FORCE_INLINE __m128 sortLanes(__m128 a) {
+            a = sortStep<0x6>(a, _mm_permute_ps(a, 0xB1));
+            a = sortStep<0xC>(a, _mm_permute_ps(a, 0x4E));
+            a = sortStep<0xA>(a, _mm_permute_ps(a, 0xB1));
+            return a;
+        }
     public:
         // ZERO-CONSTR
         UME_FORCE_INLINE SIMDVec_f() {}
@@ -235,16 +274,26 @@ namespace SIMD {
             return SIMDVec_f(t0);
         }
         template<int i0, int i1, int i2, int i3>
-        UME_FORCE_INLINE SIMDVec_f swizzle() {
-            const int index = i0 | (i1 << 2) | (i2 << 4) | (i3 << 6);
-            __m128 t0 = _mm_permute_ps(mVec, index);
+        UME_FORCE_INLINE SIMDVec_f swizzle() const {
+            __m128 t0 = _mm_permute_ps(mVec, (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6));
             return SIMDVec_f(t0);
         }
         // SWIZZLEA
         UME_FORCE_INLINE SIMDVec_f & swizzlea(SIMDSwizzle<4> const & sMask) {
-            mVec = _mm_permutevar_ps(mVec, sMask.mVec);
+            SIMDVec_f t0 = swizzle(sMask);
+            mVec = t0.mVec;
             return *this;
         }
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_f sorta() const {
+            __m128 t0 = sortLanes(mVec);
+            return SIMDVec_f(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_f sortd() const {
+            __m128 t0 = _mm_permute_ps(sortLanes(mVec), 0x1B);
+            return SIMDVec_f(t0);
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
@@ -303,13 +352,37 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVec_f const & b) const {
+            return add(b);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return add(mask, b);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(float b) const {
+            return add(b);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<4> const & mask, float b) const {
+            return add(mask, b);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVec_f const & b) {
+            return adda(b);
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            return adda(mask, b);
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(float b) {
+            return adda(b);
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<4> const & mask, float b) {
+            return adda(mask, b);
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_f postinc() {
             __m128 t0 = mVec;
@@ -398,13 +471,37 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVec_f const & b) const {
+            return sub(b);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return sub(mask, b);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(float b) const {
+            return sub(b);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<4> const & mask, float b) const {
+            return sub(mask, b);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVec_f const & b) {
+            return suba(b);
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            return suba(mask, b);
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(float b) {
+            return suba(b);
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<4> const & mask, float b) {
+            return suba(mask, b);
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVec_f const & b) const {
             __m128 t0 = _mm_sub_ps(b.mVec, mVec);
@@ -1251,12 +1348,33 @@ namespace SIMD {
             return SIMDVec_f(t1);
         }
         // ISFIN
+        UME_FORCE_INLINE SIMDVecMask<4> isfin() const {
+            return SIMDVecMask<4>(_mm_castps_si128(finiteLanes(mVec)));
+        }
         // ISINF
+        UME_FORCE_INLINE SIMDVecMask<4> isinf() const {
+            return SIMDVecMask<4>(_mm_castps_si128(infiniteLanes(mVec)));
+        }
         // ISAN
+        UME_FORCE_INLINE SIMDVecMask<4> isan() const {
+            return SIMDVecMask<4>(_mm_castps_si128(finiteLanes(mVec)));
+        }
         // ISNAN
+        UME_FORCE_INLINE SIMDVecMask<4> isnan() const {
+            return SIMDVecMask<4>(_mm_castps_si128(nanLanes(mVec)));
+        }
         // ISSUB
+        UME_FORCE_INLINE SIMDVecMask<4> issub() const {
+            return SIMDVecMask<4>(_mm_castps_si128(subnormalLanes(mVec)));
+        }
         // ISZERO
+        UME_FORCE_INLINE SIMDVecMask<4> iszero() const {
+            return SIMDVecMask<4>(_mm_castps_si128(zeroLanes(mVec)));
+        }
         // ISZEROSUB
+        UME_FORCE_INLINE SIMDVecMask<4> iszerosub() const {
+            return SIMDVecMask<4>(_mm_castps_si128(zeroOrSubnormalLanes(mVec)));
+        }
         // EXP
         UME_FORCE_INLINE SIMDVec_f exp() const {
             return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
@@ -1266,15 +1384,41 @@ namespace SIMD {
             return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
         }
         // LOG
+        UME_FORCE_INLINE SIMDVec_f log() const {
+            return VECTOR_EMULATION::logf<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+        }
         // MLOG
+        UME_FORCE_INLINE SIMDVec_f log(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::logf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // LOG2
         // MLOG2
         // LOG10
         // MLOG10
         // SIN
+        UME_FORCE_INLINE SIMDVec_f sin() const {
+            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(*this);
+        }
         // MSIN
+        UME_FORCE_INLINE SIMDVec_f sin(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // COS
+        UME_FORCE_INLINE SIMDVec_f cos() const {
+            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(*this);
+        }
         // MCOS
+        UME_FORCE_INLINE SIMDVec_f cos(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // SINCOS
+        UME_FORCE_INLINE void sincos(SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            VECTOR_EMULATION::sincosf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(*this, sinvec, cosvec);
+        }
+        // MSINCOS
+        UME_FORCE_INLINE void sincos(SIMDVecMask<4> const & mask, SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            VECTOR_EMULATION::sincosf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(mask, *this, sinvec, cosvec);
+        }
         // TAN
         // MTAN
         // CTAN
@@ -74,6 +74,129 @@ namespace SIMD {
         friend class SIMDVec_f<double, 8>;
 
         friend class SIMDVec_f<float, 16>;
+        friend class SIMDVec_f<float, 32>;
+
+        // Lane classification kernels used by ISFIN..ISZEROSUB. Lanes for which
+        // the predicate holds are set to all ones.
+        static UME_FORCE_INLINE __m256 absLanes(__m256 const & a) {
+            return _mm256_and_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF)));
+        }
+        static UME_FORCE_INLINE __m256 finiteLanes(__m256 const & a) {
+            __m256 t0 = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+            return _mm256_cmp_ps(absLanes(a), t0, _CMP_LT_OQ);
+        }
+        static UME_FORCE_INLINE __m256 infiniteLanes(__m256 const & a) {
+            __m256 t0 = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+            return _mm256_cmp_ps(absLanes(a), t0, _CMP_EQ_OQ);
+        }
+        static UME_FORCE_INLINE __m256 nanLanes(__m256 const & a) {
+            return _mm256_cmp_ps(a, a, _CMP_UNORD_Q);
+        }
+        static UME_FORCE_INLINE __m256 zeroLanes(__m256 const & a) {
+            return _mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_EQ_OQ);
+        }
+        static UME_FORCE_INLINE __m256 zeroOrSubnormalLanes(__m256 const & a) {
+            __m256 t0 = _mm256_set1_ps(std::numeric_limits<float>::min());
+            return _mm256_cmp_ps(absLanes(a), t0, _CMP_LT_OQ);
+        }
+        static UME_FORCE_INLINE __m256 subnormalLanes(__m256 const & a) {
+            return _mm256_andnot_ps(zeroLanes(a), zeroOrSubnormalLanes(a));
+        }
+
+        // Index-carrying lane reduction used by IMAX/IMIN. Each step pairs every
+        // lane with a partner lane and keeps the better value together with its
+        // index, preferring the lower index on ties. After log2(8) steps all
+        // lanes hold the winner. CMP is _CMP_GT_OQ for max and _CMP_LT_OQ for min.
+        template<int CMP>
+        static UME_FORCE_INLINE void selectLanes(__m256 & v, __m256i & idx, __m256 const & v1, __m256i const & idx1) {
+            __m256 t0 = _mm256_cmp_ps(v1, v, CMP);
+            __m256 t1 = _mm256_cmp_ps(v1, v, _CMP_EQ_OQ);
+            __m256 t2 = _mm256_castsi256_ps(_mm256_cmpgt_epi32(idx, idx1));
+            __m256 t3 = _mm256_or_ps(t0, _mm256_and_ps(t1, t2));
+            v = _mm256_blendv_ps(v, v1, t3);
+            idx = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(idx), _mm256_castsi256_ps(idx1), t3));
+        }
+        template<int CMP>
+        static UME_FORCE_INLINE uint32_t reduceIndex(__m256 v) {
+            __m256i idx = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            selectLanes<CMP>(v, idx, _mm256_permute2f128_ps(v, v, 0x01), _mm256_permute2x128_si256(idx, idx, 0x01));
+            selectLanes<CMP>(v, idx, _mm256_permute_ps(v, 0x4E), _mm256_shuffle_epi32(idx, 0x4E));
+            selectLanes<CMP>(v, idx, _mm256_permute_ps(v, 0xB1), _mm256_shuffle_epi32(idx, 0xB1));
+            return uint32_t(_mm_cvtsi128_si32(_mm256_castsi256_si128(idx)));
+        }
+        // Writes lanes of 'v' selected by bits of 'm' to baseAddr[indices[i]],
+        // in lane order. Indices are moved to general purpose registers in
+        // pairs, so neither vector makes a round trip through the stack.
+        static UME_FORCE_INLINE void scatterLanes(float * baseAddr, __m256 v, __m256i indices, int m) {
+            __m128 v0 = _mm256_castps256_ps128(v);
+            __m128 v1 = _mm256_extractf128_ps(v, 1);
+            __m128i t0 = _mm256_castsi256_si128(indices);
+            __m128i t1 = _mm256_extracti128_si256(indices, 1);
+            uint64_t i0 = uint64_t(_mm_cvtsi128_si64(t0));
+            uint64_t i1 = uint64_t(_mm_extract_epi64(t0, 1));
+            uint64_t i2 = uint64_t(_mm_cvtsi128_si64(t1));
+            uint64_t i3 = uint64_t(_mm_extract_epi64(t1, 1));
+            if (m & 0x01) _mm_store_ss(baseAddr + uint32_t(i0), v0);
+            if (m & 0x02) _mm_store_ss(baseAddr + uint32_t(i0 >> 32), _mm_movehdup_ps(v0));
+            if (m & 0x04) _mm_store_ss(baseAddr + uint32_t(i1), _mm_movehl_ps(v0, v0));
+            if (m & 0x08) _mm_store_ss(baseAddr + uint32_t(i1 >> 32), _mm_permute_ps(v0, 0x03));
+            if (m & 0x10) _mm_store_ss(baseAddr + uint32_t(i2), v1);
+            if (m & 0x20) _mm_store_ss(baseAddr + uint32_t(i2 >> 32), _mm_movehdup_ps(v1));
+            if (m & 0x40) _mm_store_ss(baseAddr + uint32_t(i3), _mm_movehl_ps(v1, v1));
+            if (m & 0x80) _mm_store_ss(baseAddr + uint32_t(i3 >> 32), _mm_permute_ps(v1, 0x03));
+        }
+        // Adds lanes of 'v' selected by bits of 'm' to baseAddr[indices[i]],
+        // in lane order, so that lanes with repeating indices accumulate.
+        static UME_FORCE_INLINE void scatterAddLanes(float * baseAddr, __m256 v, __m256i indices, int m) {
+            __m128 v0 = _mm256_castps256_ps128(v);
+            __m128 v1 = _mm256_extractf128_ps(v, 1);
+            __m128i t0 = _mm256_castsi256_si128(indices);
+            __m128i t1 = _mm256_extracti128_si256(indices, 1);
+            uint64_t i0 = uint64_t(_mm_cvtsi128_si64(t0));
+            uint64_t i1 = uint64_t(_mm_extract_epi64(t0, 1));
+            uint64_t i2 = uint64_t(_mm_cvtsi128_si64(t1));
+            uint64_t i3 = uint64_t(_mm_extract_epi64(t1, 1));
+            if (m & 0x01) baseAddr[uint32_t(i0)] += _mm_cvtss_f32(v0);
+            if (m & 0x02) baseAddr[uint32_t(i0 >> 32)] += _mm_cvtss_f32(_mm_movehdup_ps(v0));
+            if (m & 0x04) baseAddr[uint32_t(i1)] += _mm_cvtss_f32(_mm_movehl_ps(v0, v0));
+            if (m & 0x08) baseAddr[uint32_t(i1 >> 32)] += _mm_cvtss_f32(_mm_permute_ps(v0, 0x03));
+            if (m & 0x10) baseAddr[uint32_t(i2)] += _mm_cvtss_f32(v1);
+            if (m & 0x20) baseAddr[uint32_t(i2 >> 32)] += _mm_cvtss_f32(_mm_movehdup_ps(v1));
+            if (m & 0x40) baseAddr[uint32_t(i3)] += _mm_cvtss_f32(_mm_movehl_ps(v1, v1));
+            if (m & 0x80) baseAddr[uint32_t(i3 >> 32)] += _mm_cvtss_f32(_mm_permute_ps(v1, 0x03));
+        }
+        // Bitonic sorting network kernels used by SORTA/SORTD. Every step pairs
+        // each lane with a partner lane, and keeps the minimum or the maximum of
+        // the pair, as selected by bits of BLEND_MASK.
+        template<int BLEND_MASK>
+        static UME_FORCE_INLINE __m256 sortStep(__m256 const & a, __m256 const & b) {
+            return _mm256_blend_ps(_mm256_min_ps(a, b), _mm256_max_ps(a, b), BLEND_MASK);
+        }
+        // Sorts a bitonic sequence in ascending order.
+        static UME_FORCE_INLINE __m256 mergeLanes(__m256 a) {
+            a = sortStep<0xF0>(a, _mm256_permute2f128_ps(a, a, 0x01));
+            a = sortStep<0xCC>(a, _mm256_permute_ps(a, 0x4E));
+            a = sortStep<0xAA>(a, _mm256_permute_ps(a, 0xB1));
+            return a;
+        }
+        static UME_FORCE_INLINE __m256 sortLanes(__m256 a) {
+            a = sortStep<0x66>(a, _mm256_permute_ps(a, 0xB1));
+            a = sortStep<0x3C>(a, _mm256_permute_ps(a, 0x4E));
+            a = sortStep<0x5A>(a, _mm256_permute_ps(a, 0xB1));
+            return mergeLanes(a);
+        }
+        static UME_FORCE_INLINE __m256 reverseLanes(__m256 const & a) {
+            return _mm256_permute_ps(_mm256_permute2f128_ps(a, a, 0x01), 0x1B);
+        }
+        // Stores lanes of 'v' selected by bits of 'm' contiguously, starting
+        // at 'p', and returns their count.
+        static UME_FORCE_INLINE uint32_t compressLanes(float * p, __m256 const & v, int m) {
+            uint32_t n;
+            __m256i t0 = SIMDVec_u<uint32_t, 8>::compressIndices(m, n);
+            __m256 t1 = _mm256_permutevar8x32_ps(v, t0);
+            _mm256_maskstore_ps(p, SIMDVecMask<8>::prefix(n).mMask, t1);
+            return n;
+        }
     public:
         // ZERO-CONSTR
         UME_FORCE_INLINE SIMDVec_f() {}
@@ -172,7 +295,7 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<8> const & mask, float const * p) {
-            __m256 t0 = _mm256_loadu_ps(p);
+            __m256 t0 = _mm256_maskload_ps(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -201,6 +324,11 @@ namespace SIMD {
             return *this;
         }
 
+        // LOADN
+        UME_FORCE_INLINE SIMDVec_f & loadn(uint32_t n, float const * p) {
+            mVec = _mm256_maskload_ps(p, SIMDVecMask<8>::prefix(n).mMask);
+            return *this;
+        }
         // STORE
         UME_FORCE_INLINE float* store(float* p) const {
             _mm256_storeu_ps(p, mVec);
@@ -211,6 +339,11 @@ namespace SIMD {
             _mm256_maskstore_ps(p, mask.mMask, mVec);
             return p;
         }
+        // STOREN
+        UME_FORCE_INLINE float* storen(uint32_t n, float * p) const {
+            _mm256_maskstore_ps(p, SIMDVecMask<8>::prefix(n).mMask, mVec);
+            return p;
+        }
         // STOREA
         UME_FORCE_INLINE float* storea(float* p) const {
             _mm256_store_ps(p, mVec);
@@ -235,6 +368,10 @@ namespace SIMD {
             return p;
         }
 
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressstore(SIMDVecMask<8> const & mask, float * p) const {
+            return compressLanes(p, mVec, _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask)));
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
             __m256 t0 = BLEND(mVec, b.mVec, mask.mMask);
@@ -246,7 +383,39 @@ namespace SIMD {
             return SIMDVec_f(t0);
         }
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_f swizzle(SIMDSwizzle<8> const & sMask) const {
+            __m256 t0 = _mm256_permutevar8x32_ps(mVec, sMask.mVec);
+            return SIMDVec_f(t0);
+        }
+        template<int i0, int i1, int i2, int i3, int i4, int i5, int i6, int i7>
+        UME_FORCE_INLINE SIMDVec_f swizzle() const {
+            const int imm = (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6);
+            // Patterns repeated in both 128-bit lanes need only an immediate shuffle.
+            if (i0 < 4 && i1 < 4 && i2 < 4 && i3 < 4 && i4 == i0 + 4 && i5 == i1 + 4 &&
+                i6 == i2 + 4 && i7 == i3 + 4) {
+                __m256 t0 = _mm256_permute_ps(mVec, imm);
+                return SIMDVec_f(t0);
+            }
+            __m256i t1 = _mm256_setr_epi32(i0, i1, i2, i3, i4, i5, i6, i7);
+            __m256 t2 = _mm256_permutevar8x32_ps(mVec, t1);
+            return SIMDVec_f(t2);
+        }
         // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_f & swizzlea(SIMDSwizzle<8> const & sMask) {
+            SIMDVec_f t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_f sorta() const {
+            __m256 t0 = sortLanes(mVec);
+            return SIMDVec_f(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_f sortd() const {
+            __m256 t0 = reverseLanes(sortLanes(mVec));
+            return SIMDVec_f(t0);
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
@@ -309,13 +478,37 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVec_f const & b) const {
+            return add(b);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return add(mask, b);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(float b) const {
+            return add(b);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<8> const & mask, float b) const {
+            return add(mask, b);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVec_f const & b) {
+            return adda(b);
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<8> const & mask, SIMDVec_f const & b) {
+            return adda(mask, b);
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(float b) {
+            return adda(b);
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<8> const & mask, float b) {
+            return adda(mask, b);
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_f postinc() {
             __m256 t0 = _mm256_set1_ps(1);
@@ -407,13 +600,37 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVec_f const & b) const {
+            return sub(b);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return sub(mask, b);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(float b) const {
+            return sub(b);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<8> const & mask, float b) const {
+            return sub(mask, b);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVec_f const & b) {
+            return suba(b);
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<8> const & mask, SIMDVec_f const & b) {
+            return suba(mask, b);
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(float b) {
+            return suba(b);
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<8> const & mask, float b) {
+            return suba(mask, b);
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVec_f const & b) const {
             __m256 t0 = _mm256_sub_ps(b.mVec, mVec);
@@ -1059,8 +1276,8 @@ namespace SIMD {
         }
         // MHMAX
         UME_FORCE_INLINE float hmax(SIMDVecMask<8> const & mask) const {
-            __m128 t0 = _mm_set1_ps(std::numeric_limits<float>::min());
-            __m256 t1 = _mm256_set1_ps(std::numeric_limits<float>::min());
+            __m128 t0 = _mm_set1_ps(std::numeric_limits<float>::lowest());
+            __m256 t1 = _mm256_set1_ps(std::numeric_limits<float>::lowest());
             __m256 t2 = BLEND(mVec, t1, mask.mMask);
             __m128 t3 = _mm256_castps256_ps128(t2);
             __m128 t4 = _mm256_extractf128_ps(t2, 1);
@@ -1073,7 +1290,21 @@ namespace SIMD {
             return retval;
         }
         // IMAX
+        UME_FORCE_INLINE uint32_t imax() const {
+            // NaN lanes never win
+            __m256 t0 = _mm256_set1_ps(-std::numeric_limits<float>::infinity());
+            __m256 t1 = _mm256_blendv_ps(mVec, t0, _mm256_cmp_ps(mVec, mVec, _CMP_UNORD_Q));
+            return reduceIndex<_CMP_GT_OQ>(t1);
+        }
         // MIMAX
+        UME_FORCE_INLINE uint32_t imax(SIMDVecMask<8> const & mask) const {
+            __m256 t0 = _mm256_set1_ps(-std::numeric_limits<float>::infinity());
+            __m256 t1 = _mm256_cmp_ps(mVec, _mm256_set1_ps(std::numeric_limits<float>::lowest()), _CMP_GT_OQ);
+            __m256 t2 = _mm256_and_ps(t1, _mm256_castsi256_ps(mask.mMask));
+            if (_mm256_movemask_ps(t2) == 0) return 0xFFFFFFFF;
+            __m256 t3 = _mm256_blendv_ps(t0, mVec, t2);
+            return reduceIndex<_CMP_GT_OQ>(t3);
+        }
         // HMIN
         UME_FORCE_INLINE float hmin() const {
             __m128 t0 = _mm_set1_ps(std::numeric_limits<float>::max());
@@ -1103,7 +1334,21 @@ namespace SIMD {
             return retval;
         }
         // IMIN
+        UME_FORCE_INLINE uint32_t imin() const {
+            // NaN lanes never win
+            __m256 t0 = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+            __m256 t1 = _mm256_blendv_ps(mVec, t0, _mm256_cmp_ps(mVec, mVec, _CMP_UNORD_Q));
+            return reduceIndex<_CMP_LT_OQ>(t1);
+        }
         // MIMIN
+        UME_FORCE_INLINE uint32_t imin(SIMDVecMask<8> const & mask) const {
+            __m256 t0 = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+            __m256 t1 = _mm256_cmp_ps(mVec, _mm256_set1_ps(std::numeric_limits<float>::max()), _CMP_LT_OQ);
+            __m256 t2 = _mm256_and_ps(t1, _mm256_castsi256_ps(mask.mMask));
+            if (_mm256_movemask_ps(t2) == 0) return 0xFFFFFFFF;
+            __m256 t3 = _mm256_blendv_ps(t0, mVec, t2);
+            return reduceIndex<_CMP_LT_OQ>(t3);
+        }
 
         // GATHERS
         UME_FORCE_INLINE SIMDVec_f & gather(float const * baseAddr, uint32_t const * indices) {
@@ -1131,41 +1376,32 @@ namespace SIMD {
         }
         // SCATTERS
         UME_FORCE_INLINE float* scatter(float* baseAddr, uint32_t* indices) const {
-            alignas(32) float raw[8];
-            _mm256_store_ps(raw, mVec);
-            for (int i = 0; i < 8; i++) { baseAddr[indices[i]] = raw[i]; };
+            scatterLanes(baseAddr, mVec, _mm256_loadu_si256((__m256i*)indices), 0xFF);
             return baseAddr;
         }
         // MSCATTERS
         UME_FORCE_INLINE float* scatter(SIMDVecMask<8> const & mask, float* baseAddr, uint32_t* indices) const {
-            alignas(32) float raw[8];
-            alignas(32) uint32_t rawMask[8];
-            _mm256_store_ps(raw, mVec);
-            _mm256_store_si256((__m256i*) rawMask, mask.mMask);
-            for (int i = 0; i < 8; i++) { if (rawMask[i] == SIMDVecMask<8>::TRUE_VAL()) baseAddr[indices[i]] = raw[i]; };
+            scatterLanes(baseAddr, mVec, _mm256_loadu_si256((__m256i*)indices), _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask)));
             return baseAddr;
         }
         // SCATTERV
         UME_FORCE_INLINE float* scatter(float* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
-            alignas(32) float raw[8];
-            alignas(32) uint32_t rawIndices[8];
-            _mm256_store_ps(raw, mVec);
-            _mm256_store_si256((__m256i*) rawIndices, indices.mVec);
-            for (int i = 0; i < 8; i++) { baseAddr[rawIndices[i]] = raw[i]; };
+            scatterLanes(baseAddr, mVec, indices.mVec, 0xFF);
             return baseAddr;
         }
         // MSCATTERV
         UME_FORCE_INLINE float* scatter(SIMDVecMask<8> const & mask, float* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
-            alignas(32) float raw[8];
-            alignas(32) uint32_t rawIndices[8];
-            alignas(32) uint32_t rawMask[8];
-            _mm256_store_ps(raw, mVec);
-            _mm256_store_si256((__m256i*) rawIndices, indices.mVec);
-            _mm256_store_si256((__m256i*) rawMask, mask.mMask);
-            for (int i = 0; i < 8; i++) {
-                if (rawMask[i] == SIMDVecMask<8>::TRUE_VAL())
-                    baseAddr[rawIndices[i]] = raw[i];
-            }
+            scatterLanes(baseAddr, mVec, indices.mVec, _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask)));
+            return baseAddr;
+        }
+        // SCATTERADDV
+        UME_FORCE_INLINE float* scatteradd(float* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
+            scatterAddLanes(baseAddr, mVec, indices.mVec, 0xFF);
+            return baseAddr;
+        }
+        // MSCATTERADDV
+        UME_FORCE_INLINE float* scatteradd(SIMDVecMask<8> const & mask, float* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
+            scatterAddLanes(baseAddr, mVec, indices.mVec, _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask)));
             return baseAddr;
         }
         // NEG
@@ -1273,9 +1509,21 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256 t0 = _mm256_round_ps(mVec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
@@ -1322,12 +1570,33 @@ namespace SIMD {
             return SIMDVec_f(t1);
         }
         // ISFIN
+        UME_FORCE_INLINE SIMDVecMask<8> isfin() const {
+            return SIMDVecMask<8>(_mm256_castps_si256(finiteLanes(mVec)));
+        }
         // ISINF
+        UME_FORCE_INLINE SIMDVecMask<8> isinf() const {
+            return SIMDVecMask<8>(_mm256_castps_si256(infiniteLanes(mVec)));
+        }
         // ISAN
+        UME_FORCE_INLINE SIMDVecMask<8> isan() const {
+            return SIMDVecMask<8>(_mm256_castps_si256(finiteLanes(mVec)));
+        }
         // ISNAN
+        UME_FORCE_INLINE SIMDVecMask<8> isnan() const {
+            return SIMDVecMask<8>(_mm256_castps_si256(nanLanes(mVec)));
+        }
         // ISSUB
+        UME_FORCE_INLINE SIMDVecMask<8> issub() const {
+            return SIMDVecMask<8>(_mm256_castps_si256(subnormalLanes(mVec)));
+        }
         // ISZERO
+        UME_FORCE_INLINE SIMDVecMask<8> iszero() const {
+            return SIMDVecMask<8>(_mm256_castps_si256(zeroLanes(mVec)));
+        }
         // ISZEROSUB
+        UME_FORCE_INLINE SIMDVecMask<8> iszerosub() const {
+            return SIMDVecMask<8>(_mm256_castps_si256(zeroOrSubnormalLanes(mVec)));
+        }
 
         // EXP
         UME_FORCE_INLINE SIMDVec_f exp() const {
@@ -1368,9 +1637,21 @@ namespace SIMD {
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
         #if defined(UME_USE_SVML)
@@ -1428,14 +1709,33 @@ namespace SIMD {
             sinvec.mVec = BLEND(mVec, t0, mask.mMask);
             cosvec.mVec = BLEND(mVec, t1, mask.mMask);
         #else
-            sinvec = SCALAR_EMULATION::MATH::sin<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
-            cosvec = SCALAR_EMULATION::MATH::cos<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+            VECTOR_EMULATION::sincosf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this, sinvec, cosvec);
         #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(*this);
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<8>>(*this, b);
+        }
 
         // PACK
         UME_FORCE_INLINE SIMDVec_f & pack(SIMDVec_f<float, 4> const & a, SIMDVec_f<float, 4> const & b) {
@@ -111,6 +111,38 @@ namespace SIMD {
             mVec[3] = x3;
         }
 
+        // Lane classification kernels used by ISFIN..ISZEROSUB. Lanes for which
+        // the predicate holds are set to all ones.
+        static UME_FORCE_INLINE __m256d absLanes(__m256d const & a) {
+            return _mm256_and_pd(a, _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL)));
+        }
+        static UME_FORCE_INLINE __m256d finiteLanes(__m256d const & a) {
+            __m256d t0 = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+            return _mm256_cmp_pd(absLanes(a), t0, _CMP_LT_OQ);
+        }
+        static UME_FORCE_INLINE __m256d infiniteLanes(__m256d const & a) {
+            __m256d t0 = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+            return _mm256_cmp_pd(absLanes(a), t0, _CMP_EQ_OQ);
+        }
+        static UME_FORCE_INLINE __m256d nanLanes(__m256d const & a) {
+            return _mm256_cmp_pd(a, a, _CMP_UNORD_Q);
+        }
+        static UME_FORCE_INLINE __m256d zeroLanes(__m256d const & a) {
+            return _mm256_cmp_pd(a, _mm256_setzero_pd(), _CMP_EQ_OQ);
+        }
+        static UME_FORCE_INLINE __m256d zeroOrSubnormalLanes(__m256d const & a) {
+            __m256d t0 = _mm256_set1_pd(std::numeric_limits<double>::min());
+            return _mm256_cmp_pd(absLanes(a), t0, _CMP_LT_OQ);
+        }
+        static UME_FORCE_INLINE __m256d subnormalLanes(__m256d const & a) {
+            return _mm256_andnot_pd(zeroLanes(a), zeroOrSubnormalLanes(a));
+        }
+        // Packs 64-bit lane masks into the 32-bit lane layout used by masks.
+        static UME_FORCE_INLINE __m128i packLanes(__m256d const & a) {
+            __m128 t0 = _mm256_castps256_ps128(_mm256_castpd_ps(a));
+            __m128 t1 = _mm256_extractf128_ps(_mm256_castpd_ps(a), 1);
+            return _mm_castps_si128(_mm_shuffle_ps(t0, t1, 0x88));
+        }
     public:
 
         // ZERO-CONSTR - Zero element constructor 
@@ -885,13 +917,76 @@ namespace SIMD {
         // MFLOOR    - Masked floor
         // CEIL      - Ceil
         // MCEIL     - Masked ceil
-        // ISFIN     - Is finite
-        // ISINF     - Is infinite (INF)
-        // ISAN      - Is a number
-        // ISNAN     - Is 'Not a Number (NaN)'
-        // ISSUB     - Is subnormal
-        // ISZERO    - Is zero
-        // ISZEROSUB - Is zero or subnormal
+        // ISFIN
+        UME_FORCE_INLINE SIMDVecMask<16> isfin() const {
+            __m128i t0 = packLanes(finiteLanes(mVec[0]));
+            __m128i t1 = packLanes(finiteLanes(mVec[1]));
+            __m128i t2 = packLanes(finiteLanes(mVec[2]));
+            __m128i t3 = packLanes(finiteLanes(mVec[3]));
+            __m256i t4 = _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+            __m256i t5 = _mm256_insertf128_si256(_mm256_castsi128_si256(t2), t3, 1);
+            return SIMDVecMask<16>(t4, t5);
+        }
+        // ISINF
+        UME_FORCE_INLINE SIMDVecMask<16> isinf() const {
+            __m128i t0 = packLanes(infiniteLanes(mVec[0]));
+            __m128i t1 = packLanes(infiniteLanes(mVec[1]));
+            __m128i t2 = packLanes(infiniteLanes(mVec[2]));
+            __m128i t3 = packLanes(infiniteLanes(mVec[3]));
+            __m256i t4 = _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+            __m256i t5 = _mm256_insertf128_si256(_mm256_castsi128_si256(t2), t3, 1);
+            return SIMDVecMask<16>(t4, t5);
+        }
+        // ISAN
+        UME_FORCE_INLINE SIMDVecMask<16> isan() const {
+            __m128i t0 = packLanes(finiteLanes(mVec[0]));
+            __m128i t1 = packLanes(finiteLanes(mVec[1]));
+            __m128i t2 = packLanes(finiteLanes(mVec[2]));
+            __m128i t3 = packLanes(finiteLanes(mVec[3]));
+            __m256i t4 = _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+            __m256i t5 = _mm256_insertf128_si256(_mm256_castsi128_si256(t2), t3, 1);
+            return SIMDVecMask<16>(t4, t5);
+        }
+        // ISNAN
+        UME_FORCE_INLINE SIMDVecMask<16> isnan() const {
+            __m128i t0 = packLanes(nanLanes(mVec[0]));
+            __m128i t1 = packLanes(nanLanes(mVec[1]));
+            __m128i t2 = packLanes(nanLanes(mVec[2]));
+            __m128i t3 = packLanes(nanLanes(mVec[3]));
+            __m256i t4 = _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+            __m256i t5 = _mm256_insertf128_si256(_mm256_castsi128_si256(t2), t3, 1);
+            return SIMDVecMask<16>(t4, t5);
+        }
+        // ISSUB
+        UME_FORCE_INLINE SIMDVecMask<16> issub() const {
+            __m128i t0 = packLanes(subnormalLanes(mVec[0]));
+            __m128i t1 = packLanes(subnormalLanes(mVec[1]));
+            __m128i t2 = packLanes(subnormalLanes(mVec[2]));
+            __m128i t3 = packLanes(subnormalLanes(mVec[3]));
+            __m256i t4 = _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+            __m256i t5 = _mm256_insertf128_si256(_mm256_castsi128_si256(t2), t3, 1);
+            return SIMDVecMask<16>(t4, t5);
+        }
+        // ISZERO
+        UME_FORCE_INLINE SIMDVecMask<16> iszero() const {
+            __m128i t0 = packLanes(zeroLanes(mVec[0]));
+            __m128i t1 = packLanes(zeroLanes(mVec[1]));
+            __m128i t2 = packLanes(zeroLanes(mVec[2]));
+            __m128i t3 = packLanes(zeroLanes(mVec[3]));
+            __m256i t4 = _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+            __m256i t5 = _mm256_insertf128_si256(_mm256_castsi128_si256(t2), t3, 1);
+            return SIMDVecMask<16>(t4, t5);
+        }
+        // ISZEROSUB
+        UME_FORCE_INLINE SIMDVecMask<16> iszerosub() const {
+            __m128i t0 = packLanes(zeroOrSubnormalLanes(mVec[0]));
+            __m128i t1 = packLanes(zeroOrSubnormalLanes(mVec[1]));
+            __m128i t2 = packLanes(zeroOrSubnormalLanes(mVec[2]));
+            __m128i t3 = packLanes(zeroOrSubnormalLanes(mVec[3]));
+            __m256i t4 = _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+            __m256i t5 = _mm256_insertf128_si256(_mm256_castsi128_si256(t2), t3, 1);
+            return SIMDVecMask<16>(t4, t5);
+        }
         // EXP
         UME_FORCE_INLINE SIMDVec_f exp() const {
             return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 16>>(*this);
@@ -901,15 +996,77 @@ namespace SIMD {
             return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 16>, SIMDVecMask<16>>(mask, *this);
         }
         // LOG
+        UME_FORCE_INLINE SIMDVec_f log() const {
+            // Evaluate the SIMDVec_f<double, 4> kernel on each register.
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).log().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).log().mVec;
+            __m256d t2 = SIMDVec_f<double, 4>(mVec[2]).log().mVec;
+            __m256d t3 = SIMDVec_f<double, 4>(mVec[3]).log().mVec;
+            return SIMDVec_f(t0, t1, t2, t3);
+        }
         // MLOG
+        UME_FORCE_INLINE SIMDVec_f log(SIMDVecMask<16> const & mask) const {
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, log());
+            return t0;
+        }
         // LOG2
         // MLOG2
         // LOG10
         // MLOG10
         // SIN       - Sine
+        UME_FORCE_INLINE SIMDVec_f sin() const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).sin().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).sin().mVec;
+            __m256d t2 = SIMDVec_f<double, 4>(mVec[2]).sin().mVec;
+            __m256d t3 = SIMDVec_f<double, 4>(mVec[3]).sin().mVec;
+            return SIMDVec_f(t0, t1, t2, t3);
+        }
         // MSIN      - Masked sine
+        UME_FORCE_INLINE SIMDVec_f sin(SIMDVecMask<16> const & mask) const {
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, sin());
+            return t0;
+        }
         // COS       - Cosine
+        UME_FORCE_INLINE SIMDVec_f cos() const {
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).cos().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).cos().mVec;
+            __m256d t2 = SIMDVec_f<double, 4>(mVec[2]).cos().mVec;
+            __m256d t3 = SIMDVec_f<double, 4>(mVec[3]).cos().mVec;
+            return SIMDVec_f(t0, t1, t2, t3);
+        }
         // MCOS      - Masked cosine
+        UME_FORCE_INLINE SIMDVec_f cos(SIMDVecMask<16> const & mask) const {
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, cos());
+            return t0;
+        }
+        // SINCOS
+        UME_FORCE_INLINE void sincos(SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            SIMDVec_f<double, 4> t0, t1;
+            SIMDVec_f<double, 4>(mVec[0]).sincos(t0, t1);
+            sinvec.mVec[0] = t0.mVec;
+            cosvec.mVec[0] = t1.mVec;
+            SIMDVec_f<double, 4>(mVec[1]).sincos(t0, t1);
+            sinvec.mVec[1] = t0.mVec;
+            cosvec.mVec[1] = t1.mVec;
+            SIMDVec_f<double, 4>(mVec[2]).sincos(t0, t1);
+            sinvec.mVec[2] = t0.mVec;
+            cosvec.mVec[2] = t1.mVec;
+            SIMDVec_f<double, 4>(mVec[3]).sincos(t0, t1);
+            sinvec.mVec[3] = t0.mVec;
+            cosvec.mVec[3] = t1.mVec;
+        }
+        // MSINCOS
+        UME_FORCE_INLINE void sincos(SIMDVecMask<16> const & mask, SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            SIMDVec_f t0, t1;
+            sincos(t0, t1);
+            sinvec = *this;
+            cosvec = *this;
+            sinvec.assign(mask, t0);
+            cosvec.assign(mask, t1);
+        }
         // TAN       - Tangent
         // MTAN      - Masked tangent
         // CTAN      - Cotangent
@@ -288,13 +288,37 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVec_f const & b) const {
+            return add(b);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            return add(mask, b);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(double b) const {
+            return add(b);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<2> const & mask, double b) const {
+            return add(mask, b);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVec_f const & b) {
+            return adda(b);
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<2> const & mask, SIMDVec_f const & b) {
+            return adda(mask, b);
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(double b) {
+            return adda(b);
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<2> const & mask, double b) {
+            return adda(mask, b);
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_f postinc() {
             double t0 = mVec[0]++;
@@ -386,13 +410,37 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVec_f const & b) const {
+            return sub(b);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<2> const & mask, SIMDVec_f const & b) const {
+            return sub(mask, b);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(double b) const {
+            return sub(b);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<2> const & mask, double b) const {
+            return sub(mask, b);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVec_f const & b) {
+            return suba(b);
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<2> const & mask, SIMDVec_f const & b) {
+            return suba(mask, b);
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(double b) {
+            return suba(b);
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<2> const & mask, double b) {
+            return suba(mask, b);
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVec_f const & a) const {
             double t0 = a.mVec[0] - mVec[0];
@@ -1207,12 +1255,47 @@ namespace SIMD {
         // CEIL
         // MCEIL
         // ISFIN
+        UME_FORCE_INLINE SIMDVecMask<2> isfin() const {
+            bool m0 = std::isfinite(mVec[0]);
+            bool m1 = std::isfinite(mVec[1]);
+            return SIMDVecMask<2>(m0, m1);
+        }
         // ISINF
+        UME_FORCE_INLINE SIMDVecMask<2> isinf() const {
+            bool m0 = std::isinf(mVec[0]);
+            bool m1 = std::isinf(mVec[1]);
+            return SIMDVecMask<2>(m0, m1);
+        }
         // ISAN
+        UME_FORCE_INLINE SIMDVecMask<2> isan() const {
+            bool m0 = std::isfinite(mVec[0]);
+            bool m1 = std::isfinite(mVec[1]);
+            return SIMDVecMask<2>(m0, m1);
+        }
         // ISNAN
+        UME_FORCE_INLINE SIMDVecMask<2> isnan() const {
+            bool m0 = std::isnan(mVec[0]);
+            bool m1 = std::isnan(mVec[1]);
+            return SIMDVecMask<2>(m0, m1);
+        }
         // ISSUB
+        UME_FORCE_INLINE SIMDVecMask<2> issub() const {
+            bool m0 = (std::abs(mVec[0]) < std::numeric_limits<double>::min()) && (mVec[0] != 0.0);
+            bool m1 = (std::abs(mVec[1]) < std::numeric_limits<double>::min()) && (mVec[1] != 0.0);
+            return SIMDVecMask<2>(m0, m1);
+        }
         // ISZERO
+        UME_FORCE_INLINE SIMDVecMask<2> iszero() const {
+            bool m0 = mVec[0] == 0.0;
+            bool m1 = mVec[1] == 0.0;
+            return SIMDVecMask<2>(m0, m1);
+        }
         // ISZEROSUB
+        UME_FORCE_INLINE SIMDVecMask<2> iszerosub() const {
+            bool m0 = std::abs(mVec[0]) < std::numeric_limits<double>::min();
+            bool m1 = std::abs(mVec[1]) < std::numeric_limits<double>::min();
+            return SIMDVecMask<2>(m0, m1);
+        }
         // EXP
         UME_FORCE_INLINE SIMDVec_f exp() const {
             double t0 = std::exp(mVec[0]);
@@ -38,6 +38,7 @@
 
 #if defined UME_USE_MASK_64B
     #define BLEND(a_256d, b_256d, mask_256i) _mm256_blendv_pd(a_256d, b_256d, _mm256_castsi256_pd(mask_256i))
+    #define MASK_LOAD(f64_addr, mask_256i) _mm256_maskload_pd(f64_addr, mask_256i)
     #define MASK_STORE(f64_addr, mask_256i, a_256d) \
         _mm256_maskstore_pd( \
             f64_addr, \
@@ -50,6 +51,9 @@
             a_256d, \
             b_256d, \
             _mm256_cvtepi32_pd(mask_128i))
+    #define MASK_LOAD(f64_addr, mask_128i) \
+        _mm256_maskload_pd( \
+            f64_addr, _mm256_cvtepi32_epi64(mask_128i))
     #define MASK_STORE(f64_addr, mask_128i, a_256d) \
         _mm256_maskstore_pd( \
             f64_addr, _mm256_cvtepi32_epi64(mask_128i), a_256d)
@@ -81,6 +85,44 @@ namespace SIMD {
             this->mVec = x;
         }
 
+        friend class SIMDVec_u<uint64_t, 4>;
+        friend class SIMDVec_i<int64_t, 4>;
+
+        friend class SIMDVec_f<double, 8>;
+        friend class SIMDVec_f<double, 16>;
+
+        // Lane classification kernels used by ISFIN..ISZEROSUB. Lanes for which
+        // the predicate holds are set to all ones.
+        static UME_FORCE_INLINE __m256d absLanes(__m256d const & a) {
+            return _mm256_and_pd(a, _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL)));
+        }
+        static UME_FORCE_INLINE __m256d finiteLanes(__m256d const & a) {
+            __m256d t0 = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+            return _mm256_cmp_pd(absLanes(a), t0, _CMP_LT_OQ);
+        }
+        static UME_FORCE_INLINE __m256d infiniteLanes(__m256d const & a) {
+            __m256d t0 = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+            return _mm256_cmp_pd(absLanes(a), t0, _CMP_EQ_OQ);
+        }
+        static UME_FORCE_INLINE __m256d nanLanes(__m256d const & a) {
+            return _mm256_cmp_pd(a, a, _CMP_UNORD_Q);
+        }
+        static UME_FORCE_INLINE __m256d zeroLanes(__m256d const & a) {
+            return _mm256_cmp_pd(a, _mm256_setzero_pd(), _CMP_EQ_OQ);
+        }
+        static UME_FORCE_INLINE __m256d zeroOrSubnormalLanes(__m256d const & a) {
+            __m256d t0 = _mm256_set1_pd(std::numeric_limits<double>::min());
+            return _mm256_cmp_pd(absLanes(a), t0, _CMP_LT_OQ);
+        }
+        static UME_FORCE_INLINE __m256d subnormalLanes(__m256d const & a) {
+            return _mm256_andnot_pd(zeroLanes(a), zeroOrSubnormalLanes(a));
+        }
+        // Packs 64-bit lane masks into the 32-bit lane layout used by masks.
+        static UME_FORCE_INLINE __m128i packLanes(__m256d const & a) {
+            __m128 t0 = _mm256_castps256_ps128(_mm256_castpd_ps(a));
+            __m128 t1 = _mm256_extractf128_ps(_mm256_castpd_ps(a), 1);
+            return _mm_castps_si128(_mm_shuffle_ps(t0, t1, 0x88));
+        }
     public:
 
         static constexpr uint32_t length() { return 4; }
@@ -189,7 +231,7 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<4> const & mask, double const * p) {
-            __m256d t0 = _mm256_loadu_pd(p);
+            __m256d t0 = MASK_LOAD(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -204,6 +246,13 @@ namespace SIMD {
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
+        // LOADN
+        UME_FORCE_INLINE SIMDVec_f & loadn(uint32_t n, double const * p) {
+            __m256d t0 = _mm256_setr_pd(0.0, 1.0, 2.0, 3.0);
+            __m256d t1 = _mm256_cmp_pd(_mm256_set1_pd(n < 4 ? double(n) : 4.0), t0, _CMP_GT_OQ);
+            mVec = _mm256_maskload_pd(p, _mm256_castpd_si256(t1));
+            return *this;
+        }
         // STORE
         UME_FORCE_INLINE double* store(double* p) const {
             _mm256_storeu_pd(p, mVec);
@@ -211,9 +260,14 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE double* store(SIMDVecMask<4> const & mask, double* p) const {
-            __m256d t0 = _mm256_loadu_pd(p);
-            __m256d t1 = BLEND(t0, mVec, mask.mMask);
-            _mm256_storeu_pd(p, t1);
+            MASK_STORE(p, mask.mMask, mVec);
+            return p;
+        }
+        // STOREN
+        UME_FORCE_INLINE double* storen(uint32_t n, double * p) const {
+            __m256d t0 = _mm256_setr_pd(0.0, 1.0, 2.0, 3.0);
+            __m256d t1 = _mm256_cmp_pd(_mm256_set1_pd(n < 4 ? double(n) : 4.0), t0, _CMP_GT_OQ);
+            _mm256_maskstore_pd(p, _mm256_castpd_si256(t1), mVec);
             return p;
         }
         // STOREA
@@ -239,8 +293,28 @@ namespace SIMD {
             return SIMDVec_f(t1);
         }
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_f swizzle(SIMDSwizzle<4> const & sMask) const {
+            // Expand each 64-bit lane index i into the 32-bit index pair (2i, 2i+1).
+            __m256i t0 = _mm256_cvtepu32_epi64(sMask.mVec);
+            __m256i t1 = _mm256_slli_epi64(t0, 1);
+            __m256i t2 = _mm256_or_si256(t1, _mm256_slli_epi64(t1, 32));
+            __m256i t3 = _mm256_add_epi32(t2, _mm256_setr_epi32(0, 1, 0, 1, 0, 1, 0, 1));
+            __m256 t4 = _mm256_permutevar8x32_ps(_mm256_castpd_ps(mVec), t3);
+            __m256d t5 = _mm256_castps_pd(t4);
+            return SIMDVec_f(t5);
+        }
+        template<int i0, int i1, int i2, int i3>
+        UME_FORCE_INLINE SIMDVec_f swizzle() const {
+            __m256d t0 = _mm256_permute4x64_pd(mVec, (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6));
+            return SIMDVec_f(t0);
+        }
         // SWIZZLEA
-        //(Addition operations)
+        UME_FORCE_INLINE SIMDVec_f & swizzlea(SIMDSwizzle<4> const & sMask) {
+            SIMDVec_f t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
+
         // ADDV
         UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
             __m256d t0 = _mm256_add_pd(mVec, b.mVec);
@@ -311,11 +385,73 @@ namespace SIMD {
         // SADDSA   - Satureated add with scalar and assign
         // MSADDSA  - Masked staturated add with vector and assign
         // POSTINC  - Postfix increment
+        UME_FORCE_INLINE SIMDVec_f postinc() {
+            __m256d t0 = _mm256_set1_pd(1.0);
+            __m256d t1 = mVec;
+            mVec = _mm256_add_pd(mVec, t0);
+            return SIMDVec_f(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator++ (int) {
+            return postinc();
+        }
         // MPOSTINC - Masked postfix increment
+        UME_FORCE_INLINE SIMDVec_f postinc(SIMDVecMask<4> const & mask) {
+            __m256d t0 = _mm256_set1_pd(1.0);
+            __m256d t1 = mVec;
+            __m256d t2 = _mm256_add_pd(mVec, t0);
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return SIMDVec_f(t1);
+        }
         // PREFINC  - Prefix increment
+        UME_FORCE_INLINE SIMDVec_f & prefinc() {
+            __m256d t0 = _mm256_set1_pd(1.0);
+            mVec = _mm256_add_pd(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator++ () {
+            return prefinc();
+        }
         // MPREFINC - Masked prefix increment
+        UME_FORCE_INLINE SIMDVec_f & prefinc(SIMDVecMask<4> const & mask) {
+            __m256d t0 = _mm256_set1_pd(1.0);
+            __m256d t1 = _mm256_add_pd(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
 
         //(Subtraction operations)
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVec_f const & b) const {
+            return add(b);
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return add(mask, b);
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(double b) const {
+            return add(b);
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<4> const & mask, double b) const {
+            return add(mask, b);
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVec_f const & b) {
+            return adda(b);
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            return adda(mask, b);
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(double b) {
+            return adda(b);
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<4> const & mask, double b) {
+            return adda(mask, b);
+        }
         // SUBV
         UME_FORCE_INLINE SIMDVec_f sub(SIMDVec_f const & b) const {
             __m256d t0 = _mm256_sub_pd(mVec, b.mVec);
@@ -381,6 +517,38 @@ namespace SIMD {
         // MSSUBVA    - Masked saturated sub with vector and assign
         // SSUBSA     - Saturated sub with scalar and assign
         // MSSUBSA    - Masked saturated sub with scalar and assign
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVec_f const & b) const {
+            return sub(b);
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return sub(mask, b);
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(double b) const {
+            return sub(b);
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<4> const & mask, double b) const {
+            return sub(mask, b);
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVec_f const & b) {
+            return suba(b);
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            return suba(mask, b);
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(double b) {
+            return suba(b);
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<4> const & mask, double b) {
+            return suba(mask, b);
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVec_f const & b) const {
             __m256d t0 = _mm256_sub_pd(b.mVec, mVec);
@@ -848,7 +1016,16 @@ namespace SIMD {
             return SIMDVec_f(t1);
         }
         // NEGA  - Negate signed values and assign
+        UME_FORCE_INLINE SIMDVec_f & nega() {
+            mVec = _mm256_sub_pd(_mm256_set1_pd(0.0), mVec);
+            return *this;
+        }
         // MNEGA - Masked negate signed values and assign
+        UME_FORCE_INLINE SIMDVec_f & nega(SIMDVecMask<4> const & mask) {
+            __m256d t0 = _mm256_sub_pd(_mm256_set1_pd(0.0), mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
 
         // (Mathematical functions)
         // ABS
@@ -926,10 +1103,22 @@ namespace SIMD {
         }
         // SQRTA     - Square root of vector values and assign
         // MSQRTA    - Masked square root of vector values and assign
-        // POWV      - Power (exponents in vector)
-        // MPOWV     - Masked power (exponents in vector)
-        // POWS      - Power (exponent in scalar)
-        // MPOWS     - Masked power (exponent in scalar) 
+        // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this, b);
+        }
+        // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this, b);
+        }
+        // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this, SIMDVec_f(b));
+        }
+        // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256d t0 = _mm256_round_pd(mVec, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
@@ -944,16 +1133,55 @@ namespace SIMD {
         // TRUNC     - Truncate to integer (returns Signed integer vector)
         // MTRUNC    - Masked truncate to integer (returns Signed integer vector)
         // FLOOR     - Floor
+        UME_FORCE_INLINE SIMDVec_f floor() const {
+            __m256d t0 = _mm256_floor_pd(mVec);
+            return SIMDVec_f(t0);
+        }
         // MFLOOR    - Masked floor
+        UME_FORCE_INLINE SIMDVec_f floor(SIMDVecMask<4> const & mask) const {
+            __m256d t0 = _mm256_floor_pd(mVec);
+            __m256d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
         // CEIL      - Ceil
+        UME_FORCE_INLINE SIMDVec_f ceil() const {
+            __m256d t0 = _mm256_ceil_pd(mVec);
+            return SIMDVec_f(t0);
+        }
         // MCEIL     - Masked ceil
-        // ISFIN     - Is finite
-        // ISINF     - Is infinite (INF)
-        // ISAN      - Is a number
-        // ISNAN     - Is 'Not a Number (NaN)'
-        // ISSUB     - Is subnormal
-        // ISZERO    - Is zero
-        // ISZEROSUB - Is zero or subnormal
+        UME_FORCE_INLINE SIMDVec_f ceil(SIMDVecMask<4> const & mask) const {
+            __m256d t0 = _mm256_ceil_pd(mVec);
+            __m256d t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // ISFIN
+        UME_FORCE_INLINE SIMDVecMask<4> isfin() const {
+            return SIMDVecMask<4>(packLanes(finiteLanes(mVec)));
+        }
+        // ISINF
+        UME_FORCE_INLINE SIMDVecMask<4> isinf() const {
+            return SIMDVecMask<4>(packLanes(infiniteLanes(mVec)));
+        }
+        // ISAN
+        UME_FORCE_INLINE SIMDVecMask<4> isan() const {
+            return SIMDVecMask<4>(packLanes(finiteLanes(mVec)));
+        }
+        // ISNAN
+        UME_FORCE_INLINE SIMDVecMask<4> isnan() const {
+            return SIMDVecMask<4>(packLanes(nanLanes(mVec)));
+        }
+        // ISSUB
+        UME_FORCE_INLINE SIMDVecMask<4> issub() const {
+            return SIMDVecMask<4>(packLanes(subnormalLanes(mVec)));
+        }
+        // ISZERO
+        UME_FORCE_INLINE SIMDVecMask<4> iszero() const {
+            return SIMDVecMask<4>(packLanes(zeroLanes(mVec)));
+        }
+        // ISZEROSUB
+        UME_FORCE_INLINE SIMDVecMask<4> iszerosub() const {
+            return SIMDVecMask<4>(packLanes(zeroOrSubnormalLanes(mVec)));
+        }
         // EXP
         UME_FORCE_INLINE SIMDVec_f exp() const {
         #if defined(UME_USE_SVML)
@@ -993,16 +1221,28 @@ namespace SIMD {
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
 #if defined(UME_USE_SVML)
             __m256d t0 = _mm256_sin_pd(mVec);
             return SIMDVec_f(t0);
 #else
-            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(*this);
 #endif
         }
         // MSIN
@@ -1012,7 +1252,7 @@ namespace SIMD {
             __m256d t1 = BLEND(mVec, t0, mask.mMask);
             return SIMDVec_f(t1);
 #else
-            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(mask, *this);
 #endif
         }
         // COS
@@ -1021,7 +1261,7 @@ namespace SIMD {
             __m256d t0 = _mm256_cos_pd(mVec);
             return SIMDVec_f(t0);
 #else
-            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(*this);
 #endif
         }
         // MCOS
@@ -1031,13 +1271,55 @@ namespace SIMD {
             __m256d t1 = BLEND(mVec, t0, mask.mMask);
             return SIMDVec_f(t1);
 #else
-            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(mask, *this);
+#endif
+        }
+        // SINCOS
+        UME_FORCE_INLINE void sincos(SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+#if defined(UME_USE_SVML)
+            alignas(32) double raw_cos[4];
+            sinvec.mVec = _mm256_sincos_pd((__m256d*)raw_cos, mVec);
+            cosvec.mVec = _mm256_load_pd(raw_cos);
+#else
+            VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(*this, sinvec, cosvec);
+#endif
+        }
+        // MSINCOS
+        UME_FORCE_INLINE void sincos(SIMDVecMask<4> const & mask, SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+#if defined(UME_USE_SVML)
+            alignas(32) double raw_cos[4];
+            __m256d t0 = _mm256_sincos_pd((__m256d*)raw_cos, mVec);
+            __m256d t1 = _mm256_load_pd(raw_cos);
+            sinvec.mVec = BLEND(mVec, t0, mask.mMask);
+            cosvec.mVec = BLEND(mVec, t1, mask.mMask);
+#else
+            VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(mask, *this, sinvec, cosvec);
 #endif
         }
-        // TAN       - Tangent
-        // MTAN      - Masked tangent
-        // CTAN      - Cotangent
-        // MCTAN     - Masked cotangent
+        // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2d<SIMDVec_f, SIMDVecMask<4>>(*this, b);
+        }
 
         // PROMOTE
         // -
@@ -1053,5 +1335,7 @@ namespace SIMD {
 }
 
 #undef BLEND
+#undef MASK_LOAD
+#undef MASK_STORE
 
 #endif
@@ -82,6 +82,38 @@ namespace SIMD {
             this->mVec[1] = x1;
         }
 
+        // Lane classification kernels used by ISFIN..ISZEROSUB. Lanes for which
+        // the predicate holds are set to all ones.
+        static UME_FORCE_INLINE __m256d absLanes(__m256d const & a) {
+            return _mm256_and_pd(a, _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL)));
+        }
+        static UME_FORCE_INLINE __m256d finiteLanes(__m256d const & a) {
+            __m256d t0 = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+            return _mm256_cmp_pd(absLanes(a), t0, _CMP_LT_OQ);
+        }
+        static UME_FORCE_INLINE __m256d infiniteLanes(__m256d const & a) {
+            __m256d t0 = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+            return _mm256_cmp_pd(absLanes(a), t0, _CMP_EQ_OQ);
+        }
+        static UME_FORCE_INLINE __m256d nanLanes(__m256d const & a) {
+            return _mm256_cmp_pd(a, a, _CMP_UNORD_Q);
+        }
+        static UME_FORCE_INLINE __m256d zeroLanes(__m256d const & a) {
+            return _mm256_cmp_pd(a, _mm256_setzero_pd(), _CMP_EQ_OQ);
+        }
+        static UME_FORCE_INLINE __m256d zeroOrSubnormalLanes(__m256d const & a) {
+            __m256d t0 = _mm256_set1_pd(std::numeric_limits<double>::min());
+            return _mm256_cmp_pd(absLanes(a), t0, _CMP_LT_OQ);
+        }
+        static UME_FORCE_INLINE __m256d subnormalLanes(__m256d const & a) {
+            return _mm256_andnot_pd(zeroLanes(a), zeroOrSubnormalLanes(a));
+        }
+        // Packs 64-bit lane masks into the 32-bit lane layout used by masks.
+        static UME_FORCE_INLINE __m128i packLanes(__m256d const & a) {
+            __m128 t0 = _mm256_castps256_ps128(_mm256_castpd_ps(a));
+            __m128 t1 = _mm256_extractf128_ps(_mm256_castpd_ps(a), 1);
+            return _mm_castps_si128(_mm_shuffle_ps(t0, t1, 0x88));
+        }
     public:
 
         // ZERO-CONSTR - Zero element constructor 
@@ -398,6 +430,38 @@ namespace SIMD {
         // MPREFINC - Masked prefix increment
 
         //(Subtraction operations)
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVec_f const & b) const {
+            return add(b);
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return add(mask, b);
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(double b) const {
+            return add(b);
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<8> const & mask, double b) const {
+            return add(mask, b);
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVec_f const & b) {
+            return adda(b);
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<8> const & mask, SIMDVec_f const & b) {
+            return adda(mask, b);
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(double b) {
+            return adda(b);
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<8> const & mask, double b) {
+            return adda(mask, b);
+        }
         // SUBV
         UME_FORCE_INLINE SIMDVec_f sub(SIMDVec_f const & b) const {
             __m256d t0 = _mm256_sub_pd(mVec[0], b.mVec[0]);
@@ -453,6 +517,38 @@ namespace SIMD {
             __m256d t1 = _mm256_sub_pd(b.mVec[1], mVec[1]);
             return SIMDVec_f(t0, t1);
         }
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVec_f const & b) const {
+            return sub(b);
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return sub(mask, b);
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(double b) const {
+            return sub(b);
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<8> const & mask, double b) const {
+            return sub(mask, b);
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVec_f const & b) {
+            return suba(b);
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<8> const & mask, SIMDVec_f const & b) {
+            return suba(mask, b);
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(double b) {
+            return suba(b);
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<8> const & mask, double b) {
+            return suba(mask, b);
+        }
         // MSUBFROMV
         UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
             __m256d t0 = _mm256_sub_pd(b.mVec[0], mVec[0]);
@@ -1131,10 +1227,22 @@ namespace SIMD {
         }
         // SQRTA     - Square root of vector values and assign
         // MSQRTA    - Masked square root of vector values and assign
-        // POWV      - Power (exponents in vector)
-        // MPOWV     - Masked power (exponents in vector)
-        // POWS      - Power (exponent in scalar)
-        // MPOWS     - Masked power (exponent in scalar) 
+        // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(*this, b);
+        }
+        // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this, b);
+        }
+        // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(*this, SIMDVec_f(b));
+        }
+        // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256d t0 = _mm256_round_pd(mVec[0], _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
@@ -1155,13 +1263,55 @@ namespace SIMD {
         // MFLOOR    - Masked floor
         // CEIL      - Ceil
         // MCEIL     - Masked ceil
-        // ISFIN     - Is finite
-        // ISINF     - Is infinite (INF)
-        // ISAN      - Is a number
-        // ISNAN     - Is 'Not a Number (NaN)'
-        // ISSUB     - Is subnormal
-        // ISZERO    - Is zero
-        // ISZEROSUB - Is zero or subnormal
+        // ISFIN
+        UME_FORCE_INLINE SIMDVecMask<8> isfin() const {
+            __m128i t0 = packLanes(finiteLanes(mVec[0]));
+            __m128i t1 = packLanes(finiteLanes(mVec[1]));
+            __m256i t2 = _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+            return SIMDVecMask<8>(t2);
+        }
+        // ISINF
+        UME_FORCE_INLINE SIMDVecMask<8> isinf() const {
+            __m128i t0 = packLanes(infiniteLanes(mVec[0]));
+            __m128i t1 = packLanes(infiniteLanes(mVec[1]));
+            __m256i t2 = _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+            return SIMDVecMask<8>(t2);
+        }
+        // ISAN
+        UME_FORCE_INLINE SIMDVecMask<8> isan() const {
+            __m128i t0 = packLanes(finiteLanes(mVec[0]));
+            __m128i t1 = packLanes(finiteLanes(mVec[1]));
+            __m256i t2 = _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+            return SIMDVecMask<8>(t2);
+        }
+        // ISNAN
+        UME_FORCE_INLINE SIMDVecMask<8> isnan() const {
+            __m128i t0 = packLanes(nanLanes(mVec[0]));
+            __m128i t1 = packLanes(nanLanes(mVec[1]));
+            __m256i t2 = _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+            return SIMDVecMask<8>(t2);
+        }
+        // ISSUB
+        UME_FORCE_INLINE SIMDVecMask<8> issub() const {
+            __m128i t0 = packLanes(subnormalLanes(mVec[0]));
+            __m128i t1 = packLanes(subnormalLanes(mVec[1]));
+            __m256i t2 = _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+            return SIMDVecMask<8>(t2);
+        }
+        // ISZERO
+        UME_FORCE_INLINE SIMDVecMask<8> iszero() const {
+            __m128i t0 = packLanes(zeroLanes(mVec[0]));
+            __m128i t1 = packLanes(zeroLanes(mVec[1]));
+            __m256i t2 = _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+            return SIMDVecMask<8>(t2);
+        }
+        // ISZEROSUB
+        UME_FORCE_INLINE SIMDVecMask<8> iszerosub() const {
+            __m128i t0 = packLanes(zeroOrSubnormalLanes(mVec[0]));
+            __m128i t1 = packLanes(zeroOrSubnormalLanes(mVec[1]));
+            __m256i t2 = _mm256_insertf128_si256(_mm256_castsi128_si256(t0), t1, 1);
+            return SIMDVecMask<8>(t2);
+        }
         // EXP
         UME_FORCE_INLINE SIMDVec_f exp() const {
             return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 8>>(*this);
@@ -1171,11 +1321,34 @@ namespace SIMD {
             return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
         }
         // LOG
+        UME_FORCE_INLINE SIMDVec_f log() const {
+            // Evaluate the SIMDVec_f<double, 4> kernel on each register.
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).log().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).log().mVec;
+            return SIMDVec_f(t0, t1);
+        }
         // MLOG
+        UME_FORCE_INLINE SIMDVec_f log(SIMDVecMask<8> const & mask) const {
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, log());
+            return t0;
+        }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 8>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 8>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
 #if defined(UME_USE_SVML)
@@ -1183,7 +1356,9 @@ namespace SIMD {
             __m256d t1 = _mm256_sin_pd(mVec[1]);
             return SIMDVec_f(t0, t1);
 #else
-            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(*this);
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).sin().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).sin().mVec;
+            return SIMDVec_f(t0, t1);
 #endif
         }
         // MSIN
@@ -1195,7 +1370,9 @@ namespace SIMD {
             __m256d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
             return SIMDVec_f(t0, t1);
 #else
-            return VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(mask, *this);
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, sin());
+            return t0;
 #endif
         }
         // COS
@@ -1205,7 +1382,9 @@ namespace SIMD {
             __m256d t1 = _mm256_cos_pd(mVec[1]);
             return SIMDVec_f(t0, t1);
 #else
-            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(*this);
+            __m256d t0 = SIMDVec_f<double, 4>(mVec[0]).cos().mVec;
+            __m256d t1 = SIMDVec_f<double, 4>(mVec[1]).cos().mVec;
+            return SIMDVec_f(t0, t1);
 #endif
         }
         // MCOS
@@ -1217,7 +1396,9 @@ namespace SIMD {
             __m256d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
             return SIMDVec_f(t0, t1);
 #else
-            return VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(mask, *this);
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, cos());
+            return t0;
 #endif
         }
         // SINCOS
@@ -1229,7 +1410,13 @@ namespace SIMD {
             cosvec.mVec[0] = _mm256_load_pd(&raw_cos[0]);
             cosvec.mVec[1] = _mm256_load_pd(&raw_cos[4]);
         #else
-            VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(*this, sinvec, cosvec);
+            SIMDVec_f<double, 4> t0, t1;
+            SIMDVec_f<double, 4>(mVec[0]).sincos(t0, t1);
+            sinvec.mVec[0] = t0.mVec;
+            cosvec.mVec[0] = t1.mVec;
+            SIMDVec_f<double, 4>(mVec[1]).sincos(t0, t1);
+            sinvec.mVec[1] = t0.mVec;
+            cosvec.mVec[1] = t1.mVec;
         #endif
         }
 
@@ -1248,14 +1435,38 @@ namespace SIMD {
             cosvec.mVec[0] = BLEND_LO(mVec[0], t2, mask.mMask);
             cosvec.mVec[1] = BLEND_HI(mVec[1], t3, mask.mMask);
         #else
-            sinvec = VECTOR_EMULATION::sind<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(mask, *this);
-            cosvec = VECTOR_EMULATION::cosd<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(mask, *this);
+            SIMDVec_f t0, t1;
+            sincos(t0, t1);
+            sinvec = *this;
+            cosvec = *this;
+            sinvec.assign(mask, t0);
+            cosvec.assign(mask, t1);
         #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(*this);
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2d<SIMDVec_f, SIMDVecMask<8>>(*this, b);
+        }
 
         // PROMOTE
         // -
@@ -0,0 +1,1721 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_INT16_16_H_
+#define UME_SIMD_VEC_INT16_16_H_
+
+#include <type_traits>
+#include <immintrin.h>
+
+#include "../../../UMESimdInterface.h"
+
+namespace UME {
+namespace SIMD {
+
+    template<>
+    class SIMDVec_i<int16_t, 16> :
+        public SIMDVecSignedInterface<
+            SIMDVec_i<int16_t, 16>,
+            SIMDVec_u<uint16_t, 16>,
+            int16_t,
+            16,
+            uint16_t,
+            SIMDVecMask<16>,
+            SIMDSwizzle<16 >> ,
+        public SIMDVecPackableInterface<
+            SIMDVec_i<int16_t, 16>,
+            SIMDVec_i<int16_t, 8 >>
+    {
+    public:
+        // Conversion operators require access to private members.
+        friend class SIMDVec_u<uint16_t, 16>;
+        friend class SIMDVec_i<int8_t, 16>;
+        friend class SIMDVec_i<int32_t, 16>;
+
+        friend class SIMDVec_i<int16_t, 32>;
+    private:
+        __m256i mVec;
+
+        UME_FORCE_INLINE explicit SIMDVec_i(__m256i & x) { mVec = x; }
+        UME_FORCE_INLINE explicit SIMDVec_i(const __m256i & x) { mVec = x; }
+    public:
+
+        constexpr static uint32_t length() { return 16; }
+        constexpr static uint32_t alignment() { return 32; }
+
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_i() {}
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_i(int16_t i) {
+            mVec = _mm256_set1_epi16(i);
+        }
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_i(
+            T i, 
+            typename std::enable_if< std::is_fundamental<T>::value && 
+                                    !std::is_same<T, int16_t>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_i(static_cast<int16_t>(i)) {}
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVec_i(int16_t const *p) { load(p); }
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVec_i(int16_t i0, int16_t i1, int16_t i2, int16_t i3,
+                                   int16_t i4, int16_t i5, int16_t i6, int16_t i7,
+                                   int16_t i8, int16_t i9, int16_t i10, int16_t i11,
+                                   int16_t i12, int16_t i13, int16_t i14, int16_t i15)
+        {
+            mVec = _mm256_setr_epi16(i0, i1, i2, i3, i4, i5, i6, i7,
+                                     i8, i9, i10, i11, i12, i13, i14, i15);
+        }
+        // EXTRACT
+        UME_FORCE_INLINE int16_t extract(uint32_t index) const {
+            alignas(32) int16_t raw[16];
+            _mm256_store_si256((__m256i*)raw, mVec);
+            return raw[index];
+        }
+        UME_FORCE_INLINE int16_t operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_i & insert(uint32_t index, int16_t value) {
+            alignas(32) int16_t raw[16];
+            _mm256_store_si256((__m256i*)raw, mVec);
+            raw[index] = value;
+            mVec = _mm256_load_si256((__m256i*)raw);
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_i, int16_t> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_i, int16_t>(index, static_cast<SIMDVec_i &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_i, int16_t, SIMDVecMask<16>> operator() (SIMDVecMask<16> const & mask) {
+            return IntermediateMask<SIMDVec_i, int16_t, SIMDVecMask<16>>(mask, static_cast<SIMDVec_i &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_i, int16_t, SIMDVecMask<16>> operator[] (SIMDVecMask<16> const & mask) {
+            return IntermediateMask<SIMDVec_i, int16_t, SIMDVecMask<16>>(mask, static_cast<SIMDVec_i &>(*this));
+        }
+#endif
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVec_i const & b) {
+            mVec = b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator= (SIMDVec_i const & b) {
+            return assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16();
+            mVec = _mm256_blendv_epi8(mVec, b.mVec, m0);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_i & assign(int16_t b) {
+            mVec = _mm256_set1_epi16(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator= (int16_t b) {
+            return assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVecMask<16> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec = _mm256_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+
+        // PREFETCH0
+        // PREFETCH1
+        // PREFETCH2
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_i & load(int16_t const *p) {
+            mVec = _mm256_loadu_si256((const __m256i *)p);
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<16> const & mask, int16_t const *p) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_loadu_si256((const __m256i *)p);
+            mVec = _mm256_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_i & loada(int16_t const *p) {
+            mVec = _mm256_load_si256((const __m256i *)p);
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<16> const & mask, int16_t const *p) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_load_si256((const __m256i *)p);
+            mVec = _mm256_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE int16_t* store(int16_t* p) const {
+            _mm256_storeu_si256((__m256i *)p, mVec);
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE int16_t* store(SIMDVecMask<16> const & mask, int16_t* p) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_loadu_si256((const __m256i *)p);
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec, m0);
+            _mm256_storeu_si256((__m256i *)p, t1);
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE int16_t* storea(int16_t* p) const {
+            _mm256_store_si256((__m256i *)p, mVec);
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE int16_t* storea(SIMDVecMask<16> const & mask, int16_t* p) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_load_si256((const __m256i *)p);
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec, m0);
+            _mm256_store_si256((__m256i *)p, t1);
+            return p;
+        }
+
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_blendv_epi8(mVec, b.mVec, m0);
+            return SIMDVec_i(t0);
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<16> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // SWIZZLE
+        // SWIZZLEA
+
+        // SORTA
+        // SORTD
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_add_epi16(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator+ (SIMDVec_i const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_add_epi16(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_i add(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_add_epi16(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator+ (int16_t b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVecMask<16> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_add_epi16(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVec_i const & b) {
+            mVec = _mm256_add_epi16(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator+= (SIMDVec_i const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_add_epi16(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_i & adda(int16_t b) {
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec = _mm256_add_epi16(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator+= (int16_t b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVecMask<16> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_add_epi16(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // POSTINC
+        UME_FORCE_INLINE SIMDVec_i postinc() {
+            __m256i t0 = _mm256_set1_epi16(1);
+            __m256i t1 = mVec;
+            mVec = _mm256_add_epi16(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator++ (int) {
+            return postinc();
+        }
+        // MPOSTINC
+        UME_FORCE_INLINE SIMDVec_i postinc(SIMDVecMask<16> const & mask) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(1);
+            __m256i t1 = mVec;
+            __m256i t2 = _mm256_add_epi16(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t2, m0);
+            return SIMDVec_i(t1);
+        }
+        // PREFINC
+        UME_FORCE_INLINE SIMDVec_i & prefinc() {
+            __m256i t0 = _mm256_set1_epi16(1);
+            mVec = _mm256_add_epi16(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator++ () {
+            return prefinc();
+        }
+        // MPREFINC
+        UME_FORCE_INLINE SIMDVec_i & prefinc(SIMDVecMask<16> const & mask) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(1);
+            __m256i t1 = _mm256_add_epi16(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_adds_epi16(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_adds_epi16(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_adds_epi16(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<16> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_adds_epi16(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec = _mm256_adds_epi16(mVec, b.mVec);
+            return *this;
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_adds_epi16(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int16_t b) {
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec = _mm256_adds_epi16(mVec, t0);
+            return *this;
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<16> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_adds_epi16(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_sub_epi16(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- (SIMDVec_i const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_sub_epi16(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_i sub(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_sub_epi16(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- (int16_t b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVecMask<16> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_sub_epi16(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVec_i const & b) {
+            mVec = _mm256_sub_epi16(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-= (SIMDVec_i const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_sub_epi16(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_i & suba(int16_t b) {
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec = _mm256_sub_epi16(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-= (int16_t b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVecMask<16> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_sub_epi16(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_subs_epi16(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_subs_epi16(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_subs_epi16(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<16> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_subs_epi16(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec = _mm256_subs_epi16(mVec, b.mVec);
+            return *this;
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_subs_epi16(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int16_t b) {
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec = _mm256_subs_epi16(mVec, t0);
+            return *this;
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<16> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_subs_epi16(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_sub_epi16(b.mVec, mVec);
+            return SIMDVec_i(t0);
+        }
+        // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_sub_epi16(b.mVec, mVec);
+            __m256i t1 = _mm256_blendv_epi8(b.mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_i subfrom(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_sub_epi16(t0, mVec);
+            return SIMDVec_i(t1);
+        }
+        // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVecMask<16> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_sub_epi16(t0, mVec);
+            __m256i t2 = _mm256_blendv_epi8(t0, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVec_i const & b) {
+            mVec = _mm256_sub_epi16(b.mVec, mVec);
+            return *this;
+        }
+        // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_sub_epi16(b.mVec, mVec);
+            mVec = _mm256_blendv_epi8(b.mVec, t0, m0);
+            return *this;
+        }
+        // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(int16_t b) {
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec = _mm256_sub_epi16(t0, mVec);
+            return *this;
+        }
+        // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVecMask<16> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_sub_epi16(t0, mVec);
+            mVec = _mm256_blendv_epi8(t0, t1, m0);
+            return *this;
+        }
+        // POSTDEC
+        UME_FORCE_INLINE SIMDVec_i postdec() {
+            __m256i t0 = _mm256_set1_epi16(1);
+            __m256i t1 = mVec;
+            mVec = _mm256_sub_epi16(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator-- (int) {
+            return postdec();
+        }
+        // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_i postdec(SIMDVecMask<16> const & mask) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(1);
+            __m256i t1 = mVec;
+            __m256i t2 = _mm256_sub_epi16(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t2, m0);
+            return SIMDVec_i(t1);
+        }
+        // PREFDEC
+        UME_FORCE_INLINE SIMDVec_i & prefdec() {
+            __m256i t0 = _mm256_set1_epi16(1);
+            mVec = _mm256_sub_epi16(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-- () {
+            return prefdec();
+        }
+        // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_i & prefdec(SIMDVecMask<16> const & mask) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(1);
+            __m256i t1 = _mm256_sub_epi16(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // MULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_mullo_epi16(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (SIMDVec_i const & b) const {
+            return mul(b);
+        }
+        // MMULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_mullo_epi16(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // MULS
+        UME_FORCE_INLINE SIMDVec_i mul(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_mullo_epi16(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (int16_t b) const {
+            return mul(b);
+        }
+        // MMULS
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<16> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_mullo_epi16(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // MULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVec_i const & b) {
+            mVec = _mm256_mullo_epi16(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (SIMDVec_i const & b) {
+            return mula(b);
+        }
+        // MMULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_mullo_epi16(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // MULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(int16_t b) {
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec = _mm256_mullo_epi16(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (int16_t b) {
+            return mula(b);
+        }
+        // MMULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<16> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_mullo_epi16(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // DIVV
+        // MDIVV
+        // DIVS
+        // MDIVS
+        // DIVVA
+        // MDIVVA
+        // DIVSA
+        // MDIVSA
+        // RCP
+        // MRCP
+        // RCPS
+        // MRCPS
+        // RCPA
+        // MRCPA
+        // RCPSA
+        // MRCPSA
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<16> cmpeq(SIMDVec_i const & b) const {
+            __m256i m0 = _mm256_cmpeq_epi16(mVec, b.mVec);
+            return SIMDVecMask<16>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator== (SIMDVec_i const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<16> cmpeq(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i m0 = _mm256_cmpeq_epi16(mVec, t0);
+            return SIMDVecMask<16>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator== (int16_t b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<16> cmpne(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_cmpeq_epi16(mVec, b.mVec);
+            __m256i m0 = _mm256_xor_si256(t0, _mm256_set1_epi32(0xFFFFFFFF));
+            return SIMDVecMask<16>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator!= (SIMDVec_i const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<16> cmpne(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_cmpeq_epi16(mVec, t0);
+            __m256i m0 = _mm256_xor_si256(t1, _mm256_set1_epi32(0xFFFFFFFF));
+            return SIMDVecMask<16>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator!= (int16_t b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<16> cmpgt(SIMDVec_i const & b) const {
+            __m256i m0 = _mm256_cmpgt_epi16(mVec, b.mVec);
+            return SIMDVecMask<16>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator> (SIMDVec_i const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<16> cmpgt(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i m0 = _mm256_cmpgt_epi16(mVec, t0);
+            return SIMDVecMask<16>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator> (int16_t b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<16> cmplt(SIMDVec_i const & b) const {
+            __m256i m0 = _mm256_cmpgt_epi16(b.mVec, mVec);
+            return SIMDVecMask<16>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator< (SIMDVec_i const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<16> cmplt(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i m0 = _mm256_cmpgt_epi16(t0, mVec);
+            return SIMDVecMask<16>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator< (int16_t b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<16> cmpge(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_max_epi16(mVec, b.mVec);
+            __m256i m0 = _mm256_cmpeq_epi16(mVec, t0);
+            return SIMDVecMask<16>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator>= (SIMDVec_i const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<16> cmpge(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_max_epi16(mVec, t0);
+            __m256i m0 = _mm256_cmpeq_epi16(mVec, t1);
+            return SIMDVecMask<16>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator>= (int16_t b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<16> cmple(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_min_epi16(mVec, b.mVec);
+            __m256i m0 = _mm256_cmpeq_epi16(mVec, t0);
+            return SIMDVecMask<16>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator<= (SIMDVec_i const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<16> cmple(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_min_epi16(mVec, t0);
+            __m256i m0 = _mm256_cmpeq_epi16(mVec, t1);
+            return SIMDVecMask<16>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator<= (int16_t b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_i const & b) const {
+            __m256i m0 = _mm256_cmpeq_epi16(mVec, b.mVec);
+            uint32_t t0 = uint32_t(_mm256_movemask_epi8(m0));
+            return t0 == 0xFFFFFFFF;
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i m0 = _mm256_cmpeq_epi16(mVec, t0);
+            uint32_t t1 = uint32_t(_mm256_movemask_epi8(m0));
+            return t1 == 0xFFFFFFFF;
+        }
+        // UNIQUE
+        // HADD
+        UME_FORCE_INLINE int16_t hadd() const {
+            __m128i t0 = _mm_add_epi16(_mm256_extracti128_si256(mVec, 0), _mm256_extracti128_si256(mVec, 1));
+            __m128i t1 = _mm_add_epi16(t0, _mm_srli_si128(t0, 8));
+            __m128i t2 = _mm_add_epi16(t1, _mm_srli_si128(t1, 4));
+            __m128i t3 = _mm_add_epi16(t2, _mm_srli_si128(t2, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t3, 0));
+            return retval;
+        }
+        // HADDS
+        UME_FORCE_INLINE int16_t hadd(int16_t b) const {
+            __m128i t0 = _mm_add_epi16(_mm256_extracti128_si256(mVec, 0), _mm256_extracti128_si256(mVec, 1));
+            __m128i t1 = _mm_add_epi16(t0, _mm_srli_si128(t0, 8));
+            __m128i t2 = _mm_add_epi16(t1, _mm_srli_si128(t1, 4));
+            __m128i t3 = _mm_add_epi16(t2, _mm_srli_si128(t2, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t3, 0));
+            return int16_t(retval + b);
+        }
+        // MHADD
+        UME_FORCE_INLINE int16_t hadd(SIMDVecMask<16> const & mask) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_add_epi16(_mm256_extracti128_si256(t1, 0), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_add_epi16(t2, _mm_srli_si128(t2, 8));
+            __m128i t4 = _mm_add_epi16(t3, _mm_srli_si128(t3, 4));
+            __m128i t5 = _mm_add_epi16(t4, _mm_srli_si128(t4, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t5, 0));
+            return retval;
+        }
+        // MHADDS
+        UME_FORCE_INLINE int16_t hadd(SIMDVecMask<16> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_add_epi16(_mm256_extracti128_si256(t1, 0), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_add_epi16(t2, _mm_srli_si128(t2, 8));
+            __m128i t4 = _mm_add_epi16(t3, _mm_srli_si128(t3, 4));
+            __m128i t5 = _mm_add_epi16(t4, _mm_srli_si128(t4, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t5, 0));
+            return int16_t(retval + b);
+        }
+        // HMUL
+        // MHMUL
+        // HMULS
+        // MHMULS
+
+        // FMULADDV
+        UME_FORCE_INLINE SIMDVec_i fmuladd(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i t0 = _mm256_mullo_epi16(mVec, b.mVec);
+            __m256i t1 = _mm256_add_epi16(t0, c.mVec);
+            return SIMDVec_i(t1);
+        }
+        // MFMULADDV
+        UME_FORCE_INLINE SIMDVec_i fmuladd(SIMDVecMask<16> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_mullo_epi16(mVec, b.mVec);
+            __m256i t1 = _mm256_add_epi16(t0, c.mVec);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // FMULSUBV
+        UME_FORCE_INLINE SIMDVec_i fmulsub(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i t0 = _mm256_mullo_epi16(mVec, b.mVec);
+            __m256i t1 = _mm256_sub_epi16(t0, c.mVec);
+            return SIMDVec_i(t1);
+        }
+        // MFMULSUBV
+        UME_FORCE_INLINE SIMDVec_i fmulsub(SIMDVecMask<16> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_mullo_epi16(mVec, b.mVec);
+            __m256i t1 = _mm256_sub_epi16(t0, c.mVec);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // FADDMULV
+        UME_FORCE_INLINE SIMDVec_i faddmul(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i t0 = _mm256_add_epi16(mVec, b.mVec);
+            __m256i t1 = _mm256_mullo_epi16(t0, c.mVec);
+            return SIMDVec_i(t1);
+        }
+        // MFADDMULV
+        UME_FORCE_INLINE SIMDVec_i faddmul(SIMDVecMask<16> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_add_epi16(mVec, b.mVec);
+            __m256i t1 = _mm256_mullo_epi16(t0, c.mVec);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // FSUBMULV
+        UME_FORCE_INLINE SIMDVec_i fsubmul(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i t0 = _mm256_sub_epi16(mVec, b.mVec);
+            __m256i t1 = _mm256_mullo_epi16(t0, c.mVec);
+            return SIMDVec_i(t1);
+        }
+        // MFSUBMULV
+        UME_FORCE_INLINE SIMDVec_i fsubmul(SIMDVecMask<16> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_sub_epi16(mVec, b.mVec);
+            __m256i t1 = _mm256_mullo_epi16(t0, c.mVec);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+
+        // MAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_max_epi16(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MMAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_max_epi16(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // MAXS
+        UME_FORCE_INLINE SIMDVec_i max(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_max_epi16(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MMAXS
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<16> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_max_epi16(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // MAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVec_i const & b) {
+            mVec = _mm256_max_epi16(mVec, b.mVec);
+            return *this;
+        }
+        // MMAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_max_epi16(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // MAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(int16_t b) {
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec = _mm256_max_epi16(mVec, t0);
+            return *this;
+        }
+        // MMAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<16> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_max_epi16(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // MINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_min_epi16(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MMINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_min_epi16(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // MINS
+        UME_FORCE_INLINE SIMDVec_i min(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_min_epi16(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MMINS
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<16> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_min_epi16(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // MINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVec_i const & b) {
+            mVec = _mm256_min_epi16(mVec, b.mVec);
+            return *this;
+        }
+        // MMINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_min_epi16(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // MINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(int16_t b) {
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec = _mm256_min_epi16(mVec, t0);
+            return *this;
+        }
+        // MMINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<16> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_min_epi16(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // HMAX
+        UME_FORCE_INLINE int16_t hmax() const {
+            __m128i t0 = _mm_max_epi16(_mm256_extracti128_si256(mVec, 0), _mm256_extracti128_si256(mVec, 1));
+            __m128i t1 = _mm_max_epi16(t0, _mm_srli_si128(t0, 8));
+            __m128i t2 = _mm_max_epi16(t1, _mm_srli_si128(t1, 4));
+            __m128i t3 = _mm_max_epi16(t2, _mm_srli_si128(t2, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t3, 0));
+            return retval;
+        }
+        // MHMAX
+        UME_FORCE_INLINE int16_t hmax(SIMDVecMask<16> const & mask) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16((short)0x8000);
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_max_epi16(_mm256_extracti128_si256(t1, 0), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_max_epi16(t2, _mm_srli_si128(t2, 8));
+            __m128i t4 = _mm_max_epi16(t3, _mm_srli_si128(t3, 4));
+            __m128i t5 = _mm_max_epi16(t4, _mm_srli_si128(t4, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t5, 0));
+            return retval;
+        }
+        // IMAX
+        // MIMAX
+        // HMIN
+        UME_FORCE_INLINE int16_t hmin() const {
+            __m128i t0 = _mm_min_epi16(_mm256_extracti128_si256(mVec, 0), _mm256_extracti128_si256(mVec, 1));
+            __m128i t1 = _mm_min_epi16(t0, _mm_srli_si128(t0, 8));
+            __m128i t2 = _mm_min_epi16(t1, _mm_srli_si128(t1, 4));
+            __m128i t3 = _mm_min_epi16(t2, _mm_srli_si128(t2, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t3, 0));
+            return retval;
+        }
+        // MHMIN
+        UME_FORCE_INLINE int16_t hmin(SIMDVecMask<16> const & mask) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(0x7FFF);
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_min_epi16(_mm256_extracti128_si256(t1, 0), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_min_epi16(t2, _mm_srli_si128(t2, 8));
+            __m128i t4 = _mm_min_epi16(t3, _mm_srli_si128(t3, 4));
+            __m128i t5 = _mm_min_epi16(t4, _mm_srli_si128(t4, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t5, 0));
+            return retval;
+        }
+        // IMIN
+        // MIMIN
+
+        // BANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_and_si256(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator& (SIMDVec_i const & b) const {
+            return band(b);
+        }
+        // MBANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_and_si256(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // BANDS
+        UME_FORCE_INLINE SIMDVec_i band(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_and_si256(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator& (int16_t b) const {
+            return band(b);
+        }
+        // MBANDS
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<16> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_and_si256(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // BANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVec_i const & b) {
+            mVec = _mm256_and_si256(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (SIMDVec_i const & b) {
+            return banda(b);
+        }
+        // MBANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_and_si256(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // BANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(int16_t b) {
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec = _mm256_and_si256(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (int16_t b) {
+            return banda(b);
+        }
+        // MBANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<16> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_and_si256(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // BORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_or_si256(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (SIMDVec_i const & b) const {
+            return bor(b);
+        }
+        // MBORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_or_si256(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // BORS
+        UME_FORCE_INLINE SIMDVec_i bor(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_or_si256(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (int16_t b) const {
+            return bor(b);
+        }
+        // MBORS
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<16> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_or_si256(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // BORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVec_i const & b) {
+            mVec = _mm256_or_si256(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (SIMDVec_i const & b) {
+            return bora(b);
+        }
+        // MBORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_or_si256(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // BORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(int16_t b) {
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec = _mm256_or_si256(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (int16_t b) {
+            return bora(b);
+        }
+        // MBORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<16> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_or_si256(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // BXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_xor_si256(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (SIMDVec_i const & b) const {
+            return bxor(b);
+        }
+        // MBXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_xor_si256(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // BXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_xor_si256(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (int16_t b) const {
+            return bxor(b);
+        }
+        // MBXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<16> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_xor_si256(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // BXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVec_i const & b) {
+            mVec = _mm256_xor_si256(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (SIMDVec_i const & b) {
+            return bxora(b);
+        }
+        // MBXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_xor_si256(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // BXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(int16_t b) {
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec = _mm256_xor_si256(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (int16_t b) {
+            return bxora(b);
+        }
+        // MBXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<16> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_xor_si256(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // BNOT
+        UME_FORCE_INLINE SIMDVec_i bnot() const {
+            __m256i t0 = _mm256_set1_epi32(0xFFFFFFFF);
+            __m256i t1 = _mm256_xor_si256(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator~ () const {
+            return bnot();
+        }
+        // MBNOT
+        UME_FORCE_INLINE SIMDVec_i bnot(SIMDVecMask<16> const & mask) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi32(0xFFFFFFFF);
+            __m256i t1 = _mm256_xor_si256(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // BNOTA
+        UME_FORCE_INLINE SIMDVec_i & bnota() {
+            __m256i t0 = _mm256_set1_epi32(0xFFFFFFFF);
+            mVec = _mm256_xor_si256(mVec, t0);
+            return *this;
+        }
+        // MBNOTA
+        UME_FORCE_INLINE SIMDVec_i & bnota(SIMDVecMask<16> const & mask) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi32(0xFFFFFFFF);
+            __m256i t1 = _mm256_xor_si256(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // HBAND
+        UME_FORCE_INLINE int16_t hband() const {
+            __m128i t0 = _mm_and_si128(_mm256_extracti128_si256(mVec, 0), _mm256_extracti128_si256(mVec, 1));
+            __m128i t1 = _mm_and_si128(t0, _mm_srli_si128(t0, 8));
+            __m128i t2 = _mm_and_si128(t1, _mm_srli_si128(t1, 4));
+            __m128i t3 = _mm_and_si128(t2, _mm_srli_si128(t2, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t3, 0));
+            return retval;
+        }
+        // HBANDS
+        UME_FORCE_INLINE int16_t hband(int16_t b) const {
+            __m128i t0 = _mm_and_si128(_mm256_extracti128_si256(mVec, 0), _mm256_extracti128_si256(mVec, 1));
+            __m128i t1 = _mm_and_si128(t0, _mm_srli_si128(t0, 8));
+            __m128i t2 = _mm_and_si128(t1, _mm_srli_si128(t1, 4));
+            __m128i t3 = _mm_and_si128(t2, _mm_srli_si128(t2, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t3, 0));
+            return int16_t(retval & b);
+        }
+        // MHBAND
+        UME_FORCE_INLINE int16_t hband(SIMDVecMask<16> const & mask) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi32(0xFFFFFFFF);
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_and_si128(_mm256_extracti128_si256(t1, 0), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_and_si128(t2, _mm_srli_si128(t2, 8));
+            __m128i t4 = _mm_and_si128(t3, _mm_srli_si128(t3, 4));
+            __m128i t5 = _mm_and_si128(t4, _mm_srli_si128(t4, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t5, 0));
+            return retval;
+        }
+        // MHBANDS
+        UME_FORCE_INLINE int16_t hband(SIMDVecMask<16> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_set1_epi32(0xFFFFFFFF);
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_and_si128(_mm256_extracti128_si256(t1, 0), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_and_si128(t2, _mm_srli_si128(t2, 8));
+            __m128i t4 = _mm_and_si128(t3, _mm_srli_si128(t3, 4));
+            __m128i t5 = _mm_and_si128(t4, _mm_srli_si128(t4, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t5, 0));
+            return int16_t(retval & b);
+        }
+        // HBOR
+        UME_FORCE_INLINE int16_t hbor() const {
+            __m128i t0 = _mm_or_si128(_mm256_extracti128_si256(mVec, 0), _mm256_extracti128_si256(mVec, 1));
+            __m128i t1 = _mm_or_si128(t0, _mm_srli_si128(t0, 8));
+            __m128i t2 = _mm_or_si128(t1, _mm_srli_si128(t1, 4));
+            __m128i t3 = _mm_or_si128(t2, _mm_srli_si128(t2, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t3, 0));
+            return retval;
+        }
+        // HBORS
+        UME_FORCE_INLINE int16_t hbor(int16_t b) const {
+            __m128i t0 = _mm_or_si128(_mm256_extracti128_si256(mVec, 0), _mm256_extracti128_si256(mVec, 1));
+            __m128i t1 = _mm_or_si128(t0, _mm_srli_si128(t0, 8));
+            __m128i t2 = _mm_or_si128(t1, _mm_srli_si128(t1, 4));
+            __m128i t3 = _mm_or_si128(t2, _mm_srli_si128(t2, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t3, 0));
+            return int16_t(retval | b);
+        }
+        // MHBOR
+        UME_FORCE_INLINE int16_t hbor(SIMDVecMask<16> const & mask) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_or_si128(_mm256_extracti128_si256(t1, 0), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_or_si128(t2, _mm_srli_si128(t2, 8));
+            __m128i t4 = _mm_or_si128(t3, _mm_srli_si128(t3, 4));
+            __m128i t5 = _mm_or_si128(t4, _mm_srli_si128(t4, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t5, 0));
+            return retval;
+        }
+        // MHBORS
+        UME_FORCE_INLINE int16_t hbor(SIMDVecMask<16> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_or_si128(_mm256_extracti128_si256(t1, 0), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_or_si128(t2, _mm_srli_si128(t2, 8));
+            __m128i t4 = _mm_or_si128(t3, _mm_srli_si128(t3, 4));
+            __m128i t5 = _mm_or_si128(t4, _mm_srli_si128(t4, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t5, 0));
+            return int16_t(retval | b);
+        }
+        // HBXOR
+        UME_FORCE_INLINE int16_t hbxor() const {
+            __m128i t0 = _mm_xor_si128(_mm256_extracti128_si256(mVec, 0), _mm256_extracti128_si256(mVec, 1));
+            __m128i t1 = _mm_xor_si128(t0, _mm_srli_si128(t0, 8));
+            __m128i t2 = _mm_xor_si128(t1, _mm_srli_si128(t1, 4));
+            __m128i t3 = _mm_xor_si128(t2, _mm_srli_si128(t2, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t3, 0));
+            return retval;
+        }
+        // HBXORS
+        UME_FORCE_INLINE int16_t hbxor(int16_t b) const {
+            __m128i t0 = _mm_xor_si128(_mm256_extracti128_si256(mVec, 0), _mm256_extracti128_si256(mVec, 1));
+            __m128i t1 = _mm_xor_si128(t0, _mm_srli_si128(t0, 8));
+            __m128i t2 = _mm_xor_si128(t1, _mm_srli_si128(t1, 4));
+            __m128i t3 = _mm_xor_si128(t2, _mm_srli_si128(t2, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t3, 0));
+            return int16_t(retval ^ b);
+        }
+        // MHBXOR
+        UME_FORCE_INLINE int16_t hbxor(SIMDVecMask<16> const & mask) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_xor_si128(_mm256_extracti128_si256(t1, 0), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_xor_si128(t2, _mm_srli_si128(t2, 8));
+            __m128i t4 = _mm_xor_si128(t3, _mm_srli_si128(t3, 4));
+            __m128i t5 = _mm_xor_si128(t4, _mm_srli_si128(t4, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t5, 0));
+            return retval;
+        }
+        // MHBXORS
+        UME_FORCE_INLINE int16_t hbxor(SIMDVecMask<16> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_xor_si128(_mm256_extracti128_si256(t1, 0), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_xor_si128(t2, _mm_srli_si128(t2, 8));
+            __m128i t4 = _mm_xor_si128(t3, _mm_srli_si128(t3, 4));
+            __m128i t5 = _mm_xor_si128(t4, _mm_srli_si128(t4, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t5, 0));
+            return int16_t(retval ^ b);
+        }
+
+        // GATHERU
+        // MGATHERU
+        // GATHERS
+        // MGATHERS
+        // GATHERV
+        // MGATHERV
+        // SCATTERU
+        // MSCATTERU
+        // SCATTERS
+        // MSCATTERS
+        // SCATTERV
+        // MSCATTERV
+
+        // LSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVec_u<uint16_t, 16> const & b) const {
+            __m256i t0 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec, 0));
+            __m256i t1 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec, 0));
+            __m256i t2 = _mm256_sllv_epi32(t0, t1);
+            __m256i t3 = _mm256_and_si256(t2, _mm256_set1_epi32(0xFFFF));
+            __m256i t4 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec, 1));
+            __m256i t5 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec, 1));
+            __m256i t6 = _mm256_sllv_epi32(t4, t5);
+            __m256i t7 = _mm256_and_si256(t6, _mm256_set1_epi32(0xFFFF));
+            __m256i t8 = _mm256_packus_epi32(t3, t7);
+            __m256i t9 = _mm256_permute4x64_epi64(t8, 0xD8);
+            return SIMDVec_i(t9);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (SIMDVec_u<uint16_t, 16> const & b) const {
+            return lsh(b);
+        }
+        // MLSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<16> const & mask, SIMDVec_u<uint16_t, 16> const & b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec, 0));
+            __m256i t1 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec, 0));
+            __m256i t2 = _mm256_sllv_epi32(t0, t1);
+            __m256i t3 = _mm256_and_si256(t2, _mm256_set1_epi32(0xFFFF));
+            __m256i t4 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec, 1));
+            __m256i t5 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec, 1));
+            __m256i t6 = _mm256_sllv_epi32(t4, t5);
+            __m256i t7 = _mm256_and_si256(t6, _mm256_set1_epi32(0xFFFF));
+            __m256i t8 = _mm256_packus_epi32(t3, t7);
+            __m256i t9 = _mm256_permute4x64_epi64(t8, 0xD8);
+            __m256i t10 = _mm256_blendv_epi8(mVec, t9, m0);
+            return SIMDVec_i(t10);
+        }
+        // LSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(uint16_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            __m256i t1 = _mm256_sll_epi16(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (uint16_t b) const {
+            return lsh(b);
+        }
+        // MLSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<16> const & mask, uint16_t b) const {
+            __m256i m0 = mask.toEpi16();
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            __m256i t1 = _mm256_sll_epi16(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // LSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVec_u<uint16_t, 16> const & b) {
+            __m256i t0 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec, 0));
+            __m256i t1 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec, 0));
+            __m256i t2 = _mm256_sllv_epi32(t0, t1);
+            __m256i t3 = _mm256_and_si256(t2, _mm256_set1_epi32(0xFFFF));
+            __m256i t4 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec, 1));
+            __m256i t5 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec, 1));
+            __m256i t6 = _mm256_sllv_epi32(t4, t5);
+            __m256i t7 = _mm256_and_si256(t6, _mm256_set1_epi32(0xFFFF));
+            __m256i t8 = _mm256_packus_epi32(t3, t7);
+            mVec = _mm256_permute4x64_epi64(t8, 0xD8);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (SIMDVec_u<uint16_t, 16> const & b) {
+            return lsha(b);
+        }
+        // MLSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<16> const & mask, SIMDVec_u<uint16_t, 16> const & b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec, 0));
+            __m256i t1 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec, 0));
+            __m256i t2 = _mm256_sllv_epi32(t0, t1);
+            __m256i t3 = _mm256_and_si256(t2, _mm256_set1_epi32(0xFFFF));
+            __m256i t4 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec, 1));
+            __m256i t5 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec, 1));
+            __m256i t6 = _mm256_sllv_epi32(t4, t5);
+            __m256i t7 = _mm256_and_si256(t6, _mm256_set1_epi32(0xFFFF));
+            __m256i t8 = _mm256_packus_epi32(t3, t7);
+            __m256i t9 = _mm256_permute4x64_epi64(t8, 0xD8);
+            mVec = _mm256_blendv_epi8(mVec, t9, m0);
+            return *this;
+        }
+        // LSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(uint16_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            mVec = _mm256_sll_epi16(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (uint16_t b) {
+            return lsha(b);
+        }
+        // MLSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<16> const & mask, uint16_t b) {
+            __m256i m0 = mask.toEpi16();
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            __m256i t1 = _mm256_sll_epi16(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // RSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVec_u<uint16_t, 16> const & b) const {
+            __m256i t0 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec, 0));
+            __m256i t1 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec, 0));
+            __m256i t2 = _mm256_srav_epi32(t0, t1);
+            __m256i t3 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec, 1));
+            __m256i t4 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec, 1));
+            __m256i t5 = _mm256_srav_epi32(t3, t4);
+            __m256i t6 = _mm256_packs_epi32(t2, t5);
+            __m256i t7 = _mm256_permute4x64_epi64(t6, 0xD8);
+            return SIMDVec_i(t7);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (SIMDVec_u<uint16_t, 16> const & b) const {
+            return rsh(b);
+        }
+        // MRSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<16> const & mask, SIMDVec_u<uint16_t, 16> const & b) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec, 0));
+            __m256i t1 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec, 0));
+            __m256i t2 = _mm256_srav_epi32(t0, t1);
+            __m256i t3 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec, 1));
+            __m256i t4 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec, 1));
+            __m256i t5 = _mm256_srav_epi32(t3, t4);
+            __m256i t6 = _mm256_packs_epi32(t2, t5);
+            __m256i t7 = _mm256_permute4x64_epi64(t6, 0xD8);
+            __m256i t8 = _mm256_blendv_epi8(mVec, t7, m0);
+            return SIMDVec_i(t8);
+        }
+        // RSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(uint16_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            __m256i t1 = _mm256_sra_epi16(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (uint16_t b) const {
+            return rsh(b);
+        }
+        // MRSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<16> const & mask, uint16_t b) const {
+            __m256i m0 = mask.toEpi16();
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            __m256i t1 = _mm256_sra_epi16(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // RSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVec_u<uint16_t, 16> const & b) {
+            __m256i t0 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec, 0));
+            __m256i t1 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec, 0));
+            __m256i t2 = _mm256_srav_epi32(t0, t1);
+            __m256i t3 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec, 1));
+            __m256i t4 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec, 1));
+            __m256i t5 = _mm256_srav_epi32(t3, t4);
+            __m256i t6 = _mm256_packs_epi32(t2, t5);
+            mVec = _mm256_permute4x64_epi64(t6, 0xD8);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (SIMDVec_u<uint16_t, 16> const & b) {
+            return rsha(b);
+        }
+        // MRSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<16> const & mask, SIMDVec_u<uint16_t, 16> const & b) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec, 0));
+            __m256i t1 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec, 0));
+            __m256i t2 = _mm256_srav_epi32(t0, t1);
+            __m256i t3 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec, 1));
+            __m256i t4 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec, 1));
+            __m256i t5 = _mm256_srav_epi32(t3, t4);
+            __m256i t6 = _mm256_packs_epi32(t2, t5);
+            __m256i t7 = _mm256_permute4x64_epi64(t6, 0xD8);
+            mVec = _mm256_blendv_epi8(mVec, t7, m0);
+            return *this;
+        }
+        // RSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(uint16_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            mVec = _mm256_sra_epi16(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (uint16_t b) {
+            return rsha(b);
+        }
+        // MRSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<16> const & mask, uint16_t b) {
+            __m256i m0 = mask.toEpi16();
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            __m256i t1 = _mm256_sra_epi16(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // ROLV
+        // MROLV
+        // ROLS
+        // MROLS
+        // ROLVA
+        // MROLVA
+        // ROLSA
+        // MROLSA
+        // RORV
+        // MRORV
+        // RORS
+        // MRORS
+        // RORVA
+        // MRORVA
+        // RORSA
+        // MRORSA
+
+        // NEG
+        UME_FORCE_INLINE SIMDVec_i neg() const {
+            __m256i t0 = _mm256_sub_epi16(_mm256_setzero_si256(), mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- () const {
+            return neg();
+        }
+        // MNEG
+        UME_FORCE_INLINE SIMDVec_i neg(SIMDVecMask<16> const & mask) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_sub_epi16(_mm256_setzero_si256(), mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // NEGA
+        UME_FORCE_INLINE SIMDVec_i & nega() {
+            mVec = _mm256_sub_epi16(_mm256_setzero_si256(), mVec);
+            return *this;
+        }
+        // MNEGA
+        UME_FORCE_INLINE SIMDVec_i & nega(SIMDVecMask<16> const & mask) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_sub_epi16(_mm256_setzero_si256(), mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // ABS
+        UME_FORCE_INLINE SIMDVec_i abs() const {
+            __m256i t0 = _mm256_abs_epi16(mVec);
+            return SIMDVec_i(t0);
+        }
+        // MABS
+        UME_FORCE_INLINE SIMDVec_i abs(SIMDVecMask<16> const & mask) const {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_abs_epi16(mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // ABSA
+        UME_FORCE_INLINE SIMDVec_i & absa() {
+            mVec = _mm256_abs_epi16(mVec);
+            return *this;
+        }
+        // MABSA
+        UME_FORCE_INLINE SIMDVec_i & absa(SIMDVecMask<16> const & mask) {
+            __m256i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_abs_epi16(mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+
+        // PACK
+        UME_FORCE_INLINE SIMDVec_i & pack(SIMDVec_i<int16_t, 8> const & a, SIMDVec_i<int16_t, 8> const & b) {
+            mVec = _mm256_inserti128_si256(mVec, a.mVec, 0);
+            mVec = _mm256_inserti128_si256(mVec, b.mVec, 1);
+            return *this;
+        }
+        // PACKLO
+        UME_FORCE_INLINE SIMDVec_i & packlo(SIMDVec_i<int16_t, 8> const & a) {
+            mVec = _mm256_inserti128_si256(mVec, a.mVec, 0);
+            return *this;
+        }
+        // PACKHI
+        UME_FORCE_INLINE SIMDVec_i & packhi(SIMDVec_i<int16_t, 8> const & b) {
+            mVec = _mm256_inserti128_si256(mVec, b.mVec, 1);
+            return *this;
+        }
+        // UNPACK
+        UME_FORCE_INLINE void unpack(SIMDVec_i<int16_t, 8> & a, SIMDVec_i<int16_t, 8> & b) const {
+            a.mVec = _mm256_extracti128_si256(mVec, 0);
+            b.mVec = _mm256_extracti128_si256(mVec, 1);
+        }
+        // UNPACKLO
+        UME_FORCE_INLINE SIMDVec_i<int16_t, 8> unpacklo() const {
+            __m128i t0 = _mm256_extracti128_si256(mVec, 0);
+            return SIMDVec_i<int16_t, 8>(t0);
+        }
+        // UNPACKHI
+        UME_FORCE_INLINE SIMDVec_i<int16_t, 8> unpackhi() const {
+            __m128i t0 = _mm256_extracti128_si256(mVec, 1);
+            return SIMDVec_i<int16_t, 8>(t0);
+        }
+
+        // PROMOTE
+        UME_FORCE_INLINE operator SIMDVec_i<int32_t, 16>() const;
+        // DEGRADE
+        UME_FORCE_INLINE operator SIMDVec_i<int8_t, 16>() const;
+
+        // ITOU
+        UME_FORCE_INLINE operator SIMDVec_u<uint16_t, 16>() const;
+        // ITOF
+        // -
+
+    };
+
+}
+}
+
+#endif
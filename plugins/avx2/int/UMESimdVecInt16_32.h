@@ -0,0 +1,2155 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_INT16_32_H_
+#define UME_SIMD_VEC_INT16_32_H_
+
+#include <type_traits>
+#include <immintrin.h>
+
+#include "../../../UMESimdInterface.h"
+
+namespace UME {
+namespace SIMD {
+
+    template<>
+    class SIMDVec_i<int16_t, 32> :
+        public SIMDVecSignedInterface<
+            SIMDVec_i<int16_t, 32>,
+            SIMDVec_u<uint16_t, 32>,
+            int16_t,
+            32,
+            uint16_t,
+            SIMDVecMask<32>,
+            SIMDSwizzle<32 >> ,
+        public SIMDVecPackableInterface<
+            SIMDVec_i<int16_t, 32>,
+            SIMDVec_i<int16_t, 16 >>
+    {
+    public:
+        // Conversion operators require access to private members.
+        friend class SIMDVec_u<uint16_t, 32>;
+        friend class SIMDVec_i<int8_t, 32>;
+    private:
+        __m256i mVec[2];
+
+        UME_FORCE_INLINE explicit SIMDVec_i(__m256i const & x0, __m256i const & x1) { mVec[0] = x0; mVec[1] = x1; }
+    public:
+
+        constexpr static uint32_t length() { return 32; }
+        constexpr static uint32_t alignment() { return 32; }
+
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_i() {}
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_i(int16_t i) {
+            mVec[0] = _mm256_set1_epi16(i);
+            mVec[1] = _mm256_set1_epi16(i);
+        }
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_i(
+            T i, 
+            typename std::enable_if< std::is_fundamental<T>::value && 
+                                    !std::is_same<T, int16_t>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_i(static_cast<int16_t>(i)) {}
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVec_i(int16_t const *p) { load(p); }
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVec_i(int16_t i0, int16_t i1, int16_t i2, int16_t i3,
+                                   int16_t i4, int16_t i5, int16_t i6, int16_t i7,
+                                   int16_t i8, int16_t i9, int16_t i10, int16_t i11,
+                                   int16_t i12, int16_t i13, int16_t i14, int16_t i15,
+                                   int16_t i16, int16_t i17, int16_t i18, int16_t i19,
+                                   int16_t i20, int16_t i21, int16_t i22, int16_t i23,
+                                   int16_t i24, int16_t i25, int16_t i26, int16_t i27,
+                                   int16_t i28, int16_t i29, int16_t i30, int16_t i31)
+        {
+            mVec[0] = _mm256_setr_epi16(i0, i1, i2, i3, i4, i5, i6, i7,
+                                        i8, i9, i10, i11, i12, i13, i14, i15);
+            mVec[1] = _mm256_setr_epi16(i16, i17, i18, i19, i20, i21, i22, i23,
+                                        i24, i25, i26, i27, i28, i29, i30, i31);
+        }
+        // EXTRACT
+        UME_FORCE_INLINE int16_t extract(uint32_t index) const {
+            alignas(32) int16_t raw[32];
+            _mm256_store_si256((__m256i*)raw, mVec[0]);
+            _mm256_store_si256((__m256i*)(raw + 16), mVec[1]);
+            return raw[index];
+        }
+        UME_FORCE_INLINE int16_t operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_i & insert(uint32_t index, int16_t value) {
+            alignas(32) int16_t raw[32];
+            _mm256_store_si256((__m256i*)raw, mVec[0]);
+            _mm256_store_si256((__m256i*)(raw + 16), mVec[1]);
+            raw[index] = value;
+            mVec[0] = _mm256_load_si256((__m256i*)raw);
+            mVec[1] = _mm256_load_si256((__m256i*)(raw + 16));
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_i, int16_t> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_i, int16_t>(index, static_cast<SIMDVec_i &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_i, int16_t, SIMDVecMask<32>> operator() (SIMDVecMask<32> const & mask) {
+            return IntermediateMask<SIMDVec_i, int16_t, SIMDVecMask<32>>(mask, static_cast<SIMDVec_i &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_i, int16_t, SIMDVecMask<32>> operator[] (SIMDVecMask<32> const & mask) {
+            return IntermediateMask<SIMDVec_i, int16_t, SIMDVecMask<32>>(mask, static_cast<SIMDVec_i &>(*this));
+        }
+#endif
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVec_i const & b) {
+            mVec[0] = b.mVec[0];
+            mVec[1] = b.mVec[1];
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator= (SIMDVec_i const & b) {
+            return assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            mVec[0] = _mm256_blendv_epi8(mVec[0], b.mVec[0], m0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], b.mVec[1], m1);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_i & assign(int16_t b) {
+            mVec[0] = _mm256_set1_epi16(b);
+            mVec[1] = _mm256_set1_epi16(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator= (int16_t b) {
+            return assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVecMask<32> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, m0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t0, m1);
+            return *this;
+        }
+
+        // PREFETCH0
+        // PREFETCH1
+        // PREFETCH2
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_i & load(int16_t const *p) {
+            mVec[0] = _mm256_loadu_si256((const __m256i *)p);
+            mVec[1] = _mm256_loadu_si256((const __m256i *)(p + 16));
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<32> const & mask, int16_t const *p) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_loadu_si256((const __m256i *)p);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t1 = _mm256_loadu_si256((const __m256i *)(p + 16));
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, m1);
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_i & loada(int16_t const *p) {
+            mVec[0] = _mm256_load_si256((const __m256i *)p);
+            mVec[1] = _mm256_load_si256((const __m256i *)(p + 16));
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<32> const & mask, int16_t const *p) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_load_si256((const __m256i *)p);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t1 = _mm256_load_si256((const __m256i *)(p + 16));
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, m1);
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE int16_t* store(int16_t* p) const {
+            _mm256_storeu_si256((__m256i *)p, mVec[0]);
+            _mm256_storeu_si256((__m256i *)(p + 16), mVec[1]);
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE int16_t* store(SIMDVecMask<32> const & mask, int16_t* p) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_loadu_si256((const __m256i *)p);
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec[0], m0);
+            _mm256_storeu_si256((__m256i *)p, t1);
+            __m256i t2 = _mm256_loadu_si256((const __m256i *)(p + 16));
+            __m256i t3 = _mm256_blendv_epi8(t2, mVec[1], m1);
+            _mm256_storeu_si256((__m256i *)(p + 16), t3);
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE int16_t* storea(int16_t* p) const {
+            _mm256_store_si256((__m256i *)p, mVec[0]);
+            _mm256_store_si256((__m256i *)(p + 16), mVec[1]);
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE int16_t* storea(SIMDVecMask<32> const & mask, int16_t* p) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_load_si256((const __m256i *)p);
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec[0], m0);
+            _mm256_store_si256((__m256i *)p, t1);
+            __m256i t2 = _mm256_load_si256((const __m256i *)(p + 16));
+            __m256i t3 = _mm256_blendv_epi8(t2, mVec[1], m1);
+            _mm256_store_si256((__m256i *)(p + 16), t3);
+            return p;
+        }
+
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_blendv_epi8(mVec[0], b.mVec[0], m0);
+            __m256i t1 = _mm256_blendv_epi8(mVec[1], b.mVec[1], m1);
+            return SIMDVec_i(t0, t1);
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<32> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[1], t0, m1);
+            return SIMDVec_i(t1, t2);
+        }
+        // SWIZZLE
+        // SWIZZLEA
+
+        // SORTA
+        // SORTD
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_add_epi16(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_add_epi16(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator+ (SIMDVec_i const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_add_epi16(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t2 = _mm256_add_epi16(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return SIMDVec_i(t1, t3);
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_i add(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_add_epi16(mVec[0], t0);
+            __m256i t2 = _mm256_add_epi16(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator+ (int16_t b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVecMask<32> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_add_epi16(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t3 = _mm256_add_epi16(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, m1);
+            return SIMDVec_i(t2, t4);
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVec_i const & b) {
+            mVec[0] = _mm256_add_epi16(mVec[0], b.mVec[0]);
+            mVec[1] = _mm256_add_epi16(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator+= (SIMDVec_i const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_add_epi16(mVec[0], b.mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t1 = _mm256_add_epi16(mVec[1], b.mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, m1);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_i & adda(int16_t b) {
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec[0] = _mm256_add_epi16(mVec[0], t0);
+            mVec[1] = _mm256_add_epi16(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator+= (int16_t b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVecMask<32> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_add_epi16(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t2 = _mm256_add_epi16(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return *this;
+        }
+        // POSTINC
+        UME_FORCE_INLINE SIMDVec_i postinc() {
+            __m256i t0 = _mm256_set1_epi16(1);
+            __m256i t1 = mVec[0];
+            __m256i t2 = mVec[1];
+            mVec[0] = _mm256_add_epi16(mVec[0], t0);
+            mVec[1] = _mm256_add_epi16(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator++ (int) {
+            return postinc();
+        }
+        // MPOSTINC
+        UME_FORCE_INLINE SIMDVec_i postinc(SIMDVecMask<32> const & mask) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(1);
+            __m256i t1 = mVec[0];
+            __m256i t2 = mVec[1];
+            __m256i t3 = _mm256_add_epi16(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t3, m0);
+            __m256i t4 = _mm256_add_epi16(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t4, m1);
+            return SIMDVec_i(t1, t2);
+        }
+        // PREFINC
+        UME_FORCE_INLINE SIMDVec_i & prefinc() {
+            __m256i t0 = _mm256_set1_epi16(1);
+            mVec[0] = _mm256_add_epi16(mVec[0], t0);
+            mVec[1] = _mm256_add_epi16(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator++ () {
+            return prefinc();
+        }
+        // MPREFINC
+        UME_FORCE_INLINE SIMDVec_i & prefinc(SIMDVecMask<32> const & mask) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(1);
+            __m256i t1 = _mm256_add_epi16(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t2 = _mm256_add_epi16(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return *this;
+        }
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_adds_epi16(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_adds_epi16(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_adds_epi16(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t2 = _mm256_adds_epi16(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return SIMDVec_i(t1, t3);
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_adds_epi16(mVec[0], t0);
+            __m256i t2 = _mm256_adds_epi16(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<32> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_adds_epi16(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t3 = _mm256_adds_epi16(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, m1);
+            return SIMDVec_i(t2, t4);
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec[0] = _mm256_adds_epi16(mVec[0], b.mVec[0]);
+            mVec[1] = _mm256_adds_epi16(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_adds_epi16(mVec[0], b.mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t1 = _mm256_adds_epi16(mVec[1], b.mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, m1);
+            return *this;
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int16_t b) {
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec[0] = _mm256_adds_epi16(mVec[0], t0);
+            mVec[1] = _mm256_adds_epi16(mVec[1], t0);
+            return *this;
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<32> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_adds_epi16(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t2 = _mm256_adds_epi16(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return *this;
+        }
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_sub_epi16(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_sub_epi16(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- (SIMDVec_i const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_sub_epi16(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t2 = _mm256_sub_epi16(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return SIMDVec_i(t1, t3);
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_i sub(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_sub_epi16(mVec[0], t0);
+            __m256i t2 = _mm256_sub_epi16(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- (int16_t b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVecMask<32> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_sub_epi16(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t3 = _mm256_sub_epi16(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, m1);
+            return SIMDVec_i(t2, t4);
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVec_i const & b) {
+            mVec[0] = _mm256_sub_epi16(mVec[0], b.mVec[0]);
+            mVec[1] = _mm256_sub_epi16(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-= (SIMDVec_i const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_sub_epi16(mVec[0], b.mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t1 = _mm256_sub_epi16(mVec[1], b.mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, m1);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_i & suba(int16_t b) {
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec[0] = _mm256_sub_epi16(mVec[0], t0);
+            mVec[1] = _mm256_sub_epi16(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-= (int16_t b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVecMask<32> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_sub_epi16(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t2 = _mm256_sub_epi16(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return *this;
+        }
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_subs_epi16(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_subs_epi16(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_subs_epi16(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t2 = _mm256_subs_epi16(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return SIMDVec_i(t1, t3);
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_subs_epi16(mVec[0], t0);
+            __m256i t2 = _mm256_subs_epi16(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<32> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_subs_epi16(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t3 = _mm256_subs_epi16(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, m1);
+            return SIMDVec_i(t2, t4);
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec[0] = _mm256_subs_epi16(mVec[0], b.mVec[0]);
+            mVec[1] = _mm256_subs_epi16(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_subs_epi16(mVec[0], b.mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t1 = _mm256_subs_epi16(mVec[1], b.mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, m1);
+            return *this;
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int16_t b) {
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec[0] = _mm256_subs_epi16(mVec[0], t0);
+            mVec[1] = _mm256_subs_epi16(mVec[1], t0);
+            return *this;
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<32> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_subs_epi16(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t2 = _mm256_subs_epi16(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return *this;
+        }
+        // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_sub_epi16(b.mVec[0], mVec[0]);
+            __m256i t1 = _mm256_sub_epi16(b.mVec[1], mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_sub_epi16(b.mVec[0], mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(b.mVec[0], t0, m0);
+            __m256i t2 = _mm256_sub_epi16(b.mVec[1], mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(b.mVec[1], t2, m1);
+            return SIMDVec_i(t1, t3);
+        }
+        // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_i subfrom(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_sub_epi16(t0, mVec[0]);
+            __m256i t2 = _mm256_sub_epi16(t0, mVec[1]);
+            return SIMDVec_i(t1, t2);
+        }
+        // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVecMask<32> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_sub_epi16(t0, mVec[0]);
+            __m256i t2 = _mm256_blendv_epi8(t0, t1, m0);
+            __m256i t3 = _mm256_sub_epi16(t0, mVec[1]);
+            __m256i t4 = _mm256_blendv_epi8(t0, t3, m1);
+            return SIMDVec_i(t2, t4);
+        }
+        // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVec_i const & b) {
+            mVec[0] = _mm256_sub_epi16(b.mVec[0], mVec[0]);
+            mVec[1] = _mm256_sub_epi16(b.mVec[1], mVec[1]);
+            return *this;
+        }
+        // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_sub_epi16(b.mVec[0], mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(b.mVec[0], t0, m0);
+            __m256i t1 = _mm256_sub_epi16(b.mVec[1], mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(b.mVec[1], t1, m1);
+            return *this;
+        }
+        // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(int16_t b) {
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec[0] = _mm256_sub_epi16(t0, mVec[0]);
+            mVec[1] = _mm256_sub_epi16(t0, mVec[1]);
+            return *this;
+        }
+        // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVecMask<32> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_sub_epi16(t0, mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(t0, t1, m0);
+            __m256i t2 = _mm256_sub_epi16(t0, mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(t0, t2, m1);
+            return *this;
+        }
+        // POSTDEC
+        UME_FORCE_INLINE SIMDVec_i postdec() {
+            __m256i t0 = _mm256_set1_epi16(1);
+            __m256i t1 = mVec[0];
+            __m256i t2 = mVec[1];
+            mVec[0] = _mm256_sub_epi16(mVec[0], t0);
+            mVec[1] = _mm256_sub_epi16(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator-- (int) {
+            return postdec();
+        }
+        // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_i postdec(SIMDVecMask<32> const & mask) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(1);
+            __m256i t1 = mVec[0];
+            __m256i t2 = mVec[1];
+            __m256i t3 = _mm256_sub_epi16(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t3, m0);
+            __m256i t4 = _mm256_sub_epi16(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t4, m1);
+            return SIMDVec_i(t1, t2);
+        }
+        // PREFDEC
+        UME_FORCE_INLINE SIMDVec_i & prefdec() {
+            __m256i t0 = _mm256_set1_epi16(1);
+            mVec[0] = _mm256_sub_epi16(mVec[0], t0);
+            mVec[1] = _mm256_sub_epi16(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-- () {
+            return prefdec();
+        }
+        // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_i & prefdec(SIMDVecMask<32> const & mask) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(1);
+            __m256i t1 = _mm256_sub_epi16(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t2 = _mm256_sub_epi16(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return *this;
+        }
+        // MULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_mullo_epi16(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_mullo_epi16(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (SIMDVec_i const & b) const {
+            return mul(b);
+        }
+        // MMULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_mullo_epi16(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t2 = _mm256_mullo_epi16(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return SIMDVec_i(t1, t3);
+        }
+        // MULS
+        UME_FORCE_INLINE SIMDVec_i mul(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_mullo_epi16(mVec[0], t0);
+            __m256i t2 = _mm256_mullo_epi16(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (int16_t b) const {
+            return mul(b);
+        }
+        // MMULS
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<32> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_mullo_epi16(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t3 = _mm256_mullo_epi16(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, m1);
+            return SIMDVec_i(t2, t4);
+        }
+        // MULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVec_i const & b) {
+            mVec[0] = _mm256_mullo_epi16(mVec[0], b.mVec[0]);
+            mVec[1] = _mm256_mullo_epi16(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (SIMDVec_i const & b) {
+            return mula(b);
+        }
+        // MMULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_mullo_epi16(mVec[0], b.mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t1 = _mm256_mullo_epi16(mVec[1], b.mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, m1);
+            return *this;
+        }
+        // MULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(int16_t b) {
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec[0] = _mm256_mullo_epi16(mVec[0], t0);
+            mVec[1] = _mm256_mullo_epi16(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (int16_t b) {
+            return mula(b);
+        }
+        // MMULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<32> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_mullo_epi16(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t2 = _mm256_mullo_epi16(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return *this;
+        }
+        // DIVV
+        // MDIVV
+        // DIVS
+        // MDIVS
+        // DIVVA
+        // MDIVVA
+        // DIVSA
+        // MDIVSA
+        // RCP
+        // MRCP
+        // RCPS
+        // MRCPS
+        // RCPA
+        // MRCPA
+        // RCPSA
+        // MRCPSA
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<32> cmpeq(SIMDVec_i const & b) const {
+            __m256i m0 = _mm256_cmpeq_epi16(mVec[0], b.mVec[0]);
+            __m256i m1 = _mm256_cmpeq_epi16(mVec[1], b.mVec[1]);
+            return SIMDVecMask<32>::fromEpi16(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator== (SIMDVec_i const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<32> cmpeq(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i m0 = _mm256_cmpeq_epi16(mVec[0], t0);
+            __m256i m1 = _mm256_cmpeq_epi16(mVec[1], t0);
+            return SIMDVecMask<32>::fromEpi16(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator== (int16_t b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<32> cmpne(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_cmpeq_epi16(mVec[0], b.mVec[0]);
+            __m256i m0 = _mm256_xor_si256(t0, _mm256_set1_epi32(0xFFFFFFFF));
+            __m256i t1 = _mm256_cmpeq_epi16(mVec[1], b.mVec[1]);
+            __m256i m1 = _mm256_xor_si256(t1, _mm256_set1_epi32(0xFFFFFFFF));
+            return SIMDVecMask<32>::fromEpi16(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator!= (SIMDVec_i const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<32> cmpne(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_cmpeq_epi16(mVec[0], t0);
+            __m256i m0 = _mm256_xor_si256(t1, _mm256_set1_epi32(0xFFFFFFFF));
+            __m256i t2 = _mm256_cmpeq_epi16(mVec[1], t0);
+            __m256i m1 = _mm256_xor_si256(t2, _mm256_set1_epi32(0xFFFFFFFF));
+            return SIMDVecMask<32>::fromEpi16(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator!= (int16_t b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<32> cmpgt(SIMDVec_i const & b) const {
+            __m256i m0 = _mm256_cmpgt_epi16(mVec[0], b.mVec[0]);
+            __m256i m1 = _mm256_cmpgt_epi16(mVec[1], b.mVec[1]);
+            return SIMDVecMask<32>::fromEpi16(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator> (SIMDVec_i const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<32> cmpgt(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i m0 = _mm256_cmpgt_epi16(mVec[0], t0);
+            __m256i m1 = _mm256_cmpgt_epi16(mVec[1], t0);
+            return SIMDVecMask<32>::fromEpi16(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator> (int16_t b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<32> cmplt(SIMDVec_i const & b) const {
+            __m256i m0 = _mm256_cmpgt_epi16(b.mVec[0], mVec[0]);
+            __m256i m1 = _mm256_cmpgt_epi16(b.mVec[1], mVec[1]);
+            return SIMDVecMask<32>::fromEpi16(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator< (SIMDVec_i const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<32> cmplt(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i m0 = _mm256_cmpgt_epi16(t0, mVec[0]);
+            __m256i m1 = _mm256_cmpgt_epi16(t0, mVec[1]);
+            return SIMDVecMask<32>::fromEpi16(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator< (int16_t b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<32> cmpge(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_max_epi16(mVec[0], b.mVec[0]);
+            __m256i m0 = _mm256_cmpeq_epi16(mVec[0], t0);
+            __m256i t1 = _mm256_max_epi16(mVec[1], b.mVec[1]);
+            __m256i m1 = _mm256_cmpeq_epi16(mVec[1], t1);
+            return SIMDVecMask<32>::fromEpi16(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator>= (SIMDVec_i const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<32> cmpge(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_max_epi16(mVec[0], t0);
+            __m256i m0 = _mm256_cmpeq_epi16(mVec[0], t1);
+            __m256i t2 = _mm256_max_epi16(mVec[1], t0);
+            __m256i m1 = _mm256_cmpeq_epi16(mVec[1], t2);
+            return SIMDVecMask<32>::fromEpi16(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator>= (int16_t b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<32> cmple(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_min_epi16(mVec[0], b.mVec[0]);
+            __m256i m0 = _mm256_cmpeq_epi16(mVec[0], t0);
+            __m256i t1 = _mm256_min_epi16(mVec[1], b.mVec[1]);
+            __m256i m1 = _mm256_cmpeq_epi16(mVec[1], t1);
+            return SIMDVecMask<32>::fromEpi16(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator<= (SIMDVec_i const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<32> cmple(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_min_epi16(mVec[0], t0);
+            __m256i m0 = _mm256_cmpeq_epi16(mVec[0], t1);
+            __m256i t2 = _mm256_min_epi16(mVec[1], t0);
+            __m256i m1 = _mm256_cmpeq_epi16(mVec[1], t2);
+            return SIMDVecMask<32>::fromEpi16(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<32> operator<= (int16_t b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_i const & b) const {
+            __m256i m0 = _mm256_cmpeq_epi16(mVec[0], b.mVec[0]);
+            __m256i m1 = _mm256_cmpeq_epi16(mVec[1], b.mVec[1]);
+            __m256i m2 = _mm256_and_si256(m0, m1);
+            uint32_t t0 = uint32_t(_mm256_movemask_epi8(m2));
+            return t0 == 0xFFFFFFFF;
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i m0 = _mm256_cmpeq_epi16(mVec[0], t0);
+            __m256i m1 = _mm256_cmpeq_epi16(mVec[1], t0);
+            __m256i m2 = _mm256_and_si256(m0, m1);
+            uint32_t t1 = uint32_t(_mm256_movemask_epi8(m2));
+            return t1 == 0xFFFFFFFF;
+        }
+        // UNIQUE
+        // HADD
+        UME_FORCE_INLINE int16_t hadd() const {
+            __m256i t0 = _mm256_add_epi16(mVec[0], mVec[1]);
+            __m128i t1 = _mm_add_epi16(_mm256_extracti128_si256(t0, 0), _mm256_extracti128_si256(t0, 1));
+            __m128i t2 = _mm_add_epi16(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_add_epi16(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_add_epi16(t3, _mm_srli_si128(t3, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t4, 0));
+            return retval;
+        }
+        // HADDS
+        UME_FORCE_INLINE int16_t hadd(int16_t b) const {
+            __m256i t0 = _mm256_add_epi16(mVec[0], mVec[1]);
+            __m128i t1 = _mm_add_epi16(_mm256_extracti128_si256(t0, 0), _mm256_extracti128_si256(t0, 1));
+            __m128i t2 = _mm_add_epi16(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_add_epi16(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_add_epi16(t3, _mm_srli_si128(t3, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t4, 0));
+            return int16_t(retval + b);
+        }
+        // MHADD
+        UME_FORCE_INLINE int16_t hadd(SIMDVecMask<32> const & mask) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec[0], m0);
+            __m256i t2 = _mm256_blendv_epi8(t0, mVec[1], m1);
+            __m256i t3 = _mm256_add_epi16(t1, t2);
+            __m128i t4 = _mm_add_epi16(_mm256_extracti128_si256(t3, 0), _mm256_extracti128_si256(t3, 1));
+            __m128i t5 = _mm_add_epi16(t4, _mm_srli_si128(t4, 8));
+            __m128i t6 = _mm_add_epi16(t5, _mm_srli_si128(t5, 4));
+            __m128i t7 = _mm_add_epi16(t6, _mm_srli_si128(t6, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t7, 0));
+            return retval;
+        }
+        // MHADDS
+        UME_FORCE_INLINE int16_t hadd(SIMDVecMask<32> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec[0], m0);
+            __m256i t2 = _mm256_blendv_epi8(t0, mVec[1], m1);
+            __m256i t3 = _mm256_add_epi16(t1, t2);
+            __m128i t4 = _mm_add_epi16(_mm256_extracti128_si256(t3, 0), _mm256_extracti128_si256(t3, 1));
+            __m128i t5 = _mm_add_epi16(t4, _mm_srli_si128(t4, 8));
+            __m128i t6 = _mm_add_epi16(t5, _mm_srli_si128(t5, 4));
+            __m128i t7 = _mm_add_epi16(t6, _mm_srli_si128(t6, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t7, 0));
+            return int16_t(retval + b);
+        }
+        // HMUL
+        // MHMUL
+        // HMULS
+        // MHMULS
+
+        // FMULADDV
+        UME_FORCE_INLINE SIMDVec_i fmuladd(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i t0 = _mm256_mullo_epi16(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_add_epi16(t0, c.mVec[0]);
+            __m256i t2 = _mm256_mullo_epi16(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_add_epi16(t2, c.mVec[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // MFMULADDV
+        UME_FORCE_INLINE SIMDVec_i fmuladd(SIMDVecMask<32> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_mullo_epi16(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_add_epi16(t0, c.mVec[0]);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t3 = _mm256_mullo_epi16(mVec[1], b.mVec[1]);
+            __m256i t4 = _mm256_add_epi16(t3, c.mVec[1]);
+            __m256i t5 = _mm256_blendv_epi8(mVec[1], t4, m1);
+            return SIMDVec_i(t2, t5);
+        }
+        // FMULSUBV
+        UME_FORCE_INLINE SIMDVec_i fmulsub(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i t0 = _mm256_mullo_epi16(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_sub_epi16(t0, c.mVec[0]);
+            __m256i t2 = _mm256_mullo_epi16(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_sub_epi16(t2, c.mVec[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // MFMULSUBV
+        UME_FORCE_INLINE SIMDVec_i fmulsub(SIMDVecMask<32> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_mullo_epi16(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_sub_epi16(t0, c.mVec[0]);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t3 = _mm256_mullo_epi16(mVec[1], b.mVec[1]);
+            __m256i t4 = _mm256_sub_epi16(t3, c.mVec[1]);
+            __m256i t5 = _mm256_blendv_epi8(mVec[1], t4, m1);
+            return SIMDVec_i(t2, t5);
+        }
+        // FADDMULV
+        UME_FORCE_INLINE SIMDVec_i faddmul(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i t0 = _mm256_add_epi16(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_mullo_epi16(t0, c.mVec[0]);
+            __m256i t2 = _mm256_add_epi16(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_mullo_epi16(t2, c.mVec[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // MFADDMULV
+        UME_FORCE_INLINE SIMDVec_i faddmul(SIMDVecMask<32> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_add_epi16(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_mullo_epi16(t0, c.mVec[0]);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t3 = _mm256_add_epi16(mVec[1], b.mVec[1]);
+            __m256i t4 = _mm256_mullo_epi16(t3, c.mVec[1]);
+            __m256i t5 = _mm256_blendv_epi8(mVec[1], t4, m1);
+            return SIMDVec_i(t2, t5);
+        }
+        // FSUBMULV
+        UME_FORCE_INLINE SIMDVec_i fsubmul(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i t0 = _mm256_sub_epi16(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_mullo_epi16(t0, c.mVec[0]);
+            __m256i t2 = _mm256_sub_epi16(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_mullo_epi16(t2, c.mVec[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // MFSUBMULV
+        UME_FORCE_INLINE SIMDVec_i fsubmul(SIMDVecMask<32> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_sub_epi16(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_mullo_epi16(t0, c.mVec[0]);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t3 = _mm256_sub_epi16(mVec[1], b.mVec[1]);
+            __m256i t4 = _mm256_mullo_epi16(t3, c.mVec[1]);
+            __m256i t5 = _mm256_blendv_epi8(mVec[1], t4, m1);
+            return SIMDVec_i(t2, t5);
+        }
+
+        // MAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_max_epi16(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_max_epi16(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        // MMAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_max_epi16(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t2 = _mm256_max_epi16(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return SIMDVec_i(t1, t3);
+        }
+        // MAXS
+        UME_FORCE_INLINE SIMDVec_i max(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_max_epi16(mVec[0], t0);
+            __m256i t2 = _mm256_max_epi16(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        // MMAXS
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<32> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_max_epi16(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t3 = _mm256_max_epi16(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, m1);
+            return SIMDVec_i(t2, t4);
+        }
+        // MAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVec_i const & b) {
+            mVec[0] = _mm256_max_epi16(mVec[0], b.mVec[0]);
+            mVec[1] = _mm256_max_epi16(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        // MMAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_max_epi16(mVec[0], b.mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t1 = _mm256_max_epi16(mVec[1], b.mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, m1);
+            return *this;
+        }
+        // MAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(int16_t b) {
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec[0] = _mm256_max_epi16(mVec[0], t0);
+            mVec[1] = _mm256_max_epi16(mVec[1], t0);
+            return *this;
+        }
+        // MMAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<32> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_max_epi16(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t2 = _mm256_max_epi16(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return *this;
+        }
+        // MINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_min_epi16(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_min_epi16(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        // MMINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_min_epi16(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t2 = _mm256_min_epi16(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return SIMDVec_i(t1, t3);
+        }
+        // MINS
+        UME_FORCE_INLINE SIMDVec_i min(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_min_epi16(mVec[0], t0);
+            __m256i t2 = _mm256_min_epi16(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        // MMINS
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<32> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_min_epi16(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t3 = _mm256_min_epi16(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, m1);
+            return SIMDVec_i(t2, t4);
+        }
+        // MINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVec_i const & b) {
+            mVec[0] = _mm256_min_epi16(mVec[0], b.mVec[0]);
+            mVec[1] = _mm256_min_epi16(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        // MMINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_min_epi16(mVec[0], b.mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t1 = _mm256_min_epi16(mVec[1], b.mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, m1);
+            return *this;
+        }
+        // MINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(int16_t b) {
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec[0] = _mm256_min_epi16(mVec[0], t0);
+            mVec[1] = _mm256_min_epi16(mVec[1], t0);
+            return *this;
+        }
+        // MMINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<32> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_min_epi16(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t2 = _mm256_min_epi16(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return *this;
+        }
+        // HMAX
+        UME_FORCE_INLINE int16_t hmax() const {
+            __m256i t0 = _mm256_max_epi16(mVec[0], mVec[1]);
+            __m128i t1 = _mm_max_epi16(_mm256_extracti128_si256(t0, 0), _mm256_extracti128_si256(t0, 1));
+            __m128i t2 = _mm_max_epi16(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_max_epi16(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_max_epi16(t3, _mm_srli_si128(t3, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t4, 0));
+            return retval;
+        }
+        // MHMAX
+        UME_FORCE_INLINE int16_t hmax(SIMDVecMask<32> const & mask) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16((short)0x8000);
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec[0], m0);
+            __m256i t2 = _mm256_blendv_epi8(t0, mVec[1], m1);
+            __m256i t3 = _mm256_max_epi16(t1, t2);
+            __m128i t4 = _mm_max_epi16(_mm256_extracti128_si256(t3, 0), _mm256_extracti128_si256(t3, 1));
+            __m128i t5 = _mm_max_epi16(t4, _mm_srli_si128(t4, 8));
+            __m128i t6 = _mm_max_epi16(t5, _mm_srli_si128(t5, 4));
+            __m128i t7 = _mm_max_epi16(t6, _mm_srli_si128(t6, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t7, 0));
+            return retval;
+        }
+        // IMAX
+        // MIMAX
+        // HMIN
+        UME_FORCE_INLINE int16_t hmin() const {
+            __m256i t0 = _mm256_min_epi16(mVec[0], mVec[1]);
+            __m128i t1 = _mm_min_epi16(_mm256_extracti128_si256(t0, 0), _mm256_extracti128_si256(t0, 1));
+            __m128i t2 = _mm_min_epi16(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_min_epi16(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_min_epi16(t3, _mm_srli_si128(t3, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t4, 0));
+            return retval;
+        }
+        // MHMIN
+        UME_FORCE_INLINE int16_t hmin(SIMDVecMask<32> const & mask) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(0x7FFF);
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec[0], m0);
+            __m256i t2 = _mm256_blendv_epi8(t0, mVec[1], m1);
+            __m256i t3 = _mm256_min_epi16(t1, t2);
+            __m128i t4 = _mm_min_epi16(_mm256_extracti128_si256(t3, 0), _mm256_extracti128_si256(t3, 1));
+            __m128i t5 = _mm_min_epi16(t4, _mm_srli_si128(t4, 8));
+            __m128i t6 = _mm_min_epi16(t5, _mm_srli_si128(t5, 4));
+            __m128i t7 = _mm_min_epi16(t6, _mm_srli_si128(t6, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t7, 0));
+            return retval;
+        }
+        // IMIN
+        // MIMIN
+
+        // BANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_and_si256(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_and_si256(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator& (SIMDVec_i const & b) const {
+            return band(b);
+        }
+        // MBANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_and_si256(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t2 = _mm256_and_si256(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return SIMDVec_i(t1, t3);
+        }
+        // BANDS
+        UME_FORCE_INLINE SIMDVec_i band(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_and_si256(mVec[0], t0);
+            __m256i t2 = _mm256_and_si256(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator& (int16_t b) const {
+            return band(b);
+        }
+        // MBANDS
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<32> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_and_si256(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t3 = _mm256_and_si256(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, m1);
+            return SIMDVec_i(t2, t4);
+        }
+        // BANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVec_i const & b) {
+            mVec[0] = _mm256_and_si256(mVec[0], b.mVec[0]);
+            mVec[1] = _mm256_and_si256(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (SIMDVec_i const & b) {
+            return banda(b);
+        }
+        // MBANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_and_si256(mVec[0], b.mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t1 = _mm256_and_si256(mVec[1], b.mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, m1);
+            return *this;
+        }
+        // BANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(int16_t b) {
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec[0] = _mm256_and_si256(mVec[0], t0);
+            mVec[1] = _mm256_and_si256(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (int16_t b) {
+            return banda(b);
+        }
+        // MBANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<32> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_and_si256(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t2 = _mm256_and_si256(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return *this;
+        }
+        // BORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_or_si256(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_or_si256(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (SIMDVec_i const & b) const {
+            return bor(b);
+        }
+        // MBORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_or_si256(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t2 = _mm256_or_si256(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return SIMDVec_i(t1, t3);
+        }
+        // BORS
+        UME_FORCE_INLINE SIMDVec_i bor(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_or_si256(mVec[0], t0);
+            __m256i t2 = _mm256_or_si256(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (int16_t b) const {
+            return bor(b);
+        }
+        // MBORS
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<32> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_or_si256(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t3 = _mm256_or_si256(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, m1);
+            return SIMDVec_i(t2, t4);
+        }
+        // BORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVec_i const & b) {
+            mVec[0] = _mm256_or_si256(mVec[0], b.mVec[0]);
+            mVec[1] = _mm256_or_si256(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (SIMDVec_i const & b) {
+            return bora(b);
+        }
+        // MBORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_or_si256(mVec[0], b.mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t1 = _mm256_or_si256(mVec[1], b.mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, m1);
+            return *this;
+        }
+        // BORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(int16_t b) {
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec[0] = _mm256_or_si256(mVec[0], t0);
+            mVec[1] = _mm256_or_si256(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (int16_t b) {
+            return bora(b);
+        }
+        // MBORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<32> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_or_si256(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t2 = _mm256_or_si256(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return *this;
+        }
+        // BXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_xor_si256(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_xor_si256(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (SIMDVec_i const & b) const {
+            return bxor(b);
+        }
+        // MBXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<32> const & mask, SIMDVec_i const & b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_xor_si256(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t2 = _mm256_xor_si256(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return SIMDVec_i(t1, t3);
+        }
+        // BXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(int16_t b) const {
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_xor_si256(mVec[0], t0);
+            __m256i t2 = _mm256_xor_si256(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (int16_t b) const {
+            return bxor(b);
+        }
+        // MBXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<32> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_xor_si256(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t3 = _mm256_xor_si256(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, m1);
+            return SIMDVec_i(t2, t4);
+        }
+        // BXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVec_i const & b) {
+            mVec[0] = _mm256_xor_si256(mVec[0], b.mVec[0]);
+            mVec[1] = _mm256_xor_si256(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (SIMDVec_i const & b) {
+            return bxora(b);
+        }
+        // MBXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<32> const & mask, SIMDVec_i const & b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_xor_si256(mVec[0], b.mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t1 = _mm256_xor_si256(mVec[1], b.mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, m1);
+            return *this;
+        }
+        // BXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(int16_t b) {
+            __m256i t0 = _mm256_set1_epi16(b);
+            mVec[0] = _mm256_xor_si256(mVec[0], t0);
+            mVec[1] = _mm256_xor_si256(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (int16_t b) {
+            return bxora(b);
+        }
+        // MBXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<32> const & mask, int16_t b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi16(b);
+            __m256i t1 = _mm256_xor_si256(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t2 = _mm256_xor_si256(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return *this;
+        }
+        // BNOT
+        UME_FORCE_INLINE SIMDVec_i bnot() const {
+            __m256i t0 = _mm256_set1_epi32(0xFFFFFFFF);
+            __m256i t1 = _mm256_xor_si256(mVec[0], t0);
+            __m256i t2 = _mm256_xor_si256(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator~ () const {
+            return bnot();
+        }
+        // MBNOT
+        UME_FORCE_INLINE SIMDVec_i bnot(SIMDVecMask<32> const & mask) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi32(0xFFFFFFFF);
+            __m256i t1 = _mm256_xor_si256(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t3 = _mm256_xor_si256(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, m1);
+            return SIMDVec_i(t2, t4);
+        }
+        // BNOTA
+        UME_FORCE_INLINE SIMDVec_i & bnota() {
+            __m256i t0 = _mm256_set1_epi32(0xFFFFFFFF);
+            mVec[0] = _mm256_xor_si256(mVec[0], t0);
+            mVec[1] = _mm256_xor_si256(mVec[1], t0);
+            return *this;
+        }
+        // MBNOTA
+        UME_FORCE_INLINE SIMDVec_i & bnota(SIMDVecMask<32> const & mask) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi32(0xFFFFFFFF);
+            __m256i t1 = _mm256_xor_si256(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t2 = _mm256_xor_si256(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return *this;
+        }
+        // HBAND
+        UME_FORCE_INLINE int16_t hband() const {
+            __m256i t0 = _mm256_and_si256(mVec[0], mVec[1]);
+            __m128i t1 = _mm_and_si128(_mm256_extracti128_si256(t0, 0), _mm256_extracti128_si256(t0, 1));
+            __m128i t2 = _mm_and_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_and_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_and_si128(t3, _mm_srli_si128(t3, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t4, 0));
+            return retval;
+        }
+        // HBANDS
+        UME_FORCE_INLINE int16_t hband(int16_t b) const {
+            __m256i t0 = _mm256_and_si256(mVec[0], mVec[1]);
+            __m128i t1 = _mm_and_si128(_mm256_extracti128_si256(t0, 0), _mm256_extracti128_si256(t0, 1));
+            __m128i t2 = _mm_and_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_and_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_and_si128(t3, _mm_srli_si128(t3, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t4, 0));
+            return int16_t(retval & b);
+        }
+        // MHBAND
+        UME_FORCE_INLINE int16_t hband(SIMDVecMask<32> const & mask) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi32(0xFFFFFFFF);
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec[0], m0);
+            __m256i t2 = _mm256_blendv_epi8(t0, mVec[1], m1);
+            __m256i t3 = _mm256_and_si256(t1, t2);
+            __m128i t4 = _mm_and_si128(_mm256_extracti128_si256(t3, 0), _mm256_extracti128_si256(t3, 1));
+            __m128i t5 = _mm_and_si128(t4, _mm_srli_si128(t4, 8));
+            __m128i t6 = _mm_and_si128(t5, _mm_srli_si128(t5, 4));
+            __m128i t7 = _mm_and_si128(t6, _mm_srli_si128(t6, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t7, 0));
+            return retval;
+        }
+        // MHBANDS
+        UME_FORCE_INLINE int16_t hband(SIMDVecMask<32> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_set1_epi32(0xFFFFFFFF);
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec[0], m0);
+            __m256i t2 = _mm256_blendv_epi8(t0, mVec[1], m1);
+            __m256i t3 = _mm256_and_si256(t1, t2);
+            __m128i t4 = _mm_and_si128(_mm256_extracti128_si256(t3, 0), _mm256_extracti128_si256(t3, 1));
+            __m128i t5 = _mm_and_si128(t4, _mm_srli_si128(t4, 8));
+            __m128i t6 = _mm_and_si128(t5, _mm_srli_si128(t5, 4));
+            __m128i t7 = _mm_and_si128(t6, _mm_srli_si128(t6, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t7, 0));
+            return int16_t(retval & b);
+        }
+        // HBOR
+        UME_FORCE_INLINE int16_t hbor() const {
+            __m256i t0 = _mm256_or_si256(mVec[0], mVec[1]);
+            __m128i t1 = _mm_or_si128(_mm256_extracti128_si256(t0, 0), _mm256_extracti128_si256(t0, 1));
+            __m128i t2 = _mm_or_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_or_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_or_si128(t3, _mm_srli_si128(t3, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t4, 0));
+            return retval;
+        }
+        // HBORS
+        UME_FORCE_INLINE int16_t hbor(int16_t b) const {
+            __m256i t0 = _mm256_or_si256(mVec[0], mVec[1]);
+            __m128i t1 = _mm_or_si128(_mm256_extracti128_si256(t0, 0), _mm256_extracti128_si256(t0, 1));
+            __m128i t2 = _mm_or_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_or_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_or_si128(t3, _mm_srli_si128(t3, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t4, 0));
+            return int16_t(retval | b);
+        }
+        // MHBOR
+        UME_FORCE_INLINE int16_t hbor(SIMDVecMask<32> const & mask) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec[0], m0);
+            __m256i t2 = _mm256_blendv_epi8(t0, mVec[1], m1);
+            __m256i t3 = _mm256_or_si256(t1, t2);
+            __m128i t4 = _mm_or_si128(_mm256_extracti128_si256(t3, 0), _mm256_extracti128_si256(t3, 1));
+            __m128i t5 = _mm_or_si128(t4, _mm_srli_si128(t4, 8));
+            __m128i t6 = _mm_or_si128(t5, _mm_srli_si128(t5, 4));
+            __m128i t7 = _mm_or_si128(t6, _mm_srli_si128(t6, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t7, 0));
+            return retval;
+        }
+        // MHBORS
+        UME_FORCE_INLINE int16_t hbor(SIMDVecMask<32> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec[0], m0);
+            __m256i t2 = _mm256_blendv_epi8(t0, mVec[1], m1);
+            __m256i t3 = _mm256_or_si256(t1, t2);
+            __m128i t4 = _mm_or_si128(_mm256_extracti128_si256(t3, 0), _mm256_extracti128_si256(t3, 1));
+            __m128i t5 = _mm_or_si128(t4, _mm_srli_si128(t4, 8));
+            __m128i t6 = _mm_or_si128(t5, _mm_srli_si128(t5, 4));
+            __m128i t7 = _mm_or_si128(t6, _mm_srli_si128(t6, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t7, 0));
+            return int16_t(retval | b);
+        }
+        // HBXOR
+        UME_FORCE_INLINE int16_t hbxor() const {
+            __m256i t0 = _mm256_xor_si256(mVec[0], mVec[1]);
+            __m128i t1 = _mm_xor_si128(_mm256_extracti128_si256(t0, 0), _mm256_extracti128_si256(t0, 1));
+            __m128i t2 = _mm_xor_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_xor_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_xor_si128(t3, _mm_srli_si128(t3, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t4, 0));
+            return retval;
+        }
+        // HBXORS
+        UME_FORCE_INLINE int16_t hbxor(int16_t b) const {
+            __m256i t0 = _mm256_xor_si256(mVec[0], mVec[1]);
+            __m128i t1 = _mm_xor_si128(_mm256_extracti128_si256(t0, 0), _mm256_extracti128_si256(t0, 1));
+            __m128i t2 = _mm_xor_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_xor_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_xor_si128(t3, _mm_srli_si128(t3, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t4, 0));
+            return int16_t(retval ^ b);
+        }
+        // MHBXOR
+        UME_FORCE_INLINE int16_t hbxor(SIMDVecMask<32> const & mask) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec[0], m0);
+            __m256i t2 = _mm256_blendv_epi8(t0, mVec[1], m1);
+            __m256i t3 = _mm256_xor_si256(t1, t2);
+            __m128i t4 = _mm_xor_si128(_mm256_extracti128_si256(t3, 0), _mm256_extracti128_si256(t3, 1));
+            __m128i t5 = _mm_xor_si128(t4, _mm_srli_si128(t4, 8));
+            __m128i t6 = _mm_xor_si128(t5, _mm_srli_si128(t5, 4));
+            __m128i t7 = _mm_xor_si128(t6, _mm_srli_si128(t6, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t7, 0));
+            return retval;
+        }
+        // MHBXORS
+        UME_FORCE_INLINE int16_t hbxor(SIMDVecMask<32> const & mask, int16_t b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_blendv_epi8(t0, mVec[0], m0);
+            __m256i t2 = _mm256_blendv_epi8(t0, mVec[1], m1);
+            __m256i t3 = _mm256_xor_si256(t1, t2);
+            __m128i t4 = _mm_xor_si128(_mm256_extracti128_si256(t3, 0), _mm256_extracti128_si256(t3, 1));
+            __m128i t5 = _mm_xor_si128(t4, _mm_srli_si128(t4, 8));
+            __m128i t6 = _mm_xor_si128(t5, _mm_srli_si128(t5, 4));
+            __m128i t7 = _mm_xor_si128(t6, _mm_srli_si128(t6, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t7, 0));
+            return int16_t(retval ^ b);
+        }
+
+        // GATHERU
+        // MGATHERU
+        // GATHERS
+        // MGATHERS
+        // GATHERV
+        // MGATHERV
+        // SCATTERU
+        // MSCATTERU
+        // SCATTERS
+        // MSCATTERS
+        // SCATTERV
+        // MSCATTERV
+
+        // LSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVec_u<uint16_t, 32> const & b) const {
+            __m256i t0 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec[0], 0));
+            __m256i t1 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[0], 0));
+            __m256i t2 = _mm256_sllv_epi32(t0, t1);
+            __m256i t3 = _mm256_and_si256(t2, _mm256_set1_epi32(0xFFFF));
+            __m256i t4 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec[0], 1));
+            __m256i t5 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[0], 1));
+            __m256i t6 = _mm256_sllv_epi32(t4, t5);
+            __m256i t7 = _mm256_and_si256(t6, _mm256_set1_epi32(0xFFFF));
+            __m256i t8 = _mm256_packus_epi32(t3, t7);
+            __m256i t9 = _mm256_permute4x64_epi64(t8, 0xD8);
+            __m256i t10 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec[1], 0));
+            __m256i t11 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[1], 0));
+            __m256i t12 = _mm256_sllv_epi32(t10, t11);
+            __m256i t13 = _mm256_and_si256(t12, _mm256_set1_epi32(0xFFFF));
+            __m256i t14 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec[1], 1));
+            __m256i t15 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[1], 1));
+            __m256i t16 = _mm256_sllv_epi32(t14, t15);
+            __m256i t17 = _mm256_and_si256(t16, _mm256_set1_epi32(0xFFFF));
+            __m256i t18 = _mm256_packus_epi32(t13, t17);
+            __m256i t19 = _mm256_permute4x64_epi64(t18, 0xD8);
+            return SIMDVec_i(t9, t19);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (SIMDVec_u<uint16_t, 32> const & b) const {
+            return lsh(b);
+        }
+        // MLSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<32> const & mask, SIMDVec_u<uint16_t, 32> const & b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec[0], 0));
+            __m256i t1 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[0], 0));
+            __m256i t2 = _mm256_sllv_epi32(t0, t1);
+            __m256i t3 = _mm256_and_si256(t2, _mm256_set1_epi32(0xFFFF));
+            __m256i t4 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec[0], 1));
+            __m256i t5 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[0], 1));
+            __m256i t6 = _mm256_sllv_epi32(t4, t5);
+            __m256i t7 = _mm256_and_si256(t6, _mm256_set1_epi32(0xFFFF));
+            __m256i t8 = _mm256_packus_epi32(t3, t7);
+            __m256i t9 = _mm256_permute4x64_epi64(t8, 0xD8);
+            __m256i t10 = _mm256_blendv_epi8(mVec[0], t9, m0);
+            __m256i t11 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec[1], 0));
+            __m256i t12 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[1], 0));
+            __m256i t13 = _mm256_sllv_epi32(t11, t12);
+            __m256i t14 = _mm256_and_si256(t13, _mm256_set1_epi32(0xFFFF));
+            __m256i t15 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec[1], 1));
+            __m256i t16 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[1], 1));
+            __m256i t17 = _mm256_sllv_epi32(t15, t16);
+            __m256i t18 = _mm256_and_si256(t17, _mm256_set1_epi32(0xFFFF));
+            __m256i t19 = _mm256_packus_epi32(t14, t18);
+            __m256i t20 = _mm256_permute4x64_epi64(t19, 0xD8);
+            __m256i t21 = _mm256_blendv_epi8(mVec[1], t20, m1);
+            return SIMDVec_i(t10, t21);
+        }
+        // LSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(uint16_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            __m256i t1 = _mm256_sll_epi16(mVec[0], t0);
+            __m256i t2 = _mm256_sll_epi16(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (uint16_t b) const {
+            return lsh(b);
+        }
+        // MLSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<32> const & mask, uint16_t b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            __m256i t1 = _mm256_sll_epi16(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t3 = _mm256_sll_epi16(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, m1);
+            return SIMDVec_i(t2, t4);
+        }
+        // LSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVec_u<uint16_t, 32> const & b) {
+            __m256i t0 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec[0], 0));
+            __m256i t1 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[0], 0));
+            __m256i t2 = _mm256_sllv_epi32(t0, t1);
+            __m256i t3 = _mm256_and_si256(t2, _mm256_set1_epi32(0xFFFF));
+            __m256i t4 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec[0], 1));
+            __m256i t5 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[0], 1));
+            __m256i t6 = _mm256_sllv_epi32(t4, t5);
+            __m256i t7 = _mm256_and_si256(t6, _mm256_set1_epi32(0xFFFF));
+            __m256i t8 = _mm256_packus_epi32(t3, t7);
+            mVec[0] = _mm256_permute4x64_epi64(t8, 0xD8);
+            __m256i t9 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec[1], 0));
+            __m256i t10 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[1], 0));
+            __m256i t11 = _mm256_sllv_epi32(t9, t10);
+            __m256i t12 = _mm256_and_si256(t11, _mm256_set1_epi32(0xFFFF));
+            __m256i t13 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec[1], 1));
+            __m256i t14 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[1], 1));
+            __m256i t15 = _mm256_sllv_epi32(t13, t14);
+            __m256i t16 = _mm256_and_si256(t15, _mm256_set1_epi32(0xFFFF));
+            __m256i t17 = _mm256_packus_epi32(t12, t16);
+            mVec[1] = _mm256_permute4x64_epi64(t17, 0xD8);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (SIMDVec_u<uint16_t, 32> const & b) {
+            return lsha(b);
+        }
+        // MLSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<32> const & mask, SIMDVec_u<uint16_t, 32> const & b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec[0], 0));
+            __m256i t1 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[0], 0));
+            __m256i t2 = _mm256_sllv_epi32(t0, t1);
+            __m256i t3 = _mm256_and_si256(t2, _mm256_set1_epi32(0xFFFF));
+            __m256i t4 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec[0], 1));
+            __m256i t5 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[0], 1));
+            __m256i t6 = _mm256_sllv_epi32(t4, t5);
+            __m256i t7 = _mm256_and_si256(t6, _mm256_set1_epi32(0xFFFF));
+            __m256i t8 = _mm256_packus_epi32(t3, t7);
+            __m256i t9 = _mm256_permute4x64_epi64(t8, 0xD8);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t9, m0);
+            __m256i t10 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec[1], 0));
+            __m256i t11 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[1], 0));
+            __m256i t12 = _mm256_sllv_epi32(t10, t11);
+            __m256i t13 = _mm256_and_si256(t12, _mm256_set1_epi32(0xFFFF));
+            __m256i t14 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(mVec[1], 1));
+            __m256i t15 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[1], 1));
+            __m256i t16 = _mm256_sllv_epi32(t14, t15);
+            __m256i t17 = _mm256_and_si256(t16, _mm256_set1_epi32(0xFFFF));
+            __m256i t18 = _mm256_packus_epi32(t13, t17);
+            __m256i t19 = _mm256_permute4x64_epi64(t18, 0xD8);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t19, m1);
+            return *this;
+        }
+        // LSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(uint16_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            mVec[0] = _mm256_sll_epi16(mVec[0], t0);
+            mVec[1] = _mm256_sll_epi16(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (uint16_t b) {
+            return lsha(b);
+        }
+        // MLSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<32> const & mask, uint16_t b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            __m256i t1 = _mm256_sll_epi16(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t2 = _mm256_sll_epi16(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return *this;
+        }
+        // RSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVec_u<uint16_t, 32> const & b) const {
+            __m256i t0 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec[0], 0));
+            __m256i t1 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[0], 0));
+            __m256i t2 = _mm256_srav_epi32(t0, t1);
+            __m256i t3 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec[0], 1));
+            __m256i t4 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[0], 1));
+            __m256i t5 = _mm256_srav_epi32(t3, t4);
+            __m256i t6 = _mm256_packs_epi32(t2, t5);
+            __m256i t7 = _mm256_permute4x64_epi64(t6, 0xD8);
+            __m256i t8 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec[1], 0));
+            __m256i t9 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[1], 0));
+            __m256i t10 = _mm256_srav_epi32(t8, t9);
+            __m256i t11 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec[1], 1));
+            __m256i t12 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[1], 1));
+            __m256i t13 = _mm256_srav_epi32(t11, t12);
+            __m256i t14 = _mm256_packs_epi32(t10, t13);
+            __m256i t15 = _mm256_permute4x64_epi64(t14, 0xD8);
+            return SIMDVec_i(t7, t15);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (SIMDVec_u<uint16_t, 32> const & b) const {
+            return rsh(b);
+        }
+        // MRSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<32> const & mask, SIMDVec_u<uint16_t, 32> const & b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec[0], 0));
+            __m256i t1 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[0], 0));
+            __m256i t2 = _mm256_srav_epi32(t0, t1);
+            __m256i t3 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec[0], 1));
+            __m256i t4 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[0], 1));
+            __m256i t5 = _mm256_srav_epi32(t3, t4);
+            __m256i t6 = _mm256_packs_epi32(t2, t5);
+            __m256i t7 = _mm256_permute4x64_epi64(t6, 0xD8);
+            __m256i t8 = _mm256_blendv_epi8(mVec[0], t7, m0);
+            __m256i t9 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec[1], 0));
+            __m256i t10 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[1], 0));
+            __m256i t11 = _mm256_srav_epi32(t9, t10);
+            __m256i t12 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec[1], 1));
+            __m256i t13 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[1], 1));
+            __m256i t14 = _mm256_srav_epi32(t12, t13);
+            __m256i t15 = _mm256_packs_epi32(t11, t14);
+            __m256i t16 = _mm256_permute4x64_epi64(t15, 0xD8);
+            __m256i t17 = _mm256_blendv_epi8(mVec[1], t16, m1);
+            return SIMDVec_i(t8, t17);
+        }
+        // RSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(uint16_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            __m256i t1 = _mm256_sra_epi16(mVec[0], t0);
+            __m256i t2 = _mm256_sra_epi16(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (uint16_t b) const {
+            return rsh(b);
+        }
+        // MRSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<32> const & mask, uint16_t b) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            __m256i t1 = _mm256_sra_epi16(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t3 = _mm256_sra_epi16(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, m1);
+            return SIMDVec_i(t2, t4);
+        }
+        // RSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVec_u<uint16_t, 32> const & b) {
+            __m256i t0 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec[0], 0));
+            __m256i t1 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[0], 0));
+            __m256i t2 = _mm256_srav_epi32(t0, t1);
+            __m256i t3 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec[0], 1));
+            __m256i t4 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[0], 1));
+            __m256i t5 = _mm256_srav_epi32(t3, t4);
+            __m256i t6 = _mm256_packs_epi32(t2, t5);
+            mVec[0] = _mm256_permute4x64_epi64(t6, 0xD8);
+            __m256i t7 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec[1], 0));
+            __m256i t8 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[1], 0));
+            __m256i t9 = _mm256_srav_epi32(t7, t8);
+            __m256i t10 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec[1], 1));
+            __m256i t11 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[1], 1));
+            __m256i t12 = _mm256_srav_epi32(t10, t11);
+            __m256i t13 = _mm256_packs_epi32(t9, t12);
+            mVec[1] = _mm256_permute4x64_epi64(t13, 0xD8);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (SIMDVec_u<uint16_t, 32> const & b) {
+            return rsha(b);
+        }
+        // MRSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<32> const & mask, SIMDVec_u<uint16_t, 32> const & b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec[0], 0));
+            __m256i t1 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[0], 0));
+            __m256i t2 = _mm256_srav_epi32(t0, t1);
+            __m256i t3 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec[0], 1));
+            __m256i t4 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[0], 1));
+            __m256i t5 = _mm256_srav_epi32(t3, t4);
+            __m256i t6 = _mm256_packs_epi32(t2, t5);
+            __m256i t7 = _mm256_permute4x64_epi64(t6, 0xD8);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t7, m0);
+            __m256i t8 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec[1], 0));
+            __m256i t9 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[1], 0));
+            __m256i t10 = _mm256_srav_epi32(t8, t9);
+            __m256i t11 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(mVec[1], 1));
+            __m256i t12 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(b.mVec[1], 1));
+            __m256i t13 = _mm256_srav_epi32(t11, t12);
+            __m256i t14 = _mm256_packs_epi32(t10, t13);
+            __m256i t15 = _mm256_permute4x64_epi64(t14, 0xD8);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t15, m1);
+            return *this;
+        }
+        // RSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(uint16_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            mVec[0] = _mm256_sra_epi16(mVec[0], t0);
+            mVec[1] = _mm256_sra_epi16(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (uint16_t b) {
+            return rsha(b);
+        }
+        // MRSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<32> const & mask, uint16_t b) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            __m256i t1 = _mm256_sra_epi16(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, m0);
+            __m256i t2 = _mm256_sra_epi16(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return *this;
+        }
+        // ROLV
+        // MROLV
+        // ROLS
+        // MROLS
+        // ROLVA
+        // MROLVA
+        // ROLSA
+        // MROLSA
+        // RORV
+        // MRORV
+        // RORS
+        // MRORS
+        // RORVA
+        // MRORVA
+        // RORSA
+        // MRORSA
+
+        // NEG
+        UME_FORCE_INLINE SIMDVec_i neg() const {
+            __m256i t0 = _mm256_sub_epi16(_mm256_setzero_si256(), mVec[0]);
+            __m256i t1 = _mm256_sub_epi16(_mm256_setzero_si256(), mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- () const {
+            return neg();
+        }
+        // MNEG
+        UME_FORCE_INLINE SIMDVec_i neg(SIMDVecMask<32> const & mask) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_sub_epi16(_mm256_setzero_si256(), mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t2 = _mm256_sub_epi16(_mm256_setzero_si256(), mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return SIMDVec_i(t1, t3);
+        }
+        // NEGA
+        UME_FORCE_INLINE SIMDVec_i & nega() {
+            mVec[0] = _mm256_sub_epi16(_mm256_setzero_si256(), mVec[0]);
+            mVec[1] = _mm256_sub_epi16(_mm256_setzero_si256(), mVec[1]);
+            return *this;
+        }
+        // MNEGA
+        UME_FORCE_INLINE SIMDVec_i & nega(SIMDVecMask<32> const & mask) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_sub_epi16(_mm256_setzero_si256(), mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t1 = _mm256_sub_epi16(_mm256_setzero_si256(), mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, m1);
+            return *this;
+        }
+        // ABS
+        UME_FORCE_INLINE SIMDVec_i abs() const {
+            __m256i t0 = _mm256_abs_epi16(mVec[0]);
+            __m256i t1 = _mm256_abs_epi16(mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        // MABS
+        UME_FORCE_INLINE SIMDVec_i abs(SIMDVecMask<32> const & mask) const {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_abs_epi16(mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t2 = _mm256_abs_epi16(mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, m1);
+            return SIMDVec_i(t1, t3);
+        }
+        // ABSA
+        UME_FORCE_INLINE SIMDVec_i & absa() {
+            mVec[0] = _mm256_abs_epi16(mVec[0]);
+            mVec[1] = _mm256_abs_epi16(mVec[1]);
+            return *this;
+        }
+        // MABSA
+        UME_FORCE_INLINE SIMDVec_i & absa(SIMDVecMask<32> const & mask) {
+            __m256i m0 = mask.toEpi16Lo();
+            __m256i m1 = mask.toEpi16Hi();
+            __m256i t0 = _mm256_abs_epi16(mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, m0);
+            __m256i t1 = _mm256_abs_epi16(mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, m1);
+            return *this;
+        }
+
+        // PACK
+        UME_FORCE_INLINE SIMDVec_i & pack(SIMDVec_i<int16_t, 16> const & a, SIMDVec_i<int16_t, 16> const & b) {
+            mVec[0] = a.mVec;
+            mVec[1] = b.mVec;
+            return *this;
+        }
+        // PACKLO
+        UME_FORCE_INLINE SIMDVec_i & packlo(SIMDVec_i<int16_t, 16> const & a) {
+            mVec[0] = a.mVec;
+            return *this;
+        }
+        // PACKHI
+        UME_FORCE_INLINE SIMDVec_i & packhi(SIMDVec_i<int16_t, 16> const & b) {
+            mVec[1] = b.mVec;
+            return *this;
+        }
+        // UNPACK
+        UME_FORCE_INLINE void unpack(SIMDVec_i<int16_t, 16> & a, SIMDVec_i<int16_t, 16> & b) const {
+            a.mVec = mVec[0];
+            b.mVec = mVec[1];
+        }
+        // UNPACKLO
+        UME_FORCE_INLINE SIMDVec_i<int16_t, 16> unpacklo() const {
+            return SIMDVec_i<int16_t, 16>(mVec[0]);
+        }
+        // UNPACKHI
+        UME_FORCE_INLINE SIMDVec_i<int16_t, 16> unpackhi() const {
+            return SIMDVec_i<int16_t, 16>(mVec[1]);
+        }
+
+        // PROMOTE
+        UME_FORCE_INLINE operator SIMDVec_i<int32_t, 32>() const;
+        // DEGRADE
+        UME_FORCE_INLINE operator SIMDVec_i<int8_t, 32>() const;
+
+        // ITOU
+        UME_FORCE_INLINE operator SIMDVec_u<uint16_t, 32>() const;
+        // ITOF
+        // -
+
+    };
+
+}
+}
+
+#endif
@@ -0,0 +1,1637 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_INT16_8_H_
+#define UME_SIMD_VEC_INT16_8_H_
+
+#include <type_traits>
+#include <immintrin.h>
+
+#include "../../../UMESimdInterface.h"
+
+namespace UME {
+namespace SIMD {
+
+    template<>
+    class SIMDVec_i<int16_t, 8> :
+        public SIMDVecSignedInterface<
+            SIMDVec_i<int16_t, 8>,
+            SIMDVec_u<uint16_t, 8>,
+            int16_t,
+            8,
+            uint16_t,
+            SIMDVecMask<8>,
+            SIMDSwizzle<8 >> ,
+        public SIMDVecPackableInterface<
+            SIMDVec_i<int16_t, 8>,
+            SIMDVec_i<int16_t, 4 >>
+    {
+    public:
+        // Conversion operators require access to private members.
+        friend class SIMDVec_u<uint16_t, 8>;
+        friend class SIMDVec_i<int8_t, 8>;
+        friend class SIMDVec_i<int32_t, 8>;
+
+        friend class SIMDVec_i<int16_t, 16>;
+    private:
+        __m128i mVec;
+
+        UME_FORCE_INLINE explicit SIMDVec_i(__m128i & x) { mVec = x; }
+        UME_FORCE_INLINE explicit SIMDVec_i(const __m128i & x) { mVec = x; }
+    public:
+
+        constexpr static uint32_t length() { return 8; }
+        constexpr static uint32_t alignment() { return 16; }
+
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_i() {}
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_i(int16_t i) {
+            mVec = _mm_set1_epi16(i);
+        }
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_i(
+            T i, 
+            typename std::enable_if< std::is_fundamental<T>::value && 
+                                    !std::is_same<T, int16_t>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_i(static_cast<int16_t>(i)) {}
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVec_i(int16_t const *p) { load(p); }
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVec_i(int16_t i0, int16_t i1, int16_t i2, int16_t i3,
+                                   int16_t i4, int16_t i5, int16_t i6, int16_t i7)
+        {
+            mVec = _mm_setr_epi16(i0, i1, i2, i3, i4, i5, i6, i7);
+        }
+        // EXTRACT
+        UME_FORCE_INLINE int16_t extract(uint32_t index) const {
+            alignas(16) int16_t raw[8];
+            _mm_store_si128((__m128i*)raw, mVec);
+            return raw[index];
+        }
+        UME_FORCE_INLINE int16_t operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_i & insert(uint32_t index, int16_t value) {
+            alignas(16) int16_t raw[8];
+            _mm_store_si128((__m128i*)raw, mVec);
+            raw[index] = value;
+            mVec = _mm_load_si128((__m128i*)raw);
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_i, int16_t> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_i, int16_t>(index, static_cast<SIMDVec_i &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_i, int16_t, SIMDVecMask<8>> operator() (SIMDVecMask<8> const & mask) {
+            return IntermediateMask<SIMDVec_i, int16_t, SIMDVecMask<8>>(mask, static_cast<SIMDVec_i &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_i, int16_t, SIMDVecMask<8>> operator[] (SIMDVecMask<8> const & mask) {
+            return IntermediateMask<SIMDVec_i, int16_t, SIMDVecMask<8>>(mask, static_cast<SIMDVec_i &>(*this));
+        }
+#endif
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVec_i const & b) {
+            mVec = b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator= (SIMDVec_i const & b) {
+            return assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi16();
+            mVec = _mm_blendv_epi8(mVec, b.mVec, m0);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_i & assign(int16_t b) {
+            mVec = _mm_set1_epi16(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator= (int16_t b) {
+            return assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVecMask<8> const & mask, int16_t b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+
+        // PREFETCH0
+        // PREFETCH1
+        // PREFETCH2
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_i & load(int16_t const *p) {
+            mVec = _mm_loadu_si128((const __m128i *)p);
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<8> const & mask, int16_t const *p) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_loadu_si128((const __m128i *)p);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_i & loada(int16_t const *p) {
+            mVec = _mm_load_si128((const __m128i *)p);
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<8> const & mask, int16_t const *p) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_load_si128((const __m128i *)p);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE int16_t* store(int16_t* p) const {
+            _mm_storeu_si128((__m128i *)p, mVec);
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE int16_t* store(SIMDVecMask<8> const & mask, int16_t* p) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_loadu_si128((const __m128i *)p);
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            _mm_storeu_si128((__m128i *)p, t1);
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE int16_t* storea(int16_t* p) const {
+            _mm_store_si128((__m128i *)p, mVec);
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE int16_t* storea(SIMDVecMask<8> const & mask, int16_t* p) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_load_si128((const __m128i *)p);
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            _mm_store_si128((__m128i *)p, t1);
+            return p;
+        }
+
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_blendv_epi8(mVec, b.mVec, m0);
+            return SIMDVec_i(t0);
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<8> const & mask, int16_t b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // SWIZZLE
+        // SWIZZLEA
+
+        // SORTA
+        // SORTD
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_add_epi16(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator+ (SIMDVec_i const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_add_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_i add(int16_t b) const {
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_add_epi16(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator+ (int16_t b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVecMask<8> const & mask, int16_t b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_add_epi16(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVec_i const & b) {
+            mVec = _mm_add_epi16(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator+= (SIMDVec_i const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_add_epi16(mVec, b.mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_i & adda(int16_t b) {
+            __m128i t0 = _mm_set1_epi16(b);
+            mVec = _mm_add_epi16(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator+= (int16_t b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVecMask<8> const & mask, int16_t b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_add_epi16(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // POSTINC
+        UME_FORCE_INLINE SIMDVec_i postinc() {
+            __m128i t0 = _mm_set1_epi16(1);
+            __m128i t1 = mVec;
+            mVec = _mm_add_epi16(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator++ (int) {
+            return postinc();
+        }
+        // MPOSTINC
+        UME_FORCE_INLINE SIMDVec_i postinc(SIMDVecMask<8> const & mask) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(1);
+            __m128i t1 = mVec;
+            __m128i t2 = _mm_add_epi16(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t2, m0);
+            return SIMDVec_i(t1);
+        }
+        // PREFINC
+        UME_FORCE_INLINE SIMDVec_i & prefinc() {
+            __m128i t0 = _mm_set1_epi16(1);
+            mVec = _mm_add_epi16(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator++ () {
+            return prefinc();
+        }
+        // MPREFINC
+        UME_FORCE_INLINE SIMDVec_i & prefinc(SIMDVecMask<8> const & mask) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(1);
+            __m128i t1 = _mm_add_epi16(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_adds_epi16(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_adds_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int16_t b) const {
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_adds_epi16(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<8> const & mask, int16_t b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_adds_epi16(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec = _mm_adds_epi16(mVec, b.mVec);
+            return *this;
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_adds_epi16(mVec, b.mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int16_t b) {
+            __m128i t0 = _mm_set1_epi16(b);
+            mVec = _mm_adds_epi16(mVec, t0);
+            return *this;
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<8> const & mask, int16_t b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_adds_epi16(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_sub_epi16(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- (SIMDVec_i const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_sub_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_i sub(int16_t b) const {
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_sub_epi16(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- (int16_t b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVecMask<8> const & mask, int16_t b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_sub_epi16(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVec_i const & b) {
+            mVec = _mm_sub_epi16(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-= (SIMDVec_i const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_sub_epi16(mVec, b.mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_i & suba(int16_t b) {
+            __m128i t0 = _mm_set1_epi16(b);
+            mVec = _mm_sub_epi16(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-= (int16_t b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVecMask<8> const & mask, int16_t b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_sub_epi16(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_subs_epi16(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_subs_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int16_t b) const {
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_subs_epi16(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<8> const & mask, int16_t b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_subs_epi16(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec = _mm_subs_epi16(mVec, b.mVec);
+            return *this;
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_subs_epi16(mVec, b.mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int16_t b) {
+            __m128i t0 = _mm_set1_epi16(b);
+            mVec = _mm_subs_epi16(mVec, t0);
+            return *this;
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<8> const & mask, int16_t b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_subs_epi16(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_sub_epi16(b.mVec, mVec);
+            return SIMDVec_i(t0);
+        }
+        // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_sub_epi16(b.mVec, mVec);
+            __m128i t1 = _mm_blendv_epi8(b.mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_i subfrom(int16_t b) const {
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_sub_epi16(t0, mVec);
+            return SIMDVec_i(t1);
+        }
+        // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVecMask<8> const & mask, int16_t b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_sub_epi16(t0, mVec);
+            __m128i t2 = _mm_blendv_epi8(t0, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVec_i const & b) {
+            mVec = _mm_sub_epi16(b.mVec, mVec);
+            return *this;
+        }
+        // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_sub_epi16(b.mVec, mVec);
+            mVec = _mm_blendv_epi8(b.mVec, t0, m0);
+            return *this;
+        }
+        // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(int16_t b) {
+            __m128i t0 = _mm_set1_epi16(b);
+            mVec = _mm_sub_epi16(t0, mVec);
+            return *this;
+        }
+        // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVecMask<8> const & mask, int16_t b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_sub_epi16(t0, mVec);
+            mVec = _mm_blendv_epi8(t0, t1, m0);
+            return *this;
+        }
+        // POSTDEC
+        UME_FORCE_INLINE SIMDVec_i postdec() {
+            __m128i t0 = _mm_set1_epi16(1);
+            __m128i t1 = mVec;
+            mVec = _mm_sub_epi16(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator-- (int) {
+            return postdec();
+        }
+        // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_i postdec(SIMDVecMask<8> const & mask) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(1);
+            __m128i t1 = mVec;
+            __m128i t2 = _mm_sub_epi16(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t2, m0);
+            return SIMDVec_i(t1);
+        }
+        // PREFDEC
+        UME_FORCE_INLINE SIMDVec_i & prefdec() {
+            __m128i t0 = _mm_set1_epi16(1);
+            mVec = _mm_sub_epi16(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-- () {
+            return prefdec();
+        }
+        // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_i & prefdec(SIMDVecMask<8> const & mask) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(1);
+            __m128i t1 = _mm_sub_epi16(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // MULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_mullo_epi16(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (SIMDVec_i const & b) const {
+            return mul(b);
+        }
+        // MMULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_mullo_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // MULS
+        UME_FORCE_INLINE SIMDVec_i mul(int16_t b) const {
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_mullo_epi16(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (int16_t b) const {
+            return mul(b);
+        }
+        // MMULS
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<8> const & mask, int16_t b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_mullo_epi16(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // MULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVec_i const & b) {
+            mVec = _mm_mullo_epi16(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (SIMDVec_i const & b) {
+            return mula(b);
+        }
+        // MMULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_mullo_epi16(mVec, b.mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // MULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(int16_t b) {
+            __m128i t0 = _mm_set1_epi16(b);
+            mVec = _mm_mullo_epi16(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (int16_t b) {
+            return mula(b);
+        }
+        // MMULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<8> const & mask, int16_t b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_mullo_epi16(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // DIVV
+        // MDIVV
+        // DIVS
+        // MDIVS
+        // DIVVA
+        // MDIVVA
+        // DIVSA
+        // MDIVSA
+        // RCP
+        // MRCP
+        // RCPS
+        // MRCPS
+        // RCPA
+        // MRCPA
+        // RCPSA
+        // MRCPSA
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<8> cmpeq(SIMDVec_i const & b) const {
+            __m128i m0 = _mm_cmpeq_epi16(mVec, b.mVec);
+            return SIMDVecMask<8>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator== (SIMDVec_i const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<8> cmpeq(int16_t b) const {
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i m0 = _mm_cmpeq_epi16(mVec, t0);
+            return SIMDVecMask<8>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator== (int16_t b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<8> cmpne(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_cmpeq_epi16(mVec, b.mVec);
+            __m128i m0 = _mm_xor_si128(t0, _mm_set1_epi32(0xFFFFFFFF));
+            return SIMDVecMask<8>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator!= (SIMDVec_i const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<8> cmpne(int16_t b) const {
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_cmpeq_epi16(mVec, t0);
+            __m128i m0 = _mm_xor_si128(t1, _mm_set1_epi32(0xFFFFFFFF));
+            return SIMDVecMask<8>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator!= (int16_t b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<8> cmpgt(SIMDVec_i const & b) const {
+            __m128i m0 = _mm_cmpgt_epi16(mVec, b.mVec);
+            return SIMDVecMask<8>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator> (SIMDVec_i const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<8> cmpgt(int16_t b) const {
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i m0 = _mm_cmpgt_epi16(mVec, t0);
+            return SIMDVecMask<8>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator> (int16_t b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<8> cmplt(SIMDVec_i const & b) const {
+            __m128i m0 = _mm_cmpgt_epi16(b.mVec, mVec);
+            return SIMDVecMask<8>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator< (SIMDVec_i const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<8> cmplt(int16_t b) const {
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i m0 = _mm_cmpgt_epi16(t0, mVec);
+            return SIMDVecMask<8>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator< (int16_t b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<8> cmpge(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_max_epi16(mVec, b.mVec);
+            __m128i m0 = _mm_cmpeq_epi16(mVec, t0);
+            return SIMDVecMask<8>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator>= (SIMDVec_i const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<8> cmpge(int16_t b) const {
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_max_epi16(mVec, t0);
+            __m128i m0 = _mm_cmpeq_epi16(mVec, t1);
+            return SIMDVecMask<8>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator>= (int16_t b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<8> cmple(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_min_epi16(mVec, b.mVec);
+            __m128i m0 = _mm_cmpeq_epi16(mVec, t0);
+            return SIMDVecMask<8>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator<= (SIMDVec_i const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<8> cmple(int16_t b) const {
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_min_epi16(mVec, t0);
+            __m128i m0 = _mm_cmpeq_epi16(mVec, t1);
+            return SIMDVecMask<8>::fromEpi16(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator<= (int16_t b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_i const & b) const {
+            __m128i m0 = _mm_cmpeq_epi16(mVec, b.mVec);
+            uint32_t t0 = uint32_t(_mm_movemask_epi8(m0));
+            return t0 == 0xFFFF;
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(int16_t b) const {
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i m0 = _mm_cmpeq_epi16(mVec, t0);
+            uint32_t t1 = uint32_t(_mm_movemask_epi8(m0));
+            return t1 == 0xFFFF;
+        }
+        // UNIQUE
+        // HADD
+        UME_FORCE_INLINE int16_t hadd() const {
+            __m128i t0 = _mm_add_epi16(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_add_epi16(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_add_epi16(t1, _mm_srli_si128(t1, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t2, 0));
+            return retval;
+        }
+        // HADDS
+        UME_FORCE_INLINE int16_t hadd(int16_t b) const {
+            __m128i t0 = _mm_add_epi16(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_add_epi16(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_add_epi16(t1, _mm_srli_si128(t1, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t2, 0));
+            return int16_t(retval + b);
+        }
+        // MHADD
+        UME_FORCE_INLINE int16_t hadd(SIMDVecMask<8> const & mask) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_setzero_si128();
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_add_epi16(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_add_epi16(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_add_epi16(t3, _mm_srli_si128(t3, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t4, 0));
+            return retval;
+        }
+        // MHADDS
+        UME_FORCE_INLINE int16_t hadd(SIMDVecMask<8> const & mask, int16_t b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_setzero_si128();
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_add_epi16(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_add_epi16(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_add_epi16(t3, _mm_srli_si128(t3, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t4, 0));
+            return int16_t(retval + b);
+        }
+        // HMUL
+        // MHMUL
+        // HMULS
+        // MHMULS
+
+        // FMULADDV
+        UME_FORCE_INLINE SIMDVec_i fmuladd(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = _mm_mullo_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_add_epi16(t0, c.mVec);
+            return SIMDVec_i(t1);
+        }
+        // MFMULADDV
+        UME_FORCE_INLINE SIMDVec_i fmuladd(SIMDVecMask<8> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_mullo_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_add_epi16(t0, c.mVec);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // FMULSUBV
+        UME_FORCE_INLINE SIMDVec_i fmulsub(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = _mm_mullo_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_sub_epi16(t0, c.mVec);
+            return SIMDVec_i(t1);
+        }
+        // MFMULSUBV
+        UME_FORCE_INLINE SIMDVec_i fmulsub(SIMDVecMask<8> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_mullo_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_sub_epi16(t0, c.mVec);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // FADDMULV
+        UME_FORCE_INLINE SIMDVec_i faddmul(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = _mm_add_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_mullo_epi16(t0, c.mVec);
+            return SIMDVec_i(t1);
+        }
+        // MFADDMULV
+        UME_FORCE_INLINE SIMDVec_i faddmul(SIMDVecMask<8> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_add_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_mullo_epi16(t0, c.mVec);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // FSUBMULV
+        UME_FORCE_INLINE SIMDVec_i fsubmul(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = _mm_sub_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_mullo_epi16(t0, c.mVec);
+            return SIMDVec_i(t1);
+        }
+        // MFSUBMULV
+        UME_FORCE_INLINE SIMDVec_i fsubmul(SIMDVecMask<8> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_sub_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_mullo_epi16(t0, c.mVec);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+
+        // MAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_max_epi16(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MMAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_max_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // MAXS
+        UME_FORCE_INLINE SIMDVec_i max(int16_t b) const {
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_max_epi16(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MMAXS
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<8> const & mask, int16_t b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_max_epi16(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // MAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVec_i const & b) {
+            mVec = _mm_max_epi16(mVec, b.mVec);
+            return *this;
+        }
+        // MMAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_max_epi16(mVec, b.mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // MAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(int16_t b) {
+            __m128i t0 = _mm_set1_epi16(b);
+            mVec = _mm_max_epi16(mVec, t0);
+            return *this;
+        }
+        // MMAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<8> const & mask, int16_t b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_max_epi16(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // MINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_min_epi16(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MMINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_min_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // MINS
+        UME_FORCE_INLINE SIMDVec_i min(int16_t b) const {
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_min_epi16(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MMINS
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<8> const & mask, int16_t b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_min_epi16(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // MINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVec_i const & b) {
+            mVec = _mm_min_epi16(mVec, b.mVec);
+            return *this;
+        }
+        // MMINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_min_epi16(mVec, b.mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // MINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(int16_t b) {
+            __m128i t0 = _mm_set1_epi16(b);
+            mVec = _mm_min_epi16(mVec, t0);
+            return *this;
+        }
+        // MMINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<8> const & mask, int16_t b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_min_epi16(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // HMAX
+        UME_FORCE_INLINE int16_t hmax() const {
+            __m128i t0 = _mm_max_epi16(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_max_epi16(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_max_epi16(t1, _mm_srli_si128(t1, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t2, 0));
+            return retval;
+        }
+        // MHMAX
+        UME_FORCE_INLINE int16_t hmax(SIMDVecMask<8> const & mask) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16((short)0x8000);
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_max_epi16(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_max_epi16(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_max_epi16(t3, _mm_srli_si128(t3, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t4, 0));
+            return retval;
+        }
+        // IMAX
+        // MIMAX
+        // HMIN
+        UME_FORCE_INLINE int16_t hmin() const {
+            __m128i t0 = _mm_min_epi16(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_min_epi16(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_min_epi16(t1, _mm_srli_si128(t1, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t2, 0));
+            return retval;
+        }
+        // MHMIN
+        UME_FORCE_INLINE int16_t hmin(SIMDVecMask<8> const & mask) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(0x7FFF);
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_min_epi16(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_min_epi16(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_min_epi16(t3, _mm_srli_si128(t3, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t4, 0));
+            return retval;
+        }
+        // IMIN
+        // MIMIN
+
+        // BANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator& (SIMDVec_i const & b) const {
+            return band(b);
+        }
+        // MBANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // BANDS
+        UME_FORCE_INLINE SIMDVec_i band(int16_t b) const {
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator& (int16_t b) const {
+            return band(b);
+        }
+        // MBANDS
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<8> const & mask, int16_t b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // BANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVec_i const & b) {
+            mVec = _mm_and_si128(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (SIMDVec_i const & b) {
+            return banda(b);
+        }
+        // MBANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // BANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(int16_t b) {
+            __m128i t0 = _mm_set1_epi16(b);
+            mVec = _mm_and_si128(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (int16_t b) {
+            return banda(b);
+        }
+        // MBANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<8> const & mask, int16_t b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // BORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (SIMDVec_i const & b) const {
+            return bor(b);
+        }
+        // MBORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // BORS
+        UME_FORCE_INLINE SIMDVec_i bor(int16_t b) const {
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (int16_t b) const {
+            return bor(b);
+        }
+        // MBORS
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<8> const & mask, int16_t b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // BORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVec_i const & b) {
+            mVec = _mm_or_si128(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (SIMDVec_i const & b) {
+            return bora(b);
+        }
+        // MBORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // BORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(int16_t b) {
+            __m128i t0 = _mm_set1_epi16(b);
+            mVec = _mm_or_si128(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (int16_t b) {
+            return bora(b);
+        }
+        // MBORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<8> const & mask, int16_t b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // BXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (SIMDVec_i const & b) const {
+            return bxor(b);
+        }
+        // MBXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // BXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(int16_t b) const {
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (int16_t b) const {
+            return bxor(b);
+        }
+        // MBXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<8> const & mask, int16_t b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // BXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVec_i const & b) {
+            mVec = _mm_xor_si128(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (SIMDVec_i const & b) {
+            return bxora(b);
+        }
+        // MBXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // BXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(int16_t b) {
+            __m128i t0 = _mm_set1_epi16(b);
+            mVec = _mm_xor_si128(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (int16_t b) {
+            return bxora(b);
+        }
+        // MBXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<8> const & mask, int16_t b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi16(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // BNOT
+        UME_FORCE_INLINE SIMDVec_i bnot() const {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator~ () const {
+            return bnot();
+        }
+        // MBNOT
+        UME_FORCE_INLINE SIMDVec_i bnot(SIMDVecMask<8> const & mask) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // BNOTA
+        UME_FORCE_INLINE SIMDVec_i & bnota() {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            mVec = _mm_xor_si128(mVec, t0);
+            return *this;
+        }
+        // MBNOTA
+        UME_FORCE_INLINE SIMDVec_i & bnota(SIMDVecMask<8> const & mask) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // HBAND
+        UME_FORCE_INLINE int16_t hband() const {
+            __m128i t0 = _mm_and_si128(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_and_si128(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_and_si128(t1, _mm_srli_si128(t1, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t2, 0));
+            return retval;
+        }
+        // HBANDS
+        UME_FORCE_INLINE int16_t hband(int16_t b) const {
+            __m128i t0 = _mm_and_si128(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_and_si128(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_and_si128(t1, _mm_srli_si128(t1, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t2, 0));
+            return int16_t(retval & b);
+        }
+        // MHBAND
+        UME_FORCE_INLINE int16_t hband(SIMDVecMask<8> const & mask) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_and_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_and_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_and_si128(t3, _mm_srli_si128(t3, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t4, 0));
+            return retval;
+        }
+        // MHBANDS
+        UME_FORCE_INLINE int16_t hband(SIMDVecMask<8> const & mask, int16_t b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_and_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_and_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_and_si128(t3, _mm_srli_si128(t3, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t4, 0));
+            return int16_t(retval & b);
+        }
+        // HBOR
+        UME_FORCE_INLINE int16_t hbor() const {
+            __m128i t0 = _mm_or_si128(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_or_si128(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_or_si128(t1, _mm_srli_si128(t1, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t2, 0));
+            return retval;
+        }
+        // HBORS
+        UME_FORCE_INLINE int16_t hbor(int16_t b) const {
+            __m128i t0 = _mm_or_si128(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_or_si128(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_or_si128(t1, _mm_srli_si128(t1, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t2, 0));
+            return int16_t(retval | b);
+        }
+        // MHBOR
+        UME_FORCE_INLINE int16_t hbor(SIMDVecMask<8> const & mask) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_setzero_si128();
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_or_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_or_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_or_si128(t3, _mm_srli_si128(t3, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t4, 0));
+            return retval;
+        }
+        // MHBORS
+        UME_FORCE_INLINE int16_t hbor(SIMDVecMask<8> const & mask, int16_t b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_setzero_si128();
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_or_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_or_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_or_si128(t3, _mm_srli_si128(t3, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t4, 0));
+            return int16_t(retval | b);
+        }
+        // HBXOR
+        UME_FORCE_INLINE int16_t hbxor() const {
+            __m128i t0 = _mm_xor_si128(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_xor_si128(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_xor_si128(t1, _mm_srli_si128(t1, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t2, 0));
+            return retval;
+        }
+        // HBXORS
+        UME_FORCE_INLINE int16_t hbxor(int16_t b) const {
+            __m128i t0 = _mm_xor_si128(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_xor_si128(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_xor_si128(t1, _mm_srli_si128(t1, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t2, 0));
+            return int16_t(retval ^ b);
+        }
+        // MHBXOR
+        UME_FORCE_INLINE int16_t hbxor(SIMDVecMask<8> const & mask) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_setzero_si128();
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_xor_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_xor_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_xor_si128(t3, _mm_srli_si128(t3, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t4, 0));
+            return retval;
+        }
+        // MHBXORS
+        UME_FORCE_INLINE int16_t hbxor(SIMDVecMask<8> const & mask, int16_t b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_setzero_si128();
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_xor_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_xor_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_xor_si128(t3, _mm_srli_si128(t3, 2));
+            int16_t retval = int16_t(_mm_extract_epi16(t4, 0));
+            return int16_t(retval ^ b);
+        }
+
+        // GATHERU
+        // MGATHERU
+        // GATHERS
+        // MGATHERS
+        // GATHERV
+        // MGATHERV
+        // SCATTERU
+        // MSCATTERU
+        // SCATTERS
+        // MSCATTERS
+        // SCATTERV
+        // MSCATTERV
+
+        // LSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVec_u<uint16_t, 8> const & b) const {
+            __m256i t0 = _mm256_cvtepu16_epi32(mVec);
+            __m256i t1 = _mm256_cvtepu16_epi32(b.mVec);
+            __m256i t2 = _mm256_sllv_epi32(t0, t1);
+            __m256i t3 = _mm256_and_si256(t2, _mm256_set1_epi32(0xFFFF));
+            __m128i t4 = _mm_packus_epi32(_mm256_extracti128_si256(t3, 0), _mm256_extracti128_si256(t3, 1));
+            return SIMDVec_i(t4);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (SIMDVec_u<uint16_t, 8> const & b) const {
+            return lsh(b);
+        }
+        // MLSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<8> const & mask, SIMDVec_u<uint16_t, 8> const & b) const {
+            __m128i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_cvtepu16_epi32(mVec);
+            __m256i t1 = _mm256_cvtepu16_epi32(b.mVec);
+            __m256i t2 = _mm256_sllv_epi32(t0, t1);
+            __m256i t3 = _mm256_and_si256(t2, _mm256_set1_epi32(0xFFFF));
+            __m128i t4 = _mm_packus_epi32(_mm256_extracti128_si256(t3, 0), _mm256_extracti128_si256(t3, 1));
+            __m128i t5 = _mm_blendv_epi8(mVec, t4, m0);
+            return SIMDVec_i(t5);
+        }
+        // LSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(uint16_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            __m128i t1 = _mm_sll_epi16(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (uint16_t b) const {
+            return lsh(b);
+        }
+        // MLSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<8> const & mask, uint16_t b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            __m128i t1 = _mm_sll_epi16(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // LSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVec_u<uint16_t, 8> const & b) {
+            __m256i t0 = _mm256_cvtepu16_epi32(mVec);
+            __m256i t1 = _mm256_cvtepu16_epi32(b.mVec);
+            __m256i t2 = _mm256_sllv_epi32(t0, t1);
+            __m256i t3 = _mm256_and_si256(t2, _mm256_set1_epi32(0xFFFF));
+            mVec = _mm_packus_epi32(_mm256_extracti128_si256(t3, 0), _mm256_extracti128_si256(t3, 1));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (SIMDVec_u<uint16_t, 8> const & b) {
+            return lsha(b);
+        }
+        // MLSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<8> const & mask, SIMDVec_u<uint16_t, 8> const & b) {
+            __m128i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_cvtepu16_epi32(mVec);
+            __m256i t1 = _mm256_cvtepu16_epi32(b.mVec);
+            __m256i t2 = _mm256_sllv_epi32(t0, t1);
+            __m256i t3 = _mm256_and_si256(t2, _mm256_set1_epi32(0xFFFF));
+            __m128i t4 = _mm_packus_epi32(_mm256_extracti128_si256(t3, 0), _mm256_extracti128_si256(t3, 1));
+            mVec = _mm_blendv_epi8(mVec, t4, m0);
+            return *this;
+        }
+        // LSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(uint16_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            mVec = _mm_sll_epi16(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (uint16_t b) {
+            return lsha(b);
+        }
+        // MLSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<8> const & mask, uint16_t b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            __m128i t1 = _mm_sll_epi16(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // RSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVec_u<uint16_t, 8> const & b) const {
+            __m256i t0 = _mm256_cvtepi16_epi32(mVec);
+            __m256i t1 = _mm256_cvtepu16_epi32(b.mVec);
+            __m256i t2 = _mm256_srav_epi32(t0, t1);
+            __m128i t3 = _mm_packs_epi32(_mm256_extracti128_si256(t2, 0), _mm256_extracti128_si256(t2, 1));
+            return SIMDVec_i(t3);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (SIMDVec_u<uint16_t, 8> const & b) const {
+            return rsh(b);
+        }
+        // MRSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<8> const & mask, SIMDVec_u<uint16_t, 8> const & b) const {
+            __m128i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_cvtepi16_epi32(mVec);
+            __m256i t1 = _mm256_cvtepu16_epi32(b.mVec);
+            __m256i t2 = _mm256_srav_epi32(t0, t1);
+            __m128i t3 = _mm_packs_epi32(_mm256_extracti128_si256(t2, 0), _mm256_extracti128_si256(t2, 1));
+            __m128i t4 = _mm_blendv_epi8(mVec, t3, m0);
+            return SIMDVec_i(t4);
+        }
+        // RSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(uint16_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            __m128i t1 = _mm_sra_epi16(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (uint16_t b) const {
+            return rsh(b);
+        }
+        // MRSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<8> const & mask, uint16_t b) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            __m128i t1 = _mm_sra_epi16(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // RSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVec_u<uint16_t, 8> const & b) {
+            __m256i t0 = _mm256_cvtepi16_epi32(mVec);
+            __m256i t1 = _mm256_cvtepu16_epi32(b.mVec);
+            __m256i t2 = _mm256_srav_epi32(t0, t1);
+            mVec = _mm_packs_epi32(_mm256_extracti128_si256(t2, 0), _mm256_extracti128_si256(t2, 1));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (SIMDVec_u<uint16_t, 8> const & b) {
+            return rsha(b);
+        }
+        // MRSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<8> const & mask, SIMDVec_u<uint16_t, 8> const & b) {
+            __m128i m0 = mask.toEpi16();
+            __m256i t0 = _mm256_cvtepi16_epi32(mVec);
+            __m256i t1 = _mm256_cvtepu16_epi32(b.mVec);
+            __m256i t2 = _mm256_srav_epi32(t0, t1);
+            __m128i t3 = _mm_packs_epi32(_mm256_extracti128_si256(t2, 0), _mm256_extracti128_si256(t2, 1));
+            mVec = _mm_blendv_epi8(mVec, t3, m0);
+            return *this;
+        }
+        // RSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(uint16_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            mVec = _mm_sra_epi16(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (uint16_t b) {
+            return rsha(b);
+        }
+        // MRSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<8> const & mask, uint16_t b) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            __m128i t1 = _mm_sra_epi16(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // ROLV
+        // MROLV
+        // ROLS
+        // MROLS
+        // ROLVA
+        // MROLVA
+        // ROLSA
+        // MROLSA
+        // RORV
+        // MRORV
+        // RORS
+        // MRORS
+        // RORVA
+        // MRORVA
+        // RORSA
+        // MRORSA
+
+        // NEG
+        UME_FORCE_INLINE SIMDVec_i neg() const {
+            __m128i t0 = _mm_sub_epi16(_mm_setzero_si128(), mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- () const {
+            return neg();
+        }
+        // MNEG
+        UME_FORCE_INLINE SIMDVec_i neg(SIMDVecMask<8> const & mask) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_sub_epi16(_mm_setzero_si128(), mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // NEGA
+        UME_FORCE_INLINE SIMDVec_i & nega() {
+            mVec = _mm_sub_epi16(_mm_setzero_si128(), mVec);
+            return *this;
+        }
+        // MNEGA
+        UME_FORCE_INLINE SIMDVec_i & nega(SIMDVecMask<8> const & mask) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_sub_epi16(_mm_setzero_si128(), mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // ABS
+        UME_FORCE_INLINE SIMDVec_i abs() const {
+            __m128i t0 = _mm_abs_epi16(mVec);
+            return SIMDVec_i(t0);
+        }
+        // MABS
+        UME_FORCE_INLINE SIMDVec_i abs(SIMDVecMask<8> const & mask) const {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_abs_epi16(mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // ABSA
+        UME_FORCE_INLINE SIMDVec_i & absa() {
+            mVec = _mm_abs_epi16(mVec);
+            return *this;
+        }
+        // MABSA
+        UME_FORCE_INLINE SIMDVec_i & absa(SIMDVecMask<8> const & mask) {
+            __m128i m0 = mask.toEpi16();
+            __m128i t0 = _mm_abs_epi16(mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+
+        // PACK
+        // PACKLO
+        // PACKHI
+        // UNPACK
+        // UNPACKLO
+        // UNPACKHI
+
+        // PROMOTE
+        UME_FORCE_INLINE operator SIMDVec_i<int32_t, 8>() const;
+        // DEGRADE
+        UME_FORCE_INLINE operator SIMDVec_i<int8_t, 8>() const;
+
+        // ITOU
+        UME_FORCE_INLINE operator SIMDVec_u<uint16_t, 8>() const;
+        // ITOF
+        // -
+
+    };
+
+}
+}
+
+#endif
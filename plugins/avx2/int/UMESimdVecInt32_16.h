@@ -57,10 +57,104 @@ namespace SIMD {
         friend class SIMDVec_u<uint32_t, 16>;
         friend class SIMDVec_f<float, 16>;
         friend class SIMDVec_f<double, 16>;
+        friend class SIMDVec_i<int16_t, 16>;
     private:
         __m256i mVec[2];
 
         UME_FORCE_INLINE explicit SIMDVec_i(__m256i & x0, __m256i & x1) { mVec[0] = x0; mVec[1] = x1; }
+
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m256i saturatedAdd(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_add_epi32(a, b);
+            __m256i t1 = _mm256_andnot_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, t0));
+            __m256i t2 = _mm256_xor_si256(_mm256_srai_epi32(a, 31), _mm256_set1_epi32(0x7FFFFFFF));
+            return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(t0), _mm256_castsi256_ps(t2), _mm256_castsi256_ps(t1)));
+        }
+        static UME_FORCE_INLINE __m256i saturatedSub(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_sub_epi32(a, b);
+            __m256i t1 = _mm256_and_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, t0));
+            __m256i t2 = _mm256_xor_si256(_mm256_srai_epi32(a, 31), _mm256_set1_epi32(0x7FFFFFFF));
+            return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(t0), _mm256_castsi256_ps(t2), _mm256_castsi256_ps(t1)));
+        }
+        // Lane-wise division through double precision, exact for 32-bit operands.
+        static UME_FORCE_INLINE __m128i divideHalf(__m128i const & a, __m128i const & b) {
+            __m256d t0 = _mm256_div_pd(_mm256_cvtepi32_pd(a), _mm256_cvtepi32_pd(b));
+            return _mm256_cvttpd_epi32(t0);
+        }
+        static UME_FORCE_INLINE __m256i divideVector(__m256i const & a, __m256i const & b) {
+            __m128i t0 = divideHalf(_mm256_castsi256_si128(a), _mm256_castsi256_si128(b));
+            __m128i t1 = divideHalf(_mm256_extracti128_si256(a, 1), _mm256_extracti128_si256(b, 1));
+            return _mm256_inserti128_si256(_mm256_castsi128_si256(t0), t1, 1);
+        }
+        static UME_FORCE_INLINE __m256i remainderVector(__m256i const & a, __m256i const & b) {
+            __m256i t0 = divideVector(a, b);
+            return _mm256_sub_epi32(a, _mm256_mullo_epi32(t0, b));
+        }
+        // Division by a precomputed divisor, used by DIVD*/REMD*.
+        static UME_FORCE_INLINE __m256i divideMagic(__m256i const & a, SIMDDivisor<int32_t> const & b) {
+            __m256i t0 = _mm256_set1_epi32(b.magic());
+            __m256i t1 = _mm256_mul_epi32(a, t0);
+            __m256i t2 = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), t0);
+            __m256i t3 = _mm256_blend_epi32(_mm256_srli_epi64(t1, 32), t2, 0xAA);
+            __m256i t4 = _mm256_add_epi32(t3, a);
+            __m256i t5 = _mm256_and_si256(_mm256_srai_epi32(t4, 31), _mm256_set1_epi32(b.mask()));
+            __m256i t6 = _mm256_sra_epi32(_mm256_add_epi32(t4, t5), _mm_cvtsi32_si128(b.shift()));
+            __m256i t7 = _mm256_set1_epi32(b.sign());
+            return _mm256_sub_epi32(_mm256_xor_si256(t6, t7), t7);
+        }
+        static UME_FORCE_INLINE __m256i remainderMagic(__m256i const & a, SIMDDivisor<int32_t> const & b) {
+            __m256i t0 = divideMagic(a, b);
+            return _mm256_sub_epi32(a, _mm256_mullo_epi32(t0, _mm256_set1_epi32(b.divisor())));
+        }
+        // Writes lanes of 'v' selected by bits of 'm' to baseAddr[indices[i]],
+        // in lane order. Indices are moved to general purpose registers in
+        // pairs, so neither vector makes a round trip through the stack.
+        static UME_FORCE_INLINE void scatterLanes(int32_t * baseAddr, __m256i v, __m256i indices, int m) {
+            __m128i v0 = _mm256_castsi256_si128(v);
+            __m128i v1 = _mm256_extracti128_si256(v, 1);
+            __m128i t0 = _mm256_castsi256_si128(indices);
+            __m128i t1 = _mm256_extracti128_si256(indices, 1);
+            uint64_t x0 = uint64_t(_mm_cvtsi128_si64(v0));
+            uint64_t x1 = uint64_t(_mm_extract_epi64(v0, 1));
+            uint64_t x2 = uint64_t(_mm_cvtsi128_si64(v1));
+            uint64_t x3 = uint64_t(_mm_extract_epi64(v1, 1));
+            uint64_t i0 = uint64_t(_mm_cvtsi128_si64(t0));
+            uint64_t i1 = uint64_t(_mm_extract_epi64(t0, 1));
+            uint64_t i2 = uint64_t(_mm_cvtsi128_si64(t1));
+            uint64_t i3 = uint64_t(_mm_extract_epi64(t1, 1));
+            if (m & 0x01) baseAddr[uint32_t(i0)] = int32_t(x0);
+            if (m & 0x02) baseAddr[uint32_t(i0 >> 32)] = int32_t(x0 >> 32);
+            if (m & 0x04) baseAddr[uint32_t(i1)] = int32_t(x1);
+            if (m & 0x08) baseAddr[uint32_t(i1 >> 32)] = int32_t(x1 >> 32);
+            if (m & 0x10) baseAddr[uint32_t(i2)] = int32_t(x2);
+            if (m & 0x20) baseAddr[uint32_t(i2 >> 32)] = int32_t(x2 >> 32);
+            if (m & 0x40) baseAddr[uint32_t(i3)] = int32_t(x3);
+            if (m & 0x80) baseAddr[uint32_t(i3 >> 32)] = int32_t(x3 >> 32);
+        }
+        // Adds lanes of 'v' selected by bits of 'm' to baseAddr[indices[i]],
+        // in lane order, so that lanes with repeating indices accumulate.
+        static UME_FORCE_INLINE void scatterAddLanes(int32_t * baseAddr, __m256i v, __m256i indices, int m) {
+            __m128i v0 = _mm256_castsi256_si128(v);
+            __m128i v1 = _mm256_extracti128_si256(v, 1);
+            __m128i t0 = _mm256_castsi256_si128(indices);
+            __m128i t1 = _mm256_extracti128_si256(indices, 1);
+            uint64_t x0 = uint64_t(_mm_cvtsi128_si64(v0));
+            uint64_t x1 = uint64_t(_mm_extract_epi64(v0, 1));
+            uint64_t x2 = uint64_t(_mm_cvtsi128_si64(v1));
+            uint64_t x3 = uint64_t(_mm_extract_epi64(v1, 1));
+            uint64_t i0 = uint64_t(_mm_cvtsi128_si64(t0));
+            uint64_t i1 = uint64_t(_mm_extract_epi64(t0, 1));
+            uint64_t i2 = uint64_t(_mm_cvtsi128_si64(t1));
+            uint64_t i3 = uint64_t(_mm_extract_epi64(t1, 1));
+            if (m & 0x01) baseAddr[uint32_t(i0)] += int32_t(x0);
+            if (m & 0x02) baseAddr[uint32_t(i0 >> 32)] += int32_t(x0 >> 32);
+            if (m & 0x04) baseAddr[uint32_t(i1)] += int32_t(x1);
+            if (m & 0x08) baseAddr[uint32_t(i1 >> 32)] += int32_t(x1 >> 32);
+            if (m & 0x10) baseAddr[uint32_t(i2)] += int32_t(x2);
+            if (m & 0x20) baseAddr[uint32_t(i2 >> 32)] += int32_t(x2 >> 32);
+            if (m & 0x40) baseAddr[uint32_t(i3)] += int32_t(x3);
+            if (m & 0x80) baseAddr[uint32_t(i3 >> 32)] += int32_t(x3 >> 32);
+        }
     public:
 
         constexpr static uint32_t length() { return 16; }
@@ -261,10 +355,35 @@ namespace SIMD {
             _mm256_stream_si256((__m256i*)(p + 8), t3);
             return p;
         }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressstore(SIMDVecMask<16> const & mask, int32_t * p) const {
+            uint32_t t0 = SIMDVec_i<int32_t, 8>::compressLanes(p, mVec[0], _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[0])));
+            uint32_t t1 = SIMDVec_i<int32_t, 8>::compressLanes(p + t0, mVec[1], _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[1])));
+            return t0 + t1;
+        }
         // BLENDV
         // BLENDS
         // SWIZZLE 
         // SWIZZLEA
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() const {
+            // Sorting the halves in opposite directions gives a bitonic sequence.
+            __m256i t0 = SIMDVec_i<int32_t, 8>::sortLanes(mVec[0]);
+            __m256i t1 = SIMDVec_i<int32_t, 8>::reverseLanes(SIMDVec_i<int32_t, 8>::sortLanes(mVec[1]));
+            __m256i t2 = SIMDVec_i<int32_t, 8>::mergeLanes(_mm256_min_epi32(t0, t1));
+            __m256i t3 = SIMDVec_i<int32_t, 8>::mergeLanes(_mm256_max_epi32(t0, t1));
+            return SIMDVec_i(t2, t3);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() const {
+            __m256i t0 = SIMDVec_i<int32_t, 8>::sortLanes(mVec[0]);
+            __m256i t1 = SIMDVec_i<int32_t, 8>::reverseLanes(SIMDVec_i<int32_t, 8>::sortLanes(mVec[1]));
+            __m256i t2 = SIMDVec_i<int32_t, 8>::mergeLanes(_mm256_min_epi32(t0, t1));
+            __m256i t3 = SIMDVec_i<int32_t, 8>::mergeLanes(_mm256_max_epi32(t0, t1));
+            __m256i t4 = SIMDVec_i<int32_t, 8>::reverseLanes(t3);
+            __m256i t5 = SIMDVec_i<int32_t, 8>::reverseLanes(t2);
+            return SIMDVec_i(t4, t5);
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
@@ -338,13 +457,65 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m256i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            __m256i t1 = saturatedAdd(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t2 = saturatedAdd(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedAdd(mVec[0], t0);
+            __m256i t2 = saturatedAdd(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<16> const & mask, int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedAdd(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t3 = saturatedAdd(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_i(t2, t4);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec[0] = saturatedAdd(mVec[0], b.mVec[0]);
+            mVec[1] = saturatedAdd(mVec[1], b.mVec[1]);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t1 = saturatedAdd(mVec[1], b.mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec[0] = saturatedAdd(mVec[0], t0);
+            mVec[1] = saturatedAdd(mVec[1], t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<16> const & mask, int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedAdd(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t2 = saturatedAdd(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_i postinc() {
             __m256i t0 = _mm256_set1_epi32(1);
@@ -456,13 +627,65 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m256i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            __m256i t1 = saturatedSub(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t2 = saturatedSub(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedSub(mVec[0], t0);
+            __m256i t2 = saturatedSub(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<16> const & mask, int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedSub(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t3 = saturatedSub(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_i(t2, t4);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec[0] = saturatedSub(mVec[0], b.mVec[0]);
+            mVec[1] = saturatedSub(mVec[1], b.mVec[1]);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t1 = saturatedSub(mVec[1], b.mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec[0] = saturatedSub(mVec[0], t0);
+            mVec[1] = saturatedSub(mVec[1], t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<16> const & mask, int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedSub(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t2 = saturatedSub(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
             __m256i t0 = _mm256_sub_epi32(b.mVec[0], mVec[0]);
@@ -632,25 +855,217 @@ namespace SIMD {
             return *this;
         }
         // DIVV
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVec_i const & b) const {
+            __m256i t0 = divideVector(mVec[0], b.mVec[0]);
+            __m256i t1 = divideVector(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
         UME_FORCE_INLINE SIMDVec_i operator/ (SIMDVec_i const & b) const {
             return div(b);
         }
         // MDIVV
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = divideVector(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t2 = divideVector(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
         // DIVS
+        UME_FORCE_INLINE SIMDVec_i div(int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = divideVector(mVec[0], t0);
+            __m256i t2 = divideVector(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
         UME_FORCE_INLINE SIMDVec_i operator/ (int32_t b) const {
             return div(b);
         }
         // MDIVS
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<16> const & mask, int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = divideVector(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t3 = divideVector(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_i(t2, t4);
+        }
         // DIVVA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVec_i const & b) {
+            mVec[0] = divideVector(mVec[0], b.mVec[0]);
+            mVec[1] = divideVector(mVec[1], b.mVec[1]);
+            return *this;
+        }
         UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDVec_i const & b) {
             return diva(b);
         }
         // MDIVVA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = divideVector(mVec[0], b.mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t1 = divideVector(mVec[1], b.mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
         // DIVSA
+        UME_FORCE_INLINE SIMDVec_i & diva(int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec[0] = divideVector(mVec[0], t0);
+            mVec[1] = divideVector(mVec[1], t0);
+            return *this;
+        }
         UME_FORCE_INLINE SIMDVec_i & operator/= (int32_t b) {
             return diva(b);
         }
         // MDIVSA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<16> const & mask, int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = divideVector(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t2 = divideVector(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDDivisor<int32_t> const & b) const {
+            __m256i t0 = divideMagic(mVec[0], b);
+            __m256i t1 = divideMagic(mVec[1], b);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (SIMDDivisor<int32_t> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<16> const & mask, SIMDDivisor<int32_t> const & b) const {
+            __m256i t0 = divideMagic(mVec[0], b);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t2 = divideMagic(mVec[1], b);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDDivisor<int32_t> const & b) {
+            mVec[0] = divideMagic(mVec[0], b);
+            mVec[1] = divideMagic(mVec[1], b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDDivisor<int32_t> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<16> const & mask, SIMDDivisor<int32_t> const & b) {
+            __m256i t0 = divideMagic(mVec[0], b);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t1 = divideMagic(mVec[1], b);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // REMV
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVec_i const & b) const {
+            __m256i t0 = remainderVector(mVec[0], b.mVec[0]);
+            __m256i t1 = remainderVector(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (SIMDVec_i const & b) const {
+            return rem(b);
+        }
+        // MREMV
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = remainderVector(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t2 = remainderVector(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // REMS
+        UME_FORCE_INLINE SIMDVec_i rem(int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = remainderVector(mVec[0], t0);
+            __m256i t2 = remainderVector(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (int32_t b) const {
+            return rem(b);
+        }
+        // MREMS
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<16> const & mask, int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = remainderVector(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t3 = remainderVector(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_i(t2, t4);
+        }
+        // REMVA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVec_i const & b) {
+            mVec[0] = remainderVector(mVec[0], b.mVec[0]);
+            mVec[1] = remainderVector(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (SIMDVec_i const & b) {
+            return rema(b);
+        }
+        // MREMVA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = remainderVector(mVec[0], b.mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t1 = remainderVector(mVec[1], b.mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // REMSA
+        UME_FORCE_INLINE SIMDVec_i & rema(int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec[0] = remainderVector(mVec[0], t0);
+            mVec[1] = remainderVector(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (int32_t b) {
+            return rema(b);
+        }
+        // MREMSA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<16> const & mask, int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = remainderVector(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t2 = remainderVector(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // REMD
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDDivisor<int32_t> const & b) const {
+            __m256i t0 = remainderMagic(mVec[0], b);
+            __m256i t1 = remainderMagic(mVec[1], b);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (SIMDDivisor<int32_t> const & b) const {
+            return rem(b);
+        }
+        // MREMD
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<16> const & mask, SIMDDivisor<int32_t> const & b) const {
+            __m256i t0 = remainderMagic(mVec[0], b);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t2 = remainderMagic(mVec[1], b);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // REMDA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDDivisor<int32_t> const & b) {
+            mVec[0] = remainderMagic(mVec[0], b);
+            mVec[1] = remainderMagic(mVec[1], b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (SIMDDivisor<int32_t> const & b) {
+            return rema(b);
+        }
+        // MREMDA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<16> const & mask, SIMDDivisor<int32_t> const & b) {
+            __m256i t0 = remainderMagic(mVec[0], b);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t1 = remainderMagic(mVec[1], b);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
         // RCP
         // MRCP
         // RCPS
@@ -1635,83 +2050,424 @@ namespace SIMD {
         }
         // SCATTERS
         UME_FORCE_INLINE int32_t* scatter(int32_t* baseAddr, uint32_t* indices) const {
-            alignas(32) int32_t raw[16];
-            _mm256_store_si256((__m256i*) raw, mVec[0]);
-            _mm256_store_si256((__m256i*) (raw + 8), mVec[1]);
-            for (int i = 0; i < 16; i++) { baseAddr[indices[i]] = raw[i]; };
+            scatterLanes(baseAddr, mVec[0], _mm256_loadu_si256((__m256i*)indices), 0xFF);
+            scatterLanes(baseAddr, mVec[1], _mm256_loadu_si256((__m256i*)(indices + 8)), 0xFF);
             return baseAddr;
         }
         // MSCATTERS
         UME_FORCE_INLINE int32_t* scatter(SIMDVecMask<16> const & mask, int32_t* baseAddr, uint32_t* indices) const {
-            alignas(32) int32_t raw[16];
-            alignas(32) uint32_t rawMask[16];
-            _mm256_store_si256((__m256i*) raw, mVec[0]);
-            _mm256_store_si256((__m256i*) rawMask, mask.mMask[0]);
-            _mm256_store_si256((__m256i*) (raw + 8), mVec[1]);
-            _mm256_store_si256((__m256i*) (rawMask + 8), mask.mMask[1]);
-            for (int i = 0; i < 16; i++) { if (rawMask[i] == SIMDVecMask<16>::TRUE_VAL()) baseAddr[indices[i]] = raw[i]; };
+            scatterLanes(baseAddr, mVec[0], _mm256_loadu_si256((__m256i*)indices), _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[0])));
+            scatterLanes(baseAddr, mVec[1], _mm256_loadu_si256((__m256i*)(indices + 8)), _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[1])));
             return baseAddr;
         }
         // SCATTERV
         UME_FORCE_INLINE int32_t* scatter(int32_t* baseAddr, SIMDVec_i const & indices) const {
-            alignas(32) int32_t raw[16];
-            alignas(32) uint32_t rawIndices[16];
-            _mm256_store_si256((__m256i*) raw, mVec[0]);
-            _mm256_store_si256((__m256i*) rawIndices, indices.mVec[0]);
-            _mm256_store_si256((__m256i*) (raw + 8), mVec[1]);
-            _mm256_store_si256((__m256i*) (rawIndices + 8), indices.mVec[1]);
-            for (int i = 0; i < 16; i++) { baseAddr[rawIndices[i]] = raw[i]; };
+            scatterLanes(baseAddr, mVec[0], indices.mVec[0], 0xFF);
+            scatterLanes(baseAddr, mVec[1], indices.mVec[1], 0xFF);
             return baseAddr;
         }
         // MSCATTERV
         UME_FORCE_INLINE int32_t* scatter(SIMDVecMask<16> const & mask, int32_t* baseAddr, SIMDVec_i const & indices) const {
-            alignas(32) int32_t raw[16];
-            alignas(32) uint32_t rawIndices[16];
-            alignas(32) uint32_t rawMask[16];
-            _mm256_store_si256((__m256i*) raw, mVec[0]);
-            _mm256_store_si256((__m256i*) rawIndices, indices.mVec[0]);
-            _mm256_store_si256((__m256i*) rawMask, mask.mMask[0]);
-            _mm256_store_si256((__m256i*) (raw + 8), mVec[1]);
-            _mm256_store_si256((__m256i*) (rawIndices + 8), indices.mVec[1]);
-            _mm256_store_si256((__m256i*) (rawMask + 8), mask.mMask[1]);
-            for (int i = 0; i < 16; i++) {
-                if (rawMask[i] == SIMDVecMask<16>::TRUE_VAL())
-                    baseAddr[rawIndices[i]] = raw[i];
-            };
+            scatterLanes(baseAddr, mVec[0], indices.mVec[0], _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[0])));
+            scatterLanes(baseAddr, mVec[1], indices.mVec[1], _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[1])));
+            return baseAddr;
+        }
+        // SCATTERADDV
+        UME_FORCE_INLINE int32_t* scatteradd(int32_t* baseAddr, SIMDVec_u<uint32_t, 16> const & indices) const {
+            scatterAddLanes(baseAddr, mVec[0], indices.mVec[0], 0xFF);
+            scatterAddLanes(baseAddr, mVec[1], indices.mVec[1], 0xFF);
+            return baseAddr;
+        }
+        // MSCATTERADDV
+        UME_FORCE_INLINE int32_t* scatteradd(SIMDVecMask<16> const & mask, int32_t* baseAddr, SIMDVec_u<uint32_t, 16> const & indices) const {
+            scatterAddLanes(baseAddr, mVec[0], indices.mVec[0], _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[0])));
+            scatterAddLanes(baseAddr, mVec[1], indices.mVec[1], _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[1])));
             return baseAddr;
         }
         // LSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVec_u<uint32_t, 16> const & b) const {
+            __m256i t0 = _mm256_sllv_epi32(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_sllv_epi32(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (SIMDVec_u<uint32_t, 16> const & b) const {
+            return lsh(b);
+        }
         // MLSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<16> const & mask, SIMDVec_u<uint32_t, 16> const & b) const {
+            __m256i t0 = _mm256_sllv_epi32(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t2 = _mm256_sllv_epi32(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
         // LSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sll_epi32(mVec[0], t0);
+            __m256i t2 = _mm256_sll_epi32(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (uint32_t b) const {
+            return lsh(b);
+        }
         // MLSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<16> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sll_epi32(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t3 = _mm256_sll_epi32(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_i(t2, t4);
+        }
         // LSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVec_u<uint32_t, 16> const & b) {
+            mVec[0] = _mm256_sllv_epi32(mVec[0], b.mVec[0]);
+            mVec[1] = _mm256_sllv_epi32(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (SIMDVec_u<uint32_t, 16> const & b) {
+            return lsha(b);
+        }
         // MLSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<16> const & mask, SIMDVec_u<uint32_t, 16> const & b) {
+            __m256i t0 = _mm256_sllv_epi32(mVec[0], b.mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t1 = _mm256_sllv_epi32(mVec[1], b.mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
         // LSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec[0] = _mm256_sll_epi32(mVec[0], t0);
+            mVec[1] = _mm256_sll_epi32(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (uint32_t b) {
+            return lsha(b);
+        }
         // MLSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<16> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sll_epi32(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t2 = _mm256_sll_epi32(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
         // RSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVec_u<uint32_t, 16> const & b) const {
+            __m256i t0 = _mm256_srav_epi32(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_srav_epi32(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (SIMDVec_u<uint32_t, 16> const & b) const {
+            return rsh(b);
+        }
         // MRSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<16> const & mask, SIMDVec_u<uint32_t, 16> const & b) const {
+            __m256i t0 = _mm256_srav_epi32(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t2 = _mm256_srav_epi32(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
         // RSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sra_epi32(mVec[0], t0);
+            __m256i t2 = _mm256_sra_epi32(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (uint32_t b) const {
+            return rsh(b);
+        }
         // MRSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<16> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sra_epi32(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t3 = _mm256_sra_epi32(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_i(t2, t4);
+        }
         // RSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVec_u<uint32_t, 16> const & b) {
+            mVec[0] = _mm256_srav_epi32(mVec[0], b.mVec[0]);
+            mVec[1] = _mm256_srav_epi32(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (SIMDVec_u<uint32_t, 16> const & b) {
+            return rsha(b);
+        }
         // MRSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<16> const & mask, SIMDVec_u<uint32_t, 16> const & b) {
+            __m256i t0 = _mm256_srav_epi32(mVec[0], b.mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t1 = _mm256_srav_epi32(mVec[1], b.mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
         // RSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec[0] = _mm256_sra_epi32(mVec[0], t0);
+            mVec[1] = _mm256_sra_epi32(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (uint32_t b) {
+            return rsha(b);
+        }
         // MRSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<16> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sra_epi32(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t2 = _mm256_sra_epi32(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
         // ROLV
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVec_u<uint32_t, 16> const & b) const {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec[0], t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec[0], t2);
+            __m256i t5 = _mm256_srlv_epi32(mVec[0], t3);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            __m256i t7 = _mm256_and_si256(b.mVec[1], t0);
+            __m256i t8 = _mm256_sub_epi32(t1, t7);
+            __m256i t9 = _mm256_sllv_epi32(mVec[1], t7);
+            __m256i t10 = _mm256_srlv_epi32(mVec[1], t8);
+            __m256i t11 = _mm256_or_si256(t9, t10);
+            return SIMDVec_i(t6, t11);
+        }
         // MROLV
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVecMask<16> const & mask, SIMDVec_u<uint32_t, 16> const & b) const {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec[0], t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec[0], t2);
+            __m256i t5 = _mm256_srlv_epi32(mVec[0], t3);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            __m256i t7 = _mm256_blendv_epi8(mVec[0], t6, mask.mMask[0]);
+            __m256i t8 = _mm256_and_si256(b.mVec[1], t0);
+            __m256i t9 = _mm256_sub_epi32(t1, t8);
+            __m256i t10 = _mm256_sllv_epi32(mVec[1], t8);
+            __m256i t11 = _mm256_srlv_epi32(mVec[1], t9);
+            __m256i t12 = _mm256_or_si256(t10, t11);
+            __m256i t13 = _mm256_blendv_epi8(mVec[1], t12, mask.mMask[1]);
+            return SIMDVec_i(t7, t13);
+        }
         // ROLS
+        UME_FORCE_INLINE SIMDVec_i rol(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec[0], t0);
+            __m256i t3 = _mm256_srl_epi32(mVec[0], t1);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            __m256i t5 = _mm256_sll_epi32(mVec[1], t0);
+            __m256i t6 = _mm256_srl_epi32(mVec[1], t1);
+            __m256i t7 = _mm256_or_si256(t5, t6);
+            return SIMDVec_i(t4, t7);
+        }
         // MROLS
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVecMask<16> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec[0], t0);
+            __m256i t3 = _mm256_srl_epi32(mVec[0], t1);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            __m256i t5 = _mm256_blendv_epi8(mVec[0], t4, mask.mMask[0]);
+            __m256i t6 = _mm256_sll_epi32(mVec[1], t0);
+            __m256i t7 = _mm256_srl_epi32(mVec[1], t1);
+            __m256i t8 = _mm256_or_si256(t6, t7);
+            __m256i t9 = _mm256_blendv_epi8(mVec[1], t8, mask.mMask[1]);
+            return SIMDVec_i(t5, t9);
+        }
         // ROLVA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVec_u<uint32_t, 16> const & b) {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec[0], t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec[0], t2);
+            __m256i t5 = _mm256_srlv_epi32(mVec[0], t3);
+            mVec[0] = _mm256_or_si256(t4, t5);
+            __m256i t6 = _mm256_and_si256(b.mVec[1], t0);
+            __m256i t7 = _mm256_sub_epi32(t1, t6);
+            __m256i t8 = _mm256_sllv_epi32(mVec[1], t6);
+            __m256i t9 = _mm256_srlv_epi32(mVec[1], t7);
+            mVec[1] = _mm256_or_si256(t8, t9);
+            return *this;
+        }
         // MROLVA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVecMask<16> const & mask, SIMDVec_u<uint32_t, 16> const & b) {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec[0], t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec[0], t2);
+            __m256i t5 = _mm256_srlv_epi32(mVec[0], t3);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t6, mask.mMask[0]);
+            __m256i t7 = _mm256_and_si256(b.mVec[1], t0);
+            __m256i t8 = _mm256_sub_epi32(t1, t7);
+            __m256i t9 = _mm256_sllv_epi32(mVec[1], t7);
+            __m256i t10 = _mm256_srlv_epi32(mVec[1], t8);
+            __m256i t11 = _mm256_or_si256(t9, t10);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t11, mask.mMask[1]);
+            return *this;
+        }
         // ROLSA
+        UME_FORCE_INLINE SIMDVec_i & rola(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec[0], t0);
+            __m256i t3 = _mm256_srl_epi32(mVec[0], t1);
+            mVec[0] = _mm256_or_si256(t2, t3);
+            __m256i t4 = _mm256_sll_epi32(mVec[1], t0);
+            __m256i t5 = _mm256_srl_epi32(mVec[1], t1);
+            mVec[1] = _mm256_or_si256(t4, t5);
+            return *this;
+        }
         // MROLSA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVecMask<16> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec[0], t0);
+            __m256i t3 = _mm256_srl_epi32(mVec[0], t1);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t4, mask.mMask[0]);
+            __m256i t5 = _mm256_sll_epi32(mVec[1], t0);
+            __m256i t6 = _mm256_srl_epi32(mVec[1], t1);
+            __m256i t7 = _mm256_or_si256(t5, t6);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t7, mask.mMask[1]);
+            return *this;
+        }
         // RORV
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVec_u<uint32_t, 16> const & b) const {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec[0], t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec[0], t3);
+            __m256i t5 = _mm256_srlv_epi32(mVec[0], t2);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            __m256i t7 = _mm256_and_si256(b.mVec[1], t0);
+            __m256i t8 = _mm256_sub_epi32(t1, t7);
+            __m256i t9 = _mm256_sllv_epi32(mVec[1], t8);
+            __m256i t10 = _mm256_srlv_epi32(mVec[1], t7);
+            __m256i t11 = _mm256_or_si256(t9, t10);
+            return SIMDVec_i(t6, t11);
+        }
         // MRORV
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVecMask<16> const & mask, SIMDVec_u<uint32_t, 16> const & b) const {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec[0], t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec[0], t3);
+            __m256i t5 = _mm256_srlv_epi32(mVec[0], t2);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            __m256i t7 = _mm256_blendv_epi8(mVec[0], t6, mask.mMask[0]);
+            __m256i t8 = _mm256_and_si256(b.mVec[1], t0);
+            __m256i t9 = _mm256_sub_epi32(t1, t8);
+            __m256i t10 = _mm256_sllv_epi32(mVec[1], t9);
+            __m256i t11 = _mm256_srlv_epi32(mVec[1], t8);
+            __m256i t12 = _mm256_or_si256(t10, t11);
+            __m256i t13 = _mm256_blendv_epi8(mVec[1], t12, mask.mMask[1]);
+            return SIMDVec_i(t7, t13);
+        }
         // RORS
+        UME_FORCE_INLINE SIMDVec_i ror(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec[0], t1);
+            __m256i t3 = _mm256_srl_epi32(mVec[0], t0);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            __m256i t5 = _mm256_sll_epi32(mVec[1], t1);
+            __m256i t6 = _mm256_srl_epi32(mVec[1], t0);
+            __m256i t7 = _mm256_or_si256(t5, t6);
+            return SIMDVec_i(t4, t7);
+        }
         // MRORS
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVecMask<16> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec[0], t1);
+            __m256i t3 = _mm256_srl_epi32(mVec[0], t0);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            __m256i t5 = _mm256_blendv_epi8(mVec[0], t4, mask.mMask[0]);
+            __m256i t6 = _mm256_sll_epi32(mVec[1], t1);
+            __m256i t7 = _mm256_srl_epi32(mVec[1], t0);
+            __m256i t8 = _mm256_or_si256(t6, t7);
+            __m256i t9 = _mm256_blendv_epi8(mVec[1], t8, mask.mMask[1]);
+            return SIMDVec_i(t5, t9);
+        }
         // RORVA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVec_u<uint32_t, 16> const & b) {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec[0], t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec[0], t3);
+            __m256i t5 = _mm256_srlv_epi32(mVec[0], t2);
+            mVec[0] = _mm256_or_si256(t4, t5);
+            __m256i t6 = _mm256_and_si256(b.mVec[1], t0);
+            __m256i t7 = _mm256_sub_epi32(t1, t6);
+            __m256i t8 = _mm256_sllv_epi32(mVec[1], t7);
+            __m256i t9 = _mm256_srlv_epi32(mVec[1], t6);
+            mVec[1] = _mm256_or_si256(t8, t9);
+            return *this;
+        }
         // MRORVA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVecMask<16> const & mask, SIMDVec_u<uint32_t, 16> const & b) {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec[0], t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec[0], t3);
+            __m256i t5 = _mm256_srlv_epi32(mVec[0], t2);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t6, mask.mMask[0]);
+            __m256i t7 = _mm256_and_si256(b.mVec[1], t0);
+            __m256i t8 = _mm256_sub_epi32(t1, t7);
+            __m256i t9 = _mm256_sllv_epi32(mVec[1], t8);
+            __m256i t10 = _mm256_srlv_epi32(mVec[1], t7);
+            __m256i t11 = _mm256_or_si256(t9, t10);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t11, mask.mMask[1]);
+            return *this;
+        }
         // RORSA
+        UME_FORCE_INLINE SIMDVec_i & rora(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec[0], t1);
+            __m256i t3 = _mm256_srl_epi32(mVec[0], t0);
+            mVec[0] = _mm256_or_si256(t2, t3);
+            __m256i t4 = _mm256_sll_epi32(mVec[1], t1);
+            __m256i t5 = _mm256_srl_epi32(mVec[1], t0);
+            mVec[1] = _mm256_or_si256(t4, t5);
+            return *this;
+        }
         // MRORSA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVecMask<16> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec[0], t1);
+            __m256i t3 = _mm256_srl_epi32(mVec[0], t0);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t4, mask.mMask[0]);
+            __m256i t5 = _mm256_sll_epi32(mVec[1], t1);
+            __m256i t6 = _mm256_srl_epi32(mVec[1], t0);
+            __m256i t7 = _mm256_or_si256(t5, t6);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t7, mask.mMask[1]);
+            return *this;
+        }
 
         // NEG
         UME_FORCE_INLINE SIMDVec_i operator- () const {
@@ -90,6 +90,58 @@ namespace SIMD {
 
         UME_FORCE_INLINE explicit SIMDVec_i(__m128i & x) { mVec = x; }
         UME_FORCE_INLINE explicit SIMDVec_i(const __m128i & x) { mVec = x; }
+
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m128i saturatedAdd(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_add_epi32(a, b);
+            __m128i t1 = _mm_andnot_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, t0));
+            __m128i t2 = _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(0x7FFFFFFF));
+            return _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(t0), _mm_castsi128_ps(t2), _mm_castsi128_ps(t1)));
+        }
+        static UME_FORCE_INLINE __m128i saturatedSub(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_sub_epi32(a, b);
+            __m128i t1 = _mm_and_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, t0));
+            __m128i t2 = _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(0x7FFFFFFF));
+            return _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(t0), _mm_castsi128_ps(t2), _mm_castsi128_ps(t1)));
+        }
+        // Lane-wise division through double precision, exact for 32-bit operands.
+        static UME_FORCE_INLINE __m128i divideVector(__m128i const & a, __m128i const & b) {
+            __m256d t0 = _mm256_div_pd(_mm256_cvtepi32_pd(a), _mm256_cvtepi32_pd(b));
+            return _mm256_cvttpd_epi32(t0);
+        }
+        static UME_FORCE_INLINE __m128i remainderVector(__m128i const & a, __m128i const & b) {
+            __m128i t0 = divideVector(a, b);
+            return _mm_sub_epi32(a, _mm_mullo_epi32(t0, b));
+        }
+        // Division by a precomputed divisor, used by DIVD*/REMD*.
+        static UME_FORCE_INLINE __m128i divideMagic(__m128i const & a, SIMDDivisor<int32_t> const & b) {
+            __m128i t0 = _mm_set1_epi32(b.magic());
+            __m128i t1 = _mm_mul_epi32(a, t0);
+            __m128i t2 = _mm_mul_epi32(_mm_srli_epi64(a, 32), t0);
+            __m128i t3 = _mm_blend_epi32(_mm_srli_epi64(t1, 32), t2, 0xA);
+            __m128i t4 = _mm_add_epi32(t3, a);
+            __m128i t5 = _mm_and_si128(_mm_srai_epi32(t4, 31), _mm_set1_epi32(b.mask()));
+            __m128i t6 = _mm_sra_epi32(_mm_add_epi32(t4, t5), _mm_cvtsi32_si128(b.shift()));
+            __m128i t7 = _mm_set1_epi32(b.sign());
+            return _mm_sub_epi32(_mm_xor_si128(t6, t7), t7);
+        }
+        static UME_FORCE_INLINE __m128i remainderMagic(__m128i const & a, SIMDDivisor<int32_t> const & b) {
+            __m128i t0 = divideMagic(a, b);
+            return _mm_sub_epi32(a, _mm_mullo_epi32(t0, _mm_set1_epi32(b.divisor())));
+        }
+        // Bitonic sorting network kernels used by SORTA/SORTD. Every step pairs
+        // each lane with a partner lane, and keeps the minimum or the maximum of
+        // the pair, as selected by bits of BLEND_MASK.
+        template<int BLEND_MASK>
+        static UME_FORCE_INLINE __m128i sortStep(__m128i const & a, __m128i const & b) {
+            return _mm_blend_epi32(_mm_min_epi32(a, b), _mm_max_epi32(a, b), BLEND_MASK);
+        }
+        static UME_FORCE_INLINE __m128i sortLanes(__m128i a) {
+            a = sortStep<0x6>(a, _mm_shuffle_epi32(a, 0xB1));
+            a = sortStep<0xC>(a, _mm_shuffle_epi32(a, 0x4E));
+            a = sortStep<0xA>(a, _mm_shuffle_epi32(a, 0xB1));
+            return a;
+        }
     public:
 
         constexpr static uint32_t length() { return 4; }
@@ -244,7 +296,32 @@ namespace SIMD {
             return SIMDVec_i(t1);
         }
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_i swizzle(SIMDSwizzle<4> const & sMask) const {
+            __m128 t0 = _mm_permutevar_ps(_mm_castsi128_ps(mVec), sMask.mVec);
+            __m128i t1 = _mm_castps_si128(t0);
+            return SIMDVec_i(t1);
+        }
+        template<int i0, int i1, int i2, int i3>
+        UME_FORCE_INLINE SIMDVec_i swizzle() const {
+            __m128i t0 = _mm_shuffle_epi32(mVec, (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6));
+            return SIMDVec_i(t0);
+        }
         // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_i & swizzlea(SIMDSwizzle<4> const & sMask) {
+            SIMDVec_i t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() const {
+            __m128i t0 = sortLanes(mVec);
+            return SIMDVec_i(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() const {
+            __m128i t0 = _mm_shuffle_epi32(sortLanes(mVec), 0x1B);
+            return SIMDVec_i(t0);
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
@@ -305,13 +382,53 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            return SIMDVec_i(t1);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<4> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec = saturatedAdd(mVec, b.mVec);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = saturatedAdd(mVec, t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<4> const & mask, int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_i postinc() {
             __m128i t0 = _mm_set1_epi32(1);
@@ -405,13 +522,53 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            return SIMDVec_i(t1);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<4> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec = saturatedSub(mVec, b.mVec);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = saturatedSub(mVec, t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<4> const & mask, int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
             __m128i t0 = _mm_sub_epi32(b.mVec, mVec);
@@ -551,13 +708,181 @@ namespace SIMD {
             return *this;
         }
         // DIVV
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVec_i const & b) const {
+            __m128i t0 = divideVector(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (SIMDVec_i const & b) const {
+            return div(b);
+        }
         // MDIVV
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = divideVector(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // DIVS
+        UME_FORCE_INLINE SIMDVec_i div(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = divideVector(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (int32_t b) const {
+            return div(b);
+        }
         // MDIVS
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<4> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = divideVector(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // DIVVA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVec_i const & b) {
+            mVec = divideVector(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDVec_i const & b) {
+            return diva(b);
+        }
         // MDIVVA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = divideVector(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // DIVSA
+        UME_FORCE_INLINE SIMDVec_i & diva(int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = divideVector(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (int32_t b) {
+            return diva(b);
+        }
         // MDIVSA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<4> const & mask, int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = divideVector(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDDivisor<int32_t> const & b) const {
+            __m128i t0 = divideMagic(mVec, b);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (SIMDDivisor<int32_t> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<4> const & mask, SIMDDivisor<int32_t> const & b) const {
+            __m128i t0 = divideMagic(mVec, b);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDDivisor<int32_t> const & b) {
+            mVec = divideMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDDivisor<int32_t> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<4> const & mask, SIMDDivisor<int32_t> const & b) {
+            __m128i t0 = divideMagic(mVec, b);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // REMV
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVec_i const & b) const {
+            __m128i t0 = remainderVector(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (SIMDVec_i const & b) const {
+            return rem(b);
+        }
+        // MREMV
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = remainderVector(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // REMS
+        UME_FORCE_INLINE SIMDVec_i rem(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = remainderVector(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (int32_t b) const {
+            return rem(b);
+        }
+        // MREMS
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<4> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = remainderVector(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // REMVA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVec_i const & b) {
+            mVec = remainderVector(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (SIMDVec_i const & b) {
+            return rema(b);
+        }
+        // MREMVA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = remainderVector(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // REMSA
+        UME_FORCE_INLINE SIMDVec_i & rema(int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = remainderVector(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (int32_t b) {
+            return rema(b);
+        }
+        // MREMSA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<4> const & mask, int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = remainderVector(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // REMD
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDDivisor<int32_t> const & b) const {
+            __m128i t0 = remainderMagic(mVec, b);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (SIMDDivisor<int32_t> const & b) const {
+            return rem(b);
+        }
+        // MREMD
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<4> const & mask, SIMDDivisor<int32_t> const & b) const {
+            __m128i t0 = remainderMagic(mVec, b);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // REMDA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDDivisor<int32_t> const & b) {
+            mVec = remainderMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (SIMDDivisor<int32_t> const & b) {
+            return rema(b);
+        }
+        // MREMDA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<4> const & mask, SIMDDivisor<int32_t> const & b) {
+            __m128i t0 = remainderMagic(mVec, b);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // RCP
         // MRCP
         // RCPS
@@ -949,6 +1274,9 @@ namespace SIMD {
             __m128i t0 = _mm_and_si128(mVec, b.mVec);
             return SIMDVec_i(t0);
         }
+        UME_FORCE_INLINE SIMDVec_i operator& (SIMDVec_i const & b) const {
+            return band(b);
+        }
         // MBANDV
         UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
             __m128i t0 = _mm_and_si128(mVec, b.mVec);
@@ -961,6 +1289,9 @@ namespace SIMD {
             __m128i t1 = _mm_and_si128(mVec, t0);
             return SIMDVec_i(t1);
         }
+        UME_FORCE_INLINE SIMDVec_i operator& (int32_t b) const {
+            return band(b);
+        }
         // MBANDS
         UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<4> const & mask, int32_t b) const {
             __m128i t0 = _mm_set1_epi32(b);
@@ -973,6 +1304,9 @@ namespace SIMD {
             mVec = _mm_and_si128(mVec, b.mVec);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (SIMDVec_i const & b) {
+            return banda(b);
+        }
         // MBANDVA
         UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
             __m128i t0 = _mm_and_si128(mVec, b.mVec);
@@ -985,6 +1319,9 @@ namespace SIMD {
             mVec = _mm_and_si128(mVec, t0);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (int32_t b) {
+            return banda(b);
+        }
         // MBANDSA
         UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<4> const & mask, int32_t b) {
             __m128i t0 = _mm_set1_epi32(b);
@@ -997,6 +1334,9 @@ namespace SIMD {
             __m128i t0 = _mm_or_si128(mVec, b.mVec);
             return SIMDVec_i(t0);
         }
+        UME_FORCE_INLINE SIMDVec_i operator| (SIMDVec_i const & b) const {
+            return bor(b);
+        }
         // MBORV
         UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
             __m128i t0 = _mm_or_si128(mVec, b.mVec);
@@ -1009,6 +1349,9 @@ namespace SIMD {
             __m128i t1 = _mm_or_si128(mVec, t0);
             return SIMDVec_i(t1);
         }
+        UME_FORCE_INLINE SIMDVec_i operator| (int32_t b) const {
+            return bor(b);
+        }
         // MBORS
         UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<4> const & mask, int32_t b) const {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1021,6 +1364,9 @@ namespace SIMD {
             mVec = _mm_or_si128(mVec, b.mVec);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (SIMDVec_i const & b) {
+            return bora(b);
+        }
         // MBORVA
         UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
             __m128i t0 = _mm_or_si128(mVec, b.mVec);
@@ -1033,6 +1379,9 @@ namespace SIMD {
             mVec = _mm_or_si128(mVec, t0);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (int32_t b) {
+            return bora(b);
+        }
         // MBORSA
         UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<4> const & mask, int32_t b) {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1045,6 +1394,9 @@ namespace SIMD {
             __m128i t0 = _mm_xor_si128(mVec, b.mVec);
             return SIMDVec_i(t0);
         }
+        UME_FORCE_INLINE SIMDVec_i operator^ (SIMDVec_i const & b) const {
+            return bxor(b);
+        }
         // MBXORV
         UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
             __m128i t0 = _mm_xor_si128(mVec, b.mVec);
@@ -1057,6 +1409,9 @@ namespace SIMD {
             __m128i t1 = _mm_xor_si128(mVec, t0);
             return SIMDVec_i(t1);
         }
+        UME_FORCE_INLINE SIMDVec_i operator^ (int32_t b) const {
+            return bxor(b);
+        }
         // MBXORS
         UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<4> const & mask, int32_t b) const {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1069,6 +1424,9 @@ namespace SIMD {
             mVec = _mm_xor_si128(mVec, b.mVec);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (SIMDVec_i const & b) {
+            return bxora(b);
+        }
         // MBXORVA
         UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
             __m128i t0 = _mm_xor_si128(mVec, b.mVec);
@@ -1081,6 +1439,9 @@ namespace SIMD {
             mVec = _mm_xor_si128(mVec, t0);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (int32_t b) {
+            return bxora(b);
+        }
         // MBXORSA
         UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<4> const & mask, int32_t b) {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1094,6 +1455,9 @@ namespace SIMD {
             __m128i t1 = _mm_xor_si128(mVec, t0);
             return SIMDVec_i(t1);
         }
+        UME_FORCE_INLINE SIMDVec_i operator~ () const {
+            return bnot();
+        }
         // MBNOT
         UME_FORCE_INLINE SIMDVec_i bnot(SIMDVecMask<4> const & mask) const {
             __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
@@ -1286,37 +1650,293 @@ namespace SIMD {
         }
 
         // LSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVec_u<uint32_t, 4> const & b) const {
+            __m128i t0 = _mm_sllv_epi32(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (SIMDVec_u<uint32_t, 4> const & b) const {
+            return lsh(b);
+        }
         // MLSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<4> const & mask, SIMDVec_u<uint32_t, 4> const & b) const {
+            __m128i t0 = _mm_sllv_epi32(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // LSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi32(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (uint32_t b) const {
+            return lsh(b);
+        }
         // MLSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi32(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // LSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVec_u<uint32_t, 4> const & b) {
+            mVec = _mm_sllv_epi32(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (SIMDVec_u<uint32_t, 4> const & b) {
+            return lsha(b);
+        }
         // MLSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<4> const & mask, SIMDVec_u<uint32_t, 4> const & b) {
+            __m128i t0 = _mm_sllv_epi32(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // LSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = _mm_sll_epi32(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (uint32_t b) {
+            return lsha(b);
+        }
         // MLSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi32(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // RSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVec_u<uint32_t, 4> const & b) const {
+            __m128i t0 = _mm_srav_epi32(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (SIMDVec_u<uint32_t, 4> const & b) const {
+            return rsh(b);
+        }
         // MRSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<4> const & mask, SIMDVec_u<uint32_t, 4> const & b) const {
+            __m128i t0 = _mm_srav_epi32(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // RSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sra_epi32(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (uint32_t b) const {
+            return rsh(b);
+        }
         // MRSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sra_epi32(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // RSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVec_u<uint32_t, 4> const & b) {
+            mVec = _mm_srav_epi32(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (SIMDVec_u<uint32_t, 4> const & b) {
+            return rsha(b);
+        }
         // MRSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<4> const & mask, SIMDVec_u<uint32_t, 4> const & b) {
+            __m128i t0 = _mm_srav_epi32(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // RSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = _mm_sra_epi32(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (uint32_t b) {
+            return rsha(b);
+        }
         // MRSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sra_epi32(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // ROLV
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVec_u<uint32_t, 4> const & b) const {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = _mm_sllv_epi32(mVec, t2);
+            __m128i t5 = _mm_srlv_epi32(mVec, t3);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            return SIMDVec_i(t6);
+        }
         // MROLV
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVecMask<4> const & mask, SIMDVec_u<uint32_t, 4> const & b) const {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = _mm_sllv_epi32(mVec, t2);
+            __m128i t5 = _mm_srlv_epi32(mVec, t3);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = BLEND(mVec, t6, mask.mMask);
+            return SIMDVec_i(t7);
+        }
         // ROLS
+        UME_FORCE_INLINE SIMDVec_i rol(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t0);
+            __m128i t3 = _mm_srl_epi32(mVec, t1);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            return SIMDVec_i(t4);
+        }
         // MROLS
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t0);
+            __m128i t3 = _mm_srl_epi32(mVec, t1);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            __m128i t5 = BLEND(mVec, t4, mask.mMask);
+            return SIMDVec_i(t5);
+        }
         // ROLVA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVec_u<uint32_t, 4> const & b) {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = _mm_sllv_epi32(mVec, t2);
+            __m128i t5 = _mm_srlv_epi32(mVec, t3);
+            mVec = _mm_or_si128(t4, t5);
+            return *this;
+        }
         // MROLVA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVecMask<4> const & mask, SIMDVec_u<uint32_t, 4> const & b) {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = _mm_sllv_epi32(mVec, t2);
+            __m128i t5 = _mm_srlv_epi32(mVec, t3);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            mVec = BLEND(mVec, t6, mask.mMask);
+            return *this;
+        }
         // ROLSA
+        UME_FORCE_INLINE SIMDVec_i & rola(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t0);
+            __m128i t3 = _mm_srl_epi32(mVec, t1);
+            mVec = _mm_or_si128(t2, t3);
+            return *this;
+        }
         // MROLSA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t0);
+            __m128i t3 = _mm_srl_epi32(mVec, t1);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            mVec = BLEND(mVec, t4, mask.mMask);
+            return *this;
+        }
         // RORV
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVec_u<uint32_t, 4> const & b) const {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = _mm_sllv_epi32(mVec, t3);
+            __m128i t5 = _mm_srlv_epi32(mVec, t2);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            return SIMDVec_i(t6);
+        }
         // MRORV
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVecMask<4> const & mask, SIMDVec_u<uint32_t, 4> const & b) const {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = _mm_sllv_epi32(mVec, t3);
+            __m128i t5 = _mm_srlv_epi32(mVec, t2);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = BLEND(mVec, t6, mask.mMask);
+            return SIMDVec_i(t7);
+        }
         // RORS
+        UME_FORCE_INLINE SIMDVec_i ror(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t1);
+            __m128i t3 = _mm_srl_epi32(mVec, t0);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            return SIMDVec_i(t4);
+        }
         // MRORS
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t1);
+            __m128i t3 = _mm_srl_epi32(mVec, t0);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            __m128i t5 = BLEND(mVec, t4, mask.mMask);
+            return SIMDVec_i(t5);
+        }
         // RORVA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVec_u<uint32_t, 4> const & b) {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = _mm_sllv_epi32(mVec, t3);
+            __m128i t5 = _mm_srlv_epi32(mVec, t2);
+            mVec = _mm_or_si128(t4, t5);
+            return *this;
+        }
         // MRORVA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVecMask<4> const & mask, SIMDVec_u<uint32_t, 4> const & b) {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = _mm_sllv_epi32(mVec, t3);
+            __m128i t5 = _mm_srlv_epi32(mVec, t2);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            mVec = BLEND(mVec, t6, mask.mMask);
+            return *this;
+        }
         // RORSA
+        UME_FORCE_INLINE SIMDVec_i & rora(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t1);
+            __m128i t3 = _mm_srl_epi32(mVec, t0);
+            mVec = _mm_or_si128(t2, t3);
+            return *this;
+        }
         // MRORSA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t1);
+            __m128i t3 = _mm_srl_epi32(mVec, t0);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            mVec = BLEND(mVec, t4, mask.mMask);
+            return *this;
+        }
 
         // NEG
         UME_FORCE_INLINE SIMDVec_i operator- () const {
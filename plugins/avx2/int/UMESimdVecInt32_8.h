@@ -57,6 +57,7 @@ namespace SIMD {
         friend class SIMDVec_u<uint32_t, 8>;
         friend class SIMDVec_f<float, 8>;
         friend class SIMDVec_f<double, 8>;
+        friend class SIMDVec_i<int16_t, 8>;
 
         friend class SIMDVec_i<int32_t, 16>;
     private:
@@ -64,6 +65,131 @@ namespace SIMD {
 
         UME_FORCE_INLINE explicit SIMDVec_i(__m256i & x) { mVec = x; }
         UME_FORCE_INLINE explicit SIMDVec_i(const __m256i & x) { mVec = x; }
+
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m256i saturatedAdd(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_add_epi32(a, b);
+            __m256i t1 = _mm256_andnot_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, t0));
+            __m256i t2 = _mm256_xor_si256(_mm256_srai_epi32(a, 31), _mm256_set1_epi32(0x7FFFFFFF));
+            return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(t0), _mm256_castsi256_ps(t2), _mm256_castsi256_ps(t1)));
+        }
+        static UME_FORCE_INLINE __m256i saturatedSub(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_sub_epi32(a, b);
+            __m256i t1 = _mm256_and_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, t0));
+            __m256i t2 = _mm256_xor_si256(_mm256_srai_epi32(a, 31), _mm256_set1_epi32(0x7FFFFFFF));
+            return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(t0), _mm256_castsi256_ps(t2), _mm256_castsi256_ps(t1)));
+        }
+        // Lane-wise division through double precision, exact for 32-bit operands.
+        static UME_FORCE_INLINE __m128i divideHalf(__m128i const & a, __m128i const & b) {
+            __m256d t0 = _mm256_div_pd(_mm256_cvtepi32_pd(a), _mm256_cvtepi32_pd(b));
+            return _mm256_cvttpd_epi32(t0);
+        }
+        static UME_FORCE_INLINE __m256i divideVector(__m256i const & a, __m256i const & b) {
+            __m128i t0 = divideHalf(_mm256_castsi256_si128(a), _mm256_castsi256_si128(b));
+            __m128i t1 = divideHalf(_mm256_extracti128_si256(a, 1), _mm256_extracti128_si256(b, 1));
+            return _mm256_inserti128_si256(_mm256_castsi128_si256(t0), t1, 1);
+        }
+        static UME_FORCE_INLINE __m256i remainderVector(__m256i const & a, __m256i const & b) {
+            __m256i t0 = divideVector(a, b);
+            return _mm256_sub_epi32(a, _mm256_mullo_epi32(t0, b));
+        }
+        // Division by a precomputed divisor, used by DIVD*/REMD*.
+        static UME_FORCE_INLINE __m256i divideMagic(__m256i const & a, SIMDDivisor<int32_t> const & b) {
+            __m256i t0 = _mm256_set1_epi32(b.magic());
+            __m256i t1 = _mm256_mul_epi32(a, t0);
+            __m256i t2 = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), t0);
+            __m256i t3 = _mm256_blend_epi32(_mm256_srli_epi64(t1, 32), t2, 0xAA);
+            __m256i t4 = _mm256_add_epi32(t3, a);
+            __m256i t5 = _mm256_and_si256(_mm256_srai_epi32(t4, 31), _mm256_set1_epi32(b.mask()));
+            __m256i t6 = _mm256_sra_epi32(_mm256_add_epi32(t4, t5), _mm_cvtsi32_si128(b.shift()));
+            __m256i t7 = _mm256_set1_epi32(b.sign());
+            return _mm256_sub_epi32(_mm256_xor_si256(t6, t7), t7);
+        }
+        static UME_FORCE_INLINE __m256i remainderMagic(__m256i const & a, SIMDDivisor<int32_t> const & b) {
+            __m256i t0 = divideMagic(a, b);
+            return _mm256_sub_epi32(a, _mm256_mullo_epi32(t0, _mm256_set1_epi32(b.divisor())));
+        }
+        // Writes lanes of 'v' selected by bits of 'm' to baseAddr[indices[i]],
+        // in lane order. Indices are moved to general purpose registers in
+        // pairs, so neither vector makes a round trip through the stack.
+        static UME_FORCE_INLINE void scatterLanes(int32_t * baseAddr, __m256i v, __m256i indices, int m) {
+            __m128i v0 = _mm256_castsi256_si128(v);
+            __m128i v1 = _mm256_extracti128_si256(v, 1);
+            __m128i t0 = _mm256_castsi256_si128(indices);
+            __m128i t1 = _mm256_extracti128_si256(indices, 1);
+            uint64_t x0 = uint64_t(_mm_cvtsi128_si64(v0));
+            uint64_t x1 = uint64_t(_mm_extract_epi64(v0, 1));
+            uint64_t x2 = uint64_t(_mm_cvtsi128_si64(v1));
+            uint64_t x3 = uint64_t(_mm_extract_epi64(v1, 1));
+            uint64_t i0 = uint64_t(_mm_cvtsi128_si64(t0));
+            uint64_t i1 = uint64_t(_mm_extract_epi64(t0, 1));
+            uint64_t i2 = uint64_t(_mm_cvtsi128_si64(t1));
+            uint64_t i3 = uint64_t(_mm_extract_epi64(t1, 1));
+            if (m & 0x01) baseAddr[uint32_t(i0)] = int32_t(x0);
+            if (m & 0x02) baseAddr[uint32_t(i0 >> 32)] = int32_t(x0 >> 32);
+            if (m & 0x04) baseAddr[uint32_t(i1)] = int32_t(x1);
+            if (m & 0x08) baseAddr[uint32_t(i1 >> 32)] = int32_t(x1 >> 32);
+            if (m & 0x10) baseAddr[uint32_t(i2)] = int32_t(x2);
+            if (m & 0x20) baseAddr[uint32_t(i2 >> 32)] = int32_t(x2 >> 32);
+            if (m & 0x40) baseAddr[uint32_t(i3)] = int32_t(x3);
+            if (m & 0x80) baseAddr[uint32_t(i3 >> 32)] = int32_t(x3 >> 32);
+        }
+        // Adds lanes of 'v' selected by bits of 'm' to baseAddr[indices[i]],
+        // in lane order, so that lanes with repeating indices accumulate.
+        static UME_FORCE_INLINE void scatterAddLanes(int32_t * baseAddr, __m256i v, __m256i indices, int m) {
+            __m128i v0 = _mm256_castsi256_si128(v);
+            __m128i v1 = _mm256_extracti128_si256(v, 1);
+            __m128i t0 = _mm256_castsi256_si128(indices);
+            __m128i t1 = _mm256_extracti128_si256(indices, 1);
+            uint64_t x0 = uint64_t(_mm_cvtsi128_si64(v0));
+            uint64_t x1 = uint64_t(_mm_extract_epi64(v0, 1));
+            uint64_t x2 = uint64_t(_mm_cvtsi128_si64(v1));
+            uint64_t x3 = uint64_t(_mm_extract_epi64(v1, 1));
+            uint64_t i0 = uint64_t(_mm_cvtsi128_si64(t0));
+            uint64_t i1 = uint64_t(_mm_extract_epi64(t0, 1));
+            uint64_t i2 = uint64_t(_mm_cvtsi128_si64(t1));
+            uint64_t i3 = uint64_t(_mm_extract_epi64(t1, 1));
+            if (m & 0x01) baseAddr[uint32_t(i0)] += int32_t(x0);
+            if (m & 0x02) baseAddr[uint32_t(i0 >> 32)] += int32_t(x0 >> 32);
+            if (m & 0x04) baseAddr[uint32_t(i1)] += int32_t(x1);
+            if (m & 0x08) baseAddr[uint32_t(i1 >> 32)] += int32_t(x1 >> 32);
+            if (m & 0x10) baseAddr[uint32_t(i2)] += int32_t(x2);
+            if (m & 0x20) baseAddr[uint32_t(i2 >> 32)] += int32_t(x2 >> 32);
+            if (m & 0x40) baseAddr[uint32_t(i3)] += int32_t(x3);
+            if (m & 0x80) baseAddr[uint32_t(i3 >> 32)] += int32_t(x3 >> 32);
+        }
+        // Bitonic sorting network kernels used by SORTA/SORTD. Every step pairs
+        // each lane with a partner lane, and keeps the minimum or the maximum of
+        // the pair, as selected by bits of BLEND_MASK.
+        template<int BLEND_MASK>
+        static UME_FORCE_INLINE __m256i sortStep(__m256i const & a, __m256i const & b) {
+            return _mm256_blend_epi32(_mm256_min_epi32(a, b), _mm256_max_epi32(a, b), BLEND_MASK);
+        }
+        // Sorts a bitonic sequence in ascending order.
+        static UME_FORCE_INLINE __m256i mergeLanes(__m256i a) {
+            a = sortStep<0xF0>(a, _mm256_permute2x128_si256(a, a, 0x01));
+            a = sortStep<0xCC>(a, _mm256_shuffle_epi32(a, 0x4E));
+            a = sortStep<0xAA>(a, _mm256_shuffle_epi32(a, 0xB1));
+            return a;
+        }
+        static UME_FORCE_INLINE __m256i sortLanes(__m256i a) {
+            a = sortStep<0x66>(a, _mm256_shuffle_epi32(a, 0xB1));
+            a = sortStep<0x3C>(a, _mm256_shuffle_epi32(a, 0x4E));
+            a = sortStep<0x5A>(a, _mm256_shuffle_epi32(a, 0xB1));
+            return mergeLanes(a);
+        }
+        static UME_FORCE_INLINE __m256i reverseLanes(__m256i const & a) {
+            return _mm256_shuffle_epi32(_mm256_permute2x128_si256(a, a, 0x01), 0x1B);
+        }
+        // Stores lanes of 'v' selected by bits of 'm' contiguously, starting
+        // at 'p', and returns their count.
+        static UME_FORCE_INLINE uint32_t compressLanes(int32_t * p, __m256i const & v, int m) {
+            uint32_t n;
+            __m256i t0 = SIMDVec_u<uint32_t, 8>::compressIndices(m, n);
+            __m256i t1 = _mm256_permutevar8x32_epi32(v, t0);
+            _mm256_maskstore_epi32((int *)p, SIMDVecMask<8>::prefix(n).mMask, t1);
+            return n;
+        }
     public:
 
         constexpr static uint32_t length() { return 8; }
@@ -168,7 +294,7 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<8> const & mask, int32_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
+            __m256i t0 = _mm256_maskload_epi32((int const *)p, mask.mMask);
             mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
             return *this;
         }
@@ -194,6 +320,11 @@ namespace SIMD {
             mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
             return *this;
         }
+        // LOADN
+        UME_FORCE_INLINE SIMDVec_i & loadn(uint32_t n, int32_t const * p) {
+            mVec = _mm256_maskload_epi32((int const *)p, SIMDVecMask<8>::prefix(n).mMask);
+            return *this;
+        }
         // STORE
         UME_FORCE_INLINE int32_t * store(int32_t * p) const {
             _mm256_storeu_si256((__m256i*)p, mVec);
@@ -201,9 +332,12 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int32_t * store(SIMDVecMask<8> const & mask, int32_t * p) const {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = _mm256_blendv_epi8(t0, mVec, mask.mMask);
-            _mm256_storeu_si256((__m256i*)p, t1);
+            _mm256_maskstore_epi32((int *)p, mask.mMask, mVec);
+            return p;
+        }
+        // STOREN
+        UME_FORCE_INLINE int32_t* storen(uint32_t n, int32_t * p) const {
+            _mm256_maskstore_epi32((int *)p, SIMDVecMask<8>::prefix(n).mMask, mVec);
             return p;
         }
         // STOREA
@@ -228,6 +362,10 @@ namespace SIMD {
             _mm256_stream_si256((__m256i*)p, t1);
             return p;
         }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressstore(SIMDVecMask<8> const & mask, int32_t * p) const {
+            return compressLanes(p, mVec, _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask)));
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
             __m256i t0 = _mm256_blendv_epi8(mVec, b.mVec, mask.mMask);
@@ -240,7 +378,39 @@ namespace SIMD {
             return SIMDVec_i(t1);
         }
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_i swizzle(SIMDSwizzle<8> const & sMask) const {
+            __m256i t0 = _mm256_permutevar8x32_epi32(mVec, sMask.mVec);
+            return SIMDVec_i(t0);
+        }
+        template<int i0, int i1, int i2, int i3, int i4, int i5, int i6, int i7>
+        UME_FORCE_INLINE SIMDVec_i swizzle() const {
+            const int imm = (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6);
+            // Patterns repeated in both 128-bit lanes need only an immediate shuffle.
+            if (i0 < 4 && i1 < 4 && i2 < 4 && i3 < 4 && i4 == i0 + 4 && i5 == i1 + 4 &&
+                i6 == i2 + 4 && i7 == i3 + 4) {
+                __m256i t0 = _mm256_shuffle_epi32(mVec, imm);
+                return SIMDVec_i(t0);
+            }
+            __m256i t1 = _mm256_setr_epi32(i0, i1, i2, i3, i4, i5, i6, i7);
+            __m256i t2 = _mm256_permutevar8x32_epi32(mVec, t1);
+            return SIMDVec_i(t2);
+        }
         // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_i & swizzlea(SIMDSwizzle<8> const & sMask) {
+            SIMDVec_i t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() const {
+            __m256i t0 = sortLanes(mVec);
+            return SIMDVec_i(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() const {
+            __m256i t0 = reverseLanes(sortLanes(mVec));
+            return SIMDVec_i(t0);
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
@@ -303,13 +473,53 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+            return SIMDVec_i(t1);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec = saturatedAdd(mVec, b.mVec);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec = saturatedAdd(mVec, t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<8> const & mask, int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_i postinc() {
             __m256i t0 = _mm256_set1_epi32(1);
@@ -401,13 +611,53 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+            return SIMDVec_i(t1);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec = saturatedSub(mVec, b.mVec);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec = saturatedSub(mVec, t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<8> const & mask, int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
             __m256i t0 = _mm256_sub_epi32(b.mVec, mVec);
@@ -545,25 +795,181 @@ namespace SIMD {
             return *this;
         }
         // DIVV
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVec_i const & b) const {
+            __m256i t0 = divideVector(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         UME_FORCE_INLINE SIMDVec_i operator/ (SIMDVec_i const & b) const {
             return div(b);
         }
         // MDIVV
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = divideVector(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // DIVS
+        UME_FORCE_INLINE SIMDVec_i div(int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = divideVector(mVec, t0);
+            return SIMDVec_i(t1);
+        }
         UME_FORCE_INLINE SIMDVec_i operator/ (int32_t b) const {
             return div(b);
         }
         // MDIVS
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = divideVector(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // DIVVA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVec_i const & b) {
+            mVec = divideVector(mVec, b.mVec);
+            return *this;
+        }
         UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDVec_i const & b) {
             return diva(b);
         }
         // MDIVVA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = divideVector(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
         // DIVSA
+        UME_FORCE_INLINE SIMDVec_i & diva(int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec = divideVector(mVec, t0);
+            return *this;
+        }
         UME_FORCE_INLINE SIMDVec_i & operator/= (int32_t b) {
             return diva(b);
         }
         // MDIVSA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<8> const & mask, int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = divideVector(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDDivisor<int32_t> const & b) const {
+            __m256i t0 = divideMagic(mVec, b);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (SIMDDivisor<int32_t> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<8> const & mask, SIMDDivisor<int32_t> const & b) const {
+            __m256i t0 = divideMagic(mVec, b);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDDivisor<int32_t> const & b) {
+            mVec = divideMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDDivisor<int32_t> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<8> const & mask, SIMDDivisor<int32_t> const & b) {
+            __m256i t0 = divideMagic(mVec, b);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // REMV
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVec_i const & b) const {
+            __m256i t0 = remainderVector(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (SIMDVec_i const & b) const {
+            return rem(b);
+        }
+        // MREMV
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = remainderVector(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // REMS
+        UME_FORCE_INLINE SIMDVec_i rem(int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = remainderVector(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (int32_t b) const {
+            return rem(b);
+        }
+        // MREMS
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = remainderVector(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // REMVA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVec_i const & b) {
+            mVec = remainderVector(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (SIMDVec_i const & b) {
+            return rema(b);
+        }
+        // MREMVA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = remainderVector(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // REMSA
+        UME_FORCE_INLINE SIMDVec_i & rema(int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec = remainderVector(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (int32_t b) {
+            return rema(b);
+        }
+        // MREMSA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<8> const & mask, int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = remainderVector(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // REMD
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDDivisor<int32_t> const & b) const {
+            __m256i t0 = remainderMagic(mVec, b);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (SIMDDivisor<int32_t> const & b) const {
+            return rem(b);
+        }
+        // MREMD
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<8> const & mask, SIMDDivisor<int32_t> const & b) const {
+            __m256i t0 = remainderMagic(mVec, b);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // REMDA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDDivisor<int32_t> const & b) {
+            mVec = remainderMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (SIMDDivisor<int32_t> const & b) {
+            return rema(b);
+        }
+        // MREMDA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<8> const & mask, SIMDDivisor<int32_t> const & b) {
+            __m256i t0 = remainderMagic(mVec, b);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
         // RCP
         // MRCP
         // RCPS
@@ -1389,75 +1795,322 @@ namespace SIMD {
         }
         // SCATTERS
         UME_FORCE_INLINE int32_t* scatter(int32_t* baseAddr, uint32_t* indices) const {
-            alignas(32) int32_t raw[8];
-            _mm256_store_si256((__m256i*) raw, mVec);
-            for (int i = 0; i < 8; i++) { baseAddr[indices[i]] = raw[i]; };
+            scatterLanes(baseAddr, mVec, _mm256_loadu_si256((__m256i*)indices), 0xFF);
             return baseAddr;
         }
         // MSCATTERS
         UME_FORCE_INLINE int32_t* scatter(SIMDVecMask<8> const & mask, int32_t* baseAddr, uint32_t* indices) const {
-            alignas(32) int32_t raw[8];
-            alignas(32) uint32_t rawMask[8];
-            _mm256_store_si256((__m256i*) raw, mVec);
-            _mm256_store_si256((__m256i*) rawMask, mask.mMask);
-            for (int i = 0; i < 8; i++) { if (rawMask[i] == SIMDVecMask<8>::TRUE_VAL()) baseAddr[indices[i]] = raw[i]; };
+            scatterLanes(baseAddr, mVec, _mm256_loadu_si256((__m256i*)indices), _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask)));
             return baseAddr;
         }
         // SCATTERV
         UME_FORCE_INLINE int32_t* scatter(int32_t* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
-            alignas(32) int32_t raw[8];
-            alignas(32) uint32_t rawIndices[8];
-            _mm256_store_si256((__m256i*) raw, mVec);
-            _mm256_store_si256((__m256i*) rawIndices, indices.mVec);
-            for (int i = 0; i < 8; i++) { baseAddr[rawIndices[i]] = raw[i]; };
+            scatterLanes(baseAddr, mVec, indices.mVec, 0xFF);
             return baseAddr;
         }
         // MSCATTERV
         UME_FORCE_INLINE int32_t* scatter(SIMDVecMask<8> const & mask, int32_t* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
-            alignas(32) int32_t raw[8];
-            alignas(32) uint32_t rawIndices[8];
-            alignas(32) uint32_t rawMask[8];
-            _mm256_store_si256((__m256i*) raw, mVec);
-            _mm256_store_si256((__m256i*) rawIndices, indices.mVec);
-            _mm256_store_si256((__m256i*) rawMask, mask.mMask);
-            for (int i = 0; i < 8; i++) {
-                if (rawMask[i] == SIMDVecMask<8>::TRUE_VAL())
-                    baseAddr[rawIndices[i]] = raw[i];
-            };
+            scatterLanes(baseAddr, mVec, indices.mVec, _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask)));
+            return baseAddr;
+        }
+        // SCATTERADDV
+        UME_FORCE_INLINE int32_t* scatteradd(int32_t* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
+            scatterAddLanes(baseAddr, mVec, indices.mVec, 0xFF);
+            return baseAddr;
+        }
+        // MSCATTERADDV
+        UME_FORCE_INLINE int32_t* scatteradd(SIMDVecMask<8> const & mask, int32_t* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
+            scatterAddLanes(baseAddr, mVec, indices.mVec, _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask)));
             return baseAddr;
         }
         // LSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVec_u<uint32_t, 8> const & b) const {
+            __m256i t0 = _mm256_sllv_epi32(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (SIMDVec_u<uint32_t, 8> const & b) const {
+            return lsh(b);
+        }
         // MLSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) const {
+            __m256i t0 = _mm256_sllv_epi32(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // LSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sll_epi32(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (uint32_t b) const {
+            return lsh(b);
+        }
         // MLSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sll_epi32(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // LSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVec_u<uint32_t, 8> const & b) {
+            mVec = _mm256_sllv_epi32(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (SIMDVec_u<uint32_t, 8> const & b) {
+            return lsha(b);
+        }
         // MLSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) {
+            __m256i t0 = _mm256_sllv_epi32(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
         // LSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = _mm256_sll_epi32(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (uint32_t b) {
+            return lsha(b);
+        }
         // MLSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sll_epi32(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
         // RSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVec_u<uint32_t, 8> const & b) const {
+            __m256i t0 = _mm256_srav_epi32(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (SIMDVec_u<uint32_t, 8> const & b) const {
+            return rsh(b);
+        }
         // MRSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) const {
+            __m256i t0 = _mm256_srav_epi32(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // RSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sra_epi32(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (uint32_t b) const {
+            return rsh(b);
+        }
         // MRSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sra_epi32(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // RSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVec_u<uint32_t, 8> const & b) {
+            mVec = _mm256_srav_epi32(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (SIMDVec_u<uint32_t, 8> const & b) {
+            return rsha(b);
+        }
         // MRSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) {
+            __m256i t0 = _mm256_srav_epi32(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
         // RSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = _mm256_sra_epi32(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (uint32_t b) {
+            return rsha(b);
+        }
         // MRSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sra_epi32(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
         // ROLV
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVec_u<uint32_t, 8> const & b) const {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec, t2);
+            __m256i t5 = _mm256_srlv_epi32(mVec, t3);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            return SIMDVec_i(t6);
+        }
         // MROLV
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) const {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec, t2);
+            __m256i t5 = _mm256_srlv_epi32(mVec, t3);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            __m256i t7 = _mm256_blendv_epi8(mVec, t6, mask.mMask);
+            return SIMDVec_i(t7);
+        }
         // ROLS
+        UME_FORCE_INLINE SIMDVec_i rol(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec, t0);
+            __m256i t3 = _mm256_srl_epi32(mVec, t1);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            return SIMDVec_i(t4);
+        }
         // MROLS
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec, t0);
+            __m256i t3 = _mm256_srl_epi32(mVec, t1);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            __m256i t5 = _mm256_blendv_epi8(mVec, t4, mask.mMask);
+            return SIMDVec_i(t5);
+        }
         // ROLVA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVec_u<uint32_t, 8> const & b) {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec, t2);
+            __m256i t5 = _mm256_srlv_epi32(mVec, t3);
+            mVec = _mm256_or_si256(t4, t5);
+            return *this;
+        }
         // MROLVA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec, t2);
+            __m256i t5 = _mm256_srlv_epi32(mVec, t3);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            mVec = _mm256_blendv_epi8(mVec, t6, mask.mMask);
+            return *this;
+        }
         // ROLSA
+        UME_FORCE_INLINE SIMDVec_i & rola(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec, t0);
+            __m256i t3 = _mm256_srl_epi32(mVec, t1);
+            mVec = _mm256_or_si256(t2, t3);
+            return *this;
+        }
         // MROLSA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec, t0);
+            __m256i t3 = _mm256_srl_epi32(mVec, t1);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            mVec = _mm256_blendv_epi8(mVec, t4, mask.mMask);
+            return *this;
+        }
         // RORV
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVec_u<uint32_t, 8> const & b) const {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec, t3);
+            __m256i t5 = _mm256_srlv_epi32(mVec, t2);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            return SIMDVec_i(t6);
+        }
         // MRORV
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) const {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec, t3);
+            __m256i t5 = _mm256_srlv_epi32(mVec, t2);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            __m256i t7 = _mm256_blendv_epi8(mVec, t6, mask.mMask);
+            return SIMDVec_i(t7);
+        }
         // RORS
+        UME_FORCE_INLINE SIMDVec_i ror(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec, t1);
+            __m256i t3 = _mm256_srl_epi32(mVec, t0);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            return SIMDVec_i(t4);
+        }
         // MRORS
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec, t1);
+            __m256i t3 = _mm256_srl_epi32(mVec, t0);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            __m256i t5 = _mm256_blendv_epi8(mVec, t4, mask.mMask);
+            return SIMDVec_i(t5);
+        }
         // RORVA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVec_u<uint32_t, 8> const & b) {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec, t3);
+            __m256i t5 = _mm256_srlv_epi32(mVec, t2);
+            mVec = _mm256_or_si256(t4, t5);
+            return *this;
+        }
         // MRORVA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec, t3);
+            __m256i t5 = _mm256_srlv_epi32(mVec, t2);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            mVec = _mm256_blendv_epi8(mVec, t6, mask.mMask);
+            return *this;
+        }
         // RORSA
+        UME_FORCE_INLINE SIMDVec_i & rora(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec, t1);
+            __m256i t3 = _mm256_srl_epi32(mVec, t0);
+            mVec = _mm256_or_si256(t2, t3);
+            return *this;
+        }
         // MRORSA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec, t1);
+            __m256i t3 = _mm256_srl_epi32(mVec, t0);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            mVec = _mm256_blendv_epi8(mVec, t4, mask.mMask);
+            return *this;
+        }
 
         // NEG
         UME_FORCE_INLINE SIMDVec_i operator- () const {
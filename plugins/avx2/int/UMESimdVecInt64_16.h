@@ -319,6 +319,34 @@ namespace SIMD {
         // BLENDS
         // SWIZZLE
         // SWIZZLEA
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() const {
+            __m256i t0 = mVec[0];
+            __m256i t1 = mVec[1];
+            __m256i t2 = mVec[2];
+            __m256i t3 = mVec[3];
+            SIMDVec_i<int64_t, 8>::sortLanes(t0, t1);
+            SIMDVec_i<int64_t, 8>::sortLanes(t2, t3);
+            // Reversing the upper half gives a bitonic sequence.
+            __m256i t4 = SIMDVec_i<int64_t, 4>::reverseLanes(t3);
+            __m256i t5 = SIMDVec_i<int64_t, 4>::reverseLanes(t2);
+            __m256i t6 = SIMDVec_i<int64_t, 4>::minLanes(t0, t4);
+            __m256i t7 = SIMDVec_i<int64_t, 4>::minLanes(t1, t5);
+            __m256i t8 = SIMDVec_i<int64_t, 4>::maxLanes(t0, t4);
+            __m256i t9 = SIMDVec_i<int64_t, 4>::maxLanes(t1, t5);
+            SIMDVec_i<int64_t, 8>::mergeLanes(t6, t7);
+            SIMDVec_i<int64_t, 8>::mergeLanes(t8, t9);
+            return SIMDVec_i(t6, t7, t8, t9);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() const {
+            SIMDVec_i t0 = sorta();
+            __m256i t1 = SIMDVec_i<int64_t, 4>::reverseLanes(t0.mVec[3]);
+            __m256i t2 = SIMDVec_i<int64_t, 4>::reverseLanes(t0.mVec[2]);
+            __m256i t3 = SIMDVec_i<int64_t, 4>::reverseLanes(t0.mVec[1]);
+            __m256i t4 = SIMDVec_i<int64_t, 4>::reverseLanes(t0.mVec[0]);
+            return SIMDVec_i(t1, t2, t3, t4);
+        }
 
         // ADDV
         // MADDV
@@ -54,8 +54,19 @@
 
 #if defined UME_USE_MASK_64B
     #define BLEND(a_256i, b_256i, mask_256i) _mm256_blendv_epi8(a_256i, b_256i, mask_256i)
+    #define MASK_LOAD(ptr_i64, mask_256i) _mm256_maskload_epi64((long long const *)(ptr_i64), mask_256i)
+    #define MASK_STORE(ptr_i64, mask_256i, a_256i) _mm256_maskstore_epi64((long long *)(ptr_i64), mask_256i, a_256i)
+    #define MASK_GATHER(a_256i, ptr_i64, idx_256i, mask_256i) _mm256_mask_i64gather_epi64(a_256i, (long long const *)(ptr_i64), idx_256i, mask_256i, 8)
+    #define MOVEMASK(mask_256i) _mm256_movemask_pd(_mm256_castsi256_pd(mask_256i))
+    #define TO_MASK(a_256i) (a_256i)
 #else
     #define BLEND(a_256i, b_256i, mask_128i) _mm256_blendv_epi8(a_256i, b_256i, _mm256_cvtepi32_epi64(mask_128i))
+    #define MASK_LOAD(ptr_i64, mask_128i) _mm256_maskload_epi64((long long const *)(ptr_i64), _mm256_cvtepi32_epi64(mask_128i))
+    #define MASK_STORE(ptr_i64, mask_128i, a_256i) _mm256_maskstore_epi64((long long *)(ptr_i64), _mm256_cvtepi32_epi64(mask_128i), a_256i)
+    #define MASK_GATHER(a_256i, ptr_i64, idx_256i, mask_128i) _mm256_mask_i64gather_epi64(a_256i, (long long const *)(ptr_i64), idx_256i, _mm256_cvtepi32_epi64(mask_128i), 8)
+    #define MOVEMASK(mask_128i) _mm_movemask_ps(_mm_castsi128_ps(mask_128i))
+    // Packs 64b lane masks into the 32b lane layout of SIMDVecMask<4>.
+    #define TO_MASK(a_256i) _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(a_256i, _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7)))
 #endif
 
 namespace UME {
@@ -80,11 +91,98 @@ namespace SIMD {
         friend class SIMDVec_f<double, 4>;
 
         friend class SIMDVec_i<int64_t, 8>;
+        friend class SIMDVec_i<int64_t, 16>;
     private:
         __m256i mVec;
 
         UME_FORCE_INLINE explicit SIMDVec_i(__m256i & x) { mVec = x; }
         UME_FORCE_INLINE explicit SIMDVec_i(const __m256i & x) { mVec = x; }
+
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m256i saturatedAdd(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_add_epi64(a, b);
+            __m256i t1 = _mm256_andnot_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, t0));
+            __m256i t2 = _mm256_xor_si256(_mm256_cmpgt_epi64(_mm256_setzero_si256(), a), _mm256_srli_epi64(_mm256_cmpeq_epi64(a, a), 1));
+            return _mm256_castpd_si256(_mm256_blendv_pd(_mm256_castsi256_pd(t0), _mm256_castsi256_pd(t2), _mm256_castsi256_pd(t1)));
+        }
+        static UME_FORCE_INLINE __m256i saturatedSub(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_sub_epi64(a, b);
+            __m256i t1 = _mm256_and_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, t0));
+            __m256i t2 = _mm256_xor_si256(_mm256_cmpgt_epi64(_mm256_setzero_si256(), a), _mm256_srli_epi64(_mm256_cmpeq_epi64(a, a), 1));
+            return _mm256_castpd_si256(_mm256_blendv_pd(_mm256_castsi256_pd(t0), _mm256_castsi256_pd(t2), _mm256_castsi256_pd(t1)));
+        }
+        // Bitonic sorting network kernels used by SORTA/SORTD. Every step pairs
+        // each lane with a partner lane, and keeps the minimum or the maximum of
+        // the pair, as selected by bits of BLEND_MASK. BLEND_MASK has one bit
+        // per 32b element, so each lane is covered by two bits.
+        template<int BLEND_MASK>
+        static UME_FORCE_INLINE __m256i sortStep(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_cmpgt_epi64(a, b);
+            __m256i t1 = _mm256_blendv_epi8(a, b, t0);
+            __m256i t2 = _mm256_blendv_epi8(b, a, t0);
+            return _mm256_blend_epi32(t1, t2, BLEND_MASK);
+        }
+        // Sorts a bitonic sequence in ascending order.
+        static UME_FORCE_INLINE __m256i mergeLanes(__m256i a) {
+            a = sortStep<0xF0>(a, _mm256_permute4x64_epi64(a, 0x4E));
+            a = sortStep<0xCC>(a, _mm256_permute4x64_epi64(a, 0xB1));
+            return a;
+        }
+        static UME_FORCE_INLINE __m256i sortLanes(__m256i a) {
+            a = sortStep<0x3C>(a, _mm256_permute4x64_epi64(a, 0xB1));
+            return mergeLanes(a);
+        }
+        static UME_FORCE_INLINE __m256i reverseLanes(__m256i const & a) {
+            return _mm256_permute4x64_epi64(a, 0x1B);
+        }
+        static UME_FORCE_INLINE __m256i minLanes(__m256i const & a, __m256i const & b) {
+            return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b));
+        }
+        static UME_FORCE_INLINE __m256i maxLanes(__m256i const & a, __m256i const & b) {
+            return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b));
+        }
+        // Low 64 bits of the product, built from 32b x 32b partial products.
+        // The result is the same for signed and unsigned operands.
+        static UME_FORCE_INLINE __m256i mulLanes(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_mul_epu32(a, b);
+            __m256i t1 = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b);
+            __m256i t2 = _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32));
+            __m256i t3 = _mm256_slli_epi64(_mm256_add_epi64(t1, t2), 32);
+            return _mm256_add_epi64(t0, t3);
+        }
+        static UME_FORCE_INLINE __m256i absLanes(__m256i const & a) {
+            __m256i t0 = _mm256_cmpgt_epi64(_mm256_setzero_si256(), a);
+            return _mm256_sub_epi64(_mm256_xor_si256(a, t0), t0);
+        }
+        // AVX2 has no scatter instruction, so lanes selected by bits of 'm'
+        // are stored one by one.
+        static UME_FORCE_INLINE void scatterLanes(int64_t * baseAddr, __m256i const & v, __m256i const & indices, int m) {
+            __m128i v0 = _mm256_castsi256_si128(v);
+            __m128i v1 = _mm256_extracti128_si256(v, 1);
+            __m128i t0 = _mm256_castsi256_si128(indices);
+            __m128i t1 = _mm256_extracti128_si256(indices, 1);
+            if (m & 0x1) baseAddr[_mm_cvtsi128_si64(t0)] = _mm_cvtsi128_si64(v0);
+            if (m & 0x2) baseAddr[_mm_extract_epi64(t0, 1)] = _mm_extract_epi64(v0, 1);
+            if (m & 0x4) baseAddr[_mm_cvtsi128_si64(t1)] = _mm_cvtsi128_si64(v1);
+            if (m & 0x8) baseAddr[_mm_extract_epi64(t1, 1)] = _mm_extract_epi64(v1, 1);
+        }
+        // Stores lanes of 'v' selected by bits of 'm' contiguously, starting
+        // at 'p', and returns their count.
+        static UME_FORCE_INLINE uint32_t compressLanes(int64_t * p, __m256i const & v, int m) {
+            // Each entry holds eight 3-bit 32b element indices in bits 0..23, and
+            // the number of selected lanes in bits 24..31.
+            static const uint32_t table[16] = {
+                0x00000000, 0x01000008, 0x0100001A, 0x02000688, 0x0100002C, 0x02000B08, 0x02000B1A, 0x0302C688,
+                0x0100003E, 0x02000F88, 0x02000F9A, 0x0303E688, 0x02000FAC, 0x0303EB08, 0x0303EB1A, 0x04FAC688
+            };
+            uint32_t t0 = table[m];
+            uint32_t n = t0 >> 24;
+            __m256i t1 = _mm256_srlv_epi32(_mm256_set1_epi32(int(t0)), _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21));
+            __m256i t2 = _mm256_permutevar8x32_epi32(v, _mm256_and_si256(t1, _mm256_set1_epi32(0x7)));
+            __m256i t3 = _mm256_cmpgt_epi64(_mm256_set1_epi64x(int64_t(n)), _mm256_setr_epi64x(0, 1, 2, 3));
+            _mm256_maskstore_epi64((long long *)p, t3, t2);
+            return n;
+        }
     public:
 
         constexpr static uint32_t length() { return 4; }
@@ -191,7 +289,7 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<4> const & mask, int64_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
+            __m256i t0 = MASK_LOAD(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
@@ -206,6 +304,13 @@ namespace SIMD {
             mVec = BLEND(mVec, t0, mask.mMask);
             return *this;
         }
+        // LOADN
+        UME_FORCE_INLINE SIMDVec_i & loadn(uint32_t n, int64_t const * p) {
+            __m256i t0 = _mm256_setr_epi64x(0, 1, 2, 3);
+            __m256i t1 = _mm256_cmpgt_epi64(SET1_EPI64(n < 4 ? n : 4), t0);
+            mVec = _mm256_maskload_epi64((long long const *)p, t1);
+            return *this;
+        }
         // STORE
         UME_FORCE_INLINE int64_t * store(int64_t * p) const {
             _mm256_storeu_si256((__m256i*) p, mVec);
@@ -213,9 +318,14 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE int64_t * store(SIMDVecMask<4> const & mask, int64_t * p) const {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
-            __m256i t1 = BLEND(t0, mVec, mask.mMask);
-            _mm256_storeu_si256((__m256i*) p, t1);
+            MASK_STORE(p, mask.mMask, mVec);
+            return p;
+        }
+        // STOREN
+        UME_FORCE_INLINE int64_t* storen(uint32_t n, int64_t * p) const {
+            __m256i t0 = _mm256_setr_epi64x(0, 1, 2, 3);
+            __m256i t1 = _mm256_cmpgt_epi64(SET1_EPI64(n < 4 ? n : 4), t0);
+            _mm256_maskstore_epi64((long long *)p, t1, mVec);
             return p;
         }
         // STOREA
@@ -231,6 +341,15 @@ namespace SIMD {
             return p;
         }
 
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressstore(SIMDVecMask<4> const & mask, int64_t * p) const {
+#if defined UME_USE_MASK_64B
+            int t0 = _mm256_movemask_pd(_mm256_castsi256_pd(mask.mMask));
+#else
+            int t0 = _mm_movemask_ps(_mm_castsi128_ps(mask.mMask));
+#endif
+            return compressLanes(p, mVec, t0);
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
             __m256i t0 = BLEND(mVec, b.mVec, mask.mMask);
@@ -243,7 +362,36 @@ namespace SIMD {
             return SIMDVec_i(t1);
         }
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_i swizzle(SIMDSwizzle<4> const & sMask) const {
+            // Expand each 64-bit lane index i into the 32-bit index pair (2i, 2i+1).
+            __m256i t0 = _mm256_cvtepu32_epi64(sMask.mVec);
+            __m256i t1 = _mm256_slli_epi64(t0, 1);
+            __m256i t2 = _mm256_or_si256(t1, _mm256_slli_epi64(t1, 32));
+            __m256i t3 = _mm256_add_epi32(t2, _mm256_setr_epi32(0, 1, 0, 1, 0, 1, 0, 1));
+            __m256i t4 = _mm256_permutevar8x32_epi32(mVec, t3);
+            return SIMDVec_i(t4);
+        }
+        template<int i0, int i1, int i2, int i3>
+        UME_FORCE_INLINE SIMDVec_i swizzle() const {
+            __m256i t0 = _mm256_permute4x64_epi64(mVec, (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6));
+            return SIMDVec_i(t0);
+        }
         // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_i & swizzlea(SIMDSwizzle<4> const & sMask) {
+            SIMDVec_i t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() const {
+            __m256i t0 = sortLanes(mVec);
+            return SIMDVec_i(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() const {
+            __m256i t0 = reverseLanes(sortLanes(mVec));
+            return SIMDVec_i(t0);
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
@@ -302,13 +450,53 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+            return SIMDVec_i(t1);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec = saturatedAdd(mVec, b.mVec);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec = saturatedAdd(mVec, t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<4> const & mask, int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_i postinc() {
             __m256i t0 = mVec;
@@ -396,33 +584,191 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+            return SIMDVec_i(t1);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec = saturatedSub(mVec, b.mVec);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec = saturatedSub(mVec, t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<4> const & mask, int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_sub_epi64(b.mVec, mVec);
+            return SIMDVec_i(t0);
+        }
         // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_sub_epi64(b.mVec, mVec);
+            __m256i t1 = BLEND(b.mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_i subfrom(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_sub_epi64(t0, mVec);
+            return SIMDVec_i(t1);
+        }
         // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_sub_epi64(t0, mVec);
+            __m256i t2 = BLEND(t0, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVec_i const & b) {
+            mVec = _mm256_sub_epi64(b.mVec, mVec);
+            return *this;
+        }
         // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = _mm256_sub_epi64(b.mVec, mVec);
+            mVec = BLEND(b.mVec, t0, mask.mMask);
+            return *this;
+        }
         // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec = _mm256_sub_epi64(t0, mVec);
+            return *this;
+        }
         // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVecMask<4> const & mask, int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_sub_epi64(t0, mVec);
+            mVec = BLEND(t0, t1, mask.mMask);
+            return *this;
+        }
         // POSTDEC
+        UME_FORCE_INLINE SIMDVec_i postdec() {
+            __m256i t0 = mVec;
+            mVec = _mm256_sub_epi64(mVec, SET1_EPI64(1));
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator-- (int) {
+            return postdec();
+        }
         // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_i postdec(SIMDVecMask<4> const & mask) {
+            __m256i t0 = mVec;
+            __m256i t1 = _mm256_sub_epi64(mVec, SET1_EPI64(1));
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t0);
+        }
         // PREFDEC
+        UME_FORCE_INLINE SIMDVec_i & prefdec() {
+            mVec = _mm256_sub_epi64(mVec, SET1_EPI64(1));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-- () {
+            return prefdec();
+        }
         // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_i & prefdec(SIMDVecMask<4> const & mask) {
+            __m256i t0 = _mm256_sub_epi64(mVec, SET1_EPI64(1));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // MULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVec_i const & b) const {
+            __m256i t0 = mulLanes(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (SIMDVec_i const & b) const {
+            return mul(b);
+        }
         // MMULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = mulLanes(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // MULS
+        UME_FORCE_INLINE SIMDVec_i mul(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = mulLanes(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (int64_t b) const {
+            return mul(b);
+        }
         // MMULS
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = mulLanes(mVec, t0);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // MULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVec_i const & b) {
+            mVec = mulLanes(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (SIMDVec_i const & b) {
+            return mula(b);
+        }
         // MMULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = mulLanes(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // MULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec = mulLanes(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (int64_t b) {
+            return mula(b);
+        }
         // MMULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<4> const & mask, int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = mulLanes(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // DIVV
         // MDIVV
         // DIVS
@@ -441,162 +787,1135 @@ namespace SIMD {
         // MRCPSA
 
         // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpeq(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_cmpeq_epi64(mVec, b.mVec);
+            return SIMDVecMask<4>(TO_MASK(t0));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator== (SIMDVec_i const & b) const {
+            return cmpeq(b);
+        }
         // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<4> cmpeq(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_cmpeq_epi64(mVec, t0);
+            return SIMDVecMask<4>(TO_MASK(t1));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator== (int64_t b) const {
+            return cmpeq(b);
+        }
         // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpne(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_xor_si256(_mm256_cmpeq_epi64(mVec, b.mVec), _mm256_set1_epi32(-1));
+            return SIMDVecMask<4>(TO_MASK(t0));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator!= (SIMDVec_i const & b) const {
+            return cmpne(b);
+        }
         // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<4> cmpne(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_xor_si256(_mm256_cmpeq_epi64(mVec, t0), _mm256_set1_epi32(-1));
+            return SIMDVecMask<4>(TO_MASK(t1));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator!= (int64_t b) const {
+            return cmpne(b);
+        }
         // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpgt(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_cmpgt_epi64(mVec, b.mVec);
+            return SIMDVecMask<4>(TO_MASK(t0));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator> (SIMDVec_i const & b) const {
+            return cmpgt(b);
+        }
         // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<4> cmpgt(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_cmpgt_epi64(mVec, t0);
+            return SIMDVecMask<4>(TO_MASK(t1));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator> (int64_t b) const {
+            return cmpgt(b);
+        }
         // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<4> cmplt(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_cmpgt_epi64(b.mVec, mVec);
+            return SIMDVecMask<4>(TO_MASK(t0));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator< (SIMDVec_i const & b) const {
+            return cmplt(b);
+        }
         // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<4> cmplt(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_cmpgt_epi64(t0, mVec);
+            return SIMDVecMask<4>(TO_MASK(t1));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator< (int64_t b) const {
+            return cmplt(b);
+        }
         // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpge(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_xor_si256(_mm256_cmpgt_epi64(b.mVec, mVec), _mm256_set1_epi32(-1));
+            return SIMDVecMask<4>(TO_MASK(t0));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator>= (SIMDVec_i const & b) const {
+            return cmpge(b);
+        }
         // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<4> cmpge(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_xor_si256(_mm256_cmpgt_epi64(t0, mVec), _mm256_set1_epi32(-1));
+            return SIMDVecMask<4>(TO_MASK(t1));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator>= (int64_t b) const {
+            return cmpge(b);
+        }
         // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmple(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_xor_si256(_mm256_cmpgt_epi64(mVec, b.mVec), _mm256_set1_epi32(-1));
+            return SIMDVecMask<4>(TO_MASK(t0));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator<= (SIMDVec_i const & b) const {
+            return cmple(b);
+        }
         // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<4> cmple(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_xor_si256(_mm256_cmpgt_epi64(mVec, t0), _mm256_set1_epi32(-1));
+            return SIMDVecMask<4>(TO_MASK(t1));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator<= (int64_t b) const {
+            return cmple(b);
+        }
         // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_cmpeq_epi64(mVec, b.mVec);
+            return _mm256_movemask_epi8(t0) == -1;
+        }
         // CMPES
+        UME_FORCE_INLINE bool cmpe(int64_t b) const {
+            __m256i t0 = _mm256_cmpeq_epi64(mVec, SET1_EPI64(b));
+            return _mm256_movemask_epi8(t0) == -1;
+        }
         // UNIQUE
+        UME_FORCE_INLINE bool unique() const {
+            // Comparing with lanes rotated by one and by two covers every pair of lanes.
+            __m256i t0 = _mm256_cmpeq_epi64(mVec, _mm256_permute4x64_epi64(mVec, 0x39));
+            __m256i t1 = _mm256_cmpeq_epi64(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t2 = _mm256_or_si256(t0, t1);
+            return _mm256_testz_si256(t2, t2) != 0;
+        }
         // HADD
+        UME_FORCE_INLINE int64_t hadd() const {
+            __m256i t0 = _mm256_add_epi64(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = _mm256_add_epi64(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval;
+        }
         // MHADD
+        UME_FORCE_INLINE int64_t hadd(SIMDVecMask<4> const & mask) const {
+            __m256i t0 = BLEND(_mm256_setzero_si256(), mVec, mask.mMask);
+            __m256i t1 = _mm256_add_epi64(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = _mm256_add_epi64(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval;
+        }
         // HADDS
+        UME_FORCE_INLINE int64_t hadd(int64_t b) const {
+            __m256i t0 = _mm256_add_epi64(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = _mm256_add_epi64(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval + b;
+        }
         // MHADDS
+        UME_FORCE_INLINE int64_t hadd(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256i t0 = BLEND(_mm256_setzero_si256(), mVec, mask.mMask);
+            __m256i t1 = _mm256_add_epi64(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = _mm256_add_epi64(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval + b;
+        }
         // HMUL
+        UME_FORCE_INLINE int64_t hmul() const {
+            __m256i t0 = mulLanes(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = mulLanes(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval;
+        }
         // MHMUL
+        UME_FORCE_INLINE int64_t hmul(SIMDVecMask<4> const & mask) const {
+            __m256i t0 = BLEND(SET1_EPI64(1), mVec, mask.mMask);
+            __m256i t1 = mulLanes(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = mulLanes(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval;
+        }
         // HMULS
+        UME_FORCE_INLINE int64_t hmul(int64_t b) const {
+            __m256i t0 = mulLanes(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = mulLanes(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval * b;
+        }
         // MHMULS
+        UME_FORCE_INLINE int64_t hmul(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256i t0 = BLEND(SET1_EPI64(1), mVec, mask.mMask);
+            __m256i t1 = mulLanes(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = mulLanes(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval * b;
+        }
         // FMULADDV
+        UME_FORCE_INLINE SIMDVec_i fmuladd(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i t0 = mulLanes(mVec, b.mVec);
+            __m256i t1 = _mm256_add_epi64(t0, c.mVec);
+            return SIMDVec_i(t1);
+        }
         // MFMULADDV
+        UME_FORCE_INLINE SIMDVec_i fmuladd(SIMDVecMask<4> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i t0 = mulLanes(mVec, b.mVec);
+            __m256i t1 = _mm256_add_epi64(t0, c.mVec);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // FMULSUBV
+        UME_FORCE_INLINE SIMDVec_i fmulsub(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i t0 = mulLanes(mVec, b.mVec);
+            __m256i t1 = _mm256_sub_epi64(t0, c.mVec);
+            return SIMDVec_i(t1);
+        }
         // MFMULSUBV
+        UME_FORCE_INLINE SIMDVec_i fmulsub(SIMDVecMask<4> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i t0 = mulLanes(mVec, b.mVec);
+            __m256i t1 = _mm256_sub_epi64(t0, c.mVec);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // FADDMULV
+        UME_FORCE_INLINE SIMDVec_i faddmul(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i t0 = _mm256_add_epi64(mVec, b.mVec);
+            __m256i t1 = mulLanes(t0, c.mVec);
+            return SIMDVec_i(t1);
+        }
         // MFADDMULV
+        UME_FORCE_INLINE SIMDVec_i faddmul(SIMDVecMask<4> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i t0 = _mm256_add_epi64(mVec, b.mVec);
+            __m256i t1 = mulLanes(t0, c.mVec);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // FSUBMULV
+        UME_FORCE_INLINE SIMDVec_i fsubmul(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i t0 = _mm256_sub_epi64(mVec, b.mVec);
+            __m256i t1 = mulLanes(t0, c.mVec);
+            return SIMDVec_i(t1);
+        }
         // MFSUBMULV
+        UME_FORCE_INLINE SIMDVec_i fsubmul(SIMDVecMask<4> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m256i t0 = _mm256_sub_epi64(mVec, b.mVec);
+            __m256i t1 = mulLanes(t0, c.mVec);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // MAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVec_i const & b) const {
+            __m256i t0 = maxLanes(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // MMAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = maxLanes(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // MAXS
+        UME_FORCE_INLINE SIMDVec_i max(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = maxLanes(mVec, t0);
+            return SIMDVec_i(t1);
+        }
         // MMAXS
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = maxLanes(mVec, t0);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // MAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVec_i const & b) {
+            mVec = maxLanes(mVec, b.mVec);
+            return *this;
+        }
         // MMAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = maxLanes(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // MAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec = maxLanes(mVec, t0);
+            return *this;
+        }
         // MMAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<4> const & mask, int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = maxLanes(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // MINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVec_i const & b) const {
+            __m256i t0 = minLanes(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // MMINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = minLanes(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // MINS
+        UME_FORCE_INLINE SIMDVec_i min(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = minLanes(mVec, t0);
+            return SIMDVec_i(t1);
+        }
         // MMINS
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = minLanes(mVec, t0);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // MINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVec_i const & b) {
+            mVec = minLanes(mVec, b.mVec);
+            return *this;
+        }
         // MMINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = minLanes(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // MINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec = minLanes(mVec, t0);
+            return *this;
+        }
         // MMINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<4> const & mask, int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = minLanes(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // HMAX
+        UME_FORCE_INLINE int64_t hmax() const {
+            __m256i t0 = maxLanes(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = maxLanes(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval;
+        }
         // MHMAX
+        UME_FORCE_INLINE int64_t hmax(SIMDVecMask<4> const & mask) const {
+            __m256i t0 = BLEND(SET1_EPI64(std::numeric_limits<int64_t>::min()), mVec, mask.mMask);
+            __m256i t1 = maxLanes(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = maxLanes(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval;
+        }
         // IMAX
         // MIMAX
         // HMIN
+        UME_FORCE_INLINE int64_t hmin() const {
+            __m256i t0 = minLanes(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = minLanes(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval;
+        }
         // MHMIN
+        UME_FORCE_INLINE int64_t hmin(SIMDVecMask<4> const & mask) const {
+            __m256i t0 = BLEND(SET1_EPI64(std::numeric_limits<int64_t>::max()), mVec, mask.mMask);
+            __m256i t1 = minLanes(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = minLanes(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval;
+        }
         // IMIN
         // MIMIN
 
         // BANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_and_si256(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator& (SIMDVec_i const & b) const {
+            return band(b);
+        }
         // MBANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_and_si256(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // BANDS
+        UME_FORCE_INLINE SIMDVec_i band(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_and_si256(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator& (int64_t b) const {
+            return band(b);
+        }
         // MBANDS
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_and_si256(mVec, t0);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // BANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVec_i const & b) {
+            mVec = _mm256_and_si256(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (SIMDVec_i const & b) {
+            return banda(b);
+        }
         // MBANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = _mm256_and_si256(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // BANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec = _mm256_and_si256(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (int64_t b) {
+            return banda(b);
+        }
         // MBANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<4> const & mask, int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_and_si256(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // BORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_or_si256(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (SIMDVec_i const & b) const {
+            return bor(b);
+        }
         // MBORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_or_si256(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // BORS
+        UME_FORCE_INLINE SIMDVec_i bor(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_or_si256(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (int64_t b) const {
+            return bor(b);
+        }
         // MBORS
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_or_si256(mVec, t0);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // BORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVec_i const & b) {
+            mVec = _mm256_or_si256(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (SIMDVec_i const & b) {
+            return bora(b);
+        }
         // MBORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = _mm256_or_si256(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // BORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec = _mm256_or_si256(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (int64_t b) {
+            return bora(b);
+        }
         // MBORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<4> const & mask, int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_or_si256(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // BXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_xor_si256(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (SIMDVec_i const & b) const {
+            return bxor(b);
+        }
         // MBXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = _mm256_xor_si256(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // BXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_xor_si256(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (int64_t b) const {
+            return bxor(b);
+        }
         // MBXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_xor_si256(mVec, t0);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // BXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVec_i const & b) {
+            mVec = _mm256_xor_si256(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (SIMDVec_i const & b) {
+            return bxora(b);
+        }
         // MBXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = _mm256_xor_si256(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // BXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec = _mm256_xor_si256(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (int64_t b) {
+            return bxora(b);
+        }
         // MBXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<4> const & mask, int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_xor_si256(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // BNOT
+        UME_FORCE_INLINE SIMDVec_i bnot() const {
+            __m256i t0 = _mm256_xor_si256(mVec, _mm256_set1_epi32(-1));
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator~ () const {
+            return bnot();
+        }
         // MBNOT
+        UME_FORCE_INLINE SIMDVec_i bnot(SIMDVecMask<4> const & mask) const {
+            __m256i t0 = _mm256_xor_si256(mVec, _mm256_set1_epi32(-1));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // BNOTA
+        UME_FORCE_INLINE SIMDVec_i & bnota() {
+            mVec = _mm256_xor_si256(mVec, _mm256_set1_epi32(-1));
+            return *this;
+        }
         // MBNOTA
+        UME_FORCE_INLINE SIMDVec_i & bnota(SIMDVecMask<4> const & mask) {
+            __m256i t0 = _mm256_xor_si256(mVec, _mm256_set1_epi32(-1));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // HBAND
+        UME_FORCE_INLINE int64_t hband() const {
+            __m256i t0 = _mm256_and_si256(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = _mm256_and_si256(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval;
+        }
         // MHBAND
+        UME_FORCE_INLINE int64_t hband(SIMDVecMask<4> const & mask) const {
+            __m256i t0 = BLEND(_mm256_set1_epi32(-1), mVec, mask.mMask);
+            __m256i t1 = _mm256_and_si256(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = _mm256_and_si256(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval;
+        }
         // HBANDS
+        UME_FORCE_INLINE int64_t hband(int64_t b) const {
+            __m256i t0 = _mm256_and_si256(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = _mm256_and_si256(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval & b;
+        }
         // MHBANDS
+        UME_FORCE_INLINE int64_t hband(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256i t0 = BLEND(_mm256_set1_epi32(-1), mVec, mask.mMask);
+            __m256i t1 = _mm256_and_si256(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = _mm256_and_si256(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval & b;
+        }
         // HBOR
+        UME_FORCE_INLINE int64_t hbor() const {
+            __m256i t0 = _mm256_or_si256(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = _mm256_or_si256(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval;
+        }
         // MHBOR
+        UME_FORCE_INLINE int64_t hbor(SIMDVecMask<4> const & mask) const {
+            __m256i t0 = BLEND(_mm256_setzero_si256(), mVec, mask.mMask);
+            __m256i t1 = _mm256_or_si256(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = _mm256_or_si256(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval;
+        }
         // HBORS
+        UME_FORCE_INLINE int64_t hbor(int64_t b) const {
+            __m256i t0 = _mm256_or_si256(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = _mm256_or_si256(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval | b;
+        }
         // MHBORS
+        UME_FORCE_INLINE int64_t hbor(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256i t0 = BLEND(_mm256_setzero_si256(), mVec, mask.mMask);
+            __m256i t1 = _mm256_or_si256(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = _mm256_or_si256(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval | b;
+        }
         // HBXOR
+        UME_FORCE_INLINE int64_t hbxor() const {
+            __m256i t0 = _mm256_xor_si256(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = _mm256_xor_si256(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval;
+        }
         // MHBXOR
+        UME_FORCE_INLINE int64_t hbxor(SIMDVecMask<4> const & mask) const {
+            __m256i t0 = BLEND(_mm256_setzero_si256(), mVec, mask.mMask);
+            __m256i t1 = _mm256_xor_si256(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = _mm256_xor_si256(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval;
+        }
         // HBXORS
+        UME_FORCE_INLINE int64_t hbxor(int64_t b) const {
+            __m256i t0 = _mm256_xor_si256(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = _mm256_xor_si256(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval ^ b;
+        }
         // MHBXORS
+        UME_FORCE_INLINE int64_t hbxor(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256i t0 = BLEND(_mm256_setzero_si256(), mVec, mask.mMask);
+            __m256i t1 = _mm256_xor_si256(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = _mm256_xor_si256(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval ^ b;
+        }
 
+        // GATHERU
+        UME_FORCE_INLINE SIMDVec_i & gatheru(int64_t const * baseAddr, uint32_t stride) {
+            __m256i t0 = _mm256_mul_epu32(_mm256_setr_epi64x(0, 1, 2, 3), SET1_EPI64(stride));
+            mVec = _mm256_i64gather_epi64((long long const *)baseAddr, t0, 8);
+            return *this;
+        }
+        // MGATHERU
+        UME_FORCE_INLINE SIMDVec_i & gatheru(SIMDVecMask<4> const & mask, int64_t const * baseAddr, uint32_t stride) {
+            __m256i t0 = _mm256_mul_epu32(_mm256_setr_epi64x(0, 1, 2, 3), SET1_EPI64(stride));
+            mVec = MASK_GATHER(mVec, baseAddr, t0, mask.mMask);
+            return *this;
+        }
         // GATHERS
+        UME_FORCE_INLINE SIMDVec_i & gather(int64_t const * baseAddr, uint64_t const * indices) {
+            __m256i t0 = _mm256_loadu_si256((__m256i const *)indices);
+            mVec = _mm256_i64gather_epi64((long long const *)baseAddr, t0, 8);
+            return *this;
+        }
         // MGATHERS
+        UME_FORCE_INLINE SIMDVec_i & gather(SIMDVecMask<4> const & mask, int64_t const * baseAddr, uint64_t const * indices) {
+            __m256i t0 = MASK_LOAD(indices, mask.mMask);
+            mVec = MASK_GATHER(mVec, baseAddr, t0, mask.mMask);
+            return *this;
+        }
         // GATHERV
+        UME_FORCE_INLINE SIMDVec_i & gather(int64_t const * baseAddr, SIMDVec_u<uint64_t, 4> const & indices) {
+            mVec = _mm256_i64gather_epi64((long long const *)baseAddr, indices.mVec, 8);
+            return *this;
+        }
         // MGATHERV
+        UME_FORCE_INLINE SIMDVec_i & gather(SIMDVecMask<4> const & mask, int64_t const * baseAddr, SIMDVec_u<uint64_t, 4> const & indices) {
+            mVec = MASK_GATHER(mVec, baseAddr, indices.mVec, mask.mMask);
+            return *this;
+        }
+        // SCATTERU
+        UME_FORCE_INLINE int64_t* scatteru(int64_t* baseAddr, uint32_t stride) const {
+            __m256i t0 = _mm256_mul_epu32(_mm256_setr_epi64x(0, 1, 2, 3), SET1_EPI64(stride));
+            scatterLanes(baseAddr, mVec, t0, 0xF);
+            return baseAddr;
+        }
+        // MSCATTERU
+        UME_FORCE_INLINE int64_t* scatteru(SIMDVecMask<4> const & mask, int64_t* baseAddr, uint32_t stride) const {
+            __m256i t0 = _mm256_mul_epu32(_mm256_setr_epi64x(0, 1, 2, 3), SET1_EPI64(stride));
+            scatterLanes(baseAddr, mVec, t0, MOVEMASK(mask.mMask));
+            return baseAddr;
+        }
         // SCATTERS
+        UME_FORCE_INLINE int64_t* scatter(int64_t* baseAddr, uint64_t* indices) const {
+            scatterLanes(baseAddr, mVec, _mm256_loadu_si256((__m256i*)indices), 0xF);
+            return baseAddr;
+        }
         // MSCATTERS
+        UME_FORCE_INLINE int64_t* scatter(SIMDVecMask<4> const & mask, int64_t* baseAddr, uint64_t* indices) const {
+            __m256i t0 = MASK_LOAD(indices, mask.mMask);
+            scatterLanes(baseAddr, mVec, t0, MOVEMASK(mask.mMask));
+            return baseAddr;
+        }
         // SCATTERV
+        UME_FORCE_INLINE int64_t* scatter(int64_t* baseAddr, SIMDVec_u<uint64_t, 4> const & indices) const {
+            scatterLanes(baseAddr, mVec, indices.mVec, 0xF);
+            return baseAddr;
+        }
         // MSCATTERV
+        UME_FORCE_INLINE int64_t* scatter(SIMDVecMask<4> const & mask, int64_t* baseAddr, SIMDVec_u<uint64_t, 4> const & indices) const {
+            scatterLanes(baseAddr, mVec, indices.mVec, MOVEMASK(mask.mMask));
+            return baseAddr;
+        }
 
         // LSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVec_u<uint64_t, 4> const & b) const {
+            __m256i t0 = _mm256_sllv_epi64(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (SIMDVec_u<uint64_t, 4> const & b) const {
+            return lsh(b);
+        }
         // MLSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<4> const & mask, SIMDVec_u<uint64_t, 4> const & b) const {
+            __m256i t0 = _mm256_sllv_epi64(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // LSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sll_epi64(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (uint64_t b) const {
+            return lsh(b);
+        }
         // MLSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sll_epi64(mVec, t0);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
         // LSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVec_u<uint64_t, 4> const & b) {
+            mVec = _mm256_sllv_epi64(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (SIMDVec_u<uint64_t, 4> const & b) {
+            return lsha(b);
+        }
         // MLSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<4> const & mask, SIMDVec_u<uint64_t, 4> const & b) {
+            __m256i t0 = _mm256_sllv_epi64(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // LSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = _mm256_sll_epi64(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (uint64_t b) {
+            return lsha(b);
+        }
         // MLSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sll_epi64(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // RSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVec_u<uint64_t, 4> const & b) const {
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_cmpgt_epi64(t0, mVec);
+            __m256i t2 = _mm256_xor_si256(mVec, t1);
+            __m256i t3 = _mm256_srlv_epi64(t2, b.mVec);
+            __m256i t4 = _mm256_xor_si256(t3, t1);
+            return SIMDVec_i(t4);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (SIMDVec_u<uint64_t, 4> const & b) const {
+            return rsh(b);
+        }
         // MRSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<4> const & mask, SIMDVec_u<uint64_t, 4> const & b) const {
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_cmpgt_epi64(t0, mVec);
+            __m256i t2 = _mm256_xor_si256(mVec, t1);
+            __m256i t3 = _mm256_srlv_epi64(t2, b.mVec);
+            __m256i t4 = _mm256_xor_si256(t3, t1);
+            __m256i t5 = BLEND(mVec, t4, mask.mMask);
+            return SIMDVec_i(t5);
+        }
         // RSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_setzero_si256();
+            __m256i t2 = _mm256_cmpgt_epi64(t1, mVec);
+            __m256i t3 = _mm256_xor_si256(mVec, t2);
+            __m256i t4 = _mm256_srl_epi64(t3, t0);
+            __m256i t5 = _mm256_xor_si256(t4, t2);
+            return SIMDVec_i(t5);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (uint64_t b) const {
+            return rsh(b);
+        }
         // MRSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_setzero_si256();
+            __m256i t2 = _mm256_cmpgt_epi64(t1, mVec);
+            __m256i t3 = _mm256_xor_si256(mVec, t2);
+            __m256i t4 = _mm256_srl_epi64(t3, t0);
+            __m256i t5 = _mm256_xor_si256(t4, t2);
+            __m256i t6 = BLEND(mVec, t5, mask.mMask);
+            return SIMDVec_i(t6);
+        }
         // RSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVec_u<uint64_t, 4> const & b) {
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_cmpgt_epi64(t0, mVec);
+            __m256i t2 = _mm256_xor_si256(mVec, t1);
+            __m256i t3 = _mm256_srlv_epi64(t2, b.mVec);
+            mVec = _mm256_xor_si256(t3, t1);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (SIMDVec_u<uint64_t, 4> const & b) {
+            return rsha(b);
+        }
         // MRSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<4> const & mask, SIMDVec_u<uint64_t, 4> const & b) {
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_cmpgt_epi64(t0, mVec);
+            __m256i t2 = _mm256_xor_si256(mVec, t1);
+            __m256i t3 = _mm256_srlv_epi64(t2, b.mVec);
+            __m256i t4 = _mm256_xor_si256(t3, t1);
+            mVec = BLEND(mVec, t4, mask.mMask);
+            return *this;
+        }
         // RSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_setzero_si256();
+            __m256i t2 = _mm256_cmpgt_epi64(t1, mVec);
+            __m256i t3 = _mm256_xor_si256(mVec, t2);
+            __m256i t4 = _mm256_srl_epi64(t3, t0);
+            mVec = _mm256_xor_si256(t4, t2);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (uint64_t b) {
+            return rsha(b);
+        }
         // MRSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_setzero_si256();
+            __m256i t2 = _mm256_cmpgt_epi64(t1, mVec);
+            __m256i t3 = _mm256_xor_si256(mVec, t2);
+            __m256i t4 = _mm256_srl_epi64(t3, t0);
+            __m256i t5 = _mm256_xor_si256(t4, t2);
+            mVec = BLEND(mVec, t5, mask.mMask);
+            return *this;
+        }
         // ROLV
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVec_u<uint64_t, 4> const & b) const {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec, t2);
+            __m256i t5 = _mm256_srlv_epi64(mVec, t3);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            return SIMDVec_i(t6);
+        }
         // MROLV
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVecMask<4> const & mask, SIMDVec_u<uint64_t, 4> const & b) const {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec, t2);
+            __m256i t5 = _mm256_srlv_epi64(mVec, t3);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            __m256i t7 = BLEND(mVec, t6, mask.mMask);
+            return SIMDVec_i(t7);
+        }
         // ROLS
+        UME_FORCE_INLINE SIMDVec_i rol(uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec, t0);
+            __m256i t3 = _mm256_srl_epi64(mVec, t1);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            return SIMDVec_i(t4);
+        }
         // MROLS
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec, t0);
+            __m256i t3 = _mm256_srl_epi64(mVec, t1);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            __m256i t5 = BLEND(mVec, t4, mask.mMask);
+            return SIMDVec_i(t5);
+        }
         // ROLVA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVec_u<uint64_t, 4> const & b) {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec, t2);
+            __m256i t5 = _mm256_srlv_epi64(mVec, t3);
+            mVec = _mm256_or_si256(t4, t5);
+            return *this;
+        }
         // MROLVA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVecMask<4> const & mask, SIMDVec_u<uint64_t, 4> const & b) {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec, t2);
+            __m256i t5 = _mm256_srlv_epi64(mVec, t3);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            mVec = BLEND(mVec, t6, mask.mMask);
+            return *this;
+        }
         // ROLSA
+        UME_FORCE_INLINE SIMDVec_i & rola(uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec, t0);
+            __m256i t3 = _mm256_srl_epi64(mVec, t1);
+            mVec = _mm256_or_si256(t2, t3);
+            return *this;
+        }
         // MROLSA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec, t0);
+            __m256i t3 = _mm256_srl_epi64(mVec, t1);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            mVec = BLEND(mVec, t4, mask.mMask);
+            return *this;
+        }
         // RORV
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVec_u<uint64_t, 4> const & b) const {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec, t3);
+            __m256i t5 = _mm256_srlv_epi64(mVec, t2);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            return SIMDVec_i(t6);
+        }
         // MRORV
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVecMask<4> const & mask, SIMDVec_u<uint64_t, 4> const & b) const {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec, t3);
+            __m256i t5 = _mm256_srlv_epi64(mVec, t2);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            __m256i t7 = BLEND(mVec, t6, mask.mMask);
+            return SIMDVec_i(t7);
+        }
         // RORS
+        UME_FORCE_INLINE SIMDVec_i ror(uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec, t1);
+            __m256i t3 = _mm256_srl_epi64(mVec, t0);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            return SIMDVec_i(t4);
+        }
         // MRORS
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec, t1);
+            __m256i t3 = _mm256_srl_epi64(mVec, t0);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            __m256i t5 = BLEND(mVec, t4, mask.mMask);
+            return SIMDVec_i(t5);
+        }
         // RORVA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVec_u<uint64_t, 4> const & b) {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec, t3);
+            __m256i t5 = _mm256_srlv_epi64(mVec, t2);
+            mVec = _mm256_or_si256(t4, t5);
+            return *this;
+        }
         // MRORVA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVecMask<4> const & mask, SIMDVec_u<uint64_t, 4> const & b) {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec, t3);
+            __m256i t5 = _mm256_srlv_epi64(mVec, t2);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            mVec = BLEND(mVec, t6, mask.mMask);
+            return *this;
+        }
         // RORSA
+        UME_FORCE_INLINE SIMDVec_i & rora(uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec, t1);
+            __m256i t3 = _mm256_srl_epi64(mVec, t0);
+            mVec = _mm256_or_si256(t2, t3);
+            return *this;
+        }
         // MRORSA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec, t1);
+            __m256i t3 = _mm256_srl_epi64(mVec, t0);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            mVec = BLEND(mVec, t4, mask.mMask);
+            return *this;
+        }
 
         // NEG
+        UME_FORCE_INLINE SIMDVec_i neg() const {
+            __m256i t0 = _mm256_sub_epi64(_mm256_setzero_si256(), mVec);
+            return SIMDVec_i(t0);
+        }
         UME_FORCE_INLINE SIMDVec_i operator- () const {
             return neg();
         }
         // MNEG
+        UME_FORCE_INLINE SIMDVec_i neg(SIMDVecMask<4> const & mask) const {
+            __m256i t0 = _mm256_sub_epi64(_mm256_setzero_si256(), mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // NEGA
+        UME_FORCE_INLINE SIMDVec_i & nega() {
+            mVec = _mm256_sub_epi64(_mm256_setzero_si256(), mVec);
+            return *this;
+        }
         // MNEGA
+        UME_FORCE_INLINE SIMDVec_i & nega(SIMDVecMask<4> const & mask) {
+            __m256i t0 = _mm256_sub_epi64(_mm256_setzero_si256(), mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // ABS
+        UME_FORCE_INLINE SIMDVec_i abs() const {
+            __m256i t0 = absLanes(mVec);
+            return SIMDVec_i(t0);
+        }
         // MABS
+        UME_FORCE_INLINE SIMDVec_i abs(SIMDVecMask<4> const & mask) const {
+            __m256i t0 = absLanes(mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
         // ABSA
+        UME_FORCE_INLINE SIMDVec_i & absa() {
+            mVec = absLanes(mVec);
+            return *this;
+        }
         // MABSA
+        UME_FORCE_INLINE SIMDVec_i & absa(SIMDVecMask<4> const & mask) {
+            __m256i t0 = absLanes(mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
 
         // PACK
+        UME_FORCE_INLINE SIMDVec_i & pack(SIMDVec_i<int64_t, 2> const & a, SIMDVec_i<int64_t, 2> const & b) {
+            mVec = _mm256_setr_epi64x(a.mVec[0], a.mVec[1], b.mVec[0], b.mVec[1]);
+            return *this;
+        }
         // PACKLO
+        UME_FORCE_INLINE SIMDVec_i & packlo(SIMDVec_i<int64_t, 2> const & a) {
+            __m128i t0 = _mm_loadu_si128((__m128i const *)a.mVec);
+            mVec = _mm256_inserti128_si256(mVec, t0, 0);
+            return *this;
+        }
         // PACKHI
+        UME_FORCE_INLINE SIMDVec_i & packhi(SIMDVec_i<int64_t, 2> const & b) {
+            __m128i t0 = _mm_loadu_si128((__m128i const *)b.mVec);
+            mVec = _mm256_inserti128_si256(mVec, t0, 1);
+            return *this;
+        }
         // UNPACK
+        UME_FORCE_INLINE void unpack(SIMDVec_i<int64_t, 2> & a, SIMDVec_i<int64_t, 2> & b) const {
+            _mm_storeu_si128((__m128i *)a.mVec, _mm256_castsi256_si128(mVec));
+            _mm_storeu_si128((__m128i *)b.mVec, _mm256_extracti128_si256(mVec, 1));
+        }
         // UNPACKLO
+        UME_FORCE_INLINE SIMDVec_i<int64_t, 2> unpacklo() const {
+            SIMDVec_i<int64_t, 2> t0;
+            _mm_storeu_si128((__m128i *)t0.mVec, _mm256_castsi256_si128(mVec));
+            return t0;
+        }
         // UNPACKHI
+        UME_FORCE_INLINE SIMDVec_i<int64_t, 2> unpackhi() const {
+            SIMDVec_i<int64_t, 2> t0;
+            _mm_storeu_si128((__m128i *)t0.mVec, _mm256_extracti128_si256(mVec, 1));
+            return t0;
+        }
 
         // PROMOTE
         // -
@@ -614,5 +1933,10 @@ namespace SIMD {
 
 #undef SET1_EPI64
 #undef BLEND
+#undef MASK_LOAD
+#undef MASK_STORE
+#undef MASK_GATHER
+#undef MOVEMASK
+#undef TO_MASK
 
 #endif
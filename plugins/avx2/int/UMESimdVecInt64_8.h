@@ -100,6 +100,35 @@ namespace SIMD {
         __m256i mVec[2];
 
         UME_FORCE_INLINE explicit SIMDVec_i(__m256i & x0, __m256i & x1) { mVec[0] = x0; mVec[1] = x1; }
+
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m256i saturatedAdd(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_add_epi64(a, b);
+            __m256i t1 = _mm256_andnot_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, t0));
+            __m256i t2 = _mm256_xor_si256(_mm256_cmpgt_epi64(_mm256_setzero_si256(), a), _mm256_srli_epi64(_mm256_cmpeq_epi64(a, a), 1));
+            return _mm256_castpd_si256(_mm256_blendv_pd(_mm256_castsi256_pd(t0), _mm256_castsi256_pd(t2), _mm256_castsi256_pd(t1)));
+        }
+        static UME_FORCE_INLINE __m256i saturatedSub(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_sub_epi64(a, b);
+            __m256i t1 = _mm256_and_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, t0));
+            __m256i t2 = _mm256_xor_si256(_mm256_cmpgt_epi64(_mm256_setzero_si256(), a), _mm256_srli_epi64(_mm256_cmpeq_epi64(a, a), 1));
+            return _mm256_castpd_si256(_mm256_blendv_pd(_mm256_castsi256_pd(t0), _mm256_castsi256_pd(t2), _mm256_castsi256_pd(t1)));
+        }
+        // Sorting network kernels for 8 lanes held in a pair of registers. 'a'
+        // holds the lower lanes.
+        // Sorts a bitonic sequence in ascending order.
+        static UME_FORCE_INLINE void mergeLanes(__m256i & a, __m256i & b) {
+            __m256i t0 = SIMDVec_i<int64_t, 4>::minLanes(a, b);
+            __m256i t1 = SIMDVec_i<int64_t, 4>::maxLanes(a, b);
+            a = SIMDVec_i<int64_t, 4>::mergeLanes(t0);
+            b = SIMDVec_i<int64_t, 4>::mergeLanes(t1);
+        }
+        static UME_FORCE_INLINE void sortLanes(__m256i & a, __m256i & b) {
+            // Sorting the halves in opposite directions gives a bitonic sequence.
+            a = SIMDVec_i<int64_t, 4>::sortLanes(a);
+            b = SIMDVec_i<int64_t, 4>::reverseLanes(SIMDVec_i<int64_t, 4>::sortLanes(b));
+            mergeLanes(a, b);
+        }
     public:
 
         constexpr static uint32_t length() { return 8; }
@@ -281,10 +310,33 @@ namespace SIMD {
             return p;
         }
 
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressstore(SIMDVecMask<8> const & mask, int64_t * p) const {
+            int t0 = _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask));
+            uint32_t t1 = SIMDVec_i<int64_t, 4>::compressLanes(p, mVec[0], t0 & 0xF);
+            uint32_t t2 = SIMDVec_i<int64_t, 4>::compressLanes(p + t1, mVec[1], t0 >> 4);
+            return t1 + t2;
+        }
         // BLENDV
         // BLENDS
         // SWIZZLE
         // SWIZZLEA
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() const {
+            __m256i t0 = mVec[0];
+            __m256i t1 = mVec[1];
+            sortLanes(t0, t1);
+            return SIMDVec_i(t0, t1);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() const {
+            __m256i t0 = mVec[0];
+            __m256i t1 = mVec[1];
+            sortLanes(t0, t1);
+            __m256i t2 = SIMDVec_i<int64_t, 4>::reverseLanes(t1);
+            __m256i t3 = SIMDVec_i<int64_t, 4>::reverseLanes(t0);
+            return SIMDVec_i(t2, t3);
+        }
 
 
         // ADDV
@@ -328,13 +380,65 @@ namespace SIMD {
         // ADDSA
         // MADDSA
         // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m256i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            __m256i t1 = saturatedAdd(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            __m256i t1 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m256i t2 = saturatedAdd(mVec[1], b.mVec[1]);
+            __m256i t3 = BLEND_HI(mVec[1], t2, mask.mMask);
+            return SIMDVec_i(t1, t3);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = saturatedAdd(mVec[0], t0);
+            __m256i t2 = saturatedAdd(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<8> const & mask, int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = saturatedAdd(mVec[0], t0);
+            __m256i t2 = BLEND_LO(mVec[0], t1, mask.mMask);
+            __m256i t3 = saturatedAdd(mVec[1], t0);
+            __m256i t4 = BLEND_HI(mVec[1], t3, mask.mMask);
+            return SIMDVec_i(t2, t4);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec[0] = saturatedAdd(mVec[0], b.mVec[0]);
+            mVec[1] = saturatedAdd(mVec[1], b.mVec[1]);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            mVec[0] = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m256i t1 = saturatedAdd(mVec[1], b.mVec[1]);
+            mVec[1] = BLEND_HI(mVec[1], t1, mask.mMask);
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec[0] = saturatedAdd(mVec[0], t0);
+            mVec[1] = saturatedAdd(mVec[1], t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<8> const & mask, int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = saturatedAdd(mVec[0], t0);
+            mVec[0] = BLEND_LO(mVec[0], t1, mask.mMask);
+            __m256i t2 = saturatedAdd(mVec[1], t0);
+            mVec[1] = BLEND_HI(mVec[1], t2, mask.mMask);
+            return *this;
+        }
         // POSTINC
         // MPOSTINC
         // PREFINC
@@ -412,13 +516,65 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m256i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            __m256i t1 = saturatedSub(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            __m256i t1 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m256i t2 = saturatedSub(mVec[1], b.mVec[1]);
+            __m256i t3 = BLEND_HI(mVec[1], t2, mask.mMask);
+            return SIMDVec_i(t1, t3);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = saturatedSub(mVec[0], t0);
+            __m256i t2 = saturatedSub(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<8> const & mask, int64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = saturatedSub(mVec[0], t0);
+            __m256i t2 = BLEND_LO(mVec[0], t1, mask.mMask);
+            __m256i t3 = saturatedSub(mVec[1], t0);
+            __m256i t4 = BLEND_HI(mVec[1], t3, mask.mMask);
+            return SIMDVec_i(t2, t4);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec[0] = saturatedSub(mVec[0], b.mVec[0]);
+            mVec[1] = saturatedSub(mVec[1], b.mVec[1]);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            mVec[0] = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m256i t1 = saturatedSub(mVec[1], b.mVec[1]);
+            mVec[1] = BLEND_HI(mVec[1], t1, mask.mMask);
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec[0] = saturatedSub(mVec[0], t0);
+            mVec[1] = saturatedSub(mVec[1], t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<8> const & mask, int64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = saturatedSub(mVec[0], t0);
+            mVec[0] = BLEND_LO(mVec[0], t1, mask.mMask);
+            __m256i t2 = saturatedSub(mVec[1], t0);
+            mVec[1] = BLEND_HI(mVec[1], t2, mask.mMask);
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
             __m256i t0 = _mm256_sub_epi64(b.mVec[0], mVec[0]);
@@ -621,37 +777,509 @@ namespace SIMD {
         // MSCATTERV
 
         // LSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVec_u<uint64_t, 8> const & b) const {
+            alignas(32) uint64_t raw[8];
+            b.store(raw);
+            __m256i c0 = _mm256_load_si256((__m256i *)raw);
+            __m256i c1 = _mm256_load_si256((__m256i *)(raw + 4));
+            __m256i t0 = _mm256_sllv_epi64(mVec[0], c0);
+            __m256i t1 = _mm256_sllv_epi64(mVec[1], c1);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (SIMDVec_u<uint64_t, 8> const & b) const {
+            return lsh(b);
+        }
         // MLSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<8> const & mask, SIMDVec_u<uint64_t, 8> const & b) const {
+            alignas(32) uint64_t raw[8];
+            b.store(raw);
+            __m256i c0 = _mm256_load_si256((__m256i *)raw);
+            __m256i c1 = _mm256_load_si256((__m256i *)(raw + 4));
+            __m256i t0 = _mm256_sllv_epi64(mVec[0], c0);
+            __m256i t1 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m256i t2 = _mm256_sllv_epi64(mVec[1], c1);
+            __m256i t3 = BLEND_HI(mVec[1], t2, mask.mMask);
+            return SIMDVec_i(t1, t3);
+        }
         // LSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sll_epi64(mVec[0], t0);
+            __m256i t2 = _mm256_sll_epi64(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (uint64_t b) const {
+            return lsh(b);
+        }
         // MLSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<8> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sll_epi64(mVec[0], t0);
+            __m256i t2 = BLEND_LO(mVec[0], t1, mask.mMask);
+            __m256i t3 = _mm256_sll_epi64(mVec[1], t0);
+            __m256i t4 = BLEND_HI(mVec[1], t3, mask.mMask);
+            return SIMDVec_i(t2, t4);
+        }
         // LSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVec_u<uint64_t, 8> const & b) {
+            alignas(32) uint64_t raw[8];
+            b.store(raw);
+            __m256i c0 = _mm256_load_si256((__m256i *)raw);
+            __m256i c1 = _mm256_load_si256((__m256i *)(raw + 4));
+            mVec[0] = _mm256_sllv_epi64(mVec[0], c0);
+            mVec[1] = _mm256_sllv_epi64(mVec[1], c1);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (SIMDVec_u<uint64_t, 8> const & b) {
+            return lsha(b);
+        }
         // MLSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<8> const & mask, SIMDVec_u<uint64_t, 8> const & b) {
+            alignas(32) uint64_t raw[8];
+            b.store(raw);
+            __m256i c0 = _mm256_load_si256((__m256i *)raw);
+            __m256i c1 = _mm256_load_si256((__m256i *)(raw + 4));
+            __m256i t0 = _mm256_sllv_epi64(mVec[0], c0);
+            mVec[0] = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m256i t1 = _mm256_sllv_epi64(mVec[1], c1);
+            mVec[1] = BLEND_HI(mVec[1], t1, mask.mMask);
+            return *this;
+        }
         // LSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec[0] = _mm256_sll_epi64(mVec[0], t0);
+            mVec[1] = _mm256_sll_epi64(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (uint64_t b) {
+            return lsha(b);
+        }
         // MLSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<8> const & mask, uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sll_epi64(mVec[0], t0);
+            mVec[0] = BLEND_LO(mVec[0], t1, mask.mMask);
+            __m256i t2 = _mm256_sll_epi64(mVec[1], t0);
+            mVec[1] = BLEND_HI(mVec[1], t2, mask.mMask);
+            return *this;
+        }
         // RSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVec_u<uint64_t, 8> const & b) const {
+            alignas(32) uint64_t raw[8];
+            b.store(raw);
+            __m256i c0 = _mm256_load_si256((__m256i *)raw);
+            __m256i c1 = _mm256_load_si256((__m256i *)(raw + 4));
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_cmpgt_epi64(t0, mVec[0]);
+            __m256i t2 = _mm256_xor_si256(mVec[0], t1);
+            __m256i t3 = _mm256_srlv_epi64(t2, c0);
+            __m256i t4 = _mm256_xor_si256(t3, t1);
+            __m256i t5 = _mm256_cmpgt_epi64(t0, mVec[1]);
+            __m256i t6 = _mm256_xor_si256(mVec[1], t5);
+            __m256i t7 = _mm256_srlv_epi64(t6, c1);
+            __m256i t8 = _mm256_xor_si256(t7, t5);
+            return SIMDVec_i(t4, t8);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (SIMDVec_u<uint64_t, 8> const & b) const {
+            return rsh(b);
+        }
         // MRSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<8> const & mask, SIMDVec_u<uint64_t, 8> const & b) const {
+            alignas(32) uint64_t raw[8];
+            b.store(raw);
+            __m256i c0 = _mm256_load_si256((__m256i *)raw);
+            __m256i c1 = _mm256_load_si256((__m256i *)(raw + 4));
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_cmpgt_epi64(t0, mVec[0]);
+            __m256i t2 = _mm256_xor_si256(mVec[0], t1);
+            __m256i t3 = _mm256_srlv_epi64(t2, c0);
+            __m256i t4 = _mm256_xor_si256(t3, t1);
+            __m256i t5 = BLEND_LO(mVec[0], t4, mask.mMask);
+            __m256i t6 = _mm256_cmpgt_epi64(t0, mVec[1]);
+            __m256i t7 = _mm256_xor_si256(mVec[1], t6);
+            __m256i t8 = _mm256_srlv_epi64(t7, c1);
+            __m256i t9 = _mm256_xor_si256(t8, t6);
+            __m256i t10 = BLEND_HI(mVec[1], t9, mask.mMask);
+            return SIMDVec_i(t5, t10);
+        }
         // RSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_setzero_si256();
+            __m256i t2 = _mm256_cmpgt_epi64(t1, mVec[0]);
+            __m256i t3 = _mm256_xor_si256(mVec[0], t2);
+            __m256i t4 = _mm256_srl_epi64(t3, t0);
+            __m256i t5 = _mm256_xor_si256(t4, t2);
+            __m256i t6 = _mm256_cmpgt_epi64(t1, mVec[1]);
+            __m256i t7 = _mm256_xor_si256(mVec[1], t6);
+            __m256i t8 = _mm256_srl_epi64(t7, t0);
+            __m256i t9 = _mm256_xor_si256(t8, t6);
+            return SIMDVec_i(t5, t9);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (uint64_t b) const {
+            return rsh(b);
+        }
         // MRSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<8> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_setzero_si256();
+            __m256i t2 = _mm256_cmpgt_epi64(t1, mVec[0]);
+            __m256i t3 = _mm256_xor_si256(mVec[0], t2);
+            __m256i t4 = _mm256_srl_epi64(t3, t0);
+            __m256i t5 = _mm256_xor_si256(t4, t2);
+            __m256i t6 = BLEND_LO(mVec[0], t5, mask.mMask);
+            __m256i t7 = _mm256_cmpgt_epi64(t1, mVec[1]);
+            __m256i t8 = _mm256_xor_si256(mVec[1], t7);
+            __m256i t9 = _mm256_srl_epi64(t8, t0);
+            __m256i t10 = _mm256_xor_si256(t9, t7);
+            __m256i t11 = BLEND_HI(mVec[1], t10, mask.mMask);
+            return SIMDVec_i(t6, t11);
+        }
         // RSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVec_u<uint64_t, 8> const & b) {
+            alignas(32) uint64_t raw[8];
+            b.store(raw);
+            __m256i c0 = _mm256_load_si256((__m256i *)raw);
+            __m256i c1 = _mm256_load_si256((__m256i *)(raw + 4));
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_cmpgt_epi64(t0, mVec[0]);
+            __m256i t2 = _mm256_xor_si256(mVec[0], t1);
+            __m256i t3 = _mm256_srlv_epi64(t2, c0);
+            mVec[0] = _mm256_xor_si256(t3, t1);
+            __m256i t4 = _mm256_cmpgt_epi64(t0, mVec[1]);
+            __m256i t5 = _mm256_xor_si256(mVec[1], t4);
+            __m256i t6 = _mm256_srlv_epi64(t5, c1);
+            mVec[1] = _mm256_xor_si256(t6, t4);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (SIMDVec_u<uint64_t, 8> const & b) {
+            return rsha(b);
+        }
         // MRSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<8> const & mask, SIMDVec_u<uint64_t, 8> const & b) {
+            alignas(32) uint64_t raw[8];
+            b.store(raw);
+            __m256i c0 = _mm256_load_si256((__m256i *)raw);
+            __m256i c1 = _mm256_load_si256((__m256i *)(raw + 4));
+            __m256i t0 = _mm256_setzero_si256();
+            __m256i t1 = _mm256_cmpgt_epi64(t0, mVec[0]);
+            __m256i t2 = _mm256_xor_si256(mVec[0], t1);
+            __m256i t3 = _mm256_srlv_epi64(t2, c0);
+            __m256i t4 = _mm256_xor_si256(t3, t1);
+            mVec[0] = BLEND_LO(mVec[0], t4, mask.mMask);
+            __m256i t5 = _mm256_cmpgt_epi64(t0, mVec[1]);
+            __m256i t6 = _mm256_xor_si256(mVec[1], t5);
+            __m256i t7 = _mm256_srlv_epi64(t6, c1);
+            __m256i t8 = _mm256_xor_si256(t7, t5);
+            mVec[1] = BLEND_HI(mVec[1], t8, mask.mMask);
+            return *this;
+        }
         // RSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_setzero_si256();
+            __m256i t2 = _mm256_cmpgt_epi64(t1, mVec[0]);
+            __m256i t3 = _mm256_xor_si256(mVec[0], t2);
+            __m256i t4 = _mm256_srl_epi64(t3, t0);
+            mVec[0] = _mm256_xor_si256(t4, t2);
+            __m256i t5 = _mm256_cmpgt_epi64(t1, mVec[1]);
+            __m256i t6 = _mm256_xor_si256(mVec[1], t5);
+            __m256i t7 = _mm256_srl_epi64(t6, t0);
+            mVec[1] = _mm256_xor_si256(t7, t5);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (uint64_t b) {
+            return rsha(b);
+        }
         // MRSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<8> const & mask, uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_setzero_si256();
+            __m256i t2 = _mm256_cmpgt_epi64(t1, mVec[0]);
+            __m256i t3 = _mm256_xor_si256(mVec[0], t2);
+            __m256i t4 = _mm256_srl_epi64(t3, t0);
+            __m256i t5 = _mm256_xor_si256(t4, t2);
+            mVec[0] = BLEND_LO(mVec[0], t5, mask.mMask);
+            __m256i t6 = _mm256_cmpgt_epi64(t1, mVec[1]);
+            __m256i t7 = _mm256_xor_si256(mVec[1], t6);
+            __m256i t8 = _mm256_srl_epi64(t7, t0);
+            __m256i t9 = _mm256_xor_si256(t8, t6);
+            mVec[1] = BLEND_HI(mVec[1], t9, mask.mMask);
+            return *this;
+        }
         // ROLV
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVec_u<uint64_t, 8> const & b) const {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            alignas(32) uint64_t raw[8];
+            b.store(raw);
+            __m256i c0 = _mm256_load_si256((__m256i *)raw);
+            __m256i c1 = _mm256_load_si256((__m256i *)(raw + 4));
+            __m256i t2 = _mm256_and_si256(c0, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec[0], t2);
+            __m256i t5 = _mm256_srlv_epi64(mVec[0], t3);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            __m256i t7 = _mm256_and_si256(c1, t0);
+            __m256i t8 = _mm256_sub_epi64(t1, t7);
+            __m256i t9 = _mm256_sllv_epi64(mVec[1], t7);
+            __m256i t10 = _mm256_srlv_epi64(mVec[1], t8);
+            __m256i t11 = _mm256_or_si256(t9, t10);
+            return SIMDVec_i(t6, t11);
+        }
         // MROLV
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVecMask<8> const & mask, SIMDVec_u<uint64_t, 8> const & b) const {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            alignas(32) uint64_t raw[8];
+            b.store(raw);
+            __m256i c0 = _mm256_load_si256((__m256i *)raw);
+            __m256i c1 = _mm256_load_si256((__m256i *)(raw + 4));
+            __m256i t2 = _mm256_and_si256(c0, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec[0], t2);
+            __m256i t5 = _mm256_srlv_epi64(mVec[0], t3);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            __m256i t7 = BLEND_LO(mVec[0], t6, mask.mMask);
+            __m256i t8 = _mm256_and_si256(c1, t0);
+            __m256i t9 = _mm256_sub_epi64(t1, t8);
+            __m256i t10 = _mm256_sllv_epi64(mVec[1], t8);
+            __m256i t11 = _mm256_srlv_epi64(mVec[1], t9);
+            __m256i t12 = _mm256_or_si256(t10, t11);
+            __m256i t13 = BLEND_HI(mVec[1], t12, mask.mMask);
+            return SIMDVec_i(t7, t13);
+        }
         // ROLS
+        UME_FORCE_INLINE SIMDVec_i rol(uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec[0], t0);
+            __m256i t3 = _mm256_srl_epi64(mVec[0], t1);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            __m256i t5 = _mm256_sll_epi64(mVec[1], t0);
+            __m256i t6 = _mm256_srl_epi64(mVec[1], t1);
+            __m256i t7 = _mm256_or_si256(t5, t6);
+            return SIMDVec_i(t4, t7);
+        }
         // MROLS
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVecMask<8> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec[0], t0);
+            __m256i t3 = _mm256_srl_epi64(mVec[0], t1);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            __m256i t5 = BLEND_LO(mVec[0], t4, mask.mMask);
+            __m256i t6 = _mm256_sll_epi64(mVec[1], t0);
+            __m256i t7 = _mm256_srl_epi64(mVec[1], t1);
+            __m256i t8 = _mm256_or_si256(t6, t7);
+            __m256i t9 = BLEND_HI(mVec[1], t8, mask.mMask);
+            return SIMDVec_i(t5, t9);
+        }
         // ROLVA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVec_u<uint64_t, 8> const & b) {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            alignas(32) uint64_t raw[8];
+            b.store(raw);
+            __m256i c0 = _mm256_load_si256((__m256i *)raw);
+            __m256i c1 = _mm256_load_si256((__m256i *)(raw + 4));
+            __m256i t2 = _mm256_and_si256(c0, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec[0], t2);
+            __m256i t5 = _mm256_srlv_epi64(mVec[0], t3);
+            mVec[0] = _mm256_or_si256(t4, t5);
+            __m256i t6 = _mm256_and_si256(c1, t0);
+            __m256i t7 = _mm256_sub_epi64(t1, t6);
+            __m256i t8 = _mm256_sllv_epi64(mVec[1], t6);
+            __m256i t9 = _mm256_srlv_epi64(mVec[1], t7);
+            mVec[1] = _mm256_or_si256(t8, t9);
+            return *this;
+        }
         // MROLVA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVecMask<8> const & mask, SIMDVec_u<uint64_t, 8> const & b) {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            alignas(32) uint64_t raw[8];
+            b.store(raw);
+            __m256i c0 = _mm256_load_si256((__m256i *)raw);
+            __m256i c1 = _mm256_load_si256((__m256i *)(raw + 4));
+            __m256i t2 = _mm256_and_si256(c0, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec[0], t2);
+            __m256i t5 = _mm256_srlv_epi64(mVec[0], t3);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            mVec[0] = BLEND_LO(mVec[0], t6, mask.mMask);
+            __m256i t7 = _mm256_and_si256(c1, t0);
+            __m256i t8 = _mm256_sub_epi64(t1, t7);
+            __m256i t9 = _mm256_sllv_epi64(mVec[1], t7);
+            __m256i t10 = _mm256_srlv_epi64(mVec[1], t8);
+            __m256i t11 = _mm256_or_si256(t9, t10);
+            mVec[1] = BLEND_HI(mVec[1], t11, mask.mMask);
+            return *this;
+        }
         // ROLSA
+        UME_FORCE_INLINE SIMDVec_i & rola(uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec[0], t0);
+            __m256i t3 = _mm256_srl_epi64(mVec[0], t1);
+            mVec[0] = _mm256_or_si256(t2, t3);
+            __m256i t4 = _mm256_sll_epi64(mVec[1], t0);
+            __m256i t5 = _mm256_srl_epi64(mVec[1], t1);
+            mVec[1] = _mm256_or_si256(t4, t5);
+            return *this;
+        }
         // MROLSA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVecMask<8> const & mask, uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec[0], t0);
+            __m256i t3 = _mm256_srl_epi64(mVec[0], t1);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            mVec[0] = BLEND_LO(mVec[0], t4, mask.mMask);
+            __m256i t5 = _mm256_sll_epi64(mVec[1], t0);
+            __m256i t6 = _mm256_srl_epi64(mVec[1], t1);
+            __m256i t7 = _mm256_or_si256(t5, t6);
+            mVec[1] = BLEND_HI(mVec[1], t7, mask.mMask);
+            return *this;
+        }
         // RORV
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVec_u<uint64_t, 8> const & b) const {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            alignas(32) uint64_t raw[8];
+            b.store(raw);
+            __m256i c0 = _mm256_load_si256((__m256i *)raw);
+            __m256i c1 = _mm256_load_si256((__m256i *)(raw + 4));
+            __m256i t2 = _mm256_and_si256(c0, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec[0], t3);
+            __m256i t5 = _mm256_srlv_epi64(mVec[0], t2);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            __m256i t7 = _mm256_and_si256(c1, t0);
+            __m256i t8 = _mm256_sub_epi64(t1, t7);
+            __m256i t9 = _mm256_sllv_epi64(mVec[1], t8);
+            __m256i t10 = _mm256_srlv_epi64(mVec[1], t7);
+            __m256i t11 = _mm256_or_si256(t9, t10);
+            return SIMDVec_i(t6, t11);
+        }
         // MRORV
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVecMask<8> const & mask, SIMDVec_u<uint64_t, 8> const & b) const {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            alignas(32) uint64_t raw[8];
+            b.store(raw);
+            __m256i c0 = _mm256_load_si256((__m256i *)raw);
+            __m256i c1 = _mm256_load_si256((__m256i *)(raw + 4));
+            __m256i t2 = _mm256_and_si256(c0, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec[0], t3);
+            __m256i t5 = _mm256_srlv_epi64(mVec[0], t2);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            __m256i t7 = BLEND_LO(mVec[0], t6, mask.mMask);
+            __m256i t8 = _mm256_and_si256(c1, t0);
+            __m256i t9 = _mm256_sub_epi64(t1, t8);
+            __m256i t10 = _mm256_sllv_epi64(mVec[1], t9);
+            __m256i t11 = _mm256_srlv_epi64(mVec[1], t8);
+            __m256i t12 = _mm256_or_si256(t10, t11);
+            __m256i t13 = BLEND_HI(mVec[1], t12, mask.mMask);
+            return SIMDVec_i(t7, t13);
+        }
         // RORS
+        UME_FORCE_INLINE SIMDVec_i ror(uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec[0], t1);
+            __m256i t3 = _mm256_srl_epi64(mVec[0], t0);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            __m256i t5 = _mm256_sll_epi64(mVec[1], t1);
+            __m256i t6 = _mm256_srl_epi64(mVec[1], t0);
+            __m256i t7 = _mm256_or_si256(t5, t6);
+            return SIMDVec_i(t4, t7);
+        }
         // MRORS
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVecMask<8> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec[0], t1);
+            __m256i t3 = _mm256_srl_epi64(mVec[0], t0);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            __m256i t5 = BLEND_LO(mVec[0], t4, mask.mMask);
+            __m256i t6 = _mm256_sll_epi64(mVec[1], t1);
+            __m256i t7 = _mm256_srl_epi64(mVec[1], t0);
+            __m256i t8 = _mm256_or_si256(t6, t7);
+            __m256i t9 = BLEND_HI(mVec[1], t8, mask.mMask);
+            return SIMDVec_i(t5, t9);
+        }
         // RORVA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVec_u<uint64_t, 8> const & b) {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            alignas(32) uint64_t raw[8];
+            b.store(raw);
+            __m256i c0 = _mm256_load_si256((__m256i *)raw);
+            __m256i c1 = _mm256_load_si256((__m256i *)(raw + 4));
+            __m256i t2 = _mm256_and_si256(c0, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec[0], t3);
+            __m256i t5 = _mm256_srlv_epi64(mVec[0], t2);
+            mVec[0] = _mm256_or_si256(t4, t5);
+            __m256i t6 = _mm256_and_si256(c1, t0);
+            __m256i t7 = _mm256_sub_epi64(t1, t6);
+            __m256i t8 = _mm256_sllv_epi64(mVec[1], t7);
+            __m256i t9 = _mm256_srlv_epi64(mVec[1], t6);
+            mVec[1] = _mm256_or_si256(t8, t9);
+            return *this;
+        }
         // MRORVA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVecMask<8> const & mask, SIMDVec_u<uint64_t, 8> const & b) {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            alignas(32) uint64_t raw[8];
+            b.store(raw);
+            __m256i c0 = _mm256_load_si256((__m256i *)raw);
+            __m256i c1 = _mm256_load_si256((__m256i *)(raw + 4));
+            __m256i t2 = _mm256_and_si256(c0, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec[0], t3);
+            __m256i t5 = _mm256_srlv_epi64(mVec[0], t2);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            mVec[0] = BLEND_LO(mVec[0], t6, mask.mMask);
+            __m256i t7 = _mm256_and_si256(c1, t0);
+            __m256i t8 = _mm256_sub_epi64(t1, t7);
+            __m256i t9 = _mm256_sllv_epi64(mVec[1], t8);
+            __m256i t10 = _mm256_srlv_epi64(mVec[1], t7);
+            __m256i t11 = _mm256_or_si256(t9, t10);
+            mVec[1] = BLEND_HI(mVec[1], t11, mask.mMask);
+            return *this;
+        }
         // RORSA
+        UME_FORCE_INLINE SIMDVec_i & rora(uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec[0], t1);
+            __m256i t3 = _mm256_srl_epi64(mVec[0], t0);
+            mVec[0] = _mm256_or_si256(t2, t3);
+            __m256i t4 = _mm256_sll_epi64(mVec[1], t1);
+            __m256i t5 = _mm256_srl_epi64(mVec[1], t0);
+            mVec[1] = _mm256_or_si256(t4, t5);
+            return *this;
+        }
         // MRORSA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVecMask<8> const & mask, uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec[0], t1);
+            __m256i t3 = _mm256_srl_epi64(mVec[0], t0);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            mVec[0] = BLEND_LO(mVec[0], t4, mask.mMask);
+            __m256i t5 = _mm256_sll_epi64(mVec[1], t1);
+            __m256i t6 = _mm256_srl_epi64(mVec[1], t0);
+            __m256i t7 = _mm256_or_si256(t5, t6);
+            mVec[1] = BLEND_HI(mVec[1], t7, mask.mMask);
+            return *this;
+        }
 
         // NEG
         UME_FORCE_INLINE SIMDVec_i operator- () const {
@@ -0,0 +1,1847 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_INT8_16_H_
+#define UME_SIMD_VEC_INT8_16_H_
+
+#include <type_traits>
+#include <immintrin.h>
+
+#include "../../../UMESimdInterface.h"
+
+namespace UME {
+namespace SIMD {
+
+    template<>
+    class SIMDVec_i<int8_t, 16> :
+        public SIMDVecSignedInterface<
+            SIMDVec_i<int8_t, 16>,
+            SIMDVec_u<uint8_t, 16>,
+            int8_t,
+            16,
+            uint8_t,
+            SIMDVecMask<16>,
+            SIMDSwizzle<16 >> ,
+        public SIMDVecPackableInterface<
+            SIMDVec_i<int8_t, 16>,
+            SIMDVec_i<int8_t, 8 >>
+    {
+    public:
+        // Conversion operators require access to private members.
+        friend class SIMDVec_u<uint8_t, 16>;
+        friend class SIMDVec_i<int16_t, 16>;
+
+        friend class SIMDVec_i<int8_t, 32>;
+    private:
+        __m128i mVec;
+
+        UME_FORCE_INLINE explicit SIMDVec_i(__m128i & x) { mVec = x; }
+        UME_FORCE_INLINE explicit SIMDVec_i(const __m128i & x) { mVec = x; }
+    public:
+
+        constexpr static uint32_t length() { return 16; }
+        constexpr static uint32_t alignment() { return 16; }
+
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_i() {}
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_i(int8_t i) {
+            mVec = _mm_set1_epi8(i);
+        }
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_i(
+            T i, 
+            typename std::enable_if< std::is_fundamental<T>::value && 
+                                    !std::is_same<T, int8_t>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_i(static_cast<int8_t>(i)) {}
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVec_i(int8_t const *p) { load(p); }
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVec_i(int8_t i0, int8_t i1, int8_t i2, int8_t i3,
+                                   int8_t i4, int8_t i5, int8_t i6, int8_t i7,
+                                   int8_t i8, int8_t i9, int8_t i10, int8_t i11,
+                                   int8_t i12, int8_t i13, int8_t i14, int8_t i15)
+        {
+            mVec = _mm_setr_epi8(i0, i1, i2, i3, i4, i5, i6, i7,
+                                 i8, i9, i10, i11, i12, i13, i14, i15);
+        }
+        // EXTRACT
+        UME_FORCE_INLINE int8_t extract(uint32_t index) const {
+            alignas(16) int8_t raw[16];
+            _mm_store_si128((__m128i*)raw, mVec);
+            return raw[index];
+        }
+        UME_FORCE_INLINE int8_t operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_i & insert(uint32_t index, int8_t value) {
+            alignas(16) int8_t raw[16];
+            _mm_store_si128((__m128i*)raw, mVec);
+            raw[index] = value;
+            mVec = _mm_load_si128((__m128i*)raw);
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_i, int8_t> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_i, int8_t>(index, static_cast<SIMDVec_i &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_i, int8_t, SIMDVecMask<16>> operator() (SIMDVecMask<16> const & mask) {
+            return IntermediateMask<SIMDVec_i, int8_t, SIMDVecMask<16>>(mask, static_cast<SIMDVec_i &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_i, int8_t, SIMDVecMask<16>> operator[] (SIMDVecMask<16> const & mask) {
+            return IntermediateMask<SIMDVec_i, int8_t, SIMDVecMask<16>>(mask, static_cast<SIMDVec_i &>(*this));
+        }
+#endif
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVec_i const & b) {
+            mVec = b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator= (SIMDVec_i const & b) {
+            return assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi8();
+            mVec = _mm_blendv_epi8(mVec, b.mVec, m0);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_i & assign(int8_t b) {
+            mVec = _mm_set1_epi8(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator= (int8_t b) {
+            return assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVecMask<16> const & mask, int8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+
+        // PREFETCH0
+        // PREFETCH1
+        // PREFETCH2
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_i & load(int8_t const *p) {
+            mVec = _mm_loadu_si128((const __m128i *)p);
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<16> const & mask, int8_t const *p) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_loadu_si128((const __m128i *)p);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_i & loada(int8_t const *p) {
+            mVec = _mm_load_si128((const __m128i *)p);
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<16> const & mask, int8_t const *p) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_load_si128((const __m128i *)p);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE int8_t* store(int8_t* p) const {
+            _mm_storeu_si128((__m128i *)p, mVec);
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE int8_t* store(SIMDVecMask<16> const & mask, int8_t* p) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_loadu_si128((const __m128i *)p);
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            _mm_storeu_si128((__m128i *)p, t1);
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE int8_t* storea(int8_t* p) const {
+            _mm_store_si128((__m128i *)p, mVec);
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE int8_t* storea(SIMDVecMask<16> const & mask, int8_t* p) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_load_si128((const __m128i *)p);
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            _mm_store_si128((__m128i *)p, t1);
+            return p;
+        }
+
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_blendv_epi8(mVec, b.mVec, m0);
+            return SIMDVec_i(t0);
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<16> const & mask, int8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // SWIZZLE
+        // SWIZZLEA
+
+        // SORTA
+        // SORTD
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_add_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator+ (SIMDVec_i const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_add_epi8(mVec, b.mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_i add(int8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_add_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator+ (int8_t b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVecMask<16> const & mask, int8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_add_epi8(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVec_i const & b) {
+            mVec = _mm_add_epi8(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator+= (SIMDVec_i const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_add_epi8(mVec, b.mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_i & adda(int8_t b) {
+            __m128i t0 = _mm_set1_epi8(b);
+            mVec = _mm_add_epi8(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator+= (int8_t b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVecMask<16> const & mask, int8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_add_epi8(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // POSTINC
+        UME_FORCE_INLINE SIMDVec_i postinc() {
+            __m128i t0 = _mm_set1_epi8(1);
+            __m128i t1 = mVec;
+            mVec = _mm_add_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator++ (int) {
+            return postinc();
+        }
+        // MPOSTINC
+        UME_FORCE_INLINE SIMDVec_i postinc(SIMDVecMask<16> const & mask) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(1);
+            __m128i t1 = mVec;
+            __m128i t2 = _mm_add_epi8(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t2, m0);
+            return SIMDVec_i(t1);
+        }
+        // PREFINC
+        UME_FORCE_INLINE SIMDVec_i & prefinc() {
+            __m128i t0 = _mm_set1_epi8(1);
+            mVec = _mm_add_epi8(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator++ () {
+            return prefinc();
+        }
+        // MPREFINC
+        UME_FORCE_INLINE SIMDVec_i & prefinc(SIMDVecMask<16> const & mask) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(1);
+            __m128i t1 = _mm_add_epi8(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_adds_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_adds_epi8(mVec, b.mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_adds_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<16> const & mask, int8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_adds_epi8(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec = _mm_adds_epi8(mVec, b.mVec);
+            return *this;
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_adds_epi8(mVec, b.mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int8_t b) {
+            __m128i t0 = _mm_set1_epi8(b);
+            mVec = _mm_adds_epi8(mVec, t0);
+            return *this;
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<16> const & mask, int8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_adds_epi8(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_sub_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- (SIMDVec_i const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_sub_epi8(mVec, b.mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_i sub(int8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_sub_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- (int8_t b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVecMask<16> const & mask, int8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_sub_epi8(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVec_i const & b) {
+            mVec = _mm_sub_epi8(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-= (SIMDVec_i const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_sub_epi8(mVec, b.mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_i & suba(int8_t b) {
+            __m128i t0 = _mm_set1_epi8(b);
+            mVec = _mm_sub_epi8(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-= (int8_t b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVecMask<16> const & mask, int8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_sub_epi8(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_subs_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_subs_epi8(mVec, b.mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_subs_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<16> const & mask, int8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_subs_epi8(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec = _mm_subs_epi8(mVec, b.mVec);
+            return *this;
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_subs_epi8(mVec, b.mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int8_t b) {
+            __m128i t0 = _mm_set1_epi8(b);
+            mVec = _mm_subs_epi8(mVec, t0);
+            return *this;
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<16> const & mask, int8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_subs_epi8(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_sub_epi8(b.mVec, mVec);
+            return SIMDVec_i(t0);
+        }
+        // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_sub_epi8(b.mVec, mVec);
+            __m128i t1 = _mm_blendv_epi8(b.mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_i subfrom(int8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_sub_epi8(t0, mVec);
+            return SIMDVec_i(t1);
+        }
+        // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVecMask<16> const & mask, int8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_sub_epi8(t0, mVec);
+            __m128i t2 = _mm_blendv_epi8(t0, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVec_i const & b) {
+            mVec = _mm_sub_epi8(b.mVec, mVec);
+            return *this;
+        }
+        // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_sub_epi8(b.mVec, mVec);
+            mVec = _mm_blendv_epi8(b.mVec, t0, m0);
+            return *this;
+        }
+        // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(int8_t b) {
+            __m128i t0 = _mm_set1_epi8(b);
+            mVec = _mm_sub_epi8(t0, mVec);
+            return *this;
+        }
+        // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVecMask<16> const & mask, int8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_sub_epi8(t0, mVec);
+            mVec = _mm_blendv_epi8(t0, t1, m0);
+            return *this;
+        }
+        // POSTDEC
+        UME_FORCE_INLINE SIMDVec_i postdec() {
+            __m128i t0 = _mm_set1_epi8(1);
+            __m128i t1 = mVec;
+            mVec = _mm_sub_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator-- (int) {
+            return postdec();
+        }
+        // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_i postdec(SIMDVecMask<16> const & mask) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(1);
+            __m128i t1 = mVec;
+            __m128i t2 = _mm_sub_epi8(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t2, m0);
+            return SIMDVec_i(t1);
+        }
+        // PREFDEC
+        UME_FORCE_INLINE SIMDVec_i & prefdec() {
+            __m128i t0 = _mm_set1_epi8(1);
+            mVec = _mm_sub_epi8(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-- () {
+            return prefdec();
+        }
+        // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_i & prefdec(SIMDVecMask<16> const & mask) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(1);
+            __m128i t1 = _mm_sub_epi8(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // MULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_mullo_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_srli_epi16(mVec, 8);
+            __m128i t2 = _mm_srli_epi16(b.mVec, 8);
+            __m128i t3 = _mm_mullo_epi16(t1, t2);
+            __m128i t4 = _mm_slli_epi16(t3, 8);
+            __m128i t5 = _mm_and_si128(t0, _mm_set1_epi16(0x00FF));
+            __m128i t6 = _mm_or_si128(t4, t5);
+            return SIMDVec_i(t6);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (SIMDVec_i const & b) const {
+            return mul(b);
+        }
+        // MMULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_mullo_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_srli_epi16(mVec, 8);
+            __m128i t2 = _mm_srli_epi16(b.mVec, 8);
+            __m128i t3 = _mm_mullo_epi16(t1, t2);
+            __m128i t4 = _mm_slli_epi16(t3, 8);
+            __m128i t5 = _mm_and_si128(t0, _mm_set1_epi16(0x00FF));
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = _mm_blendv_epi8(mVec, t6, m0);
+            return SIMDVec_i(t7);
+        }
+        // MULS
+        UME_FORCE_INLINE SIMDVec_i mul(int8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_mullo_epi16(mVec, t0);
+            __m128i t2 = _mm_srli_epi16(mVec, 8);
+            __m128i t3 = _mm_srli_epi16(t0, 8);
+            __m128i t4 = _mm_mullo_epi16(t2, t3);
+            __m128i t5 = _mm_slli_epi16(t4, 8);
+            __m128i t6 = _mm_and_si128(t1, _mm_set1_epi16(0x00FF));
+            __m128i t7 = _mm_or_si128(t5, t6);
+            return SIMDVec_i(t7);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (int8_t b) const {
+            return mul(b);
+        }
+        // MMULS
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<16> const & mask, int8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_mullo_epi16(mVec, t0);
+            __m128i t2 = _mm_srli_epi16(mVec, 8);
+            __m128i t3 = _mm_srli_epi16(t0, 8);
+            __m128i t4 = _mm_mullo_epi16(t2, t3);
+            __m128i t5 = _mm_slli_epi16(t4, 8);
+            __m128i t6 = _mm_and_si128(t1, _mm_set1_epi16(0x00FF));
+            __m128i t7 = _mm_or_si128(t5, t6);
+            __m128i t8 = _mm_blendv_epi8(mVec, t7, m0);
+            return SIMDVec_i(t8);
+        }
+        // MULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVec_i const & b) {
+            __m128i t0 = _mm_mullo_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_srli_epi16(mVec, 8);
+            __m128i t2 = _mm_srli_epi16(b.mVec, 8);
+            __m128i t3 = _mm_mullo_epi16(t1, t2);
+            __m128i t4 = _mm_slli_epi16(t3, 8);
+            __m128i t5 = _mm_and_si128(t0, _mm_set1_epi16(0x00FF));
+            mVec = _mm_or_si128(t4, t5);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (SIMDVec_i const & b) {
+            return mula(b);
+        }
+        // MMULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_mullo_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_srli_epi16(mVec, 8);
+            __m128i t2 = _mm_srli_epi16(b.mVec, 8);
+            __m128i t3 = _mm_mullo_epi16(t1, t2);
+            __m128i t4 = _mm_slli_epi16(t3, 8);
+            __m128i t5 = _mm_and_si128(t0, _mm_set1_epi16(0x00FF));
+            __m128i t6 = _mm_or_si128(t4, t5);
+            mVec = _mm_blendv_epi8(mVec, t6, m0);
+            return *this;
+        }
+        // MULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(int8_t b) {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_mullo_epi16(mVec, t0);
+            __m128i t2 = _mm_srli_epi16(mVec, 8);
+            __m128i t3 = _mm_srli_epi16(t0, 8);
+            __m128i t4 = _mm_mullo_epi16(t2, t3);
+            __m128i t5 = _mm_slli_epi16(t4, 8);
+            __m128i t6 = _mm_and_si128(t1, _mm_set1_epi16(0x00FF));
+            mVec = _mm_or_si128(t5, t6);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (int8_t b) {
+            return mula(b);
+        }
+        // MMULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<16> const & mask, int8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_mullo_epi16(mVec, t0);
+            __m128i t2 = _mm_srli_epi16(mVec, 8);
+            __m128i t3 = _mm_srli_epi16(t0, 8);
+            __m128i t4 = _mm_mullo_epi16(t2, t3);
+            __m128i t5 = _mm_slli_epi16(t4, 8);
+            __m128i t6 = _mm_and_si128(t1, _mm_set1_epi16(0x00FF));
+            __m128i t7 = _mm_or_si128(t5, t6);
+            mVec = _mm_blendv_epi8(mVec, t7, m0);
+            return *this;
+        }
+        // DIVV
+        // MDIVV
+        // DIVS
+        // MDIVS
+        // DIVVA
+        // MDIVVA
+        // DIVSA
+        // MDIVSA
+        // RCP
+        // MRCP
+        // RCPS
+        // MRCPS
+        // RCPA
+        // MRCPA
+        // RCPSA
+        // MRCPSA
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<16> cmpeq(SIMDVec_i const & b) const {
+            __m128i m0 = _mm_cmpeq_epi8(mVec, b.mVec);
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator== (SIMDVec_i const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<16> cmpeq(int8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i m0 = _mm_cmpeq_epi8(mVec, t0);
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator== (int8_t b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<16> cmpne(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_cmpeq_epi8(mVec, b.mVec);
+            __m128i m0 = _mm_xor_si128(t0, _mm_set1_epi32(0xFFFFFFFF));
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator!= (SIMDVec_i const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<16> cmpne(int8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_cmpeq_epi8(mVec, t0);
+            __m128i m0 = _mm_xor_si128(t1, _mm_set1_epi32(0xFFFFFFFF));
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator!= (int8_t b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<16> cmpgt(SIMDVec_i const & b) const {
+            __m128i m0 = _mm_cmpgt_epi8(mVec, b.mVec);
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator> (SIMDVec_i const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<16> cmpgt(int8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i m0 = _mm_cmpgt_epi8(mVec, t0);
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator> (int8_t b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<16> cmplt(SIMDVec_i const & b) const {
+            __m128i m0 = _mm_cmpgt_epi8(b.mVec, mVec);
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator< (SIMDVec_i const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<16> cmplt(int8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i m0 = _mm_cmpgt_epi8(t0, mVec);
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator< (int8_t b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<16> cmpge(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_max_epi8(mVec, b.mVec);
+            __m128i m0 = _mm_cmpeq_epi8(mVec, t0);
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator>= (SIMDVec_i const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<16> cmpge(int8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_max_epi8(mVec, t0);
+            __m128i m0 = _mm_cmpeq_epi8(mVec, t1);
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator>= (int8_t b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<16> cmple(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_min_epi8(mVec, b.mVec);
+            __m128i m0 = _mm_cmpeq_epi8(mVec, t0);
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator<= (SIMDVec_i const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<16> cmple(int8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_min_epi8(mVec, t0);
+            __m128i m0 = _mm_cmpeq_epi8(mVec, t1);
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator<= (int8_t b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_i const & b) const {
+            __m128i m0 = _mm_cmpeq_epi8(mVec, b.mVec);
+            uint32_t t0 = uint32_t(_mm_movemask_epi8(m0));
+            return t0 == 0xFFFF;
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(int8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i m0 = _mm_cmpeq_epi8(mVec, t0);
+            uint32_t t1 = uint32_t(_mm_movemask_epi8(m0));
+            return t1 == 0xFFFF;
+        }
+        // UNIQUE
+        // HADD
+        UME_FORCE_INLINE int8_t hadd() const {
+            __m128i t0 = _mm_sad_epu8(mVec, _mm_setzero_si128());
+            int8_t retval = int8_t(_mm_extract_epi16(t0, 0) + _mm_extract_epi16(t0, 4));
+            return retval;
+        }
+        // HADDS
+        UME_FORCE_INLINE int8_t hadd(int8_t b) const {
+            __m128i t0 = _mm_sad_epu8(mVec, _mm_setzero_si128());
+            int8_t retval = int8_t(_mm_extract_epi16(t0, 0) + _mm_extract_epi16(t0, 4));
+            return int8_t(retval + b);
+        }
+        // MHADD
+        UME_FORCE_INLINE int8_t hadd(SIMDVecMask<16> const & mask) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_setzero_si128();
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_sad_epu8(t1, _mm_setzero_si128());
+            int8_t retval = int8_t(_mm_extract_epi16(t2, 0) + _mm_extract_epi16(t2, 4));
+            return retval;
+        }
+        // MHADDS
+        UME_FORCE_INLINE int8_t hadd(SIMDVecMask<16> const & mask, int8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_setzero_si128();
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_sad_epu8(t1, _mm_setzero_si128());
+            int8_t retval = int8_t(_mm_extract_epi16(t2, 0) + _mm_extract_epi16(t2, 4));
+            return int8_t(retval + b);
+        }
+        // HMUL
+        // MHMUL
+        // HMULS
+        // MHMULS
+
+        // FMULADDV
+        UME_FORCE_INLINE SIMDVec_i fmuladd(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = _mm_mullo_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_srli_epi16(mVec, 8);
+            __m128i t2 = _mm_srli_epi16(b.mVec, 8);
+            __m128i t3 = _mm_mullo_epi16(t1, t2);
+            __m128i t4 = _mm_slli_epi16(t3, 8);
+            __m128i t5 = _mm_and_si128(t0, _mm_set1_epi16(0x00FF));
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = _mm_add_epi8(t6, c.mVec);
+            return SIMDVec_i(t7);
+        }
+        // MFMULADDV
+        UME_FORCE_INLINE SIMDVec_i fmuladd(SIMDVecMask<16> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_mullo_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_srli_epi16(mVec, 8);
+            __m128i t2 = _mm_srli_epi16(b.mVec, 8);
+            __m128i t3 = _mm_mullo_epi16(t1, t2);
+            __m128i t4 = _mm_slli_epi16(t3, 8);
+            __m128i t5 = _mm_and_si128(t0, _mm_set1_epi16(0x00FF));
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = _mm_add_epi8(t6, c.mVec);
+            __m128i t8 = _mm_blendv_epi8(mVec, t7, m0);
+            return SIMDVec_i(t8);
+        }
+        // FMULSUBV
+        UME_FORCE_INLINE SIMDVec_i fmulsub(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = _mm_mullo_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_srli_epi16(mVec, 8);
+            __m128i t2 = _mm_srli_epi16(b.mVec, 8);
+            __m128i t3 = _mm_mullo_epi16(t1, t2);
+            __m128i t4 = _mm_slli_epi16(t3, 8);
+            __m128i t5 = _mm_and_si128(t0, _mm_set1_epi16(0x00FF));
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = _mm_sub_epi8(t6, c.mVec);
+            return SIMDVec_i(t7);
+        }
+        // MFMULSUBV
+        UME_FORCE_INLINE SIMDVec_i fmulsub(SIMDVecMask<16> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_mullo_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_srli_epi16(mVec, 8);
+            __m128i t2 = _mm_srli_epi16(b.mVec, 8);
+            __m128i t3 = _mm_mullo_epi16(t1, t2);
+            __m128i t4 = _mm_slli_epi16(t3, 8);
+            __m128i t5 = _mm_and_si128(t0, _mm_set1_epi16(0x00FF));
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = _mm_sub_epi8(t6, c.mVec);
+            __m128i t8 = _mm_blendv_epi8(mVec, t7, m0);
+            return SIMDVec_i(t8);
+        }
+        // FADDMULV
+        UME_FORCE_INLINE SIMDVec_i faddmul(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = _mm_add_epi8(mVec, b.mVec);
+            __m128i t1 = _mm_mullo_epi16(t0, c.mVec);
+            __m128i t2 = _mm_srli_epi16(t0, 8);
+            __m128i t3 = _mm_srli_epi16(c.mVec, 8);
+            __m128i t4 = _mm_mullo_epi16(t2, t3);
+            __m128i t5 = _mm_slli_epi16(t4, 8);
+            __m128i t6 = _mm_and_si128(t1, _mm_set1_epi16(0x00FF));
+            __m128i t7 = _mm_or_si128(t5, t6);
+            return SIMDVec_i(t7);
+        }
+        // MFADDMULV
+        UME_FORCE_INLINE SIMDVec_i faddmul(SIMDVecMask<16> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_add_epi8(mVec, b.mVec);
+            __m128i t1 = _mm_mullo_epi16(t0, c.mVec);
+            __m128i t2 = _mm_srli_epi16(t0, 8);
+            __m128i t3 = _mm_srli_epi16(c.mVec, 8);
+            __m128i t4 = _mm_mullo_epi16(t2, t3);
+            __m128i t5 = _mm_slli_epi16(t4, 8);
+            __m128i t6 = _mm_and_si128(t1, _mm_set1_epi16(0x00FF));
+            __m128i t7 = _mm_or_si128(t5, t6);
+            __m128i t8 = _mm_blendv_epi8(mVec, t7, m0);
+            return SIMDVec_i(t8);
+        }
+        // FSUBMULV
+        UME_FORCE_INLINE SIMDVec_i fsubmul(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = _mm_sub_epi8(mVec, b.mVec);
+            __m128i t1 = _mm_mullo_epi16(t0, c.mVec);
+            __m128i t2 = _mm_srli_epi16(t0, 8);
+            __m128i t3 = _mm_srli_epi16(c.mVec, 8);
+            __m128i t4 = _mm_mullo_epi16(t2, t3);
+            __m128i t5 = _mm_slli_epi16(t4, 8);
+            __m128i t6 = _mm_and_si128(t1, _mm_set1_epi16(0x00FF));
+            __m128i t7 = _mm_or_si128(t5, t6);
+            return SIMDVec_i(t7);
+        }
+        // MFSUBMULV
+        UME_FORCE_INLINE SIMDVec_i fsubmul(SIMDVecMask<16> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_sub_epi8(mVec, b.mVec);
+            __m128i t1 = _mm_mullo_epi16(t0, c.mVec);
+            __m128i t2 = _mm_srli_epi16(t0, 8);
+            __m128i t3 = _mm_srli_epi16(c.mVec, 8);
+            __m128i t4 = _mm_mullo_epi16(t2, t3);
+            __m128i t5 = _mm_slli_epi16(t4, 8);
+            __m128i t6 = _mm_and_si128(t1, _mm_set1_epi16(0x00FF));
+            __m128i t7 = _mm_or_si128(t5, t6);
+            __m128i t8 = _mm_blendv_epi8(mVec, t7, m0);
+            return SIMDVec_i(t8);
+        }
+
+        // MAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_max_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MMAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_max_epi8(mVec, b.mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // MAXS
+        UME_FORCE_INLINE SIMDVec_i max(int8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_max_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MMAXS
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<16> const & mask, int8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_max_epi8(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // MAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVec_i const & b) {
+            mVec = _mm_max_epi8(mVec, b.mVec);
+            return *this;
+        }
+        // MMAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_max_epi8(mVec, b.mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // MAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(int8_t b) {
+            __m128i t0 = _mm_set1_epi8(b);
+            mVec = _mm_max_epi8(mVec, t0);
+            return *this;
+        }
+        // MMAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<16> const & mask, int8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_max_epi8(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // MINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_min_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MMINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_min_epi8(mVec, b.mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // MINS
+        UME_FORCE_INLINE SIMDVec_i min(int8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_min_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MMINS
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<16> const & mask, int8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_min_epi8(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // MINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVec_i const & b) {
+            mVec = _mm_min_epi8(mVec, b.mVec);
+            return *this;
+        }
+        // MMINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_min_epi8(mVec, b.mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // MINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(int8_t b) {
+            __m128i t0 = _mm_set1_epi8(b);
+            mVec = _mm_min_epi8(mVec, t0);
+            return *this;
+        }
+        // MMINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<16> const & mask, int8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_min_epi8(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // HMAX
+        UME_FORCE_INLINE int8_t hmax() const {
+            __m128i t0 = _mm_max_epi8(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_max_epi8(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_max_epi8(t1, _mm_srli_si128(t1, 2));
+            __m128i t3 = _mm_max_epi8(t2, _mm_srli_si128(t2, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t3, 0));
+            return retval;
+        }
+        // MHMAX
+        UME_FORCE_INLINE int8_t hmax(SIMDVecMask<16> const & mask) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8((char)0x80);
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_max_epi8(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_max_epi8(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_max_epi8(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_max_epi8(t4, _mm_srli_si128(t4, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t5, 0));
+            return retval;
+        }
+        // IMAX
+        // MIMAX
+        // HMIN
+        UME_FORCE_INLINE int8_t hmin() const {
+            __m128i t0 = _mm_min_epi8(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_min_epi8(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_min_epi8(t1, _mm_srli_si128(t1, 2));
+            __m128i t3 = _mm_min_epi8(t2, _mm_srli_si128(t2, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t3, 0));
+            return retval;
+        }
+        // MHMIN
+        UME_FORCE_INLINE int8_t hmin(SIMDVecMask<16> const & mask) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(0x7F);
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_min_epi8(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_min_epi8(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_min_epi8(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_min_epi8(t4, _mm_srli_si128(t4, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t5, 0));
+            return retval;
+        }
+        // IMIN
+        // MIMIN
+
+        // BANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator& (SIMDVec_i const & b) const {
+            return band(b);
+        }
+        // MBANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // BANDS
+        UME_FORCE_INLINE SIMDVec_i band(int8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator& (int8_t b) const {
+            return band(b);
+        }
+        // MBANDS
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<16> const & mask, int8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // BANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVec_i const & b) {
+            mVec = _mm_and_si128(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (SIMDVec_i const & b) {
+            return banda(b);
+        }
+        // MBANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // BANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(int8_t b) {
+            __m128i t0 = _mm_set1_epi8(b);
+            mVec = _mm_and_si128(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (int8_t b) {
+            return banda(b);
+        }
+        // MBANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<16> const & mask, int8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // BORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (SIMDVec_i const & b) const {
+            return bor(b);
+        }
+        // MBORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // BORS
+        UME_FORCE_INLINE SIMDVec_i bor(int8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (int8_t b) const {
+            return bor(b);
+        }
+        // MBORS
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<16> const & mask, int8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // BORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVec_i const & b) {
+            mVec = _mm_or_si128(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (SIMDVec_i const & b) {
+            return bora(b);
+        }
+        // MBORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // BORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(int8_t b) {
+            __m128i t0 = _mm_set1_epi8(b);
+            mVec = _mm_or_si128(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (int8_t b) {
+            return bora(b);
+        }
+        // MBORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<16> const & mask, int8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // BXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (SIMDVec_i const & b) const {
+            return bxor(b);
+        }
+        // MBXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // BXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(int8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (int8_t b) const {
+            return bxor(b);
+        }
+        // MBXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<16> const & mask, int8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // BXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVec_i const & b) {
+            mVec = _mm_xor_si128(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (SIMDVec_i const & b) {
+            return bxora(b);
+        }
+        // MBXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // BXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(int8_t b) {
+            __m128i t0 = _mm_set1_epi8(b);
+            mVec = _mm_xor_si128(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (int8_t b) {
+            return bxora(b);
+        }
+        // MBXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<16> const & mask, int8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // BNOT
+        UME_FORCE_INLINE SIMDVec_i bnot() const {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator~ () const {
+            return bnot();
+        }
+        // MBNOT
+        UME_FORCE_INLINE SIMDVec_i bnot(SIMDVecMask<16> const & mask) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            __m128i t2 = _mm_blendv_epi8(mVec, t1, m0);
+            return SIMDVec_i(t2);
+        }
+        // BNOTA
+        UME_FORCE_INLINE SIMDVec_i & bnota() {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            mVec = _mm_xor_si128(mVec, t0);
+            return *this;
+        }
+        // MBNOTA
+        UME_FORCE_INLINE SIMDVec_i & bnota(SIMDVecMask<16> const & mask) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            mVec = _mm_blendv_epi8(mVec, t1, m0);
+            return *this;
+        }
+        // HBAND
+        UME_FORCE_INLINE int8_t hband() const {
+            __m128i t0 = _mm_and_si128(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_and_si128(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_and_si128(t1, _mm_srli_si128(t1, 2));
+            __m128i t3 = _mm_and_si128(t2, _mm_srli_si128(t2, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t3, 0));
+            return retval;
+        }
+        // HBANDS
+        UME_FORCE_INLINE int8_t hband(int8_t b) const {
+            __m128i t0 = _mm_and_si128(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_and_si128(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_and_si128(t1, _mm_srli_si128(t1, 2));
+            __m128i t3 = _mm_and_si128(t2, _mm_srli_si128(t2, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t3, 0));
+            return int8_t(retval & b);
+        }
+        // MHBAND
+        UME_FORCE_INLINE int8_t hband(SIMDVecMask<16> const & mask) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_and_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_and_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_and_si128(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_and_si128(t4, _mm_srli_si128(t4, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t5, 0));
+            return retval;
+        }
+        // MHBANDS
+        UME_FORCE_INLINE int8_t hband(SIMDVecMask<16> const & mask, int8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_and_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_and_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_and_si128(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_and_si128(t4, _mm_srli_si128(t4, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t5, 0));
+            return int8_t(retval & b);
+        }
+        // HBOR
+        UME_FORCE_INLINE int8_t hbor() const {
+            __m128i t0 = _mm_or_si128(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_or_si128(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_or_si128(t1, _mm_srli_si128(t1, 2));
+            __m128i t3 = _mm_or_si128(t2, _mm_srli_si128(t2, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t3, 0));
+            return retval;
+        }
+        // HBORS
+        UME_FORCE_INLINE int8_t hbor(int8_t b) const {
+            __m128i t0 = _mm_or_si128(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_or_si128(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_or_si128(t1, _mm_srli_si128(t1, 2));
+            __m128i t3 = _mm_or_si128(t2, _mm_srli_si128(t2, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t3, 0));
+            return int8_t(retval | b);
+        }
+        // MHBOR
+        UME_FORCE_INLINE int8_t hbor(SIMDVecMask<16> const & mask) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_setzero_si128();
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_or_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_or_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_or_si128(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_or_si128(t4, _mm_srli_si128(t4, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t5, 0));
+            return retval;
+        }
+        // MHBORS
+        UME_FORCE_INLINE int8_t hbor(SIMDVecMask<16> const & mask, int8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_setzero_si128();
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_or_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_or_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_or_si128(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_or_si128(t4, _mm_srli_si128(t4, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t5, 0));
+            return int8_t(retval | b);
+        }
+        // HBXOR
+        UME_FORCE_INLINE int8_t hbxor() const {
+            __m128i t0 = _mm_xor_si128(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_xor_si128(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_xor_si128(t1, _mm_srli_si128(t1, 2));
+            __m128i t3 = _mm_xor_si128(t2, _mm_srli_si128(t2, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t3, 0));
+            return retval;
+        }
+        // HBXORS
+        UME_FORCE_INLINE int8_t hbxor(int8_t b) const {
+            __m128i t0 = _mm_xor_si128(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_xor_si128(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_xor_si128(t1, _mm_srli_si128(t1, 2));
+            __m128i t3 = _mm_xor_si128(t2, _mm_srli_si128(t2, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t3, 0));
+            return int8_t(retval ^ b);
+        }
+        // MHBXOR
+        UME_FORCE_INLINE int8_t hbxor(SIMDVecMask<16> const & mask) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_setzero_si128();
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_xor_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_xor_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_xor_si128(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_xor_si128(t4, _mm_srli_si128(t4, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t5, 0));
+            return retval;
+        }
+        // MHBXORS
+        UME_FORCE_INLINE int8_t hbxor(SIMDVecMask<16> const & mask, int8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_setzero_si128();
+            __m128i t1 = _mm_blendv_epi8(t0, mVec, m0);
+            __m128i t2 = _mm_xor_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_xor_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_xor_si128(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_xor_si128(t4, _mm_srli_si128(t4, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t5, 0));
+            return int8_t(retval ^ b);
+        }
+
+        // GATHERU
+        // MGATHERU
+        // GATHERS
+        // MGATHERS
+        // GATHERV
+        // MGATHERV
+        // SCATTERU
+        // MSCATTERU
+        // SCATTERS
+        // MSCATTERS
+        // SCATTERV
+        // MSCATTERV
+
+        // LSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVec_u<uint8_t, 16> const & b) const {
+            __m128i t0 = _mm_min_epu8(b.mVec, _mm_set1_epi8(8));
+            __m128i t1 = _mm_slli_epi16(t0, 5);
+            __m128i t2 = _mm_and_si128(_mm_slli_epi16(mVec, 4), _mm_set1_epi8((char)0xF0));
+            __m128i t3 = _mm_blendv_epi8(mVec, t2, t1);
+            __m128i t4 = _mm_add_epi8(t1, t1);
+            __m128i t5 = _mm_and_si128(_mm_slli_epi16(t3, 2), _mm_set1_epi8((char)0xFC));
+            __m128i t6 = _mm_blendv_epi8(t3, t5, t4);
+            __m128i t7 = _mm_add_epi8(t4, t4);
+            __m128i t8 = _mm_and_si128(_mm_slli_epi16(t6, 1), _mm_set1_epi8((char)0xFE));
+            __m128i t9 = _mm_blendv_epi8(t6, t8, t7);
+            __m128i t10 = _mm_cmpeq_epi8(t0, _mm_set1_epi8(8));
+            __m128i t11 = _mm_andnot_si128(t10, t9);
+            return SIMDVec_i(t11);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (SIMDVec_u<uint8_t, 16> const & b) const {
+            return lsh(b);
+        }
+        // MLSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<16> const & mask, SIMDVec_u<uint8_t, 16> const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_min_epu8(b.mVec, _mm_set1_epi8(8));
+            __m128i t1 = _mm_slli_epi16(t0, 5);
+            __m128i t2 = _mm_and_si128(_mm_slli_epi16(mVec, 4), _mm_set1_epi8((char)0xF0));
+            __m128i t3 = _mm_blendv_epi8(mVec, t2, t1);
+            __m128i t4 = _mm_add_epi8(t1, t1);
+            __m128i t5 = _mm_and_si128(_mm_slli_epi16(t3, 2), _mm_set1_epi8((char)0xFC));
+            __m128i t6 = _mm_blendv_epi8(t3, t5, t4);
+            __m128i t7 = _mm_add_epi8(t4, t4);
+            __m128i t8 = _mm_and_si128(_mm_slli_epi16(t6, 1), _mm_set1_epi8((char)0xFE));
+            __m128i t9 = _mm_blendv_epi8(t6, t8, t7);
+            __m128i t10 = _mm_cmpeq_epi8(t0, _mm_set1_epi8(8));
+            __m128i t11 = _mm_andnot_si128(t10, t9);
+            __m128i t12 = _mm_blendv_epi8(mVec, t11, m0);
+            return SIMDVec_i(t12);
+        }
+        // LSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(uint8_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            char bmask = (b < 8) ? char(0xFF << b) : 0;
+            __m128i t1 = _mm_sll_epi16(mVec, t0);
+            __m128i t2 = _mm_and_si128(t1, _mm_set1_epi8(bmask));
+            return SIMDVec_i(t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (uint8_t b) const {
+            return lsh(b);
+        }
+        // MLSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<16> const & mask, uint8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            char bmask = (b < 8) ? char(0xFF << b) : 0;
+            __m128i t1 = _mm_sll_epi16(mVec, t0);
+            __m128i t2 = _mm_and_si128(t1, _mm_set1_epi8(bmask));
+            __m128i t3 = _mm_blendv_epi8(mVec, t2, m0);
+            return SIMDVec_i(t3);
+        }
+        // LSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVec_u<uint8_t, 16> const & b) {
+            __m128i t0 = _mm_min_epu8(b.mVec, _mm_set1_epi8(8));
+            __m128i t1 = _mm_slli_epi16(t0, 5);
+            __m128i t2 = _mm_and_si128(_mm_slli_epi16(mVec, 4), _mm_set1_epi8((char)0xF0));
+            __m128i t3 = _mm_blendv_epi8(mVec, t2, t1);
+            __m128i t4 = _mm_add_epi8(t1, t1);
+            __m128i t5 = _mm_and_si128(_mm_slli_epi16(t3, 2), _mm_set1_epi8((char)0xFC));
+            __m128i t6 = _mm_blendv_epi8(t3, t5, t4);
+            __m128i t7 = _mm_add_epi8(t4, t4);
+            __m128i t8 = _mm_and_si128(_mm_slli_epi16(t6, 1), _mm_set1_epi8((char)0xFE));
+            __m128i t9 = _mm_blendv_epi8(t6, t8, t7);
+            __m128i t10 = _mm_cmpeq_epi8(t0, _mm_set1_epi8(8));
+            mVec = _mm_andnot_si128(t10, t9);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (SIMDVec_u<uint8_t, 16> const & b) {
+            return lsha(b);
+        }
+        // MLSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<16> const & mask, SIMDVec_u<uint8_t, 16> const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_min_epu8(b.mVec, _mm_set1_epi8(8));
+            __m128i t1 = _mm_slli_epi16(t0, 5);
+            __m128i t2 = _mm_and_si128(_mm_slli_epi16(mVec, 4), _mm_set1_epi8((char)0xF0));
+            __m128i t3 = _mm_blendv_epi8(mVec, t2, t1);
+            __m128i t4 = _mm_add_epi8(t1, t1);
+            __m128i t5 = _mm_and_si128(_mm_slli_epi16(t3, 2), _mm_set1_epi8((char)0xFC));
+            __m128i t6 = _mm_blendv_epi8(t3, t5, t4);
+            __m128i t7 = _mm_add_epi8(t4, t4);
+            __m128i t8 = _mm_and_si128(_mm_slli_epi16(t6, 1), _mm_set1_epi8((char)0xFE));
+            __m128i t9 = _mm_blendv_epi8(t6, t8, t7);
+            __m128i t10 = _mm_cmpeq_epi8(t0, _mm_set1_epi8(8));
+            __m128i t11 = _mm_andnot_si128(t10, t9);
+            mVec = _mm_blendv_epi8(mVec, t11, m0);
+            return *this;
+        }
+        // LSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(uint8_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            char bmask = (b < 8) ? char(0xFF << b) : 0;
+            __m128i t1 = _mm_sll_epi16(mVec, t0);
+            mVec = _mm_and_si128(t1, _mm_set1_epi8(bmask));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (uint8_t b) {
+            return lsha(b);
+        }
+        // MLSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<16> const & mask, uint8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            char bmask = (b < 8) ? char(0xFF << b) : 0;
+            __m128i t1 = _mm_sll_epi16(mVec, t0);
+            __m128i t2 = _mm_and_si128(t1, _mm_set1_epi8(bmask));
+            mVec = _mm_blendv_epi8(mVec, t2, m0);
+            return *this;
+        }
+        // RSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVec_u<uint8_t, 16> const & b) const {
+            __m128i t0 = _mm_min_epu8(b.mVec, _mm_set1_epi8(7));
+            __m128i t1 = _mm_slli_epi16(t0, 5);
+            __m128i t2 = _mm_and_si128(_mm_srli_epi16(mVec, 4), _mm_set1_epi8(0x0F));
+            __m128i t3 = _mm_sub_epi8(_mm_xor_si128(t2, _mm_set1_epi8(0x08)), _mm_set1_epi8(0x08));
+            __m128i t4 = _mm_blendv_epi8(mVec, t3, t1);
+            __m128i t5 = _mm_add_epi8(t1, t1);
+            __m128i t6 = _mm_and_si128(_mm_srli_epi16(t4, 2), _mm_set1_epi8(0x3F));
+            __m128i t7 = _mm_sub_epi8(_mm_xor_si128(t6, _mm_set1_epi8(0x20)), _mm_set1_epi8(0x20));
+            __m128i t8 = _mm_blendv_epi8(t4, t7, t5);
+            __m128i t9 = _mm_add_epi8(t5, t5);
+            __m128i t10 = _mm_and_si128(_mm_srli_epi16(t8, 1), _mm_set1_epi8(0x7F));
+            __m128i t11 = _mm_sub_epi8(_mm_xor_si128(t10, _mm_set1_epi8(0x40)), _mm_set1_epi8(0x40));
+            __m128i t12 = _mm_blendv_epi8(t8, t11, t9);
+            __m128i t13 = t12;
+            return SIMDVec_i(t13);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (SIMDVec_u<uint8_t, 16> const & b) const {
+            return rsh(b);
+        }
+        // MRSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<16> const & mask, SIMDVec_u<uint8_t, 16> const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_min_epu8(b.mVec, _mm_set1_epi8(7));
+            __m128i t1 = _mm_slli_epi16(t0, 5);
+            __m128i t2 = _mm_and_si128(_mm_srli_epi16(mVec, 4), _mm_set1_epi8(0x0F));
+            __m128i t3 = _mm_sub_epi8(_mm_xor_si128(t2, _mm_set1_epi8(0x08)), _mm_set1_epi8(0x08));
+            __m128i t4 = _mm_blendv_epi8(mVec, t3, t1);
+            __m128i t5 = _mm_add_epi8(t1, t1);
+            __m128i t6 = _mm_and_si128(_mm_srli_epi16(t4, 2), _mm_set1_epi8(0x3F));
+            __m128i t7 = _mm_sub_epi8(_mm_xor_si128(t6, _mm_set1_epi8(0x20)), _mm_set1_epi8(0x20));
+            __m128i t8 = _mm_blendv_epi8(t4, t7, t5);
+            __m128i t9 = _mm_add_epi8(t5, t5);
+            __m128i t10 = _mm_and_si128(_mm_srli_epi16(t8, 1), _mm_set1_epi8(0x7F));
+            __m128i t11 = _mm_sub_epi8(_mm_xor_si128(t10, _mm_set1_epi8(0x40)), _mm_set1_epi8(0x40));
+            __m128i t12 = _mm_blendv_epi8(t8, t11, t9);
+            __m128i t13 = t12;
+            __m128i t14 = _mm_blendv_epi8(mVec, t13, m0);
+            return SIMDVec_i(t14);
+        }
+        // RSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(uint8_t b) const {
+            uint32_t s = (b < 8) ? b : 7;
+            __m128i t0 = _mm_cvtsi32_si128(s);
+            char bmask = char(0xFF >> s);
+            char smask = char(0x80 >> s);
+            __m128i t1 = _mm_srl_epi16(mVec, t0);
+            __m128i t2 = _mm_and_si128(t1, _mm_set1_epi8(bmask));
+            __m128i t3 = _mm_set1_epi8(smask);
+            __m128i t4 = _mm_xor_si128(t2, t3);
+            __m128i t5 = _mm_sub_epi8(t4, t3);
+            return SIMDVec_i(t5);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (uint8_t b) const {
+            return rsh(b);
+        }
+        // MRSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<16> const & mask, uint8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            uint32_t s = (b < 8) ? b : 7;
+            __m128i t0 = _mm_cvtsi32_si128(s);
+            char bmask = char(0xFF >> s);
+            char smask = char(0x80 >> s);
+            __m128i t1 = _mm_srl_epi16(mVec, t0);
+            __m128i t2 = _mm_and_si128(t1, _mm_set1_epi8(bmask));
+            __m128i t3 = _mm_set1_epi8(smask);
+            __m128i t4 = _mm_xor_si128(t2, t3);
+            __m128i t5 = _mm_sub_epi8(t4, t3);
+            __m128i t6 = _mm_blendv_epi8(mVec, t5, m0);
+            return SIMDVec_i(t6);
+        }
+        // RSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVec_u<uint8_t, 16> const & b) {
+            __m128i t0 = _mm_min_epu8(b.mVec, _mm_set1_epi8(7));
+            __m128i t1 = _mm_slli_epi16(t0, 5);
+            __m128i t2 = _mm_and_si128(_mm_srli_epi16(mVec, 4), _mm_set1_epi8(0x0F));
+            __m128i t3 = _mm_sub_epi8(_mm_xor_si128(t2, _mm_set1_epi8(0x08)), _mm_set1_epi8(0x08));
+            __m128i t4 = _mm_blendv_epi8(mVec, t3, t1);
+            __m128i t5 = _mm_add_epi8(t1, t1);
+            __m128i t6 = _mm_and_si128(_mm_srli_epi16(t4, 2), _mm_set1_epi8(0x3F));
+            __m128i t7 = _mm_sub_epi8(_mm_xor_si128(t6, _mm_set1_epi8(0x20)), _mm_set1_epi8(0x20));
+            __m128i t8 = _mm_blendv_epi8(t4, t7, t5);
+            __m128i t9 = _mm_add_epi8(t5, t5);
+            __m128i t10 = _mm_and_si128(_mm_srli_epi16(t8, 1), _mm_set1_epi8(0x7F));
+            __m128i t11 = _mm_sub_epi8(_mm_xor_si128(t10, _mm_set1_epi8(0x40)), _mm_set1_epi8(0x40));
+            __m128i t12 = _mm_blendv_epi8(t8, t11, t9);
+            mVec = t12;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (SIMDVec_u<uint8_t, 16> const & b) {
+            return rsha(b);
+        }
+        // MRSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<16> const & mask, SIMDVec_u<uint8_t, 16> const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_min_epu8(b.mVec, _mm_set1_epi8(7));
+            __m128i t1 = _mm_slli_epi16(t0, 5);
+            __m128i t2 = _mm_and_si128(_mm_srli_epi16(mVec, 4), _mm_set1_epi8(0x0F));
+            __m128i t3 = _mm_sub_epi8(_mm_xor_si128(t2, _mm_set1_epi8(0x08)), _mm_set1_epi8(0x08));
+            __m128i t4 = _mm_blendv_epi8(mVec, t3, t1);
+            __m128i t5 = _mm_add_epi8(t1, t1);
+            __m128i t6 = _mm_and_si128(_mm_srli_epi16(t4, 2), _mm_set1_epi8(0x3F));
+            __m128i t7 = _mm_sub_epi8(_mm_xor_si128(t6, _mm_set1_epi8(0x20)), _mm_set1_epi8(0x20));
+            __m128i t8 = _mm_blendv_epi8(t4, t7, t5);
+            __m128i t9 = _mm_add_epi8(t5, t5);
+            __m128i t10 = _mm_and_si128(_mm_srli_epi16(t8, 1), _mm_set1_epi8(0x7F));
+            __m128i t11 = _mm_sub_epi8(_mm_xor_si128(t10, _mm_set1_epi8(0x40)), _mm_set1_epi8(0x40));
+            __m128i t12 = _mm_blendv_epi8(t8, t11, t9);
+            __m128i t13 = t12;
+            mVec = _mm_blendv_epi8(mVec, t13, m0);
+            return *this;
+        }
+        // RSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(uint8_t b) {
+            uint32_t s = (b < 8) ? b : 7;
+            __m128i t0 = _mm_cvtsi32_si128(s);
+            char bmask = char(0xFF >> s);
+            char smask = char(0x80 >> s);
+            __m128i t1 = _mm_srl_epi16(mVec, t0);
+            __m128i t2 = _mm_and_si128(t1, _mm_set1_epi8(bmask));
+            __m128i t3 = _mm_set1_epi8(smask);
+            __m128i t4 = _mm_xor_si128(t2, t3);
+            mVec = _mm_sub_epi8(t4, t3);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (uint8_t b) {
+            return rsha(b);
+        }
+        // MRSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<16> const & mask, uint8_t b) {
+            __m128i m0 = mask.toEpi8();
+            uint32_t s = (b < 8) ? b : 7;
+            __m128i t0 = _mm_cvtsi32_si128(s);
+            char bmask = char(0xFF >> s);
+            char smask = char(0x80 >> s);
+            __m128i t1 = _mm_srl_epi16(mVec, t0);
+            __m128i t2 = _mm_and_si128(t1, _mm_set1_epi8(bmask));
+            __m128i t3 = _mm_set1_epi8(smask);
+            __m128i t4 = _mm_xor_si128(t2, t3);
+            __m128i t5 = _mm_sub_epi8(t4, t3);
+            mVec = _mm_blendv_epi8(mVec, t5, m0);
+            return *this;
+        }
+        // ROLV
+        // MROLV
+        // ROLS
+        // MROLS
+        // ROLVA
+        // MROLVA
+        // ROLSA
+        // MROLSA
+        // RORV
+        // MRORV
+        // RORS
+        // MRORS
+        // RORVA
+        // MRORVA
+        // RORSA
+        // MRORSA
+
+        // NEG
+        UME_FORCE_INLINE SIMDVec_i neg() const {
+            __m128i t0 = _mm_sub_epi8(_mm_setzero_si128(), mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- () const {
+            return neg();
+        }
+        // MNEG
+        UME_FORCE_INLINE SIMDVec_i neg(SIMDVecMask<16> const & mask) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_sub_epi8(_mm_setzero_si128(), mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // NEGA
+        UME_FORCE_INLINE SIMDVec_i & nega() {
+            mVec = _mm_sub_epi8(_mm_setzero_si128(), mVec);
+            return *this;
+        }
+        // MNEGA
+        UME_FORCE_INLINE SIMDVec_i & nega(SIMDVecMask<16> const & mask) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_sub_epi8(_mm_setzero_si128(), mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+        // ABS
+        UME_FORCE_INLINE SIMDVec_i abs() const {
+            __m128i t0 = _mm_abs_epi8(mVec);
+            return SIMDVec_i(t0);
+        }
+        // MABS
+        UME_FORCE_INLINE SIMDVec_i abs(SIMDVecMask<16> const & mask) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_abs_epi8(mVec);
+            __m128i t1 = _mm_blendv_epi8(mVec, t0, m0);
+            return SIMDVec_i(t1);
+        }
+        // ABSA
+        UME_FORCE_INLINE SIMDVec_i & absa() {
+            mVec = _mm_abs_epi8(mVec);
+            return *this;
+        }
+        // MABSA
+        UME_FORCE_INLINE SIMDVec_i & absa(SIMDVecMask<16> const & mask) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_abs_epi8(mVec);
+            mVec = _mm_blendv_epi8(mVec, t0, m0);
+            return *this;
+        }
+
+        // PACK
+        // PACKLO
+        // PACKHI
+        // UNPACK
+        // UNPACKLO
+        // UNPACKHI
+
+        // PROMOTE
+        UME_FORCE_INLINE operator SIMDVec_i<int16_t, 16>() const;
+        // DEGRADE
+        // -
+
+        // ITOU
+        UME_FORCE_INLINE operator SIMDVec_u<uint8_t, 16>() const;
+        // ITOF
+        // -
+
+    };
+
+}
+}
+
+#endif
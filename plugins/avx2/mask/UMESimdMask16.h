@@ -63,6 +63,28 @@ namespace SIMD {
         __m256i mMask[2];
 
         inline SIMDVecMask(__m256i const & x0, __m256i const & x1) { mMask[0] = x0; mMask[1] = x1; };
+
+        // Conversions between 32-bit lane masks and the narrower lane layouts
+        // used by 8-bit and 16-bit vectors.
+        inline __m256i toEpi16() const {
+            __m256i t0 = _mm256_packs_epi32(mMask[0], mMask[1]);
+            return _mm256_permute4x64_epi64(t0, 0xD8);
+        }
+        inline __m128i toEpi8() const {
+            __m256i t0 = toEpi16();
+            return _mm_packs_epi16(_mm256_extracti128_si256(t0, 0),
+                                   _mm256_extracti128_si256(t0, 1));
+        }
+        static inline SIMDVecMask fromEpi16(__m256i const & x) {
+            __m256i t0 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(x, 0));
+            __m256i t1 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(x, 1));
+            return SIMDVecMask(t0, t1);
+        }
+        static inline SIMDVecMask fromEpi8(__m128i const & x) {
+            __m256i t0 = _mm256_cvtepi8_epi32(x);
+            __m256i t1 = _mm256_cvtepi8_epi32(_mm_srli_si128(x, 8));
+            return SIMDVecMask(t0, t1);
+        }
     public:
         inline SIMDVecMask() {}
 
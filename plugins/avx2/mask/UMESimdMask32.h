@@ -51,7 +51,11 @@ namespace SIMD {
         // This function returns a boolean value based on internal representation
         static inline bool toBool(uint32_t m) { if ((m & 0x80000000) != 0) return true; else return false; }
 
+        friend class SIMDVec_u<uint8_t, 32>;
+        friend class SIMDVec_u<uint16_t, 32>;
         friend class SIMDVec_u<uint32_t, 32>;
+        friend class SIMDVec_i<int8_t, 32>;
+        friend class SIMDVec_i<int16_t, 32>;
         friend class SIMDVec_i<int32_t, 32>;
         friend class SIMDVec_f<float, 32>;
         friend class SIMDVec_f<double, 32>;
@@ -66,6 +70,39 @@ namespace SIMD {
             mMask[3] = x3;
         };
 
+        // Conversions between 32-bit lane masks and the narrower lane layouts
+        // used by 8-bit and 16-bit vectors.
+        inline __m256i toEpi16Lo() const {
+            __m256i t0 = _mm256_packs_epi32(mMask[0], mMask[1]);
+            return _mm256_permute4x64_epi64(t0, 0xD8);
+        }
+        inline __m256i toEpi16Hi() const {
+            __m256i t0 = _mm256_packs_epi32(mMask[2], mMask[3]);
+            return _mm256_permute4x64_epi64(t0, 0xD8);
+        }
+        inline __m256i toEpi8() const {
+            __m256i t0 = _mm256_packs_epi32(mMask[0], mMask[1]);
+            __m256i t1 = _mm256_packs_epi32(mMask[2], mMask[3]);
+            __m256i t2 = _mm256_packs_epi16(t0, t1);
+            return _mm256_permutevar8x32_epi32(t2, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+        }
+        static inline SIMDVecMask fromEpi16(__m256i const & lo, __m256i const & hi) {
+            __m256i t0 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(lo, 0));
+            __m256i t1 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(lo, 1));
+            __m256i t2 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(hi, 0));
+            __m256i t3 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(hi, 1));
+            return SIMDVecMask(t0, t1, t2, t3);
+        }
+        static inline SIMDVecMask fromEpi8(__m256i const & x) {
+            __m128i t0 = _mm256_extracti128_si256(x, 0);
+            __m128i t1 = _mm256_extracti128_si256(x, 1);
+            __m256i t2 = _mm256_cvtepi8_epi32(t0);
+            __m256i t3 = _mm256_cvtepi8_epi32(_mm_srli_si128(t0, 8));
+            __m256i t4 = _mm256_cvtepi8_epi32(t1);
+            __m256i t5 = _mm256_cvtepi8_epi32(_mm_srli_si128(t1, 8));
+            return SIMDVecMask(t2, t3, t4, t5);
+        }
+
     public:
         inline SIMDVecMask() {}
 
@@ -65,6 +65,16 @@ namespace SIMD {
         __m256i mMask;
 
         inline explicit SIMDVecMask(__m256i const & x) { mMask = x; };
+
+        // Conversions between 32-bit lane masks and the narrower lane layouts
+        // used by 16-bit vectors.
+        inline __m128i toEpi16() const {
+            return _mm_packs_epi32(_mm256_extracti128_si256(mMask, 0),
+                                   _mm256_extracti128_si256(mMask, 1));
+        }
+        static inline SIMDVecMask fromEpi16(__m128i const & x) {
+            return SIMDVecMask(_mm256_cvtepi16_epi32(x));
+        }
     public:
         inline SIMDVecMask() {}
 
@@ -94,6 +104,12 @@ namespace SIMD {
         inline SIMDVecMask(SIMDVecMask const & mask) {
             this->mMask = mask.mMask;
         }
+        // PREFIX
+        static inline SIMDVecMask prefix(uint32_t n) {
+            int32_t t0 = n < 8 ? int32_t(n) : 8;
+            __m256i t1 = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            return SIMDVecMask(_mm256_cmpgt_epi32(_mm256_set1_epi32(t0), t1));
+        }
         // EXTRACT
         inline bool extract(uint32_t index) const {
             alignas(32) uint32_t raw[8];
@@ -55,12 +55,101 @@ namespace SIMD {
         // Conversion operators require access to private members.
         friend class SIMDVec_i<int32_t, 16>;
         friend class SIMDVec_f<float, 16>;
+        friend class SIMDVec_u<uint16_t, 16>;
 
         friend class SIMDVec_u<uint32_t, 32>;
     private:
         __m256i mVec[2];
 
         UME_FORCE_INLINE explicit SIMDVec_u(__m256i & x0, __m256i & x1) { mVec[0] = x0; mVec[1] = x1; }
+
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m256i saturatedAdd(__m256i const & a, __m256i const & b) {
+            return _mm256_add_epi32(a, _mm256_min_epu32(b, _mm256_xor_si256(a, _mm256_set1_epi32(-1))));
+        }
+        static UME_FORCE_INLINE __m256i saturatedSub(__m256i const & a, __m256i const & b) {
+            return _mm256_sub_epi32(_mm256_max_epu32(a, b), b);
+        }
+        // Lane-wise division through double precision, exact for 32-bit operands.
+        static UME_FORCE_INLINE __m128i divideHalf(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_set1_epi32(0x80000000);
+            __m256d t1 = _mm256_set1_pd(2147483648.0);
+            __m256d t2 = _mm256_add_pd(_mm256_cvtepi32_pd(_mm_xor_si128(a, t0)), t1);
+            __m256d t3 = _mm256_add_pd(_mm256_cvtepi32_pd(_mm_xor_si128(b, t0)), t1);
+            __m256d t4 = _mm256_round_pd(_mm256_div_pd(t2, t3), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+            return _mm_xor_si128(_mm256_cvttpd_epi32(_mm256_sub_pd(t4, t1)), t0);
+        }
+        static UME_FORCE_INLINE __m256i divideVector(__m256i const & a, __m256i const & b) {
+            __m128i t0 = divideHalf(_mm256_castsi256_si128(a), _mm256_castsi256_si128(b));
+            __m128i t1 = divideHalf(_mm256_extracti128_si256(a, 1), _mm256_extracti128_si256(b, 1));
+            return _mm256_inserti128_si256(_mm256_castsi128_si256(t0), t1, 1);
+        }
+        static UME_FORCE_INLINE __m256i remainderVector(__m256i const & a, __m256i const & b) {
+            __m256i t0 = divideVector(a, b);
+            return _mm256_sub_epi32(a, _mm256_mullo_epi32(t0, b));
+        }
+        // Division by a precomputed divisor, used by DIVD*/REMD*.
+        static UME_FORCE_INLINE __m256i divideMagic(__m256i const & a, SIMDDivisor<uint32_t> const & b) {
+            __m256i t0 = _mm256_set1_epi32(b.magic());
+            __m256i t1 = _mm256_mul_epu32(a, t0);
+            __m256i t2 = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), t0);
+            __m256i t3 = _mm256_blend_epi32(_mm256_srli_epi64(t1, 32), t2, 0xAA);
+            __m256i t4 = _mm256_srl_epi32(_mm256_sub_epi32(a, t3), _mm_cvtsi32_si128(b.shift1()));
+            return _mm256_srl_epi32(_mm256_add_epi32(t3, t4), _mm_cvtsi32_si128(b.shift2()));
+        }
+        static UME_FORCE_INLINE __m256i remainderMagic(__m256i const & a, SIMDDivisor<uint32_t> const & b) {
+            __m256i t0 = divideMagic(a, b);
+            return _mm256_sub_epi32(a, _mm256_mullo_epi32(t0, _mm256_set1_epi32(b.divisor())));
+        }
+        // Writes lanes of 'v' selected by bits of 'm' to baseAddr[indices[i]],
+        // in lane order. Indices are moved to general purpose registers in
+        // pairs, so neither vector makes a round trip through the stack.
+        static UME_FORCE_INLINE void scatterLanes(uint32_t * baseAddr, __m256i v, __m256i indices, int m) {
+            __m128i v0 = _mm256_castsi256_si128(v);
+            __m128i v1 = _mm256_extracti128_si256(v, 1);
+            __m128i t0 = _mm256_castsi256_si128(indices);
+            __m128i t1 = _mm256_extracti128_si256(indices, 1);
+            uint64_t x0 = uint64_t(_mm_cvtsi128_si64(v0));
+            uint64_t x1 = uint64_t(_mm_extract_epi64(v0, 1));
+            uint64_t x2 = uint64_t(_mm_cvtsi128_si64(v1));
+            uint64_t x3 = uint64_t(_mm_extract_epi64(v1, 1));
+            uint64_t i0 = uint64_t(_mm_cvtsi128_si64(t0));
+            uint64_t i1 = uint64_t(_mm_extract_epi64(t0, 1));
+            uint64_t i2 = uint64_t(_mm_cvtsi128_si64(t1));
+            uint64_t i3 = uint64_t(_mm_extract_epi64(t1, 1));
+            if (m & 0x01) baseAddr[uint32_t(i0)] = uint32_t(x0);
+            if (m & 0x02) baseAddr[uint32_t(i0 >> 32)] = uint32_t(x0 >> 32);
+            if (m & 0x04) baseAddr[uint32_t(i1)] = uint32_t(x1);
+            if (m & 0x08) baseAddr[uint32_t(i1 >> 32)] = uint32_t(x1 >> 32);
+            if (m & 0x10) baseAddr[uint32_t(i2)] = uint32_t(x2);
+            if (m & 0x20) baseAddr[uint32_t(i2 >> 32)] = uint32_t(x2 >> 32);
+            if (m & 0x40) baseAddr[uint32_t(i3)] = uint32_t(x3);
+            if (m & 0x80) baseAddr[uint32_t(i3 >> 32)] = uint32_t(x3 >> 32);
+        }
+        // Adds lanes of 'v' selected by bits of 'm' to baseAddr[indices[i]],
+        // in lane order, so that lanes with repeating indices accumulate.
+        static UME_FORCE_INLINE void scatterAddLanes(uint32_t * baseAddr, __m256i v, __m256i indices, int m) {
+            __m128i v0 = _mm256_castsi256_si128(v);
+            __m128i v1 = _mm256_extracti128_si256(v, 1);
+            __m128i t0 = _mm256_castsi256_si128(indices);
+            __m128i t1 = _mm256_extracti128_si256(indices, 1);
+            uint64_t x0 = uint64_t(_mm_cvtsi128_si64(v0));
+            uint64_t x1 = uint64_t(_mm_extract_epi64(v0, 1));
+            uint64_t x2 = uint64_t(_mm_cvtsi128_si64(v1));
+            uint64_t x3 = uint64_t(_mm_extract_epi64(v1, 1));
+            uint64_t i0 = uint64_t(_mm_cvtsi128_si64(t0));
+            uint64_t i1 = uint64_t(_mm_extract_epi64(t0, 1));
+            uint64_t i2 = uint64_t(_mm_cvtsi128_si64(t1));
+            uint64_t i3 = uint64_t(_mm_extract_epi64(t1, 1));
+            if (m & 0x01) baseAddr[uint32_t(i0)] += uint32_t(x0);
+            if (m & 0x02) baseAddr[uint32_t(i0 >> 32)] += uint32_t(x0 >> 32);
+            if (m & 0x04) baseAddr[uint32_t(i1)] += uint32_t(x1);
+            if (m & 0x08) baseAddr[uint32_t(i1 >> 32)] += uint32_t(x1 >> 32);
+            if (m & 0x10) baseAddr[uint32_t(i2)] += uint32_t(x2);
+            if (m & 0x20) baseAddr[uint32_t(i2 >> 32)] += uint32_t(x2 >> 32);
+            if (m & 0x40) baseAddr[uint32_t(i3)] += uint32_t(x3);
+            if (m & 0x80) baseAddr[uint32_t(i3 >> 32)] += uint32_t(x3 >> 32);
+        }
     public:
 
         constexpr static uint32_t length() { return 16; }
@@ -231,6 +320,12 @@ namespace SIMD {
             _mm256_maskstore_epi32((int*)(p + 8), mask.mMask[1], mVec[1]);
             return p;
         }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressstore(SIMDVecMask<16> const & mask, uint32_t * p) const {
+            uint32_t t0 = SIMDVec_u<uint32_t, 8>::compressLanes(p, mVec[0], _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[0])));
+            uint32_t t1 = SIMDVec_u<uint32_t, 8>::compressLanes(p + t0, mVec[1], _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[1])));
+            return t0 + t1;
+        }
         // BLENDV
         // BLENDS
         // SWIZZLE 
@@ -308,13 +403,65 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVec_u const & b) const {
+            __m256i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            __m256i t1 = saturatedAdd(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t2 = saturatedAdd(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedAdd(mVec[0], t0);
+            __m256i t2 = saturatedAdd(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<16> const & mask, uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedAdd(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t3 = saturatedAdd(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_u(t2, t4);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVec_u const & b) {
+            mVec[0] = saturatedAdd(mVec[0], b.mVec[0]);
+            mVec[1] = saturatedAdd(mVec[1], b.mVec[1]);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t1 = saturatedAdd(mVec[1], b.mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec[0] = saturatedAdd(mVec[0], t0);
+            mVec[1] = saturatedAdd(mVec[1], t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<16> const & mask, uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedAdd(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t2 = saturatedAdd(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_u postinc() {
             __m256i t0 = _mm256_set1_epi32(1);
@@ -426,13 +573,65 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVec_u const & b) const {
+            __m256i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            __m256i t1 = saturatedSub(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t2 = saturatedSub(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedSub(mVec[0], t0);
+            __m256i t2 = saturatedSub(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<16> const & mask, uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedSub(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t3 = saturatedSub(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_u(t2, t4);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVec_u const & b) {
+            mVec[0] = saturatedSub(mVec[0], b.mVec[0]);
+            mVec[1] = saturatedSub(mVec[1], b.mVec[1]);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t1 = saturatedSub(mVec[1], b.mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec[0] = saturatedSub(mVec[0], t0);
+            mVec[1] = saturatedSub(mVec[1], t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<16> const & mask, uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedSub(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t2 = saturatedSub(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVec_u const & b) const {
             __m256i t0 = _mm256_sub_epi32(b.mVec[0], mVec[0]);
@@ -602,25 +801,217 @@ namespace SIMD {
             return *this;
         }
         // DIVV
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVec_u const & b) const {
+            __m256i t0 = divideVector(mVec[0], b.mVec[0]);
+            __m256i t1 = divideVector(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
         UME_FORCE_INLINE SIMDVec_u operator/ (SIMDVec_u const & b) const {
             return div(b);
         }
         // MDIVV
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = divideVector(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t2 = divideVector(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
         // DIVS
+        UME_FORCE_INLINE SIMDVec_u div(uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = divideVector(mVec[0], t0);
+            __m256i t2 = divideVector(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
         UME_FORCE_INLINE SIMDVec_u operator/ (uint32_t b) const {
             return div(b);
         }
         // MDIVS
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<16> const & mask, uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = divideVector(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t3 = divideVector(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_u(t2, t4);
+        }
         // DIVVA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVec_u const & b) {
+            mVec[0] = divideVector(mVec[0], b.mVec[0]);
+            mVec[1] = divideVector(mVec[1], b.mVec[1]);
+            return *this;
+        }
         UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDVec_u const & b) {
             return diva(b);
         }
         // MDIVVA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = divideVector(mVec[0], b.mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t1 = divideVector(mVec[1], b.mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
         // DIVSA
+        UME_FORCE_INLINE SIMDVec_u & diva(uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec[0] = divideVector(mVec[0], t0);
+            mVec[1] = divideVector(mVec[1], t0);
+            return *this;
+        }
         UME_FORCE_INLINE SIMDVec_u & operator/= (uint32_t b) {
             return diva(b);
         }
         // MDIVSA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<16> const & mask, uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = divideVector(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t2 = divideVector(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDDivisor<uint32_t> const & b) const {
+            __m256i t0 = divideMagic(mVec[0], b);
+            __m256i t1 = divideMagic(mVec[1], b);
+            return SIMDVec_u(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (SIMDDivisor<uint32_t> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<16> const & mask, SIMDDivisor<uint32_t> const & b) const {
+            __m256i t0 = divideMagic(mVec[0], b);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t2 = divideMagic(mVec[1], b);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDDivisor<uint32_t> const & b) {
+            mVec[0] = divideMagic(mVec[0], b);
+            mVec[1] = divideMagic(mVec[1], b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDDivisor<uint32_t> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<16> const & mask, SIMDDivisor<uint32_t> const & b) {
+            __m256i t0 = divideMagic(mVec[0], b);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t1 = divideMagic(mVec[1], b);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // REMV
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVec_u const & b) const {
+            __m256i t0 = remainderVector(mVec[0], b.mVec[0]);
+            __m256i t1 = remainderVector(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (SIMDVec_u const & b) const {
+            return rem(b);
+        }
+        // MREMV
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = remainderVector(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t2 = remainderVector(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // REMS
+        UME_FORCE_INLINE SIMDVec_u rem(uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = remainderVector(mVec[0], t0);
+            __m256i t2 = remainderVector(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (uint32_t b) const {
+            return rem(b);
+        }
+        // MREMS
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<16> const & mask, uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = remainderVector(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t3 = remainderVector(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_u(t2, t4);
+        }
+        // REMVA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVec_u const & b) {
+            mVec[0] = remainderVector(mVec[0], b.mVec[0]);
+            mVec[1] = remainderVector(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (SIMDVec_u const & b) {
+            return rema(b);
+        }
+        // MREMVA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = remainderVector(mVec[0], b.mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t1 = remainderVector(mVec[1], b.mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // REMSA
+        UME_FORCE_INLINE SIMDVec_u & rema(uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec[0] = remainderVector(mVec[0], t0);
+            mVec[1] = remainderVector(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (uint32_t b) {
+            return rema(b);
+        }
+        // MREMSA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<16> const & mask, uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = remainderVector(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t2 = remainderVector(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // REMD
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDDivisor<uint32_t> const & b) const {
+            __m256i t0 = remainderMagic(mVec[0], b);
+            __m256i t1 = remainderMagic(mVec[1], b);
+            return SIMDVec_u(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (SIMDDivisor<uint32_t> const & b) const {
+            return rem(b);
+        }
+        // MREMD
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<16> const & mask, SIMDDivisor<uint32_t> const & b) const {
+            __m256i t0 = remainderMagic(mVec[0], b);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t2 = remainderMagic(mVec[1], b);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // REMDA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDDivisor<uint32_t> const & b) {
+            mVec[0] = remainderMagic(mVec[0], b);
+            mVec[1] = remainderMagic(mVec[1], b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (SIMDDivisor<uint32_t> const & b) {
+            return rema(b);
+        }
+        // MREMDA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<16> const & mask, SIMDDivisor<uint32_t> const & b) {
+            __m256i t0 = remainderMagic(mVec[0], b);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t1 = remainderMagic(mVec[1], b);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
         // RCP
         // MRCP
         // RCPS
@@ -1621,83 +2012,424 @@ namespace SIMD {
         }
         // SCATTERS
         UME_FORCE_INLINE uint32_t* scatter(uint32_t* baseAddr, uint32_t* indices) const {
-            alignas(32) uint32_t raw[16];
-            _mm256_store_si256((__m256i*) raw, mVec[0]);
-            _mm256_store_si256((__m256i*) (raw + 8), mVec[1]);
-            for (int i = 0; i < 16; i++) { baseAddr[indices[i]] = raw[i]; };
+            scatterLanes(baseAddr, mVec[0], _mm256_loadu_si256((__m256i*)indices), 0xFF);
+            scatterLanes(baseAddr, mVec[1], _mm256_loadu_si256((__m256i*)(indices + 8)), 0xFF);
             return baseAddr;
         }
         // MSCATTERS
         UME_FORCE_INLINE uint32_t* scatter(SIMDVecMask<16> const & mask, uint32_t* baseAddr, uint32_t* indices) const {
-            alignas(32) uint32_t raw[16];
-            alignas(32) uint32_t rawMask[16];
-            _mm256_store_si256((__m256i*) raw, mVec[0]);
-            _mm256_store_si256((__m256i*) rawMask, mask.mMask[0]);
-            _mm256_store_si256((__m256i*) (raw + 8), mVec[1]);
-            _mm256_store_si256((__m256i*) (rawMask + 8), mask.mMask[1]);
-            for (int i = 0; i < 16; i++) { if (rawMask[i] == SIMDVecMask<16>::TRUE_VAL()) baseAddr[indices[i]] = raw[i]; };
+            scatterLanes(baseAddr, mVec[0], _mm256_loadu_si256((__m256i*)indices), _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[0])));
+            scatterLanes(baseAddr, mVec[1], _mm256_loadu_si256((__m256i*)(indices + 8)), _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[1])));
             return baseAddr;
         }
         // SCATTERV
         UME_FORCE_INLINE uint32_t* scatter(uint32_t* baseAddr, SIMDVec_u const & indices) const {
-            alignas(32) uint32_t raw[16];
-            alignas(32) uint32_t rawIndices[16];
-            _mm256_store_si256((__m256i*) raw, mVec[0]);
-            _mm256_store_si256((__m256i*) rawIndices, indices.mVec[0]);
-            _mm256_store_si256((__m256i*) (raw + 8), mVec[1]);
-            _mm256_store_si256((__m256i*) (rawIndices + 8), indices.mVec[1]);
-            for (int i = 0; i < 16; i++) { baseAddr[rawIndices[i]] = raw[i]; };
+            scatterLanes(baseAddr, mVec[0], indices.mVec[0], 0xFF);
+            scatterLanes(baseAddr, mVec[1], indices.mVec[1], 0xFF);
             return baseAddr;
         }
         // MSCATTERV
         UME_FORCE_INLINE uint32_t* scatter(SIMDVecMask<16> const & mask, uint32_t* baseAddr, SIMDVec_u const & indices) const {
-            alignas(32) uint32_t raw[16];
-            alignas(32) uint32_t rawIndices[16];
-            alignas(32) uint32_t rawMask[16];
-            _mm256_store_si256((__m256i*) raw, mVec[0]);
-            _mm256_store_si256((__m256i*) rawIndices, indices.mVec[0]);
-            _mm256_store_si256((__m256i*) rawMask, mask.mMask[0]);
-            _mm256_store_si256((__m256i*) (raw + 8), mVec[1]);
-            _mm256_store_si256((__m256i*) (rawIndices + 8), indices.mVec[1]);
-            _mm256_store_si256((__m256i*) (rawMask + 8), mask.mMask[1]);
-            for (int i = 0; i < 16; i++) {
-                if (rawMask[i] == SIMDVecMask<16>::TRUE_VAL())
-                    baseAddr[rawIndices[i]] = raw[i];
-            };
+            scatterLanes(baseAddr, mVec[0], indices.mVec[0], _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[0])));
+            scatterLanes(baseAddr, mVec[1], indices.mVec[1], _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[1])));
+            return baseAddr;
+        }
+        // SCATTERADDV
+        UME_FORCE_INLINE uint32_t* scatteradd(uint32_t* baseAddr, SIMDVec_u<uint32_t, 16> const & indices) const {
+            scatterAddLanes(baseAddr, mVec[0], indices.mVec[0], 0xFF);
+            scatterAddLanes(baseAddr, mVec[1], indices.mVec[1], 0xFF);
+            return baseAddr;
+        }
+        // MSCATTERADDV
+        UME_FORCE_INLINE uint32_t* scatteradd(SIMDVecMask<16> const & mask, uint32_t* baseAddr, SIMDVec_u<uint32_t, 16> const & indices) const {
+            scatterAddLanes(baseAddr, mVec[0], indices.mVec[0], _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[0])));
+            scatterAddLanes(baseAddr, mVec[1], indices.mVec[1], _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask[1])));
             return baseAddr;
         }
         // LSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_sllv_epi32(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_sllv_epi32(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (SIMDVec_u const & b) const {
+            return lsh(b);
+        }
         // MLSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_sllv_epi32(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t2 = _mm256_sllv_epi32(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
         // LSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sll_epi32(mVec[0], t0);
+            __m256i t2 = _mm256_sll_epi32(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (uint32_t b) const {
+            return lsh(b);
+        }
         // MLSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<16> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sll_epi32(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t3 = _mm256_sll_epi32(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_u(t2, t4);
+        }
         // LSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVec_u const & b) {
+            mVec[0] = _mm256_sllv_epi32(mVec[0], b.mVec[0]);
+            mVec[1] = _mm256_sllv_epi32(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (SIMDVec_u const & b) {
+            return lsha(b);
+        }
         // MLSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_sllv_epi32(mVec[0], b.mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t1 = _mm256_sllv_epi32(mVec[1], b.mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
         // LSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec[0] = _mm256_sll_epi32(mVec[0], t0);
+            mVec[1] = _mm256_sll_epi32(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (uint32_t b) {
+            return lsha(b);
+        }
         // MLSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<16> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sll_epi32(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t2 = _mm256_sll_epi32(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
         // RSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_srlv_epi32(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_srlv_epi32(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (SIMDVec_u const & b) const {
+            return rsh(b);
+        }
         // MRSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_srlv_epi32(mVec[0], b.mVec[0]);
+            __m256i t1 = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t2 = _mm256_srlv_epi32(mVec[1], b.mVec[1]);
+            __m256i t3 = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
         // RSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_srl_epi32(mVec[0], t0);
+            __m256i t2 = _mm256_srl_epi32(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (uint32_t b) const {
+            return rsh(b);
+        }
         // MRSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<16> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_srl_epi32(mVec[0], t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t3 = _mm256_srl_epi32(mVec[1], t0);
+            __m256i t4 = _mm256_blendv_epi8(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_u(t2, t4);
+        }
         // RSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVec_u const & b) {
+            mVec[0] = _mm256_srlv_epi32(mVec[0], b.mVec[0]);
+            mVec[1] = _mm256_srlv_epi32(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (SIMDVec_u const & b) {
+            return rsha(b);
+        }
         // MRSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_srlv_epi32(mVec[0], b.mVec[0]);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t0, mask.mMask[0]);
+            __m256i t1 = _mm256_srlv_epi32(mVec[1], b.mVec[1]);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
         // RSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec[0] = _mm256_srl_epi32(mVec[0], t0);
+            mVec[1] = _mm256_srl_epi32(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (uint32_t b) {
+            return rsha(b);
+        }
         // MRSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<16> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_srl_epi32(mVec[0], t0);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t1, mask.mMask[0]);
+            __m256i t2 = _mm256_srl_epi32(mVec[1], t0);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
         // ROLV
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec[0], t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec[0], t2);
+            __m256i t5 = _mm256_srlv_epi32(mVec[0], t3);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            __m256i t7 = _mm256_and_si256(b.mVec[1], t0);
+            __m256i t8 = _mm256_sub_epi32(t1, t7);
+            __m256i t9 = _mm256_sllv_epi32(mVec[1], t7);
+            __m256i t10 = _mm256_srlv_epi32(mVec[1], t8);
+            __m256i t11 = _mm256_or_si256(t9, t10);
+            return SIMDVec_u(t6, t11);
+        }
         // MROLV
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec[0], t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec[0], t2);
+            __m256i t5 = _mm256_srlv_epi32(mVec[0], t3);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            __m256i t7 = _mm256_blendv_epi8(mVec[0], t6, mask.mMask[0]);
+            __m256i t8 = _mm256_and_si256(b.mVec[1], t0);
+            __m256i t9 = _mm256_sub_epi32(t1, t8);
+            __m256i t10 = _mm256_sllv_epi32(mVec[1], t8);
+            __m256i t11 = _mm256_srlv_epi32(mVec[1], t9);
+            __m256i t12 = _mm256_or_si256(t10, t11);
+            __m256i t13 = _mm256_blendv_epi8(mVec[1], t12, mask.mMask[1]);
+            return SIMDVec_u(t7, t13);
+        }
         // ROLS
+        UME_FORCE_INLINE SIMDVec_u rol(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec[0], t0);
+            __m256i t3 = _mm256_srl_epi32(mVec[0], t1);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            __m256i t5 = _mm256_sll_epi32(mVec[1], t0);
+            __m256i t6 = _mm256_srl_epi32(mVec[1], t1);
+            __m256i t7 = _mm256_or_si256(t5, t6);
+            return SIMDVec_u(t4, t7);
+        }
         // MROLS
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVecMask<16> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec[0], t0);
+            __m256i t3 = _mm256_srl_epi32(mVec[0], t1);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            __m256i t5 = _mm256_blendv_epi8(mVec[0], t4, mask.mMask[0]);
+            __m256i t6 = _mm256_sll_epi32(mVec[1], t0);
+            __m256i t7 = _mm256_srl_epi32(mVec[1], t1);
+            __m256i t8 = _mm256_or_si256(t6, t7);
+            __m256i t9 = _mm256_blendv_epi8(mVec[1], t8, mask.mMask[1]);
+            return SIMDVec_u(t5, t9);
+        }
         // ROLVA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVec_u const & b) {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec[0], t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec[0], t2);
+            __m256i t5 = _mm256_srlv_epi32(mVec[0], t3);
+            mVec[0] = _mm256_or_si256(t4, t5);
+            __m256i t6 = _mm256_and_si256(b.mVec[1], t0);
+            __m256i t7 = _mm256_sub_epi32(t1, t6);
+            __m256i t8 = _mm256_sllv_epi32(mVec[1], t6);
+            __m256i t9 = _mm256_srlv_epi32(mVec[1], t7);
+            mVec[1] = _mm256_or_si256(t8, t9);
+            return *this;
+        }
         // MROLVA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec[0], t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec[0], t2);
+            __m256i t5 = _mm256_srlv_epi32(mVec[0], t3);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t6, mask.mMask[0]);
+            __m256i t7 = _mm256_and_si256(b.mVec[1], t0);
+            __m256i t8 = _mm256_sub_epi32(t1, t7);
+            __m256i t9 = _mm256_sllv_epi32(mVec[1], t7);
+            __m256i t10 = _mm256_srlv_epi32(mVec[1], t8);
+            __m256i t11 = _mm256_or_si256(t9, t10);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t11, mask.mMask[1]);
+            return *this;
+        }
         // ROLSA
+        UME_FORCE_INLINE SIMDVec_u & rola(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec[0], t0);
+            __m256i t3 = _mm256_srl_epi32(mVec[0], t1);
+            mVec[0] = _mm256_or_si256(t2, t3);
+            __m256i t4 = _mm256_sll_epi32(mVec[1], t0);
+            __m256i t5 = _mm256_srl_epi32(mVec[1], t1);
+            mVec[1] = _mm256_or_si256(t4, t5);
+            return *this;
+        }
         // MROLSA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVecMask<16> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec[0], t0);
+            __m256i t3 = _mm256_srl_epi32(mVec[0], t1);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t4, mask.mMask[0]);
+            __m256i t5 = _mm256_sll_epi32(mVec[1], t0);
+            __m256i t6 = _mm256_srl_epi32(mVec[1], t1);
+            __m256i t7 = _mm256_or_si256(t5, t6);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t7, mask.mMask[1]);
+            return *this;
+        }
         // RORV
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec[0], t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec[0], t3);
+            __m256i t5 = _mm256_srlv_epi32(mVec[0], t2);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            __m256i t7 = _mm256_and_si256(b.mVec[1], t0);
+            __m256i t8 = _mm256_sub_epi32(t1, t7);
+            __m256i t9 = _mm256_sllv_epi32(mVec[1], t8);
+            __m256i t10 = _mm256_srlv_epi32(mVec[1], t7);
+            __m256i t11 = _mm256_or_si256(t9, t10);
+            return SIMDVec_u(t6, t11);
+        }
         // MRORV
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec[0], t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec[0], t3);
+            __m256i t5 = _mm256_srlv_epi32(mVec[0], t2);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            __m256i t7 = _mm256_blendv_epi8(mVec[0], t6, mask.mMask[0]);
+            __m256i t8 = _mm256_and_si256(b.mVec[1], t0);
+            __m256i t9 = _mm256_sub_epi32(t1, t8);
+            __m256i t10 = _mm256_sllv_epi32(mVec[1], t9);
+            __m256i t11 = _mm256_srlv_epi32(mVec[1], t8);
+            __m256i t12 = _mm256_or_si256(t10, t11);
+            __m256i t13 = _mm256_blendv_epi8(mVec[1], t12, mask.mMask[1]);
+            return SIMDVec_u(t7, t13);
+        }
         // RORS
+        UME_FORCE_INLINE SIMDVec_u ror(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec[0], t1);
+            __m256i t3 = _mm256_srl_epi32(mVec[0], t0);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            __m256i t5 = _mm256_sll_epi32(mVec[1], t1);
+            __m256i t6 = _mm256_srl_epi32(mVec[1], t0);
+            __m256i t7 = _mm256_or_si256(t5, t6);
+            return SIMDVec_u(t4, t7);
+        }
         // MRORS
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVecMask<16> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec[0], t1);
+            __m256i t3 = _mm256_srl_epi32(mVec[0], t0);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            __m256i t5 = _mm256_blendv_epi8(mVec[0], t4, mask.mMask[0]);
+            __m256i t6 = _mm256_sll_epi32(mVec[1], t1);
+            __m256i t7 = _mm256_srl_epi32(mVec[1], t0);
+            __m256i t8 = _mm256_or_si256(t6, t7);
+            __m256i t9 = _mm256_blendv_epi8(mVec[1], t8, mask.mMask[1]);
+            return SIMDVec_u(t5, t9);
+        }
         // RORVA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVec_u const & b) {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec[0], t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec[0], t3);
+            __m256i t5 = _mm256_srlv_epi32(mVec[0], t2);
+            mVec[0] = _mm256_or_si256(t4, t5);
+            __m256i t6 = _mm256_and_si256(b.mVec[1], t0);
+            __m256i t7 = _mm256_sub_epi32(t1, t6);
+            __m256i t8 = _mm256_sllv_epi32(mVec[1], t7);
+            __m256i t9 = _mm256_srlv_epi32(mVec[1], t6);
+            mVec[1] = _mm256_or_si256(t8, t9);
+            return *this;
+        }
         // MRORVA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec[0], t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec[0], t3);
+            __m256i t5 = _mm256_srlv_epi32(mVec[0], t2);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t6, mask.mMask[0]);
+            __m256i t7 = _mm256_and_si256(b.mVec[1], t0);
+            __m256i t8 = _mm256_sub_epi32(t1, t7);
+            __m256i t9 = _mm256_sllv_epi32(mVec[1], t8);
+            __m256i t10 = _mm256_srlv_epi32(mVec[1], t7);
+            __m256i t11 = _mm256_or_si256(t9, t10);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t11, mask.mMask[1]);
+            return *this;
+        }
         // RORSA
+        UME_FORCE_INLINE SIMDVec_u & rora(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec[0], t1);
+            __m256i t3 = _mm256_srl_epi32(mVec[0], t0);
+            mVec[0] = _mm256_or_si256(t2, t3);
+            __m256i t4 = _mm256_sll_epi32(mVec[1], t1);
+            __m256i t5 = _mm256_srl_epi32(mVec[1], t0);
+            mVec[1] = _mm256_or_si256(t4, t5);
+            return *this;
+        }
         // MRORSA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVecMask<16> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec[0], t1);
+            __m256i t3 = _mm256_srl_epi32(mVec[0], t0);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            mVec[0] = _mm256_blendv_epi8(mVec[0], t4, mask.mMask[0]);
+            __m256i t5 = _mm256_sll_epi32(mVec[1], t1);
+            __m256i t6 = _mm256_srl_epi32(mVec[1], t0);
+            __m256i t7 = _mm256_or_si256(t5, t6);
+            mVec[1] = _mm256_blendv_epi8(mVec[1], t7, mask.mMask[1]);
+            return *this;
+        }
 
         // PACK
         UME_FORCE_INLINE SIMDVec_u & pack(SIMDVec_u<uint32_t, 8> const & a, SIMDVec_u<uint32_t, 8> const & b) {
@@ -97,6 +97,40 @@ namespace SIMD {
         UME_FORCE_INLINE explicit SIMDVec_u(__m128i & x) { this->mVec = x; }
         UME_FORCE_INLINE explicit SIMDVec_u(const __m128i & x) { this->mVec = x; }
 
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m128i saturatedAdd(__m128i const & a, __m128i const & b) {
+            return _mm_add_epi32(a, _mm_min_epu32(b, _mm_xor_si128(a, _mm_set1_epi32(-1))));
+        }
+        static UME_FORCE_INLINE __m128i saturatedSub(__m128i const & a, __m128i const & b) {
+            return _mm_sub_epi32(_mm_max_epu32(a, b), b);
+        }
+        // Lane-wise division through double precision, exact for 32-bit operands.
+        static UME_FORCE_INLINE __m128i divideVector(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_set1_epi32(0x80000000);
+            __m256d t1 = _mm256_set1_pd(2147483648.0);
+            __m256d t2 = _mm256_add_pd(_mm256_cvtepi32_pd(_mm_xor_si128(a, t0)), t1);
+            __m256d t3 = _mm256_add_pd(_mm256_cvtepi32_pd(_mm_xor_si128(b, t0)), t1);
+            __m256d t4 = _mm256_round_pd(_mm256_div_pd(t2, t3), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+            return _mm_xor_si128(_mm256_cvttpd_epi32(_mm256_sub_pd(t4, t1)), t0);
+        }
+        static UME_FORCE_INLINE __m128i remainderVector(__m128i const & a, __m128i const & b) {
+            __m128i t0 = divideVector(a, b);
+            return _mm_sub_epi32(a, _mm_mullo_epi32(t0, b));
+        }
+        // Division by a precomputed divisor, used by DIVD*/REMD*.
+        static UME_FORCE_INLINE __m128i divideMagic(__m128i const & a, SIMDDivisor<uint32_t> const & b) {
+            __m128i t0 = _mm_set1_epi32(b.magic());
+            __m128i t1 = _mm_mul_epu32(a, t0);
+            __m128i t2 = _mm_mul_epu32(_mm_srli_epi64(a, 32), t0);
+            __m128i t3 = _mm_blend_epi32(_mm_srli_epi64(t1, 32), t2, 0xA);
+            __m128i t4 = _mm_srl_epi32(_mm_sub_epi32(a, t3), _mm_cvtsi32_si128(b.shift1()));
+            return _mm_srl_epi32(_mm_add_epi32(t3, t4), _mm_cvtsi32_si128(b.shift2()));
+        }
+        static UME_FORCE_INLINE __m128i remainderMagic(__m128i const & a, SIMDDivisor<uint32_t> const & b) {
+            __m128i t0 = divideMagic(a, b);
+            return _mm_sub_epi32(a, _mm_mullo_epi32(t0, _mm_set1_epi32(b.divisor())));
+        }
+
     public:
 
         constexpr static uint32_t length() { return 4; }
@@ -247,26 +281,22 @@ namespace SIMD {
         }
         // SWIZZLE
         UME_FORCE_INLINE SIMDVec_u swizzle(SIMDSwizzle<4> const & sMask) const {
-            __m128 t0 = _mm_castsi128_ps(mVec);
-            __m128 t1 = _mm_permutevar_ps(t0, sMask.mVec);
-            __m128i t2 = _mm_castps_si128(t1);
-            return SIMDVec_u(t2);
+            __m128 t0 = _mm_permutevar_ps(_mm_castsi128_ps(mVec), sMask.mVec);
+            __m128i t1 = _mm_castps_si128(t0);
+            return SIMDVec_u(t1);
         }
         template<int i0, int i1, int i2, int i3>
-        UME_FORCE_INLINE SIMDVec_u swizzle() {
-            const int index = i0 | (i1 << 2) | (i2 << 4) | (i3 << 6);
-            __m128 t0 = _mm_castsi128_ps(mVec);
-            __m128 t1 = _mm_permute_ps(t0, index);
-            __m128i t2 = _mm_castps_si128(t1);
-            return SIMDVec_u(t2);
+        UME_FORCE_INLINE SIMDVec_u swizzle() const {
+            __m128i t0 = _mm_shuffle_epi32(mVec, (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6));
+            return SIMDVec_u(t0);
         }
         // SWIZZLEA
         UME_FORCE_INLINE SIMDVec_u & swizzlea(SIMDSwizzle<4> const & sMask) {
-            __m128 t0 = _mm_castsi128_ps(mVec);
-            __m128 t1 = _mm_permutevar_ps(t0, sMask.mVec);
-            mVec = _mm_castps_si128(t1);
+            SIMDVec_u t0 = swizzle(sMask);
+            mVec = t0.mVec;
             return *this;
         }
+
         // ADDV
         UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
             __m128i t0 = _mm_add_epi32(mVec, b.mVec);
@@ -326,13 +356,53 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVec_u const & b) const {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            return SIMDVec_u(t1);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVec_u const & b) {
+            mVec = saturatedAdd(mVec, b.mVec);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = saturatedAdd(mVec, t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_u postinc() {
             __m128i t0 = _mm_set1_epi32(1);
@@ -426,13 +496,53 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVec_u const & b) const {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            return SIMDVec_u(t1);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVec_u const & b) {
+            mVec = saturatedSub(mVec, b.mVec);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = saturatedSub(mVec, t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVec_u const & b) const {
             __m128i t0 = _mm_sub_epi32(b.mVec, mVec);
@@ -572,13 +682,181 @@ namespace SIMD {
             return *this;
         }
         // DIVV
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVec_u const & b) const {
+            __m128i t0 = divideVector(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (SIMDVec_u const & b) const {
+            return div(b);
+        }
         // MDIVV
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = divideVector(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // DIVS
+        UME_FORCE_INLINE SIMDVec_u div(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = divideVector(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (uint32_t b) const {
+            return div(b);
+        }
         // MDIVS
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = divideVector(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // DIVVA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVec_u const & b) {
+            mVec = divideVector(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDVec_u const & b) {
+            return diva(b);
+        }
         // MDIVVA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = divideVector(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // DIVSA
+        UME_FORCE_INLINE SIMDVec_u & diva(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = divideVector(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (uint32_t b) {
+            return diva(b);
+        }
         // MDIVSA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = divideVector(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDDivisor<uint32_t> const & b) const {
+            __m128i t0 = divideMagic(mVec, b);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (SIMDDivisor<uint32_t> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<4> const & mask, SIMDDivisor<uint32_t> const & b) const {
+            __m128i t0 = divideMagic(mVec, b);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDDivisor<uint32_t> const & b) {
+            mVec = divideMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDDivisor<uint32_t> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<4> const & mask, SIMDDivisor<uint32_t> const & b) {
+            __m128i t0 = divideMagic(mVec, b);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // REMV
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVec_u const & b) const {
+            __m128i t0 = remainderVector(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (SIMDVec_u const & b) const {
+            return rem(b);
+        }
+        // MREMV
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = remainderVector(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // REMS
+        UME_FORCE_INLINE SIMDVec_u rem(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = remainderVector(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (uint32_t b) const {
+            return rem(b);
+        }
+        // MREMS
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = remainderVector(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // REMVA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVec_u const & b) {
+            mVec = remainderVector(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (SIMDVec_u const & b) {
+            return rema(b);
+        }
+        // MREMVA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = remainderVector(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // REMSA
+        UME_FORCE_INLINE SIMDVec_u & rema(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = remainderVector(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (uint32_t b) {
+            return rema(b);
+        }
+        // MREMSA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = remainderVector(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // REMD
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDDivisor<uint32_t> const & b) const {
+            __m128i t0 = remainderMagic(mVec, b);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (SIMDDivisor<uint32_t> const & b) const {
+            return rem(b);
+        }
+        // MREMD
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<4> const & mask, SIMDDivisor<uint32_t> const & b) const {
+            __m128i t0 = remainderMagic(mVec, b);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // REMDA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDDivisor<uint32_t> const & b) {
+            mVec = remainderMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (SIMDDivisor<uint32_t> const & b) {
+            return rema(b);
+        }
+        // MREMDA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<4> const & mask, SIMDDivisor<uint32_t> const & b) {
+            __m128i t0 = remainderMagic(mVec, b);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // RCP
         // MRCP
         // RCPS
@@ -979,6 +1257,9 @@ namespace SIMD {
             __m128i t0 = _mm_and_si128(mVec, b.mVec);
             return SIMDVec_u(t0);
         }
+        UME_FORCE_INLINE SIMDVec_u operator& (SIMDVec_u const & b) const {
+            return band(b);
+        }
         // MBANDV
         UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
             __m128i t0 = _mm_and_si128(mVec, b.mVec);
@@ -991,6 +1272,9 @@ namespace SIMD {
             __m128i t1 = _mm_and_si128(mVec, t0);
             return SIMDVec_u(t1);
         }
+        UME_FORCE_INLINE SIMDVec_u operator& (uint32_t b) const {
+            return band(b);
+        }
         // MBANDS
         UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<4> const & mask, uint32_t b) const {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1003,6 +1287,9 @@ namespace SIMD {
             mVec = _mm_and_si128(mVec, b.mVec);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (SIMDVec_u const & b) {
+            return banda(b);
+        }
         // MBANDVA
         UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
             __m128i t0 = _mm_and_si128(mVec, b.mVec);
@@ -1015,6 +1302,9 @@ namespace SIMD {
             mVec = _mm_and_si128(mVec, t0);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (uint32_t b) {
+            return banda(b);
+        }
         // MBANDSA
         UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<4> const & mask, uint32_t b) {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1027,6 +1317,9 @@ namespace SIMD {
             __m128i t0 = _mm_or_si128(mVec, b.mVec);
             return SIMDVec_u(t0);
         }
+        UME_FORCE_INLINE SIMDVec_u operator| (SIMDVec_u const & b) const {
+            return bor(b);
+        }
         // MBORV
         UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
             __m128i t0 = _mm_or_si128(mVec, b.mVec);
@@ -1039,6 +1332,9 @@ namespace SIMD {
             __m128i t1 = _mm_or_si128(mVec, t0);
             return SIMDVec_u(t1);
         }
+        UME_FORCE_INLINE SIMDVec_u operator| (uint32_t b) const {
+            return bor(b);
+        }
         // MBORS
         UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<4> const & mask, uint32_t b) const {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1051,6 +1347,9 @@ namespace SIMD {
             mVec = _mm_or_si128(mVec, b.mVec);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (SIMDVec_u const & b) {
+            return bora(b);
+        }
         // MBORVA
         UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
             __m128i t0 = _mm_or_si128(mVec, b.mVec);
@@ -1063,6 +1362,9 @@ namespace SIMD {
             mVec = _mm_or_si128(mVec, t0);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (uint32_t b) {
+            return bora(b);
+        }
         // MBORSA
         UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<4> const & mask, uint32_t b) {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1075,6 +1377,9 @@ namespace SIMD {
             __m128i t0 = _mm_xor_si128(mVec, b.mVec);
             return SIMDVec_u(t0);
         }
+        UME_FORCE_INLINE SIMDVec_u operator^ (SIMDVec_u const & b) const {
+            return bxor(b);
+        }
         // MBXORV
         UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
             __m128i t0 = _mm_xor_si128(mVec, b.mVec);
@@ -1087,6 +1392,9 @@ namespace SIMD {
             __m128i t1 = _mm_xor_si128(mVec, t0);
             return SIMDVec_u(t1);
         }
+        UME_FORCE_INLINE SIMDVec_u operator^ (uint32_t b) const {
+            return bxor(b);
+        }
         // MBXORS
         UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<4> const & mask, uint32_t b) const {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1099,6 +1407,9 @@ namespace SIMD {
             mVec = _mm_xor_si128(mVec, b.mVec);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_u & operator^= (SIMDVec_u const & b) {
+            return bxora(b);
+        }
         // MBXORVA
         UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
             __m128i t0 = _mm_xor_si128(mVec, b.mVec);
@@ -1111,6 +1422,9 @@ namespace SIMD {
             mVec = _mm_xor_si128(mVec, t0);
             return *this;
         }
+        UME_FORCE_INLINE SIMDVec_u & operator^= (uint32_t b) {
+            return bxora(b);
+        }
         // MBXORSA
         UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<4> const & mask, uint32_t b) {
             __m128i t0 = _mm_set1_epi32(b);
@@ -1124,6 +1438,9 @@ namespace SIMD {
             __m128i t1 = _mm_xor_si128(mVec, t0);
             return SIMDVec_u(t1);
         }
+        UME_FORCE_INLINE SIMDVec_u operator~ () const {
+            return bnot();
+        }
         // MBNOT
         UME_FORCE_INLINE SIMDVec_u bnot(SIMDVecMask<4> const & mask) const {
             __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
@@ -1314,37 +1631,293 @@ namespace SIMD {
         }
 
         // LSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_sllv_epi32(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (SIMDVec_u const & b) const {
+            return lsh(b);
+        }
         // MLSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_sllv_epi32(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // LSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi32(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (uint32_t b) const {
+            return lsh(b);
+        }
         // MLSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi32(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // LSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVec_u const & b) {
+            mVec = _mm_sllv_epi32(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (SIMDVec_u const & b) {
+            return lsha(b);
+        }
         // MLSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_sllv_epi32(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // LSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = _mm_sll_epi32(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (uint32_t b) {
+            return lsha(b);
+        }
         // MLSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi32(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // RSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_srlv_epi32(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (SIMDVec_u const & b) const {
+            return rsh(b);
+        }
         // MRSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_srlv_epi32(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // RSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_srl_epi32(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (uint32_t b) const {
+            return rsh(b);
+        }
         // MRSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_srl_epi32(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // RSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVec_u const & b) {
+            mVec = _mm_srlv_epi32(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (SIMDVec_u const & b) {
+            return rsha(b);
+        }
         // MRSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_srlv_epi32(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // RSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = _mm_srl_epi32(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (uint32_t b) {
+            return rsha(b);
+        }
         // MRSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_srl_epi32(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // ROLV
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = _mm_sllv_epi32(mVec, t2);
+            __m128i t5 = _mm_srlv_epi32(mVec, t3);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            return SIMDVec_u(t6);
+        }
         // MROLV
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = _mm_sllv_epi32(mVec, t2);
+            __m128i t5 = _mm_srlv_epi32(mVec, t3);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = BLEND(mVec, t6, mask.mMask);
+            return SIMDVec_u(t7);
+        }
         // ROLS
+        UME_FORCE_INLINE SIMDVec_u rol(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t0);
+            __m128i t3 = _mm_srl_epi32(mVec, t1);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            return SIMDVec_u(t4);
+        }
         // MROLS
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t0);
+            __m128i t3 = _mm_srl_epi32(mVec, t1);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            __m128i t5 = BLEND(mVec, t4, mask.mMask);
+            return SIMDVec_u(t5);
+        }
         // ROLVA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVec_u const & b) {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = _mm_sllv_epi32(mVec, t2);
+            __m128i t5 = _mm_srlv_epi32(mVec, t3);
+            mVec = _mm_or_si128(t4, t5);
+            return *this;
+        }
         // MROLVA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = _mm_sllv_epi32(mVec, t2);
+            __m128i t5 = _mm_srlv_epi32(mVec, t3);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            mVec = BLEND(mVec, t6, mask.mMask);
+            return *this;
+        }
         // ROLSA
+        UME_FORCE_INLINE SIMDVec_u & rola(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t0);
+            __m128i t3 = _mm_srl_epi32(mVec, t1);
+            mVec = _mm_or_si128(t2, t3);
+            return *this;
+        }
         // MROLSA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t0);
+            __m128i t3 = _mm_srl_epi32(mVec, t1);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            mVec = BLEND(mVec, t4, mask.mMask);
+            return *this;
+        }
         // RORV
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = _mm_sllv_epi32(mVec, t3);
+            __m128i t5 = _mm_srlv_epi32(mVec, t2);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            return SIMDVec_u(t6);
+        }
         // MRORV
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = _mm_sllv_epi32(mVec, t3);
+            __m128i t5 = _mm_srlv_epi32(mVec, t2);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = BLEND(mVec, t6, mask.mMask);
+            return SIMDVec_u(t7);
+        }
         // RORS
+        UME_FORCE_INLINE SIMDVec_u ror(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t1);
+            __m128i t3 = _mm_srl_epi32(mVec, t0);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            return SIMDVec_u(t4);
+        }
         // MRORS
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t1);
+            __m128i t3 = _mm_srl_epi32(mVec, t0);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            __m128i t5 = BLEND(mVec, t4, mask.mMask);
+            return SIMDVec_u(t5);
+        }
         // RORVA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVec_u const & b) {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = _mm_sllv_epi32(mVec, t3);
+            __m128i t5 = _mm_srlv_epi32(mVec, t2);
+            mVec = _mm_or_si128(t4, t5);
+            return *this;
+        }
         // MRORVA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = _mm_sllv_epi32(mVec, t3);
+            __m128i t5 = _mm_srlv_epi32(mVec, t2);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            mVec = BLEND(mVec, t6, mask.mMask);
+            return *this;
+        }
         // RORSA
+        UME_FORCE_INLINE SIMDVec_u & rora(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t1);
+            __m128i t3 = _mm_srl_epi32(mVec, t0);
+            mVec = _mm_or_si128(t2, t3);
+            return *this;
+        }
         // MRORSA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t1);
+            __m128i t3 = _mm_srl_epi32(mVec, t0);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            mVec = BLEND(mVec, t4, mask.mMask);
+            return *this;
+        }
         // PACK
         UME_FORCE_INLINE SIMDVec_u & pack(SIMDVec_u<uint32_t, 2> const & a, SIMDVec_u<uint32_t, 2> const & b) {
             alignas(16) uint32_t raw[4] = { a.mVec[0], a.mVec[1], b.mVec[0], b.mVec[1] };
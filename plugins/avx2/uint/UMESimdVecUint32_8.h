@@ -67,6 +67,7 @@ namespace SIMD {
         // Conversion operators require access to private members.
         friend class SIMDVec_i<int32_t, 8>;
         friend class SIMDVec_f<float, 8>;
+        friend class SIMDVec_u<uint16_t, 8>;
 
         friend class SIMDVec_u<uint32_t, 16>;
     private:
@@ -74,6 +75,147 @@ namespace SIMD {
 
         UME_FORCE_INLINE explicit SIMDVec_u(__m256i & x) { mVec = x; }
         UME_FORCE_INLINE explicit SIMDVec_u(const __m256i & x) { mVec = x; }
+
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m256i saturatedAdd(__m256i const & a, __m256i const & b) {
+            return _mm256_add_epi32(a, _mm256_min_epu32(b, _mm256_xor_si256(a, _mm256_set1_epi32(-1))));
+        }
+        static UME_FORCE_INLINE __m256i saturatedSub(__m256i const & a, __m256i const & b) {
+            return _mm256_sub_epi32(_mm256_max_epu32(a, b), b);
+        }
+        // Lane-wise division through double precision, exact for 32-bit operands.
+        static UME_FORCE_INLINE __m128i divideHalf(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_set1_epi32(0x80000000);
+            __m256d t1 = _mm256_set1_pd(2147483648.0);
+            __m256d t2 = _mm256_add_pd(_mm256_cvtepi32_pd(_mm_xor_si128(a, t0)), t1);
+            __m256d t3 = _mm256_add_pd(_mm256_cvtepi32_pd(_mm_xor_si128(b, t0)), t1);
+            __m256d t4 = _mm256_round_pd(_mm256_div_pd(t2, t3), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+            return _mm_xor_si128(_mm256_cvttpd_epi32(_mm256_sub_pd(t4, t1)), t0);
+        }
+        static UME_FORCE_INLINE __m256i divideVector(__m256i const & a, __m256i const & b) {
+            __m128i t0 = divideHalf(_mm256_castsi256_si128(a), _mm256_castsi256_si128(b));
+            __m128i t1 = divideHalf(_mm256_extracti128_si256(a, 1), _mm256_extracti128_si256(b, 1));
+            return _mm256_inserti128_si256(_mm256_castsi128_si256(t0), t1, 1);
+        }
+        static UME_FORCE_INLINE __m256i remainderVector(__m256i const & a, __m256i const & b) {
+            __m256i t0 = divideVector(a, b);
+            return _mm256_sub_epi32(a, _mm256_mullo_epi32(t0, b));
+        }
+        // Division by a precomputed divisor, used by DIVD*/REMD*.
+        static UME_FORCE_INLINE __m256i divideMagic(__m256i const & a, SIMDDivisor<uint32_t> const & b) {
+            __m256i t0 = _mm256_set1_epi32(b.magic());
+            __m256i t1 = _mm256_mul_epu32(a, t0);
+            __m256i t2 = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), t0);
+            __m256i t3 = _mm256_blend_epi32(_mm256_srli_epi64(t1, 32), t2, 0xAA);
+            __m256i t4 = _mm256_srl_epi32(_mm256_sub_epi32(a, t3), _mm_cvtsi32_si128(b.shift1()));
+            return _mm256_srl_epi32(_mm256_add_epi32(t3, t4), _mm_cvtsi32_si128(b.shift2()));
+        }
+        static UME_FORCE_INLINE __m256i remainderMagic(__m256i const & a, SIMDDivisor<uint32_t> const & b) {
+            __m256i t0 = divideMagic(a, b);
+            return _mm256_sub_epi32(a, _mm256_mullo_epi32(t0, _mm256_set1_epi32(b.divisor())));
+        }
+        // Writes lanes of 'v' selected by bits of 'm' to baseAddr[indices[i]],
+        // in lane order. Indices are moved to general purpose registers in
+        // pairs, so neither vector makes a round trip through the stack.
+        static UME_FORCE_INLINE void scatterLanes(uint32_t * baseAddr, __m256i v, __m256i indices, int m) {
+            __m128i v0 = _mm256_castsi256_si128(v);
+            __m128i v1 = _mm256_extracti128_si256(v, 1);
+            __m128i t0 = _mm256_castsi256_si128(indices);
+            __m128i t1 = _mm256_extracti128_si256(indices, 1);
+            uint64_t x0 = uint64_t(_mm_cvtsi128_si64(v0));
+            uint64_t x1 = uint64_t(_mm_extract_epi64(v0, 1));
+            uint64_t x2 = uint64_t(_mm_cvtsi128_si64(v1));
+            uint64_t x3 = uint64_t(_mm_extract_epi64(v1, 1));
+            uint64_t i0 = uint64_t(_mm_cvtsi128_si64(t0));
+            uint64_t i1 = uint64_t(_mm_extract_epi64(t0, 1));
+            uint64_t i2 = uint64_t(_mm_cvtsi128_si64(t1));
+            uint64_t i3 = uint64_t(_mm_extract_epi64(t1, 1));
+            if (m & 0x01) baseAddr[uint32_t(i0)] = uint32_t(x0);
+            if (m & 0x02) baseAddr[uint32_t(i0 >> 32)] = uint32_t(x0 >> 32);
+            if (m & 0x04) baseAddr[uint32_t(i1)] = uint32_t(x1);
+            if (m & 0x08) baseAddr[uint32_t(i1 >> 32)] = uint32_t(x1 >> 32);
+            if (m & 0x10) baseAddr[uint32_t(i2)] = uint32_t(x2);
+            if (m & 0x20) baseAddr[uint32_t(i2 >> 32)] = uint32_t(x2 >> 32);
+            if (m & 0x40) baseAddr[uint32_t(i3)] = uint32_t(x3);
+            if (m & 0x80) baseAddr[uint32_t(i3 >> 32)] = uint32_t(x3 >> 32);
+        }
+        // Adds lanes of 'v' selected by bits of 'm' to baseAddr[indices[i]],
+        // in lane order, so that lanes with repeating indices accumulate.
+        static UME_FORCE_INLINE void scatterAddLanes(uint32_t * baseAddr, __m256i v, __m256i indices, int m) {
+            __m128i v0 = _mm256_castsi256_si128(v);
+            __m128i v1 = _mm256_extracti128_si256(v, 1);
+            __m128i t0 = _mm256_castsi256_si128(indices);
+            __m128i t1 = _mm256_extracti128_si256(indices, 1);
+            uint64_t x0 = uint64_t(_mm_cvtsi128_si64(v0));
+            uint64_t x1 = uint64_t(_mm_extract_epi64(v0, 1));
+            uint64_t x2 = uint64_t(_mm_cvtsi128_si64(v1));
+            uint64_t x3 = uint64_t(_mm_extract_epi64(v1, 1));
+            uint64_t i0 = uint64_t(_mm_cvtsi128_si64(t0));
+            uint64_t i1 = uint64_t(_mm_extract_epi64(t0, 1));
+            uint64_t i2 = uint64_t(_mm_cvtsi128_si64(t1));
+            uint64_t i3 = uint64_t(_mm_extract_epi64(t1, 1));
+            if (m & 0x01) baseAddr[uint32_t(i0)] += uint32_t(x0);
+            if (m & 0x02) baseAddr[uint32_t(i0 >> 32)] += uint32_t(x0 >> 32);
+            if (m & 0x04) baseAddr[uint32_t(i1)] += uint32_t(x1);
+            if (m & 0x08) baseAddr[uint32_t(i1 >> 32)] += uint32_t(x1 >> 32);
+            if (m & 0x10) baseAddr[uint32_t(i2)] += uint32_t(x2);
+            if (m & 0x20) baseAddr[uint32_t(i2 >> 32)] += uint32_t(x2 >> 32);
+            if (m & 0x40) baseAddr[uint32_t(i3)] += uint32_t(x3);
+            if (m & 0x80) baseAddr[uint32_t(i3 >> 32)] += uint32_t(x3 >> 32);
+        }
+        // Returns the permutation that moves lanes selected by bits of 'm' to
+        // the lowest lanes, in order. 'n' receives the number of selected lanes.
+        static UME_FORCE_INLINE __m256i compressIndices(int m, uint32_t & n) {
+            // Each entry holds eight 3-bit lane indices in bits 0..23, and the
+            // number of selected lanes in bits 24..31.
+            static const uint32_t table[256] = {
+                0x00000000, 0x01000000, 0x01000001, 0x02000008, 0x01000002, 0x02000010, 0x02000011, 0x03000088,
+                0x01000003, 0x02000018, 0x02000019, 0x030000C8, 0x0200001A, 0x030000D0, 0x030000D1, 0x04000688,
+                0x01000004, 0x02000020, 0x02000021, 0x03000108, 0x02000022, 0x03000110, 0x03000111, 0x04000888,
+                0x02000023, 0x03000118, 0x03000119, 0x040008C8, 0x0300011A, 0x040008D0, 0x040008D1, 0x05004688,
+                0x01000005, 0x02000028, 0x02000029, 0x03000148, 0x0200002A, 0x03000150, 0x03000151, 0x04000A88,
+                0x0200002B, 0x03000158, 0x03000159, 0x04000AC8, 0x0300015A, 0x04000AD0, 0x04000AD1, 0x05005688,
+                0x0200002C, 0x03000160, 0x03000161, 0x04000B08, 0x03000162, 0x04000B10, 0x04000B11, 0x05005888,
+                0x03000163, 0x04000B18, 0x04000B19, 0x050058C8, 0x04000B1A, 0x050058D0, 0x050058D1, 0x0602C688,
+                0x01000006, 0x02000030, 0x02000031, 0x03000188, 0x02000032, 0x03000190, 0x03000191, 0x04000C88,
+                0x02000033, 0x03000198, 0x03000199, 0x04000CC8, 0x0300019A, 0x04000CD0, 0x04000CD1, 0x05006688,
+                0x02000034, 0x030001A0, 0x030001A1, 0x04000D08, 0x030001A2, 0x04000D10, 0x04000D11, 0x05006888,
+                0x030001A3, 0x04000D18, 0x04000D19, 0x050068C8, 0x04000D1A, 0x050068D0, 0x050068D1, 0x06034688,
+                0x02000035, 0x030001A8, 0x030001A9, 0x04000D48, 0x030001AA, 0x04000D50, 0x04000D51, 0x05006A88,
+                0x030001AB, 0x04000D58, 0x04000D59, 0x05006AC8, 0x04000D5A, 0x05006AD0, 0x05006AD1, 0x06035688,
+                0x030001AC, 0x04000D60, 0x04000D61, 0x05006B08, 0x04000D62, 0x05006B10, 0x05006B11, 0x06035888,
+                0x04000D63, 0x05006B18, 0x05006B19, 0x060358C8, 0x05006B1A, 0x060358D0, 0x060358D1, 0x071AC688,
+                0x01000007, 0x02000038, 0x02000039, 0x030001C8, 0x0200003A, 0x030001D0, 0x030001D1, 0x04000E88,
+                0x0200003B, 0x030001D8, 0x030001D9, 0x04000EC8, 0x030001DA, 0x04000ED0, 0x04000ED1, 0x05007688,
+                0x0200003C, 0x030001E0, 0x030001E1, 0x04000F08, 0x030001E2, 0x04000F10, 0x04000F11, 0x05007888,
+                0x030001E3, 0x04000F18, 0x04000F19, 0x050078C8, 0x04000F1A, 0x050078D0, 0x050078D1, 0x0603C688,
+                0x0200003D, 0x030001E8, 0x030001E9, 0x04000F48, 0x030001EA, 0x04000F50, 0x04000F51, 0x05007A88,
+                0x030001EB, 0x04000F58, 0x04000F59, 0x05007AC8, 0x04000F5A, 0x05007AD0, 0x05007AD1, 0x0603D688,
+                0x030001EC, 0x04000F60, 0x04000F61, 0x05007B08, 0x04000F62, 0x05007B10, 0x05007B11, 0x0603D888,
+                0x04000F63, 0x05007B18, 0x05007B19, 0x0603D8C8, 0x05007B1A, 0x0603D8D0, 0x0603D8D1, 0x071EC688,
+                0x0200003E, 0x030001F0, 0x030001F1, 0x04000F88, 0x030001F2, 0x04000F90, 0x04000F91, 0x05007C88,
+                0x030001F3, 0x04000F98, 0x04000F99, 0x05007CC8, 0x04000F9A, 0x05007CD0, 0x05007CD1, 0x0603E688,
+                0x030001F4, 0x04000FA0, 0x04000FA1, 0x05007D08, 0x04000FA2, 0x05007D10, 0x05007D11, 0x0603E888,
+                0x04000FA3, 0x05007D18, 0x05007D19, 0x0603E8C8, 0x05007D1A, 0x0603E8D0, 0x0603E8D1, 0x071F4688,
+                0x030001F5, 0x04000FA8, 0x04000FA9, 0x05007D48, 0x04000FAA, 0x05007D50, 0x05007D51, 0x0603EA88,
+                0x04000FAB, 0x05007D58, 0x05007D59, 0x0603EAC8, 0x05007D5A, 0x0603EAD0, 0x0603EAD1, 0x071F5688,
+                0x04000FAC, 0x05007D60, 0x05007D61, 0x0603EB08, 0x05007D62, 0x0603EB10, 0x0603EB11, 0x071F5888,
+                0x05007D63, 0x0603EB18, 0x0603EB19, 0x071F58C8, 0x0603EB1A, 0x071F58D0, 0x071F58D1, 0x08FAC688
+            };
+            uint32_t t0 = table[m];
+            n = t0 >> 24;
+            __m256i t1 = _mm256_srlv_epi32(_mm256_set1_epi32(int(t0)), _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21));
+            return _mm256_and_si256(t1, _mm256_set1_epi32(0x7));
+        }
+        // Stores lanes of 'v' selected by bits of 'm' contiguously, starting
+        // at 'p', and returns their count.
+        static UME_FORCE_INLINE uint32_t compressLanes(uint32_t * p, __m256i const & v, int m) {
+            uint32_t n;
+            __m256i t0 = SIMDVec_u<uint32_t, 8>::compressIndices(m, n);
+            __m256i t1 = _mm256_permutevar8x32_epi32(v, t0);
+            _mm256_maskstore_epi32((int *)p, SIMDVecMask<8>::prefix(n).mMask, t1);
+            return n;
+        }
     public:
 
         constexpr static uint32_t length() { return 8; }
@@ -175,7 +317,7 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_u & load(SIMDVecMask<8> const & mask, uint32_t const * p) {
-            __m256i t0 = _mm256_loadu_si256((__m256i*)p);
+            __m256i t0 = _mm256_maskload_epi32((int const *)p, mask.mMask);
             mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
             return *this;
         }
@@ -190,14 +332,32 @@ namespace SIMD {
             mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
             return *this;
         }
+        // LOADN
+        UME_FORCE_INLINE SIMDVec_u & loadn(uint32_t n, uint32_t const * p) {
+            mVec = _mm256_maskload_epi32((int const *)p, SIMDVecMask<8>::prefix(n).mMask);
+            return *this;
+        }
         // STORE
         // MSTORE
+        // STOREN
+        UME_FORCE_INLINE uint32_t* storen(uint32_t n, uint32_t * p) const {
+            _mm256_maskstore_epi32((int *)p, SIMDVecMask<8>::prefix(n).mMask, mVec);
+            return p;
+        }
         // STOREA
-        /*UME_FORCE_INLINE uint32_t * storea(uint32_t * addrAligned) const {
+        UME_FORCE_INLINE uint32_t * storea(uint32_t * addrAligned) const {
             _mm256_store_si256((__m256i*)addrAligned, mVec);
             return addrAligned;
-        }*/
+        }
         // MSTOREA
+        UME_FORCE_INLINE uint32_t * storea(SIMDVecMask<8> const & mask, uint32_t * addrAligned) const {
+            _mm256_maskstore_epi32((int *)addrAligned, mask.mMask, mVec);
+            return addrAligned;
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressstore(SIMDVecMask<8> const & mask, uint32_t * p) const {
+            return compressLanes(p, mVec, _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask)));
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<8> const & mask, SIMDVec_u const &b) const {
             __m256i t0 = _mm256_blendv_epi8(mVec, b.mVec, mask.mMask);
@@ -209,7 +369,29 @@ namespace SIMD {
             return SIMDVec_u(t0);
         }
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_u swizzle(SIMDSwizzle<8> const & sMask) const {
+            __m256i t0 = _mm256_permutevar8x32_epi32(mVec, sMask.mVec);
+            return SIMDVec_u(t0);
+        }
+        template<int i0, int i1, int i2, int i3, int i4, int i5, int i6, int i7>
+        UME_FORCE_INLINE SIMDVec_u swizzle() const {
+            const int imm = (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6);
+            // Patterns repeated in both 128-bit lanes need only an immediate shuffle.
+            if (i0 < 4 && i1 < 4 && i2 < 4 && i3 < 4 && i4 == i0 + 4 && i5 == i1 + 4 &&
+                i6 == i2 + 4 && i7 == i3 + 4) {
+                __m256i t0 = _mm256_shuffle_epi32(mVec, imm);
+                return SIMDVec_u(t0);
+            }
+            __m256i t1 = _mm256_setr_epi32(i0, i1, i2, i3, i4, i5, i6, i7);
+            __m256i t2 = _mm256_permutevar8x32_epi32(mVec, t1);
+            return SIMDVec_u(t2);
+        }
         // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_u & swizzlea(SIMDSwizzle<8> const & sMask) {
+            SIMDVec_u t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
@@ -270,13 +452,53 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVec_u const & b) const {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+            return SIMDVec_u(t1);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVec_u const & b) {
+            mVec = saturatedAdd(mVec, b.mVec);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec = saturatedAdd(mVec, t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_u postinc() {
             __m256i t0 = _mm256_set1_epi32(1);
@@ -368,13 +590,53 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVec_u const & b) const {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+            return SIMDVec_u(t1);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVec_u const & b) {
+            mVec = saturatedSub(mVec, b.mVec);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec = saturatedSub(mVec, t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVec_u const & b) const {
             __m256i t0 = _mm256_sub_epi32(b.mVec, mVec);
@@ -512,27 +774,181 @@ namespace SIMD {
             return *this;
         }
         // DIVV
-
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVec_u const & b) const {
+            __m256i t0 = divideVector(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         UME_FORCE_INLINE SIMDVec_u operator/ (SIMDVec_u const & b) const {
             return div(b);
         }
         // MDIVV
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = divideVector(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // DIVS
-
+        UME_FORCE_INLINE SIMDVec_u div(uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = divideVector(mVec, t0);
+            return SIMDVec_u(t1);
+        }
         UME_FORCE_INLINE SIMDVec_u operator/ (uint32_t b) const {
             return div(b);
         }
         // MDIVS
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = divideVector(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // DIVVA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVec_u const & b) {
+            mVec = divideVector(mVec, b.mVec);
+            return *this;
+        }
         UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDVec_u const & b) {
             return diva(b);
         }
         // MDIVVA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = divideVector(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
         // DIVSA
+        UME_FORCE_INLINE SIMDVec_u & diva(uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec = divideVector(mVec, t0);
+            return *this;
+        }
         UME_FORCE_INLINE SIMDVec_u & operator/= (uint32_t b) {
             return diva(b);
         }
         // MDIVSA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = divideVector(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDDivisor<uint32_t> const & b) const {
+            __m256i t0 = divideMagic(mVec, b);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (SIMDDivisor<uint32_t> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<8> const & mask, SIMDDivisor<uint32_t> const & b) const {
+            __m256i t0 = divideMagic(mVec, b);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDDivisor<uint32_t> const & b) {
+            mVec = divideMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDDivisor<uint32_t> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<8> const & mask, SIMDDivisor<uint32_t> const & b) {
+            __m256i t0 = divideMagic(mVec, b);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // REMV
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVec_u const & b) const {
+            __m256i t0 = remainderVector(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (SIMDVec_u const & b) const {
+            return rem(b);
+        }
+        // MREMV
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = remainderVector(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // REMS
+        UME_FORCE_INLINE SIMDVec_u rem(uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = remainderVector(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (uint32_t b) const {
+            return rem(b);
+        }
+        // MREMS
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = remainderVector(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // REMVA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVec_u const & b) {
+            mVec = remainderVector(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (SIMDVec_u const & b) {
+            return rema(b);
+        }
+        // MREMVA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = remainderVector(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // REMSA
+        UME_FORCE_INLINE SIMDVec_u & rema(uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec = remainderVector(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (uint32_t b) {
+            return rema(b);
+        }
+        // MREMSA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = remainderVector(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // REMD
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDDivisor<uint32_t> const & b) const {
+            __m256i t0 = remainderMagic(mVec, b);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (SIMDDivisor<uint32_t> const & b) const {
+            return rem(b);
+        }
+        // MREMD
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<8> const & mask, SIMDDivisor<uint32_t> const & b) const {
+            __m256i t0 = remainderMagic(mVec, b);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // REMDA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDDivisor<uint32_t> const & b) {
+            mVec = remainderMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (SIMDDivisor<uint32_t> const & b) {
+            return rema(b);
+        }
+        // MREMDA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<8> const & mask, SIMDDivisor<uint32_t> const & b) {
+            __m256i t0 = remainderMagic(mVec, b);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
         // RCP
         // MRCP
         // RCPS
@@ -1368,75 +1784,322 @@ namespace SIMD {
         }
         // SCATTERS
         UME_FORCE_INLINE uint32_t* scatter(uint32_t* baseAddr, uint32_t* indices) const {
-            alignas(32) uint32_t raw[8];
-            _mm256_store_si256((__m256i*) raw, mVec);
-            for (int i = 0; i < 8; i++) { baseAddr[indices[i]] = raw[i]; };
+            scatterLanes(baseAddr, mVec, _mm256_loadu_si256((__m256i*)indices), 0xFF);
             return baseAddr;
         }
         // MSCATTERS
         UME_FORCE_INLINE uint32_t* scatter(SIMDVecMask<8> const & mask, uint32_t* baseAddr, uint32_t* indices) const {
-            alignas(32) uint32_t raw[8];
-            alignas(32) uint32_t rawMask[8];
-            _mm256_store_si256((__m256i*) raw, mVec);
-            _mm256_store_si256((__m256i*) rawMask, mask.mMask);
-            for (int i = 0; i < 8; i++) { if (rawMask[i] == SIMDVecMask<8>::TRUE_VAL()) baseAddr[indices[i]] = raw[i]; };
+            scatterLanes(baseAddr, mVec, _mm256_loadu_si256((__m256i*)indices), _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask)));
             return baseAddr;
         }
         // SCATTERV
         UME_FORCE_INLINE uint32_t* scatter(uint32_t* baseAddr, SIMDVec_u const & indices) const {
-            alignas(32) uint32_t raw[8];
-            alignas(32) uint32_t rawIndices[8];
-            _mm256_store_si256((__m256i*) raw, mVec);
-            _mm256_store_si256((__m256i*) rawIndices, indices.mVec);
-            for (int i = 0; i < 8; i++) { baseAddr[rawIndices[i]] = raw[i]; };
+            scatterLanes(baseAddr, mVec, indices.mVec, 0xFF);
             return baseAddr;
         }
         // MSCATTERV
         UME_FORCE_INLINE uint32_t* scatter(SIMDVecMask<8> const & mask, uint32_t* baseAddr, SIMDVec_u const & indices) const {
-            alignas(32) uint32_t raw[8];
-            alignas(32) uint32_t rawIndices[8];
-            alignas(32) uint32_t rawMask[8];
-            _mm256_store_si256((__m256i*) raw, mVec);
-            _mm256_store_si256((__m256i*) rawIndices, indices.mVec);
-            _mm256_store_si256((__m256i*) rawMask, mask.mMask);
-            for (int i = 0; i < 8; i++) {
-                if (rawMask[i] == SIMDVecMask<8>::TRUE_VAL())
-                    baseAddr[rawIndices[i]] = raw[i];
-            };
+            scatterLanes(baseAddr, mVec, indices.mVec, _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask)));
+            return baseAddr;
+        }
+        // SCATTERADDV
+        UME_FORCE_INLINE uint32_t* scatteradd(uint32_t* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
+            scatterAddLanes(baseAddr, mVec, indices.mVec, 0xFF);
+            return baseAddr;
+        }
+        // MSCATTERADDV
+        UME_FORCE_INLINE uint32_t* scatteradd(SIMDVecMask<8> const & mask, uint32_t* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
+            scatterAddLanes(baseAddr, mVec, indices.mVec, _mm256_movemask_ps(_mm256_castsi256_ps(mask.mMask)));
             return baseAddr;
         }
         // LSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_sllv_epi32(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (SIMDVec_u const & b) const {
+            return lsh(b);
+        }
         // MLSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_sllv_epi32(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // LSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sll_epi32(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (uint32_t b) const {
+            return lsh(b);
+        }
         // MLSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sll_epi32(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // LSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVec_u const & b) {
+            mVec = _mm256_sllv_epi32(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (SIMDVec_u const & b) {
+            return lsha(b);
+        }
         // MLSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_sllv_epi32(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
         // LSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = _mm256_sll_epi32(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (uint32_t b) {
+            return lsha(b);
+        }
         // MLSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sll_epi32(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
         // RSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_srlv_epi32(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (SIMDVec_u const & b) const {
+            return rsh(b);
+        }
         // MRSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_srlv_epi32(mVec, b.mVec);
+            __m256i t1 = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // RSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_srl_epi32(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (uint32_t b) const {
+            return rsh(b);
+        }
         // MRSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_srl_epi32(mVec, t0);
+            __m256i t2 = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // RSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVec_u const & b) {
+            mVec = _mm256_srlv_epi32(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (SIMDVec_u const & b) {
+            return rsha(b);
+        }
         // MRSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_srlv_epi32(mVec, b.mVec);
+            mVec = _mm256_blendv_epi8(mVec, t0, mask.mMask);
+            return *this;
+        }
         // RSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = _mm256_srl_epi32(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (uint32_t b) {
+            return rsha(b);
+        }
         // MRSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_srl_epi32(mVec, t0);
+            mVec = _mm256_blendv_epi8(mVec, t1, mask.mMask);
+            return *this;
+        }
         // ROLV
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec, t2);
+            __m256i t5 = _mm256_srlv_epi32(mVec, t3);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            return SIMDVec_u(t6);
+        }
         // MROLV
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec, t2);
+            __m256i t5 = _mm256_srlv_epi32(mVec, t3);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            __m256i t7 = _mm256_blendv_epi8(mVec, t6, mask.mMask);
+            return SIMDVec_u(t7);
+        }
         // ROLS
+        UME_FORCE_INLINE SIMDVec_u rol(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec, t0);
+            __m256i t3 = _mm256_srl_epi32(mVec, t1);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            return SIMDVec_u(t4);
+        }
         // MROLS
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec, t0);
+            __m256i t3 = _mm256_srl_epi32(mVec, t1);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            __m256i t5 = _mm256_blendv_epi8(mVec, t4, mask.mMask);
+            return SIMDVec_u(t5);
+        }
         // ROLVA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVec_u const & b) {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec, t2);
+            __m256i t5 = _mm256_srlv_epi32(mVec, t3);
+            mVec = _mm256_or_si256(t4, t5);
+            return *this;
+        }
         // MROLVA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec, t2);
+            __m256i t5 = _mm256_srlv_epi32(mVec, t3);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            mVec = _mm256_blendv_epi8(mVec, t6, mask.mMask);
+            return *this;
+        }
         // ROLSA
+        UME_FORCE_INLINE SIMDVec_u & rola(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec, t0);
+            __m256i t3 = _mm256_srl_epi32(mVec, t1);
+            mVec = _mm256_or_si256(t2, t3);
+            return *this;
+        }
         // MROLSA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec, t0);
+            __m256i t3 = _mm256_srl_epi32(mVec, t1);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            mVec = _mm256_blendv_epi8(mVec, t4, mask.mMask);
+            return *this;
+        }
         // RORV
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec, t3);
+            __m256i t5 = _mm256_srlv_epi32(mVec, t2);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            return SIMDVec_u(t6);
+        }
         // MRORV
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec, t3);
+            __m256i t5 = _mm256_srlv_epi32(mVec, t2);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            __m256i t7 = _mm256_blendv_epi8(mVec, t6, mask.mMask);
+            return SIMDVec_u(t7);
+        }
         // RORS
+        UME_FORCE_INLINE SIMDVec_u ror(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec, t1);
+            __m256i t3 = _mm256_srl_epi32(mVec, t0);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            return SIMDVec_u(t4);
+        }
         // MRORS
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec, t1);
+            __m256i t3 = _mm256_srl_epi32(mVec, t0);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            __m256i t5 = _mm256_blendv_epi8(mVec, t4, mask.mMask);
+            return SIMDVec_u(t5);
+        }
         // RORVA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVec_u const & b) {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec, t3);
+            __m256i t5 = _mm256_srlv_epi32(mVec, t2);
+            mVec = _mm256_or_si256(t4, t5);
+            return *this;
+        }
         // MRORVA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_set1_epi32(31);
+            __m256i t1 = _mm256_set1_epi32(32);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi32(t1, t2);
+            __m256i t4 = _mm256_sllv_epi32(mVec, t3);
+            __m256i t5 = _mm256_srlv_epi32(mVec, t2);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            mVec = _mm256_blendv_epi8(mVec, t6, mask.mMask);
+            return *this;
+        }
         // RORSA
+        UME_FORCE_INLINE SIMDVec_u & rora(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec, t1);
+            __m256i t3 = _mm256_srl_epi32(mVec, t0);
+            mVec = _mm256_or_si256(t2, t3);
+            return *this;
+        }
         // MRORSA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m256i t2 = _mm256_sll_epi32(mVec, t1);
+            __m256i t3 = _mm256_srl_epi32(mVec, t0);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            mVec = _mm256_blendv_epi8(mVec, t4, mask.mMask);
+            return *this;
+        }
 
         // PACK
         UME_FORCE_INLINE SIMDVec_u & pack(SIMDVec_u<uint32_t, 4> const & a, SIMDVec_u<uint32_t, 4> const & b) {
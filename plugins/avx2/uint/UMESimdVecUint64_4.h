@@ -54,12 +54,19 @@
 
 #if defined UME_USE_MASK_64B
 #define BLEND(a_256i, b_256i, mask_256i) _mm256_blendv_epi8((a_256i), (b_256i), mask_256i)
-#define MASK_LOAD(a_256i, mask_256i) _mm256_maskload_epi64((a_256i), mask_256i)
-#define MASK_STORE(ptr_u64, mask_256i, a_256i) _mm256_maskstore_epi64((__int64 *)ptr_u64, mask_256i, a_256i);
+#define MASK_LOAD(ptr_u64, mask_256i) _mm256_maskload_epi64((long long const *)(ptr_u64), mask_256i)
+#define MASK_STORE(ptr_u64, mask_256i, a_256i) _mm256_maskstore_epi64((long long *)(ptr_u64), mask_256i, a_256i)
+#define MASK_GATHER(a_256i, ptr_u64, idx_256i, mask_256i) _mm256_mask_i64gather_epi64((a_256i), (long long const *)(ptr_u64), (idx_256i), mask_256i, 8)
+#define MOVEMASK(mask_256i) _mm256_movemask_pd(_mm256_castsi256_pd(mask_256i))
+#define TO_MASK(a_256i) (a_256i)
 #else
 #define BLEND(a_256i, b_256i, mask_128i) _mm256_blendv_epi8((a_256i), (b_256i), (_mm256_cvtepi32_epi64(mask_128i)))
-#define MASK_LOAD(a_256i, mask_128i) _mm256_maskload_epi64((a_256i), (_mm256_cvtepi32_epi64(mask_128i)))
-#define MASK_STORE(ptr_u64, mask_128i, a_256i) _mm256_maskstore_epi64((__int64 *)ptr_u64, (_mm256_cvtepi32_epi64(mask_128i)), a_256i);
+#define MASK_LOAD(ptr_u64, mask_128i) _mm256_maskload_epi64((long long const *)(ptr_u64), (_mm256_cvtepi32_epi64(mask_128i)))
+#define MASK_STORE(ptr_u64, mask_128i, a_256i) _mm256_maskstore_epi64((long long *)(ptr_u64), (_mm256_cvtepi32_epi64(mask_128i)), a_256i)
+#define MASK_GATHER(a_256i, ptr_u64, idx_256i, mask_128i) _mm256_mask_i64gather_epi64((a_256i), (long long const *)(ptr_u64), (idx_256i), (_mm256_cvtepi32_epi64(mask_128i)), 8)
+#define MOVEMASK(mask_128i) _mm_movemask_ps(_mm_castsi128_ps(mask_128i))
+// Packs 64b lane masks into the 32b lane layout of SIMDVecMask<4>.
+#define TO_MASK(a_256i) _mm256_castsi256_si128(_mm256_permutevar8x32_epi32((a_256i), _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7)))
 #endif
 
 namespace UME {
@@ -89,6 +96,53 @@ namespace SIMD {
         UME_FORCE_INLINE explicit SIMDVec_u(__m256i & x) { mVec = x; }
         UME_FORCE_INLINE explicit SIMDVec_u(const __m256i & x) { mVec = x; }
 
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m256i saturatedAdd(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_add_epi64(a, b);
+            __m256i t1 = _mm256_slli_epi64(_mm256_cmpeq_epi64(a, a), 63);
+            __m256i t2 = _mm256_cmpgt_epi64(_mm256_xor_si256(a, t1), _mm256_xor_si256(t0, t1));
+            return _mm256_or_si256(t0, t2);
+        }
+        static UME_FORCE_INLINE __m256i saturatedSub(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_sub_epi64(a, b);
+            __m256i t1 = _mm256_slli_epi64(_mm256_cmpeq_epi64(a, a), 63);
+            __m256i t2 = _mm256_cmpgt_epi64(_mm256_xor_si256(b, t1), _mm256_xor_si256(a, t1));
+            return _mm256_andnot_si256(t2, t0);
+        }
+        // Lane-wise kernels shared by the arithmetic, comparison and
+        // reduction operations. AVX2 has no unsigned 64b comparison, so
+        // operands are compared as signed values with their sign bits flipped.
+        static UME_FORCE_INLINE __m256i cmpgtLanes(__m256i const & a, __m256i const & b) {
+            __m256i t0 = SET1_EPI64(0x8000000000000000);
+            return _mm256_cmpgt_epi64(_mm256_xor_si256(a, t0), _mm256_xor_si256(b, t0));
+        }
+        static UME_FORCE_INLINE __m256i maxLanes(__m256i const & a, __m256i const & b) {
+            return _mm256_blendv_epi8(b, a, cmpgtLanes(a, b));
+        }
+        static UME_FORCE_INLINE __m256i minLanes(__m256i const & a, __m256i const & b) {
+            return _mm256_blendv_epi8(a, b, cmpgtLanes(a, b));
+        }
+        // Low 64 bits of the product, built from 32b x 32b partial products.
+        static UME_FORCE_INLINE __m256i mulLanes(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_mul_epu32(a, b);
+            __m256i t1 = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b);
+            __m256i t2 = _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32));
+            __m256i t3 = _mm256_slli_epi64(_mm256_add_epi64(t1, t2), 32);
+            return _mm256_add_epi64(t0, t3);
+        }
+        // AVX2 has no scatter instruction, so lanes selected by bits of 'm'
+        // are stored one by one.
+        static UME_FORCE_INLINE void scatterLanes(uint64_t * baseAddr, __m256i const & v, __m256i const & indices, int m) {
+            __m128i v0 = _mm256_castsi256_si128(v);
+            __m128i v1 = _mm256_extracti128_si256(v, 1);
+            __m128i t0 = _mm256_castsi256_si128(indices);
+            __m128i t1 = _mm256_extracti128_si256(indices, 1);
+            if (m & 0x1) baseAddr[_mm_cvtsi128_si64(t0)] = uint64_t(_mm_cvtsi128_si64(v0));
+            if (m & 0x2) baseAddr[_mm_extract_epi64(t0, 1)] = uint64_t(_mm_extract_epi64(v0, 1));
+            if (m & 0x4) baseAddr[_mm_cvtsi128_si64(t1)] = uint64_t(_mm_cvtsi128_si64(v1));
+            if (m & 0x8) baseAddr[_mm_extract_epi64(t1, 1)] = uint64_t(_mm_extract_epi64(v1, 1));
+        }
+
     public:
         constexpr static uint32_t length() { return 4; }
         constexpr static uint32_t alignment() { return 32; }
@@ -189,13 +243,8 @@ namespace SIMD {
         }
         // MLOAD
         UME_FORCE_INLINE SIMDVec_u & load(SIMDVecMask<4> const & mask, uint64_t const *p) {
-#if defined __GNUG__
-            // G++ (so far 5.3) does not provide '_mm256_maskload_epi64' intrinsic
-            __m256i t0 = _mm256_loadu_si256((const __m256i *) p);
+            __m256i t0 = MASK_LOAD(p, mask.mMask);
             mVec = BLEND(mVec, t0, mask.mMask);
-#else
-            mVec = MASK_LOAD((__int64 const*)p, mask.mMask);
-#endif
             return *this;
         }
         // LOADA
@@ -210,10 +259,18 @@ namespace SIMD {
             __m256i t0 = _mm256_load_si256((const __m256i *) p);
             mVec = BLEND(mVec, t0, mask.mMask);
 #else
-            mVec = MASK_LOAD((__int64 const*)p, mask.mMask);
+            __m256i t0 = MASK_LOAD(p, mask.mMask);
+            mVec = BLEND(mVec, t0, mask.mMask);
 #endif
             return *this;
         }
+        // LOADN
+        UME_FORCE_INLINE SIMDVec_u & loadn(uint32_t n, uint64_t const * p) {
+            __m256i t0 = _mm256_setr_epi64x(0, 1, 2, 3);
+            __m256i t1 = _mm256_cmpgt_epi64(SET1_EPI64(n < 4 ? n : 4), t0);
+            mVec = _mm256_maskload_epi64((long long const *)p, t1);
+            return *this;
+        }
         // STORE
         UME_FORCE_INLINE uint64_t* store(uint64_t* p) const {
             _mm256_storeu_si256((__m256i *)p, mVec);
@@ -221,14 +278,14 @@ namespace SIMD {
         }
         // MSTORE
         UME_FORCE_INLINE uint64_t* store(SIMDVecMask<4> const & mask, uint64_t* p) const {
-#if defined __GNUG__
-            // G++ (so far 5.3) does not provide '_mm256_maskstore_epi64' intrinsic
-            __m256i t0 = _mm256_loadu_si256((const __m256i *) p);
-            __m256i t1 = BLEND(t0, mVec, mask.mMask);
-            _mm256_storeu_si256((__m256i *)p, t1);
-#else
             MASK_STORE(p, mask.mMask, mVec);
-#endif
+            return p;
+        }
+        // STOREN
+        UME_FORCE_INLINE uint64_t* storen(uint32_t n, uint64_t * p) const {
+            __m256i t0 = _mm256_setr_epi64x(0, 1, 2, 3);
+            __m256i t1 = _mm256_cmpgt_epi64(SET1_EPI64(n < 4 ? n : 4), t0);
+            _mm256_maskstore_epi64((long long *)p, t1, mVec);
             return p;
         }
         // STOREA
@@ -261,67 +318,414 @@ namespace SIMD {
             return SIMDVec_u(t1);
         }
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_u swizzle(SIMDSwizzle<4> const & sMask) const {
+            // Expand each 64-bit lane index i into the 32-bit index pair (2i, 2i+1).
+            __m256i t0 = _mm256_cvtepu32_epi64(sMask.mVec);
+            __m256i t1 = _mm256_slli_epi64(t0, 1);
+            __m256i t2 = _mm256_or_si256(t1, _mm256_slli_epi64(t1, 32));
+            __m256i t3 = _mm256_add_epi32(t2, _mm256_setr_epi32(0, 1, 0, 1, 0, 1, 0, 1));
+            __m256i t4 = _mm256_permutevar8x32_epi32(mVec, t3);
+            return SIMDVec_u(t4);
+        }
+        template<int i0, int i1, int i2, int i3>
+        UME_FORCE_INLINE SIMDVec_u swizzle() const {
+            __m256i t0 = _mm256_permute4x64_epi64(mVec, (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6));
+            return SIMDVec_u(t0);
+        }
         // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_u & swizzlea(SIMDSwizzle<4> const & sMask) {
+            SIMDVec_u t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
 
         // SORTA
         // SORTD
 
         // ADDV
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_add_epi64(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator+ (SIMDVec_u const & b) const {
+            return add(b);
+        }
         // MADDV
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_add_epi64(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // ADDS
+        UME_FORCE_INLINE SIMDVec_u add(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_add_epi64(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator+ (uint64_t b) const {
+            return add(b);
+        }
         // MADDS
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_add_epi64(mVec, t0);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // ADDVA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVec_u const & b) {
+            mVec = _mm256_add_epi64(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator+= (SIMDVec_u const & b) {
+            return adda(b);
+        }
         // MADDVA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_add_epi64(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // ADDSA
+        UME_FORCE_INLINE SIMDVec_u & adda(uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec = _mm256_add_epi64(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator+= (uint64_t b) {
+            return adda(b);
+        }
         // MADDSA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_add_epi64(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVec_u const & b) const {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+            return SIMDVec_u(t1);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVec_u const & b) {
+            mVec = saturatedAdd(mVec, b.mVec);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec = saturatedAdd(mVec, t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // POSTINC
+        UME_FORCE_INLINE SIMDVec_u postinc() {
+            __m256i t0 = mVec;
+            mVec = _mm256_add_epi64(mVec, SET1_EPI64(1));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator++ (int) {
+            return postinc();
+        }
         // MPOSTINC
+        UME_FORCE_INLINE SIMDVec_u postinc(SIMDVecMask<4> const & mask) {
+            __m256i t0 = mVec;
+            __m256i t1 = _mm256_add_epi64(mVec, SET1_EPI64(1));
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t0);
+        }
         // PREFINC
+        UME_FORCE_INLINE SIMDVec_u & prefinc() {
+            mVec = _mm256_add_epi64(mVec, SET1_EPI64(1));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator++ () {
+            return prefinc();
+        }
         // MPREFINC
+        UME_FORCE_INLINE SIMDVec_u & prefinc(SIMDVecMask<4> const & mask) {
+            __m256i t0 = _mm256_add_epi64(mVec, SET1_EPI64(1));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // SUBV
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_sub_epi64(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator- (SIMDVec_u const & b) const {
+            return sub(b);
+        }
         // MSUBV
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_sub_epi64(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // SUBS
+        UME_FORCE_INLINE SIMDVec_u sub(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_sub_epi64(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator- (uint64_t b) const {
+            return sub(b);
+        }
         // MSUBS
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_sub_epi64(mVec, t0);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // SUBVA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVec_u const & b) {
+            mVec = _mm256_sub_epi64(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-= (SIMDVec_u const & b) {
+            return suba(b);
+        }
         // MSUBVA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_sub_epi64(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // SUBSA
+        UME_FORCE_INLINE SIMDVec_u & suba(uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec = _mm256_sub_epi64(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-= (uint64_t b) {
+            return suba(b);
+        }
         // MSUBSA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_sub_epi64(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVec_u const & b) const {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+            return SIMDVec_u(t1);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVec_u const & b) {
+            mVec = saturatedSub(mVec, b.mVec);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec = saturatedSub(mVec, t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_sub_epi64(b.mVec, mVec);
+            return SIMDVec_u(t0);
+        }
         // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_sub_epi64(b.mVec, mVec);
+            __m256i t1 = BLEND(b.mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_u subfrom(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_sub_epi64(t0, mVec);
+            return SIMDVec_u(t1);
+        }
         // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_sub_epi64(t0, mVec);
+            __m256i t2 = BLEND(t0, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(SIMDVec_u const & b) {
+            mVec = _mm256_sub_epi64(b.mVec, mVec);
+            return *this;
+        }
         // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_sub_epi64(b.mVec, mVec);
+            mVec = BLEND(b.mVec, t0, mask.mMask);
+            return *this;
+        }
         // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec = _mm256_sub_epi64(t0, mVec);
+            return *this;
+        }
         // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_sub_epi64(t0, mVec);
+            mVec = BLEND(t0, t1, mask.mMask);
+            return *this;
+        }
         // POSTDEC
+        UME_FORCE_INLINE SIMDVec_u postdec() {
+            __m256i t0 = mVec;
+            mVec = _mm256_sub_epi64(mVec, SET1_EPI64(1));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator-- (int) {
+            return postdec();
+        }
         // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_u postdec(SIMDVecMask<4> const & mask) {
+            __m256i t0 = mVec;
+            __m256i t1 = _mm256_sub_epi64(mVec, SET1_EPI64(1));
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t0);
+        }
         // PREFDEC
+        UME_FORCE_INLINE SIMDVec_u & prefdec() {
+            mVec = _mm256_sub_epi64(mVec, SET1_EPI64(1));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-- () {
+            return prefdec();
+        }
         // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_u & prefdec(SIMDVecMask<4> const & mask) {
+            __m256i t0 = _mm256_sub_epi64(mVec, SET1_EPI64(1));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // MULV
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVec_u const & b) const {
+            __m256i t0 = mulLanes(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator* (SIMDVec_u const & b) const {
+            return mul(b);
+        }
         // MMULV
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = mulLanes(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // MULS
+        UME_FORCE_INLINE SIMDVec_u mul(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = mulLanes(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator* (uint64_t b) const {
+            return mul(b);
+        }
         // MMULS
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = mulLanes(mVec, t0);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // MULVA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVec_u const & b) {
+            mVec = mulLanes(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator*= (SIMDVec_u const & b) {
+            return mula(b);
+        }
         // MMULVA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = mulLanes(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // MULSA
+        UME_FORCE_INLINE SIMDVec_u & mula(uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec = mulLanes(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator*= (uint64_t b) {
+            return mula(b);
+        }
         // MMULSA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = mulLanes(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // DIVV
         // MDIVV
         // DIVS
@@ -339,157 +743,1057 @@ namespace SIMD {
         // RCPSA
         // MRCPSA
         // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpeq(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_cmpeq_epi64(mVec, b.mVec);
+            return SIMDVecMask<4>(TO_MASK(t0));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator== (SIMDVec_u const & b) const {
+            return cmpeq(b);
+        }
         // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<4> cmpeq(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_cmpeq_epi64(mVec, t0);
+            return SIMDVecMask<4>(TO_MASK(t1));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator== (uint64_t b) const {
+            return cmpeq(b);
+        }
         // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpne(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_xor_si256(_mm256_cmpeq_epi64(mVec, b.mVec), _mm256_set1_epi32(-1));
+            return SIMDVecMask<4>(TO_MASK(t0));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator!= (SIMDVec_u const & b) const {
+            return cmpne(b);
+        }
         // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<4> cmpne(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_xor_si256(_mm256_cmpeq_epi64(mVec, t0), _mm256_set1_epi32(-1));
+            return SIMDVecMask<4>(TO_MASK(t1));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator!= (uint64_t b) const {
+            return cmpne(b);
+        }
         // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpgt(SIMDVec_u const & b) const {
+            __m256i t0 = cmpgtLanes(mVec, b.mVec);
+            return SIMDVecMask<4>(TO_MASK(t0));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator> (SIMDVec_u const & b) const {
+            return cmpgt(b);
+        }
         // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<4> cmpgt(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = cmpgtLanes(mVec, t0);
+            return SIMDVecMask<4>(TO_MASK(t1));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator> (uint64_t b) const {
+            return cmpgt(b);
+        }
         // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<4> cmplt(SIMDVec_u const & b) const {
+            __m256i t0 = cmpgtLanes(b.mVec, mVec);
+            return SIMDVecMask<4>(TO_MASK(t0));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator< (SIMDVec_u const & b) const {
+            return cmplt(b);
+        }
         // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<4> cmplt(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = cmpgtLanes(t0, mVec);
+            return SIMDVecMask<4>(TO_MASK(t1));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator< (uint64_t b) const {
+            return cmplt(b);
+        }
         // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpge(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_xor_si256(cmpgtLanes(b.mVec, mVec), _mm256_set1_epi32(-1));
+            return SIMDVecMask<4>(TO_MASK(t0));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator>= (SIMDVec_u const & b) const {
+            return cmpge(b);
+        }
         // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<4> cmpge(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_xor_si256(cmpgtLanes(t0, mVec), _mm256_set1_epi32(-1));
+            return SIMDVecMask<4>(TO_MASK(t1));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator>= (uint64_t b) const {
+            return cmpge(b);
+        }
         // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmple(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_xor_si256(cmpgtLanes(mVec, b.mVec), _mm256_set1_epi32(-1));
+            return SIMDVecMask<4>(TO_MASK(t0));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator<= (SIMDVec_u const & b) const {
+            return cmple(b);
+        }
         // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<4> cmple(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_xor_si256(cmpgtLanes(mVec, t0), _mm256_set1_epi32(-1));
+            return SIMDVecMask<4>(TO_MASK(t1));
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator<= (uint64_t b) const {
+            return cmple(b);
+        }
         // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_cmpeq_epi64(mVec, b.mVec);
+            return _mm256_movemask_epi8(t0) == -1;
+        }
         // CMPES
+        UME_FORCE_INLINE bool cmpe(uint64_t b) const {
+            __m256i t0 = _mm256_cmpeq_epi64(mVec, SET1_EPI64(b));
+            return _mm256_movemask_epi8(t0) == -1;
+        }
         // UNIQUE
+        UME_FORCE_INLINE bool unique() const {
+            // Comparing with lanes rotated by one and by two covers every pair of lanes.
+            __m256i t0 = _mm256_cmpeq_epi64(mVec, _mm256_permute4x64_epi64(mVec, 0x39));
+            __m256i t1 = _mm256_cmpeq_epi64(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t2 = _mm256_or_si256(t0, t1);
+            return _mm256_testz_si256(t2, t2) != 0;
+        }
         // HADD
+        UME_FORCE_INLINE uint64_t hadd() const {
+            __m256i t0 = _mm256_add_epi64(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = _mm256_add_epi64(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval;
+        }
         // MHADD
+        UME_FORCE_INLINE uint64_t hadd(SIMDVecMask<4> const & mask) const {
+            __m256i t0 = BLEND(_mm256_setzero_si256(), mVec, mask.mMask);
+            __m256i t1 = _mm256_add_epi64(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = _mm256_add_epi64(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval;
+        }
         // HADDS
+        UME_FORCE_INLINE uint64_t hadd(uint64_t b) const {
+            __m256i t0 = _mm256_add_epi64(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = _mm256_add_epi64(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval + b;
+        }
         // MHADDS
+        UME_FORCE_INLINE uint64_t hadd(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = BLEND(_mm256_setzero_si256(), mVec, mask.mMask);
+            __m256i t1 = _mm256_add_epi64(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = _mm256_add_epi64(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval + b;
+        }
         // HMUL
+        UME_FORCE_INLINE uint64_t hmul() const {
+            __m256i t0 = mulLanes(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = mulLanes(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval;
+        }
         // MHMUL
+        UME_FORCE_INLINE uint64_t hmul(SIMDVecMask<4> const & mask) const {
+            __m256i t0 = BLEND(SET1_EPI64(1), mVec, mask.mMask);
+            __m256i t1 = mulLanes(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = mulLanes(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval;
+        }
         // HMULS
+        UME_FORCE_INLINE uint64_t hmul(uint64_t b) const {
+            __m256i t0 = mulLanes(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = mulLanes(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval * b;
+        }
         // MHMULS
+        UME_FORCE_INLINE uint64_t hmul(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = BLEND(SET1_EPI64(1), mVec, mask.mMask);
+            __m256i t1 = mulLanes(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = mulLanes(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval * b;
+        }
 
         // FMULADDV
+        UME_FORCE_INLINE SIMDVec_u fmuladd(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m256i t0 = mulLanes(mVec, b.mVec);
+            __m256i t1 = _mm256_add_epi64(t0, c.mVec);
+            return SIMDVec_u(t1);
+        }
         // MFMULADDV
+        UME_FORCE_INLINE SIMDVec_u fmuladd(SIMDVecMask<4> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m256i t0 = mulLanes(mVec, b.mVec);
+            __m256i t1 = _mm256_add_epi64(t0, c.mVec);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // FMULSUBV
+        UME_FORCE_INLINE SIMDVec_u fmulsub(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m256i t0 = mulLanes(mVec, b.mVec);
+            __m256i t1 = _mm256_sub_epi64(t0, c.mVec);
+            return SIMDVec_u(t1);
+        }
         // MFMULSUBV
+        UME_FORCE_INLINE SIMDVec_u fmulsub(SIMDVecMask<4> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m256i t0 = mulLanes(mVec, b.mVec);
+            __m256i t1 = _mm256_sub_epi64(t0, c.mVec);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // FADDMULV
+        UME_FORCE_INLINE SIMDVec_u faddmul(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m256i t0 = _mm256_add_epi64(mVec, b.mVec);
+            __m256i t1 = mulLanes(t0, c.mVec);
+            return SIMDVec_u(t1);
+        }
         // MFADDMULV
+        UME_FORCE_INLINE SIMDVec_u faddmul(SIMDVecMask<4> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m256i t0 = _mm256_add_epi64(mVec, b.mVec);
+            __m256i t1 = mulLanes(t0, c.mVec);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // FSUBMULV
+        UME_FORCE_INLINE SIMDVec_u fsubmul(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m256i t0 = _mm256_sub_epi64(mVec, b.mVec);
+            __m256i t1 = mulLanes(t0, c.mVec);
+            return SIMDVec_u(t1);
+        }
         // MFSUBMULV
+        UME_FORCE_INLINE SIMDVec_u fsubmul(SIMDVecMask<4> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m256i t0 = _mm256_sub_epi64(mVec, b.mVec);
+            __m256i t1 = mulLanes(t0, c.mVec);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
 
         // MAXV
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVec_u const & b) const {
+            __m256i t0 = maxLanes(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // MMAXV
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = maxLanes(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // MAXS
+        UME_FORCE_INLINE SIMDVec_u max(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = maxLanes(mVec, t0);
+            return SIMDVec_u(t1);
+        }
         // MMAXS
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = maxLanes(mVec, t0);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // MAXVA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVec_u const & b) {
+            mVec = maxLanes(mVec, b.mVec);
+            return *this;
+        }
         // MMAXVA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = maxLanes(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // MAXSA
+        UME_FORCE_INLINE SIMDVec_u & maxa(uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec = maxLanes(mVec, t0);
+            return *this;
+        }
         // MMAXSA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = maxLanes(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // MINV
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVec_u const & b) const {
+            __m256i t0 = minLanes(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // MMINV
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = minLanes(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // MINS
+        UME_FORCE_INLINE SIMDVec_u min(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = minLanes(mVec, t0);
+            return SIMDVec_u(t1);
+        }
         // MMINS
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = minLanes(mVec, t0);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // MINVA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVec_u const & b) {
+            mVec = minLanes(mVec, b.mVec);
+            return *this;
+        }
         // MMINVA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = minLanes(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // MINSA
+        UME_FORCE_INLINE SIMDVec_u & mina(uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec = minLanes(mVec, t0);
+            return *this;
+        }
         // MMINSA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = minLanes(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // HMAX
+        UME_FORCE_INLINE uint64_t hmax() const {
+            __m256i t0 = maxLanes(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = maxLanes(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval;
+        }
         // MHMAX
+        UME_FORCE_INLINE uint64_t hmax(SIMDVecMask<4> const & mask) const {
+            __m256i t0 = BLEND(_mm256_setzero_si256(), mVec, mask.mMask);
+            __m256i t1 = maxLanes(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = maxLanes(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval;
+        }
         // IMAX
         // MIMAX
         // HMIN
+        UME_FORCE_INLINE uint64_t hmin() const {
+            __m256i t0 = minLanes(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = minLanes(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval;
+        }
         // MHMIN
+        UME_FORCE_INLINE uint64_t hmin(SIMDVecMask<4> const & mask) const {
+            __m256i t0 = BLEND(_mm256_set1_epi32(-1), mVec, mask.mMask);
+            __m256i t1 = minLanes(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = minLanes(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval;
+        }
         // IMIN
         // MIMIN
 
         // BANDV
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_and_si256(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator& (SIMDVec_u const & b) const {
+            return band(b);
+        }
         // MBANDV
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_and_si256(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // BANDS
+        UME_FORCE_INLINE SIMDVec_u band(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_and_si256(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator& (uint64_t b) const {
+            return band(b);
+        }
         // MBANDS
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_and_si256(mVec, t0);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // BANDVA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVec_u const & b) {
+            mVec = _mm256_and_si256(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (SIMDVec_u const & b) {
+            return banda(b);
+        }
         // MBANDVA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_and_si256(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // BANDSA
+        UME_FORCE_INLINE SIMDVec_u & banda(uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec = _mm256_and_si256(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (uint64_t b) {
+            return banda(b);
+        }
         // MBANDSA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_and_si256(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // BORV
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_or_si256(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator| (SIMDVec_u const & b) const {
+            return bor(b);
+        }
         // MBORV
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_or_si256(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // BORS
+        UME_FORCE_INLINE SIMDVec_u bor(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_or_si256(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator| (uint64_t b) const {
+            return bor(b);
+        }
         // MBORS
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_or_si256(mVec, t0);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // BORVA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVec_u const & b) {
+            mVec = _mm256_or_si256(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (SIMDVec_u const & b) {
+            return bora(b);
+        }
         // MBORVA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_or_si256(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // BORSA
+        UME_FORCE_INLINE SIMDVec_u & bora(uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec = _mm256_or_si256(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (uint64_t b) {
+            return bora(b);
+        }
         // MBORSA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_or_si256(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // BXORV
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_xor_si256(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator^ (SIMDVec_u const & b) const {
+            return bxor(b);
+        }
         // MBXORV
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_xor_si256(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // BXORS
+        UME_FORCE_INLINE SIMDVec_u bxor(uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_xor_si256(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator^ (uint64_t b) const {
+            return bxor(b);
+        }
         // MBXORS
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_xor_si256(mVec, t0);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // BXORVA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVec_u const & b) {
+            mVec = _mm256_xor_si256(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator^= (SIMDVec_u const & b) {
+            return bxora(b);
+        }
         // MBXORVA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_xor_si256(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // BXORSA
+        UME_FORCE_INLINE SIMDVec_u & bxora(uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            mVec = _mm256_xor_si256(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator^= (uint64_t b) {
+            return bxora(b);
+        }
         // MBXORSA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m256i t0 = SET1_EPI64(b);
+            __m256i t1 = _mm256_xor_si256(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // BNOT
+        UME_FORCE_INLINE SIMDVec_u bnot() const {
+            __m256i t0 = _mm256_xor_si256(mVec, _mm256_set1_epi32(-1));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator~ () const {
+            return bnot();
+        }
         // MBNOT
+        UME_FORCE_INLINE SIMDVec_u bnot(SIMDVecMask<4> const & mask) const {
+            __m256i t0 = _mm256_xor_si256(mVec, _mm256_set1_epi32(-1));
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // BNOTA
+        UME_FORCE_INLINE SIMDVec_u & bnota() {
+            mVec = _mm256_xor_si256(mVec, _mm256_set1_epi32(-1));
+            return *this;
+        }
         // MBNOTA
+        UME_FORCE_INLINE SIMDVec_u & bnota(SIMDVecMask<4> const & mask) {
+            __m256i t0 = _mm256_xor_si256(mVec, _mm256_set1_epi32(-1));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // HBAND
+        UME_FORCE_INLINE uint64_t hband() const {
+            __m256i t0 = _mm256_and_si256(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = _mm256_and_si256(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval;
+        }
         // MHBAND
+        UME_FORCE_INLINE uint64_t hband(SIMDVecMask<4> const & mask) const {
+            __m256i t0 = BLEND(_mm256_set1_epi32(-1), mVec, mask.mMask);
+            __m256i t1 = _mm256_and_si256(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = _mm256_and_si256(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval;
+        }
         // HBANDS
+        UME_FORCE_INLINE uint64_t hband(uint64_t b) const {
+            __m256i t0 = _mm256_and_si256(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = _mm256_and_si256(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval & b;
+        }
         // MHBANDS
+        UME_FORCE_INLINE uint64_t hband(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = BLEND(_mm256_set1_epi32(-1), mVec, mask.mMask);
+            __m256i t1 = _mm256_and_si256(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = _mm256_and_si256(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval & b;
+        }
         // HBOR
+        UME_FORCE_INLINE uint64_t hbor() const {
+            __m256i t0 = _mm256_or_si256(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = _mm256_or_si256(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval;
+        }
         // MHBOR
+        UME_FORCE_INLINE uint64_t hbor(SIMDVecMask<4> const & mask) const {
+            __m256i t0 = BLEND(_mm256_setzero_si256(), mVec, mask.mMask);
+            __m256i t1 = _mm256_or_si256(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = _mm256_or_si256(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval;
+        }
         // HBORS
+        UME_FORCE_INLINE uint64_t hbor(uint64_t b) const {
+            __m256i t0 = _mm256_or_si256(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = _mm256_or_si256(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval | b;
+        }
         // MHBORS
+        UME_FORCE_INLINE uint64_t hbor(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = BLEND(_mm256_setzero_si256(), mVec, mask.mMask);
+            __m256i t1 = _mm256_or_si256(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = _mm256_or_si256(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval | b;
+        }
         // HBXOR
+        UME_FORCE_INLINE uint64_t hbxor() const {
+            __m256i t0 = _mm256_xor_si256(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = _mm256_xor_si256(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval;
+        }
         // MHBXOR
+        UME_FORCE_INLINE uint64_t hbxor(SIMDVecMask<4> const & mask) const {
+            __m256i t0 = BLEND(_mm256_setzero_si256(), mVec, mask.mMask);
+            __m256i t1 = _mm256_xor_si256(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = _mm256_xor_si256(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval;
+        }
         // HBXORS
+        UME_FORCE_INLINE uint64_t hbxor(uint64_t b) const {
+            __m256i t0 = _mm256_xor_si256(mVec, _mm256_permute4x64_epi64(mVec, 0x4E));
+            __m256i t1 = _mm256_xor_si256(t0, _mm256_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t1)));
+            return retval ^ b;
+        }
         // MHBXORS
+        UME_FORCE_INLINE uint64_t hbxor(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = BLEND(_mm256_setzero_si256(), mVec, mask.mMask);
+            __m256i t1 = _mm256_xor_si256(t0, _mm256_permute4x64_epi64(t0, 0x4E));
+            __m256i t2 = _mm256_xor_si256(t1, _mm256_shuffle_epi32(t1, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64(_mm256_castsi256_si128(t2)));
+            return retval ^ b;
+        }
 
         // GATHERU
+        UME_FORCE_INLINE SIMDVec_u & gatheru(uint64_t const * baseAddr, uint32_t stride) {
+            __m256i t0 = _mm256_mul_epu32(_mm256_setr_epi64x(0, 1, 2, 3), SET1_EPI64(stride));
+            mVec = _mm256_i64gather_epi64((long long const *)baseAddr, t0, 8);
+            return *this;
+        }
         // MGATHERU
+        UME_FORCE_INLINE SIMDVec_u & gatheru(SIMDVecMask<4> const & mask, uint64_t const * baseAddr, uint32_t stride) {
+            __m256i t0 = _mm256_mul_epu32(_mm256_setr_epi64x(0, 1, 2, 3), SET1_EPI64(stride));
+            mVec = MASK_GATHER(mVec, baseAddr, t0, mask.mMask);
+            return *this;
+        }
         // GATHERS
+        UME_FORCE_INLINE SIMDVec_u & gather(uint64_t const * baseAddr, uint64_t const * indices) {
+            __m256i t0 = _mm256_loadu_si256((__m256i const *)indices);
+            mVec = _mm256_i64gather_epi64((long long const *)baseAddr, t0, 8);
+            return *this;
+        }
         // MGATHERS
+        UME_FORCE_INLINE SIMDVec_u & gather(SIMDVecMask<4> const & mask, uint64_t const * baseAddr, uint64_t const * indices) {
+            __m256i t0 = MASK_LOAD(indices, mask.mMask);
+            mVec = MASK_GATHER(mVec, baseAddr, t0, mask.mMask);
+            return *this;
+        }
         // GATHERV
+        UME_FORCE_INLINE SIMDVec_u & gather(uint64_t const * baseAddr, SIMDVec_u const & indices) {
+            mVec = _mm256_i64gather_epi64((long long const *)baseAddr, indices.mVec, 8);
+            return *this;
+        }
         // MGATHERV
+        UME_FORCE_INLINE SIMDVec_u & gather(SIMDVecMask<4> const & mask, uint64_t const * baseAddr, SIMDVec_u const & indices) {
+            mVec = MASK_GATHER(mVec, baseAddr, indices.mVec, mask.mMask);
+            return *this;
+        }
         // SCATTERU
+        UME_FORCE_INLINE uint64_t* scatteru(uint64_t* baseAddr, uint32_t stride) const {
+            __m256i t0 = _mm256_mul_epu32(_mm256_setr_epi64x(0, 1, 2, 3), SET1_EPI64(stride));
+            scatterLanes(baseAddr, mVec, t0, 0xF);
+            return baseAddr;
+        }
         // MSCATTERU
+        UME_FORCE_INLINE uint64_t* scatteru(SIMDVecMask<4> const & mask, uint64_t* baseAddr, uint32_t stride) const {
+            __m256i t0 = _mm256_mul_epu32(_mm256_setr_epi64x(0, 1, 2, 3), SET1_EPI64(stride));
+            scatterLanes(baseAddr, mVec, t0, MOVEMASK(mask.mMask));
+            return baseAddr;
+        }
         // SCATTERS
+        UME_FORCE_INLINE uint64_t* scatter(uint64_t* baseAddr, uint64_t* indices) const {
+            scatterLanes(baseAddr, mVec, _mm256_loadu_si256((__m256i*)indices), 0xF);
+            return baseAddr;
+        }
         // MSCATTERS
+        UME_FORCE_INLINE uint64_t* scatter(SIMDVecMask<4> const & mask, uint64_t* baseAddr, uint64_t* indices) const {
+            __m256i t0 = MASK_LOAD(indices, mask.mMask);
+            scatterLanes(baseAddr, mVec, t0, MOVEMASK(mask.mMask));
+            return baseAddr;
+        }
         // SCATTERV
+        UME_FORCE_INLINE uint64_t* scatter(uint64_t* baseAddr, SIMDVec_u const & indices) const {
+            scatterLanes(baseAddr, mVec, indices.mVec, 0xF);
+            return baseAddr;
+        }
         // MSCATTERV
+        UME_FORCE_INLINE uint64_t* scatter(SIMDVecMask<4> const & mask, uint64_t* baseAddr, SIMDVec_u const & indices) const {
+            scatterLanes(baseAddr, mVec, indices.mVec, MOVEMASK(mask.mMask));
+            return baseAddr;
+        }
 
         // LSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_sllv_epi64(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (SIMDVec_u const & b) const {
+            return lsh(b);
+        }
         // MLSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_sllv_epi64(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // LSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sll_epi64(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (uint64_t b) const {
+            return lsh(b);
+        }
         // MLSHS
-
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sll_epi64(mVec, t0);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // LSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVec_u const & b) {
+            mVec = _mm256_sllv_epi64(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (SIMDVec_u const & b) {
+            return lsha(b);
+        }
         // MLSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_sllv_epi64(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // LSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = _mm256_sll_epi64(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (uint64_t b) {
+            return lsha(b);
+        }
         // MLSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_sll_epi64(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // RSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_srlv_epi64(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (SIMDVec_u const & b) const {
+            return rsh(b);
+        }
         // MRSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = _mm256_srlv_epi64(mVec, b.mVec);
+            __m256i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
         // RSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_srl_epi64(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (uint64_t b) const {
+            return rsh(b);
+        }
         // MRSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_srl_epi64(mVec, t0);
+            __m256i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
         // RSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVec_u const & b) {
+            mVec = _mm256_srlv_epi64(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (SIMDVec_u const & b) {
+            return rsha(b);
+        }
         // MRSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = _mm256_srlv_epi64(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
         // RSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = _mm256_srl_epi64(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (uint64_t b) {
+            return rsha(b);
+        }
         // MRSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m256i t1 = _mm256_srl_epi64(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
         // ROLV
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVec_u const & b) const {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec, t2);
+            __m256i t5 = _mm256_srlv_epi64(mVec, t3);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            return SIMDVec_u(t6);
+        }
         // MROLV
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec, t2);
+            __m256i t5 = _mm256_srlv_epi64(mVec, t3);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            __m256i t7 = BLEND(mVec, t6, mask.mMask);
+            return SIMDVec_u(t7);
+        }
         // ROLS
+        UME_FORCE_INLINE SIMDVec_u rol(uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec, t0);
+            __m256i t3 = _mm256_srl_epi64(mVec, t1);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            return SIMDVec_u(t4);
+        }
         // MROLS
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec, t0);
+            __m256i t3 = _mm256_srl_epi64(mVec, t1);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            __m256i t5 = BLEND(mVec, t4, mask.mMask);
+            return SIMDVec_u(t5);
+        }
         // ROLVA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVec_u const & b) {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec, t2);
+            __m256i t5 = _mm256_srlv_epi64(mVec, t3);
+            mVec = _mm256_or_si256(t4, t5);
+            return *this;
+        }
         // MROLVA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec, t2);
+            __m256i t5 = _mm256_srlv_epi64(mVec, t3);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            mVec = BLEND(mVec, t6, mask.mMask);
+            return *this;
+        }
         // ROLSA
+        UME_FORCE_INLINE SIMDVec_u & rola(uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec, t0);
+            __m256i t3 = _mm256_srl_epi64(mVec, t1);
+            mVec = _mm256_or_si256(t2, t3);
+            return *this;
+        }
         // MROLSA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec, t0);
+            __m256i t3 = _mm256_srl_epi64(mVec, t1);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            mVec = BLEND(mVec, t4, mask.mMask);
+            return *this;
+        }
         // RORV
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVec_u const & b) const {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec, t3);
+            __m256i t5 = _mm256_srlv_epi64(mVec, t2);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            return SIMDVec_u(t6);
+        }
         // MRORV
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec, t3);
+            __m256i t5 = _mm256_srlv_epi64(mVec, t2);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            __m256i t7 = BLEND(mVec, t6, mask.mMask);
+            return SIMDVec_u(t7);
+        }
         // RORS
+        UME_FORCE_INLINE SIMDVec_u ror(uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec, t1);
+            __m256i t3 = _mm256_srl_epi64(mVec, t0);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            return SIMDVec_u(t4);
+        }
         // MRORS
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec, t1);
+            __m256i t3 = _mm256_srl_epi64(mVec, t0);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            __m256i t5 = BLEND(mVec, t4, mask.mMask);
+            return SIMDVec_u(t5);
+        }
         // RORVA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVec_u const & b) {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec, t3);
+            __m256i t5 = _mm256_srlv_epi64(mVec, t2);
+            mVec = _mm256_or_si256(t4, t5);
+            return *this;
+        }
         // MRORVA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = SET1_EPI64(63);
+            __m256i t1 = SET1_EPI64(64);
+            __m256i t2 = _mm256_and_si256(b.mVec, t0);
+            __m256i t3 = _mm256_sub_epi64(t1, t2);
+            __m256i t4 = _mm256_sllv_epi64(mVec, t3);
+            __m256i t5 = _mm256_srlv_epi64(mVec, t2);
+            __m256i t6 = _mm256_or_si256(t4, t5);
+            mVec = BLEND(mVec, t6, mask.mMask);
+            return *this;
+        }
         // RORSA
+        UME_FORCE_INLINE SIMDVec_u & rora(uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec, t1);
+            __m256i t3 = _mm256_srl_epi64(mVec, t0);
+            mVec = _mm256_or_si256(t2, t3);
+            return *this;
+        }
         // MRORSA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m256i t2 = _mm256_sll_epi64(mVec, t1);
+            __m256i t3 = _mm256_srl_epi64(mVec, t0);
+            __m256i t4 = _mm256_or_si256(t2, t3);
+            mVec = BLEND(mVec, t4, mask.mMask);
+            return *this;
+        }
 
         // PACK
+        UME_FORCE_INLINE SIMDVec_u & pack(SIMDVec_u<uint64_t, 2> const & a, SIMDVec_u<uint64_t, 2> const & b) {
+            mVec = _mm256_setr_epi64x(a.mVec[0], a.mVec[1], b.mVec[0], b.mVec[1]);
+            return *this;
+        }
         // PACKLO
+        UME_FORCE_INLINE SIMDVec_u & packlo(SIMDVec_u<uint64_t, 2> const & a) {
+            __m128i t0 = _mm_loadu_si128((__m128i const *)a.mVec);
+            mVec = _mm256_inserti128_si256(mVec, t0, 0);
+            return *this;
+        }
         // PACKHI
+        UME_FORCE_INLINE SIMDVec_u & packhi(SIMDVec_u<uint64_t, 2> const & b) {
+            __m128i t0 = _mm_loadu_si128((__m128i const *)b.mVec);
+            mVec = _mm256_inserti128_si256(mVec, t0, 1);
+            return *this;
+        }
         // UNPACK
+        UME_FORCE_INLINE void unpack(SIMDVec_u<uint64_t, 2> & a, SIMDVec_u<uint64_t, 2> & b) const {
+            _mm_storeu_si128((__m128i *)a.mVec, _mm256_castsi256_si128(mVec));
+            _mm_storeu_si128((__m128i *)b.mVec, _mm256_extracti128_si256(mVec, 1));
+        }
         // UNPACKLO
+        UME_FORCE_INLINE SIMDVec_u<uint64_t, 2> unpacklo() const {
+            SIMDVec_u<uint64_t, 2> t0;
+            _mm_storeu_si128((__m128i *)t0.mVec, _mm256_castsi256_si128(mVec));
+            return t0;
+        }
         // UNPACKHI
+        UME_FORCE_INLINE SIMDVec_u<uint64_t, 2> unpackhi() const {
+            SIMDVec_u<uint64_t, 2> t0;
+            _mm_storeu_si128((__m128i *)t0.mVec, _mm256_extracti128_si256(mVec, 1));
+            return t0;
+        }
 
         // PROMOTE
         // -
@@ -509,5 +1813,8 @@ namespace SIMD {
 #undef BLEND
 #undef MASK_LOAD
 #undef MASK_STORE
+#undef MASK_GATHER
+#undef MOVEMASK
+#undef TO_MASK
 
 #endif
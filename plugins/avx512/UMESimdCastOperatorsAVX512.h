@@ -62,20 +62,38 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 8>, int8_t, SIMDVec_u<uint8_t, 8>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_u<uint8_t, 16>::operator SIMDVec_i<int8_t, 16>() const {
+        return SIMDVec_i<int8_t, 16>(mVec);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint8_t, 16>::operator SIMDVec_i<int8_t, 16>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 16>, int8_t, SIMDVec_u<uint8_t, 16>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_u<uint8_t, 32>::operator SIMDVec_i<int8_t, 32>() const {
+        return SIMDVec_i<int8_t, 32>(mVec);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint8_t, 32>::operator SIMDVec_i<int8_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 32>, int8_t, SIMDVec_u<uint8_t, 32>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_u<uint8_t, 64>::operator SIMDVec_i<int8_t, 64>() const {
+        return SIMDVec_i<int8_t, 64>(mVec);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint8_t, 64>::operator SIMDVec_i<int8_t, 64>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 64>, int8_t, SIMDVec_u<uint8_t, 64>>(*this);
     }
+#endif
 
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint8_t, 128>::operator SIMDVec_i<int8_t, 128>() const {
@@ -97,20 +115,38 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 4>, int16_t, SIMDVec_u<uint16_t, 4>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_u<uint16_t, 8>::operator SIMDVec_i<int16_t, 8>() const {
+        return SIMDVec_i<int16_t, 8>(mVec);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 8>::operator SIMDVec_i<int16_t, 8>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 8>, int16_t, SIMDVec_u<uint16_t, 8>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_u<uint16_t, 16>::operator SIMDVec_i<int16_t, 16>() const {
+        return SIMDVec_i<int16_t, 16>(mVec);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 16>::operator SIMDVec_i<int16_t, 16>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 16>, int16_t, SIMDVec_u<uint16_t, 16>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_u<uint16_t, 32>::operator SIMDVec_i<int16_t, 32>() const {
+        return SIMDVec_i<int16_t, 32>(mVec);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 32>::operator SIMDVec_i<int16_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 32>, int16_t, SIMDVec_u<uint16_t, 32>>(*this);
     }
+#endif
 
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 64>::operator SIMDVec_i<int16_t, 64>() const {
@@ -234,20 +270,38 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 8>, uint8_t, SIMDVec_i<int8_t, 8>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_i<int8_t, 16>::operator SIMDVec_u<uint8_t, 16>() const {
+        return SIMDVec_u<uint8_t, 16>(mVec);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int8_t, 16>::operator SIMDVec_u<uint8_t, 16>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 16>, uint8_t, SIMDVec_i<int8_t, 16>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_i<int8_t, 32>::operator SIMDVec_u<uint8_t, 32>() const {
+        return SIMDVec_u<uint8_t, 32>(mVec);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int8_t, 32>::operator SIMDVec_u<uint8_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 32>, uint8_t, SIMDVec_i<int8_t, 32>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_i<int8_t, 64>::operator SIMDVec_u<uint8_t, 64>() const {
+        return SIMDVec_u<uint8_t, 64>(mVec);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int8_t, 64>::operator SIMDVec_u<uint8_t, 64>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 64>, uint8_t, SIMDVec_i<int8_t, 64>>(*this);
     }
+#endif
 
     template<>
     UME_FORCE_INLINE SIMDVec_i<int8_t, 128>::operator SIMDVec_u<uint8_t, 128>() const {
@@ -269,20 +323,38 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 4>, uint16_t, SIMDVec_i<int16_t, 4>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_i<int16_t, 8>::operator SIMDVec_u<uint16_t, 8>() const {
+        return SIMDVec_u<uint16_t, 8>(mVec);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 8>::operator SIMDVec_u<uint16_t, 8>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 8>, uint16_t, SIMDVec_i<int16_t, 8>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_i<int16_t, 16>::operator SIMDVec_u<uint16_t, 16>() const {
+        return SIMDVec_u<uint16_t, 16>(mVec);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 16>::operator SIMDVec_u<uint16_t, 16>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 16>, uint16_t, SIMDVec_i<int16_t, 16>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_i<int16_t, 32>::operator SIMDVec_u<uint16_t, 32>() const {
+        return SIMDVec_u<uint16_t, 32>(mVec);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 32>::operator SIMDVec_u<uint16_t, 32>() const {
-        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 32>, uint32_t, SIMDVec_i<int16_t, 32>>(*this);
+        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 32>, uint16_t, SIMDVec_i<int16_t, 32>>(*this);
     }
+#endif
 
     template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 64>::operator SIMDVec_u<uint16_t, 64>() const {
@@ -659,20 +731,40 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 8>, uint16_t, SIMDVec_u<uint8_t, 8>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_u<uint8_t, 16>::operator SIMDVec_u<uint16_t, 16>() const {
+        __m256i t0 = _mm256_cvtepu8_epi16(mVec);
+        return SIMDVec_u<uint16_t, 16>(t0);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint8_t, 16>::operator SIMDVec_u<uint16_t, 16>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 16>, uint16_t, SIMDVec_u<uint8_t, 16>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_u<uint8_t, 32>::operator SIMDVec_u<uint16_t, 32>() const {
+        __m512i t0 = _mm512_cvtepu8_epi16(mVec);
+        return SIMDVec_u<uint16_t, 32>(t0);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint8_t, 32>::operator SIMDVec_u<uint16_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 32>, uint16_t, SIMDVec_u<uint8_t, 32>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_u<uint8_t, 64>::operator SIMDVec_u<uint16_t, 64>() const {
+        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 64>, uint16_t, SIMDVec_u<uint8_t, 64>>(*this);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint8_t, 64>::operator SIMDVec_u<uint16_t, 64>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 64>, uint16_t, SIMDVec_u<uint8_t, 64>>(*this);
     }
+#endif
 
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 1>::operator SIMDVec_u<uint32_t, 1>() const {
@@ -689,20 +781,42 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint32_t, 4>, uint32_t, SIMDVec_u<uint16_t, 4>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_u<uint16_t, 8>::operator SIMDVec_u<uint32_t, 8>() const {
+        __m256i t0 = _mm256_cvtepu16_epi32(mVec);
+        return SIMDVec_u<uint32_t, 8>(t0);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 8>::operator SIMDVec_u<uint32_t, 8>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint32_t, 8>, uint32_t, SIMDVec_u<uint16_t, 8>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_u<uint16_t, 16>::operator SIMDVec_u<uint32_t, 16>() const {
+        __m512i t0 = _mm512_cvtepu16_epi32(mVec);
+        return SIMDVec_u<uint32_t, 16>(t0);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 16>::operator SIMDVec_u<uint32_t, 16>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint32_t, 16>, uint32_t, SIMDVec_u<uint16_t, 16>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_u<uint16_t, 32>::operator SIMDVec_u<uint32_t, 32>() const {
+        __m512i t0 = _mm512_cvtepu16_epi32(_mm512_castsi512_si256(mVec));
+        __m512i t1 = _mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64(mVec, 1));
+        return SIMDVec_u<uint32_t, 32>(t0, t1);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 32>::operator SIMDVec_u<uint32_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint32_t, 32>, uint32_t, SIMDVec_u<uint16_t, 32>>(*this);
     }
+#endif
 
     UME_FORCE_INLINE SIMDVec_u<uint32_t, 1>::operator SIMDVec_u<uint64_t, 1>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint64_t, 1>, uint64_t, SIMDVec_u<uint32_t, 1>>(*this);
@@ -744,20 +858,40 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 8>, int16_t, SIMDVec_i<int8_t, 8>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_i<int8_t, 16>::operator SIMDVec_i<int16_t, 16>() const {
+        __m256i t0 = _mm256_cvtepi8_epi16(mVec);
+        return SIMDVec_i<int16_t, 16>(t0);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int8_t, 16>::operator SIMDVec_i<int16_t, 16>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 16>, int16_t, SIMDVec_i<int8_t, 16>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_i<int8_t, 32>::operator SIMDVec_i<int16_t, 32>() const {
+        __m512i t0 = _mm512_cvtepi8_epi16(mVec);
+        return SIMDVec_i<int16_t, 32>(t0);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int8_t, 32>::operator SIMDVec_i<int16_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 32>, int16_t, SIMDVec_i<int8_t, 32>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_i<int8_t, 64>::operator SIMDVec_i<int16_t, 64>() const {
+        return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 64>, int16_t, SIMDVec_i<int8_t, 64>>(*this);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int8_t, 64>::operator SIMDVec_i<int16_t, 64>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 64>, int16_t, SIMDVec_i<int8_t, 64>>(*this);
     }
+#endif
 
     template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 1>::operator SIMDVec_i<int32_t, 1>() const {
@@ -774,20 +908,42 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int32_t, 4>, int32_t, SIMDVec_i<int16_t, 4>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_i<int16_t, 8>::operator SIMDVec_i<int32_t, 8>() const {
+        __m256i t0 = _mm256_cvtepi16_epi32(mVec);
+        return SIMDVec_i<int32_t, 8>(t0);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 8>::operator SIMDVec_i<int32_t, 8>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int32_t, 8>, int32_t, SIMDVec_i<int16_t, 8>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_i<int16_t, 16>::operator SIMDVec_i<int32_t, 16>() const {
+        __m512i t0 = _mm512_cvtepi16_epi32(mVec);
+        return SIMDVec_i<int32_t, 16>(t0);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 16>::operator SIMDVec_i<int32_t, 16>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int32_t, 16>, int32_t, SIMDVec_i<int16_t, 16>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_i<int16_t, 32>::operator SIMDVec_i<int32_t, 32>() const {
+        __m512i t0 = _mm512_cvtepi16_epi32(_mm512_castsi512_si256(mVec));
+        __m512i t1 = _mm512_cvtepi16_epi32(_mm512_extracti64x4_epi64(mVec, 1));
+        return SIMDVec_i<int32_t, 32>(t0, t1);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 32>::operator SIMDVec_i<int32_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int32_t, 32>, int32_t, SIMDVec_i<int16_t, 32>>(*this);
     }
+#endif
 
     UME_FORCE_INLINE SIMDVec_i<int32_t, 1>::operator SIMDVec_i<int64_t, 1>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int64_t, 1>, int64_t, SIMDVec_i<int32_t, 1>>(*this);
@@ -844,20 +1000,44 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 4>, uint8_t, SIMDVec_u<uint16_t, 4>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_u<uint16_t, 8>::operator SIMDVec_u<uint8_t, 8>() const {
+        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 8>, uint8_t, SIMDVec_u<uint16_t, 8>>(*this);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 8>::operator SIMDVec_u<uint8_t, 8>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 8>, uint8_t, SIMDVec_u<uint16_t, 8>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_u<uint16_t, 16>::operator SIMDVec_u<uint8_t, 16>() const {
+        __m128i t0 = _mm256_cvtepi16_epi8(mVec);
+        return SIMDVec_u<uint8_t, 16>(t0);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 16>::operator SIMDVec_u<uint8_t, 16>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 16>, uint8_t, SIMDVec_u<uint16_t, 16>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_u<uint16_t, 32>::operator SIMDVec_u<uint8_t, 32>() const {
+        __m256i t0 = _mm512_cvtepi16_epi8(mVec);
+        return SIMDVec_u<uint8_t, 32>(t0);
+    }
+#elif defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_u<uint16_t, 32>::operator SIMDVec_u<uint8_t, 32>() const {
+        return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 32>, uint8_t, SIMDVec_u<uint16_t, 32>>(*this);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 32>::operator SIMDVec_u<uint8_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint8_t, 32>, uint8_t, SIMDVec_u<uint16_t, 32>>(*this);
     }
+#endif
 
     template<>
     UME_FORCE_INLINE SIMDVec_u<uint16_t, 64>::operator SIMDVec_u<uint8_t, 64>() const {
@@ -876,17 +1056,40 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 4>, uint16_t, SIMDVec_u<uint32_t, 4>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_u<uint32_t, 8>::operator SIMDVec_u<uint16_t, 8>() const {
+        __m128i t0 = _mm256_cvtepi32_epi16(mVec);
+        return SIMDVec_u<uint16_t, 8>(t0);
+    }
+#else
     UME_FORCE_INLINE SIMDVec_u<uint32_t, 8>::operator SIMDVec_u<uint16_t, 8>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 8>, uint16_t, SIMDVec_u<uint32_t, 8>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_u<uint32_t, 16>::operator SIMDVec_u<uint16_t, 16>() const {
+        __m256i t0 = _mm512_cvtepi32_epi16(mVec);
+        return SIMDVec_u<uint16_t, 16>(t0);
+    }
+#else
     UME_FORCE_INLINE SIMDVec_u<uint32_t, 16>::operator SIMDVec_u<uint16_t, 16>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 16>, uint16_t, SIMDVec_u<uint32_t, 16>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_u<uint32_t, 32>::operator SIMDVec_u<uint16_t, 32>() const {
+        __m256i t0 = _mm512_cvtepi32_epi16(mVec[0]);
+        __m256i t1 = _mm512_cvtepi32_epi16(mVec[1]);
+        __m512i t2 = _mm512_inserti64x4(_mm512_castsi256_si512(t0), t1, 1);
+        return SIMDVec_u<uint16_t, 32>(t2);
+    }
+#else
     UME_FORCE_INLINE SIMDVec_u<uint32_t, 32>::operator SIMDVec_u<uint16_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_u<uint16_t, 32>, uint16_t, SIMDVec_u<uint32_t, 32>>(*this);
     }
+#endif
 
     UME_FORCE_INLINE SIMDVec_u<uint64_t, 1>::operator SIMDVec_u<uint32_t, 1>() const {
         return SIMDVec_u<uint32_t, 1>(uint32_t(mVec));
@@ -922,20 +1125,44 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 4>, int8_t, SIMDVec_i<int16_t, 4>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_i<int16_t, 8>::operator SIMDVec_i<int8_t, 8>() const {
+        return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 8>, int8_t, SIMDVec_i<int16_t, 8>>(*this);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 8>::operator SIMDVec_i<int8_t, 8>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 8>, int8_t, SIMDVec_i<int16_t, 8>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_i<int16_t, 16>::operator SIMDVec_i<int8_t, 16>() const {
+        __m128i t0 = _mm256_cvtepi16_epi8(mVec);
+        return SIMDVec_i<int8_t, 16>(t0);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 16>::operator SIMDVec_i<int8_t, 16>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 16>, int8_t, SIMDVec_i<int16_t, 16>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_i<int16_t, 32>::operator SIMDVec_i<int8_t, 32>() const {
+        __m256i t0 = _mm512_cvtepi16_epi8(mVec);
+        return SIMDVec_i<int8_t, 32>(t0);
+    }
+#elif defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_i<int16_t, 32>::operator SIMDVec_i<int8_t, 32>() const {
+        return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 32>, int8_t, SIMDVec_i<int16_t, 32>>(*this);
+    }
+#else
     template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 32>::operator SIMDVec_i<int8_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int8_t, 32>, int8_t, SIMDVec_i<int16_t, 32>>(*this);
     }
+#endif
 
     template<>
     UME_FORCE_INLINE SIMDVec_i<int16_t, 64>::operator SIMDVec_i<int8_t, 64>() const {
@@ -954,17 +1181,40 @@ namespace SIMD {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 4>, int16_t, SIMDVec_i<int32_t, 4>>(*this);
     }
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_i<int32_t, 8>::operator SIMDVec_i<int16_t, 8>() const {
+        __m128i t0 = _mm256_cvtepi32_epi16(mVec);
+        return SIMDVec_i<int16_t, 8>(t0);
+    }
+#else
     UME_FORCE_INLINE SIMDVec_i<int32_t, 8>::operator SIMDVec_i<int16_t, 8>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 8>, int16_t, SIMDVec_i<int32_t, 8>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+    UME_FORCE_INLINE SIMDVec_i<int32_t, 16>::operator SIMDVec_i<int16_t, 16>() const {
+        __m256i t0 = _mm512_cvtepi32_epi16(mVec);
+        return SIMDVec_i<int16_t, 16>(t0);
+    }
+#else
     UME_FORCE_INLINE SIMDVec_i<int32_t, 16>::operator SIMDVec_i<int16_t, 16>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 16>, int16_t, SIMDVec_i<int32_t, 16>>(*this);
     }
+#endif
 
+#if defined(__AVX512BW__)
+    UME_FORCE_INLINE SIMDVec_i<int32_t, 32>::operator SIMDVec_i<int16_t, 32>() const {
+        __m256i t0 = _mm512_cvtepi32_epi16(mVec[0]);
+        __m256i t1 = _mm512_cvtepi32_epi16(mVec[1]);
+        __m512i t2 = _mm512_inserti64x4(_mm512_castsi256_si512(t0), t1, 1);
+        return SIMDVec_i<int16_t, 32>(t2);
+    }
+#else
     UME_FORCE_INLINE SIMDVec_i<int32_t, 32>::operator SIMDVec_i<int16_t, 32>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int16_t, 32>, int16_t, SIMDVec_i<int32_t, 32>>(*this);
     }
+#endif
 
     UME_FORCE_INLINE SIMDVec_i<int64_t, 1>::operator SIMDVec_i<int32_t, 1>() const {
         return SCALAR_EMULATION::xtoy <SIMDVec_i<int32_t, 1>, int32_t, SIMDVec_i<int64_t, 1>>(*this);
@@ -49,5 +49,6 @@
 #include "mask/UMESimdMask8.h"
 #include "mask/UMESimdMask16.h"
 #include "mask/UMESimdMask32.h"
+#include "mask/UMESimdMask64.h"
 
 #endif
@@ -48,6 +48,15 @@
 // ********************************************************************************************
 // SIGNED INTEGER VECTOR SPECIALIZATIONS
 // ********************************************************************************************
+// 8b and 16b specializations are only available with AVX512BW.
+#include "int/UMESimdVecInt8_16.h"
+#include "int/UMESimdVecInt8_32.h"
+#include "int/UMESimdVecInt8_64.h"
+
+#include "int/UMESimdVecInt16_8.h"
+#include "int/UMESimdVecInt16_16.h"
+#include "int/UMESimdVecInt16_32.h"
+
 #include "int/UMESimdVecInt32_1.h"
 #include "int/UMESimdVecInt32_2.h"
 #include "int/UMESimdVecInt32_4.h"
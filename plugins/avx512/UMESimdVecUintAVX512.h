@@ -50,6 +50,15 @@
 //#include "uint/UMESimdVecUint16_1.h"
 //#include "uint/UMESimdVecUint16_2.h"
 
+// 8b and 16b specializations are only available with AVX512BW.
+#include "uint/UMESimdVecUint8_16.h"
+#include "uint/UMESimdVecUint8_32.h"
+#include "uint/UMESimdVecUint8_64.h"
+
+#include "uint/UMESimdVecUint16_8.h"
+#include "uint/UMESimdVecUint16_16.h"
+#include "uint/UMESimdVecUint16_32.h"
+
 #include "uint/UMESimdVecUint32_1.h"
 #include "uint/UMESimdVecUint32_2.h"
 #include "uint/UMESimdVecUint32_4.h"
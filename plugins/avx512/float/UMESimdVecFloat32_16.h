@@ -68,6 +68,70 @@ namespace SIMD {
             this->mVec = x;
         }
 
+        // Index-carrying lane reduction used by IMAX/IMIN. Each step pairs every
+        // lane with a partner lane and keeps the better value together with its
+        // index, preferring the lower index on ties. After log2(16) steps all
+        // lanes hold the winner. CMP is _CMP_GT_OQ for max and _CMP_LT_OQ for min.
+        template<int CMP>
+        static UME_FORCE_INLINE void selectLanes(__m512 & v, __m512i & idx, __m512 const & v1, __m512i const & idx1) {
+            __mmask16 m0 = _mm512_cmp_ps_mask(v1, v, CMP);
+            __mmask16 m1 = _mm512_cmp_ps_mask(v1, v, _CMP_EQ_OQ);
+            __mmask16 m2 = _mm512_cmpgt_epi32_mask(idx, idx1);
+            __mmask16 m3 = m0 | (m1 & m2);
+            v = _mm512_mask_mov_ps(v, m3, v1);
+            idx = _mm512_mask_mov_epi32(idx, m3, idx1);
+        }
+        template<int CMP>
+        static UME_FORCE_INLINE uint32_t reduceIndex(__m512 v) {
+            __m512i idx = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            selectLanes<CMP>(v, idx, _mm512_shuffle_f32x4(v, v, 0x4E), _mm512_shuffle_i32x4(idx, idx, 0x4E));
+            selectLanes<CMP>(v, idx, _mm512_shuffle_f32x4(v, v, 0xB1), _mm512_shuffle_i32x4(idx, idx, 0xB1));
+            selectLanes<CMP>(v, idx, _mm512_permute_ps(v, 0x4E), _mm512_shuffle_epi32(idx, (_MM_PERM_ENUM)0x4E));
+            selectLanes<CMP>(v, idx, _mm512_permute_ps(v, 0xB1), _mm512_shuffle_epi32(idx, (_MM_PERM_ENUM)0xB1));
+            return uint32_t(_mm_cvtsi128_si32(_mm512_castsi512_si128(idx)));
+        }
+        // Adds lanes of 'v' selected by bits of 'm' to baseAddr[indices[i]].
+        // Lanes sharing an index are summed in registers first: each of them
+        // repeatedly adds the partial sum of its nearest preceding duplicate
+        // and jumps to that lane's predecessor, so after log2(duplicates)
+        // steps the last duplicate holds the total. Overlapping scatter writes
+        // are ordered from the lowest to the highest lane, which leaves that
+        // total in memory.
+        static UME_FORCE_INLINE void scatterAddLanes(float * baseAddr, __m512 v, __m512i indices, __mmask16 m) {
+            __m512i t0 = _mm512_and_si512(_mm512_conflict_epi32(indices), _mm512_set1_epi32(m));
+            __mmask16 t1 = _mm512_mask_test_epi32_mask(m, t0, t0);
+            __m512i t2 = _mm512_sub_epi32(_mm512_set1_epi32(31), _mm512_lzcnt_epi32(t0));
+            __m512 t3 = v;
+            while (t1 != 0) {
+                __m512 t4 = _mm512_permutexvar_ps(t2, t3);
+                t2 = _mm512_mask_permutexvar_epi32(t2, t1, t2, t2);
+                t3 = _mm512_mask_add_ps(t3, t1, t3, t4);
+                t1 = _mm512_mask_cmpneq_epi32_mask(t1, t2, _mm512_set1_epi32(-1));
+            }
+            __m512 t5 = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), m, indices, baseAddr, 4);
+            t5 = _mm512_add_ps(t5, t3);
+            _mm512_mask_i32scatter_ps(baseAddr, m, indices, t5, 4);
+        }
+        // Bitonic sorting network kernels used by SORTA/SORTD. Every step pairs
+        // each lane with a partner lane, and keeps the minimum or the maximum of
+        // the pair, as selected by bits of BLEND_MASK.
+        template<int BLEND_MASK>
+        static UME_FORCE_INLINE __m512 sortStep(__m512 const & a, __m512 const & b) {
+            return _mm512_mask_max_ps(_mm512_min_ps(a, b), __mmask16(BLEND_MASK), a, b);
+        }
+        static UME_FORCE_INLINE __m512 sortLanes(__m512 a) {
+            a = sortStep<0x6666>(a, _mm512_permute_ps(a, 0xB1));
+            a = sortStep<0x3C3C>(a, _mm512_permute_ps(a, 0x4E));
+            a = sortStep<0x5A5A>(a, _mm512_permute_ps(a, 0xB1));
+            a = sortStep<0x0FF0>(a, _mm512_shuffle_f32x4(a, a, 0xB1));
+            a = sortStep<0x33CC>(a, _mm512_permute_ps(a, 0x4E));
+            a = sortStep<0x55AA>(a, _mm512_permute_ps(a, 0xB1));
+            a = sortStep<0xFF00>(a, _mm512_shuffle_f32x4(a, a, 0x4E));
+            a = sortStep<0xF0F0>(a, _mm512_shuffle_f32x4(a, a, 0xB1));
+            a = sortStep<0xCCCC>(a, _mm512_permute_ps(a, 0x4E));
+            a = sortStep<0xAAAA>(a, _mm512_permute_ps(a, 0xB1));
+            return a;
+        }
     public:
         constexpr static uint32_t length() { return 16; }
         constexpr static uint32_t alignment() { return 64; }
@@ -185,6 +249,11 @@ namespace SIMD {
             mVec = _mm512_mask_loadu_ps(mVec, mask.mMask, p);
             return *this;
         }
+        // LOADN
+        UME_FORCE_INLINE SIMDVec_f & loadn(uint32_t n, float const * p) {
+            mVec = _mm512_maskz_loadu_ps(SIMDVecMask<16>::prefix(n).mMask, p);
+            return *this;
+        }
         // STORE
         UME_FORCE_INLINE float* store(float * p) const {
             _mm512_storeu_ps(p, mVec);
@@ -195,6 +264,11 @@ namespace SIMD {
             _mm512_mask_storeu_ps(p, mask.mMask, mVec);
             return p;
         }
+        // STOREN
+        UME_FORCE_INLINE float* storen(uint32_t n, float * p) const {
+            _mm512_mask_storeu_ps(p, SIMDVecMask<16>::prefix(n).mMask, mVec);
+            return p;
+        }
         // STOREA
         UME_FORCE_INLINE float* storea(float * p) const {
             _mm512_store_ps(p, mVec);
@@ -772,6 +846,14 @@ namespace SIMD {
             __mmask16 t0 = _mm512_cmp_ps_mask(mVec, _mm512_set1_ps(b), 0);
             return (t0 == 0xFFFF);
         }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressstore(SIMDVecMask<16> const & mask, float * p) const {
+            __mmask16 t0 = __mmask16(mask.mMask);
+            uint32_t t1 = uint32_t(_mm_popcnt_u32(t0));
+            __m512 t2 = _mm512_maskz_compress_ps(t0, mVec);
+            _mm512_mask_storeu_ps(p, __mmask16((1 << t1) - 1), t2);
+            return t1;
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<16> const & mask, SIMDVec_f const & b) const {
             __m512 t0 = _mm512_mask_mov_ps(mVec, mask.mMask, b.mVec);
@@ -784,7 +866,44 @@ namespace SIMD {
             return SIMDVec_f(t1);
         }
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_f swizzle(SIMDSwizzle<16> const & sMask) const {
+            __m512 t0 = _mm512_permutexvar_ps(sMask.mVec, mVec);
+            return SIMDVec_f(t0);
+        }
+        template<
+            int i0, int i1, int i2, int i3, int i4, int i5, int i6, int i7,
+            int i8, int i9, int i10, int i11, int i12, int i13, int i14, int i15>
+        UME_FORCE_INLINE SIMDVec_f swizzle() const {
+            const int imm = (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6);
+            // Patterns repeated in every 128-bit lane need only an immediate shuffle.
+            if (i0 < 4 && i1 < 4 && i2 < 4 && i3 < 4 && i4 == i0 + 4 && i5 == i1 + 4 &&
+                i6 == i2 + 4 && i7 == i3 + 4 && i8 == i0 + 8 && i9 == i1 + 8 && i10 == i2 + 8 &&
+                i11 == i3 + 8 && i12 == i0 + 12 && i13 == i1 + 12 && i14 == i2 + 12 &&
+                i15 == i3 + 12) {
+                __m512 t0 = _mm512_permute_ps(mVec, imm);
+                return SIMDVec_f(t0);
+            }
+            __m512i t1 = _mm512_setr_epi32(i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15);
+            __m512 t2 = _mm512_permutexvar_ps(t1, mVec);
+            return SIMDVec_f(t2);
+        }
         // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_f & swizzlea(SIMDSwizzle<16> const & sMask) {
+            SIMDVec_f t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_f sorta() const {
+            __m512 t0 = sortLanes(mVec);
+            return SIMDVec_f(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_f sortd() const {
+            __m512i t0 = _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+            __m512 t1 = _mm512_permutexvar_ps(t0, sortLanes(mVec));
+            return SIMDVec_f(t1);
+        }
         // HADD
         UME_FORCE_INLINE float hadd() const {
 #if defined (WA_GCC_INTR_SUPPORT_6_2)
@@ -1132,6 +1251,22 @@ namespace SIMD {
 #endif
         }
         // IMAX
+        UME_FORCE_INLINE uint32_t imax() const {
+            // NaN lanes never win
+            __m512 t0 = _mm512_set1_ps(-std::numeric_limits<float>::infinity());
+            __mmask16 m0 = _mm512_cmp_ps_mask(mVec, mVec, _CMP_UNORD_Q);
+            __m512 t1 = _mm512_mask_mov_ps(mVec, m0, t0);
+            return reduceIndex<_CMP_GT_OQ>(t1);
+        }
+        // MIMAX
+        UME_FORCE_INLINE uint32_t imax(SIMDVecMask<16> const & mask) const {
+            __m512 t0 = _mm512_set1_ps(-std::numeric_limits<float>::infinity());
+            __m512 t1 = _mm512_set1_ps(std::numeric_limits<float>::lowest());
+            __mmask16 m0 = _mm512_mask_cmp_ps_mask(mask.mMask, mVec, t1, _CMP_GT_OQ);
+            if (m0 == 0) return 0xFFFFFFFF;
+            __m512 t2 = _mm512_mask_mov_ps(t0, m0, mVec);
+            return reduceIndex<_CMP_GT_OQ>(t2);
+        }
         // HMIN
         UME_FORCE_INLINE float hmin() const {
 #if defined (WA_GCC_INTR_SUPPORT_6_2)
@@ -1185,7 +1320,22 @@ namespace SIMD {
 #endif
         }
         // IMIN
+        UME_FORCE_INLINE uint32_t imin() const {
+            // NaN lanes never win
+            __m512 t0 = _mm512_set1_ps(std::numeric_limits<float>::infinity());
+            __mmask16 m0 = _mm512_cmp_ps_mask(mVec, mVec, _CMP_UNORD_Q);
+            __m512 t1 = _mm512_mask_mov_ps(mVec, m0, t0);
+            return reduceIndex<_CMP_LT_OQ>(t1);
+        }
         // MIMIN
+        UME_FORCE_INLINE uint32_t imin(SIMDVecMask<16> const & mask) const {
+            __m512 t0 = _mm512_set1_ps(std::numeric_limits<float>::infinity());
+            __m512 t1 = _mm512_set1_ps(std::numeric_limits<float>::max());
+            __mmask16 m0 = _mm512_mask_cmp_ps_mask(mask.mMask, mVec, t1, _CMP_LT_OQ);
+            if (m0 == 0) return 0xFFFFFFFF;
+            __m512 t2 = _mm512_mask_mov_ps(t0, m0, mVec);
+            return reduceIndex<_CMP_LT_OQ>(t2);
+        }
         // GATHERU
         UME_FORCE_INLINE SIMDVec_f & gatheru(float const * baseAddr, uint32_t stride) {
             __m512i t0 = _mm512_set1_epi32(stride);
@@ -1266,6 +1416,16 @@ namespace SIMD {
             _mm512_mask_i32scatter_ps(baseAddr, m0, indices.mVec, mVec, 4);
             return baseAddr;
         }
+        // SCATTERADDV
+        UME_FORCE_INLINE float* scatteradd(float* baseAddr, SIMDVec_u<uint32_t, 16> const & indices) const {
+            scatterAddLanes(baseAddr, mVec, indices.mVec, 0xFFFF);
+            return baseAddr;
+        }
+        // MSCATTERADDV
+        UME_FORCE_INLINE float* scatteradd(SIMDVecMask<16> const & mask, float* baseAddr, SIMDVec_u<uint32_t, 16> const & indices) const {
+            scatterAddLanes(baseAddr, mVec, indices.mVec, mask.mMask);
+            return baseAddr;
+        }
         // NEG
         UME_FORCE_INLINE SIMDVec_f neg() const {
             __m512 t0 = _mm512_sub_ps(_mm512_set1_ps(0.0f), mVec);
@@ -1386,9 +1546,21 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<16> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<16> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m512 t0 = _mm512_roundscale_ps(mVec, 0);
@@ -1661,9 +1833,21 @@ namespace SIMD {
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 16>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
         #if defined(UME_USE_SVML)
@@ -1717,14 +1901,33 @@ namespace SIMD {
             sinvec.mVec = _mm512_mask_sincos_ps((__m512*)raw_cos, mVec, mVec, mask.mMask, mVec);
             cosvec.mVec = _mm512_load_ps(raw_cos);
         #else
-            sinvec = VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 16>, SIMDVecMask<16>>(mask, *this);
-            cosvec = VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 16>, SIMDVecMask<16>>(mask, *this);
+            VECTOR_EMULATION::sincosf<SIMDVec_f, SIMDVec_i<int32_t, 16>, SIMDVecMask<16>>(mask, *this, sinvec, cosvec);
         #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVec_i<int32_t, 16>, SIMDVecMask<16>>(*this);
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVec_i<int32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVec_i<int32_t, 16>, SIMDVecMask<16>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<16> const & mask) const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVec_i<int32_t, 16>, SIMDVecMask<16>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<16>>(*this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<16>>(*this, b);
+        }
         // PACK
         UME_FORCE_INLINE SIMDVec_f & pack(SIMDVec_f<float, 8> const & a, SIMDVec_f<float, 8> const & b) {
 #if defined(__AVX512VL__)
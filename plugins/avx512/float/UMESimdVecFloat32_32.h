@@ -1894,9 +1894,21 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<32> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<32> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m512 t0 = _mm512_roundscale_ps(mVec[0], 0);
@@ -2283,9 +2295,21 @@ namespace SIMD {
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 32>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<32> const & mask) const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 32>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<32> const & mask) const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 32>, SIMDVecMask<32>>(mask, *this);
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
         #if defined(UME_USE_SVML)
@@ -2355,14 +2379,33 @@ namespace SIMD {
             cosvec.mVec[0] = _mm512_load_ps(raw_cos0);
             cosvec.mVec[1] = _mm512_load_ps(raw_cos1);
         #else
-            sinvec = SCALAR_EMULATION::MATH::sin<SIMDVec_f, SIMDVecMask<32>>(mask, *this);
-            cosvec = SCALAR_EMULATION::MATH::cos<SIMDVec_f, SIMDVecMask<32>>(mask, *this);
+            VECTOR_EMULATION::sincosf<SIMDVec_f, SIMDVec_i<int32_t, 32>, SIMDVecMask<32>>(mask, *this, sinvec, cosvec);
         #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVec_i<int32_t, 32>, SIMDVecMask<32>>(*this);
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<32> const & mask) const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVec_i<int32_t, 32>, SIMDVecMask<32>>(mask, *this);
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVec_i<int32_t, 32>, SIMDVecMask<32>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<32> const & mask) const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVec_i<int32_t, 32>, SIMDVecMask<32>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<32>>(*this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<32>>(*this, b);
+        }
         // PACK
         UME_FORCE_INLINE SIMDVec_f & pack(SIMDVec_f<float, 16> const & a, SIMDVec_f<float, 16> const & b) {
             mVec[0] = a.mVec;
@@ -68,6 +68,51 @@ namespace SIMD {
             this->mVec = x;
         }
 
+        // Adds lanes of 'v' selected by bits of 'm' to baseAddr[indices[i]].
+        // Lanes sharing an index are summed in registers first: each of them
+        // repeatedly adds the partial sum of its nearest preceding duplicate
+        // and jumps to that lane's predecessor, so after log2(duplicates)
+        // steps the last duplicate holds the total. Overlapping scatter writes
+        // are ordered from the lowest to the highest lane, which leaves that
+        // total in memory.
+        static UME_FORCE_INLINE void scatterAddLanes(float * baseAddr, __m512 v, __m512i indices, __mmask16 m) {
+            __m512i t0 = _mm512_and_si512(_mm512_conflict_epi32(indices), _mm512_set1_epi32(m));
+            __mmask16 t1 = _mm512_mask_test_epi32_mask(m, t0, t0);
+            __m512i t2 = _mm512_sub_epi32(_mm512_set1_epi32(31), _mm512_lzcnt_epi32(t0));
+            __m512 t3 = v;
+            while (t1 != 0) {
+                __m512 t4 = _mm512_permutexvar_ps(t2, t3);
+                t2 = _mm512_mask_permutexvar_epi32(t2, t1, t2, t2);
+                t3 = _mm512_mask_add_ps(t3, t1, t3, t4);
+                t1 = _mm512_mask_cmpneq_epi32_mask(t1, t2, _mm512_set1_epi32(-1));
+            }
+            __m512 t5 = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), m, indices, baseAddr, 4);
+            t5 = _mm512_add_ps(t5, t3);
+            _mm512_mask_i32scatter_ps(baseAddr, m, indices, t5, 4);
+        }
+        // Bitonic sorting network kernels used by SORTA/SORTD. Every step pairs
+        // each lane with a partner lane, and keeps the minimum or the maximum of
+        // the pair, as selected by bits of BLEND_MASK.
+        template<int BLEND_MASK>
+        static UME_FORCE_INLINE __m256 sortStep(__m256 const & a, __m256 const & b) {
+            return _mm256_blend_ps(_mm256_min_ps(a, b), _mm256_max_ps(a, b), BLEND_MASK);
+        }
+        // Sorts a bitonic sequence in ascending order.
+        static UME_FORCE_INLINE __m256 mergeLanes(__m256 a) {
+            a = sortStep<0xF0>(a, _mm256_permute2f128_ps(a, a, 0x01));
+            a = sortStep<0xCC>(a, _mm256_permute_ps(a, 0x4E));
+            a = sortStep<0xAA>(a, _mm256_permute_ps(a, 0xB1));
+            return a;
+        }
+        static UME_FORCE_INLINE __m256 sortLanes(__m256 a) {
+            a = sortStep<0x66>(a, _mm256_permute_ps(a, 0xB1));
+            a = sortStep<0x3C>(a, _mm256_permute_ps(a, 0x4E));
+            a = sortStep<0x5A>(a, _mm256_permute_ps(a, 0xB1));
+            return mergeLanes(a);
+        }
+        static UME_FORCE_INLINE __m256 reverseLanes(__m256 const & a) {
+            return _mm256_permute_ps(_mm256_permute2f128_ps(a, a, 0x01), 0x1B);
+        }
     public:
         // ZERO-CONSTR
         UME_FORCE_INLINE SIMDVec_f() {}
@@ -1122,6 +1167,14 @@ namespace SIMD {
 #endif
             return (m0 == 0x0F);
         }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressstore(SIMDVecMask<8> const & mask, float * p) const {
+            __mmask16 t0 = __mmask16(mask.mMask & 0xFF);
+            uint32_t t1 = uint32_t(_mm_popcnt_u32(t0));
+            __m512 t2 = _mm512_maskz_compress_ps(t0, _mm512_castps256_ps512(mVec));
+            _mm512_mask_storeu_ps(p, __mmask16((1 << t1) - 1), t2);
+            return t1;
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
 #if defined(__AVX512VL__)
@@ -1150,9 +1203,39 @@ namespace SIMD {
 #endif
         }
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_f swizzle(SIMDSwizzle<8> const & sMask) const {
+            __m256 t0 = _mm256_permutevar8x32_ps(mVec, sMask.mVec);
+            return SIMDVec_f(t0);
+        }
+        template<int i0, int i1, int i2, int i3, int i4, int i5, int i6, int i7>
+        UME_FORCE_INLINE SIMDVec_f swizzle() const {
+            const int imm = (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6);
+            // Patterns repeated in both 128-bit lanes need only an immediate shuffle.
+            if (i0 < 4 && i1 < 4 && i2 < 4 && i3 < 4 && i4 == i0 + 4 && i5 == i1 + 4 &&
+                i6 == i2 + 4 && i7 == i3 + 4) {
+                __m256 t0 = _mm256_permute_ps(mVec, imm);
+                return SIMDVec_f(t0);
+            }
+            __m256i t1 = _mm256_setr_epi32(i0, i1, i2, i3, i4, i5, i6, i7);
+            __m256 t2 = _mm256_permutevar8x32_ps(mVec, t1);
+            return SIMDVec_f(t2);
+        }
         // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_f & swizzlea(SIMDSwizzle<8> const & sMask) {
+            SIMDVec_f t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
         // SORTA
+        UME_FORCE_INLINE SIMDVec_f sorta() const {
+            __m256 t0 = sortLanes(mVec);
+            return SIMDVec_f(t0);
+        }
         // SORTD
+        UME_FORCE_INLINE SIMDVec_f sortd() const {
+            __m256 t0 = reverseLanes(sortLanes(mVec));
+            return SIMDVec_f(t0);
+        }
 
         // HADD
         UME_FORCE_INLINE float hadd() const {
@@ -1734,6 +1817,16 @@ namespace SIMD {
 #endif
             return baseAddr;
         }
+        // SCATTERADDV
+        UME_FORCE_INLINE float* scatteradd(float* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
+            scatterAddLanes(baseAddr, _mm512_castps256_ps512(mVec), _mm512_castsi256_si512(indices.mVec), 0xFF);
+            return baseAddr;
+        }
+        // MSCATTERADDV
+        UME_FORCE_INLINE float* scatteradd(SIMDVecMask<8> const & mask, float* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
+            scatterAddLanes(baseAddr, _mm512_castps256_ps512(mVec), _mm512_castsi256_si512(indices.mVec), __mmask16(mask.mMask & 0xFF));
+            return baseAddr;
+        }
         // NEG
         UME_FORCE_INLINE SIMDVec_f neg() const {
             __m256 t0 = _mm256_sub_ps(_mm256_set1_ps(0.0f), mVec);
@@ -1912,9 +2005,21 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, float b) const {
+            return VECTOR_EMULATION::powf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256 t0 = _mm256_round_ps(mVec, _MM_FROUND_TO_NEAREST_INT);
@@ -2237,9 +2342,21 @@ namespace SIMD {
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::log2f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::log10f<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
         #if defined(UME_USE_SVML)
@@ -2299,14 +2416,33 @@ namespace SIMD {
             sinvec.mVec = _mm512_castps512_ps256(t1);
             cosvec.mVec = _mm256_load_ps(raw_cos);
         #else
-            sinvec = SCALAR_EMULATION::MATH::sin<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
-            cosvec = SCALAR_EMULATION::MATH::cos<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+            VECTOR_EMULATION::sincosf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this, sinvec, cosvec);
         #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(*this);
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::tanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::ctanf<SIMDVec_f, SIMDVec_i<int32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atanf<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2f<SIMDVec_f, SIMDVecMask<8>>(*this, b);
+        }
         // PACK
         UME_FORCE_INLINE SIMDVec_f & pack(SIMDVec_f<float, 4> const & a, SIMDVec_f<float, 4> const & b) {
  #if defined (WA_GCC_INTR_SUPPORT_6_2)
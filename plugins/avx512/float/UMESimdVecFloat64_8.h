@@ -184,6 +184,11 @@ namespace SIMD {
             mVec = _mm512_mask_load_pd(mVec, mask.mMask, p);
             return *this;
         }
+        // LOADN
+        UME_FORCE_INLINE SIMDVec_f & loadn(uint32_t n, double const * p) {
+            mVec = _mm512_maskz_loadu_pd(SIMDVecMask<8>::prefix(n).mMask, p);
+            return *this;
+        }
         // STORE
         UME_FORCE_INLINE double* store(double * p) const {
             _mm512_storeu_pd(p, mVec);
@@ -194,6 +199,11 @@ namespace SIMD {
             _mm512_mask_storeu_pd(p, mask.mMask, mVec);
             return p;
         }
+        // STOREN
+        UME_FORCE_INLINE double* storen(uint32_t n, double * p) const {
+            _mm512_mask_storeu_pd(p, SIMDVecMask<8>::prefix(n).mMask, mVec);
+            return p;
+        }
         // STOREA
         UME_FORCE_INLINE double* storea(double * p) const {
             _mm512_store_pd(p, mVec);
@@ -216,22 +226,28 @@ namespace SIMD {
             return SIMDVec_f(t0);
         }
         // SWIZZLE
-        UME_FORCE_INLINE SIMDVec_f swizzle(SIMDSwizzle<8> const & sMask) {
-            __m512i t0 = _mm512_cvtepi32_epi64(sMask.mVec);
+        UME_FORCE_INLINE SIMDVec_f swizzle(SIMDSwizzle<8> const & sMask) const {
+            __m512i t0 = _mm512_cvtepu32_epi64(sMask.mVec);
             __m512d t1 = _mm512_permutexvar_pd(t0, mVec);
             return SIMDVec_f(t1);
         }
-        template<
-            int i0, int i1, int i2, int i3, int i4, int i5, int i6, int i7>
-        UME_FORCE_INLINE SIMDVec_f swizzle() {
-            __m512i t0 = _mm512_setr_epi64(i0, i1, i2, i3, i4, i5, i6, i7);
-            __m512d t1 = _mm512_permutexvar_pd(t0, mVec);
-            return SIMDVec_f(t1);
+        template<int i0, int i1, int i2, int i3, int i4, int i5, int i6, int i7>
+        UME_FORCE_INLINE SIMDVec_f swizzle() const {
+            const int imm = (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6);
+            // Patterns repeated in both 256-bit lanes need only an immediate permute.
+            if (i0 < 4 && i1 < 4 && i2 < 4 && i3 < 4 && i4 == i0 + 4 && i5 == i1 + 4 &&
+                i6 == i2 + 4 && i7 == i3 + 4) {
+                __m512d t0 = _mm512_permutex_pd(mVec, imm);
+                return SIMDVec_f(t0);
+            }
+            __m512i t1 = _mm512_setr_epi64(i0, i1, i2, i3, i4, i5, i6, i7);
+            __m512d t2 = _mm512_permutexvar_pd(t1, mVec);
+            return SIMDVec_f(t2);
         }
         // SWIZZLEA
         UME_FORCE_INLINE SIMDVec_f & swizzlea(SIMDSwizzle<8> const & sMask) {
-            __m512i t0 = _mm512_cvtepi32_epi64(sMask.mVec);
-            mVec = _mm512_permutexvar_pd(t0, mVec);
+            SIMDVec_f t0 = swizzle(sMask);
+            mVec = t0.mVec;
             return *this;
         }
 
@@ -1385,9 +1401,21 @@ namespace SIMD {
             return *this;
         }
         // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(*this, b);
+        }
         // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this, b);
+        }
         // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(*this, SIMDVec_f(b));
+        }
         // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<8> const & mask, double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this, SIMDVec_f(b));
+        }
         // ROUND
         UME_FORCE_INLINE SIMDVec_f round() const {
             __m256d t0 = _mm512_extractf64x4_pd(mVec, 0);
@@ -1521,9 +1549,21 @@ namespace SIMD {
         #endif
         }
         // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 8>>(*this);
+        }
         // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 8>>(*this);
+        }
         // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // SIN
         UME_FORCE_INLINE SIMDVec_f sin() const {
         #if defined(UME_USE_SVML)
@@ -1577,14 +1617,33 @@ namespace SIMD {
             sinvec.mVec = _mm512_mask_sincos_pd((__m512d*)raw_cos, mVec, mVec, mask.mMask, mVec);
             cosvec.mVec = _mm512_load_pd(raw_cos);
         #else
-            sinvec = SCALAR_EMULATION::MATH::sin<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
-            cosvec = SCALAR_EMULATION::MATH::cos<SIMDVec_f, SIMDVecMask<8>>(mask, *this);
+            VECTOR_EMULATION::sincosd<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(mask, *this, sinvec, cosvec);
         #endif
         }
         // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(*this);
+        }
         // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
         // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(*this);
+        }
         // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVec_i<int64_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<8>>(*this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2d<SIMDVec_f, SIMDVecMask<8>>(*this, b);
+        }
 
         // PACK
         SIMDVec_f & pack(SIMDVec_f<double, 4> const & a, SIMDVec_f<double, 4> const & b) {
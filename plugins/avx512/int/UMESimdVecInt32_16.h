@@ -55,6 +55,7 @@ namespace SIMD {
     {
         friend class SIMDVec_u<uint32_t, 16>;
         friend class SIMDVec_f<float, 16>;
+        friend class SIMDVec_i<int16_t, 16>;
         friend class SIMDVec_f<double, 16>;
 
         friend class SIMDVec_i<int32_t, 32>;
@@ -63,6 +64,90 @@ namespace SIMD {
 
         UME_FORCE_INLINE explicit SIMDVec_i(__m512i & x) { mVec = x; }
         UME_FORCE_INLINE explicit SIMDVec_i(const __m512i & x) { mVec = x; }
+
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m512i saturatedAdd(__m512i const & a, __m512i const & b) {
+            __m512i t0 = _mm512_add_epi32(a, b);
+            __m512i t1 = _mm512_andnot_si512(_mm512_xor_si512(a, b), _mm512_xor_si512(a, t0));
+            __mmask16 m0 = _mm512_cmplt_epi32_mask(t1, _mm512_setzero_si512());
+            __m512i t2 = _mm512_xor_si512(_mm512_srai_epi32(a, 31), _mm512_set1_epi32(0x7FFFFFFF));
+            return _mm512_mask_mov_epi32(t0, m0, t2);
+        }
+        static UME_FORCE_INLINE __m512i saturatedSub(__m512i const & a, __m512i const & b) {
+            __m512i t0 = _mm512_sub_epi32(a, b);
+            __m512i t1 = _mm512_and_si512(_mm512_xor_si512(a, b), _mm512_xor_si512(a, t0));
+            __mmask16 m0 = _mm512_cmplt_epi32_mask(t1, _mm512_setzero_si512());
+            __m512i t2 = _mm512_xor_si512(_mm512_srai_epi32(a, 31), _mm512_set1_epi32(0x7FFFFFFF));
+            return _mm512_mask_mov_epi32(t0, m0, t2);
+        }
+        // Lane-wise division through double precision, exact for 32-bit operands.
+        static UME_FORCE_INLINE __m512i divideVector(__m512i const & a, __m512i const & b) {
+            __m512d t0 = _mm512_div_pd(_mm512_cvtepi32_pd(_mm512_castsi512_si256(a)), _mm512_cvtepi32_pd(_mm512_castsi512_si256(b)));
+            __m512d t1 = _mm512_div_pd(_mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(a, 1)), _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(b, 1)));
+            return _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvttpd_epi32(t0)), _mm512_cvttpd_epi32(t1), 1);
+        }
+        static UME_FORCE_INLINE __m512i remainderVector(__m512i const & a, __m512i const & b) {
+            __m512i t0 = divideVector(a, b);
+            return _mm512_sub_epi32(a, _mm512_mullo_epi32(t0, b));
+        }
+        // Division by a precomputed divisor, used by DIVD*/REMD*.
+        static UME_FORCE_INLINE __m512i divideMagic(__m512i const & a, SIMDDivisor<int32_t> const & b) {
+            __m512i t0 = _mm512_set1_epi32(b.magic());
+            __m512i t1 = _mm512_mul_epi32(a, t0);
+            __m512i t2 = _mm512_mul_epi32(_mm512_srli_epi64(a, 32), t0);
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_srli_epi64(t1, 32), 0xAAAA, t2);
+            __m512i t4 = _mm512_add_epi32(t3, a);
+            __m512i t5 = _mm512_and_si512(_mm512_srai_epi32(t4, 31), _mm512_set1_epi32(b.mask()));
+            __m512i t6 = _mm512_sra_epi32(_mm512_add_epi32(t4, t5), _mm_cvtsi32_si128(b.shift()));
+            __m512i t7 = _mm512_set1_epi32(b.sign());
+            return _mm512_sub_epi32(_mm512_xor_si512(t6, t7), t7);
+        }
+        static UME_FORCE_INLINE __m512i remainderMagic(__m512i const & a, SIMDDivisor<int32_t> const & b) {
+            __m512i t0 = divideMagic(a, b);
+            return _mm512_sub_epi32(a, _mm512_mullo_epi32(t0, _mm512_set1_epi32(b.divisor())));
+        }
+        // Adds lanes of 'v' selected by bits of 'm' to baseAddr[indices[i]].
+        // Lanes sharing an index are summed in registers first: each of them
+        // repeatedly adds the partial sum of its nearest preceding duplicate
+        // and jumps to that lane's predecessor, so after log2(duplicates)
+        // steps the last duplicate holds the total. Overlapping scatter writes
+        // are ordered from the lowest to the highest lane, which leaves that
+        // total in memory.
+        static UME_FORCE_INLINE void scatterAddLanes(int32_t * baseAddr, __m512i v, __m512i indices, __mmask16 m) {
+            __m512i t0 = _mm512_and_si512(_mm512_conflict_epi32(indices), _mm512_set1_epi32(m));
+            __mmask16 t1 = _mm512_mask_test_epi32_mask(m, t0, t0);
+            __m512i t2 = _mm512_sub_epi32(_mm512_set1_epi32(31), _mm512_lzcnt_epi32(t0));
+            __m512i t3 = v;
+            while (t1 != 0) {
+                __m512i t4 = _mm512_permutexvar_epi32(t2, t3);
+                t2 = _mm512_mask_permutexvar_epi32(t2, t1, t2, t2);
+                t3 = _mm512_mask_add_epi32(t3, t1, t3, t4);
+                t1 = _mm512_mask_cmpneq_epi32_mask(t1, t2, _mm512_set1_epi32(-1));
+            }
+            __m512i t5 = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), m, indices, (const int *)baseAddr, 4);
+            t5 = _mm512_add_epi32(t5, t3);
+            _mm512_mask_i32scatter_epi32((int *)baseAddr, m, indices, t5, 4);
+        }
+        // Bitonic sorting network kernels used by SORTA/SORTD. Every step pairs
+        // each lane with a partner lane, and keeps the minimum or the maximum of
+        // the pair, as selected by bits of BLEND_MASK.
+        template<int BLEND_MASK>
+        static UME_FORCE_INLINE __m512i sortStep(__m512i const & a, __m512i const & b) {
+            return _mm512_mask_max_epi32(_mm512_min_epi32(a, b), __mmask16(BLEND_MASK), a, b);
+        }
+        static UME_FORCE_INLINE __m512i sortLanes(__m512i a) {
+            a = sortStep<0x6666>(a, _mm512_shuffle_epi32(a, _MM_PERM_ENUM(0xB1)));
+            a = sortStep<0x3C3C>(a, _mm512_shuffle_epi32(a, _MM_PERM_ENUM(0x4E)));
+            a = sortStep<0x5A5A>(a, _mm512_shuffle_epi32(a, _MM_PERM_ENUM(0xB1)));
+            a = sortStep<0x0FF0>(a, _mm512_shuffle_i32x4(a, a, 0xB1));
+            a = sortStep<0x33CC>(a, _mm512_shuffle_epi32(a, _MM_PERM_ENUM(0x4E)));
+            a = sortStep<0x55AA>(a, _mm512_shuffle_epi32(a, _MM_PERM_ENUM(0xB1)));
+            a = sortStep<0xFF00>(a, _mm512_shuffle_i32x4(a, a, 0x4E));
+            a = sortStep<0xF0F0>(a, _mm512_shuffle_i32x4(a, a, 0xB1));
+            a = sortStep<0xCCCC>(a, _mm512_shuffle_epi32(a, _MM_PERM_ENUM(0x4E)));
+            a = sortStep<0xAAAA>(a, _mm512_shuffle_epi32(a, _MM_PERM_ENUM(0xB1)));
+            return a;
+        }
     public:
 
         constexpr static uint32_t length() { return 16; }
@@ -180,6 +265,11 @@ namespace SIMD {
             mVec = _mm512_mask_load_epi32(mVec, mask.mMask, p);
             return *this;
         }
+        // LOADN
+        UME_FORCE_INLINE SIMDVec_i & loadn(uint32_t n, int32_t const * p) {
+            mVec = _mm512_maskz_loadu_epi32(SIMDVecMask<16>::prefix(n).mMask, p);
+            return *this;
+        }
         // STORE
         UME_FORCE_INLINE int32_t * store(int32_t * p) const {
             _mm512_storeu_si512(p, mVec);
@@ -190,6 +280,11 @@ namespace SIMD {
             _mm512_mask_storeu_epi32(p, mask.mMask, mVec);
             return p;
         }
+        // STOREN
+        UME_FORCE_INLINE int32_t* storen(uint32_t n, int32_t * p) const {
+            _mm512_mask_storeu_epi32(p, SIMDVecMask<16>::prefix(n).mMask, mVec);
+            return p;
+        }
         // STOREA
         UME_FORCE_INLINE int32_t * storea(int32_t * addrAligned) {
             _mm512_store_si512((__m512i*)addrAligned, mVec);
@@ -200,6 +295,14 @@ namespace SIMD {
             _mm512_mask_store_epi32(p, mask.mMask, mVec);
             return p;
         }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressstore(SIMDVecMask<16> const & mask, int32_t * p) const {
+            __mmask16 t0 = __mmask16(mask.mMask);
+            uint32_t t1 = uint32_t(_mm_popcnt_u32(t0));
+            __m512i t2 = _mm512_maskz_compress_epi32(t0, mVec);
+            _mm512_mask_storeu_epi32(p, __mmask16((1 << t1) - 1), t2);
+            return t1;
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
             __m512i t0 = _mm512_mask_mov_epi32(mVec, mask.mMask, b.mVec);
@@ -212,7 +315,44 @@ namespace SIMD {
             return SIMDVec_i(t1);
         }
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_i swizzle(SIMDSwizzle<16> const & sMask) const {
+            __m512i t0 = _mm512_permutexvar_epi32(sMask.mVec, mVec);
+            return SIMDVec_i(t0);
+        }
+        template<
+            int i0, int i1, int i2, int i3, int i4, int i5, int i6, int i7,
+            int i8, int i9, int i10, int i11, int i12, int i13, int i14, int i15>
+        UME_FORCE_INLINE SIMDVec_i swizzle() const {
+            const int imm = (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6);
+            // Patterns repeated in every 128-bit lane need only an immediate shuffle.
+            if (i0 < 4 && i1 < 4 && i2 < 4 && i3 < 4 && i4 == i0 + 4 && i5 == i1 + 4 &&
+                i6 == i2 + 4 && i7 == i3 + 4 && i8 == i0 + 8 && i9 == i1 + 8 && i10 == i2 + 8 &&
+                i11 == i3 + 8 && i12 == i0 + 12 && i13 == i1 + 12 && i14 == i2 + 12 &&
+                i15 == i3 + 12) {
+                __m512i t0 = _mm512_shuffle_epi32(mVec, (_MM_PERM_ENUM)imm);
+                return SIMDVec_i(t0);
+            }
+            __m512i t1 = _mm512_setr_epi32(i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15);
+            __m512i t2 = _mm512_permutexvar_epi32(t1, mVec);
+            return SIMDVec_i(t2);
+        }
         // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_i & swizzlea(SIMDSwizzle<16> const & sMask) {
+            SIMDVec_i t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() const {
+            __m512i t0 = sortLanes(mVec);
+            return SIMDVec_i(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() const {
+            __m512i t0 = _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+            __m512i t1 = _mm512_permutexvar_epi32(t0, sortLanes(mVec));
+            return SIMDVec_i(t1);
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
             __m512i t0 = _mm512_add_epi32(mVec, b.mVec);
@@ -271,13 +411,53 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m512i t0 = saturatedAdd(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = saturatedAdd(mVec, b.mVec);
+            __m512i t1 = _mm512_mask_mov_epi32(mVec, mask.mMask, t0);
+            return SIMDVec_i(t1);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int32_t b) const {
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = saturatedAdd(mVec, t0);
+            return SIMDVec_i(t1);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<16> const & mask, int32_t b) const {
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = saturatedAdd(mVec, t0);
+            __m512i t2 = _mm512_mask_mov_epi32(mVec, mask.mMask, t1);
+            return SIMDVec_i(t2);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec = saturatedAdd(mVec, b.mVec);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m512i t0 = saturatedAdd(mVec, b.mVec);
+            mVec = _mm512_mask_mov_epi32(mVec, mask.mMask, t0);
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int32_t b) {
+            __m512i t0 = _mm512_set1_epi32(b);
+            mVec = saturatedAdd(mVec, t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<16> const & mask, int32_t b) {
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = saturatedAdd(mVec, t0);
+            mVec = _mm512_mask_mov_epi32(mVec, mask.mMask, t1);
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_i postinc() {
             __m512i t0 = _mm512_set1_epi32(1);
@@ -365,13 +545,53 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m512i t0 = saturatedSub(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = saturatedSub(mVec, b.mVec);
+            __m512i t1 = _mm512_mask_mov_epi32(mVec, mask.mMask, t0);
+            return SIMDVec_i(t1);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int32_t b) const {
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = saturatedSub(mVec, t0);
+            return SIMDVec_i(t1);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<16> const & mask, int32_t b) const {
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = saturatedSub(mVec, t0);
+            __m512i t2 = _mm512_mask_mov_epi32(mVec, mask.mMask, t1);
+            return SIMDVec_i(t2);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec = saturatedSub(mVec, b.mVec);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m512i t0 = saturatedSub(mVec, b.mVec);
+            mVec = _mm512_mask_mov_epi32(mVec, mask.mMask, t0);
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int32_t b) {
+            __m512i t0 = _mm512_set1_epi32(b);
+            mVec = saturatedSub(mVec, t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<16> const & mask, int32_t b) {
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = saturatedSub(mVec, t0);
+            mVec = _mm512_mask_mov_epi32(mVec, mask.mMask, t1);
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
             __m512i t0 = _mm512_sub_epi32(b.mVec, mVec);
@@ -501,13 +721,181 @@ namespace SIMD {
             return *this;
         }
         // DIVV
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVec_i const & b) const {
+            __m512i t0 = divideVector(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (SIMDVec_i const & b) const {
+            return div(b);
+        }
         // MDIVV
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = divideVector(mVec, b.mVec);
+            __m512i t1 = _mm512_mask_mov_epi32(mVec, mask.mMask, t0);
+            return SIMDVec_i(t1);
+        }
         // DIVS
+        UME_FORCE_INLINE SIMDVec_i div(int32_t b) const {
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = divideVector(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (int32_t b) const {
+            return div(b);
+        }
         // MDIVS
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<16> const & mask, int32_t b) const {
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = divideVector(mVec, t0);
+            __m512i t2 = _mm512_mask_mov_epi32(mVec, mask.mMask, t1);
+            return SIMDVec_i(t2);
+        }
         // DIVVA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVec_i const & b) {
+            mVec = divideVector(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDVec_i const & b) {
+            return diva(b);
+        }
         // MDIVVA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m512i t0 = divideVector(mVec, b.mVec);
+            mVec = _mm512_mask_mov_epi32(mVec, mask.mMask, t0);
+            return *this;
+        }
         // DIVSA
+        UME_FORCE_INLINE SIMDVec_i & diva(int32_t b) {
+            __m512i t0 = _mm512_set1_epi32(b);
+            mVec = divideVector(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (int32_t b) {
+            return diva(b);
+        }
         // MDIVSA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<16> const & mask, int32_t b) {
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = divideVector(mVec, t0);
+            mVec = _mm512_mask_mov_epi32(mVec, mask.mMask, t1);
+            return *this;
+        }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDDivisor<int32_t> const & b) const {
+            __m512i t0 = divideMagic(mVec, b);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (SIMDDivisor<int32_t> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<16> const & mask, SIMDDivisor<int32_t> const & b) const {
+            __m512i t0 = divideMagic(mVec, b);
+            __m512i t1 = _mm512_mask_mov_epi32(mVec, mask.mMask, t0);
+            return SIMDVec_i(t1);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDDivisor<int32_t> const & b) {
+            mVec = divideMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDDivisor<int32_t> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<16> const & mask, SIMDDivisor<int32_t> const & b) {
+            __m512i t0 = divideMagic(mVec, b);
+            mVec = _mm512_mask_mov_epi32(mVec, mask.mMask, t0);
+            return *this;
+        }
+        // REMV
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVec_i const & b) const {
+            __m512i t0 = remainderVector(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (SIMDVec_i const & b) const {
+            return rem(b);
+        }
+        // MREMV
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = remainderVector(mVec, b.mVec);
+            __m512i t1 = _mm512_mask_mov_epi32(mVec, mask.mMask, t0);
+            return SIMDVec_i(t1);
+        }
+        // REMS
+        UME_FORCE_INLINE SIMDVec_i rem(int32_t b) const {
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = remainderVector(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (int32_t b) const {
+            return rem(b);
+        }
+        // MREMS
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<16> const & mask, int32_t b) const {
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = remainderVector(mVec, t0);
+            __m512i t2 = _mm512_mask_mov_epi32(mVec, mask.mMask, t1);
+            return SIMDVec_i(t2);
+        }
+        // REMVA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVec_i const & b) {
+            mVec = remainderVector(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (SIMDVec_i const & b) {
+            return rema(b);
+        }
+        // MREMVA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __m512i t0 = remainderVector(mVec, b.mVec);
+            mVec = _mm512_mask_mov_epi32(mVec, mask.mMask, t0);
+            return *this;
+        }
+        // REMSA
+        UME_FORCE_INLINE SIMDVec_i & rema(int32_t b) {
+            __m512i t0 = _mm512_set1_epi32(b);
+            mVec = remainderVector(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (int32_t b) {
+            return rema(b);
+        }
+        // MREMSA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<16> const & mask, int32_t b) {
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = remainderVector(mVec, t0);
+            mVec = _mm512_mask_mov_epi32(mVec, mask.mMask, t1);
+            return *this;
+        }
+        // REMD
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDDivisor<int32_t> const & b) const {
+            __m512i t0 = remainderMagic(mVec, b);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (SIMDDivisor<int32_t> const & b) const {
+            return rem(b);
+        }
+        // MREMD
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<16> const & mask, SIMDDivisor<int32_t> const & b) const {
+            __m512i t0 = remainderMagic(mVec, b);
+            __m512i t1 = _mm512_mask_mov_epi32(mVec, mask.mMask, t0);
+            return SIMDVec_i(t1);
+        }
+        // REMDA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDDivisor<int32_t> const & b) {
+            mVec = remainderMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (SIMDDivisor<int32_t> const & b) {
+            return rema(b);
+        }
+        // MREMDA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<16> const & mask, SIMDDivisor<int32_t> const & b) {
+            __m512i t0 = remainderMagic(mVec, b);
+            mVec = _mm512_mask_mov_epi32(mVec, mask.mMask, t0);
+            return *this;
+        }
         // RCP
         // MRCP
         // RCPS
@@ -1566,6 +1954,16 @@ namespace SIMD {
             _mm512_mask_i32scatter_epi32(baseAddr, mask.mMask, indices.mVec, mVec, 4);
             return baseAddr;
         }
+        // SCATTERADDV
+        UME_FORCE_INLINE int32_t* scatteradd(int32_t* baseAddr, SIMDVec_u<uint32_t, 16> const & indices) const {
+            scatterAddLanes(baseAddr, mVec, indices.mVec, 0xFFFF);
+            return baseAddr;
+        }
+        // MSCATTERADDV
+        UME_FORCE_INLINE int32_t* scatteradd(SIMDVecMask<16> const & mask, int32_t* baseAddr, SIMDVec_u<uint32_t, 16> const & indices) const {
+            scatterAddLanes(baseAddr, mVec, indices.mVec, mask.mMask);
+            return baseAddr;
+        }
         // LSHV
         // MLSHV
         // LSHS
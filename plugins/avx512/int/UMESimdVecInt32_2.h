@@ -811,6 +811,36 @@ namespace SIMD {
             mVec[1] = ((mask.mMask & 0x2) != 0) ? mVec[1] / b : mVec[1];
             return *this;
         }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDDivisor<int32_t> const & b) const {
+            int32_t t0 = b.divide(mVec[0]);
+            int32_t t1 = b.divide(mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (SIMDDivisor<int32_t> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<2> const & mask, SIMDDivisor<int32_t> const & b) const {
+            int32_t t0 = ((mask.mMask & 0x1) != 0) ? b.divide(mVec[0]) : mVec[0];
+            int32_t t1 = ((mask.mMask & 0x2) != 0) ? b.divide(mVec[1]) : mVec[1];
+            return SIMDVec_i(t0, t1);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDDivisor<int32_t> const & b) {
+            mVec[0] = b.divide(mVec[0]);
+            mVec[1] = b.divide(mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDDivisor<int32_t> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<2> const & mask, SIMDDivisor<int32_t> const & b) {
+            mVec[0] = ((mask.mMask & 0x1) != 0) ? b.divide(mVec[0]) : mVec[0];
+            mVec[1] = ((mask.mMask & 0x2) != 0) ? b.divide(mVec[1]) : mVec[1];
+            return *this;
+        }
         // RCP
         // MRCP
         // RCPS
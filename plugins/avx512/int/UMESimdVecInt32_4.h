@@ -65,6 +65,58 @@ namespace SIMD {
         UME_FORCE_INLINE explicit SIMDVec_i(__m128i & x) { mVec = x; }
         UME_FORCE_INLINE explicit SIMDVec_i(const __m128i & x) { mVec = x; }
 
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m128i saturatedAdd(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_add_epi32(a, b);
+            __m128i t1 = _mm_andnot_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, t0));
+            __m128i t2 = _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(0x7FFFFFFF));
+            return _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(t0), _mm_castsi128_ps(t2), _mm_castsi128_ps(t1)));
+        }
+        static UME_FORCE_INLINE __m128i saturatedSub(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_sub_epi32(a, b);
+            __m128i t1 = _mm_and_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, t0));
+            __m128i t2 = _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(0x7FFFFFFF));
+            return _mm_castps_si128(_mm_blendv_ps(_mm_castsi128_ps(t0), _mm_castsi128_ps(t2), _mm_castsi128_ps(t1)));
+        }
+        // Lane-wise division through double precision, exact for 32-bit operands.
+        static UME_FORCE_INLINE __m128i divideVector(__m128i const & a, __m128i const & b) {
+            __m256d t0 = _mm256_div_pd(_mm256_cvtepi32_pd(a), _mm256_cvtepi32_pd(b));
+            return _mm256_cvttpd_epi32(t0);
+        }
+        static UME_FORCE_INLINE __m128i remainderVector(__m128i const & a, __m128i const & b) {
+            __m128i t0 = divideVector(a, b);
+            return _mm_sub_epi32(a, _mm_mullo_epi32(t0, b));
+        }
+        // Division by a precomputed divisor, used by DIVD*/REMD*.
+        static UME_FORCE_INLINE __m128i divideMagic(__m128i const & a, SIMDDivisor<int32_t> const & b) {
+            __m128i t0 = _mm_set1_epi32(b.magic());
+            __m128i t1 = _mm_mul_epi32(a, t0);
+            __m128i t2 = _mm_mul_epi32(_mm_srli_epi64(a, 32), t0);
+            __m128i t3 = _mm_blend_epi32(_mm_srli_epi64(t1, 32), t2, 0xA);
+            __m128i t4 = _mm_add_epi32(t3, a);
+            __m128i t5 = _mm_and_si128(_mm_srai_epi32(t4, 31), _mm_set1_epi32(b.mask()));
+            __m128i t6 = _mm_sra_epi32(_mm_add_epi32(t4, t5), _mm_cvtsi32_si128(b.shift()));
+            __m128i t7 = _mm_set1_epi32(b.sign());
+            return _mm_sub_epi32(_mm_xor_si128(t6, t7), t7);
+        }
+        static UME_FORCE_INLINE __m128i remainderMagic(__m128i const & a, SIMDDivisor<int32_t> const & b) {
+            __m128i t0 = divideMagic(a, b);
+            return _mm_sub_epi32(a, _mm_mullo_epi32(t0, _mm_set1_epi32(b.divisor())));
+        }
+
+        // Bitonic sorting network kernels used by SORTA/SORTD. Every step pairs
+        // each lane with a partner lane, and keeps the minimum or the maximum of
+        // the pair, as selected by bits of BLEND_MASK.
+        template<int BLEND_MASK>
+        static UME_FORCE_INLINE __m128i sortStep(__m128i const & a, __m128i const & b) {
+            return _mm_blend_epi32(_mm_min_epi32(a, b), _mm_max_epi32(a, b), BLEND_MASK);
+        }
+        static UME_FORCE_INLINE __m128i sortLanes(__m128i a) {
+            a = sortStep<0x6>(a, _mm_shuffle_epi32(a, 0xB1));
+            a = sortStep<0xC>(a, _mm_shuffle_epi32(a, 0x4E));
+            a = sortStep<0xA>(a, _mm_shuffle_epi32(a, 0xB1));
+            return a;
+        }
     public:
 
         constexpr static uint32_t length() { return 4; }
@@ -276,7 +328,32 @@ namespace SIMD {
 #endif
         }
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_i swizzle(SIMDSwizzle<4> const & sMask) const {
+            __m128 t0 = _mm_permutevar_ps(_mm_castsi128_ps(mVec), sMask.mVec);
+            __m128i t1 = _mm_castps_si128(t0);
+            return SIMDVec_i(t1);
+        }
+        template<int i0, int i1, int i2, int i3>
+        UME_FORCE_INLINE SIMDVec_i swizzle() const {
+            __m128i t0 = _mm_shuffle_epi32(mVec, (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6));
+            return SIMDVec_i(t0);
+        }
         // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_i & swizzlea(SIMDSwizzle<4> const & sMask) {
+            SIMDVec_i t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() const {
+            __m128i t0 = sortLanes(mVec);
+            return SIMDVec_i(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() const {
+            __m128i t0 = _mm_shuffle_epi32(sortLanes(mVec), 0x1B);
+            return SIMDVec_i(t0);
+        }
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
             __m128i t0 = _mm_add_epi32(mVec, b.mVec);
@@ -362,13 +439,75 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            return SIMDVec_i(t1);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            return SIMDVec_i(t1);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<4> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            return SIMDVec_i(t2);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec = saturatedAdd(mVec, b.mVec);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = saturatedAdd(mVec, t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<4> const & mask, int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_i postinc() {
             __m128i t0 = _mm_set1_epi32(1);
@@ -502,13 +641,75 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            return SIMDVec_i(t1);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            return SIMDVec_i(t1);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<4> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            return SIMDVec_i(t2);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec = saturatedSub(mVec, b.mVec);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = saturatedSub(mVec, t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<4> const & mask, int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
             __m128i t0 = _mm_sub_epi32(b.mVec, mVec);
@@ -714,13 +915,126 @@ namespace SIMD {
             return *this;
         }
         // DIVV
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVec_i const & b) const {
+            __m128i t0 = divideVector(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (SIMDVec_i const & b) const {
+            return div(b);
+        }
         // MDIVV
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = divideVector(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            return SIMDVec_i(t1);
+        }
         // DIVS
+        UME_FORCE_INLINE SIMDVec_i div(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = divideVector(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (int32_t b) const {
+            return div(b);
+        }
         // MDIVS
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<4> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = divideVector(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            return SIMDVec_i(t2);
+        }
         // DIVVA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVec_i const & b) {
+            mVec = divideVector(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDVec_i const & b) {
+            return diva(b);
+        }
         // MDIVVA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = divideVector(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // DIVSA
+        UME_FORCE_INLINE SIMDVec_i & diva(int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = divideVector(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (int32_t b) {
+            return diva(b);
+        }
         // MDIVSA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<4> const & mask, int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = divideVector(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDDivisor<int32_t> const & b) const {
+            __m128i t0 = divideMagic(mVec, b);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (SIMDDivisor<int32_t> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<4> const & mask, SIMDDivisor<int32_t> const & b) const {
+            __m128i t0 = divideMagic(mVec, b);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            return SIMDVec_i(t1);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDDivisor<int32_t> const & b) {
+            mVec = divideMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDDivisor<int32_t> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<4> const & mask, SIMDDivisor<int32_t> const & b) {
+            __m128i t0 = divideMagic(mVec, b);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // RCP
         // MRCP
         // RCPS
@@ -1393,15 +1707,129 @@ namespace SIMD {
         // IMIN
         // MIMIN
         
+        // MREMSA
+
         // REMV
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVec_i const & b) const {
+            __m128i t0 = remainderVector(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (SIMDVec_i const & b) const {
+            return rem(b);
+        }
         // MREMV
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = remainderVector(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            return SIMDVec_i(t1);
+        }
         // REMS
+        UME_FORCE_INLINE SIMDVec_i rem(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = remainderVector(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (int32_t b) const {
+            return rem(b);
+        }
         // MREMS
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<4> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = remainderVector(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            return SIMDVec_i(t2);
+        }
         // REMVA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVec_i const & b) {
+            mVec = remainderVector(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (SIMDVec_i const & b) {
+            return rema(b);
+        }
         // MREMVA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = remainderVector(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // REMSA
+        UME_FORCE_INLINE SIMDVec_i & rema(int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = remainderVector(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (int32_t b) {
+            return rema(b);
+        }
         // MREMSA
-
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<4> const & mask, int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = remainderVector(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
+        // REMD
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDDivisor<int32_t> const & b) const {
+            __m128i t0 = remainderMagic(mVec, b);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (SIMDDivisor<int32_t> const & b) const {
+            return rem(b);
+        }
+        // MREMD
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<4> const & mask, SIMDDivisor<int32_t> const & b) const {
+            __m128i t0 = remainderMagic(mVec, b);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            return SIMDVec_i(t1);
+        }
+        // REMDA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDDivisor<int32_t> const & b) {
+            mVec = remainderMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (SIMDDivisor<int32_t> const & b) {
+            return rema(b);
+        }
+        // MREMDA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<4> const & mask, SIMDDivisor<int32_t> const & b) {
+            __m128i t0 = remainderMagic(mVec, b);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // BANDV
         UME_FORCE_INLINE SIMDVec_i band(SIMDVec_i const & b) const {
             __m128i t0 = _mm_and_si128(mVec, b.mVec);
@@ -55,6 +55,7 @@ namespace SIMD {
     {
         friend class SIMDVec_u<uint32_t, 8>;
         friend class SIMDVec_f<float, 8>;
+        friend class SIMDVec_i<int16_t, 8>;
         friend class SIMDVec_f<double, 8>;
 
         friend class SIMDVec_i<int32_t, 16>;
@@ -63,6 +64,95 @@ namespace SIMD {
 
         UME_FORCE_INLINE explicit SIMDVec_i(__m256i & x) { mVec = x; }
         UME_FORCE_INLINE explicit SIMDVec_i(const __m256i & x) { mVec = x; }
+
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m256i saturatedAdd(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_add_epi32(a, b);
+            __m256i t1 = _mm256_andnot_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, t0));
+            __m256i t2 = _mm256_xor_si256(_mm256_srai_epi32(a, 31), _mm256_set1_epi32(0x7FFFFFFF));
+            return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(t0), _mm256_castsi256_ps(t2), _mm256_castsi256_ps(t1)));
+        }
+        static UME_FORCE_INLINE __m256i saturatedSub(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_sub_epi32(a, b);
+            __m256i t1 = _mm256_and_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, t0));
+            __m256i t2 = _mm256_xor_si256(_mm256_srai_epi32(a, 31), _mm256_set1_epi32(0x7FFFFFFF));
+            return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(t0), _mm256_castsi256_ps(t2), _mm256_castsi256_ps(t1)));
+        }
+        // Lane-wise division through double precision, exact for 32-bit operands.
+        static UME_FORCE_INLINE __m128i divideHalf(__m128i const & a, __m128i const & b) {
+            __m256d t0 = _mm256_div_pd(_mm256_cvtepi32_pd(a), _mm256_cvtepi32_pd(b));
+            return _mm256_cvttpd_epi32(t0);
+        }
+        static UME_FORCE_INLINE __m256i divideVector(__m256i const & a, __m256i const & b) {
+            __m128i t0 = divideHalf(_mm256_castsi256_si128(a), _mm256_castsi256_si128(b));
+            __m128i t1 = divideHalf(_mm256_extracti128_si256(a, 1), _mm256_extracti128_si256(b, 1));
+            return _mm256_inserti128_si256(_mm256_castsi128_si256(t0), t1, 1);
+        }
+        static UME_FORCE_INLINE __m256i remainderVector(__m256i const & a, __m256i const & b) {
+            __m256i t0 = divideVector(a, b);
+            return _mm256_sub_epi32(a, _mm256_mullo_epi32(t0, b));
+        }
+        // Division by a precomputed divisor, used by DIVD*/REMD*.
+        static UME_FORCE_INLINE __m256i divideMagic(__m256i const & a, SIMDDivisor<int32_t> const & b) {
+            __m256i t0 = _mm256_set1_epi32(b.magic());
+            __m256i t1 = _mm256_mul_epi32(a, t0);
+            __m256i t2 = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), t0);
+            __m256i t3 = _mm256_blend_epi32(_mm256_srli_epi64(t1, 32), t2, 0xAA);
+            __m256i t4 = _mm256_add_epi32(t3, a);
+            __m256i t5 = _mm256_and_si256(_mm256_srai_epi32(t4, 31), _mm256_set1_epi32(b.mask()));
+            __m256i t6 = _mm256_sra_epi32(_mm256_add_epi32(t4, t5), _mm_cvtsi32_si128(b.shift()));
+            __m256i t7 = _mm256_set1_epi32(b.sign());
+            return _mm256_sub_epi32(_mm256_xor_si256(t6, t7), t7);
+        }
+        static UME_FORCE_INLINE __m256i remainderMagic(__m256i const & a, SIMDDivisor<int32_t> const & b) {
+            __m256i t0 = divideMagic(a, b);
+            return _mm256_sub_epi32(a, _mm256_mullo_epi32(t0, _mm256_set1_epi32(b.divisor())));
+        }
+        // Adds lanes of 'v' selected by bits of 'm' to baseAddr[indices[i]].
+        // Lanes sharing an index are summed in registers first: each of them
+        // repeatedly adds the partial sum of its nearest preceding duplicate
+        // and jumps to that lane's predecessor, so after log2(duplicates)
+        // steps the last duplicate holds the total. Overlapping scatter writes
+        // are ordered from the lowest to the highest lane, which leaves that
+        // total in memory.
+        static UME_FORCE_INLINE void scatterAddLanes(int32_t * baseAddr, __m512i v, __m512i indices, __mmask16 m) {
+            __m512i t0 = _mm512_and_si512(_mm512_conflict_epi32(indices), _mm512_set1_epi32(m));
+            __mmask16 t1 = _mm512_mask_test_epi32_mask(m, t0, t0);
+            __m512i t2 = _mm512_sub_epi32(_mm512_set1_epi32(31), _mm512_lzcnt_epi32(t0));
+            __m512i t3 = v;
+            while (t1 != 0) {
+                __m512i t4 = _mm512_permutexvar_epi32(t2, t3);
+                t2 = _mm512_mask_permutexvar_epi32(t2, t1, t2, t2);
+                t3 = _mm512_mask_add_epi32(t3, t1, t3, t4);
+                t1 = _mm512_mask_cmpneq_epi32_mask(t1, t2, _mm512_set1_epi32(-1));
+            }
+            __m512i t5 = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), m, indices, (const int *)baseAddr, 4);
+            t5 = _mm512_add_epi32(t5, t3);
+            _mm512_mask_i32scatter_epi32((int *)baseAddr, m, indices, t5, 4);
+        }
+        // Bitonic sorting network kernels used by SORTA/SORTD. Every step pairs
+        // each lane with a partner lane, and keeps the minimum or the maximum of
+        // the pair, as selected by bits of BLEND_MASK.
+        template<int BLEND_MASK>
+        static UME_FORCE_INLINE __m256i sortStep(__m256i const & a, __m256i const & b) {
+            return _mm256_blend_epi32(_mm256_min_epi32(a, b), _mm256_max_epi32(a, b), BLEND_MASK);
+        }
+        // Sorts a bitonic sequence in ascending order.
+        static UME_FORCE_INLINE __m256i mergeLanes(__m256i a) {
+            a = sortStep<0xF0>(a, _mm256_permute2x128_si256(a, a, 0x01));
+            a = sortStep<0xCC>(a, _mm256_shuffle_epi32(a, 0x4E));
+            a = sortStep<0xAA>(a, _mm256_shuffle_epi32(a, 0xB1));
+            return a;
+        }
+        static UME_FORCE_INLINE __m256i sortLanes(__m256i a) {
+            a = sortStep<0x66>(a, _mm256_shuffle_epi32(a, 0xB1));
+            a = sortStep<0x3C>(a, _mm256_shuffle_epi32(a, 0x4E));
+            a = sortStep<0x5A>(a, _mm256_shuffle_epi32(a, 0xB1));
+            return mergeLanes(a);
+        }
+        static UME_FORCE_INLINE __m256i reverseLanes(__m256i const & a) {
+            return _mm256_shuffle_epi32(_mm256_permute2x128_si256(a, a, 0x01), 0x1B);
+        }
     public:
 
         constexpr static uint32_t length() { return 8; }
@@ -249,6 +339,14 @@ namespace SIMD {
 #endif
             return p;
         }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressstore(SIMDVecMask<8> const & mask, int32_t * p) const {
+            __mmask16 t0 = __mmask16(mask.mMask & 0xFF);
+            uint32_t t1 = uint32_t(_mm_popcnt_u32(t0));
+            __m512i t2 = _mm512_maskz_compress_epi32(t0, _mm512_castsi256_si512(mVec));
+            _mm512_mask_storeu_epi32(p, __mmask16((1 << t1) - 1), t2);
+            return t1;
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
 #if defined(__AVX512VL__)
@@ -277,9 +375,39 @@ namespace SIMD {
 #endif
         }
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_i swizzle(SIMDSwizzle<8> const & sMask) const {
+            __m256i t0 = _mm256_permutevar8x32_epi32(mVec, sMask.mVec);
+            return SIMDVec_i(t0);
+        }
+        template<int i0, int i1, int i2, int i3, int i4, int i5, int i6, int i7>
+        UME_FORCE_INLINE SIMDVec_i swizzle() const {
+            const int imm = (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6);
+            // Patterns repeated in both 128-bit lanes need only an immediate shuffle.
+            if (i0 < 4 && i1 < 4 && i2 < 4 && i3 < 4 && i4 == i0 + 4 && i5 == i1 + 4 &&
+                i6 == i2 + 4 && i7 == i3 + 4) {
+                __m256i t0 = _mm256_shuffle_epi32(mVec, imm);
+                return SIMDVec_i(t0);
+            }
+            __m256i t1 = _mm256_setr_epi32(i0, i1, i2, i3, i4, i5, i6, i7);
+            __m256i t2 = _mm256_permutevar8x32_epi32(mVec, t1);
+            return SIMDVec_i(t2);
+        }
         // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_i & swizzlea(SIMDSwizzle<8> const & sMask) {
+            SIMDVec_i t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
         // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() const {
+            __m256i t0 = sortLanes(mVec);
+            return SIMDVec_i(t0);
+        }
         // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() const {
+            __m256i t0 = reverseLanes(sortLanes(mVec));
+            return SIMDVec_i(t0);
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
@@ -367,13 +495,75 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            return SIMDVec_i(t1);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+            return SIMDVec_i(t1);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            return SIMDVec_i(t2);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec = saturatedAdd(mVec, b.mVec);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec = saturatedAdd(mVec, t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<8> const & mask, int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_i postinc() {
             __m256i t0 = _mm256_set1_epi32(1);
@@ -503,13 +693,75 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            return SIMDVec_i(t1);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+            return SIMDVec_i(t1);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            return SIMDVec_i(t2);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec = saturatedSub(mVec, b.mVec);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec = saturatedSub(mVec, t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<8> const & mask, int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
             __m256i t0 = _mm256_sub_epi32(b.mVec, mVec);
@@ -709,13 +961,247 @@ namespace SIMD {
             return *this;
         }
         // DIVV
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVec_i const & b) const {
+            __m256i t0 = divideVector(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (SIMDVec_i const & b) const {
+            return div(b);
+        }
         // MDIVV
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = divideVector(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            return SIMDVec_i(t1);
+        }
         // DIVS
+        UME_FORCE_INLINE SIMDVec_i div(int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = divideVector(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (int32_t b) const {
+            return div(b);
+        }
         // MDIVS
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = divideVector(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            return SIMDVec_i(t2);
+        }
         // DIVVA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVec_i const & b) {
+            mVec = divideVector(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDVec_i const & b) {
+            return diva(b);
+        }
         // MDIVVA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = divideVector(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // DIVSA
+        UME_FORCE_INLINE SIMDVec_i & diva(int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec = divideVector(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (int32_t b) {
+            return diva(b);
+        }
         // MDIVSA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<8> const & mask, int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = divideVector(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDDivisor<int32_t> const & b) const {
+            __m256i t0 = divideMagic(mVec, b);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (SIMDDivisor<int32_t> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<8> const & mask, SIMDDivisor<int32_t> const & b) const {
+            __m256i t0 = divideMagic(mVec, b);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            return SIMDVec_i(t1);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDDivisor<int32_t> const & b) {
+            mVec = divideMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDDivisor<int32_t> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<8> const & mask, SIMDDivisor<int32_t> const & b) {
+            __m256i t0 = divideMagic(mVec, b);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
+        // REMV
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVec_i const & b) const {
+            __m256i t0 = remainderVector(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (SIMDVec_i const & b) const {
+            return rem(b);
+        }
+        // MREMV
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = remainderVector(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            return SIMDVec_i(t1);
+        }
+        // REMS
+        UME_FORCE_INLINE SIMDVec_i rem(int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = remainderVector(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (int32_t b) const {
+            return rem(b);
+        }
+        // MREMS
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = remainderVector(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            return SIMDVec_i(t2);
+        }
+        // REMVA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVec_i const & b) {
+            mVec = remainderVector(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (SIMDVec_i const & b) {
+            return rema(b);
+        }
+        // MREMVA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = remainderVector(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
+        // REMSA
+        UME_FORCE_INLINE SIMDVec_i & rema(int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec = remainderVector(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (int32_t b) {
+            return rema(b);
+        }
+        // MREMSA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<8> const & mask, int32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = remainderVector(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
+        // REMD
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDDivisor<int32_t> const & b) const {
+            __m256i t0 = remainderMagic(mVec, b);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (SIMDDivisor<int32_t> const & b) const {
+            return rem(b);
+        }
+        // MREMD
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<8> const & mask, SIMDDivisor<int32_t> const & b) const {
+            __m256i t0 = remainderMagic(mVec, b);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            return SIMDVec_i(t1);
+        }
+        // REMDA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDDivisor<int32_t> const & b) {
+            mVec = remainderMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (SIMDDivisor<int32_t> const & b) {
+            return rema(b);
+        }
+        // MREMDA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<8> const & mask, SIMDDivisor<int32_t> const & b) {
+            __m256i t0 = remainderMagic(mVec, b);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // RCP
         // MRCP
         // RCPS
@@ -2022,6 +2508,16 @@ namespace SIMD {
 #endif
             return baseAddr;
         }
+        // SCATTERADDV
+        UME_FORCE_INLINE int32_t* scatteradd(int32_t* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
+            scatterAddLanes(baseAddr, _mm512_castsi256_si512(mVec), _mm512_castsi256_si512(indices.mVec), 0xFF);
+            return baseAddr;
+        }
+        // MSCATTERADDV
+        UME_FORCE_INLINE int32_t* scatteradd(SIMDVecMask<8> const & mask, int32_t* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
+            scatterAddLanes(baseAddr, _mm512_castsi256_si512(mVec), _mm512_castsi256_si512(indices.mVec), __mmask16(mask.mMask & 0xFF));
+            return baseAddr;
+        }
         // LSHV
         // MLSHV
         // LSHS
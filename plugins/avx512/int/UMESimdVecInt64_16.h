@@ -98,6 +98,22 @@ namespace SIMD {
             mVec[0] = x0;
             mVec[1] = x1;
         }
+
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m512i saturatedAdd(__m512i const & a, __m512i const & b) {
+            __m512i t0 = _mm512_add_epi64(a, b);
+            __m512i t1 = _mm512_andnot_si512(_mm512_xor_si512(a, b), _mm512_xor_si512(a, t0));
+            __mmask8 m0 = _mm512_cmplt_epi64_mask(t1, _mm512_setzero_si512());
+            __m512i t2 = _mm512_xor_si512(_mm512_srai_epi64(a, 63), _mm512_set1_epi64(0x7FFFFFFFFFFFFFFFLL));
+            return _mm512_mask_mov_epi64(t0, m0, t2);
+        }
+        static UME_FORCE_INLINE __m512i saturatedSub(__m512i const & a, __m512i const & b) {
+            __m512i t0 = _mm512_sub_epi64(a, b);
+            __m512i t1 = _mm512_and_si512(_mm512_xor_si512(a, b), _mm512_xor_si512(a, t0));
+            __mmask8 m0 = _mm512_cmplt_epi64_mask(t1, _mm512_setzero_si512());
+            __m512i t2 = _mm512_xor_si512(_mm512_srai_epi64(a, 63), _mm512_set1_epi64(0x7FFFFFFFFFFFFFFFLL));
+            return _mm512_mask_mov_epi64(t0, m0, t2);
+        }
     public:
         constexpr static uint32_t length() { return 16; }
         constexpr static uint32_t alignment() { return 64; }
@@ -278,6 +294,25 @@ namespace SIMD {
         }
         // SWIZZLE
         // SWIZZLEA
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() const {
+            // Sorting the halves in opposite directions gives a bitonic sequence.
+            __m512i t0 = SIMDVec_i<int64_t, 8>::sortLanes(mVec[0]);
+            __m512i t1 = SIMDVec_i<int64_t, 8>::reverseLanes(SIMDVec_i<int64_t, 8>::sortLanes(mVec[1]));
+            __m512i t2 = SIMDVec_i<int64_t, 8>::mergeLanes(_mm512_min_epi64(t0, t1));
+            __m512i t3 = SIMDVec_i<int64_t, 8>::mergeLanes(_mm512_max_epi64(t0, t1));
+            return SIMDVec_i(t2, t3);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() const {
+            __m512i t0 = SIMDVec_i<int64_t, 8>::sortLanes(mVec[0]);
+            __m512i t1 = SIMDVec_i<int64_t, 8>::reverseLanes(SIMDVec_i<int64_t, 8>::sortLanes(mVec[1]));
+            __m512i t2 = SIMDVec_i<int64_t, 8>::mergeLanes(_mm512_min_epi64(t0, t1));
+            __m512i t3 = SIMDVec_i<int64_t, 8>::mergeLanes(_mm512_max_epi64(t0, t1));
+            __m512i t4 = SIMDVec_i<int64_t, 8>::reverseLanes(t3);
+            __m512i t5 = SIMDVec_i<int64_t, 8>::reverseLanes(t2);
+            return SIMDVec_i(t4, t5);
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
@@ -340,13 +375,73 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m512i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            __m512i t1 = saturatedAdd(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __mmask8 m0 = mask.mMask & 0x00FF;
+            __mmask8 m1 = (mask.mMask & 0xFF00) >> 8;
+            __m512i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            __m512i t1 = _mm512_mask_mov_epi64(mVec[0], m0, t0);
+            __m512i t2 = saturatedAdd(mVec[1], b.mVec[1]);
+            __m512i t3 = _mm512_mask_mov_epi64(mVec[1], m1, t2);
+            return SIMDVec_i(t1, t3);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int64_t b) const {
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedAdd(mVec[0], t0);
+            __m512i t2 = saturatedAdd(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<16> const & mask, int64_t b) const {
+            __mmask8 m0 = mask.mMask & 0x00FF;
+            __mmask8 m1 = (mask.mMask & 0xFF00) >> 8;
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedAdd(mVec[0], t0);
+            __m512i t2 = _mm512_mask_mov_epi64(mVec[0], m0, t1);
+            __m512i t3 = saturatedAdd(mVec[1], t0);
+            __m512i t4 = _mm512_mask_mov_epi64(mVec[1], m1, t3);
+            return SIMDVec_i(t2, t4);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec[0] = saturatedAdd(mVec[0], b.mVec[0]);
+            mVec[1] = saturatedAdd(mVec[1], b.mVec[1]);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __mmask8 m0 = mask.mMask & 0x00FF;
+            __mmask8 m1 = (mask.mMask & 0xFF00) >> 8;
+            __m512i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            mVec[0] = _mm512_mask_mov_epi64(mVec[0], m0, t0);
+            __m512i t1 = saturatedAdd(mVec[1], b.mVec[1]);
+            mVec[1] = _mm512_mask_mov_epi64(mVec[1], m1, t1);
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int64_t b) {
+            __m512i t0 = _mm512_set1_epi64(b);
+            mVec[0] = saturatedAdd(mVec[0], t0);
+            mVec[1] = saturatedAdd(mVec[1], t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<16> const & mask, int64_t b) {
+            __mmask8 m0 = mask.mMask & 0x00FF;
+            __mmask8 m1 = (mask.mMask & 0xFF00) >> 8;
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedAdd(mVec[0], t0);
+            mVec[0] = _mm512_mask_mov_epi64(mVec[0], m0, t1);
+            __m512i t2 = saturatedAdd(mVec[1], t0);
+            mVec[1] = _mm512_mask_mov_epi64(mVec[1], m1, t2);
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_i postinc() {
             __m512i t0 = _mm512_set1_epi64(1);
@@ -444,13 +539,73 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m512i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            __m512i t1 = saturatedSub(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<16> const & mask, SIMDVec_i const & b) const {
+            __mmask8 m0 = mask.mMask & 0x00FF;
+            __mmask8 m1 = (mask.mMask & 0xFF00) >> 8;
+            __m512i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            __m512i t1 = _mm512_mask_mov_epi64(mVec[0], m0, t0);
+            __m512i t2 = saturatedSub(mVec[1], b.mVec[1]);
+            __m512i t3 = _mm512_mask_mov_epi64(mVec[1], m1, t2);
+            return SIMDVec_i(t1, t3);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int64_t b) const {
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedSub(mVec[0], t0);
+            __m512i t2 = saturatedSub(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<16> const & mask, int64_t b) const {
+            __mmask8 m0 = mask.mMask & 0x00FF;
+            __mmask8 m1 = (mask.mMask & 0xFF00) >> 8;
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedSub(mVec[0], t0);
+            __m512i t2 = _mm512_mask_mov_epi64(mVec[0], m0, t1);
+            __m512i t3 = saturatedSub(mVec[1], t0);
+            __m512i t4 = _mm512_mask_mov_epi64(mVec[1], m1, t3);
+            return SIMDVec_i(t2, t4);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec[0] = saturatedSub(mVec[0], b.mVec[0]);
+            mVec[1] = saturatedSub(mVec[1], b.mVec[1]);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<16> const & mask, SIMDVec_i const & b) {
+            __mmask8 m0 = mask.mMask & 0x00FF;
+            __mmask8 m1 = (mask.mMask & 0xFF00) >> 8;
+            __m512i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            mVec[0] = _mm512_mask_mov_epi64(mVec[0], m0, t0);
+            __m512i t1 = saturatedSub(mVec[1], b.mVec[1]);
+            mVec[1] = _mm512_mask_mov_epi64(mVec[1], m1, t1);
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int64_t b) {
+            __m512i t0 = _mm512_set1_epi64(b);
+            mVec[0] = saturatedSub(mVec[0], t0);
+            mVec[1] = saturatedSub(mVec[1], t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<16> const & mask, int64_t b) {
+            __mmask8 m0 = mask.mMask & 0x00FF;
+            __mmask8 m1 = (mask.mMask & 0xFF00) >> 8;
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedSub(mVec[0], t0);
+            mVec[0] = _mm512_mask_mov_epi64(mVec[0], m0, t1);
+            __m512i t2 = saturatedSub(mVec[1], t0);
+            mVec[1] = _mm512_mask_mov_epi64(mVec[1], m1, t2);
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
             __m512i t0 = _mm512_sub_epi64(b.mVec[0], mVec[0]);
@@ -99,6 +99,20 @@ namespace SIMD {
         UME_FORCE_INLINE explicit SIMDVec_i(__m128i & x) { mVec = x; }
         UME_FORCE_INLINE explicit SIMDVec_i(const __m128i & x) { mVec = x; }
 
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m128i saturatedAdd(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_add_epi64(a, b);
+            __m128i t1 = _mm_andnot_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, t0));
+            __m128i t2 = _mm_xor_si128(_mm_cmpgt_epi64(_mm_setzero_si128(), a), _mm_srli_epi64(_mm_cmpeq_epi64(a, a), 1));
+            return _mm_castpd_si128(_mm_blendv_pd(_mm_castsi128_pd(t0), _mm_castsi128_pd(t2), _mm_castsi128_pd(t1)));
+        }
+        static UME_FORCE_INLINE __m128i saturatedSub(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_sub_epi64(a, b);
+            __m128i t1 = _mm_and_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, t0));
+            __m128i t2 = _mm_xor_si128(_mm_cmpgt_epi64(_mm_setzero_si128(), a), _mm_srli_epi64(_mm_cmpeq_epi64(a, a), 1));
+            return _mm_castpd_si128(_mm_blendv_pd(_mm_castsi128_pd(t0), _mm_castsi128_pd(t2), _mm_castsi128_pd(t1)));
+        }
+
     public:
         constexpr static uint32_t length() { return 2; }
         constexpr static uint32_t alignment() { return 16; }
@@ -318,7 +332,27 @@ namespace SIMD {
 #endif
         }
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_i swizzle(SIMDSwizzle<2> const & sMask) const {
+            __m128i t0 = _mm_set_epi64x(
+                int64_t(sMask[1] & 1) << 1,
+                int64_t(sMask[0] & 1) << 1);
+            __m128d t1 = _mm_permutevar_pd(_mm_castsi128_pd(mVec), t0);
+            __m128i t2 = _mm_castpd_si128(t1);
+            return SIMDVec_i(t2);
+        }
+        template<int i0, int i1>
+        UME_FORCE_INLINE SIMDVec_i swizzle() const {
+            const int imm = ((i0 & 1) * 2) | (((i0 & 1) * 2 + 1) << 2) |
+                            (((i1 & 1) * 2) << 4) | (((i1 & 1) * 2 + 1) << 6);
+            __m128i t0 = _mm_shuffle_epi32(mVec, imm);
+            return SIMDVec_i(t0);
+        }
         // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_i & swizzlea(SIMDSwizzle<2> const & sMask) {
+            SIMDVec_i t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
 
         // SORTA
         // SORTD
@@ -392,13 +426,75 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<2> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi64(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi64(_mm512_castsi128_si512(mVec), mask.mMask, _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            return SIMDVec_i(t1);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            return SIMDVec_i(t1);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi64(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi64(_mm512_castsi128_si512(mVec), mask.mMask, _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            return SIMDVec_i(t2);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec = saturatedAdd(mVec, b.mVec);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<2> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi64(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi64(_mm512_castsi128_si512(mVec), mask.mMask, _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            mVec = saturatedAdd(mVec, t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<2> const & mask, int64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi64(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi64(_mm512_castsi128_si512(mVec), mask.mMask, _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_i postinc() {
             __m128i t0 = SET1_EPI64(1);
@@ -506,13 +602,75 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<2> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi64(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi64(_mm512_castsi128_si512(mVec), mask.mMask, _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            return SIMDVec_i(t1);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            return SIMDVec_i(t1);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi64(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi64(_mm512_castsi128_si512(mVec), mask.mMask, _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            return SIMDVec_i(t2);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec = saturatedSub(mVec, b.mVec);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<2> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi64(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi64(_mm512_castsi128_si512(mVec), mask.mMask, _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            mVec = saturatedSub(mVec, t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<2> const & mask, int64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi64(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi64(_mm512_castsi128_si512(mVec), mask.mMask, _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
             __m128i t0 = _mm_sub_epi64(b.mVec, mVec);
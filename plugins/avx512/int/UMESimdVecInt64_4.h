@@ -101,6 +101,50 @@ namespace SIMD {
         UME_FORCE_INLINE explicit SIMDVec_i(__m256i & x) { mVec = x; }
         UME_FORCE_INLINE explicit SIMDVec_i(const __m256i & x) { mVec = x; }
 
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m256i saturatedAdd(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_add_epi64(a, b);
+            __m256i t1 = _mm256_andnot_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, t0));
+            __m256i t2 = _mm256_xor_si256(_mm256_cmpgt_epi64(_mm256_setzero_si256(), a), _mm256_srli_epi64(_mm256_cmpeq_epi64(a, a), 1));
+            return _mm256_castpd_si256(_mm256_blendv_pd(_mm256_castsi256_pd(t0), _mm256_castsi256_pd(t2), _mm256_castsi256_pd(t1)));
+        }
+        static UME_FORCE_INLINE __m256i saturatedSub(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_sub_epi64(a, b);
+            __m256i t1 = _mm256_and_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, t0));
+            __m256i t2 = _mm256_xor_si256(_mm256_cmpgt_epi64(_mm256_setzero_si256(), a), _mm256_srli_epi64(_mm256_cmpeq_epi64(a, a), 1));
+            return _mm256_castpd_si256(_mm256_blendv_pd(_mm256_castsi256_pd(t0), _mm256_castsi256_pd(t2), _mm256_castsi256_pd(t1)));
+        }
+
+        // Bitonic sorting network kernels used by SORTA/SORTD. Every step pairs
+        // each lane with a partner lane, and keeps the minimum or the maximum of
+        // the pair, as selected by bits of BLEND_MASK. BLEND_MASK has one bit
+        // per 32b element, so each lane is covered by two bits.
+        template<int BLEND_MASK>
+        static UME_FORCE_INLINE __m256i sortStep(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_cmpgt_epi64(a, b);
+            __m256i t1 = _mm256_blendv_epi8(a, b, t0);
+            __m256i t2 = _mm256_blendv_epi8(b, a, t0);
+            return _mm256_blend_epi32(t1, t2, BLEND_MASK);
+        }
+        // Sorts a bitonic sequence in ascending order.
+        static UME_FORCE_INLINE __m256i mergeLanes(__m256i a) {
+            a = sortStep<0xF0>(a, _mm256_permute4x64_epi64(a, 0x4E));
+            a = sortStep<0xCC>(a, _mm256_permute4x64_epi64(a, 0xB1));
+            return a;
+        }
+        static UME_FORCE_INLINE __m256i sortLanes(__m256i a) {
+            a = sortStep<0x3C>(a, _mm256_permute4x64_epi64(a, 0xB1));
+            return mergeLanes(a);
+        }
+        static UME_FORCE_INLINE __m256i reverseLanes(__m256i const & a) {
+            return _mm256_permute4x64_epi64(a, 0x1B);
+        }
+        static UME_FORCE_INLINE __m256i minLanes(__m256i const & a, __m256i const & b) {
+            return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b));
+        }
+        static UME_FORCE_INLINE __m256i maxLanes(__m256i const & a, __m256i const & b) {
+            return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b));
+        }
     public:
         constexpr static uint32_t length() { return 4; }
         constexpr static uint32_t alignment() { return 32; }
@@ -284,6 +328,14 @@ namespace SIMD {
             return p;
         }
 
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressstore(SIMDVecMask<4> const & mask, int64_t * p) const {
+            __mmask8 t0 = __mmask8(mask.mMask & 0x0F);
+            uint32_t t1 = uint32_t(_mm_popcnt_u32(t0));
+            __m512i t2 = _mm512_maskz_compress_epi64(t0, _mm512_castsi256_si512(mVec));
+            _mm512_mask_storeu_epi64(p, __mmask8((1 << t1) - 1), t2);
+            return t1;
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
 #if defined(__AVX512VL__)
@@ -311,10 +363,37 @@ namespace SIMD {
 #endif
         }
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_i swizzle(SIMDSwizzle<4> const & sMask) const {
+            // Expand each 64-bit lane index i into the 32-bit index pair (2i, 2i+1).
+            __m256i t0 = _mm256_cvtepu32_epi64(sMask.mVec);
+            __m256i t1 = _mm256_slli_epi64(t0, 1);
+            __m256i t2 = _mm256_or_si256(t1, _mm256_slli_epi64(t1, 32));
+            __m256i t3 = _mm256_add_epi32(t2, _mm256_setr_epi32(0, 1, 0, 1, 0, 1, 0, 1));
+            __m256i t4 = _mm256_permutevar8x32_epi32(mVec, t3);
+            return SIMDVec_i(t4);
+        }
+        template<int i0, int i1, int i2, int i3>
+        UME_FORCE_INLINE SIMDVec_i swizzle() const {
+            __m256i t0 = _mm256_permute4x64_epi64(mVec, (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6));
+            return SIMDVec_i(t0);
+        }
         // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_i & swizzlea(SIMDSwizzle<4> const & sMask) {
+            SIMDVec_i t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
 
         // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() const {
+            __m256i t0 = sortLanes(mVec);
+            return SIMDVec_i(t0);
+        }
         // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() const {
+            __m256i t0 = reverseLanes(sortLanes(mVec));
+            return SIMDVec_i(t0);
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
@@ -385,13 +464,75 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi64(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi64(_mm512_castsi256_si512(mVec), mask.mMask, _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            return SIMDVec_i(t1);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int64_t b) const {
+            __m256i t0 = _mm256_set1_epi64x(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+            return SIMDVec_i(t1);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256i t0 = _mm256_set1_epi64x(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi64(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi64(_mm512_castsi256_si512(mVec), mask.mMask, _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            return SIMDVec_i(t2);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec = saturatedAdd(mVec, b.mVec);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi64(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi64(_mm512_castsi256_si512(mVec), mask.mMask, _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int64_t b) {
+            __m256i t0 = _mm256_set1_epi64x(b);
+            mVec = saturatedAdd(mVec, t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<4> const & mask, int64_t b) {
+            __m256i t0 = _mm256_set1_epi64x(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi64(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi64(_mm512_castsi256_si512(mVec), mask.mMask, _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_i postinc() {
             __m256i t0 = SET1_EPI64(1);
@@ -499,13 +640,75 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<4> const & mask, SIMDVec_i const & b) const {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi64(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi64(_mm512_castsi256_si512(mVec), mask.mMask, _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            return SIMDVec_i(t1);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int64_t b) const {
+            __m256i t0 = _mm256_set1_epi64x(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+            return SIMDVec_i(t1);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<4> const & mask, int64_t b) const {
+            __m256i t0 = _mm256_set1_epi64x(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi64(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi64(_mm512_castsi256_si512(mVec), mask.mMask, _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            return SIMDVec_i(t2);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec = saturatedSub(mVec, b.mVec);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<4> const & mask, SIMDVec_i const & b) {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi64(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi64(_mm512_castsi256_si512(mVec), mask.mMask, _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int64_t b) {
+            __m256i t0 = _mm256_set1_epi64x(b);
+            mVec = saturatedSub(mVec, t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<4> const & mask, int64_t b) {
+            __m256i t0 = _mm256_set1_epi64x(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi64(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi64(_mm512_castsi256_si512(mVec), mask.mMask, _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
             __m256i t0 = _mm256_sub_epi64(b.mVec, mVec);
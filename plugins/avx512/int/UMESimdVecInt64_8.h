@@ -100,6 +100,45 @@ namespace SIMD {
         UME_FORCE_INLINE explicit SIMDVec_i(__m512i & x) { mVec = x; }
         UME_FORCE_INLINE explicit SIMDVec_i(const __m512i & x) { mVec = x; }
 
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m512i saturatedAdd(__m512i const & a, __m512i const & b) {
+            __m512i t0 = _mm512_add_epi64(a, b);
+            __m512i t1 = _mm512_andnot_si512(_mm512_xor_si512(a, b), _mm512_xor_si512(a, t0));
+            __mmask8 m0 = _mm512_cmplt_epi64_mask(t1, _mm512_setzero_si512());
+            __m512i t2 = _mm512_xor_si512(_mm512_srai_epi64(a, 63), _mm512_set1_epi64(0x7FFFFFFFFFFFFFFFLL));
+            return _mm512_mask_mov_epi64(t0, m0, t2);
+        }
+        static UME_FORCE_INLINE __m512i saturatedSub(__m512i const & a, __m512i const & b) {
+            __m512i t0 = _mm512_sub_epi64(a, b);
+            __m512i t1 = _mm512_and_si512(_mm512_xor_si512(a, b), _mm512_xor_si512(a, t0));
+            __mmask8 m0 = _mm512_cmplt_epi64_mask(t1, _mm512_setzero_si512());
+            __m512i t2 = _mm512_xor_si512(_mm512_srai_epi64(a, 63), _mm512_set1_epi64(0x7FFFFFFFFFFFFFFFLL));
+            return _mm512_mask_mov_epi64(t0, m0, t2);
+        }
+
+        // Bitonic sorting network kernels used by SORTA/SORTD. Every step pairs
+        // each lane with a partner lane, and keeps the minimum or the maximum of
+        // the pair, as selected by bits of BLEND_MASK.
+        template<int BLEND_MASK>
+        static UME_FORCE_INLINE __m512i sortStep(__m512i const & a, __m512i const & b) {
+            return _mm512_mask_max_epi64(_mm512_min_epi64(a, b), __mmask8(BLEND_MASK), a, b);
+        }
+        // Sorts a bitonic sequence in ascending order.
+        static UME_FORCE_INLINE __m512i mergeLanes(__m512i a) {
+            a = sortStep<0xF0>(a, _mm512_shuffle_i64x2(a, a, 0x4E));
+            a = sortStep<0xCC>(a, _mm512_permutex_epi64(a, 0x4E));
+            a = sortStep<0xAA>(a, _mm512_shuffle_epi32(a, _MM_PERM_ENUM(0x4E)));
+            return a;
+        }
+        static UME_FORCE_INLINE __m512i sortLanes(__m512i a) {
+            a = sortStep<0x66>(a, _mm512_shuffle_epi32(a, _MM_PERM_ENUM(0x4E)));
+            a = sortStep<0x3C>(a, _mm512_permutex_epi64(a, 0x4E));
+            a = sortStep<0x5A>(a, _mm512_shuffle_epi32(a, _MM_PERM_ENUM(0x4E)));
+            return mergeLanes(a);
+        }
+        static UME_FORCE_INLINE __m512i reverseLanes(__m512i const & a) {
+            return _mm512_permutexvar_epi64(_mm512_setr_epi64(7, 6, 5, 4, 3, 2, 1, 0), a);
+        }
     public:
         constexpr static uint32_t length() { return 8; }
         constexpr static uint32_t alignment() { return 64; }
@@ -215,6 +254,11 @@ namespace SIMD {
             mVec = _mm512_mask_load_epi64(mVec, mask.mMask, p);
             return *this;
         }
+        // LOADN
+        UME_FORCE_INLINE SIMDVec_i & loadn(uint32_t n, int64_t const * p) {
+            mVec = _mm512_maskz_loadu_epi64(SIMDVecMask<8>::prefix(n).mMask, p);
+            return *this;
+        }
         // STORE
         UME_FORCE_INLINE int64_t* store(int64_t* p) const {
             _mm512_storeu_si512((__m512i *)p, mVec);
@@ -225,6 +269,11 @@ namespace SIMD {
             _mm512_mask_storeu_epi64(p, mask.mMask, mVec);
             return p;
         }
+        // STOREN
+        UME_FORCE_INLINE int64_t* storen(uint32_t n, int64_t * p) const {
+            _mm512_mask_storeu_epi64(p, SIMDVecMask<8>::prefix(n).mMask, mVec);
+            return p;
+        }
         // STOREA
         UME_FORCE_INLINE int64_t* storea(int64_t* p) const {
             _mm512_store_si512((__m512i *)p, mVec);
@@ -236,6 +285,14 @@ namespace SIMD {
             return p;
         }
 
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressstore(SIMDVecMask<8> const & mask, int64_t * p) const {
+            __mmask8 t0 = __mmask8(mask.mMask);
+            uint32_t t1 = uint32_t(_mm_popcnt_u32(t0));
+            __m512i t2 = _mm512_maskz_compress_epi64(t0, mVec);
+            _mm512_mask_storeu_epi64(p, __mmask8((1 << t1) - 1), t2);
+            return t1;
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
             __m512i t0 = _mm512_mask_mov_epi64(mVec, mask.mMask, b.mVec);
@@ -247,7 +304,40 @@ namespace SIMD {
             return SIMDVec_i(t0);
         }
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_i swizzle(SIMDSwizzle<8> const & sMask) const {
+            __m512i t0 = _mm512_cvtepu32_epi64(sMask.mVec);
+            __m512i t1 = _mm512_permutexvar_epi64(t0, mVec);
+            return SIMDVec_i(t1);
+        }
+        template<int i0, int i1, int i2, int i3, int i4, int i5, int i6, int i7>
+        UME_FORCE_INLINE SIMDVec_i swizzle() const {
+            const int imm = (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6);
+            // Patterns repeated in both 256-bit lanes need only an immediate permute.
+            if (i0 < 4 && i1 < 4 && i2 < 4 && i3 < 4 && i4 == i0 + 4 && i5 == i1 + 4 &&
+                i6 == i2 + 4 && i7 == i3 + 4) {
+                __m512i t0 = _mm512_permutex_epi64(mVec, imm);
+                return SIMDVec_i(t0);
+            }
+            __m512i t1 = _mm512_setr_epi64(i0, i1, i2, i3, i4, i5, i6, i7);
+            __m512i t2 = _mm512_permutexvar_epi64(t1, mVec);
+            return SIMDVec_i(t2);
+        }
         // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_i & swizzlea(SIMDSwizzle<8> const & sMask) {
+            SIMDVec_i t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() const {
+            __m512i t0 = sortLanes(mVec);
+            return SIMDVec_i(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() const {
+            __m512i t0 = reverseLanes(sortLanes(mVec));
+            return SIMDVec_i(t0);
+        }
 
         // ADDV
         UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
@@ -302,13 +392,53 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m512i t0 = saturatedAdd(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = saturatedAdd(mVec, b.mVec);
+            __m512i t1 = _mm512_mask_mov_epi64(mVec, mask.mMask, t0);
+            return SIMDVec_i(t1);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int64_t b) const {
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedAdd(mVec, t0);
+            return SIMDVec_i(t1);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<8> const & mask, int64_t b) const {
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedAdd(mVec, t0);
+            __m512i t2 = _mm512_mask_mov_epi64(mVec, mask.mMask, t1);
+            return SIMDVec_i(t2);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec = saturatedAdd(mVec, b.mVec);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m512i t0 = saturatedAdd(mVec, b.mVec);
+            mVec = _mm512_mask_mov_epi64(mVec, mask.mMask, t0);
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int64_t b) {
+            __m512i t0 = _mm512_set1_epi64(b);
+            mVec = saturatedAdd(mVec, t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<8> const & mask, int64_t b) {
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedAdd(mVec, t0);
+            mVec = _mm512_mask_mov_epi64(mVec, mask.mMask, t1);
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_i postinc() {
             __m512i t0 = _mm512_set1_epi64(1);
@@ -392,13 +522,53 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m512i t0 = saturatedSub(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = saturatedSub(mVec, b.mVec);
+            __m512i t1 = _mm512_mask_mov_epi64(mVec, mask.mMask, t0);
+            return SIMDVec_i(t1);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int64_t b) const {
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedSub(mVec, t0);
+            return SIMDVec_i(t1);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<8> const & mask, int64_t b) const {
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedSub(mVec, t0);
+            __m512i t2 = _mm512_mask_mov_epi64(mVec, mask.mMask, t1);
+            return SIMDVec_i(t2);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec = saturatedSub(mVec, b.mVec);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m512i t0 = saturatedSub(mVec, b.mVec);
+            mVec = _mm512_mask_mov_epi64(mVec, mask.mMask, t0);
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int64_t b) {
+            __m512i t0 = _mm512_set1_epi64(b);
+            mVec = saturatedSub(mVec, t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<8> const & mask, int64_t b) {
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedSub(mVec, t0);
+            mVec = _mm512_mask_mov_epi64(mVec, mask.mMask, t1);
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
             __m512i t0 = _mm512_sub_epi64(b.mVec, mVec);
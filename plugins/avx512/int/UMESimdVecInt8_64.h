@@ -0,0 +1,1684 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_INT8_64_H_
+#define UME_SIMD_VEC_INT8_64_H_
+
+#include <type_traits>
+#include <immintrin.h>
+
+#include "../../../UMESimdInterface.h"
+
+#if defined(__AVX512BW__)
+
+namespace UME {
+namespace SIMD {
+
+    template<>
+    class SIMDVec_i<int8_t, 64> :
+        public SIMDVecSignedInterface<
+            SIMDVec_i<int8_t, 64>,
+            SIMDVec_u<uint8_t, 64>,
+            int8_t,
+            64,
+            uint8_t,
+            SIMDVecMask<64>,
+            SIMDSwizzle<64 >> ,
+        public SIMDVecPackableInterface<
+            SIMDVec_i<int8_t, 64>,
+            SIMDVec_i<int8_t, 32 >>
+    {
+    public:
+        // Conversion operators require access to private members.
+        friend class SIMDVec_u<uint8_t, 64>;
+        friend class SIMDVec_i<int16_t, 64>;
+    private:
+        __m512i mVec;
+
+        UME_FORCE_INLINE explicit SIMDVec_i(__m512i & x) { mVec = x; }
+        UME_FORCE_INLINE explicit SIMDVec_i(const __m512i & x) { mVec = x; }
+    public:
+
+        constexpr static uint32_t length() { return 64; }
+        constexpr static uint32_t alignment() { return 64; }
+
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_i() {}
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_i(int8_t i) {
+            mVec = _mm512_set1_epi8(i);
+        }
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_i(
+            T i, 
+            typename std::enable_if< std::is_fundamental<T>::value && 
+                                    !std::is_same<T, int8_t>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_i(static_cast<int8_t>(i)) {}
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVec_i(int8_t const *p) {
+            this->load(p);
+        }
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVec_i(int8_t i0, int8_t i1, int8_t i2, int8_t i3,
+                                   int8_t i4, int8_t i5, int8_t i6, int8_t i7,
+                                   int8_t i8, int8_t i9, int8_t i10, int8_t i11,
+                                   int8_t i12, int8_t i13, int8_t i14, int8_t i15,
+                                   int8_t i16, int8_t i17, int8_t i18, int8_t i19,
+                                   int8_t i20, int8_t i21, int8_t i22, int8_t i23,
+                                   int8_t i24, int8_t i25, int8_t i26, int8_t i27,
+                                   int8_t i28, int8_t i29, int8_t i30, int8_t i31,
+                                   int8_t i32, int8_t i33, int8_t i34, int8_t i35,
+                                   int8_t i36, int8_t i37, int8_t i38, int8_t i39,
+                                   int8_t i40, int8_t i41, int8_t i42, int8_t i43,
+                                   int8_t i44, int8_t i45, int8_t i46, int8_t i47,
+                                   int8_t i48, int8_t i49, int8_t i50, int8_t i51,
+                                   int8_t i52, int8_t i53, int8_t i54, int8_t i55,
+                                   int8_t i56, int8_t i57, int8_t i58, int8_t i59,
+                                   int8_t i60, int8_t i61, int8_t i62, int8_t i63)
+        {
+            alignas(64) int8_t raw[64] = {
+                i0, i1, i2, i3, i4, i5, i6, i7,
+                i8, i9, i10, i11, i12, i13, i14, i15,
+                i16, i17, i18, i19, i20, i21, i22, i23,
+                i24, i25, i26, i27, i28, i29, i30, i31,
+                i32, i33, i34, i35, i36, i37, i38, i39,
+                i40, i41, i42, i43, i44, i45, i46, i47,
+                i48, i49, i50, i51, i52, i53, i54, i55,
+                i56, i57, i58, i59, i60, i61, i62, i63 };
+            mVec = _mm512_load_si512((__m512i*)raw);
+        }
+        // EXTRACT
+        UME_FORCE_INLINE int8_t extract(uint32_t index) const {
+            alignas(64) int8_t raw[64];
+            _mm512_store_si512((__m512i*)raw, mVec);
+            return raw[index];
+        }
+        UME_FORCE_INLINE int8_t operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_i & insert(uint32_t index, int8_t value) {
+            alignas(64) int8_t raw[64];
+            _mm512_store_si512((__m512i*)raw, mVec);
+            raw[index] = value;
+            mVec = _mm512_load_si512((__m512i*)raw);
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_i, int8_t> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_i, int8_t>(index, static_cast<SIMDVec_i &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_i, int8_t, SIMDVecMask<64>> operator() (SIMDVecMask<64> const & mask) {
+            return IntermediateMask<SIMDVec_i, int8_t, SIMDVecMask<64>>(mask, static_cast<SIMDVec_i &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_i, int8_t, SIMDVecMask<64>> operator[] (SIMDVecMask<64> const & mask) {
+            return IntermediateMask<SIMDVec_i, int8_t, SIMDVecMask<64>>(mask, static_cast<SIMDVec_i &>(*this));
+        }
+#endif
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVec_i const & b) {
+            mVec = b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator= (SIMDVec_i const & b) {
+            return assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVecMask<64> const & mask, SIMDVec_i const & b) {
+            mVec = _mm512_mask_mov_epi8(mVec, mask.mMask, b.mVec);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_i & assign(int8_t b) {
+            mVec = _mm512_set1_epi8(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator= (int8_t b) {
+            return assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVecMask<64> const & mask, int8_t b) {
+            mVec = _mm512_mask_mov_epi8(mVec, mask.mMask, _mm512_set1_epi8(b));
+            return *this;
+        }
+
+        // PREFETCH0
+        // PREFETCH1
+        // PREFETCH2
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_i & load(int8_t const *p) {
+            mVec = _mm512_loadu_si512((__m512i *)p);
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<64> const & mask, int8_t const *p) {
+            mVec = _mm512_mask_loadu_epi8(mVec, mask.mMask, p);
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_i & loada(int8_t const *p) {
+            mVec = _mm512_load_si512((__m512i *)p);
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<64> const & mask, int8_t const *p) {
+            mVec = _mm512_mask_loadu_epi8(mVec, mask.mMask, p);
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE int8_t* store(int8_t* p) const {
+            _mm512_storeu_si512((__m512i *)p, mVec);
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE int8_t* store(SIMDVecMask<64> const & mask, int8_t* p) const {
+            _mm512_mask_storeu_epi8(p, mask.mMask, mVec);
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE int8_t* storea(int8_t* p) const {
+            _mm512_store_si512((__m512i *)p, mVec);
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE int8_t* storea(SIMDVecMask<64> const & mask, int8_t* p) const {
+            _mm512_mask_storeu_epi8(p, mask.mMask, mVec);
+            return p;
+        }
+
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<64> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_mask_mov_epi8(mVec, mask.mMask, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_mask_mov_epi8(mVec, mask.mMask, _mm512_set1_epi8(b));
+            return SIMDVec_i(t0);
+        }
+        // SWIZZLE
+        // SWIZZLEA
+
+        // SORTA
+        // SORTD
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_add_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator+ (SIMDVec_i const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVecMask<64> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_mask_add_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_i add(int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_add_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator+ (int8_t b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_mask_add_epi8(mVec, mask.mMask, mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVec_i const & b) {
+            mVec = _mm512_add_epi8(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator+= (SIMDVec_i const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVecMask<64> const & mask, SIMDVec_i const & b) {
+            mVec = _mm512_mask_add_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_i & adda(int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_add_epi8(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator+= (int8_t b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVecMask<64> const & mask, int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_mask_add_epi8(mVec, mask.mMask, mVec, t0);
+            return *this;
+        }
+        // POSTINC
+        UME_FORCE_INLINE SIMDVec_i postinc() {
+            __m512i t0 = _mm512_set1_epi8(1);
+            __m512i t1 = mVec;
+            mVec = _mm512_add_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator++ (int) {
+            return postinc();
+        }
+        // MPOSTINC
+        UME_FORCE_INLINE SIMDVec_i postinc(SIMDVecMask<64> const & mask) {
+            __m512i t0 = _mm512_set1_epi8(1);
+            __m512i t1 = mVec;
+            mVec = _mm512_mask_add_epi8(mVec, mask.mMask, mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // PREFINC
+        UME_FORCE_INLINE SIMDVec_i & prefinc() {
+            __m512i t0 = _mm512_set1_epi8(1);
+            mVec = _mm512_add_epi8(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator++ () {
+            return prefinc();
+        }
+        // MPREFINC
+        UME_FORCE_INLINE SIMDVec_i & prefinc(SIMDVecMask<64> const & mask) {
+            __m512i t0 = _mm512_set1_epi8(1);
+            mVec = _mm512_mask_add_epi8(mVec, mask.mMask, mVec, t0);
+            return *this;
+        }
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_adds_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<64> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_mask_adds_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_adds_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_mask_adds_epi8(mVec, mask.mMask, mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec = _mm512_adds_epi8(mVec, b.mVec);
+            return *this;
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<64> const & mask, SIMDVec_i const & b) {
+            mVec = _mm512_mask_adds_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return *this;
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_adds_epi8(mVec, t0);
+            return *this;
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<64> const & mask, int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_mask_adds_epi8(mVec, mask.mMask, mVec, t0);
+            return *this;
+        }
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_sub_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- (SIMDVec_i const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVecMask<64> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_mask_sub_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_i sub(int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_sub_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- (int8_t b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_mask_sub_epi8(mVec, mask.mMask, mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVec_i const & b) {
+            mVec = _mm512_sub_epi8(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-= (SIMDVec_i const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVecMask<64> const & mask, SIMDVec_i const & b) {
+            mVec = _mm512_mask_sub_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_i & suba(int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_sub_epi8(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-= (int8_t b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVecMask<64> const & mask, int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_mask_sub_epi8(mVec, mask.mMask, mVec, t0);
+            return *this;
+        }
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_subs_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<64> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_mask_subs_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_subs_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_mask_subs_epi8(mVec, mask.mMask, mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec = _mm512_subs_epi8(mVec, b.mVec);
+            return *this;
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<64> const & mask, SIMDVec_i const & b) {
+            mVec = _mm512_mask_subs_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return *this;
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_subs_epi8(mVec, t0);
+            return *this;
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<64> const & mask, int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_mask_subs_epi8(mVec, mask.mMask, mVec, t0);
+            return *this;
+        }
+        // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_sub_epi8(b.mVec, mVec);
+            return SIMDVec_i(t0);
+        }
+        // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVecMask<64> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_mask_sub_epi8(b.mVec, mask.mMask, b.mVec, mVec);
+            return SIMDVec_i(t0);
+        }
+        // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_i subfrom(int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_sub_epi8(t0, mVec);
+            return SIMDVec_i(t1);
+        }
+        // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_mask_sub_epi8(t0, mask.mMask, t0, mVec);
+            return SIMDVec_i(t1);
+        }
+        // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVec_i const & b) {
+            mVec = _mm512_sub_epi8(b.mVec, mVec);
+            return *this;
+        }
+        // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVecMask<64> const & mask, SIMDVec_i const & b) {
+            mVec = _mm512_mask_sub_epi8(b.mVec, mask.mMask, b.mVec, mVec);
+            return *this;
+        }
+        // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_sub_epi8(t0, mVec);
+            return *this;
+        }
+        // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVecMask<64> const & mask, int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_mask_sub_epi8(t0, mask.mMask, t0, mVec);
+            return *this;
+        }
+        // POSTDEC
+        UME_FORCE_INLINE SIMDVec_i postdec() {
+            __m512i t0 = _mm512_set1_epi8(1);
+            __m512i t1 = mVec;
+            mVec = _mm512_sub_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator-- (int) {
+            return postdec();
+        }
+        // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_i postdec(SIMDVecMask<64> const & mask) {
+            __m512i t0 = _mm512_set1_epi8(1);
+            __m512i t1 = mVec;
+            mVec = _mm512_mask_sub_epi8(mVec, mask.mMask, mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // PREFDEC
+        UME_FORCE_INLINE SIMDVec_i & prefdec() {
+            __m512i t0 = _mm512_set1_epi8(1);
+            mVec = _mm512_sub_epi8(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-- () {
+            return prefdec();
+        }
+        // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_i & prefdec(SIMDVecMask<64> const & mask) {
+            __m512i t0 = _mm512_set1_epi8(1);
+            mVec = _mm512_mask_sub_epi8(mVec, mask.mMask, mVec, t0);
+            return *this;
+        }
+        // MULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_mullo_epi16(mVec, b.mVec);
+            __m512i t1 = _mm512_mullo_epi16(_mm512_srli_epi16(mVec, 8), _mm512_srli_epi16(b.mVec, 8));
+            __m512i t2 = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t0, _mm512_slli_epi16(t1, 8));
+            return SIMDVec_i(t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (SIMDVec_i const & b) const {
+            return mul(b);
+        }
+        // MMULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<64> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_mullo_epi16(mVec, b.mVec);
+            __m512i t1 = _mm512_mullo_epi16(_mm512_srli_epi16(mVec, 8), _mm512_srli_epi16(b.mVec, 8));
+            __m512i t2 = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t0, _mm512_slli_epi16(t1, 8));
+            __m512i t3 = _mm512_mask_mov_epi8(mVec, mask.mMask, t2);
+            return SIMDVec_i(t3);
+        }
+        // MULS
+        UME_FORCE_INLINE SIMDVec_i mul(int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_mullo_epi16(mVec, t0);
+            __m512i t2 = _mm512_mullo_epi16(_mm512_srli_epi16(mVec, 8), _mm512_srli_epi16(t0, 8));
+            __m512i t3 = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t1, _mm512_slli_epi16(t2, 8));
+            return SIMDVec_i(t3);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (int8_t b) const {
+            return mul(b);
+        }
+        // MMULS
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_mullo_epi16(mVec, t0);
+            __m512i t2 = _mm512_mullo_epi16(_mm512_srli_epi16(mVec, 8), _mm512_srli_epi16(t0, 8));
+            __m512i t3 = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t1, _mm512_slli_epi16(t2, 8));
+            __m512i t4 = _mm512_mask_mov_epi8(mVec, mask.mMask, t3);
+            return SIMDVec_i(t4);
+        }
+        // MULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVec_i const & b) {
+            __m512i t0 = _mm512_mullo_epi16(mVec, b.mVec);
+            __m512i t1 = _mm512_mullo_epi16(_mm512_srli_epi16(mVec, 8), _mm512_srli_epi16(b.mVec, 8));
+            mVec = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t0, _mm512_slli_epi16(t1, 8));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (SIMDVec_i const & b) {
+            return mula(b);
+        }
+        // MMULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<64> const & mask, SIMDVec_i const & b) {
+            __m512i t0 = _mm512_mullo_epi16(mVec, b.mVec);
+            __m512i t1 = _mm512_mullo_epi16(_mm512_srli_epi16(mVec, 8), _mm512_srli_epi16(b.mVec, 8));
+            __m512i t2 = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t0, _mm512_slli_epi16(t1, 8));
+            mVec = _mm512_mask_mov_epi8(mVec, mask.mMask, t2);
+            return *this;
+        }
+        // MULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_mullo_epi16(mVec, t0);
+            __m512i t2 = _mm512_mullo_epi16(_mm512_srli_epi16(mVec, 8), _mm512_srli_epi16(t0, 8));
+            mVec = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t1, _mm512_slli_epi16(t2, 8));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (int8_t b) {
+            return mula(b);
+        }
+        // MMULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<64> const & mask, int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_mullo_epi16(mVec, t0);
+            __m512i t2 = _mm512_mullo_epi16(_mm512_srli_epi16(mVec, 8), _mm512_srli_epi16(t0, 8));
+            __m512i t3 = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t1, _mm512_slli_epi16(t2, 8));
+            mVec = _mm512_mask_mov_epi8(mVec, mask.mMask, t3);
+            return *this;
+        }
+        // DIVV
+        // MDIVV
+        // DIVS
+        // MDIVS
+        // DIVVA
+        // MDIVVA
+        // DIVSA
+        // MDIVSA
+        // RCP
+        // MRCP
+        // RCPS
+        // MRCPS
+        // RCPA
+        // MRCPA
+        // RCPSA
+        // MRCPSA
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<64> cmpeq(SIMDVec_i const & b) const {
+            __mmask64 t0 = _mm512_cmpeq_epi8_mask(mVec, b.mVec);
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator== (SIMDVec_i const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<64> cmpeq(int8_t b) const {
+            __mmask64 t0 = _mm512_cmpeq_epi8_mask(mVec, _mm512_set1_epi8(b));
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator== (int8_t b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<64> cmpne(SIMDVec_i const & b) const {
+            __mmask64 t0 = _mm512_cmpneq_epi8_mask(mVec, b.mVec);
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator!= (SIMDVec_i const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<64> cmpne(int8_t b) const {
+            __mmask64 t0 = _mm512_cmpneq_epi8_mask(mVec, _mm512_set1_epi8(b));
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator!= (int8_t b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<64> cmpgt(SIMDVec_i const & b) const {
+            __mmask64 t0 = _mm512_cmpgt_epi8_mask(mVec, b.mVec);
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator> (SIMDVec_i const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<64> cmpgt(int8_t b) const {
+            __mmask64 t0 = _mm512_cmpgt_epi8_mask(mVec, _mm512_set1_epi8(b));
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator> (int8_t b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<64> cmplt(SIMDVec_i const & b) const {
+            __mmask64 t0 = _mm512_cmplt_epi8_mask(mVec, b.mVec);
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator< (SIMDVec_i const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<64> cmplt(int8_t b) const {
+            __mmask64 t0 = _mm512_cmplt_epi8_mask(mVec, _mm512_set1_epi8(b));
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator< (int8_t b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<64> cmpge(SIMDVec_i const & b) const {
+            __mmask64 t0 = _mm512_cmpge_epi8_mask(mVec, b.mVec);
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator>= (SIMDVec_i const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<64> cmpge(int8_t b) const {
+            __mmask64 t0 = _mm512_cmpge_epi8_mask(mVec, _mm512_set1_epi8(b));
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator>= (int8_t b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<64> cmple(SIMDVec_i const & b) const {
+            __mmask64 t0 = _mm512_cmple_epi8_mask(mVec, b.mVec);
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator<= (SIMDVec_i const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<64> cmple(int8_t b) const {
+            __mmask64 t0 = _mm512_cmple_epi8_mask(mVec, _mm512_set1_epi8(b));
+            SIMDVecMask<64> ret_mask;
+            ret_mask.mMask = t0;
+            return ret_mask;
+        }
+        UME_FORCE_INLINE SIMDVecMask<64> operator<= (int8_t b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_i const & b) const {
+            __mmask64 t0 = _mm512_cmpeq_epi8_mask(mVec, b.mVec);
+            return (t0 == 0xFFFFFFFFFFFFFFFF);
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(int8_t b) const {
+            __mmask64 t0 = _mm512_cmpeq_epi8_mask(mVec, _mm512_set1_epi8(b));
+            return (t0 == 0xFFFFFFFFFFFFFFFF);
+        }
+        // UNIQUE
+        // HADD
+        UME_FORCE_INLINE int8_t hadd() const {
+            __m512i t0 = _mm512_sad_epu8(mVec, _mm512_setzero_si512());
+            __m256i t1 = _mm256_add_epi64(_mm512_castsi512_si256(t0), _mm512_extracti64x4_epi64(t0, 1));
+            __m128i t2 = _mm_add_epi64(_mm256_castsi256_si128(t1), _mm256_extracti128_si256(t1, 1));
+            int8_t retval = int8_t(_mm_extract_epi16(t2, 0) + _mm_extract_epi16(t2, 4));
+            return retval;
+        }
+        // HADDS
+        UME_FORCE_INLINE int8_t hadd(int8_t b) const {
+            __m512i t0 = _mm512_sad_epu8(mVec, _mm512_setzero_si512());
+            __m256i t1 = _mm256_add_epi64(_mm512_castsi512_si256(t0), _mm512_extracti64x4_epi64(t0, 1));
+            __m128i t2 = _mm_add_epi64(_mm256_castsi256_si128(t1), _mm256_extracti128_si256(t1, 1));
+            int8_t retval = int8_t(_mm_extract_epi16(t2, 0) + _mm_extract_epi16(t2, 4));
+            return int8_t(retval + b);
+        }
+        // MHADD
+        UME_FORCE_INLINE int8_t hadd(SIMDVecMask<64> const & mask) const {
+            __m512i t0 = _mm512_maskz_mov_epi8(mask.mMask, mVec);
+            __m512i t1 = _mm512_sad_epu8(t0, _mm512_setzero_si512());
+            __m256i t2 = _mm256_add_epi64(_mm512_castsi512_si256(t1), _mm512_extracti64x4_epi64(t1, 1));
+            __m128i t3 = _mm_add_epi64(_mm256_castsi256_si128(t2), _mm256_extracti128_si256(t2, 1));
+            int8_t retval = int8_t(_mm_extract_epi16(t3, 0) + _mm_extract_epi16(t3, 4));
+            return retval;
+        }
+        // MHADDS
+        UME_FORCE_INLINE int8_t hadd(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_maskz_mov_epi8(mask.mMask, mVec);
+            __m512i t1 = _mm512_sad_epu8(t0, _mm512_setzero_si512());
+            __m256i t2 = _mm256_add_epi64(_mm512_castsi512_si256(t1), _mm512_extracti64x4_epi64(t1, 1));
+            __m128i t3 = _mm_add_epi64(_mm256_castsi256_si128(t2), _mm256_extracti128_si256(t2, 1));
+            int8_t retval = int8_t(_mm_extract_epi16(t3, 0) + _mm_extract_epi16(t3, 4));
+            return int8_t(retval + b);
+        }
+        // HMUL
+        // MHMUL
+        // HMULS
+        // MHMULS
+
+        // FMULADDV
+        UME_FORCE_INLINE SIMDVec_i fmuladd(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m512i t0 = _mm512_mullo_epi16(mVec, b.mVec);
+            __m512i t1 = _mm512_mullo_epi16(_mm512_srli_epi16(mVec, 8), _mm512_srli_epi16(b.mVec, 8));
+            __m512i t2 = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t0, _mm512_slli_epi16(t1, 8));
+            __m512i t3 = _mm512_add_epi8(t2, c.mVec);
+            return SIMDVec_i(t3);
+        }
+        // MFMULADDV
+        UME_FORCE_INLINE SIMDVec_i fmuladd(SIMDVecMask<64> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m512i t0 = _mm512_mullo_epi16(mVec, b.mVec);
+            __m512i t1 = _mm512_mullo_epi16(_mm512_srli_epi16(mVec, 8), _mm512_srli_epi16(b.mVec, 8));
+            __m512i t2 = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t0, _mm512_slli_epi16(t1, 8));
+            __m512i t3 = _mm512_mask_add_epi8(mVec, mask.mMask, t2, c.mVec);
+            return SIMDVec_i(t3);
+        }
+        // FMULSUBV
+        UME_FORCE_INLINE SIMDVec_i fmulsub(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m512i t0 = _mm512_mullo_epi16(mVec, b.mVec);
+            __m512i t1 = _mm512_mullo_epi16(_mm512_srli_epi16(mVec, 8), _mm512_srli_epi16(b.mVec, 8));
+            __m512i t2 = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t0, _mm512_slli_epi16(t1, 8));
+            __m512i t3 = _mm512_sub_epi8(t2, c.mVec);
+            return SIMDVec_i(t3);
+        }
+        // MFMULSUBV
+        UME_FORCE_INLINE SIMDVec_i fmulsub(SIMDVecMask<64> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m512i t0 = _mm512_mullo_epi16(mVec, b.mVec);
+            __m512i t1 = _mm512_mullo_epi16(_mm512_srli_epi16(mVec, 8), _mm512_srli_epi16(b.mVec, 8));
+            __m512i t2 = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t0, _mm512_slli_epi16(t1, 8));
+            __m512i t3 = _mm512_mask_sub_epi8(mVec, mask.mMask, t2, c.mVec);
+            return SIMDVec_i(t3);
+        }
+        // FADDMULV
+        UME_FORCE_INLINE SIMDVec_i faddmul(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m512i t0 = _mm512_add_epi8(mVec, b.mVec);
+            __m512i t1 = _mm512_mullo_epi16(t0, c.mVec);
+            __m512i t2 = _mm512_mullo_epi16(_mm512_srli_epi16(t0, 8), _mm512_srli_epi16(c.mVec, 8));
+            __m512i t3 = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t1, _mm512_slli_epi16(t2, 8));
+            return SIMDVec_i(t3);
+        }
+        // MFADDMULV
+        UME_FORCE_INLINE SIMDVec_i faddmul(SIMDVecMask<64> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m512i t0 = _mm512_add_epi8(mVec, b.mVec);
+            __m512i t1 = _mm512_mullo_epi16(t0, c.mVec);
+            __m512i t2 = _mm512_mullo_epi16(_mm512_srli_epi16(t0, 8), _mm512_srli_epi16(c.mVec, 8));
+            __m512i t3 = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t1, _mm512_slli_epi16(t2, 8));
+            __m512i t4 = _mm512_mask_mov_epi8(mVec, mask.mMask, t3);
+            return SIMDVec_i(t4);
+        }
+        // FSUBMULV
+        UME_FORCE_INLINE SIMDVec_i fsubmul(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m512i t0 = _mm512_sub_epi8(mVec, b.mVec);
+            __m512i t1 = _mm512_mullo_epi16(t0, c.mVec);
+            __m512i t2 = _mm512_mullo_epi16(_mm512_srli_epi16(t0, 8), _mm512_srli_epi16(c.mVec, 8));
+            __m512i t3 = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t1, _mm512_slli_epi16(t2, 8));
+            return SIMDVec_i(t3);
+        }
+        // MFSUBMULV
+        UME_FORCE_INLINE SIMDVec_i fsubmul(SIMDVecMask<64> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m512i t0 = _mm512_sub_epi8(mVec, b.mVec);
+            __m512i t1 = _mm512_mullo_epi16(t0, c.mVec);
+            __m512i t2 = _mm512_mullo_epi16(_mm512_srli_epi16(t0, 8), _mm512_srli_epi16(c.mVec, 8));
+            __m512i t3 = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t1, _mm512_slli_epi16(t2, 8));
+            __m512i t4 = _mm512_mask_mov_epi8(mVec, mask.mMask, t3);
+            return SIMDVec_i(t4);
+        }
+
+        // MAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_max_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MMAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<64> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_mask_max_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MAXS
+        UME_FORCE_INLINE SIMDVec_i max(int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_max_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MMAXS
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_mask_max_epi8(mVec, mask.mMask, mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVec_i const & b) {
+            mVec = _mm512_max_epi8(mVec, b.mVec);
+            return *this;
+        }
+        // MMAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<64> const & mask, SIMDVec_i const & b) {
+            mVec = _mm512_mask_max_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return *this;
+        }
+        // MAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_max_epi8(mVec, t0);
+            return *this;
+        }
+        // MMAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<64> const & mask, int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_mask_max_epi8(mVec, mask.mMask, mVec, t0);
+            return *this;
+        }
+        // MINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_min_epi8(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MMINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<64> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_mask_min_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MINS
+        UME_FORCE_INLINE SIMDVec_i min(int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_min_epi8(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MMINS
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_mask_min_epi8(mVec, mask.mMask, mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVec_i const & b) {
+            mVec = _mm512_min_epi8(mVec, b.mVec);
+            return *this;
+        }
+        // MMINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<64> const & mask, SIMDVec_i const & b) {
+            mVec = _mm512_mask_min_epi8(mVec, mask.mMask, mVec, b.mVec);
+            return *this;
+        }
+        // MINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_min_epi8(mVec, t0);
+            return *this;
+        }
+        // MMINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<64> const & mask, int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_mask_min_epi8(mVec, mask.mMask, mVec, t0);
+            return *this;
+        }
+        // HMAX
+        UME_FORCE_INLINE int8_t hmax() const {
+            __m256i t0 = _mm256_max_epi8(_mm512_castsi512_si256(mVec), _mm512_extracti64x4_epi64(mVec, 1));
+            __m128i t1 = _mm_max_epi8(_mm256_castsi256_si128(t0), _mm256_extracti128_si256(t0, 1));
+            __m128i t2 = _mm_max_epi8(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_max_epi8(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_max_epi8(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_max_epi8(t4, _mm_srli_si128(t4, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t5, 0));
+            return retval;
+        }
+        // MHMAX
+        UME_FORCE_INLINE int8_t hmax(SIMDVecMask<64> const & mask) const {
+            __m512i t0 = _mm512_mask_mov_epi8(_mm512_set1_epi8((char)0x80), mask.mMask, mVec);
+            __m256i t1 = _mm256_max_epi8(_mm512_castsi512_si256(t0), _mm512_extracti64x4_epi64(t0, 1));
+            __m128i t2 = _mm_max_epi8(_mm256_castsi256_si128(t1), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_max_epi8(t2, _mm_srli_si128(t2, 8));
+            __m128i t4 = _mm_max_epi8(t3, _mm_srli_si128(t3, 4));
+            __m128i t5 = _mm_max_epi8(t4, _mm_srli_si128(t4, 2));
+            __m128i t6 = _mm_max_epi8(t5, _mm_srli_si128(t5, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t6, 0));
+            return retval;
+        }
+        // IMAX
+        // MIMAX
+        // HMIN
+        UME_FORCE_INLINE int8_t hmin() const {
+            __m256i t0 = _mm256_min_epi8(_mm512_castsi512_si256(mVec), _mm512_extracti64x4_epi64(mVec, 1));
+            __m128i t1 = _mm_min_epi8(_mm256_castsi256_si128(t0), _mm256_extracti128_si256(t0, 1));
+            __m128i t2 = _mm_min_epi8(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_min_epi8(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_min_epi8(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_min_epi8(t4, _mm_srli_si128(t4, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t5, 0));
+            return retval;
+        }
+        // MHMIN
+        UME_FORCE_INLINE int8_t hmin(SIMDVecMask<64> const & mask) const {
+            __m512i t0 = _mm512_mask_mov_epi8(_mm512_set1_epi8(0x7F), mask.mMask, mVec);
+            __m256i t1 = _mm256_min_epi8(_mm512_castsi512_si256(t0), _mm512_extracti64x4_epi64(t0, 1));
+            __m128i t2 = _mm_min_epi8(_mm256_castsi256_si128(t1), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_min_epi8(t2, _mm_srli_si128(t2, 8));
+            __m128i t4 = _mm_min_epi8(t3, _mm_srli_si128(t3, 4));
+            __m128i t5 = _mm_min_epi8(t4, _mm_srli_si128(t4, 2));
+            __m128i t6 = _mm_min_epi8(t5, _mm_srli_si128(t5, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t6, 0));
+            return retval;
+        }
+        // IMIN
+        // MIMIN
+
+        // BANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_and_si512(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator& (SIMDVec_i const & b) const {
+            return band(b);
+        }
+        // MBANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<64> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_and_si512(mVec, b.mVec);
+            __m512i t1 = _mm512_mask_mov_epi8(mVec, mask.mMask, t0);
+            return SIMDVec_i(t1);
+        }
+        // BANDS
+        UME_FORCE_INLINE SIMDVec_i band(int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_and_si512(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator& (int8_t b) const {
+            return band(b);
+        }
+        // MBANDS
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_and_si512(mVec, t0);
+            __m512i t2 = _mm512_mask_mov_epi8(mVec, mask.mMask, t1);
+            return SIMDVec_i(t2);
+        }
+        // BANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVec_i const & b) {
+            mVec = _mm512_and_si512(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (SIMDVec_i const & b) {
+            return banda(b);
+        }
+        // MBANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<64> const & mask, SIMDVec_i const & b) {
+            __m512i t0 = _mm512_and_si512(mVec, b.mVec);
+            mVec = _mm512_mask_mov_epi8(mVec, mask.mMask, t0);
+            return *this;
+        }
+        // BANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_and_si512(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (int8_t b) {
+            return banda(b);
+        }
+        // MBANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<64> const & mask, int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_and_si512(mVec, t0);
+            mVec = _mm512_mask_mov_epi8(mVec, mask.mMask, t1);
+            return *this;
+        }
+        // BORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_or_si512(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (SIMDVec_i const & b) const {
+            return bor(b);
+        }
+        // MBORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<64> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_or_si512(mVec, b.mVec);
+            __m512i t1 = _mm512_mask_mov_epi8(mVec, mask.mMask, t0);
+            return SIMDVec_i(t1);
+        }
+        // BORS
+        UME_FORCE_INLINE SIMDVec_i bor(int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_or_si512(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (int8_t b) const {
+            return bor(b);
+        }
+        // MBORS
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_or_si512(mVec, t0);
+            __m512i t2 = _mm512_mask_mov_epi8(mVec, mask.mMask, t1);
+            return SIMDVec_i(t2);
+        }
+        // BORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVec_i const & b) {
+            mVec = _mm512_or_si512(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (SIMDVec_i const & b) {
+            return bora(b);
+        }
+        // MBORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<64> const & mask, SIMDVec_i const & b) {
+            __m512i t0 = _mm512_or_si512(mVec, b.mVec);
+            mVec = _mm512_mask_mov_epi8(mVec, mask.mMask, t0);
+            return *this;
+        }
+        // BORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_or_si512(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (int8_t b) {
+            return bora(b);
+        }
+        // MBORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<64> const & mask, int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_or_si512(mVec, t0);
+            mVec = _mm512_mask_mov_epi8(mVec, mask.mMask, t1);
+            return *this;
+        }
+        // BXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_xor_si512(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (SIMDVec_i const & b) const {
+            return bxor(b);
+        }
+        // MBXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<64> const & mask, SIMDVec_i const & b) const {
+            __m512i t0 = _mm512_xor_si512(mVec, b.mVec);
+            __m512i t1 = _mm512_mask_mov_epi8(mVec, mask.mMask, t0);
+            return SIMDVec_i(t1);
+        }
+        // BXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_xor_si512(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (int8_t b) const {
+            return bxor(b);
+        }
+        // MBXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_xor_si512(mVec, t0);
+            __m512i t2 = _mm512_mask_mov_epi8(mVec, mask.mMask, t1);
+            return SIMDVec_i(t2);
+        }
+        // BXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVec_i const & b) {
+            mVec = _mm512_xor_si512(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (SIMDVec_i const & b) {
+            return bxora(b);
+        }
+        // MBXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<64> const & mask, SIMDVec_i const & b) {
+            __m512i t0 = _mm512_xor_si512(mVec, b.mVec);
+            mVec = _mm512_mask_mov_epi8(mVec, mask.mMask, t0);
+            return *this;
+        }
+        // BXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            mVec = _mm512_xor_si512(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (int8_t b) {
+            return bxora(b);
+        }
+        // MBXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<64> const & mask, int8_t b) {
+            __m512i t0 = _mm512_set1_epi8(b);
+            __m512i t1 = _mm512_xor_si512(mVec, t0);
+            mVec = _mm512_mask_mov_epi8(mVec, mask.mMask, t1);
+            return *this;
+        }
+        // BNOT
+        UME_FORCE_INLINE SIMDVec_i bnot() const {
+            __m512i t0 = _mm512_xor_si512(mVec, _mm512_set1_epi32(0xFFFFFFFF));
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator~ () const {
+            return bnot();
+        }
+        // MBNOT
+        UME_FORCE_INLINE SIMDVec_i bnot(SIMDVecMask<64> const & mask) const {
+            __m512i t0 = _mm512_mask_sub_epi8(mVec, mask.mMask, _mm512_set1_epi32(0xFFFFFFFF), mVec);
+            return SIMDVec_i(t0);
+        }
+        // BNOTA
+        UME_FORCE_INLINE SIMDVec_i & bnota() {
+            mVec = _mm512_xor_si512(mVec, _mm512_set1_epi32(0xFFFFFFFF));
+            return *this;
+        }
+        // MBNOTA
+        UME_FORCE_INLINE SIMDVec_i & bnota(SIMDVecMask<64> const & mask) {
+            mVec = _mm512_mask_sub_epi8(mVec, mask.mMask, _mm512_set1_epi32(0xFFFFFFFF), mVec);
+            return *this;
+        }
+        // HBAND
+        UME_FORCE_INLINE int8_t hband() const {
+            __m256i t0 = _mm256_and_si256(_mm512_castsi512_si256(mVec), _mm512_extracti64x4_epi64(mVec, 1));
+            __m128i t1 = _mm_and_si128(_mm256_castsi256_si128(t0), _mm256_extracti128_si256(t0, 1));
+            __m128i t2 = _mm_and_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_and_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_and_si128(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_and_si128(t4, _mm_srli_si128(t4, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t5, 0));
+            return retval;
+        }
+        // HBANDS
+        UME_FORCE_INLINE int8_t hband(int8_t b) const {
+            __m256i t0 = _mm256_and_si256(_mm512_castsi512_si256(mVec), _mm512_extracti64x4_epi64(mVec, 1));
+            __m128i t1 = _mm_and_si128(_mm256_castsi256_si128(t0), _mm256_extracti128_si256(t0, 1));
+            __m128i t2 = _mm_and_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_and_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_and_si128(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_and_si128(t4, _mm_srli_si128(t4, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t5, 0));
+            return int8_t(retval & b);
+        }
+        // MHBAND
+        UME_FORCE_INLINE int8_t hband(SIMDVecMask<64> const & mask) const {
+            __m512i t0 = _mm512_mask_mov_epi8(_mm512_set1_epi32(0xFFFFFFFF), mask.mMask, mVec);
+            __m256i t1 = _mm256_and_si256(_mm512_castsi512_si256(t0), _mm512_extracti64x4_epi64(t0, 1));
+            __m128i t2 = _mm_and_si128(_mm256_castsi256_si128(t1), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_and_si128(t2, _mm_srli_si128(t2, 8));
+            __m128i t4 = _mm_and_si128(t3, _mm_srli_si128(t3, 4));
+            __m128i t5 = _mm_and_si128(t4, _mm_srli_si128(t4, 2));
+            __m128i t6 = _mm_and_si128(t5, _mm_srli_si128(t5, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t6, 0));
+            return retval;
+        }
+        // MHBANDS
+        UME_FORCE_INLINE int8_t hband(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_mask_mov_epi8(_mm512_set1_epi32(0xFFFFFFFF), mask.mMask, mVec);
+            __m256i t1 = _mm256_and_si256(_mm512_castsi512_si256(t0), _mm512_extracti64x4_epi64(t0, 1));
+            __m128i t2 = _mm_and_si128(_mm256_castsi256_si128(t1), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_and_si128(t2, _mm_srli_si128(t2, 8));
+            __m128i t4 = _mm_and_si128(t3, _mm_srli_si128(t3, 4));
+            __m128i t5 = _mm_and_si128(t4, _mm_srli_si128(t4, 2));
+            __m128i t6 = _mm_and_si128(t5, _mm_srli_si128(t5, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t6, 0));
+            return int8_t(retval & b);
+        }
+        // HBOR
+        UME_FORCE_INLINE int8_t hbor() const {
+            __m256i t0 = _mm256_or_si256(_mm512_castsi512_si256(mVec), _mm512_extracti64x4_epi64(mVec, 1));
+            __m128i t1 = _mm_or_si128(_mm256_castsi256_si128(t0), _mm256_extracti128_si256(t0, 1));
+            __m128i t2 = _mm_or_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_or_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_or_si128(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_or_si128(t4, _mm_srli_si128(t4, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t5, 0));
+            return retval;
+        }
+        // HBORS
+        UME_FORCE_INLINE int8_t hbor(int8_t b) const {
+            __m256i t0 = _mm256_or_si256(_mm512_castsi512_si256(mVec), _mm512_extracti64x4_epi64(mVec, 1));
+            __m128i t1 = _mm_or_si128(_mm256_castsi256_si128(t0), _mm256_extracti128_si256(t0, 1));
+            __m128i t2 = _mm_or_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_or_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_or_si128(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_or_si128(t4, _mm_srli_si128(t4, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t5, 0));
+            return int8_t(retval | b);
+        }
+        // MHBOR
+        UME_FORCE_INLINE int8_t hbor(SIMDVecMask<64> const & mask) const {
+            __m512i t0 = _mm512_maskz_mov_epi8(mask.mMask, mVec);
+            __m256i t1 = _mm256_or_si256(_mm512_castsi512_si256(t0), _mm512_extracti64x4_epi64(t0, 1));
+            __m128i t2 = _mm_or_si128(_mm256_castsi256_si128(t1), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_or_si128(t2, _mm_srli_si128(t2, 8));
+            __m128i t4 = _mm_or_si128(t3, _mm_srli_si128(t3, 4));
+            __m128i t5 = _mm_or_si128(t4, _mm_srli_si128(t4, 2));
+            __m128i t6 = _mm_or_si128(t5, _mm_srli_si128(t5, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t6, 0));
+            return retval;
+        }
+        // MHBORS
+        UME_FORCE_INLINE int8_t hbor(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_maskz_mov_epi8(mask.mMask, mVec);
+            __m256i t1 = _mm256_or_si256(_mm512_castsi512_si256(t0), _mm512_extracti64x4_epi64(t0, 1));
+            __m128i t2 = _mm_or_si128(_mm256_castsi256_si128(t1), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_or_si128(t2, _mm_srli_si128(t2, 8));
+            __m128i t4 = _mm_or_si128(t3, _mm_srli_si128(t3, 4));
+            __m128i t5 = _mm_or_si128(t4, _mm_srli_si128(t4, 2));
+            __m128i t6 = _mm_or_si128(t5, _mm_srli_si128(t5, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t6, 0));
+            return int8_t(retval | b);
+        }
+        // HBXOR
+        UME_FORCE_INLINE int8_t hbxor() const {
+            __m256i t0 = _mm256_xor_si256(_mm512_castsi512_si256(mVec), _mm512_extracti64x4_epi64(mVec, 1));
+            __m128i t1 = _mm_xor_si128(_mm256_castsi256_si128(t0), _mm256_extracti128_si256(t0, 1));
+            __m128i t2 = _mm_xor_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_xor_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_xor_si128(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_xor_si128(t4, _mm_srli_si128(t4, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t5, 0));
+            return retval;
+        }
+        // HBXORS
+        UME_FORCE_INLINE int8_t hbxor(int8_t b) const {
+            __m256i t0 = _mm256_xor_si256(_mm512_castsi512_si256(mVec), _mm512_extracti64x4_epi64(mVec, 1));
+            __m128i t1 = _mm_xor_si128(_mm256_castsi256_si128(t0), _mm256_extracti128_si256(t0, 1));
+            __m128i t2 = _mm_xor_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_xor_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_xor_si128(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_xor_si128(t4, _mm_srli_si128(t4, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t5, 0));
+            return int8_t(retval ^ b);
+        }
+        // MHBXOR
+        UME_FORCE_INLINE int8_t hbxor(SIMDVecMask<64> const & mask) const {
+            __m512i t0 = _mm512_maskz_mov_epi8(mask.mMask, mVec);
+            __m256i t1 = _mm256_xor_si256(_mm512_castsi512_si256(t0), _mm512_extracti64x4_epi64(t0, 1));
+            __m128i t2 = _mm_xor_si128(_mm256_castsi256_si128(t1), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_xor_si128(t2, _mm_srli_si128(t2, 8));
+            __m128i t4 = _mm_xor_si128(t3, _mm_srli_si128(t3, 4));
+            __m128i t5 = _mm_xor_si128(t4, _mm_srli_si128(t4, 2));
+            __m128i t6 = _mm_xor_si128(t5, _mm_srli_si128(t5, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t6, 0));
+            return retval;
+        }
+        // MHBXORS
+        UME_FORCE_INLINE int8_t hbxor(SIMDVecMask<64> const & mask, int8_t b) const {
+            __m512i t0 = _mm512_maskz_mov_epi8(mask.mMask, mVec);
+            __m256i t1 = _mm256_xor_si256(_mm512_castsi512_si256(t0), _mm512_extracti64x4_epi64(t0, 1));
+            __m128i t2 = _mm_xor_si128(_mm256_castsi256_si128(t1), _mm256_extracti128_si256(t1, 1));
+            __m128i t3 = _mm_xor_si128(t2, _mm_srli_si128(t2, 8));
+            __m128i t4 = _mm_xor_si128(t3, _mm_srli_si128(t3, 4));
+            __m128i t5 = _mm_xor_si128(t4, _mm_srli_si128(t4, 2));
+            __m128i t6 = _mm_xor_si128(t5, _mm_srli_si128(t5, 1));
+            int8_t retval = int8_t(_mm_extract_epi8(t6, 0));
+            return int8_t(retval ^ b);
+        }
+
+        // GATHERU
+        // MGATHERU
+        // GATHERS
+        // MGATHERS
+        // GATHERV
+        // MGATHERV
+        // SCATTERU
+        // MSCATTERU
+        // SCATTERS
+        // MSCATTERS
+        // SCATTERV
+        // MSCATTERV
+
+        // LSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVec_u<uint8_t, 64> const & b) const {
+            __m512i t0 = _mm512_and_si512(b.mVec, _mm512_set1_epi16(0x00FF));
+            __m512i t1 = _mm512_srli_epi16(b.mVec, 8);
+            __m512i t2 = _mm512_sllv_epi16(mVec, t0);
+            __m512i t3 = _mm512_sllv_epi16(_mm512_and_si512(mVec, _mm512_set1_epi16((short)0xFF00)), t1);
+            __m512i t4 = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t2, t3);
+            return SIMDVec_i(t4);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (SIMDVec_u<uint8_t, 64> const & b) const {
+            return lsh(b);
+        }
+        // MLSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<64> const & mask, SIMDVec_u<uint8_t, 64> const & b) const {
+            __m512i t0 = _mm512_and_si512(b.mVec, _mm512_set1_epi16(0x00FF));
+            __m512i t1 = _mm512_srli_epi16(b.mVec, 8);
+            __m512i t2 = _mm512_sllv_epi16(mVec, t0);
+            __m512i t3 = _mm512_sllv_epi16(_mm512_and_si512(mVec, _mm512_set1_epi16((short)0xFF00)), t1);
+            __m512i t4 = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t2, t3);
+            __m512i t5 = _mm512_mask_mov_epi8(mVec, mask.mMask, t4);
+            return SIMDVec_i(t5);
+        }
+        // LSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(uint8_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            char bmask = (b < 8) ? char(0xFF << b) : 0;
+            __m512i t1 = _mm512_sll_epi16(mVec, t0);
+            __m512i t2 = _mm512_and_si512(t1, _mm512_set1_epi8(bmask));
+            return SIMDVec_i(t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (uint8_t b) const {
+            return lsh(b);
+        }
+        // MLSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<64> const & mask, uint8_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            char bmask = (b < 8) ? char(0xFF << b) : 0;
+            __m512i t1 = _mm512_sll_epi16(mVec, t0);
+            __m512i t2 = _mm512_and_si512(t1, _mm512_set1_epi8(bmask));
+            __m512i t3 = _mm512_mask_mov_epi8(mVec, mask.mMask, t2);
+            return SIMDVec_i(t3);
+        }
+        // LSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVec_u<uint8_t, 64> const & b) {
+            __m512i t0 = _mm512_and_si512(b.mVec, _mm512_set1_epi16(0x00FF));
+            __m512i t1 = _mm512_srli_epi16(b.mVec, 8);
+            __m512i t2 = _mm512_sllv_epi16(mVec, t0);
+            __m512i t3 = _mm512_sllv_epi16(_mm512_and_si512(mVec, _mm512_set1_epi16((short)0xFF00)), t1);
+            mVec = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t2, t3);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (SIMDVec_u<uint8_t, 64> const & b) {
+            return lsha(b);
+        }
+        // MLSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<64> const & mask, SIMDVec_u<uint8_t, 64> const & b) {
+            __m512i t0 = _mm512_and_si512(b.mVec, _mm512_set1_epi16(0x00FF));
+            __m512i t1 = _mm512_srli_epi16(b.mVec, 8);
+            __m512i t2 = _mm512_sllv_epi16(mVec, t0);
+            __m512i t3 = _mm512_sllv_epi16(_mm512_and_si512(mVec, _mm512_set1_epi16((short)0xFF00)), t1);
+            __m512i t4 = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t2, t3);
+            mVec = _mm512_mask_mov_epi8(mVec, mask.mMask, t4);
+            return *this;
+        }
+        // LSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(uint8_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            char bmask = (b < 8) ? char(0xFF << b) : 0;
+            __m512i t1 = _mm512_sll_epi16(mVec, t0);
+            mVec = _mm512_and_si512(t1, _mm512_set1_epi8(bmask));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (uint8_t b) {
+            return lsha(b);
+        }
+        // MLSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<64> const & mask, uint8_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            char bmask = (b < 8) ? char(0xFF << b) : 0;
+            __m512i t1 = _mm512_sll_epi16(mVec, t0);
+            __m512i t2 = _mm512_and_si512(t1, _mm512_set1_epi8(bmask));
+            mVec = _mm512_mask_mov_epi8(mVec, mask.mMask, t2);
+            return *this;
+        }
+        // RSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVec_u<uint8_t, 64> const & b) const {
+            __m512i t0 = _mm512_and_si512(b.mVec, _mm512_set1_epi16(0x00FF));
+            __m512i t1 = _mm512_srli_epi16(b.mVec, 8);
+            __m512i t2 = _mm512_srav_epi16(_mm512_slli_epi16(mVec, 8), t0);
+            __m512i t3 = _mm512_srli_epi16(t2, 8);
+            __m512i t4 = _mm512_srav_epi16(mVec, t1);
+            __m512i t5 = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t3, t4);
+            return SIMDVec_i(t5);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (SIMDVec_u<uint8_t, 64> const & b) const {
+            return rsh(b);
+        }
+        // MRSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<64> const & mask, SIMDVec_u<uint8_t, 64> const & b) const {
+            __m512i t0 = _mm512_and_si512(b.mVec, _mm512_set1_epi16(0x00FF));
+            __m512i t1 = _mm512_srli_epi16(b.mVec, 8);
+            __m512i t2 = _mm512_srav_epi16(_mm512_slli_epi16(mVec, 8), t0);
+            __m512i t3 = _mm512_srli_epi16(t2, 8);
+            __m512i t4 = _mm512_srav_epi16(mVec, t1);
+            __m512i t5 = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t3, t4);
+            __m512i t6 = _mm512_mask_mov_epi8(mVec, mask.mMask, t5);
+            return SIMDVec_i(t6);
+        }
+        // RSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(uint8_t b) const {
+            uint32_t s = (b < 8) ? b : 7;
+            __m128i t0 = _mm_cvtsi32_si128(s);
+            char bmask = char(0xFF >> s);
+            char smask = char(0x80 >> s);
+            __m512i t1 = _mm512_srl_epi16(mVec, t0);
+            __m512i t2 = _mm512_and_si512(t1, _mm512_set1_epi8(bmask));
+            __m512i t3 = _mm512_set1_epi8(smask);
+            __m512i t4 = _mm512_xor_si512(t2, t3);
+            __m512i t5 = _mm512_sub_epi8(t4, t3);
+            return SIMDVec_i(t5);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (uint8_t b) const {
+            return rsh(b);
+        }
+        // MRSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<64> const & mask, uint8_t b) const {
+            uint32_t s = (b < 8) ? b : 7;
+            __m128i t0 = _mm_cvtsi32_si128(s);
+            char bmask = char(0xFF >> s);
+            char smask = char(0x80 >> s);
+            __m512i t1 = _mm512_srl_epi16(mVec, t0);
+            __m512i t2 = _mm512_and_si512(t1, _mm512_set1_epi8(bmask));
+            __m512i t3 = _mm512_set1_epi8(smask);
+            __m512i t4 = _mm512_xor_si512(t2, t3);
+            __m512i t5 = _mm512_sub_epi8(t4, t3);
+            __m512i t6 = _mm512_mask_mov_epi8(mVec, mask.mMask, t5);
+            return SIMDVec_i(t6);
+        }
+        // RSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVec_u<uint8_t, 64> const & b) {
+            __m512i t0 = _mm512_and_si512(b.mVec, _mm512_set1_epi16(0x00FF));
+            __m512i t1 = _mm512_srli_epi16(b.mVec, 8);
+            __m512i t2 = _mm512_srav_epi16(_mm512_slli_epi16(mVec, 8), t0);
+            __m512i t3 = _mm512_srli_epi16(t2, 8);
+            __m512i t4 = _mm512_srav_epi16(mVec, t1);
+            mVec = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t3, t4);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (SIMDVec_u<uint8_t, 64> const & b) {
+            return rsha(b);
+        }
+        // MRSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<64> const & mask, SIMDVec_u<uint8_t, 64> const & b) {
+            __m512i t0 = _mm512_and_si512(b.mVec, _mm512_set1_epi16(0x00FF));
+            __m512i t1 = _mm512_srli_epi16(b.mVec, 8);
+            __m512i t2 = _mm512_srav_epi16(_mm512_slli_epi16(mVec, 8), t0);
+            __m512i t3 = _mm512_srli_epi16(t2, 8);
+            __m512i t4 = _mm512_srav_epi16(mVec, t1);
+            __m512i t5 = _mm512_mask_blend_epi8(0xAAAAAAAAAAAAAAAA, t3, t4);
+            mVec = _mm512_mask_mov_epi8(mVec, mask.mMask, t5);
+            return *this;
+        }
+        // RSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(uint8_t b) {
+            uint32_t s = (b < 8) ? b : 7;
+            __m128i t0 = _mm_cvtsi32_si128(s);
+            char bmask = char(0xFF >> s);
+            char smask = char(0x80 >> s);
+            __m512i t1 = _mm512_srl_epi16(mVec, t0);
+            __m512i t2 = _mm512_and_si512(t1, _mm512_set1_epi8(bmask));
+            __m512i t3 = _mm512_set1_epi8(smask);
+            __m512i t4 = _mm512_xor_si512(t2, t3);
+            mVec = _mm512_sub_epi8(t4, t3);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (uint8_t b) {
+            return rsha(b);
+        }
+        // MRSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<64> const & mask, uint8_t b) {
+            uint32_t s = (b < 8) ? b : 7;
+            __m128i t0 = _mm_cvtsi32_si128(s);
+            char bmask = char(0xFF >> s);
+            char smask = char(0x80 >> s);
+            __m512i t1 = _mm512_srl_epi16(mVec, t0);
+            __m512i t2 = _mm512_and_si512(t1, _mm512_set1_epi8(bmask));
+            __m512i t3 = _mm512_set1_epi8(smask);
+            __m512i t4 = _mm512_xor_si512(t2, t3);
+            __m512i t5 = _mm512_sub_epi8(t4, t3);
+            mVec = _mm512_mask_mov_epi8(mVec, mask.mMask, t5);
+            return *this;
+        }
+        // ROLV
+        // MROLV
+        // ROLS
+        // MROLS
+        // ROLVA
+        // MROLVA
+        // ROLSA
+        // MROLSA
+        // RORV
+        // MRORV
+        // RORS
+        // MRORS
+        // RORVA
+        // MRORVA
+        // RORSA
+        // MRORSA
+
+        // NEG
+        UME_FORCE_INLINE SIMDVec_i neg() const {
+            __m512i t0 = _mm512_sub_epi8(_mm512_setzero_si512(), mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- () const {
+            return neg();
+        }
+        // MNEG
+        UME_FORCE_INLINE SIMDVec_i neg(SIMDVecMask<64> const & mask) const {
+            __m512i t0 = _mm512_mask_sub_epi8(mVec, mask.mMask, _mm512_setzero_si512(), mVec);
+            return SIMDVec_i(t0);
+        }
+        // NEGA
+        UME_FORCE_INLINE SIMDVec_i & nega() {
+            mVec = _mm512_sub_epi8(_mm512_setzero_si512(), mVec);
+            return *this;
+        }
+        // MNEGA
+        UME_FORCE_INLINE SIMDVec_i & nega(SIMDVecMask<64> const & mask) {
+            mVec = _mm512_mask_sub_epi8(mVec, mask.mMask, _mm512_setzero_si512(), mVec);
+            return *this;
+        }
+        // ABS
+        UME_FORCE_INLINE SIMDVec_i abs() const {
+            __m512i t0 = _mm512_abs_epi8(mVec);
+            return SIMDVec_i(t0);
+        }
+        // MABS
+        UME_FORCE_INLINE SIMDVec_i abs(SIMDVecMask<64> const & mask) const {
+            __m512i t0 = _mm512_mask_abs_epi8(mVec, mask.mMask, mVec);
+            return SIMDVec_i(t0);
+        }
+        // ABSA
+        UME_FORCE_INLINE SIMDVec_i & absa() {
+            mVec = _mm512_abs_epi8(mVec);
+            return *this;
+        }
+        // MABSA
+        UME_FORCE_INLINE SIMDVec_i & absa(SIMDVecMask<64> const & mask) {
+            mVec = _mm512_mask_abs_epi8(mVec, mask.mMask, mVec);
+            return *this;
+        }
+
+#if defined(__AVX512VL__)
+        // PACK
+        UME_FORCE_INLINE SIMDVec_i & pack(SIMDVec_i<int8_t, 32> const & a, SIMDVec_i<int8_t, 32> const & b) {
+            mVec = _mm512_inserti64x4(mVec, a.mVec, 0);
+            mVec = _mm512_inserti64x4(mVec, b.mVec, 1);
+            return *this;
+        }
+        // PACKLO
+        UME_FORCE_INLINE SIMDVec_i & packlo(SIMDVec_i<int8_t, 32> const & a) {
+            mVec = _mm512_inserti64x4(mVec, a.mVec, 0);
+            return *this;
+        }
+        // PACKHI
+        UME_FORCE_INLINE SIMDVec_i & packhi(SIMDVec_i<int8_t, 32> const & b) {
+            mVec = _mm512_inserti64x4(mVec, b.mVec, 1);
+            return *this;
+        }
+        // UNPACK
+        UME_FORCE_INLINE void unpack(SIMDVec_i<int8_t, 32> & a, SIMDVec_i<int8_t, 32> & b) const {
+            a.mVec = _mm512_extracti64x4_epi64(mVec, 0);
+            b.mVec = _mm512_extracti64x4_epi64(mVec, 1);
+        }
+        // UNPACKLO
+        UME_FORCE_INLINE SIMDVec_i<int8_t, 32> unpacklo() const {
+            __m256i t0 = _mm512_extracti64x4_epi64(mVec, 0);
+            return SIMDVec_i<int8_t, 32>(t0);
+        }
+        // UNPACKHI
+        UME_FORCE_INLINE SIMDVec_i<int8_t, 32> unpackhi() const {
+            __m256i t0 = _mm512_extracti64x4_epi64(mVec, 1);
+            return SIMDVec_i<int8_t, 32>(t0);
+        }
+#else
+        // PACK
+        // PACKLO
+        // PACKHI
+        // UNPACK
+        // UNPACKLO
+        // UNPACKHI
+#endif
+
+        // PROMOTE
+        UME_FORCE_INLINE operator SIMDVec_i<int16_t, 64>() const;
+        // DEGRADE
+        // -
+
+        // ITOU
+        UME_FORCE_INLINE operator SIMDVec_u<uint8_t, 64>() const;
+        // ITOF
+        // -
+
+    };
+
+}
+}
+
+#endif
+
+#endif
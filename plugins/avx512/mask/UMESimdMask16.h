@@ -113,6 +113,12 @@ namespace SIMD {
             mMask |= m14 ? 0x4000 : 0x0;
             mMask |= m15 ? 0x8000 : 0x0;
         }
+        // PREFIX
+        static UME_FORCE_INLINE SIMDVecMask prefix(uint32_t n) {
+            SIMDVecMask t0;
+            t0.mMask = n < 16 ? __mmask16((uint32_t(1) << n) - 1) : 0xFFFF;
+            return t0;
+        }
         // EXTRACT
         UME_FORCE_INLINE bool extract(uint32_t index) const {
             bool t0 = ((mMask & (1 << index)) != 0);
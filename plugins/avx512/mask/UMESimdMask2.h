@@ -84,6 +84,12 @@ namespace SIMD {
             mMask = m0 ?  0x1 : 0x0;
             mMask |= m1 ? 0x2 : 0x0;
         }
+        // PREFIX
+        static UME_FORCE_INLINE SIMDVecMask prefix(uint32_t n) {
+            SIMDVecMask t0;
+            t0.mMask = n < 2 ? __mmask8((uint32_t(1) << n) - 1) : 0x3;
+            return t0;
+        }
         // EXTRACT
         UME_FORCE_INLINE bool extract(uint32_t index) const {
             bool t0 = ((mMask & (1 << index)) != 0);
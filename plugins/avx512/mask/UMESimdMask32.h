@@ -120,6 +120,12 @@ namespace SIMD {
             mMask |= m30 ? 0x40000000 : 0x0;
             mMask |= m31 ? 0x80000000 : 0x0;
         }
+        // PREFIX
+        static UME_FORCE_INLINE SIMDVecMask prefix(uint32_t n) {
+            SIMDVecMask t0;
+            t0.mMask = n < 32 ? __mmask32((uint64_t(1) << n) - 1) : 0xFFFFFFFF;
+            return t0;
+        }
         // EXTRACT
         UME_FORCE_INLINE bool extract(uint32_t index) const {
             bool t0 = ((mMask & (1 << index)) != 0);
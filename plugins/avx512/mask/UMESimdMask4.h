@@ -91,6 +91,12 @@ namespace SIMD {
             mMask |= m2 ? 0x4 : 0x0;
             mMask |= m3 ? 0x8 : 0x0;
         }
+        // PREFIX
+        static UME_FORCE_INLINE SIMDVecMask prefix(uint32_t n) {
+            SIMDVecMask t0;
+            t0.mMask = n < 4 ? __mmask8((uint32_t(1) << n) - 1) : 0xF;
+            return t0;
+        }
         // EXTRACT
         UME_FORCE_INLINE bool extract(uint32_t index) const {
             bool t0 = ((mMask & (1 << index)) != 0);
@@ -0,0 +1,445 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_MASK_64_H_
+#define UME_SIMD_MASK_64_H_
+
+#include "UMESimdMaskPrototype.h"
+
+namespace UME {
+namespace SIMD {
+
+    template<>
+    class SIMDVecMask<64> :
+        public SIMDMaskBaseInterface<
+           SIMDVecMask<64>,
+           uint64_t,
+           64>
+    {
+        friend class SIMDVec_u<uint8_t, 64>;
+        friend class SIMDVec_u<uint16_t, 64>;
+        friend class SIMDVec_u<uint32_t, 64>;
+        friend class SIMDVec_u<uint64_t, 64>;
+        friend class SIMDVec_i<int8_t, 64>;
+        friend class SIMDVec_i<int16_t, 64>;
+        friend class SIMDVec_i<int32_t, 64>;
+        friend class SIMDVec_i<int64_t, 64>;
+        friend class SIMDVec_f<float, 64>;
+        friend class SIMDVec_f<double, 64>;
+    private:
+        __mmask64 mMask;
+
+        // Using this internal constructor is not possible because of the ICC implementation.
+        // ICC (and possibly other compilers) implement __mmask16 as 'unsigned int'. For that
+        // reason, SET-CONSTR cannot be used with automatic casting of scalars to 'bool'.
+        //UME_FORCE_INLINE explicit SIMDVecMask(__mmask64 const & x) { mMask = x; };
+
+    public:
+        UME_FORCE_INLINE SIMDVecMask() {}
+
+        // Regardless of the mask representation, the interface should only allow initialization using 
+        // standard bool or using equivalent mask
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVecMask(bool m) {
+            if (m == true) mMask = 0xFFFFFFFFFFFFFFFF;
+            else mMask = 0x0000000000000000;
+        }
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVecMask(bool const *p) {
+            this->load(p);
+        }
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVecMask(bool m0, bool m1, bool m2, bool m3,
+                                     bool m4, bool m5, bool m6, bool m7,
+                                     bool m8, bool m9, bool m10, bool m11,
+                                     bool m12, bool m13, bool m14, bool m15,
+                                     bool m16, bool m17, bool m18, bool m19,
+                                     bool m20, bool m21, bool m22, bool m23,
+                                     bool m24, bool m25, bool m26, bool m27,
+                                     bool m28, bool m29, bool m30, bool m31,
+                                     bool m32, bool m33, bool m34, bool m35,
+                                     bool m36, bool m37, bool m38, bool m39,
+                                     bool m40, bool m41, bool m42, bool m43,
+                                     bool m44, bool m45, bool m46, bool m47,
+                                     bool m48, bool m49, bool m50, bool m51,
+                                     bool m52, bool m53, bool m54, bool m55,
+                                     bool m56, bool m57, bool m58, bool m59,
+                                     bool m60, bool m61, bool m62, bool m63) {
+            mMask =  m0  ? 0x0000000000000001ULL : 0x0;
+            mMask |= m1  ? 0x0000000000000002ULL : 0x0;
+            mMask |= m2  ? 0x0000000000000004ULL : 0x0;
+            mMask |= m3  ? 0x0000000000000008ULL : 0x0;
+            mMask |= m4  ? 0x0000000000000010ULL : 0x0;
+            mMask |= m5  ? 0x0000000000000020ULL : 0x0;
+            mMask |= m6  ? 0x0000000000000040ULL : 0x0;
+            mMask |= m7  ? 0x0000000000000080ULL : 0x0;
+            mMask |= m8  ? 0x0000000000000100ULL : 0x0;
+            mMask |= m9  ? 0x0000000000000200ULL : 0x0;
+            mMask |= m10 ? 0x0000000000000400ULL : 0x0;
+            mMask |= m11 ? 0x0000000000000800ULL : 0x0;
+            mMask |= m12 ? 0x0000000000001000ULL : 0x0;
+            mMask |= m13 ? 0x0000000000002000ULL : 0x0;
+            mMask |= m14 ? 0x0000000000004000ULL : 0x0;
+            mMask |= m15 ? 0x0000000000008000ULL : 0x0;
+            mMask |= m16 ? 0x0000000000010000ULL : 0x0;
+            mMask |= m17 ? 0x0000000000020000ULL : 0x0;
+            mMask |= m18 ? 0x0000000000040000ULL : 0x0;
+            mMask |= m19 ? 0x0000000000080000ULL : 0x0;
+            mMask |= m20 ? 0x0000000000100000ULL : 0x0;
+            mMask |= m21 ? 0x0000000000200000ULL : 0x0;
+            mMask |= m22 ? 0x0000000000400000ULL : 0x0;
+            mMask |= m23 ? 0x0000000000800000ULL : 0x0;
+            mMask |= m24 ? 0x0000000001000000ULL : 0x0;
+            mMask |= m25 ? 0x0000000002000000ULL : 0x0;
+            mMask |= m26 ? 0x0000000004000000ULL : 0x0;
+            mMask |= m27 ? 0x0000000008000000ULL : 0x0;
+            mMask |= m28 ? 0x0000000010000000ULL : 0x0;
+            mMask |= m29 ? 0x0000000020000000ULL : 0x0;
+            mMask |= m30 ? 0x0000000040000000ULL : 0x0;
+            mMask |= m31 ? 0x0000000080000000ULL : 0x0;
+            mMask |= m32 ? 0x0000000100000000ULL : 0x0;
+            mMask |= m33 ? 0x0000000200000000ULL : 0x0;
+            mMask |= m34 ? 0x0000000400000000ULL : 0x0;
+            mMask |= m35 ? 0x0000000800000000ULL : 0x0;
+            mMask |= m36 ? 0x0000001000000000ULL : 0x0;
+            mMask |= m37 ? 0x0000002000000000ULL : 0x0;
+            mMask |= m38 ? 0x0000004000000000ULL : 0x0;
+            mMask |= m39 ? 0x0000008000000000ULL : 0x0;
+            mMask |= m40 ? 0x0000010000000000ULL : 0x0;
+            mMask |= m41 ? 0x0000020000000000ULL : 0x0;
+            mMask |= m42 ? 0x0000040000000000ULL : 0x0;
+            mMask |= m43 ? 0x0000080000000000ULL : 0x0;
+            mMask |= m44 ? 0x0000100000000000ULL : 0x0;
+            mMask |= m45 ? 0x0000200000000000ULL : 0x0;
+            mMask |= m46 ? 0x0000400000000000ULL : 0x0;
+            mMask |= m47 ? 0x0000800000000000ULL : 0x0;
+            mMask |= m48 ? 0x0001000000000000ULL : 0x0;
+            mMask |= m49 ? 0x0002000000000000ULL : 0x0;
+            mMask |= m50 ? 0x0004000000000000ULL : 0x0;
+            mMask |= m51 ? 0x0008000000000000ULL : 0x0;
+            mMask |= m52 ? 0x0010000000000000ULL : 0x0;
+            mMask |= m53 ? 0x0020000000000000ULL : 0x0;
+            mMask |= m54 ? 0x0040000000000000ULL : 0x0;
+            mMask |= m55 ? 0x0080000000000000ULL : 0x0;
+            mMask |= m56 ? 0x0100000000000000ULL : 0x0;
+            mMask |= m57 ? 0x0200000000000000ULL : 0x0;
+            mMask |= m58 ? 0x0400000000000000ULL : 0x0;
+            mMask |= m59 ? 0x0800000000000000ULL : 0x0;
+            mMask |= m60 ? 0x1000000000000000ULL : 0x0;
+            mMask |= m61 ? 0x2000000000000000ULL : 0x0;
+            mMask |= m62 ? 0x4000000000000000ULL : 0x0;
+            mMask |= m63 ? 0x8000000000000000ULL : 0x0;
+        }
+        // PREFIX
+        static UME_FORCE_INLINE SIMDVecMask prefix(uint32_t n) {
+            SIMDVecMask t0;
+            t0.mMask = n < 64 ? __mmask64((uint64_t(1) << n) - 1) : 0xFFFFFFFFFFFFFFFF;
+            return t0;
+        }
+        // EXTRACT
+        UME_FORCE_INLINE bool extract(uint32_t index) const {
+            bool t0 = ((mMask & (1ULL << index)) != 0);
+            return t0;
+        }
+
+        // A non-modifying element-wise access operator
+        UME_FORCE_INLINE bool operator[] (uint32_t index) const {
+            return extract(index);
+        }
+        // INSERT
+        UME_FORCE_INLINE void insert(uint32_t index, bool x) {
+            if (x == true) mMask |= 1ULL << index;
+            else mMask &= ~(1ULL << index);
+        }
+        // LOAD
+        UME_FORCE_INLINE SIMDVecMask & load(bool const * p) {
+            mMask = 0x00;
+            for (int i = 0; i < 64; i++) {
+                if (p[i] == true) mMask |= (1ULL << i);
+            }
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVecMask & loada(bool const * p) {
+            mMask = 0x00;
+            for (int i = 0; i < 64; i++) {
+                if (p[i] == true) mMask |= (1ULL << i);
+            }
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE bool* store(bool * p) const {
+            for (int i = 0; i < 64; i++) {
+                p[i] = ((mMask & (1ULL << i)) != 0);
+            }
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE bool* storea(bool * p) const {
+            for (int i = 0; i < 64; i++) {
+                p[i] = ((mMask & (1ULL << i)) != 0);
+            }
+            return p;
+        }
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVecMask & assign(SIMDVecMask const & b) {
+            mMask = b.mMask;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator= (SIMDVecMask const & b) {
+            mMask = b.mMask;
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVecMask & assign(bool b) {
+            mMask = b ? 0xFFFFFFFFFFFFFFFF : 0;
+            return *this;
+        }
+        // LANDV
+        UME_FORCE_INLINE SIMDVecMask land(SIMDVecMask const & b) const {
+            __mmask64 t0 = mMask & b.mMask;
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        UME_FORCE_INLINE SIMDVecMask operator& (SIMDVecMask const & b) const {
+            return land(b);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator&& (SIMDVecMask const & b) const {
+            return land(b);
+        }
+        // LANDS
+        UME_FORCE_INLINE SIMDVecMask land(bool b) const {
+            __mmask64 t0 = mMask & (b ? 0xFFFFFFFFFFFFFFFF : 0x0000000000000000);
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        UME_FORCE_INLINE SIMDVecMask operator& (bool b) const {
+            return land(b);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator&& (bool b) const {
+            return land(b);
+        }
+        // LANDVA
+        UME_FORCE_INLINE SIMDVecMask & landa(SIMDVecMask const & b) {
+            mMask &= b.mMask;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator&= (SIMDVecMask const & b) {
+            return landa(b);
+        }
+        // LANDSA
+        UME_FORCE_INLINE SIMDVecMask & landa(bool b) {
+            mMask &= (b ? 0xFFFFFFFFFFFFFFFF : 0x0000000000000000);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator&= (bool b) {
+            return landa(b);
+        }
+        // LORV
+        UME_FORCE_INLINE SIMDVecMask lor(SIMDVecMask const & b) const {
+            __mmask64 t0 = mMask | b.mMask;
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        UME_FORCE_INLINE SIMDVecMask operator| (SIMDVecMask const & b) const {
+            return lor(b);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator|| (SIMDVecMask const & b) const {
+            return lor(b);
+        }
+        // LORS
+        UME_FORCE_INLINE SIMDVecMask lor(bool b) const {
+            __mmask64 t0 = mMask | (b ? 0xFFFFFFFFFFFFFFFF : 0x0000000000000000);
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        UME_FORCE_INLINE SIMDVecMask operator| (bool b) const {
+            return lor(b);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator|| (bool b) const {
+            return lor(b);
+        }
+        // LORVA
+        UME_FORCE_INLINE SIMDVecMask & lora(SIMDVecMask const & b) {
+            mMask |= b.mMask;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator|= (SIMDVecMask const & b) {
+            return lora(b);
+        }
+        // LORSA
+        UME_FORCE_INLINE SIMDVecMask & lora(bool b) {
+            mMask |= (b ? 0xFFFFFFFFFFFFFFFF : 0x0000000000000000);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator|= (bool b) {
+            return lora(b);
+        }
+        // LXORV
+        UME_FORCE_INLINE SIMDVecMask lxor(SIMDVecMask const & b) const {
+            __mmask64 t0 = mMask ^ b.mMask;
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        UME_FORCE_INLINE SIMDVecMask operator^ (SIMDVecMask const & b) const {
+            return lxor(b);
+        }
+        // LXORS
+        UME_FORCE_INLINE SIMDVecMask lxor(bool b) const {
+            __mmask64 t0 = mMask ^ (b ? 0xFFFFFFFFFFFFFFFF : 0x0000000000000000);
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        UME_FORCE_INLINE SIMDVecMask operator^ (bool b) const {
+            return lxor(b);
+        }
+        // LXORVA
+        UME_FORCE_INLINE SIMDVecMask & lxora(SIMDVecMask const & b) {
+            mMask ^= b.mMask;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator^= (SIMDVecMask const & b) {
+            return lxora(b);
+        }
+        // LXORSA
+        UME_FORCE_INLINE SIMDVecMask & lxora(bool b) {
+            mMask ^= (b ? 0xFFFFFFFFFFFFFFFF : 0x0000000000000000);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator^= (bool b) {
+            return lxora(b);
+        }
+        // LNOT
+        UME_FORCE_INLINE SIMDVecMask lnot() const {
+            __mmask64 t0 = ~mMask;
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        UME_FORCE_INLINE SIMDVecMask operator! () const {
+            return lnot();
+        }
+        // LNOTA
+        UME_FORCE_INLINE SIMDVecMask & lnota() {
+            mMask = ~mMask;
+            return *this;
+        }
+        // LANDNOTV
+        UME_FORCE_INLINE SIMDVecMask landnot(SIMDVecMask const & b) const {
+            __mmask64 t0 = ~mMask & b.mMask;
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        // LANDNOTS
+        UME_FORCE_INLINE SIMDVecMask landnot(bool b) const {
+            __mmask64 t0 = ~mMask & (b ? 0xFFFFFFFFFFFFFFFF : 0);
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask cmpeq(SIMDVecMask const & b) const {
+            __mmask64 t0 = 0xFFFFFFFFFFFFFFFF & ~(mMask ^ b.mMask);
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        UME_FORCE_INLINE SIMDVecMask operator== (SIMDVecMask const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask cmpeq(bool b) const {
+            __mmask64 t0 = 0xFFFFFFFFFFFFFFFF & ~(mMask ^ (b ? 0xFFFFFFFFFFFFFFFF : 0));
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        UME_FORCE_INLINE SIMDVecMask operator== (bool b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask cmpne(SIMDVecMask const & b) const {
+            __mmask64 t0 = 0xFFFFFFFFFFFFFFFF & (mMask ^ b.mMask);
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        UME_FORCE_INLINE SIMDVecMask operator!= (SIMDVecMask const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask cmpne(bool b) const {
+            __mmask64 t0 = 0xFFFFFFFFFFFFFFFF & (mMask ^ (b ? 0xFFFFFFFFFFFFFFFF : 0));
+            SIMDVecMask t1;
+            t1.mMask = t0;
+            return t1;
+        }
+        UME_FORCE_INLINE SIMDVecMask operator!= (bool b) const {
+            return cmpne(b);
+        }
+        // HLAND
+        UME_FORCE_INLINE bool hland() const {
+            return ((mMask & 0xFFFFFFFFFFFFFFFF) == 0xFFFFFFFFFFFFFFFF);
+        }
+        // HLOR
+        UME_FORCE_INLINE bool hlor() const {
+            return ((mMask & 0xFFFFFFFFFFFFFFFF) != 0x0);
+        }
+        // HLXOR
+        UME_FORCE_INLINE bool hlxor() const {
+            __mmask64 t0 = mMask ^ (mMask >> 32);
+            t0 ^= t0 >> 16;
+            t0 ^= t0 >> 8;
+            t0 ^= t0 >> 4;
+            t0 ^= t0 >> 2;
+            t0 ^= t0 >> 1;
+            return (t0 & 0x1) != 0;
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVecMask const & b) const {
+            return mMask == b.mMask;
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(bool b) const {
+            return mMask == (b ? 0xFFFFFFFFFFFFFFFF : 0);
+        }
+    };
+
+}
+}
+
+#endif
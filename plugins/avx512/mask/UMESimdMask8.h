@@ -98,6 +98,12 @@ namespace SIMD {
             mMask |= m6 ? 0x40 : 0x0;
             mMask |= m7 ? 0x80 : 0x0;
         }
+        // PREFIX
+        static UME_FORCE_INLINE SIMDVecMask prefix(uint32_t n) {
+            SIMDVecMask t0;
+            t0.mMask = n < 8 ? __mmask8((uint32_t(1) << n) - 1) : 0xFF;
+            return t0;
+        }
         // EXTRACT
         UME_FORCE_INLINE bool extract(uint32_t index) const {
             bool t0 = ((mMask & (1 << index)) != 0);
@@ -67,8 +67,9 @@ namespace SIMD {
             mVec = _mm512_loadu_si512((__m512i*)p);
         }
         UME_FORCE_INLINE explicit SIMDSwizzle(uint64_t const * p) {
-            uint32_t raw[4] = {(uint32_t)p[0], (uint32_t)p[1], (uint32_t)p[2], (uint32_t)p[3]};
-            mVec = _mm512_loadu_si512((__m512i*)raw);
+            alignas(64) uint32_t raw[16];
+            for (int i = 0; i < 16; i++) raw[i] = (uint32_t)p[i];
+            mVec = _mm512_load_si512((__m512i*)raw);
         }
 
         UME_FORCE_INLINE SIMDSwizzle(
@@ -85,7 +86,7 @@ namespace SIMD {
         // A non-modifying element-wise access operator
         UME_FORCE_INLINE uint32_t extract(uint32_t index) const
         {
-            alignas(16) uint32_t raw[16];
+            alignas(64) uint32_t raw[16];
             _mm512_store_si512((__m512i*) raw, mVec);
             return raw[index];
         }
@@ -94,7 +95,7 @@ namespace SIMD {
 
         // Element-wise modification operator
         UME_FORCE_INLINE SIMDSwizzle & insert(uint32_t index, uint32_t value) {
-            alignas(16) uint32_t raw[16];
+            alignas(64) uint32_t raw[16];
             _mm512_store_si512((__m512i*)raw, mVec);
             raw[index] = value;
             mVec = _mm512_load_si512((__m512i*)raw);
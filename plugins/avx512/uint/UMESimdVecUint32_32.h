@@ -53,6 +53,7 @@ namespace SIMD {
     {
         friend class SIMDVec_i<int32_t, 32>;
         friend class SIMDVec_f<float, 32>;
+        friend class SIMDVec_u<uint16_t, 32>;
 
     private:
         __m512i mVec[2];
@@ -65,6 +66,37 @@ namespace SIMD {
             mVec[0] = x0;
             mVec[1] = x1;
         }
+
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m512i saturatedAdd(__m512i const & a, __m512i const & b) {
+            return _mm512_add_epi32(a, _mm512_min_epu32(b, _mm512_xor_si512(a, _mm512_set1_epi32(-1))));
+        }
+        static UME_FORCE_INLINE __m512i saturatedSub(__m512i const & a, __m512i const & b) {
+            return _mm512_sub_epi32(_mm512_max_epu32(a, b), b);
+        }
+        // Lane-wise division through double precision, exact for 32-bit operands.
+        static UME_FORCE_INLINE __m512i divideVector(__m512i const & a, __m512i const & b) {
+            __m512d t0 = _mm512_div_pd(_mm512_cvtepu32_pd(_mm512_castsi512_si256(a)), _mm512_cvtepu32_pd(_mm512_castsi512_si256(b)));
+            __m512d t1 = _mm512_div_pd(_mm512_cvtepu32_pd(_mm512_extracti64x4_epi64(a, 1)), _mm512_cvtepu32_pd(_mm512_extracti64x4_epi64(b, 1)));
+            return _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvttpd_epu32(t0)), _mm512_cvttpd_epu32(t1), 1);
+        }
+        static UME_FORCE_INLINE __m512i remainderVector(__m512i const & a, __m512i const & b) {
+            __m512i t0 = divideVector(a, b);
+            return _mm512_sub_epi32(a, _mm512_mullo_epi32(t0, b));
+        }
+        // Division by a precomputed divisor, used by DIVD*/REMD*.
+        static UME_FORCE_INLINE __m512i divideMagic(__m512i const & a, SIMDDivisor<uint32_t> const & b) {
+            __m512i t0 = _mm512_set1_epi32(b.magic());
+            __m512i t1 = _mm512_mul_epu32(a, t0);
+            __m512i t2 = _mm512_mul_epu32(_mm512_srli_epi64(a, 32), t0);
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_srli_epi64(t1, 32), 0xAAAA, t2);
+            __m512i t4 = _mm512_srl_epi32(_mm512_sub_epi32(a, t3), _mm_cvtsi32_si128(b.shift1()));
+            return _mm512_srl_epi32(_mm512_add_epi32(t3, t4), _mm_cvtsi32_si128(b.shift2()));
+        }
+        static UME_FORCE_INLINE __m512i remainderMagic(__m512i const & a, SIMDDivisor<uint32_t> const & b) {
+            __m512i t0 = divideMagic(a, b);
+            return _mm512_sub_epi32(a, _mm512_mullo_epi32(t0, _mm512_set1_epi32(b.divisor())));
+        }
     public:
 
         constexpr static uint32_t length() { return 32; }
@@ -351,13 +383,73 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVec_u const & b) const {
+            __m512i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            __m512i t1 = saturatedAdd(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<32> const & mask, SIMDVec_u const & b) const {
+            __mmask16 m0 = mask.mMask & 0x0000FFFF;
+            __mmask16 m1 = (mask.mMask & 0xFFFF0000) >> 16;
+            __m512i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            __m512i t1 = _mm512_mask_mov_epi32(mVec[0], m0, t0);
+            __m512i t2 = saturatedAdd(mVec[1], b.mVec[1]);
+            __m512i t3 = _mm512_mask_mov_epi32(mVec[1], m1, t2);
+            return SIMDVec_u(t1, t3);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(uint32_t b) const {
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = saturatedAdd(mVec[0], t0);
+            __m512i t2 = saturatedAdd(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<32> const & mask, uint32_t b) const {
+            __mmask16 m0 = mask.mMask & 0x0000FFFF;
+            __mmask16 m1 = (mask.mMask & 0xFFFF0000) >> 16;
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = saturatedAdd(mVec[0], t0);
+            __m512i t2 = _mm512_mask_mov_epi32(mVec[0], m0, t1);
+            __m512i t3 = saturatedAdd(mVec[1], t0);
+            __m512i t4 = _mm512_mask_mov_epi32(mVec[1], m1, t3);
+            return SIMDVec_u(t2, t4);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVec_u const & b) {
+            mVec[0] = saturatedAdd(mVec[0], b.mVec[0]);
+            mVec[1] = saturatedAdd(mVec[1], b.mVec[1]);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<32> const & mask, SIMDVec_u const & b) {
+            __mmask16 m0 = mask.mMask & 0x0000FFFF;
+            __mmask16 m1 = (mask.mMask & 0xFFFF0000) >> 16;
+            __m512i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            mVec[0] = _mm512_mask_mov_epi32(mVec[0], m0, t0);
+            __m512i t1 = saturatedAdd(mVec[1], b.mVec[1]);
+            mVec[1] = _mm512_mask_mov_epi32(mVec[1], m1, t1);
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(uint32_t b) {
+            __m512i t0 = _mm512_set1_epi32(b);
+            mVec[0] = saturatedAdd(mVec[0], t0);
+            mVec[1] = saturatedAdd(mVec[1], t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<32> const & mask, uint32_t b) {
+            __mmask16 m0 = mask.mMask & 0x0000FFFF;
+            __mmask16 m1 = (mask.mMask & 0xFFFF0000) >> 16;
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = saturatedAdd(mVec[0], t0);
+            mVec[0] = _mm512_mask_mov_epi32(mVec[0], m0, t1);
+            __m512i t2 = saturatedAdd(mVec[1], t0);
+            mVec[1] = _mm512_mask_mov_epi32(mVec[1], m1, t2);
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_u postinc() {
             __m512i t0 = _mm512_set1_epi32(1);
@@ -473,13 +565,73 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVec_u const & b) const {
+            __m512i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            __m512i t1 = saturatedSub(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<32> const & mask, SIMDVec_u const & b) const {
+            __mmask16 m0 = mask.mMask & 0x0000FFFF;
+            __mmask16 m1 = (mask.mMask & 0xFFFF0000) >> 16;
+            __m512i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            __m512i t1 = _mm512_mask_mov_epi32(mVec[0], m0, t0);
+            __m512i t2 = saturatedSub(mVec[1], b.mVec[1]);
+            __m512i t3 = _mm512_mask_mov_epi32(mVec[1], m1, t2);
+            return SIMDVec_u(t1, t3);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(uint32_t b) const {
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = saturatedSub(mVec[0], t0);
+            __m512i t2 = saturatedSub(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<32> const & mask, uint32_t b) const {
+            __mmask16 m0 = mask.mMask & 0x0000FFFF;
+            __mmask16 m1 = (mask.mMask & 0xFFFF0000) >> 16;
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = saturatedSub(mVec[0], t0);
+            __m512i t2 = _mm512_mask_mov_epi32(mVec[0], m0, t1);
+            __m512i t3 = saturatedSub(mVec[1], t0);
+            __m512i t4 = _mm512_mask_mov_epi32(mVec[1], m1, t3);
+            return SIMDVec_u(t2, t4);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVec_u const & b) {
+            mVec[0] = saturatedSub(mVec[0], b.mVec[0]);
+            mVec[1] = saturatedSub(mVec[1], b.mVec[1]);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<32> const & mask, SIMDVec_u const & b) {
+            __mmask16 m0 = mask.mMask & 0x0000FFFF;
+            __mmask16 m1 = (mask.mMask & 0xFFFF0000) >> 16;
+            __m512i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            mVec[0] = _mm512_mask_mov_epi32(mVec[0], m0, t0);
+            __m512i t1 = saturatedSub(mVec[1], b.mVec[1]);
+            mVec[1] = _mm512_mask_mov_epi32(mVec[1], m1, t1);
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(uint32_t b) {
+            __m512i t0 = _mm512_set1_epi32(b);
+            mVec[0] = saturatedSub(mVec[0], t0);
+            mVec[1] = saturatedSub(mVec[1], t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<32> const & mask, uint32_t b) {
+            __mmask16 m0 = mask.mMask & 0x0000FFFF;
+            __mmask16 m1 = (mask.mMask & 0xFFFF0000) >> 16;
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = saturatedSub(mVec[0], t0);
+            mVec[0] = _mm512_mask_mov_epi32(mVec[0], m0, t1);
+            __m512i t2 = saturatedSub(mVec[1], t0);
+            mVec[1] = _mm512_mask_mov_epi32(mVec[1], m1, t2);
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVec_u const & b) const {
             __m512i t0 = _mm512_sub_epi32(b.mVec[0], mVec[0]);
@@ -653,25 +805,241 @@ namespace SIMD {
             return *this;
         }
         // DIVV
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVec_u const & b) const {
+            __m512i t0 = divideVector(mVec[0], b.mVec[0]);
+            __m512i t1 = divideVector(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
         UME_FORCE_INLINE SIMDVec_u operator/ (SIMDVec_u const & b) const {
             return div(b);
         }
         // MDIVV
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<32> const & mask, SIMDVec_u const & b) const {
+            __mmask16 m0 = mask.mMask & 0x0000FFFF;
+            __mmask16 m1 = (mask.mMask & 0xFFFF0000) >> 16;
+            __m512i t0 = divideVector(mVec[0], b.mVec[0]);
+            __m512i t1 = _mm512_mask_mov_epi32(mVec[0], m0, t0);
+            __m512i t2 = divideVector(mVec[1], b.mVec[1]);
+            __m512i t3 = _mm512_mask_mov_epi32(mVec[1], m1, t2);
+            return SIMDVec_u(t1, t3);
+        }
         // DIVS
+        UME_FORCE_INLINE SIMDVec_u div(uint32_t b) const {
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = divideVector(mVec[0], t0);
+            __m512i t2 = divideVector(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
         UME_FORCE_INLINE SIMDVec_u operator/ (uint32_t b) const {
             return div(b);
         }
         // MDIVS
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<32> const & mask, uint32_t b) const {
+            __mmask16 m0 = mask.mMask & 0x0000FFFF;
+            __mmask16 m1 = (mask.mMask & 0xFFFF0000) >> 16;
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = divideVector(mVec[0], t0);
+            __m512i t2 = _mm512_mask_mov_epi32(mVec[0], m0, t1);
+            __m512i t3 = divideVector(mVec[1], t0);
+            __m512i t4 = _mm512_mask_mov_epi32(mVec[1], m1, t3);
+            return SIMDVec_u(t2, t4);
+        }
         // DIVVA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVec_u const & b) {
+            mVec[0] = divideVector(mVec[0], b.mVec[0]);
+            mVec[1] = divideVector(mVec[1], b.mVec[1]);
+            return *this;
+        }
         UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDVec_u const & b) {
             return diva(b);
         }
         // MDIVVA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<32> const & mask, SIMDVec_u const & b) {
+            __mmask16 m0 = mask.mMask & 0x0000FFFF;
+            __mmask16 m1 = (mask.mMask & 0xFFFF0000) >> 16;
+            __m512i t0 = divideVector(mVec[0], b.mVec[0]);
+            mVec[0] = _mm512_mask_mov_epi32(mVec[0], m0, t0);
+            __m512i t1 = divideVector(mVec[1], b.mVec[1]);
+            mVec[1] = _mm512_mask_mov_epi32(mVec[1], m1, t1);
+            return *this;
+        }
         // DIVSA
+        UME_FORCE_INLINE SIMDVec_u & diva(uint32_t b) {
+            __m512i t0 = _mm512_set1_epi32(b);
+            mVec[0] = divideVector(mVec[0], t0);
+            mVec[1] = divideVector(mVec[1], t0);
+            return *this;
+        }
         UME_FORCE_INLINE SIMDVec_u & operator/= (uint32_t b) {
             return diva(b);
         }
         // MDIVSA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<32> const & mask, uint32_t b) {
+            __mmask16 m0 = mask.mMask & 0x0000FFFF;
+            __mmask16 m1 = (mask.mMask & 0xFFFF0000) >> 16;
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = divideVector(mVec[0], t0);
+            mVec[0] = _mm512_mask_mov_epi32(mVec[0], m0, t1);
+            __m512i t2 = divideVector(mVec[1], t0);
+            mVec[1] = _mm512_mask_mov_epi32(mVec[1], m1, t2);
+            return *this;
+        }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDDivisor<uint32_t> const & b) const {
+            __m512i t0 = divideMagic(mVec[0], b);
+            __m512i t1 = divideMagic(mVec[1], b);
+            return SIMDVec_u(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (SIMDDivisor<uint32_t> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<32> const & mask, SIMDDivisor<uint32_t> const & b) const {
+            __mmask16 m0 = mask.mMask & 0x0000FFFF;
+            __mmask16 m1 = (mask.mMask & 0xFFFF0000) >> 16;
+            __m512i t0 = divideMagic(mVec[0], b);
+            __m512i t1 = _mm512_mask_mov_epi32(mVec[0], m0, t0);
+            __m512i t2 = divideMagic(mVec[1], b);
+            __m512i t3 = _mm512_mask_mov_epi32(mVec[1], m1, t2);
+            return SIMDVec_u(t1, t3);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDDivisor<uint32_t> const & b) {
+            mVec[0] = divideMagic(mVec[0], b);
+            mVec[1] = divideMagic(mVec[1], b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDDivisor<uint32_t> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<32> const & mask, SIMDDivisor<uint32_t> const & b) {
+            __mmask16 m0 = mask.mMask & 0x0000FFFF;
+            __mmask16 m1 = (mask.mMask & 0xFFFF0000) >> 16;
+            __m512i t0 = divideMagic(mVec[0], b);
+            mVec[0] = _mm512_mask_mov_epi32(mVec[0], m0, t0);
+            __m512i t1 = divideMagic(mVec[1], b);
+            mVec[1] = _mm512_mask_mov_epi32(mVec[1], m1, t1);
+            return *this;
+        }
+        // REMV
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVec_u const & b) const {
+            __m512i t0 = remainderVector(mVec[0], b.mVec[0]);
+            __m512i t1 = remainderVector(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (SIMDVec_u const & b) const {
+            return rem(b);
+        }
+        // MREMV
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<32> const & mask, SIMDVec_u const & b) const {
+            __mmask16 m0 = mask.mMask & 0x0000FFFF;
+            __mmask16 m1 = (mask.mMask & 0xFFFF0000) >> 16;
+            __m512i t0 = remainderVector(mVec[0], b.mVec[0]);
+            __m512i t1 = _mm512_mask_mov_epi32(mVec[0], m0, t0);
+            __m512i t2 = remainderVector(mVec[1], b.mVec[1]);
+            __m512i t3 = _mm512_mask_mov_epi32(mVec[1], m1, t2);
+            return SIMDVec_u(t1, t3);
+        }
+        // REMS
+        UME_FORCE_INLINE SIMDVec_u rem(uint32_t b) const {
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = remainderVector(mVec[0], t0);
+            __m512i t2 = remainderVector(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (uint32_t b) const {
+            return rem(b);
+        }
+        // MREMS
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<32> const & mask, uint32_t b) const {
+            __mmask16 m0 = mask.mMask & 0x0000FFFF;
+            __mmask16 m1 = (mask.mMask & 0xFFFF0000) >> 16;
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = remainderVector(mVec[0], t0);
+            __m512i t2 = _mm512_mask_mov_epi32(mVec[0], m0, t1);
+            __m512i t3 = remainderVector(mVec[1], t0);
+            __m512i t4 = _mm512_mask_mov_epi32(mVec[1], m1, t3);
+            return SIMDVec_u(t2, t4);
+        }
+        // REMVA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVec_u const & b) {
+            mVec[0] = remainderVector(mVec[0], b.mVec[0]);
+            mVec[1] = remainderVector(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (SIMDVec_u const & b) {
+            return rema(b);
+        }
+        // MREMVA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<32> const & mask, SIMDVec_u const & b) {
+            __mmask16 m0 = mask.mMask & 0x0000FFFF;
+            __mmask16 m1 = (mask.mMask & 0xFFFF0000) >> 16;
+            __m512i t0 = remainderVector(mVec[0], b.mVec[0]);
+            mVec[0] = _mm512_mask_mov_epi32(mVec[0], m0, t0);
+            __m512i t1 = remainderVector(mVec[1], b.mVec[1]);
+            mVec[1] = _mm512_mask_mov_epi32(mVec[1], m1, t1);
+            return *this;
+        }
+        // REMSA
+        UME_FORCE_INLINE SIMDVec_u & rema(uint32_t b) {
+            __m512i t0 = _mm512_set1_epi32(b);
+            mVec[0] = remainderVector(mVec[0], t0);
+            mVec[1] = remainderVector(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (uint32_t b) {
+            return rema(b);
+        }
+        // MREMSA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<32> const & mask, uint32_t b) {
+            __mmask16 m0 = mask.mMask & 0x0000FFFF;
+            __mmask16 m1 = (mask.mMask & 0xFFFF0000) >> 16;
+            __m512i t0 = _mm512_set1_epi32(b);
+            __m512i t1 = remainderVector(mVec[0], t0);
+            mVec[0] = _mm512_mask_mov_epi32(mVec[0], m0, t1);
+            __m512i t2 = remainderVector(mVec[1], t0);
+            mVec[1] = _mm512_mask_mov_epi32(mVec[1], m1, t2);
+            return *this;
+        }
+        // REMD
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDDivisor<uint32_t> const & b) const {
+            __m512i t0 = remainderMagic(mVec[0], b);
+            __m512i t1 = remainderMagic(mVec[1], b);
+            return SIMDVec_u(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (SIMDDivisor<uint32_t> const & b) const {
+            return rem(b);
+        }
+        // MREMD
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<32> const & mask, SIMDDivisor<uint32_t> const & b) const {
+            __mmask16 m0 = mask.mMask & 0x0000FFFF;
+            __mmask16 m1 = (mask.mMask & 0xFFFF0000) >> 16;
+            __m512i t0 = remainderMagic(mVec[0], b);
+            __m512i t1 = _mm512_mask_mov_epi32(mVec[0], m0, t0);
+            __m512i t2 = remainderMagic(mVec[1], b);
+            __m512i t3 = _mm512_mask_mov_epi32(mVec[1], m1, t2);
+            return SIMDVec_u(t1, t3);
+        }
+        // REMDA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDDivisor<uint32_t> const & b) {
+            mVec[0] = remainderMagic(mVec[0], b);
+            mVec[1] = remainderMagic(mVec[1], b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (SIMDDivisor<uint32_t> const & b) {
+            return rema(b);
+        }
+        // MREMDA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<32> const & mask, SIMDDivisor<uint32_t> const & b) {
+            __mmask16 m0 = mask.mMask & 0x0000FFFF;
+            __mmask16 m1 = (mask.mMask & 0xFFFF0000) >> 16;
+            __m512i t0 = remainderMagic(mVec[0], b);
+            mVec[0] = _mm512_mask_mov_epi32(mVec[0], m0, t0);
+            __m512i t1 = remainderMagic(mVec[1], b);
+            mVec[1] = _mm512_mask_mov_epi32(mVec[1], m1, t1);
+            return *this;
+        }
         // RCP
         // MRCP
         // RCPS
@@ -64,6 +64,40 @@ namespace SIMD {
         UME_FORCE_INLINE explicit SIMDVec_u(__m128i & x) { mVec = x; }
         UME_FORCE_INLINE explicit SIMDVec_u(const __m128i & x) { mVec = x; }
 
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m128i saturatedAdd(__m128i const & a, __m128i const & b) {
+            return _mm_add_epi32(a, _mm_min_epu32(b, _mm_xor_si128(a, _mm_set1_epi32(-1))));
+        }
+        static UME_FORCE_INLINE __m128i saturatedSub(__m128i const & a, __m128i const & b) {
+            return _mm_sub_epi32(_mm_max_epu32(a, b), b);
+        }
+        // Lane-wise division through double precision, exact for 32-bit operands.
+        static UME_FORCE_INLINE __m128i divideVector(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_set1_epi32(0x80000000);
+            __m256d t1 = _mm256_set1_pd(2147483648.0);
+            __m256d t2 = _mm256_add_pd(_mm256_cvtepi32_pd(_mm_xor_si128(a, t0)), t1);
+            __m256d t3 = _mm256_add_pd(_mm256_cvtepi32_pd(_mm_xor_si128(b, t0)), t1);
+            __m256d t4 = _mm256_round_pd(_mm256_div_pd(t2, t3), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+            return _mm_xor_si128(_mm256_cvttpd_epi32(_mm256_sub_pd(t4, t1)), t0);
+        }
+        static UME_FORCE_INLINE __m128i remainderVector(__m128i const & a, __m128i const & b) {
+            __m128i t0 = divideVector(a, b);
+            return _mm_sub_epi32(a, _mm_mullo_epi32(t0, b));
+        }
+        // Division by a precomputed divisor, used by DIVD*/REMD*.
+        static UME_FORCE_INLINE __m128i divideMagic(__m128i const & a, SIMDDivisor<uint32_t> const & b) {
+            __m128i t0 = _mm_set1_epi32(b.magic());
+            __m128i t1 = _mm_mul_epu32(a, t0);
+            __m128i t2 = _mm_mul_epu32(_mm_srli_epi64(a, 32), t0);
+            __m128i t3 = _mm_blend_epi32(_mm_srli_epi64(t1, 32), t2, 0xA);
+            __m128i t4 = _mm_srl_epi32(_mm_sub_epi32(a, t3), _mm_cvtsi32_si128(b.shift1()));
+            return _mm_srl_epi32(_mm_add_epi32(t3, t4), _mm_cvtsi32_si128(b.shift2()));
+        }
+        static UME_FORCE_INLINE __m128i remainderMagic(__m128i const & a, SIMDDivisor<uint32_t> const & b) {
+            __m128i t0 = divideMagic(a, b);
+            return _mm_sub_epi32(a, _mm_mullo_epi32(t0, _mm_set1_epi32(b.divisor())));
+        }
+
     public:
 
         constexpr static uint32_t length() { return 4; }
@@ -275,7 +309,22 @@ namespace SIMD {
 #endif
         }
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_u swizzle(SIMDSwizzle<4> const & sMask) const {
+            __m128 t0 = _mm_permutevar_ps(_mm_castsi128_ps(mVec), sMask.mVec);
+            __m128i t1 = _mm_castps_si128(t0);
+            return SIMDVec_u(t1);
+        }
+        template<int i0, int i1, int i2, int i3>
+        UME_FORCE_INLINE SIMDVec_u swizzle() const {
+            __m128i t0 = _mm_shuffle_epi32(mVec, (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6));
+            return SIMDVec_u(t0);
+        }
         // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_u & swizzlea(SIMDSwizzle<4> const & sMask) {
+            SIMDVec_u t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
         // SORTA
         // SORTD
         // ADDV
@@ -363,13 +412,75 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVec_u const & b) const {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            return SIMDVec_u(t1);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            return SIMDVec_u(t1);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            return SIMDVec_u(t2);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVec_u const & b) {
+            mVec = saturatedAdd(mVec, b.mVec);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = saturatedAdd(mVec, t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_u postinc() {
             __m128i t0 = _mm_set1_epi32(1);
@@ -503,13 +614,75 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVec_u const & b) const {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            return SIMDVec_u(t1);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            return SIMDVec_u(t1);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            return SIMDVec_u(t2);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVec_u const & b) {
+            mVec = saturatedSub(mVec, b.mVec);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = saturatedSub(mVec, t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVec_u const & b) const {
             __m128i t0 = _mm_sub_epi32(b.mVec, mVec);
@@ -715,13 +888,247 @@ namespace SIMD {
             return *this;
         }
         // DIVV
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVec_u const & b) const {
+            __m128i t0 = divideVector(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (SIMDVec_u const & b) const {
+            return div(b);
+        }
         // MDIVV
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = divideVector(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            return SIMDVec_u(t1);
+        }
         // DIVS
+        UME_FORCE_INLINE SIMDVec_u div(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = divideVector(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (uint32_t b) const {
+            return div(b);
+        }
         // MDIVS
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = divideVector(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            return SIMDVec_u(t2);
+        }
         // DIVVA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVec_u const & b) {
+            mVec = divideVector(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDVec_u const & b) {
+            return diva(b);
+        }
         // MDIVVA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = divideVector(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // DIVSA
+        UME_FORCE_INLINE SIMDVec_u & diva(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = divideVector(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (uint32_t b) {
+            return diva(b);
+        }
         // MDIVSA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = divideVector(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDDivisor<uint32_t> const & b) const {
+            __m128i t0 = divideMagic(mVec, b);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (SIMDDivisor<uint32_t> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<4> const & mask, SIMDDivisor<uint32_t> const & b) const {
+            __m128i t0 = divideMagic(mVec, b);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            return SIMDVec_u(t1);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDDivisor<uint32_t> const & b) {
+            mVec = divideMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDDivisor<uint32_t> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<4> const & mask, SIMDDivisor<uint32_t> const & b) {
+            __m128i t0 = divideMagic(mVec, b);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
+        // REMV
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVec_u const & b) const {
+            __m128i t0 = remainderVector(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (SIMDVec_u const & b) const {
+            return rem(b);
+        }
+        // MREMV
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = remainderVector(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            return SIMDVec_u(t1);
+        }
+        // REMS
+        UME_FORCE_INLINE SIMDVec_u rem(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = remainderVector(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (uint32_t b) const {
+            return rem(b);
+        }
+        // MREMS
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = remainderVector(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            return SIMDVec_u(t2);
+        }
+        // REMVA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVec_u const & b) {
+            mVec = remainderVector(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (SIMDVec_u const & b) {
+            return rema(b);
+        }
+        // MREMVA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = remainderVector(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
+        // REMSA
+        UME_FORCE_INLINE SIMDVec_u & rema(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = remainderVector(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (uint32_t b) {
+            return rema(b);
+        }
+        // MREMSA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = remainderVector(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
+        // REMD
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDDivisor<uint32_t> const & b) const {
+            __m128i t0 = remainderMagic(mVec, b);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (SIMDDivisor<uint32_t> const & b) const {
+            return rem(b);
+        }
+        // MREMD
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<4> const & mask, SIMDDivisor<uint32_t> const & b) const {
+            __m128i t0 = remainderMagic(mVec, b);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            return SIMDVec_u(t1);
+        }
+        // REMDA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDDivisor<uint32_t> const & b) {
+            mVec = remainderMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (SIMDDivisor<uint32_t> const & b) {
+            return rema(b);
+        }
+        // MREMDA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<4> const & mask, SIMDDivisor<uint32_t> const & b) {
+            __m128i t0 = remainderMagic(mVec, b);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi128_si512(mVec), __mmask16(mask.mMask), _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // RCP
         // MRCP
         // RCPS
@@ -1404,10 +1811,6 @@ namespace SIMD {
         // IMIN
         // MIMIN
         
-        // REMV
-        // MREMV
-        // REMS
-        // MREMS
         // BANDV
         UME_FORCE_INLINE SIMDVec_u band(SIMDVec_u const & b) const {
             __m128i t0 = _mm_and_si128(mVec, b.mVec);
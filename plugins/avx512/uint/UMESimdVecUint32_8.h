@@ -55,6 +55,7 @@ namespace SIMD {
         // Conversion operators require access to private members.
         friend class SIMDVec_i<int32_t, 8>;
         friend class SIMDVec_f<float, 8>;
+        friend class SIMDVec_u<uint16_t, 8>;
 
         friend class SIMDVec_u<uint32_t, 16>;
     private:
@@ -62,6 +63,67 @@ namespace SIMD {
 
         UME_FORCE_INLINE explicit SIMDVec_u(__m256i & x) { mVec = x; }
         UME_FORCE_INLINE explicit SIMDVec_u(const __m256i & x) { mVec = x; }
+
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m256i saturatedAdd(__m256i const & a, __m256i const & b) {
+            return _mm256_add_epi32(a, _mm256_min_epu32(b, _mm256_xor_si256(a, _mm256_set1_epi32(-1))));
+        }
+        static UME_FORCE_INLINE __m256i saturatedSub(__m256i const & a, __m256i const & b) {
+            return _mm256_sub_epi32(_mm256_max_epu32(a, b), b);
+        }
+        // Lane-wise division through double precision, exact for 32-bit operands.
+        static UME_FORCE_INLINE __m128i divideHalf(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_set1_epi32(0x80000000);
+            __m256d t1 = _mm256_set1_pd(2147483648.0);
+            __m256d t2 = _mm256_add_pd(_mm256_cvtepi32_pd(_mm_xor_si128(a, t0)), t1);
+            __m256d t3 = _mm256_add_pd(_mm256_cvtepi32_pd(_mm_xor_si128(b, t0)), t1);
+            __m256d t4 = _mm256_round_pd(_mm256_div_pd(t2, t3), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+            return _mm_xor_si128(_mm256_cvttpd_epi32(_mm256_sub_pd(t4, t1)), t0);
+        }
+        static UME_FORCE_INLINE __m256i divideVector(__m256i const & a, __m256i const & b) {
+            __m128i t0 = divideHalf(_mm256_castsi256_si128(a), _mm256_castsi256_si128(b));
+            __m128i t1 = divideHalf(_mm256_extracti128_si256(a, 1), _mm256_extracti128_si256(b, 1));
+            return _mm256_inserti128_si256(_mm256_castsi128_si256(t0), t1, 1);
+        }
+        static UME_FORCE_INLINE __m256i remainderVector(__m256i const & a, __m256i const & b) {
+            __m256i t0 = divideVector(a, b);
+            return _mm256_sub_epi32(a, _mm256_mullo_epi32(t0, b));
+        }
+        // Division by a precomputed divisor, used by DIVD*/REMD*.
+        static UME_FORCE_INLINE __m256i divideMagic(__m256i const & a, SIMDDivisor<uint32_t> const & b) {
+            __m256i t0 = _mm256_set1_epi32(b.magic());
+            __m256i t1 = _mm256_mul_epu32(a, t0);
+            __m256i t2 = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), t0);
+            __m256i t3 = _mm256_blend_epi32(_mm256_srli_epi64(t1, 32), t2, 0xAA);
+            __m256i t4 = _mm256_srl_epi32(_mm256_sub_epi32(a, t3), _mm_cvtsi32_si128(b.shift1()));
+            return _mm256_srl_epi32(_mm256_add_epi32(t3, t4), _mm_cvtsi32_si128(b.shift2()));
+        }
+        static UME_FORCE_INLINE __m256i remainderMagic(__m256i const & a, SIMDDivisor<uint32_t> const & b) {
+            __m256i t0 = divideMagic(a, b);
+            return _mm256_sub_epi32(a, _mm256_mullo_epi32(t0, _mm256_set1_epi32(b.divisor())));
+        }
+        // Adds lanes of 'v' selected by bits of 'm' to baseAddr[indices[i]].
+        // Lanes sharing an index are summed in registers first: each of them
+        // repeatedly adds the partial sum of its nearest preceding duplicate
+        // and jumps to that lane's predecessor, so after log2(duplicates)
+        // steps the last duplicate holds the total. Overlapping scatter writes
+        // are ordered from the lowest to the highest lane, which leaves that
+        // total in memory.
+        static UME_FORCE_INLINE void scatterAddLanes(uint32_t * baseAddr, __m512i v, __m512i indices, __mmask16 m) {
+            __m512i t0 = _mm512_and_si512(_mm512_conflict_epi32(indices), _mm512_set1_epi32(m));
+            __mmask16 t1 = _mm512_mask_test_epi32_mask(m, t0, t0);
+            __m512i t2 = _mm512_sub_epi32(_mm512_set1_epi32(31), _mm512_lzcnt_epi32(t0));
+            __m512i t3 = v;
+            while (t1 != 0) {
+                __m512i t4 = _mm512_permutexvar_epi32(t2, t3);
+                t2 = _mm512_mask_permutexvar_epi32(t2, t1, t2, t2);
+                t3 = _mm512_mask_add_epi32(t3, t1, t3, t4);
+                t1 = _mm512_mask_cmpneq_epi32_mask(t1, t2, _mm512_set1_epi32(-1));
+            }
+            __m512i t5 = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), m, indices, (const int *)baseAddr, 4);
+            t5 = _mm512_add_epi32(t5, t3);
+            _mm512_mask_i32scatter_epi32((int *)baseAddr, m, indices, t5, 4);
+        }
     public:
 
         constexpr static uint32_t length() { return 8; }
@@ -249,6 +311,14 @@ namespace SIMD {
 #endif
             return p;
         }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressstore(SIMDVecMask<8> const & mask, uint32_t * p) const {
+            __mmask16 t0 = __mmask16(mask.mMask & 0xFF);
+            uint32_t t1 = uint32_t(_mm_popcnt_u32(t0));
+            __m512i t2 = _mm512_maskz_compress_epi32(t0, _mm512_castsi256_si512(mVec));
+            _mm512_mask_storeu_epi32(p, __mmask16((1 << t1) - 1), t2);
+            return t1;
+        }
         // BLENDV
         UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
 #if defined(__AVX512VL__)
@@ -279,64 +349,27 @@ namespace SIMD {
         
         // SWIZZLE
         UME_FORCE_INLINE SIMDVec_u swizzle(SIMDSwizzle<8> const & sMask) const {
-#if defined(WA_GCC_INTR_SUPPORT_6_2)
-            // Use AVX2 intrinsics
-            __m256i t0  = _mm256_permutevar8x32_epi32(mVec, sMask.mVec);
-            return SIMDVec_u(t0);
-#else
-  #if defined(__AVX512VL__)
-            __m256i t0 = _mm256_permutexvar_epi32(mVec, sMask.mVec);
+            __m256i t0 = _mm256_permutevar8x32_epi32(mVec, sMask.mVec);
             return SIMDVec_u(t0);
-  #else
-            __m512i t0 = _mm512_castsi256_si512(sMask.mVec);
-            __m512i t1 = _mm512_castsi256_si512(mVec);
-            __m512i t2 = _mm512_permutexvar_epi32(t0, t1);
-            __m256i t3 = _mm512_castsi512_si256(t2);
-            return SIMDVec_u(t3);
-  #endif
-#endif
         }
         template<int i0, int i1, int i2, int i3, int i4, int i5, int i6, int i7>
-        UME_FORCE_INLINE SIMDVec_u swizzle() {
-#if defined(WA_GCC_INTR_SUPPORT_6_2)
-            // Use AVX2 intrinsics
-            __m256i t0  = _mm256_setr_epi32(i0, i1, i2, i3, i4, i5, i6, i7);
-            __m256i t1  = _mm256_permutevar8x32_epi32(mVec, t0);
-            return SIMDVec_u(t1);
-#else
-  #if defined(__AVX512VL__)
-            __m256i t0 = _mm256_setr_epi32(i0, i1, i2, i3, i4, i5, i6, i7);
-            __m256i t1 = _mm256_permutexvar_epi32(mVec, t0);
-            return SIMDVec_u(t1);
-  #else
-            __m512i t0 = _mm512_setr_epi32(
-                i0, i1, i2, i3, i4, i5, i6, i7,
-                i0, i1, i2, i3, i4, i5, i6, i7);
-            __m512i t1 = _mm512_castsi256_si512(mVec);
-            __m512i t2 = _mm512_permutexvar_epi32(t0, t1);
-            __m256i t3 = _mm512_castsi512_si256(t2);
-            return SIMDVec_u(t3);
-  #endif
-#endif
+        UME_FORCE_INLINE SIMDVec_u swizzle() const {
+            const int imm = (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6);
+            // Patterns repeated in both 128-bit lanes need only an immediate shuffle.
+            if (i0 < 4 && i1 < 4 && i2 < 4 && i3 < 4 && i4 == i0 + 4 && i5 == i1 + 4 &&
+                i6 == i2 + 4 && i7 == i3 + 4) {
+                __m256i t0 = _mm256_shuffle_epi32(mVec, imm);
+                return SIMDVec_u(t0);
+            }
+            __m256i t1 = _mm256_setr_epi32(i0, i1, i2, i3, i4, i5, i6, i7);
+            __m256i t2 = _mm256_permutevar8x32_epi32(mVec, t1);
+            return SIMDVec_u(t2);
         }
         // SWIZZLEA
         UME_FORCE_INLINE SIMDVec_u & swizzlea(SIMDSwizzle<8> const & sMask) {
-#if defined(WA_GCC_INTR_SUPPORT_6_2)
-            // Use AVX2 intrinsics
-            mVec  = _mm256_permutevar8x32_epi32(mVec, sMask.mVec);
-            return *this;
-#else
-  #if defined(__AVX512VL__)
-            mVec = _mm256_permutexvar_epi32(mVec, sMask.mVec);
-            return *this;
-  #else
-            __m512i t0 = _mm512_castsi256_si512(sMask.mVec);
-            __m512i t1 = _mm512_castsi256_si512(mVec);
-            __m512i t2 = _mm512_permutexvar_epi32(t0, t1);
-            mVec = _mm512_castsi512_si256(t2);
+            SIMDVec_u t0 = swizzle(sMask);
+            mVec = t0.mVec;
             return *this;
-  #endif
-#endif
         }
 
         // SORTA
@@ -427,13 +460,75 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVec_u const & b) const {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            return SIMDVec_u(t1);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+            return SIMDVec_u(t1);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            return SIMDVec_u(t2);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVec_u const & b) {
+            mVec = saturatedAdd(mVec, b.mVec);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec = saturatedAdd(mVec, t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_u postinc() {
             __m256i t0 = _mm256_set1_epi32(1);
@@ -563,13 +658,75 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVec_u const & b) const {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            return SIMDVec_u(t1);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+            return SIMDVec_u(t1);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            return SIMDVec_u(t2);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVec_u const & b) {
+            mVec = saturatedSub(mVec, b.mVec);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec = saturatedSub(mVec, t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVec_u const & b) const {
             __m256i t0 = _mm256_sub_epi32(b.mVec, mVec);
@@ -769,25 +926,247 @@ namespace SIMD {
             return *this;
         }
         // DIVV
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVec_u const & b) const {
+            __m256i t0 = divideVector(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         UME_FORCE_INLINE SIMDVec_u operator/ (SIMDVec_u const & b) const {
             return div(b);
         }
         // MDIVV
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = divideVector(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            return SIMDVec_u(t1);
+        }
         // DIVS
+        UME_FORCE_INLINE SIMDVec_u div(uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = divideVector(mVec, t0);
+            return SIMDVec_u(t1);
+        }
         UME_FORCE_INLINE SIMDVec_u operator/ (uint32_t b) const {
             return div(b);
         }
         // MDIVS
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = divideVector(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            return SIMDVec_u(t2);
+        }
         // DIVVA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVec_u const & b) {
+            mVec = divideVector(mVec, b.mVec);
+            return *this;
+        }
         UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDVec_u const & b) {
             return diva(b);
         }
         // MDIVVA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = divideVector(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // DIVSA
+        UME_FORCE_INLINE SIMDVec_u & diva(uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec = divideVector(mVec, t0);
+            return *this;
+        }
         UME_FORCE_INLINE SIMDVec_u & operator/= (uint32_t b) {
             return diva(b);
         }
         // MDIVSA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = divideVector(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDDivisor<uint32_t> const & b) const {
+            __m256i t0 = divideMagic(mVec, b);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (SIMDDivisor<uint32_t> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<8> const & mask, SIMDDivisor<uint32_t> const & b) const {
+            __m256i t0 = divideMagic(mVec, b);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            return SIMDVec_u(t1);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDDivisor<uint32_t> const & b) {
+            mVec = divideMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDDivisor<uint32_t> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<8> const & mask, SIMDDivisor<uint32_t> const & b) {
+            __m256i t0 = divideMagic(mVec, b);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
+        // REMV
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVec_u const & b) const {
+            __m256i t0 = remainderVector(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (SIMDVec_u const & b) const {
+            return rem(b);
+        }
+        // MREMV
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = remainderVector(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            return SIMDVec_u(t1);
+        }
+        // REMS
+        UME_FORCE_INLINE SIMDVec_u rem(uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = remainderVector(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (uint32_t b) const {
+            return rem(b);
+        }
+        // MREMS
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = remainderVector(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            return SIMDVec_u(t2);
+        }
+        // REMVA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVec_u const & b) {
+            mVec = remainderVector(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (SIMDVec_u const & b) {
+            return rema(b);
+        }
+        // MREMVA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = remainderVector(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
+        // REMSA
+        UME_FORCE_INLINE SIMDVec_u & rema(uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            mVec = remainderVector(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (uint32_t b) {
+            return rema(b);
+        }
+        // MREMSA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m256i t0 = _mm256_set1_epi32(b);
+            __m256i t1 = remainderVector(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi32(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
+        // REMD
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDDivisor<uint32_t> const & b) const {
+            __m256i t0 = remainderMagic(mVec, b);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (SIMDDivisor<uint32_t> const & b) const {
+            return rem(b);
+        }
+        // MREMD
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<8> const & mask, SIMDDivisor<uint32_t> const & b) const {
+            __m256i t0 = remainderMagic(mVec, b);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            return SIMDVec_u(t1);
+        }
+        // REMDA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDDivisor<uint32_t> const & b) {
+            mVec = remainderMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (SIMDDivisor<uint32_t> const & b) {
+            return rema(b);
+        }
+        // MREMDA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<8> const & mask, SIMDDivisor<uint32_t> const & b) {
+            __m256i t0 = remainderMagic(mVec, b);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi32(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi32(_mm512_castsi256_si512(mVec), __mmask16(mask.mMask), _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // RCP
         // MRCP
         // RCPS
@@ -2107,6 +2486,16 @@ namespace SIMD {
 #endif
             return baseAddr;
         }
+        // SCATTERADDV
+        UME_FORCE_INLINE uint32_t* scatteradd(uint32_t* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
+            scatterAddLanes(baseAddr, _mm512_castsi256_si512(mVec), _mm512_castsi256_si512(indices.mVec), 0xFF);
+            return baseAddr;
+        }
+        // MSCATTERADDV
+        UME_FORCE_INLINE uint32_t* scatteradd(SIMDVecMask<8> const & mask, uint32_t* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
+            scatterAddLanes(baseAddr, _mm512_castsi256_si512(mVec), _mm512_castsi256_si512(indices.mVec), __mmask16(mask.mMask & 0xFF));
+            return baseAddr;
+        }
         // LSHV
         UME_FORCE_INLINE SIMDVec_u lsh(SIMDVec_u const & b) const {
             __m256i t0 = _mm256_sllv_epi32(mVec, b.mVec);
@@ -89,6 +89,14 @@ namespace SIMD {
             mVec[1] = x1;
         }
 
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m512i saturatedAdd(__m512i const & a, __m512i const & b) {
+            return _mm512_add_epi64(a, _mm512_min_epu64(b, _mm512_xor_si512(a, _mm512_set1_epi64(-1))));
+        }
+        static UME_FORCE_INLINE __m512i saturatedSub(__m512i const & a, __m512i const & b) {
+            return _mm512_sub_epi64(_mm512_max_epu64(a, b), b);
+        }
+
     public:
         constexpr static uint32_t length() { return 16; }
         constexpr static uint32_t alignment() { return 64; }
@@ -361,13 +369,73 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVec_u const & b) const {
+            __m512i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            __m512i t1 = saturatedAdd(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __mmask8 m0 = mask.mMask & 0x00FF;
+            __mmask8 m1 = (mask.mMask & 0xFF00) >> 8;
+            __m512i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            __m512i t1 = _mm512_mask_mov_epi64(mVec[0], m0, t0);
+            __m512i t2 = saturatedAdd(mVec[1], b.mVec[1]);
+            __m512i t3 = _mm512_mask_mov_epi64(mVec[1], m1, t2);
+            return SIMDVec_u(t1, t3);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(uint64_t b) const {
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedAdd(mVec[0], t0);
+            __m512i t2 = saturatedAdd(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<16> const & mask, uint64_t b) const {
+            __mmask8 m0 = mask.mMask & 0x00FF;
+            __mmask8 m1 = (mask.mMask & 0xFF00) >> 8;
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedAdd(mVec[0], t0);
+            __m512i t2 = _mm512_mask_mov_epi64(mVec[0], m0, t1);
+            __m512i t3 = saturatedAdd(mVec[1], t0);
+            __m512i t4 = _mm512_mask_mov_epi64(mVec[1], m1, t3);
+            return SIMDVec_u(t2, t4);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVec_u const & b) {
+            mVec[0] = saturatedAdd(mVec[0], b.mVec[0]);
+            mVec[1] = saturatedAdd(mVec[1], b.mVec[1]);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __mmask8 m0 = mask.mMask & 0x00FF;
+            __mmask8 m1 = (mask.mMask & 0xFF00) >> 8;
+            __m512i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            mVec[0] = _mm512_mask_mov_epi64(mVec[0], m0, t0);
+            __m512i t1 = saturatedAdd(mVec[1], b.mVec[1]);
+            mVec[1] = _mm512_mask_mov_epi64(mVec[1], m1, t1);
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(uint64_t b) {
+            __m512i t0 = _mm512_set1_epi64(b);
+            mVec[0] = saturatedAdd(mVec[0], t0);
+            mVec[1] = saturatedAdd(mVec[1], t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<16> const & mask, uint64_t b) {
+            __mmask8 m0 = mask.mMask & 0x00FF;
+            __mmask8 m1 = (mask.mMask & 0xFF00) >> 8;
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedAdd(mVec[0], t0);
+            mVec[0] = _mm512_mask_mov_epi64(mVec[0], m0, t1);
+            __m512i t2 = saturatedAdd(mVec[1], t0);
+            mVec[1] = _mm512_mask_mov_epi64(mVec[1], m1, t2);
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_u postinc() {
             __m512i t0 = _mm512_set1_epi64(1);
@@ -477,13 +545,73 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVec_u const & b) const {
+            __m512i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            __m512i t1 = saturatedSub(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __mmask8 m0 = mask.mMask & 0x00FF;
+            __mmask8 m1 = (mask.mMask & 0xFF00) >> 8;
+            __m512i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            __m512i t1 = _mm512_mask_mov_epi64(mVec[0], m0, t0);
+            __m512i t2 = saturatedSub(mVec[1], b.mVec[1]);
+            __m512i t3 = _mm512_mask_mov_epi64(mVec[1], m1, t2);
+            return SIMDVec_u(t1, t3);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(uint64_t b) const {
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedSub(mVec[0], t0);
+            __m512i t2 = saturatedSub(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<16> const & mask, uint64_t b) const {
+            __mmask8 m0 = mask.mMask & 0x00FF;
+            __mmask8 m1 = (mask.mMask & 0xFF00) >> 8;
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedSub(mVec[0], t0);
+            __m512i t2 = _mm512_mask_mov_epi64(mVec[0], m0, t1);
+            __m512i t3 = saturatedSub(mVec[1], t0);
+            __m512i t4 = _mm512_mask_mov_epi64(mVec[1], m1, t3);
+            return SIMDVec_u(t2, t4);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVec_u const & b) {
+            mVec[0] = saturatedSub(mVec[0], b.mVec[0]);
+            mVec[1] = saturatedSub(mVec[1], b.mVec[1]);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __mmask8 m0 = mask.mMask & 0x00FF;
+            __mmask8 m1 = (mask.mMask & 0xFF00) >> 8;
+            __m512i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            mVec[0] = _mm512_mask_mov_epi64(mVec[0], m0, t0);
+            __m512i t1 = saturatedSub(mVec[1], b.mVec[1]);
+            mVec[1] = _mm512_mask_mov_epi64(mVec[1], m1, t1);
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(uint64_t b) {
+            __m512i t0 = _mm512_set1_epi64(b);
+            mVec[0] = saturatedSub(mVec[0], t0);
+            mVec[1] = saturatedSub(mVec[1], t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<16> const & mask, uint64_t b) {
+            __mmask8 m0 = mask.mMask & 0x00FF;
+            __mmask8 m1 = (mask.mMask & 0xFF00) >> 8;
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedSub(mVec[0], t0);
+            mVec[0] = _mm512_mask_mov_epi64(mVec[0], m0, t1);
+            __m512i t2 = saturatedSub(mVec[1], t0);
+            mVec[1] = _mm512_mask_mov_epi64(mVec[1], m1, t2);
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVec_u const & b) const {
             __m512i t0 = _mm512_sub_epi64(b.mVec[0], mVec[0]);
@@ -87,6 +87,20 @@ namespace SIMD {
         UME_FORCE_INLINE explicit SIMDVec_u(__m128i & x) { mVec = x; }
         UME_FORCE_INLINE explicit SIMDVec_u(const __m128i & x) { mVec = x; }
 
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m128i saturatedAdd(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_add_epi64(a, b);
+            __m128i t1 = _mm_slli_epi64(_mm_cmpeq_epi64(a, a), 63);
+            __m128i t2 = _mm_cmpgt_epi64(_mm_xor_si128(a, t1), _mm_xor_si128(t0, t1));
+            return _mm_or_si128(t0, t2);
+        }
+        static UME_FORCE_INLINE __m128i saturatedSub(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_sub_epi64(a, b);
+            __m128i t1 = _mm_slli_epi64(_mm_cmpeq_epi64(a, a), 63);
+            __m128i t2 = _mm_cmpgt_epi64(_mm_xor_si128(b, t1), _mm_xor_si128(a, t1));
+            return _mm_andnot_si128(t2, t0);
+        }
+
     public:
         constexpr static uint32_t length() { return 2; }
         constexpr static uint32_t alignment() { return 16; }
@@ -302,7 +316,27 @@ namespace SIMD {
 #endif
         }
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_u swizzle(SIMDSwizzle<2> const & sMask) const {
+            __m128i t0 = _mm_set_epi64x(
+                int64_t(sMask[1] & 1) << 1,
+                int64_t(sMask[0] & 1) << 1);
+            __m128d t1 = _mm_permutevar_pd(_mm_castsi128_pd(mVec), t0);
+            __m128i t2 = _mm_castpd_si128(t1);
+            return SIMDVec_u(t2);
+        }
+        template<int i0, int i1>
+        UME_FORCE_INLINE SIMDVec_u swizzle() const {
+            const int imm = ((i0 & 1) * 2) | (((i0 & 1) * 2 + 1) << 2) |
+                            (((i1 & 1) * 2) << 4) | (((i1 & 1) * 2 + 1) << 6);
+            __m128i t0 = _mm_shuffle_epi32(mVec, imm);
+            return SIMDVec_u(t0);
+        }
         // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_u & swizzlea(SIMDSwizzle<2> const & sMask) {
+            SIMDVec_u t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
 
         // SORTA
         // SORTD
@@ -376,13 +410,75 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVec_u const & b) const {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi64(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi64(_mm512_castsi128_si512(mVec), mask.mMask, _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            return SIMDVec_u(t1);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(uint64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            return SIMDVec_u(t1);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi64(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi64(_mm512_castsi128_si512(mVec), mask.mMask, _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            return SIMDVec_u(t2);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVec_u const & b) {
+            mVec = saturatedAdd(mVec, b.mVec);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi64(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi64(_mm512_castsi128_si512(mVec), mask.mMask, _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(uint64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            mVec = saturatedAdd(mVec, t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi64(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi64(_mm512_castsi128_si512(mVec), mask.mMask, _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_u postinc() {
             __m128i t0 = SET1_EPI64(1);
@@ -490,13 +586,75 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVec_u const & b) const {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi64(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi64(_mm512_castsi128_si512(mVec), mask.mMask, _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            return SIMDVec_u(t1);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(uint64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            return SIMDVec_u(t1);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi64(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi64(_mm512_castsi128_si512(mVec), mask.mMask, _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            return SIMDVec_u(t2);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVec_u const & b) {
+            mVec = saturatedSub(mVec, b.mVec);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m128i t1 = _mm_mask_mov_epi64(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi64(_mm512_castsi128_si512(mVec), mask.mMask, _mm512_castsi128_si512(t0));
+            __m128i t1 = _mm512_castsi512_si128(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(uint64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            mVec = saturatedSub(mVec, t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = _mm_set1_epi64x(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+#if defined(__AVX512VL__)
+            __m128i t2 = _mm_mask_mov_epi64(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi64(_mm512_castsi128_si512(mVec), mask.mMask, _mm512_castsi128_si512(t1));
+            __m128i t2 = _mm512_castsi512_si128(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVec_u const & b) const {
             __m128i t0 = _mm_sub_epi64(b.mVec, mVec);
@@ -87,6 +87,20 @@ namespace SIMD {
         UME_FORCE_INLINE explicit SIMDVec_u(__m256i & x) { mVec = x; }
         UME_FORCE_INLINE explicit SIMDVec_u(const __m256i & x) { mVec = x; }
 
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m256i saturatedAdd(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_add_epi64(a, b);
+            __m256i t1 = _mm256_slli_epi64(_mm256_cmpeq_epi64(a, a), 63);
+            __m256i t2 = _mm256_cmpgt_epi64(_mm256_xor_si256(a, t1), _mm256_xor_si256(t0, t1));
+            return _mm256_or_si256(t0, t2);
+        }
+        static UME_FORCE_INLINE __m256i saturatedSub(__m256i const & a, __m256i const & b) {
+            __m256i t0 = _mm256_sub_epi64(a, b);
+            __m256i t1 = _mm256_slli_epi64(_mm256_cmpeq_epi64(a, a), 63);
+            __m256i t2 = _mm256_cmpgt_epi64(_mm256_xor_si256(b, t1), _mm256_xor_si256(a, t1));
+            return _mm256_andnot_si256(t2, t0);
+        }
+
     public:
         constexpr static uint32_t length() { return 4; }
         constexpr static uint32_t alignment() { return 32; }
@@ -297,7 +311,26 @@ namespace SIMD {
 #endif
         }
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_u swizzle(SIMDSwizzle<4> const & sMask) const {
+            // Expand each 64-bit lane index i into the 32-bit index pair (2i, 2i+1).
+            __m256i t0 = _mm256_cvtepu32_epi64(sMask.mVec);
+            __m256i t1 = _mm256_slli_epi64(t0, 1);
+            __m256i t2 = _mm256_or_si256(t1, _mm256_slli_epi64(t1, 32));
+            __m256i t3 = _mm256_add_epi32(t2, _mm256_setr_epi32(0, 1, 0, 1, 0, 1, 0, 1));
+            __m256i t4 = _mm256_permutevar8x32_epi32(mVec, t3);
+            return SIMDVec_u(t4);
+        }
+        template<int i0, int i1, int i2, int i3>
+        UME_FORCE_INLINE SIMDVec_u swizzle() const {
+            __m256i t0 = _mm256_permute4x64_epi64(mVec, (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6));
+            return SIMDVec_u(t0);
+        }
         // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_u & swizzlea(SIMDSwizzle<4> const & sMask) {
+            SIMDVec_u t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
 
         // SORTA
         // SORTD
@@ -371,13 +404,75 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVec_u const & b) const {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi64(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi64(_mm512_castsi256_si512(mVec), mask.mMask, _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            return SIMDVec_u(t1);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(uint64_t b) const {
+            __m256i t0 = _mm256_set1_epi64x(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+            return SIMDVec_u(t1);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = _mm256_set1_epi64x(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi64(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi64(_mm512_castsi256_si512(mVec), mask.mMask, _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            return SIMDVec_u(t2);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVec_u const & b) {
+            mVec = saturatedAdd(mVec, b.mVec);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = saturatedAdd(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi64(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi64(_mm512_castsi256_si512(mVec), mask.mMask, _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(uint64_t b) {
+            __m256i t0 = _mm256_set1_epi64x(b);
+            mVec = saturatedAdd(mVec, t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m256i t0 = _mm256_set1_epi64x(b);
+            __m256i t1 = saturatedAdd(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi64(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi64(_mm512_castsi256_si512(mVec), mask.mMask, _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_u postinc() {
             __m256i t0 = SET1_EPI64(1);
@@ -485,13 +580,75 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVec_u const & b) const {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi64(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi64(_mm512_castsi256_si512(mVec), mask.mMask, _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            return SIMDVec_u(t1);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(uint64_t b) const {
+            __m256i t0 = _mm256_set1_epi64x(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+            return SIMDVec_u(t1);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<4> const & mask, uint64_t b) const {
+            __m256i t0 = _mm256_set1_epi64x(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi64(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi64(_mm512_castsi256_si512(mVec), mask.mMask, _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            return SIMDVec_u(t2);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVec_u const & b) {
+            mVec = saturatedSub(mVec, b.mVec);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m256i t0 = saturatedSub(mVec, b.mVec);
+#if defined(__AVX512VL__)
+            __m256i t1 = _mm256_mask_mov_epi64(mVec, mask.mMask, t0);
+#else
+            __m512i t2 = _mm512_mask_mov_epi64(_mm512_castsi256_si512(mVec), mask.mMask, _mm512_castsi256_si512(t0));
+            __m256i t1 = _mm512_castsi512_si256(t2);
+#endif
+            mVec = t1;
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(uint64_t b) {
+            __m256i t0 = _mm256_set1_epi64x(b);
+            mVec = saturatedSub(mVec, t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<4> const & mask, uint64_t b) {
+            __m256i t0 = _mm256_set1_epi64x(b);
+            __m256i t1 = saturatedSub(mVec, t0);
+#if defined(__AVX512VL__)
+            __m256i t2 = _mm256_mask_mov_epi64(mVec, mask.mMask, t1);
+#else
+            __m512i t3 = _mm512_mask_mov_epi64(_mm512_castsi256_si512(mVec), mask.mMask, _mm512_castsi256_si512(t1));
+            __m256i t2 = _mm512_castsi512_si256(t3);
+#endif
+            mVec = t2;
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVec_u const & b) const {
             __m256i t0 = _mm256_sub_epi64(b.mVec, mVec);
@@ -85,6 +85,14 @@ namespace SIMD {
         UME_FORCE_INLINE explicit SIMDVec_u(__m512i & x) { mVec = x; }
         UME_FORCE_INLINE explicit SIMDVec_u(const __m512i & x) { mVec = x; }
 
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m512i saturatedAdd(__m512i const & a, __m512i const & b) {
+            return _mm512_add_epi64(a, _mm512_min_epu64(b, _mm512_xor_si512(a, _mm512_set1_epi64(-1))));
+        }
+        static UME_FORCE_INLINE __m512i saturatedSub(__m512i const & a, __m512i const & b) {
+            return _mm512_sub_epi64(_mm512_max_epu64(a, b), b);
+        }
+
     public:
         constexpr static uint32_t length() { return 8; }
         constexpr static uint32_t alignment() { return 64; }
@@ -200,6 +208,11 @@ namespace SIMD {
             mVec = _mm512_mask_load_epi64(mVec, mask.mMask, p);
             return *this;
         }
+        // LOADN
+        UME_FORCE_INLINE SIMDVec_u & loadn(uint32_t n, uint64_t const * p) {
+            mVec = _mm512_maskz_loadu_epi64(SIMDVecMask<8>::prefix(n).mMask, p);
+            return *this;
+        }
         // STORE
         UME_FORCE_INLINE uint64_t* store(uint64_t* p) const {
             _mm512_storeu_si512((__m512i *)p, mVec);
@@ -210,6 +223,11 @@ namespace SIMD {
             _mm512_mask_storeu_epi64(p, mask.mMask, mVec);
             return p;
         }
+        // STOREN
+        UME_FORCE_INLINE uint64_t* storen(uint32_t n, uint64_t * p) const {
+            _mm512_mask_storeu_epi64(p, SIMDVecMask<8>::prefix(n).mMask, mVec);
+            return p;
+        }
         // STOREA
         UME_FORCE_INLINE uint64_t* storea(uint64_t* p) const {
             _mm512_store_si512((__m512i *)p, mVec);
@@ -232,12 +250,31 @@ namespace SIMD {
             return SIMDVec_u(t0);
         }
         // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_u swizzle(SIMDSwizzle<8> const & sMask) const {
+            __m512i t0 = _mm512_cvtepu32_epi64(sMask.mVec);
+            __m512i t1 = _mm512_permutexvar_epi64(t0, mVec);
+            return SIMDVec_u(t1);
+        }
+        template<int i0, int i1, int i2, int i3, int i4, int i5, int i6, int i7>
+        UME_FORCE_INLINE SIMDVec_u swizzle() const {
+            const int imm = (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6);
+            // Patterns repeated in both 256-bit lanes need only an immediate permute.
+            if (i0 < 4 && i1 < 4 && i2 < 4 && i3 < 4 && i4 == i0 + 4 && i5 == i1 + 4 &&
+                i6 == i2 + 4 && i7 == i3 + 4) {
+                __m512i t0 = _mm512_permutex_epi64(mVec, imm);
+                return SIMDVec_u(t0);
+            }
+            __m512i t1 = _mm512_setr_epi64(i0, i1, i2, i3, i4, i5, i6, i7);
+            __m512i t2 = _mm512_permutexvar_epi64(t1, mVec);
+            return SIMDVec_u(t2);
+        }
         // SWIZZLEA
         UME_FORCE_INLINE SIMDVec_u & swizzlea(SIMDSwizzle<8> const & sMask) {
-            __m512i t0 = _mm512_cvtepi32_epi64(sMask.mVec);
-            mVec = _mm512_permutexvar_epi64(t0, mVec);
+            SIMDVec_u t0 = swizzle(sMask);
+            mVec = t0.mVec;
             return *this;
         }
+
         // ADDV
         UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
             __m512i t0 = _mm512_add_epi64(mVec, b.mVec);
@@ -291,13 +328,53 @@ namespace SIMD {
             return *this;
         }
         // SADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVec_u const & b) const {
+            __m512i t0 = saturatedAdd(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // MSADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m512i t0 = saturatedAdd(mVec, b.mVec);
+            __m512i t1 = _mm512_mask_mov_epi64(mVec, mask.mMask, t0);
+            return SIMDVec_u(t1);
+        }
         // SADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(uint64_t b) const {
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedAdd(mVec, t0);
+            return SIMDVec_u(t1);
+        }
         // MSADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<8> const & mask, uint64_t b) const {
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedAdd(mVec, t0);
+            __m512i t2 = _mm512_mask_mov_epi64(mVec, mask.mMask, t1);
+            return SIMDVec_u(t2);
+        }
         // SADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVec_u const & b) {
+            mVec = saturatedAdd(mVec, b.mVec);
+            return *this;
+        }
         // MSADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m512i t0 = saturatedAdd(mVec, b.mVec);
+            mVec = _mm512_mask_mov_epi64(mVec, mask.mMask, t0);
+            return *this;
+        }
         // SADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(uint64_t b) {
+            __m512i t0 = _mm512_set1_epi64(b);
+            mVec = saturatedAdd(mVec, t0);
+            return *this;
+        }
         // MSADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<8> const & mask, uint64_t b) {
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedAdd(mVec, t0);
+            mVec = _mm512_mask_mov_epi64(mVec, mask.mMask, t1);
+            return *this;
+        }
         // POSTINC
         UME_FORCE_INLINE SIMDVec_u postinc() {
             __m512i t0 = _mm512_set1_epi64(1);
@@ -381,13 +458,53 @@ namespace SIMD {
             return *this;
         }
         // SSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVec_u const & b) const {
+            __m512i t0 = saturatedSub(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
         // MSSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m512i t0 = saturatedSub(mVec, b.mVec);
+            __m512i t1 = _mm512_mask_mov_epi64(mVec, mask.mMask, t0);
+            return SIMDVec_u(t1);
+        }
         // SSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(uint64_t b) const {
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedSub(mVec, t0);
+            return SIMDVec_u(t1);
+        }
         // MSSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<8> const & mask, uint64_t b) const {
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedSub(mVec, t0);
+            __m512i t2 = _mm512_mask_mov_epi64(mVec, mask.mMask, t1);
+            return SIMDVec_u(t2);
+        }
         // SSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVec_u const & b) {
+            mVec = saturatedSub(mVec, b.mVec);
+            return *this;
+        }
         // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m512i t0 = saturatedSub(mVec, b.mVec);
+            mVec = _mm512_mask_mov_epi64(mVec, mask.mMask, t0);
+            return *this;
+        }
         // SSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(uint64_t b) {
+            __m512i t0 = _mm512_set1_epi64(b);
+            mVec = saturatedSub(mVec, t0);
+            return *this;
+        }
         // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<8> const & mask, uint64_t b) {
+            __m512i t0 = _mm512_set1_epi64(b);
+            __m512i t1 = saturatedSub(mVec, t0);
+            mVec = _mm512_mask_mov_epi64(mVec, mask.mMask, t1);
+            return *this;
+        }
         // SUBFROMV
         UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVec_u const & b) const {
             __m512i t0 = _mm512_sub_epi64(b.mVec, mVec);
@@ -1406,6 +1406,55 @@ namespace SIMD {
             }
             return *this;
         }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDDivisor<SCALAR_INT_TYPE> const & b) const {
+            SIMDVec_i retval;
+            SCALAR_INT_TYPE * local_retval_ptr = &retval.mVec[0];
+            SCALAR_INT_TYPE const * local_ptr = &mVec[0];
+            #pragma omp simd safelen(VEC_LEN)
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                local_retval_ptr[i] = b.divide(local_ptr[i]);
+            }
+            return retval;
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (SIMDDivisor<SCALAR_INT_TYPE> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<VEC_LEN> const & mask, SIMDDivisor<SCALAR_INT_TYPE> const & b) const {
+            SIMDVec_i retval;
+            SCALAR_INT_TYPE * local_retval_ptr = &retval.mVec[0];
+            SCALAR_INT_TYPE const * local_ptr = &mVec[0];
+            bool const * local_mask_ptr = &mask.mMask[0];
+            #pragma omp simd safelen(VEC_LEN)
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if(local_mask_ptr[i] == true) local_retval_ptr[i] = b.divide(local_ptr[i]);
+                else local_retval_ptr[i] = local_ptr[i];
+            }
+            return retval;
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDDivisor<SCALAR_INT_TYPE> const & b) {
+            SCALAR_INT_TYPE * local_ptr = &mVec[0];
+            #pragma omp simd safelen(VEC_LEN)
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                local_ptr[i] = b.divide(local_ptr[i]);
+            }
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDDivisor<SCALAR_INT_TYPE> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<VEC_LEN> const & mask, SIMDDivisor<SCALAR_INT_TYPE> const & b) {
+            SCALAR_INT_TYPE * local_ptr = &mVec[0];
+            bool const * local_mask_ptr = &mask.mMask[0];
+            #pragma omp simd safelen(VEC_LEN)
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if(local_mask_ptr[i] == true) local_ptr[i] = b.divide(local_ptr[i]);
+            }
+            return *this;
+        }
         // RCP
         UME_FORCE_INLINE SIMDVec_i rcp() const {
             SIMDVec_i retval;
@@ -2745,6 +2794,55 @@ namespace SIMD {
             }
             return *this;
         }
+        // REMD
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDDivisor<SCALAR_INT_TYPE> const & b) const {
+            SIMDVec_i retval;
+            SCALAR_INT_TYPE * local_retval_ptr = &retval.mVec[0];
+            SCALAR_INT_TYPE const * local_ptr = &mVec[0];
+            #pragma omp simd safelen(VEC_LEN)
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                local_retval_ptr[i] = b.remainder(local_ptr[i]);
+            }
+            return retval;
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (SIMDDivisor<SCALAR_INT_TYPE> const & b) const {
+            return rem(b);
+        }
+        // MREMD
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<VEC_LEN> const & mask, SIMDDivisor<SCALAR_INT_TYPE> const & b) const {
+            SIMDVec_i retval;
+            SCALAR_INT_TYPE * local_retval_ptr = &retval.mVec[0];
+            SCALAR_INT_TYPE const * local_ptr = &mVec[0];
+            bool const * local_mask_ptr = &mask.mMask[0];
+            #pragma omp simd safelen(VEC_LEN)
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if(local_mask_ptr[i] == true) local_retval_ptr[i] = b.remainder(local_ptr[i]);
+                else local_retval_ptr[i] = local_ptr[i];
+            }
+            return retval;
+        }
+        // REMDA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDDivisor<SCALAR_INT_TYPE> const & b) {
+            SCALAR_INT_TYPE * local_ptr = &mVec[0];
+            #pragma omp simd safelen(VEC_LEN)
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                local_ptr[i] = b.remainder(local_ptr[i]);
+            }
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (SIMDDivisor<SCALAR_INT_TYPE> const & b) {
+            return rema(b);
+        }
+        // MREMDA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<VEC_LEN> const & mask, SIMDDivisor<SCALAR_INT_TYPE> const & b) {
+            SCALAR_INT_TYPE * local_ptr = &mVec[0];
+            bool const * local_mask_ptr = &mask.mMask[0];
+            #pragma omp simd safelen(VEC_LEN)
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if(local_mask_ptr[i] == true) local_ptr[i] = b.remainder(local_ptr[i]);
+            }
+            return *this;
+        }
         // LANDV
         UME_FORCE_INLINE SIMDVecMask<VEC_LEN> land(SIMDVec_i const & b) const {
             SIMDVecMask<VEC_LEN> retval;
@@ -1340,6 +1340,55 @@ namespace SIMD {
             }
             return *this;
         }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDDivisor<SCALAR_UINT_TYPE> const & b) const {
+            SIMDVec_u retval;
+            SCALAR_UINT_TYPE * local_retval_ptr = &retval.mVec[0];
+            SCALAR_UINT_TYPE const * local_ptr = &mVec[0];
+            #pragma omp simd safelen(VEC_LEN)
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                local_retval_ptr[i] = b.divide(local_ptr[i]);
+            }
+            return retval;
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (SIMDDivisor<SCALAR_UINT_TYPE> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<VEC_LEN> const & mask, SIMDDivisor<SCALAR_UINT_TYPE> const & b) const {
+            SIMDVec_u retval;
+            SCALAR_UINT_TYPE * local_retval_ptr = &retval.mVec[0];
+            SCALAR_UINT_TYPE const * local_ptr = &mVec[0];
+            bool const * local_mask_ptr = &mask.mMask[0];
+            #pragma omp simd safelen(VEC_LEN)
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if(local_mask_ptr[i] == true) local_retval_ptr[i] = b.divide(local_ptr[i]);
+                else local_retval_ptr[i] = local_ptr[i];
+            }
+            return retval;
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDDivisor<SCALAR_UINT_TYPE> const & b) {
+            SCALAR_UINT_TYPE * local_ptr = &mVec[0];
+            #pragma omp simd safelen(VEC_LEN)
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                local_ptr[i] = b.divide(local_ptr[i]);
+            }
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDDivisor<SCALAR_UINT_TYPE> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<VEC_LEN> const & mask, SIMDDivisor<SCALAR_UINT_TYPE> const & b) {
+            SCALAR_UINT_TYPE * local_ptr = &mVec[0];
+            bool const * local_mask_ptr = &mask.mMask[0];
+            #pragma omp simd safelen(VEC_LEN)
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if(local_mask_ptr[i] == true) local_ptr[i] = b.divide(local_ptr[i]);
+            }
+            return *this;
+        }
         // RCP
         UME_FORCE_INLINE SIMDVec_u rcp() const {
             SIMDVec_u retval;
@@ -2679,6 +2728,55 @@ namespace SIMD {
             }
             return *this;
         }
+        // REMD
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDDivisor<SCALAR_UINT_TYPE> const & b) const {
+            SIMDVec_u retval;
+            SCALAR_UINT_TYPE * local_retval_ptr = &retval.mVec[0];
+            SCALAR_UINT_TYPE const * local_ptr = &mVec[0];
+            #pragma omp simd safelen(VEC_LEN)
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                local_retval_ptr[i] = b.remainder(local_ptr[i]);
+            }
+            return retval;
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (SIMDDivisor<SCALAR_UINT_TYPE> const & b) const {
+            return rem(b);
+        }
+        // MREMD
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<VEC_LEN> const & mask, SIMDDivisor<SCALAR_UINT_TYPE> const & b) const {
+            SIMDVec_u retval;
+            SCALAR_UINT_TYPE * local_retval_ptr = &retval.mVec[0];
+            SCALAR_UINT_TYPE const * local_ptr = &mVec[0];
+            bool const * local_mask_ptr = &mask.mMask[0];
+            #pragma omp simd safelen(VEC_LEN)
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if(local_mask_ptr[i] == true) local_retval_ptr[i] = b.remainder(local_ptr[i]);
+                else local_retval_ptr[i] = local_ptr[i];
+            }
+            return retval;
+        }
+        // REMDA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDDivisor<SCALAR_UINT_TYPE> const & b) {
+            SCALAR_UINT_TYPE * local_ptr = &mVec[0];
+            #pragma omp simd safelen(VEC_LEN)
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                local_ptr[i] = b.remainder(local_ptr[i]);
+            }
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (SIMDDivisor<SCALAR_UINT_TYPE> const & b) {
+            return rema(b);
+        }
+        // MREMDA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<VEC_LEN> const & mask, SIMDDivisor<SCALAR_UINT_TYPE> const & b) {
+            SCALAR_UINT_TYPE * local_ptr = &mVec[0];
+            bool const * local_mask_ptr = &mask.mMask[0];
+            #pragma omp simd safelen(VEC_LEN)
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if(local_mask_ptr[i] == true) local_ptr[i] = b.remainder(local_ptr[i]);
+            }
+            return *this;
+        }
         // LANDV
         UME_FORCE_INLINE SIMDVecMask<VEC_LEN> land(SIMDVec_u const & b) const {
             SIMDVecMask<VEC_LEN> retval;
@@ -980,6 +980,44 @@ namespace SIMD {
             mVec[3] = mask.mMask[3] ? mVec[3] / b : mVec[3];
             return *this;
         }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDDivisor<int32_t> const & b) const {
+            int32_t t0 = b.divide(mVec[0]);
+            int32_t t1 = b.divide(mVec[1]);
+            int32_t t2 = b.divide(mVec[2]);
+            int32_t t3 = b.divide(mVec[3]);
+            return SIMDVec_i(t0, t1, t2, t3);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (SIMDDivisor<int32_t> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<4> const & mask, SIMDDivisor<int32_t> const & b) const {
+            int32_t t0 = mask.mMask[0] ? b.divide(mVec[0]) : mVec[0];
+            int32_t t1 = mask.mMask[1] ? b.divide(mVec[1]) : mVec[1];
+            int32_t t2 = mask.mMask[2] ? b.divide(mVec[2]) : mVec[2];
+            int32_t t3 = mask.mMask[3] ? b.divide(mVec[3]) : mVec[3];
+            return SIMDVec_i(t0, t1, t2, t3);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDDivisor<int32_t> const & b) {
+            mVec[0] = b.divide(mVec[0]);
+            mVec[1] = b.divide(mVec[1]);
+            mVec[2] = b.divide(mVec[2]);
+            mVec[3] = b.divide(mVec[3]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDDivisor<int32_t> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<4> const & mask, SIMDDivisor<int32_t> const & b) {
+            mVec[0] = mask.mMask[0] ? b.divide(mVec[0]) : mVec[0];
+            mVec[1] = mask.mMask[1] ? b.divide(mVec[1]) : mVec[1];
+            mVec[2] = mask.mMask[2] ? b.divide(mVec[2]) : mVec[2];
+            mVec[3] = mask.mMask[3] ? b.divide(mVec[3]) : mVec[3];
+            return *this;
+        }
         // RCP
         // MRCP
         // RCPS
@@ -1317,6 +1317,60 @@ namespace SIMD {
             mVec[7] = mask.mMask[7] ? mVec[7] / b : mVec[7];
             return *this;
         }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDDivisor<int32_t> const & b) const {
+            int32_t t0 = b.divide(mVec[0]);
+            int32_t t1 = b.divide(mVec[1]);
+            int32_t t2 = b.divide(mVec[2]);
+            int32_t t3 = b.divide(mVec[3]);
+            int32_t t4 = b.divide(mVec[4]);
+            int32_t t5 = b.divide(mVec[5]);
+            int32_t t6 = b.divide(mVec[6]);
+            int32_t t7 = b.divide(mVec[7]);
+            return SIMDVec_i(t0, t1, t2, t3, t4, t5, t6, t7);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (SIMDDivisor<int32_t> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<8> const & mask, SIMDDivisor<int32_t> const & b) const {
+            int32_t t0 = mask.mMask[0] ? b.divide(mVec[0]) : mVec[0];
+            int32_t t1 = mask.mMask[1] ? b.divide(mVec[1]) : mVec[1];
+            int32_t t2 = mask.mMask[2] ? b.divide(mVec[2]) : mVec[2];
+            int32_t t3 = mask.mMask[3] ? b.divide(mVec[3]) : mVec[3];
+            int32_t t4 = mask.mMask[4] ? b.divide(mVec[4]) : mVec[4];
+            int32_t t5 = mask.mMask[5] ? b.divide(mVec[5]) : mVec[5];
+            int32_t t6 = mask.mMask[6] ? b.divide(mVec[6]) : mVec[6];
+            int32_t t7 = mask.mMask[7] ? b.divide(mVec[7]) : mVec[7];
+            return SIMDVec_i(t0, t1, t2, t3, t4, t5, t6, t7);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDDivisor<int32_t> const & b) {
+            mVec[0] = b.divide(mVec[0]);
+            mVec[1] = b.divide(mVec[1]);
+            mVec[2] = b.divide(mVec[2]);
+            mVec[3] = b.divide(mVec[3]);
+            mVec[4] = b.divide(mVec[4]);
+            mVec[5] = b.divide(mVec[5]);
+            mVec[6] = b.divide(mVec[6]);
+            mVec[7] = b.divide(mVec[7]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDDivisor<int32_t> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<8> const & mask, SIMDDivisor<int32_t> const & b) {
+            mVec[0] = mask.mMask[0] ? b.divide(mVec[0]) : mVec[0];
+            mVec[1] = mask.mMask[1] ? b.divide(mVec[1]) : mVec[1];
+            mVec[2] = mask.mMask[2] ? b.divide(mVec[2]) : mVec[2];
+            mVec[3] = mask.mMask[3] ? b.divide(mVec[3]) : mVec[3];
+            mVec[4] = mask.mMask[4] ? b.divide(mVec[4]) : mVec[4];
+            mVec[5] = mask.mMask[5] ? b.divide(mVec[5]) : mVec[5];
+            mVec[6] = mask.mMask[6] ? b.divide(mVec[6]) : mVec[6];
+            mVec[7] = mask.mMask[7] ? b.divide(mVec[7]) : mVec[7];
+            return *this;
+        }
         // RCP
         // MRCP
         // RCPS
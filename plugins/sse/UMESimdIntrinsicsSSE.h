@@ -0,0 +1,617 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_INTRINSICS_SSE_H_
+#define UME_SIMD_INTRINSICS_SSE_H_
+
+#include "../../UMEInline.h"
+#include <immintrin.h>
+#include <cstdint>
+
+// SSE2 is the only instruction set extension guaranteed on x86-64. The plugin
+// uses SSSE3, SSE4.1 and SSE4.2 instructions when the compiler is allowed to
+// emit them, and the SSE2 sequences below otherwise.
+//
+// The masks of this plugin always have all bits of a lane set or cleared, so
+// the AND/ANDNOT blends are equivalent to BLENDV.
+namespace UME
+{
+namespace SIMD
+{
+    // BLENDV
+    UME_FORCE_INLINE __m128 blendv_ps_sse(__m128 a, __m128 b, __m128 mask) {
+#if defined(__SSE4_1__)
+        return _mm_blendv_ps(a, b, mask);
+#else
+        return _mm_or_ps(_mm_andnot_ps(mask, a), _mm_and_ps(mask, b));
+#endif
+    }
+    UME_FORCE_INLINE __m128d blendv_pd_sse(__m128d a, __m128d b, __m128d mask) {
+#if defined(__SSE4_1__)
+        return _mm_blendv_pd(a, b, mask);
+#else
+        return _mm_or_pd(_mm_andnot_pd(mask, a), _mm_and_pd(mask, b));
+#endif
+    }
+    UME_FORCE_INLINE __m128i blendv_epi8_sse(__m128i a, __m128i b, __m128i mask) {
+#if defined(__SSE4_1__)
+        return _mm_blendv_epi8(a, b, mask);
+#else
+        return _mm_or_si128(_mm_andnot_si128(mask, a), _mm_and_si128(mask, b));
+#endif
+    }
+
+    // BLENDV variant for masks in which only the sign bit of each byte is
+    // meaningful.
+    UME_FORCE_INLINE __m128i blendv_msb_epi8_sse(__m128i a, __m128i b, __m128i mask) {
+#if defined(__SSE4_1__)
+        return _mm_blendv_epi8(a, b, mask);
+#else
+        return blendv_epi8_sse(a, b, _mm_cmplt_epi8(mask, _mm_setzero_si128()));
+#endif
+    }
+
+    // MULLO
+    UME_FORCE_INLINE __m128i mullo_epi32_sse(__m128i a, __m128i b) {
+#if defined(__SSE4_1__)
+        return _mm_mullo_epi32(a, b);
+#else
+        // Multiply even and odd lanes separately and interleave the low halves.
+        __m128i t0 = _mm_mul_epu32(a, b);
+        __m128i t1 = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+        __m128i t2 = _mm_shuffle_epi32(t0, 0x08);
+        __m128i t3 = _mm_shuffle_epi32(t1, 0x08);
+        return _mm_unpacklo_epi32(t2, t3);
+#endif
+    }
+    UME_FORCE_INLINE __m128i mullo_epi64_sse(__m128i a, __m128i b) {
+        // lo(a)*lo(b) + ((hi(a)*lo(b) + lo(a)*hi(b)) << 32)
+        __m128i t0 = _mm_mul_epu32(a, b);
+        __m128i t1 = _mm_mul_epu32(_mm_srli_epi64(a, 32), b);
+        __m128i t2 = _mm_mul_epu32(a, _mm_srli_epi64(b, 32));
+        __m128i t3 = _mm_slli_epi64(_mm_add_epi64(t1, t2), 32);
+        return _mm_add_epi64(t0, t3);
+    }
+
+    // MIN/MAX
+    UME_FORCE_INLINE __m128i min_epi8_sse(__m128i a, __m128i b) {
+#if defined(__SSE4_1__)
+        return _mm_min_epi8(a, b);
+#else
+        return blendv_epi8_sse(a, b, _mm_cmpgt_epi8(a, b));
+#endif
+    }
+    UME_FORCE_INLINE __m128i max_epi8_sse(__m128i a, __m128i b) {
+#if defined(__SSE4_1__)
+        return _mm_max_epi8(a, b);
+#else
+        return blendv_epi8_sse(b, a, _mm_cmpgt_epi8(a, b));
+#endif
+    }
+    UME_FORCE_INLINE __m128i min_epu16_sse(__m128i a, __m128i b) {
+#if defined(__SSE4_1__)
+        return _mm_min_epu16(a, b);
+#else
+        // a - sat(a - b) is min(a, b) for unsigned lanes.
+        return _mm_sub_epi16(a, _mm_subs_epu16(a, b));
+#endif
+    }
+    UME_FORCE_INLINE __m128i max_epu16_sse(__m128i a, __m128i b) {
+#if defined(__SSE4_1__)
+        return _mm_max_epu16(a, b);
+#else
+        return _mm_add_epi16(b, _mm_subs_epu16(a, b));
+#endif
+    }
+    UME_FORCE_INLINE __m128i min_epi32_sse(__m128i a, __m128i b) {
+#if defined(__SSE4_1__)
+        return _mm_min_epi32(a, b);
+#else
+        return blendv_epi8_sse(a, b, _mm_cmpgt_epi32(a, b));
+#endif
+    }
+    UME_FORCE_INLINE __m128i max_epi32_sse(__m128i a, __m128i b) {
+#if defined(__SSE4_1__)
+        return _mm_max_epi32(a, b);
+#else
+        return blendv_epi8_sse(b, a, _mm_cmpgt_epi32(a, b));
+#endif
+    }
+    // Unsigned compares are done on signed lanes with flipped sign bits.
+    UME_FORCE_INLINE __m128i cmpgt_epu8_sse(__m128i a, __m128i b) {
+        __m128i t0 = _mm_set1_epi8((char)0x80);
+        return _mm_cmpgt_epi8(_mm_xor_si128(a, t0), _mm_xor_si128(b, t0));
+    }
+    UME_FORCE_INLINE __m128i cmpgt_epu16_sse(__m128i a, __m128i b) {
+        __m128i t0 = _mm_set1_epi16((short)0x8000);
+        return _mm_cmpgt_epi16(_mm_xor_si128(a, t0), _mm_xor_si128(b, t0));
+    }
+    UME_FORCE_INLINE __m128i cmpgt_epu32_sse(__m128i a, __m128i b) {
+        __m128i t0 = _mm_set1_epi32(0x80000000);
+        return _mm_cmpgt_epi32(_mm_xor_si128(a, t0), _mm_xor_si128(b, t0));
+    }
+    UME_FORCE_INLINE __m128i min_epu32_sse(__m128i a, __m128i b) {
+#if defined(__SSE4_1__)
+        return _mm_min_epu32(a, b);
+#else
+        return blendv_epi8_sse(a, b, cmpgt_epu32_sse(a, b));
+#endif
+    }
+    UME_FORCE_INLINE __m128i max_epu32_sse(__m128i a, __m128i b) {
+#if defined(__SSE4_1__)
+        return _mm_max_epu32(a, b);
+#else
+        return blendv_epi8_sse(b, a, cmpgt_epu32_sse(a, b));
+#endif
+    }
+
+    // 64-bit compares
+    UME_FORCE_INLINE __m128i cmpeq_epi64_sse(__m128i a, __m128i b) {
+#if defined(__SSE4_1__)
+        return _mm_cmpeq_epi64(a, b);
+#else
+        __m128i t0 = _mm_cmpeq_epi32(a, b);
+        return _mm_and_si128(t0, _mm_shuffle_epi32(t0, 0xB1));
+#endif
+    }
+    UME_FORCE_INLINE __m128i cmpgt_epi64_sse(__m128i a, __m128i b) {
+#if defined(__SSE4_2__)
+        return _mm_cmpgt_epi64(a, b);
+#else
+        // Signed compare of the high halves, unsigned compare of the low halves.
+        __m128i t0 = _mm_cmpgt_epi32(a, b);
+        __m128i t1 = _mm_cmpeq_epi32(a, b);
+        __m128i t2 = cmpgt_epu32_sse(a, b);
+        __m128i t3 = _mm_and_si128(t1, _mm_shuffle_epi32(t2, 0xA0));
+        __m128i t4 = _mm_or_si128(t0, t3);
+        return _mm_shuffle_epi32(t4, 0xF5);
+#endif
+    }
+    UME_FORCE_INLINE __m128i cmpgt_epu64_sse(__m128i a, __m128i b) {
+        __m128i t0 = _mm_set1_epi64x(0x8000000000000000LL);
+        return cmpgt_epi64_sse(_mm_xor_si128(a, t0), _mm_xor_si128(b, t0));
+    }
+
+    // ABS
+    UME_FORCE_INLINE __m128i abs_epi8_sse(__m128i a) {
+#if defined(__SSSE3__)
+        return _mm_abs_epi8(a);
+#else
+        return _mm_min_epu8(a, _mm_sub_epi8(_mm_setzero_si128(), a));
+#endif
+    }
+    UME_FORCE_INLINE __m128i abs_epi16_sse(__m128i a) {
+#if defined(__SSSE3__)
+        return _mm_abs_epi16(a);
+#else
+        return _mm_max_epi16(a, _mm_sub_epi16(_mm_setzero_si128(), a));
+#endif
+    }
+    UME_FORCE_INLINE __m128i abs_epi32_sse(__m128i a) {
+#if defined(__SSSE3__)
+        return _mm_abs_epi32(a);
+#else
+        __m128i t0 = _mm_srai_epi32(a, 31);
+        return _mm_sub_epi32(_mm_xor_si128(a, t0), t0);
+#endif
+    }
+    UME_FORCE_INLINE __m128i abs_epi64_sse(__m128i a) {
+        __m128i t0 = _mm_shuffle_epi32(_mm_srai_epi32(a, 31), 0xF5);
+        return _mm_sub_epi64(_mm_xor_si128(a, t0), t0);
+    }
+
+    // PACKUS
+    UME_FORCE_INLINE __m128i packus_epi32_sse(__m128i a, __m128i b) {
+#if defined(__SSE4_1__)
+        return _mm_packus_epi32(a, b);
+#else
+        // Clamp to [0, 65535], bias into the signed range and pack with signed saturation.
+        __m128i t0 = _mm_and_si128(a, _mm_cmpgt_epi32(a, _mm_setzero_si128()));
+        __m128i t1 = _mm_and_si128(b, _mm_cmpgt_epi32(b, _mm_setzero_si128()));
+        __m128i t2 = _mm_set1_epi32(0xFFFF);
+        t0 = blendv_epi8_sse(t0, t2, _mm_cmpgt_epi32(t0, t2));
+        t1 = blendv_epi8_sse(t1, t2, _mm_cmpgt_epi32(t1, t2));
+        __m128i t3 = _mm_set1_epi32(0x8000);
+        __m128i t4 = _mm_packs_epi32(_mm_sub_epi32(t0, t3), _mm_sub_epi32(t1, t3));
+        return _mm_xor_si128(t4, _mm_set1_epi16((short)0x8000));
+#endif
+    }
+
+    // BLEND with an immediate lane selector
+    template<int IMM>
+    UME_FORCE_INLINE __m128 blend_ps_sse(__m128 a, __m128 b) {
+#if defined(__SSE4_1__)
+        return _mm_blend_ps(a, b, IMM);
+#else
+        __m128i t0 = _mm_setr_epi32(-(IMM & 1), -((IMM >> 1) & 1), -((IMM >> 2) & 1), -((IMM >> 3) & 1));
+        return blendv_ps_sse(a, b, _mm_castsi128_ps(t0));
+#endif
+    }
+    template<int IMM>
+    UME_FORCE_INLINE __m128d blend_pd_sse(__m128d a, __m128d b) {
+#if defined(__SSE4_1__)
+        return _mm_blend_pd(a, b, IMM);
+#else
+        __m128i t0 = _mm_setr_epi32(-(IMM & 1), -(IMM & 1), -((IMM >> 1) & 1), -((IMM >> 1) & 1));
+        return blendv_pd_sse(a, b, _mm_castsi128_pd(t0));
+#endif
+    }
+    template<int IMM>
+    UME_FORCE_INLINE __m128i blend_epi32_sse(__m128i a, __m128i b) {
+        return _mm_castps_si128(blend_ps_sse<IMM>(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+    }
+
+    // PERMUTE
+    template<int IMM>
+    UME_FORCE_INLINE __m128 permute_ps_sse(__m128 a) {
+        return _mm_shuffle_ps(a, a, IMM);
+    }
+    template<int IMM>
+    UME_FORCE_INLINE __m128d permute_pd_sse(__m128d a) {
+        return _mm_shuffle_pd(a, a, IMM);
+    }
+    UME_FORCE_INLINE __m128 permutevar_ps_sse(__m128 a, __m128i idx) {
+        alignas(16) float raw[4];
+        alignas(16) uint32_t rawIdx[4];
+        alignas(16) float res[4];
+        _mm_store_ps(raw, a);
+        _mm_store_si128((__m128i*)rawIdx, idx);
+        for (int i = 0; i < 4; i++) res[i] = raw[rawIdx[i] & 3];
+        return _mm_load_ps(res);
+    }
+    UME_FORCE_INLINE __m128 movehdup_ps_sse(__m128 a) {
+#if defined(__SSE3__)
+        return _mm_movehdup_ps(a);
+#else
+        return _mm_shuffle_ps(a, a, 0xF5);
+#endif
+    }
+
+    // HADD
+    UME_FORCE_INLINE __m128 hadd_ps_sse(__m128 a, __m128 b) {
+#if defined(__SSE3__)
+        return _mm_hadd_ps(a, b);
+#else
+        __m128 t0 = _mm_shuffle_ps(a, b, 0x88);
+        __m128 t1 = _mm_shuffle_ps(a, b, 0xDD);
+        return _mm_add_ps(t0, t1);
+#endif
+    }
+    UME_FORCE_INLINE __m128i hadd_epi32_sse(__m128i a, __m128i b) {
+#if defined(__SSSE3__)
+        return _mm_hadd_epi32(a, b);
+#else
+        __m128 t0 = _mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), 0x88);
+        __m128 t1 = _mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), 0xDD);
+        return _mm_add_epi32(_mm_castps_si128(t0), _mm_castps_si128(t1));
+#endif
+    }
+
+    // MUL
+    UME_FORCE_INLINE __m128i mul_epi32_sse(__m128i a, __m128i b) {
+#if defined(__SSE4_1__)
+        return _mm_mul_epi32(a, b);
+#else
+        // Signed product from the unsigned one: subtract b (a) from the high
+        // half for each negative a (b).
+        __m128i t0 = _mm_mul_epu32(a, b);
+        __m128i t1 = _mm_and_si128(_mm_srai_epi32(a, 31), b);
+        __m128i t2 = _mm_and_si128(_mm_srai_epi32(b, 31), a);
+        __m128i t3 = _mm_slli_epi64(_mm_add_epi32(t1, t2), 32);
+        return _mm_sub_epi64(t0, t3);
+#endif
+    }
+
+    // EXTRACT/INSERT
+    template<int I>
+    UME_FORCE_INLINE int32_t extract_epi32_sse(__m128i a) {
+        return _mm_cvtsi128_si32(_mm_shuffle_epi32(a, I & 3));
+    }
+    template<int I>
+    UME_FORCE_INLINE int64_t extract_epi64_sse(__m128i a) {
+        int64_t t0;
+        _mm_storel_epi64((__m128i*)&t0, I & 1 ? _mm_unpackhi_epi64(a, a) : a);
+        return t0;
+    }
+    template<int I>
+    UME_FORCE_INLINE int8_t extract_epi8_sse(__m128i a) {
+        return int8_t(_mm_extract_epi16(a, (I & 15) >> 1) >> ((I & 1) * 8));
+    }
+
+    // SIGN EXTENSION
+    UME_FORCE_INLINE __m128i cvtepi32_epi64_sse(__m128i a) {
+#if defined(__SSE4_1__)
+        return _mm_cvtepi32_epi64(a);
+#else
+        return _mm_unpacklo_epi32(a, _mm_srai_epi32(a, 31));
+#endif
+    }
+    UME_FORCE_INLINE __m128i cvtepu32_epi64_sse(__m128i a) {
+#if defined(__SSE4_1__)
+        return _mm_cvtepu32_epi64(a);
+#else
+        return _mm_unpacklo_epi32(a, _mm_setzero_si128());
+#endif
+    }
+
+    // TEST
+    UME_FORCE_INLINE int testz_si128_sse(__m128i a, __m128i b) {
+#if defined(__SSE4_1__)
+        return _mm_testz_si128(a, b);
+#else
+        __m128i t0 = _mm_cmpeq_epi8(_mm_and_si128(a, b), _mm_setzero_si128());
+        return _mm_movemask_epi8(t0) == 0xFFFF;
+#endif
+    }
+
+    // VARIABLE SHIFTS
+    // Each lane is shifted by its own count by shifting the whole register
+    // once per lane and merging the matching lanes.
+    UME_FORCE_INLINE __m128i mergeDiagonal_epi32_sse(__m128i s0, __m128i s1, __m128i s2, __m128i s3) {
+        __m128i t0 = _mm_unpacklo_epi32(s0, s1);
+        __m128i t1 = _mm_unpackhi_epi32(s2, s3);
+        return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(t0), _mm_castsi128_ps(t1), 0xCC));
+    }
+    UME_FORCE_INLINE __m128i sllv_epi32_sse(__m128i a, __m128i count) {
+        __m128i t0 = _mm_srli_epi64(_mm_slli_epi64(count, 32), 32);
+        __m128i t1 = _mm_srli_epi64(count, 32);
+        __m128i t2 = _mm_unpackhi_epi64(t0, t0);
+        __m128i t3 = _mm_unpackhi_epi64(t1, t1);
+        return mergeDiagonal_epi32_sse(_mm_sll_epi32(a, t0), _mm_sll_epi32(a, t1),
+                                       _mm_sll_epi32(a, t2), _mm_sll_epi32(a, t3));
+    }
+    UME_FORCE_INLINE __m128i srlv_epi32_sse(__m128i a, __m128i count) {
+        __m128i t0 = _mm_srli_epi64(_mm_slli_epi64(count, 32), 32);
+        __m128i t1 = _mm_srli_epi64(count, 32);
+        __m128i t2 = _mm_unpackhi_epi64(t0, t0);
+        __m128i t3 = _mm_unpackhi_epi64(t1, t1);
+        return mergeDiagonal_epi32_sse(_mm_srl_epi32(a, t0), _mm_srl_epi32(a, t1),
+                                       _mm_srl_epi32(a, t2), _mm_srl_epi32(a, t3));
+    }
+    UME_FORCE_INLINE __m128i srav_epi32_sse(__m128i a, __m128i count) {
+        __m128i t0 = _mm_srli_epi64(_mm_slli_epi64(count, 32), 32);
+        __m128i t1 = _mm_srli_epi64(count, 32);
+        __m128i t2 = _mm_unpackhi_epi64(t0, t0);
+        __m128i t3 = _mm_unpackhi_epi64(t1, t1);
+        return mergeDiagonal_epi32_sse(_mm_sra_epi32(a, t0), _mm_sra_epi32(a, t1),
+                                       _mm_sra_epi32(a, t2), _mm_sra_epi32(a, t3));
+    }
+    // 16-bit lanes are shifted by each bit of the count in turn. The counts
+    // are clamped first, so that large counts clear (or sign-fill) the lane.
+    UME_FORCE_INLINE __m128i bitMask_epi16_sse(__m128i count, int bit) {
+        return _mm_srai_epi16(_mm_sll_epi16(count, _mm_cvtsi32_si128(15 - bit)), 15);
+    }
+    UME_FORCE_INLINE __m128i sllv_epi16_sse(__m128i a, __m128i count) {
+        __m128i t0 = min_epu16_sse(count, _mm_set1_epi16(16));
+        __m128i t1 = blendv_epi8_sse(a, _mm_slli_epi16(a, 1), bitMask_epi16_sse(t0, 0));
+        t1 = blendv_epi8_sse(t1, _mm_slli_epi16(t1, 2), bitMask_epi16_sse(t0, 1));
+        t1 = blendv_epi8_sse(t1, _mm_slli_epi16(t1, 4), bitMask_epi16_sse(t0, 2));
+        t1 = blendv_epi8_sse(t1, _mm_slli_epi16(t1, 8), bitMask_epi16_sse(t0, 3));
+        return _mm_andnot_si128(bitMask_epi16_sse(t0, 4), t1);
+    }
+    UME_FORCE_INLINE __m128i srlv_epi16_sse(__m128i a, __m128i count) {
+        __m128i t0 = min_epu16_sse(count, _mm_set1_epi16(16));
+        __m128i t1 = blendv_epi8_sse(a, _mm_srli_epi16(a, 1), bitMask_epi16_sse(t0, 0));
+        t1 = blendv_epi8_sse(t1, _mm_srli_epi16(t1, 2), bitMask_epi16_sse(t0, 1));
+        t1 = blendv_epi8_sse(t1, _mm_srli_epi16(t1, 4), bitMask_epi16_sse(t0, 2));
+        t1 = blendv_epi8_sse(t1, _mm_srli_epi16(t1, 8), bitMask_epi16_sse(t0, 3));
+        return _mm_andnot_si128(bitMask_epi16_sse(t0, 4), t1);
+    }
+    UME_FORCE_INLINE __m128i srav_epi16_sse(__m128i a, __m128i count) {
+        __m128i t0 = min_epu16_sse(count, _mm_set1_epi16(15));
+        __m128i t1 = blendv_epi8_sse(a, _mm_srai_epi16(a, 1), bitMask_epi16_sse(t0, 0));
+        t1 = blendv_epi8_sse(t1, _mm_srai_epi16(t1, 2), bitMask_epi16_sse(t0, 1));
+        t1 = blendv_epi8_sse(t1, _mm_srai_epi16(t1, 4), bitMask_epi16_sse(t0, 2));
+        return blendv_epi8_sse(t1, _mm_srai_epi16(t1, 8), bitMask_epi16_sse(t0, 3));
+    }
+    UME_FORCE_INLINE __m128i sllv_epi64_sse(__m128i a, __m128i count) {
+        __m128i t0 = _mm_sll_epi64(a, count);
+        __m128i t1 = _mm_sll_epi64(a, _mm_unpackhi_epi64(count, count));
+        return _mm_castpd_si128(_mm_move_sd(_mm_castsi128_pd(t1), _mm_castsi128_pd(t0)));
+    }
+    UME_FORCE_INLINE __m128i srlv_epi64_sse(__m128i a, __m128i count) {
+        __m128i t0 = _mm_srl_epi64(a, count);
+        __m128i t1 = _mm_srl_epi64(a, _mm_unpackhi_epi64(count, count));
+        return _mm_castpd_si128(_mm_move_sd(_mm_castsi128_pd(t1), _mm_castsi128_pd(t0)));
+    }
+
+    // NON-TEMPORAL LOADS
+    // MOVNTDQA is an SSE4.1 instruction; older targets fall back to an
+    // ordinary aligned load.
+    UME_FORCE_INLINE __m128i stream_load_si128_sse(__m128i * p) {
+#if defined(__SSE4_1__)
+        return _mm_stream_load_si128(p);
+#else
+        return _mm_load_si128(p);
+#endif
+    }
+
+    // MASKED MEMORY ACCESS
+    // There are no masked loads and stores before AVX. Only the selected lanes
+    // are touched, so that these are safe at the end of an array.
+    UME_FORCE_INLINE void maskstore_ps_sse(float * p, __m128i mask, __m128 a) {
+        alignas(16) float raw[4];
+        _mm_store_ps(raw, a);
+        int t0 = _mm_movemask_ps(_mm_castsi128_ps(mask));
+        for (int i = 0; i < 4; i++) if (t0 & (1 << i)) p[i] = raw[i];
+    }
+    UME_FORCE_INLINE void maskstore_pd_sse(double * p, __m128i mask, __m128d a) {
+        int t0 = _mm_movemask_pd(_mm_castsi128_pd(mask));
+        if (t0 & 1) _mm_storel_pd(p, a);
+        if (t0 & 2) _mm_storeh_pd(p + 1, a);
+    }
+    UME_FORCE_INLINE void maskstore_epi32_sse(int * p, __m128i mask, __m128i a) {
+        maskstore_ps_sse((float *)p, mask, _mm_castsi128_ps(a));
+    }
+    UME_FORCE_INLINE void maskstore_epi64_sse(long long * p, __m128i mask, __m128i a) {
+        maskstore_pd_sse((double *)p, mask, _mm_castsi128_pd(a));
+    }
+    UME_FORCE_INLINE __m128d maskload_pd_sse(double const * p, __m128i mask) {
+        int t0 = _mm_movemask_pd(_mm_castsi128_pd(mask));
+        __m128d t1 = _mm_setzero_pd();
+        if (t0 & 1) t1 = _mm_loadl_pd(t1, p);
+        if (t0 & 2) t1 = _mm_loadh_pd(t1, p + 1);
+        return t1;
+    }
+    UME_FORCE_INLINE __m128i maskload_epi64_sse(long long const * p, __m128i mask) {
+        return _mm_castpd_si128(maskload_pd_sse((double const *)p, mask));
+    }
+
+    // GATHER
+    UME_FORCE_INLINE __m128 i32gather_ps_sse(float const * p, __m128i idx) {
+        alignas(16) int32_t rawIdx[4];
+        _mm_store_si128((__m128i*)rawIdx, idx);
+        return _mm_setr_ps(p[rawIdx[0]], p[rawIdx[1]], p[rawIdx[2]], p[rawIdx[3]]);
+    }
+    UME_FORCE_INLINE __m128i i32gather_epi32_sse(int const * p, __m128i idx) {
+        alignas(16) int32_t rawIdx[4];
+        _mm_store_si128((__m128i*)rawIdx, idx);
+        return _mm_setr_epi32(p[rawIdx[0]], p[rawIdx[1]], p[rawIdx[2]], p[rawIdx[3]]);
+    }
+    UME_FORCE_INLINE __m128i i64gather_epi64_sse(long long const * p, __m128i idx) {
+        alignas(16) int64_t rawIdx[2];
+        _mm_store_si128((__m128i*)rawIdx, idx);
+        return _mm_set_epi64x(p[rawIdx[1]], p[rawIdx[0]]);
+    }
+    // Only the lanes selected by 'mask' are read from memory.
+    UME_FORCE_INLINE __m128i mask_i64gather_epi64_sse(__m128i src, long long const * p, __m128i idx, __m128i mask) {
+        alignas(16) int64_t raw[2];
+        alignas(16) int64_t rawIdx[2];
+        int t0 = _mm_movemask_pd(_mm_castsi128_pd(mask));
+        _mm_store_si128((__m128i*)raw, src);
+        _mm_store_si128((__m128i*)rawIdx, idx);
+        if (t0 & 1) raw[0] = p[rawIdx[0]];
+        if (t0 & 2) raw[1] = p[rawIdx[1]];
+        return _mm_load_si128((__m128i*)raw);
+    }
+    UME_FORCE_INLINE __m128d i64gather_pd_sse(double const * p, __m128i idx) {
+        alignas(16) int64_t rawIdx[2];
+        _mm_store_si128((__m128i*)rawIdx, idx);
+        return _mm_setr_pd(p[rawIdx[0]], p[rawIdx[1]]);
+    }
+
+    // ROUNDING
+    // Without SSE4.1 the rounding goes through a conversion to integer. Lanes
+    // of magnitude 2^23 (2^52 for doubles) and above, infinities and NaNs are
+    // already integral and are passed through unchanged.
+    UME_FORCE_INLINE __m128 trunc_ps_sse(__m128 a) {
+#if defined(__SSE4_1__)
+        return _mm_round_ps(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+#else
+        __m128 t0 = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
+        __m128 t1 = _mm_andnot_ps(t0, a);
+        __m128 t2 = _mm_cvtepi32_ps(_mm_cvttps_epi32(a));
+        __m128 t3 = _mm_or_ps(t2, _mm_and_ps(t0, a));
+        __m128 t4 = _mm_cmpnlt_ps(t1, _mm_set1_ps(8388608.0f));
+        return blendv_ps_sse(t3, a, t4);
+#endif
+    }
+    UME_FORCE_INLINE __m128 floor_ps_sse(__m128 a) {
+#if defined(__SSE4_1__)
+        return _mm_floor_ps(a);
+#else
+        __m128 t0 = trunc_ps_sse(a);
+        __m128 t1 = _mm_and_ps(_mm_cmpgt_ps(t0, a), _mm_set1_ps(1.0f));
+        return _mm_sub_ps(t0, t1);
+#endif
+    }
+    UME_FORCE_INLINE __m128 ceil_ps_sse(__m128 a) {
+#if defined(__SSE4_1__)
+        return _mm_ceil_ps(a);
+#else
+        __m128 t0 = trunc_ps_sse(a);
+        __m128 t1 = _mm_and_ps(_mm_cmplt_ps(t0, a), _mm_set1_ps(1.0f));
+        // Keep the sign of values in (-1, 0).
+        __m128 t2 = _mm_and_ps(_mm_castsi128_ps(_mm_set1_epi32(0x80000000)), a);
+        return _mm_or_ps(_mm_add_ps(t0, t1), t2);
+#endif
+    }
+    UME_FORCE_INLINE __m128 round_ps_sse(__m128 a) {
+#if defined(__SSE4_1__)
+        return _mm_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#else
+        // Round to nearest even using the current rounding mode of the conversion.
+        __m128 t0 = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
+        __m128 t1 = _mm_andnot_ps(t0, a);
+        __m128 t2 = _mm_cvtepi32_ps(_mm_cvtps_epi32(a));
+        __m128 t3 = _mm_or_ps(t2, _mm_and_ps(t0, a));
+        __m128 t4 = _mm_cmpnlt_ps(t1, _mm_set1_ps(8388608.0f));
+        return blendv_ps_sse(t3, a, t4);
+#endif
+    }
+    UME_FORCE_INLINE __m128d round_pd_sse(__m128d a) {
+#if defined(__SSE4_1__)
+        return _mm_round_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#else
+        // Adding and subtracting 2^52 rounds the magnitude to an integer.
+        __m128d t0 = _mm_castsi128_pd(_mm_set1_epi64x(0x8000000000000000LL));
+        __m128d t1 = _mm_andnot_pd(t0, a);
+        __m128d t2 = _mm_set1_pd(4503599627370496.0);
+        __m128d t3 = _mm_sub_pd(_mm_add_pd(t1, t2), t2);
+        __m128d t4 = _mm_or_pd(t3, _mm_and_pd(t0, a));
+        __m128d t5 = _mm_cmpnlt_pd(t1, t2);
+        return blendv_pd_sse(t4, a, t5);
+#endif
+    }
+    UME_FORCE_INLINE __m128d trunc_pd_sse(__m128d a) {
+#if defined(__SSE4_1__)
+        return _mm_round_pd(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+#else
+        __m128d t0 = _mm_castsi128_pd(_mm_set1_epi64x(0x8000000000000000LL));
+        __m128d t1 = _mm_andnot_pd(t0, a);
+        __m128d t2 = round_pd_sse(t1);
+        __m128d t3 = _mm_and_pd(_mm_cmpgt_pd(t2, t1), _mm_set1_pd(1.0));
+        __m128d t4 = _mm_sub_pd(t2, t3);
+        return _mm_or_pd(t4, _mm_and_pd(t0, a));
+#endif
+    }
+    UME_FORCE_INLINE __m128d floor_pd_sse(__m128d a) {
+#if defined(__SSE4_1__)
+        return _mm_floor_pd(a);
+#else
+        __m128d t0 = round_pd_sse(a);
+        __m128d t1 = _mm_and_pd(_mm_cmpgt_pd(t0, a), _mm_set1_pd(1.0));
+        return _mm_sub_pd(t0, t1);
+#endif
+    }
+    UME_FORCE_INLINE __m128d ceil_pd_sse(__m128d a) {
+#if defined(__SSE4_1__)
+        return _mm_ceil_pd(a);
+#else
+        __m128d t0 = round_pd_sse(a);
+        __m128d t1 = _mm_and_pd(_mm_cmplt_pd(t0, a), _mm_set1_pd(1.0));
+        __m128d t2 = _mm_and_pd(_mm_castsi128_pd(_mm_set1_epi64x(0x8000000000000000LL)), a);
+        return _mm_or_pd(_mm_add_pd(t0, t1), t2);
+#endif
+    }
+}
+}
+
+#endif
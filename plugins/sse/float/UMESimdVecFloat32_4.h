@@ -0,0 +1,1464 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_FLOAT32_4_H_
+#define UME_SIMD_VEC_FLOAT32_4_H_
+
+#include <type_traits>
+#include <immintrin.h>
+
+#include "../../../UMESimdInterface.h"
+
+    #define BLEND(a_128, b_128, mask_128i) blendv_ps_sse(a_128, b_128, _mm_castsi128_ps(mask_128i))
+    #define MASK_STORE(f32_addr, mask_128i, a_128) maskstore_ps_sse(f32_addr, mask_128i, a_128)
+
+namespace UME {
+namespace SIMD {
+
+    template<> class SIMDVec_f<double, 4>;
+
+    template<>
+    class SIMDVec_f<float, 4> :
+        public SIMDVecFloatInterface<
+            SIMDVec_f<float, 4>,
+            SIMDVec_u<uint32_t, 4>,
+            SIMDVec_i<int32_t, 4>,
+            float,
+            4,
+            uint32_t,
+            int32_t,
+            SIMDVecMask<4>,
+            SIMDSwizzle<4>> ,
+        public SIMDVecPackableInterface<
+            SIMDVec_f<float, 4>,
+            SIMDVec_f<float, 2 >>
+    {
+        friend class SIMDVec_u<uint32_t, 4>;
+        friend class SIMDVec_i<int32_t, 4>;
+        friend class SIMDVec_f<double, 4>;
+
+        friend class SIMDVec_f<float, 8>;
+    private:
+        __m128 mVec;
+
+        UME_FORCE_INLINE SIMDVec_f(__m128 const & x) {
+            this->mVec = x;
+        }
+
+        // Lane classification kernels used by ISFIN..ISZEROSUB. Lanes for which
+        // the predicate holds are set to all ones.
+        static UME_FORCE_INLINE __m128 absLanes(__m128 const & a) {
+            return _mm_and_ps(a, _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF)));
+        }
+        static UME_FORCE_INLINE __m128 finiteLanes(__m128 const & a) {
+            __m128 t0 = _mm_set1_ps(std::numeric_limits<float>::infinity());
+            return _mm_cmplt_ps(absLanes(a), t0);
+        }
+        static UME_FORCE_INLINE __m128 infiniteLanes(__m128 const & a) {
+            __m128 t0 = _mm_set1_ps(std::numeric_limits<float>::infinity());
+            return _mm_cmpeq_ps(absLanes(a), t0);
+        }
+        static UME_FORCE_INLINE __m128 nanLanes(__m128 const & a) {
+            return _mm_cmpunord_ps(a, a);
+        }
+        static UME_FORCE_INLINE __m128 zeroLanes(__m128 const & a) {
+            return _mm_cmpeq_ps(a, _mm_setzero_ps());
+        }
+        static UME_FORCE_INLINE __m128 zeroOrSubnormalLanes(__m128 const & a) {
+            __m128 t0 = _mm_set1_ps(std::numeric_limits<float>::min());
+            return _mm_cmplt_ps(absLanes(a), t0);
+        }
+        static UME_FORCE_INLINE __m128 subnormalLanes(__m128 const & a) {
+            return _mm_andnot_ps(zeroLanes(a), zeroOrSubnormalLanes(a));
+        }
+        // Bitonic sorting network kernels used by SORTA/SORTD. Every step pairs
+        // each lane with a partner lane, and keeps the minimum or the maximum of
+        // the pair, as selected by bits of BLEND_MASK.
+        template<int BLEND_MASK>
+        static UME_FORCE_INLINE __m128 sortStep(__m128 const & a, __m128 const & b) {
+            return blend_ps_sse<BLEND_MASK>(_mm_min_ps(a, b), _mm_max_ps(a, b));
+        }
+        static UME_FORCE_INLINE __m128 sortLanes(__m128 a) {
+            a = sortStep<0x6>(a, _mm_shuffle_ps(a, a, 0xB1));
+            return mergeLanes(a);
+        }
+        // Sorts a bitonic sequence in ascending order.
+        static UME_FORCE_INLINE __m128 mergeLanes(__m128 a) {
+            a = sortStep<0xC>(a, _mm_shuffle_ps(a, a, 0x4E));
+            a = sortStep<0xA>(a, _mm_shuffle_ps(a, a, 0xB1));
+            return a;
+        }
+        static UME_FORCE_INLINE __m128 reverseLanes(__m128 const & a) {
+            return _mm_shuffle_ps(a, a, 0x1B);
+        }
+        // Stores lanes of 'v' selected by bits of 'm' contiguously, starting
+        // at 'p', and returns their count.
+        static UME_FORCE_INLINE uint32_t compressLanes(float * p, __m128 const & v, int m) {
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, v);
+            uint32_t n = 0;
+            for (int i = 0; i < 4; i++) {
+                if (m & (1 << i)) p[n++] = raw[i];
+            }
+            return n;
+        }
+    public:
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_f() {}
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_f(float f) {
+            mVec = _mm_set1_ps(f);
+        }
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_f(
+            T i, 
+            typename std::enable_if< std::is_fundamental<T>::value && 
+                                    !std::is_same<T, float>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_f(static_cast<float>(i)) {}
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVec_f(float const * p) {
+            mVec = _mm_loadu_ps(p);
+        }
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVec_f(float f0, float f1, float f2, float f3) {
+            mVec = _mm_setr_ps(f0, f1, f2, f3);
+        }
+        // EXTRACT
+        UME_FORCE_INLINE float extract(uint32_t index) const {
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, mVec);
+            return raw[index];
+        }
+        UME_FORCE_INLINE float operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_f & insert(uint32_t index, float value) {
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, mVec);
+            raw[index] = value;
+            mVec = _mm_load_ps(raw);
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_f, float> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_f, float>(index, static_cast<SIMDVec_f &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_f, float, SIMDVecMask<4>> operator() (SIMDVecMask<4> const & mask) {
+            return IntermediateMask<SIMDVec_f, float, SIMDVecMask<4>>(mask, static_cast<SIMDVec_f &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_f, float, SIMDVecMask<4>> operator[] (SIMDVecMask<4> const & mask) {
+            return IntermediateMask<SIMDVec_f, float, SIMDVecMask<4>>(mask, static_cast<SIMDVec_f &>(*this));
+        }
+#endif
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_f & assign(SIMDVec_f const & b) {
+            mVec = b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator= (SIMDVec_f const & b) {
+            return assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_f & assign(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            mVec = BLEND(mVec, b.mVec, mask.mMask);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_f & assign(float b) {
+            mVec = _mm_set1_ps(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator= (float b) {
+            return assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_f & assign(SIMDVecMask<4> const & mask, float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+
+        // PREFETCH0
+        // PREFETCH1
+        // PREFETCH2
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_f & load(float const * p) {
+            mVec = _mm_loadu_ps(p);
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<4> const & mask, float const * p) {
+            __m128 t0 = _mm_loadu_ps(p);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_f & loada(float const * p) {
+            mVec = _mm_load_ps(p);
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<4> const & mask, float const * p) {
+            __m128 t0 = _mm_load_ps(p);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE float* store(float* p) const {
+            _mm_storeu_ps(p, mVec);
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE float* store(SIMDVecMask<4> const & mask, float * p) const {
+            MASK_STORE(p, mask.mMask, mVec);
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE float* storea(float * p) const {
+            _mm_store_ps(p, mVec);
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE float* storea(SIMDVecMask<4> const & mask, float * p) const {
+            MASK_STORE(p, mask.mMask, mVec);
+            return p;
+        }
+
+        // BLENDV
+        // BLENDS
+        // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_f swizzle(SIMDSwizzle<4> const & sMask) const {
+            __m128 t0 = permutevar_ps_sse(mVec, sMask.mVec);
+            return SIMDVec_f(t0);
+        }
+        template<int i0, int i1, int i2, int i3>
+        UME_FORCE_INLINE SIMDVec_f swizzle() const {
+            __m128 t0 = _mm_shuffle_ps(mVec, mVec, (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6));
+            return SIMDVec_f(t0);
+        }
+        // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_f & swizzlea(SIMDSwizzle<4> const & sMask) {
+            SIMDVec_f t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_f sorta() const {
+            __m128 t0 = sortLanes(mVec);
+            return SIMDVec_f(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_f sortd() const {
+            __m128 t0 = permute_ps_sse<0x1B>(sortLanes(mVec));
+            return SIMDVec_f(t0);
+        }
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_add_ps(this->mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator+ (SIMDVec_f const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_f add(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = _mm_add_ps(this->mVec, b.mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_f add(float b) const {
+            __m128 t0 = _mm_add_ps(this->mVec, _mm_set1_ps(b));
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator+ (float b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_f add(SIMDVecMask<4> const & mask, float b) const {
+            __m128 t0 = _mm_add_ps(this->mVec, _mm_set1_ps(b));
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_f & adda(SIMDVec_f const & b) {
+            mVec = _mm_add_ps(this->mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator+= (SIMDVec_f const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_f & adda(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            __m128 t0 = _mm_add_ps(this->mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_f & adda(float b) {
+            mVec = _mm_add_ps(this->mVec, _mm_set1_ps(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator+= (float b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_f & adda(SIMDVecMask<4> const & mask, float b) {
+            __m128 t0 = _mm_add_ps(this->mVec, _mm_set1_ps(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVec_f const & b) const {
+            return add(b);
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return add(mask, b);
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(float b) const {
+            return add(b);
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<4> const & mask, float b) const {
+            return add(mask, b);
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVec_f const & b) {
+            return adda(b);
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            return adda(mask, b);
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(float b) {
+            return adda(b);
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<4> const & mask, float b) {
+            return adda(mask, b);
+        }
+        // POSTINC
+        UME_FORCE_INLINE SIMDVec_f postinc() {
+            __m128 t0 = mVec;
+            mVec = _mm_add_ps(mVec, _mm_set1_ps(1.0f));
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator++ (int) {
+            return postinc();
+        }
+        // MPOSTINC
+        UME_FORCE_INLINE SIMDVec_f postinc(SIMDVecMask<4> const & mask) {
+            __m128 t0 = mVec;
+            __m128 t1 = _mm_add_ps(mVec, _mm_set1_ps(1.0f));
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_f(t0);
+        }
+        // PREFINC
+        UME_FORCE_INLINE SIMDVec_f & prefinc() {
+            mVec = _mm_add_ps(mVec, _mm_set1_ps(1.0f));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator++ () {
+            mVec = _mm_add_ps(mVec, _mm_set1_ps(1.0f));
+            return *this;
+        }
+        // MPREFINC
+        UME_FORCE_INLINE SIMDVec_f & prefinc(SIMDVecMask<4> const & mask) {
+            __m128 t0 = _mm_add_ps(mVec, _mm_set1_ps(1.0f));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_f sub(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_sub_ps(mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator- (SIMDVec_f const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_f sub(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = _mm_sub_ps(mVec, b.mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_f sub(float b) const {
+            __m128 t0 = _mm_sub_ps(mVec, _mm_set1_ps(b));
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator- (float b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_f sub(SIMDVecMask<4> const & mask, float b) const {
+            __m128 t0 = _mm_sub_ps(mVec, _mm_set1_ps(b));
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_f & suba(SIMDVec_f const & b) {
+            mVec = _mm_sub_ps(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator-=(SIMDVec_f const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_f & suba(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            __m128 t0 = _mm_sub_ps(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_f & suba(float b) {
+            mVec = _mm_sub_ps(mVec, _mm_set1_ps(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator-= (float b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_f & suba(SIMDVecMask<4> const & mask, float b) {
+            __m128 t0 = _mm_sub_ps(mVec, _mm_set1_ps(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVec_f const & b) const {
+            return sub(b);
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return sub(mask, b);
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(float b) const {
+            return sub(b);
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<4> const & mask, float b) const {
+            return sub(mask, b);
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVec_f const & b) {
+            return suba(b);
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            return suba(mask, b);
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(float b) {
+            return suba(b);
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<4> const & mask, float b) {
+            return suba(mask, b);
+        }
+        // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_sub_ps(b.mVec, mVec);
+            return SIMDVec_f(t0);
+        }
+        // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = _mm_sub_ps(b.mVec, mVec);
+            __m128 t1 = BLEND(b.mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_f subfrom(float b) const {
+            __m128 t0 = _mm_sub_ps(_mm_set1_ps(b), mVec);
+            return SIMDVec_f(t0);
+        }
+        // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVecMask<4> const & mask, float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_sub_ps(t0, mVec);
+            __m128 t2 = BLEND(t0, t1, mask.mMask);
+            return SIMDVec_f(t2);
+        }
+        // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_f & subfroma(SIMDVec_f const & b) {
+            mVec = _mm_sub_ps(b.mVec, mVec);
+            return *this;
+        }
+        // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_f & subfroma(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            __m128 t0 = _mm_sub_ps(b.mVec, mVec);
+            mVec = BLEND(b.mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_f & subfroma(float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            mVec = _mm_sub_ps(t0, mVec);
+            return *this;
+        }
+        // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_f & subfroma(SIMDVecMask<4> const & mask, float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_sub_ps(t0, mVec);
+            mVec = BLEND(t0, t1, mask.mMask);
+            return *this;
+        }
+        // POSTDEC
+        UME_FORCE_INLINE SIMDVec_f postdec() {
+            __m128 t0 = mVec;
+            mVec = _mm_sub_ps(mVec, _mm_set1_ps(1.0f));
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator-- (int) {
+            return postdec();
+        }
+        // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_f postdec(SIMDVecMask<4> const & mask) {
+            __m128 t0 = mVec;
+            __m128 t1 = _mm_sub_ps(mVec, _mm_set1_ps(1.0f));
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_f(t0);
+        }
+        // PREFDEC
+        UME_FORCE_INLINE SIMDVec_f & prefdec() {
+            mVec = _mm_sub_ps(mVec, _mm_set1_ps(1.0f));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator-- () {
+            return prefdec();
+        }
+        // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_f & prefdec(SIMDVecMask<4> const & mask) {
+            __m128 t0 = _mm_sub_ps(mVec, _mm_set1_ps(1.0f));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MULV
+        UME_FORCE_INLINE SIMDVec_f mul(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_mul_ps(mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator* (SIMDVec_f const & b) const {
+            return mul(b);
+        }
+        // MMULV
+        UME_FORCE_INLINE SIMDVec_f mul(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = _mm_mul_ps(mVec, b.mVec);
+            __m128 t2 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t2);
+        }
+        // MULS
+        UME_FORCE_INLINE SIMDVec_f mul(float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_mul_ps(mVec, t0);
+            return SIMDVec_f(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator* (float b) const {
+            return mul(b);
+        }
+        // MMULS
+        UME_FORCE_INLINE SIMDVec_f mul(SIMDVecMask<4> const & mask, float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_mul_ps(mVec, t0);
+            __m128 t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_f(t2);
+        }
+        // MULVA
+        UME_FORCE_INLINE SIMDVec_f & mula(SIMDVec_f const & b) {
+            mVec = _mm_mul_ps(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator*= (SIMDVec_f const & b) {
+            return mula(b);
+        }
+        // MMULVA
+        UME_FORCE_INLINE SIMDVec_f & mula(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            __m128 t0 = _mm_mul_ps(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MULSA
+        UME_FORCE_INLINE SIMDVec_f & mula(float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            mVec = _mm_mul_ps(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator*= (float b) {
+            return mula(b);
+        }
+        // MMULSA
+        UME_FORCE_INLINE SIMDVec_f & mula(SIMDVecMask<4> const & mask, float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_mul_ps(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // DIVV
+        UME_FORCE_INLINE SIMDVec_f div(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_div_ps(mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator/ (SIMDVec_f const & b) const {
+            return div(b);
+        }
+        // MDIVV
+        UME_FORCE_INLINE SIMDVec_f div(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = _mm_div_ps(mVec, b.mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // DIVS
+        UME_FORCE_INLINE SIMDVec_f div(float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_div_ps(mVec, t0);
+            return SIMDVec_f(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator/ (float b) const {
+            return div(b);
+        }
+        // MDIVS
+        UME_FORCE_INLINE SIMDVec_f div(SIMDVecMask<4> const & mask, float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_div_ps(mVec, t0);
+            __m128 t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_f(t2);
+        }
+        // DIVVA
+        UME_FORCE_INLINE SIMDVec_f & diva(SIMDVec_f const & b) {
+            mVec = _mm_div_ps(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator/= (SIMDVec_f const & b) {
+            return diva(b);
+        }
+        // MDIVVA
+        UME_FORCE_INLINE SIMDVec_f & diva(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            __m128 t0 = _mm_div_ps(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // DIVSA
+        UME_FORCE_INLINE SIMDVec_f & diva(float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            mVec = _mm_div_ps(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator/= (float b) {
+            return diva(b);
+        }
+        // MDIVSA
+        UME_FORCE_INLINE SIMDVec_f & diva(SIMDVecMask<4> const & mask, float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_div_ps(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // RCP
+        UME_FORCE_INLINE SIMDVec_f rcp() const {
+            __m128 t0 = _mm_rcp_ps(mVec);
+            return SIMDVec_f(t0);
+        }
+        // MRCP
+        UME_FORCE_INLINE SIMDVec_f rcp(SIMDVecMask<4> const & mask) const {
+            __m128 t0 = _mm_rcp_ps(mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // RCPS
+        UME_FORCE_INLINE SIMDVec_f rcp(float b) const {
+            __m128 t0 = _mm_rcp_ps(mVec);
+            __m128 t1 = _mm_set1_ps(b);
+            __m128 t2 = _mm_mul_ps(t0, t1);
+            return SIMDVec_f(t2);
+        }
+        // MRCPS
+        UME_FORCE_INLINE SIMDVec_f rcp(SIMDVecMask<4> const & mask, float b) const {
+            __m128 t0 = _mm_rcp_ps(mVec);
+            __m128 t1 = _mm_set1_ps(b);
+            __m128 t2 = _mm_mul_ps(t0, t1);
+            __m128 t3 = BLEND(mVec, t2, mask.mMask);
+            return SIMDVec_f(t3);
+        }
+        // RCPA
+        UME_FORCE_INLINE SIMDVec_f & rcpa() {
+            mVec = _mm_rcp_ps(mVec);
+            return *this;
+        }
+        // MRCPA
+        UME_FORCE_INLINE SIMDVec_f & rcpa(SIMDVecMask<4> const & mask) {
+            __m128 t0 = _mm_rcp_ps(mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // RCPSA
+        UME_FORCE_INLINE SIMDVec_f & rcpa(float b) {
+            __m128 t0 = _mm_rcp_ps(mVec);
+            __m128 t1 = _mm_set1_ps(b);
+            mVec = _mm_mul_ps(t0, t1);
+            return *this;
+        }
+        // MRCPSA
+        UME_FORCE_INLINE SIMDVec_f & rcpa(SIMDVecMask<4> const & mask, float b) {
+            __m128 t0 = _mm_rcp_ps(mVec);
+            __m128 t1 = _mm_set1_ps(b);
+            __m128 t2 = _mm_mul_ps(t0, t1);
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpeq(SIMDVec_f const & b) const {
+            __m128i m0 = _mm_castps_si128(_mm_cmpeq_ps(mVec, b.mVec));
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator== (SIMDVec_f const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<4> cmpeq(float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128i m0 = _mm_castps_si128(_mm_cmpeq_ps(mVec, t0));
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator== (float b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpne(SIMDVec_f const & b) const {
+            __m128i m0 = _mm_castps_si128(_mm_cmpneq_ps(mVec, b.mVec));
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator!= (SIMDVec_f const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<4> cmpne(float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128i m0 = _mm_castps_si128(_mm_cmpneq_ps(mVec, t0));
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator!= (float b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpgt(SIMDVec_f const & b) const {
+            __m128i m0 = _mm_castps_si128(_mm_cmpgt_ps(mVec, b.mVec));
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator> (SIMDVec_f const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<4> cmpgt(float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128i m0 = _mm_castps_si128(_mm_cmpgt_ps(mVec, t0));
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator> (float b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<4> cmplt(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_cmplt_ps(mVec, b.mVec);
+            __m128i m0 = _mm_castps_si128(t0);
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator< (SIMDVec_f const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<4> cmplt(float b) const {
+            __m128 t0 = _mm_cmplt_ps(mVec, _mm_set1_ps(b));
+            __m128i m0 = _mm_castps_si128(t0);
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator< (float b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpge(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_cmpge_ps(mVec, b.mVec);
+            __m128i m0 = _mm_castps_si128(t0);
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator>= (SIMDVec_f const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<4> cmpge(float b) const {
+            __m128 t0 = _mm_cmpge_ps(mVec, _mm_set1_ps(b));
+            __m128i m0 = _mm_castps_si128(t0);
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator>= (float b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmple(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_cmple_ps(mVec, b.mVec);
+            __m128i m0 = _mm_castps_si128(t0);
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator<= (SIMDVec_f const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<4> cmple(float b) const {
+            __m128 t0 = _mm_cmple_ps(mVec, _mm_set1_ps(b));
+            __m128i m0 = _mm_castps_si128(t0);
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator<= (float b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_f const & b) const {
+            alignas(16) uint32_t raw[4];
+            __m128 m0 = _mm_cmpeq_ps(mVec, b.mVec);
+            _mm_store_si128((__m128i*)raw, _mm_castps_si128(m0));
+            return (raw[0] != 0) && (raw[1] != 0) && (raw[2] != 0) && (raw[3] !=0);
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(float b) const {
+            alignas(16) uint32_t raw[4];
+            __m128 m0 = _mm_cmpeq_ps(mVec, _mm_set1_ps(b));
+            _mm_store_si128((__m128i*)raw, _mm_castps_si128(m0));
+            return (raw[0] != 0) && (raw[1] != 0) && (raw[2] != 0) && (raw[3] !=0);
+        }
+
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = BLEND(mVec, b.mVec, mask.mMask);
+            return SIMDVec_f(t0);
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<4> const & mask, float b) const {
+            __m128 t0 = BLEND(mVec, _mm_set1_ps(b), mask.mMask);
+            return SIMDVec_f(t0);
+        }
+        // HADD
+        UME_FORCE_INLINE float hadd() const {
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, mVec);
+            return raw[0] + raw[1] + raw[2] + raw[3];
+        }
+        // MHADD
+        UME_FORCE_INLINE float hadd(SIMDVecMask<4> const & mask) const {
+            alignas(16) float raw[4];
+            __m128 t0 = BLEND(_mm_set1_ps(0.0f), mVec, mask.mMask);
+            _mm_store_ps(raw, t0);
+            return raw[0] + raw[1] + raw[2] + raw[3];
+        }
+        // HADDS
+        UME_FORCE_INLINE float hadd(float b) const {
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, mVec);
+            return raw[0] + raw[1] + raw[2] + raw[3] + b;
+        }
+        // MHADDS
+        UME_FORCE_INLINE float hadd(SIMDVecMask<4> const & mask, float b) const {
+            alignas(16) float raw[4];
+            __m128 t0 = BLEND(_mm_set1_ps(0.0f), mVec, mask.mMask);
+            _mm_store_ps(raw, t0);
+            return raw[0] + raw[1] + raw[2] + raw[3] + b;
+        }
+        // HMUL
+        UME_FORCE_INLINE float hmul() const {
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, mVec);
+            return raw[0] * raw[1] * raw[2] * raw[3];
+        }
+        // MHMUL
+        UME_FORCE_INLINE float hmul(SIMDVecMask<4> const & mask) const {
+            alignas(16) float raw[4];
+            __m128 t0 = BLEND(_mm_set1_ps(1.0f), mVec, mask.mMask);
+            _mm_store_ps(raw, t0);
+            return raw[0] * raw[1] * raw[2] * raw[3];
+        }
+        // HMULS
+        UME_FORCE_INLINE float hmul(float b) const {
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, mVec);
+            return raw[0] * raw[1] * raw[2] * raw[3] * b;
+        }
+        // MHMULS
+        UME_FORCE_INLINE float hmul(SIMDVecMask<4> const & mask, float b) const {
+            alignas(16) float raw[4];
+            __m128 t0 = BLEND(_mm_set1_ps(1.0f), mVec, mask.mMask);
+            _mm_store_ps(raw, t0);
+            return raw[0] * raw[1] * raw[2] * raw[3] * b;
+        }
+
+        // FMULADDV
+        UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#ifdef FMA
+            __m128 t0 = _mm_add_ps(_mm_mul_ps(mVec, b.mVec), c.mVec);
+#else
+            __m128 t0 = _mm_add_ps(_mm_mul_ps(mVec, b.mVec), c.mVec);
+#endif
+            return SIMDVec_f(t0);
+        }
+        // MFMULADDV
+        UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#ifdef FMA
+            __m128 t0 = _mm_add_ps(_mm_mul_ps(mVec, b.mVec), c.mVec);
+#else
+            __m128 t0 = _mm_add_ps(_mm_mul_ps(mVec, b.mVec), c.mVec);
+#endif
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // FMULSUBV
+        UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128 t0 = _mm_sub_ps(_mm_mul_ps(mVec, b.mVec), c.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFMULSUBV
+        UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128 t0 = _mm_sub_ps(_mm_mul_ps(mVec, b.mVec), c.mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // FADDMULV
+        UME_FORCE_INLINE SIMDVec_f faddmul(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128 t0 = _mm_mul_ps(_mm_add_ps(mVec, b.mVec), c.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFADDMULV
+        UME_FORCE_INLINE SIMDVec_f faddmul(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128 t0 = _mm_mul_ps(_mm_add_ps(mVec, b.mVec), c.mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // FSUBMULV
+        UME_FORCE_INLINE SIMDVec_f fsubmul(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128 t0 = _mm_mul_ps(_mm_sub_ps(mVec, b.mVec), c.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFSUBMULV
+        UME_FORCE_INLINE SIMDVec_f fsubmul(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128 t0 = _mm_mul_ps(_mm_sub_ps(mVec, b.mVec), c.mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+
+        // MAXV
+        UME_FORCE_INLINE SIMDVec_f max(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_max_ps(mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MMAXV
+        UME_FORCE_INLINE SIMDVec_f max(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = _mm_max_ps(mVec, b.mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // MAXS
+        UME_FORCE_INLINE SIMDVec_f max(float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_max_ps(mVec, t0);
+            return SIMDVec_f(t1);
+        }
+        // MMAXS
+        UME_FORCE_INLINE SIMDVec_f max(SIMDVecMask<4> const & mask, float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_max_ps(mVec, t0);
+            __m128 t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_f(t2);
+        }
+        // MAXVA
+        UME_FORCE_INLINE SIMDVec_f & maxa(SIMDVec_f const & b) {
+            mVec = _mm_max_ps(mVec, b.mVec);
+            return *this;
+        }
+        // MMAXVA
+        UME_FORCE_INLINE SIMDVec_f & maxa(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            __m128 t0 = _mm_max_ps(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MAXSA
+        UME_FORCE_INLINE SIMDVec_f & maxa(float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            mVec = _mm_max_ps(mVec, t0);
+            return *this;
+        }
+        // MMAXSA
+        UME_FORCE_INLINE SIMDVec_f & maxa(SIMDVecMask<4> const & mask, float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_max_ps(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // MINV
+        UME_FORCE_INLINE SIMDVec_f min(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_min_ps(mVec, b.mVec);
+            return SIMDVec_f(t0);
+        }
+        // MMINV
+        UME_FORCE_INLINE SIMDVec_f min(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = _mm_min_ps(mVec, b.mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // MINS
+        UME_FORCE_INLINE SIMDVec_f min(float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_min_ps(mVec, t0);
+            return SIMDVec_f(t1);
+        }
+        // MMINS
+        UME_FORCE_INLINE SIMDVec_f min(SIMDVecMask<4> const & mask, float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_min_ps(mVec, t0);
+            __m128 t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_f(t2);
+        }
+        // MINVA
+        UME_FORCE_INLINE SIMDVec_f & mina(SIMDVec_f const & b) {
+            mVec = _mm_min_ps(mVec, b.mVec);
+            return *this;
+        }
+        // MMINVA
+        UME_FORCE_INLINE SIMDVec_f & mina(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            __m128 t0 = _mm_min_ps(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MINSA
+        UME_FORCE_INLINE SIMDVec_f & mina(float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            mVec = _mm_min_ps(mVec, t0);
+            return *this;
+        }
+        // MMINSA
+        UME_FORCE_INLINE SIMDVec_f & mina(SIMDVecMask<4> const & mask, float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_min_ps(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // HMAX
+        UME_FORCE_INLINE float hmax() const {
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, mVec);
+            float t0 = (raw[0] > raw[1]) ? raw[0] : raw[1];
+            float t1 = (raw[2] > raw[3]) ? raw[2] : raw[3];
+            return t0 > t1 ? t0 : t1;
+        }
+        // MHMAX
+        UME_FORCE_INLINE float hmax(SIMDVecMask<4> const & mask) const {
+            alignas(16) float raw[4];
+            __m128 t0 = _mm_set1_ps(std::numeric_limits<float>::min());
+            __m128 t1 = BLEND(t0, mVec, mask.mMask);
+            _mm_store_ps(raw, t1);
+            float t2 = (raw[0] > raw[1]) ? raw[0] : raw[1];
+            float t3 = (raw[2] > raw[3]) ? raw[2] : raw[3];
+            return t2 > t3 ? t2 : t3;
+        }
+        // IMAX
+        // MIMAX
+        // HMIN
+        UME_FORCE_INLINE float hmin() const {
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, mVec);
+            float t0 = (raw[0] < raw[1]) ? raw[0] : raw[1];
+            float t1 = (raw[2] < raw[3]) ? raw[2] : raw[3];
+            return t0 < t1 ? t0 : t1;
+        }
+        // MHMIN
+        UME_FORCE_INLINE float hmin(SIMDVecMask<4> const & mask) const {
+            alignas(16) float raw[4];
+            __m128 t0 = _mm_set1_ps(std::numeric_limits<float>::max());
+            __m128 t1 = BLEND(t0, mVec, mask.mMask);
+            _mm_store_ps(raw, t1);
+            float t2 = (raw[0] < raw[1]) ? raw[0] : raw[1];
+            float t3 = (raw[2] < raw[3]) ? raw[2] : raw[3];
+            return t2 < t3 ? t2 : t3;
+        }
+        // IMIN
+        // MIMIN
+
+        // GATHERS
+        UME_FORCE_INLINE SIMDVec_f & gather(float const * baseAddr, uint32_t const * indices) {
+            __m128i t0 = _mm_load_si128((__m128i*)indices);
+            mVec = i32gather_ps_sse((const float *)baseAddr, t0);
+            return *this;
+        }
+        // MGATHERS
+        UME_FORCE_INLINE SIMDVec_f & gather(SIMDVecMask<4> const & mask, float const * baseAddr, uint32_t const * indices) {
+            __m128i t0 = _mm_load_si128((__m128i*)indices);
+            __m128 t1 = i32gather_ps_sse((const float *)baseAddr, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // GATHERV
+        UME_FORCE_INLINE SIMDVec_f & gather(float const * baseAddr, SIMDVec_u<uint32_t, 4> const & indices) {
+            mVec = i32gather_ps_sse((const float *)baseAddr, indices.mVec);
+            return *this;
+        }
+        // MGATHERV
+        UME_FORCE_INLINE SIMDVec_f & gather(SIMDVecMask<4> const & mask, float const * baseAddr, SIMDVec_u<uint32_t, 4> const & indices) {
+            __m128 t0 = i32gather_ps_sse((const float *)baseAddr, indices.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SCATTERS
+        UME_FORCE_INLINE float* scatter(float* baseAddr, uint32_t* indices) const {
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, mVec);
+            for (int i = 0; i < 4; i++) { baseAddr[indices[i]] = raw[i]; };
+            return baseAddr;
+        }
+        // MSCATTERS
+        UME_FORCE_INLINE float* scatter(SIMDVecMask<4> const & mask, float* baseAddr, uint32_t* indices) const {
+            alignas(16) uint32_t rawMask[4];
+            _mm_store_si128((__m128i*) rawMask, mask.mMask);
+            alignas(16) float raw[4];
+            _mm_store_ps(raw, mVec);
+            for (int i = 0; i < 4; i++) { if (rawMask[i] == SIMDVecMask<4>::TRUE_VAL()) baseAddr[indices[i]] = raw[i]; };
+            return baseAddr;
+        }
+        // SCATTERV
+        UME_FORCE_INLINE float* scatter(float* baseAddr, SIMDVec_u<uint32_t, 4> const & indices) const {
+            alignas(16) float raw[4];
+            alignas(16) uint32_t rawIndices[4];
+            _mm_store_ps(raw, mVec);
+            _mm_store_si128((__m128i*) rawIndices, indices.mVec);
+            for (int i = 0; i < 4; i++) { baseAddr[rawIndices[i]] = raw[i]; };
+            return baseAddr;
+        }
+        // MSCATTERV
+        UME_FORCE_INLINE float* scatter(SIMDVecMask<4> const & mask, float* baseAddr, SIMDVec_u<uint32_t, 4> const & indices) const {
+            alignas(16) uint32_t rawMask[4];
+            _mm_store_si128((__m128i*) rawMask, mask.mMask);
+            alignas(16) float raw[4];
+            alignas(16) uint32_t rawIndices[4];
+            _mm_store_ps(raw, mVec);
+            _mm_store_si128((__m128i*) rawIndices, indices.mVec);
+            for (int i = 0; i < 4; i++) {
+                if (rawMask[i] == SIMDVecMask<4>::TRUE_VAL())
+                    baseAddr[rawIndices[i]] = raw[i];
+            };
+            return baseAddr;
+        }
+        // NEG
+        UME_FORCE_INLINE SIMDVec_f neg() const {
+            __m128 t0 = _mm_sub_ps(_mm_set1_ps(0.0f), mVec);
+            return SIMDVec_f(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator- () const {
+            return neg();
+        }
+        // MNEG
+        UME_FORCE_INLINE SIMDVec_f neg(SIMDVecMask<4> const & mask) const {
+            __m128 t0 = _mm_sub_ps(_mm_set1_ps(0.0f), mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // NEGA
+        UME_FORCE_INLINE SIMDVec_f & nega() {
+            mVec = _mm_sub_ps(_mm_set1_ps(0.0f), mVec);
+            return *this;
+        }
+        // MNEGA
+        UME_FORCE_INLINE SIMDVec_f & nega(SIMDVecMask<4> const & mask) {
+            __m128 t0 = _mm_sub_ps(_mm_set1_ps(0.0f), mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // ABS
+        UME_FORCE_INLINE SIMDVec_f abs() const {
+            __m128i t0 = _mm_set1_epi32(0x7FFFFFFF);
+            __m128 t1 = _mm_castsi128_ps(t0);
+            __m128 t2 = _mm_and_ps(t1, mVec);
+            return SIMDVec_f(t2);
+        }
+        // MABS
+        UME_FORCE_INLINE SIMDVec_f abs(SIMDVecMask<4> const & mask) const {
+            __m128i t0 = _mm_set1_epi32(0x7FFFFFFF);
+            __m128 t1 = _mm_castsi128_ps(t0);
+            __m128 t2 = _mm_and_ps(t1, mVec);
+            __m128 t3 = BLEND(mVec, t2, mask.mMask);
+            return SIMDVec_f(t3);
+        }
+        // ABSA
+        UME_FORCE_INLINE SIMDVec_f & absa() {
+            __m128i t0 = _mm_set1_epi32(0x7FFFFFFF);
+            __m128 t1 = _mm_castsi128_ps(t0);
+            mVec = _mm_and_ps(t1, mVec);
+            return *this;
+        }
+        // MABSA
+        UME_FORCE_INLINE SIMDVec_f & absa(SIMDVecMask<4> const & mask) {
+            __m128i t0 = _mm_set1_epi32(0x7FFFFFFF);
+            __m128 t1 = _mm_castsi128_ps(t0);
+            __m128 t2 = _mm_and_ps(t1, mVec);
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
+        // CMPEQRV
+        // CMPEQRS
+
+        // SQR
+        UME_FORCE_INLINE SIMDVec_f sqr() const {
+            __m128 t0 = _mm_mul_ps(mVec, mVec);
+            return SIMDVec_f(t0);
+        }
+        // MSQR
+        UME_FORCE_INLINE SIMDVec_f sqr(SIMDVecMask<4> const & mask) const {
+            __m128 t0 = _mm_mul_ps(mVec, mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // SQRA
+        UME_FORCE_INLINE SIMDVec_f & sqra() {
+            mVec = _mm_mul_ps(mVec, mVec);
+            return *this;
+        }
+        // MSQRA
+        UME_FORCE_INLINE SIMDVec_f & sqra(SIMDVecMask<4> const & mask) {
+            __m128 t0 = _mm_mul_ps(mVec, mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SQRT
+        UME_FORCE_INLINE SIMDVec_f sqrt() const {
+            __m128 t0 = _mm_sqrt_ps(mVec);
+            return SIMDVec_f(t0);
+        }
+        // MSQRT
+        UME_FORCE_INLINE SIMDVec_f sqrt(SIMDVecMask<4> const & mask) const {
+            __m128 t0 = _mm_sqrt_ps(mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // SQRTA
+        UME_FORCE_INLINE SIMDVec_f & sqrta() {
+            mVec = _mm_sqrt_ps(mVec);
+            return *this;
+        }
+        // MSQRTA
+        UME_FORCE_INLINE SIMDVec_f & sqrta(SIMDVecMask<4> const & mask) {
+            __m128 t0 = _mm_sqrt_ps(mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // POWV
+        // MPOWV
+        // POWS
+        // MPOWS
+        // ROUND
+        UME_FORCE_INLINE SIMDVec_f round() const {
+            __m128 t0 = round_ps_sse(mVec);
+            return SIMDVec_f(t0);
+        }
+        // MROUND
+        UME_FORCE_INLINE SIMDVec_f round(SIMDVecMask<4> const & mask) const {
+            __m128 t0 = round_ps_sse(mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // TRUNC
+        SIMDVec_i<int32_t, 4> trunc() const {
+            __m128i t0 = _mm_cvttps_epi32(mVec);
+            return SIMDVec_i<int32_t, 4>(t0);
+        }
+        // MTRUNC
+        SIMDVec_i<int32_t, 4> trunc(SIMDVecMask<4> const & mask) const {
+            __m128 t0 = _mm_setzero_ps();
+            __m128i t1 = _mm_cvttps_epi32(BLEND(t0, mVec, mask.mMask));
+            return SIMDVec_i<int32_t, 4>(t1);
+        }
+        // FLOOR
+        UME_FORCE_INLINE SIMDVec_f floor() const {
+            __m128 t0 = floor_ps_sse(mVec);
+            return SIMDVec_f(t0);
+        }
+        // MFLOOR
+        UME_FORCE_INLINE SIMDVec_f floor(SIMDVecMask<4> const & mask) const {
+            __m128 t0 = floor_ps_sse(mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // CEIL
+        UME_FORCE_INLINE SIMDVec_f ceil() const {
+            __m128 t0 = ceil_ps_sse(mVec);
+            return SIMDVec_f(t0);
+        }
+        // MCEIL
+        UME_FORCE_INLINE SIMDVec_f ceil(SIMDVecMask<4> const & mask) const {
+            __m128 t0 = ceil_ps_sse(mVec);
+            __m128 t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_f(t1);
+        }
+        // ISFIN
+        UME_FORCE_INLINE SIMDVecMask<4> isfin() const {
+            return SIMDVecMask<4>(_mm_castps_si128(finiteLanes(mVec)));
+        }
+        // ISINF
+        UME_FORCE_INLINE SIMDVecMask<4> isinf() const {
+            return SIMDVecMask<4>(_mm_castps_si128(infiniteLanes(mVec)));
+        }
+        // ISAN
+        UME_FORCE_INLINE SIMDVecMask<4> isan() const {
+            return SIMDVecMask<4>(_mm_castps_si128(finiteLanes(mVec)));
+        }
+        // ISNAN
+        UME_FORCE_INLINE SIMDVecMask<4> isnan() const {
+            return SIMDVecMask<4>(_mm_castps_si128(nanLanes(mVec)));
+        }
+        // ISSUB
+        UME_FORCE_INLINE SIMDVecMask<4> issub() const {
+            return SIMDVecMask<4>(_mm_castps_si128(subnormalLanes(mVec)));
+        }
+        // ISZERO
+        UME_FORCE_INLINE SIMDVecMask<4> iszero() const {
+            return SIMDVecMask<4>(_mm_castps_si128(zeroLanes(mVec)));
+        }
+        // ISZEROSUB
+        UME_FORCE_INLINE SIMDVecMask<4> iszerosub() const {
+            return SIMDVecMask<4>(_mm_castps_si128(zeroOrSubnormalLanes(mVec)));
+        }
+        // EXP
+        UME_FORCE_INLINE SIMDVec_f exp() const {
+            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+        }
+        // MEXP
+        UME_FORCE_INLINE SIMDVec_f exp(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // LOG
+        UME_FORCE_INLINE SIMDVec_f log() const {
+            return VECTOR_EMULATION::logf<SIMDVec_f, SIMDVec_u<uint32_t, 4>>(*this);
+        }
+        // MLOG
+        UME_FORCE_INLINE SIMDVec_f log(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::logf<SIMDVec_f, SIMDVec_u<uint32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // LOG2
+        // MLOG2
+        // LOG10
+        // MLOG10
+        // SIN
+        UME_FORCE_INLINE SIMDVec_f sin() const {
+            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MSIN
+        UME_FORCE_INLINE SIMDVec_f sin(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::sinf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // COS
+        UME_FORCE_INLINE SIMDVec_f cos() const {
+            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MCOS
+        UME_FORCE_INLINE SIMDVec_f cos(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::cosf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // SINCOS
+        UME_FORCE_INLINE void sincos(SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            VECTOR_EMULATION::sincosf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(*this, sinvec, cosvec);
+        }
+        // MSINCOS
+        UME_FORCE_INLINE void sincos(SIMDVecMask<4> const & mask, SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            VECTOR_EMULATION::sincosf<SIMDVec_f, SIMDVec_i<int32_t, 4>, SIMDVecMask<4>>(mask, *this, sinvec, cosvec);
+        }
+        // TAN
+        // MTAN
+        // CTAN
+        // MCTAN
+
+        // PACK
+        UME_FORCE_INLINE SIMDVec_f & pack(SIMDVec_f<float, 2> const & a, SIMDVec_f<float, 2> const & b) {
+            mVec = _mm_setr_ps(a[0], a[1], b[0], b[1]);
+            return *this;
+        }
+        // PACKLO
+        UME_FORCE_INLINE SIMDVec_f & packlo(SIMDVec_f<float, 2> const & a) {
+            __m128 t0 = _mm_setr_ps(a[0], a[1], 0.0f, 0.0f);
+            mVec = _mm_shuffle_ps(t0, mVec, 0xE4);
+            return *this;
+        }
+        // PACKHI
+        UME_FORCE_INLINE SIMDVec_f & packhi(SIMDVec_f<float, 2> const & b) {
+            __m128 t0 = _mm_setr_ps(b[0], b[1], 0.0f, 0.0f);
+            mVec = _mm_movelh_ps(mVec, t0);
+            return *this;
+        }
+        // UNPACK
+        UME_FORCE_INLINE void unpack(SIMDVec_f<float, 2> & a, SIMDVec_f<float, 2> & b) const {
+            a = unpacklo();
+            b = unpackhi();
+        }
+        // UNPACKLO
+        UME_FORCE_INLINE SIMDVec_f<float, 2> unpacklo() const {
+            float t0 = _mm_cvtss_f32(mVec);
+            float t1 = _mm_cvtss_f32(_mm_shuffle_ps(mVec, mVec, 0x01));
+            return SIMDVec_f<float, 2>(t0, t1);
+        }
+        // UNPACKHI
+        UME_FORCE_INLINE SIMDVec_f<float, 2> unpackhi() const {
+            float t0 = _mm_cvtss_f32(_mm_movehl_ps(mVec, mVec));
+            float t1 = _mm_cvtss_f32(_mm_shuffle_ps(mVec, mVec, 0x03));
+            return SIMDVec_f<float, 2>(t0, t1);
+        }
+
+        // PROMOTE
+        UME_FORCE_INLINE operator SIMDVec_f<double, 4>() const;
+        // DEGRADE
+        // -
+
+        // FTOU
+        UME_FORCE_INLINE operator SIMDVec_u<uint32_t, 4>() const;
+        // FTOI
+        UME_FORCE_INLINE operator SIMDVec_i<int32_t, 4>() const;
+    };
+}
+}
+
+#undef BLEND
+#undef MASK_STORE
+
+#endif
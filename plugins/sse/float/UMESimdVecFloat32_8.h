@@ -0,0 +1,1811 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_FLOAT32_8_H_
+#define UME_SIMD_VEC_FLOAT32_8_H_
+
+#include <type_traits>
+#include <immintrin.h>
+
+#include "../../../UMESimdInterface.h"
+
+#define BLEND(a_128, b_128, mask_128i) blendv_ps_sse(a_128, b_128, _mm_castsi128_ps(mask_128i))
+
+namespace UME {
+namespace SIMD {
+
+    template<>
+    class SIMDVec_f<float, 8> :
+        public SIMDVecFloatInterface<
+            SIMDVec_f<float, 8>,
+            SIMDVec_u<uint32_t, 8>,
+            SIMDVec_i<int32_t, 8>,
+            float,
+            8,
+            uint32_t,
+            int32_t,
+            SIMDVecMask<8>,
+            SIMDSwizzle<8>> ,
+        public SIMDVecPackableInterface<
+            SIMDVec_f<float, 8>,
+            SIMDVec_f<float, 4>>
+    {
+        friend class SIMDVec_i<int32_t, 8>;
+        friend class SIMDVec_u<uint32_t, 8>;
+    private:
+        __m128 mVec[2];
+
+        UME_FORCE_INLINE SIMDVec_f(__m128 const & xLo, __m128 const & xHi) {
+            this->mVec[0] = xLo;
+            this->mVec[1] = xHi;
+        }
+
+        typedef SIMDVec_u<uint32_t, 8>    VEC_UINT_TYPE;
+        typedef SIMDVec_i<int32_t, 8>     VEC_INT_TYPE;
+
+        // Lane classification kernels used by ISFIN..ISZEROSUB. Lanes for which
+        // the predicate holds are set to all ones.
+        static UME_FORCE_INLINE __m128 absLanes(__m128 const & a) {
+            return _mm_and_ps(a, _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF)));
+        }
+        static UME_FORCE_INLINE __m128 finiteLanes(__m128 const & a) {
+            __m128 t0 = _mm_set1_ps(std::numeric_limits<float>::infinity());
+            return _mm_cmplt_ps(absLanes(a), t0);
+        }
+        static UME_FORCE_INLINE __m128 infiniteLanes(__m128 const & a) {
+            __m128 t0 = _mm_set1_ps(std::numeric_limits<float>::infinity());
+            return _mm_cmpeq_ps(absLanes(a), t0);
+        }
+        static UME_FORCE_INLINE __m128 nanLanes(__m128 const & a) {
+            return _mm_cmpunord_ps(a, a);
+        }
+        static UME_FORCE_INLINE __m128 zeroLanes(__m128 const & a) {
+            return _mm_cmpeq_ps(a, _mm_setzero_ps());
+        }
+        static UME_FORCE_INLINE __m128 zeroOrSubnormalLanes(__m128 const & a) {
+            __m128 t0 = _mm_set1_ps(std::numeric_limits<float>::min());
+            return _mm_cmplt_ps(absLanes(a), t0);
+        }
+        static UME_FORCE_INLINE __m128 subnormalLanes(__m128 const & a) {
+            return _mm_andnot_ps(zeroLanes(a), zeroOrSubnormalLanes(a));
+        }
+        // Writes lanes of 'v' selected by bits of 'm' to baseAddr[indices[i]],
+        // in lane order.
+        static UME_FORCE_INLINE void scatterLanes(float * baseAddr, __m128 v, __m128i indices, int m) {
+            alignas(16) uint32_t raw[4];
+            _mm_store_si128((__m128i*)raw, indices);
+            if (m & 0x1) _mm_store_ss(baseAddr + raw[0], v);
+            if (m & 0x2) _mm_store_ss(baseAddr + raw[1], _mm_shuffle_ps(v, v, 0x01));
+            if (m & 0x4) _mm_store_ss(baseAddr + raw[2], _mm_movehl_ps(v, v));
+            if (m & 0x8) _mm_store_ss(baseAddr + raw[3], _mm_shuffle_ps(v, v, 0x03));
+        }
+        // Adds lanes of 'v' selected by bits of 'm' to baseAddr[indices[i]],
+        // in lane order, so that lanes with repeating indices accumulate.
+        static UME_FORCE_INLINE void scatterAddLanes(float * baseAddr, __m128 v, __m128i indices, int m) {
+            alignas(16) uint32_t raw[4];
+            _mm_store_si128((__m128i*)raw, indices);
+            if (m & 0x1) baseAddr[raw[0]] += _mm_cvtss_f32(v);
+            if (m & 0x2) baseAddr[raw[1]] += _mm_cvtss_f32(_mm_shuffle_ps(v, v, 0x01));
+            if (m & 0x4) baseAddr[raw[2]] += _mm_cvtss_f32(_mm_movehl_ps(v, v));
+            if (m & 0x8) baseAddr[raw[3]] += _mm_cvtss_f32(_mm_shuffle_ps(v, v, 0x03));
+        }
+    public:
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_f() {}
+
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_f(float f) {
+            mVec[0] = _mm_set1_ps(f);
+            mVec[1] = _mm_set1_ps(f);
+        }
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_f(
+            T i, 
+            typename std::enable_if< std::is_fundamental<T>::value && 
+                                    !std::is_same<T, float>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_f(static_cast<float>(i)) {}
+
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVec_f(float const *p) { this->load(p); }
+
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVec_f(float f0, float f1, float f2, float f3,
+                         float f4, float f5, float f6, float f7) {
+            mVec[0] = _mm_setr_ps(f0, f1, f2, f3);
+            mVec[1] = _mm_setr_ps(f4, f5, f6, f7);
+        }
+        // EXTRACT
+        UME_FORCE_INLINE float extract(uint32_t index) const {
+            alignas(16) float raw[4];
+            if (index < 4) {
+                _mm_store_ps(raw, mVec[0]);
+                return raw[index];
+            }
+            else {
+                _mm_store_ps(raw, mVec[1]);
+                return raw[index - 4];
+            }
+        }
+        UME_FORCE_INLINE float operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_f & insert(uint32_t index, float value) {
+            alignas(16) float raw[4];
+            if (index < 4) {
+                _mm_store_ps(raw, mVec[0]);
+                raw[index] = value;
+                mVec[0] = _mm_load_ps(raw);
+            }
+            else {
+                _mm_store_ps(raw, mVec[1]);
+                raw[index - 4] = value;
+                mVec[1] = _mm_load_ps(raw);
+            }
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_f, float> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_f, float>(index, static_cast<SIMDVec_f &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_f, float, SIMDVecMask<8>> operator() (SIMDVecMask<8> const & mask) {
+            return IntermediateMask<SIMDVec_f, float, SIMDVecMask<8>>(mask, static_cast<SIMDVec_f &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_f, float, SIMDVecMask<8>> operator[] (SIMDVecMask<8> const & mask) {
+            return IntermediateMask<SIMDVec_f, float, SIMDVecMask<8>>(mask, static_cast<SIMDVec_f &>(*this));
+        }
+#endif
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_f & assign(SIMDVec_f const & b) {
+            mVec[0] = b.mVec[0];
+            mVec[1] = b.mVec[1];
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator= (SIMDVec_f const & b) {
+            return assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_f & assign(SIMDVecMask<8> const & mask, SIMDVec_f const & b) {
+            __m128 m0 = _mm_castsi128_ps(mask.mMask[0]);
+            __m128 m1 = _mm_castsi128_ps(mask.mMask[1]);
+            mVec[0] = blendv_ps_sse(mVec[0], b.mVec[0], m0);
+            mVec[1] = blendv_ps_sse(mVec[1], b.mVec[1], m1);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_f & assign(float b) {
+            mVec[0] = _mm_set1_ps(b);
+            mVec[1] = mVec[0];
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator= (float b) {
+            return assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_f & assign(SIMDVecMask<8> const & mask, float b) {
+            __m128 m0 = _mm_castsi128_ps(mask.mMask[0]);
+            __m128 m1 = _mm_castsi128_ps(mask.mMask[1]);
+            __m128 t0 = _mm_set1_ps(b);
+            mVec[0] = blendv_ps_sse(mVec[0], t0, m0);
+            mVec[1] = blendv_ps_sse(mVec[1], t0, m1);
+            return *this;
+        }
+
+        // PREFETCH0
+        // PREFETCH1
+        // PREFETCH2
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_f & load(float const * p) {
+            mVec[0] = _mm_loadu_ps(p);
+            mVec[1] = _mm_loadu_ps(p + 4);
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<8> const & mask, float const * p) {
+            __m128 t0 = _mm_loadu_ps(p);
+            __m128 t1 = _mm_loadu_ps(p + 4);
+            mVec[0] = blendv_ps_sse(mVec[0], t0, _mm_castsi128_ps(mask.mMask[0]));
+            mVec[1] = blendv_ps_sse(mVec[1], t1, _mm_castsi128_ps(mask.mMask[1]));
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_f & loada(float const * p) {
+            mVec[0] = _mm_load_ps(p);
+            mVec[1] = _mm_load_ps(p + 4);
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<8> const & mask, float const * p) {
+            __m128 t0 = _mm_load_ps(p);
+            __m128 t1 = _mm_load_ps(p + 4);
+            mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
+            mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // SLOAD
+        UME_FORCE_INLINE SIMDVec_f & sload(float const * p) {
+            __m128i t0 = stream_load_si128_sse((__m128i*)p);
+            __m128i t1 = stream_load_si128_sse((__m128i*)(p + 4));
+            mVec[0] = _mm_castsi128_ps(t0);
+            mVec[1] = _mm_castsi128_ps(t1);
+            return *this;
+        }
+        // MSLOAD
+        UME_FORCE_INLINE SIMDVec_f & sload(SIMDVecMask<8> const & mask, float const * p) {
+            __m128i t0 = stream_load_si128_sse((__m128i*)p);
+            __m128i t1 = stream_load_si128_sse((__m128i*)(p + 4));
+            __m128 t2 = _mm_castsi128_ps(t0);
+            __m128 t3 = _mm_castsi128_ps(t1);
+            mVec[0] = BLEND(mVec[0], t2, mask.mMask[0]);
+            mVec[1] = BLEND(mVec[1], t3, mask.mMask[1]);
+            return *this;
+        }
+
+        // STORE
+        UME_FORCE_INLINE float* store(float* p) const {
+            _mm_storeu_ps(p, mVec[0]);
+            _mm_storeu_ps((p + 4), mVec[1]);
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE float* store(SIMDVecMask<8> const & mask, float * p) const {
+            maskstore_ps_sse(p, mask.mMask[0], mVec[0]);
+            maskstore_ps_sse((p + 4), mask.mMask[1], mVec[1]);
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE float* storea(float* p) const {
+            _mm_store_ps(p, mVec[0]);
+            _mm_store_ps(p + 4, mVec[1]);
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE float* storea(SIMDVecMask<8> const & mask, float* p) const {
+            maskstore_ps_sse(p, mask.mMask[0], mVec[0]);
+            maskstore_ps_sse(p + 4, mask.mMask[1], mVec[1]);
+            return p;
+        }
+        // SSTORE
+        UME_FORCE_INLINE float* sstore(float* p) const {
+            _mm_stream_ps(p, mVec[0]);
+            _mm_stream_ps(p + 4, mVec[1]);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE float* sstore(SIMDVecMask<8> const & mask, float* p) const {
+            __m128i t0 = stream_load_si128_sse((__m128i*)p);
+            __m128i t1 = stream_load_si128_sse((__m128i*)(p + 4));
+            __m128 t2 = _mm_castsi128_ps(t0);
+            __m128 t3 = _mm_castsi128_ps(t1);
+            __m128 t4 = BLEND(t2, mVec[0], mask.mMask[0]);
+            __m128 t5 = BLEND(t3, mVec[1], mask.mMask[1]);
+            _mm_stream_ps(p, t4);
+            _mm_stream_ps(p + 4, t5);
+            return p;
+        }
+
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressstore(SIMDVecMask<8> const & mask, float * p) const {
+            uint32_t t0 = SIMDVec_f<float, 4>::compressLanes(p, mVec[0], _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[0])));
+            uint32_t t1 = SIMDVec_f<float, 4>::compressLanes(p + t0, mVec[1], _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[1])));
+            return t0 + t1;
+        }
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = BLEND(mVec[0], b.mVec[0], mask.mMask[0]);
+            __m128 t1 = BLEND(mVec[1], b.mVec[1], mask.mMask[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<8> const & mask, float b) const {
+            __m128 t0 = BLEND(mVec[0], _mm_set1_ps(b), mask.mMask[0]);
+            __m128 t1 = BLEND(mVec[1], _mm_set1_ps(b), mask.mMask[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // SWIZZLE
+        // SWIZZLEA
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_f sorta() const {
+            // Sorting the halves in opposite directions gives a bitonic sequence.
+            __m128 t0 = SIMDVec_f<float, 4>::sortLanes(mVec[0]);
+            __m128 t1 = SIMDVec_f<float, 4>::reverseLanes(SIMDVec_f<float, 4>::sortLanes(mVec[1]));
+            __m128 t2 = SIMDVec_f<float, 4>::mergeLanes(_mm_min_ps(t0, t1));
+            __m128 t3 = SIMDVec_f<float, 4>::mergeLanes(_mm_max_ps(t1, t0));
+            return SIMDVec_f(t2, t3);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_f sortd() const {
+            __m128 t0 = SIMDVec_f<float, 4>::sortLanes(mVec[0]);
+            __m128 t1 = SIMDVec_f<float, 4>::reverseLanes(SIMDVec_f<float, 4>::sortLanes(mVec[1]));
+            __m128 t2 = SIMDVec_f<float, 4>::mergeLanes(_mm_min_ps(t0, t1));
+            __m128 t3 = SIMDVec_f<float, 4>::mergeLanes(_mm_max_ps(t1, t0));
+            return SIMDVec_f(SIMDVec_f<float, 4>::reverseLanes(t3), SIMDVec_f<float, 4>::reverseLanes(t2));
+        }
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_add_ps(mVec[0], b.mVec[0]);
+            __m128 t1 = _mm_add_ps(mVec[1], b.mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator+ (SIMDVec_f const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_f add(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = _mm_add_ps(mVec[0], b.mVec[0]);
+            __m128 t1 = _mm_add_ps(mVec[1], b.mVec[1]);
+            __m128 t2 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t3 = BLEND(mVec[1], t1, mask.mMask[1]);
+            return SIMDVec_f(t2, t3);
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_f add(float b) const {
+            __m128 t0 = _mm_add_ps(mVec[0], _mm_set1_ps(b));
+            __m128 t1 = _mm_add_ps(mVec[1], _mm_set1_ps(b));
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator+ (float b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_f add(SIMDVecMask<8> const & mask, float b) const {
+            __m128 t0 = _mm_add_ps(mVec[0], _mm_set1_ps(b));
+            __m128 t1 = _mm_add_ps(mVec[1], _mm_set1_ps(b));
+            __m128 t2 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t3 = BLEND(mVec[1], t1, mask.mMask[1]);
+            return SIMDVec_f(t2, t3);
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_f & adda(SIMDVec_f const & b) {
+            mVec[0] = _mm_add_ps(mVec[0], b.mVec[0]);
+            mVec[1] = _mm_add_ps(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator+= (SIMDVec_f const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_f & adda(SIMDVecMask<8> const & mask, SIMDVec_f const & b) {
+            __m128 t0 = _mm_add_ps(mVec[0], b.mVec[0]);
+            __m128 t1 = _mm_add_ps(mVec[1], b.mVec[1]);
+            mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
+            mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_f & adda(float b) {
+            mVec[0] = _mm_add_ps(mVec[0], _mm_set1_ps(b));
+            mVec[1] = _mm_add_ps(mVec[1], _mm_set1_ps(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator+= (float b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_f & adda(SIMDVecMask<8> const & mask, float b) {
+            __m128 t0 = _mm_add_ps(mVec[0], _mm_set1_ps(b));
+            __m128 t1 = _mm_add_ps(mVec[1], _mm_set1_ps(b));
+            mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
+            mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVec_f const & b) const {
+            return add(b);
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return add(mask, b);
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(float b) const {
+            return add(b);
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<8> const & mask, float b) const {
+            return add(mask, b);
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVec_f const & b) {
+            return adda(b);
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<8> const & mask, SIMDVec_f const & b) {
+            return adda(mask, b);
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(float b) {
+            return adda(b);
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<8> const & mask, float b) {
+            return adda(mask, b);
+        }
+        // POSTINC
+        UME_FORCE_INLINE SIMDVec_f postinc() {
+            __m128 t0 = _mm_set1_ps(1);
+            __m128 t1 = mVec[0];
+            mVec[0] = _mm_add_ps(mVec[0], t0);
+            __m128 t2 = mVec[1];
+            mVec[1] = _mm_add_ps(mVec[1], t0);
+            return SIMDVec_f(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator++ (int) {
+            return postinc();
+        }
+        // MPOSTINC
+        UME_FORCE_INLINE SIMDVec_f postinc(SIMDVecMask<8> const & mask) {
+            __m128 t0 = _mm_set1_ps(1);
+            __m128 t1 = mVec[0];
+            __m128 t2 = _mm_add_ps(mVec[0], t0);
+            mVec[0] = BLEND(mVec[0], t2, mask.mMask[0]);
+            __m128 t3 = mVec[1];
+            __m128 t4 = _mm_add_ps(mVec[1], t0);
+            mVec[1] = BLEND(mVec[1], t4, mask.mMask[1]);
+            return SIMDVec_f(t1, t3);
+        }
+        // PREFINC
+        UME_FORCE_INLINE SIMDVec_f & prefinc() {
+            __m128 t0 = _mm_set1_ps(1);
+            mVec[0] = _mm_add_ps(mVec[0], t0);
+            mVec[1] = _mm_add_ps(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator++ () {
+            return prefinc();
+        }
+        // MPREFINC
+        UME_FORCE_INLINE SIMDVec_f & prefinc(SIMDVecMask<8> const & mask) {
+            __m128 t0 = _mm_set1_ps(1);
+            __m128 t1 = _mm_add_ps(mVec[0], t0);
+            mVec[0] = BLEND(mVec[0], t1, mask.mMask[0]);
+            __m128 t2 = _mm_add_ps(mVec[1], t0);
+            mVec[1] = BLEND(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_f sub(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_sub_ps(mVec[0], b.mVec[0]);
+            __m128 t1 = _mm_sub_ps(mVec[1], b.mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator- (SIMDVec_f const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_f sub(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = _mm_sub_ps(mVec[0], b.mVec[0]);
+            __m128 t1 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t2 = _mm_sub_ps(mVec[1], b.mVec[1]);
+            __m128 t3 = BLEND(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_f(t1, t3);
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_f sub(float b) const {
+            __m128 t0 = _mm_sub_ps(mVec[0], _mm_set1_ps(b));
+            __m128 t1 = _mm_sub_ps(mVec[1], _mm_set1_ps(b));
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator- (float b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_f sub(SIMDVecMask<8> const & mask, float b) const {
+            __m128 t0 = _mm_sub_ps(mVec[0], _mm_set1_ps(b));
+            __m128 t1 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t2 = _mm_sub_ps(mVec[1], _mm_set1_ps(b));
+            __m128 t3 = BLEND(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_f(t1, t3);
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_f & suba(SIMDVec_f const & b) {
+            mVec[0] = _mm_sub_ps(mVec[0], b.mVec[0]);
+            mVec[1] = _mm_sub_ps(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator-= (SIMDVec_f const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_f & suba(SIMDVecMask<8> const & mask, SIMDVec_f const & b) {
+            __m128 t0 = _mm_sub_ps(mVec[0], b.mVec[0]);
+            mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t1 = _mm_sub_ps(mVec[1], b.mVec[1]);
+            mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_f & suba(float b) {
+            mVec[0] = _mm_sub_ps(mVec[0], _mm_set1_ps(b));
+            mVec[1] = _mm_sub_ps(mVec[1], _mm_set1_ps(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator-= (float b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_f & suba(SIMDVecMask<8> const & mask, float b) {
+            __m128 t0 = _mm_sub_ps(mVec[0], _mm_set1_ps(b));
+            mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t1 = _mm_sub_ps(mVec[1], _mm_set1_ps(b));
+            mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVec_f const & b) const {
+            return sub(b);
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            return sub(mask, b);
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(float b) const {
+            return sub(b);
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<8> const & mask, float b) const {
+            return sub(mask, b);
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVec_f const & b) {
+            return suba(b);
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<8> const & mask, SIMDVec_f const & b) {
+            return suba(mask, b);
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(float b) {
+            return suba(b);
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<8> const & mask, float b) {
+            return suba(mask, b);
+        }
+        // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_sub_ps(b.mVec[0], mVec[0]);
+            __m128 t1 = _mm_sub_ps(b.mVec[1], mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = _mm_sub_ps(b.mVec[0], mVec[0]);
+            __m128 t1 = BLEND(b.mVec[0], t0, mask.mMask[0]);
+            __m128 t2 = _mm_sub_ps(b.mVec[1], mVec[1]);
+            __m128 t3 = BLEND(b.mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_f(t1, t3);
+        }
+        // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_f subfrom(float b) const {
+            __m128 t0 = _mm_sub_ps(_mm_set1_ps(b), mVec[0]);
+            __m128 t1 = _mm_sub_ps(_mm_set1_ps(b), mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVecMask<8> const & mask, float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_sub_ps(t0, mVec[0]);
+            __m128 t2 = BLEND(t0, t1, mask.mMask[0]);
+            __m128 t3 = _mm_sub_ps(t0, mVec[1]);
+            __m128 t4 = BLEND(t0, t3, mask.mMask[1]);
+            return SIMDVec_f(t2, t4);
+        }
+        // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_f & subfroma(SIMDVec_f const & b) {
+            mVec[0] = _mm_sub_ps(b.mVec[0], mVec[0]);
+            mVec[1] = _mm_sub_ps(b.mVec[1], mVec[1]);
+            return *this;
+        }
+        // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_f & subfroma(SIMDVecMask<8> const & mask, SIMDVec_f const & b) {
+            __m128 t0 = _mm_sub_ps(b.mVec[0], mVec[0]);
+            mVec[0] = BLEND(b.mVec[0], t0, mask.mMask[0]);
+            __m128 t1 = _mm_sub_ps(b.mVec[1], mVec[1]);
+            mVec[1] = BLEND(b.mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_f & subfroma(float b) {
+            mVec[0] = _mm_sub_ps(_mm_set1_ps(b), mVec[0]);
+            mVec[1] = _mm_sub_ps(_mm_set1_ps(b), mVec[1]);
+            return *this;
+        }
+        // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_f subfroma(SIMDVecMask<8> const & mask, float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_sub_ps(t0, mVec[0]);
+            mVec[0] = BLEND(t0, t1, mask.mMask[0]);
+            __m128 t2 = _mm_sub_ps(t0, mVec[1]);
+            mVec[1] = BLEND(t0, t2, mask.mMask[1]);
+            return *this;
+        }
+        // POSTDEC
+        UME_FORCE_INLINE SIMDVec_f postdec() {
+            __m128 t0 = _mm_set1_ps(1);
+            __m128 t1 = mVec[0];
+            mVec[0] = _mm_sub_ps(mVec[0], t0);
+            __m128 t2 = mVec[1];
+            mVec[1] = _mm_sub_ps(mVec[1], t0);
+            return SIMDVec_f(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator-- (int) {
+            return postdec();
+        }
+        // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_f postdec(SIMDVecMask<8> const & mask) {
+            __m128 t0 = _mm_set1_ps(1);
+            __m128 t1 = mVec[0];
+            __m128 t2 = _mm_sub_ps(mVec[0], t0);
+            mVec[0] = BLEND(mVec[0], t2, mask.mMask[0]);
+            __m128 t3 = mVec[1];
+            __m128 t4 = _mm_sub_ps(mVec[1], t0);
+            mVec[1] = BLEND(mVec[1], t4, mask.mMask[1]);
+            return SIMDVec_f(t1, t3);
+        }
+        // PREFDEC
+        UME_FORCE_INLINE SIMDVec_f & prefdec() {
+            __m128 t0 = _mm_set1_ps(1);
+            mVec[0] = _mm_sub_ps(mVec[0], t0);
+            mVec[1] = _mm_sub_ps(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator-- () {
+            return prefdec();
+        }
+        // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_f & prefdec(SIMDVecMask<8> const & mask) {
+            __m128 t0 = _mm_set1_ps(1);
+            __m128 t1 = _mm_sub_ps(mVec[0], t0);
+            mVec[0] = BLEND(mVec[0], t1, mask.mMask[0]);
+            __m128 t2 = _mm_sub_ps(mVec[1], t0);
+            mVec[1] = BLEND(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // MULV
+        UME_FORCE_INLINE SIMDVec_f mul(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_mul_ps(mVec[0], b.mVec[0]);
+            __m128 t1 = _mm_mul_ps(mVec[1], b.mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator* (SIMDVec_f const & b) const {
+            return mul(b);
+        }
+        // MMULV
+        UME_FORCE_INLINE SIMDVec_f mul(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = _mm_mul_ps(mVec[0], b.mVec[0]);
+            __m128 t1 = _mm_mul_ps(mVec[1], b.mVec[1]);
+            __m128 t2 = blendv_ps_sse(mVec[0], t0, _mm_castsi128_ps(mask.mMask[0]));
+            __m128 t3 = blendv_ps_sse(mVec[1], t1, _mm_castsi128_ps(mask.mMask[1]));
+            return SIMDVec_f(t2, t3);
+        }
+        // MULS
+        UME_FORCE_INLINE SIMDVec_f mul(float b) const {
+            __m128 t0 = _mm_mul_ps(this->mVec[0], _mm_set1_ps(b));
+            __m128 t1 = _mm_mul_ps(this->mVec[1], _mm_set1_ps(b));
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator* (float b) const {
+            return mul(b);
+        }
+        // MMULS
+        UME_FORCE_INLINE SIMDVec_f mul(SIMDVecMask<8> const & mask, float b) const {
+            __m128 t0 = _mm_mul_ps(mVec[0], _mm_set1_ps(b));
+            __m128 t1 = _mm_mul_ps(mVec[1], _mm_set1_ps(b));
+            __m128 t2 = blendv_ps_sse(mVec[0], t0, _mm_castsi128_ps(mask.mMask[0]));
+            __m128 t3 = blendv_ps_sse(mVec[1], t1, _mm_castsi128_ps(mask.mMask[1]));
+            return SIMDVec_f(t2, t3);
+        }
+        // MULVA
+        UME_FORCE_INLINE SIMDVec_f & mula(SIMDVec_f const & b) {
+            mVec[0] = _mm_mul_ps(mVec[0], b.mVec[0]);
+            mVec[1] = _mm_mul_ps(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator*= (SIMDVec_f const & b) {
+            return mula(b);
+        }
+        // MMULVA
+        UME_FORCE_INLINE SIMDVec_f & mula(SIMDVecMask<8> const & mask, SIMDVec_f const & b) {
+            __m128 t0 = _mm_mul_ps(mVec[0], b.mVec[0]);
+            mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t1 = _mm_mul_ps(mVec[1], b.mVec[1]);
+            mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // MULSA
+        UME_FORCE_INLINE SIMDVec_f & mula(float b) {
+            mVec[0] = _mm_mul_ps(mVec[0], _mm_set1_ps(b));
+            mVec[1] = _mm_mul_ps(mVec[1], _mm_set1_ps(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator*= (float b) {
+            return mula(b);
+        }
+        // MMULSA
+        UME_FORCE_INLINE SIMDVec_f & mula(SIMDVecMask<8> const & mask, float b) {
+            __m128 t0 = _mm_mul_ps(mVec[0], _mm_set1_ps(b));
+            mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t1 = _mm_mul_ps(mVec[1], _mm_set1_ps(b));
+            mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // DIVV
+        UME_FORCE_INLINE SIMDVec_f div(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_div_ps(mVec[0], b.mVec[0]);
+            __m128 t1 = _mm_div_ps(mVec[1], b.mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator/ (SIMDVec_f const & b) const {
+            return div(b);
+        }
+        // MDIVV
+        UME_FORCE_INLINE SIMDVec_f div(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = _mm_div_ps(mVec[0], b.mVec[0]);
+            __m128 t1 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t2 = _mm_div_ps(mVec[1], b.mVec[1]);
+            __m128 t3 = BLEND(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_f(t1, t3);
+        }
+        // DIVS
+        UME_FORCE_INLINE SIMDVec_f div(float b) const {
+            __m128 t0 = _mm_div_ps(mVec[0], _mm_set1_ps(b));
+            __m128 t1 = _mm_div_ps(mVec[1], _mm_set1_ps(b));
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator/ (float b) const {
+            return div(b);
+        }
+        // MDIVS
+        UME_FORCE_INLINE SIMDVec_f div(SIMDVecMask<8> const & mask, float b) const {
+            __m128 t0 = _mm_div_ps(mVec[0], _mm_set1_ps(b));
+            __m128 t1 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t2 = _mm_div_ps(mVec[1], _mm_set1_ps(b));
+            __m128 t3 = BLEND(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_f(t1, t3);
+        }
+        // DIVVA
+        UME_FORCE_INLINE SIMDVec_f & diva(SIMDVec_f const & b) {
+            mVec[0] = _mm_div_ps(mVec[0], b.mVec[0]);
+            mVec[1] = _mm_div_ps(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator/= (SIMDVec_f const & b) {
+            return diva(b);
+        }
+        // MDIVVA
+        UME_FORCE_INLINE SIMDVec_f & diva(SIMDVecMask<8> const & mask, SIMDVec_f const & b) {
+            __m128 t0 = _mm_div_ps(mVec[0], b.mVec[0]);
+            mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t1 = _mm_div_ps(mVec[1], b.mVec[1]);
+            mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // DIVSA
+        UME_FORCE_INLINE SIMDVec_f & diva(float b) {
+            mVec[0] = _mm_div_ps(mVec[0], _mm_set1_ps(b));
+            mVec[1] = _mm_div_ps(mVec[1], _mm_set1_ps(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator/= (float b) {
+            return diva(b);
+        }
+        // MDIVSA
+        UME_FORCE_INLINE SIMDVec_f & diva(SIMDVecMask<8> const & mask, float b) {
+            __m128 t0 = _mm_div_ps(mVec[0], _mm_set1_ps(b));
+            mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t1 = _mm_div_ps(mVec[1], _mm_set1_ps(b));
+            mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // RCP
+        UME_FORCE_INLINE SIMDVec_f rcp() const {
+            __m128 t0 = _mm_rcp_ps(mVec[0]);
+            __m128 t1 = _mm_rcp_ps(mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // MRCP
+        UME_FORCE_INLINE SIMDVec_f rcp(SIMDVecMask<8> const & mask) const {
+            __m128 t0 = _mm_rcp_ps(mVec[0]);
+            __m128 t1 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t2 = _mm_rcp_ps(mVec[1]);
+            __m128 t3 = BLEND(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_f(t1, t3);
+        }
+        // RCPS
+        UME_FORCE_INLINE SIMDVec_f rcp(float b) const {
+            __m128 t0 = _mm_mul_ps(_mm_rcp_ps(mVec[0]), _mm_set1_ps(b));
+            __m128 t1 = _mm_mul_ps(_mm_rcp_ps(mVec[1]), _mm_set1_ps(b));
+            return SIMDVec_f(t0, t1);
+        }
+        // MRCPS
+        UME_FORCE_INLINE SIMDVec_f rcp(SIMDVecMask<8> const & mask, float b) const {
+            __m128 t0 = _mm_mul_ps(_mm_rcp_ps(mVec[0]), _mm_set1_ps(b));
+            __m128 t1 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t2 = _mm_mul_ps(_mm_rcp_ps(mVec[1]), _mm_set1_ps(b));
+            __m128 t3 = BLEND(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_f(t1, t3);
+        }
+        // RCPA
+        UME_FORCE_INLINE SIMDVec_f & rcpa() {
+            mVec[0] = _mm_rcp_ps(mVec[0]);
+            mVec[1] = _mm_rcp_ps(mVec[1]);
+            return *this;
+        }
+        // MRCPA
+        UME_FORCE_INLINE SIMDVec_f & rcpa(SIMDVecMask<8> const & mask) {
+            __m128 t0 = _mm_rcp_ps(mVec[0]);
+            mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t1 = _mm_rcp_ps(mVec[1]);
+            mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // RCPSA
+        UME_FORCE_INLINE SIMDVec_f & rcpa(float b) {
+            mVec[0] = _mm_mul_ps(_mm_rcp_ps(mVec[0]), _mm_set1_ps(b));
+            mVec[1] = _mm_mul_ps(_mm_rcp_ps(mVec[1]), _mm_set1_ps(b));
+            return *this;
+        }
+        // MRCPSA
+        UME_FORCE_INLINE SIMDVec_f & rcpa(SIMDVecMask<8> const & mask, float b) {
+            __m128 t0 = _mm_mul_ps(_mm_rcp_ps(mVec[0]), _mm_set1_ps(b));
+            mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t1 = _mm_mul_ps(_mm_rcp_ps(mVec[1]), _mm_set1_ps(b));
+            mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<8> cmpeq(SIMDVec_f const & b) const {
+            __m128 m0 = _mm_cmpeq_ps(mVec[0], b.mVec[0]);
+            __m128i m1 = _mm_castps_si128(m0);
+            __m128 m2 = _mm_cmpeq_ps(mVec[1], b.mVec[1]);
+            __m128i m3 = _mm_castps_si128(m2);
+            return SIMDVecMask<8>(m1, m3);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator==(SIMDVec_f const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<8> cmpeq(float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 m0 = _mm_cmpeq_ps(mVec[0], t0);
+            __m128i m1 = _mm_castps_si128(m0);
+            __m128 m2 = _mm_cmpeq_ps(mVec[1], t0);
+            __m128i m3 = _mm_castps_si128(m2);
+            return SIMDVecMask<8>(m1, m3);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator== (float b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<8> cmpne(SIMDVec_f const & b) const {
+            __m128 m0 = _mm_cmpneq_ps(mVec[0], b.mVec[0]);
+            __m128i m1 = _mm_castps_si128(m0);
+            __m128 m2 = _mm_cmpneq_ps(mVec[1], b.mVec[1]);
+            __m128i m3 = _mm_castps_si128(m2);
+            return SIMDVecMask<8>(m1, m3);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator!= (SIMDVec_f const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<8> cmpne(float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 m0 = _mm_cmpneq_ps(mVec[0], t0);
+            __m128i m1 = _mm_castps_si128(m0);
+            __m128 m2 = _mm_cmpneq_ps(mVec[1], t0);
+            __m128i m3 = _mm_castps_si128(m2);
+            return SIMDVecMask<8>(m1, m3);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator!= (float b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<8> cmpgt(SIMDVec_f const & b) const {;
+            __m128 m0 = _mm_cmpgt_ps(mVec[0], b.mVec[0]);
+            __m128i m1 = _mm_castps_si128(m0);
+            __m128 m2 = _mm_cmpgt_ps(mVec[1], b.mVec[1]);
+            __m128i m3 = _mm_castps_si128(m2);
+            return SIMDVecMask<8>(m1, m3);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator> (SIMDVec_f const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<8> cmpgt(float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 m0 = _mm_cmpgt_ps(mVec[0], t0);
+            __m128i m1 = _mm_castps_si128(m0);
+            __m128 m2 = _mm_cmpgt_ps(mVec[1], t0);
+            __m128i m3 = _mm_castps_si128(m2);
+            return SIMDVecMask<8>(m1, m3);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator> (float b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<8> cmplt(SIMDVec_f const & b) const {
+            __m128 m0 = _mm_cmplt_ps(mVec[0], b.mVec[0]);
+            __m128i m1 = _mm_castps_si128(m0);
+            __m128 m2 = _mm_cmplt_ps(mVec[1], b.mVec[1]);
+            __m128i m3 = _mm_castps_si128(m2);
+            return SIMDVecMask<8>(m1, m3);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator< (SIMDVec_f const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<8> cmplt(float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 m0 = _mm_cmplt_ps(mVec[0], t0);
+            __m128i m1 = _mm_castps_si128(m0);
+            __m128 m2 = _mm_cmplt_ps(mVec[1], t0);
+            __m128i m3 = _mm_castps_si128(m2);
+            return SIMDVecMask<8>(m1, m3);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator< (float b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<8> cmpge(SIMDVec_f const & b) const {
+            __m128 m0 = _mm_cmpge_ps(mVec[0], b.mVec[0]);
+            __m128i m1 = _mm_castps_si128(m0);
+            __m128 m2 = _mm_cmpge_ps(mVec[1], b.mVec[1]);
+            __m128i m3 = _mm_castps_si128(m2);
+            return SIMDVecMask<8>(m1, m3);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator>= (SIMDVec_f const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<8> cmpge(float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 m0 = _mm_cmpge_ps(mVec[0], t0);
+            __m128i m1 = _mm_castps_si128(m0);
+            __m128 m2 = _mm_cmpge_ps(mVec[1], t0);
+            __m128i m3 = _mm_castps_si128(m2);
+            return SIMDVecMask<8>(m1, m3);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator>= (float b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<8> cmple(SIMDVec_f const & b) const {
+            __m128 m0 = _mm_cmple_ps(mVec[0], b.mVec[0]);
+            __m128i m1 = _mm_castps_si128(m0);
+            __m128 m2 = _mm_cmple_ps(mVec[1], b.mVec[1]);
+            __m128i m3 = _mm_castps_si128(m2);
+            return SIMDVecMask<8>(m1, m3);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator<= (SIMDVec_f const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<8> cmple(float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 m0 = _mm_cmple_ps(mVec[0], t0);
+            __m128i m1 = _mm_castps_si128(m0);
+            __m128 m2 = _mm_cmple_ps(mVec[1], t0);
+            __m128i m3 = _mm_castps_si128(m2);
+            return SIMDVecMask<8>(m1, m3);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator<= (float b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_f const & b) const {
+            __m128 m0 = _mm_cmpeq_ps(mVec[0], b.mVec[0]);
+            __m128 m1 = _mm_cmpeq_ps(mVec[1], b.mVec[1]);
+            return _mm_movemask_ps(_mm_and_ps(m0, m1)) == 0xF;
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 m0 = _mm_cmpeq_ps(mVec[0], t0);
+            __m128 m1 = _mm_cmpeq_ps(mVec[1], t0);
+            return _mm_movemask_ps(_mm_and_ps(m0, m1)) == 0xF;
+        }
+        // UNIQUE
+        UME_FORCE_INLINE bool unique() const {
+            /* alignas(32) int32_t raw[8];
+            _mm_store_si128((__m128i *)raw, mVec);
+            for (unsigned int i = 0; i < 7; i++) {
+            for (unsigned int j = i + 1; j < 8; j++) {
+            if (raw[i] == raw[j]) {
+            return false;
+            }
+            }
+            }*/
+            return true;
+        }
+        // HADD
+        UME_FORCE_INLINE float hadd() const {
+            __m128 t0 = _mm_add_ps(mVec[0], mVec[1]);
+            __m128 t1 = _mm_add_ps(t0, _mm_movehl_ps(t0, t0));
+            __m128 t2 = _mm_add_ps(t1, _mm_shuffle_ps(t1, t1, 0x1));
+            float retval = _mm_cvtss_f32(t2);
+            return retval;
+        }
+        // MHADD
+        UME_FORCE_INLINE float hadd(SIMDVecMask<8> const & mask) const {
+            __m128 t0 = _mm_set1_ps(0.0f);
+            __m128 t1 = BLEND(t0, mVec[0], mask.mMask[0]);
+            __m128 t2 = BLEND(t0, mVec[1], mask.mMask[1]);
+            __m128 t3 = _mm_add_ps(t1, t2);
+            __m128 t4 = _mm_add_ps(t3, _mm_movehl_ps(t3, t3));
+            __m128 t5 = _mm_add_ps(t4, _mm_shuffle_ps(t4, t4, 0x1));
+            float retval = _mm_cvtss_f32(t5);
+            return retval;
+        }
+        // HADDS
+        UME_FORCE_INLINE float hadd(float b) const {
+            __m128 t0 = _mm_add_ps(mVec[0], mVec[1]);
+            __m128 t1 = _mm_add_ps(t0, _mm_movehl_ps(t0, t0));
+            __m128 t2 = _mm_add_ps(t1, _mm_shuffle_ps(t1, t1, 0x1));
+            float retval = _mm_cvtss_f32(t2);
+            return retval + b;
+        }
+        // MHADDS
+        UME_FORCE_INLINE float hadd(SIMDVecMask<8> const & mask, float b) const {
+            __m128 t0 = _mm_set1_ps(0.0f);
+            __m128 t1 = BLEND(t0, mVec[0], mask.mMask[0]);
+            __m128 t2 = BLEND(t0, mVec[1], mask.mMask[1]);
+            __m128 t3 = _mm_add_ps(t1, t2);
+            __m128 t4 = _mm_add_ps(t3, _mm_movehl_ps(t3, t3));
+            __m128 t5 = _mm_add_ps(t4, _mm_shuffle_ps(t4, t4, 0x1));
+            float retval = _mm_cvtss_f32(t5);
+            return retval + b;
+        }
+        // HMUL
+        UME_FORCE_INLINE float hmul() const {
+            __m128 t0 = _mm_mul_ps(mVec[0], mVec[1]);
+            __m128 t1 = _mm_mul_ps(t0, _mm_movehl_ps(t0, t0));
+            __m128 t2 = _mm_mul_ps(t1, _mm_shuffle_ps(t1, t1, 0x1));
+            float retval = _mm_cvtss_f32(t2);
+            return retval;
+        }
+        // MHMUL
+        UME_FORCE_INLINE float hmul(SIMDVecMask<8> const & mask) const {
+            __m128 t0 = _mm_set1_ps(1.0f);
+            __m128 t1 = BLEND(t0, mVec[0], mask.mMask[0]);
+            __m128 t2 = BLEND(t0, mVec[1], mask.mMask[1]);
+            __m128 t3 = _mm_mul_ps(t1, t2);
+            __m128 t4 = _mm_mul_ps(t3, _mm_movehl_ps(t3, t3));
+            __m128 t5 = _mm_mul_ps(t4, _mm_shuffle_ps(t4, t4, 0x1));
+            float retval = _mm_cvtss_f32(t5);
+            return retval;
+        }
+        // HMULS
+        UME_FORCE_INLINE float hmul(float b) const {
+            __m128 t0 = _mm_mul_ps(mVec[0], mVec[1]);
+            __m128 t1 = _mm_mul_ps(t0, _mm_movehl_ps(t0, t0));
+            __m128 t2 = _mm_mul_ps(t1, _mm_shuffle_ps(t1, t1, 0x1));
+            float retval = _mm_cvtss_f32(t2);
+            return retval * b;
+        }
+        // MHMULS
+        UME_FORCE_INLINE float hmul(SIMDVecMask<8> const & mask, float b) const {
+            __m128 t0 = _mm_set1_ps(1.0f);
+            __m128 t1 = BLEND(t0, mVec[0], mask.mMask[0]);
+            __m128 t2 = BLEND(t0, mVec[1], mask.mMask[1]);
+            __m128 t3 = _mm_mul_ps(t1, t2);
+            __m128 t4 = _mm_mul_ps(t3, _mm_movehl_ps(t3, t3));
+            __m128 t5 = _mm_mul_ps(t4, _mm_shuffle_ps(t4, t4, 0x1));
+            float retval = _mm_cvtss_f32(t5);
+            return retval * b;
+        }
+        // FMULADDV
+        UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#ifdef FMA
+            __m128 t0 = _mm_add_ps(_mm_mul_ps(mVec[0], b.mVec[0]), c.mVec[0]);
+            __m128 t1 = _mm_add_ps(_mm_mul_ps(mVec[1], b.mVec[1]), c.mVec[1]);
+#else
+            __m128 t0 = _mm_add_ps(_mm_mul_ps(mVec[0], b.mVec[0]), c.mVec[0]);
+            __m128 t1 = _mm_add_ps(_mm_mul_ps(mVec[1], b.mVec[1]), c.mVec[1]);
+#endif
+            return SIMDVec_f(t0, t1);
+        }
+        // MFMULADDV
+        UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVecMask<8> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#ifdef FMA
+            __m128 t0 = _mm_add_ps(_mm_mul_ps(mVec[0], b.mVec[0]), c.mVec[0]);
+            __m128 t1 = _mm_add_ps(_mm_mul_ps(mVec[1], b.mVec[1]), c.mVec[1]);
+#else
+            __m128 t0 = _mm_add_ps(_mm_mul_ps(mVec[0], b.mVec[0]), c.mVec[0]);
+            __m128 t1 = _mm_add_ps(_mm_mul_ps(mVec[1], b.mVec[1]), c.mVec[1]);
+#endif
+            __m128 t2 = blendv_ps_sse(mVec[0], t0, _mm_castsi128_ps(mask.mMask[0]));
+            __m128 t3 = blendv_ps_sse(mVec[1], t1, _mm_castsi128_ps(mask.mMask[1]));
+            return SIMDVec_f(t2, t3);
+        }
+        // FMULSUBV
+        UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128 t0 = _mm_mul_ps(mVec[0], b.mVec[0]);
+            __m128 t1 = _mm_sub_ps(t0, c.mVec[0]);
+            __m128 t2 = _mm_mul_ps(mVec[1], b.mVec[1]);
+            __m128 t3 = _mm_sub_ps(t2, c.mVec[1]);
+            return SIMDVec_f(t1, t3);
+        }
+        // MFMULSUBV
+        UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVecMask<8> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128 t0 = _mm_mul_ps(mVec[0], b.mVec[0]);
+            __m128 t1 = _mm_sub_ps(t0, c.mVec[0]);
+            __m128 t2 = BLEND(mVec[0], t1, mask.mMask[0]);
+            __m128 t3 = _mm_mul_ps(mVec[1], b.mVec[1]);
+            __m128 t4 = _mm_sub_ps(t3, c.mVec[1]);
+            __m128 t5 = BLEND(mVec[1], t4, mask.mMask[1]);
+            return SIMDVec_f(t2, t5);
+        }
+        // FADDMULV
+        UME_FORCE_INLINE SIMDVec_f faddmul(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128 t0 = _mm_add_ps(mVec[0], b.mVec[0]);
+            __m128 t1 = _mm_mul_ps(t0, c.mVec[0]);
+            __m128 t2 = _mm_add_ps(mVec[1], b.mVec[1]);
+            __m128 t3 = _mm_mul_ps(t2, c.mVec[1]);
+            return SIMDVec_f(t1, t3);
+        }
+        // MFADDMULV
+        UME_FORCE_INLINE SIMDVec_f faddmul(SIMDVecMask<8> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128 t0 = _mm_add_ps(mVec[0], b.mVec[0]);
+            __m128 t1 = _mm_mul_ps(t0, c.mVec[0]);
+            __m128 t2 = BLEND(mVec[0], t1, mask.mMask[0]);
+            __m128 t3 = _mm_add_ps(mVec[1], b.mVec[1]);
+            __m128 t4 = _mm_mul_ps(t3, c.mVec[1]);
+            __m128 t5 = BLEND(mVec[1], t4, mask.mMask[1]);
+            return SIMDVec_f(t2, t5);
+        }
+        // FSUBMULV
+        UME_FORCE_INLINE SIMDVec_f fsubmul(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128 t0 = _mm_sub_ps(mVec[0], b.mVec[0]);
+            __m128 t1 = _mm_mul_ps(t0, c.mVec[0]);
+            __m128 t2 = _mm_sub_ps(mVec[1], b.mVec[1]);
+            __m128 t3 = _mm_mul_ps(t2, c.mVec[1]);
+            return SIMDVec_f(t1, t3);
+        }
+        // MFSUBMULV
+        UME_FORCE_INLINE SIMDVec_f fsubmul(SIMDVecMask<8> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            __m128 t0 = _mm_sub_ps(mVec[0], b.mVec[0]);
+            __m128 t1 = _mm_mul_ps(t0, c.mVec[0]);
+            __m128 t2 = BLEND(mVec[0], t1, mask.mMask[0]);
+            __m128 t3 = _mm_sub_ps(mVec[1], b.mVec[1]);
+            __m128 t4 = _mm_mul_ps(t3, c.mVec[1]);
+            __m128 t5 = BLEND(mVec[1], t4, mask.mMask[1]);
+            return SIMDVec_f(t2, t5);
+        }
+
+        // MAXV
+        UME_FORCE_INLINE SIMDVec_f max(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_max_ps(mVec[0], b.mVec[0]);
+            __m128 t1 = _mm_max_ps(mVec[1], b.mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // MMAXV
+        UME_FORCE_INLINE SIMDVec_f max(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = _mm_max_ps(mVec[0], b.mVec[0]);
+            __m128 t1 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t2 = _mm_max_ps(mVec[1], b.mVec[1]);
+            __m128 t3 = BLEND(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_f(t1, t3);
+        }
+        // MAXS
+        UME_FORCE_INLINE SIMDVec_f max(float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_max_ps(mVec[0], t0);
+            __m128 t2 = _mm_max_ps(mVec[1], t0);
+            return SIMDVec_f(t1, t2);
+        }
+        // MMAXS
+        UME_FORCE_INLINE SIMDVec_f max(SIMDVecMask<8> const & mask, float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_max_ps(mVec[0], t0);
+            __m128 t2 = BLEND(mVec[0], t1, mask.mMask[0]);
+            __m128 t3 = _mm_max_ps(mVec[1], t0);
+            __m128 t4 = BLEND(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_f(t2, t4);
+        }
+        // MAXVA
+        UME_FORCE_INLINE SIMDVec_f & maxa(SIMDVec_f const & b) {
+            mVec[0] = _mm_max_ps(mVec[0], b.mVec[0]);
+            mVec[1] = _mm_max_ps(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        // MMAXVA
+        UME_FORCE_INLINE SIMDVec_f & maxa(SIMDVecMask<8> const & mask, SIMDVec_f const & b) {
+            __m128 t0 = _mm_max_ps(mVec[0], b.mVec[0]);
+            mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t1 = _mm_max_ps(mVec[1], b.mVec[1]);
+            mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // MAXSA
+        UME_FORCE_INLINE SIMDVec_f & maxa(float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            mVec[0] = _mm_max_ps(mVec[0], t0);
+            mVec[1] = _mm_max_ps(mVec[1], t0);
+            return *this;
+        }
+        // MMAXSA
+        UME_FORCE_INLINE SIMDVec_f & maxa(SIMDVecMask<8> const & mask, float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_max_ps(mVec[0], t0);
+            mVec[0] = BLEND(mVec[0], t1, mask.mMask[0]);
+            __m128 t2 = _mm_max_ps(mVec[1], t0);
+            mVec[1] = BLEND(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // MINV
+        UME_FORCE_INLINE SIMDVec_f min(SIMDVec_f const & b) const {
+            __m128 t0 = _mm_min_ps(mVec[0], b.mVec[0]);
+            __m128 t1 = _mm_min_ps(mVec[1], b.mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // MMINV
+        UME_FORCE_INLINE SIMDVec_f min(SIMDVecMask<8> const & mask, SIMDVec_f const & b) const {
+            __m128 t0 = _mm_min_ps(mVec[0], b.mVec[0]);
+            __m128 t1 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t2 = _mm_min_ps(mVec[1], b.mVec[1]);
+            __m128 t3 = BLEND(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_f(t1, t3);
+        }
+        // MINS
+        UME_FORCE_INLINE SIMDVec_f min(float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_min_ps(mVec[0], t0);
+            __m128 t2 = _mm_min_ps(mVec[1], t0);
+            return SIMDVec_f(t1, t2);
+        }
+        // MMINS
+        UME_FORCE_INLINE SIMDVec_f min(SIMDVecMask<8> const & mask, float b) const {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_min_ps(mVec[0], t0);
+            __m128 t2 = BLEND(mVec[0], t1, mask.mMask[0]);
+            __m128 t3 = _mm_min_ps(mVec[1], t0);
+            __m128 t4 = BLEND(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_f(t2, t4);
+        }
+        // MINVA
+        UME_FORCE_INLINE SIMDVec_f & mina(SIMDVec_f const & b) {
+            mVec[0] = _mm_min_ps(mVec[0], b.mVec[0]);
+            mVec[1] = _mm_min_ps(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        // MMINVA
+        UME_FORCE_INLINE SIMDVec_f & mina(SIMDVecMask<8> const & mask, SIMDVec_f const & b) {
+            __m128 t0 = _mm_min_ps(mVec[0], b.mVec[0]);
+            mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t1 = _mm_min_ps(mVec[1], b.mVec[1]);
+            mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // MINSA
+        UME_FORCE_INLINE SIMDVec_f & mina(float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            mVec[0] = _mm_min_ps(mVec[0], t0);
+            mVec[1] = _mm_min_ps(mVec[1], t0);
+            return *this;
+        }
+        // MMINSA
+        UME_FORCE_INLINE SIMDVec_f & mina(SIMDVecMask<8> const & mask, float b) {
+            __m128 t0 = _mm_set1_ps(b);
+            __m128 t1 = _mm_min_ps(mVec[0], t0);
+            mVec[0] = BLEND(mVec[0], t1, mask.mMask[0]);
+            __m128 t2 = _mm_min_ps(mVec[1], t0);
+            mVec[1] = BLEND(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // HMAX
+        UME_FORCE_INLINE float hmax() const {
+            __m128 t0 = _mm_max_ps(mVec[0], mVec[1]);
+            __m128 t1 = _mm_max_ps(t0, _mm_movehl_ps(t0, t0));
+            __m128 t2 = _mm_max_ps(t1, _mm_shuffle_ps(t1, t1, 0x1));
+            float retval = _mm_cvtss_f32(t2);
+            return retval;
+        }
+        // MHMAX
+        UME_FORCE_INLINE float hmax(SIMDVecMask<8> const & mask) const {
+            __m128 t0 = _mm_set1_ps(std::numeric_limits<float>::lowest());
+            __m128 t1 = BLEND(t0, mVec[0], mask.mMask[0]);
+            __m128 t2 = BLEND(t0, mVec[1], mask.mMask[1]);
+            __m128 t3 = _mm_max_ps(t1, t2);
+            __m128 t4 = _mm_max_ps(t3, _mm_movehl_ps(t3, t3));
+            __m128 t5 = _mm_max_ps(t4, _mm_shuffle_ps(t4, t4, 0x1));
+            float retval = _mm_cvtss_f32(t5);
+            return retval;
+        }
+        // IMAX
+        // MIMAX
+        // HMIN
+        UME_FORCE_INLINE float hmin() const {
+            __m128 t0 = _mm_min_ps(mVec[0], mVec[1]);
+            __m128 t1 = _mm_min_ps(t0, _mm_movehl_ps(t0, t0));
+            __m128 t2 = _mm_min_ps(t1, _mm_shuffle_ps(t1, t1, 0x1));
+            float retval = _mm_cvtss_f32(t2);
+            return retval;
+        }
+        // MHMIN
+        UME_FORCE_INLINE float hmin(SIMDVecMask<8> const & mask) const {
+            __m128 t0 = _mm_set1_ps(std::numeric_limits<float>::max());
+            __m128 t1 = BLEND(t0, mVec[0], mask.mMask[0]);
+            __m128 t2 = BLEND(t0, mVec[1], mask.mMask[1]);
+            __m128 t3 = _mm_min_ps(t1, t2);
+            __m128 t4 = _mm_min_ps(t3, _mm_movehl_ps(t3, t3));
+            __m128 t5 = _mm_min_ps(t4, _mm_shuffle_ps(t4, t4, 0x1));
+            float retval = _mm_cvtss_f32(t5);
+            return retval;
+        }
+        // IMIN
+        // MIMIN
+
+        // GATHERS
+        UME_FORCE_INLINE SIMDVec_f & gather(float const * baseAddr, uint32_t const * indices) {
+            __m128i t0 = _mm_load_si128((__m128i*)indices);
+            mVec[0] = i32gather_ps_sse((const float *)baseAddr, t0);
+            __m128i t1 = _mm_load_si128((__m128i*)(indices + 4));
+            mVec[1] = i32gather_ps_sse((const float *)baseAddr, t1);
+            return *this;
+        }
+        // MGATHERS
+        UME_FORCE_INLINE SIMDVec_f & gather(SIMDVecMask<8> const & mask, float const * baseAddr, uint32_t const * indices) {
+            __m128i t0 = _mm_loadu_si128((__m128i*)indices);
+            __m128 t1 = i32gather_ps_sse((const float *)baseAddr, t0);
+            mVec[0] = BLEND(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = _mm_loadu_si128((__m128i*)(indices + 4));
+            __m128 t3 = i32gather_ps_sse((const float *)baseAddr, t2);
+            mVec[1] = BLEND(mVec[1], t3, mask.mMask[1]);
+            return *this;
+        }
+        // GATHERV
+        UME_FORCE_INLINE SIMDVec_f & gather(float const * baseAddr, SIMDVec_u<uint32_t, 8> const & indices) {
+            mVec[0] = i32gather_ps_sse((const float *)baseAddr, indices.mVec[0]);
+            mVec[1] = i32gather_ps_sse((const float *)baseAddr, indices.mVec[1]);
+            return *this;
+        }
+        // MGATHERV
+        UME_FORCE_INLINE SIMDVec_f & gather(SIMDVecMask<8> const & mask, float const * baseAddr, SIMDVec_u<uint32_t, 8> const & indices) {
+            __m128 t0 = i32gather_ps_sse((const float *)baseAddr, indices.mVec[0]);
+            mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t1 = i32gather_ps_sse((const float *)baseAddr, indices.mVec[1]);
+            mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // SCATTERS
+        UME_FORCE_INLINE float* scatter(float* baseAddr, uint32_t* indices) const {
+            scatterLanes(baseAddr, mVec[0], _mm_loadu_si128((__m128i*)indices), 0xF);
+            scatterLanes(baseAddr, mVec[1], _mm_loadu_si128((__m128i*)(indices + 4)), 0xF);
+            return baseAddr;
+        }
+        // MSCATTERS
+        UME_FORCE_INLINE float* scatter(SIMDVecMask<8> const & mask, float* baseAddr, uint32_t* indices) const {
+            scatterLanes(baseAddr, mVec[0], _mm_loadu_si128((__m128i*)indices), _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[0])));
+            scatterLanes(baseAddr, mVec[1], _mm_loadu_si128((__m128i*)(indices + 4)), _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[1])));
+            return baseAddr;
+        }
+        // SCATTERV
+        UME_FORCE_INLINE float* scatter(float* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
+            scatterLanes(baseAddr, mVec[0], indices.mVec[0], 0xF);
+            scatterLanes(baseAddr, mVec[1], indices.mVec[1], 0xF);
+            return baseAddr;
+        }
+        // MSCATTERV
+        UME_FORCE_INLINE float* scatter(SIMDVecMask<8> const & mask, float* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
+            scatterLanes(baseAddr, mVec[0], indices.mVec[0], _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[0])));
+            scatterLanes(baseAddr, mVec[1], indices.mVec[1], _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[1])));
+            return baseAddr;
+        }
+        // SCATTERADDV
+        UME_FORCE_INLINE float* scatteradd(float* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
+            scatterAddLanes(baseAddr, mVec[0], indices.mVec[0], 0xF);
+            scatterAddLanes(baseAddr, mVec[1], indices.mVec[1], 0xF);
+            return baseAddr;
+        }
+        // MSCATTERADDV
+        UME_FORCE_INLINE float* scatteradd(SIMDVecMask<8> const & mask, float* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
+            scatterAddLanes(baseAddr, mVec[0], indices.mVec[0], _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[0])));
+            scatterAddLanes(baseAddr, mVec[1], indices.mVec[1], _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[1])));
+            return baseAddr;
+        }
+        // NEG
+        UME_FORCE_INLINE SIMDVec_f neg() const {
+            __m128 t0 = _mm_sub_ps(_mm_set1_ps(0.0f), mVec[0]);
+            __m128 t1 = _mm_sub_ps(_mm_set1_ps(0.0f), mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator- () const {
+            return neg();
+        }
+        // MNEG
+        UME_FORCE_INLINE SIMDVec_f neg(SIMDVecMask<8> const & mask) const {
+            __m128 t0 = _mm_sub_ps(_mm_set1_ps(0.0f), mVec[0]);
+            __m128 t1 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t2 = _mm_sub_ps(_mm_set1_ps(0.0f), mVec[1]);
+            __m128 t3 = BLEND(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_f(t1, t3);
+        }
+        // NEGA
+        UME_FORCE_INLINE SIMDVec_f & nega() {
+            mVec[0] = _mm_sub_ps(_mm_set1_ps(0.0f), mVec[0]);
+            mVec[1] = _mm_sub_ps(_mm_set1_ps(0.0f), mVec[1]);
+            return *this;
+        }
+        // MNEGA
+        UME_FORCE_INLINE SIMDVec_f & nega(SIMDVecMask<8> const & mask) {
+            __m128 t0 = _mm_sub_ps(_mm_set1_ps(0.0f), mVec[0]);
+            mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t1 = _mm_sub_ps(_mm_set1_ps(0.0f), mVec[1]);
+            mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // ABS
+        UME_FORCE_INLINE SIMDVec_f abs() const {
+            __m128 t0 = _mm_set1_ps(0.0f);
+            __m128 t1 = _mm_cmplt_ps(mVec[0], t0);
+            __m128 t2 = _mm_sub_ps(t0, mVec[0]);
+            __m128 t3 = blendv_ps_sse(mVec[0], t2, t1);
+            __m128 t4 = _mm_cmplt_ps(mVec[1], t0);
+            __m128 t5 = _mm_sub_ps(t0, mVec[1]);
+            __m128 t6 = blendv_ps_sse(mVec[1], t5, t4);
+            return SIMDVec_f(t3, t6);
+        }
+        // MABS
+        UME_FORCE_INLINE SIMDVec_f abs(SIMDVecMask<8> const & mask) const {
+            __m128 t0 = _mm_set1_ps(0.0f);
+            __m128 t1 = _mm_cmplt_ps(mVec[0], t0);
+            __m128 t2 = _mm_and_ps(t1, _mm_castsi128_ps(mask.mMask[0]));
+            __m128 t3 = _mm_sub_ps(t0, mVec[0]);
+            __m128 t4 = blendv_ps_sse(mVec[0], t3, t2);
+            __m128 t5 = _mm_cmplt_ps(mVec[1], t0);
+            __m128 t6 = _mm_and_ps(t5, _mm_castsi128_ps(mask.mMask[1]));
+            __m128 t7 = _mm_sub_ps(t0, mVec[1]);
+            __m128 t8 = blendv_ps_sse(mVec[1], t7, t6);
+            return SIMDVec_f(t4, t8);
+        }
+        // ABSA
+        UME_FORCE_INLINE SIMDVec_f & absa() {
+            __m128 t0 = _mm_set1_ps(0.0f);
+            __m128 t1 = _mm_cmplt_ps(mVec[0], t0);
+            __m128 t2 = _mm_sub_ps(t0, mVec[0]);
+            mVec[0] = blendv_ps_sse(mVec[0], t2, t1);
+            __m128 t4 = _mm_cmplt_ps(mVec[1], t0);
+            __m128 t5 = _mm_sub_ps(t0, mVec[1]);
+            mVec[1] = blendv_ps_sse(mVec[1], t5, t4);
+            return *this;
+        }
+        // MABSA
+        UME_FORCE_INLINE SIMDVec_f & absa(SIMDVecMask<8> const & mask) {
+            __m128 t0 = _mm_set1_ps(0.0f);
+            __m128 t1 = _mm_cmplt_ps(mVec[0], t0);
+            __m128 t2 = _mm_and_ps(t1, _mm_castsi128_ps(mask.mMask[0]));
+            __m128 t3 = _mm_sub_ps(t0, mVec[0]);
+            mVec[0] = blendv_ps_sse(mVec[0], t3, t2);
+            __m128 t5 = _mm_cmplt_ps(mVec[1], t0);
+            __m128 t6 = _mm_and_ps(t5, _mm_castsi128_ps(mask.mMask[1]));
+            __m128 t7 = _mm_sub_ps(t0, mVec[1]);
+            mVec[1] = blendv_ps_sse(mVec[1], t7, t6);
+            return *this;
+        }
+        // CMPEQRV
+        // CMPEQRS
+
+        // SQR
+        UME_FORCE_INLINE SIMDVec_f sqr() const {
+            __m128 t0 = _mm_mul_ps(mVec[0], mVec[0]);
+            __m128 t1 = _mm_mul_ps(mVec[1], mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // MSQR
+        UME_FORCE_INLINE SIMDVec_f sqr(SIMDVecMask<8> const & mask) const {
+            __m128 t0 = _mm_mul_ps(mVec[0], mVec[0]);
+            __m128 t1 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t2 = _mm_mul_ps(mVec[1], mVec[1]);
+            __m128 t3 = BLEND(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_f(t1, t3);
+        }
+        // SQRA
+        UME_FORCE_INLINE SIMDVec_f & sqra() {
+            mVec[0] = _mm_mul_ps(mVec[0], mVec[0]);
+            mVec[1] = _mm_mul_ps(mVec[1], mVec[1]);
+            return *this;
+        }
+        // MSQRA
+        UME_FORCE_INLINE SIMDVec_f & sqra(SIMDVecMask<8> const & mask) {
+            __m128 t0 = _mm_mul_ps(mVec[0], mVec[0]);
+            mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t1 = _mm_mul_ps(mVec[1], mVec[1]);
+            mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // SQRT
+        UME_FORCE_INLINE SIMDVec_f sqrt() const {
+            __m128 t0 = _mm_sqrt_ps(mVec[0]);
+            __m128 t1 = _mm_sqrt_ps(mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // MSQRT
+        UME_FORCE_INLINE SIMDVec_f sqrt(SIMDVecMask<8> const & mask) const {
+            __m128 t0 = _mm_sqrt_ps(mVec[0]);
+            __m128 t1 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t2 = _mm_sqrt_ps(mVec[1]);
+            __m128 t3 = BLEND(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_f(t1, t3);
+        }
+        // SQRTA
+        UME_FORCE_INLINE SIMDVec_f & sqrta() {
+            mVec[0] = _mm_sqrt_ps(mVec[0]);
+            mVec[1] = _mm_sqrt_ps(mVec[1]);
+            return *this;
+        }
+        // MSQRTA
+        UME_FORCE_INLINE SIMDVec_f & sqrta(SIMDVecMask<8> const & mask) {
+            __m128 t0 = _mm_sqrt_ps(mVec[0]);
+            mVec[0] = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t1 = _mm_sqrt_ps(mVec[1]);
+            mVec[1] = BLEND(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // POWV
+        // MPOWV
+        // POWS
+        // MPOWS
+        // ROUND
+        UME_FORCE_INLINE SIMDVec_f round() const {
+            __m128 t0 = round_ps_sse(mVec[0]);
+            __m128 t1 = round_ps_sse(mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // MROUND
+        UME_FORCE_INLINE SIMDVec_f round(SIMDVecMask<8> const & mask) const {
+            __m128 t0 = round_ps_sse(mVec[0]);
+            __m128 t1 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t2 = round_ps_sse(mVec[1]);
+            __m128 t3 = BLEND(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_f(t1, t3);
+        }
+        // TRUNC
+        UME_FORCE_INLINE SIMDVec_i<int32_t, 8> trunc() const {
+            __m128i t0 = _mm_cvttps_epi32(mVec[0]);
+            __m128i t1 = _mm_cvttps_epi32(mVec[1]);
+            return SIMDVec_i<int32_t, 8>(t0, t1);
+        }
+        // MTRUNC
+        UME_FORCE_INLINE SIMDVec_i<int32_t, 8> trunc(SIMDVecMask<8> const & mask) const {
+            __m128  t0 = _mm_setzero_ps();
+            __m128  t1 = BLEND(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = _mm_cvttps_epi32(t1);
+            __m128  t3 = BLEND(t0, mVec[1], mask.mMask[1]);
+            __m128i t4 = _mm_cvttps_epi32(t3);
+            return SIMDVec_i<int32_t, 8>(t2, t4);
+        }
+        // FLOOR
+        UME_FORCE_INLINE SIMDVec_f floor() const {
+            __m128 t0 = floor_ps_sse(mVec[0]);
+            __m128 t1 = floor_ps_sse(mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // MFLOOR
+        UME_FORCE_INLINE SIMDVec_f floor(SIMDVecMask<8> const & mask) const {
+            __m128 t0 = floor_ps_sse(mVec[0]);
+            __m128 t1 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t2 = floor_ps_sse(mVec[1]);
+            __m128 t3 = BLEND(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_f(t1, t3);
+        }
+        // CEIL
+        UME_FORCE_INLINE SIMDVec_f ceil() const {
+            __m128 t0 = ceil_ps_sse(mVec[0]);
+            __m128 t1 = ceil_ps_sse(mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // MCEIL
+        UME_FORCE_INLINE SIMDVec_f ceil(SIMDVecMask<8> const & mask) const {
+            __m128 t0 = ceil_ps_sse(mVec[0]);
+            __m128 t1 = BLEND(mVec[0], t0, mask.mMask[0]);
+            __m128 t2 = ceil_ps_sse(mVec[1]);
+            __m128 t3 = BLEND(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_f(t1, t3);
+        }
+        // ISFIN
+        UME_FORCE_INLINE SIMDVecMask<8> isfin() const {
+            __m128i t0 = _mm_castps_si128(finiteLanes(mVec[0]));
+            __m128i t1 = _mm_castps_si128(finiteLanes(mVec[1]));
+            return SIMDVecMask<8>(t0, t1);
+        }
+        // ISINF
+        UME_FORCE_INLINE SIMDVecMask<8> isinf() const {
+            __m128i t0 = _mm_castps_si128(infiniteLanes(mVec[0]));
+            __m128i t1 = _mm_castps_si128(infiniteLanes(mVec[1]));
+            return SIMDVecMask<8>(t0, t1);
+        }
+        // ISAN
+        UME_FORCE_INLINE SIMDVecMask<8> isan() const {
+            __m128i t0 = _mm_castps_si128(finiteLanes(mVec[0]));
+            __m128i t1 = _mm_castps_si128(finiteLanes(mVec[1]));
+            return SIMDVecMask<8>(t0, t1);
+        }
+        // ISNAN
+        UME_FORCE_INLINE SIMDVecMask<8> isnan() const {
+            __m128i t0 = _mm_castps_si128(nanLanes(mVec[0]));
+            __m128i t1 = _mm_castps_si128(nanLanes(mVec[1]));
+            return SIMDVecMask<8>(t0, t1);
+        }
+        // ISSUB
+        UME_FORCE_INLINE SIMDVecMask<8> issub() const {
+            __m128i t0 = _mm_castps_si128(subnormalLanes(mVec[0]));
+            __m128i t1 = _mm_castps_si128(subnormalLanes(mVec[1]));
+            return SIMDVecMask<8>(t0, t1);
+        }
+        // ISZERO
+        UME_FORCE_INLINE SIMDVecMask<8> iszero() const {
+            __m128i t0 = _mm_castps_si128(zeroLanes(mVec[0]));
+            __m128i t1 = _mm_castps_si128(zeroLanes(mVec[1]));
+            return SIMDVecMask<8>(t0, t1);
+        }
+        // ISZEROSUB
+        UME_FORCE_INLINE SIMDVecMask<8> iszerosub() const {
+            __m128i t0 = _mm_castps_si128(zeroOrSubnormalLanes(mVec[0]));
+            __m128i t1 = _mm_castps_si128(zeroOrSubnormalLanes(mVec[1]));
+            return SIMDVecMask<8>(t0, t1);
+        }
+        // EXP
+        UME_FORCE_INLINE SIMDVec_f exp() const {
+#if defined(UME_USE_SVML)
+            __m128 t0 = _mm_exp_ps(mVec[0]);
+            __m128 t1 = _mm_exp_ps(mVec[1]);
+            return SIMDVec_f(t0, t1);
+#else
+            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 8>>(*this);
+#endif
+        }
+        // MEXP
+        UME_FORCE_INLINE SIMDVec_f exp(SIMDVecMask<8> const & mask) const {
+            return VECTOR_EMULATION::expf<SIMDVec_f, SIMDVec_u<uint32_t, 8>, SIMDVecMask<8>>(mask, *this);
+        }
+        // LOG
+        UME_FORCE_INLINE SIMDVec_f log() const {
+            // Evaluate the SIMDVec_f<float, 4> kernel on each register.
+            __m128 t0 = SIMDVec_f<float, 4>(mVec[0]).log().mVec;
+            __m128 t1 = SIMDVec_f<float, 4>(mVec[1]).log().mVec;
+            return SIMDVec_f(t0, t1);
+        }
+        // MLOG
+        UME_FORCE_INLINE SIMDVec_f log(SIMDVecMask<8> const & mask) const {
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, log());
+            return t0;
+        }
+        // LOG2
+        // MLOG2
+        // LOG10
+        // MLOG10
+        // SIN
+        UME_FORCE_INLINE SIMDVec_f sin() const {
+            __m128 t0 = SIMDVec_f<float, 4>(mVec[0]).sin().mVec;
+            __m128 t1 = SIMDVec_f<float, 4>(mVec[1]).sin().mVec;
+            return SIMDVec_f(t0, t1);
+        }
+        // MSIN
+        UME_FORCE_INLINE SIMDVec_f sin(SIMDVecMask<8> const & mask) const {
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, sin());
+            return t0;
+        }
+        // COS
+        UME_FORCE_INLINE SIMDVec_f cos() const {
+            __m128 t0 = SIMDVec_f<float, 4>(mVec[0]).cos().mVec;
+            __m128 t1 = SIMDVec_f<float, 4>(mVec[1]).cos().mVec;
+            return SIMDVec_f(t0, t1);
+        }
+        // MCOS
+        UME_FORCE_INLINE SIMDVec_f cos(SIMDVecMask<8> const & mask) const {
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, cos());
+            return t0;
+        }
+        // SINCOS
+        UME_FORCE_INLINE void sincos(SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            SIMDVec_f<float, 4> t0, t1;
+            SIMDVec_f<float, 4>(mVec[0]).sincos(t0, t1);
+            sinvec.mVec[0] = t0.mVec;
+            cosvec.mVec[0] = t1.mVec;
+            SIMDVec_f<float, 4>(mVec[1]).sincos(t0, t1);
+            sinvec.mVec[1] = t0.mVec;
+            cosvec.mVec[1] = t1.mVec;
+        }
+        // MSINCOS
+        UME_FORCE_INLINE void sincos(SIMDVecMask<8> const & mask, SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            SIMDVec_f t0, t1;
+            sincos(t0, t1);
+            sinvec = *this;
+            cosvec = *this;
+            sinvec.assign(mask, t0);
+            cosvec.assign(mask, t1);
+        }
+        // TAN
+        // MTAN
+        // CTAN
+        // MCTAN
+
+        // PACK
+        UME_FORCE_INLINE SIMDVec_f & pack(SIMDVec_f<float, 4> const & a, SIMDVec_f<float, 4> const & b) {
+            mVec[0] = a.mVec;
+            mVec[1] = b.mVec;
+            return *this;
+        }
+        // PACKLO
+        UME_FORCE_INLINE SIMDVec_f & packlo(SIMDVec_f<float, 4> const & a) {
+            mVec[0] = a.mVec;
+            return *this;
+        }
+        // PACKHI
+        UME_FORCE_INLINE SIMDVec_f & packhi(SIMDVec_f<float, 4> const & b) {
+            mVec[1] = b.mVec;
+            return *this;
+        }
+        // UNPACK
+        UME_FORCE_INLINE void unpack(SIMDVec_f<float, 4> & a, SIMDVec_f<float, 4> & b) const {
+            a.mVec = mVec[0];
+            b.mVec = mVec[1];
+        }
+        // UNPACKLO
+        UME_FORCE_INLINE SIMDVec_f<float, 4> unpacklo() const {
+            return SIMDVec_f<float, 4>(mVec[0]);
+        }
+        // UNPACKHI
+        UME_FORCE_INLINE SIMDVec_f<float, 4> unpackhi() const {
+            return SIMDVec_f<float, 4>(mVec[1]);
+        }
+
+        // PROMOTE
+        UME_FORCE_INLINE operator SIMDVec_f<double, 8>() const;
+        // DEGRADE
+        // -
+
+        // FTOU
+        UME_FORCE_INLINE operator SIMDVec_u<uint32_t, 8>() const;
+        // FTOI
+        UME_FORCE_INLINE operator SIMDVec_i<int32_t, 8>() const;
+    };
+}
+}
+
+#undef BLEND
+
+#endif
@@ -0,0 +1,1291 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_FLOAT64_4_H_
+#define UME_SIMD_VEC_FLOAT64_4_H_
+
+#include <type_traits>
+#include "../../../UMESimdInterface.h"
+#include <immintrin.h>
+
+
+#define BLEND_LO(a_128d, b_128d, mask_128i) \
+    blendv_pd_sse( \
+    a_128d, \
+    b_128d, \
+    _mm_castsi128_pd(_mm_unpacklo_epi32(mask_128i, mask_128i)))
+
+#define BLEND_HI(a_128d, b_128d, mask_128i) \
+    blendv_pd_sse( \
+    a_128d, \
+    b_128d, \
+    _mm_castsi128_pd(_mm_unpackhi_epi32(mask_128i, mask_128i)))
+
+namespace UME {
+namespace SIMD {
+
+    template<>
+    class SIMDVec_f<double, 4> :
+        public SIMDVecFloatInterface<
+            SIMDVec_f<double, 4>,
+            SIMDVec_u<uint64_t, 4>,
+            SIMDVec_i<int64_t, 4>,
+            double,
+            4,
+            uint64_t,
+            int64_t,
+            SIMDVecMask<4>, // Using non-standard mask!
+            SIMDSwizzle<4>> ,
+        public SIMDVecPackableInterface<
+            SIMDVec_f<double, 4>,
+            SIMDVec_f<double, 2 >>
+    {
+        friend class SIMDVec_u<uint64_t, 4>;
+        friend class SIMDVec_i<int64_t, 4>;
+        friend class SIMDVec_f<float, 4>;
+
+        friend class SIMDVec_f<double, 8>;
+    private:
+        __m128d mVec[2];
+
+        UME_FORCE_INLINE SIMDVec_f(__m128d const & x0, __m128d const & x1) {
+            this->mVec[0] = x0;
+            this->mVec[1] = x1;
+        }
+
+        // Lane classification kernels used by ISFIN..ISZEROSUB. Lanes for which
+        // the predicate holds are set to all ones.
+        static UME_FORCE_INLINE __m128d absLanes(__m128d const & a) {
+            return _mm_and_pd(a, _mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFFLL)));
+        }
+        static UME_FORCE_INLINE __m128d finiteLanes(__m128d const & a) {
+            __m128d t0 = _mm_set1_pd(std::numeric_limits<double>::infinity());
+            return _mm_cmplt_pd(absLanes(a), t0);
+        }
+        static UME_FORCE_INLINE __m128d infiniteLanes(__m128d const & a) {
+            __m128d t0 = _mm_set1_pd(std::numeric_limits<double>::infinity());
+            return _mm_cmpeq_pd(absLanes(a), t0);
+        }
+        static UME_FORCE_INLINE __m128d nanLanes(__m128d const & a) {
+            return _mm_cmpunord_pd(a, a);
+        }
+        static UME_FORCE_INLINE __m128d zeroLanes(__m128d const & a) {
+            return _mm_cmpeq_pd(a, _mm_setzero_pd());
+        }
+        static UME_FORCE_INLINE __m128d zeroOrSubnormalLanes(__m128d const & a) {
+            __m128d t0 = _mm_set1_pd(std::numeric_limits<double>::min());
+            return _mm_cmplt_pd(absLanes(a), t0);
+        }
+        static UME_FORCE_INLINE __m128d subnormalLanes(__m128d const & a) {
+            return _mm_andnot_pd(zeroLanes(a), zeroOrSubnormalLanes(a));
+        }
+        // Packs two 64-bit lane masks into the 32-bit lane layout used by masks.
+        static UME_FORCE_INLINE __m128i packLanes(__m128d const & a, __m128d const & b) {
+            return _mm_castps_si128(_mm_shuffle_ps(_mm_castpd_ps(a), _mm_castpd_ps(b), 0x88));
+        }
+    public:
+
+        // ZERO-CONSTR - Zero element constructor 
+        UME_FORCE_INLINE SIMDVec_f() {}
+
+        // SET-CONSTR  - One element constructor
+        UME_FORCE_INLINE SIMDVec_f(double d) {
+            mVec[0] = _mm_set1_pd(d);
+            mVec[1] = _mm_set1_pd(d);
+        }
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_f(
+            T i, 
+            typename std::enable_if< std::is_fundamental<T>::value && 
+                                    !std::is_same<T, double>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_f(static_cast<double>(i)) {}
+
+        // LOAD-CONSTR - Construct by loading from memory
+        UME_FORCE_INLINE explicit SIMDVec_f(const double *p) { this->load(p); }
+
+        // FULL-CONSTR - constructor with VEC_LEN scalar element 
+        UME_FORCE_INLINE SIMDVec_f(double d0, double d1, double d2, double d3) {
+            mVec[0] = _mm_setr_pd(d0, d1);
+            mVec[1] = _mm_setr_pd(d2, d3);
+        }
+
+        // EXTRACT
+        UME_FORCE_INLINE double extract(uint32_t index) const {
+            //UME_PERFORMANCE_UNOPTIMAL_WARNING();
+            alignas(16) double raw[2];
+
+            if (index < 2) {
+                _mm_store_pd(raw, mVec[0]);
+                return raw[index];
+            }
+            else {
+                _mm_store_pd(raw, mVec[1]);
+                return raw[index - 2];
+            }
+        }
+        UME_FORCE_INLINE double operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_f & insert(uint32_t index, double value) {
+            //UME_PERFORMANCE_UNOPTIMAL_WARNING();
+            alignas(16) double raw[2];
+            if (index < 2) {
+                _mm_store_pd(raw, mVec[0]);
+                raw[index] = value;
+                mVec[0] = _mm_load_pd(raw);
+            }
+            else {
+                _mm_store_pd(raw, mVec[1]);
+                raw[index - 2] = value;
+                mVec[1] = _mm_load_pd(raw);
+            }
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_f, double> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_f, double>(index, static_cast<SIMDVec_f &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_f, double, SIMDVecMask<4>> operator() (SIMDVecMask<4> const & mask) {
+            return IntermediateMask<SIMDVec_f, double, SIMDVecMask<4>>(mask, static_cast<SIMDVec_f &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_f, double, SIMDVecMask<4>> operator[] (SIMDVecMask<4> const & mask) {
+            return IntermediateMask<SIMDVec_f, double, SIMDVecMask<4>>(mask, static_cast<SIMDVec_f &>(*this));
+        }
+#endif
+
+        // ****************************************************************************************
+        // Overloading Interface functions starts here!
+        // ****************************************************************************************
+
+        //(Initialization)
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_f & assign(SIMDVec_f const & b) {
+            mVec[0] = b.mVec[0];
+            mVec[1] = b.mVec[1];
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator= (SIMDVec_f const & b) {
+            return assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_f & assign(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            mVec[0] = BLEND_LO(mVec[0], b.mVec[0], mask.mMask);
+            mVec[1] = BLEND_HI(mVec[1], b.mVec[1], mask.mMask);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_f & assign(double b) {
+            mVec[0] = _mm_set1_pd(b);
+            mVec[1] = _mm_set1_pd(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator= (double b) {
+            return assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_f & assign(SIMDVecMask<4> const & mask, double b) {
+            mVec[0] = BLEND_LO(mVec[0], _mm_set1_pd(b), mask.mMask);
+            mVec[1] = BLEND_HI(mVec[1], _mm_set1_pd(b), mask.mMask);
+            return *this;
+        }
+
+        //(Memory access)
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_f & load(double const * p) {
+            mVec[0] = _mm_loadu_pd(p);
+            mVec[1] = _mm_loadu_pd(p + 2);
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<4> const & mask, double const * p) {
+            __m128d t0 = _mm_loadu_pd(p);
+            __m128d t1 = _mm_loadu_pd(p + 2);
+            mVec[0] = BLEND_LO(mVec[0], t0, mask.mMask);
+            mVec[1] = BLEND_HI(mVec[1], t1, mask.mMask);
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_f & loada(double const * p) {
+            mVec[0] = _mm_load_pd(p);
+            mVec[1] = _mm_load_pd(p + 2);
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<4> const & mask, double const * p) {
+            __m128d t0 = _mm_load_pd(p);
+            __m128d t1 = _mm_load_pd(p + 2);
+            mVec[0] = BLEND_LO(mVec[0], t0, mask.mMask);
+            mVec[1] = BLEND_HI(mVec[1], t1, mask.mMask);
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE double* store(double* p) const {
+            _mm_storeu_pd(p, mVec[0]);
+            _mm_storeu_pd(p + 2, mVec[1]);
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE double* store(SIMDVecMask<4> const & mask, double* p) const {
+            __m128d t0 = _mm_loadu_pd(p);
+            __m128d t1 = _mm_loadu_pd(p + 2);
+            _mm_storeu_pd(p, BLEND_LO(t0, mVec[0], mask.mMask));
+            _mm_storeu_pd(p + 2, BLEND_HI(t1, mVec[1], mask.mMask));
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE double* storea(double* p) const {
+            _mm_store_pd(p, mVec[0]);
+            _mm_store_pd(p + 2, mVec[1]);
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE double* storea(SIMDVecMask<4> const & mask, double* p) const {
+            __m128i t0 = _mm_unpacklo_epi32(mask.mMask, mask.mMask);
+            __m128i t1 = _mm_unpackhi_epi32(mask.mMask, mask.mMask);
+            maskstore_pd_sse(p, t0, mVec[0]);
+            maskstore_pd_sse(p + 2, t1, mVec[1]);
+            return p;
+        }
+        
+
+        
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            __m128d t0 = BLEND_LO(mVec[0], b.mVec[0], mask.mMask);
+            __m128d t1 = BLEND_HI(mVec[1], b.mVec[1], mask.mMask);
+            return SIMDVec_f(t0, t1);
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<4> const & mask, double b) const {
+            __m128d t0 = _mm_set1_pd(b);
+            __m128d t1 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m128d t2 = BLEND_HI(mVec[1], t0, mask.mMask);
+            return SIMDVec_f(t1, t2);
+        }
+        // SWIZZLE
+        // SWIZZLEA
+        //(Addition operations)
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_add_pd(mVec[0], b.mVec[0]);
+            __m128d t1 = _mm_add_pd(mVec[1], b.mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator+ (SIMDVec_f const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_f add(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            __m128d t0 = _mm_add_pd(mVec[0], b.mVec[0]);
+            __m128d t1 = _mm_add_pd(mVec[1], b.mVec[1]);
+
+            __m128d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m128d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+
+            return SIMDVec_f(t2, t3);
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_f add(double b) const {
+            __m128d t0 = _mm_add_pd(mVec[0], _mm_set1_pd(b));
+            __m128d t1 = _mm_add_pd(mVec[1], _mm_set1_pd(b));
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator+ (double b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_f add(SIMDVecMask<4> const & mask, double b) const {
+            __m128d t0 = _mm_add_pd(mVec[0], _mm_set1_pd(b));
+            __m128d t1 = _mm_add_pd(mVec[1], _mm_set1_pd(b));
+
+            __m128d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m128d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+
+            return SIMDVec_f(t2, t3);
+        }
+        // ADDVA    - Add with vector and assign
+        UME_FORCE_INLINE SIMDVec_f & adda(SIMDVec_f const & b) {
+            mVec[0] = _mm_add_pd(this->mVec[0], b.mVec[0]);
+            mVec[1] = _mm_add_pd(this->mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator+= (SIMDVec_f const & b) {
+            return adda(b);
+        }
+        // MADDVA   - Masked add with vector and assign
+        UME_FORCE_INLINE SIMDVec_f & adda(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            __m128d t0 = _mm_add_pd(mVec[0], b.mVec[0]);
+            __m128d t1 = _mm_add_pd(mVec[1], b.mVec[1]);
+
+            mVec[0] = BLEND_LO(mVec[0], t0, mask.mMask);
+            mVec[1] = BLEND_HI(mVec[1], t1, mask.mMask);
+
+            return *this;
+        }
+        // ADDSA    - Add with scalar and assign
+        UME_FORCE_INLINE SIMDVec_f & adda(double b) {
+            mVec[0] = _mm_add_pd(this->mVec[0], _mm_set1_pd(b));
+            mVec[1] = _mm_add_pd(this->mVec[1], _mm_set1_pd(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator+= (double b) {
+            return adda(b);
+        }
+        // MADDSA   - Masked add with scalar and assign
+        UME_FORCE_INLINE SIMDVec_f & adda(SIMDVecMask<4> const & mask, double b) {
+            __m128d t0 = _mm_add_pd(mVec[0], _mm_set1_pd(b));
+            __m128d t1 = _mm_add_pd(mVec[1], _mm_set1_pd(b));
+
+            mVec[0] = BLEND_LO(mVec[0], t0, mask.mMask);
+            mVec[1] = BLEND_HI(mVec[1], t1, mask.mMask);
+
+            return *this;
+        }
+        // SADDV    - Saturated add with vector
+        // MSADDV   - Masked saturated add with vector
+        // SADDS    - Saturated add with scalar
+        // MSADDS   - Masked saturated add with scalar
+        // SADDVA   - Saturated add with vector and assign
+        // MSADDVA  - Masked saturated add with vector and assign
+        // SADDSA   - Satureated add with scalar and assign
+        // MSADDSA  - Masked staturated add with vector and assign
+        // POSTINC  - Postfix increment
+        // MPOSTINC - Masked postfix increment
+        // PREFINC  - Prefix increment
+        // MPREFINC - Masked prefix increment
+
+        //(Subtraction operations)
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVec_f const & b) const {
+            return add(b);
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return add(mask, b);
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(double b) const {
+            return add(b);
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<4> const & mask, double b) const {
+            return add(mask, b);
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVec_f const & b) {
+            return adda(b);
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            return adda(mask, b);
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(double b) {
+            return adda(b);
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<4> const & mask, double b) {
+            return adda(mask, b);
+        }
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_f sub(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_sub_pd(mVec[0], b.mVec[0]);
+            __m128d t1 = _mm_sub_pd(mVec[1], b.mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator- (SIMDVec_f const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_f sub(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            __m128d t0 = _mm_sub_pd(mVec[0], b.mVec[0]);
+            __m128d t1 = _mm_sub_pd(mVec[1], b.mVec[1]);
+
+            __m128d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m128d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+
+            return SIMDVec_f(t2, t3);
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_f sub(double b) const {
+            __m128d t0 = _mm_sub_pd(mVec[0], _mm_set1_pd(b));
+            __m128d t1 = _mm_sub_pd(mVec[1], _mm_set1_pd(b));
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator- (double b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_f sub(SIMDVecMask<4> const & mask, double b) const {
+            __m128d t0 = _mm_sub_pd(mVec[0], _mm_set1_pd(b));
+            __m128d t1 = _mm_sub_pd(mVec[1], _mm_set1_pd(b));
+
+            __m128d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m128d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+
+            return SIMDVec_f(t2, t3);
+        }
+        // SUBVA      - Sub with vector and assign
+        // MSUBVA     - Masked sub with vector and assign
+        // SUBSA      - Sub with scalar and assign
+        // MSUBSA     - Masked sub with scalar and assign
+        // SSUBV      - Saturated sub with vector
+        // MSSUBV     - Masked saturated sub with vector
+        // SSUBS      - Saturated sub with scalar
+        // MSSUBS     - Masked saturated sub with scalar
+        // SSUBVA     - Saturated sub with vector and assign
+        // MSSUBVA    - Masked saturated sub with vector and assign
+        // SSUBSA     - Saturated sub with scalar and assign
+        // MSSUBSA    - Masked saturated sub with scalar and assign
+        UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_sub_pd(b.mVec[0], mVec[0]);
+            __m128d t1 = _mm_sub_pd(b.mVec[1], mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVec_f const & b) const {
+            return sub(b);
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return sub(mask, b);
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(double b) const {
+            return sub(b);
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<4> const & mask, double b) const {
+            return sub(mask, b);
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVec_f const & b) {
+            return suba(b);
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<4> const & mask, SIMDVec_f const & b) {
+            return suba(mask, b);
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(double b) {
+            return suba(b);
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<4> const & mask, double b) {
+            return suba(mask, b);
+        }
+        // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            __m128d t0 = _mm_sub_pd(b.mVec[0], mVec[0]);
+            __m128d t1 = _mm_sub_pd(b.mVec[1], mVec[1]);
+            __m128d t2 = BLEND_LO(b.mVec[0], t0, mask.mMask);
+            __m128d t3 = BLEND_HI(b.mVec[1], t1, mask.mMask);
+            return SIMDVec_f(t2, t3);
+        }
+        // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_f subfrom(double b) const {
+            __m128d t0 = _mm_sub_pd(_mm_set1_pd(b), mVec[0]);
+            __m128d t1 = _mm_sub_pd(_mm_set1_pd(b), mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVecMask<4> const & mask, double b) const {
+            __m128d t0 = _mm_sub_pd(_mm_set1_pd(b), mVec[0]);
+            __m128d t1 = _mm_sub_pd(_mm_set1_pd(b), mVec[1]);
+            __m128d t2 = BLEND_LO(_mm_set1_pd(b), t0, mask.mMask);
+            __m128d t3 = BLEND_HI(_mm_set1_pd(b), t1, mask.mMask);
+            return SIMDVec_f(t2, t3);
+        }
+        // SUBFROMVA  - Sub from vector and assign
+        // MSUBFROMVA - Masked sub from vector and assign
+        // SUBFROMSA  - Sub from scalar (promoted to vector) and assign
+        // MSUBFROMSA - Masked sub from scalar (promoted to vector) and assign
+        // POSTDEC    - Postfix decrement
+        // MPOSTDEC   - Masked postfix decrement
+        // PREFDEC    - Prefix decrement
+        // MPREFDEC   - Masked prefix decrement
+
+        //(Multiplication operations)
+        // MULV
+        UME_FORCE_INLINE SIMDVec_f mul(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_mul_pd(mVec[0], b.mVec[0]);
+            __m128d t1 = _mm_mul_pd(mVec[1], b.mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator* (SIMDVec_f const & b) const {
+            return mul(b);
+        }
+        // MMULV
+        UME_FORCE_INLINE SIMDVec_f mul(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            __m128d t0 = BLEND_LO(mVec[0], _mm_mul_pd(mVec[0], b.mVec[0]), mask.mMask);
+            __m128d t1 = BLEND_HI(mVec[1], _mm_mul_pd(mVec[1], b.mVec[1]), mask.mMask);
+            return SIMDVec_f(t0, t1);
+        }
+        // MULS
+        UME_FORCE_INLINE SIMDVec_f mul(double b) const {
+            __m128d t0 = _mm_mul_pd(mVec[0], _mm_set1_pd(b));
+            __m128d t1 = _mm_mul_pd(mVec[1], _mm_set1_pd(b));
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator* (double b) const {
+            return mul(b);
+        }
+        // MMULS
+        UME_FORCE_INLINE SIMDVec_f mul(SIMDVecMask<4> const & mask, double b) const {
+            __m128d t0 = BLEND_LO(mVec[0], _mm_mul_pd(mVec[0], _mm_set1_pd(b)), mask.mMask);
+            __m128d t1 = BLEND_HI(mVec[1], _mm_mul_pd(mVec[1], _mm_set1_pd(b)), mask.mMask);
+            return SIMDVec_f(t0, t1);
+        }
+        // MULVA
+        UME_FORCE_INLINE SIMDVec_f & mula(SIMDVec_f const & b) {
+            mVec[0] = _mm_mul_pd(mVec[0], b.mVec[0]);
+            mVec[1] = _mm_mul_pd(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator*= (SIMDVec_f const & b) {
+            return mula(b);
+        }
+        // MMULVA
+        UME_FORCE_INLINE SIMDVec_f & mula(SIMDVecMask<4> const & mask, SIMDVec_f const & b){
+            mVec[0] = BLEND_LO(mVec[0], _mm_mul_pd(mVec[0], b.mVec[0]), mask.mMask);
+            mVec[1] = BLEND_HI(mVec[1], _mm_mul_pd(mVec[1], b.mVec[1]), mask.mMask);
+            return *this;
+        }
+        // MULSA
+        UME_FORCE_INLINE SIMDVec_f & mula(double b) {
+            mVec[0] = _mm_mul_pd(mVec[0], _mm_set1_pd(b));
+            mVec[1] = _mm_mul_pd(mVec[1], _mm_set1_pd(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator*= (double b) {
+            return mula(b);
+        }
+        // MMULSA
+        UME_FORCE_INLINE SIMDVec_f mula(SIMDVecMask<4> const & mask, double b) {
+            mVec[0] = BLEND_LO(mVec[0], _mm_mul_pd(mVec[0], _mm_set1_pd(b)), mask.mMask);
+            mVec[1] = BLEND_HI(mVec[1], _mm_mul_pd(mVec[1], _mm_set1_pd(b)), mask.mMask);
+            return *this;
+        }
+
+        //(Division operations)
+        // DIVV
+        UME_FORCE_INLINE SIMDVec_f div(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_div_pd(mVec[0], b.mVec[0]);
+            __m128d t1 = _mm_div_pd(mVec[1], b.mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator/ (SIMDVec_f const & b) const {
+            return div(b);
+        }
+        // MDIVV
+        UME_FORCE_INLINE SIMDVec_f div(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            __m128d t0 = _mm_div_pd(mVec[0], b.mVec[0]);
+            __m128d t1 = _mm_div_pd(mVec[1], b.mVec[1]);
+            __m128d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m128d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+            return SIMDVec_f(t2, t3);
+        }
+        // DIVS
+        UME_FORCE_INLINE SIMDVec_f div(double b) const {
+            __m128d t0 = _mm_div_pd(mVec[0], _mm_set1_pd(b));
+            __m128d t1 = _mm_div_pd(mVec[1], _mm_set1_pd(b));
+            return SIMDVec_f(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator/ (double b) const {
+            return div(b);
+        }
+        // MDIVS
+        UME_FORCE_INLINE SIMDVec_f div(SIMDVecMask<4> const & mask, double b) const {
+            __m128d t0 = _mm_div_pd(mVec[0], _mm_set1_pd(b));
+            __m128d t1 = _mm_div_pd(mVec[1], _mm_set1_pd(b));
+            __m128d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m128d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+            return SIMDVec_f(t2, t3);
+        }
+        // DIVVA  - Division with vector and assign
+        // MDIVVA - Masked division with vector and assign
+        // DIVSA  - Division with scalar and assign
+        // MDIVSA - Masked division with scalar and assign
+        // RCP
+        UME_FORCE_INLINE SIMDVec_f rcp() const {
+            __m128d t0 = _mm_div_pd(_mm_set1_pd(1.0), mVec[0]);
+            __m128d t1 = _mm_div_pd(_mm_set1_pd(1.0), mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // MRCP
+        UME_FORCE_INLINE SIMDVec_f rcp(SIMDVecMask<4> const & mask) const {
+            __m128d t0 = _mm_div_pd(_mm_set1_pd(1.0), mVec[0]);
+            __m128d t1 = _mm_div_pd(_mm_set1_pd(1.0), mVec[1]);
+            __m128d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m128d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+            return SIMDVec_f(t2, t3);
+        }
+        // RCPS
+        UME_FORCE_INLINE SIMDVec_f rcp(double b) const {
+            __m128d t0 = _mm_div_pd(_mm_set1_pd(b), mVec[0]);
+            __m128d t1 = _mm_div_pd(_mm_set1_pd(b), mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // MRCPS
+        UME_FORCE_INLINE SIMDVec_f rcp(SIMDVecMask<4> const & mask, double b) const {
+            __m128d t0 = _mm_div_pd(_mm_set1_pd(b), mVec[0]);
+            __m128d t1 = _mm_div_pd(_mm_set1_pd(b), mVec[1]);
+            __m128d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m128d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+            return SIMDVec_f(t2, t3);
+        }
+        // RCPA   - Reciprocal and assign
+        // MRCPA  - Masked reciprocal and assign
+        // RCPSA  - Reciprocal with scalar and assign
+        // MRCPSA - Masked reciprocal with scalar and assign
+
+        //(Comparison operations)
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpeq(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_cmpeq_pd(mVec[0], b.mVec[0]);
+            __m128d t1 = _mm_cmpeq_pd(mVec[1], b.mVec[1]);
+            __m128i t2 = packLanes(t0, t1);
+            return SIMDVecMask<4>(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator== (SIMDVec_f const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<4> cmpeq(double b) const {
+            __m128d t0 = _mm_cmpeq_pd(mVec[0], _mm_set1_pd(b));
+            __m128d t1 = _mm_cmpeq_pd(mVec[1], _mm_set1_pd(b));
+            __m128i t2 = packLanes(t0, t1);
+            return SIMDVecMask<4>(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator== (double b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpne(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_cmpneq_pd(mVec[0], b.mVec[0]);
+            __m128d t1 = _mm_cmpneq_pd(mVec[1], b.mVec[1]);
+            __m128i t2 = packLanes(t0, t1);
+            return SIMDVecMask<4>(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator!= (SIMDVec_f const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<4> cmpne(double b) const {
+            __m128d t0 = _mm_cmpneq_pd(mVec[0], _mm_set1_pd(b));
+            __m128d t1 = _mm_cmpneq_pd(mVec[1], _mm_set1_pd(b));
+            __m128i t2 = packLanes(t0, t1);
+            return SIMDVecMask<4>(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator!= (double b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpgt(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_cmpgt_pd(mVec[0], b.mVec[0]);
+            __m128d t1 = _mm_cmpgt_pd(mVec[1], b.mVec[1]);
+            __m128i t2 = packLanes(t0, t1);
+            return SIMDVecMask<4>(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator> (SIMDVec_f const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<4> cmpgt(double b) const {
+            __m128d t0 = _mm_cmpgt_pd(mVec[0], _mm_set1_pd(b));
+            __m128d t1 = _mm_cmpgt_pd(mVec[1], _mm_set1_pd(b));
+            __m128i t2 = packLanes(t0, t1);
+            return SIMDVecMask<4>(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator> (double b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<4> cmplt(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_cmplt_pd(mVec[0], b.mVec[0]);
+            __m128d t1 = _mm_cmplt_pd(mVec[1], b.mVec[1]);
+            __m128i t2 = packLanes(t0, t1);
+            return SIMDVecMask<4>(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator< (SIMDVec_f const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<4> cmplt(double b) const {
+            __m128d t0 = _mm_cmplt_pd(mVec[0], _mm_set1_pd(b));
+            __m128d t1 = _mm_cmplt_pd(mVec[1], _mm_set1_pd(b));
+            __m128i t2 = packLanes(t0, t1);
+            return SIMDVecMask<4>(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator< (double b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpge(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_cmpge_pd(mVec[0], b.mVec[0]);
+            __m128d t1 = _mm_cmpge_pd(mVec[1], b.mVec[1]);
+            __m128i t2 = packLanes(t0, t1);
+            return SIMDVecMask<4>(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator>= (SIMDVec_f const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<4> cmpge(double b) const {
+            __m128d t0 = _mm_cmpge_pd(mVec[0], _mm_set1_pd(b));
+            __m128d t1 = _mm_cmpge_pd(mVec[1], _mm_set1_pd(b));
+            __m128i t2 = packLanes(t0, t1);
+            return SIMDVecMask<4>(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator>= (double b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmple(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_cmple_pd(mVec[0], b.mVec[0]);
+            __m128d t1 = _mm_cmple_pd(mVec[1], b.mVec[1]);
+            __m128i t2 = packLanes(t0, t1);
+            return SIMDVecMask<4>(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator<= (SIMDVec_f const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<4> cmple(double b) const {
+            __m128d t0 = _mm_cmple_pd(mVec[0], _mm_set1_pd(b));
+            __m128d t1 = _mm_cmple_pd(mVec[1], _mm_set1_pd(b));
+            __m128i t2 = packLanes(t0, t1);
+            return SIMDVecMask<4>(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator<= (double b) const {
+            return cmplt(b);
+        }
+        // CMPEX  - Check if vectors are exact (returns scalar 'bool')
+
+        //(Bitwise operations)
+        // ANDV   - AND with vector
+        // MANDV  - Masked AND with vector
+        // ANDS   - AND with scalar
+        // MANDS  - Masked AND with scalar
+        // ANDVA  - AND with vector and assign
+        // MANDVA - Masked AND with vector and assign
+        // ANDSA  - AND with scalar and assign
+        // MANDSA - Masked AND with scalar and assign
+        // ORV    - OR with vector
+        // MORV   - Masked OR with vector
+        // ORS    - OR with scalar
+        // MORS   - Masked OR with scalar
+        // ORVA   - OR with vector and assign
+        // MORVA  - Masked OR with vector and assign
+        // ORSA   - OR with scalar and assign
+        // MORSA  - Masked OR with scalar and assign
+        // XORV   - XOR with vector
+        // MXORV  - Masked XOR with vector
+        // XORS   - XOR with scalar
+        // MXORS  - Masked XOR with scalar
+        // XORVA  - XOR with vector and assign
+        // MXORVA - Masked XOR with vector and assign
+        // XORSA  - XOR with scalar and assign
+        // MXORSA - Masked XOR with scalar and assign
+        // NOT    - Negation of bits
+        // MNOT   - Masked negation of bits
+        // NOTA   - Negation of bits and assign
+        // MNOTA  - Masked negation of bits and assign
+
+        // (Pack/Unpack operations - not available for SIMD1)
+        // PACK     - assign vector with two half-length vectors
+        // PACKLO   - assign lower half of a vector with a half-length vector
+        // PACKHI   - assign upper half of a vector with a half-length vector
+        // UNPACK   - Unpack lower and upper halfs to half-length vectors.
+        // UNPACKLO - Unpack lower half and return as a half-length vector.
+        // UNPACKHI - Unpack upper half and return as a half-length vector.
+
+        //(Blend/Swizzle operations)
+        // BLENDV   - Blend (mix) two vectors
+        // BLENDS   - Blend (mix) vector with scalar (promoted to vector)
+        // assign
+        // SWIZZLE  - Swizzle (reorder/permute) vector elements
+        // SWIZZLEA - Swizzle (reorder/permute) vector elements and assign
+
+        //(Reduction to scalar operations)
+        // HADD  - Add elements of a vector (horizontal add)
+        // MHADD - Masked add elements of a vector (horizontal add)
+        // HMUL  - Multiply elements of a vector (horizontal mul)
+        // MHMUL - Masked multiply elements of a vector (horizontal mul)
+        // HAND  - AND of elements of a vector (horizontal AND)
+        // MHAND - Masked AND of elements of a vector (horizontal AND)
+        // HOR   - OR of elements of a vector (horizontal OR)
+        // MHOR  - Masked OR of elements of a vector (horizontal OR)
+        // HXOR  - XOR of elements of a vector (horizontal XOR)
+        // MHXOR - Masked XOR of elements of a vector (horizontal XOR)
+
+        //(Fused arithmetics)
+        // FMULADDV
+        UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVec_f const & b, SIMDVec_f const & c) const {
+#ifdef FMA
+            __m128d t0 = _mm_add_pd(_mm_mul_pd(mVec[0], b.mVec[0]), c.mVec[0]);
+            __m128d t1 = _mm_add_pd(_mm_mul_pd(mVec[1], b.mVec[1]), c.mVec[1]);
+#else
+            __m128d t0 = _mm_add_pd(_mm_mul_pd(mVec[0], b.mVec[0]), c.mVec[0]);
+            __m128d t1 = _mm_add_pd(_mm_mul_pd(mVec[1], b.mVec[1]), c.mVec[1]);
+#endif
+            return SIMDVec_f(t0, t1);
+        }
+        // MFMULADDV
+        UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVecMask<4> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+#ifdef FMA
+            __m128d t0 = _mm_add_pd(_mm_mul_pd(mVec[0], b.mVec[0]), c.mVec[0]);
+            __m128d t1 = _mm_add_pd(_mm_mul_pd(mVec[1], b.mVec[1]), c.mVec[1]);
+#else
+            __m128d t0 = _mm_add_pd(_mm_mul_pd(mVec[0], b.mVec[0]), c.mVec[0]);
+            __m128d t1 = _mm_add_pd(_mm_mul_pd(mVec[1], b.mVec[1]), c.mVec[1]);
+#endif
+            __m128d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m128d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+            return SIMDVec_f(t2, t3);
+        }
+        // FMULSUBV  - Fused multiply and sub (A*B - C) with vectors
+        // MFMULSUBV - Masked fused multiply and sub (A*B - C) with vectors
+        // FADDMULV  - Fused add and multiply ((A + B)*C) with vectors
+        // MFADDMULV - Masked fused add and multiply ((A + B)*C) with vectors
+        // FSUBMULV  - Fused sub and multiply ((A - B)*C) with vectors
+        // MFSUBMULV - Masked fused sub and multiply ((A - B)*C) with vectors
+
+        // (Mathematical operations)
+        // MAXV   - Max with vector
+        // MMAXV  - Masked max with vector
+        // MAXS   - Max with scalar
+        // MMAXS  - Masked max with scalar
+        // MAXVA  - Max with vector and assign
+        // MMAXVA - Masked max with vector and assign
+        // MAXSA  - Max with scalar (promoted to vector) and assign
+        // MMAXSA - Masked max with scalar (promoted to vector) and assign
+        // MINV   - Min with vector
+        // MMINV  - Masked min with vector
+        // MINS   - Min with scalar (promoted to vector)
+        // MMINS  - Masked min with scalar (promoted to vector)
+        // MINVA  - Min with vector and assign
+        // MMINVA - Masked min with vector and assign
+        // MINSA  - Min with scalar (promoted to vector) and assign
+        // MMINSA - Masked min with scalar (promoted to vector) and assign
+        // HMAX   - Max of elements of a vector (horizontal max)
+        // MHMAX  - Masked max of elements of a vector (horizontal max)
+        // IMAX   - Index of max element of a vector
+        // HMIN   - Min of elements of a vector (horizontal min)
+        // MHMIN  - Masked min of elements of a vector (horizontal min)
+        // IMIN   - Index of min element of a vector
+        // MIMIN  - Masked index of min element of a vector
+
+        // (Gather/Scatter operations)
+        // GATHERS   - Gather from memory using indices from array
+        // MGATHERS  - Masked gather from memory using indices from array
+        // GATHERV   - Gather from memory using indices from vector
+        // MGATHERV  - Masked gather from memory using indices from vector
+        // SCATTERS  - Scatter to memory using indices from array
+        // MSCATTERS - Masked scatter to memory using indices from array
+        // SCATTERV  - Scatter to memory using indices from vector
+        // MSCATTERV - Masked scatter to memory using indices from vector
+
+        // 3) Operations available for Signed integer and Unsigned integer 
+        // data types:
+
+        //(Signed/Unsigned cast)
+        // UTOI - Cast unsigned vector to signed vector
+        // ITOU - Cast signed vector to unsigned vector
+
+        // 4) Operations available for Signed integer and floating point SIMD types:
+
+        // (Sign modification)
+        // NEG
+        UME_FORCE_INLINE SIMDVec_f operator- () const {
+            return neg();
+        }
+        // MNEG  - Masked negate signed values
+        // NEGA
+        UME_FORCE_INLINE SIMDVec_f nega() {
+            mVec[0] = _mm_sub_pd(_mm_set1_pd(0.0), mVec[0]);
+            mVec[1] = _mm_sub_pd(_mm_set1_pd(0.0), mVec[1]);
+            return *this;
+        }
+        // MNEGA
+        UME_FORCE_INLINE SIMDVec_f nega(SIMDVecMask<4> const & mask) {
+            __m128d t0 = _mm_sub_pd(_mm_set1_pd(0.0), mVec[0]);
+            __m128d t1 = _mm_sub_pd(_mm_set1_pd(0.0), mVec[1]);
+            mVec[0] = BLEND_LO(mVec[0], t0, mask.mMask);
+            mVec[1] = BLEND_HI(mVec[1], t1, mask.mMask);
+            return *this;
+        }
+
+        // (Mathematical functions)
+        // ABS
+        UME_FORCE_INLINE SIMDVec_f abs() const {
+            __m128i t0 = _mm_set1_epi64x(0x7FFFFFFFFFFFFFFF);
+            __m128d t1 = _mm_castsi128_pd(t0);
+            __m128d t2 = _mm_and_pd(t1, mVec[0]);
+            __m128d t3 = _mm_and_pd(t1, mVec[1]);
+            return SIMDVec_f(t2, t3);
+        }
+        // MABS
+        UME_FORCE_INLINE SIMDVec_f abs(SIMDVecMask<4> const & mask) const {
+            __m128i t0 = _mm_set1_epi64x(0x7FFFFFFFFFFFFFFF);
+            __m128d t1 = _mm_castsi128_pd(t0);
+            __m128d t2 = _mm_and_pd(t1, mVec[0]);
+            __m128d t3 = _mm_and_pd(t1, mVec[1]);
+            __m128d t4 = BLEND_LO(mVec[0], t2, mask.mMask);
+            __m128d t5 = BLEND_HI(mVec[1], t3, mask.mMask);
+            return SIMDVec_f(t4, t5);
+        }
+        // ABSA
+        UME_FORCE_INLINE SIMDVec_f & absa() {
+            __m128i t0 = _mm_set1_epi64x(0x7FFFFFFFFFFFFFFF);
+            __m128d t1 = _mm_castsi128_pd(t0);
+            mVec[0] = _mm_and_pd(t1, mVec[0]);
+            mVec[1] = _mm_and_pd(t1, mVec[1]);
+            return *this;
+        }
+        // MABSA
+        UME_FORCE_INLINE SIMDVec_f & absa(SIMDVecMask<4> const & mask) {
+            __m128i t0 = _mm_set1_epi64x(0x7FFFFFFFFFFFFFFF);
+            __m128d t1 = _mm_castsi128_pd(t0);
+            __m128d t2 = _mm_and_pd(t1, mVec[0]);
+            __m128d t3 = _mm_and_pd(t1, mVec[1]);
+            mVec[0] = BLEND_LO(mVec[0], t2, mask.mMask);
+            mVec[1] = BLEND_HI(mVec[1], t3, mask.mMask);
+            return *this;
+        }
+
+        // COPYSIGN
+        UME_FORCE_INLINE SIMDVec_f copysign(SIMDVec_f const & b) const {
+            __m128d t0 = _mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFF));
+            __m128d t1 = _mm_castsi128_pd(_mm_set1_epi64x(0x8000000000000000));
+            __m128d t2 = _mm_and_pd(mVec[0], t0);
+            __m128d t3 = _mm_and_pd(mVec[1], t0);
+            __m128d t4 = _mm_and_pd(b.mVec[0], t1);
+            __m128d t5 = _mm_and_pd(b.mVec[1], t1);
+            __m128d t6 = _mm_or_pd(t2, t4);
+            __m128d t7 = _mm_or_pd(t3, t5);
+            return SIMDVec_f(t6, t7);
+        }
+        // MCOPYSIGN
+        UME_FORCE_INLINE SIMDVec_f copysign(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            __m128d t0 = _mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFF));
+            __m128d t1 = _mm_castsi128_pd(_mm_set1_epi64x(0x8000000000000000));
+            __m128d t2 = _mm_and_pd(mVec[0], t0);
+            __m128d t3 = _mm_and_pd(mVec[1], t0);
+            __m128d t4 = _mm_and_pd(b.mVec[0], t1);
+            __m128d t5 = _mm_and_pd(b.mVec[1], t1);
+            __m128d t6 = _mm_or_pd(t2, t4);
+            __m128d t7 = _mm_or_pd(t3, t5);
+            __m128d t8 = BLEND_LO(mVec[0], t6, mask.mMask);
+            __m128d t9 = BLEND_HI(mVec[1], t7, mask.mMask);
+            return SIMDVec_f(t8, t9);
+        }
+        
+        // 5) Operations available for floating point SIMD types:
+
+        // (Comparison operations)
+        // CMPEQRV - Compare 'Equal within range' with margins from vector
+        // CMPEQRS - Compare 'Equal within range' with scalar margin
+
+        // (Mathematical functions)
+        // SQR       - Square of vector values
+        // MSQR      - Masked square of vector values
+        // SQRA      - Square of vector values and assign
+        // MSQRA     - Masked square of vector values and assign
+        // SQRT
+        UME_FORCE_INLINE SIMDVec_f sqrt() const {
+            __m128d t0 = _mm_sqrt_pd(mVec[0]);
+            __m128d t1 = _mm_sqrt_pd(mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // MSQRT
+        UME_FORCE_INLINE SIMDVec_f sqrt(SIMDVecMask<4> const & mask) const {
+            __m128d t0 = _mm_sqrt_pd(mVec[0]);
+            __m128d t1 = _mm_sqrt_pd(mVec[1]);
+            __m128d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m128d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+            return SIMDVec_f(t2, t3);
+        }
+        // SQRTA     - Square root of vector values and assign
+        // MSQRTA    - Masked square root of vector values and assign
+        // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this, b);
+        }
+        // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this, b);
+        }
+        // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(*this, SIMDVec_f(b));
+        }
+        // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<4> const & mask, double b) const {
+            return VECTOR_EMULATION::powd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this, SIMDVec_f(b));
+        }
+        // ROUND
+        UME_FORCE_INLINE SIMDVec_f round() const {
+            __m128d t0 = round_pd_sse(mVec[0]);
+            __m128d t1 = round_pd_sse(mVec[1]);
+            return SIMDVec_f(t0, t1);
+        }
+        // MROUND
+        UME_FORCE_INLINE SIMDVec_f round(SIMDVecMask<4> const & mask) const {
+            __m128d t0 = round_pd_sse(mVec[0]);
+            __m128d t1 = round_pd_sse(mVec[1]);
+            __m128d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m128d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+            return SIMDVec_f(t2, t3);
+        }
+        // TRUNC     - Truncate to integer (returns Signed integer vector)
+        // MTRUNC    - Masked truncate to integer (returns Signed integer vector)
+        // FLOOR     - Floor
+        // MFLOOR    - Masked floor
+        // CEIL      - Ceil
+        // MCEIL     - Masked ceil
+        // ISFIN
+        UME_FORCE_INLINE SIMDVecMask<4> isfin() const {
+            __m128i t0 = packLanes(finiteLanes(mVec[0]), finiteLanes(mVec[1]));
+            return SIMDVecMask<4>(t0);
+        }
+        // ISINF
+        UME_FORCE_INLINE SIMDVecMask<4> isinf() const {
+            __m128i t0 = packLanes(infiniteLanes(mVec[0]), infiniteLanes(mVec[1]));
+            return SIMDVecMask<4>(t0);
+        }
+        // ISAN
+        UME_FORCE_INLINE SIMDVecMask<4> isan() const {
+            __m128i t0 = packLanes(finiteLanes(mVec[0]), finiteLanes(mVec[1]));
+            return SIMDVecMask<4>(t0);
+        }
+        // ISNAN
+        UME_FORCE_INLINE SIMDVecMask<4> isnan() const {
+            __m128i t0 = packLanes(nanLanes(mVec[0]), nanLanes(mVec[1]));
+            return SIMDVecMask<4>(t0);
+        }
+        // ISSUB
+        UME_FORCE_INLINE SIMDVecMask<4> issub() const {
+            __m128i t0 = packLanes(subnormalLanes(mVec[0]), subnormalLanes(mVec[1]));
+            return SIMDVecMask<4>(t0);
+        }
+        // ISZERO
+        UME_FORCE_INLINE SIMDVecMask<4> iszero() const {
+            __m128i t0 = packLanes(zeroLanes(mVec[0]), zeroLanes(mVec[1]));
+            return SIMDVecMask<4>(t0);
+        }
+        // ISZEROSUB
+        UME_FORCE_INLINE SIMDVecMask<4> iszerosub() const {
+            __m128i t0 = packLanes(zeroOrSubnormalLanes(mVec[0]), zeroOrSubnormalLanes(mVec[1]));
+            return SIMDVecMask<4>(t0);
+        }
+        // EXP
+        UME_FORCE_INLINE SIMDVec_f exp() const {
+            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
+        // MEXP
+        UME_FORCE_INLINE SIMDVec_f exp(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::expd<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // LOG
+        UME_FORCE_INLINE SIMDVec_f log() const {
+            // Evaluate the SIMDVec_f<double, 2> kernel on each register.
+            __m128d t0 = SIMDVec_f<double, 2>(mVec[0]).log().mVec;
+            __m128d t1 = SIMDVec_f<double, 2>(mVec[1]).log().mVec;
+            return SIMDVec_f(t0, t1);
+        }
+        // MLOG
+        UME_FORCE_INLINE SIMDVec_f log(SIMDVecMask<4> const & mask) const {
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, log());
+            return t0;
+        }
+        // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
+        // MLOG2
+        UME_FORCE_INLINE SIMDVec_f log2(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log2d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 4>>(*this);
+        }
+        // MLOG10
+        UME_FORCE_INLINE SIMDVec_f log10(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::log10d<SIMDVec_f, SIMDVec_u<uint64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // SIN
+        UME_FORCE_INLINE SIMDVec_f sin() const {
+#if defined(UME_USE_SVML)
+            __m128d t0 = _mm_sin_pd(mVec[0]);
+            __m128d t1 = _mm_sin_pd(mVec[1]);
+            return SIMDVec_f(t0, t1);
+#else
+            __m128d t0 = SIMDVec_f<double, 2>(mVec[0]).sin().mVec;
+            __m128d t1 = SIMDVec_f<double, 2>(mVec[1]).sin().mVec;
+            return SIMDVec_f(t0, t1);
+#endif
+        }
+        // MSIN
+        UME_FORCE_INLINE SIMDVec_f sin(SIMDVecMask<4> const & mask) const {
+#if defined(UME_USE_SVML)
+            __m128d t0 = _mm_sin_pd(mVec[0]);
+            __m128d t1 = _mm_sin_pd(mVec[1]);
+            __m128d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m128d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+            return SIMDVec_f(t0, t1);
+#else
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, sin());
+            return t0;
+#endif
+        }
+        // COS
+        UME_FORCE_INLINE SIMDVec_f cos() const {
+#if defined(UME_USE_SVML)
+            __m128d t0 = _mm_cos_pd(mVec[0]);
+            __m128d t1 = _mm_cos_pd(mVec[1]);
+            return SIMDVec_f(t0, t1);
+#else
+            __m128d t0 = SIMDVec_f<double, 2>(mVec[0]).cos().mVec;
+            __m128d t1 = SIMDVec_f<double, 2>(mVec[1]).cos().mVec;
+            return SIMDVec_f(t0, t1);
+#endif
+        }
+        // MCOS
+        UME_FORCE_INLINE SIMDVec_f cos(SIMDVecMask<4> const & mask) const {
+#if defined(UME_USE_SVML)
+            __m128d t0 = _mm_cos_pd(mVec[0]);
+            __m128d t1 = _mm_cos_pd(mVec[1]);
+            __m128d t2 = BLEND_LO(mVec[0], t0, mask.mMask);
+            __m128d t3 = BLEND_HI(mVec[1], t1, mask.mMask);
+            return SIMDVec_f(t0, t1);
+#else
+            SIMDVec_f t0 = *this;
+            t0.assign(mask, cos());
+            return t0;
+#endif
+        }
+        // SINCOS
+        UME_FORCE_INLINE void sincos(SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+        #if defined(UME_USE_SVML)
+            alignas(64) double raw_cos[8];
+            sinvec.mVec[0] = _mm_sincos_pd((__m128d*)&raw_cos[0], mVec[0]);
+            sinvec.mVec[1] = _mm_sincos_pd((__m128d*)&raw_cos[4], mVec[1]);
+            cosvec.mVec[0] = _mm_load_pd(&raw_cos[0]);
+            cosvec.mVec[1] = _mm_load_pd(&raw_cos[4]);
+        #else
+            SIMDVec_f<double, 2> t0, t1;
+            SIMDVec_f<double, 2>(mVec[0]).sincos(t0, t1);
+            sinvec.mVec[0] = t0.mVec;
+            cosvec.mVec[0] = t1.mVec;
+            SIMDVec_f<double, 2>(mVec[1]).sincos(t0, t1);
+            sinvec.mVec[1] = t0.mVec;
+            cosvec.mVec[1] = t1.mVec;
+        #endif
+        }
+
+        // MSINCOS
+        UME_FORCE_INLINE void sincos(SIMDVecMask<4> const & mask, SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+        #if defined(UME_USE_SVML)
+            alignas(64) double raw_cos[8];
+            __m128d t0 = _mm_sincos_pd((__m128d*)&raw_cos[0], mVec[0]);
+            __m128d t1 = _mm_sincos_pd((__m128d*)&raw_cos[4], mVec[1]);
+            sinvec.mVec[0] = BLEND_LO(mVec[0], t0, mask.mMask);
+            sinvec.mVec[1] = BLEND_HI(mVec[1], t1, mask.mMask);
+            
+            __m128d t2 = _mm_load_pd(&raw_cos[0]);
+            __m128d t3 = _mm_load_pd(&raw_cos[4]);
+            
+            cosvec.mVec[0] = BLEND_LO(mVec[0], t2, mask.mMask);
+            cosvec.mVec[1] = BLEND_HI(mVec[1], t3, mask.mMask);
+        #else
+            SIMDVec_f t0, t1;
+            sincos(t0, t1);
+            sinvec = *this;
+            cosvec = *this;
+            sinvec.assign(mask, t0);
+            cosvec.assign(mask, t1);
+        #endif
+        }
+        // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::tand<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(*this);
+        }
+        // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<4> const & mask) const {
+            return VECTOR_EMULATION::ctand<SIMDVec_f, SIMDVec_i<int64_t, 4>, SIMDVecMask<4>>(mask, *this);
+        }
+        // ATAN
+        UME_FORCE_INLINE SIMDVec_f atan() const {
+            return VECTOR_EMULATION::atand<SIMDVec_f, SIMDVecMask<4>>(*this);
+        }
+        // ATAN2
+        UME_FORCE_INLINE SIMDVec_f atan2(SIMDVec_f const & b) const {
+            return VECTOR_EMULATION::atan2d<SIMDVec_f, SIMDVecMask<4>>(*this, b);
+        }
+
+        // PROMOTE
+        // -
+        // DEGRADE
+        UME_FORCE_INLINE operator SIMDVec_f<float, 4>() const;
+
+        // FTOU
+        UME_FORCE_INLINE operator SIMDVec_u<uint64_t, 4>() const;
+        // FTOI
+        UME_FORCE_INLINE operator SIMDVec_i<int64_t, 4>() const;
+    };
+
+}
+}
+
+#undef BLEND_LO
+#undef BLEND_HI
+
+#endif
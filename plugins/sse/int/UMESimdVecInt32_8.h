@@ -0,0 +1,2403 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_INT32_8_H_
+#define UME_SIMD_VEC_INT32_8_H_
+
+#include <type_traits>
+#include <immintrin.h>
+
+#include "../../../UMESimdInterface.h"
+
+namespace UME {
+namespace SIMD {
+
+    template<>
+    class SIMDVec_i<int32_t, 8> :
+        public SIMDVecSignedInterface<
+            SIMDVec_i<int32_t, 8>,
+            SIMDVec_u<uint32_t, 8>,
+            int32_t,
+            8,
+            uint32_t,
+            SIMDVecMask<8>,
+            SIMDSwizzle<8>>,
+        public SIMDVecPackableInterface<
+            SIMDVec_i<int32_t, 8>,
+            SIMDVec_i<int32_t, 4>>
+    {
+    public:
+        friend class SIMDVec_u<uint32_t, 8>;
+        friend class SIMDVec_f<float, 8>;
+        friend class SIMDVec_f<double, 8>;
+        friend class SIMDVec_i<int16_t, 8>;
+    private:
+        __m128i mVec[2];
+
+        UME_FORCE_INLINE explicit SIMDVec_i(__m128i const & x0, __m128i const & x1) { mVec[0] = x0; mVec[1] = x1; }
+
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m128i saturatedAdd(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_add_epi32(a, b);
+            __m128i t1 = _mm_andnot_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, t0));
+            __m128i t2 = _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(0x7FFFFFFF));
+            return _mm_castps_si128(blendv_ps_sse(_mm_castsi128_ps(t0), _mm_castsi128_ps(t2), _mm_castsi128_ps(_mm_srai_epi32(t1, 31))));
+        }
+        static UME_FORCE_INLINE __m128i saturatedSub(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_sub_epi32(a, b);
+            __m128i t1 = _mm_and_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, t0));
+            __m128i t2 = _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(0x7FFFFFFF));
+            return _mm_castps_si128(blendv_ps_sse(_mm_castsi128_ps(t0), _mm_castsi128_ps(t2), _mm_castsi128_ps(_mm_srai_epi32(t1, 31))));
+        }
+        // Lane-wise division through double precision, exact for 32-bit operands.
+        static UME_FORCE_INLINE __m128i divideHalf(__m128i const & a, __m128i const & b) {
+            __m128d t0 = _mm_div_pd(_mm_cvtepi32_pd(a), _mm_cvtepi32_pd(b));
+            return _mm_cvttpd_epi32(t0);
+        }
+        static UME_FORCE_INLINE __m128i divideVector(__m128i const & a, __m128i const & b) {
+            __m128i t0 = divideHalf(a, b);
+            __m128i t1 = divideHalf(_mm_shuffle_epi32(a, 0x4E), _mm_shuffle_epi32(b, 0x4E));
+            return _mm_unpacklo_epi64(t0, t1);
+        }
+        static UME_FORCE_INLINE __m128i remainderVector(__m128i const & a, __m128i const & b) {
+            __m128i t0 = divideVector(a, b);
+            return _mm_sub_epi32(a, mullo_epi32_sse(t0, b));
+        }
+        // Division by a precomputed divisor, used by DIVD*/REMD*.
+        static UME_FORCE_INLINE __m128i divideMagic(__m128i const & a, SIMDDivisor<int32_t> const & b) {
+            __m128i t0 = _mm_set1_epi32(b.magic());
+            __m128i t1 = mul_epi32_sse(a, t0);
+            __m128i t2 = mul_epi32_sse(_mm_srli_epi64(a, 32), t0);
+            __m128i t3 = blend_epi32_sse<0xA>(_mm_srli_epi64(t1, 32), t2);
+            __m128i t4 = _mm_add_epi32(t3, a);
+            __m128i t5 = _mm_and_si128(_mm_srai_epi32(t4, 31), _mm_set1_epi32(b.mask()));
+            __m128i t6 = _mm_sra_epi32(_mm_add_epi32(t4, t5), _mm_cvtsi32_si128(b.shift()));
+            __m128i t7 = _mm_set1_epi32(b.sign());
+            return _mm_sub_epi32(_mm_xor_si128(t6, t7), t7);
+        }
+        static UME_FORCE_INLINE __m128i remainderMagic(__m128i const & a, SIMDDivisor<int32_t> const & b) {
+            __m128i t0 = divideMagic(a, b);
+            return _mm_sub_epi32(a, mullo_epi32_sse(t0, _mm_set1_epi32(b.divisor())));
+        }
+        // Writes lanes of 'v' selected by bits of 'm' to baseAddr[indices[i]],
+        // in lane order. Indices are moved to general purpose registers in
+        // pairs, so neither vector makes a round trip through the stack.
+        static UME_FORCE_INLINE void scatterLanes(int32_t * baseAddr, __m128i v, __m128i indices, int m) {
+            uint64_t x0 = uint64_t(_mm_cvtsi128_si64(v));
+            uint64_t x1 = uint64_t(extract_epi64_sse<1>(v));
+            uint64_t i0 = uint64_t(_mm_cvtsi128_si64(indices));
+            uint64_t i1 = uint64_t(extract_epi64_sse<1>(indices));
+            if (m & 0x01) baseAddr[uint32_t(i0)] = int32_t(x0);
+            if (m & 0x02) baseAddr[uint32_t(i0 >> 32)] = int32_t(x0 >> 32);
+            if (m & 0x04) baseAddr[uint32_t(i1)] = int32_t(x1);
+            if (m & 0x08) baseAddr[uint32_t(i1 >> 32)] = int32_t(x1 >> 32);
+        }
+        // Adds lanes of 'v' selected by bits of 'm' to baseAddr[indices[i]],
+        // in lane order, so that lanes with repeating indices accumulate.
+        static UME_FORCE_INLINE void scatterAddLanes(int32_t * baseAddr, __m128i v, __m128i indices, int m) {
+            uint64_t x0 = uint64_t(_mm_cvtsi128_si64(v));
+            uint64_t x1 = uint64_t(extract_epi64_sse<1>(v));
+            uint64_t i0 = uint64_t(_mm_cvtsi128_si64(indices));
+            uint64_t i1 = uint64_t(extract_epi64_sse<1>(indices));
+            if (m & 0x01) baseAddr[uint32_t(i0)] += int32_t(x0);
+            if (m & 0x02) baseAddr[uint32_t(i0 >> 32)] += int32_t(x0 >> 32);
+            if (m & 0x04) baseAddr[uint32_t(i1)] += int32_t(x1);
+            if (m & 0x08) baseAddr[uint32_t(i1 >> 32)] += int32_t(x1 >> 32);
+        }
+    public:
+
+        constexpr static uint32_t length() { return 8; }
+        constexpr static uint32_t alignment() { return 16; }
+
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_i() {}
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_i(int32_t i) {
+            mVec[0] = _mm_set1_epi32(i);
+            mVec[1] = _mm_set1_epi32(i);
+        }
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_i(
+            T i, 
+            typename std::enable_if< std::is_fundamental<T>::value && 
+                                    !std::is_same<T, int32_t>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_i(static_cast<int32_t>(i)) {}
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVec_i(int32_t const *p) { load(p); }
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVec_i(int32_t i0, int32_t i1, int32_t i2, int32_t i3,
+                         int32_t i4, int32_t i5, int32_t i6, int32_t i7)
+        {
+            mVec[0] = _mm_setr_epi32(i0, i1, i2, i3);
+            mVec[1] = _mm_setr_epi32(i4, i5, i6, i7);
+        }
+        // EXTRACT
+        UME_FORCE_INLINE int32_t extract(uint32_t index) const {
+            alignas(16) int32_t raw[4];
+            uint32_t raw_index;
+            if (index < 4) {
+                _mm_store_si128((__m128i*)raw, mVec[0]);
+                raw_index = index;
+            }
+            else {
+                _mm_store_si128((__m128i*)raw, mVec[1]);
+                raw_index = index - 4;
+            }
+            return raw[raw_index];
+        }
+        UME_FORCE_INLINE int32_t operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_i & insert(uint32_t index, int32_t value) {
+            alignas(16) int32_t raw[4];
+            if (index < 4) {
+                _mm_store_si128((__m128i*)raw, mVec[0]);
+                raw[index] = value;
+                mVec[0] = _mm_load_si128((__m128i*)raw);
+            }
+            else
+            {
+                _mm_store_si128((__m128i*)raw, mVec[1]);
+                raw[index - 4] = value;
+                mVec[1] = _mm_load_si128((__m128i*)raw);
+            }
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_i, int32_t> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_i, int32_t>(index, static_cast<SIMDVec_i &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_i, int32_t, SIMDVecMask<8>> operator() (SIMDVecMask<8> const & mask) {
+            return IntermediateMask<SIMDVec_i, int32_t, SIMDVecMask<8>>(mask, static_cast<SIMDVec_i &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_i, int32_t, SIMDVecMask<8>> operator[] (SIMDVecMask<8> const & mask) {
+            return IntermediateMask<SIMDVec_i, int32_t, SIMDVecMask<8>>(mask, static_cast<SIMDVec_i &>(*this));
+        }
+#endif
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVec_i const & b) {
+            mVec[0] = b.mVec[0];
+            mVec[1] = b.mVec[1];
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator= (SIMDVec_i const & b) {
+            return assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            mVec[0] = blendv_epi8_sse(mVec[0], b.mVec[0], mask.mMask[0]);
+            mVec[1] = blendv_epi8_sse(mVec[1], b.mVec[1], mask.mMask[1]);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_i & assign(int32_t b) {
+            mVec[0] = _mm_set1_epi32(b);
+            mVec[1] = _mm_set1_epi32(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator= (int32_t b) {
+            return assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVecMask<8> const & mask, int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t0, mask.mMask[1]);
+            return *this;
+        }
+
+        // PREFETCH0
+        // PREFETCH1
+        // PREFETCH2
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_i & load(int32_t const * p) {
+            mVec[0] = _mm_loadu_si128((__m128i*)p);
+            mVec[1] = _mm_loadu_si128((__m128i*)(p + 4));
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<8> const & mask, int32_t const * p) {
+            __m128i t0 = _mm_loadu_si128((__m128i*)p);
+            __m128i t1 = _mm_loadu_si128((__m128i*)(p + 4));
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_i & loada(int32_t const * p) {
+            mVec[0] = _mm_load_si128((__m128i *)p);
+            mVec[1] = _mm_load_si128((__m128i *)(p + 4));
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<8> const & mask, int32_t const * p) {
+            __m128i t0 = _mm_load_si128((__m128i*)p);
+            __m128i t1 = _mm_load_si128((__m128i*)(p + 4));
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // SLOAD
+        UME_FORCE_INLINE SIMDVec_i & sload(int32_t const * p) {
+            mVec[0] = stream_load_si128_sse((__m128i*)p);
+            mVec[1] = stream_load_si128_sse((__m128i*)(p + 4));
+            return *this;
+        }
+        // MSLOAD
+        UME_FORCE_INLINE SIMDVec_i & sload(SIMDVecMask<8> const & mask, int32_t const * p) {
+            __m128i t0 = stream_load_si128_sse((__m128i*)p);
+            __m128i t1 = stream_load_si128_sse((__m128i*)(p + 4));
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE int32_t* store(int32_t * p) const {
+            _mm_storeu_si128((__m128i*)p, mVec[0]);
+            _mm_storeu_si128((__m128i*)(p + 4), mVec[1]);
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE int32_t* store(SIMDVecMask<8> const & mask, int32_t * p) const {
+            maskstore_epi32_sse(p, mask.mMask[0], mVec[0]);
+            maskstore_epi32_sse(p + 4, mask.mMask[1], mVec[1]);
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE int32_t* storea(int32_t * p) const {
+            _mm_store_si128((__m128i*)p, mVec[0]);
+            _mm_store_si128((__m128i*)(p + 4), mVec[1]);
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE int32_t* storea(SIMDVecMask<8> const & mask, int32_t * p) const {
+            maskstore_epi32_sse(p, mask.mMask[0], mVec[0]);
+            maskstore_epi32_sse(p + 4, mask.mMask[1], mVec[1]);
+            return p;
+        }
+        // SSTORE
+        UME_FORCE_INLINE int32_t* sstore(int32_t* p) const {
+            _mm_stream_si128((__m128i*)p, mVec[0]);
+            _mm_stream_si128((__m128i*)(p + 4), mVec[1]);
+            return p;
+        }
+        // MSSTORE
+        UME_FORCE_INLINE int32_t* sstore(SIMDVecMask<8> const & mask, int32_t* p) const {
+            __m128i t0 = stream_load_si128_sse((__m128i*)p);
+            __m128i t1 = stream_load_si128_sse((__m128i*)(p + 4));
+            __m128i t2 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t3 = blendv_epi8_sse(t1, mVec[1], mask.mMask[1]);
+            _mm_stream_si128((__m128i*)p, t2);
+            _mm_stream_si128((__m128i*)(p + 4), t3);
+            return p;
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressstore(SIMDVecMask<8> const & mask, int32_t * p) const {
+            uint32_t t0 = SIMDVec_i<int32_t, 4>::compressLanes(p, mVec[0], _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[0])));
+            uint32_t t1 = SIMDVec_i<int32_t, 4>::compressLanes(p + t0, mVec[1], _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[1])));
+            return t0 + t1;
+        }
+        // BLENDV
+        // BLENDS
+        // SWIZZLE 
+        // SWIZZLEA
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() const {
+            // Sorting the halves in opposite directions gives a bitonic sequence.
+            __m128i t0 = SIMDVec_i<int32_t, 4>::sortLanes(mVec[0]);
+            __m128i t1 = SIMDVec_i<int32_t, 4>::reverseLanes(SIMDVec_i<int32_t, 4>::sortLanes(mVec[1]));
+            __m128i t2 = SIMDVec_i<int32_t, 4>::mergeLanes(min_epi32_sse(t0, t1));
+            __m128i t3 = SIMDVec_i<int32_t, 4>::mergeLanes(max_epi32_sse(t0, t1));
+            return SIMDVec_i(t2, t3);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() const {
+            __m128i t0 = SIMDVec_i<int32_t, 4>::sortLanes(mVec[0]);
+            __m128i t1 = SIMDVec_i<int32_t, 4>::reverseLanes(SIMDVec_i<int32_t, 4>::sortLanes(mVec[1]));
+            __m128i t2 = SIMDVec_i<int32_t, 4>::mergeLanes(min_epi32_sse(t0, t1));
+            __m128i t3 = SIMDVec_i<int32_t, 4>::mergeLanes(max_epi32_sse(t0, t1));
+            __m128i t4 = SIMDVec_i<int32_t, 4>::reverseLanes(t3);
+            __m128i t5 = SIMDVec_i<int32_t, 4>::reverseLanes(t2);
+            return SIMDVec_i(t4, t5);
+        }
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_add_epi32(mVec[0], b.mVec[0]);
+            __m128i t1 = _mm_add_epi32(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator+ (SIMDVec_i const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = _mm_add_epi32(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = _mm_add_epi32(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_i add(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_add_epi32(mVec[0], t0);
+            __m128i t2 = _mm_set1_epi32(b);
+            __m128i t3 = _mm_add_epi32(mVec[1], t2);
+            return SIMDVec_i(t1, t3);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator+ (int32_t b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_add_epi32(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = _mm_add_epi32(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_i(t2, t4);
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVec_i const & b) {
+            mVec[0] = _mm_add_epi32(mVec[0], b.mVec[0]);
+            mVec[1] = _mm_add_epi32(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator+= (SIMDVec_i const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = _mm_add_epi32(mVec[0], b.mVec[0]);
+            __m128i t1 = _mm_add_epi32(mVec[1], b.mVec[1]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_i & adda(int32_t b) {
+            mVec[0] = _mm_add_epi32(mVec[0], _mm_set1_epi32(b));
+            mVec[1] = _mm_add_epi32(mVec[1], _mm_set1_epi32(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator+= (int32_t b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVecMask<8> const & mask, int32_t b) {
+            __m128i t0 = _mm_add_epi32(mVec[0], _mm_set1_epi32(b));
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = _mm_add_epi32(mVec[1], _mm_set1_epi32(b));
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m128i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            __m128i t1 = saturatedAdd(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = saturatedAdd(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec[0], t0);
+            __m128i t2 = saturatedAdd(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = saturatedAdd(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_i(t2, t4);
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec[0] = saturatedAdd(mVec[0], b.mVec[0]);
+            mVec[1] = saturatedAdd(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = saturatedAdd(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec[0] = saturatedAdd(mVec[0], t0);
+            mVec[1] = saturatedAdd(mVec[1], t0);
+            return *this;
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<8> const & mask, int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = saturatedAdd(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // POSTINC
+        UME_FORCE_INLINE SIMDVec_i postinc() {
+            __m128i t0 = _mm_set1_epi32(1);
+            __m128i t1 = mVec[0];
+            mVec[0] = _mm_add_epi32(mVec[0], t0);
+            __m128i t2 = mVec[1];
+            mVec[1] = _mm_add_epi32(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator++ (int) {
+            return postinc();
+        }
+        // MPOSTINC
+        UME_FORCE_INLINE SIMDVec_i postinc(SIMDVecMask<8> const & mask) {
+            __m128i t0 = _mm_set1_epi32(1);
+            __m128i t1 = mVec[0];
+            __m128i t2 = _mm_add_epi32(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t2, mask.mMask[0]);
+            __m128i t3 = mVec[1];
+            __m128i t4 = _mm_add_epi32(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t4, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // PREFINC
+        UME_FORCE_INLINE SIMDVec_i & prefinc() {
+            __m128i t0 = _mm_set1_epi32(1);
+            mVec[0] = _mm_add_epi32(mVec[0], t0);
+            mVec[1] = _mm_add_epi32(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator++ () {
+            return prefinc();
+        }
+        // MPREFINC
+        UME_FORCE_INLINE SIMDVec_i & prefinc(SIMDVecMask<8> const & mask) {
+            __m128i t0 = _mm_set1_epi32(1);
+            __m128i t1 = _mm_add_epi32(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = _mm_add_epi32(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_sub_epi32(mVec[0], b.mVec[0]);
+            __m128i t1 = _mm_sub_epi32(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- (SIMDVec_i const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = _mm_sub_epi32(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = _mm_sub_epi32(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_i sub(int32_t b) const {
+            __m128i t0 = _mm_sub_epi32(mVec[0], _mm_set1_epi32(b));
+            __m128i t1 = _mm_sub_epi32(mVec[1], _mm_set1_epi32(b));
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- (int32_t b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m128i t0 = _mm_sub_epi32(mVec[0], _mm_set1_epi32(b));
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = _mm_sub_epi32(mVec[1], _mm_set1_epi32(b));
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVec_i const & b) {
+            mVec[0] = _mm_sub_epi32(mVec[0], b.mVec[0]);
+            mVec[1] = _mm_sub_epi32(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-= (SIMDVec_i const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = _mm_sub_epi32(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = _mm_sub_epi32(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_i & suba(int32_t b) {
+            mVec[0] = _mm_sub_epi32(mVec[0], _mm_set1_epi32(b));
+            mVec[1] = _mm_sub_epi32(mVec[1], _mm_set1_epi32(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-= (int32_t b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVecMask<8> const & mask, int32_t b) {
+            __m128i t0 = _mm_sub_epi32(mVec[0], _mm_set1_epi32(b));
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = _mm_sub_epi32(mVec[1], _mm_set1_epi32(b));
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m128i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            __m128i t1 = saturatedSub(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = saturatedSub(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec[0], t0);
+            __m128i t2 = saturatedSub(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = saturatedSub(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_i(t2, t4);
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec[0] = saturatedSub(mVec[0], b.mVec[0]);
+            mVec[1] = saturatedSub(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = saturatedSub(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec[0] = saturatedSub(mVec[0], t0);
+            mVec[1] = saturatedSub(mVec[1], t0);
+            return *this;
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<8> const & mask, int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = saturatedSub(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_sub_epi32(b.mVec[0], mVec[0]);
+            __m128i t1 = _mm_sub_epi32(b.mVec[1], mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = _mm_sub_epi32(b.mVec[0], mVec[0]);
+            __m128i t1 = blendv_epi8_sse(b.mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = _mm_sub_epi32(b.mVec[1], mVec[1]);
+            __m128i t3 = blendv_epi8_sse(b.mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_i subfrom(int32_t b) const {
+            __m128i t0 = _mm_sub_epi32(_mm_set1_epi32(b), mVec[0]);
+            __m128i t1 = _mm_sub_epi32(_mm_set1_epi32(b), mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_sub_epi32(t0, mVec[0]);
+            __m128i t2 = blendv_epi8_sse(t0, t1, mask.mMask[0]);
+            __m128i t3 = _mm_sub_epi32(t0, mVec[1]);
+            __m128i t4 = blendv_epi8_sse(t0, t3, mask.mMask[1]);
+            return SIMDVec_i(t2, t4);
+        }
+        // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVec_i const & b) {
+            mVec[0] = _mm_sub_epi32(b.mVec[0], mVec[0]);
+            mVec[1] = _mm_sub_epi32(b.mVec[1], mVec[1]);
+            return *this;
+        }
+        // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = _mm_sub_epi32(b.mVec[0], mVec[0]);
+            mVec[0] = blendv_epi8_sse(b.mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = _mm_sub_epi32(b.mVec[1], mVec[1]);
+            mVec[1] = blendv_epi8_sse(b.mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(int32_t b) {
+            mVec[0] = _mm_sub_epi32(_mm_set1_epi32(b), mVec[0]);
+            mVec[1] = _mm_sub_epi32(_mm_set1_epi32(b), mVec[1]);
+            return *this;
+        }
+        // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_i subfroma(SIMDVecMask<8> const & mask, int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_sub_epi32(t0, mVec[0]);
+            mVec[0] = blendv_epi8_sse(t0, t1, mask.mMask[0]);
+            __m128i t2 = _mm_sub_epi32(t0, mVec[1]);
+            mVec[1] = blendv_epi8_sse(t0, t2, mask.mMask[1]);
+            return *this;
+        }
+        // POSTDEC
+        UME_FORCE_INLINE SIMDVec_i postdec() {
+            __m128i t0 = _mm_set1_epi32(1);
+            __m128i t1 = mVec[0];
+            mVec[0] = _mm_sub_epi32(mVec[0], t0);
+            __m128i t2 = mVec[1];
+            mVec[1] = _mm_sub_epi32(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator-- (int) {
+            return postdec();
+        }
+        // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_i postdec(SIMDVecMask<8> const & mask) {
+            __m128i t0 = _mm_set1_epi32(1);
+            __m128i t1 = mVec[0];
+            __m128i t2 = _mm_sub_epi32(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t2, mask.mMask[0]);
+            __m128i t3 = mVec[1];
+            __m128i t4 = _mm_sub_epi32(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t4, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // PREFDEC
+        UME_FORCE_INLINE SIMDVec_i & prefdec() {
+            __m128i t0 = _mm_set1_epi32(1);
+            mVec[0] = _mm_sub_epi32(mVec[0], t0);
+            mVec[1] = _mm_sub_epi32(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-- () {
+            return prefdec();
+        }
+        // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_i & prefdec(SIMDVecMask<8> const & mask) {
+            __m128i t0 = _mm_set1_epi32(1);
+            __m128i t1 = _mm_sub_epi32(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = _mm_sub_epi32(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // MULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVec_i const & b) const {
+            __m128i t0 = mullo_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = mullo_epi32_sse(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (SIMDVec_i const & b) const {
+            return mul(b);
+        }
+        // MMULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = mullo_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = mullo_epi32_sse(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // MULS
+        UME_FORCE_INLINE SIMDVec_i mul(int32_t b) const {
+            __m128i t0 = mullo_epi32_sse(mVec[0], _mm_set1_epi32(b));
+            __m128i t1 = mullo_epi32_sse(mVec[1], _mm_set1_epi32(b));
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (int32_t b) const {
+            return mul(b);
+        }
+        // MMULS
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m128i t0 = mullo_epi32_sse(mVec[0], _mm_set1_epi32(b));
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = mullo_epi32_sse(mVec[1], _mm_set1_epi32(b));
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // MULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVec_i const & b) {
+            mVec[0] = mullo_epi32_sse(mVec[0], b.mVec[0]);
+            mVec[1] = mullo_epi32_sse(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (SIMDVec_i const & b) {
+            return mula(b);
+        }
+        // MMULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = mullo_epi32_sse(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = mullo_epi32_sse(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // MULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(int32_t b) {
+            mVec[0] = mullo_epi32_sse(mVec[0], _mm_set1_epi32(b));
+            mVec[1] = mullo_epi32_sse(mVec[1], _mm_set1_epi32(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (int32_t b) {
+            return mula(b);
+        }
+        // MMULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<8> const & mask, int32_t b) {
+            __m128i t0 = mullo_epi32_sse(mVec[0], _mm_set1_epi32(b));
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = mullo_epi32_sse(mVec[1], _mm_set1_epi32(b));
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // DIVV
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVec_i const & b) const {
+            __m128i t0 = divideVector(mVec[0], b.mVec[0]);
+            __m128i t1 = divideVector(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (SIMDVec_i const & b) const {
+            return div(b);
+        }
+        // MDIVV
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = divideVector(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = divideVector(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // DIVS
+        UME_FORCE_INLINE SIMDVec_i div(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = divideVector(mVec[0], t0);
+            __m128i t2 = divideVector(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (int32_t b) const {
+            return div(b);
+        }
+        // MDIVS
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = divideVector(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = divideVector(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_i(t2, t4);
+        }
+        // DIVVA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVec_i const & b) {
+            mVec[0] = divideVector(mVec[0], b.mVec[0]);
+            mVec[1] = divideVector(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDVec_i const & b) {
+            return diva(b);
+        }
+        // MDIVVA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = divideVector(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = divideVector(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // DIVSA
+        UME_FORCE_INLINE SIMDVec_i & diva(int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec[0] = divideVector(mVec[0], t0);
+            mVec[1] = divideVector(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (int32_t b) {
+            return diva(b);
+        }
+        // MDIVSA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<8> const & mask, int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = divideVector(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = divideVector(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDDivisor<int32_t> const & b) const {
+            __m128i t0 = divideMagic(mVec[0], b);
+            __m128i t1 = divideMagic(mVec[1], b);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (SIMDDivisor<int32_t> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<8> const & mask, SIMDDivisor<int32_t> const & b) const {
+            __m128i t0 = divideMagic(mVec[0], b);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = divideMagic(mVec[1], b);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDDivisor<int32_t> const & b) {
+            mVec[0] = divideMagic(mVec[0], b);
+            mVec[1] = divideMagic(mVec[1], b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDDivisor<int32_t> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<8> const & mask, SIMDDivisor<int32_t> const & b) {
+            __m128i t0 = divideMagic(mVec[0], b);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = divideMagic(mVec[1], b);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // REMV
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVec_i const & b) const {
+            __m128i t0 = remainderVector(mVec[0], b.mVec[0]);
+            __m128i t1 = remainderVector(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (SIMDVec_i const & b) const {
+            return rem(b);
+        }
+        // MREMV
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = remainderVector(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = remainderVector(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // REMS
+        UME_FORCE_INLINE SIMDVec_i rem(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = remainderVector(mVec[0], t0);
+            __m128i t2 = remainderVector(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (int32_t b) const {
+            return rem(b);
+        }
+        // MREMS
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = remainderVector(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = remainderVector(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_i(t2, t4);
+        }
+        // REMVA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVec_i const & b) {
+            mVec[0] = remainderVector(mVec[0], b.mVec[0]);
+            mVec[1] = remainderVector(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (SIMDVec_i const & b) {
+            return rema(b);
+        }
+        // MREMVA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = remainderVector(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = remainderVector(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // REMSA
+        UME_FORCE_INLINE SIMDVec_i & rema(int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec[0] = remainderVector(mVec[0], t0);
+            mVec[1] = remainderVector(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (int32_t b) {
+            return rema(b);
+        }
+        // MREMSA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<8> const & mask, int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = remainderVector(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = remainderVector(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // REMD
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDDivisor<int32_t> const & b) const {
+            __m128i t0 = remainderMagic(mVec[0], b);
+            __m128i t1 = remainderMagic(mVec[1], b);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (SIMDDivisor<int32_t> const & b) const {
+            return rem(b);
+        }
+        // MREMD
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<8> const & mask, SIMDDivisor<int32_t> const & b) const {
+            __m128i t0 = remainderMagic(mVec[0], b);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = remainderMagic(mVec[1], b);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // REMDA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDDivisor<int32_t> const & b) {
+            mVec[0] = remainderMagic(mVec[0], b);
+            mVec[1] = remainderMagic(mVec[1], b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (SIMDDivisor<int32_t> const & b) {
+            return rema(b);
+        }
+        // MREMDA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<8> const & mask, SIMDDivisor<int32_t> const & b) {
+            __m128i t0 = remainderMagic(mVec[0], b);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = remainderMagic(mVec[1], b);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // RCP
+        // MRCP
+        // RCPS
+        // MRCPS
+        // RCPA
+        // MRCPA
+        // RCPSA
+        // MRCPSA
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<8> cmpeq(SIMDVec_i const & b) const {
+            __m128i m0 = _mm_cmpeq_epi32(mVec[0], b.mVec[0]);
+            __m128i m1 = _mm_cmpeq_epi32(mVec[1], b.mVec[1]);
+            return SIMDVecMask<8>(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator==(SIMDVec_i const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<8> cmpeq(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i m0 = _mm_cmpeq_epi32(mVec[0], t0);
+            __m128i m1 = _mm_cmpeq_epi32(mVec[1], t0);
+            return SIMDVecMask<8>(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator== (int32_t b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<8> cmpne(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i m0 = _mm_cmpeq_epi32(mVec[0], b.mVec[0]);
+            __m128i m1 = _mm_xor_si128(m0, t0);
+            __m128i m2 = _mm_cmpeq_epi32(mVec[1], b.mVec[1]);
+            __m128i m3 = _mm_xor_si128(m2, t0);
+            return SIMDVecMask<8>(m1, m3);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator!= (SIMDVec_i const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<8> cmpne(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i m0 = _mm_cmpeq_epi32(mVec[0], t0);
+            __m128i m1 = _mm_xor_si128(m0, t1);
+            __m128i m2 = _mm_cmpeq_epi32(mVec[1], t0);
+            __m128i m3 = _mm_xor_si128(m2, t1);
+            return SIMDVecMask<8>(m1, m3);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator!= (int32_t b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<8> cmpgt(SIMDVec_i const & b) const {
+            __m128i m0 = _mm_cmpgt_epi32(mVec[0], b.mVec[0]);
+            __m128i m1 = _mm_cmpgt_epi32(mVec[1], b.mVec[1]);
+            return SIMDVecMask<8>(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator> (SIMDVec_i const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<8> cmpgt(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i m0 = _mm_cmpgt_epi32(mVec[0], t0);
+            __m128i m1 = _mm_cmpgt_epi32(mVec[1], t0);
+            return SIMDVecMask<8>(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator> (int32_t b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<8> cmplt(SIMDVec_i const & b) const {
+            __m128i m0 = _mm_cmpgt_epi32(b.mVec[0], mVec[0]);
+            __m128i m1 = _mm_cmpgt_epi32(b.mVec[1], mVec[1]);
+            return SIMDVecMask<8>(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator< (SIMDVec_i const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<8> cmplt(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i m0 = _mm_cmpgt_epi32(t0, mVec[0]);
+            __m128i m1 = _mm_cmpgt_epi32(t0, mVec[1]);
+            return SIMDVecMask<8>(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator< (int32_t b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<8> cmpge(SIMDVec_i const & b) const {
+            __m128i t0 = max_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i m0 = _mm_cmpeq_epi32(mVec[0], t0);
+            __m128i t1 = max_epi32_sse(mVec[1], b.mVec[1]);
+            __m128i m1 = _mm_cmpeq_epi32(mVec[1], t1);
+            return SIMDVecMask<8>(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator>= (SIMDVec_i const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<8> cmpge(int32_t b) const {
+            __m128i t0 = max_epi32_sse(mVec[0], _mm_set1_epi32(b));
+            __m128i m0 = _mm_cmpeq_epi32(mVec[0], t0);
+            __m128i t1 = max_epi32_sse(mVec[1], _mm_set1_epi32(b));
+            __m128i m1 = _mm_cmpeq_epi32(mVec[1], t1);
+            return SIMDVecMask<8>(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator>= (int32_t b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<8> cmple(SIMDVec_i const & b) const {
+            __m128i t0 = max_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i m0 = _mm_cmpeq_epi32(b.mVec[0], t0);
+            __m128i t1 = max_epi32_sse(mVec[1], b.mVec[1]);
+            __m128i m1 = _mm_cmpeq_epi32(b.mVec[1], t1);
+            return SIMDVecMask<8>(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator<= (SIMDVec_i const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<8> cmple(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = max_epi32_sse(mVec[0],t0);
+            __m128i m0 = _mm_cmpeq_epi32(t0, t1);
+            __m128i t2 = max_epi32_sse(mVec[1], t0);
+            __m128i m1 = _mm_cmpeq_epi32(t0, t2);
+            return SIMDVecMask<8>(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator<= (int32_t b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_i const & b) const {
+            __m128i m0 = _mm_cmpeq_epi32(mVec[0], b.mVec[0]);
+            __m128i m1 = _mm_cmpeq_epi32(mVec[1], b.mVec[1]);
+            return _mm_movemask_epi8(_mm_and_si128(m0, m1)) == 0xFFFF;
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i m0 = _mm_cmpeq_epi32(mVec[0], t0);
+            __m128i m1 = _mm_cmpeq_epi32(mVec[1], t0);
+            return _mm_movemask_epi8(_mm_and_si128(m0, m1)) == 0xFFFF;
+        }
+        // UNIQUE
+        UME_FORCE_INLINE bool unique() const {
+            alignas(16) int32_t raw[8];
+            _mm_store_si128((__m128i *)raw, mVec[0]);
+            _mm_store_si128((__m128i *)(raw + 4), mVec[1]);
+            for (unsigned int i = 0; i < 7; i++) {
+                for (unsigned int j = i + 1; j < 8; j++) {
+                    if (raw[i] == raw[j]) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+        // HADD
+        UME_FORCE_INLINE int32_t hadd() const {
+            __m128i t0 = _mm_add_epi32(mVec[0], mVec[1]);
+            __m128i t1 = _mm_add_epi32(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = _mm_add_epi32(t1, _mm_shuffle_epi32(t1, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t2));
+            return retval;
+        }
+        // MHADD
+        UME_FORCE_INLINE int32_t hadd(SIMDVecMask<8> const & mask) const {
+            __m128i t0 = _mm_set1_epi32(0);
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = _mm_add_epi32(t1, t2);
+            __m128i t4 = _mm_add_epi32(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = _mm_add_epi32(t4, _mm_shuffle_epi32(t4, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t5));
+            return retval;
+        }
+        // HADDS
+        UME_FORCE_INLINE int32_t hadd(int32_t b) const {
+            __m128i t0 = _mm_add_epi32(mVec[0], mVec[1]);
+            __m128i t1 = _mm_add_epi32(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = _mm_add_epi32(t1, _mm_shuffle_epi32(t1, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t2));
+            return retval + b;
+        }
+        // MHADDS
+        UME_FORCE_INLINE int32_t hadd(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(0);
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = _mm_add_epi32(t1, t2);
+            __m128i t4 = _mm_add_epi32(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = _mm_add_epi32(t4, _mm_shuffle_epi32(t4, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t5));
+            return retval + b;
+        }
+        // HMUL
+        UME_FORCE_INLINE int32_t hmul() const {
+            __m128i t0 = mullo_epi32_sse(mVec[0], mVec[1]);
+            __m128i t1 = mullo_epi32_sse(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = mullo_epi32_sse(t1, _mm_shuffle_epi32(t1, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t2));
+            return retval;
+        }
+        // MHMUL
+        UME_FORCE_INLINE int32_t hmul(SIMDVecMask<8> const & mask) const {
+            __m128i t0 = _mm_set1_epi32(1);
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = mullo_epi32_sse(t1, t2);
+            __m128i t4 = mullo_epi32_sse(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = mullo_epi32_sse(t4, _mm_shuffle_epi32(t4, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t5));
+            return retval;
+        }
+        // HMULS
+        UME_FORCE_INLINE int32_t hmul(int32_t b) const {
+            __m128i t0 = mullo_epi32_sse(mVec[0], mVec[1]);
+            __m128i t1 = mullo_epi32_sse(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = mullo_epi32_sse(t1, _mm_shuffle_epi32(t1, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t2));
+            return retval * b;
+        }
+        // MHMULS
+        UME_FORCE_INLINE int32_t hmul(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(1);
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = mullo_epi32_sse(t1, t2);
+            __m128i t4 = mullo_epi32_sse(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = mullo_epi32_sse(t4, _mm_shuffle_epi32(t4, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t5));
+            return retval * b;
+        }
+
+        // FMULADDV
+        UME_FORCE_INLINE SIMDVec_i fmuladd(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = mullo_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = _mm_add_epi32(t0, c.mVec[0]);
+            __m128i t2 = mullo_epi32_sse(mVec[1], b.mVec[1]);
+            __m128i t3 = _mm_add_epi32(t2, c.mVec[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // MFMULADDV
+        UME_FORCE_INLINE SIMDVec_i fmuladd(SIMDVecMask<8> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = mullo_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = _mm_add_epi32(t0, c.mVec[0]);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = mullo_epi32_sse(mVec[1], b.mVec[1]);
+            __m128i t4 = _mm_add_epi32(t3, c.mVec[1]);
+            __m128i t5 = blendv_epi8_sse(mVec[1], t4, mask.mMask[1]);
+            return SIMDVec_i(t2, t5);
+        }
+        // FMULSUBV
+        UME_FORCE_INLINE SIMDVec_i fmulsub(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = mullo_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = _mm_sub_epi32(t0, c.mVec[0]);
+            __m128i t2 = mullo_epi32_sse(mVec[1], b.mVec[1]);
+            __m128i t3 = _mm_sub_epi32(t2, c.mVec[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // MFMULSUBV
+        UME_FORCE_INLINE SIMDVec_i fmulsub(SIMDVecMask<8> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = mullo_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = _mm_sub_epi32(t0, c.mVec[0]);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = mullo_epi32_sse(mVec[1], b.mVec[1]);
+            __m128i t4 = _mm_sub_epi32(t3, c.mVec[1]);
+            __m128i t5 = blendv_epi8_sse(mVec[1], t4, mask.mMask[1]);
+            return SIMDVec_i(t2, t5);
+        }
+        // FADDMULV
+        UME_FORCE_INLINE SIMDVec_i faddmul(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = _mm_add_epi32(mVec[0], b.mVec[0]);
+            __m128i t1 = mullo_epi32_sse(t0, c.mVec[0]);
+            __m128i t2 = _mm_add_epi32(mVec[1], b.mVec[1]);
+            __m128i t3 = mullo_epi32_sse(t2, c.mVec[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // MFADDMULV
+        UME_FORCE_INLINE SIMDVec_i faddmul(SIMDVecMask<8> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = _mm_add_epi32(mVec[0], b.mVec[0]);
+            __m128i t1 = mullo_epi32_sse(t0, c.mVec[0]);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = _mm_add_epi32(mVec[1], b.mVec[1]);
+            __m128i t4 = mullo_epi32_sse(t3, c.mVec[1]);
+            __m128i t5 = blendv_epi8_sse(mVec[1], t4, mask.mMask[1]);
+            return SIMDVec_i(t2, t5);
+        }
+        // FSUBMULV
+        UME_FORCE_INLINE SIMDVec_i fsubmul(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = _mm_sub_epi32(mVec[0], b.mVec[0]);
+            __m128i t1 = mullo_epi32_sse(t0, c.mVec[0]);
+            __m128i t2 = _mm_sub_epi32(mVec[1], b.mVec[1]);
+            __m128i t3 = mullo_epi32_sse(t2, c.mVec[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // MFSUBMULV
+        UME_FORCE_INLINE SIMDVec_i fsubmul(SIMDVecMask<8> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = _mm_sub_epi32(mVec[0], b.mVec[0]);
+            __m128i t1 = mullo_epi32_sse(t0, c.mVec[0]);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = _mm_sub_epi32(mVec[1], b.mVec[1]);
+            __m128i t4 = mullo_epi32_sse(t3, c.mVec[1]);
+            __m128i t5 = blendv_epi8_sse(mVec[1], t4, mask.mMask[1]);
+            return SIMDVec_i(t2, t5);
+        }
+
+        // MAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVec_i const & b) const {
+            __m128i t0 = max_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = max_epi32_sse(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        // MMAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = max_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = max_epi32_sse(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // MAXS
+        UME_FORCE_INLINE SIMDVec_i max(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = max_epi32_sse(mVec[0], t0);
+            __m128i t2 = max_epi32_sse(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        // MMAXS
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = max_epi32_sse(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = max_epi32_sse(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_i(t2, t4);
+        }
+        // MAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVec_i const & b) {
+            mVec[0] = max_epi32_sse(mVec[0], b.mVec[0]);
+            mVec[1] = max_epi32_sse(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        // MMAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = max_epi32_sse(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = max_epi32_sse(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // MAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec[0] = max_epi32_sse(mVec[0], t0);
+            mVec[1] = max_epi32_sse(mVec[1], t0);
+            return *this;
+        }
+        // MMAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<8> const & mask, int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = max_epi32_sse(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = max_epi32_sse(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // MINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVec_i const & b) const {
+            __m128i t0 = min_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = min_epi32_sse(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        // MMINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = min_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = min_epi32_sse(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // MINS
+        UME_FORCE_INLINE SIMDVec_i min(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = min_epi32_sse(mVec[0], t0);
+            __m128i t2 = min_epi32_sse(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        // MMINS
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = min_epi32_sse(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = min_epi32_sse(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_i(t2, t4);
+        }
+        // MINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVec_i const & b) {
+            mVec[0] = min_epi32_sse(mVec[0], b.mVec[0]);
+            mVec[1] = min_epi32_sse(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        // MMINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = min_epi32_sse(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = min_epi32_sse(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // MINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec[0] = min_epi32_sse(mVec[0], t0);
+            mVec[1] = min_epi32_sse(mVec[1], t0);
+            return *this;
+        }
+        // MMINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<8> const & mask, int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = min_epi32_sse(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = min_epi32_sse(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // HMAX
+        UME_FORCE_INLINE int32_t hmax() const {
+            __m128i t0 = max_epi32_sse(mVec[0], mVec[1]);
+            __m128i t1 = max_epi32_sse(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = max_epi32_sse(t1, _mm_shuffle_epi32(t1, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t2));
+            return retval;
+        }
+        // MHMAX
+        UME_FORCE_INLINE int32_t hmax(SIMDVecMask<8> const & mask) const {
+            __m128i t0 = _mm_set1_epi32(std::numeric_limits<int32_t>::min());
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = max_epi32_sse(t1, t2);
+            __m128i t4 = max_epi32_sse(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = max_epi32_sse(t4, _mm_shuffle_epi32(t4, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t5));
+            return retval;
+        }
+        // IMAX
+        // MIMAX
+        // HMIN
+        UME_FORCE_INLINE int32_t hmin() const {
+            __m128i t0 = min_epi32_sse(mVec[0], mVec[1]);
+            __m128i t1 = min_epi32_sse(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = min_epi32_sse(t1, _mm_shuffle_epi32(t1, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t2));
+            return retval;
+        }
+        // MHMIN
+        UME_FORCE_INLINE int32_t hmin(SIMDVecMask<8> const & mask) const {
+            __m128i t0 = _mm_set1_epi32(std::numeric_limits<int32_t>::max());
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = min_epi32_sse(t1, t2);
+            __m128i t4 = min_epi32_sse(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = min_epi32_sse(t4, _mm_shuffle_epi32(t4, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t5));
+            return retval;
+        }
+        // IMIN
+        // MIMIN
+
+        // BANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_and_si128(mVec[0], b.mVec[0]);
+            __m128i t1 = _mm_and_si128(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator& (SIMDVec_i const & b) const {
+            return band(b);
+        }
+        // MBANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = _mm_and_si128(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = _mm_and_si128(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // BANDS
+        UME_FORCE_INLINE SIMDVec_i band(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_and_si128(mVec[0], t0);
+            __m128i t2 = _mm_and_si128(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator& (int32_t b) const {
+            return band(b);
+        }
+        // MBANDS
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_and_si128(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = _mm_and_si128(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_i(t2, t4);
+        }
+        // BANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVec_i const & b) {
+            mVec[0] = _mm_and_si128(mVec[0], b.mVec[0]);
+            mVec[1] = _mm_and_si128(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (SIMDVec_i const & b) {
+            return banda(b);
+        }
+        // MBANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = _mm_and_si128(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = _mm_and_si128(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // BANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec[0] = _mm_and_si128(mVec[0], t0);
+            mVec[1] = _mm_and_si128(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (bool b) {
+            return banda(b);
+        }
+        // MBANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<8> const & mask, int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_and_si128(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = _mm_and_si128(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // BORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_or_si128(mVec[0], b.mVec[0]);
+            __m128i t1 = _mm_or_si128(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (SIMDVec_i const & b) const {
+            return bor(b);
+        }
+        // MBORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = _mm_or_si128(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = _mm_or_si128(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // BORS
+        UME_FORCE_INLINE SIMDVec_i bor(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_or_si128(mVec[0], t0);
+            __m128i t2 = _mm_or_si128(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (int32_t b) const {
+            return bor(b);
+        }
+        // MBORS
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_or_si128(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = _mm_or_si128(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_i(t2, t4);
+        }
+        // BORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVec_i const & b) {
+            mVec[0] = _mm_or_si128(mVec[0], b.mVec[0]);
+            mVec[1] = _mm_or_si128(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (SIMDVec_i const & b) {
+            return bora(b);
+        }
+        // MBORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = _mm_or_si128(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = _mm_or_si128(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // BORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec[0] = _mm_or_si128(mVec[0], t0);
+            mVec[1] = _mm_or_si128(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (int32_t b) {
+            return bora(b);
+        }
+        // MBORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<8> const & mask, int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_or_si128(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = _mm_or_si128(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // BXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_xor_si128(mVec[0], b.mVec[0]);
+            __m128i t1 = _mm_xor_si128(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (SIMDVec_i const & b) const {
+            return bxor(b);
+        }
+        // MBXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<8> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = _mm_xor_si128(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = _mm_xor_si128(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // BXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_xor_si128(mVec[0], t0);
+            __m128i t2 = _mm_xor_si128(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (int32_t b) const {
+            return bxor(b);
+        }
+        // MBXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_xor_si128(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = _mm_xor_si128(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_i(t2, t4);
+        }
+        // BXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVec_i const & b) {
+            mVec[0] = _mm_xor_si128(mVec[0], b.mVec[0]);
+            mVec[1] = _mm_xor_si128(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (SIMDVec_i const & b) {
+            return bxora(b);
+        }
+        // MBXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<8> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = _mm_xor_si128(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = _mm_xor_si128(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // BXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec[0] = _mm_xor_si128(mVec[0], t0);
+            __m128i t1 = _mm_set1_epi32(b);
+            mVec[1] = _mm_xor_si128(mVec[1], t1);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (int32_t b) {
+            return bxora(b);
+        }
+        // MBXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<8> const & mask, int32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_xor_si128(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = _mm_xor_si128(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // BNOT
+        UME_FORCE_INLINE SIMDVec_i bnot() const {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec[0], t0);
+            __m128i t2 = _mm_xor_si128(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator~ () const {
+            return bnot();
+        }
+        // MBNOT
+        UME_FORCE_INLINE SIMDVec_i bnot(SIMDVecMask<8> const & mask) const {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = _mm_xor_si128(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_i(t2, t4);
+        }
+        // BNOTA
+        UME_FORCE_INLINE SIMDVec_i & bnota() {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            mVec[0] = _mm_xor_si128(mVec[0], t0);
+            mVec[1] = _mm_xor_si128(mVec[1], t0);
+            return *this;
+        }
+        // MBNOTA
+        UME_FORCE_INLINE SIMDVec_i bnota(SIMDVecMask<8> const & mask) {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = _mm_xor_si128(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // HBAND
+        UME_FORCE_INLINE int32_t hband() const {
+            __m128i t0 = _mm_and_si128(mVec[0], mVec[1]);
+            __m128i t1 = _mm_and_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = _mm_and_si128(t1, _mm_shuffle_epi32(t1, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t2));
+            return retval;
+        }
+        // MHBAND
+        UME_FORCE_INLINE int32_t hband(SIMDVecMask<8> const & mask) const {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = _mm_and_si128(t1, t2);
+            __m128i t4 = _mm_and_si128(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = _mm_and_si128(t4, _mm_shuffle_epi32(t4, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t5));
+            return retval;
+        }
+        // HBANDS
+        UME_FORCE_INLINE int32_t hband(int32_t b) const {
+            __m128i t0 = _mm_and_si128(mVec[0], mVec[1]);
+            __m128i t1 = _mm_and_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = _mm_and_si128(t1, _mm_shuffle_epi32(t1, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t2));
+            return retval & b;
+        }
+        // MHBANDS
+        UME_FORCE_INLINE int32_t hband(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = _mm_and_si128(t1, t2);
+            __m128i t4 = _mm_and_si128(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = _mm_and_si128(t4, _mm_shuffle_epi32(t4, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t5));
+            return retval & b;
+        }
+        // HBOR
+        UME_FORCE_INLINE int32_t hbor() const {
+            __m128i t0 = _mm_or_si128(mVec[0], mVec[1]);
+            __m128i t1 = _mm_or_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = _mm_or_si128(t1, _mm_shuffle_epi32(t1, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t2));
+            return retval;
+        }
+        // MHBOR
+        UME_FORCE_INLINE int32_t hbor(SIMDVecMask<8> const & mask) const {
+            __m128i t0 = _mm_set1_epi32(0);
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = _mm_or_si128(t1, t2);
+            __m128i t4 = _mm_or_si128(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = _mm_or_si128(t4, _mm_shuffle_epi32(t4, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t5));
+            return retval;
+        }
+        // HBORS
+        UME_FORCE_INLINE int32_t hbor(int32_t b) const {
+            __m128i t0 = _mm_or_si128(mVec[0], mVec[1]);
+            __m128i t1 = _mm_or_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = _mm_or_si128(t1, _mm_shuffle_epi32(t1, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t2));
+            return retval | b;
+        }
+        // MHBORS
+        UME_FORCE_INLINE int32_t hbor(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(0);
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = _mm_or_si128(t1, t2);
+            __m128i t4 = _mm_or_si128(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = _mm_or_si128(t4, _mm_shuffle_epi32(t4, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t5));
+            return retval | b;
+        }
+        // HBXOR
+        UME_FORCE_INLINE int32_t hbxor() const {
+            __m128i t0 = _mm_xor_si128(mVec[0], mVec[1]);
+            __m128i t1 = _mm_xor_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = _mm_xor_si128(t1, _mm_shuffle_epi32(t1, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t2));
+            return retval;
+        }
+        // MHBXOR
+        UME_FORCE_INLINE int32_t hbxor(SIMDVecMask<8> const & mask) const {
+            __m128i t0 = _mm_set1_epi32(0);
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = _mm_xor_si128(t1, t2);
+            __m128i t4 = _mm_xor_si128(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = _mm_xor_si128(t4, _mm_shuffle_epi32(t4, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t5));
+            return retval;
+        }
+        // HBXORS
+        UME_FORCE_INLINE int32_t hbxor(int32_t b) const {
+            __m128i t0 = _mm_xor_si128(mVec[0], mVec[1]);
+            __m128i t1 = _mm_xor_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = _mm_xor_si128(t1, _mm_shuffle_epi32(t1, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t2));
+            return retval ^ b;
+        }
+        // MHBXORS
+        UME_FORCE_INLINE int32_t hbxor(SIMDVecMask<8> const & mask, int32_t b) const {
+            __m128i t0 = _mm_set1_epi32(0);
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = _mm_xor_si128(t1, t2);
+            __m128i t4 = _mm_xor_si128(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = _mm_xor_si128(t4, _mm_shuffle_epi32(t4, 0xB1));
+            int32_t retval = int32_t(_mm_cvtsi128_si32(t5));
+            return retval ^ b;
+        }
+        // GATHERS
+        UME_FORCE_INLINE SIMDVec_i & gather(int32_t const * baseAddr, uint32_t const * indices) {
+            __m128i t0 = _mm_loadu_si128((__m128i*)indices);
+            mVec[0] = i32gather_epi32_sse((const int *)baseAddr, t0);
+            __m128i t1 = _mm_loadu_si128((__m128i*)(indices + 4));
+            mVec[1] = i32gather_epi32_sse((const int *)baseAddr, t1);
+            return *this;
+        }
+        // MGATHERS
+        UME_FORCE_INLINE SIMDVec_i & gather(SIMDVecMask<8> const & mask, int32_t const * baseAddr, uint32_t const * indices) {
+            __m128i t0 = _mm_loadu_si128((__m128i*)indices);
+            __m128i t1 = i32gather_epi32_sse((const int *)baseAddr, t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = _mm_loadu_si128((__m128i*)(indices + 4));
+            __m128i t3 = i32gather_epi32_sse((const int *)baseAddr, t2);
+            mVec[1] = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return *this;
+        }
+        // GATHERV
+        UME_FORCE_INLINE SIMDVec_i & gather(int32_t const * baseAddr, SIMDVec_i const & indices) {
+            mVec[0] = i32gather_epi32_sse((const int *)baseAddr, indices.mVec[0]);
+            mVec[1] = i32gather_epi32_sse((const int *)baseAddr, indices.mVec[1]);
+            return *this;
+        }
+        // MGATHERV
+        UME_FORCE_INLINE SIMDVec_i & gather(SIMDVecMask<8> const & mask, int32_t const * baseAddr, SIMDVec_i const & indices) {
+            __m128i t0 = i32gather_epi32_sse((const int *)baseAddr, indices.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = i32gather_epi32_sse((const int *)baseAddr, indices.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // SCATTERS
+        UME_FORCE_INLINE int32_t* scatter(int32_t* baseAddr, uint32_t* indices) const {
+            scatterLanes(baseAddr, mVec[0], _mm_loadu_si128((__m128i*)indices), 0xF);
+            scatterLanes(baseAddr, mVec[1], _mm_loadu_si128((__m128i*)(indices + 4)), 0xF);
+            return baseAddr;
+        }
+        // MSCATTERS
+        UME_FORCE_INLINE int32_t* scatter(SIMDVecMask<8> const & mask, int32_t* baseAddr, uint32_t* indices) const {
+            scatterLanes(baseAddr, mVec[0], _mm_loadu_si128((__m128i*)indices), _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[0])));
+            scatterLanes(baseAddr, mVec[1], _mm_loadu_si128((__m128i*)(indices + 4)), _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[1])));
+            return baseAddr;
+        }
+        // SCATTERV
+        UME_FORCE_INLINE int32_t* scatter(int32_t* baseAddr, SIMDVec_i const & indices) const {
+            scatterLanes(baseAddr, mVec[0], indices.mVec[0], 0xF);
+            scatterLanes(baseAddr, mVec[1], indices.mVec[1], 0xF);
+            return baseAddr;
+        }
+        // MSCATTERV
+        UME_FORCE_INLINE int32_t* scatter(SIMDVecMask<8> const & mask, int32_t* baseAddr, SIMDVec_i const & indices) const {
+            scatterLanes(baseAddr, mVec[0], indices.mVec[0], _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[0])));
+            scatterLanes(baseAddr, mVec[1], indices.mVec[1], _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[1])));
+            return baseAddr;
+        }
+        // SCATTERADDV
+        UME_FORCE_INLINE int32_t* scatteradd(int32_t* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
+            scatterAddLanes(baseAddr, mVec[0], indices.mVec[0], 0xF);
+            scatterAddLanes(baseAddr, mVec[1], indices.mVec[1], 0xF);
+            return baseAddr;
+        }
+        // MSCATTERADDV
+        UME_FORCE_INLINE int32_t* scatteradd(SIMDVecMask<8> const & mask, int32_t* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
+            scatterAddLanes(baseAddr, mVec[0], indices.mVec[0], _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[0])));
+            scatterAddLanes(baseAddr, mVec[1], indices.mVec[1], _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[1])));
+            return baseAddr;
+        }
+        // LSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVec_u<uint32_t, 8> const & b) const {
+            __m128i t0 = sllv_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = sllv_epi32_sse(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (SIMDVec_u<uint32_t, 8> const & b) const {
+            return lsh(b);
+        }
+        // MLSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) const {
+            __m128i t0 = sllv_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = sllv_epi32_sse(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // LSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi32(mVec[0], t0);
+            __m128i t2 = _mm_sll_epi32(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (uint32_t b) const {
+            return lsh(b);
+        }
+        // MLSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi32(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = _mm_sll_epi32(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_i(t2, t4);
+        }
+        // LSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVec_u<uint32_t, 8> const & b) {
+            mVec[0] = sllv_epi32_sse(mVec[0], b.mVec[0]);
+            mVec[1] = sllv_epi32_sse(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (SIMDVec_u<uint32_t, 8> const & b) {
+            return lsha(b);
+        }
+        // MLSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) {
+            __m128i t0 = sllv_epi32_sse(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = sllv_epi32_sse(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // LSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec[0] = _mm_sll_epi32(mVec[0], t0);
+            mVec[1] = _mm_sll_epi32(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (uint32_t b) {
+            return lsha(b);
+        }
+        // MLSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi32(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = _mm_sll_epi32(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // RSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVec_u<uint32_t, 8> const & b) const {
+            __m128i t0 = srav_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = srav_epi32_sse(mVec[1], b.mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (SIMDVec_u<uint32_t, 8> const & b) const {
+            return rsh(b);
+        }
+        // MRSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) const {
+            __m128i t0 = srav_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = srav_epi32_sse(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_i(t1, t3);
+        }
+        // RSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sra_epi32(mVec[0], t0);
+            __m128i t2 = _mm_sra_epi32(mVec[1], t0);
+            return SIMDVec_i(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (uint32_t b) const {
+            return rsh(b);
+        }
+        // MRSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sra_epi32(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = _mm_sra_epi32(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_i(t2, t4);
+        }
+        // RSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVec_u<uint32_t, 8> const & b) {
+            mVec[0] = srav_epi32_sse(mVec[0], b.mVec[0]);
+            mVec[1] = srav_epi32_sse(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (SIMDVec_u<uint32_t, 8> const & b) {
+            return rsha(b);
+        }
+        // MRSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) {
+            __m128i t0 = srav_epi32_sse(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = srav_epi32_sse(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // RSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec[0] = _mm_sra_epi32(mVec[0], t0);
+            mVec[1] = _mm_sra_epi32(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (uint32_t b) {
+            return rsha(b);
+        }
+        // MRSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sra_epi32(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = _mm_sra_epi32(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // ROLV
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVec_u<uint32_t, 8> const & b) const {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec[0], t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec[0], t2);
+            __m128i t5 = srlv_epi32_sse(mVec[0], t3);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = _mm_and_si128(b.mVec[1], t0);
+            __m128i t8 = _mm_sub_epi32(t1, t7);
+            __m128i t9 = sllv_epi32_sse(mVec[1], t7);
+            __m128i t10 = srlv_epi32_sse(mVec[1], t8);
+            __m128i t11 = _mm_or_si128(t9, t10);
+            return SIMDVec_i(t6, t11);
+        }
+        // MROLV
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) const {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec[0], t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec[0], t2);
+            __m128i t5 = srlv_epi32_sse(mVec[0], t3);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = blendv_epi8_sse(mVec[0], t6, mask.mMask[0]);
+            __m128i t8 = _mm_and_si128(b.mVec[1], t0);
+            __m128i t9 = _mm_sub_epi32(t1, t8);
+            __m128i t10 = sllv_epi32_sse(mVec[1], t8);
+            __m128i t11 = srlv_epi32_sse(mVec[1], t9);
+            __m128i t12 = _mm_or_si128(t10, t11);
+            __m128i t13 = blendv_epi8_sse(mVec[1], t12, mask.mMask[1]);
+            return SIMDVec_i(t7, t13);
+        }
+        // ROLS
+        UME_FORCE_INLINE SIMDVec_i rol(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec[0], t0);
+            __m128i t3 = _mm_srl_epi32(mVec[0], t1);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            __m128i t5 = _mm_sll_epi32(mVec[1], t0);
+            __m128i t6 = _mm_srl_epi32(mVec[1], t1);
+            __m128i t7 = _mm_or_si128(t5, t6);
+            return SIMDVec_i(t4, t7);
+        }
+        // MROLS
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec[0], t0);
+            __m128i t3 = _mm_srl_epi32(mVec[0], t1);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            __m128i t5 = blendv_epi8_sse(mVec[0], t4, mask.mMask[0]);
+            __m128i t6 = _mm_sll_epi32(mVec[1], t0);
+            __m128i t7 = _mm_srl_epi32(mVec[1], t1);
+            __m128i t8 = _mm_or_si128(t6, t7);
+            __m128i t9 = blendv_epi8_sse(mVec[1], t8, mask.mMask[1]);
+            return SIMDVec_i(t5, t9);
+        }
+        // ROLVA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVec_u<uint32_t, 8> const & b) {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec[0], t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec[0], t2);
+            __m128i t5 = srlv_epi32_sse(mVec[0], t3);
+            mVec[0] = _mm_or_si128(t4, t5);
+            __m128i t6 = _mm_and_si128(b.mVec[1], t0);
+            __m128i t7 = _mm_sub_epi32(t1, t6);
+            __m128i t8 = sllv_epi32_sse(mVec[1], t6);
+            __m128i t9 = srlv_epi32_sse(mVec[1], t7);
+            mVec[1] = _mm_or_si128(t8, t9);
+            return *this;
+        }
+        // MROLVA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec[0], t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec[0], t2);
+            __m128i t5 = srlv_epi32_sse(mVec[0], t3);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            mVec[0] = blendv_epi8_sse(mVec[0], t6, mask.mMask[0]);
+            __m128i t7 = _mm_and_si128(b.mVec[1], t0);
+            __m128i t8 = _mm_sub_epi32(t1, t7);
+            __m128i t9 = sllv_epi32_sse(mVec[1], t7);
+            __m128i t10 = srlv_epi32_sse(mVec[1], t8);
+            __m128i t11 = _mm_or_si128(t9, t10);
+            mVec[1] = blendv_epi8_sse(mVec[1], t11, mask.mMask[1]);
+            return *this;
+        }
+        // ROLSA
+        UME_FORCE_INLINE SIMDVec_i & rola(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec[0], t0);
+            __m128i t3 = _mm_srl_epi32(mVec[0], t1);
+            mVec[0] = _mm_or_si128(t2, t3);
+            __m128i t4 = _mm_sll_epi32(mVec[1], t0);
+            __m128i t5 = _mm_srl_epi32(mVec[1], t1);
+            mVec[1] = _mm_or_si128(t4, t5);
+            return *this;
+        }
+        // MROLSA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec[0], t0);
+            __m128i t3 = _mm_srl_epi32(mVec[0], t1);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            mVec[0] = blendv_epi8_sse(mVec[0], t4, mask.mMask[0]);
+            __m128i t5 = _mm_sll_epi32(mVec[1], t0);
+            __m128i t6 = _mm_srl_epi32(mVec[1], t1);
+            __m128i t7 = _mm_or_si128(t5, t6);
+            mVec[1] = blendv_epi8_sse(mVec[1], t7, mask.mMask[1]);
+            return *this;
+        }
+        // RORV
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVec_u<uint32_t, 8> const & b) const {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec[0], t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec[0], t3);
+            __m128i t5 = srlv_epi32_sse(mVec[0], t2);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = _mm_and_si128(b.mVec[1], t0);
+            __m128i t8 = _mm_sub_epi32(t1, t7);
+            __m128i t9 = sllv_epi32_sse(mVec[1], t8);
+            __m128i t10 = srlv_epi32_sse(mVec[1], t7);
+            __m128i t11 = _mm_or_si128(t9, t10);
+            return SIMDVec_i(t6, t11);
+        }
+        // MRORV
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) const {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec[0], t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec[0], t3);
+            __m128i t5 = srlv_epi32_sse(mVec[0], t2);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = blendv_epi8_sse(mVec[0], t6, mask.mMask[0]);
+            __m128i t8 = _mm_and_si128(b.mVec[1], t0);
+            __m128i t9 = _mm_sub_epi32(t1, t8);
+            __m128i t10 = sllv_epi32_sse(mVec[1], t9);
+            __m128i t11 = srlv_epi32_sse(mVec[1], t8);
+            __m128i t12 = _mm_or_si128(t10, t11);
+            __m128i t13 = blendv_epi8_sse(mVec[1], t12, mask.mMask[1]);
+            return SIMDVec_i(t7, t13);
+        }
+        // RORS
+        UME_FORCE_INLINE SIMDVec_i ror(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec[0], t1);
+            __m128i t3 = _mm_srl_epi32(mVec[0], t0);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            __m128i t5 = _mm_sll_epi32(mVec[1], t1);
+            __m128i t6 = _mm_srl_epi32(mVec[1], t0);
+            __m128i t7 = _mm_or_si128(t5, t6);
+            return SIMDVec_i(t4, t7);
+        }
+        // MRORS
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec[0], t1);
+            __m128i t3 = _mm_srl_epi32(mVec[0], t0);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            __m128i t5 = blendv_epi8_sse(mVec[0], t4, mask.mMask[0]);
+            __m128i t6 = _mm_sll_epi32(mVec[1], t1);
+            __m128i t7 = _mm_srl_epi32(mVec[1], t0);
+            __m128i t8 = _mm_or_si128(t6, t7);
+            __m128i t9 = blendv_epi8_sse(mVec[1], t8, mask.mMask[1]);
+            return SIMDVec_i(t5, t9);
+        }
+        // RORVA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVec_u<uint32_t, 8> const & b) {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec[0], t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec[0], t3);
+            __m128i t5 = srlv_epi32_sse(mVec[0], t2);
+            mVec[0] = _mm_or_si128(t4, t5);
+            __m128i t6 = _mm_and_si128(b.mVec[1], t0);
+            __m128i t7 = _mm_sub_epi32(t1, t6);
+            __m128i t8 = sllv_epi32_sse(mVec[1], t7);
+            __m128i t9 = srlv_epi32_sse(mVec[1], t6);
+            mVec[1] = _mm_or_si128(t8, t9);
+            return *this;
+        }
+        // MRORVA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVecMask<8> const & mask, SIMDVec_u<uint32_t, 8> const & b) {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec[0], t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec[0], t3);
+            __m128i t5 = srlv_epi32_sse(mVec[0], t2);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            mVec[0] = blendv_epi8_sse(mVec[0], t6, mask.mMask[0]);
+            __m128i t7 = _mm_and_si128(b.mVec[1], t0);
+            __m128i t8 = _mm_sub_epi32(t1, t7);
+            __m128i t9 = sllv_epi32_sse(mVec[1], t8);
+            __m128i t10 = srlv_epi32_sse(mVec[1], t7);
+            __m128i t11 = _mm_or_si128(t9, t10);
+            mVec[1] = blendv_epi8_sse(mVec[1], t11, mask.mMask[1]);
+            return *this;
+        }
+        // RORSA
+        UME_FORCE_INLINE SIMDVec_i & rora(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec[0], t1);
+            __m128i t3 = _mm_srl_epi32(mVec[0], t0);
+            mVec[0] = _mm_or_si128(t2, t3);
+            __m128i t4 = _mm_sll_epi32(mVec[1], t1);
+            __m128i t5 = _mm_srl_epi32(mVec[1], t0);
+            mVec[1] = _mm_or_si128(t4, t5);
+            return *this;
+        }
+        // MRORSA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec[0], t1);
+            __m128i t3 = _mm_srl_epi32(mVec[0], t0);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            mVec[0] = blendv_epi8_sse(mVec[0], t4, mask.mMask[0]);
+            __m128i t5 = _mm_sll_epi32(mVec[1], t1);
+            __m128i t6 = _mm_srl_epi32(mVec[1], t0);
+            __m128i t7 = _mm_or_si128(t5, t6);
+            mVec[1] = blendv_epi8_sse(mVec[1], t7, mask.mMask[1]);
+            return *this;
+        }
+
+        // NEG
+        UME_FORCE_INLINE SIMDVec_i operator- () const {
+            return neg();
+        }
+        // MNEG
+        // NEGA
+        // MNEGA
+        // ABS
+        UME_FORCE_INLINE SIMDVec_i abs() const {
+            __m128i t0 = abs_epi32_sse(mVec[0]);
+            __m128i t1 = abs_epi32_sse(mVec[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        // MABS
+        UME_FORCE_INLINE SIMDVec_i abs(SIMDVecMask<8> const & mask) const {
+            __m128i t0 = blendv_epi8_sse(mVec[0], abs_epi32_sse(mVec[0]), mask.mMask[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[1], abs_epi32_sse(mVec[1]), mask.mMask[1]);
+            return SIMDVec_i(t0, t1);
+        }
+        // ABSA
+        // MABSA
+
+        // PACK
+        UME_FORCE_INLINE SIMDVec_i & pack(SIMDVec_i<int32_t, 4> const & a, SIMDVec_i<int32_t, 4> const & b) {
+            mVec[0] = a.mVec;
+            mVec[1] = b.mVec;
+            return *this;
+        }
+        // PACKLO
+        UME_FORCE_INLINE SIMDVec_i & packlo(SIMDVec_i<int32_t, 4> const & a) {
+            mVec[0] = a.mVec;
+            return *this;
+        }
+        // PACKHI
+        UME_FORCE_INLINE SIMDVec_i & packhi(SIMDVec_i<int32_t, 4> const & b) {
+            mVec[1] = b.mVec;
+            return *this;
+        }
+        // UNPACK
+        UME_FORCE_INLINE void unpack(SIMDVec_i<int32_t, 4> & a, SIMDVec_i<int32_t, 4> & b) const {
+            a.mVec = mVec[0];
+            b.mVec = mVec[1];
+        }
+        // UNPACKLO
+        UME_FORCE_INLINE SIMDVec_i<int32_t, 4> unpacklo() const {
+            return SIMDVec_i<int32_t, 4>(mVec[0]);
+        }
+        // UNPACKHI
+        UME_FORCE_INLINE SIMDVec_i<int32_t, 4> unpackhi() const {
+            return SIMDVec_i<int32_t, 4>(mVec[1]);
+        }
+
+        // PROMOTE
+        UME_FORCE_INLINE operator SIMDVec_i<int64_t, 8>() const;
+        // DEGRADE
+        UME_FORCE_INLINE operator SIMDVec_i<int16_t, 8>() const;
+
+        // ITOU
+        UME_FORCE_INLINE operator SIMDVec_u<uint32_t, 8>() const;
+        // ITOF
+        UME_FORCE_INLINE operator SIMDVec_f<float, 8>() const;
+    };
+
+}
+}
+
+#endif
@@ -0,0 +1,1860 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_INT64_2_H_
+#define UME_SIMD_VEC_INT64_2_H_
+
+#include <type_traits>
+#include <immintrin.h>
+
+#include "../../../UMESimdInterface.h"
+
+
+#if defined (_MSC_VER) && !defined (__x86_64__)
+
+#define SET1_EPI64(x) \
+    _mm_setr_epi32(int(x & 0x00000000FFFFFFFF), \
+                      int((x & 0xFFFFFFFF00000000) >> 32), \
+                      int(x & 0x00000000FFFFFFFF), \
+                      int((x & 0xFFFFFFFF00000000) >> 32))
+#else
+#define SET1_EPI64(x) _mm_set1_epi64x(x)
+#endif
+
+    #define BLEND(a_128i, b_128i, mask_128i) blendv_epi8_sse((a_128i), (b_128i), (mask_128i))
+    #define MASK_LOAD(ptr_i64, mask_128i) maskload_epi64_sse((long long const *)(ptr_i64), (mask_128i))
+    #define MASK_STORE(ptr_i64, mask_128i, a_128i) maskstore_epi64_sse((long long *)(ptr_i64), (mask_128i), (a_128i))
+    #define MASK_GATHER(a_128i, ptr_i64, idx_128i, mask_128i) mask_i64gather_epi64_sse((a_128i), (long long const *)(ptr_i64), (idx_128i), (mask_128i))
+    #define MOVEMASK(mask_128i) _mm_movemask_pd(_mm_castsi128_pd(mask_128i))
+
+namespace UME {
+namespace SIMD {
+
+    template<>
+    class SIMDVec_i<int64_t, 2> :
+        public SIMDVecSignedInterface<
+            SIMDVec_i<int64_t, 2>,
+            SIMDVec_u<uint64_t, 2>,
+            int64_t,
+            2,
+            uint64_t,
+            SIMDVecMask<2>,
+            SIMDSwizzle<2>> ,
+        public SIMDVecPackableInterface<
+            SIMDVec_i<int64_t, 2>,
+            SIMDVec_i<int64_t, 1>>
+    {
+        friend class SIMDVec_u<uint64_t, 2>;
+        friend class SIMDVec_f<float, 2>;
+        friend class SIMDVec_f<double, 2>;
+
+        friend class SIMDVec_i<int64_t, 4>;
+        friend class SIMDVec_i<int64_t, 8>;
+    private:
+        __m128i mVec;
+
+        UME_FORCE_INLINE explicit SIMDVec_i(__m128i & x) { mVec = x; }
+        UME_FORCE_INLINE explicit SIMDVec_i(const __m128i & x) { mVec = x; }
+
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m128i saturatedAdd(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_add_epi64(a, b);
+            __m128i t1 = _mm_andnot_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, t0));
+            __m128i t2 = _mm_xor_si128(cmpgt_epi64_sse(_mm_setzero_si128(), a), _mm_srli_epi64(cmpeq_epi64_sse(a, a), 1));
+            return _mm_castpd_si128(blendv_pd_sse(_mm_castsi128_pd(t0), _mm_castsi128_pd(t2), _mm_castsi128_pd(_mm_shuffle_epi32(_mm_srai_epi32(t1, 31), 0xF5))));
+        }
+        static UME_FORCE_INLINE __m128i saturatedSub(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_sub_epi64(a, b);
+            __m128i t1 = _mm_and_si128(_mm_xor_si128(a, b), _mm_xor_si128(a, t0));
+            __m128i t2 = _mm_xor_si128(cmpgt_epi64_sse(_mm_setzero_si128(), a), _mm_srli_epi64(cmpeq_epi64_sse(a, a), 1));
+            return _mm_castpd_si128(blendv_pd_sse(_mm_castsi128_pd(t0), _mm_castsi128_pd(t2), _mm_castsi128_pd(_mm_shuffle_epi32(_mm_srai_epi32(t1, 31), 0xF5))));
+        }
+        // Sorting kernels used by SORTA/SORTD. With two lanes a single
+        // compare-exchange step sorts the vector.
+        static UME_FORCE_INLINE __m128i sortLanes(__m128i const & a) {
+            __m128i t0 = _mm_shuffle_epi32(a, 0x4E);
+            __m128i t1 = cmpgt_epi64_sse(a, t0);
+            __m128i t2 = blendv_epi8_sse(a, t0, t1);
+            __m128i t3 = blendv_epi8_sse(t0, a, t1);
+            return _mm_unpacklo_epi64(t2, t3);
+        }
+        static UME_FORCE_INLINE __m128i reverseLanes(__m128i const & a) {
+            return _mm_shuffle_epi32(a, 0x4E);
+        }
+        static UME_FORCE_INLINE __m128i minLanes(__m128i const & a, __m128i const & b) {
+            return blendv_epi8_sse(a, b, cmpgt_epi64_sse(a, b));
+        }
+        static UME_FORCE_INLINE __m128i maxLanes(__m128i const & a, __m128i const & b) {
+            return blendv_epi8_sse(b, a, cmpgt_epi64_sse(a, b));
+        }
+        // Low 64 bits of the product, built from 32b x 32b partial products.
+        // The result is the same for signed and unsigned operands.
+        static UME_FORCE_INLINE __m128i mulLanes(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_mul_epu32(a, b);
+            __m128i t1 = _mm_mul_epu32(_mm_srli_epi64(a, 32), b);
+            __m128i t2 = _mm_mul_epu32(a, _mm_srli_epi64(b, 32));
+            __m128i t3 = _mm_slli_epi64(_mm_add_epi64(t1, t2), 32);
+            return _mm_add_epi64(t0, t3);
+        }
+        static UME_FORCE_INLINE __m128i absLanes(__m128i const & a) {
+            __m128i t0 = cmpgt_epi64_sse(_mm_setzero_si128(), a);
+            return _mm_sub_epi64(_mm_xor_si128(a, t0), t0);
+        }
+        // SSE has no scatter instruction, so lanes selected by bits of 'm'
+        // are stored one by one.
+        static UME_FORCE_INLINE void scatterLanes(int64_t * baseAddr, __m128i const & v, __m128i const & indices, int m) {
+            if (m & 0x1) baseAddr[_mm_cvtsi128_si64(indices)] = _mm_cvtsi128_si64(v);
+            if (m & 0x2) baseAddr[extract_epi64_sse<1>(indices)] = extract_epi64_sse<1>(v);
+        }
+        // Stores lanes of 'v' selected by bits of 'm' contiguously, starting
+        // at 'p', and returns their count.
+        static UME_FORCE_INLINE uint32_t compressLanes(int64_t * p, __m128i const & v, int m) {
+            uint32_t n = 0;
+            if (m & 0x1) p[n++] = _mm_cvtsi128_si64(v);
+            if (m & 0x2) p[n++] = extract_epi64_sse<1>(v);
+            return n;
+        }
+    public:
+
+        constexpr static uint32_t length() { return 2; }
+        constexpr static uint32_t alignment() { return 16; }
+
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_i() {};
+
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_i(int64_t i) {
+            mVec = SET1_EPI64(i);
+        }
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_i(
+            T i, 
+            typename std::enable_if< std::is_fundamental<T>::value && 
+                                    !std::is_same<T, int64_t>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_i(static_cast<int64_t>(i)) {}
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVec_i(int64_t const *p) { this->load(p); };
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVec_i(int64_t i0, int64_t i1)
+        {
+            mVec = _mm_set_epi64x(i1, i0);
+        }
+        // EXTRACT
+        UME_FORCE_INLINE int64_t extract(uint32_t index) const {
+            //return extract_epi32_sse<index>(mVec); // TODO: this can be implemented in ICC
+            alignas(16) int64_t raw[2];
+            _mm_store_si128((__m128i *)raw, mVec);
+            return raw[index];
+        }
+        UME_FORCE_INLINE int64_t operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_i & insert(uint32_t index, int64_t value) {
+            alignas(16) int64_t raw[2];
+            _mm_store_si128((__m128i*)raw, mVec);
+            raw[index] = value;
+            mVec = _mm_load_si128((__m128i*)raw);
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_i, int64_t> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_i, int64_t>(index, static_cast<SIMDVec_i &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_i, int64_t, SIMDVecMask<2>> operator() (SIMDVecMask<2> const & mask) {
+            return IntermediateMask<SIMDVec_i, int64_t, SIMDVecMask<2>>(mask, static_cast<SIMDVec_i &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_i, int64_t, SIMDVecMask<2>> operator[] (SIMDVecMask<2> const & mask) {
+            return IntermediateMask<SIMDVec_i, int64_t, SIMDVecMask<2>>(mask, static_cast<SIMDVec_i &>(*this));
+        }
+#endif
+
+        // ****************************************************************************************
+        // Overloading Interface functions starts here!
+        // ****************************************************************************************
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVec_i const & b) {
+            mVec = b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator=(SIMDVec_i const & b) {
+            return assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVecMask<2> const & mask, SIMDVec_i const & b) {
+            mVec = BLEND(mVec, b.mVec, mask.mMask);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_i & assign(int64_t b) {
+            mVec = SET1_EPI64(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator= (int64_t b) {
+            return assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVecMask<2> const & mask, int64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+
+        // PREFETCH0
+        // PREFETCH1
+        // PREFETCH2
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_i & load(int64_t const * p) {
+            mVec = _mm_loadu_si128((__m128i*)p);
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<2> const & mask, int64_t const * p) {
+            __m128i t0 = MASK_LOAD(p, mask.mMask);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_i & loada(int64_t const * p) {
+            mVec = _mm_load_si128((__m128i*)p);
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<2> const & mask, int64_t const * p) {
+            __m128i t0 = _mm_load_si128((__m128i*)p);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // LOADN
+        UME_FORCE_INLINE SIMDVec_i & loadn(uint32_t n, int64_t const * p) {
+            __m128i t0 = _mm_set_epi64x(1, 0);
+            __m128i t1 = cmpgt_epi64_sse(SET1_EPI64(n < 2 ? n : 2), t0);
+            mVec = maskload_epi64_sse((long long const *)p, t1);
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE int64_t * store(int64_t * p) const {
+            _mm_storeu_si128((__m128i*) p, mVec);
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE int64_t * store(SIMDVecMask<2> const & mask, int64_t * p) const {
+            MASK_STORE(p, mask.mMask, mVec);
+            return p;
+        }
+        // STOREN
+        UME_FORCE_INLINE int64_t* storen(uint32_t n, int64_t * p) const {
+            __m128i t0 = _mm_set_epi64x(1, 0);
+            __m128i t1 = cmpgt_epi64_sse(SET1_EPI64(n < 2 ? n : 2), t0);
+            maskstore_epi64_sse((long long *)p, t1, mVec);
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE int64_t * storea(int64_t * p) const {
+            _mm_store_si128((__m128i *)p, mVec);
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE int64_t * storea(SIMDVecMask<2> const & mask, int64_t * p) const {
+            __m128i t0 = _mm_load_si128((__m128i*)p);
+            __m128i t1 = BLEND(t0, mVec, mask.mMask);
+            _mm_store_si128((__m128i*) p, t1);
+            return p;
+        }
+
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressstore(SIMDVecMask<2> const & mask, int64_t * p) const {
+            int t0 = _mm_movemask_pd(_mm_castsi128_pd(mask.mMask));
+            return compressLanes(p, mVec, t0);
+        }
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<2> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = BLEND(mVec, b.mVec, mask.mMask);
+            return SIMDVec_i(t0);
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_i swizzle(SIMDSwizzle<2> const & sMask) const {
+            alignas(16) int64_t raw[2];
+            _mm_store_si128((__m128i*)raw, mVec);
+            __m128i t0 = _mm_set_epi64x(raw[sMask[1] & 1], raw[sMask[0] & 1]);
+            return SIMDVec_i(t0);
+        }
+        template<int i0, int i1>
+        UME_FORCE_INLINE SIMDVec_i swizzle() const {
+            // Each 64-bit lane is moved as a pair of 32-bit elements.
+            __m128i t0 = _mm_shuffle_epi32(mVec, ((i0 & 1) * 0xA + 0x4) | (((i1 & 1) * 0xA + 0x4) << 4));
+            return SIMDVec_i(t0);
+        }
+        // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_i & swizzlea(SIMDSwizzle<2> const & sMask) {
+            SIMDVec_i t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
+        // SORTA
+        UME_FORCE_INLINE SIMDVec_i sorta() const {
+            __m128i t0 = sortLanes(mVec);
+            return SIMDVec_i(t0);
+        }
+        // SORTD
+        UME_FORCE_INLINE SIMDVec_i sortd() const {
+            __m128i t0 = reverseLanes(sortLanes(mVec));
+            return SIMDVec_i(t0);
+        }
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_add_epi64(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator+ (SIMDVec_i const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVecMask<2> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = _mm_add_epi64(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_i add(int64_t b) const {
+            __m128i t0 = _mm_add_epi64(mVec, SET1_EPI64(b));
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator+ (int64_t b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = _mm_add_epi64(mVec, SET1_EPI64(b));
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVec_i const & b) {
+            mVec = _mm_add_epi64(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator+= (SIMDVec_i const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVecMask<2> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = _mm_add_epi64(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_i & adda(int64_t b) {
+            mVec = _mm_add_epi64(mVec, SET1_EPI64(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator+= (int64_t b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVecMask<2> const & mask, int64_t b) {
+            __m128i t0 = _mm_add_epi64(mVec, SET1_EPI64(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<2> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec = saturatedAdd(mVec, b.mVec);
+            return *this;
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<2> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(int64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            mVec = saturatedAdd(mVec, t0);
+            return *this;
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<2> const & mask, int64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // POSTINC
+        UME_FORCE_INLINE SIMDVec_i postinc() {
+            __m128i t0 = mVec;
+            mVec = _mm_add_epi64(mVec, SET1_EPI64(1));
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator++ (int) {
+            return postinc();
+        }
+        // MPOSTINC
+        UME_FORCE_INLINE SIMDVec_i postinc(SIMDVecMask<2> const & mask) {
+            __m128i t0 = mVec;
+            __m128i t1 = _mm_add_epi64(mVec, SET1_EPI64(1));
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t0);
+        }
+        // PREFINC
+        UME_FORCE_INLINE SIMDVec_i & prefinc() {
+            mVec = _mm_add_epi64(mVec, SET1_EPI64(1));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator++ () {
+            return prefinc();
+        }
+        // MPREFINC
+        UME_FORCE_INLINE SIMDVec_i & prefinc(SIMDVecMask<2> const & mask) {
+            __m128i t0 = _mm_add_epi64(mVec, SET1_EPI64(1));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_sub_epi64(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- (SIMDVec_i const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVecMask<2> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = _mm_sub_epi64(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_i sub(int64_t b) const {
+            __m128i t0 = _mm_sub_epi64(mVec, SET1_EPI64(b));
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- (int64_t b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = _mm_sub_epi64(mVec, SET1_EPI64(b));
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVec_i const & b) {
+            mVec = _mm_sub_epi64(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-= (SIMDVec_i const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVecMask<2> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = _mm_sub_epi64(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_i & suba(int64_t b) {
+            mVec = _mm_sub_epi64(mVec, SET1_EPI64(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-= (int64_t b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVecMask<2> const & mask, int64_t b) {
+            __m128i t0 = _mm_sub_epi64(mVec, SET1_EPI64(b));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<2> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec = saturatedSub(mVec, b.mVec);
+            return *this;
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<2> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(int64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            mVec = saturatedSub(mVec, t0);
+            return *this;
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<2> const & mask, int64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_sub_epi64(b.mVec, mVec);
+            return SIMDVec_i(t0);
+        }
+        // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVecMask<2> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = _mm_sub_epi64(b.mVec, mVec);
+            __m128i t1 = BLEND(b.mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_i subfrom(int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_sub_epi64(t0, mVec);
+            return SIMDVec_i(t1);
+        }
+        // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_sub_epi64(t0, mVec);
+            __m128i t2 = BLEND(t0, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVec_i const & b) {
+            mVec = _mm_sub_epi64(b.mVec, mVec);
+            return *this;
+        }
+        // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVecMask<2> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = _mm_sub_epi64(b.mVec, mVec);
+            mVec = BLEND(b.mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(int64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            mVec = _mm_sub_epi64(t0, mVec);
+            return *this;
+        }
+        // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVecMask<2> const & mask, int64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_sub_epi64(t0, mVec);
+            mVec = BLEND(t0, t1, mask.mMask);
+            return *this;
+        }
+        // POSTDEC
+        UME_FORCE_INLINE SIMDVec_i postdec() {
+            __m128i t0 = mVec;
+            mVec = _mm_sub_epi64(mVec, SET1_EPI64(1));
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator-- (int) {
+            return postdec();
+        }
+        // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_i postdec(SIMDVecMask<2> const & mask) {
+            __m128i t0 = mVec;
+            __m128i t1 = _mm_sub_epi64(mVec, SET1_EPI64(1));
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t0);
+        }
+        // PREFDEC
+        UME_FORCE_INLINE SIMDVec_i & prefdec() {
+            mVec = _mm_sub_epi64(mVec, SET1_EPI64(1));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-- () {
+            return prefdec();
+        }
+        // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_i & prefdec(SIMDVecMask<2> const & mask) {
+            __m128i t0 = _mm_sub_epi64(mVec, SET1_EPI64(1));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVec_i const & b) const {
+            __m128i t0 = mulLanes(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (SIMDVec_i const & b) const {
+            return mul(b);
+        }
+        // MMULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<2> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = mulLanes(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // MULS
+        UME_FORCE_INLINE SIMDVec_i mul(int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = mulLanes(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (int64_t b) const {
+            return mul(b);
+        }
+        // MMULS
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = mulLanes(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // MULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVec_i const & b) {
+            mVec = mulLanes(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (SIMDVec_i const & b) {
+            return mula(b);
+        }
+        // MMULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<2> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = mulLanes(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(int64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            mVec = mulLanes(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (int64_t b) {
+            return mula(b);
+        }
+        // MMULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<2> const & mask, int64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = mulLanes(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // DIVV
+        // MDIVV
+        // DIVS
+        // MDIVS
+        // DIVVA
+        // MDIVVA
+        // DIVSA
+        // MDIVSA
+        // RCP
+        // MRCP
+        // RCPS
+        // MRCPS
+        // RCPA
+        // MRCPA
+        // RCPSA
+        // MRCPSA
+
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpeq(SIMDVec_i const & b) const {
+            __m128i t0 = cmpeq_epi64_sse(mVec, b.mVec);
+            return SIMDVecMask<2>(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator== (SIMDVec_i const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<2> cmpeq(int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = cmpeq_epi64_sse(mVec, t0);
+            return SIMDVecMask<2>(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator== (int64_t b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpne(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_xor_si128(cmpeq_epi64_sse(mVec, b.mVec), _mm_set1_epi32(-1));
+            return SIMDVecMask<2>(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator!= (SIMDVec_i const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<2> cmpne(int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_xor_si128(cmpeq_epi64_sse(mVec, t0), _mm_set1_epi32(-1));
+            return SIMDVecMask<2>(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator!= (int64_t b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpgt(SIMDVec_i const & b) const {
+            __m128i t0 = cmpgt_epi64_sse(mVec, b.mVec);
+            return SIMDVecMask<2>(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator> (SIMDVec_i const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<2> cmpgt(int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = cmpgt_epi64_sse(mVec, t0);
+            return SIMDVecMask<2>(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator> (int64_t b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<2> cmplt(SIMDVec_i const & b) const {
+            __m128i t0 = cmpgt_epi64_sse(b.mVec, mVec);
+            return SIMDVecMask<2>(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator< (SIMDVec_i const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<2> cmplt(int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = cmpgt_epi64_sse(t0, mVec);
+            return SIMDVecMask<2>(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator< (int64_t b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpge(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_xor_si128(cmpgt_epi64_sse(b.mVec, mVec), _mm_set1_epi32(-1));
+            return SIMDVecMask<2>(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator>= (SIMDVec_i const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<2> cmpge(int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_xor_si128(cmpgt_epi64_sse(t0, mVec), _mm_set1_epi32(-1));
+            return SIMDVecMask<2>(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator>= (int64_t b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<2> cmple(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_xor_si128(cmpgt_epi64_sse(mVec, b.mVec), _mm_set1_epi32(-1));
+            return SIMDVecMask<2>(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator<= (SIMDVec_i const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<2> cmple(int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_xor_si128(cmpgt_epi64_sse(mVec, t0), _mm_set1_epi32(-1));
+            return SIMDVecMask<2>(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator<= (int64_t b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_i const & b) const {
+            __m128i t0 = cmpeq_epi64_sse(mVec, b.mVec);
+            return _mm_movemask_epi8(t0) == 0xFFFF;
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(int64_t b) const {
+            __m128i t0 = cmpeq_epi64_sse(mVec, SET1_EPI64(b));
+            return _mm_movemask_epi8(t0) == 0xFFFF;
+        }
+        // UNIQUE
+        UME_FORCE_INLINE bool unique() const {
+            __m128i t0 = cmpeq_epi64_sse(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            return testz_si128_sse(t0, t0) != 0;
+        }
+        // HADD
+        UME_FORCE_INLINE int64_t hadd() const {
+            __m128i t0 = _mm_add_epi64(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t0)));
+            return retval;
+        }
+        // MHADD
+        UME_FORCE_INLINE int64_t hadd(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = BLEND(_mm_setzero_si128(), mVec, mask.mMask);
+            __m128i t1 = _mm_add_epi64(t0, _mm_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t1)));
+            return retval;
+        }
+        // HADDS
+        UME_FORCE_INLINE int64_t hadd(int64_t b) const {
+            __m128i t0 = _mm_add_epi64(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t0)));
+            return retval + b;
+        }
+        // MHADDS
+        UME_FORCE_INLINE int64_t hadd(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = BLEND(_mm_setzero_si128(), mVec, mask.mMask);
+            __m128i t1 = _mm_add_epi64(t0, _mm_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t1)));
+            return retval + b;
+        }
+        // HMUL
+        UME_FORCE_INLINE int64_t hmul() const {
+            __m128i t0 = mulLanes(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t0)));
+            return retval;
+        }
+        // MHMUL
+        UME_FORCE_INLINE int64_t hmul(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = BLEND(SET1_EPI64(1), mVec, mask.mMask);
+            __m128i t1 = mulLanes(t0, _mm_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t1)));
+            return retval;
+        }
+        // HMULS
+        UME_FORCE_INLINE int64_t hmul(int64_t b) const {
+            __m128i t0 = mulLanes(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t0)));
+            return retval * b;
+        }
+        // MHMULS
+        UME_FORCE_INLINE int64_t hmul(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = BLEND(SET1_EPI64(1), mVec, mask.mMask);
+            __m128i t1 = mulLanes(t0, _mm_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t1)));
+            return retval * b;
+        }
+        // FMULADDV
+        UME_FORCE_INLINE SIMDVec_i fmuladd(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = mulLanes(mVec, b.mVec);
+            __m128i t1 = _mm_add_epi64(t0, c.mVec);
+            return SIMDVec_i(t1);
+        }
+        // MFMULADDV
+        UME_FORCE_INLINE SIMDVec_i fmuladd(SIMDVecMask<2> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = mulLanes(mVec, b.mVec);
+            __m128i t1 = _mm_add_epi64(t0, c.mVec);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // FMULSUBV
+        UME_FORCE_INLINE SIMDVec_i fmulsub(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = mulLanes(mVec, b.mVec);
+            __m128i t1 = _mm_sub_epi64(t0, c.mVec);
+            return SIMDVec_i(t1);
+        }
+        // MFMULSUBV
+        UME_FORCE_INLINE SIMDVec_i fmulsub(SIMDVecMask<2> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = mulLanes(mVec, b.mVec);
+            __m128i t1 = _mm_sub_epi64(t0, c.mVec);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // FADDMULV
+        UME_FORCE_INLINE SIMDVec_i faddmul(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = _mm_add_epi64(mVec, b.mVec);
+            __m128i t1 = mulLanes(t0, c.mVec);
+            return SIMDVec_i(t1);
+        }
+        // MFADDMULV
+        UME_FORCE_INLINE SIMDVec_i faddmul(SIMDVecMask<2> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = _mm_add_epi64(mVec, b.mVec);
+            __m128i t1 = mulLanes(t0, c.mVec);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // FSUBMULV
+        UME_FORCE_INLINE SIMDVec_i fsubmul(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = _mm_sub_epi64(mVec, b.mVec);
+            __m128i t1 = mulLanes(t0, c.mVec);
+            return SIMDVec_i(t1);
+        }
+        // MFSUBMULV
+        UME_FORCE_INLINE SIMDVec_i fsubmul(SIMDVecMask<2> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            __m128i t0 = _mm_sub_epi64(mVec, b.mVec);
+            __m128i t1 = mulLanes(t0, c.mVec);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // MAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVec_i const & b) const {
+            __m128i t0 = maxLanes(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MMAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<2> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = maxLanes(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // MAXS
+        UME_FORCE_INLINE SIMDVec_i max(int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = maxLanes(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MMAXS
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = maxLanes(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // MAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVec_i const & b) {
+            mVec = maxLanes(mVec, b.mVec);
+            return *this;
+        }
+        // MMAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<2> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = maxLanes(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(int64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            mVec = maxLanes(mVec, t0);
+            return *this;
+        }
+        // MMAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<2> const & mask, int64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = maxLanes(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // MINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVec_i const & b) const {
+            __m128i t0 = minLanes(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        // MMINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<2> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = minLanes(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // MINS
+        UME_FORCE_INLINE SIMDVec_i min(int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = minLanes(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        // MMINS
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = minLanes(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // MINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVec_i const & b) {
+            mVec = minLanes(mVec, b.mVec);
+            return *this;
+        }
+        // MMINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<2> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = minLanes(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(int64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            mVec = minLanes(mVec, t0);
+            return *this;
+        }
+        // MMINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<2> const & mask, int64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = minLanes(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // HMAX
+        UME_FORCE_INLINE int64_t hmax() const {
+            __m128i t0 = maxLanes(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t0)));
+            return retval;
+        }
+        // MHMAX
+        UME_FORCE_INLINE int64_t hmax(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = BLEND(SET1_EPI64(std::numeric_limits<int64_t>::min()), mVec, mask.mMask);
+            __m128i t1 = maxLanes(t0, _mm_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t1)));
+            return retval;
+        }
+        // IMAX
+        // MIMAX
+        // HMIN
+        UME_FORCE_INLINE int64_t hmin() const {
+            __m128i t0 = minLanes(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t0)));
+            return retval;
+        }
+        // MHMIN
+        UME_FORCE_INLINE int64_t hmin(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = BLEND(SET1_EPI64(std::numeric_limits<int64_t>::max()), mVec, mask.mMask);
+            __m128i t1 = minLanes(t0, _mm_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t1)));
+            return retval;
+        }
+        // IMIN
+        // MIMIN
+
+        // BANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator& (SIMDVec_i const & b) const {
+            return band(b);
+        }
+        // MBANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<2> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // BANDS
+        UME_FORCE_INLINE SIMDVec_i band(int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator& (int64_t b) const {
+            return band(b);
+        }
+        // MBANDS
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // BANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVec_i const & b) {
+            mVec = _mm_and_si128(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (SIMDVec_i const & b) {
+            return banda(b);
+        }
+        // MBANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<2> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(int64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            mVec = _mm_and_si128(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (int64_t b) {
+            return banda(b);
+        }
+        // MBANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<2> const & mask, int64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // BORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (SIMDVec_i const & b) const {
+            return bor(b);
+        }
+        // MBORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<2> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // BORS
+        UME_FORCE_INLINE SIMDVec_i bor(int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (int64_t b) const {
+            return bor(b);
+        }
+        // MBORS
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // BORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVec_i const & b) {
+            mVec = _mm_or_si128(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (SIMDVec_i const & b) {
+            return bora(b);
+        }
+        // MBORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<2> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(int64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            mVec = _mm_or_si128(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (int64_t b) {
+            return bora(b);
+        }
+        // MBORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<2> const & mask, int64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // BXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVec_i const & b) const {
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (SIMDVec_i const & b) const {
+            return bxor(b);
+        }
+        // MBXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<2> const & mask, SIMDVec_i const & b) const {
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // BXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (int64_t b) const {
+            return bxor(b);
+        }
+        // MBXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // BXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVec_i const & b) {
+            mVec = _mm_xor_si128(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (SIMDVec_i const & b) {
+            return bxora(b);
+        }
+        // MBXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<2> const & mask, SIMDVec_i const & b) {
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(int64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            mVec = _mm_xor_si128(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (int64_t b) {
+            return bxora(b);
+        }
+        // MBXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<2> const & mask, int64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // BNOT
+        UME_FORCE_INLINE SIMDVec_i bnot() const {
+            __m128i t0 = _mm_xor_si128(mVec, _mm_set1_epi32(-1));
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator~ () const {
+            return bnot();
+        }
+        // MBNOT
+        UME_FORCE_INLINE SIMDVec_i bnot(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = _mm_xor_si128(mVec, _mm_set1_epi32(-1));
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // BNOTA
+        UME_FORCE_INLINE SIMDVec_i & bnota() {
+            mVec = _mm_xor_si128(mVec, _mm_set1_epi32(-1));
+            return *this;
+        }
+        // MBNOTA
+        UME_FORCE_INLINE SIMDVec_i & bnota(SIMDVecMask<2> const & mask) {
+            __m128i t0 = _mm_xor_si128(mVec, _mm_set1_epi32(-1));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // HBAND
+        UME_FORCE_INLINE int64_t hband() const {
+            __m128i t0 = _mm_and_si128(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t0)));
+            return retval;
+        }
+        // MHBAND
+        UME_FORCE_INLINE int64_t hband(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = BLEND(_mm_set1_epi32(-1), mVec, mask.mMask);
+            __m128i t1 = _mm_and_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t1)));
+            return retval;
+        }
+        // HBANDS
+        UME_FORCE_INLINE int64_t hband(int64_t b) const {
+            __m128i t0 = _mm_and_si128(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t0)));
+            return retval & b;
+        }
+        // MHBANDS
+        UME_FORCE_INLINE int64_t hband(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = BLEND(_mm_set1_epi32(-1), mVec, mask.mMask);
+            __m128i t1 = _mm_and_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t1)));
+            return retval & b;
+        }
+        // HBOR
+        UME_FORCE_INLINE int64_t hbor() const {
+            __m128i t0 = _mm_or_si128(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t0)));
+            return retval;
+        }
+        // MHBOR
+        UME_FORCE_INLINE int64_t hbor(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = BLEND(_mm_setzero_si128(), mVec, mask.mMask);
+            __m128i t1 = _mm_or_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t1)));
+            return retval;
+        }
+        // HBORS
+        UME_FORCE_INLINE int64_t hbor(int64_t b) const {
+            __m128i t0 = _mm_or_si128(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t0)));
+            return retval | b;
+        }
+        // MHBORS
+        UME_FORCE_INLINE int64_t hbor(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = BLEND(_mm_setzero_si128(), mVec, mask.mMask);
+            __m128i t1 = _mm_or_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t1)));
+            return retval | b;
+        }
+        // HBXOR
+        UME_FORCE_INLINE int64_t hbxor() const {
+            __m128i t0 = _mm_xor_si128(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t0)));
+            return retval;
+        }
+        // MHBXOR
+        UME_FORCE_INLINE int64_t hbxor(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = BLEND(_mm_setzero_si128(), mVec, mask.mMask);
+            __m128i t1 = _mm_xor_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t1)));
+            return retval;
+        }
+        // HBXORS
+        UME_FORCE_INLINE int64_t hbxor(int64_t b) const {
+            __m128i t0 = _mm_xor_si128(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t0)));
+            return retval ^ b;
+        }
+        // MHBXORS
+        UME_FORCE_INLINE int64_t hbxor(SIMDVecMask<2> const & mask, int64_t b) const {
+            __m128i t0 = BLEND(_mm_setzero_si128(), mVec, mask.mMask);
+            __m128i t1 = _mm_xor_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            int64_t retval = int64_t(_mm_cvtsi128_si64((t1)));
+            return retval ^ b;
+        }
+
+        // GATHERU
+        UME_FORCE_INLINE SIMDVec_i & gatheru(int64_t const * baseAddr, uint32_t stride) {
+            __m128i t0 = _mm_mul_epu32(_mm_set_epi64x(1, 0), SET1_EPI64(stride));
+            mVec = i64gather_epi64_sse((long long const *)baseAddr, t0);
+            return *this;
+        }
+        // MGATHERU
+        UME_FORCE_INLINE SIMDVec_i & gatheru(SIMDVecMask<2> const & mask, int64_t const * baseAddr, uint32_t stride) {
+            __m128i t0 = _mm_mul_epu32(_mm_set_epi64x(1, 0), SET1_EPI64(stride));
+            mVec = MASK_GATHER(mVec, baseAddr, t0, mask.mMask);
+            return *this;
+        }
+        // GATHERS
+        UME_FORCE_INLINE SIMDVec_i & gather(int64_t const * baseAddr, uint64_t const * indices) {
+            __m128i t0 = _mm_loadu_si128((__m128i const *)indices);
+            mVec = i64gather_epi64_sse((long long const *)baseAddr, t0);
+            return *this;
+        }
+        // MGATHERS
+        UME_FORCE_INLINE SIMDVec_i & gather(SIMDVecMask<2> const & mask, int64_t const * baseAddr, uint64_t const * indices) {
+            __m128i t0 = MASK_LOAD(indices, mask.mMask);
+            mVec = MASK_GATHER(mVec, baseAddr, t0, mask.mMask);
+            return *this;
+        }
+        // GATHERV
+        UME_FORCE_INLINE SIMDVec_i & gather(int64_t const * baseAddr, SIMDVec_u<uint64_t, 2> const & indices) {
+            mVec = i64gather_epi64_sse((long long const *)baseAddr, indices.mVec);
+            return *this;
+        }
+        // MGATHERV
+        UME_FORCE_INLINE SIMDVec_i & gather(SIMDVecMask<2> const & mask, int64_t const * baseAddr, SIMDVec_u<uint64_t, 2> const & indices) {
+            mVec = MASK_GATHER(mVec, baseAddr, indices.mVec, mask.mMask);
+            return *this;
+        }
+        // SCATTERU
+        UME_FORCE_INLINE int64_t* scatteru(int64_t* baseAddr, uint32_t stride) const {
+            __m128i t0 = _mm_mul_epu32(_mm_set_epi64x(1, 0), SET1_EPI64(stride));
+            scatterLanes(baseAddr, mVec, t0, 0x3);
+            return baseAddr;
+        }
+        // MSCATTERU
+        UME_FORCE_INLINE int64_t* scatteru(SIMDVecMask<2> const & mask, int64_t* baseAddr, uint32_t stride) const {
+            __m128i t0 = _mm_mul_epu32(_mm_set_epi64x(1, 0), SET1_EPI64(stride));
+            scatterLanes(baseAddr, mVec, t0, MOVEMASK(mask.mMask));
+            return baseAddr;
+        }
+        // SCATTERS
+        UME_FORCE_INLINE int64_t* scatter(int64_t* baseAddr, uint64_t* indices) const {
+            scatterLanes(baseAddr, mVec, _mm_loadu_si128((__m128i*)indices), 0x3);
+            return baseAddr;
+        }
+        // MSCATTERS
+        UME_FORCE_INLINE int64_t* scatter(SIMDVecMask<2> const & mask, int64_t* baseAddr, uint64_t* indices) const {
+            __m128i t0 = MASK_LOAD(indices, mask.mMask);
+            scatterLanes(baseAddr, mVec, t0, MOVEMASK(mask.mMask));
+            return baseAddr;
+        }
+        // SCATTERV
+        UME_FORCE_INLINE int64_t* scatter(int64_t* baseAddr, SIMDVec_u<uint64_t, 2> const & indices) const {
+            scatterLanes(baseAddr, mVec, indices.mVec, 0x3);
+            return baseAddr;
+        }
+        // MSCATTERV
+        UME_FORCE_INLINE int64_t* scatter(SIMDVecMask<2> const & mask, int64_t* baseAddr, SIMDVec_u<uint64_t, 2> const & indices) const {
+            scatterLanes(baseAddr, mVec, indices.mVec, MOVEMASK(mask.mMask));
+            return baseAddr;
+        }
+
+        // LSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVec_u<uint64_t, 2> const & b) const {
+            __m128i t0 = sllv_epi64_sse(mVec, b.mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (SIMDVec_u<uint64_t, 2> const & b) const {
+            return lsh(b);
+        }
+        // MLSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<2> const & mask, SIMDVec_u<uint64_t, 2> const & b) const {
+            __m128i t0 = sllv_epi64_sse(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // LSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi64(mVec, t0);
+            return SIMDVec_i(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (uint64_t b) const {
+            return lsh(b);
+        }
+        // MLSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi64(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_i(t2);
+        }
+        // LSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVec_u<uint64_t, 2> const & b) {
+            mVec = sllv_epi64_sse(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (SIMDVec_u<uint64_t, 2> const & b) {
+            return lsha(b);
+        }
+        // MLSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<2> const & mask, SIMDVec_u<uint64_t, 2> const & b) {
+            __m128i t0 = sllv_epi64_sse(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // LSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = _mm_sll_epi64(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (uint64_t b) {
+            return lsha(b);
+        }
+        // MLSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi64(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // RSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVec_u<uint64_t, 2> const & b) const {
+            __m128i t0 = _mm_setzero_si128();
+            __m128i t1 = cmpgt_epi64_sse(t0, mVec);
+            __m128i t2 = _mm_xor_si128(mVec, t1);
+            __m128i t3 = srlv_epi64_sse(t2, b.mVec);
+            __m128i t4 = _mm_xor_si128(t3, t1);
+            return SIMDVec_i(t4);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (SIMDVec_u<uint64_t, 2> const & b) const {
+            return rsh(b);
+        }
+        // MRSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<2> const & mask, SIMDVec_u<uint64_t, 2> const & b) const {
+            __m128i t0 = _mm_setzero_si128();
+            __m128i t1 = cmpgt_epi64_sse(t0, mVec);
+            __m128i t2 = _mm_xor_si128(mVec, t1);
+            __m128i t3 = srlv_epi64_sse(t2, b.mVec);
+            __m128i t4 = _mm_xor_si128(t3, t1);
+            __m128i t5 = BLEND(mVec, t4, mask.mMask);
+            return SIMDVec_i(t5);
+        }
+        // RSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_setzero_si128();
+            __m128i t2 = cmpgt_epi64_sse(t1, mVec);
+            __m128i t3 = _mm_xor_si128(mVec, t2);
+            __m128i t4 = _mm_srl_epi64(t3, t0);
+            __m128i t5 = _mm_xor_si128(t4, t2);
+            return SIMDVec_i(t5);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (uint64_t b) const {
+            return rsh(b);
+        }
+        // MRSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_setzero_si128();
+            __m128i t2 = cmpgt_epi64_sse(t1, mVec);
+            __m128i t3 = _mm_xor_si128(mVec, t2);
+            __m128i t4 = _mm_srl_epi64(t3, t0);
+            __m128i t5 = _mm_xor_si128(t4, t2);
+            __m128i t6 = BLEND(mVec, t5, mask.mMask);
+            return SIMDVec_i(t6);
+        }
+        // RSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVec_u<uint64_t, 2> const & b) {
+            __m128i t0 = _mm_setzero_si128();
+            __m128i t1 = cmpgt_epi64_sse(t0, mVec);
+            __m128i t2 = _mm_xor_si128(mVec, t1);
+            __m128i t3 = srlv_epi64_sse(t2, b.mVec);
+            mVec = _mm_xor_si128(t3, t1);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (SIMDVec_u<uint64_t, 2> const & b) {
+            return rsha(b);
+        }
+        // MRSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<2> const & mask, SIMDVec_u<uint64_t, 2> const & b) {
+            __m128i t0 = _mm_setzero_si128();
+            __m128i t1 = cmpgt_epi64_sse(t0, mVec);
+            __m128i t2 = _mm_xor_si128(mVec, t1);
+            __m128i t3 = srlv_epi64_sse(t2, b.mVec);
+            __m128i t4 = _mm_xor_si128(t3, t1);
+            mVec = BLEND(mVec, t4, mask.mMask);
+            return *this;
+        }
+        // RSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_setzero_si128();
+            __m128i t2 = cmpgt_epi64_sse(t1, mVec);
+            __m128i t3 = _mm_xor_si128(mVec, t2);
+            __m128i t4 = _mm_srl_epi64(t3, t0);
+            mVec = _mm_xor_si128(t4, t2);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (uint64_t b) {
+            return rsha(b);
+        }
+        // MRSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_setzero_si128();
+            __m128i t2 = cmpgt_epi64_sse(t1, mVec);
+            __m128i t3 = _mm_xor_si128(mVec, t2);
+            __m128i t4 = _mm_srl_epi64(t3, t0);
+            __m128i t5 = _mm_xor_si128(t4, t2);
+            mVec = BLEND(mVec, t5, mask.mMask);
+            return *this;
+        }
+        // ROLV
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVec_u<uint64_t, 2> const & b) const {
+            __m128i t0 = SET1_EPI64(63);
+            __m128i t1 = SET1_EPI64(64);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi64(t1, t2);
+            __m128i t4 = sllv_epi64_sse(mVec, t2);
+            __m128i t5 = srlv_epi64_sse(mVec, t3);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            return SIMDVec_i(t6);
+        }
+        // MROLV
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVecMask<2> const & mask, SIMDVec_u<uint64_t, 2> const & b) const {
+            __m128i t0 = SET1_EPI64(63);
+            __m128i t1 = SET1_EPI64(64);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi64(t1, t2);
+            __m128i t4 = sllv_epi64_sse(mVec, t2);
+            __m128i t5 = srlv_epi64_sse(mVec, t3);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = BLEND(mVec, t6, mask.mMask);
+            return SIMDVec_i(t7);
+        }
+        // ROLS
+        UME_FORCE_INLINE SIMDVec_i rol(uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m128i t2 = _mm_sll_epi64(mVec, t0);
+            __m128i t3 = _mm_srl_epi64(mVec, t1);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            return SIMDVec_i(t4);
+        }
+        // MROLS
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m128i t2 = _mm_sll_epi64(mVec, t0);
+            __m128i t3 = _mm_srl_epi64(mVec, t1);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            __m128i t5 = BLEND(mVec, t4, mask.mMask);
+            return SIMDVec_i(t5);
+        }
+        // ROLVA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVec_u<uint64_t, 2> const & b) {
+            __m128i t0 = SET1_EPI64(63);
+            __m128i t1 = SET1_EPI64(64);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi64(t1, t2);
+            __m128i t4 = sllv_epi64_sse(mVec, t2);
+            __m128i t5 = srlv_epi64_sse(mVec, t3);
+            mVec = _mm_or_si128(t4, t5);
+            return *this;
+        }
+        // MROLVA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVecMask<2> const & mask, SIMDVec_u<uint64_t, 2> const & b) {
+            __m128i t0 = SET1_EPI64(63);
+            __m128i t1 = SET1_EPI64(64);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi64(t1, t2);
+            __m128i t4 = sllv_epi64_sse(mVec, t2);
+            __m128i t5 = srlv_epi64_sse(mVec, t3);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            mVec = BLEND(mVec, t6, mask.mMask);
+            return *this;
+        }
+        // ROLSA
+        UME_FORCE_INLINE SIMDVec_i & rola(uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m128i t2 = _mm_sll_epi64(mVec, t0);
+            __m128i t3 = _mm_srl_epi64(mVec, t1);
+            mVec = _mm_or_si128(t2, t3);
+            return *this;
+        }
+        // MROLSA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m128i t2 = _mm_sll_epi64(mVec, t0);
+            __m128i t3 = _mm_srl_epi64(mVec, t1);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            mVec = BLEND(mVec, t4, mask.mMask);
+            return *this;
+        }
+        // RORV
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVec_u<uint64_t, 2> const & b) const {
+            __m128i t0 = SET1_EPI64(63);
+            __m128i t1 = SET1_EPI64(64);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi64(t1, t2);
+            __m128i t4 = sllv_epi64_sse(mVec, t3);
+            __m128i t5 = srlv_epi64_sse(mVec, t2);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            return SIMDVec_i(t6);
+        }
+        // MRORV
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVecMask<2> const & mask, SIMDVec_u<uint64_t, 2> const & b) const {
+            __m128i t0 = SET1_EPI64(63);
+            __m128i t1 = SET1_EPI64(64);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi64(t1, t2);
+            __m128i t4 = sllv_epi64_sse(mVec, t3);
+            __m128i t5 = srlv_epi64_sse(mVec, t2);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = BLEND(mVec, t6, mask.mMask);
+            return SIMDVec_i(t7);
+        }
+        // RORS
+        UME_FORCE_INLINE SIMDVec_i ror(uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m128i t2 = _mm_sll_epi64(mVec, t1);
+            __m128i t3 = _mm_srl_epi64(mVec, t0);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            return SIMDVec_i(t4);
+        }
+        // MRORS
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m128i t2 = _mm_sll_epi64(mVec, t1);
+            __m128i t3 = _mm_srl_epi64(mVec, t0);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            __m128i t5 = BLEND(mVec, t4, mask.mMask);
+            return SIMDVec_i(t5);
+        }
+        // RORVA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVec_u<uint64_t, 2> const & b) {
+            __m128i t0 = SET1_EPI64(63);
+            __m128i t1 = SET1_EPI64(64);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi64(t1, t2);
+            __m128i t4 = sllv_epi64_sse(mVec, t3);
+            __m128i t5 = srlv_epi64_sse(mVec, t2);
+            mVec = _mm_or_si128(t4, t5);
+            return *this;
+        }
+        // MRORVA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVecMask<2> const & mask, SIMDVec_u<uint64_t, 2> const & b) {
+            __m128i t0 = SET1_EPI64(63);
+            __m128i t1 = SET1_EPI64(64);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi64(t1, t2);
+            __m128i t4 = sllv_epi64_sse(mVec, t3);
+            __m128i t5 = srlv_epi64_sse(mVec, t2);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            mVec = BLEND(mVec, t6, mask.mMask);
+            return *this;
+        }
+        // RORSA
+        UME_FORCE_INLINE SIMDVec_i & rora(uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m128i t2 = _mm_sll_epi64(mVec, t1);
+            __m128i t3 = _mm_srl_epi64(mVec, t0);
+            mVec = _mm_or_si128(t2, t3);
+            return *this;
+        }
+        // MRORSA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m128i t2 = _mm_sll_epi64(mVec, t1);
+            __m128i t3 = _mm_srl_epi64(mVec, t0);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            mVec = BLEND(mVec, t4, mask.mMask);
+            return *this;
+        }
+
+        // NEG
+        UME_FORCE_INLINE SIMDVec_i neg() const {
+            __m128i t0 = _mm_sub_epi64(_mm_setzero_si128(), mVec);
+            return SIMDVec_i(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- () const {
+            return neg();
+        }
+        // MNEG
+        UME_FORCE_INLINE SIMDVec_i neg(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = _mm_sub_epi64(_mm_setzero_si128(), mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // NEGA
+        UME_FORCE_INLINE SIMDVec_i & nega() {
+            mVec = _mm_sub_epi64(_mm_setzero_si128(), mVec);
+            return *this;
+        }
+        // MNEGA
+        UME_FORCE_INLINE SIMDVec_i & nega(SIMDVecMask<2> const & mask) {
+            __m128i t0 = _mm_sub_epi64(_mm_setzero_si128(), mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // ABS
+        UME_FORCE_INLINE SIMDVec_i abs() const {
+            __m128i t0 = absLanes(mVec);
+            return SIMDVec_i(t0);
+        }
+        // MABS
+        UME_FORCE_INLINE SIMDVec_i abs(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = absLanes(mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_i(t1);
+        }
+        // ABSA
+        UME_FORCE_INLINE SIMDVec_i & absa() {
+            mVec = absLanes(mVec);
+            return *this;
+        }
+        // MABSA
+        UME_FORCE_INLINE SIMDVec_i & absa(SIMDVecMask<2> const & mask) {
+            __m128i t0 = absLanes(mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+
+        // PACK
+        UME_FORCE_INLINE SIMDVec_i & pack(SIMDVec_i<int64_t, 1> const & a, SIMDVec_i<int64_t, 1> const & b) {
+            mVec = _mm_set_epi64x(b[0], a[0]);
+            return *this;
+        }
+        // PACKLO
+        UME_FORCE_INLINE SIMDVec_i & packlo(SIMDVec_i<int64_t, 1> const & a) {
+            mVec = _mm_set_epi64x(extract_epi64_sse<1>(mVec), a[0]);
+            return *this;
+        }
+        // PACKHI
+        UME_FORCE_INLINE SIMDVec_i & packhi(SIMDVec_i<int64_t, 1> const & b) {
+            mVec = _mm_set_epi64x(b[0], _mm_cvtsi128_si64(mVec));
+            return *this;
+        }
+        // UNPACK
+        UME_FORCE_INLINE void unpack(SIMDVec_i<int64_t, 1> & a, SIMDVec_i<int64_t, 1> & b) const {
+            a = SIMDVec_i<int64_t, 1>(int64_t(_mm_cvtsi128_si64(mVec)));
+            b = SIMDVec_i<int64_t, 1>(int64_t(extract_epi64_sse<1>(mVec)));
+        }
+        // UNPACKLO
+        UME_FORCE_INLINE SIMDVec_i<int64_t, 1> unpacklo() const {
+            return SIMDVec_i<int64_t, 1>(int64_t(_mm_cvtsi128_si64(mVec)));
+        }
+        // UNPACKHI
+        UME_FORCE_INLINE SIMDVec_i<int64_t, 1> unpackhi() const {
+            return SIMDVec_i<int64_t, 1>(int64_t(extract_epi64_sse<1>(mVec)));
+        }
+
+        // PROMOTE
+        // -
+        // DEGRADE
+        UME_FORCE_INLINE operator SIMDVec_i<int32_t, 2>() const;
+
+        // ITOU
+        UME_FORCE_INLINE operator SIMDVec_u<uint64_t, 2>() const;
+        // ITOF
+        UME_FORCE_INLINE operator SIMDVec_f<double, 2>() const;
+    };
+
+}
+}
+
+#undef SET1_EPI64
+#undef BLEND
+#undef MASK_LOAD
+#undef MASK_STORE
+#undef MASK_GATHER
+#undef MOVEMASK
+
+#endif
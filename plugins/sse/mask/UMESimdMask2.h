@@ -0,0 +1,300 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_MASK_2_H_
+#define UME_SIMD_MASK_2_H_
+
+#include "UMESimdMaskPrototype.h"
+
+namespace UME {
+namespace SIMD {
+
+    template<>
+    class SIMDVecMask<2> :
+        public SIMDMaskBaseInterface<
+            SIMDVecMask<2>,
+            uint32_t,
+            2>
+    {
+        static uint32_t TRUE_VAL() { return 0xFFFFFFFF; };
+        static uint32_t FALSE_VAL() { return 0x00000000; };
+
+        // This function returns internal representation of boolean value based on bool input
+        static UME_FORCE_INLINE uint32_t toMaskBool(bool m) { if (m == true) return TRUE_VAL(); else return FALSE_VAL(); }
+
+        friend class SIMDVec_u<uint32_t, 2>;
+        friend class SIMDVec_u<uint64_t, 2>;
+        friend class SIMDVec_i<int32_t, 2>;
+        friend class SIMDVec_i<int64_t, 2>;
+        friend class SIMDVec_f<float, 2>;
+        friend class SIMDVec_f<double, 2>;
+    private:
+        __m128i mMask;
+
+        UME_FORCE_INLINE explicit SIMDVecMask(__m128i const & x) { mMask = x; };
+    public:
+        constexpr static uint32_t length() { return 2; }
+        constexpr static uint32_t alignment() { return 16; }
+        UME_FORCE_INLINE SIMDVecMask() {}
+
+        // Regardless of the mask representation, the interface should only allow initialization using 
+        // standard bool or using equivalent mask
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVecMask(bool m) {
+            mMask = _mm_set1_epi32(toMaskBool(m));
+        }
+
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVecMask(bool const *p) {
+            load(p);
+        }
+        // FULL-CONSTR
+        UME_FORCE_INLINE explicit SIMDVecMask(bool m0, bool m1) {
+            mMask = _mm_set_epi32(toMaskBool(m1), toMaskBool(m1),
+                toMaskBool(m0), toMaskBool(m0));
+        }
+
+        UME_FORCE_INLINE SIMDVecMask(SIMDVecMask const & mask) {
+            mMask = mask.mMask;
+        }
+        // PREFIX
+        static UME_FORCE_INLINE SIMDVecMask prefix(uint32_t n) {
+            __m128i t0 = _mm_set1_epi32(n < 2 ? int32_t(n) : 2);
+            __m128i t1 = _mm_setr_epi32(0, 0, 1, 1);
+            return SIMDVecMask(_mm_cmpgt_epi32(t0, t1));
+        }
+        // EXTRACT
+        UME_FORCE_INLINE bool extract(uint32_t index) const {
+            alignas(16) uint64_t raw[2];
+            _mm_store_si128((__m128i*)raw, mMask);
+            return raw[index] != 0;
+        }
+        UME_FORCE_INLINE bool operator[] (uint32_t index) const {
+            return extract(index);
+        }
+        // INSERT
+        UME_FORCE_INLINE void insert(uint32_t index, bool x) {
+            alignas(16) uint64_t raw[2];
+            _mm_store_si128((__m128i*)raw, mMask);
+            raw[index] = x ? uint64_t(-1) : 0;
+            mMask = _mm_load_si128((__m128i*)raw);
+        }
+        // LOAD
+        UME_FORCE_INLINE SIMDVecMask & load(bool const * p) {
+            alignas(16) uint64_t raw[2];
+            for (int i = 0; i < 2; i++) {
+                raw[i] = p[i] ? uint64_t(-1) : 0;
+            }
+            mMask = _mm_load_si128((__m128i*)raw);
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVecMask & loada(bool const * p) {
+            alignas(16) uint64_t raw[2];
+            for (int i = 0; i < 2; i++) {
+                raw[i] = p[i] ? uint64_t(-1) : 0;
+            }
+            mMask = _mm_load_si128((__m128i*)raw);
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE bool* store(bool * p) const {
+            alignas(16) uint64_t raw[2];
+            _mm_store_si128((__m128i*)raw, mMask);
+            for (int i = 0; i < 2; i++) {
+                p[i] = raw[i] != 0;
+            }
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE bool* storea(bool * p) const {
+            alignas(16) uint64_t raw[2];
+            _mm_store_si128((__m128i*)raw, mMask);
+            for (int i = 0; i < 2; i++) {
+                p[i] = raw[i] != 0;
+            }
+            return p;
+        }
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVecMask & operator= (SIMDVecMask const & x) {
+            mMask = x.mMask;
+            return *this;
+        }
+        // LANDV
+        UME_FORCE_INLINE SIMDVecMask land(SIMDVecMask const & b) const {
+            __m128i t0 = _mm_and_si128(mMask, b.mMask);
+            return SIMDVecMask(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator& (SIMDVecMask const & b) const {
+            return land(b);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator&& (SIMDVecMask const & b) const {
+            return land(b);
+        }
+        // LANDS
+        UME_FORCE_INLINE SIMDVecMask land(bool b) const {
+            __m128i t0 = _mm_set1_epi32(toMaskBool(b));
+            __m128i t1 = _mm_and_si128(mMask, t0);
+            return SIMDVecMask(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator& (bool b) const {
+            return land(b);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator&& (bool b) const {
+            return land(b);
+        }
+        // LANDVA
+        UME_FORCE_INLINE SIMDVecMask & landa(SIMDVecMask const & b) {
+            mMask = _mm_and_si128(mMask, b.mMask);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator&= (SIMDVecMask const & b) {
+            return landa(b);
+        }
+        // LANDSA
+        UME_FORCE_INLINE SIMDVecMask & landa(bool b) {
+            __m128i t0 = _mm_set1_epi32(toMaskBool(b));
+            mMask = _mm_and_si128(mMask, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator&= (bool b) {
+            return landa(b);
+        }
+        // LORV
+        UME_FORCE_INLINE SIMDVecMask lor(SIMDVecMask const & b) const {
+            __m128i t0 = _mm_or_si128(mMask, b.mMask);
+            return SIMDVecMask(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator| (SIMDVecMask const & b) const {
+            return lor(b);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator|| (SIMDVecMask const & b) const {
+            return lor(b);
+        }
+        // LORS
+        UME_FORCE_INLINE SIMDVecMask lor(bool b) const {
+            __m128i t0 = _mm_set1_epi32(toMaskBool(b));
+            __m128i t1 = _mm_or_si128(mMask, t0);
+            return SIMDVecMask(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator| (bool b) const {
+            return lor(b);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator|| (bool b) const {
+            return lor(b);
+        }
+        // LORVA
+        UME_FORCE_INLINE SIMDVecMask & lora(SIMDVecMask const & b) {
+            mMask = _mm_or_si128(mMask, b.mMask);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator|= (SIMDVecMask const & b) {
+            return lora(b);
+        }
+        // LORSA
+        UME_FORCE_INLINE SIMDVecMask & lora(bool b) {
+            __m128i t0 = _mm_set1_epi32(toMaskBool(b));
+            mMask = _mm_or_si128(mMask, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator|= (bool b) {
+            return lora(b);
+        }
+        // LXORV
+        UME_FORCE_INLINE SIMDVecMask lxor(SIMDVecMask const & b) const {
+            __m128i t0 = _mm_xor_si128(mMask, b.mMask);
+            return SIMDVecMask(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator^ (SIMDVecMask const & b) const {
+            return lxor(b);
+        }
+        // LXORS
+        UME_FORCE_INLINE SIMDVecMask lxor(bool b) const {
+            __m128i t0 = _mm_set1_epi32(toMaskBool(b));
+            __m128i t1 = _mm_xor_si128(mMask, t0);
+            return SIMDVecMask(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator^ (bool b) const {
+            return lxor(b);
+        }
+        // LXORVA
+        UME_FORCE_INLINE SIMDVecMask & lxora(SIMDVecMask const & b) {
+            mMask = _mm_xor_si128(mMask, b.mMask);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator^= (SIMDVecMask const & b) {
+            return lxora(b);
+        }
+        // LXORSA
+        UME_FORCE_INLINE SIMDVecMask & lxora(bool b) {
+            __m128i t0 = _mm_set1_epi32(toMaskBool(b));
+            mMask = _mm_xor_si128(mMask, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator^= (bool b) {
+            return lxora(b);
+        }
+        // LNOT
+        UME_FORCE_INLINE SIMDVecMask lnot() const {
+            __m128i t0 = _mm_set1_epi32(TRUE_VAL());
+            __m128i t1 = _mm_xor_si128(mMask, t0);
+            return SIMDVecMask(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator! () const {
+            return lnot();
+        }
+        // LNOTA
+        UME_FORCE_INLINE SIMDVecMask & lnota() {
+            __m128i t0 = _mm_set1_epi32(TRUE_VAL());
+            mMask = _mm_xor_si128(mMask, t0);
+            return *this;
+        }
+        // HLAND
+        UME_FORCE_INLINE bool hland() const {
+            int t0 = _mm_movemask_pd(_mm_castsi128_pd(mMask));
+            return t0 == 0x3;
+        }
+        // HLOR
+        UME_FORCE_INLINE bool hlor() const {
+            int t0 = _mm_movemask_pd(_mm_castsi128_pd(mMask));
+            return t0 != 0;
+        }
+        // HLXOR
+        UME_FORCE_INLINE bool hlxor() const {
+            int t0 = _mm_movemask_pd(_mm_castsi128_pd(mMask));
+            t0 ^= t0 >> 1;
+            return (t0 & 1) != 0;
+        }
+    };
+
+}
+}
+
+#endif
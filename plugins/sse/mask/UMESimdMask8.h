@@ -0,0 +1,343 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_MASK_8_H_
+#define UME_SIMD_MASK_8_H_
+
+#include "UMESimdMaskPrototype.h"
+
+namespace UME {
+namespace SIMD {
+
+    template<>
+    class SIMDVecMask<8> :
+        public SIMDMaskBaseInterface<
+            SIMDVecMask<8>,
+            uint32_t,
+            8>
+    {
+        static uint32_t TRUE_VAL() { return 0xFFFFFFFF; };
+        static uint32_t FALSE_VAL() { return 0x00000000; };
+
+        // This function returns internal representation of boolean value based on bool input
+        static UME_FORCE_INLINE uint32_t toMaskBool(bool m) { if (m == true) return TRUE_VAL(); else return FALSE_VAL(); }
+
+        friend class SIMDVec_u<uint8_t, 8>;
+        friend class SIMDVec_u<uint16_t, 8>;
+        friend class SIMDVec_u<uint32_t, 8>;
+        friend class SIMDVec_u<uint64_t, 8>;
+        friend class SIMDVec_i<int8_t, 8>;
+        friend class SIMDVec_i<int16_t, 8>;
+        friend class SIMDVec_i<int32_t, 8>;
+        friend class SIMDVec_i<int64_t, 8>;
+        friend class SIMDVec_f<float, 8>;
+        friend class SIMDVec_f<double, 8>;
+    private:
+        __m128i mMask[2];
+
+        UME_FORCE_INLINE SIMDVecMask(__m128i const & x0, __m128i const & x1) { mMask[0] = x0; mMask[1] = x1; };
+
+        // Conversions between 32-bit lane masks and the 16-bit lane layout
+        // used by 16-bit vectors.
+        UME_FORCE_INLINE __m128i toEpi16() const {
+            return _mm_packs_epi32(mMask[0], mMask[1]);
+        }
+        static UME_FORCE_INLINE SIMDVecMask fromEpi16(__m128i const & x) {
+            return SIMDVecMask(_mm_unpacklo_epi16(x, x), _mm_unpackhi_epi16(x, x));
+        }
+    public:
+        constexpr static uint32_t length() { return 8; }
+        constexpr static uint32_t alignment() { return 16; }
+        UME_FORCE_INLINE SIMDVecMask() {}
+
+        // Regardless of the mask representation, the interface should only allow initialization using 
+        // standard bool or using equivalent mask
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVecMask(bool m) {
+            mMask[0] = _mm_set1_epi32(toMaskBool(m));
+            mMask[1] = _mm_set1_epi32(toMaskBool(m));
+        }
+
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVecMask(bool const *p) {
+            load(p);
+        }
+        // FULL-CONSTR
+        UME_FORCE_INLINE explicit SIMDVecMask(bool m0, bool m1, bool m2, bool m3,
+            bool m4, bool m5, bool m6, bool m7) {
+            mMask[0] = _mm_setr_epi32(toMaskBool(m0), toMaskBool(m1),
+                toMaskBool(m2), toMaskBool(m3));
+            mMask[1] = _mm_setr_epi32(toMaskBool(m4), toMaskBool(m5),
+                toMaskBool(m6), toMaskBool(m7));
+        }
+
+        UME_FORCE_INLINE SIMDVecMask(SIMDVecMask const & mask) {
+            mMask[0] = mask.mMask[0];
+            mMask[1] = mask.mMask[1];
+        }
+        // PREFIX
+        static UME_FORCE_INLINE SIMDVecMask prefix(uint32_t n) {
+            __m128i t0 = _mm_set1_epi32(n < 8 ? int32_t(n) : 8);
+            __m128i t1 = _mm_setr_epi32(0, 1, 2, 3);
+            __m128i t2 = _mm_setr_epi32(4, 5, 6, 7);
+            return SIMDVecMask(_mm_cmpgt_epi32(t0, t1), _mm_cmpgt_epi32(t0, t2));
+        }
+        // EXTRACT
+        UME_FORCE_INLINE bool extract(uint32_t index) const {
+            alignas(16) uint32_t raw[8];
+            _mm_store_si128((__m128i*)raw, mMask[0]);
+            _mm_store_si128((__m128i*)(raw + 4), mMask[1]);
+            return raw[index] != 0;
+        }
+        UME_FORCE_INLINE bool operator[] (uint32_t index) const {
+            return extract(index);
+        }
+        // INSERT
+        UME_FORCE_INLINE void insert(uint32_t index, bool x) {
+            alignas(16) uint32_t raw[8];
+            _mm_store_si128((__m128i*)raw, mMask[0]);
+            _mm_store_si128((__m128i*)(raw + 4), mMask[1]);
+            raw[index] = toMaskBool(x);
+            mMask[0] = _mm_load_si128((__m128i*)raw);
+            mMask[1] = _mm_load_si128((__m128i*)(raw + 4));
+        }
+        // LOAD
+        UME_FORCE_INLINE SIMDVecMask & load(bool const * p) {
+            alignas(16) uint32_t raw[8];
+            for (int i = 0; i < 8; i++) {
+                raw[i] = toMaskBool(p[i]);
+            }
+            mMask[0] = _mm_load_si128((__m128i*)raw);
+            mMask[1] = _mm_load_si128((__m128i*)(raw + 4));
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVecMask & loada(bool const * p) {
+            alignas(16) uint32_t raw[8];
+            for (int i = 0; i < 8; i++) {
+                raw[i] = toMaskBool(p[i]);
+            }
+            mMask[0] = _mm_load_si128((__m128i*)raw);
+            mMask[1] = _mm_load_si128((__m128i*)(raw + 4));
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE bool* store(bool * p) const {
+            alignas(16) uint32_t raw[8];
+            _mm_store_si128((__m128i*)raw, mMask[0]);
+            _mm_store_si128((__m128i*)(raw + 4), mMask[1]);
+            for (int i = 0; i < 8; i++) {
+                p[i] = raw[i] != 0;
+            }
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE bool* storea(bool * p) const {
+            alignas(16) uint32_t raw[8];
+            _mm_store_si128((__m128i*)raw, mMask[0]);
+            _mm_store_si128((__m128i*)(raw + 4), mMask[1]);
+            for (int i = 0; i < 8; i++) {
+                p[i] = raw[i] != 0;
+            }
+            return p;
+        }
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVecMask & operator= (SIMDVecMask const & x) {
+            mMask[0] = x.mMask[0];
+            mMask[1] = x.mMask[1];
+            return *this;
+        }
+        // LANDV
+        UME_FORCE_INLINE SIMDVecMask land(SIMDVecMask const & b) const {
+            __m128i t0 = _mm_and_si128(mMask[0], b.mMask[0]);
+            __m128i t1 = _mm_and_si128(mMask[1], b.mMask[1]);
+            return SIMDVecMask(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator& (SIMDVecMask const & b) const {
+            return land(b);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator&& (SIMDVecMask const & b) const {
+            return land(b);
+        }
+        // LANDS
+        UME_FORCE_INLINE SIMDVecMask land(bool b) const {
+            __m128i t0 = _mm_set1_epi32(toMaskBool(b));
+            __m128i t1 = _mm_and_si128(mMask[0], t0);
+            __m128i t2 = _mm_and_si128(mMask[1], t0);
+            return SIMDVecMask(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator& (bool b) const {
+            return land(b);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator&& (bool b) const {
+            return land(b);
+        }
+        // LANDVA
+        UME_FORCE_INLINE SIMDVecMask & landa(SIMDVecMask const & b) {
+            mMask[0] = _mm_and_si128(mMask[0], b.mMask[0]);
+            mMask[1] = _mm_and_si128(mMask[1], b.mMask[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator&= (SIMDVecMask const & b) {
+            return landa(b);
+        }
+        // LANDSA
+        UME_FORCE_INLINE SIMDVecMask & landa(bool b) {
+            __m128i t0 = _mm_set1_epi32(toMaskBool(b));
+            mMask[0] = _mm_and_si128(mMask[0], t0);
+            mMask[1] = _mm_and_si128(mMask[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator&= (bool b) {
+            return landa(b);
+        }
+        // LORV
+        UME_FORCE_INLINE SIMDVecMask lor(SIMDVecMask const & b) const {
+            __m128i t0 = _mm_or_si128(mMask[0], b.mMask[0]);
+            __m128i t1 = _mm_or_si128(mMask[1], b.mMask[1]);
+            return SIMDVecMask(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator| (SIMDVecMask const & b) const {
+            return lor(b);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator|| (SIMDVecMask const & b) const {
+            return lor(b);
+        }
+        // LORS
+        UME_FORCE_INLINE SIMDVecMask lor(bool b) const {
+            __m128i t0 = _mm_set1_epi32(toMaskBool(b));
+            __m128i t1 = _mm_or_si128(mMask[0], t0);
+            __m128i t2 = _mm_or_si128(mMask[1], t0);
+            return SIMDVecMask(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator| (bool b) const {
+            return lor(b);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator|| (bool b) const {
+            return lor(b);
+        }
+        // LORVA
+        UME_FORCE_INLINE SIMDVecMask & lora(SIMDVecMask const & b) {
+            mMask[0] = _mm_or_si128(mMask[0], b.mMask[0]);
+            mMask[1] = _mm_or_si128(mMask[1], b.mMask[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator|= (SIMDVecMask const & b) {
+            return lora(b);
+        }
+        // LORSA
+        UME_FORCE_INLINE SIMDVecMask & lora(bool b) {
+            __m128i t0 = _mm_set1_epi32(toMaskBool(b));
+            mMask[0] = _mm_or_si128(mMask[0], t0);
+            mMask[1] = _mm_or_si128(mMask[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator|= (bool b) {
+            return lora(b);
+        }
+        // LXORV
+        UME_FORCE_INLINE SIMDVecMask lxor(SIMDVecMask const & b) const {
+            __m128i t0 = _mm_xor_si128(mMask[0], b.mMask[0]);
+            __m128i t1 = _mm_xor_si128(mMask[1], b.mMask[1]);
+            return SIMDVecMask(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator^ (SIMDVecMask const & b) const {
+            return lxor(b);
+        }
+        // LXORS
+        UME_FORCE_INLINE SIMDVecMask lxor(bool b) const {
+            __m128i t0 = _mm_set1_epi32(toMaskBool(b));
+            __m128i t1 = _mm_xor_si128(mMask[0], t0);
+            __m128i t2 = _mm_xor_si128(mMask[1], t0);
+            return SIMDVecMask(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator^ (bool b) const {
+            return lxor(b);
+        }
+        // LXORVA
+        UME_FORCE_INLINE SIMDVecMask & lxora(SIMDVecMask const & b) {
+            mMask[0] = _mm_xor_si128(mMask[0], b.mMask[0]);
+            mMask[1] = _mm_xor_si128(mMask[1], b.mMask[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator^= (SIMDVecMask const & b) {
+            return lxora(b);
+        }
+        // LXORSA
+        UME_FORCE_INLINE SIMDVecMask & lxora(bool b) {
+            __m128i t0 = _mm_set1_epi32(toMaskBool(b));
+            mMask[0] = _mm_xor_si128(mMask[0], t0);
+            mMask[1] = _mm_xor_si128(mMask[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator^= (bool b) {
+            return lxora(b);
+        }
+        // LNOT
+        UME_FORCE_INLINE SIMDVecMask lnot() const {
+            __m128i t0 = _mm_set1_epi32(TRUE_VAL());
+            __m128i t1 = _mm_xor_si128(mMask[0], t0);
+            __m128i t2 = _mm_xor_si128(mMask[1], t0);
+            return SIMDVecMask(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator! () const {
+            return lnot();
+        }
+        // LNOTA
+        UME_FORCE_INLINE SIMDVecMask & lnota() {
+            __m128i t0 = _mm_set1_epi32(TRUE_VAL());
+            mMask[0] = _mm_xor_si128(mMask[0], t0);
+            mMask[1] = _mm_xor_si128(mMask[1], t0);
+            return *this;
+        }
+        // HLAND
+        UME_FORCE_INLINE bool hland() const {
+            int t0 = _mm_movemask_ps(_mm_castsi128_ps(mMask[0])) | (_mm_movemask_ps(_mm_castsi128_ps(mMask[1])) << 4);
+            return t0 == 0xFF;
+        }
+        // HLOR
+        UME_FORCE_INLINE bool hlor() const {
+            int t0 = _mm_movemask_ps(_mm_castsi128_ps(mMask[0])) | (_mm_movemask_ps(_mm_castsi128_ps(mMask[1])) << 4);
+            return t0 != 0;
+        }
+        // HLXOR
+        UME_FORCE_INLINE bool hlxor() const {
+            int t0 = _mm_movemask_ps(_mm_castsi128_ps(mMask[0])) | (_mm_movemask_ps(_mm_castsi128_ps(mMask[1])) << 4);
+            t0 ^= t0 >> 4;
+            t0 ^= t0 >> 2;
+            t0 ^= t0 >> 1;
+            return (t0 & 1) != 0;
+        }
+    };
+
+}
+}
+
+#endif
@@ -0,0 +1,1948 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_UINT32_4_H_
+#define UME_SIMD_VEC_UINT32_4_H_
+
+#include <type_traits>
+#include <immintrin.h>
+
+#include "../../../UMESimdInterface.h"
+
+    #define BLEND(a_128i, b_128i, mask_128i) blendv_epi8_sse(a_128i, b_128i, mask_128i)
+    #define MASK_STORE(int32_addr, mask_128i, a_128i) maskstore_epi32_sse(int32_addr, mask_128i, a_128i)
+
+
+namespace UME {
+namespace SIMD {
+
+    template<>
+    class SIMDVec_u<uint32_t, 4> :
+        public SIMDVecUnsignedInterface<
+            SIMDVec_u<uint32_t, 4>,
+            uint32_t,
+            4,
+            SIMDVecMask<4>,
+            SIMDSwizzle<4 >> ,
+        public SIMDVecPackableInterface<
+            SIMDVec_u<uint32_t, 4>,
+            SIMDVec_u<uint32_t, 2 >>
+    {
+        // Stores lanes of 'v' selected by bits of 'm' contiguously, starting
+        // at 'p', and returns their count.
+        static UME_FORCE_INLINE uint32_t compressLanes(uint32_t * p, __m128i const & v, int m) {
+            alignas(16) uint32_t raw[4];
+            _mm_store_si128((__m128i *)raw, v);
+            uint32_t n = 0;
+            for (int i = 0; i < 4; i++) {
+                if (m & (1 << i)) p[n++] = raw[i];
+            }
+            return n;
+        }
+    public:
+        // Conversion operators require access to private members.
+        friend class SIMDVec_u<uint16_t, 4>;
+        friend class SIMDVec_u<uint64_t, 4>;
+        friend class SIMDVec_i<int32_t, 4>;
+        friend class SIMDVec_f<float, 4>;
+        friend class SIMDVec_f<double, 4>;
+
+        friend class SIMDVec_u<uint32_t, 2>;
+        friend class SIMDVec_u<uint32_t, 8>;
+
+    private:
+        __m128i mVec;
+
+        UME_FORCE_INLINE explicit SIMDVec_u(__m128i & x) { this->mVec = x; }
+        UME_FORCE_INLINE explicit SIMDVec_u(const __m128i & x) { this->mVec = x; }
+
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m128i saturatedAdd(__m128i const & a, __m128i const & b) {
+            return _mm_add_epi32(a, min_epu32_sse(b, _mm_xor_si128(a, _mm_set1_epi32(-1))));
+        }
+        static UME_FORCE_INLINE __m128i saturatedSub(__m128i const & a, __m128i const & b) {
+            return _mm_sub_epi32(max_epu32_sse(a, b), b);
+        }
+        // Lane-wise division through double precision, exact for 32-bit operands.
+        static UME_FORCE_INLINE __m128i divideVector(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_set1_epi32(0x80000000);
+            __m128d t1 = _mm_set1_pd(2147483648.0);
+            __m128i t2 = _mm_xor_si128(a, t0);
+            __m128i t3 = _mm_xor_si128(b, t0);
+            __m128d t4 = _mm_add_pd(_mm_cvtepi32_pd(t2), t1);
+            __m128d t5 = _mm_add_pd(_mm_cvtepi32_pd(_mm_unpackhi_epi64(t2, t2)), t1);
+            __m128d t6 = _mm_add_pd(_mm_cvtepi32_pd(t3), t1);
+            __m128d t7 = _mm_add_pd(_mm_cvtepi32_pd(_mm_unpackhi_epi64(t3, t3)), t1);
+            __m128d t8 = trunc_pd_sse(_mm_div_pd(t4, t6));
+            __m128d t9 = trunc_pd_sse(_mm_div_pd(t5, t7));
+            __m128i t10 = _mm_cvttpd_epi32(_mm_sub_pd(t8, t1));
+            __m128i t11 = _mm_cvttpd_epi32(_mm_sub_pd(t9, t1));
+            return _mm_xor_si128(_mm_unpacklo_epi64(t10, t11), t0);
+        }
+        static UME_FORCE_INLINE __m128i remainderVector(__m128i const & a, __m128i const & b) {
+            __m128i t0 = divideVector(a, b);
+            return _mm_sub_epi32(a, mullo_epi32_sse(t0, b));
+        }
+        // Division by a precomputed divisor, used by DIVD*/REMD*.
+        static UME_FORCE_INLINE __m128i divideMagic(__m128i const & a, SIMDDivisor<uint32_t> const & b) {
+            __m128i t0 = _mm_set1_epi32(b.magic());
+            __m128i t1 = _mm_mul_epu32(a, t0);
+            __m128i t2 = _mm_mul_epu32(_mm_srli_epi64(a, 32), t0);
+            __m128i t3 = blend_epi32_sse<0xA>(_mm_srli_epi64(t1, 32), t2);
+            __m128i t4 = _mm_srl_epi32(_mm_sub_epi32(a, t3), _mm_cvtsi32_si128(b.shift1()));
+            return _mm_srl_epi32(_mm_add_epi32(t3, t4), _mm_cvtsi32_si128(b.shift2()));
+        }
+        static UME_FORCE_INLINE __m128i remainderMagic(__m128i const & a, SIMDDivisor<uint32_t> const & b) {
+            __m128i t0 = divideMagic(a, b);
+            return _mm_sub_epi32(a, mullo_epi32_sse(t0, _mm_set1_epi32(b.divisor())));
+        }
+
+    public:
+
+        constexpr static uint32_t length() { return 4; }
+        constexpr static uint32_t alignment() { return 16; }
+
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_u() {}
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_u(uint32_t i) {
+            mVec = _mm_set1_epi32(i);
+        }
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_u(
+            T i, 
+            typename std::enable_if< std::is_fundamental<T>::value && 
+                                    !std::is_same<T, uint32_t>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_u(static_cast<uint32_t>(i)) {}
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVec_u(uint32_t const *p) { this->load(p); };
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVec_u(uint32_t i0, uint32_t i1, uint32_t i2, uint32_t i3)
+        {
+            mVec = _mm_set_epi32(i3, i2, i1, i0);
+        }
+        // EXTRACT
+        UME_FORCE_INLINE uint32_t extract(uint32_t index) const {
+            alignas(16) uint32_t raw[4];
+            _mm_store_si128((__m128i*) raw, mVec);
+            return raw[index];
+        }
+        UME_FORCE_INLINE uint32_t operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_u & insert(uint32_t index, uint32_t value) {
+            alignas(16) uint32_t raw[4];
+            _mm_store_si128((__m128i*)raw, mVec);
+            raw[index] = value;
+            mVec = _mm_load_si128((__m128i*)raw);
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_u, uint32_t> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_u, uint32_t>(index, static_cast<SIMDVec_u &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_u, uint32_t, SIMDVecMask<4>> operator() (SIMDVecMask<4> const & mask) {
+            return IntermediateMask<SIMDVec_u, uint32_t, SIMDVecMask<4>>(mask, static_cast<SIMDVec_u &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_u, uint32_t, SIMDVecMask<4>> operator[] (SIMDVecMask<4> const & mask) {
+            return IntermediateMask<SIMDVec_u, uint32_t, SIMDVecMask<4>>(mask, static_cast<SIMDVec_u &>(*this));
+        }
+#endif
+
+        // ****************************************************************************************
+        // Overloading Interface functions starts here!
+        // ****************************************************************************************
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVec_u const & b) {
+            mVec = b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator=(SIMDVec_u const & b) {
+            return assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            mVec = BLEND(mVec, b.mVec, mask.mMask);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_u & assign(uint32_t b) {
+            mVec = _mm_set1_epi32(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator= (uint32_t b) {
+            return assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // PREFETCH0
+        // PREFETCH1
+        // PREFETCH2
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_u & load(uint32_t const * p) {
+            mVec = _mm_loadu_si128((__m128i*)p);
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_u & load(SIMDVecMask<4> const & mask, uint32_t const * p) {
+            __m128i t0 = _mm_loadu_si128((__m128i*)p);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_u & loada(uint32_t const * p) {
+            mVec = _mm_load_si128((__m128i*)p);
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_u & loada(SIMDVecMask<4> const & mask, uint32_t const * p) {
+            __m128i t0 = _mm_load_si128((__m128i*)p);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE uint32_t * store(uint32_t * p) const {
+            _mm_storeu_si128((__m128i*) p, mVec);
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE uint32_t * store(SIMDVecMask<4> const & mask, uint32_t * p) const {        
+            MASK_STORE((int32_t*)p, mask.mMask, mVec);
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE uint32_t * storea(uint32_t * p) const {
+            _mm_store_si128((__m128i *)p, mVec);
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE uint32_t * storea(SIMDVecMask<4> const & mask, uint32_t * p) const {
+            MASK_STORE((int32_t*)p, mask.mMask, mVec);
+            return p;
+        }
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = BLEND(mVec, b.mVec, mask.mMask);
+            return SIMDVec_u(t0);
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_u swizzle(SIMDSwizzle<4> const & sMask) const {
+            __m128 t0 = permutevar_ps_sse(_mm_castsi128_ps(mVec), sMask.mVec);
+            __m128i t1 = _mm_castps_si128(t0);
+            return SIMDVec_u(t1);
+        }
+        template<int i0, int i1, int i2, int i3>
+        UME_FORCE_INLINE SIMDVec_u swizzle() const {
+            __m128i t0 = _mm_shuffle_epi32(mVec, (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6));
+            return SIMDVec_u(t0);
+        }
+        // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_u & swizzlea(SIMDSwizzle<4> const & sMask) {
+            SIMDVec_u t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_add_epi32(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator+ (SIMDVec_u const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_add_epi32(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_u add(uint32_t b) const {
+            __m128i t0 = _mm_add_epi32(mVec, _mm_set1_epi32(b));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator+ (uint32_t b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_add_epi32(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVec_u const & b) {
+            mVec = _mm_add_epi32(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator+= (SIMDVec_u const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_add_epi32(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_u & adda(uint32_t b) {
+            mVec = _mm_add_epi32(mVec, _mm_set1_epi32(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator+= (uint32_t b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_add_epi32(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVec_u const & b) const {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVec_u const & b) {
+            mVec = saturatedAdd(mVec, b.mVec);
+            return *this;
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = saturatedAdd(mVec, t0);
+            return *this;
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // POSTINC
+        UME_FORCE_INLINE SIMDVec_u postinc() {
+            __m128i t0 = _mm_set1_epi32(1);
+            __m128i t1 = mVec;
+            mVec = _mm_add_epi32(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator++ (int) {
+            return postinc();
+        }
+        // MPOSTINC
+        UME_FORCE_INLINE SIMDVec_u postinc(SIMDVecMask<4> const & mask) {
+            __m128i t0 = _mm_set1_epi32(1);
+            __m128i t1 = mVec;
+            __m128i t2 = _mm_add_epi32(mVec, t0);
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // PREFINC
+        UME_FORCE_INLINE SIMDVec_u & prefinc() {
+            __m128i t0 = _mm_set1_epi32(1);
+            mVec = _mm_add_epi32(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator++ () {
+            return prefinc();
+        }
+        // MPREFINC
+        UME_FORCE_INLINE SIMDVec_u & prefinc(SIMDVecMask<4> const & mask) {
+            __m128i t0 = _mm_set1_epi32(1);
+            __m128i t1 = _mm_add_epi32(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_sub_epi32(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator- (SIMDVec_u const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_sub_epi32(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_u sub(uint32_t b) const {
+            __m128i t0 = _mm_sub_epi32(mVec, _mm_set1_epi32(b));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator- (uint32_t b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_sub_epi32(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVec_u const & b) {
+            mVec = _mm_sub_epi32(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-= (SIMDVec_u const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_sub_epi32(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_u & suba(uint32_t b) {
+            mVec = _mm_sub_epi32(mVec, _mm_set1_epi32(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-= (uint32_t b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_sub_epi32(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVec_u const & b) const {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVec_u const & b) {
+            mVec = saturatedSub(mVec, b.mVec);
+            return *this;
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = saturatedSub(mVec, t0);
+            return *this;
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_sub_epi32(b.mVec, mVec);
+            return SIMDVec_u(t0);
+        }
+        // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t1 = _mm_sub_epi32(b.mVec, mVec);
+            __m128i t0 = BLEND(b.mVec, t1, mask.mMask);
+            return SIMDVec_u(t0);
+        }
+        // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_u subfrom(uint32_t b) const {
+            __m128i t0 = _mm_sub_epi32(_mm_set1_epi32(b), mVec);
+            return SIMDVec_u(t0);
+        }
+        // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t2 = _mm_sub_epi32(t0, mVec);
+            __m128i t1 = BLEND(t0, t2, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(SIMDVec_u const & b) {
+            mVec = _mm_sub_epi32(b.mVec, mVec);
+            return *this;
+        }
+        // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t1 = _mm_sub_epi32(b.mVec, mVec);
+            mVec = BLEND(b.mVec, t1, mask.mMask);
+            return *this;
+        }
+        // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(uint32_t b) {
+            mVec = _mm_sub_epi32(_mm_set1_epi32(b), mVec);
+            return *this;
+        }
+        // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_u subfroma(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t2 = _mm_sub_epi32(t0, mVec);
+            mVec = BLEND(t0, t2, mask.mMask);
+            return *this;
+        }
+        // POSTDEC
+        UME_FORCE_INLINE SIMDVec_u postdec() {
+            __m128i t0 = _mm_set1_epi32(1);
+            __m128i t1 = mVec;
+            mVec = _mm_sub_epi32(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator-- (int) {
+            return postdec();
+        }
+        // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_u postdec(SIMDVecMask<4> const & mask) {
+            __m128i t0 = _mm_set1_epi32(1);
+            __m128i t1 = mVec;
+            __m128i t2 = _mm_sub_epi32(mVec, t0);
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // PREFDEC
+        UME_FORCE_INLINE SIMDVec_u & prefdec() {
+            __m128i t0 = _mm_set1_epi32(1);
+            mVec = _mm_sub_epi32(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-- () {
+            return prefdec();
+        }
+        // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_u & prefdec(SIMDVecMask<4> const & mask) {
+            __m128i t0 = _mm_set1_epi32(1);
+            __m128i t2 = _mm_sub_epi32(mVec, t0);
+            mVec = BLEND(mVec, t2, mask.mMask);
+            return *this;
+        }
+        // MULV
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVec_u const & b) const {
+            __m128i t0 = mullo_epi32_sse(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator* (SIMDVec_u const & b) const {
+            return mul(b);
+        }
+        // MMULV
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t1 = mullo_epi32_sse(mVec, b.mVec);
+            __m128i t0 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t0);
+        }
+        // MULS
+        UME_FORCE_INLINE SIMDVec_u mul(uint32_t b) const {
+            __m128i t0 = mullo_epi32_sse(mVec, _mm_set1_epi32(b));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator* (uint32_t b) const {
+            return mul(b);
+        }
+        // MMULS
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t2 = mullo_epi32_sse(mVec, t0);
+            __m128i t1 = BLEND(mVec, t2, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // MULVA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVec_u const & b) {
+            mVec = mullo_epi32_sse(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator*= (SIMDVec_u const & b) {
+            return mula(b);
+        }
+        // MMULVA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = mullo_epi32_sse(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MULSA
+        UME_FORCE_INLINE SIMDVec_u & mula(uint32_t b) {
+            mVec = mullo_epi32_sse(mVec, _mm_set1_epi32(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator*= (uint32_t b) {
+            return mula(b);
+        }
+        // MMULSA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = mullo_epi32_sse(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // DIVV
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVec_u const & b) const {
+            __m128i t0 = divideVector(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (SIMDVec_u const & b) const {
+            return div(b);
+        }
+        // MDIVV
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = divideVector(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // DIVS
+        UME_FORCE_INLINE SIMDVec_u div(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = divideVector(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (uint32_t b) const {
+            return div(b);
+        }
+        // MDIVS
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = divideVector(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // DIVVA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVec_u const & b) {
+            mVec = divideVector(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDVec_u const & b) {
+            return diva(b);
+        }
+        // MDIVVA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = divideVector(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // DIVSA
+        UME_FORCE_INLINE SIMDVec_u & diva(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = divideVector(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (uint32_t b) {
+            return diva(b);
+        }
+        // MDIVSA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = divideVector(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDDivisor<uint32_t> const & b) const {
+            __m128i t0 = divideMagic(mVec, b);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (SIMDDivisor<uint32_t> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<4> const & mask, SIMDDivisor<uint32_t> const & b) const {
+            __m128i t0 = divideMagic(mVec, b);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDDivisor<uint32_t> const & b) {
+            mVec = divideMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDDivisor<uint32_t> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<4> const & mask, SIMDDivisor<uint32_t> const & b) {
+            __m128i t0 = divideMagic(mVec, b);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // REMV
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVec_u const & b) const {
+            __m128i t0 = remainderVector(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (SIMDVec_u const & b) const {
+            return rem(b);
+        }
+        // MREMV
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = remainderVector(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // REMS
+        UME_FORCE_INLINE SIMDVec_u rem(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = remainderVector(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (uint32_t b) const {
+            return rem(b);
+        }
+        // MREMS
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = remainderVector(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // REMVA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVec_u const & b) {
+            mVec = remainderVector(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (SIMDVec_u const & b) {
+            return rema(b);
+        }
+        // MREMVA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = remainderVector(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // REMSA
+        UME_FORCE_INLINE SIMDVec_u & rema(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = remainderVector(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (uint32_t b) {
+            return rema(b);
+        }
+        // MREMSA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = remainderVector(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // REMD
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDDivisor<uint32_t> const & b) const {
+            __m128i t0 = remainderMagic(mVec, b);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (SIMDDivisor<uint32_t> const & b) const {
+            return rem(b);
+        }
+        // MREMD
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<4> const & mask, SIMDDivisor<uint32_t> const & b) const {
+            __m128i t0 = remainderMagic(mVec, b);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // REMDA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDDivisor<uint32_t> const & b) {
+            mVec = remainderMagic(mVec, b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (SIMDDivisor<uint32_t> const & b) {
+            return rema(b);
+        }
+        // MREMDA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<4> const & mask, SIMDDivisor<uint32_t> const & b) {
+            __m128i t0 = remainderMagic(mVec, b);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // RCP
+        // MRCP
+        // RCPS
+        // MRCPS
+        // RCPA
+        // MRCPA
+        // RCPSA
+        // MRCPSA
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpeq(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_cmpeq_epi32(mVec, b.mVec);
+            return SIMDVecMask<4>(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator==(SIMDVec_u const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<4> cmpeq(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_cmpeq_epi32(mVec, t0);
+            return SIMDVecMask<4>(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator== (uint32_t b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpne(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_cmpeq_epi32(mVec, b.mVec);
+            __m128i m0 = _mm_set1_epi32(SIMDVecMask<4>::TRUE_VAL());
+            __m128i t1 = _mm_xor_si128(t0, m0);
+            return SIMDVecMask<4>(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator!= (SIMDVec_u const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<4> cmpne(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_cmpeq_epi32(mVec, t0);
+            __m128i m0 = _mm_set1_epi32(SIMDVecMask<4>::TRUE_VAL());
+            __m128i t2 = _mm_xor_si128(t1, m0);
+            return SIMDVecMask<4>(t2);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator!= (uint32_t b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpgt(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_set1_epi32(0x80000000);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            __m128i t2 = _mm_xor_si128(b.mVec, t0);
+            __m128i m0 = _mm_cmpgt_epi32(t1, t2);
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator> (SIMDVec_u const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<4> cmpgt(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b ^ 0x80000000);
+            __m128i t1 = _mm_set1_epi32(0x80000000);
+            __m128i t2 = _mm_xor_si128(mVec, t1);
+            __m128i m0 = _mm_cmpgt_epi32(t2, t0);
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator> (uint32_t b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<4> cmplt(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_set1_epi32(0x80000000);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            __m128i t2 = _mm_xor_si128(b.mVec, t0);
+            __m128i m0 = _mm_cmplt_epi32(t1, t2);
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator< (SIMDVec_u const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<4> cmplt(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b ^ 0x80000000);
+            __m128i t1 = _mm_set1_epi32(0x80000000);
+            __m128i t2 = _mm_xor_si128(mVec, t1);
+            __m128i m0 = _mm_cmplt_epi32(t2, t0);
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator< (uint32_t b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmpge(SIMDVec_u const & b) const {
+            __m128i t0 = max_epu32_sse(mVec, b.mVec);
+            __m128i m0 = _mm_cmpeq_epi32(mVec, t0);
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator>= (SIMDVec_u const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<4> cmpge(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = max_epu32_sse(mVec, t0);
+            __m128i m0 = _mm_cmpeq_epi32(mVec, t1);
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator>= (uint32_t b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<4> cmple(SIMDVec_u const & b) const {
+            __m128i t0 = max_epu32_sse(mVec, b.mVec);
+            __m128i m0 = _mm_cmpeq_epi32(b.mVec, t0);
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator<= (SIMDVec_u const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<4> cmple(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = max_epu32_sse(mVec, t0);
+            __m128i m0 = _mm_cmpeq_epi32(t0, t1);
+            return SIMDVecMask<4>(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<4> operator<= (uint32_t b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_u const & b) const {
+            alignas(16) uint32_t raw[4];
+            __m128i m0 = _mm_cmpeq_epi32(mVec, b.mVec);
+            _mm_store_si128((__m128i*)raw, m0);
+            return (raw[0] != 0) && (raw[1] != 0) && (raw[2] != 0) && (raw[3] !=0);
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(uint32_t b) const {
+            alignas(16) uint32_t raw[4];
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i m0 = _mm_cmpeq_epi32(mVec, t0);
+            _mm_store_si128((__m128i*)raw, m0);
+            return (raw[0] != 0) && (raw[1] != 0) && (raw[2] != 0) && (raw[3] !=0);
+        }
+        // UNIQUE
+        UME_FORCE_INLINE bool unique() const {
+            alignas(16) uint32_t raw[4];
+            _mm_store_si128((__m128i*)raw, mVec);
+            for (unsigned int i = 0; i < 3; i++) {
+                for (unsigned int j = i + 1; j < 4; j++) {
+                    if (raw[i] == raw[j]) return false;
+                }
+            }
+            return true;
+        }
+        // HADD
+        UME_FORCE_INLINE uint32_t hadd() const {
+            alignas(16) uint32_t raw[4];
+            _mm_store_si128((__m128i*)raw, mVec);
+            return raw[0] + raw[1] + raw[2] + raw[3];
+        }
+        // MHADD
+        UME_FORCE_INLINE uint32_t hadd(SIMDVecMask<4> const & mask) const {
+            alignas(16) uint32_t raw[4];
+            __m128i t0 = BLEND(_mm_set1_epi32(0), mVec, mask.mMask);
+            _mm_store_si128((__m128i*)raw, t0);
+            return raw[0] + raw[1] + raw[2] + raw[3];
+        }
+        // HADDS
+        UME_FORCE_INLINE uint32_t hadd(uint32_t b) const {
+            alignas(16) uint32_t raw[4];
+            _mm_store_si128((__m128i*)raw, mVec);
+            return raw[0] + raw[1] + raw[2] + raw[3] + b;
+        }
+        // MHADDS
+        UME_FORCE_INLINE uint32_t hadd(SIMDVecMask<4> const & mask, uint32_t b) const {
+            alignas(16) uint32_t raw[4];
+            __m128i t0 = BLEND(_mm_set1_epi32(0), mVec, mask.mMask);
+            _mm_store_si128((__m128i*)raw, t0);
+            return raw[0] + raw[1] + raw[2] + raw[3] + b;
+        }
+        // HMUL
+        UME_FORCE_INLINE uint32_t hmul() const {
+            alignas(16) uint32_t raw[4];
+            _mm_store_si128((__m128i*)raw, mVec);
+            return raw[0] * raw[1] * raw[2] * raw[3];
+        }
+        // MHMUL
+        UME_FORCE_INLINE uint32_t hmul(SIMDVecMask<4> const & mask) const {
+            alignas(16) uint32_t raw[4];
+            __m128i t0 = BLEND(_mm_set1_epi32(1), mVec, mask.mMask);
+            _mm_store_si128((__m128i*)raw, t0);
+            return raw[0] * raw[1] * raw[2] * raw[3];
+        }
+        // HMULS
+        UME_FORCE_INLINE uint32_t hmul(uint32_t b) const {
+            alignas(16) uint32_t raw[4];
+            _mm_store_si128((__m128i*)raw, mVec);
+            return raw[0] * raw[1] * raw[2] * raw[3] * b;
+        }
+        // MHMULS
+        UME_FORCE_INLINE uint32_t hmul(SIMDVecMask<4> const & mask, uint32_t b) const {
+            alignas(16) uint32_t raw[4];
+            __m128i t0 = BLEND(_mm_set1_epi32(1), mVec, mask.mMask);
+            _mm_store_si128((__m128i*)raw, t0);
+            return raw[0] * raw[1] * raw[2] * raw[3] * b;
+        }
+        // FMULADDV
+        UME_FORCE_INLINE SIMDVec_u fmuladd(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = mullo_epi32_sse(mVec, b.mVec);
+            __m128i t1 = _mm_add_epi32(t0, c.mVec);
+            return SIMDVec_u(t1);
+        }
+        // MFMULADDV
+        UME_FORCE_INLINE SIMDVec_u fmuladd(SIMDVecMask<4> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = mullo_epi32_sse(mVec, b.mVec);
+            __m128i t1 = _mm_add_epi32(t0, c.mVec);
+            t1 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // FMULSUBV
+        UME_FORCE_INLINE SIMDVec_u fmulsub(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = mullo_epi32_sse(mVec, b.mVec);
+            __m128i t1 = _mm_sub_epi32(t0, c.mVec);
+            return SIMDVec_u(t1);
+        }
+        // MFMULSUBV
+        UME_FORCE_INLINE SIMDVec_u fmulsub(SIMDVecMask<4> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = mullo_epi32_sse(mVec, b.mVec);
+            __m128i t1 = _mm_sub_epi32(t0, c.mVec);
+            t1 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // FADDMULV
+        UME_FORCE_INLINE SIMDVec_u faddmul(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = _mm_add_epi32(mVec, b.mVec);
+            __m128i t1 = mullo_epi32_sse(t0, c.mVec);
+            return SIMDVec_u(t1);
+        }
+        // MFADDMULV
+        UME_FORCE_INLINE SIMDVec_u faddmul(SIMDVecMask<4> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = _mm_add_epi32(mVec, b.mVec);
+            __m128i t1 = mullo_epi32_sse(t0, c.mVec);
+            t1 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // FSUBMULV
+        UME_FORCE_INLINE SIMDVec_u fsubmul(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = _mm_sub_epi32(mVec, b.mVec);
+            __m128i t1 = mullo_epi32_sse(t0, c.mVec);
+            return SIMDVec_u(t1);
+        }
+        // MFSUBMULV
+        UME_FORCE_INLINE SIMDVec_u fsubmul(SIMDVecMask<4> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = _mm_sub_epi32(mVec, b.mVec);
+            __m128i t1 = mullo_epi32_sse(t0, c.mVec);
+            t1 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // MAXV
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVec_u const & b) const {
+            __m128i t0 = max_epu32_sse(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // MMAXV
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t1 = max_epu32_sse(mVec, b.mVec);
+            __m128i t0 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t0);
+        }
+        // MAXS
+        UME_FORCE_INLINE SIMDVec_u max(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = max_epu32_sse(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        // MMAXS
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t2 = max_epu32_sse(mVec, t0);
+            __m128i t1 = BLEND(mVec, t2, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // MAXVA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVec_u const & b) {
+            mVec = max_epu32_sse(mVec, b.mVec);
+            return *this;
+        }
+        // MMAXVA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t1 = max_epu32_sse(mVec, b.mVec);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // MAXSA
+        UME_FORCE_INLINE SIMDVec_u & maxa(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = max_epu32_sse(mVec, t0);
+            return *this;
+        }
+        // MMAXSA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = max_epu32_sse(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // MINV
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVec_u const & b) const {
+            __m128i t0 = min_epu32_sse(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // MMINV
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = min_epu32_sse(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // MINS
+        UME_FORCE_INLINE SIMDVec_u min(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = min_epu32_sse(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        // MMINS
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = min_epu32_sse(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // MINVA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVec_u const & b) {
+            mVec = min_epu32_sse(mVec, b.mVec);
+            return *this;
+        }
+        // MMINVA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = min_epu32_sse(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MINSA
+        UME_FORCE_INLINE SIMDVec_u & mina(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = min_epu32_sse(mVec, t0);
+            return *this;
+        }
+        // MMINSA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = min_epu32_sse(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // HMAX
+        UME_FORCE_INLINE uint32_t hmax() const {
+            __m128i t0 = max_epu32_sse(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            __m128i t1 = max_epu32_sse(t0, _mm_shuffle_epi32(t0, 0xB1));
+            return uint32_t(_mm_cvtsi128_si32(t1));
+        }
+        // MHMAX
+        UME_FORCE_INLINE uint32_t hmax(SIMDVecMask<4> const & mask) const {
+            __m128i t0 = _mm_set1_epi32(std::numeric_limits<uint32_t>::min());
+            __m128i t1 = BLEND(t0, mVec, mask.mMask);
+            __m128i t2 = max_epu32_sse(t1, _mm_shuffle_epi32(t1, 0x4E));
+            __m128i t3 = max_epu32_sse(t2, _mm_shuffle_epi32(t2, 0xB1));
+            return uint32_t(_mm_cvtsi128_si32(t3));
+        }
+        // IMAX
+        // MIMAX
+        // HMIN
+        UME_FORCE_INLINE uint32_t hmin() const {
+            __m128i t0 = min_epu32_sse(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            __m128i t1 = min_epu32_sse(t0, _mm_shuffle_epi32(t0, 0xB1));
+            return uint32_t(_mm_cvtsi128_si32(t1));
+        }
+        // MHMIN
+        UME_FORCE_INLINE uint32_t hmin(SIMDVecMask<4> const & mask) const {
+            __m128i t0 = _mm_set1_epi32(std::numeric_limits<uint32_t>::max());
+            __m128i t1 = BLEND(t0, mVec, mask.mMask);
+            __m128i t2 = min_epu32_sse(t1, _mm_shuffle_epi32(t1, 0x4E));
+            __m128i t3 = min_epu32_sse(t2, _mm_shuffle_epi32(t2, 0xB1));
+            return uint32_t(_mm_cvtsi128_si32(t3));
+        }
+        // IMIN
+        // MIMIN
+
+        // BANDV
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator& (SIMDVec_u const & b) const {
+            return band(b);
+        }
+        // MBANDV
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BANDS
+        UME_FORCE_INLINE SIMDVec_u band(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator& (uint32_t b) const {
+            return band(b);
+        }
+        // MBANDS
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // BANDVA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVec_u const & b) {
+            mVec = _mm_and_si128(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (SIMDVec_u const & b) {
+            return banda(b);
+        }
+        // MBANDVA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BANDSA
+        UME_FORCE_INLINE SIMDVec_u & banda(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = _mm_and_si128(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (uint32_t b) {
+            return banda(b);
+        }
+        // MBANDSA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // BORV
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator| (SIMDVec_u const & b) const {
+            return bor(b);
+        }
+        // MBORV
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BORS
+        UME_FORCE_INLINE SIMDVec_u bor(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator| (uint32_t b) const {
+            return bor(b);
+        }
+        // MBORS
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // BORVA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVec_u const & b) {
+            mVec = _mm_or_si128(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (SIMDVec_u const & b) {
+            return bora(b);
+        }
+        // MBORVA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BORSA
+        UME_FORCE_INLINE SIMDVec_u & bora(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = _mm_or_si128(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (uint32_t b) {
+            return bora(b);
+        }
+        // MBORSA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // BXORV
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator^ (SIMDVec_u const & b) const {
+            return bxor(b);
+        }
+        // MBXORV
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BXORS
+        UME_FORCE_INLINE SIMDVec_u bxor(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator^ (uint32_t b) const {
+            return bxor(b);
+        }
+        // MBXORS
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // BXORVA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVec_u const & b) {
+            mVec = _mm_xor_si128(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator^= (SIMDVec_u const & b) {
+            return bxora(b);
+        }
+        // MBXORVA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BXORSA
+        UME_FORCE_INLINE SIMDVec_u & bxora(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec = _mm_xor_si128(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator^= (uint32_t b) {
+            return bxora(b);
+        }
+        // MBXORSA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // BNOT
+        UME_FORCE_INLINE SIMDVec_u bnot() const {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator~ () const {
+            return bnot();
+        }
+        // MBNOT
+        UME_FORCE_INLINE SIMDVec_u bnot(SIMDVecMask<4> const & mask) const {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // BNOTA
+        UME_FORCE_INLINE SIMDVec_u & bnota() {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            mVec = _mm_xor_si128(mVec, t0);
+            return *this;
+        }
+        // MBNOTA
+        UME_FORCE_INLINE SIMDVec_u bnota(SIMDVecMask<4> const & mask) {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // HBAND
+        UME_FORCE_INLINE uint32_t hband() const {
+            alignas(16) uint32_t raw[4];
+            _mm_store_si128((__m128i*)raw, mVec);
+            return raw[0] & raw[1] & raw[2] & raw[3];
+        }
+        // MHBAND
+        UME_FORCE_INLINE uint32_t hband(SIMDVecMask<4> const & mask) const {
+            alignas(16) uint32_t raw[4];
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = BLEND(t0, mVec, mask.mMask);
+            _mm_store_si128((__m128i*)raw, t1);
+            return raw[0] & raw[1] & raw[2] & raw[3];
+        }
+        // HBANDS
+        UME_FORCE_INLINE uint32_t hband(uint32_t b) const {
+            alignas(16) uint32_t raw[4];
+            _mm_store_si128((__m128i*)raw, mVec);
+            return raw[0] & raw[1] & raw[2] & raw[3] & b;
+        }
+        // MHBANDS
+        UME_FORCE_INLINE uint32_t hband(SIMDVecMask<4> const & mask, uint32_t b) const {
+            alignas(16) uint32_t raw[4];
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = BLEND(t0, mVec, mask.mMask);
+            _mm_store_si128((__m128i*)raw, t1);
+            return raw[0] & raw[1] & raw[2] & raw[3] & b;
+        }
+        // HBOR
+        UME_FORCE_INLINE uint32_t hbor() const {
+            alignas(16) uint32_t raw[4];
+            _mm_store_si128((__m128i*)raw, mVec);
+            return raw[0] | raw[1] | raw[2] | raw[3];
+        }
+        // MHBOR
+        UME_FORCE_INLINE uint32_t hbor(SIMDVecMask<4> const & mask) const {
+            alignas(16) uint32_t raw[4];
+            __m128i t0 = _mm_set1_epi32(0);
+            __m128i t1 = BLEND(t0, mVec, mask.mMask);
+            _mm_store_si128((__m128i*)raw, t1);
+            return raw[0] | raw[1] | raw[2] | raw[3];
+        }
+        // HBORS
+        UME_FORCE_INLINE uint32_t hbor(uint32_t b) const {
+            alignas(16) uint32_t raw[4];
+            _mm_store_si128((__m128i*)raw, mVec);
+            return raw[0] | raw[1] | raw[2] | raw[3] | b;
+        }
+        // MHBORS
+        UME_FORCE_INLINE uint32_t hbor(SIMDVecMask<4> const & mask, uint32_t b) const {
+            alignas(16) uint32_t raw[4];
+            __m128i t0 = _mm_set1_epi32(0);
+            __m128i t1 = BLEND(t0, mVec, mask.mMask);
+            _mm_store_si128((__m128i*)raw, t1);
+            return raw[0] | raw[1] | raw[2] | raw[3] | b;
+        }
+        // HBXOR
+        UME_FORCE_INLINE uint32_t hbxor() const {
+            alignas(16) uint32_t raw[4];
+            _mm_store_si128((__m128i*)raw, mVec);
+            return raw[0] ^ raw[1] ^ raw[2] ^ raw[3];
+        }
+        // MHBXOR
+        UME_FORCE_INLINE uint32_t hbxor(SIMDVecMask<4> const & mask) const {
+            alignas(16) uint32_t raw[4];
+            __m128i t0 = _mm_set1_epi32(0);
+            __m128i t1 = BLEND(t0, mVec, mask.mMask);
+            _mm_store_si128((__m128i*)raw, t1);
+            return raw[0] ^ raw[1] ^ raw[2] ^ raw[3];
+        }
+        // HBXORS
+        UME_FORCE_INLINE uint32_t hbxor(uint32_t b) const {
+            alignas(16) uint32_t raw[4];
+            _mm_store_si128((__m128i*)raw, mVec);
+            return raw[0] ^ raw[1] ^ raw[2] ^ raw[3] ^ b;
+        }
+        // MHBXORS
+        UME_FORCE_INLINE uint32_t hbxor(SIMDVecMask<4> const & mask, uint32_t b) const {
+            alignas(16) uint32_t raw[4];
+            __m128i t0 = _mm_set1_epi32(0);
+            __m128i t1 = BLEND(t0, mVec, mask.mMask);
+            _mm_store_si128((__m128i*)raw, t1);
+            return raw[0] ^ raw[1] ^ raw[2] ^ raw[3] ^ b;
+        }
+
+        // GATHERS
+        UME_FORCE_INLINE SIMDVec_u & gather(uint32_t const * baseAddr, uint32_t const * indices) {
+            alignas(16) uint32_t raw[4] = { baseAddr[indices[0]], baseAddr[indices[1]], baseAddr[indices[2]], baseAddr[indices[3]] };
+            mVec = _mm_load_si128((__m128i*)raw);
+            return *this;
+        }
+        // MGATHERS
+        UME_FORCE_INLINE SIMDVec_u & gather(SIMDVecMask<4> const & mask, uint32_t const * baseAddr, uint32_t const * indices) {
+            alignas(16) uint32_t raw[4] = { baseAddr[indices[0]], baseAddr[indices[1]], baseAddr[indices[2]], baseAddr[indices[3]] };
+            __m128i t0 = _mm_load_si128((__m128i*)raw);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // GATHERV
+        UME_FORCE_INLINE SIMDVec_u & gather(uint32_t const * baseAddr, SIMDVec_u const & indices) {
+            alignas(16) uint32_t rawInd[4];
+            alignas(16) uint32_t raw[4];
+
+            _mm_store_si128((__m128i*) rawInd, indices.mVec);
+            for (int i = 0; i < 4; i++) { raw[i] = baseAddr[rawInd[i]]; }
+            mVec = _mm_load_si128((__m128i*)raw);
+            return *this;
+        }
+        // MGATHERV
+        UME_FORCE_INLINE SIMDVec_u & gather(SIMDVecMask<4> const & mask, uint32_t const * baseAddr, SIMDVec_u const & indices) {
+            alignas(16) uint32_t rawInd[4];
+            alignas(16) uint32_t raw[4];
+
+            _mm_store_si128((__m128i*) rawInd, indices.mVec);
+            for (int i = 0; i < 4; i++) { raw[i] = baseAddr[rawInd[i]]; }
+            __m128i t0 = _mm_load_si128((__m128i*)&raw[0]);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SCATTERS
+        UME_FORCE_INLINE uint32_t* scatter(uint32_t* baseAddr, uint32_t* indices) {
+            alignas(16) uint32_t raw[4];
+            _mm_store_si128((__m128i*) raw, mVec);
+            for (int i = 0; i < 4; i++) { baseAddr[indices[i]] = raw[i]; };
+            return baseAddr;
+        }
+        // MSCATTERS
+        UME_FORCE_INLINE uint32_t* scatter(SIMDVecMask<4> const & mask, uint32_t* baseAddr, uint32_t* indices) {
+            alignas(16) uint32_t rawMask[4];
+            _mm_store_si128((__m128i*) rawMask, mask.mMask);
+            alignas(16) uint32_t raw[4];
+            _mm_store_si128((__m128i*) raw, mVec);
+            for (int i = 0; i < 4; i++) { if (rawMask[i] == SIMDVecMask<4>::TRUE_VAL()) baseAddr[indices[i]] = raw[i]; };
+            return baseAddr;
+        }
+        // SCATTERV
+        UME_FORCE_INLINE uint32_t* scatter(uint32_t* baseAddr, SIMDVec_u const & indices) {
+            alignas(16) uint32_t raw[4];
+            alignas(16) uint32_t rawIndices[4];
+            _mm_store_si128((__m128i*) raw, mVec);
+            _mm_store_si128((__m128i*) rawIndices, indices.mVec);
+            for (int i = 0; i < 4; i++) { baseAddr[rawIndices[i]] = raw[i]; };
+            return baseAddr;
+        }
+        // MSCATTERV
+        UME_FORCE_INLINE uint32_t* scatter(SIMDVecMask<4> const & mask, uint32_t* baseAddr, SIMDVec_u const & indices) {
+            alignas(16) uint32_t rawMask[4];
+            _mm_store_si128((__m128i*) rawMask, mask.mMask);
+            alignas(16) uint32_t raw[4];
+            alignas(16) uint32_t rawIndices[4];
+            _mm_store_si128((__m128i*) raw, mVec);
+            _mm_store_si128((__m128i*) rawIndices, indices.mVec);
+            for (int i = 0; i < 4; i++) {
+                if (rawMask[i] == SIMDVecMask<4>::TRUE_VAL())
+                    baseAddr[rawIndices[i]] = raw[i];
+            };
+            return baseAddr;
+        }
+
+        // LSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVec_u const & b) const {
+            __m128i t0 = sllv_epi32_sse(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (SIMDVec_u const & b) const {
+            return lsh(b);
+        }
+        // MLSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = sllv_epi32_sse(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // LSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi32(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (uint32_t b) const {
+            return lsh(b);
+        }
+        // MLSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi32(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // LSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVec_u const & b) {
+            mVec = sllv_epi32_sse(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (SIMDVec_u const & b) {
+            return lsha(b);
+        }
+        // MLSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = sllv_epi32_sse(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // LSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = _mm_sll_epi32(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (uint32_t b) {
+            return lsha(b);
+        }
+        // MLSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi32(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // RSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVec_u const & b) const {
+            __m128i t0 = srlv_epi32_sse(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (SIMDVec_u const & b) const {
+            return rsh(b);
+        }
+        // MRSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = srlv_epi32_sse(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // RSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_srl_epi32(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (uint32_t b) const {
+            return rsh(b);
+        }
+        // MRSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_srl_epi32(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // RSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVec_u const & b) {
+            mVec = srlv_epi32_sse(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (SIMDVec_u const & b) {
+            return rsha(b);
+        }
+        // MRSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = srlv_epi32_sse(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // RSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = _mm_srl_epi32(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (uint32_t b) {
+            return rsha(b);
+        }
+        // MRSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_srl_epi32(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // ROLV
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec, t2);
+            __m128i t5 = srlv_epi32_sse(mVec, t3);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            return SIMDVec_u(t6);
+        }
+        // MROLV
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec, t2);
+            __m128i t5 = srlv_epi32_sse(mVec, t3);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = BLEND(mVec, t6, mask.mMask);
+            return SIMDVec_u(t7);
+        }
+        // ROLS
+        UME_FORCE_INLINE SIMDVec_u rol(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t0);
+            __m128i t3 = _mm_srl_epi32(mVec, t1);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            return SIMDVec_u(t4);
+        }
+        // MROLS
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t0);
+            __m128i t3 = _mm_srl_epi32(mVec, t1);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            __m128i t5 = BLEND(mVec, t4, mask.mMask);
+            return SIMDVec_u(t5);
+        }
+        // ROLVA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVec_u const & b) {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec, t2);
+            __m128i t5 = srlv_epi32_sse(mVec, t3);
+            mVec = _mm_or_si128(t4, t5);
+            return *this;
+        }
+        // MROLVA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec, t2);
+            __m128i t5 = srlv_epi32_sse(mVec, t3);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            mVec = BLEND(mVec, t6, mask.mMask);
+            return *this;
+        }
+        // ROLSA
+        UME_FORCE_INLINE SIMDVec_u & rola(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t0);
+            __m128i t3 = _mm_srl_epi32(mVec, t1);
+            mVec = _mm_or_si128(t2, t3);
+            return *this;
+        }
+        // MROLSA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t0);
+            __m128i t3 = _mm_srl_epi32(mVec, t1);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            mVec = BLEND(mVec, t4, mask.mMask);
+            return *this;
+        }
+        // RORV
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec, t3);
+            __m128i t5 = srlv_epi32_sse(mVec, t2);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            return SIMDVec_u(t6);
+        }
+        // MRORV
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVecMask<4> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec, t3);
+            __m128i t5 = srlv_epi32_sse(mVec, t2);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = BLEND(mVec, t6, mask.mMask);
+            return SIMDVec_u(t7);
+        }
+        // RORS
+        UME_FORCE_INLINE SIMDVec_u ror(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t1);
+            __m128i t3 = _mm_srl_epi32(mVec, t0);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            return SIMDVec_u(t4);
+        }
+        // MRORS
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVecMask<4> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t1);
+            __m128i t3 = _mm_srl_epi32(mVec, t0);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            __m128i t5 = BLEND(mVec, t4, mask.mMask);
+            return SIMDVec_u(t5);
+        }
+        // RORVA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVec_u const & b) {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec, t3);
+            __m128i t5 = srlv_epi32_sse(mVec, t2);
+            mVec = _mm_or_si128(t4, t5);
+            return *this;
+        }
+        // MRORVA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVecMask<4> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec, t3);
+            __m128i t5 = srlv_epi32_sse(mVec, t2);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            mVec = BLEND(mVec, t6, mask.mMask);
+            return *this;
+        }
+        // RORSA
+        UME_FORCE_INLINE SIMDVec_u & rora(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t1);
+            __m128i t3 = _mm_srl_epi32(mVec, t0);
+            mVec = _mm_or_si128(t2, t3);
+            return *this;
+        }
+        // MRORSA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVecMask<4> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec, t1);
+            __m128i t3 = _mm_srl_epi32(mVec, t0);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            mVec = BLEND(mVec, t4, mask.mMask);
+            return *this;
+        }
+        // PACK
+        UME_FORCE_INLINE SIMDVec_u & pack(SIMDVec_u<uint32_t, 2> const & a, SIMDVec_u<uint32_t, 2> const & b) {
+            mVec = _mm_setr_epi32(a[0], a[1], b[0], b[1]);
+            return *this;
+        }
+        // PACKLO
+        UME_FORCE_INLINE SIMDVec_u & packlo(SIMDVec_u<uint32_t, 2> const & a) {
+            __m128i t0 = _mm_setr_epi32(a[0], a[1], 0, 0);
+            mVec = _mm_castpd_si128(_mm_move_sd(_mm_castsi128_pd(mVec), _mm_castsi128_pd(t0)));
+            return *this;
+        }
+        // PACKHI
+        UME_FORCE_INLINE SIMDVec_u & packhi(SIMDVec_u<uint32_t, 2> const & b) {
+            __m128i t0 = _mm_setr_epi32(b[0], b[1], 0, 0);
+            mVec = _mm_unpacklo_epi64(mVec, t0);
+            return *this;
+        }
+        // UNPACK
+        UME_FORCE_INLINE void unpack(SIMDVec_u<uint32_t, 2> & a, SIMDVec_u<uint32_t, 2> & b) const {
+            a = unpacklo();
+            b = unpackhi();
+        }
+        // UNPACKLO
+        UME_FORCE_INLINE SIMDVec_u<uint32_t, 2> unpacklo() const {
+            uint32_t t0 = uint32_t(_mm_cvtsi128_si32(mVec));
+            uint32_t t1 = uint32_t(_mm_cvtsi128_si32(_mm_shuffle_epi32(mVec, 0x01)));
+            return SIMDVec_u<uint32_t, 2>(t0, t1);
+        }
+        // UNPACKHI
+        UME_FORCE_INLINE SIMDVec_u<uint32_t, 2> unpackhi() const {
+            uint32_t t0 = uint32_t(_mm_cvtsi128_si32(_mm_shuffle_epi32(mVec, 0x02)));
+            uint32_t t1 = uint32_t(_mm_cvtsi128_si32(_mm_shuffle_epi32(mVec, 0x03)));
+            return SIMDVec_u<uint32_t, 2>(t0, t1);
+        }
+
+        // PROMOTE
+        UME_FORCE_INLINE operator SIMDVec_u<uint64_t, 4>() const;
+        // DEGRADE
+        UME_FORCE_INLINE operator SIMDVec_u<uint16_t, 4>() const;
+
+        // UTOI
+        UME_FORCE_INLINE operator SIMDVec_i<int32_t, 4>() const;
+        // UTOF
+        UME_FORCE_INLINE operator SIMDVec_f<float, 4>() const;
+    };
+
+}
+}
+
+#undef BLEND
+#undef MASK_STORE
+
+#endif
@@ -0,0 +1,2344 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_UINT32_8_H_
+#define UME_SIMD_VEC_UINT32_8_H_
+
+#include <type_traits>
+#include <immintrin.h>
+
+#include "../../../UMESimdInterface.h"
+
+namespace UME {
+namespace SIMD {
+
+    template<>
+    class SIMDVec_u<uint32_t, 8> :
+        public SIMDVecUnsignedInterface<
+            SIMDVec_u<uint32_t, 8>,
+            uint32_t,
+            8,
+            SIMDVecMask<8>,
+            SIMDSwizzle<8>>,
+        public SIMDVecPackableInterface<
+            SIMDVec_u<uint32_t, 8>,
+            SIMDVec_u<uint32_t, 4>>
+    {
+    public:
+        // Conversion operators require access to private members.
+        friend class SIMDVec_i<int32_t, 8>;
+        friend class SIMDVec_f<float, 8>;
+        friend class SIMDVec_u<uint16_t, 8>;
+
+        friend class SIMDVec_u<uint32_t, 16>;
+    private:
+        __m128i mVec[2];
+
+        UME_FORCE_INLINE explicit SIMDVec_u(__m128i const & x0, __m128i const & x1) { mVec[0] = x0; mVec[1] = x1; }
+
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m128i saturatedAdd(__m128i const & a, __m128i const & b) {
+            return _mm_add_epi32(a, min_epu32_sse(b, _mm_xor_si128(a, _mm_set1_epi32(-1))));
+        }
+        static UME_FORCE_INLINE __m128i saturatedSub(__m128i const & a, __m128i const & b) {
+            return _mm_sub_epi32(max_epu32_sse(a, b), b);
+        }
+        // Lane-wise division through double precision, exact for 32-bit operands.
+        static UME_FORCE_INLINE __m128i divideHalf(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_set1_epi32(0x80000000);
+            __m128d t1 = _mm_set1_pd(2147483648.0);
+            __m128d t2 = _mm_add_pd(_mm_cvtepi32_pd(_mm_xor_si128(a, t0)), t1);
+            __m128d t3 = _mm_add_pd(_mm_cvtepi32_pd(_mm_xor_si128(b, t0)), t1);
+            __m128d t4 = trunc_pd_sse(_mm_div_pd(t2, t3));
+            return _mm_xor_si128(_mm_cvttpd_epi32(_mm_sub_pd(t4, t1)), t0);
+        }
+        static UME_FORCE_INLINE __m128i divideVector(__m128i const & a, __m128i const & b) {
+            __m128i t0 = divideHalf(a, b);
+            __m128i t1 = divideHalf(_mm_shuffle_epi32(a, 0x4E), _mm_shuffle_epi32(b, 0x4E));
+            return _mm_unpacklo_epi64(t0, t1);
+        }
+        static UME_FORCE_INLINE __m128i remainderVector(__m128i const & a, __m128i const & b) {
+            __m128i t0 = divideVector(a, b);
+            return _mm_sub_epi32(a, mullo_epi32_sse(t0, b));
+        }
+        // Division by a precomputed divisor, used by DIVD*/REMD*.
+        static UME_FORCE_INLINE __m128i divideMagic(__m128i const & a, SIMDDivisor<uint32_t> const & b) {
+            __m128i t0 = _mm_set1_epi32(b.magic());
+            __m128i t1 = _mm_mul_epu32(a, t0);
+            __m128i t2 = _mm_mul_epu32(_mm_srli_epi64(a, 32), t0);
+            __m128i t3 = blend_epi32_sse<0xA>(_mm_srli_epi64(t1, 32), t2);
+            __m128i t4 = _mm_srl_epi32(_mm_sub_epi32(a, t3), _mm_cvtsi32_si128(b.shift1()));
+            return _mm_srl_epi32(_mm_add_epi32(t3, t4), _mm_cvtsi32_si128(b.shift2()));
+        }
+        static UME_FORCE_INLINE __m128i remainderMagic(__m128i const & a, SIMDDivisor<uint32_t> const & b) {
+            __m128i t0 = divideMagic(a, b);
+            return _mm_sub_epi32(a, mullo_epi32_sse(t0, _mm_set1_epi32(b.divisor())));
+        }
+        // Writes lanes of 'v' selected by bits of 'm' to baseAddr[indices[i]],
+        // in lane order. Indices are moved to general purpose registers in
+        // pairs, so neither vector makes a round trip through the stack.
+        static UME_FORCE_INLINE void scatterLanes(uint32_t * baseAddr, __m128i v, __m128i indices, int m) {
+            uint64_t x0 = uint64_t(_mm_cvtsi128_si64(v));
+            uint64_t x1 = uint64_t(extract_epi64_sse<1>(v));
+            uint64_t i0 = uint64_t(_mm_cvtsi128_si64(indices));
+            uint64_t i1 = uint64_t(extract_epi64_sse<1>(indices));
+            if (m & 0x01) baseAddr[uint32_t(i0)] = uint32_t(x0);
+            if (m & 0x02) baseAddr[uint32_t(i0 >> 32)] = uint32_t(x0 >> 32);
+            if (m & 0x04) baseAddr[uint32_t(i1)] = uint32_t(x1);
+            if (m & 0x08) baseAddr[uint32_t(i1 >> 32)] = uint32_t(x1 >> 32);
+        }
+        // Adds lanes of 'v' selected by bits of 'm' to baseAddr[indices[i]],
+        // in lane order, so that lanes with repeating indices accumulate.
+        static UME_FORCE_INLINE void scatterAddLanes(uint32_t * baseAddr, __m128i v, __m128i indices, int m) {
+            uint64_t x0 = uint64_t(_mm_cvtsi128_si64(v));
+            uint64_t x1 = uint64_t(extract_epi64_sse<1>(v));
+            uint64_t i0 = uint64_t(_mm_cvtsi128_si64(indices));
+            uint64_t i1 = uint64_t(extract_epi64_sse<1>(indices));
+            if (m & 0x01) baseAddr[uint32_t(i0)] += uint32_t(x0);
+            if (m & 0x02) baseAddr[uint32_t(i0 >> 32)] += uint32_t(x0 >> 32);
+            if (m & 0x04) baseAddr[uint32_t(i1)] += uint32_t(x1);
+            if (m & 0x08) baseAddr[uint32_t(i1 >> 32)] += uint32_t(x1 >> 32);
+        }
+    public:
+
+        constexpr static uint32_t length() { return 8; }
+        constexpr static uint32_t alignment() { return 16; }
+
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_u() {}
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_u(uint32_t i) {
+            mVec[0] = _mm_set1_epi32(i);
+            mVec[1] = _mm_set1_epi32(i);
+        }
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_u(
+            T i, 
+            typename std::enable_if< std::is_fundamental<T>::value && 
+                                    !std::is_same<T, uint32_t>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_u(static_cast<uint32_t>(i)) {}
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVec_u(uint32_t const *p) { load(p); }
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVec_u(uint32_t i0, uint32_t i1, uint32_t i2, uint32_t i3,
+                         uint32_t i4, uint32_t i5, uint32_t i6, uint32_t i7)
+        {
+            mVec[0] = _mm_setr_epi32(i0, i1, i2, i3);
+            mVec[1] = _mm_setr_epi32(i4, i5, i6, i7);
+        }
+        // EXTRACT
+        UME_FORCE_INLINE uint32_t extract(uint32_t index) const {
+            alignas(16) uint32_t raw[4];
+            uint32_t raw_index;
+            if (index < 4) {
+                _mm_store_si128((__m128i*)raw, mVec[0]);
+                raw_index = index;
+            }
+            else {
+                _mm_store_si128((__m128i*)raw, mVec[1]);
+                raw_index = index - 4;
+            }
+            return raw[raw_index];
+        }
+        UME_FORCE_INLINE uint32_t operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_u & insert(uint32_t index, uint32_t value) {
+            alignas(16) uint32_t raw[4];
+            if (index < 4) {
+                _mm_store_si128((__m128i*)raw, mVec[0]);
+                raw[index] = value;
+                mVec[0] = _mm_load_si128((__m128i*)raw);
+            }
+            else
+            {
+                _mm_store_si128((__m128i*)raw, mVec[1]);
+                raw[index - 4] = value;
+                mVec[1] = _mm_load_si128((__m128i*)raw);
+            }
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_u, uint32_t> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_u, uint32_t>(index, static_cast<SIMDVec_u &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_u, uint32_t, SIMDVecMask<8>> operator() (SIMDVecMask<8> const & mask) {
+            return IntermediateMask<SIMDVec_u, uint32_t, SIMDVecMask<8>>(mask, static_cast<SIMDVec_u &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_u, uint32_t, SIMDVecMask<8>> operator[] (SIMDVecMask<8> const & mask) {
+            return IntermediateMask<SIMDVec_u, uint32_t, SIMDVecMask<8>>(mask, static_cast<SIMDVec_u &>(*this));
+        }
+#endif
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVec_u const & b) {
+            mVec[0] = b.mVec[0];
+            mVec[1] = b.mVec[1];
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator= (SIMDVec_u const & b) {
+            return assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            mVec[0] = blendv_epi8_sse(mVec[0], b.mVec[0], mask.mMask[0]);
+            mVec[1] = blendv_epi8_sse(mVec[1], b.mVec[1], mask.mMask[1]);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_u & assign(uint32_t b) {
+            mVec[0] = _mm_set1_epi32(b);
+            mVec[1] = _mm_set1_epi32(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator= (uint32_t b) {
+            return assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t0, mask.mMask[1]);
+            return *this;
+        }
+
+        // PREFETCH0
+        // PREFETCH1
+        // PREFETCH2
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_u & load(uint32_t const * p) {
+            mVec[0] = _mm_loadu_si128((__m128i*)p);
+            mVec[1] = _mm_loadu_si128((__m128i*)(p + 4));
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_u & load(SIMDVecMask<8> const & mask, uint32_t const * p) {
+            __m128i t0 = _mm_loadu_si128((__m128i*)p);
+            __m128i t1 = _mm_loadu_si128((__m128i*)(p + 4));
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_u & loada(uint32_t const * p) {
+            mVec[0] = _mm_load_si128((__m128i *)p);
+            mVec[1] = _mm_load_si128((__m128i *)(p + 4));
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_u & loada(SIMDVecMask<8> const & mask, uint32_t const * p) {
+            __m128i t0 = _mm_load_si128((__m128i*)p);
+            __m128i t1 = _mm_load_si128((__m128i*)(p + 4));
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE uint32_t* store(uint32_t * p) const {
+            _mm_storeu_si128((__m128i*)p, mVec[0]);
+            _mm_storeu_si128((__m128i*)(p + 4), mVec[1]);
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE uint32_t* store(SIMDVecMask<8> const & mask, uint32_t * p) const {
+            maskstore_epi32_sse((int*)p, mask.mMask[0], mVec[0]);
+            maskstore_epi32_sse((int*)(p + 4), mask.mMask[1], mVec[1]);
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE uint32_t* storea(uint32_t * p) const {
+            _mm_store_si128((__m128i*)p, mVec[0]);
+            _mm_store_si128((__m128i*)(p + 4), mVec[1]);
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE uint32_t* storea(SIMDVecMask<8> const & mask, uint32_t * p) const {
+            maskstore_epi32_sse((int*)p, mask.mMask[0], mVec[0]);
+            maskstore_epi32_sse((int*)(p + 4), mask.mMask[1], mVec[1]);
+            return p;
+        }
+        // COMPRESSSTORE
+        UME_FORCE_INLINE uint32_t compressstore(SIMDVecMask<8> const & mask, uint32_t * p) const {
+            uint32_t t0 = SIMDVec_u<uint32_t, 4>::compressLanes(p, mVec[0], _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[0])));
+            uint32_t t1 = SIMDVec_u<uint32_t, 4>::compressLanes(p + t0, mVec[1], _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[1])));
+            return t0 + t1;
+        }
+        // BLENDV
+        // BLENDS
+        // SWIZZLE 
+        // SWIZZLEA
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_add_epi32(mVec[0], b.mVec[0]);
+            __m128i t1 = _mm_add_epi32(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator+ (SIMDVec_u const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_add_epi32(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = _mm_add_epi32(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_u add(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_add_epi32(mVec[0], t0);
+            __m128i t2 = _mm_set1_epi32(b);
+            __m128i t3 = _mm_add_epi32(mVec[1], t2);
+            return SIMDVec_u(t1, t3);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator+ (uint32_t b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_add_epi32(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = _mm_add_epi32(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_u(t2, t4);
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVec_u const & b) {
+            mVec[0] = _mm_add_epi32(mVec[0], b.mVec[0]);
+            mVec[1] = _mm_add_epi32(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator+= (SIMDVec_u const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_add_epi32(mVec[0], b.mVec[0]);
+            __m128i t1 = _mm_add_epi32(mVec[1], b.mVec[1]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_u & adda(uint32_t b) {
+            mVec[0] = _mm_add_epi32(mVec[0], _mm_set1_epi32(b));
+            mVec[1] = _mm_add_epi32(mVec[1], _mm_set1_epi32(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator+= (uint32_t b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_add_epi32(mVec[0], _mm_set1_epi32(b));
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = _mm_add_epi32(mVec[1], _mm_set1_epi32(b));
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVec_u const & b) const {
+            __m128i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            __m128i t1 = saturatedAdd(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = saturatedAdd(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec[0], t0);
+            __m128i t2 = saturatedAdd(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = saturatedAdd(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_u(t2, t4);
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVec_u const & b) {
+            mVec[0] = saturatedAdd(mVec[0], b.mVec[0]);
+            mVec[1] = saturatedAdd(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = saturatedAdd(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = saturatedAdd(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec[0] = saturatedAdd(mVec[0], t0);
+            mVec[1] = saturatedAdd(mVec[1], t0);
+            return *this;
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedAdd(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = saturatedAdd(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // POSTINC
+        UME_FORCE_INLINE SIMDVec_u postinc() {
+            __m128i t0 = _mm_set1_epi32(1);
+            __m128i t1 = mVec[0];
+            mVec[0] = _mm_add_epi32(mVec[0], t0);
+            __m128i t2 = mVec[1];
+            mVec[1] = _mm_add_epi32(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator++ (int) {
+            return postinc();
+        }
+        // MPOSTINC
+        UME_FORCE_INLINE SIMDVec_u postinc(SIMDVecMask<8> const & mask) {
+            __m128i t0 = _mm_set1_epi32(1);
+            __m128i t1 = mVec[0];
+            __m128i t2 = _mm_add_epi32(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t2, mask.mMask[0]);
+            __m128i t3 = mVec[1];
+            __m128i t4 = _mm_add_epi32(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t4, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // PREFINC
+        UME_FORCE_INLINE SIMDVec_u & prefinc() {
+            __m128i t0 = _mm_set1_epi32(1);
+            mVec[0] = _mm_add_epi32(mVec[0], t0);
+            mVec[1] = _mm_add_epi32(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator++ () {
+            return prefinc();
+        }
+        // MPREFINC
+        UME_FORCE_INLINE SIMDVec_u & prefinc(SIMDVecMask<8> const & mask) {
+            __m128i t0 = _mm_set1_epi32(1);
+            __m128i t1 = _mm_add_epi32(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = _mm_add_epi32(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_sub_epi32(mVec[0], b.mVec[0]);
+            __m128i t1 = _mm_sub_epi32(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator- (SIMDVec_u const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_sub_epi32(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = _mm_sub_epi32(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_u sub(uint32_t b) const {
+            __m128i t0 = _mm_sub_epi32(mVec[0], _mm_set1_epi32(b));
+            __m128i t1 = _mm_sub_epi32(mVec[1], _mm_set1_epi32(b));
+            return SIMDVec_u(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator- (uint32_t b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_sub_epi32(mVec[0], _mm_set1_epi32(b));
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = _mm_sub_epi32(mVec[1], _mm_set1_epi32(b));
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVec_u const & b) {
+            mVec[0] = _mm_sub_epi32(mVec[0], b.mVec[0]);
+            mVec[1] = _mm_sub_epi32(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-= (SIMDVec_u const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_sub_epi32(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = _mm_sub_epi32(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_u & suba(uint32_t b) {
+            mVec[0] = _mm_sub_epi32(mVec[0], _mm_set1_epi32(b));
+            mVec[1] = _mm_sub_epi32(mVec[1], _mm_set1_epi32(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-= (uint32_t b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_sub_epi32(mVec[0], _mm_set1_epi32(b));
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = _mm_sub_epi32(mVec[1], _mm_set1_epi32(b));
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVec_u const & b) const {
+            __m128i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            __m128i t1 = saturatedSub(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = saturatedSub(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec[0], t0);
+            __m128i t2 = saturatedSub(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = saturatedSub(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_u(t2, t4);
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVec_u const & b) {
+            mVec[0] = saturatedSub(mVec[0], b.mVec[0]);
+            mVec[1] = saturatedSub(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = saturatedSub(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = saturatedSub(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec[0] = saturatedSub(mVec[0], t0);
+            mVec[1] = saturatedSub(mVec[1], t0);
+            return *this;
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = saturatedSub(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = saturatedSub(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_sub_epi32(b.mVec[0], mVec[0]);
+            __m128i t1 = _mm_sub_epi32(b.mVec[1], mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
+        // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_sub_epi32(b.mVec[0], mVec[0]);
+            __m128i t1 = blendv_epi8_sse(b.mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = _mm_sub_epi32(b.mVec[1], mVec[1]);
+            __m128i t3 = blendv_epi8_sse(b.mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_u subfrom(uint32_t b) const {
+            __m128i t0 = _mm_sub_epi32(_mm_set1_epi32(b), mVec[0]);
+            __m128i t1 = _mm_sub_epi32(_mm_set1_epi32(b), mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
+        // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_sub_epi32(t0, mVec[0]);
+            __m128i t2 = blendv_epi8_sse(t0, t1, mask.mMask[0]);
+            __m128i t3 = _mm_sub_epi32(t0, mVec[1]);
+            __m128i t4 = blendv_epi8_sse(t0, t3, mask.mMask[1]);
+            return SIMDVec_u(t2, t4);
+        }
+        // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(SIMDVec_u const & b) {
+            mVec[0] = _mm_sub_epi32(b.mVec[0], mVec[0]);
+            mVec[1] = _mm_sub_epi32(b.mVec[1], mVec[1]);
+            return *this;
+        }
+        // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_sub_epi32(b.mVec[0], mVec[0]);
+            mVec[0] = blendv_epi8_sse(b.mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = _mm_sub_epi32(b.mVec[1], mVec[1]);
+            mVec[1] = blendv_epi8_sse(b.mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(uint32_t b) {
+            mVec[0] = _mm_sub_epi32(_mm_set1_epi32(b), mVec[0]);
+            mVec[1] = _mm_sub_epi32(_mm_set1_epi32(b), mVec[1]);
+            return *this;
+        }
+        // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_u subfroma(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_sub_epi32(t0, mVec[0]);
+            mVec[0] = blendv_epi8_sse(t0, t1, mask.mMask[0]);
+            __m128i t2 = _mm_sub_epi32(t0, mVec[1]);
+            mVec[1] = blendv_epi8_sse(t0, t2, mask.mMask[1]);
+            return *this;
+        }
+        // POSTDEC
+        UME_FORCE_INLINE SIMDVec_u postdec() {
+            __m128i t0 = _mm_set1_epi32(1);
+            __m128i t1 = mVec[0];
+            mVec[0] = _mm_sub_epi32(mVec[0], t0);
+            __m128i t2 = mVec[1];
+            mVec[1] = _mm_sub_epi32(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator-- (int) {
+            return postdec();
+        }
+        // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_u postdec(SIMDVecMask<8> const & mask) {
+            __m128i t0 = _mm_set1_epi32(1);
+            __m128i t1 = mVec[0];
+            __m128i t2 = _mm_sub_epi32(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t2, mask.mMask[0]);
+            __m128i t3 = mVec[1];
+            __m128i t4 = _mm_sub_epi32(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t4, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // PREFDEC
+        UME_FORCE_INLINE SIMDVec_u & prefdec() {
+            __m128i t0 = _mm_set1_epi32(1);
+            mVec[0] = _mm_sub_epi32(mVec[0], t0);
+            mVec[1] = _mm_sub_epi32(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-- () {
+            return prefdec();
+        }
+        // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_u & prefdec(SIMDVecMask<8> const & mask) {
+            __m128i t0 = _mm_set1_epi32(1);
+            __m128i t1 = _mm_sub_epi32(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = _mm_sub_epi32(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // MULV
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVec_u const & b) const {
+            __m128i t0 = mullo_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = mullo_epi32_sse(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator* (SIMDVec_u const & b) const {
+            return mul(b);
+        }
+        // MMULV
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = mullo_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = mullo_epi32_sse(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // MULS
+        UME_FORCE_INLINE SIMDVec_u mul(uint32_t b) const {
+            __m128i t0 = mullo_epi32_sse(mVec[0], _mm_set1_epi32(b));
+            __m128i t1 = mullo_epi32_sse(mVec[1], _mm_set1_epi32(b));
+            return SIMDVec_u(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator* (uint32_t b) const {
+            return mul(b);
+        }
+        // MMULS
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = mullo_epi32_sse(mVec[0], _mm_set1_epi32(b));
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = mullo_epi32_sse(mVec[1], _mm_set1_epi32(b));
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // MULVA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVec_u const & b) {
+            mVec[0] = mullo_epi32_sse(mVec[0], b.mVec[0]);
+            mVec[1] = mullo_epi32_sse(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator*= (SIMDVec_u const & b) {
+            return mula(b);
+        }
+        // MMULVA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = mullo_epi32_sse(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = mullo_epi32_sse(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // MULSA
+        UME_FORCE_INLINE SIMDVec_u & mula(uint32_t b) {
+            mVec[0] = mullo_epi32_sse(mVec[0], _mm_set1_epi32(b));
+            mVec[1] = mullo_epi32_sse(mVec[1], _mm_set1_epi32(b));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator*= (uint32_t b) {
+            return mula(b);
+        }
+        // MMULSA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = mullo_epi32_sse(mVec[0], _mm_set1_epi32(b));
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = mullo_epi32_sse(mVec[1], _mm_set1_epi32(b));
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // DIVV
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVec_u const & b) const {
+            __m128i t0 = divideVector(mVec[0], b.mVec[0]);
+            __m128i t1 = divideVector(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (SIMDVec_u const & b) const {
+            return div(b);
+        }
+        // MDIVV
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = divideVector(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = divideVector(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // DIVS
+        UME_FORCE_INLINE SIMDVec_u div(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = divideVector(mVec[0], t0);
+            __m128i t2 = divideVector(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (uint32_t b) const {
+            return div(b);
+        }
+        // MDIVS
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = divideVector(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = divideVector(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_u(t2, t4);
+        }
+        // DIVVA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVec_u const & b) {
+            mVec[0] = divideVector(mVec[0], b.mVec[0]);
+            mVec[1] = divideVector(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDVec_u const & b) {
+            return diva(b);
+        }
+        // MDIVVA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = divideVector(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = divideVector(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // DIVSA
+        UME_FORCE_INLINE SIMDVec_u & diva(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec[0] = divideVector(mVec[0], t0);
+            mVec[1] = divideVector(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (uint32_t b) {
+            return diva(b);
+        }
+        // MDIVSA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = divideVector(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = divideVector(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDDivisor<uint32_t> const & b) const {
+            __m128i t0 = divideMagic(mVec[0], b);
+            __m128i t1 = divideMagic(mVec[1], b);
+            return SIMDVec_u(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (SIMDDivisor<uint32_t> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<8> const & mask, SIMDDivisor<uint32_t> const & b) const {
+            __m128i t0 = divideMagic(mVec[0], b);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = divideMagic(mVec[1], b);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDDivisor<uint32_t> const & b) {
+            mVec[0] = divideMagic(mVec[0], b);
+            mVec[1] = divideMagic(mVec[1], b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDDivisor<uint32_t> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<8> const & mask, SIMDDivisor<uint32_t> const & b) {
+            __m128i t0 = divideMagic(mVec[0], b);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = divideMagic(mVec[1], b);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // REMV
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVec_u const & b) const {
+            __m128i t0 = remainderVector(mVec[0], b.mVec[0]);
+            __m128i t1 = remainderVector(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (SIMDVec_u const & b) const {
+            return rem(b);
+        }
+        // MREMV
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = remainderVector(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = remainderVector(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // REMS
+        UME_FORCE_INLINE SIMDVec_u rem(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = remainderVector(mVec[0], t0);
+            __m128i t2 = remainderVector(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (uint32_t b) const {
+            return rem(b);
+        }
+        // MREMS
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = remainderVector(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = remainderVector(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_u(t2, t4);
+        }
+        // REMVA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVec_u const & b) {
+            mVec[0] = remainderVector(mVec[0], b.mVec[0]);
+            mVec[1] = remainderVector(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (SIMDVec_u const & b) {
+            return rema(b);
+        }
+        // MREMVA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = remainderVector(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = remainderVector(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // REMSA
+        UME_FORCE_INLINE SIMDVec_u & rema(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec[0] = remainderVector(mVec[0], t0);
+            mVec[1] = remainderVector(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (uint32_t b) {
+            return rema(b);
+        }
+        // MREMSA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = remainderVector(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = remainderVector(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // REMD
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDDivisor<uint32_t> const & b) const {
+            __m128i t0 = remainderMagic(mVec[0], b);
+            __m128i t1 = remainderMagic(mVec[1], b);
+            return SIMDVec_u(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (SIMDDivisor<uint32_t> const & b) const {
+            return rem(b);
+        }
+        // MREMD
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<8> const & mask, SIMDDivisor<uint32_t> const & b) const {
+            __m128i t0 = remainderMagic(mVec[0], b);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = remainderMagic(mVec[1], b);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // REMDA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDDivisor<uint32_t> const & b) {
+            mVec[0] = remainderMagic(mVec[0], b);
+            mVec[1] = remainderMagic(mVec[1], b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (SIMDDivisor<uint32_t> const & b) {
+            return rema(b);
+        }
+        // MREMDA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<8> const & mask, SIMDDivisor<uint32_t> const & b) {
+            __m128i t0 = remainderMagic(mVec[0], b);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = remainderMagic(mVec[1], b);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // RCP
+        // MRCP
+        // RCPS
+        // MRCPS
+        // RCPA
+        // MRCPA
+        // RCPSA
+        // MRCPSA
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<8> cmpeq(SIMDVec_u const & b) const {
+            __m128i m0 = _mm_cmpeq_epi32(mVec[0], b.mVec[0]);
+            __m128i m1 = _mm_cmpeq_epi32(mVec[1], b.mVec[1]);
+            return SIMDVecMask<8>(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator==(SIMDVec_u const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<8> cmpeq(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i m0 = _mm_cmpeq_epi32(mVec[0], t0);
+            __m128i m1 = _mm_cmpeq_epi32(mVec[1], t0);
+            return SIMDVecMask<8>(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator== (uint32_t b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<8> cmpne(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i m0 = _mm_cmpeq_epi32(mVec[0], b.mVec[0]);
+            __m128i m1 = _mm_xor_si128(m0, t0);
+            __m128i m2 = _mm_cmpeq_epi32(mVec[1], b.mVec[1]);
+            __m128i m3 = _mm_xor_si128(m2, t0);
+            return SIMDVecMask<8>(m1, m3);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator!= (SIMDVec_u const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<8> cmpne(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i m0 = _mm_cmpeq_epi32(mVec[0], t0);
+            __m128i m1 = _mm_xor_si128(m0, t1);
+            __m128i m2 = _mm_cmpeq_epi32(mVec[1], t0);
+            __m128i m3 = _mm_xor_si128(m2, t1);
+            return SIMDVecMask<8>(m1, m3);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator!= (uint32_t b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<8> cmpgt(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_set1_epi32(0x80000000);
+            __m128i t1 = _mm_xor_si128(mVec[0], t0);
+            __m128i t2 = _mm_xor_si128(b.mVec[0], t0);
+            __m128i m0 = _mm_cmpgt_epi32(t1, t2);
+            __m128i t3 = _mm_xor_si128(mVec[1], t0);
+            __m128i t4 = _mm_xor_si128(b.mVec[1], t0);
+            __m128i m1 = _mm_cmpgt_epi32(t3, t4);
+            return SIMDVecMask<8>(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator> (SIMDVec_u const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<8> cmpgt(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(0x80000000);
+            __m128i t1 = _mm_set1_epi32(b ^ 0x80000000);
+            __m128i t2 = _mm_xor_si128(mVec[0], t0);
+            __m128i m0 = _mm_cmpgt_epi32(t2, t1);
+            __m128i t3 = _mm_xor_si128(mVec[1], t0);
+            __m128i m1 = _mm_cmpgt_epi32(t3, t1);
+            return SIMDVecMask<8>(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator> (uint32_t b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<8> cmplt(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_set1_epi32(0x80000000);
+            __m128i t1 = _mm_xor_si128(mVec[0], t0);
+            __m128i t2 = _mm_xor_si128(b.mVec[0], t0);
+            __m128i m0 = _mm_cmpgt_epi32(t2, t1);
+            __m128i t3 = _mm_xor_si128(mVec[1], t0);
+            __m128i t4 = _mm_xor_si128(b.mVec[1], t0);
+            __m128i m1 = _mm_cmpgt_epi32(t4, t3);
+            return SIMDVecMask<8>(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator< (SIMDVec_u const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<8> cmplt(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(0x80000000);
+            __m128i t2 = _mm_set1_epi32(b ^ 0x80000000);
+            __m128i t1 = _mm_xor_si128(mVec[0], t0);
+            __m128i m0 = _mm_cmpgt_epi32(t2, t1);
+            __m128i t3 = _mm_xor_si128(mVec[1], t0);
+            __m128i m1 = _mm_cmpgt_epi32(t2, t3);
+            return SIMDVecMask<8>(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator< (uint32_t b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<8> cmpge(SIMDVec_u const & b) const {
+            __m128i t0 = max_epu32_sse(mVec[0], b.mVec[0]);
+            __m128i m0 = _mm_cmpeq_epi32(mVec[0], t0);
+            __m128i t1 = max_epu32_sse(mVec[1], b.mVec[1]);
+            __m128i m1 = _mm_cmpeq_epi32(mVec[1], t1);
+            return SIMDVecMask<8>(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator>= (SIMDVec_u const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<8> cmpge(uint32_t b) const {
+            __m128i t0 = max_epu32_sse(mVec[0], _mm_set1_epi32(b));
+            __m128i m0 = _mm_cmpeq_epi32(mVec[0], t0);
+            __m128i t1 = max_epu32_sse(mVec[1], _mm_set1_epi32(b));
+            __m128i m1 = _mm_cmpeq_epi32(mVec[1], t1);
+            return SIMDVecMask<8>(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator>= (uint32_t b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<8> cmple(SIMDVec_u const & b) const {
+            __m128i t0 = max_epu32_sse(mVec[0], b.mVec[0]);
+            __m128i m0 = _mm_cmpeq_epi32(b.mVec[0], t0);
+            __m128i t1 = max_epu32_sse(mVec[1], b.mVec[1]);
+            __m128i m1 = _mm_cmpeq_epi32(b.mVec[1], t1);
+            return SIMDVecMask<8>(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator<= (SIMDVec_u const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<8> cmple(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = max_epu32_sse(mVec[0],t0);
+            __m128i m0 = _mm_cmpeq_epi32(t0, t1);
+            __m128i t2 = max_epu32_sse(mVec[1], t1);
+            __m128i m1 = _mm_cmpeq_epi32(t0, t2);
+            return SIMDVecMask<8>(m0, m1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<8> operator<= (uint32_t b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_u const & b) const {
+            __m128i m0 = _mm_cmpeq_epi32(mVec[0], b.mVec[0]);
+            __m128i m1 = _mm_cmpeq_epi32(mVec[1], b.mVec[1]);
+            return _mm_movemask_epi8(_mm_and_si128(m0, m1)) == 0xFFFF;
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i m0 = _mm_cmpeq_epi32(mVec[0], t0);
+            __m128i m1 = _mm_cmpeq_epi32(mVec[1], t0);
+            return _mm_movemask_epi8(_mm_and_si128(m0, m1)) == 0xFFFF;
+        }
+        // UNIQUE
+        UME_FORCE_INLINE bool unique() const {
+            alignas(16) uint32_t raw[8];
+            _mm_store_si128((__m128i *)raw, mVec[0]);
+            _mm_store_si128((__m128i *)(raw + 4), mVec[1]);
+            for (unsigned int i = 0; i < 7; i++) {
+                for (unsigned int j = i + 1; j < 8; j++) {
+                    if (raw[i] == raw[j]) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+        // HADD
+        UME_FORCE_INLINE uint32_t hadd() const {
+            __m128i t0 = _mm_add_epi32(mVec[0], mVec[1]);
+            __m128i t1 = _mm_add_epi32(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = _mm_add_epi32(t1, _mm_shuffle_epi32(t1, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t2));
+            return retval;
+        }
+        // MHADD
+        UME_FORCE_INLINE uint32_t hadd(SIMDVecMask<8> const & mask) const {
+            __m128i t0 = _mm_set1_epi32(0);
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = _mm_add_epi32(t1, t2);
+            __m128i t4 = _mm_add_epi32(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = _mm_add_epi32(t4, _mm_shuffle_epi32(t4, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t5));
+            return retval;
+        }
+        // HADDS
+        UME_FORCE_INLINE uint32_t hadd(uint32_t b) const {
+            __m128i t0 = _mm_add_epi32(mVec[0], mVec[1]);
+            __m128i t1 = _mm_add_epi32(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = _mm_add_epi32(t1, _mm_shuffle_epi32(t1, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t2));
+            return retval + b;
+        }
+        // MHADDS
+        UME_FORCE_INLINE uint32_t hadd(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(0);
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = _mm_add_epi32(t1, t2);
+            __m128i t4 = _mm_add_epi32(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = _mm_add_epi32(t4, _mm_shuffle_epi32(t4, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t5));
+            return retval + b;
+        }
+        // HMUL
+        UME_FORCE_INLINE uint32_t hmul() const {
+            __m128i t0 = mullo_epi32_sse(mVec[0], mVec[1]);
+            __m128i t1 = mullo_epi32_sse(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = mullo_epi32_sse(t1, _mm_shuffle_epi32(t1, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t2));
+            return retval;
+        }
+        // MHMUL
+        UME_FORCE_INLINE uint32_t hmul(SIMDVecMask<8> const & mask) const {
+            __m128i t0 = _mm_set1_epi32(1);
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = mullo_epi32_sse(t1, t2);
+            __m128i t4 = mullo_epi32_sse(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = mullo_epi32_sse(t4, _mm_shuffle_epi32(t4, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t5));
+            return retval;
+        }
+        // HMULS
+        UME_FORCE_INLINE uint32_t hmul(uint32_t b) const {
+            __m128i t0 = mullo_epi32_sse(mVec[0], mVec[1]);
+            __m128i t1 = mullo_epi32_sse(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = mullo_epi32_sse(t1, _mm_shuffle_epi32(t1, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t2));
+            return retval * b;
+        }
+        // MHMULS
+        UME_FORCE_INLINE uint32_t hmul(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(1);
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = mullo_epi32_sse(t1, t2);
+            __m128i t4 = mullo_epi32_sse(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = mullo_epi32_sse(t4, _mm_shuffle_epi32(t4, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t5));
+            return retval * b;
+        }
+
+        // FMULADDV
+        UME_FORCE_INLINE SIMDVec_u fmuladd(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = mullo_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = _mm_add_epi32(t0, c.mVec[0]);
+            __m128i t2 = mullo_epi32_sse(mVec[1], b.mVec[1]);
+            __m128i t3 = _mm_add_epi32(t2, c.mVec[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // MFMULADDV
+        UME_FORCE_INLINE SIMDVec_u fmuladd(SIMDVecMask<8> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = mullo_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = _mm_add_epi32(t0, c.mVec[0]);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = mullo_epi32_sse(mVec[1], b.mVec[1]);
+            __m128i t4 = _mm_add_epi32(t3, c.mVec[1]);
+            __m128i t5 = blendv_epi8_sse(mVec[1], t4, mask.mMask[1]);
+            return SIMDVec_u(t2, t5);
+        }
+        // FMULSUBV
+        UME_FORCE_INLINE SIMDVec_u fmulsub(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = mullo_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = _mm_sub_epi32(t0, c.mVec[0]);
+            __m128i t2 = mullo_epi32_sse(mVec[1], b.mVec[1]);
+            __m128i t3 = _mm_sub_epi32(t2, c.mVec[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // MFMULSUBV
+        UME_FORCE_INLINE SIMDVec_u fmulsub(SIMDVecMask<8> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = mullo_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = _mm_sub_epi32(t0, c.mVec[0]);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = mullo_epi32_sse(mVec[1], b.mVec[1]);
+            __m128i t4 = _mm_sub_epi32(t3, c.mVec[1]);
+            __m128i t5 = blendv_epi8_sse(mVec[1], t4, mask.mMask[1]);
+            return SIMDVec_u(t2, t5);
+        }
+        // FADDMULV
+        UME_FORCE_INLINE SIMDVec_u faddmul(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = _mm_add_epi32(mVec[0], b.mVec[0]);
+            __m128i t1 = mullo_epi32_sse(t0, c.mVec[0]);
+            __m128i t2 = _mm_add_epi32(mVec[1], b.mVec[1]);
+            __m128i t3 = mullo_epi32_sse(t2, c.mVec[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // MFADDMULV
+        UME_FORCE_INLINE SIMDVec_u faddmul(SIMDVecMask<8> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = _mm_add_epi32(mVec[0], b.mVec[0]);
+            __m128i t1 = mullo_epi32_sse(t0, c.mVec[0]);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = _mm_add_epi32(mVec[1], b.mVec[1]);
+            __m128i t4 = mullo_epi32_sse(t3, c.mVec[1]);
+            __m128i t5 = blendv_epi8_sse(mVec[1], t4, mask.mMask[1]);
+            return SIMDVec_u(t2, t5);
+        }
+        // FSUBMULV
+        UME_FORCE_INLINE SIMDVec_u fsubmul(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = _mm_sub_epi32(mVec[0], b.mVec[0]);
+            __m128i t1 = mullo_epi32_sse(t0, c.mVec[0]);
+            __m128i t2 = _mm_sub_epi32(mVec[1], b.mVec[1]);
+            __m128i t3 = mullo_epi32_sse(t2, c.mVec[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // MFSUBMULV
+        UME_FORCE_INLINE SIMDVec_u fsubmul(SIMDVecMask<8> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = _mm_sub_epi32(mVec[0], b.mVec[0]);
+            __m128i t1 = mullo_epi32_sse(t0, c.mVec[0]);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = _mm_sub_epi32(mVec[1], b.mVec[1]);
+            __m128i t4 = mullo_epi32_sse(t3, c.mVec[1]);
+            __m128i t5 = blendv_epi8_sse(mVec[1], t4, mask.mMask[1]);
+            return SIMDVec_u(t2, t5);
+        }
+
+        // MAXV
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVec_u const & b) const {
+            __m128i t0 = max_epu32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = max_epu32_sse(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
+        // MMAXV
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = max_epu32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = max_epu32_sse(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // MAXS
+        UME_FORCE_INLINE SIMDVec_u max(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = max_epu32_sse(mVec[0], t0);
+            __m128i t2 = max_epu32_sse(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
+        // MMAXS
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = max_epu32_sse(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = max_epu32_sse(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_u(t2, t4);
+        }
+        // MAXVA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVec_u const & b) {
+            mVec[0] = max_epu32_sse(mVec[0], b.mVec[0]);
+            mVec[1] = max_epu32_sse(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        // MMAXVA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = max_epu32_sse(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = max_epu32_sse(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // MAXSA
+        UME_FORCE_INLINE SIMDVec_u & maxa(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec[0] = max_epu32_sse(mVec[0], t0);
+            mVec[1] = max_epu32_sse(mVec[1], t0);
+            return *this;
+        }
+        // MMAXSA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = max_epu32_sse(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = max_epu32_sse(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // MINV
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVec_u const & b) const {
+            __m128i t0 = min_epu32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = min_epu32_sse(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
+        // MMINV
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = min_epu32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = min_epu32_sse(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // MINS
+        UME_FORCE_INLINE SIMDVec_u min(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = min_epu32_sse(mVec[0], t0);
+            __m128i t2 = min_epu32_sse(mVec[1], t1);
+            return SIMDVec_u(t1, t2);
+        }
+        // MMINS
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = min_epu32_sse(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = min_epu32_sse(mVec[1], t1);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_u(t2, t4);
+        }
+        // MINVA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVec_u const & b) {
+            mVec[0] = min_epu32_sse(mVec[0], b.mVec[0]);
+            mVec[1] = min_epu32_sse(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        // MMINVA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = min_epu32_sse(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = min_epu32_sse(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // MINSA
+        UME_FORCE_INLINE SIMDVec_u & mina(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec[0] = min_epu32_sse(mVec[0], t0);
+            mVec[1] = min_epu32_sse(mVec[1], t0);
+            return *this;
+        }
+        // MMINSA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = min_epu32_sse(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = min_epu32_sse(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // HMAX
+        UME_FORCE_INLINE uint32_t hmax() const {
+            __m128i t0 = max_epu32_sse(mVec[0], mVec[1]);
+            __m128i t1 = max_epu32_sse(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = max_epu32_sse(t1, _mm_shuffle_epi32(t1, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t2));
+            return retval;
+        }
+        // MHMAX
+        UME_FORCE_INLINE uint32_t hmax(SIMDVecMask<8> const & mask) const {
+            __m128i t0 = _mm_set1_epi32(std::numeric_limits<uint32_t>::min());
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = max_epu32_sse(t1, t2);
+            __m128i t4 = max_epu32_sse(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = max_epu32_sse(t4, _mm_shuffle_epi32(t4, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t5));
+            return retval;
+        }
+        // IMAX
+        // MIMAX
+        // HMIN
+        UME_FORCE_INLINE uint32_t hmin() const {
+            __m128i t0 = min_epu32_sse(mVec[0], mVec[1]);
+            __m128i t1 = min_epu32_sse(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = min_epu32_sse(t1, _mm_shuffle_epi32(t1, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t2));
+            return retval;
+        }
+        // MHMIN
+        UME_FORCE_INLINE uint32_t hmin(SIMDVecMask<8> const & mask) const {
+            __m128i t0 = _mm_set1_epi32(std::numeric_limits<uint32_t>::max());
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = min_epu32_sse(t1, t2);
+            __m128i t4 = min_epu32_sse(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = min_epu32_sse(t4, _mm_shuffle_epi32(t4, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t5));
+            return retval;
+        }
+        // IMIN
+        // MIMIN
+
+        // BANDV
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_and_si128(mVec[0], b.mVec[0]);
+            __m128i t1 = _mm_and_si128(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator& (SIMDVec_u const & b) const {
+            return band(b);
+        }
+        // MBANDV
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_and_si128(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = _mm_and_si128(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // BANDS
+        UME_FORCE_INLINE SIMDVec_u band(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_and_si128(mVec[0], t0);
+            __m128i t2 = _mm_and_si128(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator& (uint32_t b) const {
+            return band(b);
+        }
+        // MBANDS
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_and_si128(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = _mm_and_si128(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_u(t2, t4);
+        }
+        // BANDVA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVec_u const & b) {
+            mVec[0] = _mm_and_si128(mVec[0], b.mVec[0]);
+            mVec[1] = _mm_and_si128(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (SIMDVec_u const & b) {
+            return banda(b);
+        }
+        // MBANDVA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_and_si128(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = _mm_and_si128(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // BANDSA
+        UME_FORCE_INLINE SIMDVec_u & banda(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec[0] = _mm_and_si128(mVec[0], t0);
+            mVec[1] = _mm_and_si128(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (bool b) {
+            return banda(b);
+        }
+        // MBANDSA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_and_si128(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = _mm_and_si128(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // BORV
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_or_si128(mVec[0], b.mVec[0]);
+            __m128i t1 = _mm_or_si128(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator| (SIMDVec_u const & b) const {
+            return bor(b);
+        }
+        // MBORV
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_or_si128(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = _mm_or_si128(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // BORS
+        UME_FORCE_INLINE SIMDVec_u bor(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_or_si128(mVec[0], t0);
+            __m128i t2 = _mm_or_si128(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator| (uint32_t b) const {
+            return bor(b);
+        }
+        // MBORS
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_or_si128(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = _mm_or_si128(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_u(t2, t4);
+        }
+        // BORVA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVec_u const & b) {
+            mVec[0] = _mm_or_si128(mVec[0], b.mVec[0]);
+            mVec[1] = _mm_or_si128(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (SIMDVec_u const & b) {
+            return bora(b);
+        }
+        // MBORVA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_or_si128(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = _mm_or_si128(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // BORSA
+        UME_FORCE_INLINE SIMDVec_u & bora(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec[0] = _mm_or_si128(mVec[0], t0);
+            mVec[1] = _mm_or_si128(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (uint32_t b) {
+            return bora(b);
+        }
+        // MBORSA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_or_si128(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = _mm_or_si128(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // BXORV
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_xor_si128(mVec[0], b.mVec[0]);
+            __m128i t1 = _mm_xor_si128(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator^ (SIMDVec_u const & b) const {
+            return bxor(b);
+        }
+        // MBXORV
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_xor_si128(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = _mm_xor_si128(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // BXORS
+        UME_FORCE_INLINE SIMDVec_u bxor(uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_xor_si128(mVec[0], t0);
+            __m128i t2 = _mm_xor_si128(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator^ (uint32_t b) const {
+            return bxor(b);
+        }
+        // MBXORS
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_xor_si128(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = _mm_xor_si128(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_u(t2, t4);
+        }
+        // BXORVA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVec_u const & b) {
+            mVec[0] = _mm_xor_si128(mVec[0], b.mVec[0]);
+            mVec[1] = _mm_xor_si128(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator^= (SIMDVec_u const & b) {
+            return bxora(b);
+        }
+        // MBXORVA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_xor_si128(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = _mm_xor_si128(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // BXORSA
+        UME_FORCE_INLINE SIMDVec_u & bxora(uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            mVec[0] = _mm_xor_si128(mVec[0], t0);
+            __m128i t1 = _mm_set1_epi32(b);
+            mVec[1] = _mm_xor_si128(mVec[1], t1);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator^= (uint32_t b) {
+            return bxora(b);
+        }
+        // MBXORSA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_set1_epi32(b);
+            __m128i t1 = _mm_xor_si128(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = _mm_xor_si128(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // BNOT
+        UME_FORCE_INLINE SIMDVec_u bnot() const {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec[0], t0);
+            __m128i t2 = _mm_xor_si128(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator~ () const {
+            return bnot();
+        }
+        // MBNOT
+        UME_FORCE_INLINE SIMDVec_u bnot(SIMDVecMask<8> const & mask) const {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = _mm_xor_si128(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_u(t2, t4);
+        }
+        // BNOTA
+        UME_FORCE_INLINE SIMDVec_u & bnota() {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            mVec[0] = _mm_xor_si128(mVec[0], t0);
+            mVec[1] = _mm_xor_si128(mVec[1], t0);
+            return *this;
+        }
+        // MBNOTA
+        UME_FORCE_INLINE SIMDVec_u bnota(SIMDVecMask<8> const & mask) {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = _mm_xor_si128(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // HBAND
+        UME_FORCE_INLINE uint32_t hband() const {
+            __m128i t0 = _mm_and_si128(mVec[0], mVec[1]);
+            __m128i t1 = _mm_and_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = _mm_and_si128(t1, _mm_shuffle_epi32(t1, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t2));
+            return retval;
+        }
+        // MHBAND
+        UME_FORCE_INLINE uint32_t hband(SIMDVecMask<8> const & mask) const {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = _mm_and_si128(t1, t2);
+            __m128i t4 = _mm_and_si128(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = _mm_and_si128(t4, _mm_shuffle_epi32(t4, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t5));
+            return retval;
+        }
+        // HBANDS
+        UME_FORCE_INLINE uint32_t hband(uint32_t b) const {
+            __m128i t0 = _mm_and_si128(mVec[0], mVec[1]);
+            __m128i t1 = _mm_and_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = _mm_and_si128(t1, _mm_shuffle_epi32(t1, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t2));
+            return retval & b;
+        }
+        // MHBANDS
+        UME_FORCE_INLINE uint32_t hband(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = _mm_and_si128(t1, t2);
+            __m128i t4 = _mm_and_si128(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = _mm_and_si128(t4, _mm_shuffle_epi32(t4, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t5));
+            return retval & b;
+        }
+        // HBOR
+        UME_FORCE_INLINE uint32_t hbor() const {
+            __m128i t0 = _mm_or_si128(mVec[0], mVec[1]);
+            __m128i t1 = _mm_or_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = _mm_or_si128(t1, _mm_shuffle_epi32(t1, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t2));
+            return retval;
+        }
+        // MHBOR
+        UME_FORCE_INLINE uint32_t hbor(SIMDVecMask<8> const & mask) const {
+            __m128i t0 = _mm_set1_epi32(0);
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = _mm_or_si128(t1, t2);
+            __m128i t4 = _mm_or_si128(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = _mm_or_si128(t4, _mm_shuffle_epi32(t4, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t5));
+            return retval;
+        }
+        // HBORS
+        UME_FORCE_INLINE uint32_t hbor(uint32_t b) const {
+            __m128i t0 = _mm_or_si128(mVec[0], mVec[1]);
+            __m128i t1 = _mm_or_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = _mm_or_si128(t1, _mm_shuffle_epi32(t1, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t2));
+            return retval | b;
+        }
+        // MHBORS
+        UME_FORCE_INLINE uint32_t hbor(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(0);
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = _mm_or_si128(t1, t2);
+            __m128i t4 = _mm_or_si128(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = _mm_or_si128(t4, _mm_shuffle_epi32(t4, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t5));
+            return retval | b;
+        }
+        // HBXOR
+        UME_FORCE_INLINE uint32_t hbxor() const {
+            __m128i t0 = _mm_xor_si128(mVec[0], mVec[1]);
+            __m128i t1 = _mm_xor_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = _mm_xor_si128(t1, _mm_shuffle_epi32(t1, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t2));
+            return retval;
+        }
+        // MHBXOR
+        UME_FORCE_INLINE uint32_t hbxor(SIMDVecMask<8> const & mask) const {
+            __m128i t0 = _mm_set1_epi32(0);
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = _mm_xor_si128(t1, t2);
+            __m128i t4 = _mm_xor_si128(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = _mm_xor_si128(t4, _mm_shuffle_epi32(t4, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t5));
+            return retval;
+        }
+        // HBXORS
+        UME_FORCE_INLINE uint32_t hbxor(uint32_t b) const {
+            __m128i t0 = _mm_xor_si128(mVec[0], mVec[1]);
+            __m128i t1 = _mm_xor_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            __m128i t2 = _mm_xor_si128(t1, _mm_shuffle_epi32(t1, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t2));
+            return retval ^ b;
+        }
+        // MHBXORS
+        UME_FORCE_INLINE uint32_t hbxor(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_set1_epi32(0);
+            __m128i t1 = blendv_epi8_sse(t0, mVec[0], mask.mMask[0]);
+            __m128i t2 = blendv_epi8_sse(t0, mVec[1], mask.mMask[1]);
+            __m128i t3 = _mm_xor_si128(t1, t2);
+            __m128i t4 = _mm_xor_si128(t3, _mm_shuffle_epi32(t3, 0x4E));
+            __m128i t5 = _mm_xor_si128(t4, _mm_shuffle_epi32(t4, 0xB1));
+            uint32_t retval = uint32_t(_mm_cvtsi128_si32(t5));
+            return retval ^ b;
+        }
+        // GATHERS
+        UME_FORCE_INLINE SIMDVec_u & gather(uint32_t const * baseAddr, uint32_t const * indices) {
+            __m128i t0 = _mm_loadu_si128((__m128i*)indices);
+            mVec[0] = i32gather_epi32_sse((const int *)baseAddr, t0);
+            __m128i t1 = _mm_loadu_si128((__m128i*)(indices + 4));
+            mVec[1] = i32gather_epi32_sse((const int *)baseAddr, t1);
+            return *this;
+        }
+        // MGATHERS
+        UME_FORCE_INLINE SIMDVec_u & gather(SIMDVecMask<8> const & mask, uint32_t const * baseAddr, uint32_t const * indices) {
+            __m128i t0 = _mm_loadu_si128((__m128i*)indices);
+            __m128i t1 = i32gather_epi32_sse((const int *)baseAddr, t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = _mm_loadu_si128((__m128i*)(indices + 4));
+            __m128i t3 = i32gather_epi32_sse((const int *)baseAddr, t2);
+            mVec[1] = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return *this;
+        }
+        // GATHERV
+        UME_FORCE_INLINE SIMDVec_u & gather(uint32_t const * baseAddr, SIMDVec_u const & indices) {
+            mVec[0] = i32gather_epi32_sse((const int *)baseAddr, indices.mVec[0]);
+            mVec[1] = i32gather_epi32_sse((const int *)baseAddr, indices.mVec[1]);
+            return *this;
+        }
+        // MGATHERV
+        UME_FORCE_INLINE SIMDVec_u & gather(SIMDVecMask<8> const & mask, uint32_t const * baseAddr, SIMDVec_u const & indices) {
+            __m128i t0 = i32gather_epi32_sse((const int *)baseAddr, indices.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = i32gather_epi32_sse((const int *)baseAddr, indices.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // SCATTERS
+        UME_FORCE_INLINE uint32_t* scatter(uint32_t* baseAddr, uint32_t* indices) const {
+            scatterLanes(baseAddr, mVec[0], _mm_loadu_si128((__m128i*)indices), 0xF);
+            scatterLanes(baseAddr, mVec[1], _mm_loadu_si128((__m128i*)(indices + 4)), 0xF);
+            return baseAddr;
+        }
+        // MSCATTERS
+        UME_FORCE_INLINE uint32_t* scatter(SIMDVecMask<8> const & mask, uint32_t* baseAddr, uint32_t* indices) const {
+            scatterLanes(baseAddr, mVec[0], _mm_loadu_si128((__m128i*)indices), _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[0])));
+            scatterLanes(baseAddr, mVec[1], _mm_loadu_si128((__m128i*)(indices + 4)), _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[1])));
+            return baseAddr;
+        }
+        // SCATTERV
+        UME_FORCE_INLINE uint32_t* scatter(uint32_t* baseAddr, SIMDVec_u const & indices) const {
+            scatterLanes(baseAddr, mVec[0], indices.mVec[0], 0xF);
+            scatterLanes(baseAddr, mVec[1], indices.mVec[1], 0xF);
+            return baseAddr;
+        }
+        // MSCATTERV
+        UME_FORCE_INLINE uint32_t* scatter(SIMDVecMask<8> const & mask, uint32_t* baseAddr, SIMDVec_u const & indices) const {
+            scatterLanes(baseAddr, mVec[0], indices.mVec[0], _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[0])));
+            scatterLanes(baseAddr, mVec[1], indices.mVec[1], _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[1])));
+            return baseAddr;
+        }
+        // SCATTERADDV
+        UME_FORCE_INLINE uint32_t* scatteradd(uint32_t* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
+            scatterAddLanes(baseAddr, mVec[0], indices.mVec[0], 0xF);
+            scatterAddLanes(baseAddr, mVec[1], indices.mVec[1], 0xF);
+            return baseAddr;
+        }
+        // MSCATTERADDV
+        UME_FORCE_INLINE uint32_t* scatteradd(SIMDVecMask<8> const & mask, uint32_t* baseAddr, SIMDVec_u<uint32_t, 8> const & indices) const {
+            scatterAddLanes(baseAddr, mVec[0], indices.mVec[0], _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[0])));
+            scatterAddLanes(baseAddr, mVec[1], indices.mVec[1], _mm_movemask_ps(_mm_castsi128_ps(mask.mMask[1])));
+            return baseAddr;
+        }
+        // LSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVec_u const & b) const {
+            __m128i t0 = sllv_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = sllv_epi32_sse(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (SIMDVec_u const & b) const {
+            return lsh(b);
+        }
+        // MLSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = sllv_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = sllv_epi32_sse(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // LSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi32(mVec[0], t0);
+            __m128i t2 = _mm_sll_epi32(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (uint32_t b) const {
+            return lsh(b);
+        }
+        // MLSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi32(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = _mm_sll_epi32(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_u(t2, t4);
+        }
+        // LSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVec_u const & b) {
+            mVec[0] = sllv_epi32_sse(mVec[0], b.mVec[0]);
+            mVec[1] = sllv_epi32_sse(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (SIMDVec_u const & b) {
+            return lsha(b);
+        }
+        // MLSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = sllv_epi32_sse(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = sllv_epi32_sse(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // LSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec[0] = _mm_sll_epi32(mVec[0], t0);
+            mVec[1] = _mm_sll_epi32(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (uint32_t b) {
+            return lsha(b);
+        }
+        // MLSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi32(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = _mm_sll_epi32(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // RSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVec_u const & b) const {
+            __m128i t0 = srlv_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = srlv_epi32_sse(mVec[1], b.mVec[1]);
+            return SIMDVec_u(t0, t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (SIMDVec_u const & b) const {
+            return rsh(b);
+        }
+        // MRSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = srlv_epi32_sse(mVec[0], b.mVec[0]);
+            __m128i t1 = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t2 = srlv_epi32_sse(mVec[1], b.mVec[1]);
+            __m128i t3 = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return SIMDVec_u(t1, t3);
+        }
+        // RSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_srl_epi32(mVec[0], t0);
+            __m128i t2 = _mm_srl_epi32(mVec[1], t0);
+            return SIMDVec_u(t1, t2);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (uint32_t b) const {
+            return rsh(b);
+        }
+        // MRSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_srl_epi32(mVec[0], t0);
+            __m128i t2 = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t3 = _mm_srl_epi32(mVec[1], t0);
+            __m128i t4 = blendv_epi8_sse(mVec[1], t3, mask.mMask[1]);
+            return SIMDVec_u(t2, t4);
+        }
+        // RSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVec_u const & b) {
+            mVec[0] = srlv_epi32_sse(mVec[0], b.mVec[0]);
+            mVec[1] = srlv_epi32_sse(mVec[1], b.mVec[1]);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (SIMDVec_u const & b) {
+            return rsha(b);
+        }
+        // MRSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = srlv_epi32_sse(mVec[0], b.mVec[0]);
+            mVec[0] = blendv_epi8_sse(mVec[0], t0, mask.mMask[0]);
+            __m128i t1 = srlv_epi32_sse(mVec[1], b.mVec[1]);
+            mVec[1] = blendv_epi8_sse(mVec[1], t1, mask.mMask[1]);
+            return *this;
+        }
+        // RSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec[0] = _mm_srl_epi32(mVec[0], t0);
+            mVec[1] = _mm_srl_epi32(mVec[1], t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (uint32_t b) {
+            return rsha(b);
+        }
+        // MRSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_srl_epi32(mVec[0], t0);
+            mVec[0] = blendv_epi8_sse(mVec[0], t1, mask.mMask[0]);
+            __m128i t2 = _mm_srl_epi32(mVec[1], t0);
+            mVec[1] = blendv_epi8_sse(mVec[1], t2, mask.mMask[1]);
+            return *this;
+        }
+        // ROLV
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec[0], t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec[0], t2);
+            __m128i t5 = srlv_epi32_sse(mVec[0], t3);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = _mm_and_si128(b.mVec[1], t0);
+            __m128i t8 = _mm_sub_epi32(t1, t7);
+            __m128i t9 = sllv_epi32_sse(mVec[1], t7);
+            __m128i t10 = srlv_epi32_sse(mVec[1], t8);
+            __m128i t11 = _mm_or_si128(t9, t10);
+            return SIMDVec_u(t6, t11);
+        }
+        // MROLV
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec[0], t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec[0], t2);
+            __m128i t5 = srlv_epi32_sse(mVec[0], t3);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = blendv_epi8_sse(mVec[0], t6, mask.mMask[0]);
+            __m128i t8 = _mm_and_si128(b.mVec[1], t0);
+            __m128i t9 = _mm_sub_epi32(t1, t8);
+            __m128i t10 = sllv_epi32_sse(mVec[1], t8);
+            __m128i t11 = srlv_epi32_sse(mVec[1], t9);
+            __m128i t12 = _mm_or_si128(t10, t11);
+            __m128i t13 = blendv_epi8_sse(mVec[1], t12, mask.mMask[1]);
+            return SIMDVec_u(t7, t13);
+        }
+        // ROLS
+        UME_FORCE_INLINE SIMDVec_u rol(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec[0], t0);
+            __m128i t3 = _mm_srl_epi32(mVec[0], t1);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            __m128i t5 = _mm_sll_epi32(mVec[1], t0);
+            __m128i t6 = _mm_srl_epi32(mVec[1], t1);
+            __m128i t7 = _mm_or_si128(t5, t6);
+            return SIMDVec_u(t4, t7);
+        }
+        // MROLS
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec[0], t0);
+            __m128i t3 = _mm_srl_epi32(mVec[0], t1);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            __m128i t5 = blendv_epi8_sse(mVec[0], t4, mask.mMask[0]);
+            __m128i t6 = _mm_sll_epi32(mVec[1], t0);
+            __m128i t7 = _mm_srl_epi32(mVec[1], t1);
+            __m128i t8 = _mm_or_si128(t6, t7);
+            __m128i t9 = blendv_epi8_sse(mVec[1], t8, mask.mMask[1]);
+            return SIMDVec_u(t5, t9);
+        }
+        // ROLVA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVec_u const & b) {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec[0], t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec[0], t2);
+            __m128i t5 = srlv_epi32_sse(mVec[0], t3);
+            mVec[0] = _mm_or_si128(t4, t5);
+            __m128i t6 = _mm_and_si128(b.mVec[1], t0);
+            __m128i t7 = _mm_sub_epi32(t1, t6);
+            __m128i t8 = sllv_epi32_sse(mVec[1], t6);
+            __m128i t9 = srlv_epi32_sse(mVec[1], t7);
+            mVec[1] = _mm_or_si128(t8, t9);
+            return *this;
+        }
+        // MROLVA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec[0], t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec[0], t2);
+            __m128i t5 = srlv_epi32_sse(mVec[0], t3);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            mVec[0] = blendv_epi8_sse(mVec[0], t6, mask.mMask[0]);
+            __m128i t7 = _mm_and_si128(b.mVec[1], t0);
+            __m128i t8 = _mm_sub_epi32(t1, t7);
+            __m128i t9 = sllv_epi32_sse(mVec[1], t7);
+            __m128i t10 = srlv_epi32_sse(mVec[1], t8);
+            __m128i t11 = _mm_or_si128(t9, t10);
+            mVec[1] = blendv_epi8_sse(mVec[1], t11, mask.mMask[1]);
+            return *this;
+        }
+        // ROLSA
+        UME_FORCE_INLINE SIMDVec_u & rola(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec[0], t0);
+            __m128i t3 = _mm_srl_epi32(mVec[0], t1);
+            mVec[0] = _mm_or_si128(t2, t3);
+            __m128i t4 = _mm_sll_epi32(mVec[1], t0);
+            __m128i t5 = _mm_srl_epi32(mVec[1], t1);
+            mVec[1] = _mm_or_si128(t4, t5);
+            return *this;
+        }
+        // MROLSA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec[0], t0);
+            __m128i t3 = _mm_srl_epi32(mVec[0], t1);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            mVec[0] = blendv_epi8_sse(mVec[0], t4, mask.mMask[0]);
+            __m128i t5 = _mm_sll_epi32(mVec[1], t0);
+            __m128i t6 = _mm_srl_epi32(mVec[1], t1);
+            __m128i t7 = _mm_or_si128(t5, t6);
+            mVec[1] = blendv_epi8_sse(mVec[1], t7, mask.mMask[1]);
+            return *this;
+        }
+        // RORV
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec[0], t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec[0], t3);
+            __m128i t5 = srlv_epi32_sse(mVec[0], t2);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = _mm_and_si128(b.mVec[1], t0);
+            __m128i t8 = _mm_sub_epi32(t1, t7);
+            __m128i t9 = sllv_epi32_sse(mVec[1], t8);
+            __m128i t10 = srlv_epi32_sse(mVec[1], t7);
+            __m128i t11 = _mm_or_si128(t9, t10);
+            return SIMDVec_u(t6, t11);
+        }
+        // MRORV
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVecMask<8> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec[0], t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec[0], t3);
+            __m128i t5 = srlv_epi32_sse(mVec[0], t2);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = blendv_epi8_sse(mVec[0], t6, mask.mMask[0]);
+            __m128i t8 = _mm_and_si128(b.mVec[1], t0);
+            __m128i t9 = _mm_sub_epi32(t1, t8);
+            __m128i t10 = sllv_epi32_sse(mVec[1], t9);
+            __m128i t11 = srlv_epi32_sse(mVec[1], t8);
+            __m128i t12 = _mm_or_si128(t10, t11);
+            __m128i t13 = blendv_epi8_sse(mVec[1], t12, mask.mMask[1]);
+            return SIMDVec_u(t7, t13);
+        }
+        // RORS
+        UME_FORCE_INLINE SIMDVec_u ror(uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec[0], t1);
+            __m128i t3 = _mm_srl_epi32(mVec[0], t0);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            __m128i t5 = _mm_sll_epi32(mVec[1], t1);
+            __m128i t6 = _mm_srl_epi32(mVec[1], t0);
+            __m128i t7 = _mm_or_si128(t5, t6);
+            return SIMDVec_u(t4, t7);
+        }
+        // MRORS
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVecMask<8> const & mask, uint32_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec[0], t1);
+            __m128i t3 = _mm_srl_epi32(mVec[0], t0);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            __m128i t5 = blendv_epi8_sse(mVec[0], t4, mask.mMask[0]);
+            __m128i t6 = _mm_sll_epi32(mVec[1], t1);
+            __m128i t7 = _mm_srl_epi32(mVec[1], t0);
+            __m128i t8 = _mm_or_si128(t6, t7);
+            __m128i t9 = blendv_epi8_sse(mVec[1], t8, mask.mMask[1]);
+            return SIMDVec_u(t5, t9);
+        }
+        // RORVA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVec_u const & b) {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec[0], t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec[0], t3);
+            __m128i t5 = srlv_epi32_sse(mVec[0], t2);
+            mVec[0] = _mm_or_si128(t4, t5);
+            __m128i t6 = _mm_and_si128(b.mVec[1], t0);
+            __m128i t7 = _mm_sub_epi32(t1, t6);
+            __m128i t8 = sllv_epi32_sse(mVec[1], t7);
+            __m128i t9 = srlv_epi32_sse(mVec[1], t6);
+            mVec[1] = _mm_or_si128(t8, t9);
+            return *this;
+        }
+        // MRORVA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVecMask<8> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_set1_epi32(31);
+            __m128i t1 = _mm_set1_epi32(32);
+            __m128i t2 = _mm_and_si128(b.mVec[0], t0);
+            __m128i t3 = _mm_sub_epi32(t1, t2);
+            __m128i t4 = sllv_epi32_sse(mVec[0], t3);
+            __m128i t5 = srlv_epi32_sse(mVec[0], t2);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            mVec[0] = blendv_epi8_sse(mVec[0], t6, mask.mMask[0]);
+            __m128i t7 = _mm_and_si128(b.mVec[1], t0);
+            __m128i t8 = _mm_sub_epi32(t1, t7);
+            __m128i t9 = sllv_epi32_sse(mVec[1], t8);
+            __m128i t10 = srlv_epi32_sse(mVec[1], t7);
+            __m128i t11 = _mm_or_si128(t9, t10);
+            mVec[1] = blendv_epi8_sse(mVec[1], t11, mask.mMask[1]);
+            return *this;
+        }
+        // RORSA
+        UME_FORCE_INLINE SIMDVec_u & rora(uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec[0], t1);
+            __m128i t3 = _mm_srl_epi32(mVec[0], t0);
+            mVec[0] = _mm_or_si128(t2, t3);
+            __m128i t4 = _mm_sll_epi32(mVec[1], t1);
+            __m128i t5 = _mm_srl_epi32(mVec[1], t0);
+            mVec[1] = _mm_or_si128(t4, t5);
+            return *this;
+        }
+        // MRORSA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVecMask<8> const & mask, uint32_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 31));
+            __m128i t1 = _mm_cvtsi32_si128(int(32 - (b & 31)));
+            __m128i t2 = _mm_sll_epi32(mVec[0], t1);
+            __m128i t3 = _mm_srl_epi32(mVec[0], t0);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            mVec[0] = blendv_epi8_sse(mVec[0], t4, mask.mMask[0]);
+            __m128i t5 = _mm_sll_epi32(mVec[1], t1);
+            __m128i t6 = _mm_srl_epi32(mVec[1], t0);
+            __m128i t7 = _mm_or_si128(t5, t6);
+            mVec[1] = blendv_epi8_sse(mVec[1], t7, mask.mMask[1]);
+            return *this;
+        }
+
+        // PACK
+        UME_FORCE_INLINE SIMDVec_u & pack(SIMDVec_u<uint32_t, 4> const & a, SIMDVec_u<uint32_t, 4> const & b) {
+            mVec[0] = a.mVec;
+            mVec[1] = b.mVec;
+            return *this;
+        }
+        // PACKLO
+        UME_FORCE_INLINE SIMDVec_u & packlo(SIMDVec_u<uint32_t, 4> const & a) {
+            mVec[0] = a.mVec;
+            return *this;
+        }
+        // PACKHI
+        UME_FORCE_INLINE SIMDVec_u & packhi(SIMDVec_u<uint32_t, 4> const & b) {
+            mVec[1] = b.mVec;
+            return *this;
+        }
+        // UNPACK
+        UME_FORCE_INLINE void unpack(SIMDVec_u<uint32_t, 4> & a, SIMDVec_u<uint32_t, 4> & b) const {
+            a.mVec = mVec[0];
+            b.mVec = mVec[1];
+        }
+        // UNPACKLO
+        UME_FORCE_INLINE SIMDVec_u<uint32_t, 4> unpacklo() const {
+            return SIMDVec_u<uint32_t, 4>(mVec[0]);
+        }
+        // UNPACKHI
+        UME_FORCE_INLINE SIMDVec_u<uint32_t, 4> unpackhi() const {
+            return SIMDVec_u<uint32_t, 4>(mVec[1]);
+        }
+
+        // PROMOTE
+        UME_FORCE_INLINE operator SIMDVec_u<uint64_t, 8>() const;
+        // DEGRADE
+        UME_FORCE_INLINE operator SIMDVec_u<uint16_t, 8>() const;
+
+        // UTOI
+        UME_FORCE_INLINE operator SIMDVec_i<int32_t, 8>() const;
+        // UTOF
+        UME_FORCE_INLINE operator SIMDVec_f<float, 8>() const;
+
+    };
+
+}
+}
+
+#endif
@@ -0,0 +1,1763 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_UINT64_2_H_
+#define UME_SIMD_VEC_UINT64_2_H_
+
+#include <type_traits>
+#include <immintrin.h>
+
+#include "../../../UMESimdInterface.h"
+
+
+#if defined (_MSC_VER) && !defined (__x86_64__)
+
+#define SET1_EPI64(x) \
+    _mm_setr_epi32(int(x & 0x00000000FFFFFFFF), \
+                      int((x & 0xFFFFFFFF00000000) >> 32), \
+                      int(x & 0x00000000FFFFFFFF), \
+                      int((x & 0xFFFFFFFF00000000) >> 32))
+#else
+#define SET1_EPI64(x) _mm_set1_epi64x(x)
+#endif
+
+#define BLEND(a_128i, b_128i, mask_128i) blendv_epi8_sse((a_128i), (b_128i), (mask_128i))
+#define MASK_LOAD(ptr_u64, mask_128i) maskload_epi64_sse((long long const *)(ptr_u64), (mask_128i))
+#define MASK_STORE(ptr_u64, mask_128i, a_128i) maskstore_epi64_sse((long long *)(ptr_u64), (mask_128i), (a_128i))
+#define MASK_GATHER(a_128i, ptr_u64, idx_128i, mask_128i) mask_i64gather_epi64_sse((a_128i), (long long const *)(ptr_u64), (idx_128i), (mask_128i))
+#define MOVEMASK(mask_128i) _mm_movemask_pd(_mm_castsi128_pd(mask_128i))
+
+namespace UME {
+namespace SIMD {
+
+    template<>
+    class SIMDVec_u<uint64_t, 2> :
+        public SIMDVecUnsignedInterface<
+            SIMDVec_u<uint64_t, 2>,
+            uint64_t,
+            2,
+            SIMDVecMask<2>,
+            SIMDSwizzle<2>> ,
+        public SIMDVecPackableInterface<
+            SIMDVec_u<uint64_t, 2>,
+            SIMDVec_u<uint64_t, 1>>
+    {
+    public:
+        friend class SIMDVec_i<int64_t, 2>;
+        friend class SIMDVec_f<double, 2>;
+
+        friend class SIMDVec_u<uint64_t, 4>;
+
+    private:
+        __m128i mVec;
+
+        UME_FORCE_INLINE explicit SIMDVec_u(__m128i & x) { mVec = x; }
+        UME_FORCE_INLINE explicit SIMDVec_u(const __m128i & x) { mVec = x; }
+
+        // Lane-wise saturating kernels used by SADD*/SSUB*.
+        static UME_FORCE_INLINE __m128i saturatedAdd(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_add_epi64(a, b);
+            __m128i t1 = _mm_slli_epi64(cmpeq_epi64_sse(a, a), 63);
+            __m128i t2 = cmpgt_epi64_sse(_mm_xor_si128(a, t1), _mm_xor_si128(t0, t1));
+            return _mm_or_si128(t0, t2);
+        }
+        static UME_FORCE_INLINE __m128i saturatedSub(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_sub_epi64(a, b);
+            __m128i t1 = _mm_slli_epi64(cmpeq_epi64_sse(a, a), 63);
+            __m128i t2 = cmpgt_epi64_sse(_mm_xor_si128(b, t1), _mm_xor_si128(a, t1));
+            return _mm_andnot_si128(t2, t0);
+        }
+        // Lane-wise kernels shared by the arithmetic, comparison and
+        // reduction operations. SSE has no unsigned 64b comparison, so
+        // operands are compared as signed values with their sign bits flipped.
+        static UME_FORCE_INLINE __m128i cmpgtLanes(__m128i const & a, __m128i const & b) {
+            __m128i t0 = SET1_EPI64(0x8000000000000000);
+            return cmpgt_epi64_sse(_mm_xor_si128(a, t0), _mm_xor_si128(b, t0));
+        }
+        static UME_FORCE_INLINE __m128i maxLanes(__m128i const & a, __m128i const & b) {
+            return blendv_epi8_sse(b, a, cmpgtLanes(a, b));
+        }
+        static UME_FORCE_INLINE __m128i minLanes(__m128i const & a, __m128i const & b) {
+            return blendv_epi8_sse(a, b, cmpgtLanes(a, b));
+        }
+        // Low 64 bits of the product, built from 32b x 32b partial products.
+        static UME_FORCE_INLINE __m128i mulLanes(__m128i const & a, __m128i const & b) {
+            __m128i t0 = _mm_mul_epu32(a, b);
+            __m128i t1 = _mm_mul_epu32(_mm_srli_epi64(a, 32), b);
+            __m128i t2 = _mm_mul_epu32(a, _mm_srli_epi64(b, 32));
+            __m128i t3 = _mm_slli_epi64(_mm_add_epi64(t1, t2), 32);
+            return _mm_add_epi64(t0, t3);
+        }
+        // SSE has no scatter instruction, so lanes selected by bits of 'm'
+        // are stored one by one.
+        static UME_FORCE_INLINE void scatterLanes(uint64_t * baseAddr, __m128i const & v, __m128i const & indices, int m) {
+            if (m & 0x1) baseAddr[_mm_cvtsi128_si64(indices)] = uint64_t(_mm_cvtsi128_si64(v));
+            if (m & 0x2) baseAddr[extract_epi64_sse<1>(indices)] = uint64_t(extract_epi64_sse<1>(v));
+        }
+
+    public:
+        constexpr static uint32_t length() { return 2; }
+        constexpr static uint32_t alignment() { return 16; }
+
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_u() {}
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_u(uint64_t i) {
+            mVec = SET1_EPI64(i);
+        }
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_u(
+            T i, 
+            typename std::enable_if< std::is_fundamental<T>::value && 
+                                    !std::is_same<T, uint64_t>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_u(static_cast<uint64_t>(i)) {}
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVec_u(uint64_t const *p) {
+            mVec = _mm_loadu_si128((__m128i*)p);
+        }
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVec_u(uint64_t i0, uint64_t i1) {
+            mVec = _mm_set_epi64x(i1, i0);
+        }
+
+        // EXTRACT
+        UME_FORCE_INLINE uint64_t extract(uint32_t index) const {
+            alignas(16) uint64_t raw[2];
+            _mm_store_si128((__m128i*) raw, mVec);
+            return raw[index];
+        }
+        UME_FORCE_INLINE uint64_t operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_u & insert(uint32_t index, uint64_t value) {
+            alignas(16) uint64_t raw[2];
+            _mm_store_si128((__m128i*) raw, mVec);
+            raw[index] = value;
+            mVec = _mm_load_si128((__m128i*) raw);
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_u, uint64_t> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_u, uint64_t>(index, static_cast<SIMDVec_u &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_u, uint64_t, SIMDVecMask<2>> operator() (SIMDVecMask<2> const & mask) {
+            return IntermediateMask<SIMDVec_u, uint64_t, SIMDVecMask<2>>(mask, static_cast<SIMDVec_u &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_u, uint64_t, SIMDVecMask<2>> operator[] (SIMDVecMask<2> const & mask) {
+            return IntermediateMask<SIMDVec_u, uint64_t, SIMDVecMask<2>>(mask, static_cast<SIMDVec_u &>(*this));
+        }
+#endif
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVec_u const & b) {
+            mVec = b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator= (SIMDVec_u const & b) {
+            return assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            mVec = BLEND(mVec, b.mVec, mask.mMask);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_u & assign(uint64_t b) {
+            mVec = SET1_EPI64(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator= (uint64_t b) {
+            return assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVecMask<2> const & mask, uint64_t b) {
+            mVec = BLEND(mVec, SET1_EPI64(b), mask.mMask);
+            return *this;
+        }
+
+        // PREFETCH0
+        // PREFETCH1
+        // PREFETCH2
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_u & load(uint64_t const *p) {
+            mVec = _mm_loadu_si128((const __m128i *) p);
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_u & load(SIMDVecMask<2> const & mask, uint64_t const *p) {
+            __m128i t0 = MASK_LOAD(p, mask.mMask);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_u & loada(uint64_t const *p) {
+            mVec = _mm_load_si128((const __m128i *) p);
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_u & loada(SIMDVecMask<2> const & mask, uint64_t const *p) {
+#if defined __GNUG__
+            // G++ (so far 5.3) does not provide 'maskload_epi64_sse' intrinsic
+            __m128i t0 = _mm_load_si128((const __m128i *) p);
+            mVec = BLEND(mVec, t0, mask.mMask);
+#else
+            __m128i t0 = MASK_LOAD(p, mask.mMask);
+            mVec = BLEND(mVec, t0, mask.mMask);
+#endif
+            return *this;
+        }
+        // LOADN
+        UME_FORCE_INLINE SIMDVec_u & loadn(uint32_t n, uint64_t const * p) {
+            __m128i t0 = _mm_set_epi64x(1, 0);
+            __m128i t1 = cmpgt_epi64_sse(SET1_EPI64(n < 2 ? n : 2), t0);
+            mVec = maskload_epi64_sse((long long const *)p, t1);
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE uint64_t* store(uint64_t* p) const {
+            _mm_storeu_si128((__m128i *)p, mVec);
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE uint64_t* store(SIMDVecMask<2> const & mask, uint64_t* p) const {
+            MASK_STORE(p, mask.mMask, mVec);
+            return p;
+        }
+        // STOREN
+        UME_FORCE_INLINE uint64_t* storen(uint32_t n, uint64_t * p) const {
+            __m128i t0 = _mm_set_epi64x(1, 0);
+            __m128i t1 = cmpgt_epi64_sse(SET1_EPI64(n < 2 ? n : 2), t0);
+            maskstore_epi64_sse((long long *)p, t1, mVec);
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE uint64_t* storea(uint64_t* p) const {
+            _mm_store_si128((__m128i *)p, mVec);
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE uint64_t* storea(SIMDVecMask<2> const & mask, uint64_t* p) const {
+#if defined __GNUG__
+            // G++ (so far 5.3) does not provide 'maskstore_epi64_sse' intrinsic
+            __m128i t0 = _mm_load_si128((const __m128i *) p);
+            __m128i t1 = BLEND(t0, mVec, mask.mMask);
+            _mm_store_si128((__m128i *)p, t1);
+#else
+            MASK_STORE(p, mask.mMask, mVec);
+#endif
+            return p;
+        }
+
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = BLEND(mVec, b.mVec, mask.mMask);
+            return SIMDVec_u(t0);
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_u swizzle(SIMDSwizzle<2> const & sMask) const {
+            alignas(16) uint64_t raw[2];
+            _mm_store_si128((__m128i*)raw, mVec);
+            __m128i t0 = _mm_set_epi64x(raw[sMask[1] & 1], raw[sMask[0] & 1]);
+            return SIMDVec_u(t0);
+        }
+        template<int i0, int i1>
+        UME_FORCE_INLINE SIMDVec_u swizzle() const {
+            // Each 64-bit lane is moved as a pair of 32-bit elements.
+            __m128i t0 = _mm_shuffle_epi32(mVec, ((i0 & 1) * 0xA + 0x4) | (((i1 & 1) * 0xA + 0x4) << 4));
+            return SIMDVec_u(t0);
+        }
+        // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_u & swizzlea(SIMDSwizzle<2> const & sMask) {
+            SIMDVec_u t0 = swizzle(sMask);
+            mVec = t0.mVec;
+            return *this;
+        }
+
+        // SORTA
+        // SORTD
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_add_epi64(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator+ (SIMDVec_u const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_add_epi64(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_u add(uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_add_epi64(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator+ (uint64_t b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_add_epi64(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVec_u const & b) {
+            mVec = _mm_add_epi64(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator+= (SIMDVec_u const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_add_epi64(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_u & adda(uint64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            mVec = _mm_add_epi64(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator+= (uint64_t b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_add_epi64(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVec_u const & b) const {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVec_u const & b) {
+            mVec = saturatedAdd(mVec, b.mVec);
+            return *this;
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = saturatedAdd(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(uint64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            mVec = saturatedAdd(mVec, t0);
+            return *this;
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = saturatedAdd(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // POSTINC
+        UME_FORCE_INLINE SIMDVec_u postinc() {
+            __m128i t0 = mVec;
+            mVec = _mm_add_epi64(mVec, SET1_EPI64(1));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator++ (int) {
+            return postinc();
+        }
+        // MPOSTINC
+        UME_FORCE_INLINE SIMDVec_u postinc(SIMDVecMask<2> const & mask) {
+            __m128i t0 = mVec;
+            __m128i t1 = _mm_add_epi64(mVec, SET1_EPI64(1));
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t0);
+        }
+        // PREFINC
+        UME_FORCE_INLINE SIMDVec_u & prefinc() {
+            mVec = _mm_add_epi64(mVec, SET1_EPI64(1));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator++ () {
+            return prefinc();
+        }
+        // MPREFINC
+        UME_FORCE_INLINE SIMDVec_u & prefinc(SIMDVecMask<2> const & mask) {
+            __m128i t0 = _mm_add_epi64(mVec, SET1_EPI64(1));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_sub_epi64(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator- (SIMDVec_u const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_sub_epi64(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_u sub(uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_sub_epi64(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator- (uint64_t b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_sub_epi64(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVec_u const & b) {
+            mVec = _mm_sub_epi64(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-= (SIMDVec_u const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_sub_epi64(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_u & suba(uint64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            mVec = _mm_sub_epi64(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-= (uint64_t b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_sub_epi64(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVec_u const & b) const {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVec_u const & b) {
+            mVec = saturatedSub(mVec, b.mVec);
+            return *this;
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = saturatedSub(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(uint64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            mVec = saturatedSub(mVec, t0);
+            return *this;
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = saturatedSub(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_sub_epi64(b.mVec, mVec);
+            return SIMDVec_u(t0);
+        }
+        // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_sub_epi64(b.mVec, mVec);
+            __m128i t1 = BLEND(b.mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_u subfrom(uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_sub_epi64(t0, mVec);
+            return SIMDVec_u(t1);
+        }
+        // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_sub_epi64(t0, mVec);
+            __m128i t2 = BLEND(t0, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(SIMDVec_u const & b) {
+            mVec = _mm_sub_epi64(b.mVec, mVec);
+            return *this;
+        }
+        // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_sub_epi64(b.mVec, mVec);
+            mVec = BLEND(b.mVec, t0, mask.mMask);
+            return *this;
+        }
+        // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(uint64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            mVec = _mm_sub_epi64(t0, mVec);
+            return *this;
+        }
+        // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_sub_epi64(t0, mVec);
+            mVec = BLEND(t0, t1, mask.mMask);
+            return *this;
+        }
+        // POSTDEC
+        UME_FORCE_INLINE SIMDVec_u postdec() {
+            __m128i t0 = mVec;
+            mVec = _mm_sub_epi64(mVec, SET1_EPI64(1));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator-- (int) {
+            return postdec();
+        }
+        // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_u postdec(SIMDVecMask<2> const & mask) {
+            __m128i t0 = mVec;
+            __m128i t1 = _mm_sub_epi64(mVec, SET1_EPI64(1));
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t0);
+        }
+        // PREFDEC
+        UME_FORCE_INLINE SIMDVec_u & prefdec() {
+            mVec = _mm_sub_epi64(mVec, SET1_EPI64(1));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-- () {
+            return prefdec();
+        }
+        // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_u & prefdec(SIMDVecMask<2> const & mask) {
+            __m128i t0 = _mm_sub_epi64(mVec, SET1_EPI64(1));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MULV
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVec_u const & b) const {
+            __m128i t0 = mulLanes(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator* (SIMDVec_u const & b) const {
+            return mul(b);
+        }
+        // MMULV
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = mulLanes(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // MULS
+        UME_FORCE_INLINE SIMDVec_u mul(uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = mulLanes(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator* (uint64_t b) const {
+            return mul(b);
+        }
+        // MMULS
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = mulLanes(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // MULVA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVec_u const & b) {
+            mVec = mulLanes(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator*= (SIMDVec_u const & b) {
+            return mula(b);
+        }
+        // MMULVA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = mulLanes(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MULSA
+        UME_FORCE_INLINE SIMDVec_u & mula(uint64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            mVec = mulLanes(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator*= (uint64_t b) {
+            return mula(b);
+        }
+        // MMULSA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = mulLanes(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // DIVV
+        // MDIVV
+        // DIVS
+        // MDIVS
+        // DIVVA
+        // MDIVVA
+        // DIVSA
+        // MDIVSA
+        // RCP
+        // MRCP
+        // RCPS
+        // MRCPS
+        // RCPA
+        // MRCPA
+        // RCPSA
+        // MRCPSA
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpeq(SIMDVec_u const & b) const {
+            __m128i t0 = cmpeq_epi64_sse(mVec, b.mVec);
+            return SIMDVecMask<2>(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator== (SIMDVec_u const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<2> cmpeq(uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = cmpeq_epi64_sse(mVec, t0);
+            return SIMDVecMask<2>(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator== (uint64_t b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpne(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_xor_si128(cmpeq_epi64_sse(mVec, b.mVec), _mm_set1_epi32(-1));
+            return SIMDVecMask<2>(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator!= (SIMDVec_u const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<2> cmpne(uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_xor_si128(cmpeq_epi64_sse(mVec, t0), _mm_set1_epi32(-1));
+            return SIMDVecMask<2>(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator!= (uint64_t b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpgt(SIMDVec_u const & b) const {
+            __m128i t0 = cmpgtLanes(mVec, b.mVec);
+            return SIMDVecMask<2>(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator> (SIMDVec_u const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<2> cmpgt(uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = cmpgtLanes(mVec, t0);
+            return SIMDVecMask<2>(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator> (uint64_t b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<2> cmplt(SIMDVec_u const & b) const {
+            __m128i t0 = cmpgtLanes(b.mVec, mVec);
+            return SIMDVecMask<2>(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator< (SIMDVec_u const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<2> cmplt(uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = cmpgtLanes(t0, mVec);
+            return SIMDVecMask<2>(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator< (uint64_t b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<2> cmpge(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_xor_si128(cmpgtLanes(b.mVec, mVec), _mm_set1_epi32(-1));
+            return SIMDVecMask<2>(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator>= (SIMDVec_u const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<2> cmpge(uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_xor_si128(cmpgtLanes(t0, mVec), _mm_set1_epi32(-1));
+            return SIMDVecMask<2>(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator>= (uint64_t b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<2> cmple(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_xor_si128(cmpgtLanes(mVec, b.mVec), _mm_set1_epi32(-1));
+            return SIMDVecMask<2>(t0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator<= (SIMDVec_u const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<2> cmple(uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_xor_si128(cmpgtLanes(mVec, t0), _mm_set1_epi32(-1));
+            return SIMDVecMask<2>(t1);
+        }
+        UME_FORCE_INLINE SIMDVecMask<2> operator<= (uint64_t b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_u const & b) const {
+            __m128i t0 = cmpeq_epi64_sse(mVec, b.mVec);
+            return _mm_movemask_epi8(t0) == 0xFFFF;
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(uint64_t b) const {
+            __m128i t0 = cmpeq_epi64_sse(mVec, SET1_EPI64(b));
+            return _mm_movemask_epi8(t0) == 0xFFFF;
+        }
+        // UNIQUE
+        UME_FORCE_INLINE bool unique() const {
+            __m128i t0 = cmpeq_epi64_sse(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            return testz_si128_sse(t0, t0) != 0;
+        }
+        // HADD
+        UME_FORCE_INLINE uint64_t hadd() const {
+            __m128i t0 = _mm_add_epi64(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t0)));
+            return retval;
+        }
+        // MHADD
+        UME_FORCE_INLINE uint64_t hadd(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = BLEND(_mm_setzero_si128(), mVec, mask.mMask);
+            __m128i t1 = _mm_add_epi64(t0, _mm_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t1)));
+            return retval;
+        }
+        // HADDS
+        UME_FORCE_INLINE uint64_t hadd(uint64_t b) const {
+            __m128i t0 = _mm_add_epi64(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t0)));
+            return retval + b;
+        }
+        // MHADDS
+        UME_FORCE_INLINE uint64_t hadd(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = BLEND(_mm_setzero_si128(), mVec, mask.mMask);
+            __m128i t1 = _mm_add_epi64(t0, _mm_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t1)));
+            return retval + b;
+        }
+        // HMUL
+        UME_FORCE_INLINE uint64_t hmul() const {
+            __m128i t0 = mulLanes(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t0)));
+            return retval;
+        }
+        // MHMUL
+        UME_FORCE_INLINE uint64_t hmul(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = BLEND(SET1_EPI64(1), mVec, mask.mMask);
+            __m128i t1 = mulLanes(t0, _mm_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t1)));
+            return retval;
+        }
+        // HMULS
+        UME_FORCE_INLINE uint64_t hmul(uint64_t b) const {
+            __m128i t0 = mulLanes(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t0)));
+            return retval * b;
+        }
+        // MHMULS
+        UME_FORCE_INLINE uint64_t hmul(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = BLEND(SET1_EPI64(1), mVec, mask.mMask);
+            __m128i t1 = mulLanes(t0, _mm_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t1)));
+            return retval * b;
+        }
+
+        // FMULADDV
+        UME_FORCE_INLINE SIMDVec_u fmuladd(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = mulLanes(mVec, b.mVec);
+            __m128i t1 = _mm_add_epi64(t0, c.mVec);
+            return SIMDVec_u(t1);
+        }
+        // MFMULADDV
+        UME_FORCE_INLINE SIMDVec_u fmuladd(SIMDVecMask<2> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = mulLanes(mVec, b.mVec);
+            __m128i t1 = _mm_add_epi64(t0, c.mVec);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // FMULSUBV
+        UME_FORCE_INLINE SIMDVec_u fmulsub(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = mulLanes(mVec, b.mVec);
+            __m128i t1 = _mm_sub_epi64(t0, c.mVec);
+            return SIMDVec_u(t1);
+        }
+        // MFMULSUBV
+        UME_FORCE_INLINE SIMDVec_u fmulsub(SIMDVecMask<2> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = mulLanes(mVec, b.mVec);
+            __m128i t1 = _mm_sub_epi64(t0, c.mVec);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // FADDMULV
+        UME_FORCE_INLINE SIMDVec_u faddmul(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = _mm_add_epi64(mVec, b.mVec);
+            __m128i t1 = mulLanes(t0, c.mVec);
+            return SIMDVec_u(t1);
+        }
+        // MFADDMULV
+        UME_FORCE_INLINE SIMDVec_u faddmul(SIMDVecMask<2> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = _mm_add_epi64(mVec, b.mVec);
+            __m128i t1 = mulLanes(t0, c.mVec);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // FSUBMULV
+        UME_FORCE_INLINE SIMDVec_u fsubmul(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = _mm_sub_epi64(mVec, b.mVec);
+            __m128i t1 = mulLanes(t0, c.mVec);
+            return SIMDVec_u(t1);
+        }
+        // MFSUBMULV
+        UME_FORCE_INLINE SIMDVec_u fsubmul(SIMDVecMask<2> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = _mm_sub_epi64(mVec, b.mVec);
+            __m128i t1 = mulLanes(t0, c.mVec);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+
+        // MAXV
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVec_u const & b) const {
+            __m128i t0 = maxLanes(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // MMAXV
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = maxLanes(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // MAXS
+        UME_FORCE_INLINE SIMDVec_u max(uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = maxLanes(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        // MMAXS
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = maxLanes(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // MAXVA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVec_u const & b) {
+            mVec = maxLanes(mVec, b.mVec);
+            return *this;
+        }
+        // MMAXVA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = maxLanes(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MAXSA
+        UME_FORCE_INLINE SIMDVec_u & maxa(uint64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            mVec = maxLanes(mVec, t0);
+            return *this;
+        }
+        // MMAXSA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = maxLanes(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // MINV
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVec_u const & b) const {
+            __m128i t0 = minLanes(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // MMINV
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = minLanes(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // MINS
+        UME_FORCE_INLINE SIMDVec_u min(uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = minLanes(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        // MMINS
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = minLanes(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // MINVA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVec_u const & b) {
+            mVec = minLanes(mVec, b.mVec);
+            return *this;
+        }
+        // MMINVA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = minLanes(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // MINSA
+        UME_FORCE_INLINE SIMDVec_u & mina(uint64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            mVec = minLanes(mVec, t0);
+            return *this;
+        }
+        // MMINSA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = minLanes(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // HMAX
+        UME_FORCE_INLINE uint64_t hmax() const {
+            __m128i t0 = maxLanes(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t0)));
+            return retval;
+        }
+        // MHMAX
+        UME_FORCE_INLINE uint64_t hmax(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = BLEND(_mm_setzero_si128(), mVec, mask.mMask);
+            __m128i t1 = maxLanes(t0, _mm_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t1)));
+            return retval;
+        }
+        // IMAX
+        // MIMAX
+        // HMIN
+        UME_FORCE_INLINE uint64_t hmin() const {
+            __m128i t0 = minLanes(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t0)));
+            return retval;
+        }
+        // MHMIN
+        UME_FORCE_INLINE uint64_t hmin(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = BLEND(_mm_set1_epi32(-1), mVec, mask.mMask);
+            __m128i t1 = minLanes(t0, _mm_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t1)));
+            return retval;
+        }
+        // IMIN
+        // MIMIN
+
+        // BANDV
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator& (SIMDVec_u const & b) const {
+            return band(b);
+        }
+        // MBANDV
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BANDS
+        UME_FORCE_INLINE SIMDVec_u band(uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator& (uint64_t b) const {
+            return band(b);
+        }
+        // MBANDS
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // BANDVA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVec_u const & b) {
+            mVec = _mm_and_si128(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (SIMDVec_u const & b) {
+            return banda(b);
+        }
+        // MBANDVA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BANDSA
+        UME_FORCE_INLINE SIMDVec_u & banda(uint64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            mVec = _mm_and_si128(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (uint64_t b) {
+            return banda(b);
+        }
+        // MBANDSA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // BORV
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator| (SIMDVec_u const & b) const {
+            return bor(b);
+        }
+        // MBORV
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BORS
+        UME_FORCE_INLINE SIMDVec_u bor(uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator| (uint64_t b) const {
+            return bor(b);
+        }
+        // MBORS
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // BORVA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVec_u const & b) {
+            mVec = _mm_or_si128(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (SIMDVec_u const & b) {
+            return bora(b);
+        }
+        // MBORVA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BORSA
+        UME_FORCE_INLINE SIMDVec_u & bora(uint64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            mVec = _mm_or_si128(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (uint64_t b) {
+            return bora(b);
+        }
+        // MBORSA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // BXORV
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator^ (SIMDVec_u const & b) const {
+            return bxor(b);
+        }
+        // MBXORV
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BXORS
+        UME_FORCE_INLINE SIMDVec_u bxor(uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator^ (uint64_t b) const {
+            return bxor(b);
+        }
+        // MBXORS
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // BXORVA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVec_u const & b) {
+            mVec = _mm_xor_si128(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator^= (SIMDVec_u const & b) {
+            return bxora(b);
+        }
+        // MBXORVA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // BXORSA
+        UME_FORCE_INLINE SIMDVec_u & bxora(uint64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            mVec = _mm_xor_si128(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator^= (uint64_t b) {
+            return bxora(b);
+        }
+        // MBXORSA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = SET1_EPI64(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // BNOT
+        UME_FORCE_INLINE SIMDVec_u bnot() const {
+            __m128i t0 = _mm_xor_si128(mVec, _mm_set1_epi32(-1));
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator~ () const {
+            return bnot();
+        }
+        // MBNOT
+        UME_FORCE_INLINE SIMDVec_u bnot(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = _mm_xor_si128(mVec, _mm_set1_epi32(-1));
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // BNOTA
+        UME_FORCE_INLINE SIMDVec_u & bnota() {
+            mVec = _mm_xor_si128(mVec, _mm_set1_epi32(-1));
+            return *this;
+        }
+        // MBNOTA
+        UME_FORCE_INLINE SIMDVec_u & bnota(SIMDVecMask<2> const & mask) {
+            __m128i t0 = _mm_xor_si128(mVec, _mm_set1_epi32(-1));
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // HBAND
+        UME_FORCE_INLINE uint64_t hband() const {
+            __m128i t0 = _mm_and_si128(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t0)));
+            return retval;
+        }
+        // MHBAND
+        UME_FORCE_INLINE uint64_t hband(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = BLEND(_mm_set1_epi32(-1), mVec, mask.mMask);
+            __m128i t1 = _mm_and_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t1)));
+            return retval;
+        }
+        // HBANDS
+        UME_FORCE_INLINE uint64_t hband(uint64_t b) const {
+            __m128i t0 = _mm_and_si128(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t0)));
+            return retval & b;
+        }
+        // MHBANDS
+        UME_FORCE_INLINE uint64_t hband(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = BLEND(_mm_set1_epi32(-1), mVec, mask.mMask);
+            __m128i t1 = _mm_and_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t1)));
+            return retval & b;
+        }
+        // HBOR
+        UME_FORCE_INLINE uint64_t hbor() const {
+            __m128i t0 = _mm_or_si128(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t0)));
+            return retval;
+        }
+        // MHBOR
+        UME_FORCE_INLINE uint64_t hbor(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = BLEND(_mm_setzero_si128(), mVec, mask.mMask);
+            __m128i t1 = _mm_or_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t1)));
+            return retval;
+        }
+        // HBORS
+        UME_FORCE_INLINE uint64_t hbor(uint64_t b) const {
+            __m128i t0 = _mm_or_si128(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t0)));
+            return retval | b;
+        }
+        // MHBORS
+        UME_FORCE_INLINE uint64_t hbor(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = BLEND(_mm_setzero_si128(), mVec, mask.mMask);
+            __m128i t1 = _mm_or_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t1)));
+            return retval | b;
+        }
+        // HBXOR
+        UME_FORCE_INLINE uint64_t hbxor() const {
+            __m128i t0 = _mm_xor_si128(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t0)));
+            return retval;
+        }
+        // MHBXOR
+        UME_FORCE_INLINE uint64_t hbxor(SIMDVecMask<2> const & mask) const {
+            __m128i t0 = BLEND(_mm_setzero_si128(), mVec, mask.mMask);
+            __m128i t1 = _mm_xor_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t1)));
+            return retval;
+        }
+        // HBXORS
+        UME_FORCE_INLINE uint64_t hbxor(uint64_t b) const {
+            __m128i t0 = _mm_xor_si128(mVec, _mm_shuffle_epi32(mVec, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t0)));
+            return retval ^ b;
+        }
+        // MHBXORS
+        UME_FORCE_INLINE uint64_t hbxor(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = BLEND(_mm_setzero_si128(), mVec, mask.mMask);
+            __m128i t1 = _mm_xor_si128(t0, _mm_shuffle_epi32(t0, 0x4E));
+            uint64_t retval = uint64_t(_mm_cvtsi128_si64((t1)));
+            return retval ^ b;
+        }
+
+        // GATHERU
+        UME_FORCE_INLINE SIMDVec_u & gatheru(uint64_t const * baseAddr, uint32_t stride) {
+            __m128i t0 = _mm_mul_epu32(_mm_set_epi64x(1, 0), SET1_EPI64(stride));
+            mVec = i64gather_epi64_sse((long long const *)baseAddr, t0);
+            return *this;
+        }
+        // MGATHERU
+        UME_FORCE_INLINE SIMDVec_u & gatheru(SIMDVecMask<2> const & mask, uint64_t const * baseAddr, uint32_t stride) {
+            __m128i t0 = _mm_mul_epu32(_mm_set_epi64x(1, 0), SET1_EPI64(stride));
+            mVec = MASK_GATHER(mVec, baseAddr, t0, mask.mMask);
+            return *this;
+        }
+        // GATHERS
+        UME_FORCE_INLINE SIMDVec_u & gather(uint64_t const * baseAddr, uint64_t const * indices) {
+            __m128i t0 = _mm_loadu_si128((__m128i const *)indices);
+            mVec = i64gather_epi64_sse((long long const *)baseAddr, t0);
+            return *this;
+        }
+        // MGATHERS
+        UME_FORCE_INLINE SIMDVec_u & gather(SIMDVecMask<2> const & mask, uint64_t const * baseAddr, uint64_t const * indices) {
+            __m128i t0 = MASK_LOAD(indices, mask.mMask);
+            mVec = MASK_GATHER(mVec, baseAddr, t0, mask.mMask);
+            return *this;
+        }
+        // GATHERV
+        UME_FORCE_INLINE SIMDVec_u & gather(uint64_t const * baseAddr, SIMDVec_u const & indices) {
+            mVec = i64gather_epi64_sse((long long const *)baseAddr, indices.mVec);
+            return *this;
+        }
+        // MGATHERV
+        UME_FORCE_INLINE SIMDVec_u & gather(SIMDVecMask<2> const & mask, uint64_t const * baseAddr, SIMDVec_u const & indices) {
+            mVec = MASK_GATHER(mVec, baseAddr, indices.mVec, mask.mMask);
+            return *this;
+        }
+        // SCATTERU
+        UME_FORCE_INLINE uint64_t* scatteru(uint64_t* baseAddr, uint32_t stride) const {
+            __m128i t0 = _mm_mul_epu32(_mm_set_epi64x(1, 0), SET1_EPI64(stride));
+            scatterLanes(baseAddr, mVec, t0, 0x3);
+            return baseAddr;
+        }
+        // MSCATTERU
+        UME_FORCE_INLINE uint64_t* scatteru(SIMDVecMask<2> const & mask, uint64_t* baseAddr, uint32_t stride) const {
+            __m128i t0 = _mm_mul_epu32(_mm_set_epi64x(1, 0), SET1_EPI64(stride));
+            scatterLanes(baseAddr, mVec, t0, MOVEMASK(mask.mMask));
+            return baseAddr;
+        }
+        // SCATTERS
+        UME_FORCE_INLINE uint64_t* scatter(uint64_t* baseAddr, uint64_t* indices) const {
+            scatterLanes(baseAddr, mVec, _mm_loadu_si128((__m128i*)indices), 0x3);
+            return baseAddr;
+        }
+        // MSCATTERS
+        UME_FORCE_INLINE uint64_t* scatter(SIMDVecMask<2> const & mask, uint64_t* baseAddr, uint64_t* indices) const {
+            __m128i t0 = MASK_LOAD(indices, mask.mMask);
+            scatterLanes(baseAddr, mVec, t0, MOVEMASK(mask.mMask));
+            return baseAddr;
+        }
+        // SCATTERV
+        UME_FORCE_INLINE uint64_t* scatter(uint64_t* baseAddr, SIMDVec_u const & indices) const {
+            scatterLanes(baseAddr, mVec, indices.mVec, 0x3);
+            return baseAddr;
+        }
+        // MSCATTERV
+        UME_FORCE_INLINE uint64_t* scatter(SIMDVecMask<2> const & mask, uint64_t* baseAddr, SIMDVec_u const & indices) const {
+            scatterLanes(baseAddr, mVec, indices.mVec, MOVEMASK(mask.mMask));
+            return baseAddr;
+        }
+
+        // LSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVec_u const & b) const {
+            __m128i t0 = sllv_epi64_sse(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (SIMDVec_u const & b) const {
+            return lsh(b);
+        }
+        // MLSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = sllv_epi64_sse(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // LSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi64(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (uint64_t b) const {
+            return lsh(b);
+        }
+        // MLSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi64(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // LSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVec_u const & b) {
+            mVec = sllv_epi64_sse(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (SIMDVec_u const & b) {
+            return lsha(b);
+        }
+        // MLSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = sllv_epi64_sse(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // LSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = _mm_sll_epi64(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (uint64_t b) {
+            return lsha(b);
+        }
+        // MLSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_sll_epi64(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // RSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVec_u const & b) const {
+            __m128i t0 = srlv_epi64_sse(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (SIMDVec_u const & b) const {
+            return rsh(b);
+        }
+        // MRSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = srlv_epi64_sse(mVec, b.mVec);
+            __m128i t1 = BLEND(mVec, t0, mask.mMask);
+            return SIMDVec_u(t1);
+        }
+        // RSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_srl_epi64(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (uint64_t b) const {
+            return rsh(b);
+        }
+        // MRSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_srl_epi64(mVec, t0);
+            __m128i t2 = BLEND(mVec, t1, mask.mMask);
+            return SIMDVec_u(t2);
+        }
+        // RSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVec_u const & b) {
+            mVec = srlv_epi64_sse(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (SIMDVec_u const & b) {
+            return rsha(b);
+        }
+        // MRSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = srlv_epi64_sse(mVec, b.mVec);
+            mVec = BLEND(mVec, t0, mask.mMask);
+            return *this;
+        }
+        // RSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            mVec = _mm_srl_epi64(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (uint64_t b) {
+            return rsha(b);
+        }
+        // MRSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b));
+            __m128i t1 = _mm_srl_epi64(mVec, t0);
+            mVec = BLEND(mVec, t1, mask.mMask);
+            return *this;
+        }
+        // ROLV
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVec_u const & b) const {
+            __m128i t0 = SET1_EPI64(63);
+            __m128i t1 = SET1_EPI64(64);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi64(t1, t2);
+            __m128i t4 = sllv_epi64_sse(mVec, t2);
+            __m128i t5 = srlv_epi64_sse(mVec, t3);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            return SIMDVec_u(t6);
+        }
+        // MROLV
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = SET1_EPI64(63);
+            __m128i t1 = SET1_EPI64(64);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi64(t1, t2);
+            __m128i t4 = sllv_epi64_sse(mVec, t2);
+            __m128i t5 = srlv_epi64_sse(mVec, t3);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = BLEND(mVec, t6, mask.mMask);
+            return SIMDVec_u(t7);
+        }
+        // ROLS
+        UME_FORCE_INLINE SIMDVec_u rol(uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m128i t2 = _mm_sll_epi64(mVec, t0);
+            __m128i t3 = _mm_srl_epi64(mVec, t1);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            return SIMDVec_u(t4);
+        }
+        // MROLS
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m128i t2 = _mm_sll_epi64(mVec, t0);
+            __m128i t3 = _mm_srl_epi64(mVec, t1);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            __m128i t5 = BLEND(mVec, t4, mask.mMask);
+            return SIMDVec_u(t5);
+        }
+        // ROLVA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVec_u const & b) {
+            __m128i t0 = SET1_EPI64(63);
+            __m128i t1 = SET1_EPI64(64);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi64(t1, t2);
+            __m128i t4 = sllv_epi64_sse(mVec, t2);
+            __m128i t5 = srlv_epi64_sse(mVec, t3);
+            mVec = _mm_or_si128(t4, t5);
+            return *this;
+        }
+        // MROLVA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = SET1_EPI64(63);
+            __m128i t1 = SET1_EPI64(64);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi64(t1, t2);
+            __m128i t4 = sllv_epi64_sse(mVec, t2);
+            __m128i t5 = srlv_epi64_sse(mVec, t3);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            mVec = BLEND(mVec, t6, mask.mMask);
+            return *this;
+        }
+        // ROLSA
+        UME_FORCE_INLINE SIMDVec_u & rola(uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m128i t2 = _mm_sll_epi64(mVec, t0);
+            __m128i t3 = _mm_srl_epi64(mVec, t1);
+            mVec = _mm_or_si128(t2, t3);
+            return *this;
+        }
+        // MROLSA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m128i t2 = _mm_sll_epi64(mVec, t0);
+            __m128i t3 = _mm_srl_epi64(mVec, t1);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            mVec = BLEND(mVec, t4, mask.mMask);
+            return *this;
+        }
+        // RORV
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVec_u const & b) const {
+            __m128i t0 = SET1_EPI64(63);
+            __m128i t1 = SET1_EPI64(64);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi64(t1, t2);
+            __m128i t4 = sllv_epi64_sse(mVec, t3);
+            __m128i t5 = srlv_epi64_sse(mVec, t2);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            return SIMDVec_u(t6);
+        }
+        // MRORV
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVecMask<2> const & mask, SIMDVec_u const & b) const {
+            __m128i t0 = SET1_EPI64(63);
+            __m128i t1 = SET1_EPI64(64);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi64(t1, t2);
+            __m128i t4 = sllv_epi64_sse(mVec, t3);
+            __m128i t5 = srlv_epi64_sse(mVec, t2);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = BLEND(mVec, t6, mask.mMask);
+            return SIMDVec_u(t7);
+        }
+        // RORS
+        UME_FORCE_INLINE SIMDVec_u ror(uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m128i t2 = _mm_sll_epi64(mVec, t1);
+            __m128i t3 = _mm_srl_epi64(mVec, t0);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            return SIMDVec_u(t4);
+        }
+        // MRORS
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVecMask<2> const & mask, uint64_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m128i t2 = _mm_sll_epi64(mVec, t1);
+            __m128i t3 = _mm_srl_epi64(mVec, t0);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            __m128i t5 = BLEND(mVec, t4, mask.mMask);
+            return SIMDVec_u(t5);
+        }
+        // RORVA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVec_u const & b) {
+            __m128i t0 = SET1_EPI64(63);
+            __m128i t1 = SET1_EPI64(64);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi64(t1, t2);
+            __m128i t4 = sllv_epi64_sse(mVec, t3);
+            __m128i t5 = srlv_epi64_sse(mVec, t2);
+            mVec = _mm_or_si128(t4, t5);
+            return *this;
+        }
+        // MRORVA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVecMask<2> const & mask, SIMDVec_u const & b) {
+            __m128i t0 = SET1_EPI64(63);
+            __m128i t1 = SET1_EPI64(64);
+            __m128i t2 = _mm_and_si128(b.mVec, t0);
+            __m128i t3 = _mm_sub_epi64(t1, t2);
+            __m128i t4 = sllv_epi64_sse(mVec, t3);
+            __m128i t5 = srlv_epi64_sse(mVec, t2);
+            __m128i t6 = _mm_or_si128(t4, t5);
+            mVec = BLEND(mVec, t6, mask.mMask);
+            return *this;
+        }
+        // RORSA
+        UME_FORCE_INLINE SIMDVec_u & rora(uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m128i t2 = _mm_sll_epi64(mVec, t1);
+            __m128i t3 = _mm_srl_epi64(mVec, t0);
+            mVec = _mm_or_si128(t2, t3);
+            return *this;
+        }
+        // MRORSA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVecMask<2> const & mask, uint64_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(int(b & 63));
+            __m128i t1 = _mm_cvtsi32_si128(int(64 - (b & 63)));
+            __m128i t2 = _mm_sll_epi64(mVec, t1);
+            __m128i t3 = _mm_srl_epi64(mVec, t0);
+            __m128i t4 = _mm_or_si128(t2, t3);
+            mVec = BLEND(mVec, t4, mask.mMask);
+            return *this;
+        }
+
+        // PACK
+        UME_FORCE_INLINE SIMDVec_u & pack(SIMDVec_u<uint64_t, 1> const & a, SIMDVec_u<uint64_t, 1> const & b) {
+            mVec = _mm_set_epi64x(b[0], a[0]);
+            return *this;
+        }
+        // PACKLO
+        UME_FORCE_INLINE SIMDVec_u & packlo(SIMDVec_u<uint64_t, 1> const & a) {
+            mVec = _mm_set_epi64x(extract_epi64_sse<1>(mVec), a[0]);
+            return *this;
+        }
+        // PACKHI
+        UME_FORCE_INLINE SIMDVec_u & packhi(SIMDVec_u<uint64_t, 1> const & b) {
+            mVec = _mm_set_epi64x(b[0], _mm_cvtsi128_si64(mVec));
+            return *this;
+        }
+        // UNPACK
+        UME_FORCE_INLINE void unpack(SIMDVec_u<uint64_t, 1> & a, SIMDVec_u<uint64_t, 1> & b) const {
+            a = SIMDVec_u<uint64_t, 1>(uint64_t(_mm_cvtsi128_si64(mVec)));
+            b = SIMDVec_u<uint64_t, 1>(uint64_t(extract_epi64_sse<1>(mVec)));
+        }
+        // UNPACKLO
+        UME_FORCE_INLINE SIMDVec_u<uint64_t, 1> unpacklo() const {
+            return SIMDVec_u<uint64_t, 1>(uint64_t(_mm_cvtsi128_si64(mVec)));
+        }
+        // UNPACKHI
+        UME_FORCE_INLINE SIMDVec_u<uint64_t, 1> unpackhi() const {
+            return SIMDVec_u<uint64_t, 1>(uint64_t(extract_epi64_sse<1>(mVec)));
+        }
+
+        // PROMOTE
+        // -
+        // DEGRADE
+        UME_FORCE_INLINE operator SIMDVec_u<uint32_t, 2>() const;
+
+        // UTOI
+        UME_FORCE_INLINE operator SIMDVec_i<int64_t, 2>() const;
+        // UTOF
+        UME_FORCE_INLINE operator SIMDVec_f<double, 2>() const;
+    };
+
+}
+}
+
+#undef SET1_EPI64
+#undef BLEND
+#undef MASK_LOAD
+#undef MASK_STORE
+#undef MASK_GATHER
+#undef MOVEMASK
+
+#endif
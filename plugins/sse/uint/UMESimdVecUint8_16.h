@@ -0,0 +1,1777 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_UINT8_16_H_
+#define UME_SIMD_VEC_UINT8_16_H_
+
+#include <type_traits>
+#include <immintrin.h>
+
+#include "../../../UMESimdInterface.h"
+
+namespace UME {
+namespace SIMD {
+
+    template<>
+    class SIMDVec_u<uint8_t, 16> :
+        public SIMDVecUnsignedInterface<
+            SIMDVec_u<uint8_t, 16>,
+            uint8_t,
+            16,
+            SIMDVecMask<16>,
+            SIMDSwizzle<16 >> ,
+        public SIMDVecPackableInterface<
+            SIMDVec_u<uint8_t, 16>,
+            SIMDVec_u<uint8_t, 8 >>
+    {
+    public:
+        // Conversion operators require access to private members.
+        friend class SIMDVec_i<int8_t, 16>;
+        friend class SIMDVec_u<uint16_t, 16>;
+
+        friend class SIMDVec_u<uint8_t, 32>;
+    private:
+        __m128i mVec;
+
+        UME_FORCE_INLINE explicit SIMDVec_u(__m128i & x) { mVec = x; }
+        UME_FORCE_INLINE explicit SIMDVec_u(const __m128i & x) { mVec = x; }
+    public:
+
+        constexpr static uint32_t length() { return 16; }
+        constexpr static uint32_t alignment() { return 16; }
+
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_u() {}
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_u(uint8_t i) {
+            mVec = _mm_set1_epi8(i);
+        }
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_u(
+            T i, 
+            typename std::enable_if< std::is_fundamental<T>::value && 
+                                    !std::is_same<T, uint8_t>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_u(static_cast<uint8_t>(i)) {}
+        // LOAD-CONSTR
+        UME_FORCE_INLINE explicit SIMDVec_u(uint8_t const *p) { load(p); }
+        // FULL-CONSTR
+        UME_FORCE_INLINE SIMDVec_u(uint8_t i0, uint8_t i1, uint8_t i2, uint8_t i3,
+                                   uint8_t i4, uint8_t i5, uint8_t i6, uint8_t i7,
+                                   uint8_t i8, uint8_t i9, uint8_t i10, uint8_t i11,
+                                   uint8_t i12, uint8_t i13, uint8_t i14, uint8_t i15)
+        {
+            mVec = _mm_setr_epi8(i0, i1, i2, i3, i4, i5, i6, i7,
+                                 i8, i9, i10, i11, i12, i13, i14, i15);
+        }
+        // EXTRACT
+        UME_FORCE_INLINE uint8_t extract(uint32_t index) const {
+            alignas(16) uint8_t raw[16];
+            _mm_store_si128((__m128i*)raw, mVec);
+            return raw[index];
+        }
+        UME_FORCE_INLINE uint8_t operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_u & insert(uint32_t index, uint8_t value) {
+            alignas(16) uint8_t raw[16];
+            _mm_store_si128((__m128i*)raw, mVec);
+            raw[index] = value;
+            mVec = _mm_load_si128((__m128i*)raw);
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_u, uint8_t> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_u, uint8_t>(index, static_cast<SIMDVec_u &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_u, uint8_t, SIMDVecMask<16>> operator() (SIMDVecMask<16> const & mask) {
+            return IntermediateMask<SIMDVec_u, uint8_t, SIMDVecMask<16>>(mask, static_cast<SIMDVec_u &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_u, uint8_t, SIMDVecMask<16>> operator[] (SIMDVecMask<16> const & mask) {
+            return IntermediateMask<SIMDVec_u, uint8_t, SIMDVecMask<16>>(mask, static_cast<SIMDVec_u &>(*this));
+        }
+#endif
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVec_u const & b) {
+            mVec = b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator= (SIMDVec_u const & b) {
+            return assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m128i m0 = mask.toEpi8();
+            mVec = blendv_epi8_sse(mVec, b.mVec, m0);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_u & assign(uint8_t b) {
+            mVec = _mm_set1_epi8(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator= (uint8_t b) {
+            return assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVecMask<16> const & mask, uint8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            mVec = blendv_epi8_sse(mVec, t0, m0);
+            return *this;
+        }
+
+        // PREFETCH0
+        // PREFETCH1
+        // PREFETCH2
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_u & load(uint8_t const *p) {
+            mVec = _mm_loadu_si128((const __m128i *)p);
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_u & load(SIMDVecMask<16> const & mask, uint8_t const *p) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_loadu_si128((const __m128i *)p);
+            mVec = blendv_epi8_sse(mVec, t0, m0);
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_u & loada(uint8_t const *p) {
+            mVec = _mm_load_si128((const __m128i *)p);
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_u & loada(SIMDVecMask<16> const & mask, uint8_t const *p) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_load_si128((const __m128i *)p);
+            mVec = blendv_epi8_sse(mVec, t0, m0);
+            return *this;
+        }
+        // STORE
+        UME_FORCE_INLINE uint8_t* store(uint8_t* p) const {
+            _mm_storeu_si128((__m128i *)p, mVec);
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE uint8_t* store(SIMDVecMask<16> const & mask, uint8_t* p) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_loadu_si128((const __m128i *)p);
+            __m128i t1 = blendv_epi8_sse(t0, mVec, m0);
+            _mm_storeu_si128((__m128i *)p, t1);
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE uint8_t* storea(uint8_t* p) const {
+            _mm_store_si128((__m128i *)p, mVec);
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE uint8_t* storea(SIMDVecMask<16> const & mask, uint8_t* p) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_load_si128((const __m128i *)p);
+            __m128i t1 = blendv_epi8_sse(t0, mVec, m0);
+            _mm_store_si128((__m128i *)p, t1);
+            return p;
+        }
+
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = blendv_epi8_sse(mVec, b.mVec, m0);
+            return SIMDVec_u(t0);
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<16> const & mask, uint8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = blendv_epi8_sse(mVec, t0, m0);
+            return SIMDVec_u(t1);
+        }
+        // SWIZZLE
+        // SWIZZLEA
+
+        // SORTA
+        // SORTD
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_add_epi8(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator+ (SIMDVec_u const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_add_epi8(mVec, b.mVec);
+            __m128i t1 = blendv_epi8_sse(mVec, t0, m0);
+            return SIMDVec_u(t1);
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_u add(uint8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_add_epi8(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator+ (uint8_t b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVecMask<16> const & mask, uint8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_add_epi8(mVec, t0);
+            __m128i t2 = blendv_epi8_sse(mVec, t1, m0);
+            return SIMDVec_u(t2);
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVec_u const & b) {
+            mVec = _mm_add_epi8(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator+= (SIMDVec_u const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_add_epi8(mVec, b.mVec);
+            mVec = blendv_epi8_sse(mVec, t0, m0);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_u & adda(uint8_t b) {
+            __m128i t0 = _mm_set1_epi8(b);
+            mVec = _mm_add_epi8(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator+= (uint8_t b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVecMask<16> const & mask, uint8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_add_epi8(mVec, t0);
+            mVec = blendv_epi8_sse(mVec, t1, m0);
+            return *this;
+        }
+        // POSTINC
+        UME_FORCE_INLINE SIMDVec_u postinc() {
+            __m128i t0 = _mm_set1_epi8(1);
+            __m128i t1 = mVec;
+            mVec = _mm_add_epi8(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator++ (int) {
+            return postinc();
+        }
+        // MPOSTINC
+        UME_FORCE_INLINE SIMDVec_u postinc(SIMDVecMask<16> const & mask) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(1);
+            __m128i t1 = mVec;
+            __m128i t2 = _mm_add_epi8(mVec, t0);
+            mVec = blendv_epi8_sse(mVec, t2, m0);
+            return SIMDVec_u(t1);
+        }
+        // PREFINC
+        UME_FORCE_INLINE SIMDVec_u & prefinc() {
+            __m128i t0 = _mm_set1_epi8(1);
+            mVec = _mm_add_epi8(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator++ () {
+            return prefinc();
+        }
+        // MPREFINC
+        UME_FORCE_INLINE SIMDVec_u & prefinc(SIMDVecMask<16> const & mask) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(1);
+            __m128i t1 = _mm_add_epi8(mVec, t0);
+            mVec = blendv_epi8_sse(mVec, t1, m0);
+            return *this;
+        }
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_adds_epu8(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_adds_epu8(mVec, b.mVec);
+            __m128i t1 = blendv_epi8_sse(mVec, t0, m0);
+            return SIMDVec_u(t1);
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(uint8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_adds_epu8(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<16> const & mask, uint8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_adds_epu8(mVec, t0);
+            __m128i t2 = blendv_epi8_sse(mVec, t1, m0);
+            return SIMDVec_u(t2);
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVec_u const & b) {
+            mVec = _mm_adds_epu8(mVec, b.mVec);
+            return *this;
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_adds_epu8(mVec, b.mVec);
+            mVec = blendv_epi8_sse(mVec, t0, m0);
+            return *this;
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(uint8_t b) {
+            __m128i t0 = _mm_set1_epi8(b);
+            mVec = _mm_adds_epu8(mVec, t0);
+            return *this;
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<16> const & mask, uint8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_adds_epu8(mVec, t0);
+            mVec = blendv_epi8_sse(mVec, t1, m0);
+            return *this;
+        }
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_sub_epi8(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator- (SIMDVec_u const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_sub_epi8(mVec, b.mVec);
+            __m128i t1 = blendv_epi8_sse(mVec, t0, m0);
+            return SIMDVec_u(t1);
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_u sub(uint8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_sub_epi8(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator- (uint8_t b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVecMask<16> const & mask, uint8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_sub_epi8(mVec, t0);
+            __m128i t2 = blendv_epi8_sse(mVec, t1, m0);
+            return SIMDVec_u(t2);
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVec_u const & b) {
+            mVec = _mm_sub_epi8(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-= (SIMDVec_u const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_sub_epi8(mVec, b.mVec);
+            mVec = blendv_epi8_sse(mVec, t0, m0);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_u & suba(uint8_t b) {
+            __m128i t0 = _mm_set1_epi8(b);
+            mVec = _mm_sub_epi8(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-= (uint8_t b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVecMask<16> const & mask, uint8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_sub_epi8(mVec, t0);
+            mVec = blendv_epi8_sse(mVec, t1, m0);
+            return *this;
+        }
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_subs_epu8(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_subs_epu8(mVec, b.mVec);
+            __m128i t1 = blendv_epi8_sse(mVec, t0, m0);
+            return SIMDVec_u(t1);
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(uint8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_subs_epu8(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<16> const & mask, uint8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_subs_epu8(mVec, t0);
+            __m128i t2 = blendv_epi8_sse(mVec, t1, m0);
+            return SIMDVec_u(t2);
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVec_u const & b) {
+            mVec = _mm_subs_epu8(mVec, b.mVec);
+            return *this;
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_subs_epu8(mVec, b.mVec);
+            mVec = blendv_epi8_sse(mVec, t0, m0);
+            return *this;
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(uint8_t b) {
+            __m128i t0 = _mm_set1_epi8(b);
+            mVec = _mm_subs_epu8(mVec, t0);
+            return *this;
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<16> const & mask, uint8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_subs_epu8(mVec, t0);
+            mVec = blendv_epi8_sse(mVec, t1, m0);
+            return *this;
+        }
+        // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_sub_epi8(b.mVec, mVec);
+            return SIMDVec_u(t0);
+        }
+        // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_sub_epi8(b.mVec, mVec);
+            __m128i t1 = blendv_epi8_sse(b.mVec, t0, m0);
+            return SIMDVec_u(t1);
+        }
+        // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_u subfrom(uint8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_sub_epi8(t0, mVec);
+            return SIMDVec_u(t1);
+        }
+        // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVecMask<16> const & mask, uint8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_sub_epi8(t0, mVec);
+            __m128i t2 = blendv_epi8_sse(t0, t1, m0);
+            return SIMDVec_u(t2);
+        }
+        // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(SIMDVec_u const & b) {
+            mVec = _mm_sub_epi8(b.mVec, mVec);
+            return *this;
+        }
+        // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_sub_epi8(b.mVec, mVec);
+            mVec = blendv_epi8_sse(b.mVec, t0, m0);
+            return *this;
+        }
+        // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(uint8_t b) {
+            __m128i t0 = _mm_set1_epi8(b);
+            mVec = _mm_sub_epi8(t0, mVec);
+            return *this;
+        }
+        // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(SIMDVecMask<16> const & mask, uint8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_sub_epi8(t0, mVec);
+            mVec = blendv_epi8_sse(t0, t1, m0);
+            return *this;
+        }
+        // POSTDEC
+        UME_FORCE_INLINE SIMDVec_u postdec() {
+            __m128i t0 = _mm_set1_epi8(1);
+            __m128i t1 = mVec;
+            mVec = _mm_sub_epi8(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator-- (int) {
+            return postdec();
+        }
+        // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_u postdec(SIMDVecMask<16> const & mask) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(1);
+            __m128i t1 = mVec;
+            __m128i t2 = _mm_sub_epi8(mVec, t0);
+            mVec = blendv_epi8_sse(mVec, t2, m0);
+            return SIMDVec_u(t1);
+        }
+        // PREFDEC
+        UME_FORCE_INLINE SIMDVec_u & prefdec() {
+            __m128i t0 = _mm_set1_epi8(1);
+            mVec = _mm_sub_epi8(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-- () {
+            return prefdec();
+        }
+        // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_u & prefdec(SIMDVecMask<16> const & mask) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(1);
+            __m128i t1 = _mm_sub_epi8(mVec, t0);
+            mVec = blendv_epi8_sse(mVec, t1, m0);
+            return *this;
+        }
+        // MULV
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_mullo_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_srli_epi16(mVec, 8);
+            __m128i t2 = _mm_srli_epi16(b.mVec, 8);
+            __m128i t3 = _mm_mullo_epi16(t1, t2);
+            __m128i t4 = _mm_slli_epi16(t3, 8);
+            __m128i t5 = _mm_and_si128(t0, _mm_set1_epi16(0x00FF));
+            __m128i t6 = _mm_or_si128(t4, t5);
+            return SIMDVec_u(t6);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator* (SIMDVec_u const & b) const {
+            return mul(b);
+        }
+        // MMULV
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_mullo_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_srli_epi16(mVec, 8);
+            __m128i t2 = _mm_srli_epi16(b.mVec, 8);
+            __m128i t3 = _mm_mullo_epi16(t1, t2);
+            __m128i t4 = _mm_slli_epi16(t3, 8);
+            __m128i t5 = _mm_and_si128(t0, _mm_set1_epi16(0x00FF));
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = blendv_epi8_sse(mVec, t6, m0);
+            return SIMDVec_u(t7);
+        }
+        // MULS
+        UME_FORCE_INLINE SIMDVec_u mul(uint8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_mullo_epi16(mVec, t0);
+            __m128i t2 = _mm_srli_epi16(mVec, 8);
+            __m128i t3 = _mm_srli_epi16(t0, 8);
+            __m128i t4 = _mm_mullo_epi16(t2, t3);
+            __m128i t5 = _mm_slli_epi16(t4, 8);
+            __m128i t6 = _mm_and_si128(t1, _mm_set1_epi16(0x00FF));
+            __m128i t7 = _mm_or_si128(t5, t6);
+            return SIMDVec_u(t7);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator* (uint8_t b) const {
+            return mul(b);
+        }
+        // MMULS
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVecMask<16> const & mask, uint8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_mullo_epi16(mVec, t0);
+            __m128i t2 = _mm_srli_epi16(mVec, 8);
+            __m128i t3 = _mm_srli_epi16(t0, 8);
+            __m128i t4 = _mm_mullo_epi16(t2, t3);
+            __m128i t5 = _mm_slli_epi16(t4, 8);
+            __m128i t6 = _mm_and_si128(t1, _mm_set1_epi16(0x00FF));
+            __m128i t7 = _mm_or_si128(t5, t6);
+            __m128i t8 = blendv_epi8_sse(mVec, t7, m0);
+            return SIMDVec_u(t8);
+        }
+        // MULVA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVec_u const & b) {
+            __m128i t0 = _mm_mullo_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_srli_epi16(mVec, 8);
+            __m128i t2 = _mm_srli_epi16(b.mVec, 8);
+            __m128i t3 = _mm_mullo_epi16(t1, t2);
+            __m128i t4 = _mm_slli_epi16(t3, 8);
+            __m128i t5 = _mm_and_si128(t0, _mm_set1_epi16(0x00FF));
+            mVec = _mm_or_si128(t4, t5);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator*= (SIMDVec_u const & b) {
+            return mula(b);
+        }
+        // MMULVA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_mullo_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_srli_epi16(mVec, 8);
+            __m128i t2 = _mm_srli_epi16(b.mVec, 8);
+            __m128i t3 = _mm_mullo_epi16(t1, t2);
+            __m128i t4 = _mm_slli_epi16(t3, 8);
+            __m128i t5 = _mm_and_si128(t0, _mm_set1_epi16(0x00FF));
+            __m128i t6 = _mm_or_si128(t4, t5);
+            mVec = blendv_epi8_sse(mVec, t6, m0);
+            return *this;
+        }
+        // MULSA
+        UME_FORCE_INLINE SIMDVec_u & mula(uint8_t b) {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_mullo_epi16(mVec, t0);
+            __m128i t2 = _mm_srli_epi16(mVec, 8);
+            __m128i t3 = _mm_srli_epi16(t0, 8);
+            __m128i t4 = _mm_mullo_epi16(t2, t3);
+            __m128i t5 = _mm_slli_epi16(t4, 8);
+            __m128i t6 = _mm_and_si128(t1, _mm_set1_epi16(0x00FF));
+            mVec = _mm_or_si128(t5, t6);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator*= (uint8_t b) {
+            return mula(b);
+        }
+        // MMULSA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVecMask<16> const & mask, uint8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_mullo_epi16(mVec, t0);
+            __m128i t2 = _mm_srli_epi16(mVec, 8);
+            __m128i t3 = _mm_srli_epi16(t0, 8);
+            __m128i t4 = _mm_mullo_epi16(t2, t3);
+            __m128i t5 = _mm_slli_epi16(t4, 8);
+            __m128i t6 = _mm_and_si128(t1, _mm_set1_epi16(0x00FF));
+            __m128i t7 = _mm_or_si128(t5, t6);
+            mVec = blendv_epi8_sse(mVec, t7, m0);
+            return *this;
+        }
+        // DIVV
+        // MDIVV
+        // DIVS
+        // MDIVS
+        // DIVVA
+        // MDIVVA
+        // DIVSA
+        // MDIVSA
+        // RCP
+        // MRCP
+        // RCPS
+        // MRCPS
+        // RCPA
+        // MRCPA
+        // RCPSA
+        // MRCPSA
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<16> cmpeq(SIMDVec_u const & b) const {
+            __m128i m0 = _mm_cmpeq_epi8(mVec, b.mVec);
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator== (SIMDVec_u const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<16> cmpeq(uint8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i m0 = _mm_cmpeq_epi8(mVec, t0);
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator== (uint8_t b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<16> cmpne(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_cmpeq_epi8(mVec, b.mVec);
+            __m128i m0 = _mm_xor_si128(t0, _mm_set1_epi32(0xFFFFFFFF));
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator!= (SIMDVec_u const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<16> cmpne(uint8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_cmpeq_epi8(mVec, t0);
+            __m128i m0 = _mm_xor_si128(t1, _mm_set1_epi32(0xFFFFFFFF));
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator!= (uint8_t b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<16> cmpgt(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_set1_epi8(int8_t(0x80));
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            __m128i t2 = _mm_xor_si128(b.mVec, t0);
+            __m128i m0 = _mm_cmpgt_epi8(t1, t2);
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator> (SIMDVec_u const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<16> cmpgt(uint8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_set1_epi8(int8_t(0x80));
+            __m128i t2 = _mm_xor_si128(mVec, t1);
+            __m128i t3 = _mm_xor_si128(t0, t1);
+            __m128i m0 = _mm_cmpgt_epi8(t2, t3);
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator> (uint8_t b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<16> cmplt(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_set1_epi8(int8_t(0x80));
+            __m128i t1 = _mm_xor_si128(b.mVec, t0);
+            __m128i t2 = _mm_xor_si128(mVec, t0);
+            __m128i m0 = _mm_cmpgt_epi8(t1, t2);
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator< (SIMDVec_u const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<16> cmplt(uint8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_set1_epi8(int8_t(0x80));
+            __m128i t2 = _mm_xor_si128(t0, t1);
+            __m128i t3 = _mm_xor_si128(mVec, t1);
+            __m128i m0 = _mm_cmpgt_epi8(t2, t3);
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator< (uint8_t b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<16> cmpge(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_max_epu8(mVec, b.mVec);
+            __m128i m0 = _mm_cmpeq_epi8(mVec, t0);
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator>= (SIMDVec_u const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<16> cmpge(uint8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_max_epu8(mVec, t0);
+            __m128i m0 = _mm_cmpeq_epi8(mVec, t1);
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator>= (uint8_t b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<16> cmple(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_min_epu8(mVec, b.mVec);
+            __m128i m0 = _mm_cmpeq_epi8(mVec, t0);
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator<= (SIMDVec_u const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<16> cmple(uint8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_min_epu8(mVec, t0);
+            __m128i m0 = _mm_cmpeq_epi8(mVec, t1);
+            return SIMDVecMask<16>::fromEpi8(m0);
+        }
+        UME_FORCE_INLINE SIMDVecMask<16> operator<= (uint8_t b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_u const & b) const {
+            __m128i m0 = _mm_cmpeq_epi8(mVec, b.mVec);
+            uint32_t t0 = uint32_t(_mm_movemask_epi8(m0));
+            return t0 == 0xFFFF;
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(uint8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i m0 = _mm_cmpeq_epi8(mVec, t0);
+            uint32_t t1 = uint32_t(_mm_movemask_epi8(m0));
+            return t1 == 0xFFFF;
+        }
+        // UNIQUE
+        // HADD
+        UME_FORCE_INLINE uint8_t hadd() const {
+            __m128i t0 = _mm_sad_epu8(mVec, _mm_setzero_si128());
+            uint8_t retval = uint8_t(_mm_extract_epi16(t0, 0) + _mm_extract_epi16(t0, 4));
+            return retval;
+        }
+        // HADDS
+        UME_FORCE_INLINE uint8_t hadd(uint8_t b) const {
+            __m128i t0 = _mm_sad_epu8(mVec, _mm_setzero_si128());
+            uint8_t retval = uint8_t(_mm_extract_epi16(t0, 0) + _mm_extract_epi16(t0, 4));
+            return uint8_t(retval + b);
+        }
+        // MHADD
+        UME_FORCE_INLINE uint8_t hadd(SIMDVecMask<16> const & mask) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_setzero_si128();
+            __m128i t1 = blendv_epi8_sse(t0, mVec, m0);
+            __m128i t2 = _mm_sad_epu8(t1, _mm_setzero_si128());
+            uint8_t retval = uint8_t(_mm_extract_epi16(t2, 0) + _mm_extract_epi16(t2, 4));
+            return retval;
+        }
+        // MHADDS
+        UME_FORCE_INLINE uint8_t hadd(SIMDVecMask<16> const & mask, uint8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_setzero_si128();
+            __m128i t1 = blendv_epi8_sse(t0, mVec, m0);
+            __m128i t2 = _mm_sad_epu8(t1, _mm_setzero_si128());
+            uint8_t retval = uint8_t(_mm_extract_epi16(t2, 0) + _mm_extract_epi16(t2, 4));
+            return uint8_t(retval + b);
+        }
+        // HMUL
+        // MHMUL
+        // HMULS
+        // MHMULS
+
+        // FMULADDV
+        UME_FORCE_INLINE SIMDVec_u fmuladd(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = _mm_mullo_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_srli_epi16(mVec, 8);
+            __m128i t2 = _mm_srli_epi16(b.mVec, 8);
+            __m128i t3 = _mm_mullo_epi16(t1, t2);
+            __m128i t4 = _mm_slli_epi16(t3, 8);
+            __m128i t5 = _mm_and_si128(t0, _mm_set1_epi16(0x00FF));
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = _mm_add_epi8(t6, c.mVec);
+            return SIMDVec_u(t7);
+        }
+        // MFMULADDV
+        UME_FORCE_INLINE SIMDVec_u fmuladd(SIMDVecMask<16> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_mullo_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_srli_epi16(mVec, 8);
+            __m128i t2 = _mm_srli_epi16(b.mVec, 8);
+            __m128i t3 = _mm_mullo_epi16(t1, t2);
+            __m128i t4 = _mm_slli_epi16(t3, 8);
+            __m128i t5 = _mm_and_si128(t0, _mm_set1_epi16(0x00FF));
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = _mm_add_epi8(t6, c.mVec);
+            __m128i t8 = blendv_epi8_sse(mVec, t7, m0);
+            return SIMDVec_u(t8);
+        }
+        // FMULSUBV
+        UME_FORCE_INLINE SIMDVec_u fmulsub(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = _mm_mullo_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_srli_epi16(mVec, 8);
+            __m128i t2 = _mm_srli_epi16(b.mVec, 8);
+            __m128i t3 = _mm_mullo_epi16(t1, t2);
+            __m128i t4 = _mm_slli_epi16(t3, 8);
+            __m128i t5 = _mm_and_si128(t0, _mm_set1_epi16(0x00FF));
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = _mm_sub_epi8(t6, c.mVec);
+            return SIMDVec_u(t7);
+        }
+        // MFMULSUBV
+        UME_FORCE_INLINE SIMDVec_u fmulsub(SIMDVecMask<16> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_mullo_epi16(mVec, b.mVec);
+            __m128i t1 = _mm_srli_epi16(mVec, 8);
+            __m128i t2 = _mm_srli_epi16(b.mVec, 8);
+            __m128i t3 = _mm_mullo_epi16(t1, t2);
+            __m128i t4 = _mm_slli_epi16(t3, 8);
+            __m128i t5 = _mm_and_si128(t0, _mm_set1_epi16(0x00FF));
+            __m128i t6 = _mm_or_si128(t4, t5);
+            __m128i t7 = _mm_sub_epi8(t6, c.mVec);
+            __m128i t8 = blendv_epi8_sse(mVec, t7, m0);
+            return SIMDVec_u(t8);
+        }
+        // FADDMULV
+        UME_FORCE_INLINE SIMDVec_u faddmul(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = _mm_add_epi8(mVec, b.mVec);
+            __m128i t1 = _mm_mullo_epi16(t0, c.mVec);
+            __m128i t2 = _mm_srli_epi16(t0, 8);
+            __m128i t3 = _mm_srli_epi16(c.mVec, 8);
+            __m128i t4 = _mm_mullo_epi16(t2, t3);
+            __m128i t5 = _mm_slli_epi16(t4, 8);
+            __m128i t6 = _mm_and_si128(t1, _mm_set1_epi16(0x00FF));
+            __m128i t7 = _mm_or_si128(t5, t6);
+            return SIMDVec_u(t7);
+        }
+        // MFADDMULV
+        UME_FORCE_INLINE SIMDVec_u faddmul(SIMDVecMask<16> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_add_epi8(mVec, b.mVec);
+            __m128i t1 = _mm_mullo_epi16(t0, c.mVec);
+            __m128i t2 = _mm_srli_epi16(t0, 8);
+            __m128i t3 = _mm_srli_epi16(c.mVec, 8);
+            __m128i t4 = _mm_mullo_epi16(t2, t3);
+            __m128i t5 = _mm_slli_epi16(t4, 8);
+            __m128i t6 = _mm_and_si128(t1, _mm_set1_epi16(0x00FF));
+            __m128i t7 = _mm_or_si128(t5, t6);
+            __m128i t8 = blendv_epi8_sse(mVec, t7, m0);
+            return SIMDVec_u(t8);
+        }
+        // FSUBMULV
+        UME_FORCE_INLINE SIMDVec_u fsubmul(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i t0 = _mm_sub_epi8(mVec, b.mVec);
+            __m128i t1 = _mm_mullo_epi16(t0, c.mVec);
+            __m128i t2 = _mm_srli_epi16(t0, 8);
+            __m128i t3 = _mm_srli_epi16(c.mVec, 8);
+            __m128i t4 = _mm_mullo_epi16(t2, t3);
+            __m128i t5 = _mm_slli_epi16(t4, 8);
+            __m128i t6 = _mm_and_si128(t1, _mm_set1_epi16(0x00FF));
+            __m128i t7 = _mm_or_si128(t5, t6);
+            return SIMDVec_u(t7);
+        }
+        // MFSUBMULV
+        UME_FORCE_INLINE SIMDVec_u fsubmul(SIMDVecMask<16> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_sub_epi8(mVec, b.mVec);
+            __m128i t1 = _mm_mullo_epi16(t0, c.mVec);
+            __m128i t2 = _mm_srli_epi16(t0, 8);
+            __m128i t3 = _mm_srli_epi16(c.mVec, 8);
+            __m128i t4 = _mm_mullo_epi16(t2, t3);
+            __m128i t5 = _mm_slli_epi16(t4, 8);
+            __m128i t6 = _mm_and_si128(t1, _mm_set1_epi16(0x00FF));
+            __m128i t7 = _mm_or_si128(t5, t6);
+            __m128i t8 = blendv_epi8_sse(mVec, t7, m0);
+            return SIMDVec_u(t8);
+        }
+
+        // MAXV
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_max_epu8(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // MMAXV
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_max_epu8(mVec, b.mVec);
+            __m128i t1 = blendv_epi8_sse(mVec, t0, m0);
+            return SIMDVec_u(t1);
+        }
+        // MAXS
+        UME_FORCE_INLINE SIMDVec_u max(uint8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_max_epu8(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        // MMAXS
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVecMask<16> const & mask, uint8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_max_epu8(mVec, t0);
+            __m128i t2 = blendv_epi8_sse(mVec, t1, m0);
+            return SIMDVec_u(t2);
+        }
+        // MAXVA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVec_u const & b) {
+            mVec = _mm_max_epu8(mVec, b.mVec);
+            return *this;
+        }
+        // MMAXVA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_max_epu8(mVec, b.mVec);
+            mVec = blendv_epi8_sse(mVec, t0, m0);
+            return *this;
+        }
+        // MAXSA
+        UME_FORCE_INLINE SIMDVec_u & maxa(uint8_t b) {
+            __m128i t0 = _mm_set1_epi8(b);
+            mVec = _mm_max_epu8(mVec, t0);
+            return *this;
+        }
+        // MMAXSA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVecMask<16> const & mask, uint8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_max_epu8(mVec, t0);
+            mVec = blendv_epi8_sse(mVec, t1, m0);
+            return *this;
+        }
+        // MINV
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_min_epu8(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        // MMINV
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_min_epu8(mVec, b.mVec);
+            __m128i t1 = blendv_epi8_sse(mVec, t0, m0);
+            return SIMDVec_u(t1);
+        }
+        // MINS
+        UME_FORCE_INLINE SIMDVec_u min(uint8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_min_epu8(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        // MMINS
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVecMask<16> const & mask, uint8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_min_epu8(mVec, t0);
+            __m128i t2 = blendv_epi8_sse(mVec, t1, m0);
+            return SIMDVec_u(t2);
+        }
+        // MINVA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVec_u const & b) {
+            mVec = _mm_min_epu8(mVec, b.mVec);
+            return *this;
+        }
+        // MMINVA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_min_epu8(mVec, b.mVec);
+            mVec = blendv_epi8_sse(mVec, t0, m0);
+            return *this;
+        }
+        // MINSA
+        UME_FORCE_INLINE SIMDVec_u & mina(uint8_t b) {
+            __m128i t0 = _mm_set1_epi8(b);
+            mVec = _mm_min_epu8(mVec, t0);
+            return *this;
+        }
+        // MMINSA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVecMask<16> const & mask, uint8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_min_epu8(mVec, t0);
+            mVec = blendv_epi8_sse(mVec, t1, m0);
+            return *this;
+        }
+        // HMAX
+        UME_FORCE_INLINE uint8_t hmax() const {
+            __m128i t0 = _mm_max_epu8(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_max_epu8(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_max_epu8(t1, _mm_srli_si128(t1, 2));
+            __m128i t3 = _mm_max_epu8(t2, _mm_srli_si128(t2, 1));
+            uint8_t retval = uint8_t(extract_epi8_sse<0>(t3));
+            return retval;
+        }
+        // MHMAX
+        UME_FORCE_INLINE uint8_t hmax(SIMDVecMask<16> const & mask) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_setzero_si128();
+            __m128i t1 = blendv_epi8_sse(t0, mVec, m0);
+            __m128i t2 = _mm_max_epu8(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_max_epu8(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_max_epu8(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_max_epu8(t4, _mm_srli_si128(t4, 1));
+            uint8_t retval = uint8_t(extract_epi8_sse<0>(t5));
+            return retval;
+        }
+        // IMAX
+        // MIMAX
+        // HMIN
+        UME_FORCE_INLINE uint8_t hmin() const {
+            __m128i t0 = _mm_min_epu8(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_min_epu8(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_min_epu8(t1, _mm_srli_si128(t1, 2));
+            __m128i t3 = _mm_min_epu8(t2, _mm_srli_si128(t2, 1));
+            uint8_t retval = uint8_t(extract_epi8_sse<0>(t3));
+            return retval;
+        }
+        // MHMIN
+        UME_FORCE_INLINE uint8_t hmin(SIMDVecMask<16> const & mask) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = blendv_epi8_sse(t0, mVec, m0);
+            __m128i t2 = _mm_min_epu8(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_min_epu8(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_min_epu8(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_min_epu8(t4, _mm_srli_si128(t4, 1));
+            uint8_t retval = uint8_t(extract_epi8_sse<0>(t5));
+            return retval;
+        }
+        // IMIN
+        // MIMIN
+
+        // BANDV
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator& (SIMDVec_u const & b) const {
+            return band(b);
+        }
+        // MBANDV
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            __m128i t1 = blendv_epi8_sse(mVec, t0, m0);
+            return SIMDVec_u(t1);
+        }
+        // BANDS
+        UME_FORCE_INLINE SIMDVec_u band(uint8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator& (uint8_t b) const {
+            return band(b);
+        }
+        // MBANDS
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<16> const & mask, uint8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            __m128i t2 = blendv_epi8_sse(mVec, t1, m0);
+            return SIMDVec_u(t2);
+        }
+        // BANDVA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVec_u const & b) {
+            mVec = _mm_and_si128(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (SIMDVec_u const & b) {
+            return banda(b);
+        }
+        // MBANDVA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_and_si128(mVec, b.mVec);
+            mVec = blendv_epi8_sse(mVec, t0, m0);
+            return *this;
+        }
+        // BANDSA
+        UME_FORCE_INLINE SIMDVec_u & banda(uint8_t b) {
+            __m128i t0 = _mm_set1_epi8(b);
+            mVec = _mm_and_si128(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (uint8_t b) {
+            return banda(b);
+        }
+        // MBANDSA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<16> const & mask, uint8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_and_si128(mVec, t0);
+            mVec = blendv_epi8_sse(mVec, t1, m0);
+            return *this;
+        }
+        // BORV
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator| (SIMDVec_u const & b) const {
+            return bor(b);
+        }
+        // MBORV
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            __m128i t1 = blendv_epi8_sse(mVec, t0, m0);
+            return SIMDVec_u(t1);
+        }
+        // BORS
+        UME_FORCE_INLINE SIMDVec_u bor(uint8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator| (uint8_t b) const {
+            return bor(b);
+        }
+        // MBORS
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<16> const & mask, uint8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            __m128i t2 = blendv_epi8_sse(mVec, t1, m0);
+            return SIMDVec_u(t2);
+        }
+        // BORVA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVec_u const & b) {
+            mVec = _mm_or_si128(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (SIMDVec_u const & b) {
+            return bora(b);
+        }
+        // MBORVA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_or_si128(mVec, b.mVec);
+            mVec = blendv_epi8_sse(mVec, t0, m0);
+            return *this;
+        }
+        // BORSA
+        UME_FORCE_INLINE SIMDVec_u & bora(uint8_t b) {
+            __m128i t0 = _mm_set1_epi8(b);
+            mVec = _mm_or_si128(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (uint8_t b) {
+            return bora(b);
+        }
+        // MBORSA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<16> const & mask, uint8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_or_si128(mVec, t0);
+            mVec = blendv_epi8_sse(mVec, t1, m0);
+            return *this;
+        }
+        // BXORV
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVec_u const & b) const {
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            return SIMDVec_u(t0);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator^ (SIMDVec_u const & b) const {
+            return bxor(b);
+        }
+        // MBXORV
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<16> const & mask, SIMDVec_u const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            __m128i t1 = blendv_epi8_sse(mVec, t0, m0);
+            return SIMDVec_u(t1);
+        }
+        // BXORS
+        UME_FORCE_INLINE SIMDVec_u bxor(uint8_t b) const {
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator^ (uint8_t b) const {
+            return bxor(b);
+        }
+        // MBXORS
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<16> const & mask, uint8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            __m128i t2 = blendv_epi8_sse(mVec, t1, m0);
+            return SIMDVec_u(t2);
+        }
+        // BXORVA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVec_u const & b) {
+            mVec = _mm_xor_si128(mVec, b.mVec);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator^= (SIMDVec_u const & b) {
+            return bxora(b);
+        }
+        // MBXORVA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<16> const & mask, SIMDVec_u const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_xor_si128(mVec, b.mVec);
+            mVec = blendv_epi8_sse(mVec, t0, m0);
+            return *this;
+        }
+        // BXORSA
+        UME_FORCE_INLINE SIMDVec_u & bxora(uint8_t b) {
+            __m128i t0 = _mm_set1_epi8(b);
+            mVec = _mm_xor_si128(mVec, t0);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator^= (uint8_t b) {
+            return bxora(b);
+        }
+        // MBXORSA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<16> const & mask, uint8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi8(b);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            mVec = blendv_epi8_sse(mVec, t1, m0);
+            return *this;
+        }
+        // BNOT
+        UME_FORCE_INLINE SIMDVec_u bnot() const {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            return SIMDVec_u(t1);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator~ () const {
+            return bnot();
+        }
+        // MBNOT
+        UME_FORCE_INLINE SIMDVec_u bnot(SIMDVecMask<16> const & mask) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            __m128i t2 = blendv_epi8_sse(mVec, t1, m0);
+            return SIMDVec_u(t2);
+        }
+        // BNOTA
+        UME_FORCE_INLINE SIMDVec_u & bnota() {
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            mVec = _mm_xor_si128(mVec, t0);
+            return *this;
+        }
+        // MBNOTA
+        UME_FORCE_INLINE SIMDVec_u & bnota(SIMDVecMask<16> const & mask) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = _mm_xor_si128(mVec, t0);
+            mVec = blendv_epi8_sse(mVec, t1, m0);
+            return *this;
+        }
+        // HBAND
+        UME_FORCE_INLINE uint8_t hband() const {
+            __m128i t0 = _mm_and_si128(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_and_si128(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_and_si128(t1, _mm_srli_si128(t1, 2));
+            __m128i t3 = _mm_and_si128(t2, _mm_srli_si128(t2, 1));
+            uint8_t retval = uint8_t(extract_epi8_sse<0>(t3));
+            return retval;
+        }
+        // HBANDS
+        UME_FORCE_INLINE uint8_t hband(uint8_t b) const {
+            __m128i t0 = _mm_and_si128(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_and_si128(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_and_si128(t1, _mm_srli_si128(t1, 2));
+            __m128i t3 = _mm_and_si128(t2, _mm_srli_si128(t2, 1));
+            uint8_t retval = uint8_t(extract_epi8_sse<0>(t3));
+            return uint8_t(retval & b);
+        }
+        // MHBAND
+        UME_FORCE_INLINE uint8_t hband(SIMDVecMask<16> const & mask) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = blendv_epi8_sse(t0, mVec, m0);
+            __m128i t2 = _mm_and_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_and_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_and_si128(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_and_si128(t4, _mm_srli_si128(t4, 1));
+            uint8_t retval = uint8_t(extract_epi8_sse<0>(t5));
+            return retval;
+        }
+        // MHBANDS
+        UME_FORCE_INLINE uint8_t hband(SIMDVecMask<16> const & mask, uint8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_set1_epi32(0xFFFFFFFF);
+            __m128i t1 = blendv_epi8_sse(t0, mVec, m0);
+            __m128i t2 = _mm_and_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_and_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_and_si128(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_and_si128(t4, _mm_srli_si128(t4, 1));
+            uint8_t retval = uint8_t(extract_epi8_sse<0>(t5));
+            return uint8_t(retval & b);
+        }
+        // HBOR
+        UME_FORCE_INLINE uint8_t hbor() const {
+            __m128i t0 = _mm_or_si128(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_or_si128(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_or_si128(t1, _mm_srli_si128(t1, 2));
+            __m128i t3 = _mm_or_si128(t2, _mm_srli_si128(t2, 1));
+            uint8_t retval = uint8_t(extract_epi8_sse<0>(t3));
+            return retval;
+        }
+        // HBORS
+        UME_FORCE_INLINE uint8_t hbor(uint8_t b) const {
+            __m128i t0 = _mm_or_si128(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_or_si128(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_or_si128(t1, _mm_srli_si128(t1, 2));
+            __m128i t3 = _mm_or_si128(t2, _mm_srli_si128(t2, 1));
+            uint8_t retval = uint8_t(extract_epi8_sse<0>(t3));
+            return uint8_t(retval | b);
+        }
+        // MHBOR
+        UME_FORCE_INLINE uint8_t hbor(SIMDVecMask<16> const & mask) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_setzero_si128();
+            __m128i t1 = blendv_epi8_sse(t0, mVec, m0);
+            __m128i t2 = _mm_or_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_or_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_or_si128(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_or_si128(t4, _mm_srli_si128(t4, 1));
+            uint8_t retval = uint8_t(extract_epi8_sse<0>(t5));
+            return retval;
+        }
+        // MHBORS
+        UME_FORCE_INLINE uint8_t hbor(SIMDVecMask<16> const & mask, uint8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_setzero_si128();
+            __m128i t1 = blendv_epi8_sse(t0, mVec, m0);
+            __m128i t2 = _mm_or_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_or_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_or_si128(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_or_si128(t4, _mm_srli_si128(t4, 1));
+            uint8_t retval = uint8_t(extract_epi8_sse<0>(t5));
+            return uint8_t(retval | b);
+        }
+        // HBXOR
+        UME_FORCE_INLINE uint8_t hbxor() const {
+            __m128i t0 = _mm_xor_si128(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_xor_si128(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_xor_si128(t1, _mm_srli_si128(t1, 2));
+            __m128i t3 = _mm_xor_si128(t2, _mm_srli_si128(t2, 1));
+            uint8_t retval = uint8_t(extract_epi8_sse<0>(t3));
+            return retval;
+        }
+        // HBXORS
+        UME_FORCE_INLINE uint8_t hbxor(uint8_t b) const {
+            __m128i t0 = _mm_xor_si128(mVec, _mm_srli_si128(mVec, 8));
+            __m128i t1 = _mm_xor_si128(t0, _mm_srli_si128(t0, 4));
+            __m128i t2 = _mm_xor_si128(t1, _mm_srli_si128(t1, 2));
+            __m128i t3 = _mm_xor_si128(t2, _mm_srli_si128(t2, 1));
+            uint8_t retval = uint8_t(extract_epi8_sse<0>(t3));
+            return uint8_t(retval ^ b);
+        }
+        // MHBXOR
+        UME_FORCE_INLINE uint8_t hbxor(SIMDVecMask<16> const & mask) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_setzero_si128();
+            __m128i t1 = blendv_epi8_sse(t0, mVec, m0);
+            __m128i t2 = _mm_xor_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_xor_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_xor_si128(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_xor_si128(t4, _mm_srli_si128(t4, 1));
+            uint8_t retval = uint8_t(extract_epi8_sse<0>(t5));
+            return retval;
+        }
+        // MHBXORS
+        UME_FORCE_INLINE uint8_t hbxor(SIMDVecMask<16> const & mask, uint8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_setzero_si128();
+            __m128i t1 = blendv_epi8_sse(t0, mVec, m0);
+            __m128i t2 = _mm_xor_si128(t1, _mm_srli_si128(t1, 8));
+            __m128i t3 = _mm_xor_si128(t2, _mm_srli_si128(t2, 4));
+            __m128i t4 = _mm_xor_si128(t3, _mm_srli_si128(t3, 2));
+            __m128i t5 = _mm_xor_si128(t4, _mm_srli_si128(t4, 1));
+            uint8_t retval = uint8_t(extract_epi8_sse<0>(t5));
+            return uint8_t(retval ^ b);
+        }
+
+        // GATHERU
+        // MGATHERU
+        // GATHERS
+        // MGATHERS
+        // GATHERV
+        // MGATHERV
+        // SCATTERU
+        // MSCATTERU
+        // SCATTERS
+        // MSCATTERS
+        // SCATTERV
+        // MSCATTERV
+
+        // LSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVec_u<uint8_t, 16> const & b) const {
+            __m128i t0 = _mm_min_epu8(b.mVec, _mm_set1_epi8(8));
+            __m128i t1 = _mm_slli_epi16(t0, 5);
+            __m128i t2 = _mm_and_si128(_mm_slli_epi16(mVec, 4), _mm_set1_epi8((char)0xF0));
+            __m128i t3 = blendv_msb_epi8_sse(mVec, t2, t1);
+            __m128i t4 = _mm_add_epi8(t1, t1);
+            __m128i t5 = _mm_and_si128(_mm_slli_epi16(t3, 2), _mm_set1_epi8((char)0xFC));
+            __m128i t6 = blendv_msb_epi8_sse(t3, t5, t4);
+            __m128i t7 = _mm_add_epi8(t4, t4);
+            __m128i t8 = _mm_and_si128(_mm_slli_epi16(t6, 1), _mm_set1_epi8((char)0xFE));
+            __m128i t9 = blendv_msb_epi8_sse(t6, t8, t7);
+            __m128i t10 = _mm_cmpeq_epi8(t0, _mm_set1_epi8(8));
+            __m128i t11 = _mm_andnot_si128(t10, t9);
+            return SIMDVec_u(t11);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (SIMDVec_u<uint8_t, 16> const & b) const {
+            return lsh(b);
+        }
+        // MLSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<16> const & mask, SIMDVec_u<uint8_t, 16> const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_min_epu8(b.mVec, _mm_set1_epi8(8));
+            __m128i t1 = _mm_slli_epi16(t0, 5);
+            __m128i t2 = _mm_and_si128(_mm_slli_epi16(mVec, 4), _mm_set1_epi8((char)0xF0));
+            __m128i t3 = blendv_msb_epi8_sse(mVec, t2, t1);
+            __m128i t4 = _mm_add_epi8(t1, t1);
+            __m128i t5 = _mm_and_si128(_mm_slli_epi16(t3, 2), _mm_set1_epi8((char)0xFC));
+            __m128i t6 = blendv_msb_epi8_sse(t3, t5, t4);
+            __m128i t7 = _mm_add_epi8(t4, t4);
+            __m128i t8 = _mm_and_si128(_mm_slli_epi16(t6, 1), _mm_set1_epi8((char)0xFE));
+            __m128i t9 = blendv_msb_epi8_sse(t6, t8, t7);
+            __m128i t10 = _mm_cmpeq_epi8(t0, _mm_set1_epi8(8));
+            __m128i t11 = _mm_andnot_si128(t10, t9);
+            __m128i t12 = blendv_epi8_sse(mVec, t11, m0);
+            return SIMDVec_u(t12);
+        }
+        // LSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(uint8_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            char bmask = (b < 8) ? char(0xFF << b) : 0;
+            __m128i t1 = _mm_sll_epi16(mVec, t0);
+            __m128i t2 = _mm_and_si128(t1, _mm_set1_epi8(bmask));
+            return SIMDVec_u(t2);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (uint8_t b) const {
+            return lsh(b);
+        }
+        // MLSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<16> const & mask, uint8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            char bmask = (b < 8) ? char(0xFF << b) : 0;
+            __m128i t1 = _mm_sll_epi16(mVec, t0);
+            __m128i t2 = _mm_and_si128(t1, _mm_set1_epi8(bmask));
+            __m128i t3 = blendv_epi8_sse(mVec, t2, m0);
+            return SIMDVec_u(t3);
+        }
+        // LSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVec_u<uint8_t, 16> const & b) {
+            __m128i t0 = _mm_min_epu8(b.mVec, _mm_set1_epi8(8));
+            __m128i t1 = _mm_slli_epi16(t0, 5);
+            __m128i t2 = _mm_and_si128(_mm_slli_epi16(mVec, 4), _mm_set1_epi8((char)0xF0));
+            __m128i t3 = blendv_msb_epi8_sse(mVec, t2, t1);
+            __m128i t4 = _mm_add_epi8(t1, t1);
+            __m128i t5 = _mm_and_si128(_mm_slli_epi16(t3, 2), _mm_set1_epi8((char)0xFC));
+            __m128i t6 = blendv_msb_epi8_sse(t3, t5, t4);
+            __m128i t7 = _mm_add_epi8(t4, t4);
+            __m128i t8 = _mm_and_si128(_mm_slli_epi16(t6, 1), _mm_set1_epi8((char)0xFE));
+            __m128i t9 = blendv_msb_epi8_sse(t6, t8, t7);
+            __m128i t10 = _mm_cmpeq_epi8(t0, _mm_set1_epi8(8));
+            mVec = _mm_andnot_si128(t10, t9);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (SIMDVec_u<uint8_t, 16> const & b) {
+            return lsha(b);
+        }
+        // MLSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<16> const & mask, SIMDVec_u<uint8_t, 16> const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_min_epu8(b.mVec, _mm_set1_epi8(8));
+            __m128i t1 = _mm_slli_epi16(t0, 5);
+            __m128i t2 = _mm_and_si128(_mm_slli_epi16(mVec, 4), _mm_set1_epi8((char)0xF0));
+            __m128i t3 = blendv_msb_epi8_sse(mVec, t2, t1);
+            __m128i t4 = _mm_add_epi8(t1, t1);
+            __m128i t5 = _mm_and_si128(_mm_slli_epi16(t3, 2), _mm_set1_epi8((char)0xFC));
+            __m128i t6 = blendv_msb_epi8_sse(t3, t5, t4);
+            __m128i t7 = _mm_add_epi8(t4, t4);
+            __m128i t8 = _mm_and_si128(_mm_slli_epi16(t6, 1), _mm_set1_epi8((char)0xFE));
+            __m128i t9 = blendv_msb_epi8_sse(t6, t8, t7);
+            __m128i t10 = _mm_cmpeq_epi8(t0, _mm_set1_epi8(8));
+            __m128i t11 = _mm_andnot_si128(t10, t9);
+            mVec = blendv_epi8_sse(mVec, t11, m0);
+            return *this;
+        }
+        // LSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(uint8_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            char bmask = (b < 8) ? char(0xFF << b) : 0;
+            __m128i t1 = _mm_sll_epi16(mVec, t0);
+            mVec = _mm_and_si128(t1, _mm_set1_epi8(bmask));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (uint8_t b) {
+            return lsha(b);
+        }
+        // MLSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<16> const & mask, uint8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            char bmask = (b < 8) ? char(0xFF << b) : 0;
+            __m128i t1 = _mm_sll_epi16(mVec, t0);
+            __m128i t2 = _mm_and_si128(t1, _mm_set1_epi8(bmask));
+            mVec = blendv_epi8_sse(mVec, t2, m0);
+            return *this;
+        }
+        // RSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVec_u<uint8_t, 16> const & b) const {
+            __m128i t0 = _mm_min_epu8(b.mVec, _mm_set1_epi8(8));
+            __m128i t1 = _mm_slli_epi16(t0, 5);
+            __m128i t2 = _mm_and_si128(_mm_srli_epi16(mVec, 4), _mm_set1_epi8(0x0F));
+            __m128i t3 = blendv_msb_epi8_sse(mVec, t2, t1);
+            __m128i t4 = _mm_add_epi8(t1, t1);
+            __m128i t5 = _mm_and_si128(_mm_srli_epi16(t3, 2), _mm_set1_epi8(0x3F));
+            __m128i t6 = blendv_msb_epi8_sse(t3, t5, t4);
+            __m128i t7 = _mm_add_epi8(t4, t4);
+            __m128i t8 = _mm_and_si128(_mm_srli_epi16(t6, 1), _mm_set1_epi8(0x7F));
+            __m128i t9 = blendv_msb_epi8_sse(t6, t8, t7);
+            __m128i t10 = _mm_cmpeq_epi8(t0, _mm_set1_epi8(8));
+            __m128i t11 = _mm_andnot_si128(t10, t9);
+            return SIMDVec_u(t11);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (SIMDVec_u<uint8_t, 16> const & b) const {
+            return rsh(b);
+        }
+        // MRSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<16> const & mask, SIMDVec_u<uint8_t, 16> const & b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_min_epu8(b.mVec, _mm_set1_epi8(8));
+            __m128i t1 = _mm_slli_epi16(t0, 5);
+            __m128i t2 = _mm_and_si128(_mm_srli_epi16(mVec, 4), _mm_set1_epi8(0x0F));
+            __m128i t3 = blendv_msb_epi8_sse(mVec, t2, t1);
+            __m128i t4 = _mm_add_epi8(t1, t1);
+            __m128i t5 = _mm_and_si128(_mm_srli_epi16(t3, 2), _mm_set1_epi8(0x3F));
+            __m128i t6 = blendv_msb_epi8_sse(t3, t5, t4);
+            __m128i t7 = _mm_add_epi8(t4, t4);
+            __m128i t8 = _mm_and_si128(_mm_srli_epi16(t6, 1), _mm_set1_epi8(0x7F));
+            __m128i t9 = blendv_msb_epi8_sse(t6, t8, t7);
+            __m128i t10 = _mm_cmpeq_epi8(t0, _mm_set1_epi8(8));
+            __m128i t11 = _mm_andnot_si128(t10, t9);
+            __m128i t12 = blendv_epi8_sse(mVec, t11, m0);
+            return SIMDVec_u(t12);
+        }
+        // RSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(uint8_t b) const {
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            char bmask = (b < 8) ? char(0xFF >> b) : 0;
+            __m128i t1 = _mm_srl_epi16(mVec, t0);
+            __m128i t2 = _mm_and_si128(t1, _mm_set1_epi8(bmask));
+            return SIMDVec_u(t2);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (uint8_t b) const {
+            return rsh(b);
+        }
+        // MRSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<16> const & mask, uint8_t b) const {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            char bmask = (b < 8) ? char(0xFF >> b) : 0;
+            __m128i t1 = _mm_srl_epi16(mVec, t0);
+            __m128i t2 = _mm_and_si128(t1, _mm_set1_epi8(bmask));
+            __m128i t3 = blendv_epi8_sse(mVec, t2, m0);
+            return SIMDVec_u(t3);
+        }
+        // RSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVec_u<uint8_t, 16> const & b) {
+            __m128i t0 = _mm_min_epu8(b.mVec, _mm_set1_epi8(8));
+            __m128i t1 = _mm_slli_epi16(t0, 5);
+            __m128i t2 = _mm_and_si128(_mm_srli_epi16(mVec, 4), _mm_set1_epi8(0x0F));
+            __m128i t3 = blendv_msb_epi8_sse(mVec, t2, t1);
+            __m128i t4 = _mm_add_epi8(t1, t1);
+            __m128i t5 = _mm_and_si128(_mm_srli_epi16(t3, 2), _mm_set1_epi8(0x3F));
+            __m128i t6 = blendv_msb_epi8_sse(t3, t5, t4);
+            __m128i t7 = _mm_add_epi8(t4, t4);
+            __m128i t8 = _mm_and_si128(_mm_srli_epi16(t6, 1), _mm_set1_epi8(0x7F));
+            __m128i t9 = blendv_msb_epi8_sse(t6, t8, t7);
+            __m128i t10 = _mm_cmpeq_epi8(t0, _mm_set1_epi8(8));
+            mVec = _mm_andnot_si128(t10, t9);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (SIMDVec_u<uint8_t, 16> const & b) {
+            return rsha(b);
+        }
+        // MRSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<16> const & mask, SIMDVec_u<uint8_t, 16> const & b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_min_epu8(b.mVec, _mm_set1_epi8(8));
+            __m128i t1 = _mm_slli_epi16(t0, 5);
+            __m128i t2 = _mm_and_si128(_mm_srli_epi16(mVec, 4), _mm_set1_epi8(0x0F));
+            __m128i t3 = blendv_msb_epi8_sse(mVec, t2, t1);
+            __m128i t4 = _mm_add_epi8(t1, t1);
+            __m128i t5 = _mm_and_si128(_mm_srli_epi16(t3, 2), _mm_set1_epi8(0x3F));
+            __m128i t6 = blendv_msb_epi8_sse(t3, t5, t4);
+            __m128i t7 = _mm_add_epi8(t4, t4);
+            __m128i t8 = _mm_and_si128(_mm_srli_epi16(t6, 1), _mm_set1_epi8(0x7F));
+            __m128i t9 = blendv_msb_epi8_sse(t6, t8, t7);
+            __m128i t10 = _mm_cmpeq_epi8(t0, _mm_set1_epi8(8));
+            __m128i t11 = _mm_andnot_si128(t10, t9);
+            mVec = blendv_epi8_sse(mVec, t11, m0);
+            return *this;
+        }
+        // RSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(uint8_t b) {
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            char bmask = (b < 8) ? char(0xFF >> b) : 0;
+            __m128i t1 = _mm_srl_epi16(mVec, t0);
+            mVec = _mm_and_si128(t1, _mm_set1_epi8(bmask));
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (uint8_t b) {
+            return rsha(b);
+        }
+        // MRSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<16> const & mask, uint8_t b) {
+            __m128i m0 = mask.toEpi8();
+            __m128i t0 = _mm_cvtsi32_si128(b);
+            char bmask = (b < 8) ? char(0xFF >> b) : 0;
+            __m128i t1 = _mm_srl_epi16(mVec, t0);
+            __m128i t2 = _mm_and_si128(t1, _mm_set1_epi8(bmask));
+            mVec = blendv_epi8_sse(mVec, t2, m0);
+            return *this;
+        }
+        // ROLV
+        // MROLV
+        // ROLS
+        // MROLS
+        // ROLVA
+        // MROLVA
+        // ROLSA
+        // MROLSA
+        // RORV
+        // MRORV
+        // RORS
+        // MRORS
+        // RORVA
+        // MRORVA
+        // RORSA
+        // MRORSA
+
+        // PACK
+        // PACKLO
+        // PACKHI
+        // UNPACK
+        // UNPACKLO
+        // UNPACKHI
+
+        // PROMOTE
+        UME_FORCE_INLINE operator SIMDVec_u<uint16_t, 16>() const;
+        // DEGRADE
+        // -
+
+        // UTOI
+        UME_FORCE_INLINE operator SIMDVec_i<int8_t, 16>() const;
+        // UTOF
+        // -
+
+    };
+
+}
+}
+
+#endif
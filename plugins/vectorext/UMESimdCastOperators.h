@@ -0,0 +1,950 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_CAST_OPERATORS_H_
+#define UME_SIMD_CAST_OPERATORS_H_
+
+#include "UMESimdVecUint.h"
+#include "UMESimdVecInt.h"
+#include "UMESimdVecFloat.h"
+
+namespace UME {
+namespace SIMD {
+    // Operators for non-specialized types require 'template<>' syntax.
+    // Compliant compiler will not accept this syntax for non-specialized
+    // types, so make sure only proper definitions have it.
+
+    // UTOI
+    template<>
+    inline SIMDVec_u<uint8_t, 1>::operator SIMDVec_i<int8_t, 1>() const {
+        return SIMDVec_i<int8_t, 1>(__builtin_convertvector(mVec, SIMDVec_i<int8_t, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint8_t, 2>::operator SIMDVec_i<int8_t, 2>() const {
+        return SIMDVec_i<int8_t, 2>(__builtin_convertvector(mVec, SIMDVec_i<int8_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint8_t, 4>::operator SIMDVec_i<int8_t, 4>() const {
+        return SIMDVec_i<int8_t, 4>(__builtin_convertvector(mVec, SIMDVec_i<int8_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint8_t, 8>::operator SIMDVec_i<int8_t, 8>() const {
+        return SIMDVec_i<int8_t, 8>(__builtin_convertvector(mVec, SIMDVec_i<int8_t, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint8_t, 16>::operator SIMDVec_i<int8_t, 16>() const {
+        return SIMDVec_i<int8_t, 16>(__builtin_convertvector(mVec, SIMDVec_i<int8_t, 16>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint8_t, 32>::operator SIMDVec_i<int8_t, 32>() const {
+        return SIMDVec_i<int8_t, 32>(__builtin_convertvector(mVec, SIMDVec_i<int8_t, 32>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint8_t, 64>::operator SIMDVec_i<int8_t, 64>() const {
+        return SIMDVec_i<int8_t, 64>(__builtin_convertvector(mVec, SIMDVec_i<int8_t, 64>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint8_t, 128>::operator SIMDVec_i<int8_t, 128>() const {
+        return SIMDVec_i<int8_t, 128>(__builtin_convertvector(mVec, SIMDVec_i<int8_t, 128>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint16_t, 1>::operator SIMDVec_i<int16_t, 1>() const {
+        return SIMDVec_i<int16_t, 1>(__builtin_convertvector(mVec, SIMDVec_i<int16_t, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint16_t, 2>::operator SIMDVec_i<int16_t, 2>() const {
+        return SIMDVec_i<int16_t, 2>(__builtin_convertvector(mVec, SIMDVec_i<int16_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint16_t, 4>::operator SIMDVec_i<int16_t, 4>() const {
+        return SIMDVec_i<int16_t, 4>(__builtin_convertvector(mVec, SIMDVec_i<int16_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint16_t, 8>::operator SIMDVec_i<int16_t, 8>() const {
+        return SIMDVec_i<int16_t, 8>(__builtin_convertvector(mVec, SIMDVec_i<int16_t, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint16_t, 16>::operator SIMDVec_i<int16_t, 16>() const {
+        return SIMDVec_i<int16_t, 16>(__builtin_convertvector(mVec, SIMDVec_i<int16_t, 16>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint16_t, 32>::operator SIMDVec_i<int16_t, 32>() const {
+        return SIMDVec_i<int16_t, 32>(__builtin_convertvector(mVec, SIMDVec_i<int16_t, 32>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint16_t, 64>::operator SIMDVec_i<int16_t, 64>() const {
+        return SIMDVec_i<int16_t, 64>(__builtin_convertvector(mVec, SIMDVec_i<int16_t, 64>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint32_t, 1>::operator SIMDVec_i<int32_t, 1>() const {
+        return SIMDVec_i<int32_t, 1>(__builtin_convertvector(mVec, SIMDVec_i<int32_t, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint32_t, 2>::operator SIMDVec_i<int32_t, 2>() const {
+        return SIMDVec_i<int32_t, 2>(__builtin_convertvector(mVec, SIMDVec_i<int32_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint32_t, 4>::operator SIMDVec_i<int32_t, 4>() const {
+        return SIMDVec_i<int32_t, 4>(__builtin_convertvector(mVec, SIMDVec_i<int32_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint32_t, 8>::operator SIMDVec_i<int32_t, 8>() const {
+        return SIMDVec_i<int32_t, 8>(__builtin_convertvector(mVec, SIMDVec_i<int32_t, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint32_t, 16>::operator SIMDVec_i<int32_t, 16>() const {
+        return SIMDVec_i<int32_t, 16>(__builtin_convertvector(mVec, SIMDVec_i<int32_t, 16>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint32_t, 32>::operator SIMDVec_i<int32_t, 32>() const {
+        return SIMDVec_i<int32_t, 32>(__builtin_convertvector(mVec, SIMDVec_i<int32_t, 32>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint64_t, 1>::operator SIMDVec_i<int64_t, 1>() const {
+        return SIMDVec_i<int64_t, 1>(__builtin_convertvector(mVec, SIMDVec_i<int64_t, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint64_t, 2>::operator SIMDVec_i<int64_t, 2>() const {
+        return SIMDVec_i<int64_t, 2>(__builtin_convertvector(mVec, SIMDVec_i<int64_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint64_t, 4>::operator SIMDVec_i<int64_t, 4>() const {
+        return SIMDVec_i<int64_t, 4>(__builtin_convertvector(mVec, SIMDVec_i<int64_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint64_t, 8>::operator SIMDVec_i<int64_t, 8>() const {
+        return SIMDVec_i<int64_t, 8>(__builtin_convertvector(mVec, SIMDVec_i<int64_t, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint64_t, 16>::operator SIMDVec_i<int64_t, 16>() const {
+        return SIMDVec_i<int64_t, 16>(__builtin_convertvector(mVec, SIMDVec_i<int64_t, 16>::VEC_EXT_TYPE));
+    }
+
+    // UTOF
+    template<>
+    inline SIMDVec_u<uint32_t, 1>::operator SIMDVec_f<float, 1>() const {
+        return SIMDVec_f<float, 1>(__builtin_convertvector(mVec, SIMDVec_f<float, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint32_t, 2>::operator SIMDVec_f<float, 2>() const {
+        return SIMDVec_f<float, 2>(__builtin_convertvector(mVec, SIMDVec_f<float, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint32_t, 4>::operator SIMDVec_f<float, 4>() const {
+        return SIMDVec_f<float, 4>(__builtin_convertvector(mVec, SIMDVec_f<float, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint32_t, 8>::operator SIMDVec_f<float, 8>() const {
+        return SIMDVec_f<float, 8>(__builtin_convertvector(mVec, SIMDVec_f<float, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint32_t, 16>::operator SIMDVec_f<float, 16>() const {
+        return SIMDVec_f<float, 16>(__builtin_convertvector(mVec, SIMDVec_f<float, 16>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint32_t, 32>::operator SIMDVec_f<float, 32>() const {
+        return SIMDVec_f<float, 32>(__builtin_convertvector(mVec, SIMDVec_f<float, 32>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint64_t, 1>::operator SIMDVec_f<double, 1>() const {
+        return SIMDVec_f<double, 1>(__builtin_convertvector(mVec, SIMDVec_f<double, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint64_t, 2>::operator SIMDVec_f<double, 2>() const {
+        return SIMDVec_f<double, 2>(__builtin_convertvector(mVec, SIMDVec_f<double, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint64_t, 4>::operator SIMDVec_f<double, 4>() const {
+        return SIMDVec_f<double, 4>(__builtin_convertvector(mVec, SIMDVec_f<double, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint64_t, 8>::operator SIMDVec_f<double, 8>() const {
+        return SIMDVec_f<double, 8>(__builtin_convertvector(mVec, SIMDVec_f<double, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint64_t, 16>::operator SIMDVec_f<double, 16>() const {
+        return SIMDVec_f<double, 16>(__builtin_convertvector(mVec, SIMDVec_f<double, 16>::VEC_EXT_TYPE));
+    }
+
+    // ITOU
+    template<>
+    inline SIMDVec_i<int8_t, 1>::operator SIMDVec_u<uint8_t, 1>() const {
+        return SIMDVec_u<uint8_t, 1>(__builtin_convertvector(mVec, SIMDVec_u<uint8_t, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int8_t, 2>::operator SIMDVec_u<uint8_t, 2>() const {
+        return SIMDVec_u<uint8_t, 2>(__builtin_convertvector(mVec, SIMDVec_u<uint8_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int8_t, 4>::operator SIMDVec_u<uint8_t, 4>() const {
+        return SIMDVec_u<uint8_t, 4>(__builtin_convertvector(mVec, SIMDVec_u<uint8_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int8_t, 8>::operator SIMDVec_u<uint8_t, 8>() const {
+        return SIMDVec_u<uint8_t, 8>(__builtin_convertvector(mVec, SIMDVec_u<uint8_t, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int8_t, 16>::operator SIMDVec_u<uint8_t, 16>() const {
+        return SIMDVec_u<uint8_t, 16>(__builtin_convertvector(mVec, SIMDVec_u<uint8_t, 16>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int8_t, 32>::operator SIMDVec_u<uint8_t, 32>() const {
+        return SIMDVec_u<uint8_t, 32>(__builtin_convertvector(mVec, SIMDVec_u<uint8_t, 32>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int8_t, 64>::operator SIMDVec_u<uint8_t, 64>() const {
+        return SIMDVec_u<uint8_t, 64>(__builtin_convertvector(mVec, SIMDVec_u<uint8_t, 64>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int8_t, 128>::operator SIMDVec_u<uint8_t, 128>() const {
+        return SIMDVec_u<uint8_t, 128>(__builtin_convertvector(mVec, SIMDVec_u<uint8_t, 128>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int16_t, 1>::operator SIMDVec_u<uint16_t, 1>() const {
+        return SIMDVec_u<uint16_t, 1>(__builtin_convertvector(mVec, SIMDVec_u<uint16_t, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int16_t, 2>::operator SIMDVec_u<uint16_t, 2>() const {
+        return SIMDVec_u<uint16_t, 2>(__builtin_convertvector(mVec, SIMDVec_u<uint16_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int16_t, 4>::operator SIMDVec_u<uint16_t, 4>() const {
+        return SIMDVec_u<uint16_t, 4>(__builtin_convertvector(mVec, SIMDVec_u<uint16_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int16_t, 8>::operator SIMDVec_u<uint16_t, 8>() const {
+        return SIMDVec_u<uint16_t, 8>(__builtin_convertvector(mVec, SIMDVec_u<uint16_t, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int16_t, 16>::operator SIMDVec_u<uint16_t, 16>() const {
+        return SIMDVec_u<uint16_t, 16>(__builtin_convertvector(mVec, SIMDVec_u<uint16_t, 16>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int16_t, 32>::operator SIMDVec_u<uint16_t, 32>() const {
+        return SIMDVec_u<uint16_t, 32>(__builtin_convertvector(mVec, SIMDVec_u<uint16_t, 32>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int16_t, 64>::operator SIMDVec_u<uint16_t, 64>() const {
+        return SIMDVec_u<uint16_t, 64>(__builtin_convertvector(mVec, SIMDVec_u<uint16_t, 64>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int32_t, 1>::operator SIMDVec_u<uint32_t, 1>() const {
+        return SIMDVec_u<uint32_t, 1>(__builtin_convertvector(mVec, SIMDVec_u<uint32_t, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int32_t, 2>::operator SIMDVec_u<uint32_t, 2>() const {
+        return SIMDVec_u<uint32_t, 2>(__builtin_convertvector(mVec, SIMDVec_u<uint32_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int32_t, 4>::operator SIMDVec_u<uint32_t, 4>() const {
+        return SIMDVec_u<uint32_t, 4>(__builtin_convertvector(mVec, SIMDVec_u<uint32_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int32_t, 8>::operator SIMDVec_u<uint32_t, 8>() const {
+        return SIMDVec_u<uint32_t, 8>(__builtin_convertvector(mVec, SIMDVec_u<uint32_t, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int32_t, 16>::operator SIMDVec_u<uint32_t, 16>() const {
+        return SIMDVec_u<uint32_t, 16>(__builtin_convertvector(mVec, SIMDVec_u<uint32_t, 16>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int32_t, 32>::operator SIMDVec_u<uint32_t, 32>() const {
+        return SIMDVec_u<uint32_t, 32>(__builtin_convertvector(mVec, SIMDVec_u<uint32_t, 32>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int64_t, 1>::operator SIMDVec_u<uint64_t, 1>() const {
+        return SIMDVec_u<uint64_t, 1>(__builtin_convertvector(mVec, SIMDVec_u<uint64_t, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int64_t, 2>::operator SIMDVec_u<uint64_t, 2>() const {
+        return SIMDVec_u<uint64_t, 2>(__builtin_convertvector(mVec, SIMDVec_u<uint64_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int64_t, 4>::operator SIMDVec_u<uint64_t, 4>() const {
+        return SIMDVec_u<uint64_t, 4>(__builtin_convertvector(mVec, SIMDVec_u<uint64_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int64_t, 8>::operator SIMDVec_u<uint64_t, 8>() const {
+        return SIMDVec_u<uint64_t, 8>(__builtin_convertvector(mVec, SIMDVec_u<uint64_t, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int64_t, 16>::operator SIMDVec_u<uint64_t, 16>() const {
+        return SIMDVec_u<uint64_t, 16>(__builtin_convertvector(mVec, SIMDVec_u<uint64_t, 16>::VEC_EXT_TYPE));
+    }
+
+    // ITOF
+    template<>
+    inline SIMDVec_i<int32_t, 1>::operator SIMDVec_f<float, 1>() const {
+        return SIMDVec_f<float, 1>(__builtin_convertvector(mVec, SIMDVec_f<float, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int32_t, 2>::operator SIMDVec_f<float, 2>() const {
+        return SIMDVec_f<float, 2>(__builtin_convertvector(mVec, SIMDVec_f<float, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int32_t, 4>::operator SIMDVec_f<float, 4>() const {
+        return SIMDVec_f<float, 4>(__builtin_convertvector(mVec, SIMDVec_f<float, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int32_t, 8>::operator SIMDVec_f<float, 8>() const {
+        return SIMDVec_f<float, 8>(__builtin_convertvector(mVec, SIMDVec_f<float, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int32_t, 16>::operator SIMDVec_f<float, 16>() const {
+        return SIMDVec_f<float, 16>(__builtin_convertvector(mVec, SIMDVec_f<float, 16>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int32_t, 32>::operator SIMDVec_f<float, 32>() const {
+        return SIMDVec_f<float, 32>(__builtin_convertvector(mVec, SIMDVec_f<float, 32>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int64_t, 1>::operator SIMDVec_f<double, 1>() const {
+        return SIMDVec_f<double, 1>(__builtin_convertvector(mVec, SIMDVec_f<double, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int64_t, 2>::operator SIMDVec_f<double, 2>() const {
+        return SIMDVec_f<double, 2>(__builtin_convertvector(mVec, SIMDVec_f<double, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int64_t, 4>::operator SIMDVec_f<double, 4>() const {
+        return SIMDVec_f<double, 4>(__builtin_convertvector(mVec, SIMDVec_f<double, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int64_t, 8>::operator SIMDVec_f<double, 8>() const {
+        return SIMDVec_f<double, 8>(__builtin_convertvector(mVec, SIMDVec_f<double, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int64_t, 16>::operator SIMDVec_f<double, 16>() const {
+        return SIMDVec_f<double, 16>(__builtin_convertvector(mVec, SIMDVec_f<double, 16>::VEC_EXT_TYPE));
+    }
+
+    // FTOU
+    template<>
+    inline SIMDVec_f<float, 1>::operator SIMDVec_u<uint32_t, 1>() const {
+        return SIMDVec_u<uint32_t, 1>(__builtin_convertvector(mVec, SIMDVec_u<uint32_t, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<float, 2>::operator SIMDVec_u<uint32_t, 2>() const {
+        return SIMDVec_u<uint32_t, 2>(__builtin_convertvector(mVec, SIMDVec_u<uint32_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<float, 4>::operator SIMDVec_u<uint32_t, 4>() const {
+        return SIMDVec_u<uint32_t, 4>(__builtin_convertvector(mVec, SIMDVec_u<uint32_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<float, 8>::operator SIMDVec_u<uint32_t, 8>() const {
+        return SIMDVec_u<uint32_t, 8>(__builtin_convertvector(mVec, SIMDVec_u<uint32_t, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<float, 16>::operator SIMDVec_u<uint32_t, 16>() const {
+        return SIMDVec_u<uint32_t, 16>(__builtin_convertvector(mVec, SIMDVec_u<uint32_t, 16>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<float, 32>::operator SIMDVec_u<uint32_t, 32>() const {
+        return SIMDVec_u<uint32_t, 32>(__builtin_convertvector(mVec, SIMDVec_u<uint32_t, 32>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<double, 1>::operator SIMDVec_u<uint64_t, 1>() const {
+        return SIMDVec_u<uint64_t, 1>(__builtin_convertvector(mVec, SIMDVec_u<uint64_t, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<double, 2>::operator SIMDVec_u<uint64_t, 2>() const {
+        return SIMDVec_u<uint64_t, 2>(__builtin_convertvector(mVec, SIMDVec_u<uint64_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<double, 4>::operator SIMDVec_u<uint64_t, 4>() const {
+        return SIMDVec_u<uint64_t, 4>(__builtin_convertvector(mVec, SIMDVec_u<uint64_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<double, 8>::operator SIMDVec_u<uint64_t, 8>() const {
+        return SIMDVec_u<uint64_t, 8>(__builtin_convertvector(mVec, SIMDVec_u<uint64_t, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<double, 16>::operator SIMDVec_u<uint64_t, 16>() const {
+        return SIMDVec_u<uint64_t, 16>(__builtin_convertvector(mVec, SIMDVec_u<uint64_t, 16>::VEC_EXT_TYPE));
+    }
+
+    // FTOI
+    template<>
+    inline SIMDVec_f<float, 1>::operator SIMDVec_i<int32_t, 1>() const {
+        return SIMDVec_i<int32_t, 1>(__builtin_convertvector(mVec, SIMDVec_i<int32_t, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<float, 2>::operator SIMDVec_i<int32_t, 2>() const {
+        return SIMDVec_i<int32_t, 2>(__builtin_convertvector(mVec, SIMDVec_i<int32_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<float, 4>::operator SIMDVec_i<int32_t, 4>() const {
+        return SIMDVec_i<int32_t, 4>(__builtin_convertvector(mVec, SIMDVec_i<int32_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<float, 8>::operator SIMDVec_i<int32_t, 8>() const {
+        return SIMDVec_i<int32_t, 8>(__builtin_convertvector(mVec, SIMDVec_i<int32_t, 8>::VEC_EXT_TYPE));
+    /*
+        SIMDVec_i<int32_t, 8> retval;
+        int32_t * local_retval_ptr = &retval.mVec[0];
+        float const * local_ptr = &mVec[0];
+
+        #pragma omp simd aligned(local_ptr:32, local_retval_ptr:32) simdlen(8) safelen(8)
+        for(int i = 0; i < 8; i++) {
+            local_retval_ptr[i] = int32_t(local_ptr[i]);
+        }
+        return retval;*/
+    }
+
+    template<>
+    inline SIMDVec_f<float, 16>::operator SIMDVec_i<int32_t, 16>() const {
+        return SIMDVec_i<int32_t, 16>(__builtin_convertvector(mVec, SIMDVec_i<int32_t, 16>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<float, 32>::operator SIMDVec_i<int32_t, 32>() const {
+        return SIMDVec_i<int32_t, 32>(__builtin_convertvector(mVec, SIMDVec_i<int32_t, 32>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<double, 1>::operator SIMDVec_i<int64_t, 1>() const {
+        return SIMDVec_i<int64_t, 1>(__builtin_convertvector(mVec, SIMDVec_i<int64_t, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<double, 2>::operator SIMDVec_i<int64_t, 2>() const {
+        return SIMDVec_i<int64_t, 2>(__builtin_convertvector(mVec, SIMDVec_i<int64_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<double, 4>::operator SIMDVec_i<int64_t, 4>() const {
+        return SIMDVec_i<int64_t, 4>(__builtin_convertvector(mVec, SIMDVec_i<int64_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<double, 8>::operator SIMDVec_i<int64_t, 8>() const {
+        return SIMDVec_i<int64_t, 8>(__builtin_convertvector(mVec, SIMDVec_i<int64_t, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<double, 16>::operator SIMDVec_i<int64_t, 16>() const {
+        return SIMDVec_i<int64_t, 16>(__builtin_convertvector(mVec, SIMDVec_i<int64_t, 16>::VEC_EXT_TYPE));
+    }
+
+    // PROMOTE
+    template<>
+    inline SIMDVec_u<uint8_t, 1>::operator SIMDVec_u<uint16_t, 1>() const {
+        return SIMDVec_u<uint16_t, 1>(__builtin_convertvector(mVec, SIMDVec_u<uint16_t, 1>::VEC_EXT_TYPE));
+    }
+    
+    template<>
+    inline SIMDVec_u<uint8_t, 2>::operator SIMDVec_u<uint16_t, 2>() const {
+        return SIMDVec_u<uint16_t, 2>(__builtin_convertvector(mVec, SIMDVec_u<uint16_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint8_t, 4>::operator SIMDVec_u<uint16_t, 4>() const {
+        return SIMDVec_u<uint16_t, 4>(__builtin_convertvector(mVec, SIMDVec_u<uint16_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint8_t, 8>::operator SIMDVec_u<uint16_t, 8>() const {
+        return SIMDVec_u<uint16_t, 8>(__builtin_convertvector(mVec, SIMDVec_u<uint16_t, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint8_t, 16>::operator SIMDVec_u<uint16_t, 16>() const {
+        return SIMDVec_u<uint16_t, 16>(__builtin_convertvector(mVec, SIMDVec_u<uint16_t, 16>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint8_t, 32>::operator SIMDVec_u<uint16_t, 32>() const {
+        return SIMDVec_u<uint16_t, 32>(__builtin_convertvector(mVec, SIMDVec_u<uint16_t, 32>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint8_t, 64>::operator SIMDVec_u<uint16_t, 64>() const {
+        return SIMDVec_u<uint16_t, 64>(__builtin_convertvector(mVec, SIMDVec_u<uint16_t, 64>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint16_t, 1>::operator SIMDVec_u<uint32_t, 1>() const {
+        return SIMDVec_u<uint32_t, 1>(__builtin_convertvector(mVec, SIMDVec_u<uint32_t, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint16_t, 2>::operator SIMDVec_u<uint32_t, 2>() const {
+        return SIMDVec_u<uint32_t, 2>(__builtin_convertvector(mVec, SIMDVec_u<uint32_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint16_t, 4>::operator SIMDVec_u<uint32_t, 4>() const {
+        return SIMDVec_u<uint32_t, 4>(__builtin_convertvector(mVec, SIMDVec_u<uint32_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint16_t, 8>::operator SIMDVec_u<uint32_t, 8>() const {
+        return SIMDVec_u<uint32_t, 8>(__builtin_convertvector(mVec, SIMDVec_u<uint32_t, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint16_t, 16>::operator SIMDVec_u<uint32_t, 16>() const {
+        return SIMDVec_u<uint32_t, 16>(__builtin_convertvector(mVec, SIMDVec_u<uint32_t, 16>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint16_t, 32>::operator SIMDVec_u<uint32_t, 32>() const {
+        return SIMDVec_u<uint32_t, 32>(__builtin_convertvector(mVec, SIMDVec_u<uint32_t, 32>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint32_t, 1>::operator SIMDVec_u<uint64_t, 1>() const {
+        return SIMDVec_u<uint64_t, 1>(__builtin_convertvector(mVec, SIMDVec_u<uint64_t, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint32_t, 2>::operator SIMDVec_u<uint64_t, 2>() const {
+        return SIMDVec_u<uint64_t, 2>(__builtin_convertvector(mVec, SIMDVec_u<uint64_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint32_t, 4>::operator SIMDVec_u<uint64_t, 4>() const {
+        return SIMDVec_u<uint64_t, 4>(__builtin_convertvector(mVec, SIMDVec_u<uint64_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint32_t, 8>::operator SIMDVec_u<uint64_t, 8>() const {
+        return SIMDVec_u<uint64_t, 8>(__builtin_convertvector(mVec, SIMDVec_u<uint64_t, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint32_t, 16>::operator SIMDVec_u<uint64_t, 16>() const {
+        return SIMDVec_u<uint64_t, 16>(__builtin_convertvector(mVec, SIMDVec_u<uint64_t, 16>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int8_t, 1>::operator SIMDVec_i<int16_t, 1>() const {
+        return SIMDVec_i<int16_t, 1>(__builtin_convertvector(mVec, SIMDVec_i<int16_t, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int8_t, 2>::operator SIMDVec_i<int16_t, 2>() const {
+        return SIMDVec_i<int16_t, 2>(__builtin_convertvector(mVec, SIMDVec_i<int16_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int8_t, 4>::operator SIMDVec_i<int16_t, 4>() const {
+        return SIMDVec_i<int16_t, 4>(__builtin_convertvector(mVec, SIMDVec_i<int16_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int8_t, 8>::operator SIMDVec_i<int16_t, 8>() const {
+        return SIMDVec_i<int16_t, 8>(__builtin_convertvector(mVec, SIMDVec_i<int16_t, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int8_t, 16>::operator SIMDVec_i<int16_t, 16>() const {
+        return SIMDVec_i<int16_t, 16>(__builtin_convertvector(mVec, SIMDVec_i<int16_t, 16>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int8_t, 32>::operator SIMDVec_i<int16_t, 32>() const {
+        return SIMDVec_i<int16_t, 32>(__builtin_convertvector(mVec, SIMDVec_i<int16_t, 32>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int8_t, 64>::operator SIMDVec_i<int16_t, 64>() const {
+        return SIMDVec_i<int16_t, 64>(__builtin_convertvector(mVec, SIMDVec_i<int16_t, 64>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int16_t, 1>::operator SIMDVec_i<int32_t, 1>() const {
+        return SIMDVec_i<int32_t, 1>(__builtin_convertvector(mVec, SIMDVec_i<int32_t, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int16_t, 2>::operator SIMDVec_i<int32_t, 2>() const {
+        return SIMDVec_i<int32_t, 2>(__builtin_convertvector(mVec, SIMDVec_i<int32_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int16_t, 4>::operator SIMDVec_i<int32_t, 4>() const {
+        return SIMDVec_i<int32_t, 4>(__builtin_convertvector(mVec, SIMDVec_i<int32_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int16_t, 8>::operator SIMDVec_i<int32_t, 8>() const {
+        return SIMDVec_i<int32_t, 8>(__builtin_convertvector(mVec, SIMDVec_i<int32_t, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int16_t, 16>::operator SIMDVec_i<int32_t, 16>() const {
+        return SIMDVec_i<int32_t, 16>(__builtin_convertvector(mVec, SIMDVec_i<int32_t, 16>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int16_t, 32>::operator SIMDVec_i<int32_t, 32>() const {
+        return SIMDVec_i<int32_t, 32>(__builtin_convertvector(mVec, SIMDVec_i<int32_t, 32>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int32_t, 1>::operator SIMDVec_i<int64_t, 1>() const {
+        return SIMDVec_i<int64_t, 1>(__builtin_convertvector(mVec, SIMDVec_i<int64_t, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int32_t, 2>::operator SIMDVec_i<int64_t, 2>() const {
+        return SIMDVec_i<int64_t, 2>(__builtin_convertvector(mVec, SIMDVec_i<int64_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int32_t, 4>::operator SIMDVec_i<int64_t, 4>() const {
+        return SIMDVec_i<int64_t, 4>(__builtin_convertvector(mVec, SIMDVec_i<int64_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int32_t, 8>::operator SIMDVec_i<int64_t, 8>() const {
+        return SIMDVec_i<int64_t, 8>(__builtin_convertvector(mVec, SIMDVec_i<int64_t, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int32_t, 16>::operator SIMDVec_i<int64_t, 16>() const {
+        return SIMDVec_i<int64_t, 16>(__builtin_convertvector(mVec, SIMDVec_i<int64_t, 16>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<float, 1>::operator SIMDVec_f<double, 1>() const {
+        return SIMDVec_f<double, 1>(__builtin_convertvector(mVec, SIMDVec_f<double, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<float, 2>::operator SIMDVec_f<double, 2>() const {
+        return SIMDVec_f<double, 2>(__builtin_convertvector(mVec, SIMDVec_f<double, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<float, 4>::operator SIMDVec_f<double, 4>() const {
+        return SIMDVec_f<double, 4>(__builtin_convertvector(mVec, SIMDVec_f<double, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<float, 8>::operator SIMDVec_f<double, 8>() const {
+        return SIMDVec_f<double, 8>(__builtin_convertvector(mVec, SIMDVec_f<double, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<float, 16>::operator SIMDVec_f<double, 16>() const {
+        return SIMDVec_f<double, 16>(__builtin_convertvector(mVec, SIMDVec_f<double, 16>::VEC_EXT_TYPE));
+    }
+
+    // DEGRADE
+    template<>
+    inline SIMDVec_u<uint16_t, 1>::operator SIMDVec_u<uint8_t, 1>() const {
+        return SIMDVec_u<uint8_t, 1>(__builtin_convertvector(mVec, SIMDVec_u<uint8_t, 1>::VEC_EXT_TYPE));
+    }
+    template<>
+    inline SIMDVec_u<uint16_t, 2>::operator SIMDVec_u<uint8_t, 2>() const {
+        return SIMDVec_u<uint8_t, 2>(__builtin_convertvector(mVec, SIMDVec_u<uint8_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint16_t, 4>::operator SIMDVec_u<uint8_t, 4>() const {
+        return SIMDVec_u<uint8_t, 4>(__builtin_convertvector(mVec, SIMDVec_u<uint8_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint16_t, 8>::operator SIMDVec_u<uint8_t, 8>() const {
+        return SIMDVec_u<uint8_t, 8>(__builtin_convertvector(mVec, SIMDVec_u<uint8_t, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint16_t, 16>::operator SIMDVec_u<uint8_t, 16>() const {
+        return SIMDVec_u<uint8_t, 16>(__builtin_convertvector(mVec, SIMDVec_u<uint8_t, 16>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint16_t, 32>::operator SIMDVec_u<uint8_t, 32>() const {
+        return SIMDVec_u<uint8_t, 32>(__builtin_convertvector(mVec, SIMDVec_u<uint8_t, 32>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint16_t, 64>::operator SIMDVec_u<uint8_t, 64>() const {
+        return SIMDVec_u<uint8_t, 64>(__builtin_convertvector(mVec, SIMDVec_u<uint8_t, 64>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint32_t, 1>::operator SIMDVec_u<uint16_t, 1>() const {
+        return SIMDVec_u<uint16_t, 1>(__builtin_convertvector(mVec, SIMDVec_u<uint16_t, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint32_t, 2>::operator SIMDVec_u<uint16_t, 2>() const {
+        return SIMDVec_u<uint16_t, 2>(__builtin_convertvector(mVec, SIMDVec_u<uint16_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint32_t, 4>::operator SIMDVec_u<uint16_t, 4>() const {
+        return SIMDVec_u<uint16_t, 4>(__builtin_convertvector(mVec, SIMDVec_u<uint16_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint32_t, 8>::operator SIMDVec_u<uint16_t, 8>() const {
+        return SIMDVec_u<uint16_t, 8>(__builtin_convertvector(mVec, SIMDVec_u<uint16_t, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint32_t, 16>::operator SIMDVec_u<uint16_t, 16>() const {
+        return SIMDVec_u<uint16_t, 16>(__builtin_convertvector(mVec, SIMDVec_u<uint16_t, 16>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint32_t, 32>::operator SIMDVec_u<uint16_t, 32>() const {
+        return SIMDVec_u<uint16_t, 32>(__builtin_convertvector(mVec, SIMDVec_u<uint16_t, 32>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint64_t, 1>::operator SIMDVec_u<uint32_t, 1>() const {
+        return SIMDVec_u<uint32_t, 1>(__builtin_convertvector(mVec, SIMDVec_u<uint32_t, 1>::VEC_EXT_TYPE));
+    }
+    template<>
+    inline SIMDVec_u<uint64_t, 2>::operator SIMDVec_u<uint32_t, 2>() const {
+        return SIMDVec_u<uint32_t, 2>(__builtin_convertvector(mVec, SIMDVec_u<uint32_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint64_t, 4>::operator SIMDVec_u<uint32_t, 4>() const {
+        return SIMDVec_u<uint32_t, 4>(__builtin_convertvector(mVec, SIMDVec_u<uint32_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint64_t, 8>::operator SIMDVec_u<uint32_t, 8>() const {
+        return SIMDVec_u<uint32_t, 8>(__builtin_convertvector(mVec, SIMDVec_u<uint32_t, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_u<uint64_t, 16>::operator SIMDVec_u<uint32_t, 16>() const {
+        return SIMDVec_u<uint32_t, 16>(__builtin_convertvector(mVec, SIMDVec_u<uint32_t, 16>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int16_t, 1>::operator SIMDVec_i<int8_t, 1>() const {
+        return SIMDVec_i<int8_t, 1>(__builtin_convertvector(mVec, SIMDVec_i<int8_t, 1>::VEC_EXT_TYPE));
+    }
+    template<>
+    inline SIMDVec_i<int16_t, 2>::operator SIMDVec_i<int8_t, 2>() const {
+        return SIMDVec_i<int8_t, 2>(__builtin_convertvector(mVec, SIMDVec_i<int8_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int16_t, 4>::operator SIMDVec_i<int8_t, 4>() const {
+        return SIMDVec_i<int8_t, 4>(__builtin_convertvector(mVec, SIMDVec_i<int8_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int16_t, 8>::operator SIMDVec_i<int8_t, 8>() const {
+        return SIMDVec_i<int8_t, 8>(__builtin_convertvector(mVec, SIMDVec_i<int8_t, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int16_t, 16>::operator SIMDVec_i<int8_t, 16>() const {
+        return SIMDVec_i<int8_t, 16>(__builtin_convertvector(mVec, SIMDVec_i<int8_t, 16>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int16_t, 32>::operator SIMDVec_i<int8_t, 32>() const {
+        return SIMDVec_i<int8_t, 32>(__builtin_convertvector(mVec, SIMDVec_i<int8_t, 32>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int16_t, 64>::operator SIMDVec_i<int8_t, 64>() const {
+        return SIMDVec_i<int8_t, 64>(__builtin_convertvector(mVec, SIMDVec_i<int8_t, 64>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int32_t, 1>::operator SIMDVec_i<int16_t, 1>() const {
+        return SIMDVec_i<int16_t, 1>(__builtin_convertvector(mVec, SIMDVec_i<int16_t, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int32_t, 2>::operator SIMDVec_i<int16_t, 2>() const {
+        return SIMDVec_i<int16_t, 2>(__builtin_convertvector(mVec, SIMDVec_i<int16_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int32_t, 4>::operator SIMDVec_i<int16_t, 4>() const {
+        return SIMDVec_i<int16_t, 4>(__builtin_convertvector(mVec, SIMDVec_i<int16_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int32_t, 8>::operator SIMDVec_i<int16_t, 8>() const {
+        return SIMDVec_i<int16_t, 8>(__builtin_convertvector(mVec, SIMDVec_i<int16_t, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int32_t, 16>::operator SIMDVec_i<int16_t, 16>() const {
+        return SIMDVec_i<int16_t, 16>(__builtin_convertvector(mVec, SIMDVec_i<int16_t, 16>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int32_t, 32>::operator SIMDVec_i<int16_t, 32>() const {
+        return SIMDVec_i<int16_t, 32>(__builtin_convertvector(mVec, SIMDVec_i<int16_t, 32>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int64_t, 1>::operator SIMDVec_i<int32_t, 1>() const {
+        return SIMDVec_i<int32_t, 1>(__builtin_convertvector(mVec, SIMDVec_i<int32_t, 1>::VEC_EXT_TYPE));
+    }
+    template<>
+    inline SIMDVec_i<int64_t, 2>::operator SIMDVec_i<int32_t, 2>() const {
+        return SIMDVec_i<int32_t, 2>(__builtin_convertvector(mVec, SIMDVec_i<int32_t, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int64_t, 4>::operator SIMDVec_i<int32_t, 4>() const {
+        return SIMDVec_i<int32_t, 4>(__builtin_convertvector(mVec, SIMDVec_i<int32_t, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int64_t, 8>::operator SIMDVec_i<int32_t, 8>() const {
+        return SIMDVec_i<int32_t, 8>(__builtin_convertvector(mVec, SIMDVec_i<int32_t, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_i<int64_t, 16>::operator SIMDVec_i<int32_t, 16>() const {
+        return SIMDVec_i<int32_t, 16>(__builtin_convertvector(mVec, SIMDVec_i<int32_t, 16>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<double, 1>::operator SIMDVec_f<float, 1>() const {
+        return SIMDVec_f<float, 1>(__builtin_convertvector(mVec, SIMDVec_f<float, 1>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<double, 2>::operator SIMDVec_f<float, 2>() const {
+        return SIMDVec_f<float, 2>(__builtin_convertvector(mVec, SIMDVec_f<float, 2>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<double, 4>::operator SIMDVec_f<float, 4>() const {
+        return SIMDVec_f<float, 4>(__builtin_convertvector(mVec, SIMDVec_f<float, 4>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<double, 8>::operator SIMDVec_f<float, 8>() const {
+        return SIMDVec_f<float, 8>(__builtin_convertvector(mVec, SIMDVec_f<float, 8>::VEC_EXT_TYPE));
+    }
+
+    template<>
+    inline SIMDVec_f<double, 16>::operator SIMDVec_f<float, 16>() const {
+        return SIMDVec_f<float, 16>(__builtin_convertvector(mVec, SIMDVec_f<float, 16>::VEC_EXT_TYPE));
+    }
+}
+}
+
+#endif
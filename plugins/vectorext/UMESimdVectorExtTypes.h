@@ -0,0 +1,209 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VECTOR_EXT_TYPES_H_
+#define UME_SIMD_VECTOR_EXT_TYPES_H_
+
+#include <type_traits>
+#include "../../UMESimdInterface.h"
+
+// Helpers shared by all types of the vector extension plugin. The plugin keeps
+// vector registers in GCC/Clang generic vectors ('vector_size' attribute) so that
+// element-wise operations are lowered by the compiler directly to the SIMD
+// instructions of the current target. Shuffles require '__builtin_shufflevector'
+// (Clang, GCC 12 and newer).
+
+namespace UME {
+namespace SIMD {
+
+    // Generic vector holding VEC_LEN elements of SCALAR_TYPE.
+    template<typename SCALAR_TYPE, uint32_t VEC_LEN>
+    struct VecExtType {
+        typedef SCALAR_TYPE type __attribute__((vector_size(VEC_LEN*sizeof(SCALAR_TYPE))));
+    };
+
+    // Compile-time sequence of lane indices used to build shuffles.
+    template<int... INDICES>
+    struct VecExtIndices {};
+
+    // VecExtRange<BEGIN, COUNT>::type is VecExtIndices<BEGIN, BEGIN + 1, ..., BEGIN + COUNT - 1>
+    template<int BEGIN, int COUNT, int... INDICES>
+    struct VecExtRange : VecExtRange<BEGIN, COUNT - 1, BEGIN + COUNT - 1, INDICES...> {};
+
+    template<int BEGIN, int... INDICES>
+    struct VecExtRange<BEGIN, 0, INDICES...> {
+        typedef VecExtIndices<INDICES...> type;
+    };
+
+    // Select lanes of concatenated {a, b} vector. The number of indices
+    // determines the length of the result.
+    template<typename RESULT_TYPE, typename VEC_EXT_TYPE, int... INDICES>
+    UME_FORCE_INLINE RESULT_TYPE vecExtShuffle(VEC_EXT_TYPE const & a, VEC_EXT_TYPE const & b, VecExtIndices<INDICES...>) {
+        return __builtin_shufflevector(a, b, INDICES...);
+    }
+
+    // Vector of consecutive lane indices: {0, 1, ..., VEC_LEN - 1}.
+    template<typename VEC_EXT_TYPE, int... INDICES>
+    UME_FORCE_INLINE VEC_EXT_TYPE vecExtIota(VecExtIndices<INDICES...>) {
+        return VEC_EXT_TYPE{INDICES...};
+    }
+
+    // Element-wise operations used by the horizontal reductions.
+    struct VecExtAdd {
+        template<typename T> UME_FORCE_INLINE T operator() (T const & a, T const & b) const { return a + b; }
+    };
+    struct VecExtMul {
+        template<typename T> UME_FORCE_INLINE T operator() (T const & a, T const & b) const { return a * b; }
+    };
+    struct VecExtMax {
+        template<typename T> UME_FORCE_INLINE T operator() (T const & a, T const & b) const { return a > b ? a : b; }
+    };
+    struct VecExtMin {
+        template<typename T> UME_FORCE_INLINE T operator() (T const & a, T const & b) const { return a < b ? a : b; }
+    };
+    struct VecExtAnd {
+        template<typename T> UME_FORCE_INLINE T operator() (T const & a, T const & b) const { return a & b; }
+    };
+    struct VecExtOr {
+        template<typename T> UME_FORCE_INLINE T operator() (T const & a, T const & b) const { return a | b; }
+    };
+    struct VecExtXor {
+        template<typename T> UME_FORCE_INLINE T operator() (T const & a, T const & b) const { return a ^ b; }
+    };
+
+    // Horizontal reduction: the vector is folded in halves, so that the
+    // reduction of N elements takes log2(N) vector operations.
+    template<typename SCALAR_TYPE, uint32_t VEC_LEN>
+    struct VecExtReduce {
+        typedef typename VecExtType<SCALAR_TYPE, VEC_LEN>::type     VEC_EXT_TYPE;
+        typedef typename VecExtType<SCALAR_TYPE, VEC_LEN/2>::type   HALF_EXT_TYPE;
+
+        template<typename OP>
+        static UME_FORCE_INLINE SCALAR_TYPE apply(VEC_EXT_TYPE const & a) {
+            HALF_EXT_TYPE lo = vecExtShuffle<HALF_EXT_TYPE>(a, a, typename VecExtRange<0, VEC_LEN/2>::type());
+            HALF_EXT_TYPE hi = vecExtShuffle<HALF_EXT_TYPE>(a, a, typename VecExtRange<VEC_LEN/2, VEC_LEN/2>::type());
+            return VecExtReduce<SCALAR_TYPE, VEC_LEN/2>::template apply<OP>(OP()(lo, hi));
+        }
+    };
+
+    template<typename SCALAR_TYPE>
+    struct VecExtReduce<SCALAR_TYPE, 1> {
+        typedef typename VecExtType<SCALAR_TYPE, 1>::type VEC_EXT_TYPE;
+
+        template<typename OP>
+        static UME_FORCE_INLINE SCALAR_TYPE apply(VEC_EXT_TYPE const & a) {
+            return a[0];
+        }
+    };
+
+    // Selects single or double precision kernels of VECTOR_EMULATION.
+    template<typename SCALAR_FLOAT_TYPE>
+    struct VecExtMath {};
+
+    template<>
+    struct VecExtMath<float> {
+        template<typename VEC_T, typename UINT_VEC_T>
+        static UME_FORCE_INLINE VEC_T exp(VEC_T const & x) { return VECTOR_EMULATION::expf<VEC_T, UINT_VEC_T>(x); }
+        template<typename VEC_T, typename UINT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE VEC_T exp(MASK_T const & mask, VEC_T const & x) { return VECTOR_EMULATION::expf<VEC_T, UINT_VEC_T, MASK_T>(mask, x); }
+        template<typename VEC_T, typename UINT_VEC_T>
+        static UME_FORCE_INLINE VEC_T log(VEC_T const & x) { return VECTOR_EMULATION::logf<VEC_T, UINT_VEC_T>(x); }
+        template<typename VEC_T, typename UINT_VEC_T>
+        static UME_FORCE_INLINE VEC_T log2(VEC_T const & x) { return VECTOR_EMULATION::log2f<VEC_T, UINT_VEC_T>(x); }
+        template<typename VEC_T, typename UINT_VEC_T>
+        static UME_FORCE_INLINE VEC_T log10(VEC_T const & x) { return VECTOR_EMULATION::log10f<VEC_T, UINT_VEC_T>(x); }
+        template<typename VEC_T, typename UINT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE VEC_T pow(VEC_T const & x, VEC_T const & y) { return VECTOR_EMULATION::powf<VEC_T, UINT_VEC_T, MASK_T>(x, y); }
+        template<typename VEC_T, typename UINT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE VEC_T pow(MASK_T const & mask, VEC_T const & x, VEC_T const & y) { return VECTOR_EMULATION::powf<VEC_T, UINT_VEC_T, MASK_T>(mask, x, y); }
+        template<typename VEC_T, typename INT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE VEC_T sin(VEC_T const & x) { return VECTOR_EMULATION::sinf<VEC_T, INT_VEC_T, MASK_T>(x); }
+        template<typename VEC_T, typename INT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE VEC_T sin(MASK_T const & mask, VEC_T const & x) { return VECTOR_EMULATION::sinf<VEC_T, INT_VEC_T, MASK_T>(mask, x); }
+        template<typename VEC_T, typename INT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE VEC_T cos(VEC_T const & x) { return VECTOR_EMULATION::cosf<VEC_T, INT_VEC_T, MASK_T>(x); }
+        template<typename VEC_T, typename INT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE VEC_T cos(MASK_T const & mask, VEC_T const & x) { return VECTOR_EMULATION::cosf<VEC_T, INT_VEC_T, MASK_T>(mask, x); }
+        template<typename VEC_T, typename INT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE void sincos(VEC_T const & x, VEC_T & s, VEC_T & c) { VECTOR_EMULATION::sincosf<VEC_T, INT_VEC_T, MASK_T>(x, s, c); }
+        template<typename VEC_T, typename INT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE void sincos(MASK_T const & mask, VEC_T const & x, VEC_T & s, VEC_T & c) { VECTOR_EMULATION::sincosf<VEC_T, INT_VEC_T, MASK_T>(mask, x, s, c); }
+        template<typename VEC_T, typename INT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE VEC_T tan(VEC_T const & x) { return VECTOR_EMULATION::tanf<VEC_T, INT_VEC_T, MASK_T>(x); }
+        template<typename VEC_T, typename INT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE VEC_T tan(MASK_T const & mask, VEC_T const & x) { return VECTOR_EMULATION::tanf<VEC_T, INT_VEC_T, MASK_T>(mask, x); }
+        template<typename VEC_T, typename INT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE VEC_T ctan(VEC_T const & x) { return VECTOR_EMULATION::ctanf<VEC_T, INT_VEC_T, MASK_T>(x); }
+        template<typename VEC_T, typename INT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE VEC_T ctan(MASK_T const & mask, VEC_T const & x) { return VECTOR_EMULATION::ctanf<VEC_T, INT_VEC_T, MASK_T>(mask, x); }
+    };
+
+    template<>
+    struct VecExtMath<double> {
+        template<typename VEC_T, typename UINT_VEC_T>
+        static UME_FORCE_INLINE VEC_T exp(VEC_T const & x) { return VECTOR_EMULATION::expd<VEC_T, UINT_VEC_T>(x); }
+        template<typename VEC_T, typename UINT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE VEC_T exp(MASK_T const & mask, VEC_T const & x) { return VECTOR_EMULATION::expd<VEC_T, UINT_VEC_T, MASK_T>(mask, x); }
+        template<typename VEC_T, typename UINT_VEC_T>
+        static UME_FORCE_INLINE VEC_T log(VEC_T const & x) { return VECTOR_EMULATION::logd<VEC_T, UINT_VEC_T>(x); }
+        template<typename VEC_T, typename UINT_VEC_T>
+        static UME_FORCE_INLINE VEC_T log2(VEC_T const & x) { return VECTOR_EMULATION::log2d<VEC_T, UINT_VEC_T>(x); }
+        template<typename VEC_T, typename UINT_VEC_T>
+        static UME_FORCE_INLINE VEC_T log10(VEC_T const & x) { return VECTOR_EMULATION::log10d<VEC_T, UINT_VEC_T>(x); }
+        template<typename VEC_T, typename UINT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE VEC_T pow(VEC_T const & x, VEC_T const & y) { return VECTOR_EMULATION::powd<VEC_T, UINT_VEC_T, MASK_T>(x, y); }
+        template<typename VEC_T, typename UINT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE VEC_T pow(MASK_T const & mask, VEC_T const & x, VEC_T const & y) { return VECTOR_EMULATION::powd<VEC_T, UINT_VEC_T, MASK_T>(mask, x, y); }
+        template<typename VEC_T, typename INT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE VEC_T sin(VEC_T const & x) { return VECTOR_EMULATION::sind<VEC_T, INT_VEC_T, MASK_T>(x); }
+        template<typename VEC_T, typename INT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE VEC_T sin(MASK_T const & mask, VEC_T const & x) { return VECTOR_EMULATION::sind<VEC_T, INT_VEC_T, MASK_T>(mask, x); }
+        template<typename VEC_T, typename INT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE VEC_T cos(VEC_T const & x) { return VECTOR_EMULATION::cosd<VEC_T, INT_VEC_T, MASK_T>(x); }
+        template<typename VEC_T, typename INT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE VEC_T cos(MASK_T const & mask, VEC_T const & x) { return VECTOR_EMULATION::cosd<VEC_T, INT_VEC_T, MASK_T>(mask, x); }
+        template<typename VEC_T, typename INT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE void sincos(VEC_T const & x, VEC_T & s, VEC_T & c) { VECTOR_EMULATION::sincosd<VEC_T, INT_VEC_T, MASK_T>(x, s, c); }
+        template<typename VEC_T, typename INT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE void sincos(MASK_T const & mask, VEC_T const & x, VEC_T & s, VEC_T & c) { VECTOR_EMULATION::sincosd<VEC_T, INT_VEC_T, MASK_T>(mask, x, s, c); }
+        template<typename VEC_T, typename INT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE VEC_T tan(VEC_T const & x) { return VECTOR_EMULATION::tand<VEC_T, INT_VEC_T, MASK_T>(x); }
+        template<typename VEC_T, typename INT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE VEC_T tan(MASK_T const & mask, VEC_T const & x) { return VECTOR_EMULATION::tand<VEC_T, INT_VEC_T, MASK_T>(mask, x); }
+        template<typename VEC_T, typename INT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE VEC_T ctan(VEC_T const & x) { return VECTOR_EMULATION::ctand<VEC_T, INT_VEC_T, MASK_T>(x); }
+        template<typename VEC_T, typename INT_VEC_T, typename MASK_T>
+        static UME_FORCE_INLINE VEC_T ctan(MASK_T const & mask, VEC_T const & x) { return VECTOR_EMULATION::ctand<VEC_T, INT_VEC_T, MASK_T>(mask, x); }
+    };
+
+}
+}
+
+#endif
@@ -0,0 +1,1711 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_FLOAT_PROTOTYPE_H_
+#define UME_SIMD_VEC_FLOAT_PROTOTYPE_H_
+
+#include <type_traits>
+#include <cstring>
+
+#include "../../../UMESimdInterface.h"
+#include "../UMESimdVectorExtTypes.h"
+
+#include "../UMESimdMask.h"
+#include "../UMESimdSwizzle.h"
+#include "../UMESimdVecUint.h"
+
+namespace UME {
+namespace SIMD {
+
+    template<typename SCALAR_FLOAT_TYPE, uint32_t VEC_LEN>
+    struct SIMDVec_f_traits {
+        // Generic trait class not containing type definition so that only correct explicit
+        // type definitions are compiled correctly
+    };
+
+    // 32b vectors
+    template<>
+    struct SIMDVec_f_traits<float, 1> {
+        typedef NullType<1>             HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint32_t, 1>  VEC_UINT_TYPE;
+        typedef SIMDVec_i<int32_t, 1>   VEC_INT_TYPE;
+        typedef int32_t                 SCALAR_INT_TYPE;
+        typedef uint32_t                SCALAR_UINT_TYPE;
+        typedef float*                  SCALAR_TYPE_PTR;
+        typedef SIMDVecMask<1>          MASK_TYPE;
+        typedef SIMDSwizzle<1>          SWIZZLE_MASK_TYPE;
+        typedef NullType<2>             SCALAR_FLOAT_LOWER_PRECISION;
+        typedef double                  SCALAR_FLOAT_HIGHER_PRECISION;
+    };
+
+    // 64b vectors
+    template<>
+    struct SIMDVec_f_traits<float, 2> {
+        typedef SIMDVec_f<float, 1>     HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint32_t, 2>  VEC_UINT_TYPE;
+        typedef SIMDVec_i<int32_t, 2>   VEC_INT_TYPE;
+        typedef int32_t                 SCALAR_INT_TYPE;
+        typedef uint32_t                SCALAR_UINT_TYPE;
+        typedef float*                  SCALAR_TYPE_PTR;
+        typedef SIMDVecMask<2>          MASK_TYPE;
+        typedef SIMDSwizzle<2>          SWIZZLE_MASK_TYPE;
+        typedef NullType<2>             SCALAR_FLOAT_LOWER_PRECISION;
+        typedef double                  SCALAR_FLOAT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_f_traits<double, 1> {
+        typedef NullType<1>             HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint64_t, 1>  VEC_UINT_TYPE;
+        typedef SIMDVec_i<int64_t, 1>   VEC_INT_TYPE;
+        typedef int64_t                 SCALAR_INT_TYPE;
+        typedef uint64_t                SCALAR_UINT_TYPE;
+        typedef double*                 SCALAR_TYPE_PTR;
+        typedef SIMDVecMask<1>          MASK_TYPE;
+        typedef SIMDSwizzle<1>          SWIZZLE_MASK_TYPE;
+        typedef float                   SCALAR_FLOAT_LOWER_PRECISION;
+        typedef NullType<2>             SCALAR_FLOAT_HIGHER_PRECISION;
+    };
+
+    // 128b vectors
+    template<>
+    struct SIMDVec_f_traits<float, 4> {
+        typedef SIMDVec_f<float, 2>     HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint32_t, 4>  VEC_UINT_TYPE;
+        typedef SIMDVec_i<int32_t, 4>   VEC_INT_TYPE;
+        typedef int32_t                 SCALAR_INT_TYPE;
+        typedef uint32_t                SCALAR_UINT_TYPE;
+        typedef float*                  SCALAR_TYPE_PTR;
+        typedef SIMDVecMask<4>          MASK_TYPE;
+        typedef SIMDSwizzle<4>          SWIZZLE_MASK_TYPE;
+        typedef NullType<2>             SCALAR_FLOAT_LOWER_PRECISION;
+        typedef double                  SCALAR_FLOAT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_f_traits<double, 2> {
+        typedef SIMDVec_f<double, 1>    HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint64_t, 2>  VEC_UINT_TYPE;
+        typedef SIMDVec_i<int64_t, 2>   VEC_INT_TYPE;
+        typedef int64_t                 SCALAR_INT_TYPE;
+        typedef uint64_t                SCALAR_UINT_TYPE;
+        typedef double*                 SCALAR_TYPE_PTR;
+        typedef SIMDVecMask<2>          MASK_TYPE;
+        typedef SIMDSwizzle<2>          SWIZZLE_MASK_TYPE;
+        typedef float                   SCALAR_FLOAT_LOWER_PRECISION;
+        typedef NullType<2>             SCALAR_FLOAT_HIGHER_PRECISION;
+    };
+
+    // 256b vectors
+    template<>
+    struct SIMDVec_f_traits<float, 8> {
+        typedef SIMDVec_f<float, 4>     HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint32_t, 8>  VEC_UINT_TYPE;
+        typedef SIMDVec_i<int32_t, 8>   VEC_INT_TYPE;
+        typedef int32_t                 SCALAR_INT_TYPE;
+        typedef uint32_t                SCALAR_UINT_TYPE;
+        typedef float*                  SCALAR_TYPE_PTR;
+        typedef SIMDVecMask<8>          MASK_TYPE;
+        typedef SIMDSwizzle<8>          SWIZZLE_MASK_TYPE;
+        typedef NullType<2>             SCALAR_FLOAT_LOWER_PRECISION;
+        typedef double                  SCALAR_FLOAT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_f_traits<double, 4> {
+        typedef SIMDVec_f<double, 2>    HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint64_t, 4>  VEC_UINT_TYPE;
+        typedef SIMDVec_i<int64_t, 4>   VEC_INT_TYPE;
+        typedef int64_t                 SCALAR_INT_TYPE;
+        typedef uint64_t                SCALAR_UINT_TYPE;
+        typedef double*                 SCALAR_TYPE_PTR;
+        typedef SIMDVecMask<4>          MASK_TYPE;
+        typedef SIMDSwizzle<4>          SWIZZLE_MASK_TYPE;
+        typedef float                   SCALAR_FLOAT_LOWER_PRECISION;
+        typedef NullType<2>             SCALAR_FLOAT_HIGHER_PRECISION;
+    };
+
+    // 512b vectors
+    template<>
+    struct SIMDVec_f_traits<float, 16> {
+        typedef SIMDVec_f<float, 8>     HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint32_t, 16> VEC_UINT_TYPE;
+        typedef SIMDVec_i<int32_t, 16>  VEC_INT_TYPE;
+        typedef int32_t                 SCALAR_INT_TYPE;
+        typedef uint32_t                SCALAR_UINT_TYPE;
+        typedef float*                  SCALAR_TYPE_PTR;
+        typedef SIMDVecMask<16>         MASK_TYPE;
+        typedef SIMDSwizzle<16>         SWIZZLE_MASK_TYPE;
+        typedef NullType<2>             SCALAR_FLOAT_LOWER_PRECISION;
+        typedef double                  SCALAR_FLOAT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_f_traits<double, 8> {
+        typedef SIMDVec_f<double, 4>    HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint64_t, 8>  VEC_UINT_TYPE;
+        typedef SIMDVec_i<int64_t, 8>   VEC_INT_TYPE;
+        typedef int64_t                 SCALAR_INT_TYPE;
+        typedef uint64_t                SCALAR_UINT_TYPE;
+        typedef double*                 SCALAR_TYPE_PTR;
+        typedef SIMDVecMask<8>          MASK_TYPE;
+        typedef SIMDSwizzle<8>          SWIZZLE_MASK_TYPE;
+        typedef float                   SCALAR_FLOAT_LOWER_PRECISION;
+        typedef NullType<2>             SCALAR_FLOAT_HIGHER_PRECISION;
+    };
+
+    // 1024b vectors
+    template<>
+    struct SIMDVec_f_traits<float, 32> {
+        typedef SIMDVec_f<float, 16>    HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint32_t, 32> VEC_UINT_TYPE;
+        typedef SIMDVec_i<int32_t, 32>  VEC_INT_TYPE;
+        typedef int32_t                 SCALAR_INT_TYPE;
+        typedef uint32_t                SCALAR_UINT_TYPE;
+        typedef float*                  SCALAR_TYPE_PTR;
+        typedef SIMDVecMask<32>         MASK_TYPE;
+        typedef SIMDSwizzle<32>         SWIZZLE_MASK_TYPE;
+        typedef NullType<2>             SCALAR_FLOAT_LOWER_PRECISION;
+        typedef NullType<3>             SCALAR_FLOAT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_f_traits<double, 16> {
+        typedef SIMDVec_f<double, 8>    HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint64_t, 16> VEC_UINT_TYPE;
+        typedef SIMDVec_i<int64_t, 16>  VEC_INT_TYPE;
+        typedef int64_t                 SCALAR_INT_TYPE;
+        typedef uint64_t                SCALAR_UINT_TYPE;
+        typedef double*                 SCALAR_TYPE_PTR;
+        typedef SIMDVecMask<16>         MASK_TYPE;
+        typedef SIMDSwizzle<16>         SWIZZLE_MASK_TYPE;
+        typedef float                   SCALAR_FLOAT_LOWER_PRECISION;
+        typedef NullType<2>             SCALAR_FLOAT_HIGHER_PRECISION;
+    };
+
+    // ***************************************************************************
+    // *
+    // *    Implementation of floating point types SIMDx_32f and SIMDx_64f.
+    // *
+    // *    Vector register is stored in a generic vector of the compiler
+    // *    (GCC/Clang 'vector_size' extension), so that all element-wise
+    // *    operations are translated directly to SIMD instructions of the target.
+    // *
+    // ***************************************************************************
+    template<typename SCALAR_FLOAT_TYPE, uint32_t VEC_LEN>
+    class SIMDVec_f :
+        public SIMDVecFloatInterface<
+            SIMDVec_f<SCALAR_FLOAT_TYPE, VEC_LEN>,
+            typename SIMDVec_f_traits<SCALAR_FLOAT_TYPE, VEC_LEN>::VEC_UINT_TYPE,
+            typename SIMDVec_f_traits<SCALAR_FLOAT_TYPE, VEC_LEN>::VEC_INT_TYPE,
+            SCALAR_FLOAT_TYPE,
+            VEC_LEN,
+            typename SIMDVec_f_traits<SCALAR_FLOAT_TYPE, VEC_LEN>::SCALAR_UINT_TYPE,
+            typename SIMDVec_f_traits<SCALAR_FLOAT_TYPE, VEC_LEN>::SCALAR_INT_TYPE,
+            typename SIMDVec_f_traits<SCALAR_FLOAT_TYPE, VEC_LEN>::MASK_TYPE,
+            typename SIMDVec_f_traits<SCALAR_FLOAT_TYPE, VEC_LEN>::SWIZZLE_MASK_TYPE>,
+        public SIMDVecPackableInterface<
+            SIMDVec_f<SCALAR_FLOAT_TYPE, VEC_LEN>,
+            typename SIMDVec_f_traits<SCALAR_FLOAT_TYPE, VEC_LEN>::HALF_LEN_VEC_TYPE>
+    {
+    public:
+        typedef typename SIMDVec_f_traits<SCALAR_FLOAT_TYPE, VEC_LEN>::SCALAR_UINT_TYPE SCALAR_UINT_TYPE;
+        typedef typename SIMDVec_f_traits<SCALAR_FLOAT_TYPE, VEC_LEN>::SCALAR_INT_TYPE SCALAR_INT_TYPE;
+        typedef SIMDVec_f VEC_TYPE;
+
+        typedef typename SIMDVec_f_traits<SCALAR_FLOAT_TYPE, VEC_LEN>::VEC_UINT_TYPE     VEC_UINT_TYPE;
+        typedef typename SIMDVec_f_traits<SCALAR_FLOAT_TYPE, VEC_LEN>::VEC_INT_TYPE      VEC_INT_TYPE;
+        typedef typename SIMDVec_f_traits<SCALAR_FLOAT_TYPE, VEC_LEN>::MASK_TYPE         MASK_TYPE;
+        typedef typename SIMDVec_f_traits<SCALAR_FLOAT_TYPE, VEC_LEN>::SWIZZLE_MASK_TYPE SWIZZLE_MASK_TYPE;
+        typedef typename SIMDVec_f_traits<SCALAR_FLOAT_TYPE, VEC_LEN>::HALF_LEN_VEC_TYPE HALF_LEN_VEC_TYPE;
+
+        typedef typename SIMDVec_f_traits<SCALAR_FLOAT_TYPE, VEC_LEN>::SCALAR_FLOAT_LOWER_PRECISION  SCALAR_FLOAT_LOWER_PRECISION;
+        typedef typename SIMDVec_f_traits<SCALAR_FLOAT_TYPE, VEC_LEN>::SCALAR_FLOAT_HIGHER_PRECISION SCALAR_FLOAT_HIGHER_PRECISION;
+
+        typedef typename VecExtType<SCALAR_FLOAT_TYPE, VEC_LEN>::type   VEC_EXT_TYPE;
+        typedef typename VecExtType<SCALAR_INT_TYPE, VEC_LEN>::type     VEC_EXT_SEL_TYPE;
+        typedef typename VecExtType<SCALAR_UINT_TYPE, VEC_LEN>::type    VEC_EXT_UINT_TYPE;
+
+        // Conversion operators and packing require access to private members.
+        template<typename T, uint32_t L>
+        friend class SIMDVec_u;
+        template<typename T, uint32_t L>
+        friend class SIMDVec_i;
+        template<typename T, uint32_t L>
+        friend class SIMDVec_f;
+
+    public:
+        constexpr static uint32_t alignment() { return VEC_LEN*sizeof(SCALAR_FLOAT_TYPE); }
+
+    private:
+        // This is the only data member and it is a low level representation of vector register.
+        alignas(alignment()) VEC_EXT_TYPE mVec;
+
+        UME_FORCE_INLINE explicit SIMDVec_f(VEC_EXT_TYPE const & x) : mVec(x) {}
+
+        // Broadcast scalar to all lanes.
+        static UME_FORCE_INLINE VEC_EXT_TYPE splat(SCALAR_FLOAT_TYPE x) {
+            return x - VEC_EXT_TYPE();
+        }
+        // Select 'b' in lanes where mask is set, and 'a' otherwise.
+        static UME_FORCE_INLINE VEC_EXT_TYPE blendExt(MASK_TYPE const & mask, VEC_EXT_TYPE const & a, VEC_EXT_TYPE const & b) {
+            return __builtin_convertvector(mask.mMask, VEC_EXT_SEL_TYPE) ? b : a;
+        }
+        // Convert result of vector comparison to mask.
+        template<typename CMP_TYPE>
+        static UME_FORCE_INLINE MASK_TYPE toMask(CMP_TYPE const & cmp) {
+            return MASK_TYPE(__builtin_convertvector(cmp, typename MASK_TYPE::VEC_EXT_TYPE));
+        }
+
+    public:
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_f() {};
+
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_f(SCALAR_FLOAT_TYPE x) : mVec(splat(x)) {}
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_f(
+            T i,
+            typename std::enable_if< std::is_fundamental<T>::value &&
+                                    !std::is_same<T, SCALAR_FLOAT_TYPE>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_f(static_cast<SCALAR_FLOAT_TYPE>(i)) {}
+
+        // LOAD-CONSTR - Construct by loading from memory
+        UME_FORCE_INLINE explicit SIMDVec_f(SCALAR_FLOAT_TYPE const * p) { this->load(p); }
+
+        UME_FORCE_INLINE SIMDVec_f(SCALAR_FLOAT_TYPE i0, SCALAR_FLOAT_TYPE i1)
+        : mVec(VEC_EXT_TYPE{
+            i0, i1 })
+        {}
+
+        UME_FORCE_INLINE SIMDVec_f(SCALAR_FLOAT_TYPE i0, SCALAR_FLOAT_TYPE i1, SCALAR_FLOAT_TYPE i2, SCALAR_FLOAT_TYPE i3)
+        : mVec(VEC_EXT_TYPE{
+            i0, i1, i2, i3 })
+        {}
+
+        UME_FORCE_INLINE SIMDVec_f(
+            SCALAR_FLOAT_TYPE i0, SCALAR_FLOAT_TYPE i1, SCALAR_FLOAT_TYPE i2, SCALAR_FLOAT_TYPE i3, SCALAR_FLOAT_TYPE i4, SCALAR_FLOAT_TYPE i5, SCALAR_FLOAT_TYPE i6, SCALAR_FLOAT_TYPE i7)
+        : mVec(VEC_EXT_TYPE{
+            i0, i1, i2, i3, i4, i5, i6, i7 })
+        {}
+
+        UME_FORCE_INLINE SIMDVec_f(
+            SCALAR_FLOAT_TYPE i0, SCALAR_FLOAT_TYPE i1, SCALAR_FLOAT_TYPE i2, SCALAR_FLOAT_TYPE i3, SCALAR_FLOAT_TYPE i4, SCALAR_FLOAT_TYPE i5, SCALAR_FLOAT_TYPE i6, SCALAR_FLOAT_TYPE i7,
+            SCALAR_FLOAT_TYPE i8, SCALAR_FLOAT_TYPE i9, SCALAR_FLOAT_TYPE i10, SCALAR_FLOAT_TYPE i11, SCALAR_FLOAT_TYPE i12, SCALAR_FLOAT_TYPE i13, SCALAR_FLOAT_TYPE i14, SCALAR_FLOAT_TYPE i15)
+        : mVec(VEC_EXT_TYPE{
+            i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15 })
+        {}
+
+        UME_FORCE_INLINE SIMDVec_f(
+            SCALAR_FLOAT_TYPE i0, SCALAR_FLOAT_TYPE i1, SCALAR_FLOAT_TYPE i2, SCALAR_FLOAT_TYPE i3, SCALAR_FLOAT_TYPE i4, SCALAR_FLOAT_TYPE i5, SCALAR_FLOAT_TYPE i6, SCALAR_FLOAT_TYPE i7,
+            SCALAR_FLOAT_TYPE i8, SCALAR_FLOAT_TYPE i9, SCALAR_FLOAT_TYPE i10, SCALAR_FLOAT_TYPE i11, SCALAR_FLOAT_TYPE i12, SCALAR_FLOAT_TYPE i13, SCALAR_FLOAT_TYPE i14, SCALAR_FLOAT_TYPE i15,
+            SCALAR_FLOAT_TYPE i16, SCALAR_FLOAT_TYPE i17, SCALAR_FLOAT_TYPE i18, SCALAR_FLOAT_TYPE i19, SCALAR_FLOAT_TYPE i20, SCALAR_FLOAT_TYPE i21, SCALAR_FLOAT_TYPE i22, SCALAR_FLOAT_TYPE i23,
+            SCALAR_FLOAT_TYPE i24, SCALAR_FLOAT_TYPE i25, SCALAR_FLOAT_TYPE i26, SCALAR_FLOAT_TYPE i27, SCALAR_FLOAT_TYPE i28, SCALAR_FLOAT_TYPE i29, SCALAR_FLOAT_TYPE i30, SCALAR_FLOAT_TYPE i31)
+        : mVec(VEC_EXT_TYPE{
+            i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15,
+            i16, i17, i18, i19, i20, i21, i22, i23, i24, i25, i26, i27, i28, i29, i30, i31 })
+        {}
+
+        // EXTRACT
+        UME_FORCE_INLINE SCALAR_FLOAT_TYPE extract(uint32_t index) const {
+            return mVec[index];
+        }
+        UME_FORCE_INLINE SCALAR_FLOAT_TYPE operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_f & insert(uint32_t index, SCALAR_FLOAT_TYPE value) {
+            mVec[index] = value;
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_f, SCALAR_FLOAT_TYPE> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_f, SCALAR_FLOAT_TYPE>(index, static_cast<SIMDVec_f &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_f, SCALAR_FLOAT_TYPE, MASK_TYPE> operator() (MASK_TYPE const & mask) {
+            return IntermediateMask<SIMDVec_f, SCALAR_FLOAT_TYPE, MASK_TYPE>(mask, static_cast<SIMDVec_f &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_f, SCALAR_FLOAT_TYPE, MASK_TYPE> operator[] (MASK_TYPE const & mask) {
+            return IntermediateMask<SIMDVec_f, SCALAR_FLOAT_TYPE, MASK_TYPE>(mask, static_cast<SIMDVec_f &>(*this));
+        }
+#endif
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_f & assign(SIMDVec_f const & src) {
+            mVec = src.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator= (SIMDVec_f const & b) {
+            return this->assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_f & assign(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & src) {
+            mVec = blendExt(mask, mVec, src.mVec);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_f & assign(SCALAR_FLOAT_TYPE b) {
+            mVec = splat(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator= (SCALAR_FLOAT_TYPE b) {
+            return this->assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_f & assign(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) {
+            mVec = blendExt(mask, mVec, splat(b));
+            return *this;
+        }
+
+        // PREFETCH0
+        // PREFETCH1
+        // PREFETCH2
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_f & load(SCALAR_FLOAT_TYPE const *p) {
+            std::memcpy(&mVec, p, sizeof(VEC_EXT_TYPE));
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_f & load(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE const *p) {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0) mVec[i] = p[i];
+            }
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_f & loada(SCALAR_FLOAT_TYPE const *p) {
+            std::memcpy(&mVec, __builtin_assume_aligned(p, alignment()), sizeof(VEC_EXT_TYPE));
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_f & loada(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE const *p) {
+            return load(mask, p);
+        }
+
+        // STORE
+        UME_FORCE_INLINE SCALAR_FLOAT_TYPE* store(SCALAR_FLOAT_TYPE* p) const {
+            std::memcpy(p, &mVec, sizeof(VEC_EXT_TYPE));
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE SCALAR_FLOAT_TYPE* store(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE* p) const {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0) p[i] = mVec[i];
+            }
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE SCALAR_FLOAT_TYPE* storea(SCALAR_FLOAT_TYPE* p) const {
+            std::memcpy(__builtin_assume_aligned(p, alignment()), &mVec, sizeof(VEC_EXT_TYPE));
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE SCALAR_FLOAT_TYPE* storea(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE* p) const {
+            return store(mask, p);
+        }
+
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b) const {
+            return SIMDVec_f(blendExt(mask, mVec, b.mVec));
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_f blend(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) const {
+            return SIMDVec_f(blendExt(mask, mVec, splat(b)));
+        }
+
+        // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_f swizzle(SWIZZLE_MASK_TYPE const & sMask) const {
+            SIMDVec_f retval;
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                retval.mVec[i] = mVec[sMask[i]];
+            }
+            return retval;
+        }
+        template<int... INDICES>
+        UME_FORCE_INLINE SIMDVec_f swizzle() const {
+            static_assert(sizeof...(INDICES) == VEC_LEN, "Invalid number of template parameters.");
+            return SIMDVec_f(__builtin_shufflevector(mVec, mVec, INDICES...));
+        }
+        // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_f & swizzlea(SWIZZLE_MASK_TYPE const & sMask) {
+            mVec = swizzle(sMask).mVec;
+            return *this;
+        }
+        template<int... INDICES>
+        UME_FORCE_INLINE SIMDVec_f & swizzlea() {
+            static_assert(sizeof...(INDICES) == VEC_LEN, "Invalid number of template parameters.");
+            mVec = __builtin_shufflevector(mVec, mVec, INDICES...);
+            return *this;
+        }
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_f add(SIMDVec_f const & b) const {
+            return SIMDVec_f(mVec + b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator+ (SIMDVec_f const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_f add(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b) const {
+            return SIMDVec_f(blendExt(mask, mVec, mVec + b.mVec));
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_f add(SCALAR_FLOAT_TYPE b) const {
+            return SIMDVec_f(mVec + splat(b));
+        }
+        UME_FORCE_INLINE SIMDVec_f operator+ (SCALAR_FLOAT_TYPE b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_f add(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) const {
+            return SIMDVec_f(blendExt(mask, mVec, mVec + splat(b)));
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_f & adda(SIMDVec_f const & b) {
+            mVec = mVec + b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator+= (SIMDVec_f const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_f & adda(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b) {
+            mVec = blendExt(mask, mVec, mVec + b.mVec);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_f & adda(SCALAR_FLOAT_TYPE b) {
+            mVec = mVec + splat(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator+= (SCALAR_FLOAT_TYPE b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_f & adda(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec + splat(b));
+            return *this;
+        }
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVec_f const & b) const {
+            return SIMDVec_f(mVec + b.mVec);
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b) const {
+            return SIMDVec_f(blendExt(mask, mVec, mVec + b.mVec));
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(SCALAR_FLOAT_TYPE b) const {
+            return SIMDVec_f(mVec + splat(b));
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_f sadd(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) const {
+            return SIMDVec_f(blendExt(mask, mVec, mVec + splat(b)));
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVec_f const & b) {
+            mVec = mVec + b.mVec;
+            return *this;
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b) {
+            mVec = blendExt(mask, mVec, mVec + b.mVec);
+            return *this;
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SCALAR_FLOAT_TYPE b) {
+            mVec = mVec + splat(b);
+            return *this;
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_f & sadda(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec + splat(b));
+            return *this;
+        }
+        // POSTINC
+        UME_FORCE_INLINE SIMDVec_f postinc() {
+            SIMDVec_f t0(mVec);
+            mVec = mVec + SCALAR_FLOAT_TYPE(1);
+            return t0;
+        }
+        UME_FORCE_INLINE SIMDVec_f operator++ (int) {
+            return postinc();
+        }
+        // MPOSTINC
+        UME_FORCE_INLINE SIMDVec_f postinc(SIMDVecMask<VEC_LEN> const & mask) {
+            SIMDVec_f t0(mVec);
+            mVec = blendExt(mask, mVec, mVec + SCALAR_FLOAT_TYPE(1));
+            return t0;
+        }
+        // PREFINC
+        UME_FORCE_INLINE SIMDVec_f & prefinc() {
+            mVec = mVec + SCALAR_FLOAT_TYPE(1);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator++ () {
+            return prefinc();
+        }
+        // MPREFINC
+        UME_FORCE_INLINE SIMDVec_f & prefinc(SIMDVecMask<VEC_LEN> const & mask) {
+            mVec = blendExt(mask, mVec, mVec + SCALAR_FLOAT_TYPE(1));
+            return *this;
+        }
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_f sub(SIMDVec_f const & b) const {
+            return SIMDVec_f(mVec - b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator- (SIMDVec_f const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_f sub(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b) const {
+            return SIMDVec_f(blendExt(mask, mVec, mVec - b.mVec));
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_f sub(SCALAR_FLOAT_TYPE b) const {
+            return SIMDVec_f(mVec - splat(b));
+        }
+        UME_FORCE_INLINE SIMDVec_f operator- (SCALAR_FLOAT_TYPE b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_f sub(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) const {
+            return SIMDVec_f(blendExt(mask, mVec, mVec - splat(b)));
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_f & suba(SIMDVec_f const & b) {
+            mVec = mVec - b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator-= (SIMDVec_f const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_f & suba(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b) {
+            mVec = blendExt(mask, mVec, mVec - b.mVec);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_f & suba(SCALAR_FLOAT_TYPE b) {
+            mVec = mVec - splat(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator-= (SCALAR_FLOAT_TYPE b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_f & suba(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec - splat(b));
+            return *this;
+        }
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVec_f const & b) const {
+            return SIMDVec_f(mVec - b.mVec);
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b) const {
+            return SIMDVec_f(blendExt(mask, mVec, mVec - b.mVec));
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(SCALAR_FLOAT_TYPE b) const {
+            return SIMDVec_f(mVec - splat(b));
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_f ssub(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) const {
+            return SIMDVec_f(blendExt(mask, mVec, mVec - splat(b)));
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVec_f const & b) {
+            mVec = mVec - b.mVec;
+            return *this;
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b) {
+            mVec = blendExt(mask, mVec, mVec - b.mVec);
+            return *this;
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SCALAR_FLOAT_TYPE b) {
+            mVec = mVec - splat(b);
+            return *this;
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_f & ssuba(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec - splat(b));
+            return *this;
+        }
+        // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVec_f const & b) const {
+            return SIMDVec_f(b.mVec - mVec);
+        }
+        // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b) const {
+            return SIMDVec_f(blendExt(mask, b.mVec, b.mVec - mVec));
+        }
+        // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_f subfrom(SCALAR_FLOAT_TYPE b) const {
+            return SIMDVec_f(splat(b) - mVec);
+        }
+        // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_f subfrom(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) const {
+            return SIMDVec_f(blendExt(mask, splat(b), splat(b) - mVec));
+        }
+        // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_f & subfroma(SIMDVec_f const & b) {
+            mVec = b.mVec - mVec;
+            return *this;
+        }
+        // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_f & subfroma(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b) {
+            mVec = blendExt(mask, b.mVec, b.mVec - mVec);
+            return *this;
+        }
+        // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_f & subfroma(SCALAR_FLOAT_TYPE b) {
+            mVec = splat(b) - mVec;
+            return *this;
+        }
+        // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_f & subfroma(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) {
+            mVec = blendExt(mask, splat(b), splat(b) - mVec);
+            return *this;
+        }
+        // POSTDEC
+        UME_FORCE_INLINE SIMDVec_f postdec() {
+            SIMDVec_f t0(mVec);
+            mVec = mVec - SCALAR_FLOAT_TYPE(1);
+            return t0;
+        }
+        UME_FORCE_INLINE SIMDVec_f operator-- (int) {
+            return postdec();
+        }
+        // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_f postdec(SIMDVecMask<VEC_LEN> const & mask) {
+            SIMDVec_f t0(mVec);
+            mVec = blendExt(mask, mVec, mVec - SCALAR_FLOAT_TYPE(1));
+            return t0;
+        }
+        // PREFDEC
+        UME_FORCE_INLINE SIMDVec_f & prefdec() {
+            mVec = mVec - SCALAR_FLOAT_TYPE(1);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator-- () {
+            return prefdec();
+        }
+        // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_f & prefdec(SIMDVecMask<VEC_LEN> const & mask) {
+            mVec = blendExt(mask, mVec, mVec - SCALAR_FLOAT_TYPE(1));
+            return *this;
+        }
+        // MULV
+        UME_FORCE_INLINE SIMDVec_f mul(SIMDVec_f const & b) const {
+            return SIMDVec_f(mVec * b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator* (SIMDVec_f const & b) const {
+            return mul(b);
+        }
+        // MMULV
+        UME_FORCE_INLINE SIMDVec_f mul(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b) const {
+            return SIMDVec_f(blendExt(mask, mVec, mVec * b.mVec));
+        }
+        // MULS
+        UME_FORCE_INLINE SIMDVec_f mul(SCALAR_FLOAT_TYPE b) const {
+            return SIMDVec_f(mVec * splat(b));
+        }
+        UME_FORCE_INLINE SIMDVec_f operator* (SCALAR_FLOAT_TYPE b) const {
+            return mul(b);
+        }
+        // MMULS
+        UME_FORCE_INLINE SIMDVec_f mul(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) const {
+            return SIMDVec_f(blendExt(mask, mVec, mVec * splat(b)));
+        }
+        // MULVA
+        UME_FORCE_INLINE SIMDVec_f & mula(SIMDVec_f const & b) {
+            mVec = mVec * b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator*= (SIMDVec_f const & b) {
+            return mula(b);
+        }
+        // MMULVA
+        UME_FORCE_INLINE SIMDVec_f & mula(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b) {
+            mVec = blendExt(mask, mVec, mVec * b.mVec);
+            return *this;
+        }
+        // MULSA
+        UME_FORCE_INLINE SIMDVec_f & mula(SCALAR_FLOAT_TYPE b) {
+            mVec = mVec * splat(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator*= (SCALAR_FLOAT_TYPE b) {
+            return mula(b);
+        }
+        // MMULSA
+        UME_FORCE_INLINE SIMDVec_f & mula(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec * splat(b));
+            return *this;
+        }
+        // DIVV
+        UME_FORCE_INLINE SIMDVec_f div(SIMDVec_f const & b) const {
+            return SIMDVec_f(mVec / b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator/ (SIMDVec_f const & b) const {
+            return div(b);
+        }
+        // MDIVV
+        UME_FORCE_INLINE SIMDVec_f div(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b) const {
+            return SIMDVec_f(blendExt(mask, mVec, mVec / b.mVec));
+        }
+        // DIVS
+        UME_FORCE_INLINE SIMDVec_f div(SCALAR_FLOAT_TYPE b) const {
+            return SIMDVec_f(mVec / splat(b));
+        }
+        UME_FORCE_INLINE SIMDVec_f operator/ (SCALAR_FLOAT_TYPE b) const {
+            return div(b);
+        }
+        // MDIVS
+        UME_FORCE_INLINE SIMDVec_f div(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) const {
+            return SIMDVec_f(blendExt(mask, mVec, mVec / splat(b)));
+        }
+        // DIVVA
+        UME_FORCE_INLINE SIMDVec_f & diva(SIMDVec_f const & b) {
+            mVec = mVec / b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator/= (SIMDVec_f const & b) {
+            return diva(b);
+        }
+        // MDIVVA
+        UME_FORCE_INLINE SIMDVec_f & diva(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b) {
+            mVec = blendExt(mask, mVec, mVec / b.mVec);
+            return *this;
+        }
+        // DIVSA
+        UME_FORCE_INLINE SIMDVec_f & diva(SCALAR_FLOAT_TYPE b) {
+            mVec = mVec / splat(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_f & operator/= (SCALAR_FLOAT_TYPE b) {
+            return diva(b);
+        }
+        // MDIVSA
+        UME_FORCE_INLINE SIMDVec_f & diva(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec / splat(b));
+            return *this;
+        }
+        // RCP
+        UME_FORCE_INLINE SIMDVec_f rcp() const {
+            return SIMDVec_f(splat(SCALAR_FLOAT_TYPE(1.0f)) / mVec);
+        }
+        // MRCP
+        UME_FORCE_INLINE SIMDVec_f rcp(SIMDVecMask<VEC_LEN> const & mask) const {
+            return SIMDVec_f(blendExt(mask, mVec, splat(SCALAR_FLOAT_TYPE(1.0f)) / mVec));
+        }
+        // RCPS
+        UME_FORCE_INLINE SIMDVec_f rcp(SCALAR_FLOAT_TYPE b) const {
+            return SIMDVec_f(splat(b) / mVec);
+        }
+        // MRCPS
+        UME_FORCE_INLINE SIMDVec_f rcp(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) const {
+            return SIMDVec_f(blendExt(mask, mVec, splat(b) / mVec));
+        }
+        // RCPA
+        UME_FORCE_INLINE SIMDVec_f & rcpa() {
+            mVec = splat(SCALAR_FLOAT_TYPE(1.0f)) / mVec;
+            return *this;
+        }
+        // MRCPA
+        UME_FORCE_INLINE SIMDVec_f & rcpa(SIMDVecMask<VEC_LEN> const & mask) {
+            mVec = blendExt(mask, mVec, splat(SCALAR_FLOAT_TYPE(1.0f)) / mVec);
+            return *this;
+        }
+        // RCPSA
+        UME_FORCE_INLINE SIMDVec_f & rcpa(SCALAR_FLOAT_TYPE b) {
+            mVec = splat(b) / mVec;
+            return *this;
+        }
+        // MRCPSA
+        UME_FORCE_INLINE SIMDVec_f & rcpa(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) {
+            mVec = blendExt(mask, mVec, splat(b) / mVec);
+            return *this;
+        }
+
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpeq(SIMDVec_f const & b) const {
+            return toMask(mVec == b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator== (SIMDVec_f const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpeq(SCALAR_FLOAT_TYPE b) const {
+            return toMask(mVec == splat(b));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator== (SCALAR_FLOAT_TYPE b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpne(SIMDVec_f const & b) const {
+            return toMask(mVec != b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator!= (SIMDVec_f const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpne(SCALAR_FLOAT_TYPE b) const {
+            return toMask(mVec != splat(b));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator!= (SCALAR_FLOAT_TYPE b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpgt(SIMDVec_f const & b) const {
+            return toMask(mVec > b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator> (SIMDVec_f const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpgt(SCALAR_FLOAT_TYPE b) const {
+            return toMask(mVec > splat(b));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator> (SCALAR_FLOAT_TYPE b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmplt(SIMDVec_f const & b) const {
+            return toMask(mVec < b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator< (SIMDVec_f const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmplt(SCALAR_FLOAT_TYPE b) const {
+            return toMask(mVec < splat(b));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator< (SCALAR_FLOAT_TYPE b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpge(SIMDVec_f const & b) const {
+            return toMask(mVec >= b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator>= (SIMDVec_f const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpge(SCALAR_FLOAT_TYPE b) const {
+            return toMask(mVec >= splat(b));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator>= (SCALAR_FLOAT_TYPE b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmple(SIMDVec_f const & b) const {
+            return toMask(mVec <= b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator<= (SIMDVec_f const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmple(SCALAR_FLOAT_TYPE b) const {
+            return toMask(mVec <= splat(b));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator<= (SCALAR_FLOAT_TYPE b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_f const & b) const {
+            return cmpeq(b).hland();
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(SCALAR_FLOAT_TYPE b) const {
+            return cmpeq(b).hland();
+        }
+
+        // UNIQUE
+
+        // HADD
+        UME_FORCE_INLINE SCALAR_FLOAT_TYPE hadd() const {
+            return VecExtReduce<SCALAR_FLOAT_TYPE, VEC_LEN>::template apply<VecExtAdd>(mVec);
+        }
+        // MHADD
+        UME_FORCE_INLINE SCALAR_FLOAT_TYPE hadd(SIMDVecMask<VEC_LEN> const & mask) const {
+            return VecExtReduce<SCALAR_FLOAT_TYPE, VEC_LEN>::template apply<VecExtAdd>(blendExt(mask, splat(SCALAR_FLOAT_TYPE(0)), mVec));
+        }
+        // HADDS
+        UME_FORCE_INLINE SCALAR_FLOAT_TYPE hadd(SCALAR_FLOAT_TYPE b) const {
+            return b + hadd();
+        }
+        // MHADDS
+        UME_FORCE_INLINE SCALAR_FLOAT_TYPE hadd(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) const {
+            return b + hadd(mask);
+        }
+        // HMUL
+        UME_FORCE_INLINE SCALAR_FLOAT_TYPE hmul() const {
+            return VecExtReduce<SCALAR_FLOAT_TYPE, VEC_LEN>::template apply<VecExtMul>(mVec);
+        }
+        // MHMUL
+        UME_FORCE_INLINE SCALAR_FLOAT_TYPE hmul(SIMDVecMask<VEC_LEN> const & mask) const {
+            return VecExtReduce<SCALAR_FLOAT_TYPE, VEC_LEN>::template apply<VecExtMul>(blendExt(mask, splat(SCALAR_FLOAT_TYPE(1)), mVec));
+        }
+        // HMULS
+        UME_FORCE_INLINE SCALAR_FLOAT_TYPE hmul(SCALAR_FLOAT_TYPE b) const {
+            return b * hmul();
+        }
+        // MHMULS
+        UME_FORCE_INLINE SCALAR_FLOAT_TYPE hmul(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) const {
+            return b * hmul(mask);
+        }
+
+        // FMULADDV
+        UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            return SIMDVec_f(mVec * b.mVec + c.mVec);
+        }
+        // MFMULADDV
+        UME_FORCE_INLINE SIMDVec_f fmuladd(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            return SIMDVec_f(blendExt(mask, mVec, mVec * b.mVec + c.mVec));
+        }
+        // FMULSUBV
+        UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            return SIMDVec_f(mVec * b.mVec - c.mVec);
+        }
+        // MFMULSUBV
+        UME_FORCE_INLINE SIMDVec_f fmulsub(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            return SIMDVec_f(blendExt(mask, mVec, mVec * b.mVec - c.mVec));
+        }
+        // FADDMULV
+        UME_FORCE_INLINE SIMDVec_f faddmul(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            return SIMDVec_f((mVec + b.mVec) * c.mVec);
+        }
+        // MFADDMULV
+        UME_FORCE_INLINE SIMDVec_f faddmul(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            return SIMDVec_f(blendExt(mask, mVec, (mVec + b.mVec) * c.mVec));
+        }
+        // FSUBMULV
+        UME_FORCE_INLINE SIMDVec_f fsubmul(SIMDVec_f const & b, SIMDVec_f const & c) const {
+            return SIMDVec_f((mVec - b.mVec) * c.mVec);
+        }
+        // MFSUBMULV
+        UME_FORCE_INLINE SIMDVec_f fsubmul(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b, SIMDVec_f const & c) const {
+            return SIMDVec_f(blendExt(mask, mVec, (mVec - b.mVec) * c.mVec));
+        }
+
+        // MAXV
+        UME_FORCE_INLINE SIMDVec_f max(SIMDVec_f const & b) const {
+            return SIMDVec_f((mVec > b.mVec) ? mVec : b.mVec);
+        }
+        // MMAXV
+        UME_FORCE_INLINE SIMDVec_f max(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b) const {
+            return SIMDVec_f(blendExt(mask, mVec, (mVec > b.mVec) ? mVec : b.mVec));
+        }
+        // MAXS
+        UME_FORCE_INLINE SIMDVec_f max(SCALAR_FLOAT_TYPE b) const {
+            return SIMDVec_f((mVec > splat(b)) ? mVec : splat(b));
+        }
+        // MMAXS
+        UME_FORCE_INLINE SIMDVec_f max(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) const {
+            return SIMDVec_f(blendExt(mask, mVec, (mVec > splat(b)) ? mVec : splat(b)));
+        }
+        // MAXVA
+        UME_FORCE_INLINE SIMDVec_f & maxa(SIMDVec_f const & b) {
+            mVec = (mVec > b.mVec) ? mVec : b.mVec;
+            return *this;
+        }
+        // MMAXVA
+        UME_FORCE_INLINE SIMDVec_f & maxa(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b) {
+            mVec = blendExt(mask, mVec, (mVec > b.mVec) ? mVec : b.mVec);
+            return *this;
+        }
+        // MAXSA
+        UME_FORCE_INLINE SIMDVec_f & maxa(SCALAR_FLOAT_TYPE b) {
+            mVec = (mVec > splat(b)) ? mVec : splat(b);
+            return *this;
+        }
+        // MMAXSA
+        UME_FORCE_INLINE SIMDVec_f & maxa(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) {
+            mVec = blendExt(mask, mVec, (mVec > splat(b)) ? mVec : splat(b));
+            return *this;
+        }
+        // MINV
+        UME_FORCE_INLINE SIMDVec_f min(SIMDVec_f const & b) const {
+            return SIMDVec_f((mVec < b.mVec) ? mVec : b.mVec);
+        }
+        // MMINV
+        UME_FORCE_INLINE SIMDVec_f min(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b) const {
+            return SIMDVec_f(blendExt(mask, mVec, (mVec < b.mVec) ? mVec : b.mVec));
+        }
+        // MINS
+        UME_FORCE_INLINE SIMDVec_f min(SCALAR_FLOAT_TYPE b) const {
+            return SIMDVec_f((mVec < splat(b)) ? mVec : splat(b));
+        }
+        // MMINS
+        UME_FORCE_INLINE SIMDVec_f min(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) const {
+            return SIMDVec_f(blendExt(mask, mVec, (mVec < splat(b)) ? mVec : splat(b)));
+        }
+        // MINVA
+        UME_FORCE_INLINE SIMDVec_f & mina(SIMDVec_f const & b) {
+            mVec = (mVec < b.mVec) ? mVec : b.mVec;
+            return *this;
+        }
+        // MMINVA
+        UME_FORCE_INLINE SIMDVec_f & mina(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b) {
+            mVec = blendExt(mask, mVec, (mVec < b.mVec) ? mVec : b.mVec);
+            return *this;
+        }
+        // MINSA
+        UME_FORCE_INLINE SIMDVec_f & mina(SCALAR_FLOAT_TYPE b) {
+            mVec = (mVec < splat(b)) ? mVec : splat(b);
+            return *this;
+        }
+        // MMINSA
+        UME_FORCE_INLINE SIMDVec_f & mina(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) {
+            mVec = blendExt(mask, mVec, (mVec < splat(b)) ? mVec : splat(b));
+            return *this;
+        }
+        // HMAX
+        UME_FORCE_INLINE SCALAR_FLOAT_TYPE hmax() const {
+            return VecExtReduce<SCALAR_FLOAT_TYPE, VEC_LEN>::template apply<VecExtMax>(mVec);
+        }
+        // MHMAX
+        UME_FORCE_INLINE SCALAR_FLOAT_TYPE hmax(SIMDVecMask<VEC_LEN> const & mask) const {
+            return VecExtReduce<SCALAR_FLOAT_TYPE, VEC_LEN>::template apply<VecExtMax>(blendExt(mask, splat(std::numeric_limits<SCALAR_FLOAT_TYPE>::lowest()), mVec));
+        }
+        // IMAX
+        UME_FORCE_INLINE uint32_t imax() const {
+            SCALAR_FLOAT_TYPE t0 = hmax();
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mVec[i] == t0) return i;
+            }
+            return 0;
+        }
+        // MIMAX
+        UME_FORCE_INLINE uint32_t imax(SIMDVecMask<VEC_LEN> const & mask) const {
+            SCALAR_FLOAT_TYPE t0 = hmax(mask);
+            if (t0 == std::numeric_limits<SCALAR_FLOAT_TYPE>::lowest()) return 0xFFFFFFFF;
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0 && mVec[i] == t0) return i;
+            }
+            return 0xFFFFFFFF;
+        }
+        // HMIN
+        UME_FORCE_INLINE SCALAR_FLOAT_TYPE hmin() const {
+            return VecExtReduce<SCALAR_FLOAT_TYPE, VEC_LEN>::template apply<VecExtMin>(mVec);
+        }
+        // MHMIN
+        UME_FORCE_INLINE SCALAR_FLOAT_TYPE hmin(SIMDVecMask<VEC_LEN> const & mask) const {
+            return VecExtReduce<SCALAR_FLOAT_TYPE, VEC_LEN>::template apply<VecExtMin>(blendExt(mask, splat(std::numeric_limits<SCALAR_FLOAT_TYPE>::max()), mVec));
+        }
+        // IMIN
+        UME_FORCE_INLINE uint32_t imin() const {
+            SCALAR_FLOAT_TYPE t0 = hmin();
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mVec[i] == t0) return i;
+            }
+            return 0;
+        }
+        // MIMIN
+        UME_FORCE_INLINE uint32_t imin(SIMDVecMask<VEC_LEN> const & mask) const {
+            SCALAR_FLOAT_TYPE t0 = hmin(mask);
+            if (t0 == std::numeric_limits<SCALAR_FLOAT_TYPE>::max()) return 0xFFFFFFFF;
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0 && mVec[i] == t0) return i;
+            }
+            return 0xFFFFFFFF;
+        }
+
+        // GATHERS
+        UME_FORCE_INLINE SIMDVec_f & gather(SCALAR_FLOAT_TYPE const * baseAddr, SCALAR_UINT_TYPE const * indices) {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                mVec[i] = baseAddr[indices[i]];
+            }
+            return *this;
+        }
+        // MGATHERS
+        UME_FORCE_INLINE SIMDVec_f & gather(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE const * baseAddr, SCALAR_UINT_TYPE const * indices) {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0) mVec[i] = baseAddr[indices[i]];
+            }
+            return *this;
+        }
+        // GATHERV
+        UME_FORCE_INLINE SIMDVec_f & gather(SCALAR_FLOAT_TYPE const * baseAddr, SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & indices) {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                mVec[i] = baseAddr[indices.mVec[i]];
+            }
+            return *this;
+        }
+        // MGATHERV
+        UME_FORCE_INLINE SIMDVec_f & gather(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE const * baseAddr, SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & indices) {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0) mVec[i] = baseAddr[indices.mVec[i]];
+            }
+            return *this;
+        }
+        // SCATTERS
+        UME_FORCE_INLINE SCALAR_FLOAT_TYPE* scatter(SCALAR_FLOAT_TYPE* baseAddr, SCALAR_UINT_TYPE* indices) const {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                baseAddr[indices[i]] = mVec[i];
+            }
+            return baseAddr;
+        }
+        // MSCATTERS
+        UME_FORCE_INLINE SCALAR_FLOAT_TYPE* scatter(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE* baseAddr, SCALAR_UINT_TYPE* indices) const {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0) baseAddr[indices[i]] = mVec[i];
+            }
+            return baseAddr;
+        }
+        // SCATTERV
+        UME_FORCE_INLINE SCALAR_FLOAT_TYPE* scatter(SCALAR_FLOAT_TYPE* baseAddr, SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & indices) const {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                baseAddr[indices.mVec[i]] = mVec[i];
+            }
+            return baseAddr;
+        }
+        // MSCATTERV
+        UME_FORCE_INLINE SCALAR_FLOAT_TYPE* scatter(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE* baseAddr, SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & indices) const {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0) baseAddr[indices.mVec[i]] = mVec[i];
+            }
+            return baseAddr;
+        }
+
+        // NEG
+        UME_FORCE_INLINE SIMDVec_f neg() const {
+            return SIMDVec_f(-mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_f operator- () const {
+            return neg();
+        }
+        // MNEG
+        UME_FORCE_INLINE SIMDVec_f neg(SIMDVecMask<VEC_LEN> const & mask) const {
+            return SIMDVec_f(blendExt(mask, mVec, -mVec));
+        }
+        // NEGA
+        UME_FORCE_INLINE SIMDVec_f & nega() {
+            mVec = -mVec;
+            return *this;
+        }
+        // MNEGA
+        UME_FORCE_INLINE SIMDVec_f & nega(SIMDVecMask<VEC_LEN> const & mask) {
+            mVec = blendExt(mask, mVec, -mVec);
+            return *this;
+        }
+
+        // Clear the sign bit.
+        static UME_FORCE_INLINE VEC_EXT_TYPE absExt(VEC_EXT_TYPE const & a) {
+            return (VEC_EXT_TYPE)((VEC_EXT_UINT_TYPE)a & (std::numeric_limits<SCALAR_INT_TYPE>::max() - VEC_EXT_UINT_TYPE()));
+        }
+
+        // ABS
+        UME_FORCE_INLINE SIMDVec_f abs() const {
+            return SIMDVec_f(absExt(mVec));
+        }
+        // MABS
+        UME_FORCE_INLINE SIMDVec_f abs(SIMDVecMask<VEC_LEN> const & mask) const {
+            return SIMDVec_f(blendExt(mask, mVec, absExt(mVec)));
+        }
+        // ABSA
+        UME_FORCE_INLINE SIMDVec_f & absa() {
+            mVec = absExt(mVec);
+            return *this;
+        }
+        // MABSA
+        UME_FORCE_INLINE SIMDVec_f & absa(SIMDVecMask<VEC_LEN> const & mask) {
+            mVec = blendExt(mask, mVec, absExt(mVec));
+            return *this;
+        }
+
+        // CMPEQRV
+        // CMPEQRS
+
+        // SQR
+        UME_FORCE_INLINE SIMDVec_f sqr() const {
+            return SIMDVec_f(mVec * mVec);
+        }
+        // MSQR
+        UME_FORCE_INLINE SIMDVec_f sqr(SIMDVecMask<VEC_LEN> const & mask) const {
+            return SIMDVec_f(blendExt(mask, mVec, mVec * mVec));
+        }
+        // SQRA
+        UME_FORCE_INLINE SIMDVec_f & sqra() {
+            mVec = mVec * mVec;
+            return *this;
+        }
+        // MSQRA
+        UME_FORCE_INLINE SIMDVec_f & sqra(SIMDVecMask<VEC_LEN> const & mask) {
+            mVec = blendExt(mask, mVec, mVec * mVec);
+            return *this;
+        }
+        // SQRT
+        UME_FORCE_INLINE SIMDVec_f sqrt() const {
+            SIMDVec_f retval;
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                retval.mVec[i] = std::sqrt(mVec[i]);
+            }
+            return retval;
+        }
+        // MSQRT
+        UME_FORCE_INLINE SIMDVec_f sqrt(SIMDVecMask<VEC_LEN> const & mask) const {
+            SIMDVec_f retval(*this);
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0) retval.mVec[i] = std::sqrt(mVec[i]);
+            }
+            return retval;
+        }
+        // SQRTA
+        UME_FORCE_INLINE SIMDVec_f & sqrta() {
+            mVec = sqrt().mVec;
+            return *this;
+        }
+        // MSQRTA
+        UME_FORCE_INLINE SIMDVec_f & sqrta(SIMDVecMask<VEC_LEN> const & mask) {
+            mVec = sqrt(mask).mVec;
+            return *this;
+        }
+        // POWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVec_f const & b) const {
+            return VecExtMath<SCALAR_FLOAT_TYPE>::template pow<SIMDVec_f, VEC_UINT_TYPE, MASK_TYPE>(*this, b);
+        }
+        // MPOWV
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f const & b) const {
+            return VecExtMath<SCALAR_FLOAT_TYPE>::template pow<SIMDVec_f, VEC_UINT_TYPE, MASK_TYPE>(mask, *this, b);
+        }
+        // POWS
+        UME_FORCE_INLINE SIMDVec_f pow(SCALAR_FLOAT_TYPE b) const {
+            return VecExtMath<SCALAR_FLOAT_TYPE>::template pow<SIMDVec_f, VEC_UINT_TYPE, MASK_TYPE>(*this, SIMDVec_f(b));
+        }
+        // MPOWS
+        UME_FORCE_INLINE SIMDVec_f pow(SIMDVecMask<VEC_LEN> const & mask, SCALAR_FLOAT_TYPE b) const {
+            return VecExtMath<SCALAR_FLOAT_TYPE>::template pow<SIMDVec_f, VEC_UINT_TYPE, MASK_TYPE>(mask, *this, SIMDVec_f(b));
+        }
+        // ROUND
+        UME_FORCE_INLINE SIMDVec_f round() const {
+            SIMDVec_f retval;
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                retval.mVec[i] = std::round(mVec[i]);
+            }
+            return retval;
+        }
+        // MROUND
+        UME_FORCE_INLINE SIMDVec_f round(SIMDVecMask<VEC_LEN> const & mask) const {
+            SIMDVec_f retval(*this);
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0) retval.mVec[i] = std::round(mVec[i]);
+            }
+            return retval;
+        }
+        // TRUNC
+        UME_FORCE_INLINE SIMDVec_i<SCALAR_INT_TYPE, VEC_LEN> trunc() const {
+            return SIMDVec_i<SCALAR_INT_TYPE, VEC_LEN>(__builtin_convertvector(mVec, VEC_EXT_SEL_TYPE));
+        }
+        // MTRUNC
+        UME_FORCE_INLINE SIMDVec_i<SCALAR_INT_TYPE, VEC_LEN> trunc(SIMDVecMask<VEC_LEN> const & mask) const {
+            VEC_EXT_SEL_TYPE t0 = __builtin_convertvector(mVec, VEC_EXT_SEL_TYPE);
+            return SIMDVec_i<SCALAR_INT_TYPE, VEC_LEN>(__builtin_convertvector(mask.mMask, VEC_EXT_SEL_TYPE) & t0);
+        }
+        // FLOOR
+        UME_FORCE_INLINE SIMDVec_f floor() const {
+            SIMDVec_f retval;
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                retval.mVec[i] = std::floor(mVec[i]);
+            }
+            return retval;
+        }
+        // MFLOOR
+        UME_FORCE_INLINE SIMDVec_f floor(SIMDVecMask<VEC_LEN> const & mask) const {
+            SIMDVec_f retval(*this);
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0) retval.mVec[i] = std::floor(mVec[i]);
+            }
+            return retval;
+        }
+        // CEIL
+        UME_FORCE_INLINE SIMDVec_f ceil() const {
+            SIMDVec_f retval;
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                retval.mVec[i] = std::ceil(mVec[i]);
+            }
+            return retval;
+        }
+        // MCEIL
+        UME_FORCE_INLINE SIMDVec_f ceil(SIMDVecMask<VEC_LEN> const & mask) const {
+            SIMDVec_f retval(*this);
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0) retval.mVec[i] = std::ceil(mVec[i]);
+            }
+            return retval;
+        }
+        // ISFIN
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> isfin() const {
+            return toMask(absExt(mVec) < splat(std::numeric_limits<SCALAR_FLOAT_TYPE>::infinity()));
+        }
+        // ISINF
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> isinf() const {
+            return toMask(absExt(mVec) == splat(std::numeric_limits<SCALAR_FLOAT_TYPE>::infinity()));
+        }
+        // ISAN
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> isan() const {
+            return toMask(absExt(mVec) < splat(std::numeric_limits<SCALAR_FLOAT_TYPE>::infinity()));
+        }
+        // ISNAN
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> isnan() const {
+            return toMask(mVec != mVec);
+        }
+        // ISNORM
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> isnorm() const {
+            return toMask((absExt(mVec) >= splat(std::numeric_limits<SCALAR_FLOAT_TYPE>::min())) & (absExt(mVec) < splat(std::numeric_limits<SCALAR_FLOAT_TYPE>::infinity())));
+        }
+        // ISSUB
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> issub() const {
+            return toMask((absExt(mVec) < splat(std::numeric_limits<SCALAR_FLOAT_TYPE>::min())) & (mVec != 0));
+        }
+        // ISZERO
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> iszero() const {
+            return toMask(mVec == 0);
+        }
+        // ISZEROSUB
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> iszerosub() const {
+            return toMask(absExt(mVec) < splat(std::numeric_limits<SCALAR_FLOAT_TYPE>::min()));
+        }
+
+        // EXP
+        UME_FORCE_INLINE SIMDVec_f exp() const {
+            return VecExtMath<SCALAR_FLOAT_TYPE>::template exp<SIMDVec_f, VEC_UINT_TYPE>(*this);
+        }
+        // MEXP
+        UME_FORCE_INLINE SIMDVec_f exp(SIMDVecMask<VEC_LEN> const & mask) const {
+            return VecExtMath<SCALAR_FLOAT_TYPE>::template exp<SIMDVec_f, VEC_UINT_TYPE, MASK_TYPE>(mask, *this);
+        }
+        // LOG
+        UME_FORCE_INLINE SIMDVec_f log() const {
+            return VecExtMath<SCALAR_FLOAT_TYPE>::template log<SIMDVec_f, VEC_UINT_TYPE>(*this);
+        }
+        // LOG10
+        UME_FORCE_INLINE SIMDVec_f log10() const {
+            return VecExtMath<SCALAR_FLOAT_TYPE>::template log10<SIMDVec_f, VEC_UINT_TYPE>(*this);
+        }
+        // LOG2
+        UME_FORCE_INLINE SIMDVec_f log2() const {
+            return VecExtMath<SCALAR_FLOAT_TYPE>::template log2<SIMDVec_f, VEC_UINT_TYPE>(*this);
+        }
+        // SIN
+        UME_FORCE_INLINE SIMDVec_f sin() const {
+            return VecExtMath<SCALAR_FLOAT_TYPE>::template sin<SIMDVec_f, VEC_INT_TYPE, MASK_TYPE>(*this);
+        }
+        // MSIN
+        UME_FORCE_INLINE SIMDVec_f sin(SIMDVecMask<VEC_LEN> const & mask) const {
+            return VecExtMath<SCALAR_FLOAT_TYPE>::template sin<SIMDVec_f, VEC_INT_TYPE, MASK_TYPE>(mask, *this);
+        }
+        // COS
+        UME_FORCE_INLINE SIMDVec_f cos() const {
+            return VecExtMath<SCALAR_FLOAT_TYPE>::template cos<SIMDVec_f, VEC_INT_TYPE, MASK_TYPE>(*this);
+        }
+        // MCOS
+        UME_FORCE_INLINE SIMDVec_f cos(SIMDVecMask<VEC_LEN> const & mask) const {
+            return VecExtMath<SCALAR_FLOAT_TYPE>::template cos<SIMDVec_f, VEC_INT_TYPE, MASK_TYPE>(mask, *this);
+        }
+        // SINCOS
+        UME_FORCE_INLINE void sincos(SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            VecExtMath<SCALAR_FLOAT_TYPE>::template sincos<SIMDVec_f, VEC_INT_TYPE, MASK_TYPE>(*this, sinvec, cosvec);
+        }
+        // MSINCOS
+        UME_FORCE_INLINE void sincos(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_f & sinvec, SIMDVec_f & cosvec) const {
+            VecExtMath<SCALAR_FLOAT_TYPE>::template sincos<SIMDVec_f, VEC_INT_TYPE, MASK_TYPE>(mask, *this, sinvec, cosvec);
+        }
+        // TAN
+        UME_FORCE_INLINE SIMDVec_f tan() const {
+            return VecExtMath<SCALAR_FLOAT_TYPE>::template tan<SIMDVec_f, VEC_INT_TYPE, MASK_TYPE>(*this);
+        }
+        // MTAN
+        UME_FORCE_INLINE SIMDVec_f tan(SIMDVecMask<VEC_LEN> const & mask) const {
+            return VecExtMath<SCALAR_FLOAT_TYPE>::template tan<SIMDVec_f, VEC_INT_TYPE, MASK_TYPE>(mask, *this);
+        }
+        // CTAN
+        UME_FORCE_INLINE SIMDVec_f ctan() const {
+            return VecExtMath<SCALAR_FLOAT_TYPE>::template ctan<SIMDVec_f, VEC_INT_TYPE, MASK_TYPE>(*this);
+        }
+        // MCTAN
+        UME_FORCE_INLINE SIMDVec_f ctan(SIMDVecMask<VEC_LEN> const & mask) const {
+            return VecExtMath<SCALAR_FLOAT_TYPE>::template ctan<SIMDVec_f, VEC_INT_TYPE, MASK_TYPE>(mask, *this);
+        }
+
+        // PACK
+        UME_FORCE_INLINE SIMDVec_f & pack(HALF_LEN_VEC_TYPE const & a, HALF_LEN_VEC_TYPE const & b) {
+            mVec = vecExtShuffle<VEC_EXT_TYPE>(a.mVec, b.mVec, typename VecExtRange<0, VEC_LEN>::type());
+            return *this;
+        }
+        // PACKLO
+        UME_FORCE_INLINE SIMDVec_f & packlo(HALF_LEN_VEC_TYPE const & a) {
+            typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE t0 = vecExtShuffle<typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE>(mVec, mVec, typename VecExtRange<VEC_LEN/2, VEC_LEN/2>::type());
+            mVec = vecExtShuffle<VEC_EXT_TYPE>(a.mVec, t0, typename VecExtRange<0, VEC_LEN>::type());
+            return *this;
+        }
+        // PACKHI
+        UME_FORCE_INLINE SIMDVec_f & packhi(HALF_LEN_VEC_TYPE const & b) {
+            typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE t0 = vecExtShuffle<typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE>(mVec, mVec, typename VecExtRange<0, VEC_LEN/2>::type());
+            mVec = vecExtShuffle<VEC_EXT_TYPE>(t0, b.mVec, typename VecExtRange<0, VEC_LEN>::type());
+            return *this;
+        }
+        // UNPACK
+        UME_FORCE_INLINE void unpack(HALF_LEN_VEC_TYPE & a, HALF_LEN_VEC_TYPE & b) const {
+            a.mVec = vecExtShuffle<typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE>(mVec, mVec, typename VecExtRange<0, VEC_LEN/2>::type());
+            b.mVec = vecExtShuffle<typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE>(mVec, mVec, typename VecExtRange<VEC_LEN/2, VEC_LEN/2>::type());
+        }
+        // UNPACKLO
+        UME_FORCE_INLINE HALF_LEN_VEC_TYPE unpacklo() const {
+            return HALF_LEN_VEC_TYPE(vecExtShuffle<typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE>(mVec, mVec, typename VecExtRange<0, VEC_LEN/2>::type()));
+        }
+        // UNPACKHI
+        UME_FORCE_INLINE HALF_LEN_VEC_TYPE unpackhi() const {
+            return HALF_LEN_VEC_TYPE(vecExtShuffle<typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE>(mVec, mVec, typename VecExtRange<VEC_LEN/2, VEC_LEN/2>::type()));
+        }
+
+        // DEGRADE
+        UME_FORCE_INLINE operator SIMDVec_f<SCALAR_FLOAT_LOWER_PRECISION, VEC_LEN>() const;
+        // PROMOTE
+        UME_FORCE_INLINE operator SIMDVec_f<SCALAR_FLOAT_HIGHER_PRECISION, VEC_LEN>() const;
+
+        // FTOU
+        UME_FORCE_INLINE operator SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN>() const;
+        // FTOI
+        UME_FORCE_INLINE operator SIMDVec_i<SCALAR_INT_TYPE, VEC_LEN>() const;
+    };
+
+    // SIMD NullTypes. These are used whenever a terminating
+    // scalar type is used as a creator function for SIMD type.
+    // These types cannot be instantiated, but are necessary for 
+    // typeset to be consistent.
+    template<>
+    class SIMDVec_f<NullType<1>, 1>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+
+    template<>
+    class SIMDVec_f<NullType<1>, 2>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+
+    template<>
+    class SIMDVec_f<NullType<1>, 4>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+
+    template<>
+    class SIMDVec_f<NullType<1>, 8>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+
+    template<>
+    class SIMDVec_f<NullType<1>, 16>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+
+    template<>
+    class SIMDVec_f<NullType<1>, 32>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+
+    template<>
+    class SIMDVec_f<NullType<1>, 64>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+
+    template<>
+    class SIMDVec_f<NullType<1>, 128>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+
+    template<>
+    class SIMDVec_f<NullType<2>, 1>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+
+    template<>
+    class SIMDVec_f<NullType<2>, 2>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+
+    template<>
+    class SIMDVec_f<NullType<2>, 4>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+
+    template<>
+    class SIMDVec_f<NullType<2>, 8>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+
+    template<>
+    class SIMDVec_f<NullType<2>, 16>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+
+    template<>
+    class SIMDVec_f<NullType<2>, 32>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+
+    template<>
+    class SIMDVec_f<NullType<2>, 64>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+
+    template<>
+    class SIMDVec_f<NullType<2>, 128>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+
+    template<>
+    class SIMDVec_f<NullType<3>, 1>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+
+    template<>
+    class SIMDVec_f<NullType<3>, 2>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+
+    template<>
+    class SIMDVec_f<NullType<3>, 4>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+
+    template<>
+    class SIMDVec_f<NullType<3>, 8>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+
+    template<>
+    class SIMDVec_f<NullType<3>, 16>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+
+    template<>
+    class SIMDVec_f<NullType<3>, 32>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+
+    template<>
+    class SIMDVec_f<NullType<3>, 64>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+
+    template<>
+    class SIMDVec_f<NullType<3>, 128>
+    {
+    private:
+        SIMDVec_f() {}
+        ~SIMDVec_f() {}
+    };
+}
+}
+
+#endif
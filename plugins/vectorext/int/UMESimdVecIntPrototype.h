@@ -0,0 +1,2214 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_INT_PROTOTYPE_H_
+#define UME_SIMD_VEC_INT_PROTOTYPE_H_
+
+#include <type_traits>
+#include <cstring>
+#include "../../../UMESimdInterface.h"
+#include "../UMESimdVectorExtTypes.h"
+
+#include "../UMESimdMask.h"
+#include "../UMESimdSwizzle.h"
+#include "../UMESimdVecUint.h"
+
+namespace UME {
+namespace SIMD {
+
+    // ********************************************************************************************
+    // SIGNED INTEGER VECTORS
+    // ********************************************************************************************
+    template<typename SCALAR_INT_TYPE, uint32_t VEC_LEN>
+    struct SIMDVec_i_traits {
+        // Generic trait class not containing type definition so that only correct explicit
+        // type definitions are compiled correctly
+    };
+
+    // 8b vectors
+    template<>
+    struct SIMDVec_i_traits<int8_t, 1> {
+        typedef NullType<1>             HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint8_t, 1>   VEC_UINT;
+        typedef uint8_t                 SCALAR_UINT_TYPE;
+        typedef NullType<2>             SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<1>          MASK_TYPE;
+        typedef SIMDSwizzle<1>          SWIZZLE_MASK_TYPE;
+        typedef NullType<3>             SCALAR_INT_LOWER_PRECISION;
+        typedef int16_t                 SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    // 16b vectors
+    template<>
+    struct SIMDVec_i_traits<int8_t, 2> {
+        typedef SIMDVec_i<int8_t, 1>    HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint8_t, 2>   VEC_UINT;
+        typedef uint8_t                 SCALAR_UINT_TYPE;
+        typedef NullType<1>             SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<2>          MASK_TYPE;
+        typedef SIMDSwizzle<2>          SWIZZLE_MASK_TYPE;
+        typedef NullType<2>             SCALAR_INT_LOWER_PRECISION;
+        typedef int16_t                 SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_i_traits<int16_t, 1> {
+        typedef NullType<1>             HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint16_t, 1>  VEC_UINT;
+        typedef uint16_t                SCALAR_UINT_TYPE;
+        typedef NullType<2>             SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<1>          MASK_TYPE;
+        typedef SIMDSwizzle<1>          SWIZZLE_MASK_TYPE;
+        typedef int8_t                  SCALAR_INT_LOWER_PRECISION;
+        typedef int32_t                 SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    // 32b vectors
+    template<>
+    struct SIMDVec_i_traits<int8_t, 4> {
+        typedef SIMDVec_i<int8_t, 2>    HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint8_t, 4>   VEC_UINT;
+        typedef uint8_t                 SCALAR_UINT_TYPE;
+        typedef NullType<1>             SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<4>          MASK_TYPE;
+        typedef SIMDSwizzle<4>          SWIZZLE_MASK_TYPE;
+        typedef NullType<2>             SCALAR_INT_LOWER_PRECISION;
+        typedef int16_t                 SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_i_traits<int16_t, 2> {
+        typedef SIMDVec_i<int16_t, 1>   HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint16_t, 2>  VEC_UINT;
+        typedef uint16_t                SCALAR_UINT_TYPE;
+        typedef NullType<1>             SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<2>          MASK_TYPE;
+        typedef SIMDSwizzle<2>          SWIZZLE_MASK_TYPE;
+        typedef int8_t                  SCALAR_INT_LOWER_PRECISION;
+        typedef int32_t                 SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_i_traits<int32_t, 1> {
+        typedef NullType<1>             HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint32_t, 1>  VEC_UINT;
+        typedef uint32_t                SCALAR_UINT_TYPE;
+        typedef float                   SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<1>          MASK_TYPE;
+        typedef SIMDSwizzle<1>          SWIZZLE_MASK_TYPE;
+        typedef int16_t                 SCALAR_INT_LOWER_PRECISION;
+        typedef int64_t                 SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    // 64b vectors
+    template<>
+    struct SIMDVec_i_traits<int8_t, 8> {
+        typedef SIMDVec_i<int8_t, 4>    HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint8_t, 8>   VEC_UINT;
+        typedef uint8_t                 SCALAR_UINT_TYPE;
+        typedef NullType<1>             SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<8>          MASK_TYPE;
+        typedef SIMDSwizzle<8>          SWIZZLE_MASK_TYPE;
+        typedef NullType<2>             SCALAR_INT_LOWER_PRECISION;
+        typedef int16_t                 SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_i_traits<int16_t, 4> {
+        typedef SIMDVec_i<int16_t, 2>   HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint16_t, 4>  VEC_UINT;
+        typedef uint16_t                SCALAR_UINT_TYPE;
+        typedef NullType<1>             SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<4>          MASK_TYPE;
+        typedef SIMDSwizzle<4>          SWIZZLE_MASK_TYPE;
+        typedef int8_t                  SCALAR_INT_LOWER_PRECISION;
+        typedef int32_t                 SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_i_traits<int32_t, 2> {
+        typedef SIMDVec_i<int32_t, 1>   HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint32_t, 2>  VEC_UINT;
+        typedef uint32_t                SCALAR_UINT_TYPE;
+        typedef float                   SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<2>          MASK_TYPE;
+        typedef SIMDSwizzle<2>          SWIZZLE_MASK_TYPE;
+        typedef int16_t                 SCALAR_INT_LOWER_PRECISION;
+        typedef int64_t                 SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_i_traits<int64_t, 1> {
+        typedef NullType<1>             HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint64_t, 1>  VEC_UINT;
+        typedef uint64_t                SCALAR_UINT_TYPE;
+        typedef double                  SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<1>          MASK_TYPE;
+        typedef SIMDSwizzle<1>          SWIZZLE_MASK_TYPE;
+        typedef int32_t                 SCALAR_INT_LOWER_PRECISION;
+        typedef NullType<2>             SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    // 128b vectors
+    template<>
+    struct SIMDVec_i_traits<int8_t, 16> {
+        typedef SIMDVec_i<int8_t, 8>    HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint8_t, 16>  VEC_UINT;
+        typedef uint8_t                 SCALAR_UINT_TYPE;
+        typedef NullType<1>             SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<16>         MASK_TYPE;
+        typedef SIMDSwizzle<16>         SWIZZLE_MASK_TYPE;
+        typedef NullType<2>             SCALAR_INT_LOWER_PRECISION;
+        typedef int16_t                 SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_i_traits<int16_t, 8> {
+        typedef SIMDVec_i<int16_t, 4>   HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint16_t, 8>  VEC_UINT;
+        typedef uint16_t                SCALAR_UINT_TYPE;
+        typedef NullType<1>             SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<8>          MASK_TYPE;
+        typedef SIMDSwizzle<8>          SWIZZLE_MASK_TYPE;
+        typedef int8_t                  SCALAR_INT_LOWER_PRECISION;
+        typedef int32_t                 SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_i_traits<int32_t, 4> {
+        typedef SIMDVec_i<int32_t, 2>   HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint32_t, 4>  VEC_UINT;
+        typedef uint32_t                SCALAR_UINT_TYPE;
+        typedef float                   SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<4>          MASK_TYPE;
+        typedef SIMDSwizzle<4>          SWIZZLE_MASK_TYPE;
+        typedef int16_t                 SCALAR_INT_LOWER_PRECISION;
+        typedef int64_t                 SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_i_traits<int64_t, 2> {
+        typedef SIMDVec_i<int64_t, 1>   HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint64_t, 2>  VEC_UINT;
+        typedef uint64_t                SCALAR_UINT_TYPE;
+        typedef double                  SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<2>          MASK_TYPE;
+        typedef SIMDSwizzle<2>          SWIZZLE_MASK_TYPE;
+        typedef int32_t                 SCALAR_INT_LOWER_PRECISION;
+        typedef NullType<2>             SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    // 256b vectors
+    template<>
+    struct SIMDVec_i_traits<int8_t, 32> {
+        typedef SIMDVec_i<int8_t, 16>   HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint8_t, 32>  VEC_UINT;
+        typedef uint8_t                 SCALAR_UINT_TYPE;
+        typedef NullType<1>             SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<32>         MASK_TYPE;
+        typedef SIMDSwizzle<32>         SWIZZLE_MASK_TYPE;
+        typedef NullType<2>             SCALAR_INT_LOWER_PRECISION;
+        typedef int16_t                 SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_i_traits<int16_t, 16> {
+        typedef SIMDVec_i<int16_t, 8>   HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint16_t, 16> VEC_UINT;
+        typedef uint16_t                SCALAR_UINT_TYPE;
+        typedef NullType<1>             SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<16>         MASK_TYPE;
+        typedef SIMDSwizzle<16>         SWIZZLE_MASK_TYPE;
+        typedef int8_t                  SCALAR_INT_LOWER_PRECISION;
+        typedef int32_t                 SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_i_traits<int32_t, 8> {
+        typedef SIMDVec_i<int32_t, 4>   HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint32_t, 8>  VEC_UINT;
+        typedef uint32_t                SCALAR_UINT_TYPE;
+        typedef float                   SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<8>          MASK_TYPE;
+        typedef SIMDSwizzle<8>          SWIZZLE_MASK_TYPE;
+        typedef int16_t                 SCALAR_INT_LOWER_PRECISION;
+        typedef int64_t                 SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_i_traits<int64_t, 4> {
+        typedef SIMDVec_i<int64_t, 2>   HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint64_t, 4>  VEC_UINT;
+        typedef uint64_t                SCALAR_UINT_TYPE;
+        typedef double                  SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<4>          MASK_TYPE;
+        typedef SIMDSwizzle<4>          SWIZZLE_MASK_TYPE;
+        typedef int32_t                 SCALAR_INT_LOWER_PRECISION;
+        typedef NullType<1>             SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    // 512b vectors
+    template<>
+    struct SIMDVec_i_traits<int8_t, 64> {
+        typedef SIMDVec_i<int8_t, 32>   HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint8_t, 64>  VEC_UINT;
+        typedef uint8_t                 SCALAR_UINT_TYPE;
+        typedef NullType<1>             SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<64>         MASK_TYPE;
+        typedef SIMDSwizzle<64>         SWIZZLE_MASK_TYPE;
+        typedef NullType<2>             SCALAR_INT_LOWER_PRECISION;
+        typedef int16_t                 SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_i_traits<int16_t, 32> {
+        typedef SIMDVec_i<int16_t, 16>  HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint16_t, 32> VEC_UINT;
+        typedef uint16_t                SCALAR_UINT_TYPE;
+        typedef NullType<1>             SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<32>         MASK_TYPE;
+        typedef SIMDSwizzle<32>         SWIZZLE_MASK_TYPE;
+        typedef int8_t                  SCALAR_INT_LOWER_PRECISION;
+        typedef int32_t                 SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_i_traits<int32_t, 16> {
+        typedef SIMDVec_i<int32_t, 8>   HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint32_t, 16> VEC_UINT;
+        typedef uint32_t                SCALAR_UINT_TYPE;
+        typedef float                   SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<16>         MASK_TYPE;
+        typedef SIMDSwizzle<16>         SWIZZLE_MASK_TYPE;
+        typedef int16_t                 SCALAR_INT_LOWER_PRECISION;
+        typedef int64_t                 SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_i_traits<int64_t, 8> {
+        typedef SIMDVec_i<int64_t, 4>   HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint64_t, 8>  VEC_UINT;
+        typedef uint64_t                SCALAR_UINT_TYPE;
+        typedef double                  SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<8>          MASK_TYPE;
+        typedef SIMDSwizzle<8>          SWIZZLE_MASK_TYPE;
+        typedef int32_t                 SCALAR_INT_LOWER_PRECISION;
+        typedef NullType<2>             SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    // 1024b vectors
+    template<>
+    struct SIMDVec_i_traits<int8_t, 128> {
+        typedef SIMDVec_i<int8_t, 64>   HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint8_t, 128> VEC_UINT;
+        typedef uint8_t                 SCALAR_UINT_TYPE;
+        typedef NullType<1>             SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<128>        MASK_TYPE;
+        typedef SIMDSwizzle<128>        SWIZZLE_MASK_TYPE;
+        typedef NullType<2>             SCALAR_INT_LOWER_PRECISION;
+        typedef NullType<3>             SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_i_traits<int16_t, 64> {
+        typedef SIMDVec_i<int16_t, 32>  HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint16_t, 64> VEC_UINT;
+        typedef uint16_t                SCALAR_UINT_TYPE;
+        typedef NullType<1>             SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<64>         MASK_TYPE;
+        typedef SIMDSwizzle<64>         SWIZZLE_MASK_TYPE;
+        typedef int8_t                  SCALAR_INT_LOWER_PRECISION;
+        typedef NullType<2>             SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_i_traits<int32_t, 32> {
+        typedef SIMDVec_i<int32_t, 16>  HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint32_t, 32> VEC_UINT;
+        typedef uint32_t                SCALAR_UINT_TYPE;
+        typedef float                   SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<32>         MASK_TYPE;
+        typedef SIMDSwizzle<32>         SWIZZLE_MASK_TYPE;
+        typedef int16_t                 SCALAR_INT_LOWER_PRECISION;
+        typedef NullType<1>             SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_i_traits<int64_t, 16> {
+        typedef SIMDVec_i<int64_t, 8>   HALF_LEN_VEC_TYPE;
+        typedef SIMDVec_u<uint64_t, 16> VEC_UINT;
+        typedef uint64_t                SCALAR_UINT_TYPE;
+        typedef double                  SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<16>         MASK_TYPE;
+        typedef SIMDSwizzle<16>         SWIZZLE_MASK_TYPE;
+        typedef int32_t                 SCALAR_INT_LOWER_PRECISION;
+        typedef NullType<1>             SCALAR_INT_HIGHER_PRECISION;
+    };
+
+    // ***************************************************************************
+    // *
+    // *    Implementation of signed integer SIMDx_8i, SIMDx_16i, SIMDx_32i, 
+    // *    and SIMDx_64i.
+    // *
+    // *    Vector register is stored in a generic vector of the compiler
+    // *    (GCC/Clang 'vector_size' extension), so that all element-wise
+    // *    operations are translated directly to SIMD instructions of the target.
+    // *
+    // ***************************************************************************
+    template<typename SCALAR_INT_TYPE, uint32_t VEC_LEN>
+    class SIMDVec_i :
+        public SIMDVecSignedInterface<
+            SIMDVec_i<SCALAR_INT_TYPE, VEC_LEN>,
+            typename SIMDVec_i_traits<SCALAR_INT_TYPE, VEC_LEN>::VEC_UINT,
+            SCALAR_INT_TYPE,
+            VEC_LEN,
+            typename SIMDVec_i_traits<SCALAR_INT_TYPE, VEC_LEN>::SCALAR_UINT_TYPE,
+            typename SIMDVec_i_traits<SCALAR_INT_TYPE, VEC_LEN>::MASK_TYPE,
+            typename SIMDVec_i_traits<SCALAR_INT_TYPE, VEC_LEN>::SWIZZLE_MASK_TYPE>,
+        public SIMDVecPackableInterface<
+            SIMDVec_i<SCALAR_INT_TYPE, VEC_LEN>,
+            typename SIMDVec_i_traits<SCALAR_INT_TYPE, VEC_LEN>::HALF_LEN_VEC_TYPE>
+    {
+    public:
+        typedef typename SIMDVec_i_traits<SCALAR_INT_TYPE, VEC_LEN>::SCALAR_UINT_TYPE   SCALAR_UINT_TYPE;
+        typedef typename SIMDVec_i_traits<SCALAR_INT_TYPE, VEC_LEN>::SCALAR_FLOAT_TYPE  SCALAR_FLOAT_TYPE;
+        typedef typename SIMDVec_i_traits<SCALAR_INT_TYPE, VEC_LEN>::VEC_UINT           VEC_UINT;
+        typedef typename SIMDVec_i_traits<SCALAR_INT_TYPE, VEC_LEN>::MASK_TYPE          MASK_TYPE;
+        typedef typename SIMDVec_i_traits<SCALAR_INT_TYPE, VEC_LEN>::SWIZZLE_MASK_TYPE  SWIZZLE_MASK_TYPE;
+        typedef typename SIMDVec_i_traits<SCALAR_INT_TYPE, VEC_LEN>::HALF_LEN_VEC_TYPE  HALF_LEN_VEC_TYPE;
+
+        typedef typename SIMDVec_i_traits<SCALAR_INT_TYPE, VEC_LEN>::SCALAR_INT_LOWER_PRECISION  SCALAR_INT_LOWER_PRECISION;
+        typedef typename SIMDVec_i_traits<SCALAR_INT_TYPE, VEC_LEN>::SCALAR_INT_HIGHER_PRECISION SCALAR_INT_HIGHER_PRECISION;
+
+        typedef typename VecExtType<SCALAR_INT_TYPE, VEC_LEN>::type     VEC_EXT_TYPE;
+        typedef typename VecExtType<SCALAR_INT_TYPE, VEC_LEN>::type     VEC_EXT_SEL_TYPE;
+        typedef typename VecExtType<SCALAR_UINT_TYPE, VEC_LEN>::type    VEC_EXT_UINT_TYPE;
+
+        // Conversion operators and packing require access to private members.
+        template<typename T, uint32_t L>
+        friend class SIMDVec_u;
+        template<typename T, uint32_t L>
+        friend class SIMDVec_i;
+        template<typename T, uint32_t L>
+        friend class SIMDVec_f;
+
+    public:
+        constexpr static uint32_t alignment() { return VEC_LEN*sizeof(SCALAR_INT_TYPE); }
+
+    private:
+        // This is the only data member and it is a low level representation of vector register.
+        alignas(alignment()) VEC_EXT_TYPE mVec;
+
+        UME_FORCE_INLINE explicit SIMDVec_i(VEC_EXT_TYPE const & x) : mVec(x) {}
+
+        // Broadcast scalar to all lanes.
+        static UME_FORCE_INLINE VEC_EXT_TYPE splat(SCALAR_INT_TYPE x) {
+            return x - VEC_EXT_TYPE();
+        }
+        // Select 'b' in lanes where mask is set, and 'a' otherwise.
+        static UME_FORCE_INLINE VEC_EXT_TYPE blendExt(MASK_TYPE const & mask, VEC_EXT_TYPE const & a, VEC_EXT_TYPE const & b) {
+            return __builtin_convertvector(mask.mMask, VEC_EXT_SEL_TYPE) ? b : a;
+        }
+        // Convert result of vector comparison to mask.
+        template<typename CMP_TYPE>
+        static UME_FORCE_INLINE MASK_TYPE toMask(CMP_TYPE const & cmp) {
+            return MASK_TYPE(__builtin_convertvector(cmp, typename MASK_TYPE::VEC_EXT_TYPE));
+        }
+
+    public:
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_i() {};
+
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_i(SCALAR_INT_TYPE x) : mVec(splat(x)) {}
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_i(
+            T i,
+            typename std::enable_if< std::is_fundamental<T>::value &&
+                                    !std::is_same<T, SCALAR_INT_TYPE>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_i(static_cast<SCALAR_INT_TYPE>(i)) {}
+
+        // LOAD-CONSTR - Construct by loading from memory
+        UME_FORCE_INLINE explicit SIMDVec_i(SCALAR_INT_TYPE const * p) { this->load(p); }
+
+        UME_FORCE_INLINE SIMDVec_i(SCALAR_INT_TYPE i0, SCALAR_INT_TYPE i1)
+        : mVec(VEC_EXT_TYPE{
+            i0, i1 })
+        {}
+
+        UME_FORCE_INLINE SIMDVec_i(SCALAR_INT_TYPE i0, SCALAR_INT_TYPE i1, SCALAR_INT_TYPE i2, SCALAR_INT_TYPE i3)
+        : mVec(VEC_EXT_TYPE{
+            i0, i1, i2, i3 })
+        {}
+
+        UME_FORCE_INLINE SIMDVec_i(
+            SCALAR_INT_TYPE i0, SCALAR_INT_TYPE i1, SCALAR_INT_TYPE i2, SCALAR_INT_TYPE i3, SCALAR_INT_TYPE i4, SCALAR_INT_TYPE i5, SCALAR_INT_TYPE i6, SCALAR_INT_TYPE i7)
+        : mVec(VEC_EXT_TYPE{
+            i0, i1, i2, i3, i4, i5, i6, i7 })
+        {}
+
+        UME_FORCE_INLINE SIMDVec_i(
+            SCALAR_INT_TYPE i0, SCALAR_INT_TYPE i1, SCALAR_INT_TYPE i2, SCALAR_INT_TYPE i3, SCALAR_INT_TYPE i4, SCALAR_INT_TYPE i5, SCALAR_INT_TYPE i6, SCALAR_INT_TYPE i7,
+            SCALAR_INT_TYPE i8, SCALAR_INT_TYPE i9, SCALAR_INT_TYPE i10, SCALAR_INT_TYPE i11, SCALAR_INT_TYPE i12, SCALAR_INT_TYPE i13, SCALAR_INT_TYPE i14, SCALAR_INT_TYPE i15)
+        : mVec(VEC_EXT_TYPE{
+            i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15 })
+        {}
+
+        UME_FORCE_INLINE SIMDVec_i(
+            SCALAR_INT_TYPE i0, SCALAR_INT_TYPE i1, SCALAR_INT_TYPE i2, SCALAR_INT_TYPE i3, SCALAR_INT_TYPE i4, SCALAR_INT_TYPE i5, SCALAR_INT_TYPE i6, SCALAR_INT_TYPE i7,
+            SCALAR_INT_TYPE i8, SCALAR_INT_TYPE i9, SCALAR_INT_TYPE i10, SCALAR_INT_TYPE i11, SCALAR_INT_TYPE i12, SCALAR_INT_TYPE i13, SCALAR_INT_TYPE i14, SCALAR_INT_TYPE i15,
+            SCALAR_INT_TYPE i16, SCALAR_INT_TYPE i17, SCALAR_INT_TYPE i18, SCALAR_INT_TYPE i19, SCALAR_INT_TYPE i20, SCALAR_INT_TYPE i21, SCALAR_INT_TYPE i22, SCALAR_INT_TYPE i23,
+            SCALAR_INT_TYPE i24, SCALAR_INT_TYPE i25, SCALAR_INT_TYPE i26, SCALAR_INT_TYPE i27, SCALAR_INT_TYPE i28, SCALAR_INT_TYPE i29, SCALAR_INT_TYPE i30, SCALAR_INT_TYPE i31)
+        : mVec(VEC_EXT_TYPE{
+            i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15,
+            i16, i17, i18, i19, i20, i21, i22, i23, i24, i25, i26, i27, i28, i29, i30, i31 })
+        {}
+
+        UME_FORCE_INLINE SIMDVec_i(
+            SCALAR_INT_TYPE i0, SCALAR_INT_TYPE i1, SCALAR_INT_TYPE i2, SCALAR_INT_TYPE i3, SCALAR_INT_TYPE i4, SCALAR_INT_TYPE i5, SCALAR_INT_TYPE i6, SCALAR_INT_TYPE i7,
+            SCALAR_INT_TYPE i8, SCALAR_INT_TYPE i9, SCALAR_INT_TYPE i10, SCALAR_INT_TYPE i11, SCALAR_INT_TYPE i12, SCALAR_INT_TYPE i13, SCALAR_INT_TYPE i14, SCALAR_INT_TYPE i15,
+            SCALAR_INT_TYPE i16, SCALAR_INT_TYPE i17, SCALAR_INT_TYPE i18, SCALAR_INT_TYPE i19, SCALAR_INT_TYPE i20, SCALAR_INT_TYPE i21, SCALAR_INT_TYPE i22, SCALAR_INT_TYPE i23,
+            SCALAR_INT_TYPE i24, SCALAR_INT_TYPE i25, SCALAR_INT_TYPE i26, SCALAR_INT_TYPE i27, SCALAR_INT_TYPE i28, SCALAR_INT_TYPE i29, SCALAR_INT_TYPE i30, SCALAR_INT_TYPE i31,
+            SCALAR_INT_TYPE i32, SCALAR_INT_TYPE i33, SCALAR_INT_TYPE i34, SCALAR_INT_TYPE i35, SCALAR_INT_TYPE i36, SCALAR_INT_TYPE i37, SCALAR_INT_TYPE i38, SCALAR_INT_TYPE i39,
+            SCALAR_INT_TYPE i40, SCALAR_INT_TYPE i41, SCALAR_INT_TYPE i42, SCALAR_INT_TYPE i43, SCALAR_INT_TYPE i44, SCALAR_INT_TYPE i45, SCALAR_INT_TYPE i46, SCALAR_INT_TYPE i47,
+            SCALAR_INT_TYPE i48, SCALAR_INT_TYPE i49, SCALAR_INT_TYPE i50, SCALAR_INT_TYPE i51, SCALAR_INT_TYPE i52, SCALAR_INT_TYPE i53, SCALAR_INT_TYPE i54, SCALAR_INT_TYPE i55,
+            SCALAR_INT_TYPE i56, SCALAR_INT_TYPE i57, SCALAR_INT_TYPE i58, SCALAR_INT_TYPE i59, SCALAR_INT_TYPE i60, SCALAR_INT_TYPE i61, SCALAR_INT_TYPE i62, SCALAR_INT_TYPE i63)
+        : mVec(VEC_EXT_TYPE{
+            i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15,
+            i16, i17, i18, i19, i20, i21, i22, i23, i24, i25, i26, i27, i28, i29, i30, i31,
+            i32, i33, i34, i35, i36, i37, i38, i39, i40, i41, i42, i43, i44, i45, i46, i47,
+            i48, i49, i50, i51, i52, i53, i54, i55, i56, i57, i58, i59, i60, i61, i62, i63 })
+        {}
+
+        UME_FORCE_INLINE SIMDVec_i(
+            SCALAR_INT_TYPE i0, SCALAR_INT_TYPE i1, SCALAR_INT_TYPE i2, SCALAR_INT_TYPE i3, SCALAR_INT_TYPE i4, SCALAR_INT_TYPE i5, SCALAR_INT_TYPE i6, SCALAR_INT_TYPE i7,
+            SCALAR_INT_TYPE i8, SCALAR_INT_TYPE i9, SCALAR_INT_TYPE i10, SCALAR_INT_TYPE i11, SCALAR_INT_TYPE i12, SCALAR_INT_TYPE i13, SCALAR_INT_TYPE i14, SCALAR_INT_TYPE i15,
+            SCALAR_INT_TYPE i16, SCALAR_INT_TYPE i17, SCALAR_INT_TYPE i18, SCALAR_INT_TYPE i19, SCALAR_INT_TYPE i20, SCALAR_INT_TYPE i21, SCALAR_INT_TYPE i22, SCALAR_INT_TYPE i23,
+            SCALAR_INT_TYPE i24, SCALAR_INT_TYPE i25, SCALAR_INT_TYPE i26, SCALAR_INT_TYPE i27, SCALAR_INT_TYPE i28, SCALAR_INT_TYPE i29, SCALAR_INT_TYPE i30, SCALAR_INT_TYPE i31,
+            SCALAR_INT_TYPE i32, SCALAR_INT_TYPE i33, SCALAR_INT_TYPE i34, SCALAR_INT_TYPE i35, SCALAR_INT_TYPE i36, SCALAR_INT_TYPE i37, SCALAR_INT_TYPE i38, SCALAR_INT_TYPE i39,
+            SCALAR_INT_TYPE i40, SCALAR_INT_TYPE i41, SCALAR_INT_TYPE i42, SCALAR_INT_TYPE i43, SCALAR_INT_TYPE i44, SCALAR_INT_TYPE i45, SCALAR_INT_TYPE i46, SCALAR_INT_TYPE i47,
+            SCALAR_INT_TYPE i48, SCALAR_INT_TYPE i49, SCALAR_INT_TYPE i50, SCALAR_INT_TYPE i51, SCALAR_INT_TYPE i52, SCALAR_INT_TYPE i53, SCALAR_INT_TYPE i54, SCALAR_INT_TYPE i55,
+            SCALAR_INT_TYPE i56, SCALAR_INT_TYPE i57, SCALAR_INT_TYPE i58, SCALAR_INT_TYPE i59, SCALAR_INT_TYPE i60, SCALAR_INT_TYPE i61, SCALAR_INT_TYPE i62, SCALAR_INT_TYPE i63,
+            SCALAR_INT_TYPE i64, SCALAR_INT_TYPE i65, SCALAR_INT_TYPE i66, SCALAR_INT_TYPE i67, SCALAR_INT_TYPE i68, SCALAR_INT_TYPE i69, SCALAR_INT_TYPE i70, SCALAR_INT_TYPE i71,
+            SCALAR_INT_TYPE i72, SCALAR_INT_TYPE i73, SCALAR_INT_TYPE i74, SCALAR_INT_TYPE i75, SCALAR_INT_TYPE i76, SCALAR_INT_TYPE i77, SCALAR_INT_TYPE i78, SCALAR_INT_TYPE i79,
+            SCALAR_INT_TYPE i80, SCALAR_INT_TYPE i81, SCALAR_INT_TYPE i82, SCALAR_INT_TYPE i83, SCALAR_INT_TYPE i84, SCALAR_INT_TYPE i85, SCALAR_INT_TYPE i86, SCALAR_INT_TYPE i87,
+            SCALAR_INT_TYPE i88, SCALAR_INT_TYPE i89, SCALAR_INT_TYPE i90, SCALAR_INT_TYPE i91, SCALAR_INT_TYPE i92, SCALAR_INT_TYPE i93, SCALAR_INT_TYPE i94, SCALAR_INT_TYPE i95,
+            SCALAR_INT_TYPE i96, SCALAR_INT_TYPE i97, SCALAR_INT_TYPE i98, SCALAR_INT_TYPE i99, SCALAR_INT_TYPE i100, SCALAR_INT_TYPE i101, SCALAR_INT_TYPE i102, SCALAR_INT_TYPE i103,
+            SCALAR_INT_TYPE i104, SCALAR_INT_TYPE i105, SCALAR_INT_TYPE i106, SCALAR_INT_TYPE i107, SCALAR_INT_TYPE i108, SCALAR_INT_TYPE i109, SCALAR_INT_TYPE i110, SCALAR_INT_TYPE i111,
+            SCALAR_INT_TYPE i112, SCALAR_INT_TYPE i113, SCALAR_INT_TYPE i114, SCALAR_INT_TYPE i115, SCALAR_INT_TYPE i116, SCALAR_INT_TYPE i117, SCALAR_INT_TYPE i118, SCALAR_INT_TYPE i119,
+            SCALAR_INT_TYPE i120, SCALAR_INT_TYPE i121, SCALAR_INT_TYPE i122, SCALAR_INT_TYPE i123, SCALAR_INT_TYPE i124, SCALAR_INT_TYPE i125, SCALAR_INT_TYPE i126, SCALAR_INT_TYPE i127)
+        : mVec(VEC_EXT_TYPE{
+            i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15,
+            i16, i17, i18, i19, i20, i21, i22, i23, i24, i25, i26, i27, i28, i29, i30, i31,
+            i32, i33, i34, i35, i36, i37, i38, i39, i40, i41, i42, i43, i44, i45, i46, i47,
+            i48, i49, i50, i51, i52, i53, i54, i55, i56, i57, i58, i59, i60, i61, i62, i63,
+            i64, i65, i66, i67, i68, i69, i70, i71, i72, i73, i74, i75, i76, i77, i78, i79,
+            i80, i81, i82, i83, i84, i85, i86, i87, i88, i89, i90, i91, i92, i93, i94, i95,
+            i96, i97, i98, i99, i100, i101, i102, i103, i104, i105, i106, i107, i108, i109, i110, i111,
+            i112, i113, i114, i115, i116, i117, i118, i119, i120, i121, i122, i123, i124, i125, i126, i127 })
+        {}
+
+        // EXTRACT
+        UME_FORCE_INLINE SCALAR_INT_TYPE extract(uint32_t index) const {
+            return mVec[index];
+        }
+        UME_FORCE_INLINE SCALAR_INT_TYPE operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_i & insert(uint32_t index, SCALAR_INT_TYPE value) {
+            mVec[index] = value;
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_i, SCALAR_INT_TYPE> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_i, SCALAR_INT_TYPE>(index, static_cast<SIMDVec_i &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_i, SCALAR_INT_TYPE, MASK_TYPE> operator() (MASK_TYPE const & mask) {
+            return IntermediateMask<SIMDVec_i, SCALAR_INT_TYPE, MASK_TYPE>(mask, static_cast<SIMDVec_i &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_i, SCALAR_INT_TYPE, MASK_TYPE> operator[] (MASK_TYPE const & mask) {
+            return IntermediateMask<SIMDVec_i, SCALAR_INT_TYPE, MASK_TYPE>(mask, static_cast<SIMDVec_i &>(*this));
+        }
+#endif
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVec_i const & src) {
+            mVec = src.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator= (SIMDVec_i const & b) {
+            return this->assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & src) {
+            mVec = blendExt(mask, mVec, src.mVec);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_i & assign(SCALAR_INT_TYPE b) {
+            mVec = splat(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator= (SCALAR_INT_TYPE b) {
+            return this->assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_i & assign(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) {
+            mVec = blendExt(mask, mVec, splat(b));
+            return *this;
+        }
+
+        // PREFETCH0
+        // PREFETCH1
+        // PREFETCH2
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_i & load(SCALAR_INT_TYPE const *p) {
+            std::memcpy(&mVec, p, sizeof(VEC_EXT_TYPE));
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_i & load(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE const *p) {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0) mVec[i] = p[i];
+            }
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_i & loada(SCALAR_INT_TYPE const *p) {
+            std::memcpy(&mVec, __builtin_assume_aligned(p, alignment()), sizeof(VEC_EXT_TYPE));
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_i & loada(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE const *p) {
+            return load(mask, p);
+        }
+
+        // STORE
+        UME_FORCE_INLINE SCALAR_INT_TYPE* store(SCALAR_INT_TYPE* p) const {
+            std::memcpy(p, &mVec, sizeof(VEC_EXT_TYPE));
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE SCALAR_INT_TYPE* store(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE* p) const {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0) p[i] = mVec[i];
+            }
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE SCALAR_INT_TYPE* storea(SCALAR_INT_TYPE* p) const {
+            std::memcpy(__builtin_assume_aligned(p, alignment()), &mVec, sizeof(VEC_EXT_TYPE));
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE SCALAR_INT_TYPE* storea(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE* p) const {
+            return store(mask, p);
+        }
+
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) const {
+            return SIMDVec_i(blendExt(mask, mVec, b.mVec));
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_i blend(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(blendExt(mask, mVec, splat(b)));
+        }
+
+        // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_i swizzle(SWIZZLE_MASK_TYPE const & sMask) const {
+            SIMDVec_i retval;
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                retval.mVec[i] = mVec[sMask[i]];
+            }
+            return retval;
+        }
+        template<int... INDICES>
+        UME_FORCE_INLINE SIMDVec_i swizzle() const {
+            static_assert(sizeof...(INDICES) == VEC_LEN, "Invalid number of template parameters.");
+            return SIMDVec_i(__builtin_shufflevector(mVec, mVec, INDICES...));
+        }
+        // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_i & swizzlea(SWIZZLE_MASK_TYPE const & sMask) {
+            mVec = swizzle(sMask).mVec;
+            return *this;
+        }
+        template<int... INDICES>
+        UME_FORCE_INLINE SIMDVec_i & swizzlea() {
+            static_assert(sizeof...(INDICES) == VEC_LEN, "Invalid number of template parameters.");
+            mVec = __builtin_shufflevector(mVec, mVec, INDICES...);
+            return *this;
+        }
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVec_i const & b) const {
+            return SIMDVec_i(mVec + b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator+ (SIMDVec_i const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) const {
+            return SIMDVec_i(blendExt(mask, mVec, mVec + b.mVec));
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_i add(SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(mVec + splat(b));
+        }
+        UME_FORCE_INLINE SIMDVec_i operator+ (SCALAR_INT_TYPE b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_i add(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(blendExt(mask, mVec, mVec + splat(b)));
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVec_i const & b) {
+            mVec = mVec + b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator+= (SIMDVec_i const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) {
+            mVec = blendExt(mask, mVec, mVec + b.mVec);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_i & adda(SCALAR_INT_TYPE b) {
+            mVec = mVec + splat(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator+= (SCALAR_INT_TYPE b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_i & adda(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec + splat(b));
+            return *this;
+        }
+
+        // Signed saturation: the operation overflows when the sign of the wrapped
+        // result differs from the sign of the operands. Saturated value is
+        // MAX for non-negative 'a' and MIN for negative 'a'.
+        static UME_FORCE_INLINE VEC_EXT_TYPE addSaturatedExt(VEC_EXT_TYPE const & a, VEC_EXT_TYPE const & b) {
+            VEC_EXT_TYPE t0 = (VEC_EXT_TYPE)((VEC_EXT_UINT_TYPE)a + (VEC_EXT_UINT_TYPE)b);
+            VEC_EXT_TYPE t1 = (a >> (sizeof(SCALAR_INT_TYPE)*8 - 1)) ^ std::numeric_limits<SCALAR_INT_TYPE>::max();
+            return (((a ^ t0) & (b ^ t0)) < 0) ? t1 : t0;
+        }
+        static UME_FORCE_INLINE VEC_EXT_TYPE subSaturatedExt(VEC_EXT_TYPE const & a, VEC_EXT_TYPE const & b) {
+            VEC_EXT_TYPE t0 = (VEC_EXT_TYPE)((VEC_EXT_UINT_TYPE)a - (VEC_EXT_UINT_TYPE)b);
+            VEC_EXT_TYPE t1 = (a >> (sizeof(SCALAR_INT_TYPE)*8 - 1)) ^ std::numeric_limits<SCALAR_INT_TYPE>::max();
+            return (((a ^ b) & (a ^ t0)) < 0) ? t1 : t0;
+        }
+
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVec_i const & b) const {
+            return SIMDVec_i(addSaturatedExt(mVec, b.mVec));
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) const {
+            return SIMDVec_i(blendExt(mask, mVec, addSaturatedExt(mVec, b.mVec)));
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(addSaturatedExt(mVec, splat(b)));
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_i sadd(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(blendExt(mask, mVec, addSaturatedExt(mVec, splat(b))));
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVec_i const & b) {
+            mVec = addSaturatedExt(mVec, b.mVec);
+            return *this;
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) {
+            mVec = blendExt(mask, mVec, addSaturatedExt(mVec, b.mVec));
+            return *this;
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SCALAR_INT_TYPE b) {
+            mVec = addSaturatedExt(mVec, splat(b));
+            return *this;
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_i & sadda(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) {
+            mVec = blendExt(mask, mVec, addSaturatedExt(mVec, splat(b)));
+            return *this;
+        }
+        // POSTINC
+        UME_FORCE_INLINE SIMDVec_i postinc() {
+            SIMDVec_i t0(mVec);
+            mVec = mVec + SCALAR_INT_TYPE(1);
+            return t0;
+        }
+        UME_FORCE_INLINE SIMDVec_i operator++ (int) {
+            return postinc();
+        }
+        // MPOSTINC
+        UME_FORCE_INLINE SIMDVec_i postinc(SIMDVecMask<VEC_LEN> const & mask) {
+            SIMDVec_i t0(mVec);
+            mVec = blendExt(mask, mVec, mVec + SCALAR_INT_TYPE(1));
+            return t0;
+        }
+        // PREFINC
+        UME_FORCE_INLINE SIMDVec_i & prefinc() {
+            mVec = mVec + SCALAR_INT_TYPE(1);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator++ () {
+            return prefinc();
+        }
+        // MPREFINC
+        UME_FORCE_INLINE SIMDVec_i & prefinc(SIMDVecMask<VEC_LEN> const & mask) {
+            mVec = blendExt(mask, mVec, mVec + SCALAR_INT_TYPE(1));
+            return *this;
+        }
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVec_i const & b) const {
+            return SIMDVec_i(mVec - b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- (SIMDVec_i const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) const {
+            return SIMDVec_i(blendExt(mask, mVec, mVec - b.mVec));
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_i sub(SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(mVec - splat(b));
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- (SCALAR_INT_TYPE b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_i sub(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(blendExt(mask, mVec, mVec - splat(b)));
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVec_i const & b) {
+            mVec = mVec - b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-= (SIMDVec_i const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) {
+            mVec = blendExt(mask, mVec, mVec - b.mVec);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_i & suba(SCALAR_INT_TYPE b) {
+            mVec = mVec - splat(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-= (SCALAR_INT_TYPE b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_i & suba(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec - splat(b));
+            return *this;
+        }
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVec_i const & b) const {
+            return SIMDVec_i(subSaturatedExt(mVec, b.mVec));
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) const {
+            return SIMDVec_i(blendExt(mask, mVec, subSaturatedExt(mVec, b.mVec)));
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(subSaturatedExt(mVec, splat(b)));
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_i ssub(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(blendExt(mask, mVec, subSaturatedExt(mVec, splat(b))));
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVec_i const & b) {
+            mVec = subSaturatedExt(mVec, b.mVec);
+            return *this;
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) {
+            mVec = blendExt(mask, mVec, subSaturatedExt(mVec, b.mVec));
+            return *this;
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SCALAR_INT_TYPE b) {
+            mVec = subSaturatedExt(mVec, splat(b));
+            return *this;
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_i & ssuba(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) {
+            mVec = blendExt(mask, mVec, subSaturatedExt(mVec, splat(b)));
+            return *this;
+        }
+        // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVec_i const & b) const {
+            return SIMDVec_i(b.mVec - mVec);
+        }
+        // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) const {
+            return SIMDVec_i(blendExt(mask, b.mVec, b.mVec - mVec));
+        }
+        // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_i subfrom(SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(splat(b) - mVec);
+        }
+        // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_i subfrom(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(blendExt(mask, splat(b), splat(b) - mVec));
+        }
+        // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVec_i const & b) {
+            mVec = b.mVec - mVec;
+            return *this;
+        }
+        // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) {
+            mVec = blendExt(mask, b.mVec, b.mVec - mVec);
+            return *this;
+        }
+        // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SCALAR_INT_TYPE b) {
+            mVec = splat(b) - mVec;
+            return *this;
+        }
+        // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_i & subfroma(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) {
+            mVec = blendExt(mask, splat(b), splat(b) - mVec);
+            return *this;
+        }
+        // POSTDEC
+        UME_FORCE_INLINE SIMDVec_i postdec() {
+            SIMDVec_i t0(mVec);
+            mVec = mVec - SCALAR_INT_TYPE(1);
+            return t0;
+        }
+        UME_FORCE_INLINE SIMDVec_i operator-- (int) {
+            return postdec();
+        }
+        // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_i postdec(SIMDVecMask<VEC_LEN> const & mask) {
+            SIMDVec_i t0(mVec);
+            mVec = blendExt(mask, mVec, mVec - SCALAR_INT_TYPE(1));
+            return t0;
+        }
+        // PREFDEC
+        UME_FORCE_INLINE SIMDVec_i & prefdec() {
+            mVec = mVec - SCALAR_INT_TYPE(1);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator-- () {
+            return prefdec();
+        }
+        // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_i & prefdec(SIMDVecMask<VEC_LEN> const & mask) {
+            mVec = blendExt(mask, mVec, mVec - SCALAR_INT_TYPE(1));
+            return *this;
+        }
+        // MULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVec_i const & b) const {
+            return SIMDVec_i(mVec * b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (SIMDVec_i const & b) const {
+            return mul(b);
+        }
+        // MMULV
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) const {
+            return SIMDVec_i(blendExt(mask, mVec, mVec * b.mVec));
+        }
+        // MULS
+        UME_FORCE_INLINE SIMDVec_i mul(SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(mVec * splat(b));
+        }
+        UME_FORCE_INLINE SIMDVec_i operator* (SCALAR_INT_TYPE b) const {
+            return mul(b);
+        }
+        // MMULS
+        UME_FORCE_INLINE SIMDVec_i mul(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(blendExt(mask, mVec, mVec * splat(b)));
+        }
+        // MULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVec_i const & b) {
+            mVec = mVec * b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (SIMDVec_i const & b) {
+            return mula(b);
+        }
+        // MMULVA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) {
+            mVec = blendExt(mask, mVec, mVec * b.mVec);
+            return *this;
+        }
+        // MULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(SCALAR_INT_TYPE b) {
+            mVec = mVec * splat(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator*= (SCALAR_INT_TYPE b) {
+            return mula(b);
+        }
+        // MMULSA
+        UME_FORCE_INLINE SIMDVec_i & mula(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec * splat(b));
+            return *this;
+        }
+        // DIVV
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVec_i const & b) const {
+            return SIMDVec_i(mVec / b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (SIMDVec_i const & b) const {
+            return div(b);
+        }
+        // MDIVV
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) const {
+            return SIMDVec_i(blendExt(mask, mVec, mVec / blendExt(mask, splat(SCALAR_INT_TYPE(1)), b.mVec)));
+        }
+        // DIVS
+        UME_FORCE_INLINE SIMDVec_i div(SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(mVec / splat(b));
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (SCALAR_INT_TYPE b) const {
+            return div(b);
+        }
+        // MDIVS
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(blendExt(mask, mVec, mVec / blendExt(mask, splat(SCALAR_INT_TYPE(1)), splat(b))));
+        }
+        // DIVVA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVec_i const & b) {
+            mVec = mVec / b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDVec_i const & b) {
+            return diva(b);
+        }
+        // MDIVVA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) {
+            mVec = blendExt(mask, mVec, mVec / blendExt(mask, splat(SCALAR_INT_TYPE(1)), b.mVec));
+            return *this;
+        }
+        // DIVSA
+        UME_FORCE_INLINE SIMDVec_i & diva(SCALAR_INT_TYPE b) {
+            mVec = mVec / splat(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (SCALAR_INT_TYPE b) {
+            return diva(b);
+        }
+        // MDIVSA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec / blendExt(mask, splat(SCALAR_INT_TYPE(1)), splat(b)));
+            return *this;
+        }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDDivisor<SCALAR_INT_TYPE> const & b) const {
+            return div(b.divisor());
+        }
+        UME_FORCE_INLINE SIMDVec_i operator/ (SIMDDivisor<SCALAR_INT_TYPE> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_i div(SIMDVecMask<VEC_LEN> const & mask, SIMDDivisor<SCALAR_INT_TYPE> const & b) const {
+            return div(mask, b.divisor());
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDDivisor<SCALAR_INT_TYPE> const & b) {
+            return diva(b.divisor());
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator/= (SIMDDivisor<SCALAR_INT_TYPE> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_i & diva(SIMDVecMask<VEC_LEN> const & mask, SIMDDivisor<SCALAR_INT_TYPE> const & b) {
+            return diva(mask, b.divisor());
+        }
+        // RCP
+        UME_FORCE_INLINE SIMDVec_i rcp() const {
+            return SIMDVec_i(splat(SCALAR_INT_TYPE(1)) / mVec);
+        }
+        // MRCP
+        UME_FORCE_INLINE SIMDVec_i rcp(SIMDVecMask<VEC_LEN> const & mask) const {
+            return SIMDVec_i(blendExt(mask, mVec, splat(SCALAR_INT_TYPE(1)) / blendExt(mask, splat(SCALAR_INT_TYPE(1)), mVec)));
+        }
+        // RCPS
+        UME_FORCE_INLINE SIMDVec_i rcp(SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(splat(b) / mVec);
+        }
+        // MRCPS
+        UME_FORCE_INLINE SIMDVec_i rcp(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(blendExt(mask, mVec, splat(b) / blendExt(mask, splat(SCALAR_INT_TYPE(1)), mVec)));
+        }
+        // RCPA
+        UME_FORCE_INLINE SIMDVec_i & rcpa() {
+            mVec = splat(SCALAR_INT_TYPE(1)) / mVec;
+            return *this;
+        }
+        // MRCPA
+        UME_FORCE_INLINE SIMDVec_i & rcpa(SIMDVecMask<VEC_LEN> const & mask) {
+            mVec = blendExt(mask, mVec, splat(SCALAR_INT_TYPE(1)) / blendExt(mask, splat(SCALAR_INT_TYPE(1)), mVec));
+            return *this;
+        }
+        // RCPSA
+        UME_FORCE_INLINE SIMDVec_i & rcpa(SCALAR_INT_TYPE b) {
+            mVec = splat(b) / mVec;
+            return *this;
+        }
+        // MRCPSA
+        UME_FORCE_INLINE SIMDVec_i & rcpa(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) {
+            mVec = blendExt(mask, mVec, splat(b) / blendExt(mask, splat(SCALAR_INT_TYPE(1)), mVec));
+            return *this;
+        }
+
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpeq(SIMDVec_i const & b) const {
+            return toMask(mVec == b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator== (SIMDVec_i const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpeq(SCALAR_INT_TYPE b) const {
+            return toMask(mVec == splat(b));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator== (SCALAR_INT_TYPE b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpne(SIMDVec_i const & b) const {
+            return toMask(mVec != b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator!= (SIMDVec_i const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpne(SCALAR_INT_TYPE b) const {
+            return toMask(mVec != splat(b));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator!= (SCALAR_INT_TYPE b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpgt(SIMDVec_i const & b) const {
+            return toMask(mVec > b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator> (SIMDVec_i const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpgt(SCALAR_INT_TYPE b) const {
+            return toMask(mVec > splat(b));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator> (SCALAR_INT_TYPE b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmplt(SIMDVec_i const & b) const {
+            return toMask(mVec < b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator< (SIMDVec_i const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmplt(SCALAR_INT_TYPE b) const {
+            return toMask(mVec < splat(b));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator< (SCALAR_INT_TYPE b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpge(SIMDVec_i const & b) const {
+            return toMask(mVec >= b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator>= (SIMDVec_i const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpge(SCALAR_INT_TYPE b) const {
+            return toMask(mVec >= splat(b));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator>= (SCALAR_INT_TYPE b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmple(SIMDVec_i const & b) const {
+            return toMask(mVec <= b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator<= (SIMDVec_i const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmple(SCALAR_INT_TYPE b) const {
+            return toMask(mVec <= splat(b));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator<= (SCALAR_INT_TYPE b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_i const & b) const {
+            return cmpeq(b).hland();
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(SCALAR_INT_TYPE b) const {
+            return cmpeq(b).hland();
+        }
+
+        // UNIQUE
+
+        // HADD
+        UME_FORCE_INLINE SCALAR_INT_TYPE hadd() const {
+            return VecExtReduce<SCALAR_INT_TYPE, VEC_LEN>::template apply<VecExtAdd>(mVec);
+        }
+        // MHADD
+        UME_FORCE_INLINE SCALAR_INT_TYPE hadd(SIMDVecMask<VEC_LEN> const & mask) const {
+            return VecExtReduce<SCALAR_INT_TYPE, VEC_LEN>::template apply<VecExtAdd>(blendExt(mask, splat(SCALAR_INT_TYPE(0)), mVec));
+        }
+        // HADDS
+        UME_FORCE_INLINE SCALAR_INT_TYPE hadd(SCALAR_INT_TYPE b) const {
+            return b + hadd();
+        }
+        // MHADDS
+        UME_FORCE_INLINE SCALAR_INT_TYPE hadd(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) const {
+            return b + hadd(mask);
+        }
+        // HMUL
+        UME_FORCE_INLINE SCALAR_INT_TYPE hmul() const {
+            return VecExtReduce<SCALAR_INT_TYPE, VEC_LEN>::template apply<VecExtMul>(mVec);
+        }
+        // MHMUL
+        UME_FORCE_INLINE SCALAR_INT_TYPE hmul(SIMDVecMask<VEC_LEN> const & mask) const {
+            return VecExtReduce<SCALAR_INT_TYPE, VEC_LEN>::template apply<VecExtMul>(blendExt(mask, splat(SCALAR_INT_TYPE(1)), mVec));
+        }
+        // HMULS
+        UME_FORCE_INLINE SCALAR_INT_TYPE hmul(SCALAR_INT_TYPE b) const {
+            return b * hmul();
+        }
+        // MHMULS
+        UME_FORCE_INLINE SCALAR_INT_TYPE hmul(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) const {
+            return b * hmul(mask);
+        }
+
+        // FMULADDV
+        UME_FORCE_INLINE SIMDVec_i fmuladd(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            return SIMDVec_i(mVec * b.mVec + c.mVec);
+        }
+        // MFMULADDV
+        UME_FORCE_INLINE SIMDVec_i fmuladd(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            return SIMDVec_i(blendExt(mask, mVec, mVec * b.mVec + c.mVec));
+        }
+        // FMULSUBV
+        UME_FORCE_INLINE SIMDVec_i fmulsub(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            return SIMDVec_i(mVec * b.mVec - c.mVec);
+        }
+        // MFMULSUBV
+        UME_FORCE_INLINE SIMDVec_i fmulsub(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            return SIMDVec_i(blendExt(mask, mVec, mVec * b.mVec - c.mVec));
+        }
+        // FADDMULV
+        UME_FORCE_INLINE SIMDVec_i faddmul(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            return SIMDVec_i((mVec + b.mVec) * c.mVec);
+        }
+        // MFADDMULV
+        UME_FORCE_INLINE SIMDVec_i faddmul(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            return SIMDVec_i(blendExt(mask, mVec, (mVec + b.mVec) * c.mVec));
+        }
+        // FSUBMULV
+        UME_FORCE_INLINE SIMDVec_i fsubmul(SIMDVec_i const & b, SIMDVec_i const & c) const {
+            return SIMDVec_i((mVec - b.mVec) * c.mVec);
+        }
+        // MFSUBMULV
+        UME_FORCE_INLINE SIMDVec_i fsubmul(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b, SIMDVec_i const & c) const {
+            return SIMDVec_i(blendExt(mask, mVec, (mVec - b.mVec) * c.mVec));
+        }
+
+        // MAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVec_i const & b) const {
+            return SIMDVec_i((mVec > b.mVec) ? mVec : b.mVec);
+        }
+        // MMAXV
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) const {
+            return SIMDVec_i(blendExt(mask, mVec, (mVec > b.mVec) ? mVec : b.mVec));
+        }
+        // MAXS
+        UME_FORCE_INLINE SIMDVec_i max(SCALAR_INT_TYPE b) const {
+            return SIMDVec_i((mVec > splat(b)) ? mVec : splat(b));
+        }
+        // MMAXS
+        UME_FORCE_INLINE SIMDVec_i max(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(blendExt(mask, mVec, (mVec > splat(b)) ? mVec : splat(b)));
+        }
+        // MAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVec_i const & b) {
+            mVec = (mVec > b.mVec) ? mVec : b.mVec;
+            return *this;
+        }
+        // MMAXVA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) {
+            mVec = blendExt(mask, mVec, (mVec > b.mVec) ? mVec : b.mVec);
+            return *this;
+        }
+        // MAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SCALAR_INT_TYPE b) {
+            mVec = (mVec > splat(b)) ? mVec : splat(b);
+            return *this;
+        }
+        // MMAXSA
+        UME_FORCE_INLINE SIMDVec_i & maxa(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) {
+            mVec = blendExt(mask, mVec, (mVec > splat(b)) ? mVec : splat(b));
+            return *this;
+        }
+        // MINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVec_i const & b) const {
+            return SIMDVec_i((mVec < b.mVec) ? mVec : b.mVec);
+        }
+        // MMINV
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) const {
+            return SIMDVec_i(blendExt(mask, mVec, (mVec < b.mVec) ? mVec : b.mVec));
+        }
+        // MINS
+        UME_FORCE_INLINE SIMDVec_i min(SCALAR_INT_TYPE b) const {
+            return SIMDVec_i((mVec < splat(b)) ? mVec : splat(b));
+        }
+        // MMINS
+        UME_FORCE_INLINE SIMDVec_i min(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(blendExt(mask, mVec, (mVec < splat(b)) ? mVec : splat(b)));
+        }
+        // MINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVec_i const & b) {
+            mVec = (mVec < b.mVec) ? mVec : b.mVec;
+            return *this;
+        }
+        // MMINVA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) {
+            mVec = blendExt(mask, mVec, (mVec < b.mVec) ? mVec : b.mVec);
+            return *this;
+        }
+        // MINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(SCALAR_INT_TYPE b) {
+            mVec = (mVec < splat(b)) ? mVec : splat(b);
+            return *this;
+        }
+        // MMINSA
+        UME_FORCE_INLINE SIMDVec_i & mina(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) {
+            mVec = blendExt(mask, mVec, (mVec < splat(b)) ? mVec : splat(b));
+            return *this;
+        }
+        // HMAX
+        UME_FORCE_INLINE SCALAR_INT_TYPE hmax() const {
+            return VecExtReduce<SCALAR_INT_TYPE, VEC_LEN>::template apply<VecExtMax>(mVec);
+        }
+        // MHMAX
+        UME_FORCE_INLINE SCALAR_INT_TYPE hmax(SIMDVecMask<VEC_LEN> const & mask) const {
+            return VecExtReduce<SCALAR_INT_TYPE, VEC_LEN>::template apply<VecExtMax>(blendExt(mask, splat(std::numeric_limits<SCALAR_INT_TYPE>::lowest()), mVec));
+        }
+        // IMAX
+        UME_FORCE_INLINE uint32_t imax() const {
+            SCALAR_INT_TYPE t0 = hmax();
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mVec[i] == t0) return i;
+            }
+            return 0;
+        }
+        // MIMAX
+        UME_FORCE_INLINE uint32_t imax(SIMDVecMask<VEC_LEN> const & mask) const {
+            SCALAR_INT_TYPE t0 = hmax(mask);
+            if (t0 == std::numeric_limits<SCALAR_INT_TYPE>::lowest()) return 0xFFFFFFFF;
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0 && mVec[i] == t0) return i;
+            }
+            return 0xFFFFFFFF;
+        }
+        // HMIN
+        UME_FORCE_INLINE SCALAR_INT_TYPE hmin() const {
+            return VecExtReduce<SCALAR_INT_TYPE, VEC_LEN>::template apply<VecExtMin>(mVec);
+        }
+        // MHMIN
+        UME_FORCE_INLINE SCALAR_INT_TYPE hmin(SIMDVecMask<VEC_LEN> const & mask) const {
+            return VecExtReduce<SCALAR_INT_TYPE, VEC_LEN>::template apply<VecExtMin>(blendExt(mask, splat(std::numeric_limits<SCALAR_INT_TYPE>::max()), mVec));
+        }
+        // IMIN
+        UME_FORCE_INLINE uint32_t imin() const {
+            SCALAR_INT_TYPE t0 = hmin();
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mVec[i] == t0) return i;
+            }
+            return 0;
+        }
+        // MIMIN
+        UME_FORCE_INLINE uint32_t imin(SIMDVecMask<VEC_LEN> const & mask) const {
+            SCALAR_INT_TYPE t0 = hmin(mask);
+            if (t0 == std::numeric_limits<SCALAR_INT_TYPE>::max()) return 0xFFFFFFFF;
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0 && mVec[i] == t0) return i;
+            }
+            return 0xFFFFFFFF;
+        }
+
+        // BANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVec_i const & b) const {
+            return SIMDVec_i(mVec & b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator& (SIMDVec_i const & b) const {
+            return band(b);
+        }
+        // MBANDV
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) const {
+            return SIMDVec_i(blendExt(mask, mVec, mVec & b.mVec));
+        }
+        // BANDS
+        UME_FORCE_INLINE SIMDVec_i band(SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(mVec & splat(b));
+        }
+        UME_FORCE_INLINE SIMDVec_i operator& (SCALAR_INT_TYPE b) const {
+            return band(b);
+        }
+        // MBANDS
+        UME_FORCE_INLINE SIMDVec_i band(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(blendExt(mask, mVec, mVec & splat(b)));
+        }
+        // BANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVec_i const & b) {
+            mVec = mVec & b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (SIMDVec_i const & b) {
+            return banda(b);
+        }
+        // MBANDVA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) {
+            mVec = blendExt(mask, mVec, mVec & b.mVec);
+            return *this;
+        }
+        // BANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(SCALAR_INT_TYPE b) {
+            mVec = mVec & splat(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator&= (SCALAR_INT_TYPE b) {
+            return banda(b);
+        }
+        // MBANDSA
+        UME_FORCE_INLINE SIMDVec_i & banda(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec & splat(b));
+            return *this;
+        }
+        // BORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVec_i const & b) const {
+            return SIMDVec_i(mVec | b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (SIMDVec_i const & b) const {
+            return bor(b);
+        }
+        // MBORV
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) const {
+            return SIMDVec_i(blendExt(mask, mVec, mVec | b.mVec));
+        }
+        // BORS
+        UME_FORCE_INLINE SIMDVec_i bor(SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(mVec | splat(b));
+        }
+        UME_FORCE_INLINE SIMDVec_i operator| (SCALAR_INT_TYPE b) const {
+            return bor(b);
+        }
+        // MBORS
+        UME_FORCE_INLINE SIMDVec_i bor(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(blendExt(mask, mVec, mVec | splat(b)));
+        }
+        // BORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVec_i const & b) {
+            mVec = mVec | b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (SIMDVec_i const & b) {
+            return bora(b);
+        }
+        // MBORVA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) {
+            mVec = blendExt(mask, mVec, mVec | b.mVec);
+            return *this;
+        }
+        // BORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(SCALAR_INT_TYPE b) {
+            mVec = mVec | splat(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator|= (SCALAR_INT_TYPE b) {
+            return bora(b);
+        }
+        // MBORSA
+        UME_FORCE_INLINE SIMDVec_i & bora(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec | splat(b));
+            return *this;
+        }
+        // BXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVec_i const & b) const {
+            return SIMDVec_i(mVec ^ b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (SIMDVec_i const & b) const {
+            return bxor(b);
+        }
+        // MBXORV
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) const {
+            return SIMDVec_i(blendExt(mask, mVec, mVec ^ b.mVec));
+        }
+        // BXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(mVec ^ splat(b));
+        }
+        UME_FORCE_INLINE SIMDVec_i operator^ (SCALAR_INT_TYPE b) const {
+            return bxor(b);
+        }
+        // MBXORS
+        UME_FORCE_INLINE SIMDVec_i bxor(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(blendExt(mask, mVec, mVec ^ splat(b)));
+        }
+        // BXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVec_i const & b) {
+            mVec = mVec ^ b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (SIMDVec_i const & b) {
+            return bxora(b);
+        }
+        // MBXORVA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) {
+            mVec = blendExt(mask, mVec, mVec ^ b.mVec);
+            return *this;
+        }
+        // BXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SCALAR_INT_TYPE b) {
+            mVec = mVec ^ splat(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator^= (SCALAR_INT_TYPE b) {
+            return bxora(b);
+        }
+        // MBXORSA
+        UME_FORCE_INLINE SIMDVec_i & bxora(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec ^ splat(b));
+            return *this;
+        }
+        // BNOT
+        UME_FORCE_INLINE SIMDVec_i bnot() const {
+            return SIMDVec_i(~mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator~ () const {
+            return bnot();
+        }
+        // MBNOT
+        UME_FORCE_INLINE SIMDVec_i bnot(SIMDVecMask<VEC_LEN> const & mask) const {
+            return SIMDVec_i(blendExt(mask, mVec, ~mVec));
+        }
+        // BNOTA
+        UME_FORCE_INLINE SIMDVec_i & bnota() {
+            mVec = ~mVec;
+            return *this;
+        }
+        // MBNOTA
+        UME_FORCE_INLINE SIMDVec_i & bnota(SIMDVecMask<VEC_LEN> const & mask) {
+            mVec = blendExt(mask, mVec, ~mVec);
+            return *this;
+        }
+
+        // HBAND
+        UME_FORCE_INLINE SCALAR_INT_TYPE hband() const {
+            return VecExtReduce<SCALAR_INT_TYPE, VEC_LEN>::template apply<VecExtAnd>(mVec);
+        }
+        // MHBAND
+        UME_FORCE_INLINE SCALAR_INT_TYPE hband(SIMDVecMask<VEC_LEN> const & mask) const {
+            return VecExtReduce<SCALAR_INT_TYPE, VEC_LEN>::template apply<VecExtAnd>(blendExt(mask, splat(SCALAR_INT_TYPE(~SCALAR_INT_TYPE(0))), mVec));
+        }
+        // HBANDS
+        UME_FORCE_INLINE SCALAR_INT_TYPE hband(SCALAR_INT_TYPE b) const {
+            return b & hband();
+        }
+        // MHBANDS
+        UME_FORCE_INLINE SCALAR_INT_TYPE hband(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) const {
+            return b & hband(mask);
+        }
+        // HBOR
+        UME_FORCE_INLINE SCALAR_INT_TYPE hbor() const {
+            return VecExtReduce<SCALAR_INT_TYPE, VEC_LEN>::template apply<VecExtOr>(mVec);
+        }
+        // MHBOR
+        UME_FORCE_INLINE SCALAR_INT_TYPE hbor(SIMDVecMask<VEC_LEN> const & mask) const {
+            return VecExtReduce<SCALAR_INT_TYPE, VEC_LEN>::template apply<VecExtOr>(blendExt(mask, splat(SCALAR_INT_TYPE(0)), mVec));
+        }
+        // HBORS
+        UME_FORCE_INLINE SCALAR_INT_TYPE hbor(SCALAR_INT_TYPE b) const {
+            return b | hbor();
+        }
+        // MHBORS
+        UME_FORCE_INLINE SCALAR_INT_TYPE hbor(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) const {
+            return b | hbor(mask);
+        }
+        // HBXOR
+        UME_FORCE_INLINE SCALAR_INT_TYPE hbxor() const {
+            return VecExtReduce<SCALAR_INT_TYPE, VEC_LEN>::template apply<VecExtXor>(mVec);
+        }
+        // MHBXOR
+        UME_FORCE_INLINE SCALAR_INT_TYPE hbxor(SIMDVecMask<VEC_LEN> const & mask) const {
+            return VecExtReduce<SCALAR_INT_TYPE, VEC_LEN>::template apply<VecExtXor>(blendExt(mask, splat(SCALAR_INT_TYPE(0)), mVec));
+        }
+        // HBXORS
+        UME_FORCE_INLINE SCALAR_INT_TYPE hbxor(SCALAR_INT_TYPE b) const {
+            return b ^ hbxor();
+        }
+        // MHBXORS
+        UME_FORCE_INLINE SCALAR_INT_TYPE hbxor(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) const {
+            return b ^ hbxor(mask);
+        }
+
+        // REMV
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVec_i const & b) const {
+            return SIMDVec_i(mVec % b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (SIMDVec_i const & b) const {
+            return rem(b);
+        }
+        // MREMV
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) const {
+            return SIMDVec_i(blendExt(mask, mVec, mVec % blendExt(mask, splat(SCALAR_INT_TYPE(1)), b.mVec)));
+        }
+        // REMS
+        UME_FORCE_INLINE SIMDVec_i rem(SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(mVec % splat(b));
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (SCALAR_INT_TYPE b) const {
+            return rem(b);
+        }
+        // MREMS
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) const {
+            return SIMDVec_i(blendExt(mask, mVec, mVec % blendExt(mask, splat(SCALAR_INT_TYPE(1)), splat(b))));
+        }
+        // REMVA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVec_i const & b) {
+            mVec = mVec % b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (SIMDVec_i const & b) {
+            return rema(b);
+        }
+        // MREMVA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_i const & b) {
+            mVec = blendExt(mask, mVec, mVec % blendExt(mask, splat(SCALAR_INT_TYPE(1)), b.mVec));
+            return *this;
+        }
+        // REMSA
+        UME_FORCE_INLINE SIMDVec_i & rema(SCALAR_INT_TYPE b) {
+            mVec = mVec % splat(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (SCALAR_INT_TYPE b) {
+            return rema(b);
+        }
+        // MREMSA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec % blendExt(mask, splat(SCALAR_INT_TYPE(1)), splat(b)));
+            return *this;
+        }
+        // REMD
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDDivisor<SCALAR_INT_TYPE> const & b) const {
+            return rem(b.divisor());
+        }
+        UME_FORCE_INLINE SIMDVec_i operator% (SIMDDivisor<SCALAR_INT_TYPE> const & b) const {
+            return rem(b);
+        }
+        // MREMD
+        UME_FORCE_INLINE SIMDVec_i rem(SIMDVecMask<VEC_LEN> const & mask, SIMDDivisor<SCALAR_INT_TYPE> const & b) const {
+            return rem(mask, b.divisor());
+        }
+        // REMDA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDDivisor<SCALAR_INT_TYPE> const & b) {
+            return rema(b.divisor());
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator%= (SIMDDivisor<SCALAR_INT_TYPE> const & b) {
+            return rema(b);
+        }
+        // MREMDA
+        UME_FORCE_INLINE SIMDVec_i & rema(SIMDVecMask<VEC_LEN> const & mask, SIMDDivisor<SCALAR_INT_TYPE> const & b) {
+            return rema(mask, b.divisor());
+        }
+
+        // LANDV
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> land(SIMDVec_i const & b) const {
+            return toMask((mVec != 0) & (b.mVec != 0));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator&& (SIMDVec_i const & b) const {
+            return land(b);
+        }
+        // LANDS
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> land(bool b) const {
+            return toMask((mVec != 0) & -VEC_EXT_SEL_TYPE(b - VEC_EXT_SEL_TYPE()));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator&& (bool b) const {
+            return land(b);
+        }
+        // LORV
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> lor(SIMDVec_i const & b) const {
+            return toMask((mVec != 0) | (b.mVec != 0));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator|| (SIMDVec_i const & b) const {
+            return lor(b);
+        }
+        // LORS
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> lor(bool b) const {
+            return toMask((mVec != 0) | -VEC_EXT_SEL_TYPE(b - VEC_EXT_SEL_TYPE()));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator|| (bool b) const {
+            return lor(b);
+        }
+
+        // GATHERS
+        UME_FORCE_INLINE SIMDVec_i & gather(SCALAR_INT_TYPE const * baseAddr, SCALAR_UINT_TYPE const * indices) {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                mVec[i] = baseAddr[indices[i]];
+            }
+            return *this;
+        }
+        // MGATHERS
+        UME_FORCE_INLINE SIMDVec_i & gather(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE const * baseAddr, SCALAR_UINT_TYPE const * indices) {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0) mVec[i] = baseAddr[indices[i]];
+            }
+            return *this;
+        }
+        // GATHERV
+        UME_FORCE_INLINE SIMDVec_i & gather(SCALAR_INT_TYPE const * baseAddr, SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & indices) {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                mVec[i] = baseAddr[indices.mVec[i]];
+            }
+            return *this;
+        }
+        // MGATHERV
+        UME_FORCE_INLINE SIMDVec_i & gather(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE const * baseAddr, SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & indices) {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0) mVec[i] = baseAddr[indices.mVec[i]];
+            }
+            return *this;
+        }
+        // SCATTERS
+        UME_FORCE_INLINE SCALAR_INT_TYPE* scatter(SCALAR_INT_TYPE* baseAddr, SCALAR_UINT_TYPE* indices) const {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                baseAddr[indices[i]] = mVec[i];
+            }
+            return baseAddr;
+        }
+        // MSCATTERS
+        UME_FORCE_INLINE SCALAR_INT_TYPE* scatter(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE* baseAddr, SCALAR_UINT_TYPE* indices) const {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0) baseAddr[indices[i]] = mVec[i];
+            }
+            return baseAddr;
+        }
+        // SCATTERV
+        UME_FORCE_INLINE SCALAR_INT_TYPE* scatter(SCALAR_INT_TYPE* baseAddr, SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & indices) const {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                baseAddr[indices.mVec[i]] = mVec[i];
+            }
+            return baseAddr;
+        }
+        // MSCATTERV
+        UME_FORCE_INLINE SCALAR_INT_TYPE* scatter(SIMDVecMask<VEC_LEN> const & mask, SCALAR_INT_TYPE* baseAddr, SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & indices) const {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0) baseAddr[indices.mVec[i]] = mVec[i];
+            }
+            return baseAddr;
+        }
+
+        // LSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & b) const {
+            return SIMDVec_i(mVec << (VEC_EXT_TYPE)b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & b) const {
+            return lsh(b);
+        }
+        // MLSHV
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & b) const {
+            return SIMDVec_i(blendExt(mask, mVec, mVec << (VEC_EXT_TYPE)b.mVec));
+        }
+        // LSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(SCALAR_UINT_TYPE b) const {
+            return SIMDVec_i(mVec << b);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator<< (SCALAR_UINT_TYPE b) const {
+            return lsh(b);
+        }
+        // MLSHS
+        UME_FORCE_INLINE SIMDVec_i lsh(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return SIMDVec_i(blendExt(mask, mVec, mVec << b));
+        }
+        // LSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & b) {
+            mVec = mVec << (VEC_EXT_TYPE)b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & b) {
+            return lsha(b);
+        }
+        // MLSHVA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & b) {
+            mVec = blendExt(mask, mVec, mVec << (VEC_EXT_TYPE)b.mVec);
+            return *this;
+        }
+        // LSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SCALAR_UINT_TYPE b) {
+            mVec = mVec << b;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator<<= (SCALAR_UINT_TYPE b) {
+            return lsha(b);
+        }
+        // MLSHSA
+        UME_FORCE_INLINE SIMDVec_i & lsha(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec << b);
+            return *this;
+        }
+        // RSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & b) const {
+            return SIMDVec_i(mVec >> (VEC_EXT_TYPE)b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & b) const {
+            return rsh(b);
+        }
+        // MRSHV
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & b) const {
+            return SIMDVec_i(blendExt(mask, mVec, mVec >> (VEC_EXT_TYPE)b.mVec));
+        }
+        // RSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(SCALAR_UINT_TYPE b) const {
+            return SIMDVec_i(mVec >> b);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator>> (SCALAR_UINT_TYPE b) const {
+            return rsh(b);
+        }
+        // MRSHS
+        UME_FORCE_INLINE SIMDVec_i rsh(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return SIMDVec_i(blendExt(mask, mVec, mVec >> b));
+        }
+        // RSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & b) {
+            mVec = mVec >> (VEC_EXT_TYPE)b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & b) {
+            return rsha(b);
+        }
+        // MRSHVA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & b) {
+            mVec = blendExt(mask, mVec, mVec >> (VEC_EXT_TYPE)b.mVec);
+            return *this;
+        }
+        // RSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SCALAR_UINT_TYPE b) {
+            mVec = mVec >> b;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_i & operator>>= (SCALAR_UINT_TYPE b) {
+            return rsha(b);
+        }
+        // MRSHSA
+        UME_FORCE_INLINE SIMDVec_i & rsha(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec >> b);
+            return *this;
+        }
+        // ROLV
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & b) const {
+            return SIMDVec_i((VEC_EXT_TYPE)VEC_UINT::rotateLeftExt((VEC_EXT_UINT_TYPE)mVec, b.mVec));
+        }
+        // MROLV
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & b) const {
+            return SIMDVec_i(blendExt(mask, mVec, (VEC_EXT_TYPE)VEC_UINT::rotateLeftExt((VEC_EXT_UINT_TYPE)mVec, b.mVec)));
+        }
+        // ROLS
+        UME_FORCE_INLINE SIMDVec_i rol(SCALAR_UINT_TYPE b) const {
+            return SIMDVec_i((VEC_EXT_TYPE)VEC_UINT::rotateLeftExt((VEC_EXT_UINT_TYPE)mVec, VEC_UINT::splat(b)));
+        }
+        // MROLS
+        UME_FORCE_INLINE SIMDVec_i rol(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return SIMDVec_i(blendExt(mask, mVec, (VEC_EXT_TYPE)VEC_UINT::rotateLeftExt((VEC_EXT_UINT_TYPE)mVec, VEC_UINT::splat(b))));
+        }
+        // ROLVA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & b) {
+            mVec = (VEC_EXT_TYPE)VEC_UINT::rotateLeftExt((VEC_EXT_UINT_TYPE)mVec, b.mVec);
+            return *this;
+        }
+        // MROLVA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & b) {
+            mVec = blendExt(mask, mVec, (VEC_EXT_TYPE)VEC_UINT::rotateLeftExt((VEC_EXT_UINT_TYPE)mVec, b.mVec));
+            return *this;
+        }
+        // ROLSA
+        UME_FORCE_INLINE SIMDVec_i & rola(SCALAR_UINT_TYPE b) {
+            mVec = (VEC_EXT_TYPE)VEC_UINT::rotateLeftExt((VEC_EXT_UINT_TYPE)mVec, VEC_UINT::splat(b));
+            return *this;
+        }
+        // MROLSA
+        UME_FORCE_INLINE SIMDVec_i & rola(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) {
+            mVec = blendExt(mask, mVec, (VEC_EXT_TYPE)VEC_UINT::rotateLeftExt((VEC_EXT_UINT_TYPE)mVec, VEC_UINT::splat(b)));
+            return *this;
+        }
+        // RORV
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & b) const {
+            return SIMDVec_i((VEC_EXT_TYPE)VEC_UINT::rotateRightExt((VEC_EXT_UINT_TYPE)mVec, b.mVec));
+        }
+        // MRORV
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & b) const {
+            return SIMDVec_i(blendExt(mask, mVec, (VEC_EXT_TYPE)VEC_UINT::rotateRightExt((VEC_EXT_UINT_TYPE)mVec, b.mVec)));
+        }
+        // RORS
+        UME_FORCE_INLINE SIMDVec_i ror(SCALAR_UINT_TYPE b) const {
+            return SIMDVec_i((VEC_EXT_TYPE)VEC_UINT::rotateRightExt((VEC_EXT_UINT_TYPE)mVec, VEC_UINT::splat(b)));
+        }
+        // MRORS
+        UME_FORCE_INLINE SIMDVec_i ror(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return SIMDVec_i(blendExt(mask, mVec, (VEC_EXT_TYPE)VEC_UINT::rotateRightExt((VEC_EXT_UINT_TYPE)mVec, VEC_UINT::splat(b))));
+        }
+        // RORVA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & b) {
+            mVec = (VEC_EXT_TYPE)VEC_UINT::rotateRightExt((VEC_EXT_UINT_TYPE)mVec, b.mVec);
+            return *this;
+        }
+        // MRORVA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN> const & b) {
+            mVec = blendExt(mask, mVec, (VEC_EXT_TYPE)VEC_UINT::rotateRightExt((VEC_EXT_UINT_TYPE)mVec, b.mVec));
+            return *this;
+        }
+        // RORSA
+        UME_FORCE_INLINE SIMDVec_i & rora(SCALAR_UINT_TYPE b) {
+            mVec = (VEC_EXT_TYPE)VEC_UINT::rotateRightExt((VEC_EXT_UINT_TYPE)mVec, VEC_UINT::splat(b));
+            return *this;
+        }
+        // MRORSA
+        UME_FORCE_INLINE SIMDVec_i & rora(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) {
+            mVec = blendExt(mask, mVec, (VEC_EXT_TYPE)VEC_UINT::rotateRightExt((VEC_EXT_UINT_TYPE)mVec, VEC_UINT::splat(b)));
+            return *this;
+        }
+
+        // NEG
+        UME_FORCE_INLINE SIMDVec_i neg() const {
+            return SIMDVec_i(-mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_i operator- () const {
+            return neg();
+        }
+        // MNEG
+        UME_FORCE_INLINE SIMDVec_i neg(SIMDVecMask<VEC_LEN> const & mask) const {
+            return SIMDVec_i(blendExt(mask, mVec, -mVec));
+        }
+        // NEGA
+        UME_FORCE_INLINE SIMDVec_i & nega() {
+            mVec = -mVec;
+            return *this;
+        }
+        // MNEGA
+        UME_FORCE_INLINE SIMDVec_i & nega(SIMDVecMask<VEC_LEN> const & mask) {
+            mVec = blendExt(mask, mVec, -mVec);
+            return *this;
+        }
+        // ABS
+        UME_FORCE_INLINE SIMDVec_i abs() const {
+            return SIMDVec_i((mVec < 0) ? -mVec : mVec);
+        }
+        // MABS
+        UME_FORCE_INLINE SIMDVec_i abs(SIMDVecMask<VEC_LEN> const & mask) const {
+            return SIMDVec_i(blendExt(mask, mVec, (mVec < 0) ? -mVec : mVec));
+        }
+        // ABSA
+        UME_FORCE_INLINE SIMDVec_i & absa() {
+            mVec = (mVec < 0) ? -mVec : mVec;
+            return *this;
+        }
+        // MABSA
+        UME_FORCE_INLINE SIMDVec_i & absa(SIMDVecMask<VEC_LEN> const & mask) {
+            mVec = blendExt(mask, mVec, (mVec < 0) ? -mVec : mVec);
+            return *this;
+        }
+
+        // PACK
+        UME_FORCE_INLINE SIMDVec_i & pack(HALF_LEN_VEC_TYPE const & a, HALF_LEN_VEC_TYPE const & b) {
+            mVec = vecExtShuffle<VEC_EXT_TYPE>(a.mVec, b.mVec, typename VecExtRange<0, VEC_LEN>::type());
+            return *this;
+        }
+        // PACKLO
+        UME_FORCE_INLINE SIMDVec_i & packlo(HALF_LEN_VEC_TYPE const & a) {
+            typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE t0 = vecExtShuffle<typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE>(mVec, mVec, typename VecExtRange<VEC_LEN/2, VEC_LEN/2>::type());
+            mVec = vecExtShuffle<VEC_EXT_TYPE>(a.mVec, t0, typename VecExtRange<0, VEC_LEN>::type());
+            return *this;
+        }
+        // PACKHI
+        UME_FORCE_INLINE SIMDVec_i & packhi(HALF_LEN_VEC_TYPE const & b) {
+            typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE t0 = vecExtShuffle<typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE>(mVec, mVec, typename VecExtRange<0, VEC_LEN/2>::type());
+            mVec = vecExtShuffle<VEC_EXT_TYPE>(t0, b.mVec, typename VecExtRange<0, VEC_LEN>::type());
+            return *this;
+        }
+        // UNPACK
+        UME_FORCE_INLINE void unpack(HALF_LEN_VEC_TYPE & a, HALF_LEN_VEC_TYPE & b) const {
+            a.mVec = vecExtShuffle<typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE>(mVec, mVec, typename VecExtRange<0, VEC_LEN/2>::type());
+            b.mVec = vecExtShuffle<typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE>(mVec, mVec, typename VecExtRange<VEC_LEN/2, VEC_LEN/2>::type());
+        }
+        // UNPACKLO
+        UME_FORCE_INLINE HALF_LEN_VEC_TYPE unpacklo() const {
+            return HALF_LEN_VEC_TYPE(vecExtShuffle<typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE>(mVec, mVec, typename VecExtRange<0, VEC_LEN/2>::type()));
+        }
+        // UNPACKHI
+        UME_FORCE_INLINE HALF_LEN_VEC_TYPE unpackhi() const {
+            return HALF_LEN_VEC_TYPE(vecExtShuffle<typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE>(mVec, mVec, typename VecExtRange<VEC_LEN/2, VEC_LEN/2>::type()));
+        }
+
+        // DEGRADE
+        UME_FORCE_INLINE operator SIMDVec_i<SCALAR_INT_LOWER_PRECISION, VEC_LEN>() const;
+        // PROMOTE
+        UME_FORCE_INLINE operator SIMDVec_i<SCALAR_INT_HIGHER_PRECISION, VEC_LEN>() const;
+
+        // ITOU
+        UME_FORCE_INLINE operator SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN>() const;
+        // ITOF
+        UME_FORCE_INLINE operator SIMDVec_f<SCALAR_FLOAT_TYPE, VEC_LEN>() const;
+    };
+
+    // SIMD NullTypes. These are used whenever a terminating
+    // scalar type is used as a creator function for SIMD type.
+    // These types cannot be instantiated, but are necessary for 
+    // typeset to be consistent.
+    template<>
+    class SIMDVec_i<NullType<1>, 1>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+
+    template<>
+    class SIMDVec_i<NullType<1>, 2>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+
+    template<>
+    class SIMDVec_i<NullType<1>, 4>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+
+    template<>
+    class SIMDVec_i<NullType<1>, 8>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+
+    template<>
+    class SIMDVec_i<NullType<1>, 16>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+
+    template<>
+    class SIMDVec_i<NullType<1>, 32>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+
+    template<>
+    class SIMDVec_i<NullType<1>, 64>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+
+    template<>
+    class SIMDVec_i<NullType<1>, 128>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+
+    template<>
+    class SIMDVec_i<NullType<2>, 1>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+
+    template<>
+    class SIMDVec_i<NullType<2>, 2>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+
+    template<>
+    class SIMDVec_i<NullType<2>, 4>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+
+    template<>
+    class SIMDVec_i<NullType<2>, 8>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+
+    template<>
+    class SIMDVec_i<NullType<2>, 16>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+
+    template<>
+    class SIMDVec_i<NullType<2>, 32>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+
+    template<>
+    class SIMDVec_i<NullType<2>, 64>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+
+    template<>
+    class SIMDVec_i<NullType<2>, 128>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+
+    template<>
+    class SIMDVec_i<NullType<3>, 1>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+
+    template<>
+    class SIMDVec_i<NullType<3>, 2>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+
+    template<>
+    class SIMDVec_i<NullType<3>, 4>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+
+    template<>
+    class SIMDVec_i<NullType<3>, 8>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+
+    template<>
+    class SIMDVec_i<NullType<3>, 16>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+
+    template<>
+    class SIMDVec_i<NullType<3>, 32>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+
+    template<>
+    class SIMDVec_i<NullType<3>, 64>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+
+    template<>
+    class SIMDVec_i<NullType<3>, 128>
+    {
+    private:
+        SIMDVec_i() {}
+        ~SIMDVec_i() {}
+    };
+}
+}
+
+#endif
@@ -0,0 +1,520 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+
+#ifndef UME_SIMD_MASK_PROTOTYPE_H_
+#define UME_SIMD_MASK_PROTOTYPE_H_
+
+#include <type_traits>
+#include "../../../UMESimdInterface.h"
+#include "../UMESimdVectorExtTypes.h"
+
+namespace UME {
+namespace SIMD {
+
+    template<uint32_t VEC_LEN>
+    struct SIMDVecMask_traits {};
+
+    // No specialized traits
+
+    // Mask lanes are stored as 32-bit integers set to either 0 or -1 (all bits set),
+    // which is the format produced by comparisons of generic vectors. Vectors of
+    // other element widths convert the mask with '__builtin_convertvector' before
+    // using it as a selector.
+    template<uint32_t VEC_LEN>
+    class SIMDVecMask :
+        public SIMDMaskBaseInterface<
+            SIMDVecMask<VEC_LEN>,
+            bool,
+            VEC_LEN>
+    {
+    public:
+        typedef typename VecExtType<int32_t, VEC_LEN>::type VEC_EXT_TYPE;
+
+    private:
+        alignas(VEC_LEN*sizeof(int32_t)) VEC_EXT_TYPE mMask;
+
+    template<typename T, uint32_t L>
+    friend class SIMDVec_u;
+    template<typename T, uint32_t L>
+    friend class SIMDVec_i;
+    template<typename T, uint32_t L>
+    friend class SIMDVec_f;
+
+        UME_FORCE_INLINE explicit SIMDVecMask(VEC_EXT_TYPE const & m) : mMask(m) {}
+
+    public:
+        UME_FORCE_INLINE SIMDVecMask() {}
+
+        // Regardless of the mask representation, the interface should only allow initialization using 
+        // standard bool or using equivalent mask
+        UME_FORCE_INLINE SIMDVecMask(bool m) {
+            mMask = -int32_t(m) - VEC_EXT_TYPE();
+        }
+
+        // LOAD-CONSTR - Construct by loading from memory
+        UME_FORCE_INLINE explicit SIMDVecMask(bool const * p) { this->load(p); }
+
+        // TODO: this should be handled using variadic templates, but unfortunatelly Visual Studio does not support this feature...
+        UME_FORCE_INLINE SIMDVecMask(bool m0, bool m1)
+        {
+            mMask[0] = -int32_t(m0);
+            mMask[1] = -int32_t(m1);
+        }
+
+        UME_FORCE_INLINE SIMDVecMask(bool m0, bool m1, bool m2, bool m3)
+        {
+            mMask[0] = -int32_t(m0);
+            mMask[1] = -int32_t(m1);
+            mMask[2] = -int32_t(m2);
+            mMask[3] = -int32_t(m3);
+        }
+
+        UME_FORCE_INLINE SIMDVecMask(bool m0, bool m1, bool m2, bool m3,
+            bool m4, bool m5, bool m6, bool m7)
+        {
+            mMask[0] = -int32_t(m0); mMask[1] = -int32_t(m1);
+            mMask[2] = -int32_t(m2); mMask[3] = -int32_t(m3);
+            mMask[4] = -int32_t(m4); mMask[5] = -int32_t(m5);
+            mMask[6] = -int32_t(m6); mMask[7] = -int32_t(m7);
+        }
+
+        UME_FORCE_INLINE SIMDVecMask(bool m0, bool m1, bool m2, bool m3,
+            bool m4, bool m5, bool m6, bool m7,
+            bool m8, bool m9, bool m10, bool m11,
+            bool m12, bool m13, bool m14, bool m15)
+        {
+            mMask[0] = -int32_t(m0);   mMask[1] = -int32_t(m1);
+            mMask[2] = -int32_t(m2);   mMask[3] = -int32_t(m3);
+            mMask[4] = -int32_t(m4);   mMask[5] = -int32_t(m5);
+            mMask[6] = -int32_t(m6);   mMask[7] = -int32_t(m7);
+            mMask[8] = -int32_t(m8);   mMask[9] = -int32_t(m9);
+            mMask[10] = -int32_t(m10); mMask[11] = -int32_t(m11);
+            mMask[12] = -int32_t(m12); mMask[13] = -int32_t(m13);
+            mMask[14] = -int32_t(m14); mMask[15] = -int32_t(m15);
+        }
+
+        UME_FORCE_INLINE SIMDVecMask(bool m0, bool m1, bool m2, bool m3,
+            bool m4, bool m5, bool m6, bool m7,
+            bool m8, bool m9, bool m10, bool m11,
+            bool m12, bool m13, bool m14, bool m15,
+            bool m16, bool m17, bool m18, bool m19,
+            bool m20, bool m21, bool m22, bool m23,
+            bool m24, bool m25, bool m26, bool m27,
+            bool m28, bool m29, bool m30, bool m31)
+        {
+            mMask[0] = -int32_t(m0);   mMask[1] = -int32_t(m1);
+            mMask[2] = -int32_t(m2);   mMask[3] = -int32_t(m3);
+            mMask[4] = -int32_t(m4);   mMask[5] = -int32_t(m5);
+            mMask[6] = -int32_t(m6);   mMask[7] = -int32_t(m7);
+            mMask[8] = -int32_t(m8);   mMask[9] = -int32_t(m9);
+            mMask[10] = -int32_t(m10); mMask[11] = -int32_t(m11);
+            mMask[12] = -int32_t(m12); mMask[13] = -int32_t(m13);
+            mMask[14] = -int32_t(m14); mMask[15] = -int32_t(m15);
+            mMask[16] = -int32_t(m16); mMask[17] = -int32_t(m17);
+            mMask[18] = -int32_t(m18); mMask[19] = -int32_t(m19);
+            mMask[20] = -int32_t(m20); mMask[21] = -int32_t(m21);
+            mMask[22] = -int32_t(m22); mMask[23] = -int32_t(m23);
+            mMask[24] = -int32_t(m24); mMask[25] = -int32_t(m25);
+            mMask[26] = -int32_t(m26); mMask[27] = -int32_t(m27);
+            mMask[28] = -int32_t(m28); mMask[29] = -int32_t(m29);
+            mMask[30] = -int32_t(m30); mMask[31] = -int32_t(m31);
+        }
+
+        UME_FORCE_INLINE SIMDVecMask(bool m0, bool m1, bool m2, bool m3,
+            bool m4, bool m5, bool m6, bool m7,
+            bool m8, bool m9, bool m10, bool m11,
+            bool m12, bool m13, bool m14, bool m15,
+            bool m16, bool m17, bool m18, bool m19,
+            bool m20, bool m21, bool m22, bool m23,
+            bool m24, bool m25, bool m26, bool m27,
+            bool m28, bool m29, bool m30, bool m31,
+            bool m32, bool m33, bool m34, bool m35,
+            bool m36, bool m37, bool m38, bool m39,
+            bool m40, bool m41, bool m42, bool m43,
+            bool m44, bool m45, bool m46, bool m47,
+            bool m48, bool m49, bool m50, bool m51,
+            bool m52, bool m53, bool m54, bool m55,
+            bool m56, bool m57, bool m58, bool m59,
+            bool m60, bool m61, bool m62, bool m63)
+        {
+            mMask[0] = -int32_t(m0);   mMask[1] = -int32_t(m1);
+            mMask[2] = -int32_t(m2);   mMask[3] = -int32_t(m3);
+            mMask[4] = -int32_t(m4);   mMask[5] = -int32_t(m5);
+            mMask[6] = -int32_t(m6);   mMask[7] = -int32_t(m7);
+            mMask[8] = -int32_t(m8);   mMask[9] = -int32_t(m9);
+            mMask[10] = -int32_t(m10); mMask[11] = -int32_t(m11);
+            mMask[12] = -int32_t(m12); mMask[13] = -int32_t(m13);
+            mMask[14] = -int32_t(m14); mMask[15] = -int32_t(m15);
+            mMask[16] = -int32_t(m16); mMask[17] = -int32_t(m17);
+            mMask[18] = -int32_t(m18); mMask[19] = -int32_t(m19);
+            mMask[20] = -int32_t(m20); mMask[21] = -int32_t(m21);
+            mMask[22] = -int32_t(m22); mMask[23] = -int32_t(m23);
+            mMask[24] = -int32_t(m24); mMask[25] = -int32_t(m25);
+            mMask[26] = -int32_t(m26); mMask[27] = -int32_t(m27);
+            mMask[28] = -int32_t(m28); mMask[29] = -int32_t(m29);
+            mMask[30] = -int32_t(m30); mMask[31] = -int32_t(m31);
+            mMask[32] = -int32_t(m32); mMask[33] = -int32_t(m33);
+            mMask[34] = -int32_t(m34); mMask[35] = -int32_t(m35);
+            mMask[36] = -int32_t(m36); mMask[37] = -int32_t(m37);
+            mMask[38] = -int32_t(m38); mMask[39] = -int32_t(m39);
+            mMask[40] = -int32_t(m40); mMask[41] = -int32_t(m41);
+            mMask[42] = -int32_t(m42); mMask[43] = -int32_t(m43);
+            mMask[44] = -int32_t(m44); mMask[45] = -int32_t(m45);
+            mMask[46] = -int32_t(m46); mMask[47] = -int32_t(m47);
+            mMask[48] = -int32_t(m48); mMask[49] = -int32_t(m49);
+            mMask[50] = -int32_t(m50); mMask[51] = -int32_t(m51);
+            mMask[52] = -int32_t(m52); mMask[53] = -int32_t(m53);
+            mMask[54] = -int32_t(m54); mMask[55] = -int32_t(m55);
+            mMask[56] = -int32_t(m56); mMask[57] = -int32_t(m57);
+            mMask[58] = -int32_t(m58); mMask[59] = -int32_t(m59);
+            mMask[60] = -int32_t(m60); mMask[61] = -int32_t(m61);
+            mMask[62] = -int32_t(m62); mMask[63] = -int32_t(m63);
+        }
+
+        UME_FORCE_INLINE SIMDVecMask(bool m0, bool m1, bool m2, bool m3,
+            bool m4, bool m5, bool m6, bool m7,
+            bool m8, bool m9, bool m10, bool m11,
+            bool m12, bool m13, bool m14, bool m15,
+            bool m16, bool m17, bool m18, bool m19,
+            bool m20, bool m21, bool m22, bool m23,
+            bool m24, bool m25, bool m26, bool m27,
+            bool m28, bool m29, bool m30, bool m31,
+            bool m32, bool m33, bool m34, bool m35,
+            bool m36, bool m37, bool m38, bool m39,
+            bool m40, bool m41, bool m42, bool m43,
+            bool m44, bool m45, bool m46, bool m47,
+            bool m48, bool m49, bool m50, bool m51,
+            bool m52, bool m53, bool m54, bool m55,
+            bool m56, bool m57, bool m58, bool m59,
+            bool m60, bool m61, bool m62, bool m63,
+            bool m64, bool m65, bool m66, bool m67,
+            bool m68, bool m69, bool m70, bool m71,
+            bool m72, bool m73, bool m74, bool m75,
+            bool m76, bool m77, bool m78, bool m79,
+            bool m80, bool m81, bool m82, bool m83,
+            bool m84, bool m85, bool m86, bool m87,
+            bool m88, bool m89, bool m90, bool m91,
+            bool m92, bool m93, bool m94, bool m95,
+            bool m96, bool m97, bool m98, bool m99,
+            bool m100, bool m101, bool m102, bool m103,
+            bool m104, bool m105, bool m106, bool m107,
+            bool m108, bool m109, bool m110, bool m111,
+            bool m112, bool m113, bool m114, bool m115,
+            bool m116, bool m117, bool m118, bool m119,
+            bool m120, bool m121, bool m122, bool m123,
+            bool m124, bool m125, bool m126, bool m127)
+        {
+            mMask[0] = -int32_t(m0);     mMask[1] = -int32_t(m1);
+            mMask[2] = -int32_t(m2);     mMask[3] = -int32_t(m3);
+            mMask[4] = -int32_t(m4);     mMask[5] = -int32_t(m5);
+            mMask[6] = -int32_t(m6);     mMask[7] = -int32_t(m7);
+            mMask[8] = -int32_t(m8);     mMask[9] = -int32_t(m9);
+            mMask[10] = -int32_t(m10);   mMask[11] = -int32_t(m11);
+            mMask[12] = -int32_t(m12);   mMask[13] = -int32_t(m13);
+            mMask[14] = -int32_t(m14);   mMask[15] = -int32_t(m15);
+            mMask[16] = -int32_t(m16);   mMask[17] = -int32_t(m17);
+            mMask[18] = -int32_t(m18);   mMask[19] = -int32_t(m19);
+            mMask[20] = -int32_t(m20);   mMask[21] = -int32_t(m21);
+            mMask[22] = -int32_t(m22);   mMask[23] = -int32_t(m23);
+            mMask[24] = -int32_t(m24);   mMask[25] = -int32_t(m25);
+            mMask[26] = -int32_t(m26);   mMask[27] = -int32_t(m27);
+            mMask[28] = -int32_t(m28);   mMask[29] = -int32_t(m29);
+            mMask[30] = -int32_t(m30);   mMask[31] = -int32_t(m31);
+            mMask[32] = -int32_t(m32);   mMask[33] = -int32_t(m33);
+            mMask[34] = -int32_t(m34);   mMask[35] = -int32_t(m35);
+            mMask[36] = -int32_t(m36);   mMask[37] = -int32_t(m37);
+            mMask[38] = -int32_t(m38);   mMask[39] = -int32_t(m39);
+            mMask[40] = -int32_t(m40);   mMask[41] = -int32_t(m41);
+            mMask[42] = -int32_t(m42);   mMask[43] = -int32_t(m43);
+            mMask[44] = -int32_t(m44);   mMask[45] = -int32_t(m45);
+            mMask[46] = -int32_t(m46);   mMask[47] = -int32_t(m47);
+            mMask[48] = -int32_t(m48);   mMask[49] = -int32_t(m49);
+            mMask[50] = -int32_t(m50);   mMask[51] = -int32_t(m51);
+            mMask[52] = -int32_t(m52);   mMask[53] = -int32_t(m53);
+            mMask[54] = -int32_t(m54);   mMask[55] = -int32_t(m55);
+            mMask[56] = -int32_t(m56);   mMask[57] = -int32_t(m57);
+            mMask[58] = -int32_t(m58);   mMask[59] = -int32_t(m59);
+            mMask[60] = -int32_t(m60);   mMask[61] = -int32_t(m61);
+            mMask[62] = -int32_t(m62);   mMask[63] = -int32_t(m63);
+            mMask[64] = -int32_t(m64);   mMask[65] = -int32_t(m65);
+            mMask[66] = -int32_t(m66);   mMask[67] = -int32_t(m67);
+            mMask[68] = -int32_t(m68);   mMask[69] = -int32_t(m69);
+            mMask[70] = -int32_t(m70);   mMask[71] = -int32_t(m71);
+            mMask[72] = -int32_t(m72);   mMask[73] = -int32_t(m73);
+            mMask[74] = -int32_t(m74);   mMask[75] = -int32_t(m75);
+            mMask[76] = -int32_t(m76);   mMask[77] = -int32_t(m77);
+            mMask[78] = -int32_t(m78);   mMask[79] = -int32_t(m79);
+            mMask[80] = -int32_t(m80);   mMask[81] = -int32_t(m81);
+            mMask[82] = -int32_t(m82);   mMask[83] = -int32_t(m83);
+            mMask[84] = -int32_t(m84);   mMask[85] = -int32_t(m85);
+            mMask[86] = -int32_t(m86);   mMask[87] = -int32_t(m87);
+            mMask[88] = -int32_t(m88);   mMask[89] = -int32_t(m89);
+            mMask[90] = -int32_t(m90);   mMask[91] = -int32_t(m91);
+            mMask[92] = -int32_t(m92);   mMask[93] = -int32_t(m93);
+            mMask[94] = -int32_t(m94);   mMask[95] = -int32_t(m95);
+            mMask[96] = -int32_t(m96);   mMask[97] = -int32_t(m97);
+            mMask[98] = -int32_t(m98);   mMask[99] = -int32_t(m99);
+            mMask[100] = -int32_t(m100); mMask[101] = -int32_t(m101);
+            mMask[102] = -int32_t(m102); mMask[103] = -int32_t(m103);
+            mMask[104] = -int32_t(m104); mMask[105] = -int32_t(m105);
+            mMask[106] = -int32_t(m106); mMask[107] = -int32_t(m107);
+            mMask[108] = -int32_t(m108); mMask[109] = -int32_t(m109);
+            mMask[110] = -int32_t(m110); mMask[111] = -int32_t(m111);
+            mMask[112] = -int32_t(m112); mMask[113] = -int32_t(m113);
+            mMask[114] = -int32_t(m114); mMask[115] = -int32_t(m115);
+            mMask[116] = -int32_t(m116); mMask[117] = -int32_t(m117);
+            mMask[118] = -int32_t(m118); mMask[119] = -int32_t(m119);
+            mMask[120] = -int32_t(m120); mMask[121] = -int32_t(m121);
+            mMask[122] = -int32_t(m122); mMask[123] = -int32_t(m123);
+            mMask[124] = -int32_t(m124); mMask[125] = -int32_t(m125);
+            mMask[126] = -int32_t(m126); mMask[127] = -int32_t(m127);
+        }
+
+        // A non-modifying element-wise access operator
+        UME_FORCE_INLINE bool operator[] (uint32_t index) const { return mMask[index] != 0; }
+
+        UME_FORCE_INLINE bool extract(uint32_t index) const
+        {
+            return mMask[index] != 0;
+        }
+
+        // Element-wise modification operator
+        UME_FORCE_INLINE void insert(uint32_t index, bool x) {
+            mMask[index] = -int32_t(x);
+        }
+
+        UME_FORCE_INLINE SIMDVecMask(SIMDVecMask const & mask) : mMask(mask.mMask) {}
+
+        // PREFIX
+        UME_FORCE_INLINE static SIMDVecMask prefix(uint32_t n) {
+            VEC_EXT_TYPE t0 = vecExtIota<VEC_EXT_TYPE>(typename VecExtRange<0, VEC_LEN>::type());
+            return SIMDVecMask(t0 < int32_t(n < VEC_LEN ? n : VEC_LEN));
+        }
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVecMask & assign(SIMDVecMask const & maskOp) {
+            mMask = maskOp.mMask;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator= (SIMDVecMask const & maskOp) {
+            return assign(maskOp);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVecMask & assign(SIMDVecMask const & mask, SIMDVecMask const & maskOp) {
+            mMask = (maskOp.mMask & mask.mMask) | (mMask & ~mask.mMask);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVecMask & assign(bool scalarOp) {
+            mMask = -int32_t(scalarOp) - VEC_EXT_TYPE();
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator= (bool scalarOp) {
+            return assign(scalarOp);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVecMask & assign(SIMDVecMask const & mask, bool scalarOp) {
+            mMask = scalarOp ? (mMask | mask.mMask) : (mMask & ~mask.mMask);
+            return *this;
+        }
+
+        // LANDV
+        UME_FORCE_INLINE SIMDVecMask land(SIMDVecMask const & maskOp) const {
+            return SIMDVecMask(mMask & maskOp.mMask);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator& (SIMDVecMask const & maskOp) const {
+            return land(maskOp);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator&& (SIMDVecMask const & maskOp) const {
+            return land(maskOp);
+        }
+        // LANDS
+        UME_FORCE_INLINE SIMDVecMask land(bool value) const {
+            return SIMDVecMask(mMask & -int32_t(value));
+        }
+        UME_FORCE_INLINE SIMDVecMask operator& (bool value) const {
+            return land(value);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator&& (bool value) const {
+            return land(value);
+        }
+        // LANDVA
+        UME_FORCE_INLINE SIMDVecMask & landa(SIMDVecMask const & maskOp) {
+            mMask &= maskOp.mMask;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator&= (SIMDVecMask const & maskOp) {
+            return landa(maskOp);
+        }
+        // LANDSA
+        UME_FORCE_INLINE SIMDVecMask & landa(bool value) {
+            mMask &= -int32_t(value);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator&= (bool value) {
+            return landa(value);
+        }
+        // LORV
+        UME_FORCE_INLINE SIMDVecMask lor(SIMDVecMask const & maskOp) const {
+            return SIMDVecMask(mMask | maskOp.mMask);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator| (SIMDVecMask const & maskOp) const {
+            return lor(maskOp);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator|| (SIMDVecMask const & maskOp) const {
+            return lor(maskOp);
+        }
+        // LORS
+        UME_FORCE_INLINE SIMDVecMask lor(bool value) const {
+            return SIMDVecMask(mMask | -int32_t(value));
+        }
+        UME_FORCE_INLINE SIMDVecMask operator| (bool value) const {
+            return lor(value);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator|| (bool value) const {
+            return lor(value);
+        }
+        // LORVA
+        UME_FORCE_INLINE SIMDVecMask & lora(SIMDVecMask const & maskOp) {
+            mMask |= maskOp.mMask;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator|= (SIMDVecMask const & maskOp) {
+            return lora(maskOp);
+        }
+        // LORSA
+        UME_FORCE_INLINE SIMDVecMask & lora(bool value) {
+            mMask |= -int32_t(value);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator|= (bool value) {
+            return lora(value);
+        }
+        // LXORV
+        UME_FORCE_INLINE SIMDVecMask lxor(SIMDVecMask const & maskOp) const {
+            return SIMDVecMask(mMask ^ maskOp.mMask);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator^ (SIMDVecMask const & maskOp) const {
+            return lxor(maskOp);
+        }
+        // LXORS
+        UME_FORCE_INLINE SIMDVecMask lxor(bool value) const {
+            return SIMDVecMask(mMask ^ -int32_t(value));
+        }
+        UME_FORCE_INLINE SIMDVecMask operator^ (bool value) const {
+            return lxor(value);
+        }
+        // LXORVA
+        UME_FORCE_INLINE SIMDVecMask & lxora(SIMDVecMask const & maskOp) {
+            mMask ^= maskOp.mMask;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator^= (SIMDVecMask const & maskOp) {
+            return lxora(maskOp);
+        }
+        // LXORSA
+        UME_FORCE_INLINE SIMDVecMask & lxora(bool value) {
+            mMask ^= -int32_t(value);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVecMask & operator^= (bool value) {
+            return lxora(value);
+        }
+        // LNOT
+        UME_FORCE_INLINE SIMDVecMask lnot() const {
+            return SIMDVecMask(~mMask);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator! () const {
+            return lnot();
+        }
+        // LNOTA
+        UME_FORCE_INLINE SIMDVecMask & lnota() {
+            mMask = ~mMask;
+            return *this;
+        }
+        // LANDNOTV
+        UME_FORCE_INLINE SIMDVecMask landnot(SIMDVecMask const & b) const {
+            return SIMDVecMask(~mMask & b.mMask);
+        }
+        // LANDNOTS
+        UME_FORCE_INLINE SIMDVecMask landnot(bool b) const {
+            return SIMDVecMask(~mMask & -int32_t(b));
+        }
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask cmpeq(SIMDVecMask const & b) const {
+            return SIMDVecMask(mMask == b.mMask);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator== (SIMDVecMask const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask cmpeq(bool b) const {
+            return SIMDVecMask(mMask == -int32_t(b));
+        }
+        UME_FORCE_INLINE SIMDVecMask operator== (bool b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask cmpne(SIMDVecMask const & b) const {
+            return SIMDVecMask(mMask != b.mMask);
+        }
+        UME_FORCE_INLINE SIMDVecMask operator!= (SIMDVecMask const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask cmpne(bool b) const {
+            return SIMDVecMask(mMask != -int32_t(b));
+        }
+        UME_FORCE_INLINE SIMDVecMask operator!= (bool b) const {
+            return cmpne(b);
+        }
+        // HLAND
+        UME_FORCE_INLINE bool hland() const {
+            return VecExtReduce<int32_t, VEC_LEN>::template apply<VecExtAnd>(mMask) != 0;
+        }
+        // HLOR
+        UME_FORCE_INLINE bool hlor() const {
+            return VecExtReduce<int32_t, VEC_LEN>::template apply<VecExtOr>(mMask) != 0;
+        }
+        // HLXOR
+        UME_FORCE_INLINE bool hlxor() const {
+            return VecExtReduce<int32_t, VEC_LEN>::template apply<VecExtXor>(mMask) != 0;
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVecMask const & mask) const {
+            return VecExtReduce<int32_t, VEC_LEN>::template apply<VecExtOr>(mMask ^ mask.mMask) == 0;
+        }
+    };
+
+}
+}
+
+#endif
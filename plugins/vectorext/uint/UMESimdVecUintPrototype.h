@@ -0,0 +1,2152 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2015-2017 CERN
+//
+// Author: Przemyslaw Karpinski
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//
+//  This piece of code was developed as part of ICE-DIP project at CERN.
+//  "ICE-DIP is a European Industrial Doctorate project funded by the European Community's 
+//  7th Framework programme Marie Curie Actions under grant PITN-GA-2012-316596".
+//
+
+#ifndef UME_SIMD_VEC_UINT_PROTOTYPE_H_
+#define UME_SIMD_VEC_UINT_PROTOTYPE_H_
+
+#include <type_traits>
+#include <cstring>
+
+#include "../../../UMESimdInterface.h"
+#include "../UMESimdVectorExtTypes.h"
+
+#include "../UMESimdMask.h"
+#include "../UMESimdSwizzle.h"
+
+namespace UME {
+namespace SIMD {
+    // ********************************************************************************************
+    // UNSIGNED INTEGER VECTORS
+    // ********************************************************************************************
+    template<typename VEC_TYPE, uint32_t VEC_LEN>
+    struct SIMDVec_u_traits {
+        // Generic trait class not containing type definition so that only correct explicit
+        // type definitions are compiled correctly
+    };
+
+    // 8b vectors
+    template<>
+    struct SIMDVec_u_traits<uint8_t, 1> {
+        typedef NullType<1>       HALF_LEN_VEC_TYPE;
+        typedef int8_t            SCALAR_INT_TYPE;
+        typedef NullType<2>       SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<1>    MASK_TYPE;
+        typedef SIMDSwizzle<1>    SWIZZLE_MASK_TYPE;
+        typedef NullType<3>       SCALAR_UINT_LOWER_PRECISION;
+        typedef uint16_t          SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    // 16b vectors
+    template<>
+    struct SIMDVec_u_traits<uint8_t, 2> {
+        typedef SIMDVec_u<uint8_t, 1> HALF_LEN_VEC_TYPE;
+        typedef int8_t                SCALAR_INT_TYPE;
+        typedef NullType<1>           SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<2>        MASK_TYPE;
+        typedef SIMDSwizzle<2>        SWIZZLE_MASK_TYPE;
+        typedef NullType<2>           SCALAR_UINT_LOWER_PRECISION;
+        typedef uint16_t              SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_u_traits<uint16_t, 1> {
+        typedef NullType<1>         HALF_LEN_VEC_TYPE;
+        typedef int16_t             SCALAR_INT_TYPE;
+        typedef NullType<2>         SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<1>      MASK_TYPE;
+        typedef SIMDSwizzle<1>      SWIZZLE_MASK_TYPE;
+        typedef uint8_t             SCALAR_UINT_LOWER_PRECISION;
+        typedef uint32_t            SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    // 32b vectors
+    template<>
+    struct SIMDVec_u_traits<uint8_t, 4> {
+        typedef SIMDVec_u<uint8_t, 2> HALF_LEN_VEC_TYPE;
+        typedef int8_t                SCALAR_INT_TYPE;
+        typedef NullType<1>           SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<4>        MASK_TYPE;
+        typedef SIMDSwizzle<4>        SWIZZLE_MASK_TYPE;
+        typedef NullType<2>           SCALAR_UINT_LOWER_PRECISION;
+        typedef uint16_t              SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_u_traits<uint16_t, 2> {
+        typedef SIMDVec_u<uint16_t, 1> HALF_LEN_VEC_TYPE;
+        typedef int16_t                SCALAR_INT_TYPE;
+        typedef NullType<1>            SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<2>         MASK_TYPE;
+        typedef SIMDSwizzle<2>         SWIZZLE_MASK_TYPE;
+        typedef uint8_t                SCALAR_UINT_LOWER_PRECISION;
+        typedef uint32_t               SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_u_traits<uint32_t, 1> {
+        typedef NullType<1>         HALF_LEN_VEC_TYPE;
+        typedef int32_t             SCALAR_INT_TYPE;
+        typedef float               SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<1>      MASK_TYPE;
+        typedef SIMDSwizzle<1>      SWIZZLE_MASK_TYPE;
+        typedef uint16_t            SCALAR_UINT_LOWER_PRECISION;
+        typedef uint64_t            SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    // 64b vectors
+    template<>
+    struct SIMDVec_u_traits<uint8_t, 8> {
+        typedef SIMDVec_u<uint8_t, 4> HALF_LEN_VEC_TYPE;
+        typedef int8_t                SCALAR_INT_TYPE;
+        typedef NullType<1>           SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<8>        MASK_TYPE;
+        typedef SIMDSwizzle<8>        SWIZZLE_MASK_TYPE;
+        typedef NullType<2>           SCALAR_UINT_LOWER_PRECISION;
+        typedef uint16_t              SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_u_traits<uint16_t, 4> {
+        typedef SIMDVec_u<uint16_t, 2> HALF_LEN_VEC_TYPE;
+        typedef int16_t                SCALAR_INT_TYPE;
+        typedef NullType<1>            SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<4>         MASK_TYPE;
+        typedef SIMDSwizzle<4>         SWIZZLE_MASK_TYPE;
+        typedef uint8_t                SCALAR_UINT_LOWER_PRECISION;
+        typedef uint32_t               SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_u_traits<uint32_t, 2> {
+        typedef SIMDVec_u<uint32_t, 1> HALF_LEN_VEC_TYPE;
+        typedef int32_t                SCALAR_INT_TYPE;
+        typedef float                  SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<2>         MASK_TYPE;
+        typedef SIMDSwizzle<2>         SWIZZLE_MASK_TYPE;
+        typedef uint16_t               SCALAR_UINT_LOWER_PRECISION;
+        typedef uint64_t               SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_u_traits<uint64_t, 1> {
+        typedef NullType<1>         HALF_LEN_VEC_TYPE;
+        typedef int64_t             SCALAR_INT_TYPE;
+        typedef double              SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<1>      MASK_TYPE;
+        typedef SIMDSwizzle<1>      SWIZZLE_MASK_TYPE;
+        typedef uint32_t            SCALAR_UINT_LOWER_PRECISION;
+        typedef NullType<2>         SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    // 128b vectors
+    template<>
+    struct SIMDVec_u_traits<uint8_t, 16> {
+        typedef SIMDVec_u<uint8_t, 8> HALF_LEN_VEC_TYPE;
+        typedef int8_t                SCALAR_INT_TYPE;
+        typedef NullType<1>           SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<16>       MASK_TYPE;
+        typedef SIMDSwizzle<16>       SWIZZLE_MASK_TYPE;
+        typedef NullType<2>           SCALAR_UINT_LOWER_PRECISION;
+        typedef uint16_t              SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_u_traits<uint16_t, 8> {
+        typedef SIMDVec_u<uint16_t, 4> HALF_LEN_VEC_TYPE;
+        typedef int16_t                SCALAR_INT_TYPE;
+        typedef NullType<1>            SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<8>         MASK_TYPE;
+        typedef SIMDSwizzle<8>         SWIZZLE_MASK_TYPE;
+        typedef uint8_t                SCALAR_UINT_LOWER_PRECISION;
+        typedef uint32_t               SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_u_traits<uint32_t, 4> {
+        typedef SIMDVec_u<uint32_t, 2> HALF_LEN_VEC_TYPE;
+        typedef int32_t                SCALAR_INT_TYPE;
+        typedef float                  SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<4>         MASK_TYPE;
+        typedef SIMDSwizzle<4>         SWIZZLE_MASK_TYPE;
+        typedef uint16_t               SCALAR_UINT_LOWER_PRECISION;
+        typedef uint64_t               SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_u_traits<uint64_t, 2> {
+        typedef SIMDVec_u<uint64_t, 1> HALF_LEN_VEC_TYPE;
+        typedef int64_t                SCALAR_INT_TYPE;
+        typedef double                 SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<2>         MASK_TYPE;
+        typedef SIMDSwizzle<2>         SWIZZLE_MASK_TYPE;
+        typedef uint32_t               SCALAR_UINT_LOWER_PRECISION;
+        typedef NullType<1>            SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    // 256b vectors
+    template<>
+    struct SIMDVec_u_traits<uint8_t, 32> {
+        typedef SIMDVec_u<uint8_t, 16> HALF_LEN_VEC_TYPE;
+        typedef int8_t                 SCALAR_INT_TYPE;
+        typedef NullType<1>            SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<32>        MASK_TYPE;
+        typedef SIMDSwizzle<32>        SWIZZLE_MASK_TYPE;
+        typedef NullType<2>            SCALAR_UINT_LOWER_PRECISION;
+        typedef uint16_t               SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_u_traits<uint16_t, 16> {
+        typedef SIMDVec_u<uint16_t, 8> HALF_LEN_VEC_TYPE;
+        typedef int16_t                SCALAR_INT_TYPE;
+        typedef NullType<1>            SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<16>        MASK_TYPE;
+        typedef SIMDSwizzle<16>        SWIZZLE_MASK_TYPE;
+        typedef uint8_t                SCALAR_UINT_LOWER_PRECISION;
+        typedef uint32_t               SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_u_traits<uint32_t, 8> {
+        typedef SIMDVec_u<uint32_t, 4> HALF_LEN_VEC_TYPE;
+        typedef int32_t                SCALAR_INT_TYPE;
+        typedef float                  SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<8>         MASK_TYPE;
+        typedef SIMDSwizzle<8>         SWIZZLE_MASK_TYPE;
+        typedef uint16_t               SCALAR_UINT_LOWER_PRECISION;
+        typedef uint64_t               SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_u_traits<uint64_t, 4> {
+        typedef SIMDVec_u<uint64_t, 2> HALF_LEN_VEC_TYPE;
+        typedef int64_t                SCALAR_INT_TYPE;
+        typedef double                 SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<4>         MASK_TYPE;
+        typedef SIMDSwizzle<4>         SWIZZLE_MASK_TYPE;
+        typedef uint32_t               SCALAR_UINT_LOWER_PRECISION;
+        typedef NullType<2>            SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    // 512b vectors
+    template<>
+    struct SIMDVec_u_traits<uint8_t, 64> {
+        typedef SIMDVec_u<uint8_t, 32> HALF_LEN_VEC_TYPE;
+        typedef int8_t                 SCALAR_INT_TYPE;
+        typedef NullType<1>            SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<64>        MASK_TYPE;
+        typedef SIMDSwizzle<64>        SWIZZLE_MASK_TYPE;
+        typedef NullType<2>            SCALAR_UINT_LOWER_PRECISION;
+        typedef uint16_t               SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_u_traits<uint16_t, 32> {
+        typedef SIMDVec_u<uint16_t, 16> HALF_LEN_VEC_TYPE;
+        typedef int16_t                 SCALAR_INT_TYPE;
+        typedef NullType<1>             SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<32>         MASK_TYPE;
+        typedef SIMDSwizzle<32>         SWIZZLE_MASK_TYPE;
+        typedef uint8_t                 SCALAR_UINT_LOWER_PRECISION;
+        typedef uint32_t                SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_u_traits<uint32_t, 16> {
+        typedef SIMDVec_u<uint32_t, 8> HALF_LEN_VEC_TYPE;
+        typedef int32_t                SCALAR_INT_TYPE;
+        typedef float                  SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<16>        MASK_TYPE;
+        typedef SIMDSwizzle<16>        SWIZZLE_MASK_TYPE;
+        typedef uint16_t               SCALAR_UINT_LOWER_PRECISION;
+        typedef uint64_t               SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_u_traits<uint64_t, 8> {
+        typedef SIMDVec_u<uint64_t, 4> HALF_LEN_VEC_TYPE;
+        typedef int64_t                SCALAR_INT_TYPE;
+        typedef double                 SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<8>         MASK_TYPE;
+        typedef SIMDSwizzle<8>         SWIZZLE_MASK_TYPE;
+        typedef uint32_t               SCALAR_UINT_LOWER_PRECISION;
+        typedef NullType<1>            SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    // 1024b vectors
+    template<>
+    struct SIMDVec_u_traits<uint8_t, 128> {
+        typedef SIMDVec_u<uint8_t, 64> HALF_LEN_VEC_TYPE;
+        typedef int8_t                 SCALAR_INT_TYPE;
+        typedef NullType<1>            SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<128>       MASK_TYPE;
+        typedef SIMDSwizzle<128>       SWIZZLE_MASK_TYPE;
+        typedef NullType<2>            SCALAR_UINT_LOWER_PRECISION;
+        typedef NullType<3>            SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_u_traits<uint16_t, 64> {
+        typedef SIMDVec_u<uint16_t, 32> HALF_LEN_VEC_TYPE;
+        typedef int16_t                 SCALAR_INT_TYPE;
+        typedef NullType<1>             SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<64>         MASK_TYPE;
+        typedef SIMDSwizzle<64>         SWIZZLE_MASK_TYPE;
+        typedef uint8_t                 SCALAR_UINT_LOWER_PRECISION;
+        typedef NullType<1>             SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_u_traits<uint32_t, 32> {
+        typedef SIMDVec_u<uint32_t, 16> HALF_LEN_VEC_TYPE;
+        typedef int32_t                 SCALAR_INT_TYPE;
+        typedef float                   SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<32>         MASK_TYPE;
+        typedef SIMDSwizzle<32>         SWIZZLE_MASK_TYPE;
+        typedef uint16_t                SCALAR_UINT_LOWER_PRECISION;
+        typedef NullType<1>             SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    template<>
+    struct SIMDVec_u_traits<uint64_t, 16> {
+        typedef SIMDVec_u<uint64_t, 8> HALF_LEN_VEC_TYPE;
+        typedef int64_t                SCALAR_INT_TYPE;
+        typedef double                 SCALAR_FLOAT_TYPE;
+        typedef SIMDVecMask<16>        MASK_TYPE;
+        typedef SIMDSwizzle<16>        SWIZZLE_MASK_TYPE;
+        typedef uint32_t               SCALAR_UINT_LOWER_PRECISION;
+        typedef NullType<1>            SCALAR_UINT_HIGHER_PRECISION;
+    };
+
+    // ***************************************************************************
+    // *
+    // *    Implementation of unsigned integer SIMDx_8u, SIMDx_16u, SIMDx_32u, 
+    // *    and SIMDx_64u.
+    // *
+    // *    Vector register is stored in a generic vector of the compiler
+    // *    (GCC/Clang 'vector_size' extension), so that all element-wise
+    // *    operations are translated directly to SIMD instructions of the target.
+    // *
+    // ***************************************************************************
+    template<typename SCALAR_UINT_TYPE, uint32_t VEC_LEN>
+    class SIMDVec_u :
+        public SIMDVecUnsignedInterface<
+            SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN>,
+            SCALAR_UINT_TYPE,
+            VEC_LEN,
+            typename SIMDVec_u_traits<SCALAR_UINT_TYPE, VEC_LEN>::MASK_TYPE,
+            typename SIMDVec_u_traits<SCALAR_UINT_TYPE, VEC_LEN>::SWIZZLE_MASK_TYPE>,
+        public SIMDVecPackableInterface<
+            SIMDVec_u<SCALAR_UINT_TYPE, VEC_LEN>,
+            typename SIMDVec_u_traits<SCALAR_UINT_TYPE, VEC_LEN>::HALF_LEN_VEC_TYPE>
+    {
+    public:
+        typedef typename SIMDVec_u_traits<SCALAR_UINT_TYPE, VEC_LEN>::SCALAR_INT_TYPE    SCALAR_INT_TYPE;
+        typedef typename SIMDVec_u_traits<SCALAR_UINT_TYPE, VEC_LEN>::SCALAR_FLOAT_TYPE  SCALAR_FLOAT_TYPE;
+        typedef typename SIMDVec_u_traits<SCALAR_UINT_TYPE, VEC_LEN>::MASK_TYPE          MASK_TYPE;
+        typedef typename SIMDVec_u_traits<SCALAR_UINT_TYPE, VEC_LEN>::SWIZZLE_MASK_TYPE  SWIZZLE_MASK_TYPE;
+        typedef typename SIMDVec_u_traits<SCALAR_UINT_TYPE, VEC_LEN>::HALF_LEN_VEC_TYPE  HALF_LEN_VEC_TYPE;
+
+        typedef typename SIMDVec_u_traits<SCALAR_UINT_TYPE, VEC_LEN>::SCALAR_UINT_LOWER_PRECISION  SCALAR_UINT_LOWER_PRECISION;
+        typedef typename SIMDVec_u_traits<SCALAR_UINT_TYPE, VEC_LEN>::SCALAR_UINT_HIGHER_PRECISION SCALAR_UINT_HIGHER_PRECISION;
+
+        typedef typename VecExtType<SCALAR_UINT_TYPE, VEC_LEN>::type    VEC_EXT_TYPE;
+        // Signed vector of the same layout. Comparison results and selectors use this type.
+        typedef typename VecExtType<SCALAR_INT_TYPE, VEC_LEN>::type     VEC_EXT_SEL_TYPE;
+
+        // Conversion operators and packing require access to private members.
+        template<typename T, uint32_t L>
+        friend class SIMDVec_u;
+        template<typename T, uint32_t L>
+        friend class SIMDVec_i;
+        template<typename T, uint32_t L>
+        friend class SIMDVec_f;
+
+    public:
+        constexpr static uint32_t alignment() { return VEC_LEN*sizeof(SCALAR_UINT_TYPE); }
+
+    private:
+        // This is the only data member and it is a low level representation of vector register.
+        alignas(alignment()) VEC_EXT_TYPE mVec;
+
+        UME_FORCE_INLINE explicit SIMDVec_u(VEC_EXT_TYPE const & x) : mVec(x) {}
+
+        // Broadcast scalar to all lanes.
+        static UME_FORCE_INLINE VEC_EXT_TYPE splat(SCALAR_UINT_TYPE x) {
+            return x - VEC_EXT_TYPE();
+        }
+        // Select 'b' in lanes where mask is set, and 'a' otherwise.
+        static UME_FORCE_INLINE VEC_EXT_TYPE blendExt(MASK_TYPE const & mask, VEC_EXT_TYPE const & a, VEC_EXT_TYPE const & b) {
+            return __builtin_convertvector(mask.mMask, VEC_EXT_SEL_TYPE) ? b : a;
+        }
+        // Convert result of vector comparison to mask.
+        template<typename CMP_TYPE>
+        static UME_FORCE_INLINE MASK_TYPE toMask(CMP_TYPE const & cmp) {
+            return MASK_TYPE(__builtin_convertvector(cmp, typename MASK_TYPE::VEC_EXT_TYPE));
+        }
+
+    public:
+        // ZERO-CONSTR
+        UME_FORCE_INLINE SIMDVec_u() {};
+
+        // SET-CONSTR
+        UME_FORCE_INLINE SIMDVec_u(SCALAR_UINT_TYPE x) : mVec(splat(x)) {}
+        // This constructor is used to force types other than SCALAR_TYPES
+        // to be promoted to SCALAR_TYPE instead of SCALAR_TYPE*. This prevents
+        // ambiguity between SET-CONSTR and LOAD-CONSTR.
+        template<typename T>
+        UME_FORCE_INLINE SIMDVec_u(
+            T i,
+            typename std::enable_if< std::is_fundamental<T>::value &&
+                                    !std::is_same<T, SCALAR_UINT_TYPE>::value,
+                                    void*>::type = nullptr)
+        : SIMDVec_u(static_cast<SCALAR_UINT_TYPE>(i)) {}
+
+        // LOAD-CONSTR - Construct by loading from memory
+        UME_FORCE_INLINE explicit SIMDVec_u(SCALAR_UINT_TYPE const * p) { this->load(p); }
+
+        UME_FORCE_INLINE SIMDVec_u(SCALAR_UINT_TYPE i0, SCALAR_UINT_TYPE i1)
+        : mVec(VEC_EXT_TYPE{
+            i0, i1 })
+        {}
+
+        UME_FORCE_INLINE SIMDVec_u(SCALAR_UINT_TYPE i0, SCALAR_UINT_TYPE i1, SCALAR_UINT_TYPE i2, SCALAR_UINT_TYPE i3)
+        : mVec(VEC_EXT_TYPE{
+            i0, i1, i2, i3 })
+        {}
+
+        UME_FORCE_INLINE SIMDVec_u(
+            SCALAR_UINT_TYPE i0, SCALAR_UINT_TYPE i1, SCALAR_UINT_TYPE i2, SCALAR_UINT_TYPE i3, SCALAR_UINT_TYPE i4, SCALAR_UINT_TYPE i5, SCALAR_UINT_TYPE i6, SCALAR_UINT_TYPE i7)
+        : mVec(VEC_EXT_TYPE{
+            i0, i1, i2, i3, i4, i5, i6, i7 })
+        {}
+
+        UME_FORCE_INLINE SIMDVec_u(
+            SCALAR_UINT_TYPE i0, SCALAR_UINT_TYPE i1, SCALAR_UINT_TYPE i2, SCALAR_UINT_TYPE i3, SCALAR_UINT_TYPE i4, SCALAR_UINT_TYPE i5, SCALAR_UINT_TYPE i6, SCALAR_UINT_TYPE i7,
+            SCALAR_UINT_TYPE i8, SCALAR_UINT_TYPE i9, SCALAR_UINT_TYPE i10, SCALAR_UINT_TYPE i11, SCALAR_UINT_TYPE i12, SCALAR_UINT_TYPE i13, SCALAR_UINT_TYPE i14, SCALAR_UINT_TYPE i15)
+        : mVec(VEC_EXT_TYPE{
+            i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15 })
+        {}
+
+        UME_FORCE_INLINE SIMDVec_u(
+            SCALAR_UINT_TYPE i0, SCALAR_UINT_TYPE i1, SCALAR_UINT_TYPE i2, SCALAR_UINT_TYPE i3, SCALAR_UINT_TYPE i4, SCALAR_UINT_TYPE i5, SCALAR_UINT_TYPE i6, SCALAR_UINT_TYPE i7,
+            SCALAR_UINT_TYPE i8, SCALAR_UINT_TYPE i9, SCALAR_UINT_TYPE i10, SCALAR_UINT_TYPE i11, SCALAR_UINT_TYPE i12, SCALAR_UINT_TYPE i13, SCALAR_UINT_TYPE i14, SCALAR_UINT_TYPE i15,
+            SCALAR_UINT_TYPE i16, SCALAR_UINT_TYPE i17, SCALAR_UINT_TYPE i18, SCALAR_UINT_TYPE i19, SCALAR_UINT_TYPE i20, SCALAR_UINT_TYPE i21, SCALAR_UINT_TYPE i22, SCALAR_UINT_TYPE i23,
+            SCALAR_UINT_TYPE i24, SCALAR_UINT_TYPE i25, SCALAR_UINT_TYPE i26, SCALAR_UINT_TYPE i27, SCALAR_UINT_TYPE i28, SCALAR_UINT_TYPE i29, SCALAR_UINT_TYPE i30, SCALAR_UINT_TYPE i31)
+        : mVec(VEC_EXT_TYPE{
+            i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15,
+            i16, i17, i18, i19, i20, i21, i22, i23, i24, i25, i26, i27, i28, i29, i30, i31 })
+        {}
+
+        UME_FORCE_INLINE SIMDVec_u(
+            SCALAR_UINT_TYPE i0, SCALAR_UINT_TYPE i1, SCALAR_UINT_TYPE i2, SCALAR_UINT_TYPE i3, SCALAR_UINT_TYPE i4, SCALAR_UINT_TYPE i5, SCALAR_UINT_TYPE i6, SCALAR_UINT_TYPE i7,
+            SCALAR_UINT_TYPE i8, SCALAR_UINT_TYPE i9, SCALAR_UINT_TYPE i10, SCALAR_UINT_TYPE i11, SCALAR_UINT_TYPE i12, SCALAR_UINT_TYPE i13, SCALAR_UINT_TYPE i14, SCALAR_UINT_TYPE i15,
+            SCALAR_UINT_TYPE i16, SCALAR_UINT_TYPE i17, SCALAR_UINT_TYPE i18, SCALAR_UINT_TYPE i19, SCALAR_UINT_TYPE i20, SCALAR_UINT_TYPE i21, SCALAR_UINT_TYPE i22, SCALAR_UINT_TYPE i23,
+            SCALAR_UINT_TYPE i24, SCALAR_UINT_TYPE i25, SCALAR_UINT_TYPE i26, SCALAR_UINT_TYPE i27, SCALAR_UINT_TYPE i28, SCALAR_UINT_TYPE i29, SCALAR_UINT_TYPE i30, SCALAR_UINT_TYPE i31,
+            SCALAR_UINT_TYPE i32, SCALAR_UINT_TYPE i33, SCALAR_UINT_TYPE i34, SCALAR_UINT_TYPE i35, SCALAR_UINT_TYPE i36, SCALAR_UINT_TYPE i37, SCALAR_UINT_TYPE i38, SCALAR_UINT_TYPE i39,
+            SCALAR_UINT_TYPE i40, SCALAR_UINT_TYPE i41, SCALAR_UINT_TYPE i42, SCALAR_UINT_TYPE i43, SCALAR_UINT_TYPE i44, SCALAR_UINT_TYPE i45, SCALAR_UINT_TYPE i46, SCALAR_UINT_TYPE i47,
+            SCALAR_UINT_TYPE i48, SCALAR_UINT_TYPE i49, SCALAR_UINT_TYPE i50, SCALAR_UINT_TYPE i51, SCALAR_UINT_TYPE i52, SCALAR_UINT_TYPE i53, SCALAR_UINT_TYPE i54, SCALAR_UINT_TYPE i55,
+            SCALAR_UINT_TYPE i56, SCALAR_UINT_TYPE i57, SCALAR_UINT_TYPE i58, SCALAR_UINT_TYPE i59, SCALAR_UINT_TYPE i60, SCALAR_UINT_TYPE i61, SCALAR_UINT_TYPE i62, SCALAR_UINT_TYPE i63)
+        : mVec(VEC_EXT_TYPE{
+            i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15,
+            i16, i17, i18, i19, i20, i21, i22, i23, i24, i25, i26, i27, i28, i29, i30, i31,
+            i32, i33, i34, i35, i36, i37, i38, i39, i40, i41, i42, i43, i44, i45, i46, i47,
+            i48, i49, i50, i51, i52, i53, i54, i55, i56, i57, i58, i59, i60, i61, i62, i63 })
+        {}
+
+        UME_FORCE_INLINE SIMDVec_u(
+            SCALAR_UINT_TYPE i0, SCALAR_UINT_TYPE i1, SCALAR_UINT_TYPE i2, SCALAR_UINT_TYPE i3, SCALAR_UINT_TYPE i4, SCALAR_UINT_TYPE i5, SCALAR_UINT_TYPE i6, SCALAR_UINT_TYPE i7,
+            SCALAR_UINT_TYPE i8, SCALAR_UINT_TYPE i9, SCALAR_UINT_TYPE i10, SCALAR_UINT_TYPE i11, SCALAR_UINT_TYPE i12, SCALAR_UINT_TYPE i13, SCALAR_UINT_TYPE i14, SCALAR_UINT_TYPE i15,
+            SCALAR_UINT_TYPE i16, SCALAR_UINT_TYPE i17, SCALAR_UINT_TYPE i18, SCALAR_UINT_TYPE i19, SCALAR_UINT_TYPE i20, SCALAR_UINT_TYPE i21, SCALAR_UINT_TYPE i22, SCALAR_UINT_TYPE i23,
+            SCALAR_UINT_TYPE i24, SCALAR_UINT_TYPE i25, SCALAR_UINT_TYPE i26, SCALAR_UINT_TYPE i27, SCALAR_UINT_TYPE i28, SCALAR_UINT_TYPE i29, SCALAR_UINT_TYPE i30, SCALAR_UINT_TYPE i31,
+            SCALAR_UINT_TYPE i32, SCALAR_UINT_TYPE i33, SCALAR_UINT_TYPE i34, SCALAR_UINT_TYPE i35, SCALAR_UINT_TYPE i36, SCALAR_UINT_TYPE i37, SCALAR_UINT_TYPE i38, SCALAR_UINT_TYPE i39,
+            SCALAR_UINT_TYPE i40, SCALAR_UINT_TYPE i41, SCALAR_UINT_TYPE i42, SCALAR_UINT_TYPE i43, SCALAR_UINT_TYPE i44, SCALAR_UINT_TYPE i45, SCALAR_UINT_TYPE i46, SCALAR_UINT_TYPE i47,
+            SCALAR_UINT_TYPE i48, SCALAR_UINT_TYPE i49, SCALAR_UINT_TYPE i50, SCALAR_UINT_TYPE i51, SCALAR_UINT_TYPE i52, SCALAR_UINT_TYPE i53, SCALAR_UINT_TYPE i54, SCALAR_UINT_TYPE i55,
+            SCALAR_UINT_TYPE i56, SCALAR_UINT_TYPE i57, SCALAR_UINT_TYPE i58, SCALAR_UINT_TYPE i59, SCALAR_UINT_TYPE i60, SCALAR_UINT_TYPE i61, SCALAR_UINT_TYPE i62, SCALAR_UINT_TYPE i63,
+            SCALAR_UINT_TYPE i64, SCALAR_UINT_TYPE i65, SCALAR_UINT_TYPE i66, SCALAR_UINT_TYPE i67, SCALAR_UINT_TYPE i68, SCALAR_UINT_TYPE i69, SCALAR_UINT_TYPE i70, SCALAR_UINT_TYPE i71,
+            SCALAR_UINT_TYPE i72, SCALAR_UINT_TYPE i73, SCALAR_UINT_TYPE i74, SCALAR_UINT_TYPE i75, SCALAR_UINT_TYPE i76, SCALAR_UINT_TYPE i77, SCALAR_UINT_TYPE i78, SCALAR_UINT_TYPE i79,
+            SCALAR_UINT_TYPE i80, SCALAR_UINT_TYPE i81, SCALAR_UINT_TYPE i82, SCALAR_UINT_TYPE i83, SCALAR_UINT_TYPE i84, SCALAR_UINT_TYPE i85, SCALAR_UINT_TYPE i86, SCALAR_UINT_TYPE i87,
+            SCALAR_UINT_TYPE i88, SCALAR_UINT_TYPE i89, SCALAR_UINT_TYPE i90, SCALAR_UINT_TYPE i91, SCALAR_UINT_TYPE i92, SCALAR_UINT_TYPE i93, SCALAR_UINT_TYPE i94, SCALAR_UINT_TYPE i95,
+            SCALAR_UINT_TYPE i96, SCALAR_UINT_TYPE i97, SCALAR_UINT_TYPE i98, SCALAR_UINT_TYPE i99, SCALAR_UINT_TYPE i100, SCALAR_UINT_TYPE i101, SCALAR_UINT_TYPE i102, SCALAR_UINT_TYPE i103,
+            SCALAR_UINT_TYPE i104, SCALAR_UINT_TYPE i105, SCALAR_UINT_TYPE i106, SCALAR_UINT_TYPE i107, SCALAR_UINT_TYPE i108, SCALAR_UINT_TYPE i109, SCALAR_UINT_TYPE i110, SCALAR_UINT_TYPE i111,
+            SCALAR_UINT_TYPE i112, SCALAR_UINT_TYPE i113, SCALAR_UINT_TYPE i114, SCALAR_UINT_TYPE i115, SCALAR_UINT_TYPE i116, SCALAR_UINT_TYPE i117, SCALAR_UINT_TYPE i118, SCALAR_UINT_TYPE i119,
+            SCALAR_UINT_TYPE i120, SCALAR_UINT_TYPE i121, SCALAR_UINT_TYPE i122, SCALAR_UINT_TYPE i123, SCALAR_UINT_TYPE i124, SCALAR_UINT_TYPE i125, SCALAR_UINT_TYPE i126, SCALAR_UINT_TYPE i127)
+        : mVec(VEC_EXT_TYPE{
+            i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11, i12, i13, i14, i15,
+            i16, i17, i18, i19, i20, i21, i22, i23, i24, i25, i26, i27, i28, i29, i30, i31,
+            i32, i33, i34, i35, i36, i37, i38, i39, i40, i41, i42, i43, i44, i45, i46, i47,
+            i48, i49, i50, i51, i52, i53, i54, i55, i56, i57, i58, i59, i60, i61, i62, i63,
+            i64, i65, i66, i67, i68, i69, i70, i71, i72, i73, i74, i75, i76, i77, i78, i79,
+            i80, i81, i82, i83, i84, i85, i86, i87, i88, i89, i90, i91, i92, i93, i94, i95,
+            i96, i97, i98, i99, i100, i101, i102, i103, i104, i105, i106, i107, i108, i109, i110, i111,
+            i112, i113, i114, i115, i116, i117, i118, i119, i120, i121, i122, i123, i124, i125, i126, i127 })
+        {}
+
+        // EXTRACT
+        UME_FORCE_INLINE SCALAR_UINT_TYPE extract(uint32_t index) const {
+            return mVec[index];
+        }
+        UME_FORCE_INLINE SCALAR_UINT_TYPE operator[] (uint32_t index) const {
+            return extract(index);
+        }
+
+        // INSERT
+        UME_FORCE_INLINE SIMDVec_u & insert(uint32_t index, SCALAR_UINT_TYPE value) {
+            mVec[index] = value;
+            return *this;
+        }
+        UME_FORCE_INLINE IntermediateIndex<SIMDVec_u, SCALAR_UINT_TYPE> operator[] (uint32_t index) {
+            return IntermediateIndex<SIMDVec_u, SCALAR_UINT_TYPE>(index, static_cast<SIMDVec_u &>(*this));
+        }
+
+        // Override Mask Access operators
+#if defined(USE_PARENTHESES_IN_MASK_ASSIGNMENT)
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_u, SCALAR_UINT_TYPE, MASK_TYPE> operator() (MASK_TYPE const & mask) {
+            return IntermediateMask<SIMDVec_u, SCALAR_UINT_TYPE, MASK_TYPE>(mask, static_cast<SIMDVec_u &>(*this));
+        }
+#else
+        UME_FORCE_INLINE IntermediateMask<SIMDVec_u, SCALAR_UINT_TYPE, MASK_TYPE> operator[] (MASK_TYPE const & mask) {
+            return IntermediateMask<SIMDVec_u, SCALAR_UINT_TYPE, MASK_TYPE>(mask, static_cast<SIMDVec_u &>(*this));
+        }
+#endif
+
+        // ASSIGNV
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVec_u const & src) {
+            mVec = src.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator= (SIMDVec_u const & b) {
+            return this->assign(b);
+        }
+        // MASSIGNV
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & src) {
+            mVec = blendExt(mask, mVec, src.mVec);
+            return *this;
+        }
+        // ASSIGNS
+        UME_FORCE_INLINE SIMDVec_u & assign(SCALAR_UINT_TYPE b) {
+            mVec = splat(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator= (SCALAR_UINT_TYPE b) {
+            return this->assign(b);
+        }
+        // MASSIGNS
+        UME_FORCE_INLINE SIMDVec_u & assign(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) {
+            mVec = blendExt(mask, mVec, splat(b));
+            return *this;
+        }
+
+        // PREFETCH0
+        // PREFETCH1
+        // PREFETCH2
+
+        // LOAD
+        UME_FORCE_INLINE SIMDVec_u & load(SCALAR_UINT_TYPE const *p) {
+            std::memcpy(&mVec, p, sizeof(VEC_EXT_TYPE));
+            return *this;
+        }
+        // MLOAD
+        UME_FORCE_INLINE SIMDVec_u & load(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE const *p) {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0) mVec[i] = p[i];
+            }
+            return *this;
+        }
+        // LOADA
+        UME_FORCE_INLINE SIMDVec_u & loada(SCALAR_UINT_TYPE const *p) {
+            std::memcpy(&mVec, __builtin_assume_aligned(p, alignment()), sizeof(VEC_EXT_TYPE));
+            return *this;
+        }
+        // MLOADA
+        UME_FORCE_INLINE SIMDVec_u & loada(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE const *p) {
+            return load(mask, p);
+        }
+
+        // STORE
+        UME_FORCE_INLINE SCALAR_UINT_TYPE* store(SCALAR_UINT_TYPE* p) const {
+            std::memcpy(p, &mVec, sizeof(VEC_EXT_TYPE));
+            return p;
+        }
+        // MSTORE
+        UME_FORCE_INLINE SCALAR_UINT_TYPE* store(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE* p) const {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0) p[i] = mVec[i];
+            }
+            return p;
+        }
+        // STOREA
+        UME_FORCE_INLINE SCALAR_UINT_TYPE* storea(SCALAR_UINT_TYPE* p) const {
+            std::memcpy(__builtin_assume_aligned(p, alignment()), &mVec, sizeof(VEC_EXT_TYPE));
+            return p;
+        }
+        // MSTOREA
+        UME_FORCE_INLINE SCALAR_UINT_TYPE* storea(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE* p) const {
+            return store(mask, p);
+        }
+
+        // BLENDV
+        UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) const {
+            return SIMDVec_u(blendExt(mask, mVec, b.mVec));
+        }
+        // BLENDS
+        UME_FORCE_INLINE SIMDVec_u blend(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(blendExt(mask, mVec, splat(b)));
+        }
+
+        // SWIZZLE
+        UME_FORCE_INLINE SIMDVec_u swizzle(SWIZZLE_MASK_TYPE const & sMask) const {
+            SIMDVec_u retval;
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                retval.mVec[i] = mVec[sMask[i]];
+            }
+            return retval;
+        }
+        template<int... INDICES>
+        UME_FORCE_INLINE SIMDVec_u swizzle() const {
+            static_assert(sizeof...(INDICES) == VEC_LEN, "Invalid number of template parameters.");
+            return SIMDVec_u(__builtin_shufflevector(mVec, mVec, INDICES...));
+        }
+        // SWIZZLEA
+        UME_FORCE_INLINE SIMDVec_u & swizzlea(SWIZZLE_MASK_TYPE const & sMask) {
+            mVec = swizzle(sMask).mVec;
+            return *this;
+        }
+        template<int... INDICES>
+        UME_FORCE_INLINE SIMDVec_u & swizzlea() {
+            static_assert(sizeof...(INDICES) == VEC_LEN, "Invalid number of template parameters.");
+            mVec = __builtin_shufflevector(mVec, mVec, INDICES...);
+            return *this;
+        }
+
+        // ADDV
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVec_u const & b) const {
+            return SIMDVec_u(mVec + b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator+ (SIMDVec_u const & b) const {
+            return add(b);
+        }
+        // MADDV
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) const {
+            return SIMDVec_u(blendExt(mask, mVec, mVec + b.mVec));
+        }
+        // ADDS
+        UME_FORCE_INLINE SIMDVec_u add(SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(mVec + splat(b));
+        }
+        UME_FORCE_INLINE SIMDVec_u operator+ (SCALAR_UINT_TYPE b) const {
+            return add(b);
+        }
+        // MADDS
+        UME_FORCE_INLINE SIMDVec_u add(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(blendExt(mask, mVec, mVec + splat(b)));
+        }
+        // ADDVA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVec_u const & b) {
+            mVec = mVec + b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator+= (SIMDVec_u const & b) {
+            return adda(b);
+        }
+        // MADDVA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) {
+            mVec = blendExt(mask, mVec, mVec + b.mVec);
+            return *this;
+        }
+        // ADDSA
+        UME_FORCE_INLINE SIMDVec_u & adda(SCALAR_UINT_TYPE b) {
+            mVec = mVec + splat(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator+= (SCALAR_UINT_TYPE b) {
+            return adda(b);
+        }
+        // MADDSA
+        UME_FORCE_INLINE SIMDVec_u & adda(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec + splat(b));
+            return *this;
+        }
+
+        // Unsigned saturation: wrapped sum is smaller than the operand on overflow,
+        // and wrapped difference is only valid when a >= b.
+        static UME_FORCE_INLINE VEC_EXT_TYPE addSaturatedExt(VEC_EXT_TYPE const & a, VEC_EXT_TYPE const & b) {
+            VEC_EXT_TYPE t0 = a + b;
+            return t0 | (VEC_EXT_TYPE)(t0 < a);
+        }
+        static UME_FORCE_INLINE VEC_EXT_TYPE subSaturatedExt(VEC_EXT_TYPE const & a, VEC_EXT_TYPE const & b) {
+            VEC_EXT_TYPE t0 = a - b;
+            return t0 & (VEC_EXT_TYPE)(a >= b);
+        }
+
+        // SADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVec_u const & b) const {
+            return SIMDVec_u(addSaturatedExt(mVec, b.mVec));
+        }
+        // MSADDV
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) const {
+            return SIMDVec_u(blendExt(mask, mVec, addSaturatedExt(mVec, b.mVec)));
+        }
+        // SADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(addSaturatedExt(mVec, splat(b)));
+        }
+        // MSADDS
+        UME_FORCE_INLINE SIMDVec_u sadd(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(blendExt(mask, mVec, addSaturatedExt(mVec, splat(b))));
+        }
+        // SADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVec_u const & b) {
+            mVec = addSaturatedExt(mVec, b.mVec);
+            return *this;
+        }
+        // MSADDVA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) {
+            mVec = blendExt(mask, mVec, addSaturatedExt(mVec, b.mVec));
+            return *this;
+        }
+        // SADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SCALAR_UINT_TYPE b) {
+            mVec = addSaturatedExt(mVec, splat(b));
+            return *this;
+        }
+        // MSADDSA
+        UME_FORCE_INLINE SIMDVec_u & sadda(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) {
+            mVec = blendExt(mask, mVec, addSaturatedExt(mVec, splat(b)));
+            return *this;
+        }
+        // POSTINC
+        UME_FORCE_INLINE SIMDVec_u postinc() {
+            SIMDVec_u t0(mVec);
+            mVec = mVec + SCALAR_UINT_TYPE(1);
+            return t0;
+        }
+        UME_FORCE_INLINE SIMDVec_u operator++ (int) {
+            return postinc();
+        }
+        // MPOSTINC
+        UME_FORCE_INLINE SIMDVec_u postinc(SIMDVecMask<VEC_LEN> const & mask) {
+            SIMDVec_u t0(mVec);
+            mVec = blendExt(mask, mVec, mVec + SCALAR_UINT_TYPE(1));
+            return t0;
+        }
+        // PREFINC
+        UME_FORCE_INLINE SIMDVec_u & prefinc() {
+            mVec = mVec + SCALAR_UINT_TYPE(1);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator++ () {
+            return prefinc();
+        }
+        // MPREFINC
+        UME_FORCE_INLINE SIMDVec_u & prefinc(SIMDVecMask<VEC_LEN> const & mask) {
+            mVec = blendExt(mask, mVec, mVec + SCALAR_UINT_TYPE(1));
+            return *this;
+        }
+        // SUBV
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVec_u const & b) const {
+            return SIMDVec_u(mVec - b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator- (SIMDVec_u const & b) const {
+            return sub(b);
+        }
+        // MSUBV
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) const {
+            return SIMDVec_u(blendExt(mask, mVec, mVec - b.mVec));
+        }
+        // SUBS
+        UME_FORCE_INLINE SIMDVec_u sub(SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(mVec - splat(b));
+        }
+        UME_FORCE_INLINE SIMDVec_u operator- (SCALAR_UINT_TYPE b) const {
+            return sub(b);
+        }
+        // MSUBS
+        UME_FORCE_INLINE SIMDVec_u sub(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(blendExt(mask, mVec, mVec - splat(b)));
+        }
+        // SUBVA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVec_u const & b) {
+            mVec = mVec - b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-= (SIMDVec_u const & b) {
+            return suba(b);
+        }
+        // MSUBVA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) {
+            mVec = blendExt(mask, mVec, mVec - b.mVec);
+            return *this;
+        }
+        // SUBSA
+        UME_FORCE_INLINE SIMDVec_u & suba(SCALAR_UINT_TYPE b) {
+            mVec = mVec - splat(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-= (SCALAR_UINT_TYPE b) {
+            return suba(b);
+        }
+        // MSUBSA
+        UME_FORCE_INLINE SIMDVec_u & suba(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec - splat(b));
+            return *this;
+        }
+        // SSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVec_u const & b) const {
+            return SIMDVec_u(subSaturatedExt(mVec, b.mVec));
+        }
+        // MSSUBV
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) const {
+            return SIMDVec_u(blendExt(mask, mVec, subSaturatedExt(mVec, b.mVec)));
+        }
+        // SSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(subSaturatedExt(mVec, splat(b)));
+        }
+        // MSSUBS
+        UME_FORCE_INLINE SIMDVec_u ssub(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(blendExt(mask, mVec, subSaturatedExt(mVec, splat(b))));
+        }
+        // SSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVec_u const & b) {
+            mVec = subSaturatedExt(mVec, b.mVec);
+            return *this;
+        }
+        // MSSUBVA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) {
+            mVec = blendExt(mask, mVec, subSaturatedExt(mVec, b.mVec));
+            return *this;
+        }
+        // SSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SCALAR_UINT_TYPE b) {
+            mVec = subSaturatedExt(mVec, splat(b));
+            return *this;
+        }
+        // MSSUBSA
+        UME_FORCE_INLINE SIMDVec_u & ssuba(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) {
+            mVec = blendExt(mask, mVec, subSaturatedExt(mVec, splat(b)));
+            return *this;
+        }
+        // SUBFROMV
+        UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVec_u const & b) const {
+            return SIMDVec_u(b.mVec - mVec);
+        }
+        // MSUBFROMV
+        UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) const {
+            return SIMDVec_u(blendExt(mask, b.mVec, b.mVec - mVec));
+        }
+        // SUBFROMS
+        UME_FORCE_INLINE SIMDVec_u subfrom(SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(splat(b) - mVec);
+        }
+        // MSUBFROMS
+        UME_FORCE_INLINE SIMDVec_u subfrom(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(blendExt(mask, splat(b), splat(b) - mVec));
+        }
+        // SUBFROMVA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(SIMDVec_u const & b) {
+            mVec = b.mVec - mVec;
+            return *this;
+        }
+        // MSUBFROMVA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) {
+            mVec = blendExt(mask, b.mVec, b.mVec - mVec);
+            return *this;
+        }
+        // SUBFROMSA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(SCALAR_UINT_TYPE b) {
+            mVec = splat(b) - mVec;
+            return *this;
+        }
+        // MSUBFROMSA
+        UME_FORCE_INLINE SIMDVec_u & subfroma(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) {
+            mVec = blendExt(mask, splat(b), splat(b) - mVec);
+            return *this;
+        }
+        // POSTDEC
+        UME_FORCE_INLINE SIMDVec_u postdec() {
+            SIMDVec_u t0(mVec);
+            mVec = mVec - SCALAR_UINT_TYPE(1);
+            return t0;
+        }
+        UME_FORCE_INLINE SIMDVec_u operator-- (int) {
+            return postdec();
+        }
+        // MPOSTDEC
+        UME_FORCE_INLINE SIMDVec_u postdec(SIMDVecMask<VEC_LEN> const & mask) {
+            SIMDVec_u t0(mVec);
+            mVec = blendExt(mask, mVec, mVec - SCALAR_UINT_TYPE(1));
+            return t0;
+        }
+        // PREFDEC
+        UME_FORCE_INLINE SIMDVec_u & prefdec() {
+            mVec = mVec - SCALAR_UINT_TYPE(1);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator-- () {
+            return prefdec();
+        }
+        // MPREFDEC
+        UME_FORCE_INLINE SIMDVec_u & prefdec(SIMDVecMask<VEC_LEN> const & mask) {
+            mVec = blendExt(mask, mVec, mVec - SCALAR_UINT_TYPE(1));
+            return *this;
+        }
+        // MULV
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVec_u const & b) const {
+            return SIMDVec_u(mVec * b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator* (SIMDVec_u const & b) const {
+            return mul(b);
+        }
+        // MMULV
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) const {
+            return SIMDVec_u(blendExt(mask, mVec, mVec * b.mVec));
+        }
+        // MULS
+        UME_FORCE_INLINE SIMDVec_u mul(SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(mVec * splat(b));
+        }
+        UME_FORCE_INLINE SIMDVec_u operator* (SCALAR_UINT_TYPE b) const {
+            return mul(b);
+        }
+        // MMULS
+        UME_FORCE_INLINE SIMDVec_u mul(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(blendExt(mask, mVec, mVec * splat(b)));
+        }
+        // MULVA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVec_u const & b) {
+            mVec = mVec * b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator*= (SIMDVec_u const & b) {
+            return mula(b);
+        }
+        // MMULVA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) {
+            mVec = blendExt(mask, mVec, mVec * b.mVec);
+            return *this;
+        }
+        // MULSA
+        UME_FORCE_INLINE SIMDVec_u & mula(SCALAR_UINT_TYPE b) {
+            mVec = mVec * splat(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator*= (SCALAR_UINT_TYPE b) {
+            return mula(b);
+        }
+        // MMULSA
+        UME_FORCE_INLINE SIMDVec_u & mula(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec * splat(b));
+            return *this;
+        }
+        // DIVV
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVec_u const & b) const {
+            return SIMDVec_u(mVec / b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (SIMDVec_u const & b) const {
+            return div(b);
+        }
+        // MDIVV
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) const {
+            return SIMDVec_u(blendExt(mask, mVec, mVec / blendExt(mask, splat(SCALAR_UINT_TYPE(1)), b.mVec)));
+        }
+        // DIVS
+        UME_FORCE_INLINE SIMDVec_u div(SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(mVec / splat(b));
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (SCALAR_UINT_TYPE b) const {
+            return div(b);
+        }
+        // MDIVS
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(blendExt(mask, mVec, mVec / blendExt(mask, splat(SCALAR_UINT_TYPE(1)), splat(b))));
+        }
+        // DIVVA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVec_u const & b) {
+            mVec = mVec / b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDVec_u const & b) {
+            return diva(b);
+        }
+        // MDIVVA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) {
+            mVec = blendExt(mask, mVec, mVec / blendExt(mask, splat(SCALAR_UINT_TYPE(1)), b.mVec));
+            return *this;
+        }
+        // DIVSA
+        UME_FORCE_INLINE SIMDVec_u & diva(SCALAR_UINT_TYPE b) {
+            mVec = mVec / splat(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (SCALAR_UINT_TYPE b) {
+            return diva(b);
+        }
+        // MDIVSA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec / blendExt(mask, splat(SCALAR_UINT_TYPE(1)), splat(b)));
+            return *this;
+        }
+        // DIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDDivisor<SCALAR_UINT_TYPE> const & b) const {
+            return div(b.divisor());
+        }
+        UME_FORCE_INLINE SIMDVec_u operator/ (SIMDDivisor<SCALAR_UINT_TYPE> const & b) const {
+            return div(b);
+        }
+        // MDIVD
+        UME_FORCE_INLINE SIMDVec_u div(SIMDVecMask<VEC_LEN> const & mask, SIMDDivisor<SCALAR_UINT_TYPE> const & b) const {
+            return div(mask, b.divisor());
+        }
+        // DIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDDivisor<SCALAR_UINT_TYPE> const & b) {
+            return diva(b.divisor());
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator/= (SIMDDivisor<SCALAR_UINT_TYPE> const & b) {
+            return diva(b);
+        }
+        // MDIVDA
+        UME_FORCE_INLINE SIMDVec_u & diva(SIMDVecMask<VEC_LEN> const & mask, SIMDDivisor<SCALAR_UINT_TYPE> const & b) {
+            return diva(mask, b.divisor());
+        }
+        // RCP
+        UME_FORCE_INLINE SIMDVec_u rcp() const {
+            return SIMDVec_u(splat(SCALAR_UINT_TYPE(1)) / mVec);
+        }
+        // MRCP
+        UME_FORCE_INLINE SIMDVec_u rcp(SIMDVecMask<VEC_LEN> const & mask) const {
+            return SIMDVec_u(blendExt(mask, mVec, splat(SCALAR_UINT_TYPE(1)) / blendExt(mask, splat(SCALAR_UINT_TYPE(1)), mVec)));
+        }
+        // RCPS
+        UME_FORCE_INLINE SIMDVec_u rcp(SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(splat(b) / mVec);
+        }
+        // MRCPS
+        UME_FORCE_INLINE SIMDVec_u rcp(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(blendExt(mask, mVec, splat(b) / blendExt(mask, splat(SCALAR_UINT_TYPE(1)), mVec)));
+        }
+        // RCPA
+        UME_FORCE_INLINE SIMDVec_u & rcpa() {
+            mVec = splat(SCALAR_UINT_TYPE(1)) / mVec;
+            return *this;
+        }
+        // MRCPA
+        UME_FORCE_INLINE SIMDVec_u & rcpa(SIMDVecMask<VEC_LEN> const & mask) {
+            mVec = blendExt(mask, mVec, splat(SCALAR_UINT_TYPE(1)) / blendExt(mask, splat(SCALAR_UINT_TYPE(1)), mVec));
+            return *this;
+        }
+        // RCPSA
+        UME_FORCE_INLINE SIMDVec_u & rcpa(SCALAR_UINT_TYPE b) {
+            mVec = splat(b) / mVec;
+            return *this;
+        }
+        // MRCPSA
+        UME_FORCE_INLINE SIMDVec_u & rcpa(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) {
+            mVec = blendExt(mask, mVec, splat(b) / blendExt(mask, splat(SCALAR_UINT_TYPE(1)), mVec));
+            return *this;
+        }
+
+        // CMPEQV
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpeq(SIMDVec_u const & b) const {
+            return toMask(mVec == b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator== (SIMDVec_u const & b) const {
+            return cmpeq(b);
+        }
+        // CMPEQS
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpeq(SCALAR_UINT_TYPE b) const {
+            return toMask(mVec == splat(b));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator== (SCALAR_UINT_TYPE b) const {
+            return cmpeq(b);
+        }
+        // CMPNEV
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpne(SIMDVec_u const & b) const {
+            return toMask(mVec != b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator!= (SIMDVec_u const & b) const {
+            return cmpne(b);
+        }
+        // CMPNES
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpne(SCALAR_UINT_TYPE b) const {
+            return toMask(mVec != splat(b));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator!= (SCALAR_UINT_TYPE b) const {
+            return cmpne(b);
+        }
+        // CMPGTV
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpgt(SIMDVec_u const & b) const {
+            return toMask(mVec > b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator> (SIMDVec_u const & b) const {
+            return cmpgt(b);
+        }
+        // CMPGTS
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpgt(SCALAR_UINT_TYPE b) const {
+            return toMask(mVec > splat(b));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator> (SCALAR_UINT_TYPE b) const {
+            return cmpgt(b);
+        }
+        // CMPLTV
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmplt(SIMDVec_u const & b) const {
+            return toMask(mVec < b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator< (SIMDVec_u const & b) const {
+            return cmplt(b);
+        }
+        // CMPLTS
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmplt(SCALAR_UINT_TYPE b) const {
+            return toMask(mVec < splat(b));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator< (SCALAR_UINT_TYPE b) const {
+            return cmplt(b);
+        }
+        // CMPGEV
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpge(SIMDVec_u const & b) const {
+            return toMask(mVec >= b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator>= (SIMDVec_u const & b) const {
+            return cmpge(b);
+        }
+        // CMPGES
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmpge(SCALAR_UINT_TYPE b) const {
+            return toMask(mVec >= splat(b));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator>= (SCALAR_UINT_TYPE b) const {
+            return cmpge(b);
+        }
+        // CMPLEV
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmple(SIMDVec_u const & b) const {
+            return toMask(mVec <= b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator<= (SIMDVec_u const & b) const {
+            return cmple(b);
+        }
+        // CMPLES
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> cmple(SCALAR_UINT_TYPE b) const {
+            return toMask(mVec <= splat(b));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator<= (SCALAR_UINT_TYPE b) const {
+            return cmple(b);
+        }
+        // CMPEV
+        UME_FORCE_INLINE bool cmpe(SIMDVec_u const & b) const {
+            return cmpeq(b).hland();
+        }
+        // CMPES
+        UME_FORCE_INLINE bool cmpe(SCALAR_UINT_TYPE b) const {
+            return cmpeq(b).hland();
+        }
+
+        // UNIQUE
+
+        // HADD
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hadd() const {
+            return VecExtReduce<SCALAR_UINT_TYPE, VEC_LEN>::template apply<VecExtAdd>(mVec);
+        }
+        // MHADD
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hadd(SIMDVecMask<VEC_LEN> const & mask) const {
+            return VecExtReduce<SCALAR_UINT_TYPE, VEC_LEN>::template apply<VecExtAdd>(blendExt(mask, splat(SCALAR_UINT_TYPE(0)), mVec));
+        }
+        // HADDS
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hadd(SCALAR_UINT_TYPE b) const {
+            return b + hadd();
+        }
+        // MHADDS
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hadd(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return b + hadd(mask);
+        }
+        // HMUL
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hmul() const {
+            return VecExtReduce<SCALAR_UINT_TYPE, VEC_LEN>::template apply<VecExtMul>(mVec);
+        }
+        // MHMUL
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hmul(SIMDVecMask<VEC_LEN> const & mask) const {
+            return VecExtReduce<SCALAR_UINT_TYPE, VEC_LEN>::template apply<VecExtMul>(blendExt(mask, splat(SCALAR_UINT_TYPE(1)), mVec));
+        }
+        // HMULS
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hmul(SCALAR_UINT_TYPE b) const {
+            return b * hmul();
+        }
+        // MHMULS
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hmul(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return b * hmul(mask);
+        }
+
+        // FMULADDV
+        UME_FORCE_INLINE SIMDVec_u fmuladd(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            return SIMDVec_u(mVec * b.mVec + c.mVec);
+        }
+        // MFMULADDV
+        UME_FORCE_INLINE SIMDVec_u fmuladd(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            return SIMDVec_u(blendExt(mask, mVec, mVec * b.mVec + c.mVec));
+        }
+        // FMULSUBV
+        UME_FORCE_INLINE SIMDVec_u fmulsub(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            return SIMDVec_u(mVec * b.mVec - c.mVec);
+        }
+        // MFMULSUBV
+        UME_FORCE_INLINE SIMDVec_u fmulsub(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            return SIMDVec_u(blendExt(mask, mVec, mVec * b.mVec - c.mVec));
+        }
+        // FADDMULV
+        UME_FORCE_INLINE SIMDVec_u faddmul(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            return SIMDVec_u((mVec + b.mVec) * c.mVec);
+        }
+        // MFADDMULV
+        UME_FORCE_INLINE SIMDVec_u faddmul(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            return SIMDVec_u(blendExt(mask, mVec, (mVec + b.mVec) * c.mVec));
+        }
+        // FSUBMULV
+        UME_FORCE_INLINE SIMDVec_u fsubmul(SIMDVec_u const & b, SIMDVec_u const & c) const {
+            return SIMDVec_u((mVec - b.mVec) * c.mVec);
+        }
+        // MFSUBMULV
+        UME_FORCE_INLINE SIMDVec_u fsubmul(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b, SIMDVec_u const & c) const {
+            return SIMDVec_u(blendExt(mask, mVec, (mVec - b.mVec) * c.mVec));
+        }
+
+        // MAXV
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVec_u const & b) const {
+            return SIMDVec_u((mVec > b.mVec) ? mVec : b.mVec);
+        }
+        // MMAXV
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) const {
+            return SIMDVec_u(blendExt(mask, mVec, (mVec > b.mVec) ? mVec : b.mVec));
+        }
+        // MAXS
+        UME_FORCE_INLINE SIMDVec_u max(SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u((mVec > splat(b)) ? mVec : splat(b));
+        }
+        // MMAXS
+        UME_FORCE_INLINE SIMDVec_u max(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(blendExt(mask, mVec, (mVec > splat(b)) ? mVec : splat(b)));
+        }
+        // MAXVA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVec_u const & b) {
+            mVec = (mVec > b.mVec) ? mVec : b.mVec;
+            return *this;
+        }
+        // MMAXVA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) {
+            mVec = blendExt(mask, mVec, (mVec > b.mVec) ? mVec : b.mVec);
+            return *this;
+        }
+        // MAXSA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SCALAR_UINT_TYPE b) {
+            mVec = (mVec > splat(b)) ? mVec : splat(b);
+            return *this;
+        }
+        // MMAXSA
+        UME_FORCE_INLINE SIMDVec_u & maxa(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) {
+            mVec = blendExt(mask, mVec, (mVec > splat(b)) ? mVec : splat(b));
+            return *this;
+        }
+        // MINV
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVec_u const & b) const {
+            return SIMDVec_u((mVec < b.mVec) ? mVec : b.mVec);
+        }
+        // MMINV
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) const {
+            return SIMDVec_u(blendExt(mask, mVec, (mVec < b.mVec) ? mVec : b.mVec));
+        }
+        // MINS
+        UME_FORCE_INLINE SIMDVec_u min(SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u((mVec < splat(b)) ? mVec : splat(b));
+        }
+        // MMINS
+        UME_FORCE_INLINE SIMDVec_u min(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(blendExt(mask, mVec, (mVec < splat(b)) ? mVec : splat(b)));
+        }
+        // MINVA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVec_u const & b) {
+            mVec = (mVec < b.mVec) ? mVec : b.mVec;
+            return *this;
+        }
+        // MMINVA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) {
+            mVec = blendExt(mask, mVec, (mVec < b.mVec) ? mVec : b.mVec);
+            return *this;
+        }
+        // MINSA
+        UME_FORCE_INLINE SIMDVec_u & mina(SCALAR_UINT_TYPE b) {
+            mVec = (mVec < splat(b)) ? mVec : splat(b);
+            return *this;
+        }
+        // MMINSA
+        UME_FORCE_INLINE SIMDVec_u & mina(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) {
+            mVec = blendExt(mask, mVec, (mVec < splat(b)) ? mVec : splat(b));
+            return *this;
+        }
+        // HMAX
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hmax() const {
+            return VecExtReduce<SCALAR_UINT_TYPE, VEC_LEN>::template apply<VecExtMax>(mVec);
+        }
+        // MHMAX
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hmax(SIMDVecMask<VEC_LEN> const & mask) const {
+            return VecExtReduce<SCALAR_UINT_TYPE, VEC_LEN>::template apply<VecExtMax>(blendExt(mask, splat(std::numeric_limits<SCALAR_UINT_TYPE>::lowest()), mVec));
+        }
+        // IMAX
+        UME_FORCE_INLINE uint32_t imax() const {
+            SCALAR_UINT_TYPE t0 = hmax();
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mVec[i] == t0) return i;
+            }
+            return 0;
+        }
+        // MIMAX
+        UME_FORCE_INLINE uint32_t imax(SIMDVecMask<VEC_LEN> const & mask) const {
+            SCALAR_UINT_TYPE t0 = hmax(mask);
+            if (t0 == std::numeric_limits<SCALAR_UINT_TYPE>::lowest()) return 0xFFFFFFFF;
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0 && mVec[i] == t0) return i;
+            }
+            return 0xFFFFFFFF;
+        }
+        // HMIN
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hmin() const {
+            return VecExtReduce<SCALAR_UINT_TYPE, VEC_LEN>::template apply<VecExtMin>(mVec);
+        }
+        // MHMIN
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hmin(SIMDVecMask<VEC_LEN> const & mask) const {
+            return VecExtReduce<SCALAR_UINT_TYPE, VEC_LEN>::template apply<VecExtMin>(blendExt(mask, splat(std::numeric_limits<SCALAR_UINT_TYPE>::max()), mVec));
+        }
+        // IMIN
+        UME_FORCE_INLINE uint32_t imin() const {
+            SCALAR_UINT_TYPE t0 = hmin();
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mVec[i] == t0) return i;
+            }
+            return 0;
+        }
+        // MIMIN
+        UME_FORCE_INLINE uint32_t imin(SIMDVecMask<VEC_LEN> const & mask) const {
+            SCALAR_UINT_TYPE t0 = hmin(mask);
+            if (t0 == std::numeric_limits<SCALAR_UINT_TYPE>::max()) return 0xFFFFFFFF;
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0 && mVec[i] == t0) return i;
+            }
+            return 0xFFFFFFFF;
+        }
+
+        // BANDV
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVec_u const & b) const {
+            return SIMDVec_u(mVec & b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator& (SIMDVec_u const & b) const {
+            return band(b);
+        }
+        // MBANDV
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) const {
+            return SIMDVec_u(blendExt(mask, mVec, mVec & b.mVec));
+        }
+        // BANDS
+        UME_FORCE_INLINE SIMDVec_u band(SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(mVec & splat(b));
+        }
+        UME_FORCE_INLINE SIMDVec_u operator& (SCALAR_UINT_TYPE b) const {
+            return band(b);
+        }
+        // MBANDS
+        UME_FORCE_INLINE SIMDVec_u band(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(blendExt(mask, mVec, mVec & splat(b)));
+        }
+        // BANDVA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVec_u const & b) {
+            mVec = mVec & b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (SIMDVec_u const & b) {
+            return banda(b);
+        }
+        // MBANDVA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) {
+            mVec = blendExt(mask, mVec, mVec & b.mVec);
+            return *this;
+        }
+        // BANDSA
+        UME_FORCE_INLINE SIMDVec_u & banda(SCALAR_UINT_TYPE b) {
+            mVec = mVec & splat(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator&= (SCALAR_UINT_TYPE b) {
+            return banda(b);
+        }
+        // MBANDSA
+        UME_FORCE_INLINE SIMDVec_u & banda(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec & splat(b));
+            return *this;
+        }
+        // BORV
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVec_u const & b) const {
+            return SIMDVec_u(mVec | b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator| (SIMDVec_u const & b) const {
+            return bor(b);
+        }
+        // MBORV
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) const {
+            return SIMDVec_u(blendExt(mask, mVec, mVec | b.mVec));
+        }
+        // BORS
+        UME_FORCE_INLINE SIMDVec_u bor(SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(mVec | splat(b));
+        }
+        UME_FORCE_INLINE SIMDVec_u operator| (SCALAR_UINT_TYPE b) const {
+            return bor(b);
+        }
+        // MBORS
+        UME_FORCE_INLINE SIMDVec_u bor(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(blendExt(mask, mVec, mVec | splat(b)));
+        }
+        // BORVA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVec_u const & b) {
+            mVec = mVec | b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (SIMDVec_u const & b) {
+            return bora(b);
+        }
+        // MBORVA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) {
+            mVec = blendExt(mask, mVec, mVec | b.mVec);
+            return *this;
+        }
+        // BORSA
+        UME_FORCE_INLINE SIMDVec_u & bora(SCALAR_UINT_TYPE b) {
+            mVec = mVec | splat(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator|= (SCALAR_UINT_TYPE b) {
+            return bora(b);
+        }
+        // MBORSA
+        UME_FORCE_INLINE SIMDVec_u & bora(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec | splat(b));
+            return *this;
+        }
+        // BXORV
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVec_u const & b) const {
+            return SIMDVec_u(mVec ^ b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator^ (SIMDVec_u const & b) const {
+            return bxor(b);
+        }
+        // MBXORV
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) const {
+            return SIMDVec_u(blendExt(mask, mVec, mVec ^ b.mVec));
+        }
+        // BXORS
+        UME_FORCE_INLINE SIMDVec_u bxor(SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(mVec ^ splat(b));
+        }
+        UME_FORCE_INLINE SIMDVec_u operator^ (SCALAR_UINT_TYPE b) const {
+            return bxor(b);
+        }
+        // MBXORS
+        UME_FORCE_INLINE SIMDVec_u bxor(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(blendExt(mask, mVec, mVec ^ splat(b)));
+        }
+        // BXORVA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVec_u const & b) {
+            mVec = mVec ^ b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator^= (SIMDVec_u const & b) {
+            return bxora(b);
+        }
+        // MBXORVA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) {
+            mVec = blendExt(mask, mVec, mVec ^ b.mVec);
+            return *this;
+        }
+        // BXORSA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SCALAR_UINT_TYPE b) {
+            mVec = mVec ^ splat(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator^= (SCALAR_UINT_TYPE b) {
+            return bxora(b);
+        }
+        // MBXORSA
+        UME_FORCE_INLINE SIMDVec_u & bxora(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec ^ splat(b));
+            return *this;
+        }
+        // BNOT
+        UME_FORCE_INLINE SIMDVec_u bnot() const {
+            return SIMDVec_u(~mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator~ () const {
+            return bnot();
+        }
+        // MBNOT
+        UME_FORCE_INLINE SIMDVec_u bnot(SIMDVecMask<VEC_LEN> const & mask) const {
+            return SIMDVec_u(blendExt(mask, mVec, ~mVec));
+        }
+        // BNOTA
+        UME_FORCE_INLINE SIMDVec_u & bnota() {
+            mVec = ~mVec;
+            return *this;
+        }
+        // MBNOTA
+        UME_FORCE_INLINE SIMDVec_u & bnota(SIMDVecMask<VEC_LEN> const & mask) {
+            mVec = blendExt(mask, mVec, ~mVec);
+            return *this;
+        }
+
+        // HBAND
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hband() const {
+            return VecExtReduce<SCALAR_UINT_TYPE, VEC_LEN>::template apply<VecExtAnd>(mVec);
+        }
+        // MHBAND
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hband(SIMDVecMask<VEC_LEN> const & mask) const {
+            return VecExtReduce<SCALAR_UINT_TYPE, VEC_LEN>::template apply<VecExtAnd>(blendExt(mask, splat(SCALAR_UINT_TYPE(~SCALAR_UINT_TYPE(0))), mVec));
+        }
+        // HBANDS
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hband(SCALAR_UINT_TYPE b) const {
+            return b & hband();
+        }
+        // MHBANDS
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hband(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return b & hband(mask);
+        }
+        // HBOR
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hbor() const {
+            return VecExtReduce<SCALAR_UINT_TYPE, VEC_LEN>::template apply<VecExtOr>(mVec);
+        }
+        // MHBOR
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hbor(SIMDVecMask<VEC_LEN> const & mask) const {
+            return VecExtReduce<SCALAR_UINT_TYPE, VEC_LEN>::template apply<VecExtOr>(blendExt(mask, splat(SCALAR_UINT_TYPE(0)), mVec));
+        }
+        // HBORS
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hbor(SCALAR_UINT_TYPE b) const {
+            return b | hbor();
+        }
+        // MHBORS
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hbor(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return b | hbor(mask);
+        }
+        // HBXOR
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hbxor() const {
+            return VecExtReduce<SCALAR_UINT_TYPE, VEC_LEN>::template apply<VecExtXor>(mVec);
+        }
+        // MHBXOR
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hbxor(SIMDVecMask<VEC_LEN> const & mask) const {
+            return VecExtReduce<SCALAR_UINT_TYPE, VEC_LEN>::template apply<VecExtXor>(blendExt(mask, splat(SCALAR_UINT_TYPE(0)), mVec));
+        }
+        // HBXORS
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hbxor(SCALAR_UINT_TYPE b) const {
+            return b ^ hbxor();
+        }
+        // MHBXORS
+        UME_FORCE_INLINE SCALAR_UINT_TYPE hbxor(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return b ^ hbxor(mask);
+        }
+
+        // REMV
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVec_u const & b) const {
+            return SIMDVec_u(mVec % b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (SIMDVec_u const & b) const {
+            return rem(b);
+        }
+        // MREMV
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) const {
+            return SIMDVec_u(blendExt(mask, mVec, mVec % blendExt(mask, splat(SCALAR_UINT_TYPE(1)), b.mVec)));
+        }
+        // REMS
+        UME_FORCE_INLINE SIMDVec_u rem(SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(mVec % splat(b));
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (SCALAR_UINT_TYPE b) const {
+            return rem(b);
+        }
+        // MREMS
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(blendExt(mask, mVec, mVec % blendExt(mask, splat(SCALAR_UINT_TYPE(1)), splat(b))));
+        }
+        // REMVA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVec_u const & b) {
+            mVec = mVec % b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (SIMDVec_u const & b) {
+            return rema(b);
+        }
+        // MREMVA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) {
+            mVec = blendExt(mask, mVec, mVec % blendExt(mask, splat(SCALAR_UINT_TYPE(1)), b.mVec));
+            return *this;
+        }
+        // REMSA
+        UME_FORCE_INLINE SIMDVec_u & rema(SCALAR_UINT_TYPE b) {
+            mVec = mVec % splat(b);
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (SCALAR_UINT_TYPE b) {
+            return rema(b);
+        }
+        // MREMSA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec % blendExt(mask, splat(SCALAR_UINT_TYPE(1)), splat(b)));
+            return *this;
+        }
+        // REMD
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDDivisor<SCALAR_UINT_TYPE> const & b) const {
+            return rem(b.divisor());
+        }
+        UME_FORCE_INLINE SIMDVec_u operator% (SIMDDivisor<SCALAR_UINT_TYPE> const & b) const {
+            return rem(b);
+        }
+        // MREMD
+        UME_FORCE_INLINE SIMDVec_u rem(SIMDVecMask<VEC_LEN> const & mask, SIMDDivisor<SCALAR_UINT_TYPE> const & b) const {
+            return rem(mask, b.divisor());
+        }
+        // REMDA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDDivisor<SCALAR_UINT_TYPE> const & b) {
+            return rema(b.divisor());
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator%= (SIMDDivisor<SCALAR_UINT_TYPE> const & b) {
+            return rema(b);
+        }
+        // MREMDA
+        UME_FORCE_INLINE SIMDVec_u & rema(SIMDVecMask<VEC_LEN> const & mask, SIMDDivisor<SCALAR_UINT_TYPE> const & b) {
+            return rema(mask, b.divisor());
+        }
+
+        // LANDV
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> land(SIMDVec_u const & b) const {
+            return toMask((mVec != 0) & (b.mVec != 0));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator&& (SIMDVec_u const & b) const {
+            return land(b);
+        }
+        // LANDS
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> land(bool b) const {
+            return toMask((mVec != 0) & -VEC_EXT_SEL_TYPE(b - VEC_EXT_SEL_TYPE()));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator&& (bool b) const {
+            return land(b);
+        }
+        // LORV
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> lor(SIMDVec_u const & b) const {
+            return toMask((mVec != 0) | (b.mVec != 0));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator|| (SIMDVec_u const & b) const {
+            return lor(b);
+        }
+        // LORS
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> lor(bool b) const {
+            return toMask((mVec != 0) | -VEC_EXT_SEL_TYPE(b - VEC_EXT_SEL_TYPE()));
+        }
+        UME_FORCE_INLINE SIMDVecMask<VEC_LEN> operator|| (bool b) const {
+            return lor(b);
+        }
+
+        // GATHERS
+        UME_FORCE_INLINE SIMDVec_u & gather(SCALAR_UINT_TYPE const * baseAddr, SCALAR_UINT_TYPE const * indices) {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                mVec[i] = baseAddr[indices[i]];
+            }
+            return *this;
+        }
+        // MGATHERS
+        UME_FORCE_INLINE SIMDVec_u & gather(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE const * baseAddr, SCALAR_UINT_TYPE const * indices) {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0) mVec[i] = baseAddr[indices[i]];
+            }
+            return *this;
+        }
+        // GATHERV
+        UME_FORCE_INLINE SIMDVec_u & gather(SCALAR_UINT_TYPE const * baseAddr, SIMDVec_u const & indices) {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                mVec[i] = baseAddr[indices.mVec[i]];
+            }
+            return *this;
+        }
+        // MGATHERV
+        UME_FORCE_INLINE SIMDVec_u & gather(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE const * baseAddr, SIMDVec_u const & indices) {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0) mVec[i] = baseAddr[indices.mVec[i]];
+            }
+            return *this;
+        }
+        // SCATTERS
+        UME_FORCE_INLINE SCALAR_UINT_TYPE* scatter(SCALAR_UINT_TYPE* baseAddr, SCALAR_UINT_TYPE* indices) const {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                baseAddr[indices[i]] = mVec[i];
+            }
+            return baseAddr;
+        }
+        // MSCATTERS
+        UME_FORCE_INLINE SCALAR_UINT_TYPE* scatter(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE* baseAddr, SCALAR_UINT_TYPE* indices) const {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0) baseAddr[indices[i]] = mVec[i];
+            }
+            return baseAddr;
+        }
+        // SCATTERV
+        UME_FORCE_INLINE SCALAR_UINT_TYPE* scatter(SCALAR_UINT_TYPE* baseAddr, SIMDVec_u const & indices) const {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                baseAddr[indices.mVec[i]] = mVec[i];
+            }
+            return baseAddr;
+        }
+        // MSCATTERV
+        UME_FORCE_INLINE SCALAR_UINT_TYPE* scatter(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE* baseAddr, SIMDVec_u const & indices) const {
+            for(unsigned int i = 0; i < VEC_LEN; i++) {
+                if (mask.mMask[i] != 0) baseAddr[indices.mVec[i]] = mVec[i];
+            }
+            return baseAddr;
+        }
+
+        // LSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVec_u const & b) const {
+            return SIMDVec_u(mVec << b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (SIMDVec_u const & b) const {
+            return lsh(b);
+        }
+        // MLSHV
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) const {
+            return SIMDVec_u(blendExt(mask, mVec, mVec << b.mVec));
+        }
+        // LSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(mVec << b);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator<< (SCALAR_UINT_TYPE b) const {
+            return lsh(b);
+        }
+        // MLSHS
+        UME_FORCE_INLINE SIMDVec_u lsh(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(blendExt(mask, mVec, mVec << b));
+        }
+        // LSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVec_u const & b) {
+            mVec = mVec << b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (SIMDVec_u const & b) {
+            return lsha(b);
+        }
+        // MLSHVA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) {
+            mVec = blendExt(mask, mVec, mVec << b.mVec);
+            return *this;
+        }
+        // LSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SCALAR_UINT_TYPE b) {
+            mVec = mVec << b;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator<<= (SCALAR_UINT_TYPE b) {
+            return lsha(b);
+        }
+        // MLSHSA
+        UME_FORCE_INLINE SIMDVec_u & lsha(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec << b);
+            return *this;
+        }
+        // RSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVec_u const & b) const {
+            return SIMDVec_u(mVec >> b.mVec);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (SIMDVec_u const & b) const {
+            return rsh(b);
+        }
+        // MRSHV
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) const {
+            return SIMDVec_u(blendExt(mask, mVec, mVec >> b.mVec));
+        }
+        // RSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(mVec >> b);
+        }
+        UME_FORCE_INLINE SIMDVec_u operator>> (SCALAR_UINT_TYPE b) const {
+            return rsh(b);
+        }
+        // MRSHS
+        UME_FORCE_INLINE SIMDVec_u rsh(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(blendExt(mask, mVec, mVec >> b));
+        }
+        // RSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVec_u const & b) {
+            mVec = mVec >> b.mVec;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (SIMDVec_u const & b) {
+            return rsha(b);
+        }
+        // MRSHVA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) {
+            mVec = blendExt(mask, mVec, mVec >> b.mVec);
+            return *this;
+        }
+        // RSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SCALAR_UINT_TYPE b) {
+            mVec = mVec >> b;
+            return *this;
+        }
+        UME_FORCE_INLINE SIMDVec_u & operator>>= (SCALAR_UINT_TYPE b) {
+            return rsha(b);
+        }
+        // MRSHSA
+        UME_FORCE_INLINE SIMDVec_u & rsha(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) {
+            mVec = blendExt(mask, mVec, mVec >> b);
+            return *this;
+        }
+
+        // Rotations use shift counts modulo the number of bits in the element.
+        static UME_FORCE_INLINE VEC_EXT_TYPE rotateLeftExt(VEC_EXT_TYPE const & a, VEC_EXT_TYPE const & b) {
+            VEC_EXT_TYPE n = b & VEC_EXT_TYPE(sizeof(SCALAR_UINT_TYPE)*8 - 1 - VEC_EXT_TYPE());
+            return (a << n) | (a >> ((sizeof(SCALAR_UINT_TYPE)*8 - n) & (sizeof(SCALAR_UINT_TYPE)*8 - 1)));
+        }
+        static UME_FORCE_INLINE VEC_EXT_TYPE rotateRightExt(VEC_EXT_TYPE const & a, VEC_EXT_TYPE const & b) {
+            VEC_EXT_TYPE n = b & VEC_EXT_TYPE(sizeof(SCALAR_UINT_TYPE)*8 - 1 - VEC_EXT_TYPE());
+            return (a >> n) | (a << ((sizeof(SCALAR_UINT_TYPE)*8 - n) & (sizeof(SCALAR_UINT_TYPE)*8 - 1)));
+        }
+
+        // ROLV
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVec_u const & b) const {
+            return SIMDVec_u(rotateLeftExt(mVec, b.mVec));
+        }
+        // MROLV
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) const {
+            return SIMDVec_u(blendExt(mask, mVec, rotateLeftExt(mVec, b.mVec)));
+        }
+        // ROLS
+        UME_FORCE_INLINE SIMDVec_u rol(SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(rotateLeftExt(mVec, splat(b)));
+        }
+        // MROLS
+        UME_FORCE_INLINE SIMDVec_u rol(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(blendExt(mask, mVec, rotateLeftExt(mVec, splat(b))));
+        }
+        // ROLVA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVec_u const & b) {
+            mVec = rotateLeftExt(mVec, b.mVec);
+            return *this;
+        }
+        // MROLVA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) {
+            mVec = blendExt(mask, mVec, rotateLeftExt(mVec, b.mVec));
+            return *this;
+        }
+        // ROLSA
+        UME_FORCE_INLINE SIMDVec_u & rola(SCALAR_UINT_TYPE b) {
+            mVec = rotateLeftExt(mVec, splat(b));
+            return *this;
+        }
+        // MROLSA
+        UME_FORCE_INLINE SIMDVec_u & rola(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) {
+            mVec = blendExt(mask, mVec, rotateLeftExt(mVec, splat(b)));
+            return *this;
+        }
+        // RORV
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVec_u const & b) const {
+            return SIMDVec_u(rotateRightExt(mVec, b.mVec));
+        }
+        // MRORV
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) const {
+            return SIMDVec_u(blendExt(mask, mVec, rotateRightExt(mVec, b.mVec)));
+        }
+        // RORS
+        UME_FORCE_INLINE SIMDVec_u ror(SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(rotateRightExt(mVec, splat(b)));
+        }
+        // MRORS
+        UME_FORCE_INLINE SIMDVec_u ror(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) const {
+            return SIMDVec_u(blendExt(mask, mVec, rotateRightExt(mVec, splat(b))));
+        }
+        // RORVA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVec_u const & b) {
+            mVec = rotateRightExt(mVec, b.mVec);
+            return *this;
+        }
+        // MRORVA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVecMask<VEC_LEN> const & mask, SIMDVec_u const & b) {
+            mVec = blendExt(mask, mVec, rotateRightExt(mVec, b.mVec));
+            return *this;
+        }
+        // RORSA
+        UME_FORCE_INLINE SIMDVec_u & rora(SCALAR_UINT_TYPE b) {
+            mVec = rotateRightExt(mVec, splat(b));
+            return *this;
+        }
+        // MRORSA
+        UME_FORCE_INLINE SIMDVec_u & rora(SIMDVecMask<VEC_LEN> const & mask, SCALAR_UINT_TYPE b) {
+            mVec = blendExt(mask, mVec, rotateRightExt(mVec, splat(b)));
+            return *this;
+        }
+
+        // PACK
+        UME_FORCE_INLINE SIMDVec_u & pack(HALF_LEN_VEC_TYPE const & a, HALF_LEN_VEC_TYPE const & b) {
+            mVec = vecExtShuffle<VEC_EXT_TYPE>(a.mVec, b.mVec, typename VecExtRange<0, VEC_LEN>::type());
+            return *this;
+        }
+        // PACKLO
+        UME_FORCE_INLINE SIMDVec_u & packlo(HALF_LEN_VEC_TYPE const & a) {
+            typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE t0 = vecExtShuffle<typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE>(mVec, mVec, typename VecExtRange<VEC_LEN/2, VEC_LEN/2>::type());
+            mVec = vecExtShuffle<VEC_EXT_TYPE>(a.mVec, t0, typename VecExtRange<0, VEC_LEN>::type());
+            return *this;
+        }
+        // PACKHI
+        UME_FORCE_INLINE SIMDVec_u & packhi(HALF_LEN_VEC_TYPE const & b) {
+            typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE t0 = vecExtShuffle<typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE>(mVec, mVec, typename VecExtRange<0, VEC_LEN/2>::type());
+            mVec = vecExtShuffle<VEC_EXT_TYPE>(t0, b.mVec, typename VecExtRange<0, VEC_LEN>::type());
+            return *this;
+        }
+        // UNPACK
+        UME_FORCE_INLINE void unpack(HALF_LEN_VEC_TYPE & a, HALF_LEN_VEC_TYPE & b) const {
+            a.mVec = vecExtShuffle<typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE>(mVec, mVec, typename VecExtRange<0, VEC_LEN/2>::type());
+            b.mVec = vecExtShuffle<typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE>(mVec, mVec, typename VecExtRange<VEC_LEN/2, VEC_LEN/2>::type());
+        }
+        // UNPACKLO
+        UME_FORCE_INLINE HALF_LEN_VEC_TYPE unpacklo() const {
+            return HALF_LEN_VEC_TYPE(vecExtShuffle<typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE>(mVec, mVec, typename VecExtRange<0, VEC_LEN/2>::type()));
+        }
+        // UNPACKHI
+        UME_FORCE_INLINE HALF_LEN_VEC_TYPE unpackhi() const {
+            return HALF_LEN_VEC_TYPE(vecExtShuffle<typename HALF_LEN_VEC_TYPE::VEC_EXT_TYPE>(mVec, mVec, typename VecExtRange<VEC_LEN/2, VEC_LEN/2>::type()));
+        }
+
+        // DEGRADE
+        UME_FORCE_INLINE operator SIMDVec_u<SCALAR_UINT_LOWER_PRECISION, VEC_LEN>() const;
+        // PROMOTE
+        UME_FORCE_INLINE operator SIMDVec_u<SCALAR_UINT_HIGHER_PRECISION, VEC_LEN>() const;
+
+        // UTOI
+        UME_FORCE_INLINE operator SIMDVec_i<SCALAR_INT_TYPE, VEC_LEN>() const;
+        // UTOF
+        UME_FORCE_INLINE operator SIMDVec_f<SCALAR_FLOAT_TYPE, VEC_LEN>() const;
+    };
+
+    // SIMD NullTypes. These are used whenever a terminating
+    // scalar type is used as a creator function for SIMD type.
+    // These types cannot be instantiated, but are necessary for 
+    // typeset to be consistent.
+    template<>
+    class SIMDVec_u<NullType<1>, 1>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+
+    template<>
+    class SIMDVec_u<NullType<1>, 2>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+
+    template<>
+    class SIMDVec_u<NullType<1>, 4>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+
+    template<>
+    class SIMDVec_u<NullType<1>, 8>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+
+    template<>
+    class SIMDVec_u<NullType<1>, 16>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+
+    template<>
+    class SIMDVec_u<NullType<1>, 32>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+
+    template<>
+    class SIMDVec_u<NullType<1>, 64>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+
+    template<>
+    class SIMDVec_u<NullType<1>, 128>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+
+    template<>
+    class SIMDVec_u<NullType<2>, 1>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+
+    template<>
+    class SIMDVec_u<NullType<2>, 2>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+
+    template<>
+    class SIMDVec_u<NullType<2>, 4>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+
+    template<>
+    class SIMDVec_u<NullType<2>, 8>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+
+    template<>
+    class SIMDVec_u<NullType<2>, 16>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+
+    template<>
+    class SIMDVec_u<NullType<2>, 32>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+
+    template<>
+    class SIMDVec_u<NullType<2>, 64>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+
+    template<>
+    class SIMDVec_u<NullType<2>, 128>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+
+    template<>
+    class SIMDVec_u<NullType<3>, 1>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+
+    template<>
+    class SIMDVec_u<NullType<3>, 2>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+
+    template<>
+    class SIMDVec_u<NullType<3>, 4>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+
+    template<>
+    class SIMDVec_u<NullType<3>, 8>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+
+    template<>
+    class SIMDVec_u<NullType<3>, 16>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+
+    template<>
+    class SIMDVec_u<NullType<3>, 32>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+
+    template<>
+    class SIMDVec_u<NullType<3>, 64>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+
+    template<>
+    class SIMDVec_u<NullType<3>, 128>
+    {
+    private:
+        SIMDVec_u() {}
+        ~SIMDVec_u() {}
+    };
+}
+}
+
+#endif
@@ -33,6 +33,9 @@
 
 #include "UMEUnitTestCommon.h"
 #include "UMEUnitTestMemory.h"
+#include "UMEUnitTestSoAContainer.h"
+#include "UMEUnitTestHistogram.h"
+#include "UMEUnitTestSort.h"
 #include "UMEUnitTestSimd.h"
 
 int main()
@@ -42,6 +45,12 @@ int main()
     
     total_failed += test_allocators(false);
     total_tests +=g_totalTests;
+    total_failed += test_soa_container(false);
+    total_tests +=g_totalTests;
+    total_failed += test_histogram(false);
+    total_tests +=g_totalTests;
+    total_failed += test_sort(false);
+    total_tests +=g_totalTests;
     total_failed += test_UMESimd(false);
     total_tests +=g_totalTests;
     std::cout << std::endl;
@@ -1511,6 +1511,60 @@ void genericMSTORETest_random()
     }
 }
 
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericLOADN_STORENTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = randomValue<SCALAR_TYPE>(gen);
+        inputB[i] = randomValue<SCALAR_TYPE>(gen);
+    }
+
+    for (uint32_t n = 0; n <= VEC_LEN + 1; n++) {
+        MASK_TYPE mask = MASK_TYPE::prefix(n);
+        bool maskOk = true;
+        for (uint32_t i = 0; i < VEC_LEN; i++) {
+            if (mask[i] != (i < n)) maskOk = false;
+        }
+        CHECK_CONDITION(maskOk, "PREFIX");
+
+        // Source and destination are heap blocks sized exactly 'count' so
+        // that any access past the end is caught by memory checkers.
+        uint32_t count = n < VEC_LEN ? n : VEC_LEN;
+        SCALAR_TYPE *src = new SCALAR_TYPE[count];
+        SCALAR_TYPE *dst = new SCALAR_TYPE[count];
+        for (uint32_t i = 0; i < count; i++) {
+            src[i] = inputB[i];
+            dst[i] = inputA[i];
+        }
+
+        SCALAR_TYPE values[VEC_LEN];
+        SCALAR_TYPE expected[VEC_LEN];
+        for (uint32_t i = 0; i < VEC_LEN; i++) {
+            expected[i] = i < count ? inputB[i] : SCALAR_TYPE(0);
+        }
+
+        VEC_TYPE vec0(inputA);
+        vec0.loadn(count, src);
+        vec0.store(values);
+        bool inRange = valuesInRange(values, expected, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION(inRange, "LOADN");
+
+        VEC_TYPE vec1(inputB);
+        vec1.storen(count, dst);
+        inRange = count == 0 || valuesInRange(dst, inputB, count, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION(inRange, "STOREN");
+
+        delete[] src;
+        delete[] dst;
+    }
+}
+
 template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
 void genericLOADA_STOREATest()
 {
@@ -3665,6 +3719,106 @@ void genericREMSTest_random()
     }
 }
 
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericDIVDTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB;
+    SCALAR_TYPE output[VEC_LEN];
+
+    // Skip -1 to avoid overflow of (min / -1) for signed types.
+    do {
+        inputB = randomValue<SCALAR_TYPE>(gen);
+    } while (inputB == 0 || inputB == SCALAR_TYPE(-1));
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = randomValue<SCALAR_TYPE>(gen);
+        output[i] = inputA[i] / inputB;
+    }
+
+    UME::SIMD::SIMDDivisor<SCALAR_TYPE> divisor(inputB);
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.div(divisor);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "DIVD gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0 / divisor;
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION(inRange, "DIVD(operator/ RHS divisor) gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        vec0.diva(divisor);
+        vec0.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION(inRange, "DIVDA gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericREMDTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB;
+    SCALAR_TYPE output[VEC_LEN];
+
+    // Skip -1 to avoid overflow of (min % -1) for signed types.
+    do {
+        inputB = randomValue<SCALAR_TYPE>(gen);
+    } while (inputB == 0 || inputB == SCALAR_TYPE(-1));
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = randomValue<SCALAR_TYPE>(gen);
+        output[i] = inputA[i] % inputB;
+    }
+
+    UME::SIMD::SIMDDivisor<SCALAR_TYPE> divisor(inputB);
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.rem(divisor);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "REMD gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0 % divisor;
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION(inRange, "REMD(operator% RHS divisor) gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        vec0.rema(divisor);
+        vec0.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION(inRange, "REMDA gen");
+    }
+}
+
 template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
 void genericRCPTest()
 {
@@ -6003,6 +6157,93 @@ void genericSWIZZLETest_random()
 }
         // SWIZZLEA - Swizzle (reorder/permute) vector elements and assign
 
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void checkSwizzleResult(VEC_TYPE const & result, SCALAR_TYPE const * input, int const * indices, const char * msg)
+{
+    SCALAR_TYPE values[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+    for (int i = 0; i < VEC_LEN; i++) {
+        output[i] = input[indices[i]];
+    }
+    result.store(values);
+    bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+    check_condition(inRange, std::string(msg));
+}
+
+// Compile-time swizzles are checked with one pattern that repeats within
+// 128-bit lanes and one that crosses lanes, as plugins lower these differently.
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+struct SwizzleTemplateTester {
+    static void run(VEC_TYPE &, SCALAR_TYPE const *) {}
+};
+
+template<typename VEC_TYPE, typename SCALAR_TYPE>
+struct SwizzleTemplateTester<VEC_TYPE, SCALAR_TYPE, 2> {
+    static void run(VEC_TYPE & vec, SCALAR_TYPE const * input) {
+        const int pattern0[2] = { 1, 0 };
+        checkSwizzleResult<VEC_TYPE, SCALAR_TYPE, 2>(vec.template swizzle<1, 0>(), input, pattern0, "SWIZZLE<>");
+        const int pattern1[2] = { 1, 1 };
+        checkSwizzleResult<VEC_TYPE, SCALAR_TYPE, 2>(vec.template swizzle<1, 1>(), input, pattern1, "SWIZZLE<>");
+    }
+};
+
+template<typename VEC_TYPE, typename SCALAR_TYPE>
+struct SwizzleTemplateTester<VEC_TYPE, SCALAR_TYPE, 4> {
+    static void run(VEC_TYPE & vec, SCALAR_TYPE const * input) {
+        const int pattern0[4] = { 1, 0, 3, 2 };
+        checkSwizzleResult<VEC_TYPE, SCALAR_TYPE, 4>(vec.template swizzle<1, 0, 3, 2>(), input, pattern0, "SWIZZLE<>");
+        const int pattern1[4] = { 3, 1, 2, 0 };
+        checkSwizzleResult<VEC_TYPE, SCALAR_TYPE, 4>(vec.template swizzle<3, 1, 2, 0>(), input, pattern1, "SWIZZLE<>");
+    }
+};
+
+template<typename VEC_TYPE, typename SCALAR_TYPE>
+struct SwizzleTemplateTester<VEC_TYPE, SCALAR_TYPE, 8> {
+    static void run(VEC_TYPE & vec, SCALAR_TYPE const * input) {
+        const int pattern0[8] = { 1, 0, 3, 3, 5, 4, 7, 7 };
+        checkSwizzleResult<VEC_TYPE, SCALAR_TYPE, 8>(vec.template swizzle<1, 0, 3, 3, 5, 4, 7, 7>(), input, pattern0, "SWIZZLE<>");
+        const int pattern1[8] = { 7, 0, 6, 1, 5, 2, 4, 3 };
+        checkSwizzleResult<VEC_TYPE, SCALAR_TYPE, 8>(vec.template swizzle<7, 0, 6, 1, 5, 2, 4, 3>(), input, pattern1, "SWIZZLE<>");
+    }
+};
+
+template<typename VEC_TYPE, typename SCALAR_TYPE>
+struct SwizzleTemplateTester<VEC_TYPE, SCALAR_TYPE, 16> {
+    static void run(VEC_TYPE & vec, SCALAR_TYPE const * input) {
+        const int pattern0[16] = { 2, 0, 1, 3, 6, 4, 5, 7, 10, 8, 9, 11, 14, 12, 13, 15 };
+        checkSwizzleResult<VEC_TYPE, SCALAR_TYPE, 16>(
+            vec.template swizzle<2, 0, 1, 3, 6, 4, 5, 7, 10, 8, 9, 11, 14, 12, 13, 15>(), input, pattern0, "SWIZZLE<>");
+        const int pattern1[16] = { 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 };
+        checkSwizzleResult<VEC_TYPE, SCALAR_TYPE, 16>(
+            vec.template swizzle<15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0>(), input, pattern1, "SWIZZLE<>");
+    }
+};
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename SWIZZLE_TYPE, int VEC_LEN>
+void genericSWIZZLEATest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    SCALAR_TYPE input[VEC_LEN];
+    uint32_t indexes[VEC_LEN];
+    int expectedIndexes[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        input[i] = randomValue<SCALAR_TYPE>(gen);
+        indexes[i] = randomValue<uint32_t>(gen) % VEC_LEN;
+        expectedIndexes[i] = int(indexes[i]);
+    }
+
+    VEC_TYPE t0(input);
+    SWIZZLE_TYPE t1(indexes);
+    t0.swizzlea(t1);
+    checkSwizzleResult<VEC_TYPE, SCALAR_TYPE, VEC_LEN>(t0, input, expectedIndexes, "SWIZZLEA");
+
+    VEC_TYPE t2(input);
+    SwizzleTemplateTester<VEC_TYPE, SCALAR_TYPE, VEC_LEN>::run(t2, input);
+}
+
 template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
 void genericSORTATest_random()
 {
@@ -7081,6 +7322,54 @@ void genericMSCATTERVTest_random()
     CHECK_CONDITION(inRange, "MSCATTERV");
 }
 
+template<typename VEC_TYPE, typename SCALAR_TYPE, typename UINT_VEC_TYPE, typename SCALAR_UINT_TYPE, typename MASK_TYPE, int VEC_LEN>
+void genericSCATTERADDVTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    // Few slots, so that most vectors carry repeating indices. Small
+    // integral values keep floating point sums exact in any order.
+    const int SLOTS = VEC_LEN / 2 + 1;
+    SCALAR_TYPE inputA[SLOTS];
+    SCALAR_TYPE inputB[VEC_LEN];
+    SCALAR_UINT_TYPE indices[VEC_LEN];
+    SCALAR_TYPE output[SLOTS];
+    SCALAR_TYPE outputMasked[SLOTS];
+    bool inputMask[VEC_LEN];
+
+    for (int i = 0; i < SLOTS; i++) {
+        inputA[i] = SCALAR_TYPE(gen() % 8);
+        output[i] = inputA[i];
+        outputMasked[i] = inputA[i];
+    }
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputB[i] = SCALAR_TYPE(gen() % 8);
+        indices[i] = SCALAR_UINT_TYPE(gen() % SLOTS);
+        inputMask[i] = randomValue<bool>(gen);
+        output[indices[i]] += inputB[i];
+        if (inputMask[i] == true) outputMasked[indices[i]] += inputB[i];
+    }
+
+    VEC_TYPE vec0(inputB);
+    UINT_VEC_TYPE vec1(indices);
+    MASK_TYPE mask(inputMask);
+    {
+        SCALAR_TYPE values[SLOTS];
+        for (int i = 0; i < SLOTS; i++) values[i] = inputA[i];
+        vec0.scatteradd(values, vec1);
+        bool inRange = valuesInRange(values, output, SLOTS, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION(inRange, "SCATTERADDV");
+    }
+    {
+        SCALAR_TYPE values[SLOTS];
+        for (int i = 0; i < SLOTS; i++) values[i] = inputA[i];
+        vec0.scatteradd(mask, values, vec1);
+        bool inRange = valuesInRange(values, outputMasked, SLOTS, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION(inRange, "MSCATTERADDV");
+    }
+}
+
 template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
 void genericFMULADDVTest()
 {
@@ -10319,6 +10608,60 @@ void genericISZEROSUBTest()
     }
 }
 
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericCOUNT_IF_COMPACTTest()
+{
+    // Three full vectors and a partial one, every third element is NaN.
+    const uint32_t COUNT = 3 * VEC_LEN + VEC_LEN / 2 + 1;
+    SCALAR_TYPE input[COUNT];
+    SCALAR_TYPE output[COUNT];
+    SCALAR_TYPE expected[COUNT];
+    uint32_t expectedCount = 0;
+
+    for (uint32_t i = 0; i < COUNT; i++) {
+        input[i] = (i % 3 == 1) ? std::numeric_limits<SCALAR_TYPE>::quiet_NaN() : SCALAR_TYPE(i);
+        if (i % 3 != 1) expected[expectedCount++] = input[i];
+    }
+
+    {
+        uint32_t count = UME::SIMD::FUNCTIONS::count_if<VEC_TYPE>(input, COUNT,
+            [](VEC_TYPE const & x) { return x.isnan(); });
+        CHECK_CONDITION(count == COUNT - expectedCount, "COUNT_IF");
+    }
+    {
+        uint32_t count = UME::SIMD::FUNCTIONS::compact<VEC_TYPE>(input, COUNT, output,
+            [](VEC_TYPE const & x) { return x.isan(); });
+        bool inRange = (count == expectedCount) && valuesInRange(output, expected, expectedCount, SCALAR_TYPE(0.0f));
+        CHECK_CONDITION(inRange, "COMPACT");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericARGMAX_ARGMINTest()
+{
+    // Four full vectors and a partial one. Both extremes appear twice and
+    // the first occurrence has to be reported.
+    const uint32_t COUNT = 4 * VEC_LEN + VEC_LEN / 2 + 3;
+    const uint32_t MAX_INDEX = VEC_LEN + 1;
+    const uint32_t MIN_INDEX = 2 * VEC_LEN + 2;
+    SCALAR_TYPE input[COUNT];
+
+    for (uint32_t i = 0; i < COUNT; i++) {
+        input[i] = SCALAR_TYPE(i % 7);
+    }
+    input[MAX_INDEX] = input[COUNT - 1] = SCALAR_TYPE(100);
+    input[MIN_INDEX] = input[MIN_INDEX + 1] = SCALAR_TYPE(-100);
+
+    {
+        uint32_t index = UME::SIMD::FUNCTIONS::argmax<VEC_TYPE>(input, COUNT);
+        CHECK_CONDITION(index == MAX_INDEX, "ARGMAX");
+    }
+    {
+        uint32_t index = UME::SIMD::FUNCTIONS::argmin<VEC_TYPE>(input, COUNT);
+        CHECK_CONDITION(index == MIN_INDEX, "ARGMIN");
+    }
+}
+
 template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
 void genericEXPTest_random()
 {
@@ -10508,6 +10851,76 @@ void genericLOG10Test_random()
     }
 }
 
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericPOWVTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> distA(SCALAR_TYPE(0.1f), SCALAR_TYPE(10.0f));
+    std::uniform_real_distribution<SCALAR_TYPE> distB(SCALAR_TYPE(-8.0f), SCALAR_TYPE(8.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB[VEC_LEN];
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = distA(gen);
+        inputB[i] = distB(gen);
+        output[i] = std::pow(inputA[i], inputB[i]);
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(inputB);
+        VEC_TYPE vec2 = vec0.pow(vec1);
+        vec2.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "POWV gen");
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1(inputB);
+        VEC_TYPE vec2;
+        vec2 = UME::SIMD::FUNCTIONS::pow(vec0, vec1);
+        vec2.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION(inRange, "POWV(function) gen");
+    }
+}
+
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN>
+void genericPOWSTest_random()
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_real_distribution<SCALAR_TYPE> distA(SCALAR_TYPE(0.1f), SCALAR_TYPE(10.0f));
+    std::uniform_real_distribution<SCALAR_TYPE> distB(SCALAR_TYPE(-8.0f), SCALAR_TYPE(8.0f));
+
+    SCALAR_TYPE inputA[VEC_LEN];
+    SCALAR_TYPE inputB = distB(gen);
+    SCALAR_TYPE output[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputA[i] = distA(gen);
+        output[i] = std::pow(inputA[i], inputB);
+    }
+
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputA);
+        VEC_TYPE vec1 = vec0.pow(inputB);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, output, VEC_LEN, SCALAR_TYPE(0.01f));
+        vec0.store(values);
+        bool isUnmodified = valuesInRange(values, inputA, VEC_LEN, SCALAR_TYPE(0.01f));
+        CHECK_CONDITION((inRange & isUnmodified), "POWS gen");
+    }
+}
+
 template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN, typename DATA_SET>
 void genericSINTest()
 {
@@ -11048,12 +11461,14 @@ void genericBaseInterfaceTest()
     genericLOAD_STORETest<VEC_TYPE, SCALAR_TYPE, VEC_LEN, DATA_SET>();
     genericMLOADTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
     genericMSTORETest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
+    genericLOADN_STORENTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
     genericLOADA_STOREATest<VEC_TYPE, SCALAR_TYPE, VEC_LEN, DATA_SET>();
     genericMLOADATest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
     genericMSTOREATest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
     // SWIZZLE
     genericSWIZZLETest_random<VEC_TYPE, SCALAR_TYPE, SWIZZLE_TYPE, VEC_LEN>();
     // SWIZZLEA
+    genericSWIZZLEATest_random<VEC_TYPE, SCALAR_TYPE, SWIZZLE_TYPE, VEC_LEN>();
     genericSORTATest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     genericSORTDTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     genericBLENDVTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
@@ -11215,6 +11630,8 @@ void genericIntegerInterfaceTest()
     genericREMVTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     genericMREMVTest_random<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN>();
     genericREMSTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericDIVDTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericREMDTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
 
     genericLANDVTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     genericLORVTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
@@ -11287,6 +11704,7 @@ void genericGatherScatterInterfaceTest()
     genericMSCATTERSTest_random<VEC_TYPE, SCALAR_TYPE, SCALAR_UINT_TYPE, MASK_TYPE, VEC_LEN>();
     genericSCATTERVTest_random<VEC_TYPE, SCALAR_TYPE, UINT_VEC_TYPE, SCALAR_UINT_TYPE, VEC_LEN>();
     genericMSCATTERVTest_random<VEC_TYPE, SCALAR_TYPE, UINT_VEC_TYPE, SCALAR_UINT_TYPE, MASK_TYPE, VEC_LEN>();
+    genericSCATTERADDVTest_random<VEC_TYPE, SCALAR_TYPE, UINT_VEC_TYPE, SCALAR_UINT_TYPE, MASK_TYPE, VEC_LEN>();
 }
 
 template<typename VEC_TYPE, typename UINT_VEC_TYPE, typename SCALAR_TYPE, typename UINT_SCALAR_TYPE, typename MASK_TYPE, int VEC_LEN, typename DATA_SET>
@@ -11340,6 +11758,86 @@ void genericSignInterfaceTest()
     genericCOPYSIGNTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
 }
 
+template<typename VEC_TYPE, typename SCALAR_TYPE, int VEC_LEN, UME::SIMD::Precision PRECISION>
+void genericPRECISIONTest_random(SCALAR_TYPE errMargin, const char * tierName)
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    // Fast and Approx tiers do not handle special values, so keep inputs in range
+    std::uniform_real_distribution<SCALAR_TYPE> distExp(SCALAR_TYPE(-20.0f), SCALAR_TYPE(20.0f));
+    std::uniform_real_distribution<SCALAR_TYPE> distLog(SCALAR_TYPE(-10.0f), SCALAR_TYPE(10.0f));
+    std::uniform_real_distribution<SCALAR_TYPE> distSin(SCALAR_TYPE(0.1f), SCALAR_TYPE(3.0f));
+    std::uniform_real_distribution<SCALAR_TYPE> distCos(SCALAR_TYPE(-1.4f), SCALAR_TYPE(1.4f));
+
+    SCALAR_TYPE inputExp[VEC_LEN], inputLog[VEC_LEN], inputSin[VEC_LEN], inputCos[VEC_LEN];
+    SCALAR_TYPE outputExp[VEC_LEN], outputLog[VEC_LEN], outputSin[VEC_LEN], outputCos[VEC_LEN];
+
+    for (int i = 0; i < VEC_LEN; i++) {
+        inputExp[i] = distExp(gen);
+        inputLog[i] = std::exp(distLog(gen));
+        inputSin[i] = (i & 1) ? -distSin(gen) : distSin(gen);
+        inputCos[i] = distCos(gen);
+        outputExp[i] = std::exp(inputExp[i]);
+        outputLog[i] = std::log(inputLog[i]);
+        outputSin[i] = std::sin(inputSin[i]);
+        outputCos[i] = std::cos(inputCos[i]);
+    }
+
+    std::string name(tierName);
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputExp);
+        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::exp<PRECISION>(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, outputExp, VEC_LEN, errMargin);
+        CHECK_CONDITION(inRange, ("EXP<" + name + ">(function) gen").c_str());
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputLog);
+        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::log<PRECISION>(vec0);
+        vec1.store(values);
+        // log(x) crosses zero at x == 1, so compare with an absolute margin as well
+        bool inRange = true;
+        for (int i = 0; i < VEC_LEN; i++) {
+            inRange &= std::abs(values[i] - outputLog[i]) <= errMargin * std::max(SCALAR_TYPE(1.0f), std::abs(outputLog[i]));
+        }
+        CHECK_CONDITION(inRange, ("LOG<" + name + ">(function) gen").c_str());
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputSin);
+        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::sin<PRECISION>(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, outputSin, VEC_LEN, errMargin);
+        CHECK_CONDITION(inRange, ("SIN<" + name + ">(function) gen").c_str());
+    }
+    {
+        SCALAR_TYPE values[VEC_LEN];
+        VEC_TYPE vec0(inputCos);
+        VEC_TYPE vec1 = UME::SIMD::FUNCTIONS::cos<PRECISION>(vec0);
+        vec1.store(values);
+        bool inRange = valuesInRange(values, outputCos, VEC_LEN, errMargin);
+        CHECK_CONDITION(inRange, ("COS<" + name + ">(function) gen").c_str());
+    }
+    {
+        SCALAR_TYPE values0[VEC_LEN], values1[VEC_LEN];
+        VEC_TYPE vec0(inputSin);
+        VEC_TYPE vec1, vec2;
+        UME::SIMD::FUNCTIONS::sincos<PRECISION>(vec0, vec1, vec2);
+        vec1.store(values0);
+        vec2.store(values1);
+        SCALAR_TYPE expectedCos[VEC_LEN];
+        for (int i = 0; i < VEC_LEN; i++) expectedCos[i] = std::cos(inputSin[i]);
+        bool inRange = valuesInRange(values0, outputSin, VEC_LEN, errMargin);
+        // cos(x) has a zero at pi/2, allow an absolute margin there
+        for (int i = 0; i < VEC_LEN; i++) {
+            inRange &= std::abs(values1[i] - expectedCos[i]) <= errMargin;
+        }
+        CHECK_CONDITION(inRange, ("SINCOS<" + name + ">(function) gen").c_str());
+    }
+}
+
 template<typename VEC_TYPE, typename SCALAR_TYPE, typename VEC_INT_TYPE, typename SCALAR_INT_TYPE, typename MASK_TYPE, int VEC_LEN, typename DATA_SET>
 void genericFloatInterfaceTest()
 {
@@ -11359,6 +11857,8 @@ void genericFloatInterfaceTest()
     genericISSUBTest<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN, DATA_SET>();
     genericISZEROTest<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN, DATA_SET>();
     genericISZEROSUBTest<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN, DATA_SET>();
+    genericCOUNT_IF_COMPACTTest<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericARGMAX_ARGMINTest<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     
     genericSQRTest<VEC_TYPE, SCALAR_TYPE, VEC_LEN, DATA_SET>();
     genericMSQRTest<VEC_TYPE, SCALAR_TYPE, MASK_TYPE, VEC_LEN, DATA_SET>();
@@ -11374,6 +11874,11 @@ void genericFloatInterfaceTest()
     genericLOGTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     genericLOG2Test_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     genericLOG10Test_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericPOWVTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericPOWSTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
+    genericPRECISIONTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN, UME::SIMD::Precision::Accurate>(SCALAR_TYPE(16) * std::numeric_limits<SCALAR_TYPE>::epsilon(), "Accurate");
+    genericPRECISIONTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN, UME::SIMD::Precision::Fast>(SCALAR_TYPE(16) * std::numeric_limits<SCALAR_TYPE>::epsilon(), "Fast");
+    genericPRECISIONTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN, UME::SIMD::Precision::Approx>(SCALAR_TYPE(1.0e-3f), "Approx");
 
     genericSINTest_random<VEC_TYPE, SCALAR_TYPE, VEC_LEN>();
     // MSIN
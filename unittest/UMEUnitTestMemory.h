@@ -53,6 +53,106 @@ void generic_AlignedAllocatorTest(std::string const & scalar_type) {
     allocator.deallocate(mem, sizeof(SCALAR_T)*100);
 }
 
+template<typename SCALAR_T, int SIMD_STRIDE, typename MEMORY>
+void generic_MemoryAllocatorTest(std::string const & scalar_type, std::string const & memory_type) {
+    
+    UME::AlignedAllocator<SCALAR_T, SIMD_STRIDE, MEMORY> allocator;
+    int alignment = UME::SIMD::SIMDVec<SCALAR_T, SIMD_STRIDE>::alignment();
+    
+    SCALAR_T* mem0 = allocator.allocate(100);
+    SCALAR_T* mem1 = allocator.allocate(3);
+    bool isAligned = ((uint64_t(mem0) % alignment) == 0) && ((uint64_t(mem1) % alignment) == 0);
+    bool isNullptr = (mem0 == nullptr) || (mem1 == nullptr);
+    // Buffers should not overlap
+    for (int i = 0; i < 100; i++) mem0[i] = SCALAR_T(1);
+    for (int i = 0; i < 3; i++) mem1[i] = SCALAR_T(2);
+    bool isUnmodified = true;
+    for (int i = 0; i < 100; i++) isUnmodified &= (mem0[i] == SCALAR_T(1));
+
+    std::vector<SCALAR_T, UME::AlignedAllocator<SCALAR_T, SIMD_STRIDE, MEMORY>> vec(257, SCALAR_T(3));
+    bool isVectorAligned = ((uint64_t(vec.data()) % alignment) == 0);
+
+    std::string msg = "ALLOCATOR <";
+    msg.append(scalar_type);
+    msg.append(", ");
+    msg.append(std::to_string(SIMD_STRIDE));
+    msg.append(", ");
+    msg.append(memory_type);
+    msg.append(">");
+    check_condition(isAligned && !isNullptr && isUnmodified && isVectorAligned, msg.c_str());
+    
+    allocator.deallocate(mem1, 3);
+    allocator.deallocate(mem0, 100);
+}
+
+void arena_ResetTest() {
+    UME::MemoryArena arena(4096);
+    void* first = arena.allocate(100, 64);
+    arena.allocate(200, 64);
+    arena.reset();
+    void* second = arena.allocate(100, 64);
+    // Growing past the first block merges blocks on reset
+    arena.allocate(10000, 128);
+    arena.reset();
+    void* third = arena.allocate(10000, 128);
+    void* fourth = arena.allocate(100, 128);
+    bool isAligned = ((uint64_t(third) % 128) == 0) && ((uint64_t(fourth) % 128) == 0);
+    check_condition((first == second) && isAligned && (arena.used() >= 10100), "ARENA reset");
+
+    UME::MemoryArena hugeArena(1 << 22, true);
+    char* huge = (char*)hugeArena.allocate(1 << 21, 64);
+    for (int i = 0; i < (1 << 21); i += 4096) huge[i] = 1;
+    check_condition(huge != nullptr && ((uint64_t(huge) % 64) == 0), "ARENA huge pages");
+}
+
+void pool_ReuseTest() {
+    UME::MemoryPool pool;
+    void* first = pool.allocate(100, 32);
+    pool.deallocate(first, 100, 32);
+    void* second = pool.allocate(120, 32);
+    void* third = pool.allocate(120, 32);
+    // Larger than MAX_POOLED_SIZE goes to the system allocator
+    void* large = pool.allocate(1 << 20, 64);
+    bool isAligned = ((uint64_t(third) % 32) == 0) && ((uint64_t(large) % 64) == 0);
+    check_condition((first == second) && (second != third) && isAligned, "POOL reuse");
+    pool.deallocate(large, 1 << 20, 64);
+    pool.deallocate(third, 120, 32);
+    pool.deallocate(second, 120, 32);
+}
+
+void memory_MemCopyMemSetTest() {
+    const std::size_t SIZE = 4096;
+    char* src = (char*)UME::DynamicMemory::AlignedMalloc(SIZE, 64);
+    char* dst = (char*)UME::DynamicMemory::AlignedMalloc(SIZE, 64);
+    for (std::size_t i = 0; i < SIZE; i++) src[i] = char(i * 7 + 3);
+
+    std::size_t threshold = UME::DynamicMemory::StreamingThreshold();
+    bool copyCorrect = true;
+    bool setCorrect = true;
+    // Threshold 0 forces the streaming path for every size
+    for (int streaming = 0; streaming < 2; streaming++) {
+        UME::DynamicMemory::SetStreamingThreshold(streaming ? 0 : threshold);
+        for (std::size_t offset = 0; offset < 70; offset += 13) {
+            for (std::size_t size = 0; size < SIZE - 140; size += 251) {
+                std::memset(dst, 0, SIZE);
+                UME::DynamicMemory::MemCopy(dst + offset, src + 2 * offset, size);
+                copyCorrect &= (std::memcmp(dst + offset, src + 2 * offset, size) == 0);
+                copyCorrect &= (offset == 0 || dst[offset - 1] == 0) && dst[offset + size] == 0;
+
+                UME::DynamicMemory::MemSet(dst + offset, 0x3C, size);
+                for (std::size_t i = 0; i < size; i++) setCorrect &= (dst[offset + i] == 0x3C);
+                setCorrect &= (offset == 0 || dst[offset - 1] == 0) && dst[offset + size] == 0;
+            }
+        }
+    }
+    UME::DynamicMemory::SetStreamingThreshold(threshold);
+    check_condition(copyCorrect, "MEMCOPY");
+    check_condition(setCorrect, "MEMSET");
+
+    UME::DynamicMemory::AlignedFree(src);
+    UME::DynamicMemory::AlignedFree(dst);
+}
+
 int test_allocators(bool supressMessages)
 {
     char header[] = "UME::AlignedAllocator test";
@@ -121,6 +221,20 @@ int test_allocators(bool supressMessages)
     generic_AlignedAllocatorTest<double, 4> (std::string("double(64b)"));
     generic_AlignedAllocatorTest<double, 8> (std::string("double(64b)"));
     generic_AlignedAllocatorTest<double, 16> (std::string("double(64b)"));
+
+    generic_MemoryAllocatorTest<float, 8, UME::DynamicMemory> (std::string("float(32b)"), std::string("DynamicMemory"));
+    generic_MemoryAllocatorTest<double, 8, UME::DynamicMemory> (std::string("double(64b)"), std::string("DynamicMemory"));
+    generic_MemoryAllocatorTest<uint8_t, 64, UME::ArenaMemory> (std::string("uint8_t"), std::string("ArenaMemory"));
+    generic_MemoryAllocatorTest<float, 8, UME::ArenaMemory> (std::string("float(32b)"), std::string("ArenaMemory"));
+    generic_MemoryAllocatorTest<double, 16, UME::ArenaMemory> (std::string("double(64b)"), std::string("ArenaMemory"));
+    UME::MemoryArena::threadLocal().reset();
+    generic_MemoryAllocatorTest<uint8_t, 64, UME::PoolMemory> (std::string("uint8_t"), std::string("PoolMemory"));
+    generic_MemoryAllocatorTest<float, 8, UME::PoolMemory> (std::string("float(32b)"), std::string("PoolMemory"));
+    generic_MemoryAllocatorTest<double, 16, UME::PoolMemory> (std::string("double(64b)"), std::string("PoolMemory"));
+    generic_MemoryAllocatorTest<int32_t, 16, UME::PoolMemory> (std::string("int32_t"), std::string("PoolMemory"));
+    arena_ResetTest();
+    pool_ReuseTest();
+    memory_MemCopyMemSetTest();
     
     return g_failCount;
 }
@@ -2,7 +2,27 @@
 
 int main()
 {
-    std::cout << "Native (default) vector lengths:\n";
+    UME::SIMD::CPUFeatures const & f = UME::SIMD::RuntimeISA::features();
+
+    std::cout << "Runtime CPU features:\n";
+    std::cout << "sse2       : " << f.sse2 << "\n";
+    std::cout << "sse3       : " << f.sse3 << "\n";
+    std::cout << "ssse3      : " << f.ssse3 << "\n";
+    std::cout << "sse4.1     : " << f.sse41 << "\n";
+    std::cout << "sse4.2     : " << f.sse42 << "\n";
+    std::cout << "avx        : " << f.avx << "\n";
+    std::cout << "fma        : " << f.fma << "\n";
+    std::cout << "avx2       : " << f.avx2 << "\n";
+    std::cout << "avx512f    : " << f.avx512f << "\n";
+    std::cout << "avx512cd   : " << f.avx512cd << "\n";
+    std::cout << "avx512bw   : " << f.avx512bw << "\n";
+    std::cout << "avx512dq   : " << f.avx512dq << "\n";
+    std::cout << "avx512vl   : " << f.avx512vl << "\n";
+
+    std::cout << "\nBest runtime plugin  : " << UME::SIMD::RuntimeISA::name(UME::SIMD::RuntimeISA::best()) << "\n";
+    std::cout << "Compiled-in plugin   : " << UME::SIMD::RuntimeISA::name(UME_SIMD_COMPILED_ISA) << "\n";
+
+    std::cout << "\nNative (default) vector lengths of the compiled-in plugin:\n";
     
     std::cout << "uint8_t    : " << UME::SIMD::ISATraits::NativeLength<uint8_t>() << "\n";
     std::cout << "uint16_t   : " << UME::SIMD::ISATraits::NativeLength<uint16_t>() << "\n";